@@ -55,6 +55,92 @@ typedef enum
   * @}
   */
 
+#if defined(USE_HAL_OS_HOOKS) && (USE_HAL_OS_HOOKS == 1U)
+/** @defgroup HAL_OS_Hooks OS Hooks
+  * @{
+  */
+typedef struct
+{
+  HAL_StatusTypeDef (*Wait)(const void *pObject, uint32_t Timeout); /*!< Block the calling thread until Signal()
+                                                                          is called for pObject, or for Timeout ms.
+                                                                          Returns HAL_OK or HAL_TIMEOUT. A Signal()
+                                                                          given before Wait() must not be lost */
+  void (*Signal)(const void *pObject);                               /*!< Wake up the thread waiting on pObject,
+                                                                          called from interrupt context */
+} HAL_OS_HooksTypeDef;
+/**
+  * @}
+  */
+#endif /* USE_HAL_OS_HOOKS */
+
+#if defined(USE_HAL_CLOCK_GATING) && (USE_HAL_CLOCK_GATING == 1U)
+/** @defgroup HAL_Clock_Gating Clock Gating
+  * @{
+  */
+typedef struct __HAL_ClockGateTypeDef
+{
+  const void *Handle;                       /*!< Handle of the driver, whose lock re-enables the clock */
+  __IO uint32_t *pEnableReg;                /*!< RCC clock enable register of the peripheral, e.g. &RCC->APB2ENR */
+  uint32_t EnableMask;                      /*!< Clock enable bits in pEnableReg, e.g. RCC_APB2ENR_SPI1EN */
+  uint32_t IdleTime;                        /*!< Time in ms without handle lock before gating the clock, not 0 */
+  uint32_t (*IsIdle)(const void *Handle);   /*!< Returns 1 when the handle is in the READY state, nothing
+                                                 ongoing on the peripheral, 0 otherwise */
+  __IO uint32_t LastActivity;               /*!< Tick of the last handle lock, internal use */
+  __IO uint32_t Gated;                      /*!< 1 while the clock is gated, internal use */
+  uint32_t GateCount;                       /*!< Number of times the clock was gated */
+  struct __HAL_ClockGateTypeDef *pNext;     /*!< Next registered clock gate, internal use */
+} HAL_ClockGateTypeDef;
+/**
+  * @}
+  */
+#endif /* USE_HAL_CLOCK_GATING */
+
+/** @defgroup HAL_Cycle_Measure Cycle Measure
+  * @{
+  */
+typedef struct
+{
+  uint32_t Start;       /*!< Cycle counter value at the start of the current measurement */
+  uint32_t Count;       /*!< Number of measurements */
+  uint32_t Min;         /*!< Minimum measured duration in cycles */
+  uint32_t Max;         /*!< Maximum measured duration in cycles */
+  uint64_t Total;       /*!< Sum of the measured durations in cycles */
+} HAL_CycleMeasureTypeDef;
+/**
+  * @}
+  */
+
+/** @defgroup HAL_Memory_Pool Memory Pool
+  * @{
+  */
+typedef struct __HAL_MemPoolTypeDef
+{
+  uint32_t Base;                       /*!< Start address of the pool memory */
+  uint32_t Size;                       /*!< Size of the pool memory in bytes */
+  uint32_t Offset;                     /*!< Offset of the first free byte */
+  uint32_t Masters;                    /*!< Bus masters reaching the pool memory,
+                                            a combination of @ref HAL_Memory_Master */
+  struct __HAL_MemPoolTypeDef *pNext;  /*!< Next registered pool, internal use */
+} HAL_MemPoolTypeDef;
+/**
+  * @}
+  */
+
+#if defined(USE_HAL_TRACE) && (USE_HAL_TRACE == 1U)
+/** @defgroup HAL_Trace_Record Trace Record
+  * @{
+  */
+typedef struct
+{
+  uint32_t Timestamp;   /*!< DWT cycle counter value when the event occurred */
+  uint32_t Event;       /*!< Event identifier, ORed with HAL_TRACE_EXIT_FLAG for an exit event */
+  const void *pHandle;  /*!< Handle of the driver, NULL when the function has no handle */
+} HAL_TraceRecordTypeDef;
+/**
+  * @}
+  */
+#endif /* USE_HAL_TRACE */
+
 /**
   * @}
   */
@@ -71,6 +157,40 @@ extern HAL_TickFreqTypeDef      uwTickFreq;
   */
 
 /* Exported constants --------------------------------------------------------*/
+/** @defgroup HAL_Exported_Constants HAL Exported Constants
+  * @{
+  */
+
+/** @defgroup HAL_Memory_Region Memory Region
+  * @{
+  */
+#define HAL_MEM_REGION_NONE       0x00U  /*!< Address not mapped to a memory */
+#define HAL_MEM_REGION_SRAM1      0x01U  /*!< SRAM1 */
+#define HAL_MEM_REGION_SRAM2      0x02U  /*!< SRAM2 */
+#define HAL_MEM_REGION_SRAM3      0x03U  /*!< SRAM3 */
+#define HAL_MEM_REGION_BKPSRAM    0x04U  /*!< Backup SRAM, on the AHB peripheral bus */
+#define HAL_MEM_REGION_FLASH      0x05U  /*!< Embedded flash memory */
+#define HAL_MEM_REGION_EXTERNAL   0x06U  /*!< FMC and OCTOSPI external memories */
+#define HAL_MEM_REGION_PERIPH     0x07U  /*!< Peripheral registers */
+/**
+  * @}
+  */
+
+/** @defgroup HAL_Memory_Master Memory Master
+  * @{
+  */
+#define HAL_MEM_MASTER_CPU        0x01U  /*!< Cortex-M33 */
+#define HAL_MEM_MASTER_GPDMA      0x02U  /*!< GPDMA1 and GPDMA2 */
+#define HAL_MEM_MASTER_ETH        0x04U  /*!< Ethernet DMA */
+#define HAL_MEM_MASTER_SDMMC      0x08U  /*!< SDMMC1 and SDMMC2 internal DMA */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
 /** @defgroup SBS_Exported_Constants SBS Exported Constants
   * @{
   */
@@ -802,6 +922,9 @@ extern HAL_TickFreqTypeDef      uwTickFreq;
 #define IS_TICKFREQ(FREQ) (((FREQ) == HAL_TICK_FREQ_10HZ)  || \
                            ((FREQ) == HAL_TICK_FREQ_100HZ) || \
                            ((FREQ) == HAL_TICK_FREQ_1KHZ))
+
+#define IS_HAL_MEM_REACHABLE(MASTERS, ADDRESS, SIZE) \
+  (HAL_MemRegion_CheckReach((MASTERS), (uint32_t)(ADDRESS), (SIZE)) == HAL_OK)
 /**
   * @}
   */
@@ -834,6 +957,7 @@ HAL_StatusTypeDef    HAL_InitTick(uint32_t TickPriority);
 void                 HAL_IncTick(void);
 void                 HAL_Delay(uint32_t Delay);
 uint32_t             HAL_GetTick(void);
+uint64_t             HAL_GetTickUs64(void);
 uint32_t             HAL_GetTickPrio(void);
 HAL_StatusTypeDef    HAL_SetTickFreq(HAL_TickFreqTypeDef Freq);
 HAL_TickFreqTypeDef  HAL_GetTickFreq(void);
@@ -845,6 +969,24 @@ uint32_t             HAL_GetDEVID(void);
 uint32_t             HAL_GetUIDw0(void);
 uint32_t             HAL_GetUIDw1(void);
 uint32_t             HAL_GetUIDw2(void);
+#if defined(USE_HAL_OS_HOOKS) && (USE_HAL_OS_HOOKS == 1U)
+HAL_StatusTypeDef    HAL_OS_RegisterHooks(const HAL_OS_HooksTypeDef *pHooks);
+uint32_t             HAL_OS_IsBlockingAllowed(void);
+HAL_StatusTypeDef    HAL_OS_Wait(const void *pObject, uint32_t Timeout);
+void                 HAL_OS_Signal(const void *pObject);
+#endif /* USE_HAL_OS_HOOKS */
+#if defined(USE_HAL_REQUEST) && (USE_HAL_REQUEST == 1U)
+HAL_StatusTypeDef    HAL_Request_Submit(HAL_RequestTypeDef *pReq);
+void                 HAL_Request_Chain(HAL_RequestTypeDef *pReq, HAL_RequestTypeDef *pNext);
+void                 HAL_Request_Complete(HAL_RequestTypeDef *pReq, HAL_StatusTypeDef Status);
+void                 HAL_RequestQueue_Init(HAL_RequestQueueTypeDef *pQueue);
+HAL_RequestTypeDef  *HAL_RequestQueue_Get(HAL_RequestQueueTypeDef *pQueue);
+#endif /* USE_HAL_REQUEST */
+#if defined(USE_HAL_CLOCK_GATING) && (USE_HAL_CLOCK_GATING == 1U)
+HAL_StatusTypeDef    HAL_ClockGate_Register(HAL_ClockGateTypeDef *pGate);
+HAL_StatusTypeDef    HAL_ClockGate_Unregister(HAL_ClockGateTypeDef *pGate);
+void                 HAL_ClockGate_Process(void);
+#endif /* USE_HAL_CLOCK_GATING */
 
 /**
   * @}
@@ -859,6 +1001,21 @@ void                 HAL_DBGMCU_EnableDBGStopMode(void);
 void                 HAL_DBGMCU_DisableDBGStopMode(void);
 void                 HAL_DBGMCU_EnableDBGStandbyMode(void);
 void                 HAL_DBGMCU_DisableDBGStandbyMode(void);
+void                 HAL_CycleCounter_Enable(void);
+uint32_t             HAL_CycleCounter_Get(void);
+uint32_t             HAL_CycleCounter_ToNs(uint32_t Cycles);
+void                 HAL_CycleMeasure_Reset(HAL_CycleMeasureTypeDef *pMeasure);
+void                 HAL_CycleMeasure_Start(HAL_CycleMeasureTypeDef *pMeasure);
+uint32_t             HAL_CycleMeasure_Stop(HAL_CycleMeasureTypeDef *pMeasure);
+uint32_t             HAL_MemRegion_Get(uint32_t Address);
+HAL_StatusTypeDef    HAL_MemRegion_CheckReach(uint32_t Masters, uint32_t Address, uint32_t Size);
+HAL_StatusTypeDef    HAL_MemPool_Init(HAL_MemPoolTypeDef *pPool, void *pBase, uint32_t Size);
+void                 HAL_MemPool_Reset(HAL_MemPoolTypeDef *pPool);
+void                *HAL_MemPool_Alloc(uint32_t Masters, uint32_t Size, uint32_t Align);
+#if defined(USE_HAL_TRACE) && (USE_HAL_TRACE == 1U)
+HAL_StatusTypeDef    HAL_Trace_Init(HAL_TraceRecordTypeDef *pBuffer, uint32_t Size);
+uint32_t             HAL_Trace_FlushITM(uint32_t Port);
+#endif /* USE_HAL_TRACE */
 
 /**
   * @}
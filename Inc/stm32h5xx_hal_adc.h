@@ -490,6 +490,14 @@ typedef struct
   __IO uint32_t                 ErrorCode;                     /*!< ADC Error code */
   ADC_InjectionConfigTypeDef    InjectionConfig ;              /*!< ADC injected channel configuration build-up
                                                                   structure */
+  __IO uint32_t                 DeinterleaveBlock;             /*!< ADC deinterleaved DMA stream: index of the next
+                                                                    half buffer to be completed (0 or 1) */
+#if defined(ADC_MULTIMODE_SUPPORT)
+  struct __ADC_MultiModeStreamTypeDef *pMultiModeStream;       /*!< ADC multimode streaming acquisition, NULL when
+                                                                    not running */
+#endif /* ADC_MULTIMODE_SUPPORT */
+  struct __ADC_ThresholdCaptureTypeDef *pThresholdCapture;     /*!< ADC threshold triggered capture, NULL when not
+                                                                    running */
 #if (USE_HAL_ADC_REGISTER_CALLBACKS == 1)
   void (* ConvCpltCallback)(struct __ADC_HandleTypeDef *hadc);              /*!< ADC conversion complete callback */
   void (* ConvHalfCpltCallback)(struct __ADC_HandleTypeDef *hadc);          /*!< ADC conversion DMA half-transfer
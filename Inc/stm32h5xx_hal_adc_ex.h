@@ -272,8 +272,155 @@ typedef struct
                                     from 1 to 12 clock cycles for 12 bits, from 1 to 10 clock cycles for 10 bits,
                                     from 1 to 8 clock cycles for 8 bits, from 1 to 6 clock cycles for 6 bits.     */
 } ADC_MultiModeTypeDef;
+
+/**
+  * @brief  Structure definition of ADC multimode streaming acquisition
+  * @note   The buffers are provided by the user and must stay allocated while the stream runs.
+  */
+typedef struct __ADC_MultiModeStreamTypeDef
+{
+  uint32_t          *pRawBuffer;        /*!< DMA buffer of (2 * BlockSize) packed ADC common data words */
+
+  uint16_t          *pMasterData;       /*!< Buffer of BlockSize ADC master results of the last block */
+
+  uint16_t          *pSlaveData;        /*!< Buffer of BlockSize ADC slave results of the last block */
+
+  uint32_t          BlockSize;          /*!< Number of ADC master and slave results pairs per block */
+
+  const __IO uint32_t *pTimestampCounter; /*!< Counter latched at each block completion (for instance TIMx->CNT or
+                                             LPTIMx->CNT). This parameter can be NULL if no timestamp is needed */
+
+  uint32_t          Timestamp;          /*!< Counter value latched at the completion of the last block */
+
+  uint32_t          BlockIndex;         /*!< Number of blocks completed since the stream start, dropped ones
+                                             included */
+
+  uint32_t          DroppedBlocks;      /*!< Number of blocks dropped since the stream start */
+
+  __IO uint32_t     BlockPending;       /*!< Set when a block is unpacked, cleared by
+                                             HAL_ADCEx_MultiModeStreamRelease() */
+} ADC_MultiModeStreamTypeDef;
 #endif /* ADC_MULTIMODE_SUPPORT */
 
+/**
+  * @brief  Structure definition of ADC acquisition target
+  */
+typedef struct
+{
+  uint32_t AdcClockFreq;        /*!< ADC kernel clock frequency after prescaler, in Hz */
+
+  uint32_t TimerClockFreq;      /*!< Counter clock frequency of the timer triggering the ADC, in Hz.
+                                     This parameter can be 0 if the ADC is not triggered by a timer */
+
+  uint32_t TargetResolution;    /*!< Target effective resolution in bits, from the ADC native resolution
+                                     (Init.Resolution) up to 4 more bits and at most 16 bits */
+
+  uint32_t OutputRate;          /*!< Output data rate of the regular sequence (per channel), in Hz */
+} ADC_AcquisitionTargetTypeDef;
+
+/**
+  * @brief  Structure definition of ADC acquisition profile
+  */
+typedef struct
+{
+  FunctionalState OversamplingMode; /*!< Oversampling of ADC group regular enabled or disabled */
+
+  uint32_t Ratio;               /*!< Oversampling ratio.
+                                     This parameter can be a value of @ref ADC_HAL_EC_OVS_RATIO */
+
+  uint32_t RightBitShift;       /*!< Oversampling right bit shift.
+                                     This parameter can be a value of @ref ADC_HAL_EC_OVS_SHIFT */
+
+  uint32_t SamplingTime;        /*!< Sampling time of the channels of all the regular sequencer ranks.
+                                     This parameter can be a value of @ref ADC_HAL_EC_CHANNEL_SAMPLINGTIME */
+
+  uint32_t TimerPeriod;         /*!< Auto-reload value of the trigger timer (0 if no timer clock) */
+} ADC_AcquisitionProfileTypeDef;
+
+/**
+  * @brief  Structure definition of ADC group regular deinterleaved DMA stream
+  * @note   The queue and the nodes are provided by the user and must stay allocated while the stream runs.
+  * @note   The buffer is organized per channel (structure of arrays): the samples of the sequencer rank k
+  *         are stored from pData[k * SamplesPerChannel] to pData[((k + 1) * SamplesPerChannel) - 1].
+  */
+typedef struct
+{
+  DMA_QListTypeDef  *pQueue;            /*!< Linked-list queue used to build the circular stream */
+
+  DMA_NodeTypeDef   *pNodes;            /*!< Array of 2 linked-list nodes, one per half buffer */
+
+  uint32_t          Request;            /*!< DMA request of the ADC instance.
+                                             This parameter can be a value of @ref DMA_Request_Selection */
+
+  uint16_t          *pData;             /*!< Destination buffer of (number of ranks * SamplesPerChannel) halfwords */
+
+  uint32_t          SamplesPerChannel;  /*!< Number of samples per channel in the destination buffer.
+                                             This parameter must be an even number from 2 to 4096 */
+} ADC_DeinterleaveConfTypeDef;
+
+/**
+  * @brief  Structure definition of ADC low-power sampler
+  * @note   The buffer is provided by the user and must stay allocated while the sampler runs.
+  */
+typedef struct
+{
+  uint32_t          Trigger;            /*!< External trigger of the conversions, typically a low-power timer
+                                             running in Sleep mode (ADC_EXTERNALTRIG_LPTIM1_CH1,
+                                             ADC_EXTERNALTRIG_LPTIM2_CH1).
+                                             This parameter can be a value of @ref ADC_regular_external_trigger_source */
+
+  uint32_t          *pData;             /*!< Destination buffer of 2 blocks of BlockSize conversions */
+
+  uint32_t          BlockSize;          /*!< Number of conversions per block */
+
+  FunctionalState   WakeUpWindow;       /*!< Wake-up on a conversion out of the thresholds window (analog watchdog 1
+                                             on all the regular channels), in addition to the blocks completion.
+                                             This parameter can be set to ENABLE or DISABLE */
+
+  uint32_t          HighThreshold;      /*!< Wake-up high threshold, used if WakeUpWindow is ENABLE */
+
+  uint32_t          LowThreshold;       /*!< Wake-up low threshold, used if WakeUpWindow is ENABLE */
+} ADC_LowPowerSamplerConfTypeDef;
+
+/**
+  * @brief  Structure definition of ADC threshold triggered capture
+  * @note   The buffers are provided by the user and must stay allocated while the capture runs.
+  */
+typedef struct __ADC_ThresholdCaptureTypeDef
+{
+  uint32_t          WatchdogNumber;     /*!< Analog watchdog triggering the capture, applied to the regular group.
+                                             This parameter can be a value of @ref ADC_HAL_EC_AWD_NUMBER */
+
+  uint32_t          HighThreshold;      /*!< Trigger high threshold, in the ADC resolution unit */
+
+  uint32_t          LowThreshold;       /*!< Trigger low threshold, in the ADC resolution unit */
+
+  uint32_t          *pRingBuffer;       /*!< DMA ring buffer of RingSize conversions, holding the pre-trigger history */
+
+  uint32_t          RingSize;           /*!< Number of conversions of the ring buffer */
+
+  uint32_t          *pCaptureBuffer;    /*!< Buffer of (PreTriggerSamples + PostTriggerSamples) conversions, filled
+                                             with the conversions around the trigger */
+
+  uint32_t          PreTriggerSamples;  /*!< Number of conversions kept before the trigger conversion */
+
+  uint32_t          PostTriggerSamples; /*!< Number of conversions kept from the trigger conversion, not null.
+                                             PreTriggerSamples + PostTriggerSamples must not exceed RingSize / 2 */
+
+  uint32_t          TriggerIndex;       /*!< Ring buffer index of the trigger conversion of the last capture */
+
+  uint32_t          WriteIndex;         /*!< Ring buffer index of the next DMA write at the last update */
+
+  uint32_t          PostCount;          /*!< Number of post-trigger conversions written in the ring buffer */
+
+  __IO uint32_t     Triggered;          /*!< Set from the trigger until the capture buffer is filled */
+
+  __IO uint32_t     CapturePending;     /*!< Set when the capture buffer is filled, cleared by
+                                             HAL_ADCEx_ThresholdCaptureRearm() */
+
+  uint32_t          CaptureCount;       /*!< Number of captures since the start */
+} ADC_ThresholdCaptureTypeDef;
+
 /**
   * @}
   */
@@ -1265,8 +1412,27 @@ HAL_StatusTypeDef       HAL_ADCEx_InjectedStop_IT(ADC_HandleTypeDef *hadc);
 HAL_StatusTypeDef       HAL_ADCEx_MultiModeStart_DMA(ADC_HandleTypeDef *hadc, uint32_t *pData, uint32_t Length);
 HAL_StatusTypeDef       HAL_ADCEx_MultiModeStop_DMA(ADC_HandleTypeDef *hadc);
 uint32_t                HAL_ADCEx_MultiModeGetValue(const ADC_HandleTypeDef *hadc);
+HAL_StatusTypeDef       HAL_ADCEx_MultiModeStreamStart_DMA(ADC_HandleTypeDef *hadc,
+                                                           ADC_MultiModeStreamTypeDef *pStream);
+HAL_StatusTypeDef       HAL_ADCEx_MultiModeStreamStop_DMA(ADC_HandleTypeDef *hadc);
+HAL_StatusTypeDef       HAL_ADCEx_MultiModeStreamRelease(ADC_HandleTypeDef *hadc);
 #endif /* ADC_MULTIMODE_SUPPORT */
 
+/* ADC group regular deinterleaved DMA stream */
+HAL_StatusTypeDef       HAL_ADCEx_RegularStartDeinterleave_DMA(ADC_HandleTypeDef *hadc,
+                                                               const ADC_DeinterleaveConfTypeDef *pConfig);
+
+/* ADC low-power sampler */
+HAL_StatusTypeDef       HAL_ADCEx_LowPowerSamplerStart_DMA(ADC_HandleTypeDef *hadc,
+                                                           const ADC_LowPowerSamplerConfTypeDef *pConfig);
+HAL_StatusTypeDef       HAL_ADCEx_LowPowerSamplerStop_DMA(ADC_HandleTypeDef *hadc);
+
+/* ADC threshold triggered capture */
+HAL_StatusTypeDef       HAL_ADCEx_ThresholdCaptureStart_DMA(ADC_HandleTypeDef *hadc,
+                                                            ADC_ThresholdCaptureTypeDef *pCapture);
+HAL_StatusTypeDef       HAL_ADCEx_ThresholdCaptureStop_DMA(ADC_HandleTypeDef *hadc);
+HAL_StatusTypeDef       HAL_ADCEx_ThresholdCaptureRearm(ADC_HandleTypeDef *hadc);
+
 /* ADC retrieve conversion value intended to be used with polling or interruption */
 uint32_t                HAL_ADCEx_InjectedGetValue(const ADC_HandleTypeDef *hadc, uint32_t InjectedRank);
 
@@ -1305,6 +1471,13 @@ HAL_StatusTypeDef       HAL_ADCEx_DisableInjectedQueue(ADC_HandleTypeDef *hadc);
 HAL_StatusTypeDef       HAL_ADCEx_DisableVoltageRegulator(ADC_HandleTypeDef *hadc);
 HAL_StatusTypeDef       HAL_ADCEx_EnterADCDeepPowerDownMode(ADC_HandleTypeDef *hadc);
 
+/* ADC acquisition profile */
+HAL_StatusTypeDef       HAL_ADCEx_ComputeAcquisitionProfile(const ADC_HandleTypeDef *hadc,
+                                                            const ADC_AcquisitionTargetTypeDef *pTarget,
+                                                            ADC_AcquisitionProfileTypeDef *pProfile);
+HAL_StatusTypeDef       HAL_ADCEx_ApplyAcquisitionProfile(ADC_HandleTypeDef *hadc,
+                                                          const ADC_AcquisitionProfileTypeDef *pProfile);
+
 /**
   * @}
   */
@@ -1313,6 +1486,15 @@ HAL_StatusTypeDef       HAL_ADCEx_EnterADCDeepPowerDownMode(ADC_HandleTypeDef *h
   * @}
   */
 
+/* Private functions ---------------------------------------------------------*/
+/** @addtogroup ADCEx_Private_Functions
+  * @{
+  */
+void ADCEx_ThresholdCaptureTrigger(ADC_HandleTypeDef *hadc);
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -52,6 +52,9 @@ typedef struct
   __IO uint32_t SAESState;                  /*!< Internal state of the SAES instance                  */
 #endif /* (GENERATOR_C7AMBA_CCB_V1_0) */
   __IO uint32_t ErrorCode;                  /*!< Error code in case of HAL driver  error              */
+  struct __CCB_ECDSASignJobTypeDef *pSignJobs; /*!< ECDSA signature jobs queue processed in interrupt mode */
+  uint32_t SignJobNbr;                      /*!< Number of jobs in the ECDSA signature jobs queue     */
+  __IO uint32_t SignJobIndex;               /*!< Index of the ECDSA signature job being processed     */
 } CCB_HandleTypeDef;
 
 /** @brief  CCB Wrapping Key definition
@@ -102,6 +105,19 @@ typedef struct
   uint8_t *pSSign;                          /*!< Pointer to signature part s          (Array of modulusSize elements) */
 } CCB_ECDSASignTypeDef;
 
+/**
+  * @brief  CCB ECDSA signature job definition, used by HAL_CCB_ECDSA_Sign_IT()
+  */
+typedef struct __CCB_ECDSASignJobTypeDef
+{
+  CCB_ECDSACurveParamTypeDef *pCurveParam;  /*!< Pointer to the Curve parameters */
+  CCB_WrappingKeyTypeDef *pWrappingKey;     /*!< Pointer to the Wrapping Key structure */
+  CCB_ECDSAKeyBlobTypeDef *pWrappedPrivateKeyBlob; /*!< Pointer to the related wrapped Private Key Blob */
+  const uint8_t *pHash;                     /*!< Pointer to the Hash                  (Array of modulusSize elements) */
+  CCB_ECDSASignTypeDef *pSignature;         /*!< Pointer to the output signature */
+  HAL_StatusTypeDef Status;                 /*!< Job status, HAL_BUSY until the job is processed */
+} CCB_ECDSASignJobTypeDef;
+
 /**
   * @brief  CCB ECC scalar multiplication point definition
   */
@@ -260,6 +276,7 @@ HAL_StatusTypeDef HAL_CCB_ECDSA_Sign(CCB_HandleTypeDef *hccb, CCB_ECDSACurvePara
                                      CCB_WrappingKeyTypeDef *pWrappingKey,
                                      CCB_ECDSAKeyBlobTypeDef *pWrappedPrivateKeyBlob, const uint8_t *pHash,
                                      CCB_ECDSASignTypeDef *pSignature);
+HAL_StatusTypeDef HAL_CCB_ECDSA_Sign_IT(CCB_HandleTypeDef *hccb, CCB_ECDSASignJobTypeDef *pJobs, uint32_t JobNbr);
 HAL_StatusTypeDef HAL_CCB_ECDSA_ComputePublicKey(CCB_HandleTypeDef *hccb, CCB_ECDSACurveParamTypeDef *pCurveParam,
                                                  CCB_WrappingKeyTypeDef *pWrappingKey,
                                                  CCB_ECDSAKeyBlobTypeDef *pWrappedPrivateKeyBlob,
@@ -290,8 +307,11 @@ HAL_StatusTypeDef HAL_CCB_RSA_ComputeModularExp(CCB_HandleTypeDef *hccb, CCB_RSA
                                                 CCB_RSAKeyBlobTypeDef *pWrappedPrivateKeyBlob,
                                                 const uint8_t *pOperand, uint8_t *pModularExp);
 
-/* Callback functions in non-blocking modes ***********************************/
+/* IRQ handler and callback functions in non-blocking modes ******************/
+void HAL_CCB_IRQHandler(CCB_HandleTypeDef *hccb);
 void HAL_CCB_IntrusionCallback(CCB_HandleTypeDef *hccb);
+void HAL_CCB_ECDSA_SignCpltCallback(CCB_HandleTypeDef *hccb);
+void HAL_CCB_ErrorCallback(CCB_HandleTypeDef *hccb);
 
 /**
   * @}
@@ -160,14 +160,23 @@ typedef struct
   */
 typedef uint32_t HAL_CEC_StateTypeDef;
 
+#define CEC_FRAME_MAX_SIZE  16U   /*!< Header block plus up to 15 opcode/operand blocks */
+
+/**
+  * @brief  CEC frame slot used by the driver managed Rx ring and Tx queue
+  */
+typedef struct
+{
+  uint8_t Size;                          /*!< Frame size in bytes, header block included                  */
+
+  uint8_t Data[CEC_FRAME_MAX_SIZE];      /*!< Header block followed by opcode and operand blocks          */
+
+} CEC_FrameTypeDef;
+
 /**
   * @brief  CEC handle Structure definition
   */
-#if (USE_HAL_CEC_REGISTER_CALLBACKS == 1)
 typedef struct __CEC_HandleTypeDef
-#else
-typedef struct
-#endif /* USE_HAL_CEC_REGISTER_CALLBACKS */
 {
   CEC_TypeDef             *Instance;      /*!< CEC registers base address                                 */
 
@@ -191,6 +200,24 @@ typedef struct
   uint32_t                ErrorCode;      /*!< For errors handling purposes, copy of ISR register
                                                in case error is reported                                  */
 
+  CEC_FrameTypeDef        *pRxRing;       /*!< Rx frame ring, NULL when the ring is not used              */
+
+  uint16_t                RxRingSize;     /*!< Number of frame slots in the Rx ring                       */
+
+  __IO uint16_t           RxRingHead;     /*!< Rx ring slot being filled by the IRQ handler               */
+
+  __IO uint16_t           RxRingTail;     /*!< Next Rx ring slot to be read by the application            */
+
+  __IO uint32_t           RxRingDropCount; /*!< Number of frames dropped because the Rx ring was full     */
+
+  CEC_FrameTypeDef        *pTxQueue;      /*!< Tx frame queue, NULL when the queue is not used            */
+
+  uint16_t                TxQueueSize;    /*!< Number of frame slots in the Tx queue                      */
+
+  __IO uint16_t           TxQueueHead;    /*!< Next free Tx queue slot                                    */
+
+  __IO uint16_t           TxQueueTail;    /*!< Tx queue slot being transmitted                            */
+
 #if (USE_HAL_CEC_REGISTER_CALLBACKS == 1)
   void (* TxCpltCallback)(struct __CEC_HandleTypeDef
                           *hcec);                                /*!< CEC Tx Transfer completed callback  */
@@ -675,6 +702,11 @@ HAL_StatusTypeDef HAL_CEC_Transmit_IT(CEC_HandleTypeDef *hcec, uint8_t Initiator
                                       const uint8_t *pData, uint32_t Size);
 uint32_t HAL_CEC_GetLastReceivedFrameSize(const CEC_HandleTypeDef *hcec);
 void HAL_CEC_ChangeRxBuffer(CEC_HandleTypeDef *hcec, uint8_t *Rxbuffer);
+HAL_StatusTypeDef HAL_CEC_EnableRxRing(CEC_HandleTypeDef *hcec, CEC_FrameTypeDef *pFrames, uint32_t FrameNbr);
+HAL_StatusTypeDef HAL_CEC_ReadFrame(CEC_HandleTypeDef *hcec, CEC_FrameTypeDef *pFrame);
+HAL_StatusTypeDef HAL_CEC_EnableTxQueue(CEC_HandleTypeDef *hcec, CEC_FrameTypeDef *pFrames, uint32_t FrameNbr);
+HAL_StatusTypeDef HAL_CEC_Transmit_Queue(CEC_HandleTypeDef *hcec, uint8_t InitiatorAddress,
+                                         uint8_t DestinationAddress, const uint8_t *pData, uint32_t Size);
 void HAL_CEC_IRQHandler(CEC_HandleTypeDef *hcec);
 void HAL_CEC_TxCpltCallback(CEC_HandleTypeDef *hcec);
 void HAL_CEC_RxCpltCallback(CEC_HandleTypeDef *hcec, uint32_t RxFrameSize);
@@ -84,6 +84,38 @@ typedef struct
 
 } COMP_InitTypeDef;
 
+#if defined(HAL_TIM_MODULE_ENABLED)
+/**
+  * @brief  COMP fast trip configuration structure definition
+  * @note   Used by HAL_COMP_ConfigFastTrip() to link the comparator output to a timer break input.
+  */
+typedef struct
+{
+  uint32_t BreakInput;         /*!< Timer break input driven by the comparator output.
+                                    This parameter can be a value of @ref TIMEx_Break_Input */
+
+  uint32_t BreakFilter;        /*!< Timer break input digital filter.
+                                    Note: Set to 0 to keep the asynchronous break path: any other value adds
+                                          filter sampling periods to the trip latency.
+                                    This parameter can be a number between Min_Data = 0x0 and Max_Data = 0xF */
+
+  uint32_t AutomaticOutput;    /*!< Specifies whether the timer outputs are re-enabled at the next update event
+                                    once the comparator output is low again.
+                                    This parameter can be a value of @ref TIM_AOE_Bit_Set_Reset */
+
+  uint32_t BlankingSrce;       /*!< Comparator blanking source masking the switching spikes.
+                                    This parameter can be a value of @ref COMP_BlankingSrce */
+
+  uint32_t BlankingChannel;    /*!< Channel of the timer generating the blanking window
+                                    (e.g. TIM_CHANNEL_5 for COMP_BLANKINGSRC_TIM1_OC5).
+                                    This parameter can be a value of @ref TIM_Channel */
+
+  uint32_t BlankingPulse;      /*!< Blanking window duration from the start of the timer period, in timer ticks.
+                                    Set to 0 when the blanking channel is configured by the application
+                                    (e.g. generated by another timer) or when BlankingSrce is COMP_BLANKINGSRC_NONE */
+} COMP_FastTripConfigTypeDef;
+#endif /* HAL_TIM_MODULE_ENABLED */
+
 /**
   * @brief  HAL COMP state machine: HAL COMP states definition
   */
@@ -1026,6 +1058,13 @@ void              HAL_COMP_IRQHandler(COMP_HandleTypeDef *hcomp);
   */
 HAL_StatusTypeDef HAL_COMP_Lock(COMP_HandleTypeDef *hcomp);
 uint32_t          HAL_COMP_GetOutputLevel(const COMP_HandleTypeDef *hcomp);
+#if defined(HAL_TIM_MODULE_ENABLED)
+HAL_StatusTypeDef HAL_COMP_ConfigFastTrip(COMP_HandleTypeDef *hcomp, TIM_HandleTypeDef *htim,
+                                          const COMP_FastTripConfigTypeDef *sConfig);
+HAL_StatusTypeDef HAL_COMP_FastTripSelfTest(COMP_HandleTypeDef *hcomp, TIM_HandleTypeDef *htim,
+                                            TIM_HandleTypeDef *htimcapture, uint32_t CaptureChannel,
+                                            uint32_t *pLatency);
+#endif /* HAL_TIM_MODULE_ENABLED */
 /* Callback in interrupt mode */
 void              HAL_COMP_TriggerCallback(COMP_HandleTypeDef *hcomp);
 /**
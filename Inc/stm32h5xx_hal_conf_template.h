@@ -91,6 +91,7 @@ extern "C" {
 #define HAL_SPI_MODULE_ENABLED
 #define HAL_SRAM_MODULE_ENABLED
 #define HAL_TIM_MODULE_ENABLED
+#define HAL_UCPD_MODULE_ENABLED
 #define HAL_UART_MODULE_ENABLED
 #define HAL_USART_MODULE_ENABLED
 #define HAL_WWDG_MODULE_ENABLED
@@ -185,8 +186,20 @@ in voltage and temperature.*/
 #define  VDD_VALUE                  3300UL /*!< Value of VDD in mv */
 #define  TICK_INT_PRIORITY          ((1UL<<__NVIC_PRIO_BITS) - 1UL)  /*!< tick interrupt priority (lowest by default) */
 #define  USE_RTOS                   0U
+#define  USE_HAL_ATOMIC_LOCK        0U               /*!< Handle lock with exclusive accesses */
+#define  USE_HAL_OS_HOOKS           0U               /*!< Blocking functions waiting on OS hooks */
+#define  USE_HAL_TRACE              0U               /*!< IRQ handlers and DMA start trace hooks */
+#define  USE_HAL_REQUEST            0U               /*!< Chained asynchronous requests across drivers */
+#define  USE_HAL_RCC_FREQ_CACHE     0U               /*!< Peripheral clock frequencies cached by the RCC driver */
+#define  USE_HAL_CLOCK_GATING       0U               /*!< Peripheral clocks gated while the handles are idle */
 #define  PREFETCH_ENABLE            0U               /*!< Enable prefetch */
 
+/* Linker sections of the __SRAMx_BUFFER placement macros, uncomment to rename them */
+/* #define HAL_SRAM1_SECTION          ".sram1" */
+/* #define HAL_SRAM2_SECTION          ".sram2" */
+/* #define HAL_SRAM3_SECTION          ".sram3" */
+/* #define HAL_BKPSRAM_SECTION        ".bkpsram" */
+
 /* ############################################ Assert Selection #################################################### */
 /**
   * @brief Uncomment the line below to expanse the "assert_param" macro in the
@@ -253,6 +266,7 @@ in voltage and temperature.*/
 #define  USE_HAL_SPI_REGISTER_CALLBACKS       0U    /* SPI register callback disabled       */
 #define  USE_HAL_SRAM_REGISTER_CALLBACKS      0U    /* SRAM register callback disabled      */
 #define  USE_HAL_TIM_REGISTER_CALLBACKS       0U    /* TIM register callback disabled       */
+#define  USE_HAL_UCPD_REGISTER_CALLBACKS      0U    /* UCPD register callback disabled      */
 #define  USE_HAL_UART_REGISTER_CALLBACKS      0U    /* UART register callback disabled      */
 #define  USE_HAL_USART_REGISTER_CALLBACKS     0U    /* USART register callback disabled     */
 #define  USE_HAL_WWDG_REGISTER_CALLBACKS      0U    /* WWDG register callback disabled      */
@@ -266,12 +280,56 @@ in voltage and temperature.*/
   */
 #define USE_SPI_CRC                   1U
 
+/* SPI and UART DMA FEATURE: Use to remove the DMA transfers from a polling or interrupt only application
+ * Activated (1): DMA transfer code and handle fields are present inside driver (HAL DMA module enabled)
+ * Deactivated (0): DMA transfer code and handle fields cleaned from driver, reducing the handle size
+  */
+#define USE_HAL_SPI_DMA               1U
+#define USE_HAL_UART_DMA              1U
+
 /* DMA2D COMMAND List Feature: Use to activate Command List feature inside HAL DMA2D Driver
  * Activated (1): DMA2D COmmand list code is present inside driver
  * Deactivated (0): DMA2D Direct Mode code is present inside driver
   */
 #define USE_DMA2D_COMMAND_LIST_MODE   0U
 
+/* ETH RX LATENCY Feature: Use to activate the Rx interrupt to packet read latency measurement
+ * inside HAL ETH Driver, based on the DWT cycle counter
+ * Activated (1): latency measurement code is present inside driver
+ * Deactivated (0): latency measurement code cleaned from driver
+  */
+#define USE_ETH_RX_LATENCY            0U
+
+/* ############################################ DMA configuration ################################################### */
+
+/* DMA MEMORY COPY CPU THRESHOLD: size in bytes below which HAL_DMAEx_Memcpy/HAL_DMAEx_Memset
+ * are executed by CPU, the DMA channel setup costing more than the copy
+  */
+#define DMA_MEMCPY_CPU_THRESHOLD      32U
+
+/* DMA STATISTICS Feature: Use to activate the per channel transfer statistics inside HAL DMA Driver,
+ * based on the DWT cycle counter
+ * Activated (1): statistics code is present inside driver
+ * Deactivated (0): statistics code cleaned from driver
+  */
+#define USE_HAL_DMA_STATISTICS        0U
+
+/* DCACHE DMA COHERENCY Feature: Use to maintain the DCACHE coherency of the DMA buffers inside the SPI, SD and XSPI
+ * HAL Drivers, the DCACHE handle being registered with HAL_DCACHE_DMA_Register() (requires the DCACHE HAL module)
+ * Activated (1): cache maintenance code is present inside drivers
+ * Deactivated (0): cache maintenance code cleaned from drivers
+  */
+#define USE_HAL_DCACHE_DMA_COHERENCY  0U
+
+/* ############################################ PCD configuration ################################################### */
+
+/* PCD STATISTICS Feature: Use to activate the per endpoint transfer statistics inside HAL PCD Driver,
+ * based on the DWT cycle counter
+ * Activated (1): statistics code is present inside driver
+ * Deactivated (0): statistics code cleaned from driver
+  */
+#define USE_HAL_PCD_STATISTICS        0U
+
 /* Includes ----------------------------------------------------------------------------------------------------------*/
 /**
   * @brief Include module's header file
@@ -441,6 +499,10 @@ in voltage and temperature.*/
 #include "stm32h5xx_hal_tim.h"
 #endif /* HAL_TIM_MODULE_ENABLED */
 
+#ifdef HAL_UCPD_MODULE_ENABLED
+#include "stm32h5xx_hal_ucpd.h"
+#endif /* HAL_UCPD_MODULE_ENABLED */
+
 #ifdef HAL_UART_MODULE_ENABLED
 #include "stm32h5xx_hal_uart.h"
 #endif /* HAL_UART_MODULE_ENABLED */
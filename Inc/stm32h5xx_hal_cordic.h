@@ -88,6 +88,7 @@ typedef struct
 #if USE_HAL_CORDIC_REGISTER_CALLBACKS == 1
   void (* ErrorCallback)(struct __CORDIC_HandleTypeDef *hcordic);          /*!< CORDIC error callback */
   void (* CalculateCpltCallback)(struct __CORDIC_HandleTypeDef *hcordic);  /*!< CORDIC calculate complete callback */
+  void (* CalculateHalfCpltCallback)(struct __CORDIC_HandleTypeDef *hcordic); /*!< CORDIC calculate half complete callback */
 
   void (* MspInitCallback)(struct __CORDIC_HandleTypeDef *hcordic);        /*!< CORDIC Msp Init callback */
   void (* MspDeInitCallback)(struct __CORDIC_HandleTypeDef *hcordic);      /*!< CORDIC Msp DeInit callback */
@@ -124,6 +125,21 @@ typedef struct
 
 } CORDIC_ConfigTypeDef;
 
+/**
+  * @brief  CORDIC batch job Structure definition
+  */
+typedef struct
+{
+  CORDIC_ConfigTypeDef Config;    /*!< CORDIC configuration used for this job */
+
+  const int32_t        *pInBuff;  /*!< Pointer to buffer containing input data of this job */
+
+  int32_t              *pOutBuff; /*!< Pointer to buffer where output data of this job will be stored */
+
+  uint32_t             NbCalc;    /*!< Number of CORDIC calculation of this job */
+
+} CORDIC_BatchJobTypeDef;
+
 #if USE_HAL_CORDIC_REGISTER_CALLBACKS == 1
 /**
   * @brief  HAL CORDIC Callback ID enumeration definition
@@ -136,6 +152,8 @@ typedef enum
   HAL_CORDIC_MSPINIT_CB_ID           = 0x02U,    /*!< CORDIC MspInit callback ID */
   HAL_CORDIC_MSPDEINIT_CB_ID         = 0x03U,    /*!< CORDIC MspDeInit callback ID */
 
+  HAL_CORDIC_CALCULATE_HALFCPLT_CB_ID = 0x04U,   /*!< CORDIC calculate half complete callback ID */
+
 } HAL_CORDIC_CallbackIDTypeDef;
 
 /**
@@ -561,10 +579,15 @@ HAL_StatusTypeDef HAL_CORDIC_Calculate(CORDIC_HandleTypeDef *hcordic, const int3
                                        uint32_t NbCalc, uint32_t Timeout);
 HAL_StatusTypeDef HAL_CORDIC_CalculateZO(CORDIC_HandleTypeDef *hcordic, const int32_t *pInBuff, int32_t *pOutBuff,
                                          uint32_t NbCalc, uint32_t Timeout);
+HAL_StatusTypeDef HAL_CORDIC_CalculateBatchZO(CORDIC_HandleTypeDef *hcordic, const CORDIC_BatchJobTypeDef *pJobs,
+                                              uint32_t NbJobs, uint32_t Timeout);
 HAL_StatusTypeDef HAL_CORDIC_Calculate_IT(CORDIC_HandleTypeDef *hcordic, const int32_t *pInBuff, int32_t *pOutBuff,
                                           uint32_t NbCalc);
 HAL_StatusTypeDef HAL_CORDIC_Calculate_DMA(CORDIC_HandleTypeDef *hcordic, const int32_t *pInBuff, int32_t *pOutBuff,
                                            uint32_t NbCalc, uint32_t DMADirection);
+HAL_StatusTypeDef HAL_CORDIC_CalculateStream_DMA(CORDIC_HandleTypeDef *hcordic, const int32_t *pInBuff,
+                                                 int32_t *pOutBuff, uint32_t NbCalc);
+HAL_StatusTypeDef HAL_CORDIC_StopStream_DMA(CORDIC_HandleTypeDef *hcordic);
 /**
   * @}
   */
@@ -575,6 +598,7 @@ HAL_StatusTypeDef HAL_CORDIC_Calculate_DMA(CORDIC_HandleTypeDef *hcordic, const
 /* Callback functions *********************************************************/
 void HAL_CORDIC_ErrorCallback(CORDIC_HandleTypeDef *hcordic);
 void HAL_CORDIC_CalculateCpltCallback(CORDIC_HandleTypeDef *hcordic);
+void HAL_CORDIC_CalculateHalfCpltCallback(CORDIC_HandleTypeDef *hcordic);
 /**
   * @}
   */
@@ -81,6 +81,28 @@ typedef struct
   * @}
   */
 
+/** @defgroup CORTEX_MPU_Profile_Region_Structure_definition MPU Profile Region Structure Definition
+  * @{
+  */
+typedef struct
+{
+  uint32_t               BaseAddress;       /*!< Specifies the base address of the area, 32-byte aligned.             */
+  uint32_t               LimitAddress;      /*!< Specifies the address of the last byte of the area, the next address
+                                                 must be 32-byte aligned.                                             */
+  uint8_t                Attributes;        /*!< Specifies the memory attributes of the area. This parameter can be a
+                                                 combination of @ref CORTEX_MPU_Attributes, e.g.
+                                                 INNER_OUTER(MPU_NOT_CACHEABLE) for DMA buffers                      */
+  uint8_t                AccessPermission;  /*!< Specifies the region access permission type. This parameter
+                                                 can be a value of @ref CORTEX_MPU_Region_Permission_Attributes       */
+  uint8_t                DisableExec;       /*!< Specifies the instruction access status.
+                                                 This parameter can be a value of @ref CORTEX_MPU_Instruction_Access  */
+  uint8_t                IsShareable;       /*!< Specifies the shareability status of the area.
+                                                 This parameter can be a value of @ref CORTEX_MPU_Access_Shareable    */
+} MPU_Profile_RegionTypeDef;
+/**
+  * @}
+  */
+
 
 /**
   * @}
@@ -304,6 +326,8 @@ void HAL_MPU_EnableRegion(uint32_t RegionNumber);
 void HAL_MPU_DisableRegion(uint32_t RegionNumber);
 void HAL_MPU_ConfigRegion(const MPU_Region_InitTypeDef *const pMPU_RegionInit);
 void HAL_MPU_ConfigMemoryAttributes(const MPU_Attributes_InitTypeDef *const pMPU_AttributesInit);
+HAL_StatusTypeDef HAL_MPU_ConfigProfile(const MPU_Profile_RegionTypeDef *pRegions, uint32_t NbRegions,
+                                        uint32_t MPU_Control, uint32_t *pConflictIndex);
 #if defined (__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U)
 /* MPU_NS Control functions ***********************************************/
 void HAL_MPU_Enable_NS(uint32_t MPU_Control);
@@ -312,6 +336,8 @@ void HAL_MPU_EnableRegion_NS(uint32_t RegionNumber);
 void HAL_MPU_DisableRegion_NS(uint32_t RegionNumber);
 void HAL_MPU_ConfigRegion_NS(const MPU_Region_InitTypeDef *const pMPU_RegionInit);
 void HAL_MPU_ConfigMemoryAttributes_NS(const MPU_Attributes_InitTypeDef *const pMPU_AttributesInit);
+HAL_StatusTypeDef HAL_MPU_ConfigProfile_NS(const MPU_Profile_RegionTypeDef *pRegions, uint32_t NbRegions,
+                                           uint32_t MPU_Control, uint32_t *pConflictIndex);
 #endif /* __ARM_FEATURE_CMSE */
 /**
   * @}
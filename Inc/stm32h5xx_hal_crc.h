@@ -128,6 +128,16 @@ typedef struct
                                           Note that constant CRC_INPUT_FORMAT_UNDEFINED is defined but an initialization
                                           error must occur if InputBufferFormat is not one of the three values listed
                                           above  */
+#if defined(HAL_DMA_MODULE_ENABLED)
+
+  DMA_HandleTypeDef           *hdma;       /*!< CRC DMA handle parameters, linked with __HAL_LINKDMA() */
+
+  uint8_t                     *pBuffPtr;   /*!< Pointer to the next input data to be fed to the CRC     */
+
+  __IO uint32_t               XferCount;   /*!< Remaining aligned body bytes to be streamed by DMA     */
+
+  uint32_t                    XferTail;    /*!< Number of trailing bytes fed by CPU after the DMA body  */
+#endif /* HAL_DMA_MODULE_ENABLED */
 } CRC_HandleTypeDef;
 /**
   * @}
@@ -310,6 +320,13 @@ void HAL_CRC_MspDeInit(CRC_HandleTypeDef *hcrc);
   */
 uint32_t HAL_CRC_Accumulate(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength);
 uint32_t HAL_CRC_Calculate(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength);
+#if defined(HAL_DMA_MODULE_ENABLED)
+HAL_StatusTypeDef HAL_CRC_Accumulate_DMA(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength);
+HAL_StatusTypeDef HAL_CRC_Calculate_DMA(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength);
+uint32_t HAL_CRC_GetValue(const CRC_HandleTypeDef *hcrc);
+void HAL_CRC_CpltCallback(CRC_HandleTypeDef *hcrc);
+void HAL_CRC_ErrorCallback(CRC_HandleTypeDef *hcrc);
+#endif /* HAL_DMA_MODULE_ENABLED */
 /**
   * @}
   */
@@ -36,6 +36,31 @@ extern "C" {
   */
 
 /* Exported types ------------------------------------------------------------*/
+/** @defgroup CRCEx_Exported_Types CRC Extended Exported Types
+  * @{
+  */
+
+/**
+  * @brief  CRC computation context structure definition, holds the state of one
+  *         logical CRC stream while the peripheral is used by another one
+  */
+typedef struct
+{
+  uint32_t InitValue;        /*!< CRC initialization value (INIT register)                 */
+
+  uint32_t Polynomial;       /*!< CRC generating polynomial (POL register)                 */
+
+  uint32_t Control;          /*!< CRC polynomial size and data inversion modes (CR register) */
+
+  uint32_t Value;            /*!< Running CRC value, without output data inversion         */
+
+  uint32_t InputDataFormat;  /*!< Input data format, value of @ref CRC_Input_Buffer_Format */
+} CRC_ContextTypeDef;
+
+/**
+  * @}
+  */
+
 /* Exported constants --------------------------------------------------------*/
 /** @defgroup CRCEx_Exported_Constants CRC Extended Exported Constants
   * @{
@@ -205,6 +230,20 @@ HAL_StatusTypeDef HAL_CRCEx_Polynomial_Set(CRC_HandleTypeDef *hcrc, uint32_t Pol
 HAL_StatusTypeDef HAL_CRCEx_Input_Data_Reverse(CRC_HandleTypeDef *hcrc, uint32_t InputReverseMode);
 HAL_StatusTypeDef HAL_CRCEx_Output_Data_Reverse(CRC_HandleTypeDef *hcrc, uint32_t OutputReverseMode);
 
+/**
+  * @}
+  */
+
+/** @addtogroup CRCEx_Exported_Functions_Group2
+  * @{
+  */
+/* Context management functions  **********************************************/
+HAL_StatusTypeDef HAL_CRCEx_SaveContext(CRC_HandleTypeDef *hcrc, CRC_ContextTypeDef *pContext);
+HAL_StatusTypeDef HAL_CRCEx_RestoreContext(CRC_HandleTypeDef *hcrc, const CRC_ContextTypeDef *pContext);
+HAL_StatusTypeDef HAL_CRCEx_ResetContext(CRC_ContextTypeDef *pContext);
+uint32_t HAL_CRCEx_AccumulateCtx(CRC_HandleTypeDef *hcrc, CRC_ContextTypeDef *pContext, uint32_t pBuffer[],
+                                 uint32_t BufferLength);
+
 /**
   * @}
   */
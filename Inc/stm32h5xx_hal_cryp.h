@@ -119,6 +119,52 @@ typedef struct
 
 } CRYP_ContextTypeDef;
 
+/**
+  * @brief  CRYP prepared key structure definition, holding the configuration of a key
+  *         loaded (and derived for ECB/CBC decryption) once for several messages
+  */
+typedef struct
+{
+  uint32_t DataType;                   /*!< This parameter can be a value of @ref CRYP_Data_Type */
+  uint32_t KeySize;                    /*!< This parameter can be a value of @ref CRYP_Key_Size */
+  uint32_t *pKey;                      /*!< The key used for encryption/decryption */
+  uint32_t Algorithm;                  /*!< This parameter can be a value of @ref CRYP_Algorithm_Mode */
+  uint32_t DataWidthUnit;              /*!< This parameter can be value of @ref CRYP_Data_Width_Unit */
+  uint32_t Decrypt;                    /*!< Key prepared for decryption (1) or encryption (0) */
+  uint32_t CR_Reg;                     /*!< CRYP CR register once the key is prepared */
+  uint32_t *pWrappedKey;               /*!< Only for SAES : wrapped key unwrapped in the key registers,
+                                            NULL for a key provided by pKey */
+} CRYP_PreparedKeyTypeDef;
+
+/**
+  * @brief CRYP buffer fragment structure definition, used for scatter-gather processing
+  */
+typedef struct
+{
+  uint8_t  *pBuffer;                   /*!< Pointer to the fragment data */
+  uint32_t Size;                       /*!< Fragment length in bytes      */
+} CRYP_FragmentTypeDef;
+
+/**
+  * @brief CRYP scatter-gather processing state structure definition
+  */
+typedef struct
+{
+  const CRYP_FragmentTypeDef *pIn;     /*!< Input fragments, NULL when no scatter-gather processing is ongoing */
+  const CRYP_FragmentTypeDef *pOut;    /*!< Output fragments, sizes identical to the input ones */
+  uint32_t FragmentNbr;                /*!< Number of fragments */
+  uint32_t Index;                      /*!< Current fragment index */
+  uint32_t Offset;                     /*!< Current offset in bytes in the current fragment */
+  uint32_t Remaining;                  /*!< Number of bytes still to be processed */
+  uint32_t BlockIndex;                 /*!< Fragment index of the block straddling fragments */
+  uint32_t BlockOffset;                /*!< Fragment offset of the block straddling fragments */
+  uint32_t BlockSize;                  /*!< Size of the block straddling fragments, 0 if none is processed */
+  uint32_t BlockIn[4];                 /*!< Gathered input block straddling fragments */
+  uint32_t BlockOut[4];                /*!< Output block to be scattered to the output fragments */
+  uint32_t KeyIVConfigSkip;            /*!< User Key and IV configuration skip setting */
+  uint32_t Decrypt;                    /*!< Decryption (1) or encryption (0) */
+} CRYP_SGStateTypeDef;
+
 #if (USE_HAL_CRYP_SUSPEND_RESUME == 1U)
 /**
   * @brief HAL CRYP mode suspend definitions
@@ -173,6 +219,19 @@ typedef struct
                                                            for a single signature computation after several
                                                            messages processing */
 
+  uint32_t                          *pAuthTag;        /*!< Pointer to the authentication TAG buffer filled at the
+                                                           end of a GCM DMA processing chained with the final
+                                                           phase, NULL otherwise */
+
+  CRYP_SGStateTypeDef               SG;               /*!< CRYP scatter-gather processing state */
+
+  CRYP_PreparedKeyTypeDef           *pPreparedKey;    /*!< Prepared key currently held in the key registers,
+                                                           NULL otherwise */
+
+#if defined(USE_HAL_REQUEST) && (USE_HAL_REQUEST == 1U)
+  struct __HAL_RequestTypeDef       *pRequest;        /*!< Pointer to the ongoing asynchronous request */
+#endif /* USE_HAL_REQUEST */
+
 #if (USE_HAL_CRYP_REGISTER_CALLBACKS == 1U)
   void (*InCpltCallback)(struct __CRYP_HandleTypeDef *hcryp);      /*!< CRYP Input FIFO transfer completed callback  */
   void (*OutCpltCallback)(struct __CRYP_HandleTypeDef *hcryp);     /*!< CRYP Output FIFO transfer completed callback */
@@ -440,6 +499,17 @@ typedef  void (*pCRYP_CallbackTypeDef)(CRYP_HandleTypeDef *hcryp);    /*!< point
   * @}
   */
 
+#if defined(USE_HAL_REQUEST) && (USE_HAL_REQUEST == 1U)
+/** @defgroup CRYP_Request_Operation CRYP Asynchronous Request Operation
+  * @{
+  */
+#define HAL_CRYP_REQUEST_ENCRYPT 0x00000000U            /*!< Request encrypting pSrc into pDst */
+#define HAL_CRYP_REQUEST_DECRYPT 0x00000001U            /*!< Request decrypting pSrc into pDst */
+/**
+  * @}
+  */
+#endif /* USE_HAL_REQUEST */
+
 
 /**
   * @}
@@ -593,6 +663,9 @@ HAL_StatusTypeDef HAL_CRYP_Resume(CRYP_HandleTypeDef *hcryp);
 #endif /* defined (USE_HAL_CRYP_SUSPEND_RESUME) */
 HAL_StatusTypeDef  HAL_CRYP_SaveContext(CRYP_HandleTypeDef *hcryp, CRYP_ContextTypeDef *pcont);
 HAL_StatusTypeDef HAL_CRYP_RestoreContext(CRYP_HandleTypeDef *hcryp, CRYP_ContextTypeDef *pcont);
+HAL_StatusTypeDef HAL_CRYP_PrepareKey(CRYP_HandleTypeDef *hcryp, CRYP_PreparedKeyTypeDef *pPrepKey, uint32_t Decrypt);
+HAL_StatusTypeDef HAL_CRYP_LoadPreparedKey(CRYP_HandleTypeDef *hcryp, CRYP_PreparedKeyTypeDef *pPrepKey,
+                                           uint32_t *pInitVect);
 
 /**
   * @}
@@ -611,6 +684,13 @@ HAL_StatusTypeDef HAL_CRYP_Encrypt_IT(CRYP_HandleTypeDef *hcryp, uint32_t *pInpu
 HAL_StatusTypeDef HAL_CRYP_Decrypt_IT(CRYP_HandleTypeDef *hcryp, uint32_t *pInput, uint16_t Size, uint32_t *pOutput);
 HAL_StatusTypeDef HAL_CRYP_Encrypt_DMA(CRYP_HandleTypeDef *hcryp, uint32_t *pInput, uint16_t Size, uint32_t *pOutput);
 HAL_StatusTypeDef HAL_CRYP_Decrypt_DMA(CRYP_HandleTypeDef *hcryp, uint32_t *pInput, uint16_t Size, uint32_t *pOutput);
+HAL_StatusTypeDef HAL_CRYP_EncryptSG(CRYP_HandleTypeDef *hcryp, const CRYP_FragmentTypeDef *pInput,
+                                     const CRYP_FragmentTypeDef *pOutput, uint32_t FragmentNbr);
+HAL_StatusTypeDef HAL_CRYP_DecryptSG(CRYP_HandleTypeDef *hcryp, const CRYP_FragmentTypeDef *pInput,
+                                     const CRYP_FragmentTypeDef *pOutput, uint32_t FragmentNbr);
+#if defined(USE_HAL_REQUEST) && (USE_HAL_REQUEST == 1U)
+HAL_StatusTypeDef HAL_CRYP_Request_Start(HAL_RequestTypeDef *pReq);
+#endif /* USE_HAL_REQUEST */
 
 /**
   * @}
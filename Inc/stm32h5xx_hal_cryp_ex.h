@@ -43,6 +43,17 @@ extern "C" {
   * @{
   */
 
+/**
+  * @brief CRYP GCM/CCM streaming processing structure definition
+  */
+typedef struct
+{
+  uint32_t Block[4];                   /*!< Input bytes waiting for a whole block to be processed */
+  uint32_t BlockSize;                  /*!< Number of bytes in the pending input block */
+  uint32_t Decrypt;                    /*!< Decryption (1) or encryption (0) */
+  uint32_t KeyIVConfigSkip;            /*!< User Key and IV configuration skip setting */
+} CRYP_StreamTypeDef;
+
 /**
   * @}
   */
@@ -111,6 +122,16 @@ HAL_StatusTypeDef HAL_CRYPEx_AESGCM_GenerateAuthTAG(CRYP_HandleTypeDef *hcryp, c
                                                     uint32_t Timeout);
 HAL_StatusTypeDef HAL_CRYPEx_AESCCM_GenerateAuthTAG(CRYP_HandleTypeDef *hcryp, const uint32_t *pAuthTag,
                                                     uint32_t Timeout);
+HAL_StatusTypeDef HAL_CRYPEx_AESGCM_Encrypt_DMA(CRYP_HandleTypeDef *hcryp, uint32_t *pInput, uint16_t Size,
+                                                uint32_t *pOutput, uint32_t *pAuthTag);
+HAL_StatusTypeDef HAL_CRYPEx_AESGCM_Decrypt_DMA(CRYP_HandleTypeDef *hcryp, uint32_t *pInput, uint16_t Size,
+                                                uint32_t *pOutput, uint32_t *pAuthTag);
+HAL_StatusTypeDef HAL_CRYPEx_AES_StreamInit(CRYP_HandleTypeDef *hcryp, CRYP_StreamTypeDef *pStream, uint32_t Decrypt,
+                                            uint32_t Timeout);
+HAL_StatusTypeDef HAL_CRYPEx_AES_StreamUpdate(CRYP_HandleTypeDef *hcryp, CRYP_StreamTypeDef *pStream, uint8_t *pInput,
+                                              uint32_t Size, uint8_t *pOutput, uint32_t *pOutputSize, uint32_t Timeout);
+HAL_StatusTypeDef HAL_CRYPEx_AES_StreamFinal(CRYP_HandleTypeDef *hcryp, CRYP_StreamTypeDef *pStream, uint8_t *pOutput,
+                                             uint32_t *pOutputSize, uint32_t *pAuthTag, uint32_t Timeout);
 /**
   * @}
   */
@@ -120,6 +141,9 @@ HAL_StatusTypeDef HAL_CRYPEx_AESCCM_GenerateAuthTAG(CRYP_HandleTypeDef *hcryp, c
   */
 HAL_StatusTypeDef HAL_CRYPEx_UnwrapKey(CRYP_HandleTypeDef *hcryp, uint32_t *pInput, uint32_t Timeout);
 HAL_StatusTypeDef HAL_CRYPEx_WrapKey(CRYP_HandleTypeDef *hcryp, uint32_t *pInput, uint32_t *pOutput, uint32_t Timeout);
+HAL_StatusTypeDef HAL_CRYPEx_PrepareUnwrappedKey(CRYP_HandleTypeDef *hcryp, CRYP_PreparedKeyTypeDef *pPrepKey,
+                                                 uint32_t *pWrappedKey, uint32_t Decrypt, uint32_t Timeout);
+HAL_StatusTypeDef HAL_CRYPEx_ReleasePreparedKey(CRYP_HandleTypeDef *hcryp, CRYP_PreparedKeyTypeDef *pPrepKey);
 /**
   * @}
   */
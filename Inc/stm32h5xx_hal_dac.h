@@ -77,6 +77,10 @@ typedef struct
 
   __IO uint32_t               ErrorCode;     /*!< DAC Error code                    */
 
+  __IO uint32_t               StreamBlockCh1; /*!< DAC channel 1 streaming: next block to be transferred */
+
+  __IO uint32_t               StreamBlockCh2; /*!< DAC channel 2 streaming: next block to be transferred */
+
 #if (USE_HAL_DAC_REGISTER_CALLBACKS == 1)
   void (* ConvCpltCallbackCh1)(struct __DAC_HandleTypeDef *hdac);
   void (* ConvHalfCpltCallbackCh1)(struct __DAC_HandleTypeDef *hdac);
@@ -43,6 +43,31 @@ extern "C" {
   * @brief  HAL State structures definition
   */
 
+/**
+  * @brief  DAC waveform streaming configuration structure definition
+  * @note   The queue, the nodes and the block buffers are provided by the user and must stay allocated while
+  *         the streaming runs.
+  */
+typedef struct
+{
+  DMA_QListTypeDef  *pQueue;      /*!< Linked-list queue used to build the circular streaming queue */
+
+  DMA_NodeTypeDef   *pNodes;      /*!< Array of 2 linked-list nodes, one per block */
+
+  uint32_t          Request;      /*!< DMA request of the DAC channel.
+                                       This parameter can be a value of @ref DMA_Request_Selection */
+
+  const uint32_t    *pBuffer[2];  /*!< Buffers of the 2 blocks */
+
+  uint32_t          BlockLength;  /*!< Number of data per block */
+
+  uint32_t          Alignment;    /*!< Data alignment.
+                                       This parameter can be a value of @ref DAC_data_alignment */
+
+  FunctionalState   DualMode;     /*!< Dual mode: blocks hold packed data of both channels, converted
+                                       simultaneously. This parameter can be ENABLE or DISABLE */
+} DAC_StreamConfTypeDef;
+
 /* Exported constants --------------------------------------------------------*/
 
 /** @defgroup DACEx_Exported_Constants DACEx Exported Constants
@@ -211,6 +236,10 @@ HAL_StatusTypeDef HAL_DACEx_DualStop(DAC_HandleTypeDef *hdac);
 HAL_StatusTypeDef HAL_DACEx_DualStart_DMA(DAC_HandleTypeDef *hdac, uint32_t Channel,
                                           const uint32_t *pData, uint32_t Length, uint32_t Alignment);
 HAL_StatusTypeDef HAL_DACEx_DualStop_DMA(DAC_HandleTypeDef *hdac, uint32_t Channel);
+HAL_StatusTypeDef HAL_DACEx_StreamStart_DMA(DAC_HandleTypeDef *hdac, uint32_t Channel,
+                                            const DAC_StreamConfTypeDef *pConfig);
+HAL_StatusTypeDef HAL_DACEx_StreamSetBuffer(DAC_HandleTypeDef *hdac, uint32_t Channel, uint32_t Block,
+                                            const uint32_t *pData);
 HAL_StatusTypeDef HAL_DACEx_DualSetValue(DAC_HandleTypeDef *hdac, uint32_t Alignment, uint32_t Data1, uint32_t Data2);
 uint32_t HAL_DACEx_DualGetValue(const DAC_HandleTypeDef *hdac);
 
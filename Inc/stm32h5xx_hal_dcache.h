@@ -106,6 +106,17 @@ typedef enum
   HAL_DCACHE_MSPDEINIT_CB_ID                        = 0x06U  /*!< DCACHE Msp DeInit callback ID                      */
 } HAL_DCACHE_CallbackIDTypeDef;
 
+/**
+  * @brief  DCACHE memory pool structure definition
+  */
+typedef struct
+{
+  uint32_t      BaseAddress;     /*!< Start address of the managed region, aligned on a cache line       */
+  uint32_t      Size;            /*!< Size in bytes of the managed region, multiple of the cache line    */
+  __IO uint32_t Offset;          /*!< Offset of the first free byte of the region                        */
+  uint32_t      HighWatermark;   /*!< Maximum offset reached since the pool initialization               */
+} DCACHE_PoolTypeDef;
+
 /**
   * @}
   */
@@ -128,6 +139,14 @@ typedef enum
 #define HAL_DCACHE_ERROR_EVICTION_CLEAN    0x00000040U /*!< Eviction or clean operation write-back error */
 #define HAL_DCACHE_ERROR_INVALID_OPERATION 0x00000080U /*!< Invalid operation       */
 
+/**
+  * @}
+  */
+
+/** @defgroup DCACHE_Line_Size Cache line size
+  * @{
+  */
+#define DCACHE_LINE_SIZE               32U                 /*!< Size in bytes of a DCACHE line */
 /**
   * @}
   */
@@ -327,6 +346,37 @@ uint32_t HAL_DCACHE_GetError(const DCACHE_HandleTypeDef *hdcache);
   * @}
   */
 
+/** @defgroup DCACHE_Exported_Functions_Group5 Memory Pool Functions
+  * @brief    Memory Pool Functions
+  * @{
+  */
+HAL_StatusTypeDef HAL_DCACHE_Pool_Init(DCACHE_PoolTypeDef *pPool, uint32_t BaseAddress, uint32_t Size);
+void             *HAL_DCACHE_Pool_Alloc(DCACHE_PoolTypeDef *pPool, uint32_t Size, uint32_t Alignment);
+uint32_t          HAL_DCACHE_Pool_GetMark(const DCACHE_PoolTypeDef *pPool);
+HAL_StatusTypeDef HAL_DCACHE_Pool_Release(DCACHE_PoolTypeDef *pPool, uint32_t Mark);
+void              HAL_DCACHE_Pool_Reset(DCACHE_PoolTypeDef *pPool);
+uint32_t          HAL_DCACHE_Pool_GetFreeSize(const DCACHE_PoolTypeDef *pPool);
+HAL_StatusTypeDef HAL_DCACHE_Pool_Clean(DCACHE_HandleTypeDef *hdcache, const DCACHE_PoolTypeDef *pPool,
+                                        const void *pBuffer, uint32_t Size);
+HAL_StatusTypeDef HAL_DCACHE_Pool_Invalidate(DCACHE_HandleTypeDef *hdcache, const DCACHE_PoolTypeDef *pPool,
+                                             const void *pBuffer, uint32_t Size);
+/**
+  * @}
+  */
+
+/** @defgroup DCACHE_Exported_Functions_Group6 DMA Coherency Functions
+  * @brief    DMA Coherency Functions
+  * @{
+  */
+void              HAL_DCACHE_DMA_Register(DCACHE_HandleTypeDef *hdcache);
+HAL_StatusTypeDef HAL_DCACHE_DMA_PrepareTx(const void *pBuffer, uint32_t Size);
+HAL_StatusTypeDef HAL_DCACHE_DMA_PrepareRx(const void *pBuffer, uint32_t Size);
+HAL_StatusTypeDef HAL_DCACHE_DMA_WaitPrepared(void);
+HAL_StatusTypeDef HAL_DCACHE_DMA_CompleteRx(const void *pBuffer, uint32_t Size);
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -118,6 +118,35 @@ typedef struct
                                             This parameter can be a value of @ref DCMI_Line_Select_Start     */
 } DCMI_InitTypeDef;
 
+/**
+  * @brief  DCMI frame ring structure definition, provided by the user
+  */
+typedef struct
+{
+  uint32_t                      FrameAddress;        /*!< Address of the first frame buffer, the FrameCount
+                                                          buffers are consecutive                         */
+
+  uint32_t                      FrameSize;           /*!< Size of one frame in bytes, multiple of 4 and, above
+                                                          0xFFFF bytes, a power of 2 multiple of a DMA node
+                                                          size not exceeding 0xFFFF bytes                 */
+
+  uint32_t                      FrameCount;          /*!< Number of frame buffers, from 2 to
+                                                          DCMI_FRAME_RING_MAX_FRAMES                      */
+
+  uint32_t                      NodesPerFrame;       /*!< Number of DMA node transfers per frame, internal */
+
+  __IO uint32_t                 NodeIndex;           /*!< DMA node transfers done in the frame being
+                                                          written, internal                               */
+
+  __IO uint32_t                 WriteIndex;          /*!< Index of the frame buffer being written          */
+
+  __IO uint32_t                 ReadyMask;           /*!< Frames delivered and not released yet, one bit per
+                                                          frame buffer                                    */
+
+  __IO uint32_t                 Overwrites;          /*!< Number of frames captured into a buffer still
+                                                          owned by the application                        */
+} DCMI_FrameRingTypeDef;
+
 /**
   * @brief  DCMI handle Structure definition
   */
@@ -147,11 +176,15 @@ typedef struct
 
   __IO uint32_t                 ErrorCode;           /*!< DCMI Error code              */
 
+  DCMI_FrameRingTypeDef         *pFrameRing;         /*!< Running frame ring, NULL when not used */
+
 #if (USE_HAL_DCMI_REGISTER_CALLBACKS == 1)
   void (* FrameEventCallback)(struct __DCMI_HandleTypeDef *hdcmi);       /*!< DCMI Frame Event Callback */
   void (* VsyncEventCallback)(struct __DCMI_HandleTypeDef *hdcmi);       /*!< DCMI Vsync Event Callback */
   void (* LineEventCallback)(struct __DCMI_HandleTypeDef *hdcmi);        /*!< DCMI Line Event Callback  */
   void (* ErrorCallback)(struct __DCMI_HandleTypeDef *hdcmi);            /*!< DCMI Error Callback       */
+  void (* FrameReadyCallback)(struct __DCMI_HandleTypeDef *hdcmi, uint32_t FrameIndex,
+                              uint32_t Timestamp);                       /*!< DCMI Frame Ready Callback */
   void (* MspInitCallback)(struct __DCMI_HandleTypeDef *hdcmi);          /*!< DCMI Msp Init callback    */
   void (* MspDeInitCallback)(struct __DCMI_HandleTypeDef *hdcmi);        /*!< DCMI Msp DeInit callback  */
 #endif  /* USE_HAL_DCMI_REGISTER_CALLBACKS */
@@ -176,6 +209,8 @@ typedef enum
   * @brief  HAL DCMI Callback pointer definition
   */
 typedef void (*pDCMI_CallbackTypeDef)(DCMI_HandleTypeDef *hdcmi); /*!< pointer to a DCMI callback function */
+typedef void (*pDCMI_FrameReadyCallbackTypeDef)(DCMI_HandleTypeDef *hdcmi, uint32_t FrameIndex,
+                                                uint32_t Timestamp); /*!< pointer to a DCMI Frame Ready callback */
 #endif /* USE_HAL_DCMI_REGISTER_CALLBACKS */
 
 
@@ -188,6 +223,14 @@ typedef void (*pDCMI_CallbackTypeDef)(DCMI_HandleTypeDef *hdcmi); /*!< pointer t
   * @{
   */
 
+/** @defgroup DCMI_Frame_Ring DCMI Frame Ring
+  * @{
+  */
+#define DCMI_FRAME_RING_MAX_FRAMES      32U            /*!< Maximum number of frame buffers of a frame ring */
+/**
+  * @}
+  */
+
 /** @defgroup DCMI_Error_Code DCMI Error Code
   * @{
   */
@@ -544,6 +587,9 @@ void       HAL_DCMI_MspDeInit(DCMI_HandleTypeDef *hdcmi);
 HAL_StatusTypeDef HAL_DCMI_RegisterCallback(DCMI_HandleTypeDef *hdcmi, HAL_DCMI_CallbackIDTypeDef CallbackID,
                                             pDCMI_CallbackTypeDef pCallback);
 HAL_StatusTypeDef HAL_DCMI_UnRegisterCallback(DCMI_HandleTypeDef *hdcmi, HAL_DCMI_CallbackIDTypeDef CallbackID);
+HAL_StatusTypeDef HAL_DCMI_RegisterFrameReadyCallback(DCMI_HandleTypeDef *hdcmi,
+                                                      pDCMI_FrameReadyCallbackTypeDef pCallback);
+HAL_StatusTypeDef HAL_DCMI_UnRegisterFrameReadyCallback(DCMI_HandleTypeDef *hdcmi);
 #endif /* USE_HAL_DCMI_REGISTER_CALLBACKS */
 /**
   * @}
@@ -557,10 +603,13 @@ HAL_StatusTypeDef HAL_DCMI_Start_DMA(DCMI_HandleTypeDef *hdcmi, uint32_t DCMI_Mo
 HAL_StatusTypeDef HAL_DCMI_Stop(DCMI_HandleTypeDef *hdcmi);
 HAL_StatusTypeDef HAL_DCMI_Suspend(DCMI_HandleTypeDef *hdcmi);
 HAL_StatusTypeDef HAL_DCMI_Resume(DCMI_HandleTypeDef *hdcmi);
+HAL_StatusTypeDef HAL_DCMI_FrameRing_Start(DCMI_HandleTypeDef *hdcmi, DCMI_FrameRingTypeDef *pRing);
+HAL_StatusTypeDef HAL_DCMI_FrameRing_Release(DCMI_HandleTypeDef *hdcmi, uint32_t FrameIndex);
 void       HAL_DCMI_ErrorCallback(DCMI_HandleTypeDef *hdcmi);
 void       HAL_DCMI_LineEventCallback(DCMI_HandleTypeDef *hdcmi);
 void       HAL_DCMI_FrameEventCallback(DCMI_HandleTypeDef *hdcmi);
 void       HAL_DCMI_VsyncEventCallback(DCMI_HandleTypeDef *hdcmi);
+void       HAL_DCMI_FrameReadyCallback(DCMI_HandleTypeDef *hdcmi, uint32_t FrameIndex, uint32_t Timestamp);
 void       HAL_DCMI_IRQHandler(DCMI_HandleTypeDef *hdcmi);
 /**
   * @}
@@ -92,9 +92,62 @@ typedef enum
   */
 #define __HAL_RESET_HANDLE_STATE(__HANDLE__) ((__HANDLE__)->State = 0)
 
+#if defined(USE_HAL_CLOCK_GATING) && (USE_HAL_CLOCK_GATING == 1U)
+/**
+  * @brief  Re-enable the clock of a peripheral gated by HAL_ClockGate_Process(), called on each handle lock.
+  * @note   Defined in stm32h5xx_hal.c.
+  * @param  pHandle Handle of the driver.
+  * @retval None
+  */
+void HAL_ClockGate_Wake(const void *pHandle);
+
+#define HAL_CLOCKGATE_WAKE(__HANDLE__)  HAL_ClockGate_Wake((const void *)(__HANDLE__))
+#else
+#define HAL_CLOCKGATE_WAKE(__HANDLE__)  ((void)0U)
+#endif /* USE_HAL_CLOCK_GATING */
+
 #if (USE_RTOS == 1)
 /* Reserved for future use */
 #error " USE_RTOS should be 0 in the current HAL release "
+#elif defined(USE_HAL_ATOMIC_LOCK) && (USE_HAL_ATOMIC_LOCK == 1U)
+/**
+  * @brief  Take a handle lock with an exclusive access, safe between thread and interrupt contexts.
+  * @note   The lock is accessed on its first byte, holding the HAL_LockTypeDef value whatever
+  *         the enumeration size.
+  * @param  pLock Address of the Lock field of the handle.
+  * @retval 0 if the lock is taken, 1 if it is already locked.
+  */
+__STATIC_FORCEINLINE uint32_t HAL_LockTry(volatile uint8_t *pLock)
+{
+  do
+  {
+    if (__LDREXB(pLock) != (uint8_t)HAL_UNLOCKED)
+    {
+      __CLREX();
+      return 1U;
+    }
+  } while (__STREXB((uint8_t)HAL_LOCKED, pLock) != 0U);
+
+  /* Accesses to the handle are not done before the lock */
+  __DMB();
+
+  return 0U;
+}
+
+#define __HAL_LOCK(__HANDLE__)                                              \
+  do{                                                                       \
+    if(HAL_LockTry((volatile uint8_t *)&(__HANDLE__)->Lock) != 0U)          \
+    {                                                                       \
+      return HAL_BUSY;                                                      \
+    }                                                                       \
+    HAL_CLOCKGATE_WAKE(__HANDLE__);                                         \
+  }while (0)
+
+#define __HAL_UNLOCK(__HANDLE__)           \
+  do{                                      \
+    __DMB();                               \
+    (__HANDLE__)->Lock = HAL_UNLOCKED;     \
+  }while (0)
 #else
 #define __HAL_LOCK(__HANDLE__)             \
   do{                                      \
@@ -105,6 +158,7 @@ typedef enum
     else                                   \
     {                                      \
       (__HANDLE__)->Lock = HAL_LOCKED;     \
+      HAL_CLOCKGATE_WAKE(__HANDLE__);      \
     }                                      \
   }while (0)
 
@@ -112,7 +166,77 @@ typedef enum
   do{                                      \
     (__HANDLE__)->Lock = HAL_UNLOCKED;     \
   }while (0)
-#endif /* USE_RTOS */
+#endif /* USE_RTOS, USE_HAL_ATOMIC_LOCK */
+
+/* Trace event identifiers, the exit events have HAL_TRACE_EXIT_FLAG set */
+#define HAL_TRACE_EXIT_FLAG             0x80000000U
+#define HAL_TRACE_ID_ADC_IRQ            0x01U
+#define HAL_TRACE_ID_DMA_IRQ            0x02U
+#define HAL_TRACE_ID_DMA_START          0x03U
+#define HAL_TRACE_ID_DMA_LIST_START     0x04U
+#define HAL_TRACE_ID_ETH_IRQ            0x05U
+#define HAL_TRACE_ID_EXTI_IRQ           0x06U
+#define HAL_TRACE_ID_FDCAN_IRQ          0x07U
+#define HAL_TRACE_ID_GPIO_EXTI_IRQ      0x08U
+#define HAL_TRACE_ID_I2C_EV_IRQ         0x09U
+#define HAL_TRACE_ID_I2C_ER_IRQ         0x0AU
+#define HAL_TRACE_ID_SAI_IRQ            0x0BU
+#define HAL_TRACE_ID_SPI_IRQ            0x0CU
+#define HAL_TRACE_ID_TIM_IRQ            0x0DU
+#define HAL_TRACE_ID_UART_IRQ           0x0EU
+#define HAL_TRACE_ID_USART_IRQ          0x0FU
+#define HAL_TRACE_ID_USER               0x100U  /*!< First identifier free for the application events */
+
+#if defined(USE_HAL_TRACE) && (USE_HAL_TRACE == 1U)
+/**
+  * @brief  Trace hook called at the entry and exit of the instrumented HAL functions.
+  * @note   Defined as weak in stm32h5xx_hal.c with a ring buffer backend.
+  * @param  Event Event identifier, ORed with HAL_TRACE_EXIT_FLAG on exit.
+  * @param  pHandle Handle of the driver, NULL when the function has no handle.
+  * @retval None
+  */
+void HAL_Trace_Hook(uint32_t Event, const void *pHandle);
+
+#define HAL_TRACE_ENTER(__ID__, __HANDLE__)  HAL_Trace_Hook((__ID__), (const void *)(__HANDLE__))
+#define HAL_TRACE_EXIT(__ID__, __HANDLE__)   HAL_Trace_Hook(((__ID__) | HAL_TRACE_EXIT_FLAG), \
+                                                            (const void *)(__HANDLE__))
+#else
+#define HAL_TRACE_ENTER(__ID__, __HANDLE__)  ((void)0U)
+#define HAL_TRACE_EXIT(__ID__, __HANDLE__)   ((void)0U)
+#endif /* USE_HAL_TRACE */
+
+#if defined(USE_HAL_REQUEST) && (USE_HAL_REQUEST == 1U)
+/**
+  * @brief  Asynchronous request run by the DMA of a driver, see HAL_Request_Submit().
+  */
+typedef struct __HAL_RequestTypeDef
+{
+  HAL_StatusTypeDef (*Start)(struct __HAL_RequestTypeDef *pReq); /*!< Driver function starting the DMA transfer of
+                                                                       the request, e.g. HAL_SPIEx_Request_Start */
+  void *Handle;                                   /*!< Handle of the driver running the request */
+  uint32_t Operation;                             /*!< Driver specific operation, e.g. HAL_CRYP_REQUEST_ENCRYPT */
+  const uint8_t *pSrc;                            /*!< Input buffer, NULL when the operation has no input */
+  uint8_t *pDst;                                  /*!< Output buffer, NULL when the operation has no output */
+  uint32_t Size;                                  /*!< Amount of data, in the unit of the driver DMA function */
+  struct __HAL_RequestTypeDef *pNext;             /*!< Request submitted when this one completes with HAL_OK,
+                                                       NULL at the end of the chain */
+  void (*CpltCallback)(struct __HAL_RequestTypeDef *pReq); /*!< Optional completion callback, called from the
+                                                                completion context, NULL if not used */
+  struct __HAL_RequestQueueTypeDef *pCpltQueue;   /*!< Optional queue receiving the request on completion,
+                                                       NULL if not used */
+  __IO HAL_StatusTypeDef Status;                  /*!< HAL_BUSY while pending, then the completion status */
+  struct __HAL_RequestTypeDef *pCpltNext;         /*!< Link in the completion queue, internal use */
+} HAL_RequestTypeDef;
+
+/**
+  * @brief  Queue of completed asynchronous requests, see HAL_RequestQueue_Get().
+  */
+typedef struct __HAL_RequestQueueTypeDef
+{
+  HAL_RequestTypeDef *pHead;                      /*!< Oldest completed request */
+  HAL_RequestTypeDef *pTail;                      /*!< Last completed request */
+} HAL_RequestQueueTypeDef;
+#endif /* USE_HAL_REQUEST */
 
 #if  defined ( __GNUC__ )
 #ifndef __weak
@@ -172,6 +296,35 @@ typedef enum
 #define ALIGN_32BYTES(buf) __align(32) buf
 #endif /* __GNUC__ */
 
+/* Macros to place a variable in a linker section, e.g. a DMA buffer in a SRAM reachable by the DMA masters
+   using it. The macro is put before the declaration, the section must be defined in the linker script
+   (ICF file for IAR, scatter file for ARM Compiler). The section names can be redefined in the HAL
+   configuration file */
+#ifndef HAL_SRAM1_SECTION
+#define HAL_SRAM1_SECTION      ".sram1"
+#endif /* HAL_SRAM1_SECTION */
+#ifndef HAL_SRAM2_SECTION
+#define HAL_SRAM2_SECTION      ".sram2"
+#endif /* HAL_SRAM2_SECTION */
+#ifndef HAL_SRAM3_SECTION
+#define HAL_SRAM3_SECTION      ".sram3"
+#endif /* HAL_SRAM3_SECTION */
+#ifndef HAL_BKPSRAM_SECTION
+#define HAL_BKPSRAM_SECTION    ".bkpsram"
+#endif /* HAL_BKPSRAM_SECTION */
+
+#if defined (__ICCARM__)        /* IAR Compiler */
+#define __HAL_PRAGMA(x)        _Pragma(#x)
+#define __HAL_SECTION(name)    __HAL_PRAGMA(location = name)
+#else                           /* GNU and ARM Compilers */
+#define __HAL_SECTION(name)    __attribute__((section(name)))
+#endif /* __ICCARM__ */
+
+#define __SRAM1_BUFFER         __HAL_SECTION(HAL_SRAM1_SECTION)
+#define __SRAM2_BUFFER         __HAL_SECTION(HAL_SRAM2_SECTION)
+#define __SRAM3_BUFFER         __HAL_SECTION(HAL_SRAM3_SECTION)
+#define __BKPSRAM_BUFFER       __HAL_SECTION(HAL_BKPSRAM_SECTION)
+
 /**
   * @brief  __RAM_FUNC definition
   */
@@ -152,6 +152,33 @@ typedef enum
 
 } HAL_DMA_CallbackIDTypeDef;
 
+#if (USE_HAL_DMA_STATISTICS == 1U)
+/**
+  * @brief  DMA Channel Statistics Structure Definition.
+  */
+typedef struct
+{
+  uint32_t XferCount;     /*!< Number of completed transfers                                                    */
+
+  uint32_t XferBytes;     /*!< Number of bytes of the completed transfers (normal mode transfers only)          */
+
+  uint64_t XferCycles;    /*!< Cumulative DWT cycles from transfer start to transfer complete                   */
+
+  uint32_t XferCyclesMax; /*!< Maximum DWT cycles from transfer start to transfer complete                      */
+
+  uint32_t DTECount;      /*!< Number of data transfer errors                                                   */
+
+  uint32_t ULECount;      /*!< Number of update linked-list item errors                                         */
+
+  uint32_t USECount;      /*!< Number of user setting errors                                                    */
+
+  uint32_t TOCount;       /*!< Number of trigger overrun errors                                                 */
+
+  uint32_t ISRCyclesMax;  /*!< Maximum DWT cycles spent in HAL_DMA_IRQHandler, callbacks included               */
+
+} DMA_StatisticsTypeDef;
+#endif /* USE_HAL_DMA_STATISTICS */
+
 /**
   * @brief  DMA handle Structure definition
   */
@@ -185,6 +212,16 @@ typedef struct __DMA_HandleTypeDef
 
   struct __DMA_QListTypeDef  *LinkedListQueue;                     /*!< DMA linked-list queue                   */
 
+  uint32_t                  MemsetPattern;                         /*!< DMA memory set source pattern           */
+
+#if (USE_HAL_DMA_STATISTICS == 1U)
+  DMA_StatisticsTypeDef     Statistics;                            /*!< DMA channel statistics                  */
+
+  uint32_t                  XferStartTimeStamp;                    /*!< DWT cycle counter value at transfer start */
+
+  uint32_t                  XferSize;                              /*!< Size in bytes of the ongoing transfer   */
+#endif /* USE_HAL_DMA_STATISTICS */
+
 } DMA_HandleTypeDef;
 /**
   * @}
@@ -1020,6 +1057,10 @@ HAL_StatusTypeDef HAL_DMA_Start_IT(DMA_HandleTypeDef *const hdma,
                                    uint32_t SrcAddress,
                                    uint32_t DstAddress,
                                    uint32_t SrcDataSize);
+HAL_StatusTypeDef HAL_DMA_Restart(DMA_HandleTypeDef *const hdma,
+                                  uint32_t SrcAddress,
+                                  uint32_t DstAddress,
+                                  uint32_t SrcDataSize);
 HAL_StatusTypeDef HAL_DMA_Abort(DMA_HandleTypeDef *const hdma);
 HAL_StatusTypeDef HAL_DMA_Abort_IT(DMA_HandleTypeDef *const hdma);
 HAL_StatusTypeDef HAL_DMA_PollForTransfer(DMA_HandleTypeDef *const hdma,
@@ -61,6 +61,38 @@ typedef struct
   uint32_t *Address;       /*!< The Command List Base Address    */
   uint32_t Index;          /*!< The Current Command List Address */
 } DMA2D_CL_CommandListTypeDef;
+
+/**
+  * @brief DMA2D Command List frame rectangle Structure definition
+  */
+typedef struct
+{
+  uint32_t X;              /*!< Left pixel of the rectangle       */
+  uint32_t Y;              /*!< Top line of the rectangle         */
+  uint32_t Width;          /*!< Width of the rectangle, in pixels */
+  uint32_t Height;         /*!< Height of the rectangle, in lines */
+} DMA2D_CL_RectTypeDef;
+
+/**
+  * @brief DMA2D Command List dirty region Structure definition
+  */
+typedef struct
+{
+  DMA2D_CL_RectTypeDef *pRects;   /*!< User array of MaxRects disjoint rectangles */
+  uint32_t MaxRects;              /*!< Number of entries of pRects                */
+  uint32_t RectCount;             /*!< Number of dirty rectangles                 */
+  uint32_t FrameWidth;            /*!< Width of the frame buffers, in pixels      */
+  uint32_t FrameHeight;           /*!< Height of the frame buffers, in lines      */
+} DMA2D_CL_DirtyRegionTypeDef;
+
+/**
+  * @brief DMA2D Command List frame buffer Structure definition
+  */
+typedef struct
+{
+  uint32_t Address;        /*!< Base address of the frame buffer            */
+  uint32_t PixelSize;      /*!< Size of a pixel in bytes, from 1 to 4       */
+} DMA2D_CL_FrameBufferTypeDef;
 /**
   * @brief DMA2D Stencil Configuration Structure definition
   */
@@ -192,6 +224,43 @@ typedef enum
   HAL_DMA2D_STATE_SUSPEND           = 0x05U     /*!< DMA2D process is suspended                  */
 } HAL_DMA2D_StateTypeDef;
 
+#if defined(HAL_LTDC_MODULE_ENABLED)
+/**
+  * @brief  DMA2D tiled blending Structure definition
+  */
+typedef struct
+{
+  uint32_t SrcAddress1;                   /*!< Foreground source address, or color in DMA2D_M2M_BLEND_FG mode      */
+
+  uint32_t SrcAddress2;                   /*!< Background source address, or color in DMA2D_M2M_BLEND_BG mode      */
+
+  uint32_t DstAddress;                    /*!< Destination address, in the frame buffer scanned out by the LTDC     */
+
+  uint32_t Width;                         /*!< Width of the blended area, in pixels                                 */
+
+  uint32_t Height;                        /*!< Height of the blended area, in lines                                 */
+
+  uint32_t SrcPitch1;                     /*!< Distance in bytes between two lines of the foreground source        */
+
+  uint32_t SrcPitch2;                     /*!< Distance in bytes between two lines of the background source        */
+
+  uint32_t DstPitch;                      /*!< Distance in bytes between two lines of the destination              */
+
+  uint32_t TileHeight;                    /*!< Number of lines blended by one DMA2D transfer                        */
+
+  uint32_t RasterOffset;                  /*!< LTDC line position of the first destination line, that is
+                                               AccumulatedVBP + 1 plus the vertical position of the layer window */
+
+  struct __LTDC_HandleTypeDef *hltdc;     /*!< LTDC handle scanning out the destination                            */
+
+  __IO uint32_t NextLine;                 /*!< First line not yet blended, driver internal                          */
+
+  __IO uint32_t ScannedLine;              /*!< Lines already scanned out by the LTDC, driver internal               */
+
+  __IO uint32_t Running;                  /*!< A tile transfer is ongoing, driver internal                          */
+} DMA2D_TiledBlendingTypeDef;
+#endif /* HAL_LTDC_MODULE_ENABLED */
+
 /**
   * @brief  DMA2D handle Structure definition
   */
@@ -223,6 +292,10 @@ typedef struct __DMA2D_HandleTypeDef
   __IO HAL_DMA2D_StateTypeDef State;                                      /*!< DMA2D transfer state.                  */
 
   __IO uint32_t               ErrorCode;                                  /*!< DMA2D error code.                      */
+
+#if defined(HAL_LTDC_MODULE_ENABLED)
+  DMA2D_TiledBlendingTypeDef  *pTiledBlending;                            /*!< Ongoing tiled blending, NULL if none   */
+#endif /* HAL_LTDC_MODULE_ENABLED */
 } DMA2D_HandleTypeDef;
 #endif /* USE_DMA2D_COMMAND_LIST_MODE == 0 */
 #if (USE_DMA2D_COMMAND_LIST_MODE == 1)
@@ -851,6 +924,10 @@ HAL_StatusTypeDef HAL_DMA2D_Start_IT(DMA2D_HandleTypeDef *hdma2d, uint32_t pdata
                                      uint32_t Height);
 HAL_StatusTypeDef HAL_DMA2D_BlendingStart_IT(DMA2D_HandleTypeDef *hdma2d, uint32_t SrcAddress1, uint32_t SrcAddress2,
                                              uint32_t DstAddress, uint32_t Width, uint32_t Height);
+#if defined(HAL_LTDC_MODULE_ENABLED)
+HAL_StatusTypeDef HAL_DMA2D_TiledBlendingStart_IT(DMA2D_HandleTypeDef *hdma2d, DMA2D_TiledBlendingTypeDef *pTiled);
+HAL_StatusTypeDef HAL_DMA2D_TiledBlending_LineEvent(DMA2D_HandleTypeDef *hdma2d);
+#endif /* HAL_LTDC_MODULE_ENABLED */
 HAL_StatusTypeDef HAL_DMA2D_Suspend(DMA2D_HandleTypeDef *hdma2d);
 HAL_StatusTypeDef HAL_DMA2D_Resume(DMA2D_HandleTypeDef *hdma2d);
 HAL_StatusTypeDef HAL_DMA2D_Abort(DMA2D_HandleTypeDef *hdma2d);
@@ -919,6 +996,10 @@ uint32_t               HAL_DMA2D_GetError(const DMA2D_HandleTypeDef *hdma2d);
           HAL_DMA2D_CL_AddConfigDownscalingCMD(),
           HAL_DMA2D_CL_AddProgramLineEventCMD(), HAL_DMA2D_CL_AddCopyCMD(),
           HAL_DMA2D_CL_AddBlendingCMD(), HAL_DMA2D_CL_AddCLUTStartLoadCMD().
+      (+) Track the dirty rectangles of a frame with HAL_DMA2D_CL_DirtyRegion_Init(),
+          HAL_DMA2D_CL_DirtyRegion_Add() and HAL_DMA2D_CL_DirtyRegion_Reset(), and
+          redraw only them using HAL_DMA2D_CL_AddRegionCopyCMD() and
+          HAL_DMA2D_CL_AddRegionBlendingCMD().
       (+) Insert prepared command lists into the ring buffer and start
           execution using HAL_DMA2D_CL_InsertCommandList(), HAL_DMA2D_CL_Start()
           and HAL_DMA2D_CL_StartOpt().
@@ -980,6 +1061,22 @@ HAL_StatusTypeDef HAL_DMA2D_CL_AddCopyCMD(DMA2D_CL_HandleTypeDef *hdma2d, uint32
 HAL_StatusTypeDef HAL_DMA2D_CL_AddBlendingCMD(DMA2D_CL_HandleTypeDef *hdma2d, uint32_t SrcAddress1,
                                               uint32_t SrcAddress2, uint32_t DstAddress, uint32_t Width,
                                               uint32_t Height ,DMA2D_CL_CommandListTypeDef *pCommandList);
+HAL_StatusTypeDef HAL_DMA2D_CL_DirtyRegion_Init(DMA2D_CL_DirtyRegionTypeDef *pRegion, DMA2D_CL_RectTypeDef *pRects,
+                                                uint32_t MaxRects, uint32_t FrameWidth, uint32_t FrameHeight);
+HAL_StatusTypeDef HAL_DMA2D_CL_DirtyRegion_Add(DMA2D_CL_DirtyRegionTypeDef *pRegion,
+                                               const DMA2D_CL_RectTypeDef *pRect);
+HAL_StatusTypeDef HAL_DMA2D_CL_DirtyRegion_Reset(DMA2D_CL_DirtyRegionTypeDef *pRegion);
+HAL_StatusTypeDef HAL_DMA2D_CL_AddRegionCopyCMD(DMA2D_CL_HandleTypeDef *hdma2d,
+                                                const DMA2D_CL_DirtyRegionTypeDef *pRegion,
+                                                const DMA2D_CL_FrameBufferTypeDef *pSrc,
+                                                const DMA2D_CL_FrameBufferTypeDef *pDst,
+                                                DMA2D_CL_CommandListTypeDef *pCommandList);
+HAL_StatusTypeDef HAL_DMA2D_CL_AddRegionBlendingCMD(DMA2D_CL_HandleTypeDef *hdma2d,
+                                                    const DMA2D_CL_DirtyRegionTypeDef *pRegion,
+                                                    const DMA2D_CL_FrameBufferTypeDef *pFg,
+                                                    const DMA2D_CL_FrameBufferTypeDef *pBg,
+                                                    const DMA2D_CL_FrameBufferTypeDef *pDst,
+                                                    DMA2D_CL_CommandListTypeDef *pCommandList);
 HAL_StatusTypeDef HAL_DMA2D_CL_Init_CommandList(uint32_t *Address, uint32_t Size,
                                                 DMA2D_CL_CommandListTypeDef *pCommandList);
 HAL_StatusTypeDef HAL_DMA2D_CL_ResetIndex(DMA2D_CL_CommandListTypeDef *pCommandList);
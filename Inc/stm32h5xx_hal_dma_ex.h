@@ -173,6 +173,9 @@ typedef struct __DMA_QListTypeDef
 
   DMA_NodeTypeDef                *FirstCircularNode; /*!< Specifies the queue first circular node          */
 
+  DMA_NodeTypeDef                *Tail;              /*!< Specifies the queue tail node cache, NULL when it is
+                                                          not valid                                        */
+
   uint32_t                       NodeNumber;         /*!< Specifies the queue node number                  */
 
   __IO HAL_DMA_QStateTypeDef     State;              /*!< Specifies the queue state                        */
@@ -182,6 +185,144 @@ typedef struct __DMA_QListTypeDef
   __IO uint32_t                  Type;               /*!< Specifies whether the queue is static or dynamic */
 
 } DMA_QListTypeDef;
+
+/**
+  * @brief DMAEx Linked-List Node Pool Structure Definition.
+  */
+typedef struct
+{
+  DMA_NodeTypeDef *pFree;   /*!< Specifies the first free node of the pool, free nodes are chained through
+                                 their first register                                                    */
+
+  uint32_t        NodeNbr;  /*!< Specifies the pool node number                                          */
+
+  __IO uint32_t   FreeNbr;  /*!< Specifies the pool free node number                                     */
+
+} DMA_NodePoolTypeDef;
+
+/**
+  * @brief  DMAEx Event Capture Configuration Structure Definition.
+  * @note   The queue, the node and the buffer are provided by the user and must stay allocated while the capture
+  *         runs.
+  */
+typedef struct
+{
+  DMA_QListTypeDef *pQueue;         /*!< Specifies the linked-list queue used to build the capture ring            */
+
+  DMA_NodeTypeDef  *pNode;          /*!< Specifies the linked-list node of the capture ring                        */
+
+  uint32_t         Trigger;         /*!< Specifies the event capturing one data, typically an EXTI line.
+                                         This parameter can be a value of @ref DMAEx_Trigger_Selection             */
+
+  uint32_t         TriggerPolarity; /*!< Specifies the captured edge of the trigger event.
+                                         This parameter can be a value of @ref DMAEx_Trigger_Polarity              */
+
+  uint32_t         SrcAddress;      /*!< Specifies the captured register address (GPIO port IDR, timer CNT, ...)   */
+
+  uint32_t         DataWidth;       /*!< Specifies the captured data width.
+                                         This parameter can be a value of @ref DMA_Source_Data_Width              */
+
+  void             *pBuffer;        /*!< Specifies the capture ring buffer                                         */
+
+  uint32_t         Length;          /*!< Specifies the capture ring buffer length in data                          */
+
+} DMA_EventCaptureConfTypeDef;
+
+/**
+  * @brief  DMAEx Pipeline Stage Structure Definition.
+  * @note   A stage moves the data of a source peripheral to a destination peripheral through a buffer of two blocks :
+  *         the fill channel writes one half while the drain channel, triggered by the end of each fill block, reads
+  *         the other half. The stage must stay allocated while the pipeline runs.
+  */
+typedef struct
+{
+  DMA_HandleTypeDef *hdmaFill;      /*!< Specifies the channel filling the buffer from the source peripheral,
+                                         initialized in DMA_LINKEDLIST_CIRCULAR mode                                 */
+
+  DMA_HandleTypeDef *hdmaDrain;     /*!< Specifies the channel draining the buffer to the destination peripheral,
+                                         initialized in DMA_LINKEDLIST_CIRCULAR mode                                 */
+
+  uint32_t          SrcRequest;     /*!< Specifies the source peripheral request.
+                                         This parameter can be a value of @ref DMA_Request_Selection               */
+
+  uint32_t          SrcAddress;     /*!< Specifies the source peripheral data register address                      */
+
+  uint32_t          SrcDataWidth;   /*!< Specifies the source peripheral data width.
+                                         This parameter can be a value of @ref DMA_Source_Data_Width              */
+
+  uint32_t          DstRequest;     /*!< Specifies the destination peripheral request.
+                                         This parameter can be a value of @ref DMA_Request_Selection               */
+
+  uint32_t          DstAddress;     /*!< Specifies the destination peripheral data register address                 */
+
+  uint32_t          DstDataWidth;   /*!< Specifies the destination peripheral data width.
+                                         This parameter can be a value of @ref DMA_Source_Data_Width              */
+
+  uint8_t           *pBuffer;       /*!< Specifies the intermediate buffer of two blocks                            */
+
+  DMA_QListTypeDef  FillQueue;      /*!< Fill channel ring queue, used by the pipeline                              */
+
+  DMA_QListTypeDef  DrainQueue;     /*!< Drain channel ring queue, used by the pipeline                             */
+
+  DMA_NodeTypeDef   FillNodes[2U];  /*!< Fill channel ring nodes, one per buffer half, used by the pipeline         */
+
+  DMA_NodeTypeDef   DrainNodes[2U]; /*!< Drain channel ring nodes, one per buffer half, used by the pipeline        */
+
+} DMA_PipelineStageTypeDef;
+
+/**
+  * @brief  DMAEx Pipeline Structure Definition.
+  */
+typedef struct __DMA_PipelineTypeDef
+{
+  DMA_PipelineStageTypeDef *pStages;                                   /*!< Specifies the stages array, the
+                                                                            destination peripheral of a stage
+                                                                            feeds the source peripheral of the
+                                                                            next one                          */
+
+  uint32_t                 StageNbr;                                   /*!< Specifies the number of stages     */
+
+  uint32_t                 BlockSize;                                  /*!< Specifies the block size in bytes,
+                                                                            a multiple of all the stage data
+                                                                            widths                            */
+
+  uint32_t                 BlockNbr;                                   /*!< Specifies the number of blocks of
+                                                                            the transfer, 0 to run until
+                                                                            HAL_DMAEx_Pipeline_Stop()         */
+
+  __IO uint32_t            BlockCount;                                 /*!< Blocks delivered by the last stage */
+
+  void (* XferCpltCallback)(struct __DMA_PipelineTypeDef *pPipeline);  /*!< Transfer complete callback        */
+
+  void (* XferErrorCallback)(struct __DMA_PipelineTypeDef *pPipeline); /*!< Transfer error callback           */
+
+} DMA_PipelineTypeDef;
+
+/**
+  * @brief  DMAEx Bus Traffic Structure Definition.
+  * @note   A traffic is a copy of Size bytes run by a memory to memory channel or by the CPU. The measurement
+  *         fields are filled by HAL_DMAEx_BusProfile().
+  */
+typedef struct
+{
+  DMA_HandleTypeDef *hdma;          /*!< Specifies the memory to memory channel generating the traffic, initialized in
+                                         DMA_NORMAL mode, NULL for a CPU copy                                        */
+
+  uint32_t          SrcAddress;     /*!< Specifies the source buffer address, word aligned for a CPU copy           */
+
+  uint32_t          DstAddress;     /*!< Specifies the destination buffer address, word aligned for a CPU copy      */
+
+  uint32_t          Size;           /*!< Specifies the copy size in bytes, a multiple of 4 for a CPU copy           */
+
+  uint32_t          SoloCycles;     /*!< CPU cycles of the copy run alone                                           */
+
+  uint32_t          SharedCycles;   /*!< CPU cycles of the copy run concurrently with the other traffics            */
+
+  uint32_t          Bandwidth;      /*!< Bandwidth achieved concurrently with the other traffics, in KB/s          */
+
+  uint32_t          Slowdown;       /*!< SharedCycles in percent of SoloCycles, 100 without bus contention          */
+
+} DMA_BusTrafficTypeDef;
 /**
   * @}
   */
@@ -510,6 +651,19 @@ typedef struct __DMA_QListTypeDef
   * @}
   */
 
+/** @defgroup DMAEx_Channel_Features DMAEx Channel Features
+  * @brief    DMAEx Channel Features
+  * @{
+  */
+#define DMA_CHANNEL_FEATURE_NONE         0x00000000U /*!< Any channel (all channels support linked-list) */
+#define DMA_CHANNEL_FEATURE_FIFO_32BYTES 0x00000001U /*!< Channel with 32 bytes FIFO                       */
+#define DMA_CHANNEL_FEATURE_2D_ADDR      0x00000002U /*!< Channel with 2D addressing                       */
+#define DMA_CHANNEL_FEATURE_GPDMA1       0x00000100U /*!< Channel of GPDMA1 instance                       */
+#define DMA_CHANNEL_FEATURE_GPDMA2       0x00000200U /*!< Channel of GPDMA2 instance                       */
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -536,6 +690,18 @@ HAL_StatusTypeDef HAL_DMAEx_List_DeInit(DMA_HandleTypeDef *const hdma);
   */
 HAL_StatusTypeDef HAL_DMAEx_List_Start(DMA_HandleTypeDef *const hdma);
 HAL_StatusTypeDef HAL_DMAEx_List_Start_IT(DMA_HandleTypeDef *const hdma);
+HAL_StatusTypeDef HAL_DMAEx_List_SwapNextNodeBuffer(DMA_HandleTypeDef *const hdma,
+                                                    uint32_t BufferAddress,
+                                                    DMA_NodeTypeDef **const ppNode);
+HAL_StatusTypeDef HAL_DMAEx_Copy2D_IT(DMA_HandleTypeDef *const hdma,
+                                      DMA_QListTypeDef *const pQList,
+                                      DMA_NodeTypeDef *const pNodes,
+                                      uint32_t SrcAddress,
+                                      uint32_t SrcStride,
+                                      uint32_t DstAddress,
+                                      uint32_t DstStride,
+                                      uint32_t Width,
+                                      uint32_t Rows);
 /**
   * @}
   */
@@ -591,6 +757,18 @@ HAL_StatusTypeDef HAL_DMAEx_List_ConvertQToStatic(DMA_QListTypeDef *const pQList
 HAL_StatusTypeDef HAL_DMAEx_List_LinkQ(DMA_HandleTypeDef *const hdma,
                                        DMA_QListTypeDef *const pQList);
 HAL_StatusTypeDef HAL_DMAEx_List_UnLinkQ(DMA_HandleTypeDef *const hdma);
+
+HAL_StatusTypeDef HAL_DMAEx_List_InitNodePool(DMA_NodePoolTypeDef *const pPool,
+                                              DMA_NodeTypeDef *const pNodes,
+                                              uint32_t NodeNbr);
+DMA_NodeTypeDef *HAL_DMAEx_List_AllocNode(DMA_NodePoolTypeDef *const pPool);
+HAL_StatusTypeDef HAL_DMAEx_List_FreeNode(DMA_NodePoolTypeDef *const pPool,
+                                          DMA_NodeTypeDef *const pNode);
+HAL_StatusTypeDef HAL_DMAEx_List_CloneNode(DMA_NodeTypeDef const *const pTemplate,
+                                           DMA_NodeTypeDef *const pNode,
+                                           uint32_t SrcAddress,
+                                           uint32_t DstAddress,
+                                           uint32_t DataSize);
 /**
   * @}
   */
@@ -605,6 +783,7 @@ HAL_StatusTypeDef HAL_DMAEx_ConfigTrigger(DMA_HandleTypeDef *const hdma,
                                           DMA_TriggerConfTypeDef const *const pConfigTrigger);
 HAL_StatusTypeDef HAL_DMAEx_ConfigRepeatBlock(DMA_HandleTypeDef *const hdma,
                                               DMA_RepeatBlockConfTypeDef const *const pConfigRepeatBlock);
+HAL_StatusTypeDef HAL_DMAEx_GetTransferCpltTrigger(DMA_HandleTypeDef const *const hdma, uint32_t *const pTrigger);
 /**
   * @}
   */
@@ -629,6 +808,89 @@ uint32_t HAL_DMAEx_GetFifoLevel(DMA_HandleTypeDef const *const hdma);
   * @}
   */
 
+/** @defgroup DMAEx_Exported_Functions_Group7 Channel Allocation Functions
+  * @brief    Channel Allocation Functions
+  * @{
+  */
+HAL_StatusTypeDef HAL_DMAEx_ReserveChannel(DMA_Channel_TypeDef *const Instance);
+HAL_StatusTypeDef HAL_DMAEx_AcquireChannel(DMA_HandleTypeDef *const hdma,
+                                           uint32_t Features);
+HAL_StatusTypeDef HAL_DMAEx_ReleaseChannel(DMA_HandleTypeDef *const hdma);
+/**
+  * @}
+  */
+
+/** @defgroup DMAEx_Exported_Functions_Group8 Memory Copy and Set Functions
+  * @brief    Memory Copy and Set Functions
+  * @{
+  */
+HAL_StatusTypeDef HAL_DMAEx_Memcpy(DMA_HandleTypeDef *const hdma,
+                                   void *pDst,
+                                   void const *pSrc,
+                                   uint32_t Size,
+                                   uint32_t Timeout);
+HAL_StatusTypeDef HAL_DMAEx_Memcpy_IT(DMA_HandleTypeDef *const hdma,
+                                      void *pDst,
+                                      void const *pSrc,
+                                      uint32_t Size);
+HAL_StatusTypeDef HAL_DMAEx_Memset(DMA_HandleTypeDef *const hdma,
+                                   void *pDst,
+                                   uint8_t Value,
+                                   uint32_t Size,
+                                   uint32_t Timeout);
+HAL_StatusTypeDef HAL_DMAEx_Memset_IT(DMA_HandleTypeDef *const hdma,
+                                      void *pDst,
+                                      uint8_t Value,
+                                      uint32_t Size);
+/**
+  * @}
+  */
+
+#if (USE_HAL_DMA_STATISTICS == 1U)
+/** @defgroup DMAEx_Exported_Functions_Group9 Statistics Functions
+  * @brief    Statistics Functions
+  * @{
+  */
+HAL_StatusTypeDef HAL_DMAEx_GetStatistics(DMA_HandleTypeDef const *const hdma,
+                                          DMA_StatisticsTypeDef *const pStatistics);
+HAL_StatusTypeDef HAL_DMAEx_ResetStatistics(DMA_HandleTypeDef *const hdma);
+/**
+  * @}
+  */
+#endif /* USE_HAL_DMA_STATISTICS */
+
+/** @defgroup DMAEx_Exported_Functions_Group10 Event Capture Functions
+  * @brief    Event Capture Functions
+  * @{
+  */
+HAL_StatusTypeDef HAL_DMAEx_EventCapture_Start(DMA_HandleTypeDef *const hdma,
+                                               DMA_EventCaptureConfTypeDef const *const pConfig);
+HAL_StatusTypeDef HAL_DMAEx_EventCapture_Stop(DMA_HandleTypeDef *const hdma);
+uint32_t HAL_DMAEx_EventCapture_GetIndex(DMA_HandleTypeDef const *const hdma,
+                                         DMA_EventCaptureConfTypeDef const *const pConfig);
+/**
+  * @}
+  */
+
+/** @defgroup DMAEx_Exported_Functions_Group11 Pipeline Functions
+  * @brief    Pipeline Functions
+  * @{
+  */
+HAL_StatusTypeDef HAL_DMAEx_Pipeline_Start(DMA_PipelineTypeDef *const pPipeline);
+HAL_StatusTypeDef HAL_DMAEx_Pipeline_Stop(DMA_PipelineTypeDef *const pPipeline);
+/**
+  * @}
+  */
+
+/** @defgroup DMAEx_Exported_Functions_Group12 Bus Profiling Functions
+  * @brief    Bus Profiling Functions
+  * @{
+  */
+HAL_StatusTypeDef HAL_DMAEx_BusProfile(DMA_BusTrafficTypeDef *const pTraffic, uint32_t TrafficNbr, uint32_t Timeout);
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -698,6 +960,13 @@ typedef struct
 #define NODE_CLLR_2D_DEFAULT_OFFSET     (0x0007UL) /* CLLR 2D addressing default offset     */
 #define NODE_CLLR_LINEAR_DEFAULT_OFFSET (0x0005UL) /* CLLR linear addressing default offset */
 
+#if !defined (DMA_MEMCPY_CPU_THRESHOLD)
+#define DMA_MEMCPY_CPU_THRESHOLD          (32U)     /* Memory copy and set size executed by CPU below */
+#endif /* DMA_MEMCPY_CPU_THRESHOLD */
+
+#define DMA_CHANNEL_FEATURE_CAPS_MASK     (0x00FFU) /* DMA channel capabilities features mask */
+#define DMA_CHANNEL_FEATURE_INSTANCE_MASK (0xFF00U) /* DMA channel instance features mask     */
+
 #define DMA_BURST_ADDR_OFFSET_MIN       (-8192L)  /* DMA burst minimum address offset      */
 #define DMA_BURST_ADDR_OFFSET_MAX       (8192L)   /* DMA burst maximum address offset      */
 #define DMA_BLOCK_ADDR_OFFSET_MIN       (-65536L) /* DMA block minimum address offset      */
@@ -769,6 +1038,9 @@ typedef struct
 #define IS_DMA_NODE_TYPE(TYPE)          \
   (((TYPE) == DMA_GPDMA_LINEAR_NODE) || \
    ((TYPE) == DMA_GPDMA_2D_NODE))
+
+#define IS_DMA_CHANNEL_FEATURES(FEATURES) \
+  (((FEATURES) & ~(DMA_CHANNEL_FEATURE_CAPS_MASK | DMA_CHANNEL_FEATURE_INSTANCE_MASK)) == 0U)
 /**
   * @}
   */
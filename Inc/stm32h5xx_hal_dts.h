@@ -80,6 +80,24 @@ typedef enum
 
 } HAL_DTS_StateTypeDef;
 
+/**
+  * @brief  DTS thermal governor structure definition
+  */
+typedef struct __DTS_GovernorTypeDef
+{
+  const RCC_ClockProfileTypeDef *pProfiles; /*!< Clock profiles, from the fastest to the slowest               */
+  uint32_t           NbProfiles;            /*!< Number of clock profiles                                      */
+  int32_t            HighTemperature;       /*!< Temperature in deg C above which the next slower profile is
+                                                 applied                                                       */
+  int32_t            LowTemperature;        /*!< Temperature in deg C below which the next faster profile is
+                                                 applied, lower than HighTemperature                           */
+  uint32_t           MinInterval;           /*!< Minimum time in ms between two profile changes                */
+  __IO uint32_t      Level;                 /*!< Index of the applied profile                                  */
+  uint32_t           LastChange;            /*!< Tick of the last profile change                               */
+  uint32_t           NbStepsDown;           /*!< Number of changes to a slower profile                         */
+  uint32_t           NbStepsUp;             /*!< Number of changes to a faster profile                         */
+} DTS_GovernorTypeDef;
+
 /**
   * @brief  DTS Handle Structure definition
   */
@@ -93,6 +111,7 @@ typedef struct
   DTS_InitTypeDef            Init;                                    /*!< DTS required parameters                    */
   HAL_LockTypeDef            Lock;                                    /*!< DTS Locking object                         */
   __IO HAL_DTS_StateTypeDef  State;                                   /*!< DTS peripheral state                       */
+  struct __DTS_GovernorTypeDef *pGovernor;                            /*!< Thermal governor, NULL when not started    */
 
 #if (USE_HAL_DTS_REGISTER_CALLBACKS == 1U)
   void (* MspInitCallback)(struct __DTS_HandleTypeDef *hdts);         /*!< DTS Base Msp Init Callback                 */
@@ -464,6 +483,17 @@ void HAL_DTS_AsyncHighCallback(DTS_HandleTypeDef *hdts);
   * @}
   */
 
+/** @addtogroup DTS_Exported_Functions_Group4
+  * @{
+  */
+/* Thermal governor functions */
+HAL_StatusTypeDef HAL_DTS_Governor_Start(DTS_HandleTypeDef *hdts, DTS_GovernorTypeDef *pGovernor);
+HAL_StatusTypeDef HAL_DTS_Governor_Stop(DTS_HandleTypeDef *hdts);
+void              HAL_DTS_GovernorCallback(DTS_HandleTypeDef *hdts, uint32_t Level);
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -73,7 +73,7 @@ typedef struct
   __IO uint32_t DESC2;
   __IO uint32_t DESC3;
   uint32_t BackupAddr0; /* used to store rx buffer 1 address */
-  uint32_t BackupAddr1; /* used to store rx buffer 2 address */
+  uint32_t BackupAddr1; /* used to store the Rx flow of the last packet received in rx buffer 1 */
 } ETH_DMADescTypeDef;
 /**
   *
@@ -99,11 +99,11 @@ typedef struct __ETH_BufferTypeDef
   */
 typedef struct
 {
-  uint32_t  TxDesc[ETH_TX_DESC_CNT];        /*<! Tx DMA descriptors addresses */
-
   uint32_t  CurTxDesc;                      /*<! Current Tx descriptor index for packet transmission */
 
-  uint32_t *PacketAddress[ETH_TX_DESC_CNT];  /*<! Ethernet packet addresses array */
+  uint32_t **PacketAddress;                 /*<! Ethernet packet addresses array in use */
+
+  uint32_t *PacketAddressTab[ETH_TX_DESC_CNT]; /*<! Default Ethernet packet addresses array */
 
   uint32_t *CurrentPacketAddress;           /*<! Current transmit packet addresses */
 
@@ -177,6 +177,20 @@ typedef struct
   *
   */
 
+/**
+  * @brief  ETH packet completion record structure definition
+  */
+typedef struct
+{
+  void                 *pBuff;        /*!< Rx: packet built by the Rx link callback.
+                                           Tx: packet address given in ETH_TxPacketConfigTypeDef */
+  ETH_TimeStampTypeDef TimeStamp;     /*!< Timestamp written back by the DMA, both words are set
+                                           to UINT32_MAX when the packet was not timestamped */
+} ETH_PacketRecordTypeDef;
+/**
+  *
+  */
+
 #ifdef HAL_ETH_USE_PTP
 /**
   * @brief  ETH Timeupdate structure definition
@@ -186,21 +200,91 @@ typedef struct
   uint32_t Seconds;
   uint32_t NanoSeconds;
 } ETH_TimeTypeDef;
+/**
+  *
+  */
+
+/**
+  * @brief  ETH PTP clock servo structure definition
+  */
+typedef struct
+{
+  int32_t  Kp;                        /*!< Proportional gain in ppb per nanosecond of offset, 8 fractional bits */
+  int32_t  Ki;                        /*!< Integral gain in ppb per nanosecond of offset, 8 fractional bits */
+  uint32_t StepThreshold;             /*!< Offsets above this value in nanoseconds are stepped */
+  int32_t  MaxAdjustment;             /*!< Maximum frequency adjustment in ppb */
+  uint32_t BaseAddend;                /*!< Nominal addend, set by HAL_ETH_PTP_ServoInit() */
+  int32_t  Integral;                  /*!< Integral term in ppb */
+  int32_t  Adjustment;                /*!< Last frequency adjustment applied in ppb */
+} ETH_PTP_ServoTypeDef;
 /**
   *
   */
 #endif  /* HAL_ETH_USE_PTP */
 
 /**
-  * @brief  DMA Receive Descriptors Wrapper structure definition
+  * @brief  ETH MDIO transfer structure definition
+  */
+typedef struct
+{
+  uint32_t Operation;                 /*!< MDIO operation, a value of @ref ETH_MDIO_Operation */
+
+  uint32_t PHYAddr;                   /*!< PHY port address, must be a value from 0 to 31 */
+
+  uint32_t PHYReg;                    /*!< PHY register address, must be a value from 0 to 31 */
+
+  uint32_t Value;                     /*!< Value to write, or value read once the transfer is complete */
+} ETH_MDIOTransferTypeDef;
+/**
+  *
+  */
+
+/**
+  * @brief  ETH pool buffer header structure definition, stored in the cache line before the buffer data
+  */
+typedef struct __ETH_PoolBufferTypeDef
+{
+  struct __ETH_PoolBufferTypeDef *pNext; /*!< Next buffer of the packet, or of the pool free list */
+
+  uint8_t *pData;                     /*!< Buffer data, cache line aligned */
+
+  uint32_t Length;                    /*!< Length of the received data in the buffer */
+
+  struct __ETH_PoolBufferTypeDef *pNextPacket; /*!< First buffer of the next packet of a packet queue */
+} ETH_PoolBufferTypeDef;
+/**
+  *
+  */
+
+/**
+  * @brief  ETH fixed-size buffer pool structure definition
   */
 typedef struct
 {
-  uint32_t RxDesc[ETH_RX_DESC_CNT];     /*<! Rx DMA descriptors addresses. */
+  uint8_t *pMemory;                   /*!< Pool memory of ETH_BUFFER_POOL_SIZE(BufferSize, BufferNbr) bytes,
+                                           aligned on ETH_BUFFER_POOL_ALIGN */
+
+  uint32_t BufferSize;                /*!< Data size of each buffer, multiple of ETH_BUFFER_POOL_ALIGN */
+
+  uint32_t BufferNbr;                 /*!< Number of buffers of the pool */
+
+  __IO uint32_t FreeList;             /*!< Address of the first free buffer header, 0 when empty */
+} ETH_BufferPoolTypeDef;
+/**
+  *
+  */
 
+/**
+  * @brief  DMA Receive Descriptors Wrapper structure definition
+  */
+typedef struct
+{
   uint32_t ItMode;                      /*<! If 1, DMA will generate the Rx complete interrupt.
                                              If 0, DMA will not generate the Rx complete interrupt. */
 
+  uint32_t RxIntWatchdog;             /*<! If not 0, Rx complete interrupts are coalesced by the DMA
+                                           Rx watchdog timer instead of being generated per packet. */
+
   uint32_t RxDescIdx;                 /*<! Current Rx descriptor. */
 
   uint32_t RxDescCnt;                 /*<! Number of descriptors . */
@@ -213,6 +297,8 @@ typedef struct
 
   uint32_t pRxLastRxDesc;             /*<! Last received descriptor. */
 
+  uint32_t RxFlow;                    /*<! Flow of the last received packet. */
+
   ETH_TimeStampTypeDef TimeStamp;     /*<! Time Stamp Low value for receive. */
 
   void *pRxStart;                     /*<! Pointer to the first buff. */
@@ -446,6 +532,17 @@ typedef struct
 
   uint32_t                    RxBuffLen;                 /*!< Provides the length of Rx buffers size */
 
+  uint32_t                    TxDescNbr;                 /*!< Provides the number of DMA Tx descriptors in the list.
+                                                              If 0, ETH_TX_DESC_CNT descriptors are used */
+
+  uint32_t                    RxDescNbr;                 /*!< Provides the number of DMA Rx descriptors in the list.
+                                                              If 0, ETH_RX_DESC_CNT descriptors are used */
+
+  uint32_t
+  **TxPacketAddress;         /*!< Provides an array of TxDescNbr entries to track the Tx packets in use.
+                                  If NULL, the handle default array is used and TxDescNbr must not
+                                  exceed ETH_TX_DESC_CNT */
+
 } ETH_InitTypeDef;
 /**
   *
@@ -510,6 +607,15 @@ typedef  void (*pETH_rxAllocateCallbackTypeDef)(uint8_t **buffer);  /*!< pointer
   *
   */
 
+/**
+  * @brief  HAL ETH Rx Get Flow Buffer Function definition
+  */
+typedef  void (*pETH_rxFlowAllocateCallbackTypeDef)(uint8_t **buffer,
+                                                    uint32_t Flow);  /*!< pointer to an ETH Rx Get Flow Buffer */
+/**
+  *
+  */
+
 /**
   * @brief  HAL ETH Rx Set App Data Function definition
   */
@@ -519,6 +625,14 @@ typedef  void (*pETH_rxLinkCallbackTypeDef)(void **pStart, void **pEnd, uint8_t
   *
   */
 
+/**
+  * @brief  HAL ETH Rx Packet Function definition
+  */
+typedef  void (*pETH_rxPacketCallbackTypeDef)(void *pAppBuff);  /*!< pointer to an ETH Rx Packet Function */
+/**
+  *
+  */
+
 /**
   * @brief  HAL ETH Tx Free Function definition
   */
@@ -587,6 +701,37 @@ typedef struct
                                                              This parameter can be a value of
                                                              @ref ETH_PTP_Config_Status */
 
+  __IO uint32_t              RxBuffUnavailableCnt;      /*!< Holds the number of Rx buffer unavailable events */
+
+  ETH_MDIOTransferTypeDef    *pMDIOXfer;                /*!< MDIO transfers batch in progress, NULL when none */
+
+  uint32_t                   MDIOXferCount;             /*!< Number of transfers of the MDIO batch */
+
+  uint32_t                   MDIOXferIdx;               /*!< Index of the MDIO batch transfer in progress */
+
+  ETH_MDIOTransferTypeDef    *pMDIOXferActive;          /*!< MDIO transfer on the bus, NULL when the bus is idle */
+
+  uint32_t                   MDIOTickStart;             /*!< Tick at which the MDIO transfer on the bus started */
+
+  ETH_MDIOTransferTypeDef    MDIOLinkXfer;              /*!< Link monitor PHY register read */
+
+  uint32_t                   MDIOLinkMask;              /*!< Link monitor PHY register mask, 0 when stopped */
+
+  uint32_t                   MDIOLinkStatus;            /*!< Last link monitor PHY register value, masked */
+
+  uint32_t                   MDIOLinkPeriod;            /*!< Link monitor polling period in ms */
+
+  uint32_t                   MDIOLinkTickStart;         /*!< Tick of the last link monitor poll */
+
+#if (USE_ETH_RX_LATENCY != 0U)
+  __IO uint32_t              RxIrqTimeStamp;            /*!< DWT cycle counter value of the pending Rx complete
+                                                             interrupt, 0 when no interrupt is pending */
+
+  uint32_t                   RxLatencyMin;              /*!< Minimum Rx interrupt to packet read latency in cycles */
+
+  uint32_t                   RxLatencyMax;              /*!< Maximum Rx interrupt to packet read latency in cycles */
+#endif /* USE_ETH_RX_LATENCY */
+
 #if (USE_HAL_ETH_REGISTER_CALLBACKS == 1)
 
   void (* TxCpltCallback)(struct __ETH_HandleTypeDef *heth);             /*!< ETH Tx Complete Callback */
@@ -595,6 +740,8 @@ typedef struct
   void (* PMTCallback)(struct __ETH_HandleTypeDef *heth);               /*!< ETH Power Management Callback            */
   void (* EEECallback)(struct __ETH_HandleTypeDef *heth);               /*!< ETH EEE Callback   */
   void (* WakeUpCallback)(struct __ETH_HandleTypeDef *heth);            /*!< ETH Wake UP Callback   */
+  void (* MDIOCpltCallback)(struct __ETH_HandleTypeDef *heth);          /*!< ETH MDIO Complete Callback   */
+  void (* LinkChangeCallback)(struct __ETH_HandleTypeDef *heth);        /*!< ETH Link Change Callback   */
 
   void (* MspInitCallback)(struct __ETH_HandleTypeDef *heth);             /*!< ETH Msp Init callback              */
   void (* MspDeInitCallback)(struct __ETH_HandleTypeDef *heth);           /*!< ETH Msp DeInit callback            */
@@ -602,6 +749,8 @@ typedef struct
 #endif  /* USE_HAL_ETH_REGISTER_CALLBACKS */
 
   pETH_rxAllocateCallbackTypeDef  rxAllocateCallback;  /*!< ETH Rx Get Buffer Function   */
+  pETH_rxFlowAllocateCallbackTypeDef rxFlowAllocateCallback; /*!< ETH Rx Get Flow Buffer Function, NULL when
+                                                                  the Rx buffers are not allocated per flow */
   pETH_rxLinkCallbackTypeDef      rxLinkCallback; /*!< ETH Rx Set App Data Function */
   pETH_txFreeCallbackTypeDef      txFreeCallback;       /*!< ETH Tx Free Function         */
   pETH_txPtpCallbackTypeDef       txPtpCallback;  /*!< ETH Tx Handle Ptp Function */
@@ -611,6 +760,42 @@ typedef struct
   *
   */
 
+#if defined(HAL_PCD_MODULE_ENABLED) && defined(USB_DRD_FS)
+/**
+  * @brief  ETH to PCD bridge structure definition, the packets are moved between the ETH buffer
+  *         pool and the USB endpoints without being copied by the application
+  */
+typedef struct
+{
+  ETH_HandleTypeDef *heth;            /*!< ETH handle transmitting the packets received on the OUT endpoint */
+
+  PCD_HandleTypeDef *hpcd;            /*!< PCD handle of the USB endpoints */
+
+  uint8_t InEpAddr;                   /*!< IN endpoint address sending the packets received by ETH */
+
+  uint8_t OutEpAddr;                  /*!< OUT endpoint address receiving the packets to transmit by ETH */
+
+  uint8_t InZlp;                      /*!< Set while the zero-length packet ending a packet is sent */
+
+  ETH_TxPacketConfigTypeDef TxConfig; /*!< Tx packet configuration of the packets received on the OUT endpoint */
+
+  ETH_BufferTypeDef TxBuffer;         /*!< Tx buffer of the packet received on the OUT endpoint */
+
+  ETH_PoolBufferTypeDef *pInHead;     /*!< First packet of the IN queue, the one being sent */
+
+  ETH_PoolBufferTypeDef *pInTail;     /*!< Last packet of the IN queue */
+
+  ETH_PoolBufferTypeDef *pInBuffer;   /*!< Buffer being sent on the IN endpoint, NULL when idle */
+
+  ETH_PoolBufferTypeDef *pOutBuffer;  /*!< Buffer armed on the OUT endpoint, NULL when the pool was empty */
+
+  uint32_t DropCount;                 /*!< Number of packets received on the OUT endpoint and not transmitted */
+} ETH_PCDBridgeTypeDef;
+/**
+  *
+  */
+#endif /* HAL_PCD_MODULE_ENABLED && USB_DRD_FS */
+
 #if (USE_HAL_ETH_REGISTER_CALLBACKS == 1)
 /**
   * @brief  HAL ETH Callback ID enumeration definition
@@ -624,7 +809,9 @@ typedef enum
   HAL_ETH_ERROR_CB_ID              = 0x04U,    /*!< ETH Error Callback ID             */
   HAL_ETH_PMT_CB_ID                = 0x06U,    /*!< ETH Power Management Callback ID  */
   HAL_ETH_EEE_CB_ID                = 0x07U,    /*!< ETH EEE Callback ID               */
-  HAL_ETH_WAKEUP_CB_ID             = 0x08U     /*!< ETH Wake UP Callback ID           */
+  HAL_ETH_WAKEUP_CB_ID             = 0x08U,    /*!< ETH Wake UP Callback ID           */
+  HAL_ETH_MDIO_COMPLETE_CB_ID      = 0x09U,    /*!< ETH MDIO Complete Callback ID     */
+  HAL_ETH_LINK_CHANGE_CB_ID        = 0x0AU     /*!< ETH Link Change Callback ID       */
 
 } HAL_ETH_CallbackIDTypeDef;
 
@@ -1036,6 +1223,17 @@ typedef struct
   * @}
   */
 
+/** @defgroup ETH_Buffer_Pool ETH Buffer Pool
+  * @{
+  */
+#define ETH_BUFFER_POOL_ALIGN                 32U      /*!< Alignment of the buffers, one cache line */
+#define ETH_BUFFER_POOL_HEADER_SIZE           32U      /*!< Header of each buffer, kept in its own cache line */
+#define ETH_BUFFER_POOL_SIZE(__BUFFSIZE__, __BUFFNBR__) \
+  ((ETH_BUFFER_POOL_HEADER_SIZE + (__BUFFSIZE__)) * (__BUFFNBR__)) /*!< Pool memory size in bytes */
+/**
+  * @}
+  */
+
 /** @defgroup ETH_Error_Code ETH Error Code
   * @{
   */
@@ -1177,6 +1375,26 @@ typedef struct
   * @}
   */
 
+/** @defgroup ETH_MDIO_Operation ETH MDIO Operation
+  * @{
+  */
+#define ETH_MDIO_READ               0x00000000U   /*!< Read a PHY register */
+#define ETH_MDIO_WRITE              0x00000001U   /*!< Write a PHY register */
+/**
+  * @}
+  */
+
+/** @defgroup ETH_Rx_Flow ETH Rx Flow
+  * @{
+  */
+#define ETH_RX_FLOW_DEFAULT         0x00000000U   /*!< No L3/L4 filter matched */
+#define ETH_RX_FLOW_FILTER0         0x00000001U   /*!< L3 or L4 filter 0 matched */
+#define ETH_RX_FLOW_FILTER1         0x00000002U   /*!< L3 or L4 filter 1 matched */
+#define ETH_RX_FLOW_NBR             0x00000003U   /*!< Number of Rx flows */
+/**
+  * @}
+  */
+
 /** @defgroup ETH_Rx_Error_Code ETH Rx Error Code
   * @{
   */
@@ -1774,15 +1992,36 @@ HAL_StatusTypeDef HAL_ETH_Stop(ETH_HandleTypeDef *heth);
 HAL_StatusTypeDef HAL_ETH_Stop_IT(ETH_HandleTypeDef *heth);
 
 HAL_StatusTypeDef HAL_ETH_ReadData(ETH_HandleTypeDef *heth, void **pAppBuff);
+HAL_StatusTypeDef HAL_ETH_ReadDataBurst(ETH_HandleTypeDef *heth, uint32_t Budget,
+                                        pETH_rxPacketCallbackTypeDef RxPacketCallback, uint32_t *pPacketCount);
+HAL_StatusTypeDef HAL_ETH_SetRxCoalescing(ETH_HandleTypeDef *heth, uint32_t WatchdogCount);
 HAL_StatusTypeDef HAL_ETH_RegisterRxAllocateCallback(ETH_HandleTypeDef *heth,
                                                      pETH_rxAllocateCallbackTypeDef rxAllocateCallback);
 HAL_StatusTypeDef HAL_ETH_UnRegisterRxAllocateCallback(ETH_HandleTypeDef *heth);
 HAL_StatusTypeDef HAL_ETH_RegisterRxLinkCallback(ETH_HandleTypeDef *heth, pETH_rxLinkCallbackTypeDef rxLinkCallback);
 HAL_StatusTypeDef HAL_ETH_UnRegisterRxLinkCallback(ETH_HandleTypeDef *heth);
 HAL_StatusTypeDef HAL_ETH_GetRxDataErrorCode(const ETH_HandleTypeDef *heth, uint32_t *pErrorCode);
+HAL_StatusTypeDef HAL_ETH_RegisterRxFlowAllocateCallback(ETH_HandleTypeDef *heth,
+                                                         pETH_rxFlowAllocateCallbackTypeDef rxFlowAllocateCallback);
+HAL_StatusTypeDef HAL_ETH_UnRegisterRxFlowAllocateCallback(ETH_HandleTypeDef *heth);
+HAL_StatusTypeDef HAL_ETH_GetRxFlow(const ETH_HandleTypeDef *heth, uint32_t *pFlow);
 HAL_StatusTypeDef HAL_ETH_RegisterTxFreeCallback(ETH_HandleTypeDef *heth, pETH_txFreeCallbackTypeDef txFreeCallback);
 HAL_StatusTypeDef HAL_ETH_UnRegisterTxFreeCallback(ETH_HandleTypeDef *heth);
 HAL_StatusTypeDef HAL_ETH_ReleaseTxPacket(ETH_HandleTypeDef *heth);
+HAL_StatusTypeDef HAL_ETH_BufferPool_Init(ETH_HandleTypeDef *heth, ETH_BufferPoolTypeDef *pPool, uint8_t *pMemory,
+                                          uint32_t BufferSize, uint32_t BufferNbr);
+ETH_PoolBufferTypeDef *HAL_ETH_BufferPool_Alloc(void);
+void              HAL_ETH_BufferPool_Free(ETH_PoolBufferTypeDef *pBuffer);
+void              HAL_ETH_BufferPool_RxAllocate(uint8_t **buff);
+void              HAL_ETH_BufferPool_RxLink(void **pStart, void **pEnd, uint8_t *buff, uint16_t Length);
+void              HAL_ETH_BufferPool_TxFree(uint32_t *buff);
+#if defined(HAL_PCD_MODULE_ENABLED) && defined(USB_DRD_FS)
+HAL_StatusTypeDef HAL_ETH_Bridge_Init(ETH_PCDBridgeTypeDef *pBridge, ETH_HandleTypeDef *heth, PCD_HandleTypeDef *hpcd,
+                                      uint8_t InEpAddr, uint8_t OutEpAddr, const ETH_TxPacketConfigTypeDef *pTxConfig);
+HAL_StatusTypeDef HAL_ETH_Bridge_ToPCD(ETH_PCDBridgeTypeDef *pBridge, ETH_PoolBufferTypeDef *pPacket);
+void              HAL_ETH_Bridge_PCDDataIn(ETH_PCDBridgeTypeDef *pBridge);
+void              HAL_ETH_Bridge_PCDDataOut(ETH_PCDBridgeTypeDef *pBridge);
+#endif /* HAL_PCD_MODULE_ENABLED && USB_DRD_FS */
 
 #ifdef HAL_ETH_USE_PTP
 HAL_StatusTypeDef HAL_ETH_PTP_SetConfig(ETH_HandleTypeDef *heth, ETH_PTP_ConfigTypeDef *ptpconfig);
@@ -1794,17 +2033,31 @@ HAL_StatusTypeDef HAL_ETH_PTP_AddTimeOffset(ETH_HandleTypeDef *heth, ETH_PtpUpda
 HAL_StatusTypeDef HAL_ETH_PTP_InsertTxTimestamp(ETH_HandleTypeDef *heth);
 HAL_StatusTypeDef HAL_ETH_PTP_GetTxTimestamp(ETH_HandleTypeDef *heth, ETH_TimeStampTypeDef *timestamp);
 HAL_StatusTypeDef HAL_ETH_PTP_GetRxTimestamp(ETH_HandleTypeDef *heth, ETH_TimeStampTypeDef *timestamp);
+HAL_StatusTypeDef HAL_ETH_PTP_ReadDataBurst(ETH_HandleTypeDef *heth, ETH_PacketRecordTypeDef *pRecords,
+                                            uint32_t MaxRecords, uint32_t *pRecordCount);
+HAL_StatusTypeDef HAL_ETH_PTP_ReleaseTxPacket(ETH_HandleTypeDef *heth, ETH_PacketRecordTypeDef *pRecords,
+                                              uint32_t MaxRecords, uint32_t *pRecordCount);
+HAL_StatusTypeDef HAL_ETH_PTP_ServoInit(ETH_HandleTypeDef *heth, ETH_PTP_ServoTypeDef *pServo);
+HAL_StatusTypeDef HAL_ETH_PTP_ServoUpdate(ETH_HandleTypeDef *heth, ETH_PTP_ServoTypeDef *pServo, int64_t OffsetNs);
 HAL_StatusTypeDef HAL_ETH_RegisterTxPtpCallback(ETH_HandleTypeDef *heth, pETH_txPtpCallbackTypeDef txPtpCallback);
 HAL_StatusTypeDef HAL_ETH_UnRegisterTxPtpCallback(ETH_HandleTypeDef *heth);
 #endif /* HAL_ETH_USE_PTP */
 
 HAL_StatusTypeDef HAL_ETH_Transmit(ETH_HandleTypeDef *heth, ETH_TxPacketConfigTypeDef *pTxConfig, uint32_t Timeout);
 HAL_StatusTypeDef HAL_ETH_Transmit_IT(ETH_HandleTypeDef *heth, ETH_TxPacketConfigTypeDef *pTxConfig);
+HAL_StatusTypeDef HAL_ETH_TransmitBatch_IT(ETH_HandleTypeDef *heth, ETH_TxPacketConfigTypeDef *pTxConfig,
+                                           uint32_t PacketCount, uint32_t *pQueuedCount);
 
 HAL_StatusTypeDef HAL_ETH_WritePHYRegister(const ETH_HandleTypeDef *heth, uint32_t PHYAddr, uint32_t PHYReg,
                                            uint32_t RegValue);
 HAL_StatusTypeDef HAL_ETH_ReadPHYRegister(ETH_HandleTypeDef *heth, uint32_t PHYAddr, uint32_t PHYReg,
                                           uint32_t *pRegValue);
+HAL_StatusTypeDef HAL_ETH_MDIO_Submit(ETH_HandleTypeDef *heth, ETH_MDIOTransferTypeDef *pXfer, uint32_t XferCount);
+HAL_StatusTypeDef HAL_ETH_MDIO_StartLinkMonitor(ETH_HandleTypeDef *heth, uint32_t PHYAddr, uint32_t PHYReg,
+                                                uint32_t Mask, uint32_t Period);
+HAL_StatusTypeDef HAL_ETH_MDIO_StopLinkMonitor(ETH_HandleTypeDef *heth);
+uint32_t          HAL_ETH_MDIO_GetLinkStatus(const ETH_HandleTypeDef *heth);
+void              HAL_ETH_MDIO_Process(ETH_HandleTypeDef *heth);
 
 void              HAL_ETH_IRQHandler(ETH_HandleTypeDef *heth);
 void              HAL_ETH_TxCpltCallback(ETH_HandleTypeDef *heth);
@@ -1813,6 +2066,8 @@ void              HAL_ETH_ErrorCallback(ETH_HandleTypeDef *heth);
 void              HAL_ETH_PMTCallback(ETH_HandleTypeDef *heth);
 void              HAL_ETH_EEECallback(ETH_HandleTypeDef *heth);
 void              HAL_ETH_WakeUpCallback(ETH_HandleTypeDef *heth);
+void              HAL_ETH_MDIOCpltCallback(ETH_HandleTypeDef *heth);
+void              HAL_ETH_LinkChangeCallback(ETH_HandleTypeDef *heth);
 void              HAL_ETH_RxAllocateCallback(uint8_t **buff);
 void              HAL_ETH_RxLinkCallback(void **pStart, void **pEnd, uint8_t *buff, uint16_t Length);
 void              HAL_ETH_TxFreeCallback(uint32_t *buff);
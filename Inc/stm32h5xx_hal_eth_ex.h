@@ -146,6 +146,104 @@ typedef struct
   *
   */
 
+/**
+  * @brief  ETH statistics structure definition
+  */
+typedef struct
+{
+  uint32_t TxGoodPackets;                  /*!< Number of good packets transmitted (MMC counter) */
+
+  uint32_t TxSingleCollisionGoodPackets;   /*!< Number of good packets transmitted after a single collision
+                                                (MMC counter) */
+
+  uint32_t TxMultipleCollisionGoodPackets; /*!< Number of good packets transmitted after multiple collisions
+                                                (MMC counter) */
+
+  uint32_t TxUnderflowPackets;             /*!< Number of packets aborted because of a Tx queue underflow
+                                                since the previous snapshot */
+
+  uint32_t RxUnicastGoodPackets;           /*!< Number of good unicast packets received (MMC counter) */
+
+  uint32_t RxCRCErrorPackets;              /*!< Number of packets received with CRC error (MMC counter) */
+
+  uint32_t RxAlignmentErrorPackets;        /*!< Number of packets received with alignment error (MMC counter) */
+
+  uint32_t RxOverflowPackets;              /*!< Number of packets discarded because of a Rx queue overflow
+                                                since the previous snapshot */
+
+  uint32_t RxMissedPackets;                /*!< Number of packets missed by the Rx DMA because no descriptor
+                                                was available since the previous snapshot */
+
+  uint32_t RxBuffUnavailableEvents;        /*!< Number of Rx buffer unavailable (ring exhausted) events */
+
+  uint32_t TxDescInUse;                    /*!< Number of Tx descriptors holding packets not yet released */
+
+  uint32_t RxDescOwnedByDMA;               /*!< Number of Rx descriptors ready to receive packets */
+
+  uint32_t RxLatencyMin;                   /*!< Minimum Rx complete interrupt to packet read latency in
+                                                CPU cycles, only when USE_ETH_RX_LATENCY is set */
+
+  uint32_t RxLatencyMax;                   /*!< Maximum Rx complete interrupt to packet read latency in
+                                                CPU cycles, only when USE_ETH_RX_LATENCY is set */
+} ETH_StatisticsTypeDef;
+/**
+  *
+  */
+
+/**
+  * @brief  ETH TCP segmentation offload structure definition
+  */
+typedef struct
+{
+  uint8_t *pHeader;                 /*!< Pointer to the Ethernet, IP and TCP headers template of all segments */
+
+  uint32_t HeaderLen;               /*!< Sets the total headers length in bytes.
+                                         This parameter can be a value from 0x1 to 0x3FF */
+
+  uint32_t TCPHeaderLen;            /*!< Sets the TCP header length in 32-bit words.
+                                         This parameter can be a value from 0x5 to 0xF */
+
+  uint8_t *pPayload;                /*!< Pointer to the TCP payload to be segmented */
+
+  uint32_t PayloadLen;              /*!< Sets the TCP payload length in bytes.
+                                         This parameter can be a value from 0x1 to 0x3FFFF */
+
+  uint32_t MaxSegmentSize;          /*!< Sets the TCP maximum segment size.
+                                         This parameter can be a value from 0x40 to 0x3FFF */
+
+  ETH_BufferTypeDef *pBuffers;      /*!< Caller owned buffer descriptors used to chain the header and payload,
+                                         must stay valid until the packet is released */
+
+  uint32_t BuffersNbr;              /*!< Number of entries of the pBuffers array, at least
+                                         1 + (PayloadLen / ETH_TSO_PAYLOAD_CHUNK_MAX) rounded up */
+
+  void *pData;                      /*!< Specifies Application packet pointer to save */
+} ETH_TSOConfigTypeDef;
+/**
+  *
+  */
+
+/**
+  * @brief  ETH automatic LPI Configuration Structure definition
+  */
+typedef struct
+{
+  uint32_t EntryTime;               /*!< Sets the Tx idle time before entering the LPI state in microseconds.
+                                         This parameter can be a multiple of 8 from 0x8 to 0xFFFF8 */
+
+  uint32_t TxWaitTime;              /*!< Sets the time to wait after the LPI exit before resuming the
+                                         transmission in microseconds (Tw_sys_tx of the PHY).
+                                         This parameter can be a value from 0x0 to 0xFFFF */
+
+  uint32_t LinkStatusTime;          /*!< Sets the time the link must be up before the LPI is allowed in
+                                         milliseconds. This parameter can be a value from 0x0 to 0x3FF */
+
+  FunctionalState TxClockStop;      /*!< Enables or disables the Tx clock stop in the LPI state */
+} ETH_AutoLPIConfigTypeDef;
+/**
+  *
+  */
+
 /**
   * @}
   */
@@ -294,6 +392,14 @@ typedef struct
   * @}
   */
 
+/** @defgroup ETHEx_TSO_Payload_Chunk ETHEx TSO Payload Chunk
+  * @{
+  */
+#define ETH_TSO_PAYLOAD_CHUNK_MAX  0x3FF0U   /*!< Maximum payload bytes held by one Tx buffer */
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -340,6 +446,15 @@ void              HAL_ETHEx_EnterLPIMode(ETH_HandleTypeDef *heth, FunctionalStat
                                          FunctionalState TxClockStop);
 void              HAL_ETHEx_ExitLPIMode(ETH_HandleTypeDef *heth);
 uint32_t          HAL_ETHEx_GetMACLPIEvent(const ETH_HandleTypeDef *heth);
+HAL_StatusTypeDef HAL_ETHEx_EnableAutoLPI(ETH_HandleTypeDef *heth, const ETH_AutoLPIConfigTypeDef *pLPIConfig);
+void              HAL_ETHEx_DisableAutoLPI(ETH_HandleTypeDef *heth);
+
+/* Statistics APIs ************************************************************/
+HAL_StatusTypeDef HAL_ETHEx_GetStatistics(const ETH_HandleTypeDef *heth, ETH_StatisticsTypeDef *pStatistics);
+void              HAL_ETHEx_ResetStatistics(ETH_HandleTypeDef *heth);
+
+/* TCP Segmentation Offload APIs **********************************************/
+HAL_StatusTypeDef HAL_ETHEx_TransmitTSO_IT(ETH_HandleTypeDef *heth, const ETH_TSOConfigTypeDef *pTSOConfig);
 
 /**
   * @}
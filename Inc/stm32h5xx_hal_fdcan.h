@@ -153,6 +153,21 @@ typedef struct
 
 } FDCAN_FilterTypeDef;
 
+/**
+  * @brief  FDCAN filter list entry structure definition
+  */
+typedef struct
+{
+  uint32_t Identifier;       /*!< Specifies the identifier to accept.
+                                  This parameter must be a number between:
+                                   - 0 and 0x7FF, if IdType is FDCAN_STANDARD_ID
+                                   - 0 and 0x1FFFFFFF, if IdType is FDCAN_EXTENDED_ID       */
+
+  uint32_t FilterConfig;     /*!< Specifies the routing of the identifier.
+                                  This parameter can be a value of @ref FDCAN_filter_config */
+
+} FDCAN_FilterIdTypeDef;
+
 /**
   * @brief  FDCAN Tx header structure definition
   */
@@ -242,6 +257,18 @@ typedef struct
 
 } FDCAN_RxHeaderTypeDef;
 
+/**
+  * @brief  FDCAN Rx FIFO element structure definition (message RAM layout)
+  */
+typedef struct
+{
+  __IM uint32_t Header[2U];       /*!< Rx element header words R0 (identifier, RTR, XTD, ESI) and
+                                       R1 (timestamp, DLC, BRS, FDF, filter index, ANMF)                 */
+
+  __IM uint32_t Data[16U];        /*!< Rx element payload, up to 64 bytes                                */
+
+} FDCAN_RxElementTypeDef;
+
 /**
   * @brief  FDCAN Tx event FIFO structure definition
   */
@@ -422,6 +449,64 @@ typedef struct
 
 } FDCAN_MsgRamAddressTypeDef;
 
+/**
+  * @brief  FDCAN traffic profile structure definition
+  */
+typedef struct
+{
+  uint32_t IdType;              /*!< Identifier type of the shortest frames of the bursts.
+                                     This parameter can be a value of @ref FDCAN_id_type             */
+
+  uint32_t FDFormat;            /*!< Format of the frames of the bursts.
+                                     This parameter can be a value of @ref FDCAN_format              */
+
+  uint32_t BitRateSwitch;       /*!< Bit rate switching of the FD frames of the bursts.
+                                     This parameter can be a value of @ref FDCAN_bit_rate_switching  */
+
+  uint32_t DataLength;          /*!< Data length of the shortest frames of the bursts.
+                                     This parameter can be a value of @ref FDCAN_data_length_code    */
+
+  uint32_t RxBurstLength;       /*!< Maximum number of back-to-back frames received in a burst       */
+
+  uint32_t RxServiceLatency;    /*!< Maximum time in us between a Rx FIFO new message interrupt and
+                                     the reading of all the pending messages of the FIFO             */
+
+  uint32_t TxBurstLength;       /*!< Maximum number of frames queued at once for transmission        */
+
+} FDCAN_TrafficProfileTypeDef;
+
+/**
+  * @brief  FDCAN message RAM buffering report structure definition
+  */
+typedef struct
+{
+  uint32_t NominalBitRate;      /*!< Nominal bit rate in bit/s                                       */
+
+  uint32_t DataBitRate;         /*!< Data bit rate in bit/s                                          */
+
+  uint32_t FrameTime;           /*!< Duration in ns of the shortest frame, without stuff bits        */
+
+  uint32_t RxElementsNeeded;    /*!< Rx FIFO elements filled during the service latency              */
+
+  int32_t RxFifoHeadroom;       /*!< Free Rx FIFO elements when the burst is received in one FIFO,
+                                     negative when frames are lost                                   */
+
+  int32_t RxSplitHeadroom;      /*!< Free elements of each Rx FIFO when the burst is split between
+                                     Rx FIFO 0 and Rx FIFO 1 by the filters, negative when frames
+                                     are lost                                                        */
+
+  uint32_t MaxRxLatency;        /*!< Maximum service latency in us without loss, one Rx FIFO         */
+
+  uint32_t MaxRxSplitLatency;   /*!< Maximum service latency in us without loss, two Rx FIFOs        */
+
+  uint32_t TxQueueSize;         /*!< Software Tx queue entries needed beyond the Tx FIFO/Queue
+                                     elements, see HAL_FDCAN_TxQueue_Start()                         */
+
+  uint32_t TxRefillTime;        /*!< Time in us to send the full Tx FIFO/Queue, before which it must
+                                     be refilled to keep the bus busy                                */
+
+} FDCAN_BufferingReportTypeDef;
+
 /**
   * @brief  FDCAN handle structure definition
   */
@@ -446,6 +531,9 @@ typedef struct
 
   __IO uint32_t               ErrorCode;        /*!< FDCAN Error code          */
 
+  struct __FDCAN_TxQueueTypeDef *pTxQueue;      /*!< FDCAN software Tx priority queue,
+                                                     NULL when not used        */
+
 #if USE_HAL_FDCAN_REGISTER_CALLBACKS == 1
   void (* TxEventFifoCallback)(struct __FDCAN_HandleTypeDef *hfdcan, uint32_t TxEventFifoITs);     /*!< FDCAN Tx Event Fifo callback         */
   void (* RxFifo0Callback)(struct __FDCAN_HandleTypeDef *hfdcan, uint32_t RxFifo0ITs);             /*!< FDCAN Rx Fifo 0 callback             */
@@ -466,6 +554,50 @@ typedef struct
 
 } FDCAN_HandleTypeDef;
 
+/**
+  * @brief  FDCAN Tx queue message structure definition
+  */
+typedef struct
+{
+  FDCAN_TxHeaderTypeDef Header;   /*!< Tx header of the message. The TxEventFifoControl and MessageMarker
+                                       fields are managed by the Tx queue                                   */
+
+  const uint8_t *pData;           /*!< Payload of the message, kept valid until the message completes      */
+
+  uint32_t Priority;              /*!< Software priority of the message, the lowest value being sent first.
+                                       Messages of equal priority are sent in submission order.
+                                       Using the frame identifier mirrors the CAN bus arbitration           */
+
+  uint32_t TxTimestamp;           /*!< Timestamp captured on start of frame transmission, updated from
+                                       the Tx event FIFO on completion                                      */
+
+  uint32_t EventType;             /*!< Tx event type, updated on completion.
+                                       This parameter can be a value of @ref FDCAN_event_type               */
+
+} FDCAN_TxQueueMessageTypeDef;
+
+/**
+  * @brief  FDCAN Tx priority queue structure definition
+  */
+typedef struct __FDCAN_TxQueueTypeDef
+{
+  FDCAN_TxQueueMessageTypeDef **pSlots;   /*!< User array of Size message pointers holding the queued messages */
+
+  uint32_t Size;                          /*!< Number of entries of pSlots                                     */
+
+  __IO uint32_t Count;                    /*!< Number of messages waiting for a Tx buffer                      */
+
+  FDCAN_TxQueueMessageTypeDef *pInFlight[8U]; /*!< Messages handed to the Tx FIFO/Queue, indexed by the
+                                                   message marker and waiting for their Tx event            */
+
+  uint32_t NextMarker;                    /*!< Message marker used for the next message handed to the hardware */
+
+  void (* pTxCompleteCallback)(FDCAN_HandleTypeDef *hfdcan,
+                               FDCAN_TxQueueMessageTypeDef *pMessage); /*!< Called from the FDCAN interrupt when
+                                                                            the Tx event of a message is read */
+
+} FDCAN_TxQueueTypeDef;
+
 #if USE_HAL_FDCAN_REGISTER_CALLBACKS == 1
 /**
   * @brief  HAL FDCAN common Callback ID enumeration definition
@@ -1172,6 +1304,9 @@ HAL_StatusTypeDef HAL_FDCAN_UnRegisterErrorStatusCallback(FDCAN_HandleTypeDef *h
   */
 /* Configuration functions ****************************************************/
 HAL_StatusTypeDef HAL_FDCAN_ConfigFilter(FDCAN_HandleTypeDef *hfdcan, const FDCAN_FilterTypeDef *sFilterConfig);
+HAL_StatusTypeDef HAL_FDCAN_ConfigFilterList(FDCAN_HandleTypeDef *hfdcan, uint32_t IdType,
+                                             FDCAN_FilterIdTypeDef *pIds, uint32_t IdCount,
+                                             FDCAN_FilterTypeDef *pFilters, uint32_t *pFilterCount);
 HAL_StatusTypeDef HAL_FDCAN_ConfigGlobalFilter(FDCAN_HandleTypeDef *hfdcan, uint32_t NonMatchingStd,
                                                uint32_t NonMatchingExt, uint32_t RejectRemoteStd,
                                                uint32_t RejectRemoteExt);
@@ -1197,6 +1332,9 @@ HAL_StatusTypeDef HAL_FDCAN_EnableISOMode(FDCAN_HandleTypeDef *hfdcan);
 HAL_StatusTypeDef HAL_FDCAN_DisableISOMode(FDCAN_HandleTypeDef *hfdcan);
 HAL_StatusTypeDef HAL_FDCAN_EnableEdgeFiltering(FDCAN_HandleTypeDef *hfdcan);
 HAL_StatusTypeDef HAL_FDCAN_DisableEdgeFiltering(FDCAN_HandleTypeDef *hfdcan);
+HAL_StatusTypeDef HAL_FDCAN_EvaluateBuffering(const FDCAN_HandleTypeDef *hfdcan,
+                                              const FDCAN_TrafficProfileTypeDef *pProfile,
+                                              FDCAN_BufferingReportTypeDef *pReport);
 /**
   * @}
   */
@@ -1211,8 +1349,19 @@ HAL_StatusTypeDef HAL_FDCAN_AddMessageToTxFifoQ(FDCAN_HandleTypeDef *hfdcan, con
                                                 const uint8_t *pTxData);
 uint32_t HAL_FDCAN_GetLatestTxFifoQRequestBuffer(const FDCAN_HandleTypeDef *hfdcan);
 HAL_StatusTypeDef HAL_FDCAN_AbortTxRequest(FDCAN_HandleTypeDef *hfdcan, uint32_t BufferIndex);
+HAL_StatusTypeDef HAL_FDCAN_TxQueue_Start(FDCAN_HandleTypeDef *hfdcan, FDCAN_TxQueueTypeDef *pQueue,
+                                          FDCAN_TxQueueMessageTypeDef **pSlots, uint32_t Size);
+HAL_StatusTypeDef HAL_FDCAN_TxQueue_Add(FDCAN_HandleTypeDef *hfdcan, FDCAN_TxQueueMessageTypeDef *pMessage);
+HAL_StatusTypeDef HAL_FDCAN_TxQueue_Stop(FDCAN_HandleTypeDef *hfdcan);
 HAL_StatusTypeDef HAL_FDCAN_GetRxMessage(FDCAN_HandleTypeDef *hfdcan, uint32_t RxLocation,
                                          FDCAN_RxHeaderTypeDef *pRxHeader, uint8_t *pRxData);
+HAL_StatusTypeDef HAL_FDCAN_GetRxMessages(FDCAN_HandleTypeDef *hfdcan, uint32_t RxLocation,
+                                          FDCAN_RxHeaderTypeDef *pRxHeaders, uint8_t *pRxData,
+                                          uint32_t DataStride, uint32_t MaxCount, uint32_t *pCount);
+uint32_t HAL_FDCAN_PeekRxFifo(FDCAN_HandleTypeDef *hfdcan, uint32_t RxLocation,
+                              const FDCAN_RxElementTypeDef *pElements[], uint32_t MaxCount);
+HAL_StatusTypeDef HAL_FDCAN_ReleaseRxFifo(FDCAN_HandleTypeDef *hfdcan, uint32_t RxLocation, uint32_t Count);
+void HAL_FDCAN_DecodeRxElement(const FDCAN_RxElementTypeDef *pElement, FDCAN_RxHeaderTypeDef *pRxHeader);
 HAL_StatusTypeDef HAL_FDCAN_GetTxEvent(FDCAN_HandleTypeDef *hfdcan, FDCAN_TxEventFifoTypeDef *pTxEvent);
 HAL_StatusTypeDef HAL_FDCAN_GetHighPriorityMessageStatus(const FDCAN_HandleTypeDef *hfdcan,
                                                          FDCAN_HpMsgStatusTypeDef *HpMsgStatus);
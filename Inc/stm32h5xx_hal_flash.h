@@ -62,6 +62,16 @@ typedef struct
   uint32_t               NbSectorsToErase;   /*!< Internal variable to save the remaining sectors to erase in
                                                   IT context  */
 
+  uint32_t               DataAddress;        /*!< Internal variable to save the address of the next data to program
+                                                  in IT context */
+
+  uint32_t               NbQuadWordsToProgram; /*!< Internal variable to save the remaining quad-words to program in
+                                                    IT context */
+
+  struct __FLASH_QueueTypeDef *pQueue;       /*!< Background operations queue, NULL if not used                       */
+
+  struct __FLASH_EccMonitorTypeDef *pEccMonitor; /*!< ECC errors monitor, NULL if not used                           */
+
 } FLASH_ProcessTypeDef;
 
 /**
@@ -763,6 +773,10 @@ typedef struct
 /* Program operation functions */
 HAL_StatusTypeDef HAL_FLASH_Program(uint32_t TypeProgram, uint32_t FlashAddress, uint32_t DataAddress);
 HAL_StatusTypeDef HAL_FLASH_Program_IT(uint32_t TypeProgram, uint32_t FlashAddress, uint32_t DataAddress);
+HAL_StatusTypeDef HAL_FLASHEx_ProgramBuffer(uint32_t TypeProgram, uint32_t FlashAddress, uint32_t DataAddress,
+                                            uint32_t Size);
+HAL_StatusTypeDef HAL_FLASHEx_ProgramBuffer_IT(uint32_t TypeProgram, uint32_t FlashAddress, uint32_t DataAddress,
+                                               uint32_t Size);
 /* FLASH IRQ handler method */
 void HAL_FLASH_IRQHandler(void);
 /* Callbacks in non blocking modes */
@@ -26,6 +26,9 @@ extern "C" {
 
 /* Includes ------------------------------------------------------------------*/
 #include "stm32h5xx_hal_def.h"
+#if defined (HASH) && defined (HAL_HASH_MODULE_ENABLED)
+#include "stm32h5xx_hal_hash.h"
+#endif /* HASH && HAL_HASH_MODULE_ENABLED */
 
 /** @addtogroup STM32H5xx_HAL_Driver
   * @{
@@ -35,6 +38,14 @@ extern "C" {
   * @{
   */
 
+/** @defgroup FLASHEx_OTA_Digest_Size FLASHEx dual-bank image update digest size
+  * @{
+  */
+#define FLASH_OTA_DIGEST_MAX_SIZE 64U /*!< Size of the largest HASH digest (SHA-512) */
+/**
+  * @}
+  */
+
 /* Exported types ------------------------------------------------------------*/
 /** @defgroup FLASHEx_Exported_Types FLASHEx Exported Types
   * @{
@@ -60,6 +71,117 @@ typedef struct
                              value of initial sector)*/
 } FLASH_EraseInitTypeDef;
 
+/**
+  * @brief  FLASH background queue operation definition
+  */
+typedef struct
+{
+  uint32_t Operation;     /*!< Operation to be queued.
+                               This parameter can be FLASH_TYPEERASE_SECTORS(_NS) or FLASH_TYPEPROGRAM_QUADWORD(_NS) */
+
+  uint32_t Banks;         /*!< Bank of the sectors to erase, sectors erase only.
+                               This parameter can be FLASH_BANK_1 or FLASH_BANK_2 */
+
+  uint32_t Sector;        /*!< Initial sector to erase, sectors erase only.
+                               This parameter can be a value of @ref FLASH_Sectors */
+
+  uint32_t NbSectors;     /*!< Number of sectors to erase, sectors erase only */
+
+  uint32_t FlashAddress;  /*!< Address to program, aligned to the Flash word (128-bit), program only */
+
+  uint32_t DataAddress;   /*!< Address of the data to program, 32-bit aligned, program only.
+                               The data must stay available until the operation is completed */
+
+  uint32_t Size;          /*!< Number of bytes to program, multiple of 16, program only */
+} FLASH_QueueOpTypeDef;
+
+/**
+  * @brief  FLASH background queue definition
+  * @note   The operations array is provided by the user and must stay allocated while the queue is used.
+  */
+typedef struct __FLASH_QueueTypeDef
+{
+  FLASH_QueueOpTypeDef *pOps;        /*!< Operations ring */
+
+  uint32_t             Size;         /*!< Number of operations of the ring */
+
+  uint32_t             Head;         /*!< Next operation to be queued */
+
+  uint32_t             Tail;         /*!< Operation on-going, or next operation to be started */
+
+  __IO uint32_t        NbPending;    /*!< Number of operations queued and not completed, on-going one included */
+
+  __IO uint32_t        NbCompleted;  /*!< Number of operations completed since the queue initialization */
+
+  __IO uint32_t        Active;       /*!< Set while an operation of the queue is on-going */
+
+  uint32_t             ErrorCode;    /*!< FLASH error code of the failed operation, the queue being flushed */
+} FLASH_QueueTypeDef;
+
+#if defined (FLASH_EDATAR_EDATA_EN)
+/**
+  * @brief  FLASH high-cycle data key-value store definition
+  * @note   Bank, FirstSector, NbSectors, pIndex and NbKeys are set by the user before
+  *         HAL_FLASHEx_EEStore_Init(), the other fields are internal.
+  */
+typedef struct
+{
+  uint32_t Bank;           /*!< Bank of the high-cycle data sectors.
+                                This parameter can be FLASH_BANK_1 or FLASH_BANK_2 */
+
+  uint32_t FirstSector;    /*!< First high-cycle data sector of the store, index in the bank high-cycle
+                                data area, between 0 and (FLASH_EDATA_SECTOR_NB - 1) */
+
+  uint32_t NbSectors;      /*!< Number of high-cycle data sectors of the store, at least 3 */
+
+  uint16_t *pIndex;        /*!< User array of NbKeys entries, location of the latest record of each key */
+
+  uint32_t NbKeys;         /*!< Number of keys, the keys being between 0 and (NbKeys - 1) */
+
+  uint32_t BaseAddress;    /*!< Address of the first sector of the store */
+
+  uint32_t HeadSector;     /*!< Sector being written, position in the store */
+
+  uint32_t HeadSlot;       /*!< Next free record of the head sector */
+
+  uint32_t TailSector;     /*!< Oldest sector, compacted once the store is almost full */
+
+  uint32_t CompactSlot;    /*!< Next record of the tail sector to be compacted */
+
+  uint16_t Sequence;       /*!< Sequence number of the head sector */
+
+  uint16_t LiveCount[FLASH_EDATA_SECTOR_NB]; /*!< Number of latest records in each sector */
+} FLASH_EEStoreTypeDef;
+#endif /* FLASH_EDATAR_EDATA_EN */
+
+/**
+  * @brief  FLASH dual-bank image update definition
+  * @note   ImageSize, hhash and pDigest are set by the user before HAL_FLASHEx_OTA_Start(),
+  *         the other fields are internal.
+  */
+typedef struct
+{
+  uint32_t ImageSize;            /*!< Size in bytes of the new image, up to the bank size */
+
+#if defined (HASH) && defined (HAL_HASH_MODULE_ENABLED)
+  HASH_HandleTypeDef *hhash;     /*!< HASH handle with an input DMA channel in normal mode, NULL to skip
+                                      the digest verification */
+
+  const uint8_t *pDigest;        /*!< Expected digest of the image, with the HASH algorithm length */
+
+  uint8_t Digest[FLASH_OTA_DIGEST_MAX_SIZE]; /*!< Digest of the image computed while it is programmed */
+
+#endif /* HASH && HAL_HASH_MODULE_ENABLED */
+  uint32_t Bank;                 /*!< Physical bank being updated, the one mapped at FLASH_BASE + FLASH_BANK_SIZE,
+                                      0 when no update is started */
+
+  uint32_t Offset;               /*!< Number of bytes of the image already programmed */
+
+  uint32_t NbErasedSectors;      /*!< Number of sectors of the bank already erased */
+
+  uint32_t Complete;             /*!< Set once the whole image is programmed and verified */
+} FLASH_OTATypeDef;
+
 
 /**
   * @brief  FLASH Option Bytes Program structure definition
@@ -184,6 +306,47 @@ typedef struct
   uint32_t               Data;             /*!< ECC failing data */
 } FLASH_EccInfoTypeDef;
 
+/**
+  * @brief  ECC monitor log entry definition
+  */
+typedef struct
+{
+  uint32_t               Area;             /*!< Area of the ECC error.
+                                                This parameter can be a value of @ref FLASH_ECC_Area  */
+
+  uint32_t               Address;          /*!< ECC error address */
+
+  uint32_t               Event;            /*!< ECC error event.
+                                                This parameter can be a value of @ref FLASH_ECC_Event */
+
+  uint32_t               Count;            /*!< Number of reports of the error */
+
+  uint32_t               Handled;          /*!< Set once processed by HAL_FLASHEx_EccMonitor_Process() */
+} FLASH_EccLogEntryTypeDef;
+
+/**
+  * @brief  ECC monitor definition
+  */
+typedef struct __FLASH_EccMonitorTypeDef
+{
+  FLASH_EccLogEntryTypeDef *pLog;          /*!< User log array, one entry per failing address */
+
+  uint32_t               Size;             /*!< Number of entries of the log array */
+
+  __IO uint32_t          NbEntries;        /*!< Number of logged addresses */
+
+  __IO uint32_t          NbCorrections;    /*!< Number of single errors corrected */
+
+  __IO uint32_t          NbDetections;     /*!< Number of double errors detected */
+
+  __IO uint32_t          NbLost;           /*!< Number of errors not logged, the log being full */
+
+#if defined (FLASH_EDATAR_EDATA_EN)
+  FLASH_EEStoreTypeDef   *pStore;          /*!< Key-value store whose failing records are relocated,
+                                                NULL if none. Set by the user before the monitor start */
+#endif /* FLASH_EDATAR_EDATA_EN */
+} FLASH_EccMonitorTypeDef;
+
 /**
   * @}
   */
@@ -239,6 +402,16 @@ typedef struct
   * @}
   */
 
+/** @defgroup FLASH_ECC_Event FLASH ECC Event
+  * @brief    FLASH ECC error event of the monitor log
+  * @{
+  */
+#define FLASH_ECC_EVENT_CORRECTION        0x00000000U               /*!< Single error corrected           */
+#define FLASH_ECC_EVENT_DETECTION         0x00000001U               /*!< Double error detected            */
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -933,6 +1106,10 @@ byte configuration */
 /* Extension Erase and OB Program operation functions  ******************************/
 HAL_StatusTypeDef HAL_FLASHEx_Erase(FLASH_EraseInitTypeDef *pEraseInit, uint32_t *SectorError);
 HAL_StatusTypeDef HAL_FLASHEx_Erase_IT(FLASH_EraseInitTypeDef *pEraseInit);
+HAL_StatusTypeDef HAL_FLASHEx_Queue_Init(FLASH_QueueTypeDef *pQueue, FLASH_QueueOpTypeDef *pOps, uint32_t Size);
+HAL_StatusTypeDef HAL_FLASHEx_Queue_DeInit(FLASH_QueueTypeDef *pQueue);
+HAL_StatusTypeDef HAL_FLASHEx_Queue_Add(FLASH_QueueTypeDef *pQueue, const FLASH_QueueOpTypeDef *pOp);
+void              HAL_FLASHEx_QueueProgressCallback(uint32_t NbCompleted, uint32_t NbPending);
 HAL_StatusTypeDef HAL_FLASHEx_OBProgram(FLASH_OBProgramInitTypeDef *pOBInit);
 void              HAL_FLASHEx_OBGetConfig(FLASH_OBProgramInitTypeDef *pOBInit);
 #if defined (FLASH_SR_OBKERR)
@@ -976,6 +1153,34 @@ void              HAL_FLASHEx_GetEccInfo(FLASH_EccInfoTypeDef *pData);
 void              HAL_FLASHEx_ECCD_IRQHandler(void);
 __weak void       HAL_FLASHEx_EccDetectionCallback(void);
 __weak void       HAL_FLASHEx_EccCorrectionCallback(void);
+HAL_StatusTypeDef HAL_FLASHEx_EccMonitor_Start(FLASH_EccMonitorTypeDef *pMonitor, FLASH_EccLogEntryTypeDef *pLog,
+                                               uint32_t Size);
+HAL_StatusTypeDef HAL_FLASHEx_EccMonitor_Stop(const FLASH_EccMonitorTypeDef *pMonitor);
+HAL_StatusTypeDef HAL_FLASHEx_EccMonitor_Process(FLASH_EccMonitorTypeDef *pMonitor);
+/**
+  * @}
+  */
+
+#if defined (FLASH_EDATAR_EDATA_EN)
+/** @addtogroup FLASHEx_Exported_Functions_Group4
+  * @{
+  */
+HAL_StatusTypeDef HAL_FLASHEx_EEStore_Init(FLASH_EEStoreTypeDef *pStore);
+HAL_StatusTypeDef HAL_FLASHEx_EEStore_Format(FLASH_EEStoreTypeDef *pStore);
+HAL_StatusTypeDef HAL_FLASHEx_EEStore_Read(const FLASH_EEStoreTypeDef *pStore, uint32_t Key, uint32_t *pValue);
+HAL_StatusTypeDef HAL_FLASHEx_EEStore_Write(FLASH_EEStoreTypeDef *pStore, uint32_t Key, uint32_t Value);
+HAL_StatusTypeDef HAL_FLASHEx_EEStore_Compact(FLASH_EEStoreTypeDef *pStore);
+/**
+  * @}
+  */
+#endif /* FLASH_EDATAR_EDATA_EN */
+
+/** @addtogroup FLASHEx_Exported_Functions_Group5
+  * @{
+  */
+HAL_StatusTypeDef HAL_FLASHEx_OTA_Start(FLASH_OTATypeDef *pOTA);
+HAL_StatusTypeDef HAL_FLASHEx_OTA_Write(FLASH_OTATypeDef *pOTA, const uint8_t *pData, uint32_t Size);
+HAL_StatusTypeDef HAL_FLASHEx_OTA_Swap(const FLASH_OTATypeDef *pOTA);
 /**
   * @}
   */
@@ -1001,6 +1206,7 @@ __weak void       HAL_FLASHEx_EccCorrectionCallback(void);
 #else
 #define FLASH_EDATA_BANK_SIZE          (0x0000C000U)               /*!< FLASH EDATA Bank Size */
 #endif /* STM32H5F5xx */
+#define FLASH_EDATA_SECTOR_SIZE        (FLASH_EDATA_BANK_SIZE / FLASH_EDATA_SECTOR_NB) /*!< FLASH EDATA Sector Size */
 /**
   * @}
   */
@@ -1143,6 +1349,8 @@ __weak void       HAL_FLASHEx_EccCorrectionCallback(void);
   * @{
   */
 void FLASH_Erase_Sector(uint32_t Sector, uint32_t Banks);
+void FLASH_QueueProcess(uint32_t ErrorFlags);
+void FLASH_EccMonitorRecord(uint32_t Event);
 /**
   * @}
   */
@@ -100,6 +100,13 @@ typedef struct
   DMA_HandleTypeDef          *hdmaPreload;       /*!< FMAC peripheral preloaded data (X1, X2 and Y) DMA handle
                                                       parameters */
 
+  struct __FMAC_ChannelTypeDef *pChannels;       /*!< Logical channels processed round-robin
+                                                      (NULL when multi-channel processing is not running) */
+
+  uint32_t                   ChannelNbr;         /*!< Number of logical channels */
+
+  __IO uint32_t              ChannelIndex;       /*!< Index of the logical channel being processed */
+
 #if (USE_HAL_FMAC_REGISTER_CALLBACKS == 1)
   void (* ErrorCallback)(struct __FMAC_HandleTypeDef *hfmac);               /*!< FMAC error callback                  */
 
@@ -239,6 +246,61 @@ typedef struct
 
 } FMAC_FilterConfigTypeDef;
 
+/**
+  * @brief  FMAC Coefficient Bank Structure definition
+  * @note   Each bank owns its own coefficient area (X2) within the internal memory,
+  *         so that several banks can be loaded once and swapped at run time.
+  */
+typedef struct
+{
+  uint8_t                    CoeffBaseAddress;  /*!< Base address of the bank coefficient buffer (X2) within the
+                                                     internal memory (0x00 to 0xFF). */
+
+  uint8_t                    CoeffBufferSize;   /*!< Number of 16-bit words allocated to the bank coefficient buffer. */
+
+  int16_t                    *pCoeffB;          /*!< [IIR only] Initialization of the coefficient vector B.
+                                                     If not needed, it should be set to NULL. */
+
+  uint8_t                    CoeffBSize;        /*!< Size of the coefficient vector B. */
+
+  int16_t                    *pCoeffA;          /*!< [IIR only] Initialization of the coefficient vector A.
+                                                     If not needed, it should be set to NULL. */
+
+  uint8_t                    CoeffASize;        /*!< Size of the coefficient vector A. */
+
+  uint8_t                    P;                 /*!< Filter parameter P used with this bank. */
+
+  uint8_t                    Q;                 /*!< Filter parameter Q used with this bank (IIR only). */
+
+  uint8_t                    R;                 /*!< Filter parameter R used with this bank (gain). */
+
+} FMAC_CoeffBankTypeDef;
+
+/**
+  * @brief  FMAC Logical Channel Structure definition
+  * @note   The filter state of a channel is kept between its blocks in the history buffers:
+  *         the last (P - 1) input samples and, for IIR, the last Q output samples. They are
+  *         preloaded into X1 and Y before each block of the channel.
+  */
+typedef struct __FMAC_ChannelTypeDef
+{
+  const FMAC_CoeffBankTypeDef *pBank;         /*!< Coefficient bank of the channel, loaded by
+                                                   HAL_FMAC_LoadCoeffBank_DMA(). NULL to keep the current one. */
+
+  int16_t                    *pInput;         /*!< Input block of the channel */
+
+  int16_t                    *pOutput;        /*!< Output block of the channel */
+
+  uint16_t                   NbSamples;       /*!< Number of samples of the input and output blocks */
+
+  int16_t                    *pInputHistory;  /*!< Input history, (P - 1) samples, oldest first
+                                                   (to be initialized by the user, e.g. to 0) */
+
+  int16_t                    *pOutputHistory; /*!< [IIR only] Output history, Q samples, oldest first
+                                                   (to be initialized by the user, e.g. to 0) */
+
+} FMAC_ChannelTypeDef;
+
 /**
   * @}
   */
@@ -655,15 +717,22 @@ HAL_StatusTypeDef HAL_FMAC_UnRegisterCallback(FMAC_HandleTypeDef *hfmac, HAL_FMA
 /* Peripheral Control functions ***********************************************/
 HAL_StatusTypeDef HAL_FMAC_FilterConfig(FMAC_HandleTypeDef *hfmac, FMAC_FilterConfigTypeDef *pConfig);
 HAL_StatusTypeDef HAL_FMAC_FilterConfig_DMA(FMAC_HandleTypeDef *hfmac, FMAC_FilterConfigTypeDef *pConfig);
+HAL_StatusTypeDef HAL_FMAC_LoadCoeffBank_DMA(FMAC_HandleTypeDef *hfmac, const FMAC_CoeffBankTypeDef *pBank);
+HAL_StatusTypeDef HAL_FMAC_SwapCoeffBank(FMAC_HandleTypeDef *hfmac, const FMAC_CoeffBankTypeDef *pBank);
 HAL_StatusTypeDef HAL_FMAC_FilterPreload(FMAC_HandleTypeDef *hfmac, int16_t *pInput, uint8_t InputSize,
                                          int16_t *pOutput, uint8_t OutputSize);
 HAL_StatusTypeDef HAL_FMAC_FilterPreload_DMA(FMAC_HandleTypeDef *hfmac, int16_t *pInput, uint8_t InputSize,
                                              int16_t *pOutput, uint8_t OutputSize);
 HAL_StatusTypeDef HAL_FMAC_FilterStart(FMAC_HandleTypeDef *hfmac, int16_t *pOutput, uint16_t *pOutputSize);
+HAL_StatusTypeDef HAL_FMAC_FilterStartStream(FMAC_HandleTypeDef *hfmac, int16_t *pInput, uint16_t InputSize,
+                                             int16_t *pOutput, uint16_t OutputSize);
 HAL_StatusTypeDef HAL_FMAC_AppendFilterData(FMAC_HandleTypeDef *hfmac, int16_t *pInput, uint16_t *pInputSize);
 HAL_StatusTypeDef HAL_FMAC_ConfigFilterOutputBuffer(FMAC_HandleTypeDef *hfmac, int16_t *pOutput, uint16_t *pOutputSize);
 HAL_StatusTypeDef HAL_FMAC_PollFilterData(FMAC_HandleTypeDef *hfmac, uint32_t Timeout);
 HAL_StatusTypeDef HAL_FMAC_FilterStop(FMAC_HandleTypeDef  *hfmac);
+HAL_StatusTypeDef HAL_FMAC_ChannelsStart_DMA(FMAC_HandleTypeDef *hfmac, FMAC_ChannelTypeDef *pChannels,
+                                             uint32_t NbChannels);
+HAL_StatusTypeDef HAL_FMAC_ChannelsStop(FMAC_HandleTypeDef *hfmac);
 /**
   * @}
   */
@@ -41,6 +41,9 @@ extern "C" {
 /** @defgroup GFXTIM_Exported_Types  GFXTIM Exported Types
   * @{
   */
+#define GFXTIM_FRAMEPACER_MAX_BUFFERS  3U          /*!< Maximum number of frame pacer buffers */
+#define GFXTIM_FRAMEPACER_NO_BUFFER    0xFFFFFFFFU /*!< No buffer index */
+
 
 /**
   * @brief  HAL GFXTIM states definition
@@ -80,6 +83,8 @@ typedef struct
   __IO HAL_GFXTIM_StateTypeDef      State;                 /*!< GFXTIM state */
   __IO uint32_t                     ErrorCode;             /*!< GFXTIM error code */
   GFXTIM_InitTypeDef                Init;                  /*!< GFXTIM initialization */
+  struct __GFXTIM_FramePacerTypeDef *pFramePacer;          /*!< Frame pacer driven by the GFXTIM events,
+                                                                NULL when not started */
 #if (USE_HAL_GFXTIM_REGISTER_CALLBACKS == 1)
   void (*HAL_GFXTIM_AbsoluteTimer_AFCC1Callback)(struct __GFXTIM_HandleTypeDef *hgfxtim);    /*!< GFXTIM Absolute frame counter compare 1 callback */
   void (*HAL_GFXTIM_AbsoluteTimer_AFCOFCallback)(struct __GFXTIM_HandleTypeDef *hgfxtim);    /*!< GFXTIM Absolute frame counter overflow callback */
@@ -263,6 +268,40 @@ typedef struct
                                This parameter can be a value of @ref GFXTIM_Interrupt */
 } GFXTIM_WatchdogConfigTypeDef;
 
+/**
+  * @brief  GFXTIM frame pacer structure
+  */
+typedef struct __GFXTIM_FramePacerTypeDef
+{
+  uint32_t FrameEvent;        /*!< GFXTIM event flipping the presented buffer to the display
+                              This parameter can be a value of @ref GFXTIM_Flag (e.g. GFXTIM_FLAG_TE) */
+
+  uint32_t RenderEvent;       /*!< GFXTIM event starting the rendering of the next frame
+                              This parameter can be a value of @ref GFXTIM_Flag (e.g. GFXTIM_FLAG_ALCC1),
+                              0 to start the rendering right after the flip */
+
+  uint32_t BufferNb;          /*!< Number of frame buffers
+                              This parameter must be a number between 2 and GFXTIM_FRAMEPACER_MAX_BUFFERS */
+
+  uint32_t BufferAddress[GFXTIM_FRAMEPACER_MAX_BUFFERS]; /*!< Frame buffer addresses */
+
+  void (* FlipCallback)(struct __GFXTIM_FramePacerTypeDef *pPacer, uint32_t BufferAddress);   /*!< Starts the
+                              display refresh from the buffer, e.g. the SPI or parallel interface transfer */
+
+  void (* RenderCallback)(struct __GFXTIM_FramePacerTypeDef *pPacer, uint32_t BufferAddress); /*!< Starts the
+                              rendering into the buffer, e.g. a DMA2D command list */
+
+  __IO uint32_t FrontBuffer;  /*!< Index of the displayed buffer, managed by the driver */
+
+  __IO uint32_t QueuedBuffer; /*!< Index of the buffer presented for the next flip, managed by the driver */
+
+  __IO uint32_t RenderBuffer; /*!< Index of the buffer being rendered, managed by the driver */
+
+  __IO uint32_t FrameCount;   /*!< Number of frame events, managed by the driver */
+
+  __IO uint32_t RepeatCount;  /*!< Number of frame events without new buffer to flip, managed by the driver */
+} GFXTIM_FramePacerTypeDef;
+
 /**
   * @}
   */
@@ -703,6 +742,13 @@ typedef struct
 #define IS_GFXTIM_ABSOLUTE_LINE_VALUE(PARAM) ((PARAM) <= 4095U)
 #define IS_GFXTIM_LCC_RELOAD_VALUE(PARAM) ((PARAM) <= 4194303U)
 #define IS_GFXTIM_FCC_RELOAD_VALUE(PARAM) ((PARAM) <= 4095U)
+#define IS_GFXTIM_FRAMEPACER_EVENT(PARAM) (((PARAM) == GFXTIM_FLAG_AFCO)  || ((PARAM) == GFXTIM_FLAG_ALCO)  || \
+                                           ((PARAM) == GFXTIM_FLAG_TE)    || ((PARAM) == GFXTIM_FLAG_AFCC1) || \
+                                           ((PARAM) == GFXTIM_FLAG_ALCC1) || ((PARAM) == GFXTIM_FLAG_ALCC2) || \
+                                           ((PARAM) == GFXTIM_FLAG_RFC1R) || ((PARAM) == GFXTIM_FLAG_RFC2R) || \
+                                           ((PARAM) == GFXTIM_FLAG_EV1)   || ((PARAM) == GFXTIM_FLAG_EV2)   || \
+                                           ((PARAM) == GFXTIM_FLAG_EV3)   || ((PARAM) == GFXTIM_FLAG_EV4))
+#define IS_GFXTIM_FRAMEPACER_BUFFER_NB(PARAM) (((PARAM) >= 2U) && ((PARAM) <= GFXTIM_FRAMEPACER_MAX_BUFFERS))
 
 
 /**
@@ -904,6 +950,17 @@ void                    HAL_GFXTIM_ErrorCallback(GFXTIM_HandleTypeDef *hgfxtim);
 uint32_t                HAL_GFXTIM_GetError(const GFXTIM_HandleTypeDef *hgfxtim);
 HAL_GFXTIM_StateTypeDef HAL_GFXTIM_GetState(const GFXTIM_HandleTypeDef *hgfxtim);
 
+/**
+  * @}
+  */
+
+/* Frame pacing functions  ****************************************************/
+/** @addtogroup GFXTIM_Exported_Functions_Group8
+  * @{
+  */
+HAL_StatusTypeDef HAL_GFXTIM_FramePacer_Start(GFXTIM_HandleTypeDef *hgfxtim, GFXTIM_FramePacerTypeDef *pPacer);
+HAL_StatusTypeDef HAL_GFXTIM_FramePacer_Stop(GFXTIM_HandleTypeDef *hgfxtim);
+HAL_StatusTypeDef HAL_GFXTIM_FramePacer_Present(GFXTIM_HandleTypeDef *hgfxtim);
 /**
   * @}
   */
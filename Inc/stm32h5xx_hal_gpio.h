@@ -265,6 +265,55 @@ typedef enum
   */
 #define __HAL_GPIO_EXTI_CLEAR_FLAG(__EXTI_LINE__)     __HAL_GPIO_EXTI_CLEAR_IT(__EXTI_LINE__)
 
+/**
+  * @brief  Set or clear the selected data port bit, without parameter check.
+  * @note   Single register write version of HAL_GPIO_WritePin() for inner loops, the pins
+  *         are expected to be configured by HAL_GPIO_Init().
+  * @param  __GPIOx__ where x can be (A..I) to select the GPIO peripheral.
+  * @param  __PIN__ specifies the port bits to be written.
+  *         This parameter can be any combination of GPIO_PIN_x where x can be (0..15)
+  * @param  __STATE__ specifies the value to be written: GPIO_PIN_RESET or GPIO_PIN_SET
+  * @retval None
+  */
+#define __HAL_GPIO_WRITE_PIN(__GPIOx__, __PIN__, __STATE__)                        \
+  ((__GPIOx__)->BSRR = ((__STATE__) != GPIO_PIN_RESET) ? (uint32_t)(__PIN__) :  \
+                       ((uint32_t)(__PIN__) << 16U))
+
+/**
+  * @brief  Toggle the selected data port bits, without parameter check.
+  * @param  __GPIOx__ where x can be (A..I) to select the GPIO peripheral.
+  * @param  __PIN__ specifies the pins to be toggled.
+  *         This parameter can be any combination of GPIO_PIN_x where x can be (0..15)
+  * @retval None
+  */
+#define __HAL_GPIO_TOGGLE_PIN(__GPIOx__, __PIN__)                                       \
+  do {                                                                                  \
+    uint32_t odr_value = (__GPIOx__)->ODR;                                              \
+    (__GPIOx__)->BSRR = ((odr_value & (uint32_t)(__PIN__)) << 16U) |                    \
+                        (~odr_value & (uint32_t)(__PIN__));                             \
+  } while (0)
+
+/**
+  * @brief  Read the selected input port pin, without parameter check.
+  * @param  __GPIOx__ where x can be (A..I) to select the GPIO peripheral.
+  * @param  __PIN__ specifies the port bit to read.
+  *         This parameter can be GPIO_PIN_x where x can be (0..15)
+  * @retval The input port pin value (GPIO_PIN_SET or GPIO_PIN_RESET).
+  */
+#define __HAL_GPIO_READ_PIN(__GPIOx__, __PIN__)   \
+  ((((__GPIOx__)->IDR & (uint32_t)(__PIN__)) != 0U) ? GPIO_PIN_SET : GPIO_PIN_RESET)
+
+/**
+  * @brief  Build the BSRR value driving a group of pins to a given value in one write.
+  * @param  __PIN__ specifies the port bits to be driven.
+  *         This parameter can be any combination of GPIO_PIN_x where x can be (0..15)
+  * @param  __VALUE__ specifies the port bits value, only the bits of __PIN__ are used.
+  * @retval BSRR value: bits of __PIN__ set in __VALUE__ are set, the others are reset
+  */
+#define __HAL_GPIO_BSRR_PATTERN(__PIN__, __VALUE__)                          \
+  (((((uint32_t)(__PIN__)) & ~((uint32_t)(__VALUE__))) << 16U) |           \
+   (((uint32_t)(__PIN__)) & ((uint32_t)(__VALUE__))))
+
 /**
   * @}
   */
@@ -391,6 +440,25 @@ HAL_StatusTypeDef HAL_GPIO_GetConfigPinAttributes(const GPIO_TypeDef *GPIOx, uin
 
 #endif /* __ARM_FEATURE_CMSE */
 
+#if defined(HAL_DMA_MODULE_ENABLED)
+
+/** @addtogroup GPIO_Exported_Functions_Group4 IO streaming functions
+  * @{
+  */
+
+/* IO streaming functions *****************************************************/
+uint32_t          HAL_GPIO_BuildBusPatterns(const uint16_t *pData, uint32_t Size, uint32_t *pPatterns,
+                                            uint16_t DataPins, uint32_t DataPosition, uint16_t StrobePin);
+HAL_StatusTypeDef HAL_GPIO_StreamStart_DMA(GPIO_TypeDef *GPIOx, struct __DMA_HandleTypeDef *hdma,
+                                           const uint32_t *pPatterns, uint32_t Count);
+HAL_StatusTypeDef HAL_GPIO_StreamStop_DMA(struct __DMA_HandleTypeDef *hdma);
+
+/**
+  * @}
+  */
+
+#endif /* HAL_DMA_MODULE_ENABLED */
+
 /**
   * @}
   */
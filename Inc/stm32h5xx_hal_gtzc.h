@@ -67,6 +67,17 @@ typedef struct
   MPCBB_Attribute_ConfigTypeDef AttributeConfig; /*!< MPCBB attribute configuration sub-structure */
 } MPCBB_ConfigTypeDef;
 
+typedef struct
+{
+  uint32_t       MemAddress;     /*!< Address of the first super-block described, in the secure or non-secure
+                                      alias. It must be aligned on GTZC_MPCBB_SUPERBLOCK_SIZE */
+  uint32_t       NbSuperBlocks;  /*!< Number of consecutive super-blocks described */
+  const uint32_t *pSecConfig;    /*!< Secure state of each super-block, bit n set when block n is secure.
+                                      NULL keeps the current secure state */
+  const uint32_t *pPrivConfig;   /*!< Privilege state of each super-block, bit n set when block n is privileged.
+                                      NULL keeps the current privilege state */
+} MPCBB_AttributeMapTypeDef;
+
 typedef struct
 {
   uint32_t AreaId;     /*!< Area identifier field. It can be a value of @ref
@@ -558,6 +569,10 @@ typedef struct
 #define GTZC_MPCBB_LOCK_OFF  (0U)
 #define GTZC_MPCBB_LOCK_ON   (1U)
 
+/* user-oriented definitions for MPCBB_AttributeMapTypeDef super-block words */
+#define GTZC_MPCBB_SUPERBLOCK_NONE      (0x00000000U)
+#define GTZC_MPCBB_SUPERBLOCK_ALL       (0xFFFFFFFFU)
+
 /**
   * @}
   */
@@ -627,6 +642,12 @@ typedef struct
 #define HAL_GTZC_GET_ARRAY_INDEX(periph_id)\
   ( (GTZC_GET_REG_INDEX((periph_id)) * 32U) + GTZC_GET_PERIPH_POS((periph_id)) )
 
+/* user-oriented macro to build at compile time a super-block word of an
+ * MPCBB_AttributeMapTypeDef map, with NbBlocks (1 to 32) blocks set from FirstBlock
+ */
+#define HAL_GTZC_MPCBB_BLOCKS(FirstBlock, NbBlocks)\
+  ( (0xFFFFFFFFUL >> (32U - (NbBlocks))) << (FirstBlock) )
+
 /**
   * @}
   */
@@ -693,6 +714,8 @@ HAL_StatusTypeDef HAL_GTZC_MPCBB_ConfigMemAttributes(uint32_t MemAddress,
 HAL_StatusTypeDef HAL_GTZC_MPCBB_GetConfigMemAttributes(uint32_t MemAddress,
                                                         uint32_t NbBlocks,
                                                         uint32_t *pMemAttributes);
+HAL_StatusTypeDef HAL_GTZC_MPCBB_ConfigMap(const MPCBB_AttributeMapTypeDef *pMap,
+                                           uint32_t NbEntries);
 
 #if defined(__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U)
 HAL_StatusTypeDef HAL_GTZC_MPCBB_LockConfig(uint32_t MemAddress,
@@ -59,6 +59,67 @@ typedef struct
 
 } HASH_ConfigTypeDef;
 
+/**
+  * @brief  HASH input fragment structure definition, used for scatter-gather processing
+  */
+typedef struct
+{
+  const uint8_t *pBuffer;  /*!< Pointer to the fragment data, must be word aligned                        */
+
+  uint32_t Size;           /*!< Fragment length in bytes, must be a multiple of 4 except for the last one */
+} HASH_FragmentTypeDef;
+
+/**
+  * @brief  HASH memory region configuration structure definition, used to hash a flash or
+  *         memory-mapped external memory region in DMA mode
+  */
+typedef struct
+{
+  uint32_t             Address;      /*!< Start address of the region, must be word aligned                   */
+
+  uint32_t             Size;         /*!< Region length in bytes                                               */
+
+  DMA_QListTypeDef     *pQList;      /*!< HASH input DMA channel queue                                        */
+
+  DMA_NodeTypeDef      *pNodes;      /*!< Array of NodeNbr nodes: one per HASH_REGION_CHUNK_SIZE bytes chunk of
+                                          the region, two per chunk when the CRC is computed                 */
+
+  uint32_t             NodeNbr;      /*!< Number of nodes of the pNodes array                                 */
+#if defined(HAL_CRC_MODULE_ENABLED)
+
+  CRC_HandleTypeDef    *hcrc;        /*!< CRC handle also fed with the region by the input DMA channel, NULL if
+                                          none. The CRC input data format must be words and Size a multiple
+                                          of 4                                                               */
+#endif /* HAL_CRC_MODULE_ENABLED */
+} HASH_RegionConfTypeDef;
+
+#if defined(AES) && defined(HAL_CRYP_MODULE_ENABLED)
+/**
+  * @brief  HASH encrypt-then-MAC configuration structure definition
+  * @note   The message is encrypted by chunks, the HMAC of each encrypted chunk is started by the end of
+  *         its output DMA transfer. The arrays are used by the processing and must stay allocated until
+  *         the digest complete callback.
+  */
+typedef struct
+{
+  CRYP_HandleTypeDef   *hcryp;       /*!< CRYP handle encrypting the message in DMA mode                       */
+
+  uint8_t              *pPlain;      /*!< Pointer to the plaintext message, must be word aligned              */
+
+  uint8_t              *pCipher;     /*!< Pointer to the ciphertext message, must be word aligned             */
+
+  uint32_t             Size;         /*!< Message length in bytes, must be a multiple of 16                   */
+
+  uint32_t             ChunkSize;    /*!< Chunk length in bytes, must be a multiple of 16 up to 0xFFF0        */
+
+  CRYP_FragmentTypeDef *pFragments;  /*!< Array of 2 x N fragments, N being the number of chunks of the message */
+
+  DMA_QListTypeDef     *pQList;      /*!< HASH input DMA channel queue                                        */
+
+  DMA_NodeTypeDef      *pNodes;      /*!< Array of N nodes, N being the number of chunks of the message       */
+} HASH_EtMConfTypeDef;
+#endif /* AES && HAL_CRYP_MODULE_ENABLED */
+
 /**
   * @brief HAL State structure definition
   */
@@ -86,6 +147,32 @@ typedef enum
 
 } HAL_HASH_PhaseTypeDef;
 
+/** @defgroup HASH_Number_Of_CSR_Registers HASH Number of Context Swap Registers
+  * @{
+  */
+#if defined(HASH_ALGOSELECTION_SHA512)
+#define HASH_NUMBER_OF_CSR_REGISTERS              103U /*!< Number of Context Swap Registers */
+#else
+#define HASH_NUMBER_OF_CSR_REGISTERS              54U                          /*!< Number of Context Swap Registers */
+#endif /* HASH_ALGOSELECTION_SHA512 */
+/**
+  * @}
+  */
+
+/**
+  * @brief HASH Context Structure definition, used for interleaved multi-stream processing
+  */
+typedef struct
+{
+  HASH_ConfigTypeDef    Init;                                   /*!< HASH stream configuration               */
+  HAL_HASH_PhaseTypeDef Phase;                                  /*!< HASH stream processing phase            */
+  uint32_t              Accumulation;                           /*!< HASH stream multi buffers accumulation flag */
+  uint32_t              IMR_Reg;                                /*!< HASH IMR register                       */
+  uint32_t              STR_Reg;                                /*!< HASH STR register                       */
+  uint32_t              CR_Reg;                                 /*!< HASH CR register                        */
+  uint32_t              CSR_Reg[HASH_NUMBER_OF_CSR_REGISTERS];  /*!< HASH context swap registers             */
+} HASH_ContextTypeDef;
+
 #if (USE_HAL_HASH_SUSPEND_RESUME == 1U)
 /**
   * @brief HAL HASH mode suspend definitions
@@ -133,6 +220,10 @@ typedef struct
 
   __IO  uint32_t             Accumulation;     /*!< HASH multi buffers accumulation flag    */
 
+#if defined(USE_HAL_REQUEST) && (USE_HAL_REQUEST == 1U)
+  struct __HAL_RequestTypeDef *pRequest;       /*!< Pointer to the ongoing asynchronous request */
+#endif /* USE_HAL_REQUEST */
+
 #if (USE_HAL_HASH_REGISTER_CALLBACKS == 1)
   void (* InCpltCallback)(struct __HASH_HandleTypeDef *hhash);         /*!< HASH input completion callback            */
 
@@ -280,6 +371,25 @@ typedef  void (*pHASH_CallbackTypeDef)(HASH_HandleTypeDef *hhash);  /*!< pointer
   * @}
   */
 
+/** @defgroup HASH_Region_Chunk_Size HASH memory region chunk size
+  * @{
+  */
+#define HASH_REGION_CHUNK_SIZE     0x0000FFFCU     /*!< Bytes of a region transferred by a DMA node */
+/**
+  * @}
+  */
+
+#if defined(USE_HAL_REQUEST) && (USE_HAL_REQUEST == 1U)
+/** @defgroup HASH_Request_Operation HASH Asynchronous Request Operation
+  * @{
+  */
+#define HAL_HASH_REQUEST_DIGEST    0x00000000U     /*!< Request the digest of pSrc into pDst      */
+#define HAL_HASH_REQUEST_HMAC      0x00000001U     /*!< Request the HMAC of pSrc into pDst        */
+/**
+  * @}
+  */
+#endif /* USE_HAL_REQUEST */
+
 /**
   * @}
   */
@@ -410,6 +520,8 @@ HAL_StatusTypeDef HAL_HASH_UnRegisterCallback(HASH_HandleTypeDef *hhash, HAL_HAS
 HAL_StatusTypeDef HAL_HASH_ProcessSuspend(HASH_HandleTypeDef *hhash);
 void HAL_HASH_Resume(HASH_HandleTypeDef *hhash, uint8_t *pMemBuffer);
 void HAL_HASH_Suspend(HASH_HandleTypeDef *hhash, uint8_t *pMemBuffer);
+HAL_StatusTypeDef HAL_HASH_SaveContext(HASH_HandleTypeDef *hhash, HASH_ContextTypeDef *pContext);
+HAL_StatusTypeDef HAL_HASH_RestoreContext(HASH_HandleTypeDef *hhash, const HASH_ContextTypeDef *pContext);
 /**
   * @}
   */
@@ -425,6 +537,14 @@ HAL_StatusTypeDef HAL_HASH_Start_IT(HASH_HandleTypeDef *hhash, const  uint8_t *c
                                     uint8_t  *const pOutBuffer);
 HAL_StatusTypeDef HAL_HASH_Start_DMA(HASH_HandleTypeDef *hhash, const uint8_t *const pInBuffer, uint32_t Size,
                                      uint8_t  *const pOutBuffer);
+HAL_StatusTypeDef HAL_HASH_StartSG(HASH_HandleTypeDef *hhash, const HASH_FragmentTypeDef *pFragments,
+                                   uint32_t FragmentNbr, DMA_QListTypeDef *pQList, DMA_NodeTypeDef *pNodes,
+                                   uint8_t *const pOutBuffer);
+HAL_StatusTypeDef HAL_HASH_StartRegion_DMA(HASH_HandleTypeDef *hhash, const HASH_RegionConfTypeDef *pConfig,
+                                           uint8_t *const pOutBuffer);
+#if defined(USE_HAL_REQUEST) && (USE_HAL_REQUEST == 1U)
+HAL_StatusTypeDef HAL_HASH_Request_Start(HAL_RequestTypeDef *pReq);
+#endif /* USE_HAL_REQUEST */
 
 HAL_StatusTypeDef HAL_HASH_Accumulate(HASH_HandleTypeDef *hhash, const uint8_t *const pInBuffer, uint32_t Size,
                                       uint32_t Timeout);
@@ -449,6 +569,10 @@ HAL_StatusTypeDef HAL_HASH_HMAC_Start_DMA(HASH_HandleTypeDef *hhash, const uint8
                                           uint8_t *const pOutBuffer);
 HAL_StatusTypeDef HAL_HASH_HMAC_Start_IT(HASH_HandleTypeDef *hhash, const uint8_t *const pInBuffer, uint32_t Size,
                                          uint8_t *const pOutBuffer);
+#if defined(AES) && defined(HAL_CRYP_MODULE_ENABLED)
+HAL_StatusTypeDef HAL_HASH_HMAC_EncryptThenMAC(HASH_HandleTypeDef *hhash, const HASH_EtMConfTypeDef *pConfig,
+                                               uint8_t *const pOutBuffer);
+#endif /* AES && HAL_CRYP_MODULE_ENABLED */
 
 HAL_StatusTypeDef HAL_HASH_HMAC_Accumulate(HASH_HandleTypeDef *hhash, const uint8_t *const pInBuffer, uint32_t Size,
                                            uint32_t Timeout);
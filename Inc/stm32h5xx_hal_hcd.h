@@ -81,6 +81,18 @@ typedef enum
  * 8Bytes each Block 32Bit in each word
  */
 #define PMA_BLOCKS        ((USB_DRD_PMA_SIZE) / (8U * 32U))
+
+/**
+  * @brief  HCD queued URB structure definition
+  */
+typedef struct
+{
+  uint8_t             *pBuffer;    /*!< Data buffer of the URB                   */
+  uint16_t            Length;      /*!< Length of the URB data                   */
+  uint16_t            XferCount;   /*!< Bytes transferred, set on completion     */
+  HCD_URBStateTypeDef URBState;    /*!< URB_DONE, URB_STALL or URB_ERROR         */
+  void                *pContext;   /*!< User context, not used by the driver     */
+} HCD_URBTypeDef;
 #endif /* defined (USB_DRD_FS) */
 /**
   * @}
@@ -104,6 +116,7 @@ typedef struct
   uint16_t                  phy_chout_state[8]; /*!< Physical Channel out State (Used/Free)*/
   uint32_t                  PMALookupTable[PMA_BLOCKS]; /*PMA LookUp Table */
   HCD_HostStateTypeDef      HostState; /*!< USB current state DICONNECT/CONNECT/RUN/SUSPEND/RESUME */
+  struct __HCD_URBQueueTypeDef *pURBQueue[16]; /*!< Channels URB queues, NULL when not used */
 #endif /* defined (USB_DRD_FS) */
   HAL_LockTypeDef           Lock;       /*!< HCD peripheral status    */
   __IO HCD_StateTypeDef     State;      /*!< HCD communication state  */
@@ -122,6 +135,23 @@ typedef struct
   void (* MspDeInitCallback)(struct __HCD_HandleTypeDef *hhcd);                         /*!< USB OTG HCD Msp DeInit callback         */
 #endif /* USE_HAL_HCD_REGISTER_CALLBACKS */
 } HCD_HandleTypeDef;
+
+#if defined (USB_DRD_FS)
+/**
+  * @brief  HCD channel URB queue structure definition
+  */
+typedef struct __HCD_URBQueueTypeDef
+{
+  HCD_URBTypeDef *pURBs;            /*!< User ring of Size URBs                        */
+  uint32_t       Size;              /*!< Number of entries of the ring                 */
+  __IO uint32_t  Head;              /*!< Number of URBs submitted                      */
+  __IO uint32_t  Tail;              /*!< Number of URBs completed                      */
+  __IO uint32_t  Busy;              /*!< URB Tail ongoing on the channel               */
+  void (* pURBCpltCallback)(HCD_HandleTypeDef *hhcd, uint8_t ch_num,
+                            HCD_URBTypeDef *pURB); /*!< URB completion callback, called
+                                                        from the channel interrupt      */
+} HCD_URBQueueTypeDef;
+#endif /* defined (USB_DRD_FS) */
 /**
   * @}
   */
@@ -308,6 +338,16 @@ HAL_StatusTypeDef HAL_HCD_HC_SetHubInfo(HCD_HandleTypeDef *hhcd, uint8_t ch_num,
 
 HAL_StatusTypeDef HAL_HCD_HC_ClearHubInfo(HCD_HandleTypeDef *hhcd, uint8_t ch_num);
 
+#if defined (USB_DRD_FS)
+HAL_StatusTypeDef HAL_HCD_HC_URBQueue_Start(HCD_HandleTypeDef *hhcd, uint8_t ch_num, HCD_URBQueueTypeDef *pQueue,
+                                            HCD_URBTypeDef *pURBs, uint32_t Size,
+                                            void (* pURBCpltCallback)(HCD_HandleTypeDef *hhcd, uint8_t ch_num,
+                                                                      HCD_URBTypeDef *pURB));
+HAL_StatusTypeDef HAL_HCD_HC_URBQueue_Submit(HCD_HandleTypeDef *hhcd, uint8_t ch_num, uint8_t *pbuff,
+                                             uint16_t length, void *pContext);
+HAL_StatusTypeDef HAL_HCD_HC_URBQueue_Stop(HCD_HandleTypeDef *hhcd, uint8_t ch_num);
+#endif /* defined (USB_DRD_FS) */
+
 /* Non-Blocking mode: Interrupt */
 void HAL_HCD_IRQHandler(HCD_HandleTypeDef *hhcd);
 void HAL_HCD_SOF_Callback(HCD_HandleTypeDef *hhcd);
@@ -177,6 +177,30 @@ typedef enum
   * @}
   */
 
+/** @defgroup I2C_Probe_Structure_definition I2C probe Structure definition
+  * @brief  I2C probe Structure definition
+  * @{
+  */
+typedef struct __I2C_ProbeTypeDef
+{
+  const uint16_t *pDevAddress; /*!< Target device addresses, the 7 bits address value must be shifted to the left */
+
+  uint8_t        *pReady;      /*!< Output: 1 for each device acknowledging its address, 0 otherwise           */
+
+  uint32_t       DevNbr;       /*!< Number of device addresses                                                  */
+
+  uint32_t       Trials;       /*!< Number of address trials per device                                         */
+
+  uint32_t       ReadyNbr;     /*!< Output: number of devices acknowledging their address                      */
+
+  __IO uint32_t  Index;        /*!< Index of the device being probed (managed by the driver)                    */
+
+  __IO uint32_t  Trial;        /*!< Trial of the device being probed (managed by the driver)                    */
+} I2C_ProbeTypeDef;
+/**
+  * @}
+  */
+
 /** @defgroup I2C_handle_Structure_definition I2C handle Structure definition
   * @brief  I2C handle Structure definition
   * @{
@@ -222,6 +246,27 @@ typedef struct __I2C_HandleTypeDef
 
   __IO uint32_t              Memaddress;     /*!< I2C Target memory address                 */
 
+  struct __I2C_JobTypeDef    *pJobs;         /*!< Pointer to the ongoing I2C job list       */
+
+  uint32_t                   JobNbr;         /*!< Number of jobs in the job list            */
+
+  __IO uint32_t              JobIndex;       /*!< Index of the ongoing (or failing) job     */
+
+  void (*JobISR)(struct __I2C_HandleTypeDef *hi2c);
+  /*!< I2C job list handler function pointer, called at end of each job, NULL when no job list is ongoing */
+
+  struct __I2C_ProbeTypeDef  *pProbe;        /*!< Pointer to the ongoing device probe, NULL when not in use */
+
+  uint8_t                    *pRegFile;      /*!< Pointer to the slave register file, NULL when not in use */
+
+  uint16_t                   RegFileSize;    /*!< Size of the slave register file           */
+
+  __IO uint16_t              RegPointer;     /*!< Slave register file address pointer       */
+
+#if defined(USE_HAL_OS_HOOKS) && (USE_HAL_OS_HOOKS == 1U)
+  __IO uint32_t              OsWaiting;      /*!< A thread waits for the end of the transfer with HAL_OS_Wait() */
+#endif /* USE_HAL_OS_HOOKS */
+
 #if (USE_HAL_I2C_REGISTER_CALLBACKS == 1)
   void (* MasterTxCpltCallback)(struct __I2C_HandleTypeDef *hi2c);
   /*!< I2C Master Tx Transfer completed callback */
@@ -661,6 +706,7 @@ HAL_StatusTypeDef HAL_I2C_Slave_Seq_Receive_IT(I2C_HandleTypeDef *hi2c, uint8_t
 HAL_StatusTypeDef HAL_I2C_EnableListen_IT(I2C_HandleTypeDef *hi2c);
 HAL_StatusTypeDef HAL_I2C_DisableListen_IT(I2C_HandleTypeDef *hi2c);
 HAL_StatusTypeDef HAL_I2C_Master_Abort_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress);
+HAL_StatusTypeDef HAL_I2C_Probe_IT(I2C_HandleTypeDef *hi2c, I2C_ProbeTypeDef *pProbe);
 
 #if defined(HAL_DMA_MODULE_ENABLED)
 /******* Non-Blocking mode: DMA */
@@ -704,6 +750,7 @@ void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c);
 void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef *hi2c);
 void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c);
 void HAL_I2C_AbortCpltCallback(I2C_HandleTypeDef *hi2c);
+void HAL_I2C_ProbeCpltCallback(I2C_HandleTypeDef *hi2c);
 /**
   * @}
   */
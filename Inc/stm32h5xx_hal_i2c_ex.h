@@ -36,6 +36,34 @@ extern "C" {
   */
 
 /* Exported types ------------------------------------------------------------*/
+/** @defgroup I2CEx_Exported_Types I2C Extended Exported Types
+  * @{
+  */
+
+/**
+  * @brief  I2C job structure definition, one register block access of the job list
+  */
+typedef struct __I2C_JobTypeDef
+{
+  uint16_t DevAddress;   /*!< Target device address, the 7 bits address value must be shifted to the left */
+
+  uint16_t MemAddress;   /*!< Internal memory (register) address                                          */
+
+  uint16_t MemAddSize;   /*!< Size of internal memory address.
+                              This parameter can be a value of @ref I2C_MEMORY_ADDRESS_SIZE             */
+
+  uint32_t Direction;    /*!< Job direction.
+                              This parameter can be a value of @ref I2CEx_Job_Direction                 */
+
+  uint8_t  *pData;       /*!< Pointer to data buffer                                                      */
+
+  uint16_t Size;         /*!< Amount of data to be written or read                                        */
+} I2C_JobTypeDef;
+
+/**
+  * @}
+  */
+
 /* Exported constants --------------------------------------------------------*/
 /** @defgroup I2CEx_Exported_Constants I2C Extended Exported Constants
   * @{
@@ -59,6 +87,15 @@ extern "C" {
   * @}
   */
 
+/** @defgroup I2CEx_Job_Direction I2C Extended Job Direction
+  * @{
+  */
+#define I2C_JOB_WRITE                   0x00000000U           /*!< Register block write                         */
+#define I2C_JOB_READ                    0x00000001U           /*!< Register block read                          */
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -104,6 +141,27 @@ HAL_StatusTypeDef HAL_I2CEx_ConfigFastModePlus(I2C_HandleTypeDef *hi2c, uint32_t
   * @}
   */
 
+/** @addtogroup I2CEx_Exported_Functions_Group4 Job List Functions
+  * @{
+  */
+HAL_StatusTypeDef HAL_I2CEx_JobList_IT(I2C_HandleTypeDef *hi2c, I2C_JobTypeDef *pJobs, uint32_t JobNbr);
+void HAL_I2CEx_JobListCpltCallback(I2C_HandleTypeDef *hi2c);
+/**
+  * @}
+  */
+
+#if defined(HAL_DMA_MODULE_ENABLED)
+/** @addtogroup I2CEx_Exported_Functions_Group5 Slave Register File Functions
+  * @{
+  */
+HAL_StatusTypeDef HAL_I2CEx_RegFile_Start_DMA(I2C_HandleTypeDef *hi2c, uint8_t *pRegs, uint16_t Size);
+HAL_StatusTypeDef HAL_I2CEx_RegFile_Stop(I2C_HandleTypeDef *hi2c);
+void HAL_I2CEx_RegFileWriteCallback(I2C_HandleTypeDef *hi2c, uint16_t Offset, uint16_t Length);
+/**
+  * @}
+  */
+#endif /* HAL_DMA_MODULE_ENABLED */
+
 /**
   * @}
   */
@@ -128,6 +186,9 @@ HAL_StatusTypeDef HAL_I2CEx_ConfigFastModePlus(I2C_HandleTypeDef *hi2c, uint32_t
 
 #define IS_I2C_FASTMODEPLUS(__CONFIG__) (((__CONFIG__) == (I2C_FASTMODEPLUS_ENABLE))   || \
                                          ((__CONFIG__) == (I2C_FASTMODEPLUS_DISABLE)))
+
+#define IS_I2C_JOB_DIRECTION(__DIR__)   (((__DIR__) == I2C_JOB_WRITE) || \
+                                         ((__DIR__) == I2C_JOB_READ))
 /**
   * @}
   */
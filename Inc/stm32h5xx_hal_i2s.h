@@ -172,6 +172,34 @@ typedef enum
 typedef  void (*pI2S_CallbackTypeDef)(I2S_HandleTypeDef *hi2s); /*!< pointer to an I2S callback function */
 
 #endif /* USE_HAL_I2S_REGISTER_CALLBACKS */
+
+/**
+  * @brief  I2S full-duplex DMA streaming configuration structure definition
+  * @note   The queues, the nodes and the buffers are provided by the user and must stay allocated while
+  *         the streaming runs.
+  */
+typedef struct
+{
+  DMA_QListTypeDef  *pTxQueue;      /*!< Linked-list queue used to build the circular Tx streaming queue */
+
+  DMA_NodeTypeDef   *pTxNode;       /*!< Linked-list node of the Tx queue */
+
+  uint32_t          TxRequest;      /*!< DMA request of the I2S transmitter.
+                                         This parameter can be a value of @ref DMA_Request_Selection */
+
+  DMA_QListTypeDef  *pRxQueue;      /*!< Linked-list queue used to build the circular Rx streaming queue */
+
+  DMA_NodeTypeDef   *pRxNode;       /*!< Linked-list node of the Rx queue */
+
+  uint32_t          RxRequest;      /*!< DMA request of the I2S receiver.
+                                         This parameter can be a value of @ref DMA_Request_Selection */
+
+  const uint16_t    *pTxData;       /*!< Tx circular buffer */
+
+  uint16_t          *pRxData;       /*!< Rx circular buffer */
+
+  uint16_t          Size;           /*!< Number of data of each buffer, same unit as HAL_I2SEx_TransmitReceive_DMA() */
+} I2S_StreamConfTypeDef;
 /**
   * @}
   */
@@ -500,6 +528,7 @@ HAL_StatusTypeDef HAL_I2S_Transmit_DMA(I2S_HandleTypeDef *hi2s, const uint16_t *
 HAL_StatusTypeDef HAL_I2S_Receive_DMA(I2S_HandleTypeDef *hi2s, uint16_t *pData, uint16_t Size);
 HAL_StatusTypeDef HAL_I2SEx_TransmitReceive_DMA(I2S_HandleTypeDef *hi2s, const uint16_t *pTxData, uint16_t *pRxData,
                                                 uint16_t Size);
+HAL_StatusTypeDef HAL_I2SEx_TransmitReceiveStream_DMA(I2S_HandleTypeDef *hi2s, const I2S_StreamConfTypeDef *pConfig);
 
 HAL_StatusTypeDef HAL_I2S_DMAPause(I2S_HandleTypeDef *hi2s);
 HAL_StatusTypeDef HAL_I2S_DMAResume(I2S_HandleTypeDef *hi2s);
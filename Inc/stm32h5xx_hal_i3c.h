@@ -434,6 +434,27 @@ typedef struct
   * @}
   */
 
+/** @defgroup I3C_FrameTypeDef_Structure_definition I3C FrameTypeDef Structure definition
+  * @brief    I3C FrameTypeDef Structure definition
+  * @{
+  */
+typedef struct
+{
+  const I3C_CCCTypeDef     *pCCCDesc;          /*!< CCC descriptor of the frame, NULL for a private frame       */
+  const I3C_PrivateTypeDef *pPrivateDesc;      /*!< Private descriptor of the frame, NULL for a CCC frame       */
+  I3C_XferTypeDef          *pXferData;         /*!< Transfer buffers holding the control words of the frame     */
+  I3C_XferTypeDef          Buffers;            /*!< Buffers of pXferData restored before each transfer. The
+                                                    TxBuf and RxBuf pointers can be updated between transfers,
+                                                    the sizes must be kept                                      */
+  uint32_t                 ControlXferCount;   /*!< Number of control words of the frame                        */
+  uint32_t                 TxXferCount;        /*!< Number of bytes to transmit                                 */
+  uint32_t                 RxXferCount;        /*!< Number of bytes to receive                                  */
+
+} I3C_FrameTypeDef;
+/**
+  * @}
+  */
+
 /** @defgroup I3C_handle_Structure_definition I3C handle Structure definition
   * @brief    I3C handle Structure definition
   * @{
@@ -489,6 +510,9 @@ typedef struct __I3C_HandleTypeDef
 
   void(*ptrRxFunc)(struct __I3C_HandleTypeDef *hi3c);             /*!< I3C receive function pointer              */
 
+  struct __I3C_IBIStreamTypeDef *pIBIStream;                      /*!< I3C controller IBI stream, NULL when the
+                                                                       IBIs are reported by the notify callback  */
+
 #if (USE_HAL_I3C_REGISTER_CALLBACKS == 1U)
 
   void (* CtrlTxCpltCallback)(struct __I3C_HandleTypeDef *hi3c);
@@ -537,6 +561,70 @@ typedef struct __I3C_HandleTypeDef
   * @}
   */
 
+/** @defgroup I3C_IBIStream_Structure_definition I3C IBI stream Structure definition
+  * @brief    I3C IBI stream Structure definition
+  * @{
+  */
+typedef struct
+{
+  uint8_t  TargetAddr;          /*!< Dynamic address of the target raising IBIs                                  */
+  uint32_t ReadSize;            /*!< Number of bytes read from the target after each of its IBIs, 0 for none     */
+
+} I3C_IBIStreamTargetTypeDef;
+
+typedef struct
+{
+  uint32_t TargetAddr;          /*!< Address of the target which raised the IBI                                  */
+  uint32_t PayloadSize;         /*!< Number of IBI data bytes received, the mandatory data byte included         */
+  uint32_t Payload;             /*!< IBI data bytes, the mandatory data byte in the least significant byte       */
+  uint32_t DataSize;            /*!< Number of bytes of the follow-up read, 0 when the read failed               */
+  uint32_t ErrorCode;           /*!< Error code of the follow-up read                                            */
+
+} I3C_IBIStreamEntryTypeDef;
+
+typedef struct __I3C_IBIStreamTypeDef
+{
+  const I3C_IBIStreamTargetTypeDef *pTargets;  /*!< Targets with a follow-up read after their IBIs             */
+  uint32_t                   TargetCount;      /*!< Number of entries of pTargets                              */
+  I3C_IBIStreamEntryTypeDef  *pEntries;        /*!< User ring of EntryCount entries                            */
+  uint8_t                    *pDataPool;       /*!< User buffer of EntryCount * DataSlotSize bytes for the
+                                                    follow-up read data                                        */
+  uint32_t                   EntryCount;       /*!< Number of entries of the ring                              */
+  uint32_t                   DataSlotSize;     /*!< Maximum follow-up read size per entry in bytes             */
+  void (* pEntryCallback)(struct __I3C_HandleTypeDef *hi3c); /*!< Called from the I3C interrupt when entries
+                                                                  are complete, or NULL                      */
+
+  __IO uint32_t              Head;             /*!< Number of IBIs captured                                    */
+  __IO uint32_t              ReadIndex;        /*!< Number of entries complete                                 */
+  __IO uint32_t              Tail;             /*!< Number of entries retrieved by the application             */
+  __IO uint32_t              ReadActive;       /*!< Follow-up read ongoing                                     */
+  __IO uint32_t              OverflowCount;    /*!< Number of IBIs dropped on a full ring                      */
+  I3C_PrivateTypeDef         PrivateDesc;      /*!< Follow-up read descriptor                                  */
+  I3C_XferTypeDef            Xfer;             /*!< Follow-up read transfer buffers                            */
+  uint32_t                   ControlWord;      /*!< Follow-up read control buffer                              */
+
+} I3C_IBIStreamTypeDef;
+/**
+  * @}
+  */
+
+/** @defgroup I3C_DeviceTable_Structure_definition I3C device table Structure definition
+  * @brief    I3C device table Structure definition
+  * @{
+  */
+typedef struct
+{
+  uint64_t Payload;             /*!< ENTDAA payload of the target (PID, BCR and DCR), 0 when not yet known       */
+  uint8_t  StaticAddr;          /*!< Static address of the target assigned with SETDASA, 0 when it has none      */
+  uint8_t  DynamicAddr;         /*!< Dynamic address of the target, 0 to let the driver allocate one             */
+  uint8_t  DeviceIndex;         /*!< DEVRx register index (1 to 4) configured after the assignment, 0 for none   */
+  uint8_t  Present;             /*!< Set when the target received its dynamic address during the last assignment */
+
+} I3C_DeviceTableEntryTypeDef;
+/**
+  * @}
+  */
+
 #if (USE_HAL_I3C_REGISTER_CALLBACKS == 1U)
 /** @defgroup HAL_I3C_Callback_ID_definition I3C callback ID definition
   * @brief    HAL I3C callback ID definition
@@ -1222,6 +1310,14 @@ HAL_StatusTypeDef HAL_I3C_AddDescToFrame(I3C_HandleTypeDef         *hi3c,
                                          I3C_XferTypeDef           *pXferData,
                                          uint8_t                   nbFrame,
                                          uint32_t                  option);
+HAL_StatusTypeDef HAL_I3C_Ctrl_BuildFrame(I3C_HandleTypeDef         *hi3c,
+                                          const I3C_CCCTypeDef      *pCCCDesc,
+                                          const I3C_PrivateTypeDef  *pPrivateDesc,
+                                          I3C_XferTypeDef           *pXferData,
+                                          uint8_t                   nbFrame,
+                                          uint32_t                  option,
+                                          I3C_FrameTypeDef          *pFrame);
+HAL_StatusTypeDef HAL_I3C_Ctrl_LoadFrame(I3C_HandleTypeDef *hi3c, const I3C_FrameTypeDef *pFrame);
 HAL_StatusTypeDef HAL_I3C_Ctrl_SetConfigResetPattern(I3C_HandleTypeDef *hi3c, uint32_t resetPattern);
 HAL_StatusTypeDef HAL_I3C_Ctrl_GetConfigResetPattern(I3C_HandleTypeDef *hi3c, uint32_t *pResetPattern);
 /**
@@ -1307,6 +1403,17 @@ HAL_StatusTypeDef HAL_I3C_Ctrl_IsDeviceI2C_Ready(I3C_HandleTypeDef *hi3c,
 HAL_StatusTypeDef HAL_I3C_Ctrl_GeneratePatterns(I3C_HandleTypeDef *hi3c, uint32_t pattern, uint32_t timeout);
 /* Controller arbitration APIs */
 HAL_StatusTypeDef HAL_I3C_Ctrl_GenerateArbitration(I3C_HandleTypeDef *hi3c, uint32_t timeout);
+/* Controller IBI stream APIs */
+HAL_StatusTypeDef HAL_I3C_Ctrl_IBIStream_Start(I3C_HandleTypeDef *hi3c, I3C_IBIStreamTypeDef *pStream);
+HAL_StatusTypeDef HAL_I3C_Ctrl_IBIStream_Stop(I3C_HandleTypeDef *hi3c);
+HAL_StatusTypeDef HAL_I3C_Ctrl_IBIStream_Get(I3C_HandleTypeDef *hi3c, I3C_IBIStreamEntryTypeDef *pEntry,
+                                             uint8_t *pData);
+/* Controller device table APIs */
+HAL_StatusTypeDef HAL_I3C_Ctrl_DeviceTable_Assign(I3C_HandleTypeDef           *hi3c,
+                                                  I3C_DeviceTableEntryTypeDef *pTable,
+                                                  uint32_t                     nbEntry,
+                                                  uint32_t                     dynOption,
+                                                  uint32_t                     timeout);
 
 /**
   * @}
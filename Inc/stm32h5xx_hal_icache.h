@@ -37,11 +37,49 @@ extern "C" {
   */
 
 /* Exported types -----------------------------------------------------------*/
-#if defined(ICACHE_CRRx_REN)
 /** @defgroup ICACHE_Exported_Types ICACHE Exported Types
   * @{
   */
 
+/**
+  * @brief  HAL ICACHE profiling phase statistics structure definition
+  */
+typedef struct
+{
+  uint32_t Hits;                     /*!< Hits accumulated over the phase runs */
+
+  uint32_t Misses;                   /*!< Misses accumulated over the phase runs */
+
+  uint32_t Runs;                     /*!< Number of runs of the phase */
+} ICACHE_ProfilePhaseTypeDef;
+
+/**
+  * @brief  HAL ICACHE profiling structure definition
+  */
+typedef struct
+{
+  ICACHE_ProfilePhaseTypeDef *pPhases; /*!< User array of phase statistics */
+
+  uint32_t NbPhases;                 /*!< Number of phases of the array */
+
+  uint32_t CurrentPhase;             /*!< Phase being profiled, NbPhases if none */
+} ICACHE_ProfileTypeDef;
+
+/**
+  * @brief  HAL ICACHE associativity comparison result structure definition
+  */
+typedef struct
+{
+  uint32_t HitRate1Way;              /*!< Hit rate of the workload in 1-way mode, in per mille */
+
+  uint32_t HitRate2Ways;             /*!< Hit rate of the workload in 2-ways mode, in per mille */
+
+  uint32_t BestMode;                 /*!< Mode with the best hit rate.
+                                          This parameter can be a value of @ref ICACHE_WaysSelection */
+} ICACHE_AssociativityResultTypeDef;
+
+#if defined(ICACHE_CRRx_REN)
+
 /**
   * @brief  HAL ICACHE region configuration structure definition
   */
@@ -60,10 +98,10 @@ typedef struct
   uint32_t OutputBurstType;          /*!< Selects the output burst type.
                                           This parameter can be a value of @ref ICACHE_Output_Burst_Type */
 } ICACHE_RegionConfigTypeDef;
+#endif /*  ICACHE_CRRx_REN */
 /**
   * @}
   */
-#endif /*  ICACHE_CRRx_REN */
 
 /* Exported constants -------------------------------------------------------*/
 /** @defgroup ICACHE_Exported_Constants ICACHE Exported Constants
@@ -274,12 +312,31 @@ void HAL_ICACHE_ErrorCallback(void);
 /******* Memory remapped regions functions */
 HAL_StatusTypeDef HAL_ICACHE_EnableRemapRegion(uint32_t Region, const ICACHE_RegionConfigTypeDef *const pRegionConfig);
 HAL_StatusTypeDef HAL_ICACHE_DisableRemapRegion(uint32_t Region);
+HAL_StatusTypeDef HAL_ICACHE_SuggestRemapRegion(uint32_t ExternalAddress, uint32_t CodeSize, uint32_t BaseAddress,
+                                                uint32_t *pRegion, ICACHE_RegionConfigTypeDef *pRegionConfig);
 
 /**
   * @}
   */
 #endif /*  ICACHE_CRRx_REN */
 
+/** @addtogroup ICACHE_Exported_Functions_Group4
+  * @brief    Profiling functions
+  * @{
+  */
+/******* Hit rate profiling functions */
+HAL_StatusTypeDef HAL_ICACHE_Profile_Init(ICACHE_ProfileTypeDef *pProfile, ICACHE_ProfilePhaseTypeDef *pPhases,
+                                          uint32_t NbPhases);
+HAL_StatusTypeDef HAL_ICACHE_Profile_Enter(ICACHE_ProfileTypeDef *pProfile, uint32_t Phase);
+HAL_StatusTypeDef HAL_ICACHE_Profile_Exit(ICACHE_ProfileTypeDef *pProfile);
+uint32_t HAL_ICACHE_Profile_GetHitRate(const ICACHE_ProfileTypeDef *pProfile, uint32_t Phase);
+HAL_StatusTypeDef HAL_ICACHE_CompareAssociativity(void (*pWorkload)(void),
+                                                  ICACHE_AssociativityResultTypeDef *pResult);
+
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -178,6 +178,9 @@ typedef struct
 
   __IO uint32_t            ErrorCode;        /*!< IRDA Error code                    */
 
+  __IO uint32_t            ReceptionType;    /*!< Type of ongoing reception
+                                                  This parameter can be a value of @ref IRDA_Reception_Type_Values */
+
 #if (USE_HAL_IRDA_REGISTER_CALLBACKS == 1)
   void (* TxHalfCpltCallback)(struct __IRDA_HandleTypeDef *hirda);        /*!< IRDA Tx Half Complete Callback        */
 
@@ -195,6 +198,8 @@ typedef struct
 
   void (* AbortReceiveCpltCallback)(struct __IRDA_HandleTypeDef *hirda);  /*!< IRDA Abort Receive Complete Callback  */
 
+  void (* RxEventCallback)(struct __IRDA_HandleTypeDef *hirda, uint16_t Pos); /*!< IRDA Reception Event Callback  */
+
 
   void (* MspInitCallback)(struct __IRDA_HandleTypeDef *hirda);           /*!< IRDA Msp Init callback                */
 
@@ -228,6 +233,12 @@ typedef enum
   */
 typedef  void (*pIRDA_CallbackTypeDef)(IRDA_HandleTypeDef *hirda);  /*!< pointer to an IRDA callback function */
 
+/**
+  * @brief  HAL IRDA Reception Event Callback pointer definition
+  */
+typedef  void (*pIRDA_RxEventCallbackTypeDef)(IRDA_HandleTypeDef *hirda, uint16_t Pos); /*!< pointer to a IRDA Rx Event
+                                                                                            specific callback function */
+
 #endif /* USE_HAL_IRDA_REGISTER_CALLBACKS */
 
 /**
@@ -376,6 +387,15 @@ typedef  void (*pIRDA_CallbackTypeDef)(IRDA_HandleTypeDef *hirda);  /*!< pointer
   * @}
   */
 
+/** @defgroup IRDA_Reception_Type_Values  IRDA Reception type values
+  * @{
+  */
+#define HAL_IRDA_RECEPTION_STANDARD          (0x00000000U)             /*!< Standard reception                      */
+#define HAL_IRDA_RECEPTION_TOIDLE            (0x00000001U)             /*!< Reception till completion or IDLE event */
+/**
+  * @}
+  */
+
 /** @defgroup IRDA_Request_Parameters IRDA Request Parameters
   * @{
   */
@@ -824,6 +844,9 @@ void HAL_IRDA_MspDeInit(IRDA_HandleTypeDef *hirda);
 HAL_StatusTypeDef HAL_IRDA_RegisterCallback(IRDA_HandleTypeDef *hirda, HAL_IRDA_CallbackIDTypeDef CallbackID,
                                             pIRDA_CallbackTypeDef pCallback);
 HAL_StatusTypeDef HAL_IRDA_UnRegisterCallback(IRDA_HandleTypeDef *hirda, HAL_IRDA_CallbackIDTypeDef CallbackID);
+
+HAL_StatusTypeDef HAL_IRDA_RegisterRxEventCallback(IRDA_HandleTypeDef *hirda, pIRDA_RxEventCallbackTypeDef pCallback);
+HAL_StatusTypeDef HAL_IRDA_UnRegisterRxEventCallback(IRDA_HandleTypeDef *hirda);
 #endif /* USE_HAL_IRDA_REGISTER_CALLBACKS */
 
 /**
@@ -842,6 +865,7 @@ HAL_StatusTypeDef HAL_IRDA_Receive_IT(IRDA_HandleTypeDef *hirda, uint8_t *pData,
 #if defined(HAL_DMA_MODULE_ENABLED)
 HAL_StatusTypeDef HAL_IRDA_Transmit_DMA(IRDA_HandleTypeDef *hirda, const uint8_t *pData, uint16_t Size);
 HAL_StatusTypeDef HAL_IRDA_Receive_DMA(IRDA_HandleTypeDef *hirda, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_IRDA_ReceiveToIdle_DMA(IRDA_HandleTypeDef *hirda, uint8_t *pData, uint16_t Size);
 HAL_StatusTypeDef HAL_IRDA_DMAPause(IRDA_HandleTypeDef *hirda);
 HAL_StatusTypeDef HAL_IRDA_DMAResume(IRDA_HandleTypeDef *hirda);
 HAL_StatusTypeDef HAL_IRDA_DMAStop(IRDA_HandleTypeDef *hirda);
@@ -863,6 +887,7 @@ void HAL_IRDA_ErrorCallback(IRDA_HandleTypeDef *hirda);
 void HAL_IRDA_AbortCpltCallback(IRDA_HandleTypeDef *hirda);
 void HAL_IRDA_AbortTransmitCpltCallback(IRDA_HandleTypeDef *hirda);
 void HAL_IRDA_AbortReceiveCpltCallback(IRDA_HandleTypeDef *hirda);
+void HAL_IRDA_RxEventCallback(IRDA_HandleTypeDef *hirda, uint16_t Pos);
 
 /**
   * @}
@@ -40,6 +40,11 @@ extern "C" {
   * @{
   */
 
+/**
+  * @brief  Maximum number of tasks of the IWDG task supervisor
+  */
+#define IWDG_SUPERVISOR_MAX_TASKS       32U
+
 /**
   * @brief  IWDG Init structure definition
   */
@@ -78,6 +83,27 @@ typedef struct
 #endif /* USE_HAL_IWDG_REGISTER_CALLBACKS */
 } IWDG_HandleTypeDef;
 
+/**
+  * @brief  IWDG task supervisor structure definition
+  */
+typedef struct
+{
+  uint32_t TaskNb;                                /*!< Number of supervised tasks.
+                                                       This parameter must be a number between Min_Data = 1 and
+                                                       Max_Data = IWDG_SUPERVISOR_MAX_TASKS */
+
+  uint32_t Deadline[IWDG_SUPERVISOR_MAX_TASKS];   /*!< Maximum period between two check-ins of each task, in ms */
+
+  __IO uint32_t CheckInMask;                      /*!< Tasks checked in since the last supervision, one bit per
+                                                       task, managed by the driver */
+
+  uint32_t LastCheckIn[IWDG_SUPERVISOR_MAX_TASKS]; /*!< Tick of the last supervised check-in of each task,
+                                                        managed by the driver */
+
+  uint32_t FaultMask;                             /*!< Tasks which missed their deadline, one bit per task.
+                                                       Latched, the IWDG is no longer refreshed once set */
+} IWDG_SupervisorTypeDef;
+
 #if (USE_HAL_IWDG_REGISTER_CALLBACKS == 1)
 /**
   * @brief  HAL IWDG common Callback ID enumeration definition
@@ -206,6 +232,17 @@ void                  HAL_IWDG_EarlyWakeupCallback(IWDG_HandleTypeDef *hiwdg);
   * @}
   */
 
+/** @defgroup IWDG_Exported_Functions_Group3 Task supervision functions
+  * @{
+  */
+/* Task supervision functions  ************************************************/
+HAL_StatusTypeDef     HAL_IWDG_Supervisor_Start(IWDG_SupervisorTypeDef *pSupervisor);
+void                  HAL_IWDG_Supervisor_CheckIn(IWDG_SupervisorTypeDef *pSupervisor, uint32_t TaskId);
+HAL_StatusTypeDef     HAL_IWDG_Supervisor_Process(IWDG_HandleTypeDef *hiwdg, IWDG_SupervisorTypeDef *pSupervisor);
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -89,11 +89,7 @@ typedef enum
   * @brief  JPEG handle Structure definition
   * @{
   */
-#if (USE_HAL_JPEG_REGISTER_CALLBACKS == 1)
 typedef struct __JPEG_HandleTypeDef
-#else
-typedef struct
-#endif /* (USE_HAL_JPEG_REGISTER_CALLBACKS) */
 {
   JPEG_TypeDef             *Instance;        /*!< JPEG peripheral register base address */
 
@@ -133,6 +129,12 @@ typedef struct
 
   __IO uint32_t Context;                     /*!< JPEG Internal context */
 
+#if defined(HAL_DMA2D_MODULE_ENABLED) && (USE_DMA2D_COMMAND_LIST_MODE == 0U)
+  struct __JPEG_PipelineTypeDef *pPipeline;  /*!< Attached streaming decode pipeline, NULL when not used */
+
+  struct __JPEG_EncodeSourceTypeDef *pEncodeSource;  /*!< Attached linear frame encode source, NULL when not used */
+#endif /* HAL_DMA2D_MODULE_ENABLED && USE_DMA2D_COMMAND_LIST_MODE == 0U */
+
 #if (USE_HAL_JPEG_REGISTER_CALLBACKS == 1)
   void (*InfoReadyCallback)(struct __JPEG_HandleTypeDef *hjpeg,
                             JPEG_ConfTypeDef *pInfo);  /*!< JPEG Info ready callback      */
@@ -160,6 +162,142 @@ typedef struct
   * @}
   */
 
+#if defined(HAL_DMA2D_MODULE_ENABLED) && (USE_DMA2D_COMMAND_LIST_MODE == 0U)
+/** @defgroup JPEG_Pipeline_Structure_definition JPEG streaming decode pipeline Structure definition
+  * @brief  JPEG streaming decode pipeline Structure definition,
+  *         the structure and all the buffers it references are provided by the user
+  * @{
+  */
+typedef struct __JPEG_PipelineTypeDef
+{
+  uint8_t                  *pInRing;         /*!< Compressed input ring buffer, 32-bit aligned */
+
+  uint32_t                 InRingSize;       /*!< Input ring size in bytes, multiple of 4 */
+
+  uint32_t                 InChunkSize;      /*!< Maximum number of bytes handed to the codec at once,
+                                                  multiple of 4 */
+
+  uint8_t                  *pOutChunks;      /*!< ChunkCount consecutive MCU chunks of ChunkSize bytes each,
+                                                  32-bit aligned */
+
+  uint32_t                 ChunkSize;        /*!< MCU chunk size in bytes, multiple of the MCU size
+                                                  (768 fits the 4:4:4, 4:2:2 and 4:2:0 subsamplings) */
+
+  uint32_t                 ChunkCount;       /*!< Number of MCU chunks, at least 2 */
+
+  DMA2D_HandleTypeDef      *hdma2d;          /*!< Initialized DMA2D handle used for the YCbCr to RGB conversion,
+                                                  its mode, color mode, offsets and callbacks are overwritten */
+
+  uint32_t                 OutputColorMode;  /*!< Frame buffer color mode, DMA2D_OUTPUT_ARGB8888 or
+                                                  DMA2D_OUTPUT_RGB565 */
+
+  uint32_t                 FrameAddress;     /*!< Frame buffer address of the top left pixel of the image */
+
+  uint32_t                 FramePitch;       /*!< Frame buffer line length in pixels, at least the image width
+                                                  rounded up to the MCU width */
+
+  void (* CpltCallback)(struct __JPEG_HandleTypeDef *hjpeg,
+                        HAL_StatusTypeDef Status);  /*!< Called once the last MCU is in the frame buffer,
+                                                         or with HAL_ERROR when the pipeline fails */
+
+  __IO uint32_t            InHead;           /*!< Free-running count of bytes written in the input ring */
+
+  __IO uint32_t            InTail;           /*!< Free-running count of bytes consumed by the codec */
+
+  __IO uint32_t            InEnd;            /*!< Set by HAL_JPEG_Pipeline_EndOfInput() */
+
+  __IO uint32_t            InPaused;         /*!< Codec input paused waiting for data */
+
+  __IO uint32_t            FillIndex;        /*!< Free-running count of chunks filled by the codec */
+
+  __IO uint32_t            ConvertIndex;     /*!< Free-running count of chunks converted by the DMA2D */
+
+  __IO uint32_t            OutPaused;        /*!< Codec output paused waiting for a free chunk */
+
+  __IO uint32_t            Converting;       /*!< DMA2D segment conversion on going */
+
+  uint32_t                 McuSize;          /*!< MCU size in bytes */
+
+  uint32_t                 McuWidth;         /*!< MCU width in pixels */
+
+  uint32_t                 McuHeight;        /*!< MCU height in pixels */
+
+  uint32_t                 McusPerRow;       /*!< Number of MCUs per image row */
+
+  uint32_t                 TotalMcus;        /*!< Number of MCUs in the image */
+
+  __IO uint32_t            McuIndex;         /*!< Number of MCUs already written to the frame buffer */
+
+  uint32_t                 ChunkMcu;         /*!< Number of MCUs already converted from the current chunk */
+
+  uint32_t                 SegmentMcus;      /*!< Number of MCUs of the DMA2D segment on going */
+
+  uint32_t                 BytesPerPixel;    /*!< Frame buffer bytes per pixel */
+
+} JPEG_PipelineTypeDef;
+/**
+  * @}
+  */
+
+/** @defgroup JPEG_EncodeSource_Structure_definition JPEG linear frame encode source Structure definition
+  * @brief  JPEG linear frame encode source Structure definition,
+  *         the structure and all the buffers it references are provided by the user
+  * @{
+  */
+typedef struct __JPEG_EncodeSourceTypeDef
+{
+  DMA2D_HandleTypeDef      *hdma2d;          /*!< Initialized DMA2D handle used to fetch the frame strips,
+                                                  its mode, color modes, offsets and callbacks are overwritten */
+
+  uint32_t                 FrameAddress;     /*!< Source frame buffer address of the top left pixel */
+
+  uint32_t                 FramePitch;       /*!< Source frame line length in pixels, at least the image width
+                                                  rounded up to the MCU width */
+
+  uint32_t                 InputColorMode;   /*!< Source frame color mode, DMA2D_INPUT_ARGB8888, DMA2D_INPUT_RGB888,
+                                                  DMA2D_INPUT_RGB565, DMA2D_INPUT_ARGB1555 or DMA2D_INPUT_ARGB4444 */
+
+  uint32_t                 *pStrip;          /*!< Strip buffer of one MCU row of ARGB8888 pixels: image width rounded
+                                                  up to the MCU width times the MCU height words */
+
+  uint8_t                  *pMcuRows;        /*!< Two consecutive MCU row buffers handed to the codec: image width
+                                                  rounded up to the MCU width divided by the MCU width, times the
+                                                  MCU size bytes each, 32-bit aligned */
+
+  uint32_t                 McuWidth;         /*!< MCU width in pixels */
+
+  uint32_t                 McuHeight;        /*!< MCU height in pixels */
+
+  uint32_t                 McuSize;          /*!< MCU size in bytes */
+
+  uint32_t                 McusPerRow;       /*!< Number of MCUs per image row */
+
+  uint32_t                 Rows;             /*!< Number of MCU rows in the image */
+
+  uint32_t                 RowSize;          /*!< Size in bytes of one MCU row */
+
+  uint32_t                 BytesPerPixel;    /*!< Source frame bytes per pixel */
+
+  __IO uint32_t            FetchRow;         /*!< Index of the next MCU row fetched by the DMA2D */
+
+  __IO uint32_t            RowsReady;        /*!< Free-running count of MCU rows converted for the codec */
+
+  __IO uint32_t            RowsConsumed;     /*!< Free-running count of MCU rows consumed by the codec */
+
+  __IO uint32_t            StripPending;     /*!< Fetched strip waiting for a free MCU row buffer */
+
+  __IO uint32_t            Fetching;         /*!< DMA2D strip fetch on going */
+
+  __IO uint32_t            Converting;       /*!< Strip conversion to MCUs on going */
+
+  __IO uint32_t            InPaused;         /*!< Codec input paused waiting for an MCU row */
+
+} JPEG_EncodeSourceTypeDef;
+/**
+  * @}
+  */
+#endif /* HAL_DMA2D_MODULE_ENABLED && USE_DMA2D_COMMAND_LIST_MODE == 0U */
+
 
 #if (USE_HAL_JPEG_REGISTER_CALLBACKS == 1)
 /** @defgroup HAL_JPEG_Callback_ID_enumeration_definition HAL JPEG Callback ID enumeration definition
@@ -514,6 +652,19 @@ HAL_StatusTypeDef  HAL_JPEG_Resume(JPEG_HandleTypeDef *hjpeg, uint32_t XferSelec
 void HAL_JPEG_ConfigInputBuffer(JPEG_HandleTypeDef *hjpeg, uint8_t *pNewInputBuffer, uint32_t InDataLength);
 void HAL_JPEG_ConfigOutputBuffer(JPEG_HandleTypeDef *hjpeg, uint8_t *pNewOutputBuffer, uint32_t OutDataLength);
 HAL_StatusTypeDef HAL_JPEG_Abort(JPEG_HandleTypeDef *hjpeg);
+#if defined(HAL_DMA2D_MODULE_ENABLED) && (USE_DMA2D_COMMAND_LIST_MODE == 0U)
+HAL_StatusTypeDef HAL_JPEG_Pipeline_Init(JPEG_HandleTypeDef *hjpeg, JPEG_PipelineTypeDef *pPipeline);
+HAL_StatusTypeDef HAL_JPEG_Pipeline_WriteInput(JPEG_HandleTypeDef *hjpeg, const uint8_t *pData, uint32_t Size,
+                                               uint32_t *pWritten);
+HAL_StatusTypeDef HAL_JPEG_Pipeline_EndOfInput(JPEG_HandleTypeDef *hjpeg);
+HAL_StatusTypeDef HAL_JPEG_Pipeline_Start(JPEG_HandleTypeDef *hjpeg);
+HAL_StatusTypeDef HAL_JPEG_Pipeline_Abort(JPEG_HandleTypeDef *hjpeg);
+HAL_StatusTypeDef HAL_JPEG_Pipeline_DeInit(JPEG_HandleTypeDef *hjpeg);
+HAL_StatusTypeDef HAL_JPEG_EncodeSource_Init(JPEG_HandleTypeDef *hjpeg, JPEG_EncodeSourceTypeDef *pSource);
+HAL_StatusTypeDef HAL_JPEG_EncodeSource_Start(JPEG_HandleTypeDef *hjpeg, uint8_t *pDataOut, uint32_t OutDataLength);
+HAL_StatusTypeDef HAL_JPEG_EncodeSource_Abort(JPEG_HandleTypeDef *hjpeg);
+HAL_StatusTypeDef HAL_JPEG_EncodeSource_DeInit(JPEG_HandleTypeDef *hjpeg);
+#endif /* HAL_DMA2D_MODULE_ENABLED && USE_DMA2D_COMMAND_LIST_MODE == 0U */
 
 /**
   * @}
@@ -43,6 +43,7 @@ extern "C" {
   * @{
   */
 #define MAX_LAYER  2U
+#define LTDC_SWAPCHAIN_MAX_BUFFERS  3U   /*!< Maximum number of frame buffers of a swap chain */
 
 /**
   * @brief  LTDC color structure definition
@@ -164,6 +165,25 @@ typedef struct
   LTDC_ColorTypeDef   Backcolor;       /*!< Configures the layer background color. */
 } LTDC_LayerCfgTypeDef;
 
+/**
+  * @brief  LTDC swap chain structure definition
+  */
+typedef struct
+{
+  uint32_t      BufferAddress[LTDC_SWAPCHAIN_MAX_BUFFERS]; /*!< Frame buffer addresses                       */
+
+  uint32_t      BufferCount;           /*!< Number of frame buffers, 2 (double) or 3 (triple buffering) */
+
+  uint32_t      LayerIdx;              /*!< LTDC layer displaying the frame buffers                      */
+
+  __IO uint32_t Front;                 /*!< Index of the displayed frame buffer                          */
+
+  __IO uint32_t Pending;               /*!< Index of the frame buffer queued for the next vertical
+                                            blanking, LTDC_SWAPCHAIN_NONE if none                       */
+
+  __IO uint32_t FreeMask;              /*!< Bit field of the frame buffers available for rendering       */
+} LTDC_SwapChainTypeDef;
+
 /**
   * @brief  HAL LTDC State structures definition
   */
@@ -179,11 +199,7 @@ typedef enum
 /**
   * @brief  LTDC handle Structure definition
   */
-#if (USE_HAL_LTDC_REGISTER_CALLBACKS == 1)
 typedef struct __LTDC_HandleTypeDef
-#else
-typedef struct
-#endif /* USE_HAL_LTDC_REGISTER_CALLBACKS */
 {
   LTDC_TypeDef                *Instance;                /*!< LTDC Register base address                */
 
@@ -205,8 +221,11 @@ typedef struct
   void (* MspInitCallback)(struct __LTDC_HandleTypeDef *hltdc);       /*!< LTDC Msp Init callback      */
   void (* MspDeInitCallback)(struct __LTDC_HandleTypeDef *hltdc);     /*!< LTDC Msp DeInit callback    */
 
+  /* LTDC Buffer Release Callback */
+  void (* BufferReleaseCallback)(struct __LTDC_HandleTypeDef *hltdc, uint32_t Address);
 #endif /* USE_HAL_LTDC_REGISTER_CALLBACKS */
 
+  LTDC_SwapChainTypeDef       *pSwapChain;              /*!< Swap chain of the handle, NULL if none    */
 
 } LTDC_HandleTypeDef;
 
@@ -230,6 +249,11 @@ typedef enum
   */
 typedef  void (*pLTDC_CallbackTypeDef)(LTDC_HandleTypeDef *hltdc);  /*!< pointer to an LTDC callback function */
 
+/**
+  * @brief  HAL LTDC Buffer Release Callback pointer definition
+  */
+typedef  void (*pLTDC_BufferReleaseCallbackTypeDef)(LTDC_HandleTypeDef *hltdc, uint32_t Address);
+
 #endif /* USE_HAL_LTDC_REGISTER_CALLBACKS */
 
 /**
@@ -241,6 +265,14 @@ typedef  void (*pLTDC_CallbackTypeDef)(LTDC_HandleTypeDef *hltdc);  /*!< pointer
   * @{
   */
 
+/** @defgroup LTDC_SwapChain_Buffer LTDC Swap Chain Buffer
+  * @{
+  */
+#define LTDC_SWAPCHAIN_NONE               0xFFFFFFFFU               /*!< No frame buffer */
+/**
+  * @}
+  */
+
 /** @defgroup LTDC_Error_Code LTDC Error Code
   * @{
   */
@@ -559,12 +591,16 @@ void HAL_LTDC_MspDeInit(LTDC_HandleTypeDef *hltdc);
 void HAL_LTDC_ErrorCallback(LTDC_HandleTypeDef *hltdc);
 void HAL_LTDC_LineEventCallback(LTDC_HandleTypeDef *hltdc);
 void HAL_LTDC_ReloadEventCallback(LTDC_HandleTypeDef *hltdc);
+void HAL_LTDC_BufferReleaseCallback(LTDC_HandleTypeDef *hltdc, uint32_t Address);
 
 /* Callbacks Register/UnRegister functions  ***********************************/
 #if (USE_HAL_LTDC_REGISTER_CALLBACKS == 1)
 HAL_StatusTypeDef HAL_LTDC_RegisterCallback(LTDC_HandleTypeDef *hltdc, HAL_LTDC_CallbackIDTypeDef CallbackID,
                                             pLTDC_CallbackTypeDef pCallback);
 HAL_StatusTypeDef HAL_LTDC_UnRegisterCallback(LTDC_HandleTypeDef *hltdc, HAL_LTDC_CallbackIDTypeDef CallbackID);
+HAL_StatusTypeDef HAL_LTDC_RegisterBufferReleaseCallback(LTDC_HandleTypeDef *hltdc,
+                                                         pLTDC_BufferReleaseCallbackTypeDef pCallback);
+HAL_StatusTypeDef HAL_LTDC_UnRegisterBufferReleaseCallback(LTDC_HandleTypeDef *hltdc);
 #endif /* USE_HAL_LTDC_REGISTER_CALLBACKS */
 
 /**
@@ -617,6 +653,11 @@ HAL_StatusTypeDef HAL_LTDC_EnableColorKeying_NoReload(LTDC_HandleTypeDef *hltdc,
 HAL_StatusTypeDef HAL_LTDC_DisableColorKeying_NoReload(LTDC_HandleTypeDef *hltdc, uint32_t LayerIdx);
 HAL_StatusTypeDef HAL_LTDC_EnableCLUT_NoReload(LTDC_HandleTypeDef *hltdc, uint32_t LayerIdx);
 HAL_StatusTypeDef HAL_LTDC_DisableCLUT_NoReload(LTDC_HandleTypeDef *hltdc, uint32_t LayerIdx);
+HAL_StatusTypeDef HAL_LTDC_SwapChain_Init(LTDC_HandleTypeDef *hltdc, LTDC_SwapChainTypeDef *pSwapChain,
+                                          const uint32_t *pAddresses, uint32_t BufferCount, uint32_t LayerIdx);
+HAL_StatusTypeDef HAL_LTDC_SwapChain_Acquire(LTDC_HandleTypeDef *hltdc, uint32_t *pAddress);
+HAL_StatusTypeDef HAL_LTDC_SwapChain_Present(LTDC_HandleTypeDef *hltdc, uint32_t Address);
+HAL_StatusTypeDef HAL_LTDC_SwapChain_DeInit(LTDC_HandleTypeDef *hltdc);
 
 /**
   * @}
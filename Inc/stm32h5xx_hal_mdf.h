@@ -132,6 +132,9 @@ typedef struct
   DMA_HandleTypeDef         *hdma;      /*!< Pointer on DMA handler for acquisitions */
   __IO HAL_MDF_StateTypeDef  State;     /*!< MDF state */
   __IO uint32_t              ErrorCode; /*!< MDF error code */
+  __IO uint32_t              AcqSampleCount;  /*!< Samples of the completed DMA blocks since the
+                                                   acquisition start */
+  uint32_t                   AcqBlockSamples; /*!< Samples of the DMA buffer */
 #if (USE_HAL_MDF_REGISTER_CALLBACKS == 1)
   void (*OldCallback)(struct __MDF_HandleTypeDef *hmdf,
                       uint32_t Threshold);                        /*!< MDF out-off limit detector callback.
@@ -850,7 +853,12 @@ HAL_StatusTypeDef HAL_MDF_AcqStop_IT(MDF_HandleTypeDef *hmdf);
 HAL_StatusTypeDef HAL_MDF_AcqStart_DMA(MDF_HandleTypeDef *hmdf, const MDF_FilterConfigTypeDef *pFilterConfig,
                                        const MDF_DmaConfigTypeDef *pDmaConfig);
 HAL_StatusTypeDef HAL_MDF_AcqStop_DMA(MDF_HandleTypeDef *hmdf);
+HAL_StatusTypeDef HAL_MDF_AcqStart_MultiDMA(MDF_HandleTypeDef *const phmdf[], uint32_t NbFilters,
+                                            const MDF_FilterConfigTypeDef *pFilterConfig,
+                                            const MDF_DmaConfigTypeDef *pDmaConfig);
+HAL_StatusTypeDef HAL_MDF_AcqStop_MultiDMA(MDF_HandleTypeDef *const phmdf[], uint32_t NbFilters);
 HAL_StatusTypeDef HAL_MDF_GenerateTrgo(const MDF_HandleTypeDef *hmdf);
+uint32_t          HAL_MDF_GetAcqSampleCount(const MDF_HandleTypeDef *hmdf);
 HAL_StatusTypeDef HAL_MDF_SetDelay(MDF_HandleTypeDef *hmdf, uint32_t Delay);
 HAL_StatusTypeDef HAL_MDF_GetDelay(const MDF_HandleTypeDef *hmdf, uint32_t *pDelay);
 HAL_StatusTypeDef HAL_MDF_SetGain(MDF_HandleTypeDef *hmdf, int32_t Gain);
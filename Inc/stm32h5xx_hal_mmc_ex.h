@@ -51,6 +51,7 @@ extern "C" {
 #define MMC_DMALinkNodeTypeDef        SDMMC_DMALinkNodeTypeDef
 #define MMC_DMALinkNodeConfTypeDef    SDMMC_DMALinkNodeConfTypeDef
 #define MMC_DMALinkedListTypeDef      SDMMC_DMALinkedListTypeDef
+#define MMC_DMAIOVecTypeDef           SDMMC_DMAIOVecTypeDef
 /* ----------------- Linked Aliases ------------------------------------------*/
 #define HAL_MMCx_DMALinkedList_WriteCpltCallback HAL_MMC_TxCpltCallback
 #define HAL_MMCx_DMALinkedList_ReadCpltCallback  HAL_MMC_RxCpltCallback
@@ -58,6 +59,31 @@ extern "C" {
   * @}
   */
 
+/** @defgroup MMCEx_Exported_Types_Group2 Packed Write Structures
+  * @{
+  */
+typedef struct
+{
+  const uint8_t *pData;                  /*!< Pointer to the data of the individual write, word aligned   */
+
+  uint32_t BlockAdd;                     /*!< Block address of the individual write                       */
+
+  uint32_t NumberOfBlocks;               /*!< Number of blocks of the individual write                    */
+} MMC_PackedWriteEntryTypeDef;
+
+typedef struct
+{
+  uint32_t Header[MMC_BLOCKSIZE / 4U];   /*!< Packed command header block, built by the driver            */
+
+  MMC_DMALinkedListTypeDef LinkedList;   /*!< Linked list of the packed command, built by the driver      */
+
+  MMC_DMALinkNodeTypeDef *pNodes;        /*!< Pointer to an array of (number of entries + 1) linked list
+                                              nodes, provided by the user                                 */
+} MMC_PackedWriteTypeDef;
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -92,6 +118,32 @@ void HAL_MMCEx_Read_DMALnkLstBufCpltCallback(MMC_HandleTypeDef *hmmc);
 void HAL_MMCEx_Write_DMALnkLstBufCpltCallback(MMC_HandleTypeDef *hmmc);
 
 
+/**
+  * @}
+  */
+
+/** @defgroup MMCEx_Exported_Functions_Group2 Scatter-gather functions
+  * @{
+  */
+HAL_StatusTypeDef HAL_MMCEx_ReadBlocksIOVec_DMA(MMC_HandleTypeDef *hmmc, MMC_DMALinkedListTypeDef *pLinkedList,
+                                                MMC_DMALinkNodeTypeDef *pNodes, const MMC_DMAIOVecTypeDef *pIOVec,
+                                                uint32_t IOVecCount, uint32_t BlockAdd);
+HAL_StatusTypeDef HAL_MMCEx_WriteBlocksIOVec_DMA(MMC_HandleTypeDef *hmmc, MMC_DMALinkedListTypeDef *pLinkedList,
+                                                 MMC_DMALinkNodeTypeDef *pNodes, const MMC_DMAIOVecTypeDef *pIOVec,
+                                                 uint32_t IOVecCount, uint32_t BlockAdd);
+/**
+  * @}
+  */
+
+/** @defgroup MMCEx_Exported_Functions_Group3 Cache and packed commands functions
+  * @{
+  */
+HAL_StatusTypeDef HAL_MMCEx_GetCacheSize(const MMC_HandleTypeDef *hmmc, uint32_t *pCacheSize);
+HAL_StatusTypeDef HAL_MMCEx_ConfigCache(MMC_HandleTypeDef *hmmc, FunctionalState State, uint32_t Timeout);
+HAL_StatusTypeDef HAL_MMCEx_FlushCache(MMC_HandleTypeDef *hmmc, uint32_t Timeout);
+HAL_StatusTypeDef HAL_MMCEx_GetMaxPackedWrites(const MMC_HandleTypeDef *hmmc, uint32_t *pMaxPackedWrites);
+HAL_StatusTypeDef HAL_MMCEx_PackedWriteBlocks_DMA(MMC_HandleTypeDef *hmmc, MMC_PackedWriteTypeDef *pPacked,
+                                                  const MMC_PackedWriteEntryTypeDef *pEntries, uint32_t EntryCount);
 /**
   * @}
   */
@@ -107,6 +107,12 @@ typedef struct
                                               command (NAND_CMD_AREA_TRUE1) and before DATA reading sequence.
                                               This parameter could be ENABLE or DISABLE
                                               Please check the Read Mode sequence in the NAND device datasheet */
+
+  FunctionalState CacheReadEnable;       /*!< NAND read cache sequential mode used by the DMA multi-page read.
+                                              When enabled, the next page is loaded into the device cache
+                                              register while the current one is transferred.
+                                              This parameter could be ENABLE or DISABLE
+                                              Please check the Read Cache sequence in the NAND device datasheet */
 } NAND_DeviceConfigTypeDef;
 
 /**
@@ -128,10 +134,25 @@ typedef struct
 
   NAND_DeviceConfigTypeDef       Config;     /*!< NAND physical characteristic information structure    */
 
+  DMA_HandleTypeDef              *hdma;      /*!< Pointer DMA handler                                   */
+
+  const uint8_t                  *pXferBuffer; /*!< DMA page(s) transfer buffer                       */
+
+  uint32_t                       XferAddress; /*!< NAND raw address of the first transferred page      */
+
+  uint32_t                       XferPageCount; /*!< Number of pages of the DMA transfer               */
+
+  __IO uint32_t                  XferPageIdx; /*!< Index of the page being transferred                 */
+
+  uint32_t                       *pXferECC;  /*!< Per page ECC values, NULL when not used               */
+
 #if (USE_HAL_NAND_REGISTER_CALLBACKS == 1)
   void (* MspInitCallback)(struct __NAND_HandleTypeDef *hnand);               /*!< NAND Msp Init callback              */
   void (* MspDeInitCallback)(struct __NAND_HandleTypeDef *hnand);             /*!< NAND Msp DeInit callback            */
   void (* ItCallback)(struct __NAND_HandleTypeDef *hnand);                    /*!< NAND IT callback                    */
+  void (* ReadCpltCallback)(struct __NAND_HandleTypeDef *hnand);              /*!< NAND DMA Read Complete callback     */
+  void (* WriteCpltCallback)(struct __NAND_HandleTypeDef *hnand);             /*!< NAND DMA Write Complete callback    */
+  void (* ErrorCallback)(struct __NAND_HandleTypeDef *hnand);                 /*!< NAND DMA Error callback             */
 #endif /* USE_HAL_NAND_REGISTER_CALLBACKS */
 } NAND_HandleTypeDef;
 
@@ -143,7 +164,10 @@ typedef enum
 {
   HAL_NAND_MSP_INIT_CB_ID       = 0x00U,  /*!< NAND MspInit Callback ID          */
   HAL_NAND_MSP_DEINIT_CB_ID     = 0x01U,  /*!< NAND MspDeInit Callback ID        */
-  HAL_NAND_IT_CB_ID             = 0x02U   /*!< NAND IT Callback ID               */
+  HAL_NAND_IT_CB_ID             = 0x02U,  /*!< NAND IT Callback ID               */
+  HAL_NAND_READ_CPLT_CB_ID      = 0x03U,  /*!< NAND DMA Read Complete Callback ID  */
+  HAL_NAND_WRITE_CPLT_CB_ID     = 0x04U,  /*!< NAND DMA Write Complete Callback ID */
+  HAL_NAND_ERROR_CB_ID          = 0x05U   /*!< NAND DMA Error Callback ID        */
 } HAL_NAND_CallbackIDTypeDef;
 
 /**
@@ -202,6 +226,9 @@ void               HAL_NAND_MspInit(NAND_HandleTypeDef *hnand);
 void               HAL_NAND_MspDeInit(NAND_HandleTypeDef *hnand);
 void               HAL_NAND_IRQHandler(NAND_HandleTypeDef *hnand);
 void               HAL_NAND_ITCallback(NAND_HandleTypeDef *hnand);
+void               HAL_NAND_ReadCpltCallback(NAND_HandleTypeDef *hnand);
+void               HAL_NAND_WriteCpltCallback(NAND_HandleTypeDef *hnand);
+void               HAL_NAND_ErrorCallback(NAND_HandleTypeDef *hnand);
 
 /**
   * @}
@@ -223,6 +250,11 @@ HAL_StatusTypeDef  HAL_NAND_Read_SpareArea_8b(NAND_HandleTypeDef *hnand, const N
 HAL_StatusTypeDef  HAL_NAND_Write_SpareArea_8b(NAND_HandleTypeDef *hnand, const NAND_AddressTypeDef *pAddress,
                                                const uint8_t *pBuffer, uint32_t NumSpareAreaTowrite);
 
+HAL_StatusTypeDef  HAL_NAND_Read_Page_8b_DMA(NAND_HandleTypeDef *hnand, const NAND_AddressTypeDef *pAddress,
+                                             uint8_t *pBuffer, uint32_t NumPageToRead, uint32_t *pECC);
+HAL_StatusTypeDef  HAL_NAND_Write_Page_8b_DMA(NAND_HandleTypeDef *hnand, const NAND_AddressTypeDef *pAddress,
+                                              const uint8_t *pBuffer, uint32_t NumPageToWrite, uint32_t *pECC);
+
 HAL_StatusTypeDef  HAL_NAND_Read_Page_16b(NAND_HandleTypeDef *hnand, const NAND_AddressTypeDef *pAddress,
                                           uint16_t *pBuffer, uint32_t NumPageToRead);
 HAL_StatusTypeDef  HAL_NAND_Write_Page_16b(NAND_HandleTypeDef *hnand, const NAND_AddressTypeDef *pAddress,
@@ -290,6 +322,8 @@ uint32_t              HAL_NAND_Read_Status(const NAND_HandleTypeDef *hnand);
 #define NAND_CMD_AREA_B            ((uint8_t)0x01)
 #define NAND_CMD_AREA_C            ((uint8_t)0x50)
 #define NAND_CMD_AREA_TRUE1        ((uint8_t)0x30)
+#define NAND_CMD_READ_CACHE_SEQ    ((uint8_t)0x31)
+#define NAND_CMD_READ_CACHE_END    ((uint8_t)0x3F)
 
 #define NAND_CMD_WRITE0            ((uint8_t)0x80)
 #define NAND_CMD_WRITE_TRUE1       ((uint8_t)0x10)
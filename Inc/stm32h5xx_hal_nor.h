@@ -122,9 +122,27 @@ typedef struct
 
   uint32_t                      CommandSet;   /*!< NOR algorithm command set and control        */
 
+  DMA_HandleTypeDef             *hdma;        /*!< Pointer DMA handler                          */
+
+  uint32_t                      WriteBufferSize; /*!< NOR write buffer size in half-words, must be a
+                                                      power of 2. The default size of 32 half-words
+                                                      is used when 0                             */
+
+  const uint16_t                *pXferData;   /*!< Pointer to the buffered program data         */
+
+  uint32_t                      XferAddress;  /*!< NOR address of the buffered program chunk    */
+
+  __IO uint32_t                 XferCount;    /*!< Remaining half-words to program              */
+
+  uint32_t                      XferChunkSize; /*!< Half-words of the buffered program chunk    */
+
+  __IO uint32_t                 XferProgramming; /*!< Set while the chunk is programmed         */
+
 #if (USE_HAL_NOR_REGISTER_CALLBACKS == 1)
   void (* MspInitCallback)(struct __NOR_HandleTypeDef *hnor);               /*!< NOR Msp Init callback              */
   void (* MspDeInitCallback)(struct __NOR_HandleTypeDef *hnor);             /*!< NOR Msp DeInit callback            */
+  void (* ProgramCpltCallback)(struct __NOR_HandleTypeDef *hnor);           /*!< NOR Program Complete callback      */
+  void (* ErrorCallback)(struct __NOR_HandleTypeDef *hnor);                 /*!< NOR Error callback                 */
 #endif /* USE_HAL_NOR_REGISTER_CALLBACKS */
 } NOR_HandleTypeDef;
 
@@ -135,7 +153,9 @@ typedef struct
 typedef enum
 {
   HAL_NOR_MSP_INIT_CB_ID       = 0x00U,  /*!< NOR MspInit Callback ID          */
-  HAL_NOR_MSP_DEINIT_CB_ID     = 0x01U   /*!< NOR MspDeInit Callback ID        */
+  HAL_NOR_MSP_DEINIT_CB_ID     = 0x01U,  /*!< NOR MspDeInit Callback ID        */
+  HAL_NOR_PROGRAM_CPLT_CB_ID   = 0x02U,  /*!< NOR Program Complete Callback ID */
+  HAL_NOR_ERROR_CB_ID          = 0x03U   /*!< NOR Error Callback ID            */
 } HAL_NOR_CallbackIDTypeDef;
 
 /**
@@ -185,6 +205,8 @@ HAL_StatusTypeDef HAL_NOR_DeInit(NOR_HandleTypeDef *hnor);
 void HAL_NOR_MspInit(NOR_HandleTypeDef *hnor);
 void HAL_NOR_MspDeInit(NOR_HandleTypeDef *hnor);
 void HAL_NOR_MspWait(NOR_HandleTypeDef *hnor, uint32_t Timeout);
+void HAL_NOR_ProgramCpltCallback(NOR_HandleTypeDef *hnor);
+void HAL_NOR_ErrorCallback(NOR_HandleTypeDef *hnor);
 /**
   * @}
   */
@@ -203,6 +225,9 @@ HAL_StatusTypeDef HAL_NOR_ReadBuffer(NOR_HandleTypeDef *hnor, uint32_t uwAddress
                                      uint32_t uwBufferSize);
 HAL_StatusTypeDef HAL_NOR_ProgramBuffer(NOR_HandleTypeDef *hnor, uint32_t uwAddress, uint16_t *pData,
                                         uint32_t uwBufferSize);
+HAL_StatusTypeDef HAL_NOR_ProgramBuffer_DMA(NOR_HandleTypeDef *hnor, uint32_t uwAddress, const uint16_t *pData,
+                                            uint32_t uwBufferSize);
+void              HAL_NOR_ReadyIRQHandler(NOR_HandleTypeDef *hnor);
 
 HAL_StatusTypeDef HAL_NOR_Erase_Block(NOR_HandleTypeDef *hnor, uint32_t BlockAddress, uint32_t Address);
 HAL_StatusTypeDef HAL_NOR_Erase_Chip(NOR_HandleTypeDef *hnor, uint32_t Address);
@@ -265,6 +290,9 @@ HAL_NOR_StatusTypeDef HAL_NOR_GetStatus(NOR_HandleTypeDef *hnor, uint32_t Addres
 /* NOR operation wait timeout */
 #define NOR_TMEOUT               ((uint16_t)0xFFFF)
 
+/* NOR default write buffer size in half-words */
+#define NOR_WRITE_BUFFER_SIZE    (32U)
+
 /* NOR memory data width */
 #define NOR_MEMORY_8B            ((uint8_t)0x00)
 #define NOR_MEMORY_16B           ((uint8_t)0x01)
@@ -36,6 +36,44 @@ extern "C" {
   * @{
   */
 /* Exported types ----------------------------------------------------------------------------------------------------*/
+#if defined(HAL_ADC_MODULE_ENABLED)
+/** @defgroup OPAMPEx_Exported_Types OPAMPEx Exported Types
+  * @{
+  */
+
+/**
+  * @brief  OPAMP PGA auto-ranging structure definition
+  */
+typedef struct
+{
+  ADC_HandleTypeDef         *hadc;                /*!< ADC handle converting the OPAMP output                        */
+
+  ADC_AnalogWDGConfTypeDef  AWDConfig;            /*!< ADC analog watchdog monitoring the OPAMP output channel.
+                                                       The gain is halved above HighThreshold and doubled below
+                                                       LowThreshold, which must be lower than HighThreshold / 2.
+                                                       ITMode is set by HAL_OPAMPEx_AutoRange_Start()             */
+
+  uint32_t                  MinGain;              /*!< Lowest PGA gain.
+                                                       This parameter must be a value of @ref OPAMP_PgaGain       */
+
+  uint32_t                  MaxGain;              /*!< Highest PGA gain.
+                                                       This parameter must be a value of @ref OPAMP_PgaGain       */
+
+  uint32_t                  SettlingConversions;  /*!< Number of conversions discarded after a gain switch, covering
+                                                       the conversion on going and the OPAMP settling time        */
+
+  __IO uint32_t             Gain;                 /*!< Current PGA gain, value of @ref OPAMP_PgaGain              */
+
+  __IO uint32_t             SettlingCount;        /*!< Number of conversions left to discard                      */
+
+  uint32_t                  SwitchCount;          /*!< Number of gain switches since the auto-ranging start       */
+} OPAMPEx_AutoRangeTypeDef;
+
+/**
+  * @}
+  */
+#endif /* HAL_ADC_MODULE_ENABLED */
+
 /* Exported constants ------------------------------------------------------------------------------------------------*/
 /* Exported macro ----------------------------------------------------------------------------------------------------*/
 /* Exported functions ------------------------------------------------------------------------------------------------*/
@@ -52,6 +90,22 @@ HAL_StatusTypeDef HAL_OPAMPEx_Unlock(OPAMP_HandleTypeDef *hopamp);
   * @}
   */
 
+#if defined(HAL_ADC_MODULE_ENABLED)
+/* PGA auto-ranging functions */
+/** @addtogroup OPAMPEx_Exported_Functions_Group2
+  * @{
+  */
+HAL_StatusTypeDef HAL_OPAMPEx_AutoRange_Start(OPAMP_HandleTypeDef *hopamp, OPAMPEx_AutoRangeTypeDef *pRange);
+HAL_StatusTypeDef HAL_OPAMPEx_AutoRange_Stop(OPAMP_HandleTypeDef *hopamp, OPAMPEx_AutoRangeTypeDef *pRange);
+HAL_StatusTypeDef HAL_OPAMPEx_AutoRange_Process(OPAMP_HandleTypeDef *hopamp, OPAMPEx_AutoRangeTypeDef *pRange,
+                                                uint32_t AdcValue);
+HAL_StatusTypeDef HAL_OPAMPEx_AutoRange_Convert(OPAMPEx_AutoRangeTypeDef *pRange, uint32_t AdcValue,
+                                                uint32_t *pValue);
+/**
+  * @}
+  */
+#endif /* HAL_ADC_MODULE_ENABLED */
+
 /**
   * @}
   */
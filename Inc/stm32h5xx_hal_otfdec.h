@@ -129,6 +129,73 @@ typedef  void (*pOTFDEC_CallbackTypeDef)(OTFDEC_HandleTypeDef *hotfdec); /*!< po
   * @}
   */
 
+#if defined(HAL_ICACHE_MODULE_ENABLED) && defined(ICACHE_CRRx_REN)
+/** @defgroup OTFDEC_Exported_Types_Group3 OTFDEC encrypted execute-in-place definitions
+  * @{
+  */
+
+/**
+  * @brief OTFDEC encrypted firmware slot structure definition
+  */
+typedef struct
+{
+  uint32_t                   RegionIndex;  /*!< OTFDEC region deciphering the slot, a region per slot keeps
+                                                its key loaded across the slot switches                      */
+
+  uint32_t                   Mode;         /*!< Region deciphering mode, value of
+                                                @ref OTFDEC_Region_Operating_Mode                            */
+
+  uint32_t                   *pKey;        /*!< Slot key, 4 words */
+
+  OTFDEC_RegionConfigTypeDef Config;       /*!< Nonce, external memory start and end addresses and firmware
+                                                version of the slot. The start address is aligned on the
+                                                ICACHE remap region size                                     */
+} OTFDEC_XIPSlotTypeDef;
+
+/**
+  * @brief OTFDEC encrypted execute-in-place structure definition
+  */
+typedef struct
+{
+  OTFDEC_HandleTypeDef        *hotfdec;         /*!< OTFDEC handle (user)                                     */
+
+  const OTFDEC_XIPSlotTypeDef *pSlots;          /*!< Firmware slots (user)                                    */
+
+  uint32_t                    NbSlots;          /*!< Number of firmware slots (user)                          */
+
+  uint32_t                    ExecAddress;      /*!< Code address the active slot is executed from (user)     */
+
+  uint32_t                    OutputBurstType;  /*!< ICACHE output burst type, value of
+                                                     @ref ICACHE_Output_Burst_Type (user)                     */
+
+  uint32_t                    ActiveSlot;       /*!< Active slot, OTFDEC_XIP_NO_SLOT when none                */
+
+  uint32_t                    CacheRegion;      /*!< ICACHE remap region of the active slot                   */
+
+  uint32_t                    RegionSlot[4];    /*!< Slot whose key is loaded in each OTFDEC region           */
+
+  uint32_t                    NbKeyLoads;       /*!< Number of region key and configuration loads             */
+} OTFDEC_XIPTypeDef;
+
+/**
+  * @brief OTFDEC execute-in-place fetch benchmark structure definition
+  */
+typedef struct
+{
+  uint32_t ColdCycles;      /*!< CPU cycles to read the area from the memory, cache invalidated  */
+
+  uint32_t WarmCycles;      /*!< CPU cycles to read the area a second time                       */
+
+  uint32_t ColdThroughput;  /*!< Read throughput from the memory in KB/s                         */
+
+  uint32_t Checksum;        /*!< Sum of the words read, to compare with the plain firmware       */
+} OTFDEC_XIPBenchmarkTypeDef;
+
+/**
+  * @}
+  */
+#endif /* HAL_ICACHE_MODULE_ENABLED && ICACHE_CRRx_REN */
+
 /**
   * @}
   */
@@ -179,6 +246,14 @@ typedef  void (*pOTFDEC_CallbackTypeDef)(OTFDEC_HandleTypeDef *hotfdec); /*!< po
   * @}
   */
 
+/** @defgroup OTFDEC_XIP_Slot   OTFDEC Execute-In-Place Slot
+  * @{
+  */
+#define OTFDEC_XIP_NO_SLOT         0xFFFFFFFFU                   /*!< No slot active or loaded */
+/**
+  * @}
+  */
+
 /** @defgroup OTFDEC_Error_Definition   OTFDEC Error Definition
   * @{
   */
@@ -374,6 +449,18 @@ HAL_StatusTypeDef HAL_OTFDEC_RegionGetConfig(OTFDEC_HandleTypeDef *hotfdec, uint
   * @}
   */
 
+#if defined(HAL_ICACHE_MODULE_ENABLED) && defined(ICACHE_CRRx_REN)
+/** @addtogroup OTFDEC_Exported_Functions_Group5 Encrypted execute-in-place functions
+  * @{
+  */
+HAL_StatusTypeDef HAL_OTFDEC_XIP_Init(OTFDEC_XIPTypeDef *pXIP);
+HAL_StatusTypeDef HAL_OTFDEC_XIP_Activate(OTFDEC_XIPTypeDef *pXIP, uint32_t Slot);
+HAL_StatusTypeDef HAL_OTFDEC_XIP_Benchmark(uint32_t Address, uint32_t Size, OTFDEC_XIPBenchmarkTypeDef *pResult);
+/**
+  * @}
+  */
+#endif /* HAL_ICACHE_MODULE_ENABLED && ICACHE_CRRx_REN */
+
 /**
   * @}
   */
@@ -89,6 +89,53 @@ typedef USB_OTG_EPTypeDef      PCD_EPTypeDef;
 typedef USB_DRD_TypeDef        PCD_TypeDef;
 typedef USB_DRD_CfgTypeDef     PCD_InitTypeDef;
 typedef USB_DRD_EPTypeDef      PCD_EPTypeDef;
+
+/**
+  * @brief  PCD endpoint stream buffer structure definition
+  */
+typedef struct
+{
+  uint8_t  *pBuffer;     /*!< Buffer to transmit or to receive into             */
+  uint32_t Length;       /*!< Bytes to transmit, or size of the reception buffer */
+  uint32_t XferCount;    /*!< Bytes transferred, updated on completion          */
+} PCD_EPStreamBufferTypeDef;
+
+/**
+  * @brief  PCD endpoint stream structure definition
+  */
+typedef struct
+{
+  PCD_EPStreamBufferTypeDef *pBuffers;  /*!< User ring of BufferCount buffers          */
+  uint32_t      BufferCount;            /*!< Number of entries of the ring             */
+  __IO uint32_t Head;                   /*!< Number of buffers queued                  */
+  __IO uint32_t Done;                   /*!< Number of buffers transferred             */
+  __IO uint32_t Tail;                   /*!< Number of buffers retrieved               */
+  __IO uint32_t Busy;                   /*!< Transfer of the buffer Done ongoing       */
+} PCD_EPStreamTypeDef;
+
+#if (USE_HAL_PCD_STATISTICS == 1U)
+/**
+  * @brief  PCD endpoint statistics structure definition
+  */
+typedef struct
+{
+  uint32_t XferCount;      /*!< Number of completed transfers                            */
+  uint32_t XferBytes;      /*!< Number of bytes of the transferred packets               */
+  uint32_t PacketCount;    /*!< Number of packets transferred (correct transfer events)  */
+} PCD_EPStatsTypeDef;
+
+/**
+  * @brief  PCD device statistics structure definition
+  */
+typedef struct
+{
+  uint32_t PMAOverrunCount;  /*!< Number of packet memory over/underruns                    */
+  uint32_t ErrorCount;       /*!< Number of bus errors (CRC, bit stuffing, timeout)        */
+  uint32_t MissedSOFCount;   /*!< Number of expected SOF not received                      */
+  uint32_t EPISRCyclesMax;   /*!< Maximum DWT cycles servicing the endpoint interrupts,
+                                  callbacks included                                       */
+} PCD_StatsTypeDef;
+#endif /* USE_HAL_PCD_STATISTICS */
 #endif /* defined (USB_DRD_FS) */
 
 /**
@@ -125,6 +172,16 @@ typedef struct
   uint32_t battery_charging_active;    /*!< Enable or disable Battery charging.
                                        This parameter can be set to ENABLE or DISABLE        */
   void                    *pData;      /*!< Pointer to upper stack Handler */
+#if defined (USB_DRD_FS)
+  PCD_EPStreamTypeDef     *pINStream[8];  /*!< IN endpoints streams, NULL when not used  */
+  PCD_EPStreamTypeDef     *pOUTStream[8]; /*!< OUT endpoints streams, NULL when not used */
+  uint16_t                PMAFreeAddr;    /*!< Next free PMA address of HAL_PCDEx_PMAlloc() */
+#if (USE_HAL_PCD_STATISTICS == 1U)
+  PCD_EPStatsTypeDef      INStats[8];     /*!< IN endpoints statistics              */
+  PCD_EPStatsTypeDef      OUTStats[8];    /*!< OUT endpoints statistics             */
+  PCD_StatsTypeDef        Stats;          /*!< Device statistics                    */
+#endif /* USE_HAL_PCD_STATISTICS */
+#endif /* defined (USB_DRD_FS) */
 
 #if (USE_HAL_PCD_REGISTER_CALLBACKS == 1U)
   void (* SOFCallback)(struct __PCD_HandleTypeDef *hpcd);                              /*!< USB OTG PCD SOF callback                */
@@ -355,6 +412,13 @@ HAL_StatusTypeDef HAL_PCD_EP_Open(PCD_HandleTypeDef *hpcd, uint8_t ep_addr, uint
 HAL_StatusTypeDef HAL_PCD_EP_Close(PCD_HandleTypeDef *hpcd, uint8_t ep_addr);
 HAL_StatusTypeDef HAL_PCD_EP_Receive(PCD_HandleTypeDef *hpcd, uint8_t ep_addr, uint8_t *pBuf, uint32_t len);
 HAL_StatusTypeDef HAL_PCD_EP_Transmit(PCD_HandleTypeDef *hpcd, uint8_t ep_addr, uint8_t *pBuf, uint32_t len);
+#if defined (USB_DRD_FS)
+HAL_StatusTypeDef HAL_PCD_EP_StreamStart(PCD_HandleTypeDef *hpcd, uint8_t ep_addr, PCD_EPStreamTypeDef *pStream,
+                                         PCD_EPStreamBufferTypeDef *pBuffers, uint32_t BufferCount);
+HAL_StatusTypeDef HAL_PCD_EP_StreamQueue(PCD_HandleTypeDef *hpcd, uint8_t ep_addr, uint8_t *pBuf, uint32_t len);
+HAL_StatusTypeDef HAL_PCD_EP_StreamGet(PCD_HandleTypeDef *hpcd, uint8_t ep_addr, uint8_t **ppBuf, uint32_t *pLen);
+HAL_StatusTypeDef HAL_PCD_EP_StreamStop(PCD_HandleTypeDef *hpcd, uint8_t ep_addr);
+#endif /* defined (USB_DRD_FS) */
 HAL_StatusTypeDef HAL_PCD_EP_SetStall(PCD_HandleTypeDef *hpcd, uint8_t ep_addr);
 HAL_StatusTypeDef HAL_PCD_EP_ClrStall(PCD_HandleTypeDef *hpcd, uint8_t ep_addr);
 HAL_StatusTypeDef HAL_PCD_EP_Flush(PCD_HandleTypeDef *hpcd, uint8_t ep_addr);
@@ -53,6 +53,14 @@ HAL_StatusTypeDef HAL_PCDEx_SetRxFiFo(PCD_HandleTypeDef *hpcd, uint16_t size);
 #if defined (USB_DRD_FS)
 HAL_StatusTypeDef  HAL_PCDEx_PMAConfig(PCD_HandleTypeDef *hpcd, uint16_t ep_addr,
                                        uint16_t ep_kind, uint32_t pmaadress);
+HAL_StatusTypeDef  HAL_PCDEx_PMAlloc(PCD_HandleTypeDef *hpcd, uint16_t ep_addr,
+                                     uint16_t ep_kind, uint16_t mps);
+HAL_StatusTypeDef  HAL_PCDEx_PMAReset(PCD_HandleTypeDef *hpcd);
+#if (USE_HAL_PCD_STATISTICS == 1U)
+HAL_StatusTypeDef  HAL_PCDEx_GetEPStats(PCD_HandleTypeDef const *hpcd, uint8_t ep_addr, PCD_EPStatsTypeDef *pStats);
+HAL_StatusTypeDef  HAL_PCDEx_GetStats(PCD_HandleTypeDef const *hpcd, PCD_StatsTypeDef *pStats);
+HAL_StatusTypeDef  HAL_PCDEx_ResetStats(PCD_HandleTypeDef *hpcd);
+#endif /* USE_HAL_PCD_STATISTICS */
 #endif /* defined (USB_DRD_FS) */
 
 HAL_StatusTypeDef HAL_PCDEx_ActivateLPM(PCD_HandleTypeDef *hpcd);
@@ -113,6 +113,25 @@ typedef struct
   __IO uint32_t                 primeordersize;         /*!< Elliptic curve prime order length */
   __IO uint32_t                 opsize;                 /*!< Modular exponentiation operand length */
   __IO uint32_t                 modulussize;            /*!< Elliptic curve modulus length */
+  const struct __PKA_ECDSAVerifCurveTypeDef *pECDSAVerifCurve; /*!< ECDSA verification curve loaded in PKA RAM,
+                                                                    NULL if none */
+  const uint8_t                 *pECDSAVerifPubKeyX;    /*!< Public key xQ loaded in PKA RAM with the curve,
+                                                             NULL if none */
+  const uint8_t                 *pECDSAVerifPubKeyY;    /*!< Public key yQ loaded in PKA RAM with the curve,
+                                                             NULL if none */
+  struct __PKA_ECDSAVerifOperandTypeDef *pECDSAVerifBatch;     /*!< ECDSA verification batch processed in
+                                                                    interrupt mode, NULL if none */
+  uint32_t                      ECDSAVerifBatchNbr;     /*!< Number of ECDSA verifications in the batch */
+  __IO uint32_t                 ECDSAVerifBatchIndex;   /*!< Index of the ECDSA verification being processed */
+  struct __PKA_MontgomeryCacheEntryTypeDef *pMontgomeryCache; /*!< Montgomery parameter cache entries, NULL if
+                                                                   no cache is configured */
+  uint32_t                      MontgomeryCacheSize;    /*!< Number of Montgomery parameter cache entries */
+  uint32_t                      MontgomeryCacheNext;    /*!< Next Montgomery parameter cache entry to replace */
+  struct __PKA_RSACRTExpRequestTypeDef *pRSACRTQueueHead; /*!< RSA CRT exponentiation queue processed in
+                                                                 interrupt mode, NULL if empty */
+  struct __PKA_RSACRTExpRequestTypeDef *pRSACRTQueueTail; /*!< Last request of the RSA CRT exponentiation queue */
+  __IO uint32_t                 RSACRTQueueActive;      /*!< Head of the RSA CRT exponentiation queue is being
+                                                             processed */
 #if (USE_HAL_PKA_REGISTER_CALLBACKS == 1)
   void (* OperationCpltCallback)(struct __PKA_HandleTypeDef *hpka); /*!< PKA End of operation callback */
   void (* ErrorCallback)(struct __PKA_HandleTypeDef *hpka);         /*!< PKA Error callback            */
@@ -191,6 +210,17 @@ typedef struct
   const uint8_t *popA;                 /*!< Pointer to operand A    (Array of size elements) */
 } PKA_RSACRTExpInTypeDef;
 
+typedef struct __PKA_RSACRTExpRequestTypeDef
+{
+  PKA_RSACRTExpInTypeDef *pIn;         /*!< Pointer to the RSA CRT exponentiation input information */
+  uint8_t *pRes;                       /*!< Pointer to the result buffer (Array of pIn->size elements) */
+  void (* CpltCallback)(struct __PKA_RSACRTExpRequestTypeDef *pReq); /*!< Request completion callback, called
+                                                                            from the PKA interrupt, may be NULL */
+  void *pContext;                      /*!< User context, not used by the driver */
+  __IO HAL_StatusTypeDef Status;       /*!< HAL_BUSY while queued, then HAL_OK or HAL_ERROR */
+  struct __PKA_RSACRTExpRequestTypeDef *pNext; /*!< Next queued request, managed by the driver */
+} PKA_RSACRTExpRequestTypeDef;
+
 typedef struct
 {
   uint32_t primeOrderSize;             /*!< Number of element in primeOrder array */
@@ -208,6 +238,28 @@ typedef struct
   const uint8_t *primeOrder;           /*!< Pointer to order of the curve n      (Array of primeOrderSize elements) */
 } PKA_ECDSAVerifInTypeDef;
 
+typedef struct __PKA_ECDSAVerifCurveTypeDef
+{
+  uint32_t primeOrderSize;             /*!< Number of element in primeOrder array */
+  uint32_t modulusSize;                /*!< Number of element in modulus array */
+  uint32_t coefSign;                   /*!< Curve coefficient a sign */
+  const uint8_t *coef;                 /*!< Pointer to curve coefficient |a|     (Array of modulusSize elements) */
+  const uint8_t *modulus;              /*!< Pointer to curve modulus value p     (Array of modulusSize elements) */
+  const uint8_t *basePointX;           /*!< Pointer to curve base point xG       (Array of modulusSize elements) */
+  const uint8_t *basePointY;           /*!< Pointer to curve base point yG       (Array of modulusSize elements) */
+  const uint8_t *primeOrder;           /*!< Pointer to order of the curve n      (Array of primeOrderSize elements) */
+} PKA_ECDSAVerifCurveTypeDef;
+
+typedef struct __PKA_ECDSAVerifOperandTypeDef
+{
+  const uint8_t *pPubKeyCurvePtX;      /*!< Pointer to public-key curve point xQ (Array of modulusSize elements) */
+  const uint8_t *pPubKeyCurvePtY;      /*!< Pointer to public-key curve point yQ (Array of modulusSize elements) */
+  const uint8_t *RSign;                /*!< Pointer to signature part r          (Array of primeOrderSize elements) */
+  const uint8_t *SSign;                /*!< Pointer to signature part s          (Array of primeOrderSize elements) */
+  const uint8_t *hash;                 /*!< Pointer to hash of the message e     (Array of primeOrderSize elements) */
+  uint32_t ValidSignature;             /*!< Output of a batch verification: 1 if signature is verified, 0 otherwise */
+} PKA_ECDSAVerifOperandTypeDef;
+
 typedef struct
 {
   uint32_t primeOrderSize;             /*!< Number of element in primeOrder array */
@@ -279,6 +331,16 @@ typedef struct
   const uint8_t *pOp1;                 /*!< Pointer to Operand (Array of size elements) */
 } PKA_MontgomeryParamInTypeDef;
 
+typedef struct __PKA_MontgomeryCacheEntryTypeDef
+{
+  uint32_t *pMontgomeryParam;          /*!< Pointer to the Montgomery parameter buffer, provided by the user */
+  uint32_t bufferSize;                 /*!< Number of words of the pMontgomeryParam buffer */
+  const uint8_t *pMod;                 /*!< Pointer to the cached modulus, managed by the HAL */
+  uint32_t modSize;                    /*!< Number of element in pMod array, managed by the HAL */
+  uint32_t key;                        /*!< Hash of the cached modulus, managed by the HAL */
+  uint32_t valid;                      /*!< 1 if the entry holds a Montgomery parameter, managed by the HAL */
+} PKA_MontgomeryCacheEntryTypeDef;
+
 typedef struct
 {
   uint32_t size;                       /*!< Number of element in pOp1 and pOp2 arrays */
@@ -582,9 +644,16 @@ void HAL_PKA_ECDSASign_GetResult(PKA_HandleTypeDef *hpka, PKA_ECDSASignOutTypeDe
 HAL_StatusTypeDef HAL_PKA_ECDSAVerif(PKA_HandleTypeDef *hpka, PKA_ECDSAVerifInTypeDef *in, uint32_t Timeout);
 HAL_StatusTypeDef HAL_PKA_ECDSAVerif_IT(PKA_HandleTypeDef *hpka, PKA_ECDSAVerifInTypeDef *in);
 uint32_t HAL_PKA_ECDSAVerif_IsValidSignature(PKA_HandleTypeDef const *const hpka);
+HAL_StatusTypeDef HAL_PKA_ECDSAVerif_LoadCurve(PKA_HandleTypeDef *hpka, const PKA_ECDSAVerifCurveTypeDef *curve);
+HAL_StatusTypeDef HAL_PKA_ECDSAVerifCtx(PKA_HandleTypeDef *hpka, const PKA_ECDSAVerifOperandTypeDef *in,
+                                        uint32_t Timeout);
+HAL_StatusTypeDef HAL_PKA_ECDSAVerifCtx_IT(PKA_HandleTypeDef *hpka, const PKA_ECDSAVerifOperandTypeDef *in);
+HAL_StatusTypeDef HAL_PKA_ECDSAVerifBatch_IT(PKA_HandleTypeDef *hpka, PKA_ECDSAVerifOperandTypeDef *in,
+                                             uint32_t Nbr);
 
 HAL_StatusTypeDef HAL_PKA_RSACRTExp(PKA_HandleTypeDef *hpka, PKA_RSACRTExpInTypeDef *in, uint32_t Timeout);
 HAL_StatusTypeDef HAL_PKA_RSACRTExp_IT(PKA_HandleTypeDef *hpka, PKA_RSACRTExpInTypeDef *in);
+HAL_StatusTypeDef HAL_PKA_RSACRTExp_Submit_IT(PKA_HandleTypeDef *hpka, PKA_RSACRTExpRequestTypeDef *pReq);
 void HAL_PKA_RSACRTExp_GetResult(PKA_HandleTypeDef *hpka, uint8_t *pRes);
 
 HAL_StatusTypeDef HAL_PKA_PointCheck(PKA_HandleTypeDef *hpka, PKA_PointCheckInTypeDef *in, uint32_t Timeout);
@@ -620,6 +689,12 @@ void HAL_PKA_Arithmetic_GetResult(PKA_HandleTypeDef *hpka, uint32_t *pRes);
 HAL_StatusTypeDef HAL_PKA_MontgomeryParam(PKA_HandleTypeDef *hpka, PKA_MontgomeryParamInTypeDef *in, uint32_t Timeout);
 HAL_StatusTypeDef HAL_PKA_MontgomeryParam_IT(PKA_HandleTypeDef *hpka, PKA_MontgomeryParamInTypeDef *in);
 void HAL_PKA_MontgomeryParam_GetResult(PKA_HandleTypeDef *hpka, uint32_t *pRes);
+HAL_StatusTypeDef HAL_PKA_MontgomeryCache_Config(PKA_HandleTypeDef *hpka, PKA_MontgomeryCacheEntryTypeDef *pEntries,
+                                                 uint32_t Nbr);
+void HAL_PKA_MontgomeryCache_Invalidate(PKA_HandleTypeDef *hpka, const uint8_t *pMod, uint32_t modSize);
+HAL_StatusTypeDef HAL_PKA_MontgomeryCache_Get(PKA_HandleTypeDef *hpka, const uint8_t *pMod, uint32_t modSize,
+                                              const uint32_t **ppMontgomeryParam, uint32_t Timeout);
+HAL_StatusTypeDef HAL_PKA_ModExpFastModeCached(PKA_HandleTypeDef *hpka, PKA_ModExpInTypeDef *in, uint32_t Timeout);
 
 HAL_StatusTypeDef HAL_PKA_ECCDoubleBaseLadder(PKA_HandleTypeDef *hpka, PKA_ECCDoubleBaseLadderInTypeDef *in,
                                               uint32_t Timeout);
@@ -637,6 +637,84 @@ typedef struct
   uint32_t            lut_output; /*!< Lookup table output, one of @ref PLAY_LookUp_Table_Output */
 } HAL_PLAY_OUT_ConfTypeDef;
 
+/**
+  * @brief  PLAY Netlist: complete logic function made of inputs, lookup tables and outputs
+  */
+typedef struct
+{
+  const HAL_PLAY_IN_ConfTypeDef  *p_input;    /*!< Input multiplexer configurations, NULL if none  */
+  uint32_t                       input_nbr;   /*!< Number of input multiplexer configurations      */
+  const HAL_PLAY_LUT_ConfTypeDef *p_lut;      /*!< Lookup table configurations, NULL if none       */
+  uint32_t                       lut_nbr;     /*!< Number of lookup table configurations           */
+  const HAL_PLAY_OUT_ConfTypeDef *p_output;   /*!< Output multiplexer configurations, NULL if none */
+  uint32_t                       output_nbr;  /*!< Number of output multiplexer configurations     */
+} HAL_PLAY_NetlistTypeDef;
+
+/**
+  * @brief  PLAY compiled configuration: register values of a netlist, built by HAL_PLAY_CompileNetlist()
+  */
+typedef struct
+{
+  uint32_t in_mask;                  /*!< Input multiplexers set by the netlist, bit n for input n   */
+  uint32_t lut_mask;                 /*!< Lookup tables set by the netlist, bit n for lookup table n */
+  uint32_t out_mask;                 /*!< Output multiplexers set by the netlist, bit n for output n */
+  uint32_t filtcfg[LL_PLAY_IN_MAX];  /*!< FILTxCFG register values                                   */
+  uint32_t lecfg1[LL_PLAY_LUT_MAX];  /*!< LExCFG1 register values                                    */
+  uint32_t lecfg2[LL_PLAY_LUT_MAX];  /*!< LExCFG2 register values                                    */
+  uint32_t outcfg[LL_PLAY_OUT_MAX];  /*!< OUTxCFG register values                                    */
+} HAL_PLAY_CompiledConfTypeDef;
+
+/**
+  * @brief  PLAY ready-made logic function enumeration
+  */
+typedef enum
+{
+  HAL_PLAY_FUNCTION_DEBOUNCE      = 0U, /*!< Filtered copy of input A, pulses shorter than the minimum width
+                                             removed. Uses 1 lookup table                                    */
+  HAL_PLAY_FUNCTION_QUADRATURE    = 1U, /*!< Quadrature decoder of inputs A and B: step pulse on each edge
+                                             (x4) and direction level. Uses 4 lookup tables                  */
+  HAL_PLAY_FUNCTION_PULSE_STRETCH = 2U, /*!< Input A pulse held until cleared by input B or by a software
+                                             trigger. Uses 1 lookup table                                    */
+  HAL_PLAY_FUNCTION_COINCIDENCE   = 3U, /*!< Inputs A and B active at the same time. Uses 1 lookup table    */
+} HAL_PLAY_FunctionTypeDef;
+
+/**
+  * @brief  PLAY ready-made logic function Configuration structure
+  */
+typedef struct
+{
+  HAL_PLAY_FunctionTypeDef  function;        /*!< Logic function                                                 */
+  HAL_PLAY_IN_SourceTypeDef source_a;        /*!< Input A signal source (GPIO, timer, ...)                       */
+  HAL_PLAY_IN_SourceTypeDef source_b;        /*!< Input B signal source. HAL_PLAY_IN_SOURCE_INVALID for
+                                                  HAL_PLAY_FUNCTION_DEBOUNCE, and for
+                                                  HAL_PLAY_FUNCTION_PULSE_STRETCH cleared by software trigger    */
+  uint32_t                  min_pulse_width; /*!< Minimum pulse width of the inputs. Value in range 0x00 to 0xFF */
+  HAL_PLAY_LUTTypeDef       first_lut;       /*!< First of the consecutive lookup tables used by the function.
+                                                  A multiple of 4 for HAL_PLAY_FUNCTION_QUADRATURE               */
+  uint32_t                  sw_trigger;      /*!< Software trigger clearing HAL_PLAY_FUNCTION_PULSE_STRETCH when
+                                                  source_b is not used, one of @ref PLAY_Software_Trigger_ID     */
+  FunctionalState           output_state;    /*!< ENABLE to route the function results to output multiplexers    */
+  HAL_PLAY_OUTTypeDef       output;          /*!< Output multiplexer of the function result                      */
+  HAL_PLAY_OUTTypeDef       output_dir;      /*!< Output multiplexer of the direction,
+                                                  HAL_PLAY_FUNCTION_QUADRATURE only                              */
+} HAL_PLAY_FunctionConfTypeDef;
+
+/**
+  * @brief  PLAY ready-made logic function netlist, built by HAL_PLAY_BuildFunction()
+  * @note   The netlist points to the configuration arrays of this structure, which must not be copied.
+  */
+typedef struct
+{
+  HAL_PLAY_NetlistTypeDef  netlist;        /*!< Netlist to be compiled with HAL_PLAY_CompileNetlist()           */
+  HAL_PLAY_IN_ConfTypeDef  input[2];       /*!< Input multiplexer configurations                                */
+  HAL_PLAY_LUT_ConfTypeDef lut[4];         /*!< Lookup table configurations                                     */
+  HAL_PLAY_OUT_ConfTypeDef output[2];      /*!< Output multiplexer configurations                               */
+  uint32_t                 lut_output;     /*!< Lookup table output of the function result, for the edge
+                                                triggers, one of @ref PLAY_LookUp_Table_Output                  */
+  uint32_t                 lut_output_dir; /*!< Lookup table output of the direction, HAL_PLAY_FUNCTION_QUADRATURE
+                                                only, one of @ref PLAY_LookUp_Table_Output                      */
+} HAL_PLAY_FunctionNetlistTypeDef;
+
 /**
   * @}
   */
@@ -846,6 +924,17 @@ HAL_StatusTypeDef HAL_PLAY_OUTPUT_SetSource(const HAL_PLAY_HandleTypeDef *hplay,
                                             uint32_t source);
 uint32_t HAL_PLAY_OUTPUT_GetSource(const HAL_PLAY_HandleTypeDef *hplay, HAL_PLAY_OUTTypeDef mux_id);
 
+/* PLAY Compiled configuration functions **************************************/
+HAL_StatusTypeDef HAL_PLAY_CompileNetlist(const HAL_PLAY_HandleTypeDef *hplay, const HAL_PLAY_NetlistTypeDef *p_netlist,
+                                          HAL_PLAY_CompiledConfTypeDef *p_compiled);
+HAL_StatusTypeDef HAL_PLAY_LoadCompiled(HAL_PLAY_HandleTypeDef *hplay, const HAL_PLAY_CompiledConfTypeDef *p_compiled);
+
+/* PLAY Ready-made logic function functions **********************************/
+HAL_StatusTypeDef HAL_PLAY_BuildFunction(const HAL_PLAY_FunctionConfTypeDef *p_config,
+                                         HAL_PLAY_FunctionNetlistTypeDef *p_function);
+HAL_StatusTypeDef HAL_PLAY_SetFunction(HAL_PLAY_HandleTypeDef *hplay, const HAL_PLAY_FunctionConfTypeDef *p_config,
+                                       HAL_PLAY_FunctionNetlistTypeDef *p_function);
+
 /**
   * @}
   */
@@ -856,6 +945,7 @@ uint32_t HAL_PLAY_OUTPUT_GetSource(const HAL_PLAY_HandleTypeDef *hplay, HAL_PLAY
 
 HAL_StatusTypeDef HAL_PLAY_Start(HAL_PLAY_HandleTypeDef *hplay, const HAL_PLAY_EdgeTriggerConfTypeDef *p_config);
 HAL_StatusTypeDef HAL_PLAY_Stop(HAL_PLAY_HandleTypeDef *hplay);
+HAL_StatusTypeDef HAL_PLAY_Reconfigure(HAL_PLAY_HandleTypeDef *hplay, const HAL_PLAY_CompiledConfTypeDef *p_compiled);
 
 /**
   * @}
@@ -102,6 +102,10 @@ typedef struct
 #if defined(HAL_DMA_MODULE_ENABLED)
   DMA_HandleTypeDef    *hdmatx;      /*!< PSSI Tx DMA Handle parameters  */
   DMA_HandleTypeDef    *hdmarx;      /*!< PSSI Rx DMA Handle parameters  */
+  __IO uint32_t         StreamHalfMask;      /*!< PSSI stream halves owned by the application,
+                                                  one bit per half                            */
+  __IO uint32_t         StreamOverflowCount; /*!< PSSI stream halves reused by the DMA before
+                                                  being released                              */
 #endif /*HAL_DMA_MODULE_ENABLED*/
 
 #if (USE_HAL_PSSI_REGISTER_CALLBACKS == 1)
@@ -109,6 +113,8 @@ typedef struct
   void (* RxCpltCallback)(struct __PSSI_HandleTypeDef *hpssi);    /*!< PSSI transfer complete callback. */
   void (* ErrorCallback)(struct __PSSI_HandleTypeDef *hpssi);     /*!< PSSI transfer complete callback. */
   void (* AbortCpltCallback)(struct __PSSI_HandleTypeDef *hpssi); /*!< PSSI transfer error callback.    */
+  void (* TxHalfCpltCallback)(struct __PSSI_HandleTypeDef *hpssi); /*!< PSSI stream Tx half complete callback. */
+  void (* RxHalfCpltCallback)(struct __PSSI_HandleTypeDef *hpssi); /*!< PSSI stream Rx half complete callback. */
 
   void (* MspInitCallback)(struct __PSSI_HandleTypeDef *hpssi);   /*!< PSSI Msp Init callback.          */
   void (* MspDeInitCallback)(struct __PSSI_HandleTypeDef *hpssi); /*!< PSSI Msp DeInit callback.        */
@@ -137,7 +143,10 @@ typedef enum
   HAL_PSSI_ABORT_CB_ID       = 0x04U, /*!< PSSI Abort callback ID                  */
 
   HAL_PSSI_MSPINIT_CB_ID     = 0x05U, /*!< PSSI Msp Init callback ID               */
-  HAL_PSSI_MSPDEINIT_CB_ID   = 0x06U  /*!< PSSI Msp DeInit callback ID             */
+  HAL_PSSI_MSPDEINIT_CB_ID   = 0x06U, /*!< PSSI Msp DeInit callback ID             */
+
+  HAL_PSSI_TX_HALF_COMPLETE_CB_ID = 0x07U, /*!< PSSI stream Tx half completed callback ID */
+  HAL_PSSI_RX_HALF_COMPLETE_CB_ID = 0x08U  /*!< PSSI stream Rx half completed callback ID */
 
 } HAL_PSSI_CallbackIDTypeDef;
 #endif /* USE_HAL_PSSI_REGISTER_CALLBACKS */
@@ -163,6 +172,7 @@ typedef enum
 #if (USE_HAL_PSSI_REGISTER_CALLBACKS == 1)
 #define HAL_PSSI_ERROR_INVALID_CALLBACK 0x00000020U /*!< Invalid callback error  */
 #endif /* USE_HAL_PSSI_REGISTER_CALLBACKS */
+#define HAL_PSSI_ERROR_STREAM_OVERFLOW  0x00000040U /*!< Stream half reused by the DMA before release */
 
 /**
   * @}
@@ -179,6 +189,16 @@ typedef enum
   * @}
   */
 
+/** @defgroup PSSI_STREAM_HALF PSSI Stream Half
+  * @{
+  */
+
+#define HAL_PSSI_STREAM_FIRST_HALF      0x00000000U   /*!< First half of the stream buffer  */
+#define HAL_PSSI_STREAM_SECOND_HALF     0x00000001U   /*!< Second half of the stream buffer */
+/**
+  * @}
+  */
+
 /** @defgroup PSSI_BUS_WIDTH PSSI Bus Width
   * @{
   */
@@ -475,6 +495,10 @@ HAL_StatusTypeDef HAL_PSSI_Receive(PSSI_HandleTypeDef *hpssi, uint8_t *pData, ui
 HAL_StatusTypeDef HAL_PSSI_Transmit_DMA(PSSI_HandleTypeDef *hpssi, uint32_t *pData, uint32_t Size);
 HAL_StatusTypeDef HAL_PSSI_Receive_DMA(PSSI_HandleTypeDef *hpssi, uint32_t *pData, uint32_t Size);
 HAL_StatusTypeDef HAL_PSSI_Abort_DMA(PSSI_HandleTypeDef *hpssi);
+HAL_StatusTypeDef HAL_PSSI_Transmit_Stream_DMA(PSSI_HandleTypeDef *hpssi, uint32_t *pData, uint32_t Size);
+HAL_StatusTypeDef HAL_PSSI_Receive_Stream_DMA(PSSI_HandleTypeDef *hpssi, uint32_t *pData, uint32_t Size);
+HAL_StatusTypeDef HAL_PSSI_Stream_Release(PSSI_HandleTypeDef *hpssi, uint32_t Half);
+HAL_StatusTypeDef HAL_PSSI_Stop_Stream_DMA(PSSI_HandleTypeDef *hpssi);
 #endif /*HAL_DMA_MODULE_ENABLED*/
 
 /**
@@ -502,6 +526,8 @@ void HAL_PSSI_TxCpltCallback(PSSI_HandleTypeDef *hpssi);
 void HAL_PSSI_RxCpltCallback(PSSI_HandleTypeDef *hpssi);
 void HAL_PSSI_ErrorCallback(PSSI_HandleTypeDef *hpssi);
 void HAL_PSSI_AbortCpltCallback(PSSI_HandleTypeDef *hpssi);
+void HAL_PSSI_TxHalfCpltCallback(PSSI_HandleTypeDef *hpssi);
+void HAL_PSSI_RxHalfCpltCallback(PSSI_HandleTypeDef *hpssi);
 
 /**
   * @}
@@ -77,6 +77,22 @@ typedef struct
                                       PWREx_PIN_Pull
                         */
 } PWREx_WakeupPinTypeDef;
+
+/**
+  * @brief  PWREx low-power manager structure definition
+  */
+typedef struct
+{
+  const RCC_ClockProfileTypeDef *pRunProfile; /*!< Clock profile restored at wake-up from Stop mode, NULL to only
+                                                   restart the oscillators and keep the wake-up clock          */
+  uint32_t WakeUpClock;                       /*!< System clock at wake-up from Stop mode, a value of
+                                                   @ref RCC_Stop_WakeUpClock                                   */
+  __IO uint32_t StopLocks;                    /*!< Number of activities needing the clocks: Stop not allowed */
+  __IO uint32_t SleepLocks;                   /*!< Number of activities needing the CPU: Sleep not allowed   */
+  uint32_t NbSleep;                           /*!< Number of Sleep mode entries                              */
+  uint32_t NbStop;                            /*!< Number of Stop mode entries                               */
+  uint32_t NbRestoreErrors;                   /*!< Number of wake-ups where the clocks were not restored     */
+} PWREx_PMTypeDef;
 /**
   * @}
   */
@@ -226,6 +242,16 @@ typedef struct
   * @}
   */
 
+/** @defgroup PWREx_PM_Mode PWREx Low-Power Manager Mode
+  * @{
+  */
+#define PWR_PM_MODE_RUN   0U /*!< No low-power mode */
+#define PWR_PM_MODE_SLEEP 1U /*!< Sleep mode        */
+#define PWR_PM_MODE_STOP  2U /*!< Stop mode         */
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -581,6 +607,18 @@ void HAL_PWREx_DisableStandbyIORetention(void);
 void HAL_PWREx_EnableStandbyJTAGIORetention(void);
 void HAL_PWREx_DisableStandbyJTAGIORetention(void);
 
+/**
+  * @}
+  */
+
+/** @addtogroup PWREx_Exported_Functions_Group6
+  * @{
+  */
+HAL_StatusTypeDef HAL_PWREx_PM_Init(PWREx_PMTypeDef *pPM);
+void              HAL_PWREx_PM_Lock(uint32_t Mode);
+void              HAL_PWREx_PM_Unlock(uint32_t Mode);
+uint32_t          HAL_PWREx_PM_GetAllowedMode(void);
+uint32_t          HAL_PWREx_PM_Idle(void);
 /**
   * @}
   */
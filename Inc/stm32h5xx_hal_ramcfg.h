@@ -64,7 +64,8 @@ typedef enum
   HAL_RAMCFG_MSPDEINIT_CB_ID         = 0x01U,  /*!< RAMCFG MSP DeInit Callback ID          */
   HAL_RAMCFG_SE_DETECT_CB_ID         = 0x02U,  /*!< RAMCFG Single Error Detect Callback ID */
   HAL_RAMCFG_DE_DETECT_CB_ID         = 0x03U,  /*!< RAMCFG Double Error Detect Callback ID */
-  HAL_RAMCFG_ALL_CB_ID               = 0x04U,  /*!< RAMCFG All callback ID                 */
+  HAL_RAMCFG_ERASE_CPLT_CB_ID        = 0x04U,  /*!< RAMCFG Erase Complete Callback ID      */
+  HAL_RAMCFG_ALL_CB_ID               = 0x05U,  /*!< RAMCFG All callback ID                 */
 } HAL_RAMCFG_CallbackIDTypeDef;
 #endif /* USE_HAL_RAMCFG_REGISTER_CALLBACKS */
 
@@ -85,6 +86,7 @@ typedef struct
   void (* MspDeInitCallback)(struct __RAMCFG_HandleTypeDef *hramcfg);        /*!< RAMCFG MSP DeInit Callback          */
   void (* DetectSingleErrorCallback)(struct __RAMCFG_HandleTypeDef *hramcfg);/*!< RAMCFG Single Error Detect Callback */
   void (* DetectDoubleErrorCallback)(struct __RAMCFG_HandleTypeDef *hramcfg);/*!< RAMCFG Double Error Detect Callback */
+  void (* EraseCpltCallback)(struct __RAMCFG_HandleTypeDef *hramcfg);        /*!< RAMCFG Erase Complete Callback      */
 #endif  /* USE_HAL_RAMCFG_REGISTER_CALLBACKS */
 } RAMCFG_HandleTypeDef;
 
@@ -301,6 +303,11 @@ HAL_StatusTypeDef HAL_RAMCFG_EnableWriteProtection(RAMCFG_HandleTypeDef *hramcfg
   * @{
   */
 HAL_StatusTypeDef HAL_RAMCFG_Erase(RAMCFG_HandleTypeDef *hramcfg);
+HAL_StatusTypeDef HAL_RAMCFG_Erase_Start(RAMCFG_HandleTypeDef *hramcfg);
+HAL_StatusTypeDef HAL_RAMCFG_Erase_Process(RAMCFG_HandleTypeDef *hramcfg);
+HAL_StatusTypeDef HAL_RAMCFG_Erase_WaitAll(RAMCFG_HandleTypeDef *const hramcfg[], uint32_t NbInstances,
+                                           uint32_t Timeout);
+void              HAL_RAMCFG_EraseCpltCallback(RAMCFG_HandleTypeDef *hramcfg);
 /**
   * @}
   */
@@ -468,7 +468,50 @@ typedef struct
 
 } RCC_CRSSynchroInfoTypeDef;
 
+/**
+  * @brief RCC_CRS monitor statistics structure definition, filled by HAL_RCCEx_CRSGetMonitorStats()
+  */
+typedef struct
+{
+  uint32_t SyncCount;             /*!< Number of SYNC events with a frequency error measurement (SYNCOK or SYNCWARN) */
+
+  uint32_t SyncWarnCount;         /*!< Number of SYNC events with a frequency error above the warning limit */
+
+  uint32_t SyncErrorCount;        /*!< Number of SYNC errors (frequency error above the error limit) */
+
+  uint32_t SyncMissCount;         /*!< Number of missed SYNC events */
+
+  uint32_t TrimOverflowCount;     /*!< Number of trimming overflows or underflows */
+
+  uint32_t OutOfToleranceCount;   /*!< Number of frequency error measurements above the monitor tolerance */
+
+  uint32_t LastErrorPpm;          /*!< Frequency error of the last SYNC event, in ppm of the target frequency */
+
+  uint32_t LastErrorDirection;    /*!< Frequency error direction of the last SYNC event.
+                                     This parameter is a value of @ref RCCEx_CRS_FreqErrorDirection */
+
+  uint32_t MaxErrorPpm;           /*!< Maximum frequency error since the monitor start, in ppm */
+
+  uint32_t HSI48CalibrationValue; /*!< HSI48 trimming value at the last SYNC event */
+
+} RCC_CRSMonitorStatsTypeDef;
+
 #endif /* CRS */
+
+/**
+  * @brief  RCC clock profile structure definition, filled by HAL_RCCEx_InitProfile()
+  */
+typedef struct
+{
+  uint32_t SYSCLKSource;    /*!< System clock source, a value of @ref RCC_System_Clock_Source           */
+  uint32_t CFGR2;           /*!< AHB and APB prescalers, as programmed in the RCC_CFGR2 register        */
+  uint32_t FlashLatency;    /*!< Flash wait states, a value of @ref FLASH_Latency                       */
+  uint32_t ProgramDelay;    /*!< Flash programming delay, as programmed in the FLASH_ACR register       */
+  uint32_t VoltageScaling;  /*!< Regulator voltage scaling, a value of @ref PWREx_Regulator_Voltage_Scale */
+  uint32_t SYSCLKFrequency; /*!< System clock frequency in Hz                                           */
+  uint32_t HCLKFrequency;   /*!< AHB clock frequency in Hz                                              */
+} RCC_ClockProfileTypeDef;
+
 /**
   * @}
   */
@@ -1657,6 +1700,14 @@ typedef struct
   * @}
   */
 
+/** @defgroup RCCEx_CRS_MonitorTolerance RCCEx CRS Monitor Tolerance
+  * @{
+  */
+#define RCC_CRS_USB_TOLERANCE_PPM      2500U  /*!< USB full-speed data rate tolerance (+/-0.25%) */
+/**
+  * @}
+  */
+
 /** @defgroup RCCEx_CRS_Interrupt_Sources RCCEx CRS Interrupt Sources
   * @{
   */
@@ -4754,6 +4805,8 @@ typedef struct
 #define IS_RCC_CRS_FREQERRORDIR(__DIR__)   (((__DIR__) == RCC_CRS_FREQERRORDIR_UP) || \
                                             ((__DIR__) == RCC_CRS_FREQERRORDIR_DOWN))
 
+#define IS_RCC_CRS_TOLERANCE(__PPM__)      (((__PPM__) > 0U) && ((__PPM__) <= 1000000U))
+
 #endif /* CRS */
 
 /**
@@ -4772,6 +4825,7 @@ typedef struct
 HAL_StatusTypeDef HAL_RCCEx_PeriphCLKConfig(const RCC_PeriphCLKInitTypeDef  *pPeriphClkInit);
 void              HAL_RCCEx_GetPeriphCLKConfig(RCC_PeriphCLKInitTypeDef  *pPeriphClkInit);
 uint32_t          HAL_RCCEx_GetPeriphCLKFreq(uint64_t PeriphClk);
+void              HAL_RCCEx_InvalidateFreqCache(void);
 void     HAL_RCCEx_GetPLL1ClockFreq(PLL1_ClocksTypeDef *pPLL1_Clocks);
 void     HAL_RCCEx_GetPLL2ClockFreq(PLL2_ClocksTypeDef *pPLL2_Clocks);
 #if defined(RCC_CR_PLL3ON)
@@ -4787,9 +4841,11 @@ void     HAL_RCCEx_GetPLL3ClockFreq(PLL3_ClocksTypeDef *pPLL3_Clocks);
 
 HAL_StatusTypeDef HAL_RCCEx_EnablePLL2(RCC_PLL2InitTypeDef  *pPLL2Init);
 HAL_StatusTypeDef HAL_RCCEx_DisablePLL2(void);
+HAL_StatusTypeDef HAL_RCCEx_SetPLL2FRACN(uint32_t PLL2FRACN);
 #if defined(RCC_CR_PLL3ON)
 HAL_StatusTypeDef HAL_RCCEx_EnablePLL3(RCC_PLL3InitTypeDef  *pPLL3Init);
 HAL_StatusTypeDef HAL_RCCEx_DisablePLL3(void);
+HAL_StatusTypeDef HAL_RCCEx_SetPLL3FRACN(uint32_t PLL3FRACN);
 #endif /* RCC_CR_PLL3ON */
 
 void              HAL_RCCEx_WakeUpStopCLKConfig(uint32_t WakeUpClk);
@@ -4818,12 +4874,26 @@ void              HAL_RCCEx_CRS_SyncOkCallback(void);
 void              HAL_RCCEx_CRS_SyncWarnCallback(void);
 void              HAL_RCCEx_CRS_ExpectedSyncCallback(void);
 void              HAL_RCCEx_CRS_ErrorCallback(uint32_t Error);
+HAL_StatusTypeDef HAL_RCCEx_CRSStartMonitor(const RCC_CRSInitTypeDef *pInit, uint32_t TolerancePpm);
+void              HAL_RCCEx_CRSStopMonitor(void);
+void              HAL_RCCEx_CRSGetMonitorStats(RCC_CRSMonitorStatsTypeDef *pStats);
+void              HAL_RCCEx_CRS_ToleranceCallback(uint32_t ErrorPpm);
 /**
   * @}
   */
 
 #endif /* CRS */
 
+/** @addtogroup RCCEx_Exported_Functions_Group4
+  * @{
+  */
+HAL_StatusTypeDef HAL_RCCEx_InitProfile(RCC_ClockProfileTypeDef *pProfile, const RCC_ClkInitTypeDef *pClkInitStruct,
+                                        uint32_t VoltageScaling);
+HAL_StatusTypeDef HAL_RCCEx_SwitchProfile(const RCC_ClockProfileTypeDef *pProfile);
+/**
+  * @}
+  */
+
 /**
   * @}
   */
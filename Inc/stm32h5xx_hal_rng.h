@@ -94,6 +94,14 @@ typedef struct
 
   uint32_t                    RandomNumber; /*!< Last Generated RNG Data */
 
+  uint32_t                    *pPool;       /*!< Random pool buffer (NULL when pool is not running) */
+
+  uint32_t                    PoolSize;     /*!< Random pool buffer size in words  */
+
+  __IO uint32_t               PoolHead;     /*!< Random pool write index (IRQ side) */
+
+  __IO uint32_t               PoolTail;     /*!< Random pool read index (user side) */
+
 #if (USE_HAL_RNG_REGISTER_CALLBACKS == 1)
   void (* ReadyDataCallback)(struct __RNG_HandleTypeDef *hrng, uint32_t random32bit);  /*!< RNG Data Ready Callback    */
   void (* ErrorCallback)(struct __RNG_HandleTypeDef *hrng);                            /*!< RNG Error Callback         */
@@ -247,6 +247,18 @@ HAL_StatusTypeDef HAL_RNGEx_RecoverSeedError(RNG_HandleTypeDef *hrng);
 HAL_StatusTypeDef HAL_RNGEx_SetHealthFactorConfig(RNG_HandleTypeDef *hrng, uint32_t htcr_idx, uint32_t htcr_value);
 #endif  /* RNG_HTCR0_HTCFG || RNG_HTCR1_HTCFG || RNG_HTCR2_HTCFG || RNG_HTCR3_HTCFG */
 
+/**
+  * @}
+  */
+
+/** @addtogroup RNGEx_Exported_Functions_Group3
+  * @{
+  */
+HAL_StatusTypeDef HAL_RNGEx_StartPool(RNG_HandleTypeDef *hrng, uint32_t *pPool, uint32_t Size);
+HAL_StatusTypeDef HAL_RNGEx_StopPool(RNG_HandleTypeDef *hrng);
+uint32_t HAL_RNGEx_GetPoolLevel(const RNG_HandleTypeDef *hrng);
+HAL_StatusTypeDef HAL_RNGEx_GetBytes(RNG_HandleTypeDef *hrng, uint8_t *pBuf, uint32_t Len);
+
 /**
   * @}
   */
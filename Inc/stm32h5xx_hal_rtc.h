@@ -206,6 +206,10 @@ typedef struct
 
   __IO HAL_RTCStateTypeDef  State;      /*!< Time communication state */
 
+  __IO uint32_t             SSRUCount;  /*!< SSR underflows counted since HAL_RTCEx_StartBinaryCounter() */
+
+  struct __RTCEx_TimerWheelTypeDef *pTimerWheel; /*!< Software timer wheel owning Alarm A, NULL if none */
+
 #if (USE_HAL_RTC_REGISTER_CALLBACKS == 1)
   void (* AlarmAEventCallback)(struct __RTC_HandleTypeDef *hrtc);            /*!< RTC Alarm A Event callback            */
   void (* AlarmBEventCallback)(struct __RTC_HandleTypeDef *hrtc);            /*!< RTC Alarm B Event callback            */
@@ -245,6 +245,47 @@ typedef struct
                                              This parameter can be a value of
                                              @ref RTCEx_TAMP_Monotonic_Counter_Privilege */
 } RTC_PrivilegeStateTypeDef;
+
+/**
+  * @brief  RTC software timer structure definition
+  */
+typedef struct __RTCEx_TimerTypeDef
+{
+  struct __RTCEx_TimerTypeDef *pNext;  /*!< Next timer of the same wheel slot, managed by the driver */
+
+  uint64_t Expiry;                     /*!< Expiry wheel tick, managed by the driver */
+
+  uint32_t Period;                     /*!< Reload period in wheel ticks, 0 for a one-shot timer.
+                                            Set by HAL_RTCEx_TimerStart() */
+
+  __IO uint32_t Active;                /*!< 1 while the timer is inserted in the wheel, managed by the driver */
+
+  void (* Callback)(struct __RTCEx_TimerTypeDef *pTimer); /*!< Expiry callback, executed from the RTC alarm
+                                                               interrupt. Must be set before starting the timer */
+} RTCEx_TimerTypeDef;
+
+/**
+  * @brief  Number of slots of the RTC software timer wheel, one bit of SlotMask per slot
+  */
+#define RTC_TIMERWHEEL_SLOTS               32U
+
+/**
+  * @brief  RTC software timer wheel structure definition
+  */
+typedef struct __RTCEx_TimerWheelTypeDef
+{
+  uint32_t TickShift;                  /*!< Wheel tick duration, as a power of two of the binary counter
+                                            period (ck_apre). This parameter must be a number between
+                                            Min_Data = 0 and Max_Data = 16 */
+
+  RTCEx_TimerTypeDef *pSlot[RTC_TIMERWHEEL_SLOTS]; /*!< Timer lists of the wheel slots, managed by the driver */
+
+  uint32_t SlotMask;                   /*!< Non empty slots bit field, managed by the driver */
+
+  uint64_t CurrentTick;                /*!< Last processed wheel tick, managed by the driver */
+
+  uint64_t AlarmTick;                  /*!< Wheel tick programmed on Alarm A, managed by the driver */
+} RTCEx_TimerWheelTypeDef;
 /**
   * @}
   */
@@ -1687,6 +1728,13 @@ HAL_StatusTypeDef HAL_RTCEx_SetSSRU_IT(RTC_HandleTypeDef *hrtc);
 HAL_StatusTypeDef HAL_RTCEx_DeactivateSSRU(RTC_HandleTypeDef *hrtc);
 void              HAL_RTCEx_SSRUIRQHandler(RTC_HandleTypeDef *hrtc);
 void              HAL_RTCEx_SSRUEventCallback(RTC_HandleTypeDef *hrtc);
+HAL_StatusTypeDef HAL_RTCEx_StartBinaryCounter(RTC_HandleTypeDef *hrtc);
+uint64_t          HAL_RTCEx_GetBinaryCounter(const RTC_HandleTypeDef *hrtc);
+HAL_StatusTypeDef HAL_RTCEx_TimerWheelStart(RTC_HandleTypeDef *hrtc, RTCEx_TimerWheelTypeDef *pWheel);
+HAL_StatusTypeDef HAL_RTCEx_TimerWheelStop(RTC_HandleTypeDef *hrtc);
+HAL_StatusTypeDef HAL_RTCEx_TimerStart(RTC_HandleTypeDef *hrtc, RTCEx_TimerTypeDef *pTimer, uint32_t Delay,
+                                       uint32_t Period);
+HAL_StatusTypeDef HAL_RTCEx_TimerStop(RTC_HandleTypeDef *hrtc, RTCEx_TimerTypeDef *pTimer);
 
 /**
   * @}
@@ -1966,6 +2014,8 @@ void              HAL_RTCEx_DisableRemapRtcOut2(RTC_HandleTypeDef *hrtc);
 
 #define IS_RTC_ALARMSUBSECONDBIN_AUTOCLR(SEL) (((SEL) == RTC_ALARMSUBSECONDBIN_AUTOCLR_NO) || \
                                                ((SEL) == RTC_ALARMSUBSECONDBIN_AUTOCLR_YES))
+
+#define IS_RTC_TIMERWHEEL_TICKSHIFT(SHIFT) ((SHIFT) <= 16U)
 /**
   * @}
   */
@@ -1974,6 +2024,15 @@ void              HAL_RTCEx_DisableRemapRtcOut2(RTC_HandleTypeDef *hrtc);
   * @}
   */
 
+/* Private functions ---------------------------------------------------------*/
+/** @defgroup RTCEx_Private_Functions RTCEx Private Functions
+  * @{
+  */
+void RTCEx_TimerWheelProcess(RTC_HandleTypeDef *hrtc);
+/**
+  * @}
+  */
+
 /**
   * @}
   */
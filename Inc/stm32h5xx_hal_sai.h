@@ -210,6 +210,29 @@ typedef struct
   * @}
   */
 
+/** @defgroup SAI_TdmStream_Structure_definition SAI TDM Stream Structure definition
+  * @brief  SAI TDM deinterleaving stream structure definition, provided by the user
+  * @{
+  */
+typedef struct
+{
+  uint8_t       *pData;         /*!< Channel buffers, 2 halves of one buffer per active slot, each buffer
+                                     holding FrameCount samples, see @ref HAL_SAI_TdmStream_GetChannel() */
+
+  uint32_t      FrameCount;     /*!< Number of TDM frames per half.
+                                     This parameter must be a number between Min_Data = 1 and
+                                     Max_Data = SAI_TDM_STREAM_MAX_FRAMES */
+
+  uint32_t      NbChannels;     /*!< Number of active slots deinterleaved, internal */
+
+  uint32_t      SampleSize;     /*!< Size of one sample in bytes, internal */
+
+  __IO uint32_t NextHalf;       /*!< Half filled by the running DMA node, internal */
+} SAI_TdmStreamTypeDef;
+/**
+  * @}
+  */
+
 /** @defgroup SAI_Handle_Structure_definition SAI Handle Structure definition
   * @brief  SAI handle Structure definition
   * @{
@@ -244,6 +267,12 @@ typedef struct __SAI_HandleTypeDef
 
   __IO uint32_t             ErrorCode;    /*!< SAI Error code */
 
+  SAI_TdmStreamTypeDef      *pTdmStream;  /*!< Running TDM deinterleaving stream, NULL when not used */
+
+  __IO uint32_t             XferFrameCount;  /*!< Frames of the completed Rx DMA blocks since the start */
+
+  uint32_t                  XferBlockFrames; /*!< Frames of the Rx DMA buffer */
+
 #if (USE_HAL_SAI_REGISTER_CALLBACKS == 1)
   void (*RxCpltCallback)(struct __SAI_HandleTypeDef *hsai);      /*!< SAI receive complete callback */
   void (*RxHalfCpltCallback)(struct __SAI_HandleTypeDef *hsai);  /*!< SAI receive half complete callback */
@@ -288,6 +317,14 @@ typedef void (*pSAI_CallbackTypeDef)(SAI_HandleTypeDef *hsai);
   * @{
   */
 
+/** @defgroup SAI_TdmStream_Limits SAI TDM Stream Limits
+  * @{
+  */
+#define SAI_TDM_STREAM_MAX_FRAMES      2048U  /*!< Maximum number of TDM frames per half (DMA repeat count) */
+/**
+  * @}
+  */
+
 /** @defgroup SAI_Error_Code SAI Error Code
   * @{
   */
@@ -303,6 +340,7 @@ typedef void (*pSAI_CallbackTypeDef)(SAI_HandleTypeDef *hsai);
 #if (USE_HAL_SAI_REGISTER_CALLBACKS == 1)
 #define HAL_SAI_ERROR_INVALID_CALLBACK 0x00000100U  /*!< Invalid callback error */
 #endif /* USE_HAL_SAI_REGISTER_CALLBACKS */
+#define HAL_SAI_ERROR_SYNC             0x00000200U  /*!< Synchronized start trigger error */
 /**
   * @}
   */
@@ -785,6 +823,15 @@ HAL_StatusTypeDef HAL_SAI_Receive_DMA(SAI_HandleTypeDef *hsai, uint8_t *pData, u
 HAL_StatusTypeDef HAL_SAI_DMAPause(SAI_HandleTypeDef *hsai);
 HAL_StatusTypeDef HAL_SAI_DMAResume(SAI_HandleTypeDef *hsai);
 HAL_StatusTypeDef HAL_SAI_DMAStop(SAI_HandleTypeDef *hsai);
+HAL_StatusTypeDef HAL_SAI_Receive_TdmStream_DMA(SAI_HandleTypeDef *hsai, SAI_TdmStreamTypeDef *pStream);
+uint8_t          *HAL_SAI_TdmStream_GetChannel(const SAI_HandleTypeDef *hsai, uint32_t Half, uint32_t Channel);
+uint32_t          HAL_SAI_GetFrameCount(const SAI_HandleTypeDef *hsai);
+#if defined(HAL_MDF_MODULE_ENABLED) && defined(MDF1)
+HAL_StatusTypeDef HAL_SAI_MDF_SyncReceive_DMA(SAI_HandleTypeDef *hsai, uint8_t *pData, uint16_t Size,
+                                              const MDF_HandleTypeDef *hmdf);
+HAL_StatusTypeDef HAL_SAI_MDF_SyncReceive_TdmStream_DMA(SAI_HandleTypeDef *hsai, SAI_TdmStreamTypeDef *pStream,
+                                                        const MDF_HandleTypeDef *hmdf);
+#endif /* HAL_MDF_MODULE_ENABLED && MDF1 */
 
 /* Abort function */
 HAL_StatusTypeDef HAL_SAI_Abort(SAI_HandleTypeDef *hsai);
@@ -57,11 +57,54 @@ typedef struct
                              This parameter must be a number between Min_Data = 0 and Max_Data = 7. */
 } SAIEx_PdmMicDelayParamTypeDef;
 
+/**
+  * @brief  SAI clock tracking structure definition, proportional-integral controller of the audio PLL
+  *         fractional multiplier fed by the SAI DMA buffer fill level
+  */
+typedef struct
+{
+  uint32_t PLL;           /*!< Audio PLL tuned by the controller.
+                               This parameter can be a value of @ref SAIEx_ClockTrack_PLL */
+
+  uint32_t NominalFracN;  /*!< FRACN value of the PLL at nominal sample rate, between 0 and 8191 */
+
+  uint32_t MaxDeviation;  /*!< Maximum deviation of the FRACN value from NominalFracN */
+
+  uint32_t TargetLevel;   /*!< Fill level (in samples) the controller converges to */
+
+  int32_t  Kp;            /*!< Proportional gain, in 1/256 FRACN step per sample of fill level error */
+
+  int32_t  Ki;            /*!< Integral gain, in 1/256 FRACN step per accumulated sample of error */
+
+  int32_t  Integral;      /*!< Accumulated fill level error, managed by the controller */
+
+  uint32_t FracN;         /*!< FRACN value currently applied, managed by the controller */
+} SAIEx_ClockTrackTypeDef;
+
 /**
   * @}
   */
 
 /* Exported constants --------------------------------------------------------*/
+/** @defgroup SAIEx_Exported_Constants SAIEx Extended Exported Constants
+  * @{
+  */
+
+/** @defgroup SAIEx_ClockTrack_PLL SAIEx Clock Tracking PLL
+  * @{
+  */
+#define SAIEX_CLOCKTRACK_PLL2     0x00000002U  /*!< PLL2 fractional multiplier tuned */
+#if defined(RCC_CR_PLL3ON)
+#define SAIEX_CLOCKTRACK_PLL3     0x00000003U  /*!< PLL3 fractional multiplier tuned */
+#endif /* RCC_CR_PLL3ON */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
 /* Exported macros -----------------------------------------------------------*/
 /* Exported functions --------------------------------------------------------*/
 /** @addtogroup SAIEx_Exported_Functions SAIEx Extended Exported Functions
@@ -77,6 +120,16 @@ HAL_StatusTypeDef HAL_SAIEx_ConfigPdmMicDelay(const SAI_HandleTypeDef *hsai,
   * @}
   */
 
+/** @addtogroup SAIEx_Exported_Functions_Group2 Clock tracking functions
+  * @{
+  */
+uint32_t          HAL_SAIEx_GetDMAPosition(const SAI_HandleTypeDef *hsai);
+HAL_StatusTypeDef HAL_SAIEx_ClockTrack_Init(SAIEx_ClockTrackTypeDef *pTrack);
+HAL_StatusTypeDef HAL_SAIEx_ClockTrack_Update(SAIEx_ClockTrackTypeDef *pTrack, uint32_t FillLevel);
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -86,6 +139,11 @@ HAL_StatusTypeDef HAL_SAIEx_ConfigPdmMicDelay(const SAI_HandleTypeDef *hsai,
   * @{
   */
 #define IS_SAI_PDM_MIC_DELAY(VALUE)   ((VALUE) <= 7U)
+#if defined(RCC_CR_PLL3ON)
+#define IS_SAIEX_CLOCKTRACK_PLL(PLL)  (((PLL) == SAIEX_CLOCKTRACK_PLL2) || ((PLL) == SAIEX_CLOCKTRACK_PLL3))
+#else
+#define IS_SAIEX_CLOCKTRACK_PLL(PLL)  ((PLL) == SAIEX_CLOCKTRACK_PLL2)
+#endif /* RCC_CR_PLL3ON */
 /**
   * @}
   */
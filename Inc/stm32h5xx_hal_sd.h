@@ -147,6 +147,8 @@ typedef struct
 
   uint32_t                     CID[4];           /*!< SD card identification number table */
 
+  struct __SD_RequestQueueTypeDef *pRequestQueue; /*!< SD request queue attached by HAL_SDEx_RequestQueue_Init() */
+
 #if defined (USE_HAL_SD_REGISTER_CALLBACKS) && (USE_HAL_SD_REGISTER_CALLBACKS == 1U)
   void (* TxCpltCallback)(struct __SD_HandleTypeDef *hsd);
   void (* RxCpltCallback)(struct __SD_HandleTypeDef *hsd);
@@ -357,6 +359,8 @@ typedef void (*pSD_TransceiverCallbackTypeDef)(FlagStatus status);
 #define   SD_CONTEXT_WRITE_MULTIPLE_BLOCK ((uint32_t)0x00000020U)  /*!< Write multiple blocks operation  */
 #define   SD_CONTEXT_IT                   ((uint32_t)0x00000008U)  /*!< Process in Interrupt mode        */
 #define   SD_CONTEXT_DMA                  ((uint32_t)0x00000080U)  /*!< Process in DMA mode              */
+#define   SD_CONTEXT_BLOCK_COUNT          ((uint32_t)0x00000100U)  /*!< Multiple blocks operation with a
+                                                                        predefined block count (CMD23)   */
 
 /**
   * @}
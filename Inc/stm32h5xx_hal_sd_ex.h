@@ -52,12 +52,120 @@ extern "C" {
 #define SD_DMALinkNodeTypeDef        SDMMC_DMALinkNodeTypeDef
 #define SD_DMALinkNodeConfTypeDef    SDMMC_DMALinkNodeConfTypeDef
 #define SD_DMALinkedListTypeDef      SDMMC_DMALinkedListTypeDef
+#define SD_DMAIOVecTypeDef           SDMMC_DMAIOVecTypeDef
 /* ----------------- Linked Aliases ------------------------------------------*/
 #define HAL_SDEx_DMALinkedList_WriteCpltCallback HAL_SD_TxCpltCallback
 #define HAL_SDEx_DMALinkedList_ReadCpltCallback  HAL_SD_RxCpltCallback
 /**
   * @}
   */
+
+/** @defgroup SDEx_Exported_Types_Group2 Write Session Structure
+  * @{
+  */
+typedef struct
+{
+  uint32_t NextBlockAdd;     /*!< Address of the next block to write in the session area */
+
+  uint32_t RemainingBlocks;  /*!< Number of blocks remaining to write in the session area */
+} SD_WriteSessionTypeDef;
+/**
+  * @}
+  */
+
+/** @defgroup SDEx_Exported_Types_Group3 Request Queue Structures
+  * @{
+  */
+typedef struct __SD_RequestTypeDef
+{
+  uint32_t Operation;                    /*!< Request operation.
+                                              This parameter can be a value of @ref SDEx_Request_Operation */
+
+  uint8_t *pData;                        /*!< Pointer to the read or write buffer, not used for erase      */
+
+  uint32_t BlockAdd;                     /*!< First block address of the request                           */
+
+  uint32_t NumberOfBlocks;               /*!< Number of blocks to read, write or erase                     */
+
+  void (* pCompleteCallback)(SD_HandleTypeDef *hsd, struct __SD_RequestTypeDef *pRequest);
+                                         /*!< Completion callback, called from interrupt context (can be NULL) */
+
+  void *pToken;                          /*!< User completion token, not used by the driver                */
+
+  __IO uint32_t Status;                  /*!< Request status.
+                                              This parameter can be a value of @ref SDEx_Request_Status    */
+
+  uint32_t ErrorCode;                    /*!< SD error code of the completed request                       */
+
+  struct __SD_RequestTypeDef *pNext;     /*!< Next request in the queue, managed by the driver             */
+} SD_RequestTypeDef;
+
+typedef struct __SD_RequestQueueTypeDef
+{
+  SD_RequestTypeDef *pHead;              /*!< Request being processed or next to process                   */
+
+  SD_RequestTypeDef *pTail;              /*!< Last submitted request                                       */
+
+  __IO uint32_t Running;                 /*!< Set while the queue head is processed by the driver          */
+} SD_RequestQueueTypeDef;
+/**
+  * @}
+  */
+
+#if defined (DLYB_SDMMC1) || defined (DLYB_SDMMC2)
+/** @defgroup SDEx_Exported_Types_Group4 Tuning Structure
+  * @{
+  */
+typedef struct
+{
+  uint32_t ClockDiv;                     /*!< [in] SDMMC clock divider of the tuned UHS-I speed mode.
+                                              This parameter can be a value between Min_Data = 0 and Max_Data = 1023 */
+
+  uint32_t FallbackClockDiv;             /*!< [in] SDMMC clock divider of the high speed mode used when the tuning fails.
+                                              This parameter can be a value between Min_Data = 0 and Max_Data = 1023 */
+
+  uint32_t SpeedMode;                    /*!< [out] Selected speed mode, value of @ref SDMMC_LL_Speed_Mode        */
+
+  uint32_t Units;                        /*!< [out] Delay block unit delays of one phase                          */
+
+  uint32_t PhaseSel;                     /*!< [out] Selected sampling phase                                       */
+
+  uint32_t PhaseMask;                    /*!< [out] Bit field of the sampling phases passing the tuning           */
+} SD_TuningTypeDef;
+/**
+  * @}
+  */
+#endif /* DLYB_SDMMC1 || DLYB_SDMMC2 */
+/**
+  * @}
+  */
+
+/* Exported constants --------------------------------------------------------*/
+/** @defgroup SDEx_Exported_Constants SDEx Exported Constants
+  * @{
+  */
+
+/** @defgroup SDEx_Request_Operation Request Operation
+  * @{
+  */
+#define SD_REQUEST_READ                ((uint32_t)0x00000000U)  /*!< Read blocks in DMA mode             */
+#define SD_REQUEST_WRITE               ((uint32_t)0x00000001U)  /*!< Write blocks in DMA mode            */
+#define SD_REQUEST_ERASE               ((uint32_t)0x00000002U)  /*!< Erase blocks                        */
+/**
+  * @}
+  */
+
+/** @defgroup SDEx_Request_Status Request Status
+  * @{
+  */
+#define SD_REQUEST_STATUS_DONE         ((uint32_t)0x00000000U)  /*!< Request completed without error     */
+#define SD_REQUEST_STATUS_PENDING      ((uint32_t)0x00000001U)  /*!< Request waiting in the queue        */
+#define SD_REQUEST_STATUS_ACTIVE       ((uint32_t)0x00000002U)  /*!< Request being processed             */
+#define SD_REQUEST_STATUS_ERROR        ((uint32_t)0x00000003U)  /*!< Request completed with error        */
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -91,6 +199,57 @@ void HAL_SDEx_Write_DMALnkLstBufCpltCallback(SD_HandleTypeDef *hsd);
   * @}
   */
 
+/** @defgroup SDEx_Exported_Functions_Group2 Write session functions
+  * @{
+  */
+HAL_StatusTypeDef HAL_SDEx_WriteSession_Start(const SD_HandleTypeDef *hsd, SD_WriteSessionTypeDef *pSession,
+                                              uint32_t BlockAdd, uint32_t NumberOfBlocks);
+HAL_StatusTypeDef HAL_SDEx_WriteSession_WriteBlocks(SD_HandleTypeDef *hsd, SD_WriteSessionTypeDef *pSession,
+                                                    const SD_DMALinkedListTypeDef *pLinkedList,
+                                                    uint32_t NumberOfBlocks);
+/**
+  * @}
+  */
+
+/** @defgroup SDEx_Exported_Functions_Group3 Scatter-gather functions
+  * @{
+  */
+HAL_StatusTypeDef HAL_SDEx_ReadBlocksIOVec_DMA(SD_HandleTypeDef *hsd, SD_DMALinkedListTypeDef *pLinkedList,
+                                               SD_DMALinkNodeTypeDef *pNodes, const SD_DMAIOVecTypeDef *pIOVec,
+                                               uint32_t IOVecCount, uint32_t BlockAdd);
+HAL_StatusTypeDef HAL_SDEx_WriteBlocksIOVec_DMA(SD_HandleTypeDef *hsd, SD_DMALinkedListTypeDef *pLinkedList,
+                                                SD_DMALinkNodeTypeDef *pNodes, const SD_DMAIOVecTypeDef *pIOVec,
+                                                uint32_t IOVecCount, uint32_t BlockAdd);
+/**
+  * @}
+  */
+
+/** @defgroup SDEx_Exported_Functions_Group4 Request queue functions
+  * @{
+  */
+HAL_StatusTypeDef HAL_SDEx_RequestQueue_Init(SD_HandleTypeDef *hsd, SD_RequestQueueTypeDef *pQueue);
+HAL_StatusTypeDef HAL_SDEx_RequestQueue_DeInit(SD_HandleTypeDef *hsd);
+HAL_StatusTypeDef HAL_SDEx_RequestQueue_Submit(SD_HandleTypeDef *hsd, SD_RequestTypeDef *pRequest);
+void HAL_SDEx_RequestQueue_IRQHandler(SD_HandleTypeDef *hsd);
+/**
+  * @}
+  */
+
+#if defined (DLYB_SDMMC1) || defined (DLYB_SDMMC2)
+/** @defgroup SDEx_Exported_Functions_Group5 Sampling point tuning functions
+  * @{
+  */
+HAL_StatusTypeDef HAL_SDEx_ExecuteTuning(SD_HandleTypeDef *hsd, SD_TuningTypeDef *pTuning);
+HAL_StatusTypeDef HAL_SDEx_ApplyTuning(SD_HandleTypeDef *hsd, const SD_TuningTypeDef *pTuning);
+#if (USE_SD_TRANSCEIVER != 0U)
+HAL_StatusTypeDef HAL_SDEx_ConfigSpeedBusOperationTuned(SD_HandleTypeDef *hsd, uint32_t SpeedMode,
+                                                        SD_TuningTypeDef *pTuning);
+#endif /* USE_SD_TRANSCEIVER */
+/**
+  * @}
+  */
+#endif /* DLYB_SDMMC1 || DLYB_SDMMC2 */
+
 /**
   * @}
   */
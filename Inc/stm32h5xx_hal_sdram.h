@@ -57,6 +57,30 @@ typedef enum
 
 } HAL_SDRAM_StateTypeDef;
 
+/**
+  * @brief  SDRAM device datasheet parameters structure definition
+  */
+typedef struct
+{
+  uint32_t RefreshPeriod;        /*!< Period in ms within which all the rows must be refreshed (e.g. 64)  */
+
+  uint32_t RowNbr;               /*!< Number of rows to refresh within the refresh period (e.g. 8192)     */
+
+  uint32_t LoadToActiveDelay;    /*!< Load Mode Register to Active delay (tMRD) in SDRAM clock cycles     */
+
+  uint32_t ExitSelfRefreshDelay; /*!< Exit Self-refresh to Active delay (tXSR) in ns                      */
+
+  uint32_t SelfRefreshTime;      /*!< Minimum Active to Precharge delay (tRAS) in ns                      */
+
+  uint32_t RowCycleDelay;        /*!< Refresh to Active / Active to Active delay (tRC) in ns              */
+
+  uint32_t WriteRecoveryTime;    /*!< Write recovery time (tWR) in ns                                     */
+
+  uint32_t RPDelay;              /*!< Precharge to Active delay (tRP) in ns                               */
+
+  uint32_t RCDDelay;             /*!< Active to Read/Write delay (tRCD) in ns                             */
+} SDRAM_DeviceParamTypeDef;
+
 /**
   * @brief  SDRAM handle Structure definition
   */
@@ -76,6 +100,8 @@ typedef struct
 
   DMA_HandleTypeDef             *hdma;      /*!< Pointer DMA handler                   */
 
+  uint32_t                      RegionOffset[4]; /*!< Allocated size of each internal bank */
+
 #if (USE_HAL_SDRAM_REGISTER_CALLBACKS == 1)
   void (* MspInitCallback)(struct __SDRAM_HandleTypeDef *hsdram);               /*!< SDRAM Msp Init callback              */
   void (* MspDeInitCallback)(struct __SDRAM_HandleTypeDef *hsdram);             /*!< SDRAM Msp DeInit callback            */
@@ -203,6 +229,10 @@ HAL_StatusTypeDef HAL_SDRAM_SendCommand(SDRAM_HandleTypeDef *hsdram, FMC_SDRAM_C
 HAL_StatusTypeDef HAL_SDRAM_ProgramRefreshRate(SDRAM_HandleTypeDef *hsdram, uint32_t RefreshRate);
 HAL_StatusTypeDef HAL_SDRAM_SetAutoRefreshNumber(SDRAM_HandleTypeDef *hsdram, uint32_t AutoRefreshNumber);
 uint32_t          HAL_SDRAM_GetModeStatus(SDRAM_HandleTypeDef *hsdram);
+HAL_StatusTypeDef HAL_SDRAM_ComputeTiming(const SDRAM_HandleTypeDef *hsdram, const SDRAM_DeviceParamTypeDef *pParam,
+                                          FMC_SDRAM_TimingTypeDef *pTiming, uint32_t *pRefreshRate);
+HAL_StatusTypeDef HAL_SDRAM_AllocRegion(SDRAM_HandleTypeDef *hsdram, uint32_t InternalBank, uint32_t Size,
+                                        uint32_t *pAddress);
 
 /**
   * @}
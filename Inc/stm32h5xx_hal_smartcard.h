@@ -225,6 +225,11 @@ typedef struct __SMARTCARD_HandleTypeDef
 
   void (*TxISR)(struct __SMARTCARD_HandleTypeDef *huart);  /*!< Function pointer on Tx IRQ handler                    */
 
+  struct __SMARTCARD_T1HandleTypeDef *pT1;                 /*!< T=1 block protocol context, NULL when not used        */
+
+  void (*T1ISR)(struct __SMARTCARD_HandleTypeDef *hsmartcard); /*!< T=1 engine hook called instead of the Tx/Rx DMA
+                                                                    complete callbacks while a block exchange runs */
+
 #if defined(HAL_DMA_MODULE_ENABLED)
   DMA_HandleTypeDef                 *hdmatx;               /*!< SmartCard Tx DMA Handle parameters                    */
 
@@ -363,6 +368,7 @@ typedef enum
 #if (USE_HAL_SMARTCARD_REGISTER_CALLBACKS == 1)
 #define HAL_SMARTCARD_ERROR_INVALID_CALLBACK (0x00000040U)         /*!< Invalid Callback error  */
 #endif /* USE_HAL_SMARTCARD_REGISTER_CALLBACKS */
+#define HAL_SMARTCARD_ERROR_PROTOCOL         (0x00000080U)         /*!< T=1 block protocol error */
 /**
   * @}
   */
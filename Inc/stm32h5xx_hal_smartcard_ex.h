@@ -36,6 +36,74 @@ extern "C" {
   */
 
 /* Exported types ------------------------------------------------------------*/
+/** @defgroup SMARTCARDEx_Exported_Types SMARTCARD Extended Exported Types
+  * @{
+  */
+
+#define SMARTCARD_T1_INF_MAX    254U                             /*!< Largest T=1 information field      */
+#define SMARTCARD_T1_BLOCK_MAX  (3U + SMARTCARD_T1_INF_MAX + 2U) /*!< Prologue, information and epilogue */
+
+/**
+  * @brief  SMARTCARD T=1 block protocol parameters, taken from the card ATR
+  */
+typedef struct
+{
+  uint8_t  NAD;                  /*!< Node address byte sent in every block                                   */
+
+  uint8_t  IFSC;                 /*!< Maximum information field size accepted by the card, 1 to 254           */
+
+  uint32_t EDC;                  /*!< Epilogue error detection code.
+                                      This parameter can be a value of @ref SMARTCARDEx_T1_EDC               */
+
+  uint32_t BWT;                  /*!< Block waiting time in baud blocks, loaded in the receiver timeout
+                                      before the card response starts. Must be lower or equal to 0xFFFFFF    */
+
+  uint32_t CWT;                  /*!< Character waiting time in baud blocks, loaded in the receiver timeout
+                                      once the block prologue is received. Must be lower or equal to 0xFFFFFF */
+} SMARTCARD_T1InitTypeDef;
+
+/**
+  * @brief  SMARTCARD T=1 block protocol context
+  */
+typedef struct __SMARTCARD_T1HandleTypeDef
+{
+  SMARTCARD_T1InitTypeDef Init;                      /*!< T=1 protocol parameters                            */
+
+  uint8_t                 TxBlock[SMARTCARD_T1_BLOCK_MAX]; /*!< Last block sent, kept for retransmission     */
+
+  uint8_t                 RxBlock[SMARTCARD_T1_BLOCK_MAX]; /*!< Block being received                        */
+
+  uint16_t                TxBlockSize;               /*!< Size of the block in TxBlock                       */
+
+  const uint8_t           *pTxData;                  /*!< Command to send                                    */
+
+  uint16_t                TxSize;                    /*!< Command size                                       */
+
+  uint16_t                TxOffset;                  /*!< Command bytes acknowledged by the card             */
+
+  uint16_t                TxChunk;                   /*!< Command bytes carried by the pending I-block       */
+
+  uint8_t                 *pRxData;                  /*!< Response buffer                                    */
+
+  uint16_t                RxSize;                    /*!< Response buffer size                               */
+
+  uint16_t                RxLength;                  /*!< Response bytes received                            */
+
+  uint8_t                 SeqTx;                     /*!< Send sequence number of the next reader I-block    */
+
+  uint8_t                 SeqRx;                     /*!< Expected send sequence number of the card I-block  */
+
+  uint8_t                 Retry;                     /*!< Retransmissions done for the current block         */
+
+  __IO uint8_t            Step;                      /*!< Block exchange step                                */
+
+  uint32_t                WaitTime;                  /*!< Receiver timeout used for the next card response   */
+} SMARTCARD_T1HandleTypeDef;
+
+/**
+  * @}
+  */
+
 /* Exported constants --------------------------------------------------------*/
 
 /** @addtogroup SMARTCARDEx_Exported_Constants  SMARTCARD Extended Exported Constants
@@ -51,6 +119,15 @@ extern "C" {
   * @}
   */
 
+/** @defgroup SMARTCARDEx_T1_EDC SMARTCARD T=1 Error Detection Code
+  * @{
+  */
+#define SMARTCARD_T1_EDC_LRC        0x00000000U  /*!< One byte longitudinal redundancy check         */
+#define SMARTCARD_T1_EDC_CRC        0x00000001U  /*!< Two bytes cyclic redundancy check (ISO 13239)  */
+/**
+  * @}
+  */
+
 /** @defgroup SMARTCARDEx_Advanced_Features_Initialization_Type SMARTCARD advanced feature initialization type
   * @{
   */
@@ -261,6 +338,13 @@ extern "C" {
                                                       ((__THRESHOLD__) == SMARTCARD_RXFIFO_THRESHOLD_7_8) || \
                                                       ((__THRESHOLD__) == SMARTCARD_RXFIFO_THRESHOLD_8_8))
 
+/** @brief  Ensure that SMARTCARD T=1 error detection code is valid.
+  * @param  __EDC__ SMARTCARD T=1 error detection code.
+  * @retval SET (__EDC__ is valid) or RESET (__EDC__ is invalid)
+  */
+#define IS_SMARTCARD_T1_EDC(__EDC__) (((__EDC__) == SMARTCARD_T1_EDC_LRC) || \
+                                      ((__EDC__) == SMARTCARD_T1_EDC_CRC))
+
 /**
   * @}
   */
@@ -296,6 +380,13 @@ HAL_StatusTypeDef HAL_SMARTCARDEx_DisableReceiverTimeOut(SMARTCARD_HandleTypeDef
 void HAL_SMARTCARDEx_RxFifoFullCallback(SMARTCARD_HandleTypeDef *hsmartcard);
 void HAL_SMARTCARDEx_TxFifoEmptyCallback(SMARTCARD_HandleTypeDef *hsmartcard);
 
+#if defined(HAL_DMA_MODULE_ENABLED)
+HAL_StatusTypeDef HAL_SMARTCARDEx_T1_Init(SMARTCARD_HandleTypeDef *hsmartcard, SMARTCARD_T1HandleTypeDef *pT1);
+HAL_StatusTypeDef HAL_SMARTCARDEx_T1_Transceive_DMA(SMARTCARD_HandleTypeDef *hsmartcard, const uint8_t *pTxData,
+                                                    uint16_t TxSize, uint8_t *pRxData, uint16_t RxSize);
+void HAL_SMARTCARDEx_T1_TransceiveCpltCallback(SMARTCARD_HandleTypeDef *hsmartcard);
+#endif /* HAL_DMA_MODULE_ENABLED */
+
 /**
   * @}
   */
@@ -130,11 +130,7 @@ typedef struct
   * @brief  SMBUS handle Structure definition
   * @{
   */
-#if (USE_HAL_SMBUS_REGISTER_CALLBACKS == 1)
 typedef struct __SMBUS_HandleTypeDef
-#else
-typedef struct
-#endif  /* USE_HAL_SMBUS_REGISTER_CALLBACKS */
 {
   I2C_TypeDef                  *Instance;       /*!< SMBUS registers base address       */
 
@@ -156,6 +152,17 @@ typedef struct
 
   __IO uint32_t                ErrorCode;       /*!< SMBUS Error code                   */
 
+  struct __SMBUS_CommandTypeDef *pCmds;         /*!< Pointer to the ongoing command list */
+
+  uint32_t                     CmdNbr;          /*!< Number of commands in the list     */
+
+  __IO uint32_t                CmdIndex;        /*!< Index of the ongoing (or failing) command */
+
+  __IO uint32_t                CmdStep;         /*!< Step of the ongoing command: 0 command code write, 1 data read */
+
+  void (*CmdISR)(struct __SMBUS_HandleTypeDef *hsmbus);
+  /*!< SMBUS command list handler function pointer, called at end of each transfer, NULL when no list is ongoing */
+
 #if (USE_HAL_SMBUS_REGISTER_CALLBACKS == 1)
   void (* MasterTxCpltCallback)(struct __SMBUS_HandleTypeDef *hsmbus);
   /*!< SMBUS Master Tx Transfer completed callback */
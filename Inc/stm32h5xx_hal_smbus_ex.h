@@ -37,6 +37,29 @@ extern "C" {
 
 /* Exported types ------------------------------------------------------------*/
 /* Exported constants --------------------------------------------------------*/
+/** @defgroup SMBUSEx_Exported_Types SMBUS Extended Exported Types
+  * @{
+  */
+
+/**
+  * @brief  SMBUS command structure definition, one read command of the command list
+  */
+typedef struct __SMBUS_CommandTypeDef
+{
+  uint16_t DevAddress;   /*!< Target device address, the 7 bits address value must be shifted to the left */
+
+  uint8_t  Command;      /*!< Command code, e.g. PMBus READ_VOUT (0x8B) or READ_IOUT (0x8C)               */
+
+  uint8_t  *pData;       /*!< Pointer to data buffer, one more byte is needed to store the PEC byte
+                              when Packet Error Check is enabled                                        */
+
+  uint16_t Size;         /*!< Amount of data to be read, PEC byte excluded                               */
+} SMBUS_CommandTypeDef;
+
+/**
+  * @}
+  */
+
 /** @defgroup SMBUSEx_Exported_Constants SMBUS Extended Exported Constants
   * @{
   */
@@ -86,6 +109,16 @@ HAL_StatusTypeDef HAL_SMBUSEx_ConfigFastModePlus(SMBUS_HandleTypeDef *hsmbus, ui
   * @}
   */
 
+/** @addtogroup SMBUSEx_Exported_Functions_Group4 Command List Functions
+  * @{
+  */
+HAL_StatusTypeDef HAL_SMBUSEx_CommandList_IT(SMBUS_HandleTypeDef *hsmbus, SMBUS_CommandTypeDef *pCmds,
+                                             uint32_t CmdNbr);
+void HAL_SMBUSEx_CommandListCpltCallback(SMBUS_HandleTypeDef *hsmbus);
+/**
+  * @}
+  */
+
 /**
   * @}
   */
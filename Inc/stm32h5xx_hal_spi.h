@@ -27,6 +27,11 @@ extern "C" {
 /* Includes ------------------------------------------------------------------*/
 #include "stm32h5xx_hal_def.h"
 
+/* DMA transfers of the driver, removed when USE_HAL_SPI_DMA is set to 0 in the HAL configuration */
+#if defined(HAL_DMA_MODULE_ENABLED) && (!defined(USE_HAL_SPI_DMA) || (USE_HAL_SPI_DMA == 1U))
+#define HAL_SPI_DMA_ENABLED
+#endif /* HAL_DMA_MODULE_ENABLED && USE_HAL_SPI_DMA */
+
 /** @addtogroup STM32H5xx_HAL_Driver
   * @{
   */
@@ -152,6 +157,69 @@ typedef enum
 } HAL_SPI_StateTypeDef;
 
 
+struct __SPI_HandleTypeDef;
+
+/**
+  * @brief  SPI slave mailbox structure definition
+  */
+typedef struct __SPI_MailboxTypeDef
+{
+  const uint8_t                   *pSlots;           /*!< Response table: SlotNbr slots of SlotSize bytes, the slot
+                                                          of a command is the command byte times SlotSize     */
+
+  uint32_t                        SlotSize;          /*!< Number of response bytes clocked by the master after
+                                                          the command byte                                    */
+
+  uint32_t                        SlotNbr;           /*!< Number of slots of the table, from 1 to 256. Commands
+                                                          without a slot are answered with UnderrunPattern    */
+
+  uint32_t                        UnderrunPattern;   /*!< Byte sent when no response is loaded, i.e. during the
+                                                          command byte and for unknown commands               */
+
+  void (* CommandCallback)(struct __SPI_HandleTypeDef *hspi,
+                           uint32_t Command);        /*!< Called once the response of a command is loaded,
+                                                          can be NULL                                         */
+
+  const uint8_t                   *pTxPtr;           /*!< Next response byte to load (internal use)           */
+
+  uint32_t                        TxCount;           /*!< Response bytes left to load (internal use)          */
+
+  uint32_t                        RxCount;           /*!< Response bytes left to be clocked (internal use)    */
+} SPI_MailboxTypeDef;
+
+#if defined(HAL_SPI_DMA_ENABLED)
+/**
+  * @brief  SPI transaction descriptor structure definition
+  */
+typedef struct __SPI_TransactionTypeDef
+{
+  GPIO_TypeDef                    *CSPort;           /*!< Chip select GPIO port, driven low during the transaction.
+                                                          NULL when chip select is not managed by the queue   */
+
+  uint16_t                        CSPin;             /*!< Chip select GPIO pin.
+                                                          This parameter can be a value of @ref GPIO_pins     */
+
+  uint32_t                        CLKPolarity;       /*!< Serial clock steady state of the addressed device.
+                                                          This parameter can be a value of @ref SPI_Clock_Polarity */
+
+  uint32_t                        CLKPhase;          /*!< Clock active edge for the bit capture of the addressed device.
+                                                          This parameter can be a value of @ref SPI_Clock_Phase */
+
+  const uint8_t                   *pTxData;          /*!< Pointer to the Tx buffer, NULL for a receive only transaction */
+
+  uint8_t                         *pRxData;          /*!< Pointer to the Rx buffer, NULL for a transmit only
+                                                          transaction                                         */
+
+  uint16_t                        Size;              /*!< Amount of data to be sent and/or received           */
+
+  void (* XferCpltCallback)(struct __SPI_HandleTypeDef *hspi,
+                            struct __SPI_TransactionTypeDef *pTransaction); /*!< Transaction complete callback,
+                                                          can be NULL                                         */
+
+  struct __SPI_TransactionTypeDef *pNext;            /*!< Pointer to the next transaction, NULL for the last one */
+} SPI_TransactionTypeDef;
+
+#endif /* HAL_SPI_DMA_ENABLED */
 /**
   * @brief  SPI handle Structure definition
   */
@@ -179,11 +247,29 @@ typedef struct __SPI_HandleTypeDef
 
   void (*TxISR)(struct __SPI_HandleTypeDef *hspi);         /*!< function pointer on Tx ISR               */
 
-#if defined(HAL_DMA_MODULE_ENABLED)
+  SPI_MailboxTypeDef         *pMailbox;                    /*!< Pointer to the ongoing slave mailbox, NULL when
+                                                                no mailbox is ongoing                 */
+
+#if defined(HAL_SPI_DMA_ENABLED)
   DMA_HandleTypeDef          *hdmatx;                      /*!< SPI Tx DMA Handle parameters             */
 
   DMA_HandleTypeDef          *hdmarx;                      /*!< SPI Rx DMA Handle parameters             */
-#endif /* HAL_DMA_MODULE_ENABLED */
+
+  SPI_TransactionTypeDef     *pTransaction;                /*!< Pointer to the ongoing transaction of the queue */
+
+  void (*TransactionISR)(struct __SPI_HandleTypeDef *hspi); /*!< function pointer on transaction queue handler,
+                                                                 called at end of transfer or on error, NULL when
+                                                                 no transaction queue is ongoing      */
+
+  DMA_NodeTypeDef            *pStreamNode;                 /*!< DMA node of the second Rx stream buffer, NULL when
+                                                                no Rx stream is ongoing               */
+
+  __IO uint32_t              StreamBuffIdx;                /*!< Index (0 or 1) of the Rx stream buffer being filled */
+
+#if defined(USE_HAL_REQUEST) && (USE_HAL_REQUEST == 1U)
+  struct __HAL_RequestTypeDef *pRequest;                   /*!< Pointer to the ongoing asynchronous request */
+#endif /* USE_HAL_REQUEST */
+#endif /* HAL_SPI_DMA_ENABLED */
 
   HAL_LockTypeDef            Lock;                         /*!< Locking object                           */
 
@@ -191,6 +277,10 @@ typedef struct __SPI_HandleTypeDef
 
   __IO uint32_t              ErrorCode;                    /*!< SPI Error code                           */
 
+#if defined(USE_HAL_OS_HOOKS) && (USE_HAL_OS_HOOKS == 1U)
+  __IO uint32_t              OsWaiting;                    /*!< A thread waits for the end of the transfer
+                                                                with HAL_OS_Wait()                    */
+#endif /* USE_HAL_OS_HOOKS */
 
 #if (USE_HAL_SPI_REGISTER_CALLBACKS == 1UL)
   void (* TxCpltCallback)(struct __SPI_HandleTypeDef *hspi);       /*!< SPI Tx Completed callback          */
@@ -261,9 +351,9 @@ typedef  void (*pSPI_CallbackTypeDef)(SPI_HandleTypeDef *hspi); /*!< pointer to
 #define HAL_SPI_ERROR_CRC                             (0x00000002UL)   /*!< CRC error                              */
 #define HAL_SPI_ERROR_OVR                             (0x00000004UL)   /*!< OVR error                              */
 #define HAL_SPI_ERROR_FRE                             (0x00000008UL)   /*!< FRE error                              */
-#if defined(HAL_DMA_MODULE_ENABLED)
+#if defined(HAL_SPI_DMA_ENABLED)
 #define HAL_SPI_ERROR_DMA                             (0x00000010UL)   /*!< DMA transfer error                     */
-#endif /* HAL_DMA_MODULE_ENABLED */
+#endif /* HAL_SPI_DMA_ENABLED */
 #define HAL_SPI_ERROR_FLAG                            (0x00000020UL)   /*!< Error on RXP/TXP/DXP/FTLVL/FRLVL Flag  */
 #define HAL_SPI_ERROR_ABORT                           (0x00000040UL)   /*!< Error during SPI Abort procedure       */
 #define HAL_SPI_ERROR_UDR                             (0x00000080UL)   /*!< Underrun error                         */
@@ -854,25 +944,26 @@ HAL_StatusTypeDef HAL_SPI_Receive_IT(SPI_HandleTypeDef *hspi, uint8_t *pData, ui
 HAL_StatusTypeDef HAL_SPI_TransmitReceive_IT(SPI_HandleTypeDef *hspi, const uint8_t *pTxData, uint8_t *pRxData,
                                              uint16_t Size);
 
-#if defined(HAL_DMA_MODULE_ENABLED)
+#if defined(HAL_SPI_DMA_ENABLED)
 HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, const uint8_t *pData, uint16_t Size);
 HAL_StatusTypeDef HAL_SPI_Receive_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size);
 HAL_StatusTypeDef HAL_SPI_TransmitReceive_DMA(SPI_HandleTypeDef *hspi, const uint8_t *pTxData, uint8_t *pRxData,
                                               uint16_t Size);
-#endif /* HAL_DMA_MODULE_ENABLED */
+#endif /* HAL_SPI_DMA_ENABLED */
 
 
-#if defined(HAL_DMA_MODULE_ENABLED)
+#if defined(HAL_SPI_DMA_ENABLED)
 HAL_StatusTypeDef HAL_SPI_DMAPause(SPI_HandleTypeDef *hspi);
 HAL_StatusTypeDef HAL_SPI_DMAResume(SPI_HandleTypeDef *hspi);
 HAL_StatusTypeDef HAL_SPI_DMAStop(SPI_HandleTypeDef *hspi);
-#endif /* HAL_DMA_MODULE_ENABLED */
+#endif /* HAL_SPI_DMA_ENABLED */
 
 /* Transfer Abort functions */
 HAL_StatusTypeDef HAL_SPI_Abort(SPI_HandleTypeDef *hspi);
 HAL_StatusTypeDef HAL_SPI_Abort_IT(SPI_HandleTypeDef *hspi);
 
 void HAL_SPI_IRQHandler(SPI_HandleTypeDef *hspi);
+void HAL_SPI_FastIRQHandler(SPI_HandleTypeDef *hspi);
 void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi);
 void HAL_SPI_RxCpltCallback(SPI_HandleTypeDef *hspi);
 void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef *hspi);
@@ -80,6 +80,20 @@ HAL_StatusTypeDef HAL_SPIEx_ConfigureUnderrun(SPI_HandleTypeDef *hspi, uint32_t
 HAL_StatusTypeDef HAL_SPIEx_EnableDelayReadDataSampling(SPI_HandleTypeDef *hspi);
 HAL_StatusTypeDef HAL_SPIEx_DisableDelayReadDataSampling(SPI_HandleTypeDef *hspi);
 #endif /* SPI_CFG1_DRDS */
+HAL_StatusTypeDef HAL_SPIEx_MailboxStart(SPI_HandleTypeDef *hspi, SPI_MailboxTypeDef *pMailbox);
+HAL_StatusTypeDef HAL_SPIEx_MailboxStop(SPI_HandleTypeDef *hspi);
+#if defined(HAL_SPI_DMA_ENABLED)
+HAL_StatusTypeDef HAL_SPIEx_TransactionQueue_DMA(SPI_HandleTypeDef *hspi, SPI_TransactionTypeDef *pTransaction);
+HAL_StatusTypeDef HAL_SPIEx_AbortTransactionQueue(SPI_HandleTypeDef *hspi);
+HAL_StatusTypeDef HAL_SPIEx_StreamStart(SPI_HandleTypeDef *hspi, DMA_NodeTypeDef *pNode, uint8_t *pBuffer0,
+                                        uint8_t *pBuffer1, uint16_t Size);
+HAL_StatusTypeDef HAL_SPIEx_StreamStop(SPI_HandleTypeDef *hspi);
+uint8_t *HAL_SPIEx_StreamGetCpltBuffer(const SPI_HandleTypeDef *hspi);
+HAL_StatusTypeDef HAL_SPIEx_StreamSetNextBuffer(SPI_HandleTypeDef *hspi, uint8_t *pBuffer);
+#if defined(USE_HAL_REQUEST) && (USE_HAL_REQUEST == 1U)
+HAL_StatusTypeDef HAL_SPIEx_Request_Start(HAL_RequestTypeDef *pReq);
+#endif /* USE_HAL_REQUEST */
+#endif /* HAL_SPI_DMA_ENABLED */
 /**
   * @}
   */
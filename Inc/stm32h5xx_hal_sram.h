@@ -171,6 +171,8 @@ HAL_StatusTypeDef HAL_SRAM_Read_DMA(SRAM_HandleTypeDef *hsram, uint32_t *pAddres
                                     uint32_t BufferSize);
 HAL_StatusTypeDef HAL_SRAM_Write_DMA(SRAM_HandleTypeDef *hsram, uint32_t *pAddress, uint32_t *pSrcBuffer,
                                      uint32_t BufferSize);
+HAL_StatusTypeDef HAL_SRAM_Copy2D_DMA(SRAM_HandleTypeDef *hsram, const uint32_t *pSrcAddress, uint32_t *pDstAddress,
+                                      uint32_t Width, uint32_t Height, uint32_t SrcPitch, uint32_t DstPitch);
 
 void HAL_SRAM_DMA_XferCpltCallback(DMA_HandleTypeDef *hdma);
 void HAL_SRAM_DMA_XferErrorCallback(DMA_HandleTypeDef *hdma);
@@ -195,6 +197,7 @@ HAL_StatusTypeDef HAL_SRAM_RegisterDmaCallback(SRAM_HandleTypeDef *hsram, HAL_SR
 /* SRAM Control functions  ****************************************************/
 HAL_StatusTypeDef HAL_SRAM_WriteOperation_Enable(SRAM_HandleTypeDef *hsram);
 HAL_StatusTypeDef HAL_SRAM_WriteOperation_Disable(SRAM_HandleTypeDef *hsram);
+HAL_StatusTypeDef HAL_SRAM_ConfigDMABurst(SRAM_HandleTypeDef *hsram);
 
 /**
   * @}
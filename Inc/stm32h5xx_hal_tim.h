@@ -373,6 +373,8 @@ typedef struct
   __IO HAL_TIM_ChannelStateTypeDef   ChannelState[6];   /*!< TIM channel operation state                       */
   __IO HAL_TIM_ChannelStateTypeDef   ChannelNState[4];  /*!< TIM complementary channel operation state         */
   __IO HAL_TIM_DMABurstStateTypeDef  DMABurstState;     /*!< DMA burst operation state                         */
+  struct __TIM_PWMStreamTypeDef      *pPWMStream;       /*!< PWM sequence stream, NULL when not running        */
+  struct __TIM_ICStreamTypeDef       *pICStream;        /*!< Input capture stream, NULL when not running       */
 
 #if (USE_HAL_TIM_REGISTER_CALLBACKS == 1)
   void (* Base_MspInitCallback)(struct __TIM_HandleTypeDef *htim);              /*!< TIM Base Msp Init Callback                              */
@@ -1830,6 +1832,43 @@ mode.
 #define __HAL_TIM_SELECT_CCDMAREQUEST(__HANDLE__, __CCDMA__)    \
   MODIFY_REG((__HANDLE__)->Instance->CR2, TIM_CR2_CCDS, (__CCDMA__))
 
+/**
+  * @brief  Enable the TIM Capture/Compare channel output, without state check.
+  * @note   With __HAL_TIM_ENABLE(), this restarts in a single register write a PWM or output
+  *         compare channel already configured and started once by the HAL, for inner loops.
+  *         The channel state of the handle is not updated.
+  * @param  __HANDLE__ TIM handle.
+  * @param  __CHANNEL__ TIM Channel associated with the capture compare register
+  *          This parameter can be one of the following values:
+  *            @arg TIM_CHANNEL_1: TIM Channel 1 selected
+  *            @arg TIM_CHANNEL_2: TIM Channel 2 selected
+  *            @arg TIM_CHANNEL_3: TIM Channel 3 selected
+  *            @arg TIM_CHANNEL_4: TIM Channel 4 selected
+  *            @arg TIM_CHANNEL_5: TIM Channel 5 selected
+  *            @arg TIM_CHANNEL_6: TIM Channel 6 selected
+  * @retval None
+  */
+#define __HAL_TIM_ENABLE_CCx(__HANDLE__, __CHANNEL__)    \
+  ((__HANDLE__)->Instance->CCER |= (TIM_CCER_CC1E << ((__CHANNEL__) & 0x1FU)))
+
+/**
+  * @brief  Disable the TIM Capture/Compare channel output, without state check.
+  * @note   The counter and the main output are not disabled, the channel state of the handle
+  *         is not updated.
+  * @param  __HANDLE__ TIM handle.
+  * @param  __CHANNEL__ TIM Channel associated with the capture compare register
+  *          This parameter can be one of the following values:
+  *            @arg TIM_CHANNEL_1: TIM Channel 1 selected
+  *            @arg TIM_CHANNEL_2: TIM Channel 2 selected
+  *            @arg TIM_CHANNEL_3: TIM Channel 3 selected
+  *            @arg TIM_CHANNEL_4: TIM Channel 4 selected
+  *            @arg TIM_CHANNEL_5: TIM Channel 5 selected
+  *            @arg TIM_CHANNEL_6: TIM Channel 6 selected
+  * @retval None
+  */
+#define __HAL_TIM_DISABLE_CCx(__HANDLE__, __CHANNEL__)    \
+  ((__HANDLE__)->Instance->CCER &= ~(TIM_CCER_CC1E << ((__CHANNEL__) & 0x1FU)))
+
 /**
   * @}
   */
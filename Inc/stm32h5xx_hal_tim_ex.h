@@ -93,6 +93,128 @@ typedef struct
 
 } TIMEx_EncoderIndexConfigTypeDef;
 
+/**
+  * @brief  TIM PWM sequence streaming structure definition
+  * @note   The buffer is provided by the user and must stay allocated while the stream runs.
+  */
+typedef struct __TIM_PWMStreamTypeDef
+{
+  uint32_t          *pBuffer;           /*!< DMA buffer of two halves of HalfFrames frames. A frame holds the
+                                             NbChannels compare values loaded by the DMA burst at an update event */
+
+  uint32_t          HalfFrames;         /*!< Number of frames per half buffer */
+
+  uint32_t          FirstChannel;       /*!< First channel of a frame: TIM_CHANNEL_1 to TIM_CHANNEL_4 */
+
+  uint32_t          NbChannels;         /*!< Number of consecutive channels of a frame, from 1 to 4 */
+
+  uint32_t          *pRefill;           /*!< Half buffer to be refilled, updated before each period elapsed
+                                             half complete and complete callback */
+
+  uint32_t          HalfIndex;          /*!< Number of half buffers played since the stream start */
+
+  uint32_t          Underruns;          /*!< Number of half buffers played again because not refilled in time */
+
+  __IO uint32_t     RefillPending;      /*!< Set when a half buffer is released, cleared by
+                                             HAL_TIMEx_PWMStream_Refilled() */
+} TIM_PWMStreamTypeDef;
+
+/**
+  * @brief  Number of counter overflows queued between two input capture stream reads
+  */
+#define TIM_ICSTREAM_MARKS               8U
+
+/**
+  * @brief  TIM input capture streaming structure definition
+  * @note   The buffer is provided by the user and must stay allocated while the stream runs.
+  *         Only pBuffer, Size and Channel are set by the user, the other fields are managed by the driver.
+  */
+typedef struct __TIM_ICStreamTypeDef
+{
+  uint32_t          *pBuffer;                       /*!< DMA ring of the raw captured values */
+
+  uint32_t          Size;                           /*!< Number of captures of the ring */
+
+  uint32_t          Channel;                        /*!< Captured channel: TIM_CHANNEL_1 to TIM_CHANNEL_4 */
+
+  uint32_t          ReadIndex;                      /*!< Next capture to read in the ring */
+
+  uint32_t          ReadCount;                      /*!< Number of captures read since the stream start */
+
+  uint32_t          LastCapture;                    /*!< Last raw value read */
+
+  uint32_t          Epoch;                          /*!< Number of counter overflows before the last capture read */
+
+  uint32_t          WriteIndex;                     /*!< Ring position at the last counter overflow */
+
+  uint32_t          WriteCount;                     /*!< Number of captures at the last counter overflow */
+
+  uint32_t          MarkCount[TIM_ICSTREAM_MARKS];  /*!< Number of captures at each queued counter overflow */
+
+  uint32_t          MarkWraps[TIM_ICSTREAM_MARKS];  /*!< Counter overflows merged in each queued mark */
+
+  uint32_t          MarkUsed;                       /*!< Overflows of the oldest mark already accounted */
+
+  __IO uint32_t     MarkWr;                         /*!< Marks queued by the update interrupt */
+
+  uint32_t          MarkRd;                         /*!< Marks consumed by HAL_TIMEx_ICStream_Read() */
+
+  uint32_t          MarkOverruns;                   /*!< Overflows queued while the marks queue was full */
+} TIM_ICStreamTypeDef;
+
+/**
+  * @brief  TIM encoder speed estimation structure definition (M/T method)
+  * @note   Only htimCapture, Channel, Scale and Timeout are set by the user, the other fields are managed
+  *         by the driver.
+  */
+typedef struct __TIM_EncoderSpeedTypeDef
+{
+  TIM_HandleTypeDef *htimCapture;   /*!< Free running time base capturing the encoder clock (TRGO) edges */
+
+  uint32_t          Channel;        /*!< Time base channel configured in input capture on TRC:
+                                         TIM_CHANNEL_1 to TIM_CHANNEL_4 */
+
+  uint64_t          Scale;          /*!< Speed unit: Speed = encoder counts x Scale / time base ticks,
+                                         e.g. time base frequency x 60 / counts per revolution for RPM */
+
+  uint32_t          Timeout;        /*!< Time base ticks without encoder edge after which the speed is 0 */
+
+  int32_t           Speed;          /*!< Estimated speed, signed with the counting direction */
+
+  int32_t           Position;       /*!< Encoder counts accumulated since the start */
+
+  uint32_t          LastCount;      /*!< Encoder counter at the last edge taken into account */
+
+  uint32_t          LastStamp;      /*!< Time base capture of the last edge taken into account */
+
+  __IO uint32_t     EdgeCount;      /*!< Encoder counter copied by the DMA at each captured edge */
+} TIM_EncoderSpeedTypeDef;
+
+/**
+  * @brief  TIM group member definition
+  */
+typedef struct
+{
+  TIM_HandleTypeDef *htim;          /*!< Member TIM handle, initialized with its channels configured */
+
+  uint32_t          Channels;       /*!< Channels enabled by the group start.
+                                         This parameter can be a combination of @ref TIMEx_Group_Channels */
+
+  uint32_t          Trigger;        /*!< Trigger input connected to the master TRGO, ignored for the master.
+                                         This parameter can be a value of @ref TIM_Trigger_Selection */
+} TIM_GroupMemberTypeDef;
+
+/**
+  * @brief  TIM group definition
+  * @note   The first member is the master, the other members are gated by its counter enable.
+  */
+typedef struct
+{
+  TIM_GroupMemberTypeDef *pMembers; /*!< Members of the group, the master first */
+
+  uint32_t          NbMembers;      /*!< Number of members of the group */
+} TIM_GroupTypeDef;
+
 /**
   * @}
   */
@@ -545,6 +667,18 @@ typedef struct
   * @}
   */
 
+/** @defgroup TIMEx_Group_Channels TIM Extended group member channels
+  * @{
+  */
+#define TIM_GROUP_CHANNEL_NONE                       0x00000000U                   /*!< No channel enabled by the group start */
+#define TIM_GROUP_CHANNEL_1                          0x00000001U                   /*!< Channel 1 enabled by the group start  */
+#define TIM_GROUP_CHANNEL_2                          0x00000002U                   /*!< Channel 2 enabled by the group start  */
+#define TIM_GROUP_CHANNEL_3                          0x00000004U                   /*!< Channel 3 enabled by the group start  */
+#define TIM_GROUP_CHANNEL_4                          0x00000008U                   /*!< Channel 4 enabled by the group start  */
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -1381,6 +1515,40 @@ HAL_TIM_ChannelStateTypeDef HAL_TIMEx_GetChannelNState(const TIM_HandleTypeDef *
   * @}
   */
 
+/** @addtogroup TIMEx_Exported_Functions_Group8 Extended DMA streaming functions
+  * @brief    Extended DMA streaming functions
+  * @{
+  */
+/* Extended DMA streaming functions  ******************************************/
+HAL_StatusTypeDef HAL_TIMEx_PWMStream_Start(TIM_HandleTypeDef *htim, TIM_PWMStreamTypeDef *pStream);
+HAL_StatusTypeDef HAL_TIMEx_PWMStream_Stop(TIM_HandleTypeDef *htim);
+HAL_StatusTypeDef HAL_TIMEx_PWMStream_Refilled(TIM_HandleTypeDef *htim);
+HAL_StatusTypeDef HAL_TIMEx_ICStream_Start(TIM_HandleTypeDef *htim, TIM_ICStreamTypeDef *pStream);
+HAL_StatusTypeDef HAL_TIMEx_ICStream_Stop(TIM_HandleTypeDef *htim);
+HAL_StatusTypeDef HAL_TIMEx_ICStream_Read(TIM_HandleTypeDef *htim, uint64_t *pTimestamps, uint32_t MaxCount,
+                                          uint32_t *pCount);
+uint32_t HAL_TIMEx_ICStream_DecodePeriods(const uint64_t *pTimestamps, uint32_t Count, uint32_t *pPeriods);
+uint32_t HAL_TIMEx_ICStream_DecodePWM(const uint64_t *pTimestamps, uint32_t Count, uint32_t *pPeriods,
+                                      uint32_t *pPulses);
+HAL_StatusTypeDef HAL_TIMEx_EncoderSpeed_Start(TIM_HandleTypeDef *htim, TIM_EncoderSpeedTypeDef *pSpeed);
+HAL_StatusTypeDef HAL_TIMEx_EncoderSpeed_Stop(TIM_HandleTypeDef *htim, TIM_EncoderSpeedTypeDef *pSpeed);
+HAL_StatusTypeDef HAL_TIMEx_EncoderSpeed_Update(const TIM_HandleTypeDef *htim, TIM_EncoderSpeedTypeDef *pSpeed);
+/**
+  * @}
+  */
+
+/** @addtogroup TIMEx_Exported_Functions_Group9 Extended timer group functions
+  * @brief    Extended timer group functions
+  * @{
+  */
+/* Extended timer group functions  ********************************************/
+HAL_StatusTypeDef HAL_TIMEx_Group_Config(const TIM_GroupTypeDef *pGroup);
+HAL_StatusTypeDef HAL_TIMEx_Group_Start(const TIM_GroupTypeDef *pGroup);
+HAL_StatusTypeDef HAL_TIMEx_Group_Stop(const TIM_GroupTypeDef *pGroup);
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -1392,6 +1560,7 @@ HAL_TIM_ChannelStateTypeDef HAL_TIMEx_GetChannelNState(const TIM_HandleTypeDef *
   */
 void TIMEx_DMACommutationCplt(DMA_HandleTypeDef *hdma);
 void TIMEx_DMACommutationHalfCplt(DMA_HandleTypeDef *hdma);
+void TIMEx_ICStreamOverflow(TIM_HandleTypeDef *htim);
 /**
   * @}
   */
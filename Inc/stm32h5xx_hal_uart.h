@@ -27,6 +27,11 @@ extern "C" {
 /* Includes ------------------------------------------------------------------*/
 #include "stm32h5xx_hal_def.h"
 
+/* DMA transfers of the driver, removed when USE_HAL_UART_DMA is set to 0 in the HAL configuration */
+#if defined(HAL_DMA_MODULE_ENABLED) && (!defined(USE_HAL_UART_DMA) || (USE_HAL_UART_DMA == 1U))
+#define HAL_UART_DMA_ENABLED
+#endif /* HAL_DMA_MODULE_ENABLED && USE_HAL_UART_DMA */
+
 /** @addtogroup STM32H5xx_HAL_Driver
   * @{
   */
@@ -120,11 +125,11 @@ typedef struct
   uint32_t OverrunDisable;        /*!< Specifies whether the reception overrun detection is disabled.
                                        This parameter can be a value of @ref UART_Overrun_Disable. */
 
-#if defined(HAL_DMA_MODULE_ENABLED)
+#if defined(HAL_UART_DMA_ENABLED)
   uint32_t DMADisableonRxError;   /*!< Specifies whether the DMA is disabled in case of reception error.
                                        This parameter can be a value of @ref UART_DMA_Disable_on_Rx_Error. */
 
-#endif /* HAL_DMA_MODULE_ENABLED */
+#endif /* HAL_UART_DMA_ENABLED */
   uint32_t AutoBaudRateEnable;    /*!< Specifies whether auto Baud rate detection is enabled.
                                        This parameter can be a value of @ref UART_AutoBaudRate_Enable. */
 
@@ -214,6 +219,34 @@ typedef uint32_t HAL_UART_RxTypeTypeDef;
   */
 typedef uint32_t HAL_UART_RxEventTypeTypeDef;
 
+#if defined(HAL_UART_DMA_ENABLED)
+/**
+  * @brief  UART Rx stream ring structure definition
+  * @note   Single producer (UART/DMA interrupt context) / single consumer ring:
+  *         WriteCount is only updated from interrupt context, ReadCount is only updated by the consumer.
+  *         Both are free running counters, their difference gives the number of unread bytes.
+  */
+typedef struct
+{
+  uint8_t                  *pBuffer;                 /*!< Pointer to the stream ring buffer                    */
+
+  uint16_t                 Size;                     /*!< Size of the stream ring buffer in bytes              */
+
+  uint16_t                 LastPos;                  /*!< DMA write position at the last processed Rx event    */
+
+  __IO uint32_t            WriteCount;               /*!< Total number of bytes written by DMA (producer side) */
+
+  __IO uint32_t            ReadCount;                /*!< Total number of bytes consumed (consumer side)       */
+
+  __IO uint32_t            OverrunCount;             /*!< Number of Rx events detecting unread data overwrite  */
+
+  uint32_t                 FrameDelimiter;           /*!< Events ending a frame, 0 when framing is not used.
+                                                          Combination of @ref UARTEx_RxFrame_Delimiter      */
+
+  uint32_t                 FrameStart;               /*!< Value of WriteCount at the start of the current frame */
+} UART_RxStreamTypeDef;
+
+#endif /* HAL_UART_DMA_ENABLED */
 /**
   * @brief  UART handle Structure definition
   */
@@ -254,12 +287,21 @@ typedef struct __UART_HandleTypeDef
 
   void (*TxISR)(struct __UART_HandleTypeDef *huart); /*!< Function pointer on Tx IRQ handler */
 
-#if defined(HAL_DMA_MODULE_ENABLED)
+#if defined(HAL_UART_DMA_ENABLED)
   DMA_HandleTypeDef        *hdmatx;                  /*!< UART Tx DMA Handle parameters      */
 
   DMA_HandleTypeDef        *hdmarx;                  /*!< UART Rx DMA Handle parameters      */
 
-#endif /* HAL_DMA_MODULE_ENABLED */
+  UART_RxStreamTypeDef     *pRxStream;               /*!< Pointer to the Rx stream ring, NULL when no Rx stream
+                                                          is ongoing                          */
+
+  __IO uint32_t            TxQueueNbr;               /*!< Number of messages queued on the ongoing Tx DMA
+                                                          transfer, 0 when not in Tx queue mode */
+
+  DMA_NodeTypeDef *__IO    pTxQueueRestart;          /*!< Queued Tx node linked after the DMA channel fetched the
+                                                          last node, NULL if none             */
+
+#endif /* HAL_UART_DMA_ENABLED */
   HAL_LockTypeDef           Lock;                    /*!< Locking object                     */
 
   __IO HAL_UART_StateTypeDef    gState;              /*!< UART state information related to global Handle management
@@ -284,6 +326,8 @@ typedef struct __UART_HandleTypeDef
   void (* RxFifoFullCallback)(struct __UART_HandleTypeDef *huart);        /*!< UART Rx Fifo Full Callback            */
   void (* TxFifoEmptyCallback)(struct __UART_HandleTypeDef *huart);       /*!< UART Tx Fifo Empty Callback           */
   void (* RxEventCallback)(struct __UART_HandleTypeDef *huart, uint16_t Pos); /*!< UART Reception Event Callback     */
+  void (* RxFrameCallback)(struct __UART_HandleTypeDef *huart, uint16_t Offset,
+                           uint16_t Length);                              /*!< UART Rx Frame Callback                */
 
   void (* MspInitCallback)(struct __UART_HandleTypeDef *huart);           /*!< UART Msp Init callback                */
   void (* MspDeInitCallback)(struct __UART_HandleTypeDef *huart);         /*!< UART Msp DeInit callback              */
@@ -320,6 +364,9 @@ typedef enum
 typedef  void (*pUART_CallbackTypeDef)(UART_HandleTypeDef *huart); /*!< pointer to an UART callback function */
 typedef  void (*pUART_RxEventCallbackTypeDef)
 (struct __UART_HandleTypeDef *huart, uint16_t Pos); /*!< pointer to a UART Rx Event specific callback function */
+typedef  void (*pUART_RxFrameCallbackTypeDef)
+(struct __UART_HandleTypeDef *huart, uint16_t Offset, uint16_t Length); /*!< pointer to a UART Rx Frame callback
+                                                                             function */
 
 #endif /* USE_HAL_UART_REGISTER_CALLBACKS */
 
@@ -364,9 +411,9 @@ typedef  void (*pUART_RxEventCallbackTypeDef)
 #define  HAL_UART_ERROR_NE               (0x00000002U)    /*!< Noise error             */
 #define  HAL_UART_ERROR_FE               (0x00000004U)    /*!< Frame error             */
 #define  HAL_UART_ERROR_ORE              (0x00000008U)    /*!< Overrun error           */
-#if defined(HAL_DMA_MODULE_ENABLED)
+#if defined(HAL_UART_DMA_ENABLED)
 #define  HAL_UART_ERROR_DMA              (0x00000010U)    /*!< DMA transfer error      */
-#endif /* HAL_DMA_MODULE_ENABLED */
+#endif /* HAL_UART_DMA_ENABLED */
 #define  HAL_UART_ERROR_RTO              (0x00000020U)    /*!< Receiver Timeout error  */
 
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
@@ -506,7 +553,7 @@ typedef  void (*pUART_RxEventCallbackTypeDef)
   * @}
   */
 
-#if defined(HAL_DMA_MODULE_ENABLED)
+#if defined(HAL_UART_DMA_ENABLED)
 /** @defgroup UART_DMA_Tx    UART DMA Tx
   * @{
   */
@@ -524,7 +571,7 @@ typedef  void (*pUART_RxEventCallbackTypeDef)
 /**
   * @}
   */
-#endif /* HAL_DMA_MODULE_ENABLED */
+#endif /* HAL_UART_DMA_ENABLED */
 
 /** @defgroup UART_Half_Duplex_Selection  UART Half Duplex Selection
   * @{
@@ -565,9 +612,9 @@ typedef  void (*pUART_RxEventCallbackTypeDef)
 #define UART_ADVFEATURE_DATAINVERT_INIT         0x00000004U          /*!< Binary data inversion                    */
 #define UART_ADVFEATURE_SWAP_INIT               0x00000008U          /*!< TX/RX pins swap                          */
 #define UART_ADVFEATURE_RXOVERRUNDISABLE_INIT   0x00000010U          /*!< RX overrun disable                       */
-#if defined(HAL_DMA_MODULE_ENABLED)
+#if defined(HAL_UART_DMA_ENABLED)
 #define UART_ADVFEATURE_DMADISABLEONERROR_INIT  0x00000020U          /*!< DMA disable on Reception Error           */
-#endif /* HAL_DMA_MODULE_ENABLED */
+#endif /* HAL_UART_DMA_ENABLED */
 #define UART_ADVFEATURE_AUTOBAUDRATE_INIT       0x00000040U          /*!< Auto Baud rate detection initialization  */
 #define UART_ADVFEATURE_MSBFIRST_INIT           0x00000080U          /*!< Most significant bit sent/received first */
 /**
@@ -628,7 +675,7 @@ typedef  void (*pUART_RxEventCallbackTypeDef)
   * @}
   */
 
-#if defined(HAL_DMA_MODULE_ENABLED)
+#if defined(HAL_UART_DMA_ENABLED)
 /** @defgroup UART_DMA_Disable_on_Rx_Error   UART Advanced Feature DMA Disable On Rx Error
   * @{
   */
@@ -637,7 +684,7 @@ typedef  void (*pUART_RxEventCallbackTypeDef)
 /**
   * @}
   */
-#endif /* HAL_DMA_MODULE_ENABLED */
+#endif /* HAL_UART_DMA_ENABLED */
 
 /** @defgroup UART_MSB_First   UART Advanced Feature MSB First
   * @{
@@ -1423,7 +1470,7 @@ typedef  void (*pUART_RxEventCallbackTypeDef)
 #define IS_UART_LIN_BREAK_DETECT_LENGTH(__LENGTH__) (((__LENGTH__) == UART_LINBREAKDETECTLENGTH_10B) || \
                                                      ((__LENGTH__) == UART_LINBREAKDETECTLENGTH_11B))
 
-#if defined(HAL_DMA_MODULE_ENABLED)
+#if defined(HAL_UART_DMA_ENABLED)
 /**
   * @brief Ensure that UART DMA TX state is valid.
   * @param __DMATX__ UART DMA TX state.
@@ -1440,7 +1487,7 @@ typedef  void (*pUART_RxEventCallbackTypeDef)
 #define IS_UART_DMA_RX(__DMARX__)     (((__DMARX__) == UART_DMA_RX_DISABLE) || \
                                        ((__DMARX__) == UART_DMA_RX_ENABLE))
 
-#endif /* HAL_DMA_MODULE_ENABLED */
+#endif /* HAL_UART_DMA_ENABLED */
 /**
   * @brief Ensure that UART half-duplex state is valid.
   * @param __HDSEL__ UART half-duplex state.
@@ -1473,7 +1520,7 @@ typedef  void (*pUART_RxEventCallbackTypeDef)
   * @param __INIT__ UART advanced features initialization.
   * @retval SET (__INIT__ is valid) or RESET (__INIT__ is invalid)
   */
-#if defined(HAL_DMA_MODULE_ENABLED)
+#if defined(HAL_UART_DMA_ENABLED)
 #define IS_UART_ADVFEATURE_INIT(__INIT__)   ((__INIT__) <= (UART_ADVFEATURE_NO_INIT                | \
                                                             UART_ADVFEATURE_TXINVERT_INIT          | \
                                                             UART_ADVFEATURE_RXINVERT_INIT          | \
@@ -1492,7 +1539,7 @@ typedef  void (*pUART_RxEventCallbackTypeDef)
                                                             UART_ADVFEATURE_RXOVERRUNDISABLE_INIT  | \
                                                             UART_ADVFEATURE_AUTOBAUDRATE_INIT      | \
                                                             UART_ADVFEATURE_MSBFIRST_INIT))
-#endif /* HAL_DMA_MODULE_ENABLED */
+#endif /* HAL_UART_DMA_ENABLED */
 
 /**
   * @brief Ensure that UART frame TX inversion setting is valid.
@@ -1543,7 +1590,7 @@ typedef  void (*pUART_RxEventCallbackTypeDef)
                                                             UART_ADVFEATURE_AUTOBAUDRATE_DISABLE) || \
                                                            ((__AUTOBAUDRATE__) == UART_ADVFEATURE_AUTOBAUDRATE_ENABLE))
 
-#if defined(HAL_DMA_MODULE_ENABLED)
+#if defined(HAL_UART_DMA_ENABLED)
 /**
   * @brief Ensure that UART DMA enabling or disabling on error setting is valid.
   * @param __DMA__ UART DMA enabling or disabling on error setting.
@@ -1551,7 +1598,7 @@ typedef  void (*pUART_RxEventCallbackTypeDef)
   */
 #define IS_UART_ADVFEATURE_DMAONRXERROR(__DMA__)  (((__DMA__) == UART_ADVFEATURE_DMA_ENABLEONRXERROR) || \
                                                    ((__DMA__) == UART_ADVFEATURE_DMA_DISABLEONRXERROR))
-#endif /* HAL_DMA_MODULE_ENABLED */
+#endif /* HAL_UART_DMA_ENABLED */
 
 /**
   * @brief Ensure that UART frame MSB first setting is valid.
@@ -1645,6 +1692,9 @@ HAL_StatusTypeDef HAL_UART_UnRegisterCallback(UART_HandleTypeDef *huart, HAL_UAR
 
 HAL_StatusTypeDef HAL_UART_RegisterRxEventCallback(UART_HandleTypeDef *huart, pUART_RxEventCallbackTypeDef pCallback);
 HAL_StatusTypeDef HAL_UART_UnRegisterRxEventCallback(UART_HandleTypeDef *huart);
+
+HAL_StatusTypeDef HAL_UART_RegisterRxFrameCallback(UART_HandleTypeDef *huart, pUART_RxFrameCallbackTypeDef pCallback);
+HAL_StatusTypeDef HAL_UART_UnRegisterRxFrameCallback(UART_HandleTypeDef *huart);
 #endif /* USE_HAL_UART_REGISTER_CALLBACKS */
 
 /**
@@ -1660,13 +1710,13 @@ HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, const uint8_t *pD
 HAL_StatusTypeDef HAL_UART_Receive(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size, uint32_t Timeout);
 HAL_StatusTypeDef HAL_UART_Transmit_IT(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size);
 HAL_StatusTypeDef HAL_UART_Receive_IT(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
-#if defined(HAL_DMA_MODULE_ENABLED)
+#if defined(HAL_UART_DMA_ENABLED)
 HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size);
 HAL_StatusTypeDef HAL_UART_Receive_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
 HAL_StatusTypeDef HAL_UART_DMAPause(UART_HandleTypeDef *huart);
 HAL_StatusTypeDef HAL_UART_DMAResume(UART_HandleTypeDef *huart);
 HAL_StatusTypeDef HAL_UART_DMAStop(UART_HandleTypeDef *huart);
-#endif /* HAL_DMA_MODULE_ENABLED */
+#endif /* HAL_UART_DMA_ENABLED */
 /* Transfer Abort functions */
 HAL_StatusTypeDef HAL_UART_Abort(UART_HandleTypeDef *huart);
 HAL_StatusTypeDef HAL_UART_AbortTransmit(UART_HandleTypeDef *huart);
@@ -1676,6 +1726,7 @@ HAL_StatusTypeDef HAL_UART_AbortTransmit_IT(UART_HandleTypeDef *huart);
 HAL_StatusTypeDef HAL_UART_AbortReceive_IT(UART_HandleTypeDef *huart);
 
 void HAL_UART_IRQHandler(UART_HandleTypeDef *huart);
+void HAL_UART_FastIRQHandler(UART_HandleTypeDef *huart);
 void HAL_UART_TxHalfCpltCallback(UART_HandleTypeDef *huart);
 void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart);
 void HAL_UART_RxHalfCpltCallback(UART_HandleTypeDef *huart);
@@ -1740,9 +1791,9 @@ HAL_StatusTypeDef UART_WaitOnFlagUntilTimeout(UART_HandleTypeDef *huart, uint32_
                                               uint32_t Tickstart, uint32_t Timeout);
 void              UART_AdvFeatureConfig(UART_HandleTypeDef *huart);
 HAL_StatusTypeDef UART_Start_Receive_IT(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
-#if defined(HAL_DMA_MODULE_ENABLED)
+#if defined(HAL_UART_DMA_ENABLED)
 HAL_StatusTypeDef UART_Start_Receive_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
-#endif /* HAL_DMA_MODULE_ENABLED */
+#endif /* HAL_UART_DMA_ENABLED */
 
 /**
   * @}
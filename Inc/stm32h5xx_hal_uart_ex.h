@@ -56,6 +56,21 @@ typedef struct
   uint8_t Address;             /*!< UART/USART node address (7-bit long max). */
 } UART_WakeUpTypeDef;
 
+/**
+  * @brief  UART Rx stream framing parameters
+  */
+typedef struct
+{
+  uint32_t Delimiter;          /*!< Specifies which events delimit the frames in the Rx stream ring.
+                                    This parameter can be a combination of @ref UARTEx_RxFrame_Delimiter. */
+
+  uint8_t MatchChar;           /*!< Character ending a frame, used with UART_RXFRAME_CHARMATCH. */
+
+  uint32_t ReceiverTimeout;    /*!< Line idle duration ending a frame, in number of bit durations, used with
+                                    UART_RXFRAME_RTO (for Modbus RTU, 3.5 characters of 11 bits : 39).
+                                    This parameter must be lower or equal to 0x00FFFFFF. */
+} UART_RxFrameConfTypeDef;
+
 /**
   * @}
   */
@@ -84,6 +99,16 @@ typedef struct
   * @}
   */
 
+/** @defgroup UARTEx_RxFrame_Delimiter UARTEx Rx Frame Delimiter
+  * @brief    Events ending a frame in the Rx stream ring
+  * @{
+  */
+#define UART_RXFRAME_CHARMATCH      0x00000001U      /*!< Frame ended by the character match event    */
+#define UART_RXFRAME_RTO            0x00000002U      /*!< Frame ended by the receiver timeout event   */
+/**
+  * @}
+  */
+
 /** @defgroup UARTEx_FIFO_mode UARTEx FIFO mode
   * @brief    UART FIFO mode
   * @{
@@ -153,6 +178,8 @@ void HAL_UARTEx_WakeupCallback(UART_HandleTypeDef *huart);
 void HAL_UARTEx_RxFifoFullCallback(UART_HandleTypeDef *huart);
 void HAL_UARTEx_TxFifoEmptyCallback(UART_HandleTypeDef *huart);
 
+void HAL_UARTEx_RxFrameCallback(UART_HandleTypeDef *huart, uint16_t Offset, uint16_t Length);
+
 /**
   * @}
   */
@@ -176,9 +203,26 @@ HAL_StatusTypeDef HAL_UARTEx_SetRxFifoThreshold(UART_HandleTypeDef *huart, uint3
 HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size, uint16_t *RxLen,
                                            uint32_t Timeout);
 HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_IT(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
-#if defined(HAL_DMA_MODULE_ENABLED)
+#if defined(HAL_UART_DMA_ENABLED)
 HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
-#endif /* HAL_DMA_MODULE_ENABLED */
+HAL_StatusTypeDef HAL_UARTEx_ReceiveInStopMode_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size,
+                                                   uint32_t Threshold);
+
+HAL_StatusTypeDef HAL_UARTEx_TransmitQueue_DMA(UART_HandleTypeDef *huart, DMA_NodeTypeDef *pNode,
+                                               const uint8_t *pData, uint16_t Size);
+
+HAL_StatusTypeDef HAL_UARTEx_StreamStart(UART_HandleTypeDef *huart, UART_RxStreamTypeDef *pStream, uint8_t *pBuffer,
+                                         uint16_t Size);
+HAL_StatusTypeDef HAL_UARTEx_StreamStartFraming(UART_HandleTypeDef *huart, UART_RxStreamTypeDef *pStream,
+                                                uint8_t *pBuffer, uint16_t Size,
+                                                const UART_RxFrameConfTypeDef *pConfig);
+HAL_StatusTypeDef HAL_UARTEx_StreamStop(UART_HandleTypeDef *huart);
+uint16_t HAL_UARTEx_StreamGetAvailable(const UART_HandleTypeDef *huart);
+HAL_StatusTypeDef HAL_UARTEx_StreamPeek(const UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_UARTEx_StreamConsume(UART_HandleTypeDef *huart, uint16_t Size);
+HAL_StatusTypeDef HAL_UARTEx_StreamRead(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size, uint16_t *pReadLen);
+uint32_t HAL_UARTEx_StreamGetOverrun(const UART_HandleTypeDef *huart);
+#endif /* HAL_UART_DMA_ENABLED */
 
 HAL_UART_RxEventTypeTypeDef HAL_UARTEx_GetRxEventType(const UART_HandleTypeDef *huart);
 
@@ -438,6 +482,15 @@ HAL_UART_RxEventTypeTypeDef HAL_UARTEx_GetRxEventType(const UART_HandleTypeDef *
 #define IS_UART_ADDRESSLENGTH_DETECT(__ADDRESS__) (((__ADDRESS__) == UART_ADDRESS_DETECT_4B) || \
                                                    ((__ADDRESS__) == UART_ADDRESS_DETECT_7B))
 
+/**
+  * @brief Ensure that UART Rx frame delimiter selection is valid.
+  * @param __DELIMITER__ UART Rx frame delimiter selection.
+  * @retval SET (__DELIMITER__ is valid) or RESET (__DELIMITER__ is invalid)
+  */
+#define IS_UART_RXFRAME_DELIMITER(__DELIMITER__) ((((__DELIMITER__) & ~(UART_RXFRAME_CHARMATCH | \
+                                                                        UART_RXFRAME_RTO)) == 0U) && \
+                                                  ((__DELIMITER__) != 0U))
+
 /**
   * @brief Ensure that UART TXFIFO threshold level is valid.
   * @param __THRESHOLD__ UART TXFIFO threshold level.
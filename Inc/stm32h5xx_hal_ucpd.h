@@ -0,0 +1,502 @@
+/**
+  ******************************************************************************
+  * @file    stm32h5xx_hal_ucpd.h
+  * @author  MCD Application Team
+  * @brief   Header file of UCPD HAL module.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2023 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef STM32H5xx_HAL_UCPD_H
+#define STM32H5xx_HAL_UCPD_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32h5xx_hal_def.h"
+#include "stm32h5xx_ll_ucpd.h"
+
+#if defined(UCPD1)
+/** @addtogroup STM32H5xx_HAL_Driver
+  * @{
+  */
+
+/** @addtogroup UCPD
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+/** @defgroup UCPD_Exported_Types UCPD Exported Types
+  * @{
+  */
+
+/**
+  * @brief  UCPD HAL State Structure definition
+  */
+typedef enum
+{
+  HAL_UCPD_STATE_RESET          = 0x00U,  /*!< UCPD not yet initialized or disabled          */
+  HAL_UCPD_STATE_READY          = 0x01U,  /*!< UCPD initialized and ready for use            */
+  HAL_UCPD_STATE_BUSY_TX        = 0x02U,  /*!< Message transmission is ongoing               */
+  HAL_UCPD_STATE_BUSY_RX        = 0x03U,  /*!< Message reception is enabled                  */
+  HAL_UCPD_STATE_BUSY_GOODCRC   = 0x04U,  /*!< Automatic GoodCRC transmission is ongoing     */
+  HAL_UCPD_STATE_BUSY_HARDRESET = 0x05U,  /*!< Hard Reset transmission is ongoing            */
+  HAL_UCPD_STATE_ERROR          = 0x06U   /*!< UCPD error state                              */
+} HAL_UCPD_StateTypeDef;
+
+/**
+  * @brief  UCPD Init Structure definition
+  */
+typedef struct
+{
+  uint32_t Prescaler;       /*!< Specifies the prescaler of the UCPD kernel clock.
+                                 This parameter can be a value of @ref UCPD_Prescaler */
+
+  uint32_t TransWin;        /*!< Specifies the number of half bit clock cycles (minus 1) defining
+                                 tTransitionWindow, between 12 and 20 us.
+                                 This parameter must be a number between Min_Data = 0x01 and Max_Data = 0x1F */
+
+  uint32_t IfrGap;          /*!< Specifies the clock divider (minus 1) defining tInterFrameGap.
+                                 This parameter must be a number between Min_Data = 0x01 and Max_Data = 0x1F */
+
+  uint32_t HbitClockDiv;    /*!< Specifies the number of kernel clock cycles (minus 1) of a half bit.
+                                 This parameter must be a number between Min_Data = 0x00 and Max_Data = 0x3F */
+
+  uint32_t CCPin;           /*!< Specifies the CC line used for the Power Delivery communication.
+                                 This parameter can be a value of @ref UCPD_CC_Pin */
+
+  uint32_t RxOrderSet;      /*!< Specifies the ordered sets detected by the receiver.
+                                 This parameter can be any combination of @ref UCPD_Rx_OrderSet_Detection */
+
+  uint32_t AutoGoodCRC;     /*!< Specifies whether a GoodCRC message is sent by the driver in response
+                                 to each valid received message.
+                                 This parameter can be set to ENABLE or DISABLE */
+
+  uint32_t PowerRole;       /*!< Specifies the port power role advertised in the GoodCRC header.
+                                 This parameter can be a value of @ref UCPD_Power_Role */
+
+  uint32_t DataRole;        /*!< Specifies the port data role advertised in the GoodCRC header.
+                                 This parameter can be a value of @ref UCPD_Data_Role */
+
+  uint32_t SpecRevision;    /*!< Specifies the specification revision advertised in the GoodCRC header.
+                                 This parameter can be a value of @ref UCPD_Spec_Revision */
+} UCPD_InitTypeDef;
+
+/**
+  * @brief  UCPD Handle Structure definition
+  */
+#if (USE_HAL_UCPD_REGISTER_CALLBACKS == 1)
+typedef struct __UCPD_HandleTypeDef
+#else
+typedef struct
+#endif /* USE_HAL_UCPD_REGISTER_CALLBACKS */
+{
+  UCPD_TypeDef                  *Instance;        /*!< UCPD registers base address         */
+
+  UCPD_InitTypeDef              Init;             /*!< UCPD communication parameters       */
+
+  uint8_t                       *pRxBuffPtr;      /*!< Pointer to UCPD Rx message buffer   */
+
+  uint16_t                      RxXferSize;       /*!< UCPD Rx message buffer size         */
+
+  __IO uint16_t                 RxXferCount;      /*!< Payload size of the last received message,
+                                                       header included, CRC excluded */
+
+  __IO uint32_t                 RxOrderSet;       /*!< Ordered set of the last received message.
+                                                       This parameter is a value of @ref UCPD_LL_EC_RXORDSET */
+
+  uint8_t                       GoodCRCBuffer[2]; /*!< GoodCRC message sent by the driver */
+
+  DMA_HandleTypeDef             *hdmatx;          /*!< UCPD Tx DMA handle parameters       */
+
+  DMA_HandleTypeDef             *hdmarx;          /*!< UCPD Rx DMA handle parameters       */
+
+  HAL_LockTypeDef               Lock;             /*!< Locking object                      */
+
+  __IO HAL_UCPD_StateTypeDef    gState;           /*!< UCPD state related to Tx operations
+                                                       This parameter can be a value of @ref HAL_UCPD_StateTypeDef */
+
+  __IO HAL_UCPD_StateTypeDef    RxState;          /*!< UCPD state related to Rx operations
+                                                       This parameter can be a value of @ref HAL_UCPD_StateTypeDef */
+
+  __IO uint32_t                 ErrorCode;        /*!< UCPD Error code
+                                                       This parameter can be a value of @ref UCPD_Error_Code */
+
+#if (USE_HAL_UCPD_REGISTER_CALLBACKS == 1)
+  void (* TxCpltCallback)(struct __UCPD_HandleTypeDef *hucpd);            /*!< UCPD Tx Complete Callback       */
+  void (* RxCpltCallback)(struct __UCPD_HandleTypeDef *hucpd);            /*!< UCPD Rx Complete Callback       */
+  void (* HardResetReceivedCallback)(struct __UCPD_HandleTypeDef *hucpd); /*!< UCPD Hard Reset Rx Callback     */
+  void (* HardResetSentCallback)(struct __UCPD_HandleTypeDef *hucpd);     /*!< UCPD Hard Reset Tx Callback     */
+  void (* ErrorCallback)(struct __UCPD_HandleTypeDef *hucpd);             /*!< UCPD Error Callback             */
+
+  void (* MspInitCallback)(struct __UCPD_HandleTypeDef *hucpd);           /*!< UCPD Msp Init callback          */
+  void (* MspDeInitCallback)(struct __UCPD_HandleTypeDef *hucpd);         /*!< UCPD Msp DeInit callback        */
+#endif /* USE_HAL_UCPD_REGISTER_CALLBACKS */
+} UCPD_HandleTypeDef;
+
+#if (USE_HAL_UCPD_REGISTER_CALLBACKS == 1)
+/**
+  * @brief  HAL UCPD Callback ID enumeration definition
+  */
+typedef enum
+{
+  HAL_UCPD_TX_COMPLETE_CB_ID        = 0x00U,  /*!< UCPD Tx Complete Callback ID        */
+  HAL_UCPD_RX_COMPLETE_CB_ID        = 0x01U,  /*!< UCPD Rx Complete Callback ID        */
+  HAL_UCPD_HARDRESET_RX_CB_ID       = 0x02U,  /*!< UCPD Hard Reset received Callback ID */
+  HAL_UCPD_HARDRESET_TX_CB_ID       = 0x03U,  /*!< UCPD Hard Reset sent Callback ID    */
+  HAL_UCPD_ERROR_CB_ID              = 0x04U,  /*!< UCPD Error Callback ID              */
+
+  HAL_UCPD_MSPINIT_CB_ID            = 0x05U,  /*!< UCPD MspInit callback ID            */
+  HAL_UCPD_MSPDEINIT_CB_ID          = 0x06U   /*!< UCPD MspDeInit callback ID          */
+} HAL_UCPD_CallbackIDTypeDef;
+
+/**
+  * @brief  HAL UCPD Callback pointer definition
+  */
+typedef void (*pUCPD_CallbackTypeDef)(UCPD_HandleTypeDef *hucpd);  /*!< pointer to a UCPD callback function */
+
+#endif /* USE_HAL_UCPD_REGISTER_CALLBACKS */
+
+/**
+  * @}
+  */
+
+/* Exported constants --------------------------------------------------------*/
+/** @defgroup UCPD_Exported_Constants UCPD Exported Constants
+  * @{
+  */
+
+/** @defgroup UCPD_Error_Code UCPD Error Code
+  * @{
+  */
+#define HAL_UCPD_ERROR_NONE                 (0x00000000U)  /*!< No error                                   */
+#define HAL_UCPD_ERROR_RX                   (0x00000001U)  /*!< Message received with a CRC or coding error */
+#define HAL_UCPD_ERROR_RX_OVERRUN           (0x00000002U)  /*!< Rx data overrun                            */
+#define HAL_UCPD_ERROR_TX_DISCARDED         (0x00000004U)  /*!< Tx message discarded by an incoming message */
+#define HAL_UCPD_ERROR_TX_ABORTED           (0x00000008U)  /*!< Tx message aborted                         */
+#define HAL_UCPD_ERROR_TX_UNDERRUN          (0x00000010U)  /*!< Tx data underrun                           */
+#define HAL_UCPD_ERROR_HARDRESET_DISCARDED  (0x00000020U)  /*!< Hard Reset discarded by an incoming message */
+#define HAL_UCPD_ERROR_GOODCRC              (0x00000040U)  /*!< GoodCRC could not be sent, Tx path busy    */
+#define HAL_UCPD_ERROR_DMA                  (0x00000080U)  /*!< DMA transfer error                         */
+#if (USE_HAL_UCPD_REGISTER_CALLBACKS == 1)
+#define HAL_UCPD_ERROR_INVALID_CALLBACK     (0x00000100U)  /*!< Invalid Callback error                     */
+#endif /* USE_HAL_UCPD_REGISTER_CALLBACKS */
+/**
+  * @}
+  */
+
+/** @defgroup UCPD_Prescaler UCPD Kernel Clock Prescaler
+  * @{
+  */
+#define UCPD_PSC_DIV1                       LL_UCPD_PSC_DIV1   /*!< UCPD kernel clock divided by 1  */
+#define UCPD_PSC_DIV2                       LL_UCPD_PSC_DIV2   /*!< UCPD kernel clock divided by 2  */
+#define UCPD_PSC_DIV4                       LL_UCPD_PSC_DIV4   /*!< UCPD kernel clock divided by 4  */
+#define UCPD_PSC_DIV8                       LL_UCPD_PSC_DIV8   /*!< UCPD kernel clock divided by 8  */
+#define UCPD_PSC_DIV16                      LL_UCPD_PSC_DIV16  /*!< UCPD kernel clock divided by 16 */
+/**
+  * @}
+  */
+
+/** @defgroup UCPD_CC_Pin UCPD CC Pin
+  * @{
+  */
+#define UCPD_CCPIN_CC1                      LL_UCPD_CCPIN_CC1  /*!< Power Delivery communication on CC1 */
+#define UCPD_CCPIN_CC2                      LL_UCPD_CCPIN_CC2  /*!< Power Delivery communication on CC2 */
+/**
+  * @}
+  */
+
+/** @defgroup UCPD_Rx_OrderSet_Detection UCPD Rx Ordered Set Detection
+  * @{
+  */
+#define UCPD_RXORDERSET_SOP                 LL_UCPD_ORDERSET_SOP          /*!< SOP detection enabled          */
+#define UCPD_RXORDERSET_SOP1                LL_UCPD_ORDERSET_SOP1         /*!< SOP' detection enabled         */
+#define UCPD_RXORDERSET_SOP2                LL_UCPD_ORDERSET_SOP2         /*!< SOP'' detection enabled        */
+#define UCPD_RXORDERSET_HARDRESET           LL_UCPD_ORDERSET_HARDRST      /*!< Hard Reset detection enabled   */
+#define UCPD_RXORDERSET_CABLERESET          LL_UCPD_ORDERSET_CABLERST     /*!< Cable Reset detection enabled  */
+#define UCPD_RXORDERSET_SOP1_DEBUG          LL_UCPD_ORDERSET_SOP1_DEBUG   /*!< SOP' Debug detection enabled   */
+#define UCPD_RXORDERSET_SOP2_DEBUG          LL_UCPD_ORDERSET_SOP2_DEBUG   /*!< SOP'' Debug detection enabled  */
+/**
+  * @}
+  */
+
+/** @defgroup UCPD_Tx_OrderSet UCPD Tx Ordered Set
+  * @{
+  */
+#define UCPD_TXORDERSET_SOP                 LL_UCPD_ORDERED_SET_SOP          /*!< SOP message         */
+#define UCPD_TXORDERSET_SOP1                LL_UCPD_ORDERED_SET_SOP1         /*!< SOP' message        */
+#define UCPD_TXORDERSET_SOP2                LL_UCPD_ORDERED_SET_SOP2         /*!< SOP'' message       */
+#define UCPD_TXORDERSET_SOP1_DEBUG          LL_UCPD_ORDERED_SET_SOP1_DEBUG   /*!< SOP' Debug message  */
+#define UCPD_TXORDERSET_SOP2_DEBUG          LL_UCPD_ORDERED_SET_SOP2_DEBUG   /*!< SOP'' Debug message */
+/**
+  * @}
+  */
+
+/** @defgroup UCPD_Power_Role UCPD Power Role
+  * @{
+  */
+#define UCPD_POWERROLE_SINK                 (0x00000000U)  /*!< Port is a power sink   */
+#define UCPD_POWERROLE_SOURCE               (0x00000001U)  /*!< Port is a power source */
+/**
+  * @}
+  */
+
+/** @defgroup UCPD_Data_Role UCPD Data Role
+  * @{
+  */
+#define UCPD_DATAROLE_UFP                   (0x00000000U)  /*!< Port is an Upstream Facing Port   */
+#define UCPD_DATAROLE_DFP                   (0x00000001U)  /*!< Port is a Downstream Facing Port */
+/**
+  * @}
+  */
+
+/** @defgroup UCPD_Spec_Revision UCPD Specification Revision
+  * @{
+  */
+#define UCPD_SPECREV_1_0                    (0x00000000U)  /*!< USB PD revision 1.0 */
+#define UCPD_SPECREV_2_0                    (0x00000001U)  /*!< USB PD revision 2.0 */
+#define UCPD_SPECREV_3_0                    (0x00000002U)  /*!< USB PD revision 3.x */
+/**
+  * @}
+  */
+
+/** @defgroup UCPD_Flags UCPD Flags
+  * @{
+  */
+#define UCPD_FLAG_TXIS                      UCPD_SR_TXIS       /*!< Transmit interrupt status          */
+#define UCPD_FLAG_TXMSGDISC                 UCPD_SR_TXMSGDISC  /*!< Transmit message discarded         */
+#define UCPD_FLAG_TXMSGSENT                 UCPD_SR_TXMSGSENT  /*!< Transmit message sent              */
+#define UCPD_FLAG_TXMSGABT                  UCPD_SR_TXMSGABT   /*!< Transmit message aborted           */
+#define UCPD_FLAG_HRSTDISC                  UCPD_SR_HRSTDISC   /*!< Hard Reset discarded               */
+#define UCPD_FLAG_HRSTSENT                  UCPD_SR_HRSTSENT   /*!< Hard Reset sent                    */
+#define UCPD_FLAG_TXUND                     UCPD_SR_TXUND      /*!< Tx data underrun                   */
+#define UCPD_FLAG_RXNE                      UCPD_SR_RXNE       /*!< Receive data register not empty    */
+#define UCPD_FLAG_RXORDDET                  UCPD_SR_RXORDDET   /*!< Rx ordered set detected            */
+#define UCPD_FLAG_RXHRSTDET                 UCPD_SR_RXHRSTDET  /*!< Rx Hard Reset detected             */
+#define UCPD_FLAG_RXOVR                     UCPD_SR_RXOVR      /*!< Rx data overrun                    */
+#define UCPD_FLAG_RXMSGEND                  UCPD_SR_RXMSGEND   /*!< Rx message received                */
+#define UCPD_FLAG_RXERR                     UCPD_SR_RXERR      /*!< Rx error                           */
+/**
+  * @}
+  */
+
+/** @defgroup UCPD_Interrupt_definition UCPD Interrupts Definition
+  * @{
+  */
+#define UCPD_IT_TXMSGDISC                   UCPD_IMR_TXMSGDISCIE  /*!< Transmit message discarded interrupt */
+#define UCPD_IT_TXMSGSENT                   UCPD_IMR_TXMSGSENTIE  /*!< Transmit message sent interrupt      */
+#define UCPD_IT_TXMSGABT                    UCPD_IMR_TXMSGABTIE   /*!< Transmit message aborted interrupt   */
+#define UCPD_IT_HRSTDISC                    UCPD_IMR_HRSTDISCIE   /*!< Hard Reset discarded interrupt       */
+#define UCPD_IT_HRSTSENT                    UCPD_IMR_HRSTSENTIE   /*!< Hard Reset sent interrupt            */
+#define UCPD_IT_TXUND                       UCPD_IMR_TXUNDIE      /*!< Tx data underrun interrupt           */
+#define UCPD_IT_RXORDDET                    UCPD_IMR_RXORDDETIE   /*!< Rx ordered set detected interrupt    */
+#define UCPD_IT_RXHRSTDET                   UCPD_IMR_RXHRSTDETIE  /*!< Rx Hard Reset detected interrupt     */
+#define UCPD_IT_RXOVR                       UCPD_IMR_RXOVRIE      /*!< Rx data overrun interrupt            */
+#define UCPD_IT_RXMSGEND                    UCPD_IMR_RXMSGENDIE   /*!< Rx message received interrupt        */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/* Exported macros -----------------------------------------------------------*/
+/** @defgroup UCPD_Exported_Macros UCPD Exported Macros
+  * @{
+  */
+
+/** @brief  Reset UCPD handle state.
+  * @param  __HANDLE__ UCPD handle.
+  * @retval None
+  */
+#if (USE_HAL_UCPD_REGISTER_CALLBACKS == 1)
+#define __HAL_UCPD_RESET_HANDLE_STATE(__HANDLE__) do{                                               \
+                                                      (__HANDLE__)->gState = HAL_UCPD_STATE_RESET;  \
+                                                      (__HANDLE__)->RxState = HAL_UCPD_STATE_RESET; \
+                                                      (__HANDLE__)->MspInitCallback = NULL;         \
+                                                      (__HANDLE__)->MspDeInitCallback = NULL;       \
+                                                    } while(0)
+#else
+#define __HAL_UCPD_RESET_HANDLE_STATE(__HANDLE__) do{                                               \
+                                                      (__HANDLE__)->gState = HAL_UCPD_STATE_RESET;  \
+                                                      (__HANDLE__)->RxState = HAL_UCPD_STATE_RESET; \
+                                                    } while(0)
+#endif /* USE_HAL_UCPD_REGISTER_CALLBACKS */
+
+/** @brief  Check whether the specified UCPD flag is set or not.
+  * @param  __HANDLE__ UCPD handle.
+  * @param  __FLAG__ specifies the flag to check.
+  *         This parameter can be a value of @ref UCPD_Flags
+  * @retval The new state of __FLAG__ (TRUE or FALSE).
+  */
+#define __HAL_UCPD_GET_FLAG(__HANDLE__, __FLAG__) (((__HANDLE__)->Instance->SR & (__FLAG__)) == (__FLAG__))
+
+/** @brief  Clear the specified UCPD pending flags.
+  * @note   The ICR clear bits are located at the same positions as the SR flags.
+  * @param  __HANDLE__ UCPD handle.
+  * @param  __FLAG__ specifies the flags to clear.
+  *         This parameter can be any combination of @ref UCPD_Flags except
+  *         UCPD_FLAG_TXIS, UCPD_FLAG_RXNE and UCPD_FLAG_RXERR
+  * @retval None
+  */
+#define __HAL_UCPD_CLEAR_FLAG(__HANDLE__, __FLAG__) WRITE_REG((__HANDLE__)->Instance->ICR, (__FLAG__))
+
+/** @brief  Enable the specified UCPD interrupts.
+  * @param  __HANDLE__ UCPD handle.
+  * @param  __INTERRUPT__ specifies the interrupts to enable.
+  *         This parameter can be any combination of @ref UCPD_Interrupt_definition
+  * @retval None
+  */
+#define __HAL_UCPD_ENABLE_IT(__HANDLE__, __INTERRUPT__) SET_BIT((__HANDLE__)->Instance->IMR, (__INTERRUPT__))
+
+/** @brief  Disable the specified UCPD interrupts.
+  * @param  __HANDLE__ UCPD handle.
+  * @param  __INTERRUPT__ specifies the interrupts to disable.
+  *         This parameter can be any combination of @ref UCPD_Interrupt_definition
+  * @retval None
+  */
+#define __HAL_UCPD_DISABLE_IT(__HANDLE__, __INTERRUPT__) CLEAR_BIT((__HANDLE__)->Instance->IMR, (__INTERRUPT__))
+
+/**
+  * @}
+  */
+
+/* Private macros ------------------------------------------------------------*/
+/** @defgroup UCPD_Private_Macros UCPD Private Macros
+  * @{
+  */
+#define IS_UCPD_PRESCALER(__PSC__) (((__PSC__) == UCPD_PSC_DIV1) || \
+                                    ((__PSC__) == UCPD_PSC_DIV2) || \
+                                    ((__PSC__) == UCPD_PSC_DIV4) || \
+                                    ((__PSC__) == UCPD_PSC_DIV8) || \
+                                    ((__PSC__) == UCPD_PSC_DIV16))
+
+#define IS_UCPD_TRANSWIN(__TRANSWIN__) (((__TRANSWIN__) >= 0x01U) && ((__TRANSWIN__) <= 0x1FU))
+
+#define IS_UCPD_IFRGAP(__IFRGAP__) (((__IFRGAP__) >= 0x01U) && ((__IFRGAP__) <= 0x1FU))
+
+#define IS_UCPD_HBITCLOCKDIV(__DIV__) ((__DIV__) <= 0x3FU)
+
+#define IS_UCPD_CCPIN(__PIN__) (((__PIN__) == UCPD_CCPIN_CC1) || ((__PIN__) == UCPD_CCPIN_CC2))
+
+#define IS_UCPD_RXORDERSET(__ORDERSET__) (((__ORDERSET__) != 0U) && \
+                                          (((__ORDERSET__) & ~(UCPD_RXORDERSET_SOP | UCPD_RXORDERSET_SOP1       | \
+                                                                UCPD_RXORDERSET_SOP2 | UCPD_RXORDERSET_HARDRESET  | \
+                                                                UCPD_RXORDERSET_CABLERESET                        | \
+                                                                UCPD_RXORDERSET_SOP1_DEBUG                        | \
+                                                                UCPD_RXORDERSET_SOP2_DEBUG)) == 0U))
+
+#define IS_UCPD_TXORDERSET(__ORDERSET__) (((__ORDERSET__) == UCPD_TXORDERSET_SOP)        || \
+                                          ((__ORDERSET__) == UCPD_TXORDERSET_SOP1)       || \
+                                          ((__ORDERSET__) == UCPD_TXORDERSET_SOP2)       || \
+                                          ((__ORDERSET__) == UCPD_TXORDERSET_SOP1_DEBUG) || \
+                                          ((__ORDERSET__) == UCPD_TXORDERSET_SOP2_DEBUG))
+
+#define IS_UCPD_POWERROLE(__ROLE__) (((__ROLE__) == UCPD_POWERROLE_SINK) || ((__ROLE__) == UCPD_POWERROLE_SOURCE))
+
+#define IS_UCPD_DATAROLE(__ROLE__) (((__ROLE__) == UCPD_DATAROLE_UFP) || ((__ROLE__) == UCPD_DATAROLE_DFP))
+
+#define IS_UCPD_SPECREVISION(__REV__) (((__REV__) == UCPD_SPECREV_1_0) || \
+                                       ((__REV__) == UCPD_SPECREV_2_0) || \
+                                       ((__REV__) == UCPD_SPECREV_3_0))
+
+#define IS_UCPD_TXPAYLOADSIZE(__SIZE__) (((__SIZE__) >= 2U) && ((__SIZE__) <= 0x3FFU))
+/**
+  * @}
+  */
+
+/* Exported functions --------------------------------------------------------*/
+/** @addtogroup UCPD_Exported_Functions
+  * @{
+  */
+
+/** @addtogroup UCPD_Exported_Functions_Group1
+  * @{
+  */
+/* Initialization and de-initialization functions  ****************************/
+HAL_StatusTypeDef HAL_UCPD_Init(UCPD_HandleTypeDef *hucpd);
+HAL_StatusTypeDef HAL_UCPD_DeInit(UCPD_HandleTypeDef *hucpd);
+void HAL_UCPD_MspInit(UCPD_HandleTypeDef *hucpd);
+void HAL_UCPD_MspDeInit(UCPD_HandleTypeDef *hucpd);
+
+#if (USE_HAL_UCPD_REGISTER_CALLBACKS == 1)
+/* Callbacks Register/UnRegister functions  ***********************************/
+HAL_StatusTypeDef HAL_UCPD_RegisterCallback(UCPD_HandleTypeDef *hucpd, HAL_UCPD_CallbackIDTypeDef CallbackID,
+                                            pUCPD_CallbackTypeDef pCallback);
+HAL_StatusTypeDef HAL_UCPD_UnRegisterCallback(UCPD_HandleTypeDef *hucpd, HAL_UCPD_CallbackIDTypeDef CallbackID);
+#endif /* USE_HAL_UCPD_REGISTER_CALLBACKS */
+/**
+  * @}
+  */
+
+/** @addtogroup UCPD_Exported_Functions_Group2
+  * @{
+  */
+/* IO operation functions *****************************************************/
+HAL_StatusTypeDef HAL_UCPD_Transmit_DMA(UCPD_HandleTypeDef *hucpd, uint32_t TxOrderSet, const uint8_t *pData,
+                                        uint16_t Size);
+HAL_StatusTypeDef HAL_UCPD_Receive_DMA(UCPD_HandleTypeDef *hucpd, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_UCPD_AbortReceive(UCPD_HandleTypeDef *hucpd);
+HAL_StatusTypeDef HAL_UCPD_SendHardReset(UCPD_HandleTypeDef *hucpd);
+
+void HAL_UCPD_IRQHandler(UCPD_HandleTypeDef *hucpd);
+void HAL_UCPD_TxCpltCallback(UCPD_HandleTypeDef *hucpd);
+void HAL_UCPD_RxCpltCallback(UCPD_HandleTypeDef *hucpd);
+void HAL_UCPD_HardResetReceivedCallback(UCPD_HandleTypeDef *hucpd);
+void HAL_UCPD_HardResetSentCallback(UCPD_HandleTypeDef *hucpd);
+void HAL_UCPD_ErrorCallback(UCPD_HandleTypeDef *hucpd);
+/**
+  * @}
+  */
+
+/** @addtogroup UCPD_Exported_Functions_Group3
+  * @{
+  */
+/* Peripheral Control functions  **********************************************/
+HAL_StatusTypeDef HAL_UCPD_SetRoles(UCPD_HandleTypeDef *hucpd, uint32_t PowerRole, uint32_t DataRole);
+/**
+  * @}
+  */
+
+/** @addtogroup UCPD_Exported_Functions_Group4
+  * @{
+  */
+/* Peripheral State and Error functions ***************************************/
+HAL_UCPD_StateTypeDef HAL_UCPD_GetState(const UCPD_HandleTypeDef *hucpd);
+uint32_t HAL_UCPD_GetError(const UCPD_HandleTypeDef *hucpd);
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#endif /* UCPD1 */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32H5xx_HAL_UCPD_H */
@@ -159,6 +159,8 @@ typedef struct __USART_HandleTypeDef
 
   DMA_HandleTypeDef             *hdmarx;                 /*!< USART Rx DMA Handle parameters      */
 
+  __IO uint32_t                 StreamBlock;             /*!< USART DMA streaming: next block to be received */
+
 #endif /* HAL_DMA_MODULE_ENABLED */
   HAL_LockTypeDef               Lock;                    /*!< Locking object                      */
 
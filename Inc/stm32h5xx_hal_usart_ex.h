@@ -36,6 +36,44 @@ extern "C" {
   */
 
 /* Exported types ------------------------------------------------------------*/
+/** @defgroup USARTEx_Exported_Types USARTEx Exported Types
+  * @{
+  */
+
+#if defined(HAL_DMA_MODULE_ENABLED)
+/**
+  * @brief  USART synchronous DMA streaming configuration structure definition
+  * @note   The queues, the nodes and the block buffers are provided by the user and must stay allocated while
+  *         the streaming runs.
+  */
+typedef struct
+{
+  DMA_QListTypeDef  *pTxQueue;      /*!< Linked-list queue used to build the circular Tx streaming queue */
+
+  DMA_NodeTypeDef   *pTxNodes;      /*!< Array of 2 linked-list nodes of the Tx queue, one per block */
+
+  uint32_t          TxRequest;      /*!< DMA request of the USART transmitter.
+                                         This parameter can be a value of @ref DMA_Request_Selection */
+
+  DMA_QListTypeDef  *pRxQueue;      /*!< Linked-list queue used to build the circular Rx streaming queue */
+
+  DMA_NodeTypeDef   *pRxNodes;      /*!< Array of 2 linked-list nodes of the Rx queue, one per block */
+
+  uint32_t          RxRequest;      /*!< DMA request of the USART receiver.
+                                         This parameter can be a value of @ref DMA_Request_Selection */
+
+  const uint8_t     *pTxBuffer[2];  /*!< Tx buffers of the 2 blocks (u8 or u16 data elements) */
+
+  uint8_t           *pRxBuffer[2];  /*!< Rx buffers of the 2 blocks (u8 or u16 data elements) */
+
+  uint16_t          BlockLength;    /*!< Number of data elements (u8 or u16) per block */
+} USART_StreamConfTypeDef;
+
+#endif /* HAL_DMA_MODULE_ENABLED */
+/**
+  * @}
+  */
+
 /* Exported constants --------------------------------------------------------*/
 /** @defgroup USARTEx_Exported_Constants USARTEx Exported Constants
   * @{
@@ -241,6 +279,10 @@ extern "C" {
 void HAL_USARTEx_RxFifoFullCallback(USART_HandleTypeDef *husart);
 void HAL_USARTEx_TxFifoEmptyCallback(USART_HandleTypeDef *husart);
 
+#if defined(HAL_DMA_MODULE_ENABLED)
+HAL_StatusTypeDef HAL_USARTEx_StreamStart_DMA(USART_HandleTypeDef *husart, const USART_StreamConfTypeDef *pConfig);
+#endif /* HAL_DMA_MODULE_ENABLED */
+
 /**
   * @}
   */
@@ -124,6 +124,7 @@ typedef struct
   __IO uint32_t              State;         /*!< Internal state of the XSPI HAL driver                 */
   __IO uint32_t              ErrorCode;     /*!< Error code in case of HAL driver internal error       */
   uint32_t                   Timeout;       /*!< Timeout used for the XSPI external device access      */
+  struct __XSPI_TransactionQueueTypeDef *pTransactionQueue; /*!< Transaction queue in progress, NULL if none */
 #if defined(USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U)
   void (* ErrorCallback)(struct __XSPI_HandleTypeDef *hxspi);
   void (* AbortCpltCallback)(struct __XSPI_HandleTypeDef *hxspi);
@@ -264,6 +265,117 @@ typedef struct
 #endif /* XSPI_CR_NOPREF */
 } XSPI_MemoryMappedTypeDef;
 
+/**
+  * @brief  HAL XSPI managed execute-in-place context structure definition
+  */
+typedef struct
+{
+  XSPI_MemoryMappedTypeDef MemoryMappedCfg; /*!< Memory-mapped configuration (timeout and prefetch settings) restored
+                                                 after each program or erase operation */
+#if defined(HAL_DCACHE_MODULE_ENABLED)
+  DCACHE_HandleTypeDef     *hdcache;        /*!< Handle of the DCACHE caching the memory-mapped region, NULL if none */
+#endif /* HAL_DCACHE_MODULE_ENABLED */
+  uint32_t                 MemorySelect;    /*!< Saved memory selection of the memory-mapped read accesses          */
+  uint32_t                 ReadCCR;         /*!< Saved communication configuration of the memory-mapped reads       */
+  uint32_t                 ReadTCR;         /*!< Saved timing configuration of the memory-mapped reads              */
+  uint32_t                 ReadIR;          /*!< Saved instruction of the memory-mapped reads                       */
+  uint32_t                 ReadABR;         /*!< Saved alternate bytes of the memory-mapped reads                   */
+  __IO uint32_t            Suspended;       /*!< Memory-mapped mode suspended by HAL_XSPI_XIP_Suspend()             */
+} XSPI_XIPContextTypeDef;
+
+/**
+  * @brief  HAL XSPI managed execute-in-place program or erase operation structure definition
+  */
+typedef struct
+{
+  const XSPI_RegularCmdTypeDef  *pWriteEnableCmd; /*!< Write enable command sent before the operation, NULL if none */
+  const XSPI_RegularCmdTypeDef  *pOperationCmd;   /*!< Program or erase command, with its data length for a program */
+  const uint8_t                 *pData;           /*!< Data programmed by the operation, NULL for an erase          */
+  const XSPI_RegularCmdTypeDef  *pStatusCmd;      /*!< Status register read command used for the busy polling      */
+  const XSPI_AutoPollingTypeDef *pStatusPolling;  /*!< Match configuration of the operation end (automatic stop)   */
+  uint32_t                      MappedAddress;    /*!< Address of the modified range in the memory-mapped region   */
+  uint32_t                      Size;             /*!< Size in bytes of the modified range                         */
+} XSPI_XIPOperationTypeDef;
+
+/**
+  * @brief  HAL XSPI queued transaction structure definition
+  */
+typedef struct
+{
+  uint32_t      Address;              /*!< Address of the transaction in the external memory                     */
+  const uint8_t *pData;               /*!< Data transferred by the transaction, NULL for a command without data  */
+  uint32_t      DataLength;           /*!< Number of data transferred, 0 for a command without data (e.g erase)  */
+} XSPI_TransactionTypeDef;
+
+/**
+  * @brief  HAL XSPI transaction queue structure definition
+  */
+typedef struct __XSPI_TransactionQueueTypeDef
+{
+  XSPI_RegularCmdTypeDef        WriteEnableCmd;   /*!< Write enable command sent before each transaction, skipped
+                                                       when its instruction mode is HAL_XSPI_INSTRUCTION_NONE      */
+  XSPI_RegularCmdTypeDef        OperationCmd;     /*!< Command of each transaction, its address and data length
+                                                       are taken from the transaction                              */
+  XSPI_RegularCmdTypeDef        StatusCmd;        /*!< Status register read command polled after each transaction,
+                                                       skipped when its instruction mode is HAL_XSPI_INSTRUCTION_NONE */
+  XSPI_AutoPollingTypeDef       StatusPolling;    /*!< Match configuration of the end of each transaction,
+                                                       the automatic stop must be enabled                          */
+  void (* pCompleteCallback)(XSPI_HandleTypeDef *hxspi,
+                             struct __XSPI_TransactionQueueTypeDef *pQueue); /*!< Called from the XSPI interrupt at
+                                                       the end of the queue or on the first error, may be NULL     */
+  const XSPI_TransactionTypeDef *pTransactions;   /*!< Transactions in progress (managed by the driver)          */
+  uint32_t                      TransactionCount; /*!< Number of transactions (managed by the driver)            */
+  __IO uint32_t                 Index;            /*!< Number of completed transactions                          */
+  __IO uint32_t                 Step;             /*!< Step of the transaction in progress (managed by the driver) */
+  __IO uint32_t                 ErrorCode;        /*!< Error code of the queue, a value of @ref XSPI_ErrorCode   */
+  XSPI_RegularCmdTypeDef        CurrentCmd;       /*!< Command of the transaction in progress (managed by the driver) */
+} XSPI_TransactionQueueTypeDef;
+
+#if !defined(XSPI_BLOCKDEV_CACHE_NBR_MAX)
+#define XSPI_BLOCKDEV_CACHE_NBR_MAX 4U  /*!< Maximum number of sectors cached by a block device              */
+#endif /* XSPI_BLOCKDEV_CACHE_NBR_MAX */
+#if !defined(XSPI_BLOCKDEV_ERASE_NBR_MAX)
+#define XSPI_BLOCKDEV_ERASE_NBR_MAX 4U  /*!< Maximum number of sectors reserved for background erase         */
+#endif /* XSPI_BLOCKDEV_ERASE_NBR_MAX */
+
+/**
+  * @brief  HAL XSPI NOR flash block device structure definition
+  */
+typedef struct
+{
+  XSPI_XIPContextTypeDef        *pXIPContext;     /*!< Memory-mapped context when the memory is read in memory-mapped
+                                                       mode (programs and erases use HAL_XSPI_XIP_Execute()),
+                                                       NULL when the memory is accessed in indirect mode            */
+  uint32_t                      MappedBase;       /*!< Base address of the memory-mapped region, unused if pXIPContext
+                                                       is NULL                                                      */
+  XSPI_RegularCmdTypeDef        ReadCmd;          /*!< Indirect read command, its address and data length are set on
+                                                       each read, unused if pXIPContext is not NULL                 */
+  XSPI_RegularCmdTypeDef        WriteEnableCmd;   /*!< Write enable command sent before each program or erase       */
+  XSPI_RegularCmdTypeDef        ProgramCmd;       /*!< Page program command, its address and data length are set on
+                                                       each program                                                 */
+  XSPI_RegularCmdTypeDef        EraseCmd;         /*!< Sector erase command, its address is set on each erase      */
+  XSPI_RegularCmdTypeDef        StatusCmd;        /*!< Status register read command of the busy polling            */
+  XSPI_AutoPollingTypeDef       StatusPolling;    /*!< Match configuration of the end of a program or an erase,
+                                                       the automatic stop must be enabled                          */
+  uint32_t                      PageSize;         /*!< Program page size of the memory in bytes                    */
+  uint32_t                      SectorSize;       /*!< Erase sector size of the memory in bytes, multiple of the
+                                                       page size                                                    */
+  uint32_t                      Timeout;          /*!< Timeout of a program or an erase in milliseconds            */
+  uint8_t                       *pPageBuffer;     /*!< Write coalescing buffer of PageSize bytes                   */
+  uint8_t                       *pCacheBuffer;    /*!< Sector cache of CacheNbr x SectorSize bytes, NULL if none   */
+  uint32_t                      CacheNbr;         /*!< Number of cached sectors, up to XSPI_BLOCKDEV_CACHE_NBR_MAX  */
+  uint32_t                      PageAddress;      /*!< Address of the page being coalesced (managed by the driver) */
+  uint32_t                      aCacheAddress[XSPI_BLOCKDEV_CACHE_NBR_MAX]; /*!< Address of each cached sector
+                                                       (managed by the driver)                                      */
+  uint32_t                      aCacheStamp[XSPI_BLOCKDEV_CACHE_NBR_MAX];   /*!< Last use of each cached sector
+                                                       (managed by the driver)                                      */
+  uint32_t                      CacheStamp;       /*!< Cache use counter (managed by the driver)                   */
+  uint32_t                      aEraseAddress[XSPI_BLOCKDEV_ERASE_NBR_MAX]; /*!< Address of each reserved sector
+                                                       (managed by the driver)                                      */
+  uint32_t                      aEraseState[XSPI_BLOCKDEV_ERASE_NBR_MAX];   /*!< Erase state of each reserved sector
+                                                       (managed by the driver)                                      */
+} XSPI_BlockDevTypeDef;
+
 #if defined(OCTOSPIM)
 /**
   * @brief HAL XSPI IO Manager Configuration structure definition
@@ -281,6 +393,21 @@ typedef struct
 } XSPIM_CfgTypeDef;
 
 #endif /* OCTOSPIM */
+/**
+  * @brief HAL XSPI Delay Block calibration structure definition
+  */
+typedef struct
+{
+  const XSPI_RegularCmdTypeDef *pReadCmd;  /*!< Indirect read command of the calibration pattern, configured with
+                                                the memory mode being calibrated (e.g octal DTR)                  */
+  const uint8_t                *pPattern;  /*!< Pattern expected from the memory, of pReadCmd->DataLength bytes   */
+  uint8_t                      *pBuffer;   /*!< Buffer receiving the pattern, of pReadCmd->DataLength bytes      */
+  uint32_t                     Trials;     /*!< Number of pattern reads required to pass on each phase,
+                                                0 meaning a single read                                           */
+  uint32_t                     PhaseMask;  /*!< Output: bit n set when the pattern is read without error
+                                                on the output clock phase n                                       */
+} XSPI_DLYB_CalibrationTypeDef;
+
 #if defined(USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U)
 /**
   * @brief  HAL XSPI Callback ID enumeration definition
@@ -970,6 +1097,29 @@ HAL_StatusTypeDef     HAL_XSPI_AutoPolling_IT(XSPI_HandleTypeDef *hxspi, const X
 HAL_StatusTypeDef     HAL_XSPI_MemoryMapped(XSPI_HandleTypeDef *hxspi,  const XSPI_MemoryMappedTypeDef *pCfg);
 uint32_t              HAL_XSPI_IsMemoryMapped(XSPI_HandleTypeDef *hxspi);
 
+/* XSPI managed execute-in-place functions */
+HAL_StatusTypeDef     HAL_XSPI_XIP_Suspend(XSPI_HandleTypeDef *hxspi, XSPI_XIPContextTypeDef *pContext);
+HAL_StatusTypeDef     HAL_XSPI_XIP_Resume(XSPI_HandleTypeDef *hxspi, XSPI_XIPContextTypeDef *pContext);
+HAL_StatusTypeDef     HAL_XSPI_XIP_Execute(XSPI_HandleTypeDef *hxspi, XSPI_XIPContextTypeDef *pContext,
+                                           const XSPI_XIPOperationTypeDef *pOperation, uint32_t Timeout);
+
+/* XSPI transaction queue functions */
+HAL_StatusTypeDef     HAL_XSPI_TransactionQueue_Start(XSPI_HandleTypeDef *hxspi, XSPI_TransactionQueueTypeDef *pQueue,
+                                                      const XSPI_TransactionTypeDef *pTransactions,
+                                                      uint32_t TransactionCount);
+
+/* XSPI NOR flash block device functions */
+HAL_StatusTypeDef     HAL_XSPI_BlockDev_Init(XSPI_HandleTypeDef *hxspi, XSPI_BlockDevTypeDef *pDev);
+HAL_StatusTypeDef     HAL_XSPI_BlockDev_Read(XSPI_HandleTypeDef *hxspi, XSPI_BlockDevTypeDef *pDev, uint32_t Address,
+                                             uint8_t *pData, uint32_t Size);
+HAL_StatusTypeDef     HAL_XSPI_BlockDev_Program(XSPI_HandleTypeDef *hxspi, XSPI_BlockDevTypeDef *pDev,
+                                                uint32_t Address, const uint8_t *pData, uint32_t Size);
+HAL_StatusTypeDef     HAL_XSPI_BlockDev_Erase(XSPI_HandleTypeDef *hxspi, XSPI_BlockDevTypeDef *pDev, uint32_t Address);
+HAL_StatusTypeDef     HAL_XSPI_BlockDev_Sync(XSPI_HandleTypeDef *hxspi, XSPI_BlockDevTypeDef *pDev);
+HAL_StatusTypeDef     HAL_XSPI_BlockDev_ReserveErase(XSPI_HandleTypeDef *hxspi, XSPI_BlockDevTypeDef *pDev,
+                                                     uint32_t Address);
+HAL_StatusTypeDef     HAL_XSPI_BlockDev_Process(XSPI_HandleTypeDef *hxspi, XSPI_BlockDevTypeDef *pDev);
+
 /* Callback functions in non-blocking modes ***********************************/
 void                  HAL_XSPI_ErrorCallback(XSPI_HandleTypeDef *hxspi);
 void                  HAL_XSPI_AbortCpltCallback(XSPI_HandleTypeDef *hxspi);
@@ -1039,6 +1189,8 @@ HAL_StatusTypeDef      HAL_XSPI_DLYB_SetConfig(XSPI_HandleTypeDef *hxspi, const
 HAL_StatusTypeDef      HAL_XSPI_DLYB_GetConfig(XSPI_HandleTypeDef *hxspi, HAL_XSPI_DLYB_CfgTypeDef *pdlyb_cfg);
 HAL_StatusTypeDef      HAL_XSPI_DLYB_GetClockPeriod(XSPI_HandleTypeDef *hxspi,
                                                     HAL_XSPI_DLYB_CfgTypeDef  *pdlyb_cfg);
+HAL_StatusTypeDef      HAL_XSPI_DLYB_Calibrate(XSPI_HandleTypeDef *hxspi, XSPI_DLYB_CalibrationTypeDef *pCalib,
+                                               HAL_XSPI_DLYB_CfgTypeDef *pdlyb_cfg);
 
 /**
   * @}
@@ -585,6 +585,33 @@ typedef struct
   __IO uint32_t LinkRegisters[8U];
 
 } LL_DMA_LinkNodeTypeDef;
+
+/**
+  * @brief  LL DMA linked list queue structure definition.
+  * @note   The nodes are stored in a user array. All the nodes of a queue share the layout of the first
+  *         appended node (node type and updated registers) and the same 64 KB linked list base address.
+  */
+typedef struct
+{
+  LL_DMA_LinkNodeTypeDef *pNodes;         /*!< Specifies the user array of nodes.                               */
+
+  uint32_t MaxNodes;                      /*!< Specifies the number of nodes of the pNodes array.               */
+
+  uint32_t NodeNb;                        /*!< Specifies the number of nodes appended to the queue.             */
+
+  uint32_t NodeType;                      /*!< Specifies the node type of the queue nodes.
+                                               This parameter can be a value of @ref DMA_LL_EC_LINKEDLIST_NODE_TYPE */
+
+  uint32_t UpdateRegisters;               /*!< Specifies the registers updated by the queue nodes.
+                                               This parameter can be a combination of
+                                               @ref DMA_LL_EC_LINKEDLIST_REGISTER_UPDATE                        */
+
+  uint32_t CLLRIdx;                       /*!< Specifies the index of the CLLR register in the queue nodes.     */
+
+  uint32_t FirstCircularNode;             /*!< Specifies the index of the node linked after the last one when the
+                                               queue is circular, LL_DMA_QUEUE_NOT_CIRCULAR otherwise.          */
+
+} LL_DMA_LinkQueueTypeDef;
 /**
   * @}
   */
@@ -635,6 +662,14 @@ typedef struct
 #define LL_DMA_CLLR_OFFSET5 (0x05U)
 #define LL_DMA_CLLR_OFFSET6 (0x06U)
 #define LL_DMA_CLLR_OFFSET7 (0x07U)
+/**
+  * @}
+  */
+
+/** @defgroup DMA_LL_EC_QUEUE_CIRCULAR Linked list queue circular mode
+  * @{
+  */
+#define LL_DMA_QUEUE_NOT_CIRCULAR (0xFFFFFFFFU) /*!< The last node of the queue is not linked to any node */
 /**
   * @}
   */
@@ -7454,6 +7489,12 @@ uint32_t LL_DMA_CreateLinkNode(const LL_DMA_InitNodeTypeDef *DMA_InitNodeStruct,
 void     LL_DMA_ConnectLinkNode(LL_DMA_LinkNodeTypeDef *pPrevLinkNode, uint32_t PrevNodeCLLRIdx,
                                 LL_DMA_LinkNodeTypeDef *pNewLinkNode, uint32_t NewNodeCLLRIdx);
 void     LL_DMA_DisconnectNextLinkNode(LL_DMA_LinkNodeTypeDef *pLinkNode, uint32_t LinkNodeCLLRIdx);
+
+void     LL_DMA_Queue_Init(LL_DMA_LinkQueueTypeDef *pQueue, LL_DMA_LinkNodeTypeDef *pNodes, uint32_t MaxNodes);
+uint32_t LL_DMA_Queue_AppendNode(LL_DMA_LinkQueueTypeDef *pQueue, const LL_DMA_InitNodeTypeDef *DMA_InitNodeStruct);
+uint32_t LL_DMA_Queue_SetCircular(LL_DMA_LinkQueueTypeDef *pQueue, uint32_t FirstCircularNodeIdx);
+void     LL_DMA_Queue_ClearCircular(LL_DMA_LinkQueueTypeDef *pQueue);
+uint32_t LL_DMA_Queue_Start(DMA_TypeDef *DMAx, uint32_t Channel, const LL_DMA_LinkQueueTypeDef *pQueue);
 /**
   * @}
   */
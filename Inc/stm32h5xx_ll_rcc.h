@@ -123,6 +123,19 @@ typedef struct
   uint32_t PLL_R_Frequency;
 } LL_PLL_ClocksTypeDef;
 
+/**
+  * @brief  RCC Clock Tree Snapshot Structure
+  */
+typedef struct
+{
+  LL_RCC_ClocksTypeDef Clocks;      /*!< System and buses clocks frequencies */
+  LL_PLL_ClocksTypeDef PLL1_Clocks; /*!< PLL1 outputs frequencies */
+  LL_PLL_ClocksTypeDef PLL2_Clocks; /*!< PLL2 outputs frequencies */
+#if defined(RCC_CR_PLL3ON)
+  LL_PLL_ClocksTypeDef PLL3_Clocks; /*!< PLL3 outputs frequencies */
+#endif /* PLL3 */
+} LL_RCC_ClockSnapshotTypeDef;
+
 /**
   * @}
   */
@@ -6947,6 +6960,9 @@ void        LL_RCC_GetPLL2ClockFreq(LL_PLL_ClocksTypeDef *pPLL_Clocks);
 void        LL_RCC_GetPLL3ClockFreq(LL_PLL_ClocksTypeDef *pPLL_Clocks);
 #endif /* PLL3 */
 void        LL_RCC_GetSystemClocksFreq(LL_RCC_ClocksTypeDef *pRCC_Clocks);
+void        LL_RCC_UpdateClockSnapshot(void);
+void        LL_RCC_InvalidateClockSnapshot(void);
+void        LL_RCC_GetClockSnapshot(LL_RCC_ClockSnapshotTypeDef *pSnapshot);
 uint32_t    LL_RCC_GetUSARTClockFreq(uint32_t USARTxSource);
 #if defined(UART4)
 uint32_t    LL_RCC_GetUARTClockFreq(uint32_t UARTxSource);
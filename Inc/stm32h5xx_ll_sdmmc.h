@@ -140,6 +140,13 @@ typedef struct
   SDMMC_DMALinkNodeTypeDef *pTailNode;  /*!<  Linked List Node Head                        */
   uint32_t NodesCounter ;               /*!<  Node is ready for execution                  */
 } SDMMC_DMALinkedListTypeDef;
+
+typedef struct
+{
+  uint32_t BufferAddress;              /*!<  Scatter-gather buffer address, word aligned  */
+  uint32_t BufferSize ;                /*!<  Scatter-gather buffer size in bytes,
+                                             multiple of 32 bytes                         */
+} SDMMC_DMAIOVecTypeDef;
 /**
   * @}
   */
@@ -278,6 +285,7 @@ typedef struct
 #define SDMMC_CMD_APP_SD_SET_BUSWIDTH                 6U   /*!< (ACMD6) Defines the data bus width to be used for data transfer. The allowed data bus widths are given in SCR register.                                                   */
 #define SDMMC_CMD_SD_APP_STATUS                       13U  /*!< (ACMD13) Sends the SD status.                                                            */
 #define SDMMC_CMD_SD_APP_SEND_NUM_WRITE_BLOCKS        22U  /*!< (ACMD22) Sends the number of the written (without errors) write blocks. Responds with 32bit+CRC data block.                                                               */
+#define SDMMC_CMD_SD_APP_SET_WR_BLK_ERASE_COUNT       23U  /*!< (ACMD23) Set the number of write blocks to be pre-erased before writing, for faster multiple block write. */
 #define SDMMC_CMD_SD_APP_OP_COND                      41U  /*!< (ACMD41) Sends host capacity support information (HCS) and asks the accessed card to send its operating condition register (OCR) content in the response on the CMD line. */
 #define SDMMC_CMD_SD_APP_SET_CLR_CARD_DETECT          42U  /*!< (ACMD42) Connect/Disconnect the 50 KOhm pull-up resistor on CD/DAT3 (pin 1) of the card  */
 #define SDMMC_CMD_SD_APP_SEND_SCR                     51U  /*!< Reads the SD Configuration Register (SCR).                                               */
@@ -1257,6 +1265,8 @@ uint32_t SDMMC_CmdOpCondition(SDMMC_TypeDef *SDMMCx, uint32_t Argument);
 uint32_t SDMMC_CmdSwitch(SDMMC_TypeDef *SDMMCx, uint32_t Argument);
 uint32_t SDMMC_CmdSendEXTCSD(SDMMC_TypeDef *SDMMCx, uint32_t Argument);
 uint32_t SDMMC_CmdBlockCount(SDMMC_TypeDef *SDMMCx, uint32_t BlockCount);
+uint32_t SDMMC_CmdSetWrBlkEraseCount(SDMMC_TypeDef *SDMMCx, uint32_t BlockCount);
+uint32_t SDMMC_CmdSendTuningBlock(SDMMC_TypeDef *SDMMCx);
 uint32_t SDMMC_SDIO_CmdReadWriteDirect(SDMMC_TypeDef *SDMMCx, uint32_t Argument, uint8_t *pResponse);
 uint32_t SDMMC_SDIO_CmdReadWriteExtended(SDMMC_TypeDef *SDMMCx, uint32_t Argument);
 uint32_t SDMMC_CmdSendOperationcondition(SDMMC_TypeDef *SDMMCx, uint32_t Argument, uint32_t *pResp);
@@ -1291,6 +1301,9 @@ uint32_t SDMMC_DMALinkedList_LockNode(SDMMC_DMALinkNodeTypeDef *pNode);
 uint32_t SDMMC_DMALinkedList_UnlockNode(SDMMC_DMALinkNodeTypeDef *pNode);
 uint32_t SDMMC_DMALinkedList_EnableCircularMode(SDMMC_DMALinkedListTypeDef *pLinkedList);
 uint32_t SDMMC_DMALinkedList_DisableCircularMode(SDMMC_DMALinkedListTypeDef *pLinkedList);
+uint32_t SDMMC_DMALinkedList_BuildIOVec(SDMMC_DMALinkedListTypeDef *pLinkedList, SDMMC_DMALinkNodeTypeDef *pNodes,
+                                        const SDMMC_DMAIOVecTypeDef *pIOVec, uint32_t IOVecCount,
+                                        uint32_t *pDataLength);
 /**
   * @}
   */
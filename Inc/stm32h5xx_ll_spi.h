@@ -45,6 +45,10 @@ extern "C" {
 /** @defgroup SPI_LL_Private_Macros SPI Private Macros
   * @{
   */
+/* Number of bytes moved by the DMA for each SPI frame */
+#define __LL_SPI_FRAME_BYTES(__SPIx__)                                                         \
+  ((READ_BIT((__SPIx__)->CFG1, SPI_CFG1_DSIZE) > LL_SPI_DATAWIDTH_16BIT) ? 4U :                \
+   ((READ_BIT((__SPIx__)->CFG1, SPI_CFG1_DSIZE) > LL_SPI_DATAWIDTH_8BIT) ? 2U : 1U))
 /**
   * @}
   */
@@ -2314,6 +2318,139 @@ __STATIC_INLINE uint32_t LL_SPI_DMA_GetRxRegAddr(const SPI_TypeDef *SPIx)
 {
   return (uint32_t) &(SPIx->RXDR);
 }
+
+/**
+  * @brief  Start a DMA transmission in a few register writes
+  * @note   The SPI must be disabled and configured. The GPDMA channel must be disabled and
+  *         preconfigured for a memory to peripheral transfer on the SPI Tx request (CTR1, CTR2),
+  *         only its addresses and block size are written here.
+  * @note   Call LL_SPI_StopDMA() once the EOT flag is set before starting a new transfer.
+  * @rmtoll CR2          TSIZE         LL_SPI_TransmitDMA\n
+  *         CFG1         TXDMAEN       LL_SPI_TransmitDMA\n
+  *         CR1          SPE           LL_SPI_TransmitDMA\n
+  *         CR1          CSTART        LL_SPI_TransmitDMA
+  * @param  SPIx SPI Instance
+  * @param  DMAChannelx GPDMA channel Instance
+  * @param  pData Pointer to the data buffer
+  * @param  Count Number of frames to transmit, 1..0xFFFF
+  * @retval None
+  */
+__STATIC_INLINE void LL_SPI_TransmitDMA(SPI_TypeDef *SPIx, DMA_Channel_TypeDef *DMAChannelx, const void *pData,
+                                        uint32_t Count)
+{
+  WRITE_REG(DMAChannelx->CSAR, (uint32_t)pData);
+  WRITE_REG(DMAChannelx->CDAR, (uint32_t) &(SPIx->TXDR));
+  MODIFY_REG(DMAChannelx->CBR1, DMA_CBR1_BNDT, (Count * __LL_SPI_FRAME_BYTES(SPIx)));
+  SET_BIT(DMAChannelx->CCR, DMA_CCR_EN);
+
+  MODIFY_REG(SPIx->CR2, SPI_CR2_TSIZE, Count);
+  SET_BIT(SPIx->CFG1, SPI_CFG1_TXDMAEN);
+  SET_BIT(SPIx->CR1, SPI_CR1_SPE);
+  if (READ_BIT(SPIx->CFG2, SPI_CFG2_MASTER) == SPI_CFG2_MASTER)
+  {
+    SET_BIT(SPIx->CR1, SPI_CR1_CSTART);
+  }
+}
+
+/**
+  * @brief  Start a DMA reception in a few register writes
+  * @note   The SPI must be disabled and configured. The GPDMA channel must be disabled and
+  *         preconfigured for a peripheral to memory transfer on the SPI Rx request (CTR1, CTR2),
+  *         only its addresses and block size are written here.
+  * @note   Call LL_SPI_StopDMA() once the EOT flag is set before starting a new transfer.
+  * @rmtoll CFG1         RXDMAEN       LL_SPI_ReceiveDMA\n
+  *         CR2          TSIZE         LL_SPI_ReceiveDMA\n
+  *         CR1          SPE           LL_SPI_ReceiveDMA\n
+  *         CR1          CSTART        LL_SPI_ReceiveDMA
+  * @param  SPIx SPI Instance
+  * @param  DMAChannelx GPDMA channel Instance
+  * @param  pData Pointer to the data buffer
+  * @param  Count Number of frames to receive, 1..0xFFFF
+  * @retval None
+  */
+__STATIC_INLINE void LL_SPI_ReceiveDMA(SPI_TypeDef *SPIx, DMA_Channel_TypeDef *DMAChannelx, void *pData,
+                                       uint32_t Count)
+{
+  SET_BIT(SPIx->CFG1, SPI_CFG1_RXDMAEN);
+
+  WRITE_REG(DMAChannelx->CSAR, (uint32_t) &(SPIx->RXDR));
+  WRITE_REG(DMAChannelx->CDAR, (uint32_t)pData);
+  MODIFY_REG(DMAChannelx->CBR1, DMA_CBR1_BNDT, (Count * __LL_SPI_FRAME_BYTES(SPIx)));
+  SET_BIT(DMAChannelx->CCR, DMA_CCR_EN);
+
+  MODIFY_REG(SPIx->CR2, SPI_CR2_TSIZE, Count);
+  SET_BIT(SPIx->CR1, SPI_CR1_SPE);
+  if (READ_BIT(SPIx->CFG2, SPI_CFG2_MASTER) == SPI_CFG2_MASTER)
+  {
+    SET_BIT(SPIx->CR1, SPI_CR1_CSTART);
+  }
+}
+
+/**
+  * @brief  Start a full duplex DMA transfer in a few register writes
+  * @note   The SPI must be disabled and configured. The GPDMA channels must be disabled and
+  *         preconfigured on the SPI Tx and Rx requests (CTR1, CTR2), only their addresses and
+  *         block sizes are written here.
+  * @note   Call LL_SPI_StopDMA() once the EOT flag is set before starting a new transfer.
+  * @rmtoll CFG1         RXDMAEN       LL_SPI_TransmitReceiveDMA\n
+  *         CR2          TSIZE         LL_SPI_TransmitReceiveDMA\n
+  *         CFG1         TXDMAEN       LL_SPI_TransmitReceiveDMA\n
+  *         CR1          SPE           LL_SPI_TransmitReceiveDMA\n
+  *         CR1          CSTART        LL_SPI_TransmitReceiveDMA
+  * @param  SPIx SPI Instance
+  * @param  TxDMAChannelx GPDMA channel Instance used for the transmission
+  * @param  RxDMAChannelx GPDMA channel Instance used for the reception
+  * @param  pTxData Pointer to the transmission data buffer
+  * @param  pRxData Pointer to the reception data buffer
+  * @param  Count Number of frames to transfer, 1..0xFFFF
+  * @retval None
+  */
+__STATIC_INLINE void LL_SPI_TransmitReceiveDMA(SPI_TypeDef *SPIx, DMA_Channel_TypeDef *TxDMAChannelx,
+                                               DMA_Channel_TypeDef *RxDMAChannelx, const void *pTxData,
+                                               void *pRxData, uint32_t Count)
+{
+  uint32_t size = Count * __LL_SPI_FRAME_BYTES(SPIx);
+
+  /* The Rx DMA request is enabled before the Rx channel, then the Tx one after the Tx channel */
+  SET_BIT(SPIx->CFG1, SPI_CFG1_RXDMAEN);
+
+  WRITE_REG(RxDMAChannelx->CSAR, (uint32_t) &(SPIx->RXDR));
+  WRITE_REG(RxDMAChannelx->CDAR, (uint32_t)pRxData);
+  MODIFY_REG(RxDMAChannelx->CBR1, DMA_CBR1_BNDT, size);
+  SET_BIT(RxDMAChannelx->CCR, DMA_CCR_EN);
+
+  WRITE_REG(TxDMAChannelx->CSAR, (uint32_t)pTxData);
+  WRITE_REG(TxDMAChannelx->CDAR, (uint32_t) &(SPIx->TXDR));
+  MODIFY_REG(TxDMAChannelx->CBR1, DMA_CBR1_BNDT, size);
+  SET_BIT(TxDMAChannelx->CCR, DMA_CCR_EN);
+
+  MODIFY_REG(SPIx->CR2, SPI_CR2_TSIZE, Count);
+  SET_BIT(SPIx->CFG1, SPI_CFG1_TXDMAEN);
+  SET_BIT(SPIx->CR1, SPI_CR1_SPE);
+  if (READ_BIT(SPIx->CFG2, SPI_CFG2_MASTER) == SPI_CFG2_MASTER)
+  {
+    SET_BIT(SPIx->CR1, SPI_CR1_CSTART);
+  }
+}
+
+/**
+  * @brief  Close a DMA transfer started by LL_SPI_TransmitDMA(), LL_SPI_ReceiveDMA() or
+  *         LL_SPI_TransmitReceiveDMA()
+  * @note   The end of transfer flags are cleared, the SPI is disabled and its DMA requests too.
+  * @rmtoll IFCR         EOTC          LL_SPI_StopDMA\n
+  *         IFCR         TXTFC         LL_SPI_StopDMA\n
+  *         CR1          SPE           LL_SPI_StopDMA\n
+  *         CFG1         TXDMAEN       LL_SPI_StopDMA\n
+  *         CFG1         RXDMAEN       LL_SPI_StopDMA
+  * @param  SPIx SPI Instance
+  * @retval None
+  */
+__STATIC_INLINE void LL_SPI_StopDMA(SPI_TypeDef *SPIx)
+{
+  WRITE_REG(SPIx->IFCR, (SPI_IFCR_EOTC | SPI_IFCR_TXTFC));
+  CLEAR_BIT(SPIx->CR1, SPI_CR1_SPE);
+  CLEAR_BIT(SPIx->CFG1, (SPI_CFG1_TXDMAEN | SPI_CFG1_RXDMAEN));
+}
 /**
   * @}
   */
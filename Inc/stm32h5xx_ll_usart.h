@@ -4239,6 +4239,60 @@ __STATIC_INLINE uint32_t LL_USART_DMA_GetRegAddr(const USART_TypeDef *USARTx, ui
   return data_reg_addr;
 }
 
+/**
+  * @brief  Start a DMA transmission in a few register writes
+  * @note   The USART must be enabled and configured. The GPDMA channel must be disabled and
+  *         preconfigured for a memory to peripheral transfer on the USART Tx request (CTR1, CTR2),
+  *         only its addresses and block size are written here.
+  * @note   The end of the transmission is signaled by the TC flag, the DMA request can then be
+  *         disabled with LL_USART_DisableDMAReq_TX().
+  * @rmtoll ICR          TCCF          LL_USART_TransmitDMA\n
+  *         CR3          DMAT          LL_USART_TransmitDMA
+  * @param  USARTx USART Instance
+  * @param  DMAChannelx GPDMA channel Instance
+  * @param  pData Pointer to the data buffer
+  * @param  Size Number of bytes to transmit, 1..0xFFFF
+  * @retval None
+  */
+__STATIC_INLINE void LL_USART_TransmitDMA(USART_TypeDef *USARTx, DMA_Channel_TypeDef *DMAChannelx,
+                                          const void *pData, uint32_t Size)
+{
+  WRITE_REG(DMAChannelx->CSAR, (uint32_t)pData);
+  WRITE_REG(DMAChannelx->CDAR, (uint32_t) &(USARTx->TDR));
+  MODIFY_REG(DMAChannelx->CBR1, DMA_CBR1_BNDT, Size);
+  SET_BIT(DMAChannelx->CCR, DMA_CCR_EN);
+
+  WRITE_REG(USARTx->ICR, USART_ICR_TCCF);
+  ATOMIC_SET_BIT(USARTx->CR3, USART_CR3_DMAT);
+}
+
+/**
+  * @brief  Start a DMA reception in a few register writes
+  * @note   The USART must be enabled and configured. The GPDMA channel must be disabled and
+  *         preconfigured for a peripheral to memory transfer on the USART Rx request (CTR1, CTR2),
+  *         only its addresses and block size are written here.
+  * @note   The end of the reception is signaled by the GPDMA channel transfer complete flag, the
+  *         DMA request can then be disabled with LL_USART_DisableDMAReq_RX().
+  * @rmtoll ICR          ORECF         LL_USART_ReceiveDMA\n
+  *         CR3          DMAR          LL_USART_ReceiveDMA
+  * @param  USARTx USART Instance
+  * @param  DMAChannelx GPDMA channel Instance
+  * @param  pData Pointer to the data buffer
+  * @param  Size Number of bytes to receive, 1..0xFFFF
+  * @retval None
+  */
+__STATIC_INLINE void LL_USART_ReceiveDMA(USART_TypeDef *USARTx, DMA_Channel_TypeDef *DMAChannelx, void *pData,
+                                         uint32_t Size)
+{
+  WRITE_REG(DMAChannelx->CSAR, (uint32_t) &(USARTx->RDR));
+  WRITE_REG(DMAChannelx->CDAR, (uint32_t)pData);
+  MODIFY_REG(DMAChannelx->CBR1, DMA_CBR1_BNDT, Size);
+  SET_BIT(DMAChannelx->CCR, DMA_CCR_EN);
+
+  WRITE_REG(USARTx->ICR, USART_ICR_ORECF);
+  ATOMIC_SET_BIT(USARTx->CR3, USART_CR3_DMAR);
+}
+
 /**
   * @}
   */
@@ -569,6 +569,11 @@ typedef USB_HCTypeDef       USB_DRD_HCTypeDef;
 
 #define EP_ADDR_MSK                            0xFU
 #endif /* defined (USB_OTG_FS) || defined (USB_OTG_HS) */
+
+/*!< Alignment of the transfer buffers taking the word copy fast path:
+     class drivers should provide buffers aligned on this boundary */
+#define USB_BUFFER_ALIGNMENT                   4U
+
 #if defined (USB_DRD_FS)
 #define EP_ADDR_MSK                            0x7U
 
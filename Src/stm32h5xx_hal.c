@@ -46,6 +46,14 @@
 #ifdef HAL_MODULE_ENABLED
 
 /* Private typedef ---------------------------------------------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t Base;      /* Start address, non-secure alias */
+  uint32_t Size;      /* Size in bytes */
+  uint32_t Region;    /* HAL_MEM_REGION_xxx identifier */
+  uint32_t Masters;   /* Bus masters reaching the region, HAL_MEM_MASTER_xxx combination */
+} MEM_RegionTypeDef;
+
 /* Private define ----------------------------------------------------------------------------------------------------*/
 /**
   * @brief STM32H5xx HAL Driver version number 1.6.0
@@ -70,8 +78,49 @@
 #define SBS_DEBUG_LOCK_VALUE      (uint8_t)0xC3
 #define SBS_DEBUG_UNLOCK_VALUE    (uint8_t)0xB4
 
+/* Memory map of the regions with no size definition in the device header */
+#define HAL_MEM_FLASH_AREA_SIZE   0x04000000UL  /* Flash area up to the secure alias */
+#define HAL_MEM_EXT_BASE          0x60000000UL  /* FMC banks and OCTOSPI memory */
+#define HAL_MEM_EXT_SIZE          0x40000000UL
+#define HAL_MEM_PERIPH_SIZE       0x10000000UL
+#define HAL_MEM_SECURE_OFFSET     0x10000000UL  /* Secure alias of the SRAMs and peripherals */
+#define HAL_MEM_FLASH_S_OFFSET    0x04000000UL  /* Secure alias of the flash */
+
+#define HAL_MEM_MASTER_ALL        (HAL_MEM_MASTER_CPU | HAL_MEM_MASTER_GPDMA | HAL_MEM_MASTER_ETH | \
+                                   HAL_MEM_MASTER_SDMMC)
+#define HAL_MEM_MASTER_AHB        (HAL_MEM_MASTER_CPU | HAL_MEM_MASTER_GPDMA)
+
 /* Private macro -----------------------------------------------------------------------------------------------------*/
 /* Private variables -------------------------------------------------------------------------------------------------*/
+#if defined(USE_HAL_OS_HOOKS) && (USE_HAL_OS_HOOKS == 1U)
+static const HAL_OS_HooksTypeDef *pHalOsHooks = NULL;
+#endif /* USE_HAL_OS_HOOKS */
+#if defined(USE_HAL_TRACE) && (USE_HAL_TRACE == 1U)
+static HAL_TraceRecordTypeDef *pHalTraceBuffer = NULL;
+static uint32_t uwHalTraceMask;             /* Ring size minus one */
+static __IO uint32_t uwHalTraceWrIndex;     /* Free running index of the next record to write */
+static uint32_t uwHalTraceRdIndex;          /* Free running index of the next record to flush */
+#endif /* USE_HAL_TRACE */
+
+/* Bus matrix reachability of the memories. ETH and SDMMC are not connected to the AHB peripheral
+   buses, so they cannot reach the backup SRAM. The backup SRAM is looked up before the peripherals */
+static const MEM_RegionTypeDef aHalMemRegions[] =
+{
+  {SRAM1_BASE_NS,   SRAM1_SIZE,              HAL_MEM_REGION_SRAM1,    HAL_MEM_MASTER_ALL},
+  {SRAM2_BASE_NS,   SRAM2_SIZE,              HAL_MEM_REGION_SRAM2,    HAL_MEM_MASTER_ALL},
+#if defined(SRAM3_BASE_NS)
+  {SRAM3_BASE_NS,   SRAM3_SIZE,              HAL_MEM_REGION_SRAM3,    HAL_MEM_MASTER_ALL},
+#endif /* SRAM3_BASE_NS */
+  {BKPSRAM_BASE_NS, BKPSRAM_SIZE,            HAL_MEM_REGION_BKPSRAM,  HAL_MEM_MASTER_AHB},
+  {FLASH_BASE_NS,   HAL_MEM_FLASH_AREA_SIZE, HAL_MEM_REGION_FLASH,    HAL_MEM_MASTER_ALL},
+  {HAL_MEM_EXT_BASE, HAL_MEM_EXT_SIZE,       HAL_MEM_REGION_EXTERNAL, HAL_MEM_MASTER_ALL},
+  {PERIPH_BASE_NS,  HAL_MEM_PERIPH_SIZE,     HAL_MEM_REGION_PERIPH,   HAL_MEM_MASTER_AHB},
+};
+
+static HAL_MemPoolTypeDef *pHalMemPoolList = NULL;
+#if defined(USE_HAL_CLOCK_GATING) && (USE_HAL_CLOCK_GATING == 1U)
+static HAL_ClockGateTypeDef *pHalClockGateList = NULL;
+#endif /* USE_HAL_CLOCK_GATING */
 /* Exported variables ------------------------------------------------------------------------------------------------*/
 
 /** @defgroup HAL_Exported_Variables HAL Exported Variables
@@ -85,6 +134,7 @@ HAL_TickFreqTypeDef uwTickFreq = HAL_TICK_FREQ_DEFAULT;  /* 1KHz */
   */
 
 /* Private function prototypes ---------------------------------------------------------------------------------------*/
+static const MEM_RegionTypeDef *MEM_FindRegion(uint32_t Address, uint32_t *pOffset);
 /* Exported functions ------------------------------------------------------------------------------------------------*/
 
 /** @defgroup HAL_Exported_Functions HAL Exported Functions
@@ -311,13 +361,41 @@ __weak HAL_StatusTypeDef HAL_InitTick(uint32_t TickPriority)
                                        ##### HAL Control functions #####
  =======================================================================================================================
     [..]  This section provides functions allowing to:
-      (+) Provide a tick value in millisecond
+      (+) Provide a tick value in millisecond, and the time in microsecond
       (+) Provide a blocking delay in millisecond
       (+) Suspend the time base source interrupt
       (+) Resume the time base source interrupt
       (+) Get the HAL API driver version
       (+) Get the device identifier
       (+) Get the device revision identifier
+      (+) Register the OS hooks letting blocking functions wait on an RTOS object
+      (+) Submit and chain asynchronous requests running on several drivers
+      (+) Gate the clock of the idle peripherals
+
+    [..]  With USE_HAL_OS_HOOKS set to 1 in the HAL configuration, HAL_OS_RegisterHooks() registers
+          the wait and signal functions of the application RTOS, typically a binary semaphore or a
+          thread notification per object. The blocking transfer functions of the drivers supporting
+          it (SPI, I2C master), when called from a thread, then start the interrupt variant of the
+          transfer and wait for its end with HAL_OS_Wait() instead of polling the flags.
+          The completion callbacks of the interrupt variant are not called for these transfers.
+
+    [..]  With USE_HAL_REQUEST set to 1 in the HAL configuration, a HAL_RequestTypeDef describes
+          a DMA operation of a driver (SPI, CRYP, HASH) by its Start function, handle, operation
+          and buffers. HAL_Request_Chain() links requests, e.g. a SPI reception, then the CRYP
+          decryption of the received buffer, then its HASH digest, and HAL_Request_Submit()
+          starts the first one. Each driver calls HAL_Request_Complete() at the end of the
+          transfer, which reports the request and starts the next one of the chain from the
+          same interrupt, so the whole flow runs without application code between the steps.
+          A failed request ends the chain. The completion is reported by the optional request
+          callback and completion queue, read from a thread with HAL_RequestQueue_Get(). The
+          driver completion callbacks are not called for the requests.
+
+    [..]  With USE_HAL_CLOCK_GATING set to 1 in the HAL configuration, HAL_ClockGate_Register()
+          registers the RCC clock enable bits of a peripheral with its handle. HAL_IncTick()
+          clears them once the handle has not been locked for IdleTime ms and the IsIdle function
+          reports it in the READY state, and __HAL_LOCK() sets them back at the next driver call
+          on the handle. The driver functions not locking the handle (e.g. the state getters)
+          read a gated peripheral as 0, HAL_ClockGate_Wake() re-enables its clock explicitly.
 
 @endverbatim
   * @{
@@ -335,6 +413,10 @@ __weak HAL_StatusTypeDef HAL_InitTick(uint32_t TickPriority)
 __weak void HAL_IncTick(void)
 {
   uwTick += (uint32_t)uwTickFreq;
+#if defined(USE_HAL_CLOCK_GATING) && (USE_HAL_CLOCK_GATING == 1U)
+
+  HAL_ClockGate_Process();
+#endif /* USE_HAL_CLOCK_GATING */
 }
 
 /**
@@ -348,6 +430,18 @@ __weak uint32_t HAL_GetTick(void)
   return uwTick;
 }
 
+/**
+  * @brief Provides the time in microseconds.
+  * @note The default implementation has the resolution of the millisecond tick.
+  *       This function is declared as __weak to be overwritten by a high resolution
+  *       time base, as in stm32h5xx_hal_timebase_lptim_template.c.
+  * @retval 64-bit time in microseconds
+  */
+__weak uint64_t HAL_GetTickUs64(void)
+{
+  return (uint64_t)HAL_GetTick() * 1000U;
+}
+
 /**
   * @brief This function returns a tick priority.
   * @retval tick priority
@@ -458,6 +552,332 @@ __weak void HAL_ResumeTick(void)
   SysTick->CTRL  |= SysTick_CTRL_TICKINT_Msk;
 }
 
+#if defined(USE_HAL_OS_HOOKS) && (USE_HAL_OS_HOOKS == 1U)
+/**
+  * @brief  Register the OS hooks used by the blocking functions.
+  * @note   Call after HAL_Init() and before any blocking transfer. The structure must remain
+  *         valid while registered. NULL unregisters the hooks, the blocking functions then
+  *         poll the flags again.
+  * @param  pHooks pointer to a HAL_OS_HooksTypeDef structure, or NULL.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_OS_RegisterHooks(const HAL_OS_HooksTypeDef *pHooks)
+{
+  if ((pHooks != NULL) && ((pHooks->Wait == NULL) || (pHooks->Signal == NULL)))
+  {
+    return HAL_ERROR;
+  }
+
+  pHalOsHooks = pHooks;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Check if the caller can wait on the OS hooks.
+  * @retval 1 if hooks are registered and the caller is a thread with interrupts enabled, 0 otherwise.
+  */
+uint32_t HAL_OS_IsBlockingAllowed(void)
+{
+  if ((pHalOsHooks == NULL) || (__get_IPSR() != 0U) || (__get_PRIMASK() != 0U))
+  {
+    return 0U;
+  }
+
+  return 1U;
+}
+
+/**
+  * @brief  Block the calling thread until HAL_OS_Signal() is called for an object.
+  * @param  pObject Object waited for, the handle of the driver.
+  * @param  Timeout Timeout duration in ms.
+  * @retval HAL_OK when signaled, HAL_TIMEOUT otherwise.
+  */
+HAL_StatusTypeDef HAL_OS_Wait(const void *pObject, uint32_t Timeout)
+{
+  return pHalOsHooks->Wait(pObject, Timeout);
+}
+
+/**
+  * @brief  Wake up the thread waiting on an object.
+  * @param  pObject Object waited for, the handle of the driver.
+  * @retval None
+  */
+void HAL_OS_Signal(const void *pObject)
+{
+  if (pHalOsHooks != NULL)
+  {
+    pHalOsHooks->Signal(pObject);
+  }
+}
+#endif /* USE_HAL_OS_HOOKS */
+
+#if defined(USE_HAL_REQUEST) && (USE_HAL_REQUEST == 1U)
+/**
+  * @brief  Start an asynchronous request.
+  * @note   The requests chained to pReq are started one after the other as each one completes.
+  * @note   The Status field of a request must be HAL_OK (zero) before its first submission.
+  * @param  pReq pointer to a HAL_RequestTypeDef structure, Start and Handle must be set.
+  * @retval HAL status of the request start
+  */
+HAL_StatusTypeDef HAL_Request_Submit(HAL_RequestTypeDef *pReq)
+{
+  HAL_StatusTypeDef status;
+
+  if ((pReq == NULL) || (pReq->Start == NULL) || (pReq->Handle == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  if (pReq->Status == HAL_BUSY)
+  {
+    return HAL_BUSY;
+  }
+
+  pReq->Status = HAL_BUSY;
+
+  status = pReq->Start(pReq);
+  if (status != HAL_OK)
+  {
+    pReq->Status = HAL_ERROR;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Chain a request to another one.
+  * @note   pNext is submitted from the completion context of pReq when pReq completes with HAL_OK.
+  * @param  pReq pointer to a HAL_RequestTypeDef structure.
+  * @param  pNext pointer to the next request, NULL to end the chain at pReq.
+  * @retval None
+  */
+void HAL_Request_Chain(HAL_RequestTypeDef *pReq, HAL_RequestTypeDef *pNext)
+{
+  pReq->pNext = pNext;
+}
+
+/**
+  * @brief  Report the completion of a request and start the next one of its chain.
+  * @note   Called by the drivers at the end of the DMA transfer of the request, from interrupt context.
+  * @param  pReq pointer to the completed request.
+  * @param  Status completion status, HAL_OK or HAL_ERROR.
+  * @retval None
+  */
+void HAL_Request_Complete(HAL_RequestTypeDef *pReq, HAL_StatusTypeDef Status)
+{
+  HAL_RequestTypeDef *preq = pReq;
+  HAL_StatusTypeDef status = Status;
+  HAL_RequestQueueTypeDef *pqueue;
+  uint32_t primask_bit;
+
+  while (preq != NULL)
+  {
+    preq->Status = status;
+
+    pqueue = preq->pCpltQueue;
+    if (pqueue != NULL)
+    {
+      preq->pCpltNext = NULL;
+
+      primask_bit = __get_PRIMASK();
+      __disable_irq();
+      if (pqueue->pTail == NULL)
+      {
+        pqueue->pHead = preq;
+      }
+      else
+      {
+        pqueue->pTail->pCpltNext = preq;
+      }
+      pqueue->pTail = preq;
+      __set_PRIMASK(primask_bit);
+    }
+
+    if (preq->CpltCallback != NULL)
+    {
+      preq->CpltCallback(preq);
+    }
+
+    /* A failed request ends the chain */
+    if ((status != HAL_OK) || (preq->pNext == NULL))
+    {
+      break;
+    }
+
+    /* A next request failing to start completes with an error */
+    preq = preq->pNext;
+    if (HAL_Request_Submit(preq) == HAL_OK)
+    {
+      break;
+    }
+    status = HAL_ERROR;
+  }
+}
+
+/**
+  * @brief  Initialize a completion queue.
+  * @param  pQueue pointer to a HAL_RequestQueueTypeDef structure.
+  * @retval None
+  */
+void HAL_RequestQueue_Init(HAL_RequestQueueTypeDef *pQueue)
+{
+  pQueue->pHead = NULL;
+  pQueue->pTail = NULL;
+}
+
+/**
+  * @brief  Get the oldest completed request of a completion queue.
+  * @param  pQueue pointer to a HAL_RequestQueueTypeDef structure.
+  * @retval Completed request removed from the queue, NULL if the queue is empty.
+  */
+HAL_RequestTypeDef *HAL_RequestQueue_Get(HAL_RequestQueueTypeDef *pQueue)
+{
+  HAL_RequestTypeDef *preq;
+  uint32_t primask_bit;
+
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+  preq = pQueue->pHead;
+  if (preq != NULL)
+  {
+    pQueue->pHead = preq->pCpltNext;
+    if (pQueue->pHead == NULL)
+    {
+      pQueue->pTail = NULL;
+    }
+  }
+  __set_PRIMASK(primask_bit);
+
+  return preq;
+}
+#endif /* USE_HAL_REQUEST */
+
+#if defined(USE_HAL_CLOCK_GATING) && (USE_HAL_CLOCK_GATING == 1U)
+/**
+  * @brief  Register the automatic clock gating of a peripheral.
+  * @note   Call after HAL_PPP_Init() of the handle. The structure must remain valid while
+  *         registered, HAL_ClockGate_Unregister() must be called before HAL_PPP_DeInit().
+  * @param  pGate pointer to a HAL_ClockGateTypeDef structure, Handle, pEnableReg, EnableMask,
+  *         IdleTime and IsIdle must be set.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ClockGate_Register(HAL_ClockGateTypeDef *pGate)
+{
+  uint32_t primask_bit;
+
+  if ((pGate == NULL) || (pGate->Handle == NULL) || (pGate->pEnableReg == NULL) || (pGate->EnableMask == 0U) ||
+      (pGate->IdleTime == 0U) || (pGate->IsIdle == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  pGate->LastActivity = uwTick;
+  pGate->Gated = 0U;
+  pGate->GateCount = 0U;
+
+  /* The list is walked from the tick interrupt */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  pGate->pNext = pHalClockGateList;
+  pHalClockGateList = pGate;
+
+  __set_PRIMASK(primask_bit);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Unregister the automatic clock gating of a peripheral, its clock is left enabled.
+  * @param  pGate pointer to a registered HAL_ClockGateTypeDef structure.
+  * @retval HAL status, HAL_ERROR when pGate is not registered.
+  */
+HAL_StatusTypeDef HAL_ClockGate_Unregister(HAL_ClockGateTypeDef *pGate)
+{
+  HAL_ClockGateTypeDef **ppnext;
+  HAL_StatusTypeDef status = HAL_ERROR;
+  uint32_t primask_bit;
+
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  ppnext = &pHalClockGateList;
+  while (*ppnext != NULL)
+  {
+    if (*ppnext == pGate)
+    {
+      *ppnext = pGate->pNext;
+      SET_BIT(*pGate->pEnableReg, pGate->EnableMask);
+      pGate->Gated = 0U;
+      status = HAL_OK;
+      break;
+    }
+    ppnext = &(*ppnext)->pNext;
+  }
+
+  __set_PRIMASK(primask_bit);
+
+  return status;
+}
+
+/**
+  * @brief  Re-enable the clock of a gated peripheral.
+  * @note   Called by __HAL_LOCK() at the start of the driver functions, the clock is running
+  *         again two bus cycles later, before the first peripheral register access.
+  * @param  pHandle Handle of the driver.
+  * @retval None
+  */
+void HAL_ClockGate_Wake(const void *pHandle)
+{
+  HAL_ClockGateTypeDef *pgate = pHalClockGateList;
+  __IO uint32_t tmpreg;
+
+  while (pgate != NULL)
+  {
+    if (pgate->Handle == pHandle)
+    {
+      /* Updated first so that the tick interrupt does not gate the clock again */
+      pgate->LastActivity = uwTick;
+
+      if (pgate->Gated != 0U)
+      {
+        SET_BIT(*pgate->pEnableReg, pgate->EnableMask);
+        /* Delay after an RCC peripheral clock enabling */
+        tmpreg = READ_BIT(*pgate->pEnableReg, pgate->EnableMask);
+        UNUSED(tmpreg);
+        pgate->Gated = 0U;
+      }
+      break;
+    }
+    pgate = pgate->pNext;
+  }
+}
+
+/**
+  * @brief  Gate the clock of the registered peripherals idle for their IdleTime.
+  * @note   Called by HAL_IncTick(), to be called from the time base interrupt when
+  *         HAL_IncTick() is overridden.
+  * @retval None
+  */
+void HAL_ClockGate_Process(void)
+{
+  HAL_ClockGateTypeDef *pgate = pHalClockGateList;
+
+  while (pgate != NULL)
+  {
+    if ((pgate->Gated == 0U) && ((uwTick - pgate->LastActivity) >= pgate->IdleTime) &&
+        (pgate->IsIdle(pgate->Handle) != 0U))
+    {
+      CLEAR_BIT(*pgate->pEnableReg, pgate->EnableMask);
+      pgate->Gated = 1U;
+      pgate->GateCount++;
+    }
+    pgate = pgate->pNext;
+  }
+}
+#endif /* USE_HAL_CLOCK_GATING */
+
 /**
   * @brief  Returns the HAL revision
   * @retval version : 0xXYZR (8bits for each decimal, R for RC)
@@ -527,6 +947,43 @@ uint32_t HAL_GetUIDw2(void)
     [..]  This section provides functions allowing to:
       (+) Enable/Disable Debug module during STOP mode
       (+) Enable/Disable Debug module during STANDBY mode
+      (+) Measure durations with the DWT cycle counter
+      (+) Check and allocate the DMA buffers in the memories reachable by their bus masters
+      (+) Record the HAL trace events and send them over the ITM
+
+    [..]  HAL_CycleCounter_Enable() starts the DWT cycle counter shared by the HAL statistics.
+          A HAL_CycleMeasureTypeDef structure accumulates the count, minimum, maximum and total
+          duration of a code section between HAL_CycleMeasure_Start() and HAL_CycleMeasure_Stop(),
+          e.g. to compare the cycles of a HAL_CRC_Calculate() or a DMA transfer between releases
+          and message sizes. HAL_CycleCounter_ToNs() converts the cycles at the SystemCoreClock
+          frequency.
+
+    [..]  The bus masters do not reach all the memories: the Ethernet and SDMMC DMAs cannot access the
+          backup SRAM, which is on the AHB peripheral bus. HAL_MemRegion_Get() returns the memory of an
+          address, secure or non-secure alias, and HAL_MemRegion_CheckReach() checks that a buffer is
+          reachable by a combination of HAL_MEM_MASTER_xxx, as asserted by the DMA, ETH, MMC and SD
+          drivers with USE_FULL_ASSERT.
+      (+) The __SRAM1_BUFFER, __SRAM2_BUFFER, __SRAM3_BUFFER and __BKPSRAM_BUFFER macros, put before a
+          variable declaration, place it in the linker section HAL_SRAMx_SECTION, e.g. to keep the DMA
+          buffers of concurrent masters in distinct SRAMs.
+      (+) HAL_MemPool_Init() registers a memory area as a pool. HAL_MemPool_Alloc() allocates an aligned
+          buffer from the first registered pool reachable by all the requested masters, and
+          HAL_MemPool_Reset() frees all the buffers of a pool at once. The allocation can be done from
+          any context, there is no individual free.
+
+    [..]  With USE_HAL_TRACE set to 1 in the HAL configuration, the IRQ handlers of the ADC, DMA, ETH,
+          EXTI, FDCAN, GPIO, I2C, SAI, SPI, TIM, UART and USART drivers, and the DMA start functions,
+          call HAL_Trace_Hook() at their entry and exit with an event identifier HAL_TRACE_ID_xxx and
+          the handle. The default hook, enabled by HAL_Trace_Init(), stores each event with the DWT
+          cycle counter in a ring buffer provided by the application, the oldest records being
+          overwritten. It can be called from any context and priority level without masking the
+          interrupts.
+      (+) HAL_Trace_FlushITM() sends the records not yet sent over an ITM stimulus port, to be read
+          over the SWO pin. Call it from a low priority context, e.g. the idle loop.
+      (+) The application can record its own events with HAL_TRACE_ENTER() and HAL_TRACE_EXIT()
+          from HAL_TRACE_ID_USER, or redefine HAL_Trace_Hook() for another backend.
+      (@) The cycle counter wraps around every 2^32 cycles: the time between two events is the
+          unsigned difference of their timestamps.
 
 @endverbatim
   * @{
@@ -568,6 +1025,349 @@ void HAL_DBGMCU_DisableDBGStandbyMode(void)
   CLEAR_BIT(DBGMCU->CR, DBGMCU_CR_DBG_STANDBY);
 }
 
+/**
+  * @brief  Enable the DWT cycle counter used for the time measurements.
+  * @retval None
+  */
+void HAL_CycleCounter_Enable(void)
+{
+  SET_BIT(CoreDebug->DEMCR, CoreDebug_DEMCR_TRCENA_Msk);
+  SET_BIT(DWT->CTRL, DWT_CTRL_CYCCNTENA_Msk);
+}
+
+/**
+  * @brief  Get the DWT cycle counter value.
+  * @retval Cycle counter value, wrapping around every 2^32 cycles
+  */
+uint32_t HAL_CycleCounter_Get(void)
+{
+  return DWT->CYCCNT;
+}
+
+/**
+  * @brief  Convert a number of CPU cycles in nanoseconds.
+  * @param  Cycles Number of cycles at the SystemCoreClock frequency.
+  * @retval Duration in nanoseconds, saturated to 0xFFFFFFFF
+  */
+uint32_t HAL_CycleCounter_ToNs(uint32_t Cycles)
+{
+  uint64_t ns = ((uint64_t)Cycles * 1000000000U) / SystemCoreClock;
+
+  return (ns > 0xFFFFFFFFU) ? 0xFFFFFFFFU : (uint32_t)ns;
+}
+
+/**
+  * @brief  Reset a cycle measurement and enable the cycle counter.
+  * @param  pMeasure pointer to a HAL_CycleMeasureTypeDef structure.
+  * @retval None
+  */
+void HAL_CycleMeasure_Reset(HAL_CycleMeasureTypeDef *pMeasure)
+{
+  HAL_CycleCounter_Enable();
+
+  pMeasure->Start = 0U;
+  pMeasure->Count = 0U;
+  pMeasure->Min   = 0xFFFFFFFFU;
+  pMeasure->Max   = 0U;
+  pMeasure->Total = 0U;
+}
+
+/**
+  * @brief  Start a cycle measurement.
+  * @param  pMeasure pointer to a HAL_CycleMeasureTypeDef structure.
+  * @retval None
+  */
+void HAL_CycleMeasure_Start(HAL_CycleMeasureTypeDef *pMeasure)
+{
+  pMeasure->Start = DWT->CYCCNT;
+}
+
+/**
+  * @brief  Stop a cycle measurement and accumulate its duration.
+  * @note   The duration includes the call overhead of HAL_CycleMeasure_Start() and
+  *         HAL_CycleMeasure_Stop(), obtained by measuring an empty section.
+  * @param  pMeasure pointer to a HAL_CycleMeasureTypeDef structure.
+  * @retval Duration of the measurement in cycles
+  */
+uint32_t HAL_CycleMeasure_Stop(HAL_CycleMeasureTypeDef *pMeasure)
+{
+  uint32_t cycles = DWT->CYCCNT - pMeasure->Start;
+
+  pMeasure->Count++;
+  pMeasure->Total += cycles;
+  if (cycles < pMeasure->Min)
+  {
+    pMeasure->Min = cycles;
+  }
+  if (cycles > pMeasure->Max)
+  {
+    pMeasure->Max = cycles;
+  }
+
+  return cycles;
+}
+
+/**
+  * @brief  Get the memory region of an address.
+  * @param  Address Address in the secure or non-secure alias.
+  * @retval Region, a value of @ref HAL_Memory_Region
+  */
+uint32_t HAL_MemRegion_Get(uint32_t Address)
+{
+  const MEM_RegionTypeDef *pregion;
+  uint32_t offset;
+
+  pregion = MEM_FindRegion(Address, &offset);
+
+  return (pregion != NULL) ? pregion->Region : HAL_MEM_REGION_NONE;
+}
+
+/**
+  * @brief  Check that a buffer is reachable by bus masters.
+  * @param  Masters Bus masters accessing the buffer, a combination of @ref HAL_Memory_Master.
+  * @param  Address Start address of the buffer.
+  * @param  Size Size of the buffer in bytes, a null size is checked as one byte.
+  * @retval HAL_OK when the buffer lies in a single memory reached by all the masters, HAL_ERROR otherwise.
+  */
+HAL_StatusTypeDef HAL_MemRegion_CheckReach(uint32_t Masters, uint32_t Address, uint32_t Size)
+{
+  const MEM_RegionTypeDef *pregion;
+  uint32_t offset;
+  uint32_t size = (Size == 0U) ? 1U : Size;
+
+  pregion = MEM_FindRegion(Address, &offset);
+
+  if ((pregion == NULL) || ((Masters & ~pregion->Masters) != 0U) || (size > (pregion->Size - offset)))
+  {
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Register a memory area as an allocation pool.
+  * @note   The pools are searched by HAL_MemPool_Alloc() in their registration order. A pool
+  *         already registered is emptied.
+  * @param  pPool pointer to a HAL_MemPoolTypeDef structure, which must stay valid.
+  * @param  pBase Start address of the area, e.g. an array placed with __SRAM2_BUFFER.
+  * @param  Size Size of the area in bytes, the area must lie in a single memory.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_MemPool_Init(HAL_MemPoolTypeDef *pPool, void *pBase, uint32_t Size)
+{
+  const MEM_RegionTypeDef *pregion;
+  HAL_MemPoolTypeDef **ppnext;
+  uint32_t offset;
+  uint32_t primask;
+
+  if ((pPool == NULL) || (pBase == NULL) || (Size == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  pregion = MEM_FindRegion((uint32_t)pBase, &offset);
+  if ((pregion == NULL) || (Size > (pregion->Size - offset)))
+  {
+    return HAL_ERROR;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  pPool->Base    = (uint32_t)pBase;
+  pPool->Size    = Size;
+  pPool->Offset  = 0U;
+  pPool->Masters = pregion->Masters;
+
+  /* Append the pool to the list unless it is already registered */
+  ppnext = &pHalMemPoolList;
+  while ((*ppnext != NULL) && (*ppnext != pPool))
+  {
+    ppnext = &(*ppnext)->pNext;
+  }
+  if (*ppnext == NULL)
+  {
+    pPool->pNext = NULL;
+    *ppnext = pPool;
+  }
+
+  __set_PRIMASK(primask);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Free all the buffers allocated from a pool.
+  * @param  pPool pointer to a registered HAL_MemPoolTypeDef structure.
+  * @retval None
+  */
+void HAL_MemPool_Reset(HAL_MemPoolTypeDef *pPool)
+{
+  pPool->Offset = 0U;
+}
+
+/**
+  * @brief  Allocate a buffer reachable by bus masters.
+  * @param  Masters Bus masters accessing the buffer, a combination of @ref HAL_Memory_Master.
+  * @param  Size Size of the buffer in bytes.
+  * @param  Align Alignment of the buffer in bytes, a power of 2, e.g. 32 for the cache maintenance
+  *         or the GPDMA bursts.
+  * @retval Pointer to the buffer, NULL when no registered pool can provide it.
+  */
+void *HAL_MemPool_Alloc(uint32_t Masters, uint32_t Size, uint32_t Align)
+{
+  HAL_MemPoolTypeDef *ppool;
+  uint32_t address;
+  uint32_t primask;
+  void *pbuffer = NULL;
+
+  if ((Size == 0U) || (Align == 0U) || ((Align & (Align - 1U)) != 0U))
+  {
+    return NULL;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  ppool = pHalMemPoolList;
+  while ((ppool != NULL) && (pbuffer == NULL))
+  {
+    if ((Masters & ~ppool->Masters) == 0U)
+    {
+      address = (ppool->Base + ppool->Offset + Align - 1U) & ~(Align - 1U);
+      if (((address - ppool->Base) <= ppool->Size) && (Size <= (ppool->Size - (address - ppool->Base))))
+      {
+        ppool->Offset = (address - ppool->Base) + Size;
+        pbuffer = (void *)address;
+      }
+    }
+    ppool = ppool->pNext;
+  }
+
+  __set_PRIMASK(primask);
+
+  return pbuffer;
+}
+
+#if defined(USE_HAL_TRACE) && (USE_HAL_TRACE == 1U)
+/**
+  * @brief  Start recording the trace events in a ring buffer.
+  * @note   The DWT cycle counter is enabled. A NULL buffer stops the recording.
+  * @param  pBuffer Ring buffer of trace records.
+  * @param  Size Number of records of the buffer, must be a power of 2.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_Trace_Init(HAL_TraceRecordTypeDef *pBuffer, uint32_t Size)
+{
+  if ((pBuffer != NULL) && ((Size == 0U) || ((Size & (Size - 1U)) != 0U)))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Stop the recording while the ring is updated */
+  pHalTraceBuffer = NULL;
+  __DMB();
+
+  if (pBuffer != NULL)
+  {
+    HAL_CycleCounter_Enable();
+
+    uwHalTraceMask    = Size - 1U;
+    uwHalTraceWrIndex = 0U;
+    uwHalTraceRdIndex = 0U;
+    __DMB();
+    pHalTraceBuffer   = pBuffer;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Record a trace event in the ring buffer.
+  * @note   The record slot is reserved with an exclusive access, so that the function can be
+  *         interrupted and called again from a higher priority context.
+  * @note   This function is declared as __weak to be overwritten in case of other
+  *         implementations in user file.
+  * @param  Event Event identifier, ORed with HAL_TRACE_EXIT_FLAG on exit.
+  * @param  pHandle Handle of the driver, NULL when the function has no handle.
+  * @retval None
+  */
+__weak void HAL_Trace_Hook(uint32_t Event, const void *pHandle)
+{
+  HAL_TraceRecordTypeDef *pbuffer = pHalTraceBuffer;
+  HAL_TraceRecordTypeDef *precord;
+  uint32_t timestamp = DWT->CYCCNT;
+  uint32_t index;
+
+  if (pbuffer != NULL)
+  {
+    do
+    {
+      index = __LDREXW(&uwHalTraceWrIndex);
+    } while (__STREXW(index + 1U, &uwHalTraceWrIndex) != 0U);
+
+    precord = &pbuffer[index & uwHalTraceMask];
+    precord->Timestamp = timestamp;
+    precord->Event     = Event;
+    precord->pHandle   = pHandle;
+  }
+}
+
+/**
+  * @brief  Send the trace records not yet sent over an ITM stimulus port.
+  * @note   Each record is sent as three words: timestamp, event and handle. When the ring was
+  *         overwritten since the last call, the oldest records are lost and the sending starts
+  *         at the oldest record still in the ring.
+  * @note   A record written by an interrupt during the sending of its slot may be sent mixed.
+  * @param  Port ITM stimulus port, 0 to 31.
+  * @retval Number of records sent, 0 when the ITM or the port is not enabled.
+  */
+uint32_t HAL_Trace_FlushITM(uint32_t Port)
+{
+  const HAL_TraceRecordTypeDef *precord;
+  uint32_t wr_index;
+  uint32_t count = 0U;
+
+  if ((pHalTraceBuffer == NULL) || (Port > 31U) ||
+      ((ITM->TCR & ITM_TCR_ITMENA_Msk) == 0U) || ((ITM->TER & (1UL << Port)) == 0U))
+  {
+    return 0U;
+  }
+
+  wr_index = uwHalTraceWrIndex;
+
+  /* Records overwritten since the last flush */
+  if ((wr_index - uwHalTraceRdIndex) > (uwHalTraceMask + 1U))
+  {
+    uwHalTraceRdIndex = wr_index - (uwHalTraceMask + 1U);
+  }
+
+  while (uwHalTraceRdIndex != wr_index)
+  {
+    precord = &pHalTraceBuffer[uwHalTraceRdIndex & uwHalTraceMask];
+
+    while (ITM->PORT[Port].u32 == 0UL)
+    {
+    }
+    ITM->PORT[Port].u32 = precord->Timestamp;
+    while (ITM->PORT[Port].u32 == 0UL)
+    {
+    }
+    ITM->PORT[Port].u32 = precord->Event;
+    while (ITM->PORT[Port].u32 == 0UL)
+    {
+    }
+    ITM->PORT[Port].u32 = (uint32_t)precord->pHandle;
+
+    uwHalTraceRdIndex++;
+    count++;
+  }
+
+  return count;
+}
+#endif /* USE_HAL_TRACE */
+
 /**
   * @}
   */
@@ -1408,6 +2208,53 @@ HAL_StatusTypeDef HAL_SBS_GetConfigAttributes(uint32_t Item, uint32_t *pAttribut
   * @}
   */
 
+/**
+  * @}
+  */
+
+/** @defgroup HAL_Private_Functions HAL Private Functions
+  * @{
+  */
+
+/**
+  * @brief  Find the memory region of an address.
+  * @param  Address Address in the secure or non-secure alias.
+  * @param  pOffset Offset of the address in the region.
+  * @retval Region descriptor, NULL when the address is not mapped to a memory.
+  */
+static const MEM_RegionTypeDef *MEM_FindRegion(uint32_t Address, uint32_t *pOffset)
+{
+  const MEM_RegionTypeDef *pregion = NULL;
+  uint32_t address = Address;
+  uint32_t index = 0U;
+
+  /* Get the non-secure alias */
+  if (((address & 0xF0000000UL) == 0x30000000UL) || ((address & 0xF0000000UL) == 0x50000000UL))
+  {
+    address -= HAL_MEM_SECURE_OFFSET;
+  }
+  else if ((address & 0xFC000000UL) == 0x0C000000UL)
+  {
+    address -= HAL_MEM_FLASH_S_OFFSET;
+  }
+  else
+  {
+    /* Non-secure alias */
+  }
+
+  while ((pregion == NULL) && (index < (sizeof(aHalMemRegions) / sizeof(aHalMemRegions[0]))))
+  {
+    if ((address - aHalMemRegions[index].Base) < aHalMemRegions[index].Size)
+    {
+      pregion = &aHalMemRegions[index];
+      *pOffset = address - pregion->Base;
+    }
+    index++;
+  }
+
+  return pregion;
+}
+
 /**
   * @}
   */
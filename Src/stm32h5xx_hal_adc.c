@@ -172,6 +172,49 @@
           (+++) Stop conversion and disable the ADC peripheral
                 using function HAL_ADC_Stop_DMA()
 
+        (++) ADC conversion with transfer by DMA deinterleaved per channel:
+          (+++) Initialize a 2D addressing DMA channel with HAL_DMAEx_List_Init()
+                in DMA_LINKEDLIST_CIRCULAR mode and link it to the ADC handle
+          (+++) Activate the ADC peripheral and start conversions using
+                function HAL_ADCEx_RegularStartDeinterleave_DMA(), providing a
+                queue, 2 nodes and a buffer of one array of samples per rank
+          (+++) Process the first half of each channel array in
+                HAL_ADC_ConvHalfCpltCallback() and the second half in
+                HAL_ADC_ConvCpltCallback()
+          (+++) Stop conversion and disable the ADC peripheral
+                using function HAL_ADC_Stop_DMA()
+
+        (++) ADC low-power sampler, the CPU sleeping between blocks:
+          (+++) Configure a low-power timer generating the sampling rate on
+                its channel 1 (e.g. HAL_LPTIM_PWM_Start() on LPTIM1)
+          (+++) Initialize a DMA channel in DMA_LINKEDLIST_CIRCULAR mode and
+                link it to the ADC handle
+          (+++) Start the sampler using function
+                HAL_ADCEx_LowPowerSamplerStart_DMA(), providing the trigger,
+                a buffer of 2 blocks and optionally wake-up thresholds
+          (+++) Enter Sleep mode: the CPU is woken up by
+                HAL_ADC_ConvHalfCpltCallback() and HAL_ADC_ConvCpltCallback()
+                at each block and by HAL_ADC_LevelOutOfWindowCallback() when
+                a conversion is out of the thresholds window
+          (+++) A DAC output can be generated at the same rate with
+                HAL_DAC_Start_DMA() triggered by the same low-power timer
+          (+++) Stop the sampler using function
+                HAL_ADCEx_LowPowerSamplerStop_DMA()
+
+        (++) ADC threshold triggered capture, like an oscilloscope trigger:
+          (+++) Initialize a DMA channel in DMA_LINKEDLIST_CIRCULAR mode with
+                word data width and link it to the ADC handle
+          (+++) Start the capture using function
+                HAL_ADCEx_ThresholdCaptureStart_DMA(), providing the analog
+                watchdog, its thresholds, a ring buffer and a capture buffer
+          (+++) HAL_ADC_ConvCpltCallback() is called when the conversions
+                around the thresholds crossing are copied into the capture
+                buffer, no conversion being processed by the CPU otherwise
+          (+++) Arm the next capture using function
+                HAL_ADCEx_ThresholdCaptureRearm()
+          (+++) Stop the capture using function
+                HAL_ADCEx_ThresholdCaptureStop_DMA()
+
      [..]
 
     (@) Callback functions must be implemented in user program:
@@ -885,6 +928,14 @@ HAL_StatusTypeDef HAL_ADC_DeInit(ADC_HandleTypeDef *hadc)
   hadc->InjectionConfig.ContextQueue = 0;
   hadc->InjectionConfig.ChannelCount = 0;
 
+#if defined(ADC_MULTIMODE_SUPPORT)
+  /* Reset multimode streaming acquisition */
+  hadc->pMultiModeStream = NULL;
+#endif /* ADC_MULTIMODE_SUPPORT */
+
+  /* Reset threshold triggered capture */
+  hadc->pThresholdCapture = NULL;
+
   /* Set ADC state */
   hadc->State = HAL_ADC_STATE_RESET;
 
@@ -2352,6 +2403,8 @@ void HAL_ADC_IRQHandler(ADC_HandleTypeDef *hadc)
   uint32_t tmp_multimode_config = LL_ADC_GetMultimode(__LL_ADC_COMMON_INSTANCE(hadc->Instance));
 #endif /* ADC_MULTIMODE_SUPPORT */
 
+  HAL_TRACE_ENTER(HAL_TRACE_ID_ADC_IRQ, hadc);
+
   /* Check the parameters */
   assert_param(IS_ADC_ALL_INSTANCE(hadc->Instance));
   assert_param(IS_ADC_EOC_SELECTION(hadc->Init.EOCSelection));
@@ -2578,12 +2631,20 @@ void HAL_ADC_IRQHandler(ADC_HandleTypeDef *hadc)
     /* Set ADC state */
     SET_BIT(hadc->State, HAL_ADC_STATE_AWD1);
 
-    /* Level out of window 1 callback */
+    if ((hadc->pThresholdCapture != NULL) && (hadc->pThresholdCapture->WatchdogNumber == ADC_ANALOGWATCHDOG_1))
+    {
+      /* Threshold triggered capture event */
+      ADCEx_ThresholdCaptureTrigger(hadc);
+    }
+    else
+    {
+      /* Level out of window 1 callback */
 #if (USE_HAL_ADC_REGISTER_CALLBACKS == 1)
-    hadc->LevelOutOfWindowCallback(hadc);
+      hadc->LevelOutOfWindowCallback(hadc);
 #else
-    HAL_ADC_LevelOutOfWindowCallback(hadc);
+      HAL_ADC_LevelOutOfWindowCallback(hadc);
 #endif /* USE_HAL_ADC_REGISTER_CALLBACKS */
+    }
 
     /* Clear ADC analog watchdog flag */
     __HAL_ADC_CLEAR_FLAG(hadc, ADC_FLAG_AWD1);
@@ -2595,12 +2656,20 @@ void HAL_ADC_IRQHandler(ADC_HandleTypeDef *hadc)
     /* Set ADC state */
     SET_BIT(hadc->State, HAL_ADC_STATE_AWD2);
 
-    /* Level out of window 2 callback */
+    if ((hadc->pThresholdCapture != NULL) && (hadc->pThresholdCapture->WatchdogNumber == ADC_ANALOGWATCHDOG_2))
+    {
+      /* Threshold triggered capture event */
+      ADCEx_ThresholdCaptureTrigger(hadc);
+    }
+    else
+    {
+      /* Level out of window 2 callback */
 #if (USE_HAL_ADC_REGISTER_CALLBACKS == 1)
-    hadc->LevelOutOfWindow2Callback(hadc);
+      hadc->LevelOutOfWindow2Callback(hadc);
 #else
-    HAL_ADCEx_LevelOutOfWindow2Callback(hadc);
+      HAL_ADCEx_LevelOutOfWindow2Callback(hadc);
 #endif /* USE_HAL_ADC_REGISTER_CALLBACKS */
+    }
 
     /* Clear ADC analog watchdog flag */
     __HAL_ADC_CLEAR_FLAG(hadc, ADC_FLAG_AWD2);
@@ -2612,12 +2681,20 @@ void HAL_ADC_IRQHandler(ADC_HandleTypeDef *hadc)
     /* Set ADC state */
     SET_BIT(hadc->State, HAL_ADC_STATE_AWD3);
 
-    /* Level out of window 3 callback */
+    if ((hadc->pThresholdCapture != NULL) && (hadc->pThresholdCapture->WatchdogNumber == ADC_ANALOGWATCHDOG_3))
+    {
+      /* Threshold triggered capture event */
+      ADCEx_ThresholdCaptureTrigger(hadc);
+    }
+    else
+    {
+      /* Level out of window 3 callback */
 #if (USE_HAL_ADC_REGISTER_CALLBACKS == 1)
-    hadc->LevelOutOfWindow3Callback(hadc);
+      hadc->LevelOutOfWindow3Callback(hadc);
 #else
-    HAL_ADCEx_LevelOutOfWindow3Callback(hadc);
+      HAL_ADCEx_LevelOutOfWindow3Callback(hadc);
 #endif /* USE_HAL_ADC_REGISTER_CALLBACKS */
+    }
 
     /* Clear ADC analog watchdog flag */
     __HAL_ADC_CLEAR_FLAG(hadc, ADC_FLAG_AWD3);
@@ -2704,6 +2781,7 @@ void HAL_ADC_IRQHandler(ADC_HandleTypeDef *hadc)
 #endif /* USE_HAL_ADC_REGISTER_CALLBACKS */
   }
 
+  HAL_TRACE_EXIT(HAL_TRACE_ID_ADC_IRQ, hadc);
 }
 
 /**
@@ -73,6 +73,27 @@
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
+/** @defgroup ADCEx_Private_Functions ADC Extended Private Functions
+  * @{
+  */
+static void ADCEx_DMADeinterleaveCplt(DMA_HandleTypeDef *hdma);
+#if defined(ADC_MULTIMODE_SUPPORT)
+static HAL_StatusTypeDef ADCEx_MultiModeStartDMA(ADC_HandleTypeDef *hadc, uint32_t *pData, uint32_t Length,
+                                                 void (*pXferCpltCallback)(DMA_HandleTypeDef *hdma),
+                                                 void (*pXferHalfCpltCallback)(DMA_HandleTypeDef *hdma));
+static void ADCEx_MultiModeStreamBlock(ADC_HandleTypeDef *hadc, uint32_t Block);
+static void ADCEx_DMAStreamHalfCplt(DMA_HandleTypeDef *hdma);
+static void ADCEx_DMAStreamCplt(DMA_HandleTypeDef *hdma);
+#endif /* ADC_MULTIMODE_SUPPORT */
+static uint32_t ADCEx_ThresholdCaptureIT(const ADC_ThresholdCaptureTypeDef *pCapture);
+static void ADCEx_ThresholdCaptureArm(ADC_HandleTypeDef *hadc);
+static uint32_t ADCEx_ThresholdCaptureWriteIndex(const ADC_HandleTypeDef *hadc);
+static void ADCEx_ThresholdCaptureUpdate(ADC_HandleTypeDef *hadc);
+static void ADCEx_DMACaptureUpdate(DMA_HandleTypeDef *hdma);
+/**
+  * @}
+  */
+
 /* Exported functions --------------------------------------------------------*/
 
 /** @defgroup ADCEx_Exported_Functions ADC Extended Exported Functions
@@ -102,6 +123,14 @@
       (+) When multimode feature is available, start multimode and enable DMA transfer.
       (+) Stop multimode and disable ADC DMA transfer.
       (+) Get result of multimode conversion.
+      (+) Start and stop a multimode streaming acquisition unpacking ADC master and slave
+          results per block, with block timestamp and dropped blocks report.
+
+      (+) Start conversion of ADC group regular with DMA transfer deinterleaved per channel
+          into a structure of arrays buffer (2D addressing DMA channel).
+
+      (+) Start and stop a threshold triggered capture keeping only the conversions around
+          an analog watchdog event.
 
 @endverbatim
   * @{
@@ -856,173 +885,7 @@ HAL_StatusTypeDef HAL_ADCEx_InjectedStop_IT(ADC_HandleTypeDef *hadc)
   */
 HAL_StatusTypeDef HAL_ADCEx_MultiModeStart_DMA(ADC_HandleTypeDef *hadc, uint32_t *pData, uint32_t Length)
 {
-  HAL_StatusTypeDef tmp_hal_status;
-  ADC_HandleTypeDef tmp_hadc_slave;
-  ADC_Common_TypeDef *tmpADC_Common;
-  uint32_t length_bytes;
-  DMA_NodeConfTypeDef node_conf;
-
-  /* Check the parameters */
-  assert_param(IS_ADC_MULTIMODE_MASTER_INSTANCE(hadc->Instance));
-  assert_param(IS_FUNCTIONAL_STATE(hadc->Init.ContinuousConvMode));
-  assert_param(IS_ADC_EXTTRIG_EDGE(hadc->Init.ExternalTrigConvEdge));
-#if   defined(ADC3)
-#else
-  assert_param(IS_FUNCTIONAL_STATE(hadc->Init.DMAContinuousRequests));
-#endif /* ADC3 */
-
-  if (LL_ADC_REG_IsConversionOngoing(hadc->Instance) != 0UL)
-  {
-    return HAL_BUSY;
-  }
-  else
-  {
-    /* Process locked */
-    __HAL_LOCK(hadc);
-
-    /* Temporary handle minimum initialization */
-    __HAL_ADC_RESET_HANDLE_STATE(&tmp_hadc_slave);
-    ADC_CLEAR_ERRORCODE(&tmp_hadc_slave);
-
-    /* Set a temporary handle of the ADC slave associated to the ADC master   */
-    ADC_MULTI_SLAVE(hadc, &tmp_hadc_slave);
-
-    if (tmp_hadc_slave.Instance == NULL)
-    {
-      /* Set ADC state */
-      SET_BIT(hadc->State, HAL_ADC_STATE_ERROR_CONFIG);
-
-      /* Process unlocked */
-      __HAL_UNLOCK(hadc);
-
-      return HAL_ERROR;
-    }
-
-    /* Enable the ADC peripherals: master and slave (in case if not already   */
-    /* enabled previously)                                                    */
-    tmp_hal_status = ADC_Enable(hadc);
-    if (tmp_hal_status == HAL_OK)
-    {
-      tmp_hal_status = ADC_Enable(&tmp_hadc_slave);
-    }
-
-    /* Start multimode conversion of ADCs pair */
-    if (tmp_hal_status == HAL_OK)
-    {
-      /* Set ADC state */
-      ADC_STATE_CLR_SET(hadc->State,
-                        (HAL_ADC_STATE_READY | HAL_ADC_STATE_REG_EOC | HAL_ADC_STATE_REG_OVR | HAL_ADC_STATE_REG_EOSMP),
-                        HAL_ADC_STATE_REG_BUSY);
-
-      /* Set ADC error code to none */
-      ADC_CLEAR_ERRORCODE(hadc);
-
-      /* Set the DMA transfer complete callback */
-      hadc->DMA_Handle->XferCpltCallback = ADC_DMAConvCplt;
-
-      /* Set the DMA half transfer complete callback */
-      hadc->DMA_Handle->XferHalfCpltCallback = ADC_DMAHalfConvCplt;
-
-      /* Set the DMA error callback */
-      hadc->DMA_Handle->XferErrorCallback = ADC_DMAError ;
-
-      /* Pointer to the common control register  */
-      tmpADC_Common = __LL_ADC_COMMON_INSTANCE(hadc->Instance);
-
-      /* Manage ADC and DMA start: ADC overrun interruption, DMA start, ADC     */
-      /* start (in case of SW start):                                           */
-
-      /* Clear regular group conversion flag and overrun flag */
-      /* (To ensure of no unknown state from potential previous ADC operations) */
-      __HAL_ADC_CLEAR_FLAG(hadc, (ADC_FLAG_EOC | ADC_FLAG_EOS | ADC_FLAG_OVR));
-
-      /* Process unlocked */
-      /* Unlock before starting ADC conversions: in case of potential         */
-      /* interruption, to let the process to ADC IRQ Handler.                 */
-      __HAL_UNLOCK(hadc);
-
-      /* Enable ADC overrun interrupt */
-      __HAL_ADC_ENABLE_IT(hadc, ADC_IT_OVR);
-
-      /* Check linkedlist mode */
-      if ((hadc->DMA_Handle->Mode & DMA_LINKEDLIST) == DMA_LINKEDLIST)
-      {
-        if ((hadc->DMA_Handle->LinkedListQueue != NULL) && (hadc->DMA_Handle->LinkedListQueue->Head != NULL))
-        {
-          /* Length should be converted to number of bytes */
-          if (HAL_DMAEx_List_GetNodeConfig(&node_conf, hadc->DMA_Handle->LinkedListQueue->Head) != HAL_OK)
-          {
-            return HAL_ERROR;
-          }
-
-          /* Length should be converted to number of bytes */
-          if (node_conf.Init.SrcDataWidth == DMA_SRC_DATAWIDTH_WORD)
-          {
-            /* Word -> Bytes */
-            length_bytes = Length * 4U;
-          }
-          else if (node_conf.Init.SrcDataWidth == DMA_SRC_DATAWIDTH_HALFWORD)
-          {
-            /* Halfword -> Bytes */
-            length_bytes = Length * 2U;
-          }
-          else /* Bytes */
-          {
-            /* Same size already expressed in Bytes */
-            length_bytes = Length;
-          }
-
-          hadc->DMA_Handle->LinkedListQueue->Head->LinkRegisters[NODE_CBR1_DEFAULT_OFFSET] = (uint32_t)length_bytes;
-          hadc->DMA_Handle->LinkedListQueue->Head->LinkRegisters[NODE_CSAR_DEFAULT_OFFSET] =                  \
-              (uint32_t)&tmpADC_Common->CDR;
-          hadc->DMA_Handle->LinkedListQueue->Head->LinkRegisters[NODE_CDAR_DEFAULT_OFFSET] = (uint32_t)pData;
-          tmp_hal_status = HAL_DMAEx_List_Start_IT(hadc->DMA_Handle);
-        }
-        else
-        {
-          return HAL_ERROR;
-        }
-      }
-      else
-      {
-        /* Length should be converted to number of bytes */
-        if (hadc->DMA_Handle->Init.SrcDataWidth == DMA_SRC_DATAWIDTH_WORD)
-        {
-          /* Word -> Bytes */
-          length_bytes = Length * 4U;
-        }
-        else if (hadc->DMA_Handle->Init.SrcDataWidth == DMA_SRC_DATAWIDTH_HALFWORD)
-        {
-          /* Halfword -> Bytes */
-          length_bytes = Length * 2U;
-        }
-        else /* Bytes */
-        {
-          /* Same size already expressed in Bytes */
-          length_bytes = Length;
-        }
-
-        /* Start the DMA channel */
-        tmp_hal_status = HAL_DMA_Start_IT(hadc->DMA_Handle, (uint32_t)&tmpADC_Common->CDR, (uint32_t)pData,        \
-                                          length_bytes);
-      }
-
-      /* Enable conversion of regular group.                                    */
-      /* If software start has been selected, conversion starts immediately.    */
-      /* If external trigger has been selected, conversion will start at next   */
-      /* trigger event.                                                         */
-      /* Start ADC group regular conversion */
-      LL_ADC_REG_StartConversion(hadc->Instance);
-    }
-    else
-    {
-      /* Process unlocked */
-      __HAL_UNLOCK(hadc);
-    }
-
-    /* Return function status */
-    return tmp_hal_status;
-  }
+  return ADCEx_MultiModeStartDMA(hadc, pData, Length, ADC_DMAConvCplt, ADC_DMAHalfConvCplt);
 }
 
 /**
@@ -1178,993 +1041,1059 @@ uint32_t HAL_ADCEx_MultiModeGetValue(const ADC_HandleTypeDef *hadc)
   /* Return the multi mode conversion value */
   return tmpADC_Common->CDR;
 }
-#endif /* ADC_MULTIMODE_SUPPORT */
 
 /**
-  * @brief  Get ADC injected group conversion result.
-  * @note   Reading register JDRx automatically clears ADC flag JEOC
-  *         (ADC group injected end of unitary conversion).
-  * @note   This function does not clear ADC flag JEOS
-  *         (ADC group injected end of sequence conversion)
-  *         Occurrence of flag JEOS rising:
-  *          - If sequencer is composed of 1 rank, flag JEOS is equivalent
-  *            to flag JEOC.
-  *          - If sequencer is composed of several ranks, during the scan
-  *            sequence flag JEOC only is raised, at the end of the scan sequence
-  *            both flags JEOC and EOS are raised.
-  *         Flag JEOS must not be cleared by this function because
-  *         it would not be compliant with low power features
-  *         (feature low power auto-wait, not available on all STM32 series).
-  *         To clear this flag, either use function:
-  *         in programming model IT: @ref HAL_ADC_IRQHandler(), in programming
-  *         model polling: @ref HAL_ADCEx_InjectedPollForConversion()
-  *         or @ref __HAL_ADC_CLEAR_FLAG(&hadc, ADC_FLAG_JEOS).
-  * @param hadc ADC handle
-  * @param InjectedRank the converted ADC injected rank.
-  *          This parameter can be one of the following values:
-  *            @arg @ref ADC_INJECTED_RANK_1 ADC group injected rank 1
-  *            @arg @ref ADC_INJECTED_RANK_2 ADC group injected rank 2
-  *            @arg @ref ADC_INJECTED_RANK_3 ADC group injected rank 3
-  *            @arg @ref ADC_INJECTED_RANK_4 ADC group injected rank 4
-  * @retval ADC group injected conversion data
+  * @brief  Enable ADC master and slave and start a dual mode streaming acquisition: the packed ADC common data words
+  *         transferred by DMA are unpacked block per block into one buffer per ADC, each block being timestamped.
+  * @note   Multimode must have been previously configured using HAL_ADCEx_MultiModeConfigChannel() with
+  *         DMAAccessMode set to ADC_DMAACCESSMODE_12_10_BITS: each data word holds the ADC master result in its
+  *         lower halfword and the ADC slave result in its upper halfword.
+  * @note   The DMA channel of the ADC master handle must be initialized in DMA_LINKEDLIST_CIRCULAR mode with word
+  *         data width, its queue holding a single node with half transfer event enabled.
+  * @note   At each half of the raw buffer, the block is unpacked in interrupt context, the timestamp counter is
+  *         latched and HAL_ADC_ConvCpltCallback() is called. The block must be released with
+  *         HAL_ADCEx_MultiModeStreamRelease() before the next one: a block completing while the previous one is
+  *         still pending, or overwritten by the DMA while being unpacked, is dropped and counted in DroppedBlocks.
+  *         BlockIndex increments for every block, dropped ones included, so that the sample index of a block is
+  *         BlockIndex * BlockSize whatever the interrupt latency.
+  * @param hadc ADC handle of ADC master (handle of ADC slave must not be used)
+  * @param pStream Pointer to the stream structure, it must stay allocated until the stream is stopped
+  * @retval HAL status
   */
-uint32_t HAL_ADCEx_InjectedGetValue(const ADC_HandleTypeDef *hadc, uint32_t InjectedRank)
+HAL_StatusTypeDef HAL_ADCEx_MultiModeStreamStart_DMA(ADC_HandleTypeDef *hadc, ADC_MultiModeStreamTypeDef *pStream)
 {
-  uint32_t tmp_jdr;
+  HAL_StatusTypeDef tmp_hal_status;
 
   /* Check the parameters */
-  assert_param(IS_ADC_ALL_INSTANCE(hadc->Instance));
-  assert_param(IS_ADC_INJECTED_RANK(InjectedRank));
+  assert_param(IS_ADC_MULTIMODE_MASTER_INSTANCE(hadc->Instance));
 
-  /* Get ADC converted value */
-  switch (InjectedRank)
+  if ((pStream == NULL) || (pStream->pRawBuffer == NULL) || (pStream->pMasterData == NULL)
+      || (pStream->pSlaveData == NULL) || (pStream->BlockSize == 0UL))
   {
-    case ADC_INJECTED_RANK_4:
-      tmp_jdr = hadc->Instance->JDR4;
-      break;
-    case ADC_INJECTED_RANK_3:
-      tmp_jdr = hadc->Instance->JDR3;
-      break;
-    case ADC_INJECTED_RANK_2:
-      tmp_jdr = hadc->Instance->JDR2;
-      break;
-    case ADC_INJECTED_RANK_1:
-    default:
-      tmp_jdr = hadc->Instance->JDR1;
-      break;
+    return HAL_ERROR;
   }
 
-  /* Return ADC converted value */
-  return tmp_jdr;
+  /* Check the packed data format and the DMA circular linked-list mode */
+  if ((READ_BIT(__LL_ADC_COMMON_INSTANCE(hadc->Instance)->CCR, ADC_CCR_MDMA) != ADC_DMAACCESSMODE_12_10_BITS)
+      || (hadc->DMA_Handle == NULL) || (hadc->DMA_Handle->Mode != DMA_LINKEDLIST_CIRCULAR))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Reset the stream status */
+  pStream->Timestamp     = 0UL;
+  pStream->BlockIndex    = 0UL;
+  pStream->DroppedBlocks = 0UL;
+  pStream->BlockPending  = 0UL;
+
+  hadc->pMultiModeStream = pStream;
+
+  /* Start the dual conversions on the 2 blocks raw buffer */
+  tmp_hal_status = ADCEx_MultiModeStartDMA(hadc, pStream->pRawBuffer, 2UL * pStream->BlockSize,
+                                           ADCEx_DMAStreamCplt, ADCEx_DMAStreamHalfCplt);
+
+  if (tmp_hal_status != HAL_OK)
+  {
+    hadc->pMultiModeStream = NULL;
+  }
+
+  return tmp_hal_status;
 }
 
 /**
-  * @brief  Injected conversion complete callback in non-blocking mode.
-  * @param hadc ADC handle
-  * @retval None
+  * @brief  Stop a dual mode streaming acquisition started with HAL_ADCEx_MultiModeStreamStart_DMA().
+  * @note   The stream status (BlockIndex, DroppedBlocks) is kept for reading after stop.
+  * @param hadc ADC handle of ADC master (handle of ADC slave must not be used)
+  * @retval HAL status
   */
-__weak void HAL_ADCEx_InjectedConvCpltCallback(ADC_HandleTypeDef *hadc)
+HAL_StatusTypeDef HAL_ADCEx_MultiModeStreamStop_DMA(ADC_HandleTypeDef *hadc)
 {
-  /* Prevent unused argument(s) compilation warning */
-  UNUSED(hadc);
+  HAL_StatusTypeDef tmp_hal_status;
 
-  /* NOTE : This function should not be modified. When the callback is needed,
-            function HAL_ADCEx_InjectedConvCpltCallback must be implemented in the user file.
-  */
-}
+  tmp_hal_status = HAL_ADCEx_MultiModeStop_DMA(hadc);
 
-/**
-  * @brief  Injected context queue overflow callback.
-  * @note   This callback is called if injected context queue is enabled
-            (parameter "QueueInjectedContext" in injected channel configuration)
-            and if a new injected context is set when queue is full (maximum 2
-            contexts).
-  * @param hadc ADC handle
-  * @retval None
-  */
-__weak void HAL_ADCEx_InjectedQueueOverflowCallback(ADC_HandleTypeDef *hadc)
-{
-  /* Prevent unused argument(s) compilation warning */
-  UNUSED(hadc);
+  if (tmp_hal_status == HAL_OK)
+  {
+    hadc->pMultiModeStream = NULL;
+  }
 
-  /* NOTE : This function should not be modified. When the callback is needed,
-            function HAL_ADCEx_InjectedQueueOverflowCallback must be implemented in the user file.
-  */
+  return tmp_hal_status;
 }
 
 /**
-  * @brief  Analog watchdog 2 callback in non-blocking mode.
-  * @param hadc ADC handle
-  * @retval None
+  * @brief  Release the last unpacked block of a dual mode streaming acquisition.
+  * @note   The master and slave buffers can be overwritten by the next block after this call.
+  * @param hadc ADC handle of ADC master (handle of ADC slave must not be used)
+  * @retval HAL status
   */
-__weak void HAL_ADCEx_LevelOutOfWindow2Callback(ADC_HandleTypeDef *hadc)
+HAL_StatusTypeDef HAL_ADCEx_MultiModeStreamRelease(ADC_HandleTypeDef *hadc)
 {
-  /* Prevent unused argument(s) compilation warning */
-  UNUSED(hadc);
+  if (hadc->pMultiModeStream == NULL)
+  {
+    return HAL_ERROR;
+  }
 
-  /* NOTE : This function should not be modified. When the callback is needed,
-            function HAL_ADCEx_LevelOutOfWindow2Callback must be implemented in the user file.
-  */
+  hadc->pMultiModeStream->BlockPending = 0UL;
+
+  return HAL_OK;
 }
+#endif /* ADC_MULTIMODE_SUPPORT */
 
 /**
-  * @brief  Analog watchdog 3 callback in non-blocking mode.
+  * @brief  Enable ADC, start conversion of regular group and transfer the results through DMA, deinterleaved
+  *         per sequencer rank into a structure of arrays buffer.
+  * @note   The DMA channel of the ADC handle must be a 2D addressing channel, initialized with
+  *         HAL_DMAEx_List_Init() in DMA_LINKEDLIST_CIRCULAR mode. Its linked-list queue is built by this function
+  *         from the user queue and nodes, and linked to the DMA channel.
+  * @note   ADC must be configured with DMA continuous requests (DMAContinuousRequests = ENABLE) and with data
+  *         fitting in 16 bits.
+  * @note   Each half buffer is transferred by a repeated block node: one block per sequence scan, the destination
+  *         address being offset by SamplesPerChannel halfwords after each rank, then moved back to the next sample
+  *         of the first channel after each scan.
+  *         HAL_ADC_ConvHalfCpltCallback() is called when the first half of every channel buffer is filled and
+  *         HAL_ADC_ConvCpltCallback() when the second half is filled.
+  * @note   Interruptions enabled in this function:
+  *         overrun, DMA transfer complete.
+  * @note   Use HAL_ADC_Stop_DMA() to stop the stream.
   * @param hadc ADC handle
-  * @retval None
+  * @param pConfig Pointer to the deinterleaved DMA stream configuration
+  * @retval HAL status
   */
-__weak void HAL_ADCEx_LevelOutOfWindow3Callback(ADC_HandleTypeDef *hadc)
+HAL_StatusTypeDef HAL_ADCEx_RegularStartDeinterleave_DMA(ADC_HandleTypeDef *hadc,
+                                                         const ADC_DeinterleaveConfTypeDef *pConfig)
 {
-  /* Prevent unused argument(s) compilation warning */
-  UNUSED(hadc);
+  HAL_StatusTypeDef tmp_hal_status;
+#if defined(ADC_MULTIMODE_SUPPORT)
+  uint32_t tmp_multimode_config = LL_ADC_GetMultimode(__LL_ADC_COMMON_INSTANCE(hadc->Instance));
+#endif /* ADC_MULTIMODE_SUPPORT */
+  DMA_HandleTypeDef *hdma = hadc->DMA_Handle;
+  DMA_NodeConfTypeDef node_conf;
+  uint32_t nb_ranks;
+  uint32_t channel_stride;
 
-  /* NOTE : This function should not be modified. When the callback is needed,
-            function HAL_ADCEx_LevelOutOfWindow3Callback must be implemented in the user file.
-  */
-}
+  /* Check the parameters */
+  assert_param(IS_ADC_ALL_INSTANCE(hadc->Instance));
 
+  if ((pConfig == NULL) || (pConfig->pQueue == NULL) || (pConfig->pNodes == NULL) || (pConfig->pData == NULL))
+  {
+    return HAL_ERROR;
+  }
 
-/**
-  * @brief  End Of Sampling callback in non-blocking mode.
-  * @param hadc ADC handle
-  * @retval None
-  */
-__weak void HAL_ADCEx_EndOfSamplingCallback(ADC_HandleTypeDef *hadc)
-{
-  /* Prevent unused argument(s) compilation warning */
-  UNUSED(hadc);
+  /* Number of ranks of the regular sequencer */
+  nb_ranks = (READ_BIT(hadc->Instance->SQR1, ADC_SQR1_L) >> ADC_SQR1_L_Pos) + 1UL;
+  channel_stride = pConfig->SamplesPerChannel * 2UL;
+
+  /* Check the stream geometry against the 2D addressing limits:              */
+  /* - 2 repeated blocks nodes of SamplesPerChannel / 2 blocks               */
+  /* - intra-block destination offset of one channel buffer                  */
+  /* - end of block destination offset back to the first channel buffer      */
+  if ((pConfig->SamplesPerChannel < 2UL) || (pConfig->SamplesPerChannel > 4096UL)
+      || ((pConfig->SamplesPerChannel & 0x1UL) != 0UL)
+      || (((nb_ranks - 1UL) * channel_stride) > 65535UL))
+  {
+    return HAL_ERROR;
+  }
 
-  /* NOTE : This function should not be modified. When the callback is needed,
-            function HAL_ADCEx_EndOfSamplingCallback must be implemented in the user file.
-  */
-}
+  /* Check the DMA channel: 2D addressing and circular linked-list mode */
+  if ((hdma == NULL) || (IS_DMA_2D_ADDRESSING_INSTANCE(hdma->Instance) == 0U)
+      || (hdma->Mode != DMA_LINKEDLIST_CIRCULAR))
+  {
+    return HAL_ERROR;
+  }
 
-/**
-  * @brief  Stop ADC conversion of regular group (and injected channels in
-  *         case of auto_injection mode), disable ADC peripheral if no
-  *         conversion is on going on injected group.
-  * @param hadc ADC handle
-  * @retval HAL status.
-  */
-HAL_StatusTypeDef HAL_ADCEx_RegularStop(ADC_HandleTypeDef *hadc)
-{
-  HAL_StatusTypeDef tmp_hal_status;
+  /* Check ADC DMA continuous requests */
+  if (READ_BIT(hadc->Instance->CFGR, ADC_CFGR_DMACFG) == 0UL)
+  {
+    return HAL_ERROR;
+  }
 
-  /* Check the parameters */
-  assert_param(IS_ADC_ALL_INSTANCE(hadc->Instance));
+  /* Perform ADC enable and conversion start if no conversion is on going */
+  if (LL_ADC_REG_IsConversionOngoing(hadc->Instance) != 0UL)
+  {
+    return HAL_BUSY;
+  }
 
   /* Process locked */
   __HAL_LOCK(hadc);
 
-  /* 1. Stop potential regular conversion on going */
-  tmp_hal_status = ADC_ConversionStop(hadc, ADC_REGULAR_GROUP);
+#if defined(ADC_MULTIMODE_SUPPORT)
+  /* Ensure that multimode regular conversions are not enabled. */
+  if ((tmp_multimode_config != LL_ADC_MULTI_INDEPENDENT)
+      && (tmp_multimode_config != LL_ADC_MULTI_DUAL_INJ_SIMULT)
+      && (tmp_multimode_config != LL_ADC_MULTI_DUAL_INJ_ALTERN)
+     )
+  {
+    /* Process unlocked */
+    __HAL_UNLOCK(hadc);
+
+    return HAL_ERROR;
+  }
+#endif /* ADC_MULTIMODE_SUPPORT */
+
+  /* Prepare the repeated block node of the first half buffer */
+  node_conf.NodeType                            = DMA_GPDMA_2D_NODE;
+  node_conf.Init.Request                        = pConfig->Request;
+  node_conf.Init.BlkHWRequest                   = DMA_BREQ_SINGLE_BURST;
+  node_conf.Init.Direction                      = DMA_PERIPH_TO_MEMORY;
+  node_conf.Init.SrcInc                         = DMA_SINC_FIXED;
+  node_conf.Init.DestInc                        = DMA_DINC_INCREMENTED;
+  node_conf.Init.SrcDataWidth                   = DMA_SRC_DATAWIDTH_HALFWORD;
+  node_conf.Init.DestDataWidth                  = DMA_DEST_DATAWIDTH_HALFWORD;
+  node_conf.Init.Priority                       = hdma->InitLinkedList.Priority;
+  node_conf.Init.SrcBurstLength                 = 1U;
+  node_conf.Init.DestBurstLength                = 1U;
+  node_conf.Init.TransferAllocatedPort          = DMA_SRC_ALLOCATED_PORT0 | DMA_DEST_ALLOCATED_PORT0;
+  node_conf.Init.TransferEventMode              = DMA_TCEM_EACH_LL_ITEM_TRANSFER;
+  node_conf.Init.Mode                           = DMA_NORMAL;
+  node_conf.DataHandlingConfig.DataExchange     = DMA_EXCHANGE_NONE;
+  node_conf.DataHandlingConfig.DataAlignment    = DMA_DATA_RIGHTALIGN_ZEROPADDED;
+  node_conf.TriggerConfig.TriggerPolarity       = DMA_TRIG_POLARITY_MASKED;
+  node_conf.TriggerConfig.TriggerMode           = 0U;
+  node_conf.TriggerConfig.TriggerSelection      = 0U;
+  node_conf.RepeatBlockConfig.RepeatCount       = pConfig->SamplesPerChannel / 2UL;
+  node_conf.RepeatBlockConfig.SrcAddrOffset     = 0;
+  node_conf.RepeatBlockConfig.DestAddrOffset    = (int32_t)channel_stride - 2;
+  node_conf.RepeatBlockConfig.BlkSrcAddrOffset  = 0;
+  node_conf.RepeatBlockConfig.BlkDestAddrOffset = -(int32_t)((nb_ranks - 1UL) * channel_stride);
+  node_conf.SrcAddress                          = (uint32_t)&hadc->Instance->DR;
+  node_conf.DstAddress                          = (uint32_t)pConfig->pData;
+  node_conf.DataSize                            = nb_ranks * 2UL;
+#if defined (__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U)
+  node_conf.SrcSecure                           = DMA_CHANNEL_SRC_SEC;
+  node_conf.DestSecure                          = DMA_CHANNEL_DEST_SEC;
+#endif /* (__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U) */
+
+  /* Build the circular stream queue: one node per half buffer */
+  tmp_hal_status = HAL_DMAEx_List_ResetQ(pConfig->pQueue);
 
-  /* Disable ADC peripheral if regular conversions are effectively stopped
-     and if no injected conversions are on-going */
   if (tmp_hal_status == HAL_OK)
   {
-    /* Clear HAL_ADC_STATE_REG_BUSY bit */
-    CLEAR_BIT(hadc->State, HAL_ADC_STATE_REG_BUSY);
+    tmp_hal_status = HAL_DMAEx_List_BuildNode(&node_conf, &pConfig->pNodes[0U]);
+  }
+  if (tmp_hal_status == HAL_OK)
+  {
+    tmp_hal_status = HAL_DMAEx_List_InsertNode_Tail(pConfig->pQueue, &pConfig->pNodes[0U]);
+  }
+  if (tmp_hal_status == HAL_OK)
+  {
+    /* Second half buffer starts at the middle of the first channel buffer */
+    node_conf.DstAddress = (uint32_t)&pConfig->pData[pConfig->SamplesPerChannel / 2UL];
+    tmp_hal_status = HAL_DMAEx_List_BuildNode(&node_conf, &pConfig->pNodes[1U]);
+  }
+  if (tmp_hal_status == HAL_OK)
+  {
+    tmp_hal_status = HAL_DMAEx_List_InsertNode_Tail(pConfig->pQueue, &pConfig->pNodes[1U]);
+  }
+  if (tmp_hal_status == HAL_OK)
+  {
+    tmp_hal_status = HAL_DMAEx_List_SetCircularMode(pConfig->pQueue);
+  }
+  if (tmp_hal_status == HAL_OK)
+  {
+    tmp_hal_status = HAL_DMAEx_List_LinkQ(hdma, pConfig->pQueue);
+  }
 
-    if (LL_ADC_INJ_IsConversionOngoing(hadc->Instance) == 0UL)
+  /* Enable the ADC peripheral */
+  if (tmp_hal_status == HAL_OK)
+  {
+    tmp_hal_status = ADC_Enable(hadc);
+  }
+
+  /* Start conversion if ADC is effectively enabled */
+  if (tmp_hal_status == HAL_OK)
+  {
+    /* Set ADC state                                                        */
+    /* - Clear state bitfield related to regular group conversion results   */
+    /* - Set state bitfield related to regular operation                    */
+    ADC_STATE_CLR_SET(hadc->State,
+                      HAL_ADC_STATE_READY | HAL_ADC_STATE_REG_EOC | HAL_ADC_STATE_REG_OVR | HAL_ADC_STATE_REG_EOSMP,
+                      HAL_ADC_STATE_REG_BUSY);
+
+#if defined(ADC_MULTIMODE_SUPPORT)
+    /* Reset HAL_ADC_STATE_MULTIMODE_SLAVE bit
+      - if ADC instance is master or if multimode feature is not available
+      - if multimode setting is disabled (ADC instance slave in independent mode) */
+    if ((__LL_ADC_MULTI_INSTANCE_MASTER(hadc->Instance) == hadc->Instance)
+        || (tmp_multimode_config == LL_ADC_MULTI_INDEPENDENT)
+       )
     {
-      /* 2. Disable the ADC peripheral */
-      tmp_hal_status = ADC_Disable(hadc);
+      CLEAR_BIT(hadc->State, HAL_ADC_STATE_MULTIMODE_SLAVE);
+    }
+#endif /* ADC_MULTIMODE_SUPPORT */
 
-      /* Check if ADC is effectively disabled */
-      if (tmp_hal_status == HAL_OK)
-      {
-        /* Set ADC state */
-        ADC_STATE_CLR_SET(hadc->State,
-                          HAL_ADC_STATE_INJ_BUSY,
-                          HAL_ADC_STATE_READY);
-      }
+    /* Check if a conversion is on going on ADC group injected */
+    if ((hadc->State & HAL_ADC_STATE_INJ_BUSY) != 0UL)
+    {
+      /* Reset ADC error code fields related to regular conversions only */
+      CLEAR_BIT(hadc->ErrorCode, (HAL_ADC_ERROR_OVR | HAL_ADC_ERROR_DMA));
     }
-    /* Conversion on injected group is stopped, but ADC not disabled since    */
-    /* conversion on regular group is still running.                          */
     else
     {
-      SET_BIT(hadc->State, HAL_ADC_STATE_INJ_BUSY);
+      /* Reset all ADC error code fields */
+      ADC_CLEAR_ERRORCODE(hadc);
     }
-  }
 
-  /* Process unlocked */
-  __HAL_UNLOCK(hadc);
+    /* First completed node is the first half buffer */
+    hadc->DeinterleaveBlock = 0UL;
+
+    /* Set the DMA transfer complete callback: each node completion is a half */
+    /* buffer, the half transfer event of the nodes is not used               */
+    hdma->XferCpltCallback = ADCEx_DMADeinterleaveCplt;
+    hdma->XferHalfCpltCallback = NULL;
+
+    /* Set the DMA error callback */
+    hdma->XferErrorCallback = ADC_DMAError;
+
+    /* Clear regular group conversion flag and overrun flag               */
+    /* (To ensure of no unknown state from potential previous ADC         */
+    /* operations)                                                        */
+    __HAL_ADC_CLEAR_FLAG(hadc, (ADC_FLAG_EOC | ADC_FLAG_EOS | ADC_FLAG_OVR));
+
+    /* Process unlocked */
+    /* Unlock before starting ADC conversions: in case of potential         */
+    /* interruption, to let the process to ADC IRQ Handler.                 */
+    __HAL_UNLOCK(hadc);
+
+    /* With DMA, overrun event is always considered as an error even if
+       hadc->Init.Overrun is set to ADC_OVR_DATA_OVERWRITTEN. Therefore,
+       ADC_IT_OVR is enabled. */
+    __HAL_ADC_ENABLE_IT(hadc, ADC_IT_OVR);
+
+    /* Enable ADC DMA mode */
+    SET_BIT(hadc->Instance->CFGR, ADC_CFGR_DMAEN);
+
+    /* Start the DMA channel */
+    tmp_hal_status = HAL_DMAEx_List_Start_IT(hdma);
+
+    /* Enable conversion of regular group.                                  */
+    /* If software start has been selected, conversion starts immediately.  */
+    /* If external trigger has been selected, conversion will start at next */
+    /* trigger event.                                                       */
+    if (tmp_hal_status == HAL_OK)
+    {
+      LL_ADC_REG_StartConversion(hadc->Instance);
+    }
+  }
+  else
+  {
+    /* Process unlocked */
+    __HAL_UNLOCK(hadc);
+  }
 
   /* Return function status */
   return tmp_hal_status;
 }
 
-
 /**
-  * @brief  Stop ADC conversion of ADC groups regular and injected,
-  *         disable interrution of end-of-conversion,
-  *         disable ADC peripheral if no conversion is on going
-  *         on injected group.
+  * @brief  Enable ADC and start the conversions of regular group on an external trigger, transferred through DMA
+  *         in blocks, so that the CPU sleeps between blocks.
+  * @note   The DMA channel of the ADC handle must be initialized in DMA_LINKEDLIST_CIRCULAR mode.
+  * @note   This function configures the regular group trigger (rising edge, no continuous mode), the DMA
+  *         continuous requests and, if WakeUpWindow is enabled, the analog watchdog 1 on all the regular channels.
+  *         HAL_ADC_ConvHalfCpltCallback() is called when the first block is filled,
+  *         HAL_ADC_ConvCpltCallback() when the second block is filled and
+  *         HAL_ADC_LevelOutOfWindowCallback() on a conversion out of the thresholds window.
+  * @note   Interruptions enabled in this function:
+  *         overrun, DMA half transfer and transfer complete, analog watchdog 1 (if WakeUpWindow is enabled).
+  * @note   The ADC and DMA run in Sleep mode, not in Stop mode: enter Sleep mode with HAL_PWR_EnterSLEEPMode(),
+  *         the ADC and GPDMA clocks being enabled in Sleep mode at RCC level.
   * @param hadc ADC handle
-  * @retval HAL status.
+  * @param pConfig Pointer to the low-power sampler configuration
+  * @retval HAL status
   */
-HAL_StatusTypeDef HAL_ADCEx_RegularStop_IT(ADC_HandleTypeDef *hadc)
+HAL_StatusTypeDef HAL_ADCEx_LowPowerSamplerStart_DMA(ADC_HandleTypeDef *hadc,
+                                                     const ADC_LowPowerSamplerConfTypeDef *pConfig)
 {
+  ADC_AnalogWDGConfTypeDef awd_config = {0};
   HAL_StatusTypeDef tmp_hal_status;
 
   /* Check the parameters */
   assert_param(IS_ADC_ALL_INSTANCE(hadc->Instance));
 
-  /* Process locked */
-  __HAL_LOCK(hadc);
+  if ((pConfig == NULL) || (pConfig->pData == NULL) || (pConfig->BlockSize == 0UL)
+      || (pConfig->Trigger == ADC_SOFTWARE_START))
+  {
+    return HAL_ERROR;
+  }
 
-  /* 1. Stop potential regular conversion on going */
-  tmp_hal_status = ADC_ConversionStop(hadc, ADC_REGULAR_GROUP);
+  assert_param(IS_ADC_EXTTRIG(pConfig->Trigger));
+  assert_param(IS_FUNCTIONAL_STATE(pConfig->WakeUpWindow));
 
-  /* Disable ADC peripheral if conversions are effectively stopped
-    and if no injected conversion is on-going */
-  if (tmp_hal_status == HAL_OK)
+  /* Check the DMA channel: the two blocks are filled continuously */
+  if ((hadc->DMA_Handle == NULL) || (hadc->DMA_Handle->Mode != DMA_LINKEDLIST_CIRCULAR))
   {
-    /* Clear HAL_ADC_STATE_REG_BUSY bit */
-    CLEAR_BIT(hadc->State, HAL_ADC_STATE_REG_BUSY);
+    return HAL_ERROR;
+  }
 
-    /* Disable all regular-related interrupts */
-    __HAL_ADC_DISABLE_IT(hadc, (ADC_IT_EOC | ADC_IT_EOS | ADC_IT_OVR));
+  /* Configuration of the regular group is possible only if no conversion is on going */
+  if (LL_ADC_REG_IsConversionOngoing(hadc->Instance) != 0UL)
+  {
+    return HAL_BUSY;
+  }
 
-    /* 2. Disable ADC peripheral if no injected conversions are on-going */
-    if (LL_ADC_INJ_IsConversionOngoing(hadc->Instance) == 0UL)
-    {
-      tmp_hal_status = ADC_Disable(hadc);
-      /* if no issue reported */
-      if (tmp_hal_status == HAL_OK)
-      {
-        /* Set ADC state */
-        ADC_STATE_CLR_SET(hadc->State,
-                          HAL_ADC_STATE_INJ_BUSY,
-                          HAL_ADC_STATE_READY);
-      }
-    }
-    else
+  /* One conversion per trigger, DMA in circular mode */
+  MODIFY_REG(hadc->Instance->CFGR,
+             ADC_CFGR_EXTSEL | ADC_CFGR_EXTEN | ADC_CFGR_CONT | ADC_CFGR_DMACFG,
+             (pConfig->Trigger & ADC_CFGR_EXTSEL) | ADC_EXTERNALTRIGCONVEDGE_RISING | ADC_CFGR_DMACFG);
+  hadc->Init.ExternalTrigConv      = pConfig->Trigger;
+  hadc->Init.ExternalTrigConvEdge  = ADC_EXTERNALTRIGCONVEDGE_RISING;
+  hadc->Init.ContinuousConvMode    = DISABLE;
+  hadc->Init.DMAContinuousRequests = ENABLE;
+
+  if (pConfig->WakeUpWindow == ENABLE)
+  {
+    /* Analog watchdog 1 on all the regular channels, in interrupt mode */
+    awd_config.WatchdogNumber  = ADC_ANALOGWATCHDOG_1;
+    awd_config.WatchdogMode    = ADC_ANALOGWATCHDOG_ALL_REG;
+    awd_config.Channel         = ADC_CHANNEL_0;
+    awd_config.ITMode          = ENABLE;
+    awd_config.HighThreshold   = pConfig->HighThreshold;
+    awd_config.LowThreshold    = pConfig->LowThreshold;
+    awd_config.FilteringConfig = ADC_AWD_FILTERING_NONE;
+
+    tmp_hal_status = HAL_ADC_AnalogWDGConfig(hadc, &awd_config);
+    if (tmp_hal_status != HAL_OK)
     {
-      SET_BIT(hadc->State, HAL_ADC_STATE_INJ_BUSY);
+      return tmp_hal_status;
     }
   }
 
-  /* Process unlocked */
-  __HAL_UNLOCK(hadc);
+  /* Start the conversions, the first one at the next trigger event */
+  return HAL_ADC_Start_DMA(hadc, pConfig->pData, 2UL * pConfig->BlockSize);
+}
+
+/**
+  * @brief  Stop the low-power sampler: stop the conversions and the DMA transfer, and disable the ADC.
+  * @param hadc ADC handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ADCEx_LowPowerSamplerStop_DMA(ADC_HandleTypeDef *hadc)
+{
+  HAL_StatusTypeDef tmp_hal_status;
+
+  /* Check the parameters */
+  assert_param(IS_ADC_ALL_INSTANCE(hadc->Instance));
+
+  tmp_hal_status = HAL_ADC_Stop_DMA(hadc);
+
+  /* Disable the wake-up on the thresholds window */
+  __HAL_ADC_DISABLE_IT(hadc, ADC_IT_AWD1);
 
   /* Return function status */
   return tmp_hal_status;
 }
 
 /**
-  * @brief  Stop ADC conversion of regular group (and injected group in
-  *         case of auto_injection mode), disable ADC DMA transfer, disable
-  *         ADC peripheral if no conversion is on going
-  *         on injected group.
-  * @note   HAL_ADCEx_RegularStop_DMA() function is dedicated to single-ADC mode only.
-  *         For multimode (when multimode feature is available),
-  *         HAL_ADCEx_RegularMultiModeStop_DMA() API must be used.
+  * @brief  Enable ADC and start a threshold triggered capture: the conversions of regular group run continuously
+  *         through DMA into a ring buffer and only the conversions around an analog watchdog event are kept,
+  *         like an oscilloscope trigger.
+  * @note   The regular group must hold a single channel and the DMA channel of the ADC handle must be initialized
+  *         in DMA_LINKEDLIST_CIRCULAR mode with word data width, its queue holding a single node with half
+  *         transfer event enabled. The conversion data must be right aligned without offset.
+  * @note   The analog watchdog interrupt is disabled at the trigger. At the first half ring completion after the
+  *         post-trigger conversions, the conversions from PreTriggerSamples before the trigger are copied into
+  *         the capture buffer and HAL_ADC_ConvCpltCallback() is called instead of the analog watchdog callbacks.
+  *         The trigger is armed again by HAL_ADCEx_ThresholdCaptureRearm().
+  * @note   The pre-trigger conversions are valid once PreTriggerSamples conversions are done after the start.
   * @param hadc ADC handle
-  * @retval HAL status.
+  * @param pCapture Pointer to the capture structure, it must stay allocated until the capture is stopped
+  * @retval HAL status
   */
-HAL_StatusTypeDef HAL_ADCEx_RegularStop_DMA(ADC_HandleTypeDef *hadc)
+HAL_StatusTypeDef HAL_ADCEx_ThresholdCaptureStart_DMA(ADC_HandleTypeDef *hadc, ADC_ThresholdCaptureTypeDef *pCapture)
 {
+  ADC_AnalogWDGConfTypeDef awd_config = {0};
   HAL_StatusTypeDef tmp_hal_status;
 
   /* Check the parameters */
   assert_param(IS_ADC_ALL_INSTANCE(hadc->Instance));
 
-  /* Process locked */
-  __HAL_LOCK(hadc);
+  if ((pCapture == NULL) || (pCapture->pRingBuffer == NULL) || (pCapture->pCaptureBuffer == NULL)
+      || (pCapture->PostTriggerSamples == 0UL)
+      || ((2UL * (pCapture->PreTriggerSamples + pCapture->PostTriggerSamples)) > pCapture->RingSize))
+  {
+    return HAL_ERROR;
+  }
 
-  /* 1. Stop potential regular conversion on going */
-  tmp_hal_status = ADC_ConversionStop(hadc, ADC_REGULAR_GROUP);
+  assert_param(IS_ADC_ANALOG_WATCHDOG_NUMBER(pCapture->WatchdogNumber));
 
-  /* Disable ADC peripheral if conversions are effectively stopped
-     and if no injected conversion is on-going */
-  if (tmp_hal_status == HAL_OK)
+  /* Check the single channel sequence and the DMA circular linked-list mode */
+  if ((LL_ADC_REG_GetSequencerLength(hadc->Instance) != LL_ADC_REG_SEQ_SCAN_DISABLE)
+      || (hadc->DMA_Handle == NULL) || (hadc->DMA_Handle->Mode != DMA_LINKEDLIST_CIRCULAR))
   {
-    /* Clear HAL_ADC_STATE_REG_BUSY bit */
-    CLEAR_BIT(hadc->State, HAL_ADC_STATE_REG_BUSY);
+    return HAL_ERROR;
+  }
 
-    /* Disable ADC DMA (ADC DMA configuration ADC_CFGR_DMACFG is kept) */
-    CLEAR_BIT(hadc->Instance->CFGR, ADC_CFGR_DMAEN);
+  if (LL_ADC_REG_IsConversionOngoing(hadc->Instance) != 0UL)
+  {
+    return HAL_BUSY;
+  }
 
-    /* Disable the DMA channel (in case of DMA in circular mode or stop while */
-    /* while DMA transfer is on going)                                        */
-    tmp_hal_status = HAL_DMA_Abort(hadc->DMA_Handle);
+  /* Analog watchdog on the regular group, its interrupt is enabled once the DMA runs */
+  awd_config.WatchdogNumber  = pCapture->WatchdogNumber;
+  awd_config.WatchdogMode    = ADC_ANALOGWATCHDOG_ALL_REG;
+  awd_config.Channel         = ADC_CHANNEL_0;
+  awd_config.ITMode          = DISABLE;
+  awd_config.HighThreshold   = pCapture->HighThreshold;
+  awd_config.LowThreshold    = pCapture->LowThreshold;
+  awd_config.FilteringConfig = ADC_AWD_FILTERING_NONE;
+
+  tmp_hal_status = HAL_ADC_AnalogWDGConfig(hadc, &awd_config);
+  if (tmp_hal_status != HAL_OK)
+  {
+    return tmp_hal_status;
+  }
 
-    /* Check if DMA channel effectively disabled */
-    if (tmp_hal_status != HAL_OK)
-    {
-      /* Update ADC state machine to error */
-      SET_BIT(hadc->State, HAL_ADC_STATE_ERROR_DMA);
-    }
+  /* Reset the capture status */
+  pCapture->TriggerIndex   = 0UL;
+  pCapture->WriteIndex     = 0UL;
+  pCapture->PostCount      = 0UL;
+  pCapture->Triggered      = 0UL;
+  pCapture->CapturePending = 0UL;
+  pCapture->CaptureCount   = 0UL;
 
-    /* Disable ADC overrun interrupt */
-    __HAL_ADC_DISABLE_IT(hadc, ADC_IT_OVR);
+  hadc->pThresholdCapture = pCapture;
 
-    /* 2. Disable the ADC peripheral */
-    /* Update "tmp_hal_status" only if DMA channel disabling passed,          */
-    /* to keep in memory a potential failing status.                          */
-    if (LL_ADC_INJ_IsConversionOngoing(hadc->Instance) == 0UL)
-    {
-      if (tmp_hal_status == HAL_OK)
-      {
-        tmp_hal_status = ADC_Disable(hadc);
-      }
-      else
-      {
-        (void)ADC_Disable(hadc);
-      }
+  tmp_hal_status = HAL_ADC_Start_DMA(hadc, pCapture->pRingBuffer, pCapture->RingSize);
 
-      /* Check if ADC is effectively disabled */
-      if (tmp_hal_status == HAL_OK)
-      {
-        /* Set ADC state */
-        ADC_STATE_CLR_SET(hadc->State,
-                          HAL_ADC_STATE_INJ_BUSY,
-                          HAL_ADC_STATE_READY);
-      }
-    }
-    else
-    {
-      SET_BIT(hadc->State, HAL_ADC_STATE_INJ_BUSY);
-    }
-  }
+  if (tmp_hal_status == HAL_OK)
+  {
+    /* The ring buffer halves only update the capture progress: the first one completes after RingSize / 2
+       conversions, long after this point */
+    hadc->DMA_Handle->XferHalfCpltCallback = ADCEx_DMACaptureUpdate;
+    hadc->DMA_Handle->XferCpltCallback = ADCEx_DMACaptureUpdate;
 
-  /* Process unlocked */
-  __HAL_UNLOCK(hadc);
+    /* Arm the trigger */
+    ADCEx_ThresholdCaptureArm(hadc);
+  }
+  else
+  {
+    hadc->pThresholdCapture = NULL;
+  }
 
-  /* Return function status */
   return tmp_hal_status;
 }
 
-#if defined(ADC_MULTIMODE_SUPPORT)
 /**
-  * @brief  Stop DMA-based multimode ADC conversion, disable ADC DMA transfer, disable ADC peripheral if no injected
-  *         conversion is on-going.
-  * @note   Multimode is kept enabled after this function. Multimode DMA bits
-  *         (MDMA and DMACFG bits of common CCR register) are maintained. To disable
-  *         multimode (set with HAL_ADCEx_MultiModeConfigChannel()), ADC must be
-  *         reinitialized using HAL_ADC_Init() or HAL_ADC_DeInit(), or the user can
-  *         resort to HAL_ADCEx_DisableMultiMode() API.
-  * @note   In case of DMA configured in circular mode, function
-  *         HAL_ADCEx_RegularStop_DMA() must be called after this function with handle of
-  *         ADC slave, to properly disable the DMA channel.
-  * @param hadc ADC handle of ADC master (handle of ADC slave must not be used)
+  * @brief  Stop a threshold triggered capture: stop the conversions and the DMA transfer, and disable the ADC.
+  * @note   The capture status (CaptureCount) is kept for reading after stop.
+  * @param hadc ADC handle
   * @retval HAL status
   */
-HAL_StatusTypeDef HAL_ADCEx_RegularMultiModeStop_DMA(ADC_HandleTypeDef *hadc)
+HAL_StatusTypeDef HAL_ADCEx_ThresholdCaptureStop_DMA(ADC_HandleTypeDef *hadc)
 {
   HAL_StatusTypeDef tmp_hal_status;
-  uint32_t tickstart;
-  ADC_HandleTypeDef tmp_hadc_slave;
-  uint32_t tmp_hadc_slave_conversion_on_going;
-
-  /* Check the parameters */
-  assert_param(IS_ADC_MULTIMODE_MASTER_INSTANCE(hadc->Instance));
 
-  /* Process locked */
-  __HAL_LOCK(hadc);
+  if (hadc->pThresholdCapture == NULL)
+  {
+    return HAL_ERROR;
+  }
 
+  /* Disarm the trigger */
+  __HAL_ADC_DISABLE_IT(hadc, ADCEx_ThresholdCaptureIT(hadc->pThresholdCapture));
 
-  /* 1. Stop potential multimode conversion on going, on regular groups */
-  tmp_hal_status = ADC_ConversionStop(hadc, ADC_REGULAR_GROUP);
+  tmp_hal_status = HAL_ADC_Stop_DMA(hadc);
 
-  /* Disable ADC peripheral if conversions are effectively stopped */
   if (tmp_hal_status == HAL_OK)
   {
-    /* Clear HAL_ADC_STATE_REG_BUSY bit */
-    CLEAR_BIT(hadc->State, HAL_ADC_STATE_REG_BUSY);
-
-    /* Temporary handle minimum initialization */
-    __HAL_ADC_RESET_HANDLE_STATE(&tmp_hadc_slave);
-    ADC_CLEAR_ERRORCODE(&tmp_hadc_slave);
-
-    /* Set a temporary handle of the ADC slave associated to the ADC master   */
-    ADC_MULTI_SLAVE(hadc, &tmp_hadc_slave);
-
-    if (tmp_hadc_slave.Instance == NULL)
-    {
-      /* Update ADC state machine to error */
-      SET_BIT(hadc->State, HAL_ADC_STATE_ERROR_CONFIG);
-
-      /* Process unlocked */
-      __HAL_UNLOCK(hadc);
-
-      return HAL_ERROR;
-    }
-
-    /* Procedure to disable the ADC peripheral: wait for conversions          */
-    /* effectively stopped (ADC master and ADC slave), then disable ADC       */
-
-    /* 1. Wait for ADC conversion completion for ADC master and ADC slave */
-    tickstart = HAL_GetTick();
+    hadc->pThresholdCapture = NULL;
+  }
 
-    tmp_hadc_slave_conversion_on_going = LL_ADC_REG_IsConversionOngoing((&tmp_hadc_slave)->Instance);
-    while ((LL_ADC_REG_IsConversionOngoing(hadc->Instance) == 1UL)
-           || (tmp_hadc_slave_conversion_on_going == 1UL)
-          )
-    {
-      if ((HAL_GetTick() - tickstart) > ADC_STOP_CONVERSION_TIMEOUT)
-      {
-        /* New check to avoid false timeout detection in case of preemption */
-        tmp_hadc_slave_conversion_on_going = LL_ADC_REG_IsConversionOngoing((&tmp_hadc_slave)->Instance);
-        if ((LL_ADC_REG_IsConversionOngoing(hadc->Instance) == 1UL)
-            || (tmp_hadc_slave_conversion_on_going == 1UL)
-           )
-        {
-          /* Update ADC state machine to error */
-          SET_BIT(hadc->State, HAL_ADC_STATE_ERROR_INTERNAL);
+  return tmp_hal_status;
+}
 
-          /* Process unlocked */
-          __HAL_UNLOCK(hadc);
+/**
+  * @brief  Release the capture buffer of a threshold triggered capture and arm the trigger again.
+  * @param hadc ADC handle
+  * @retval HAL status, HAL_BUSY if the post-trigger conversions of a capture are on going
+  */
+HAL_StatusTypeDef HAL_ADCEx_ThresholdCaptureRearm(ADC_HandleTypeDef *hadc)
+{
+  if (hadc->pThresholdCapture == NULL)
+  {
+    return HAL_ERROR;
+  }
 
-          return HAL_ERROR;
-        }
-      }
+  if (hadc->pThresholdCapture->Triggered != 0UL)
+  {
+    return HAL_BUSY;
+  }
 
-      tmp_hadc_slave_conversion_on_going = LL_ADC_REG_IsConversionOngoing((&tmp_hadc_slave)->Instance);
-    }
+  hadc->pThresholdCapture->CapturePending = 0UL;
 
-    /* Disable the DMA channel (in case of DMA in circular mode or stop       */
-    /* while DMA transfer is on going)                                        */
-    /* Note: DMA channel of ADC slave should be stopped after this function   */
-    /* with HAL_ADCEx_RegularStop_DMA() API.                                  */
-    tmp_hal_status = HAL_DMA_Abort(hadc->DMA_Handle);
+  ADCEx_ThresholdCaptureArm(hadc);
 
-    /* Check if DMA channel effectively disabled */
-    if (tmp_hal_status != HAL_OK)
-    {
-      /* Update ADC state machine to error */
-      SET_BIT(hadc->State, HAL_ADC_STATE_ERROR_DMA);
-    }
+  return HAL_OK;
+}
 
-    /* Disable ADC overrun interrupt */
-    __HAL_ADC_DISABLE_IT(hadc, ADC_IT_OVR);
+/**
+  * @brief  Get ADC injected group conversion result.
+  * @note   Reading register JDRx automatically clears ADC flag JEOC
+  *         (ADC group injected end of unitary conversion).
+  * @note   This function does not clear ADC flag JEOS
+  *         (ADC group injected end of sequence conversion)
+  *         Occurrence of flag JEOS rising:
+  *          - If sequencer is composed of 1 rank, flag JEOS is equivalent
+  *            to flag JEOC.
+  *          - If sequencer is composed of several ranks, during the scan
+  *            sequence flag JEOC only is raised, at the end of the scan sequence
+  *            both flags JEOC and EOS are raised.
+  *         Flag JEOS must not be cleared by this function because
+  *         it would not be compliant with low power features
+  *         (feature low power auto-wait, not available on all STM32 series).
+  *         To clear this flag, either use function:
+  *         in programming model IT: @ref HAL_ADC_IRQHandler(), in programming
+  *         model polling: @ref HAL_ADCEx_InjectedPollForConversion()
+  *         or @ref __HAL_ADC_CLEAR_FLAG(&hadc, ADC_FLAG_JEOS).
+  * @param hadc ADC handle
+  * @param InjectedRank the converted ADC injected rank.
+  *          This parameter can be one of the following values:
+  *            @arg @ref ADC_INJECTED_RANK_1 ADC group injected rank 1
+  *            @arg @ref ADC_INJECTED_RANK_2 ADC group injected rank 2
+  *            @arg @ref ADC_INJECTED_RANK_3 ADC group injected rank 3
+  *            @arg @ref ADC_INJECTED_RANK_4 ADC group injected rank 4
+  * @retval ADC group injected conversion data
+  */
+uint32_t HAL_ADCEx_InjectedGetValue(const ADC_HandleTypeDef *hadc, uint32_t InjectedRank)
+{
+  uint32_t tmp_jdr;
 
-    /* 2. Disable the ADC peripherals: master and slave if no injected        */
-    /*   conversion is on-going.                                              */
-    /* Update "tmp_hal_status" only if DMA channel disabling passed, to keep in */
-    /* memory a potential failing status.                                     */
-    if (tmp_hal_status == HAL_OK)
-    {
-      if (LL_ADC_INJ_IsConversionOngoing(hadc->Instance) == 0UL)
-      {
-        tmp_hal_status =  ADC_Disable(hadc);
-        if (tmp_hal_status == HAL_OK)
-        {
-          if (LL_ADC_INJ_IsConversionOngoing((&tmp_hadc_slave)->Instance) == 0UL)
-          {
-            tmp_hal_status =  ADC_Disable(&tmp_hadc_slave);
-          }
-        }
-      }
+  /* Check the parameters */
+  assert_param(IS_ADC_ALL_INSTANCE(hadc->Instance));
+  assert_param(IS_ADC_INJECTED_RANK(InjectedRank));
 
-      if (tmp_hal_status == HAL_OK)
-      {
-        /* Both Master and Slave ADC's could be disabled. Update Master State */
-        /* Clear HAL_ADC_STATE_INJ_BUSY bit, set HAL_ADC_STATE_READY bit */
-        ADC_STATE_CLR_SET(hadc->State, HAL_ADC_STATE_INJ_BUSY, HAL_ADC_STATE_READY);
-      }
-      else
-      {
-        /* injected (Master or Slave) conversions are still on-going,
-           no Master State change */
-      }
-    }
+  /* Get ADC converted value */
+  switch (InjectedRank)
+  {
+    case ADC_INJECTED_RANK_4:
+      tmp_jdr = hadc->Instance->JDR4;
+      break;
+    case ADC_INJECTED_RANK_3:
+      tmp_jdr = hadc->Instance->JDR3;
+      break;
+    case ADC_INJECTED_RANK_2:
+      tmp_jdr = hadc->Instance->JDR2;
+      break;
+    case ADC_INJECTED_RANK_1:
+    default:
+      tmp_jdr = hadc->Instance->JDR1;
+      break;
   }
 
-  /* Process unlocked */
-  __HAL_UNLOCK(hadc);
-
-  /* Return function status */
-  return tmp_hal_status;
+  /* Return ADC converted value */
+  return tmp_jdr;
 }
-#endif /* ADC_MULTIMODE_SUPPORT */
 
 /**
-  * @}
+  * @brief  Injected conversion complete callback in non-blocking mode.
+  * @param hadc ADC handle
+  * @retval None
   */
+__weak void HAL_ADCEx_InjectedConvCpltCallback(ADC_HandleTypeDef *hadc)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hadc);
 
-/** @defgroup ADCEx_Exported_Functions_Group2 ADC Extended Peripheral Control functions
-  * @brief    ADC Extended Peripheral Control functions
-  *
-@verbatim
- ===============================================================================
-             ##### Peripheral Control functions #####
- ===============================================================================
-    [..]  This section provides functions allowing to:
-      (+) Configure channels on injected group
-      (+) Configure multimode when multimode feature is available
-      (+) Enable or Disable Injected Queue
-      (+) Disable ADC voltage regulator
-      (+) Enter ADC deep-power-down mode
-
-@endverbatim
-  * @{
+  /* NOTE : This function should not be modified. When the callback is needed,
+            function HAL_ADCEx_InjectedConvCpltCallback must be implemented in the user file.
   */
+}
 
 /**
-  * @brief  Configure a channel to be assigned to ADC group injected.
-  * @note   Possibility to update parameters on the fly:
-  *         This function initializes injected group, following calls to this
-  *         function can be used to reconfigure some parameters of structure
-  *         "ADC_InjectionConfTypeDef" on the fly, without resetting the ADC.
-  *         The setting of these parameters is conditioned to ADC state:
-  *         Refer to comments of structure "ADC_InjectionConfTypeDef".
-  * @note   In case of usage of internal measurement channels:
-  *         Vbat/VrefInt/TempSensor.
-  *         These internal paths can be disabled using function
-  *         HAL_ADC_DeInit().
-  * @note   Caution: For Injected Context Queue use, a context must be fully
-  *         defined before start of injected conversion. All channels are configured
-  *         consecutively for the same ADC instance. Therefore, the number of calls to
-  *         HAL_ADCEx_InjectedConfigChannel() must be equal to the value of parameter
-  *         InjectedNbrOfConversion for each context.
-  *  - Example 1: If 1 context is intended to be used (or if there is no use of the
-  *    Injected Queue Context feature) and if the context contains 3 injected ranks
-  *    (InjectedNbrOfConversion = 3), HAL_ADCEx_InjectedConfigChannel() must be
-  *    called once for each channel (i.e. 3 times) before starting a conversion.
-  *    This function must not be called to configure a 4th injected channel:
-  *    it would start a new context into context queue.
-  *  - Example 2: If 2 contexts are intended to be used and each of them contains
-  *    3 injected ranks (InjectedNbrOfConversion = 3),
-  *    HAL_ADCEx_InjectedConfigChannel() must be called once for each channel and
-  *    for each context (3 channels x 2 contexts = 6 calls). Conversion can
-  *    start once the 1st context is set, that is after the first three
-  *    HAL_ADCEx_InjectedConfigChannel() calls. The 2nd context can be set on the fly.
+  * @brief  Injected context queue overflow callback.
+  * @note   This callback is called if injected context queue is enabled
+            (parameter "QueueInjectedContext" in injected channel configuration)
+            and if a new injected context is set when queue is full (maximum 2
+            contexts).
   * @param hadc ADC handle
-  * @param pConfigInjected Structure of ADC injected group and ADC channel for
-  *         injected group.
-  * @retval HAL status
+  * @retval None
   */
-HAL_StatusTypeDef HAL_ADCEx_InjectedConfigChannel(ADC_HandleTypeDef *hadc,
-                                                  const ADC_InjectionConfTypeDef *pConfigInjected)
+__weak void HAL_ADCEx_InjectedQueueOverflowCallback(ADC_HandleTypeDef *hadc)
 {
-  HAL_StatusTypeDef tmp_hal_status = HAL_OK;
-  uint32_t tmp_offset_shifted;
-  uint32_t tmp_config_internal_channel;
-  uint32_t tmp_adc_is_conversion_on_going_regular;
-  uint32_t tmp_adc_is_conversion_on_going_injected;
-  __IO uint32_t wait_loop_index = 0;
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hadc);
 
-  uint32_t tmp_jsqr_context_queue_being_built = 0U;
+  /* NOTE : This function should not be modified. When the callback is needed,
+            function HAL_ADCEx_InjectedQueueOverflowCallback must be implemented in the user file.
+  */
+}
 
-  /* Check the parameters */
-  assert_param(IS_ADC_ALL_INSTANCE(hadc->Instance));
-  assert_param(IS_ADC_SAMPLE_TIME(pConfigInjected->InjectedSamplingTime));
-  assert_param(IS_ADC_SINGLE_DIFFERENTIAL(pConfigInjected->InjectedSingleDiff));
-  assert_param(IS_FUNCTIONAL_STATE(pConfigInjected->AutoInjectedConv));
-  assert_param(IS_FUNCTIONAL_STATE(pConfigInjected->QueueInjectedContext));
-  assert_param(IS_ADC_EXTTRIGINJEC_EDGE(pConfigInjected->ExternalTrigInjecConvEdge));
-  assert_param(IS_ADC_EXTTRIGINJEC(pConfigInjected->ExternalTrigInjecConv));
-  assert_param(IS_ADC_OFFSET_NUMBER(pConfigInjected->InjectedOffsetNumber));
-  assert_param(IS_ADC_RANGE(ADC_GET_RESOLUTION(hadc), pConfigInjected->InjectedOffset));
-  assert_param(IS_ADC_OFFSET_SIGN(pConfigInjected->InjectedOffsetSign));
-  assert_param(IS_FUNCTIONAL_STATE(pConfigInjected->InjectedOffsetSaturation));
-  assert_param(IS_FUNCTIONAL_STATE(pConfigInjected->InjecOversamplingMode));
+/**
+  * @brief  Analog watchdog 2 callback in non-blocking mode.
+  * @param hadc ADC handle
+  * @retval None
+  */
+__weak void HAL_ADCEx_LevelOutOfWindow2Callback(ADC_HandleTypeDef *hadc)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hadc);
 
-  if (hadc->Init.ScanConvMode != ADC_SCAN_DISABLE)
-  {
-    assert_param(IS_ADC_INJECTED_RANK(pConfigInjected->InjectedRank));
-    assert_param(IS_ADC_INJECTED_NB_CONV(pConfigInjected->InjectedNbrOfConversion));
-    assert_param(IS_FUNCTIONAL_STATE(pConfigInjected->InjectedDiscontinuousConvMode));
-  }
+  /* NOTE : This function should not be modified. When the callback is needed,
+            function HAL_ADCEx_LevelOutOfWindow2Callback must be implemented in the user file.
+  */
+}
 
+/**
+  * @brief  Analog watchdog 3 callback in non-blocking mode.
+  * @param hadc ADC handle
+  * @retval None
+  */
+__weak void HAL_ADCEx_LevelOutOfWindow3Callback(ADC_HandleTypeDef *hadc)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hadc);
 
-  /* if JOVSE is set, the value of the OFFSETy_EN bit in ADCx_OFRy register is
-     ignored (considered as reset) */
-  assert_param(!((pConfigInjected->InjectedOffsetNumber != ADC_OFFSET_NONE)
-                 && (pConfigInjected->InjecOversamplingMode == ENABLE)));
+  /* NOTE : This function should not be modified. When the callback is needed,
+            function HAL_ADCEx_LevelOutOfWindow3Callback must be implemented in the user file.
+  */
+}
 
-  /* JDISCEN and JAUTO bits can't be set at the same time  */
-  assert_param(!((pConfigInjected->InjectedDiscontinuousConvMode == ENABLE)
-                 && (pConfigInjected->AutoInjectedConv == ENABLE)));
 
-  /*  DISCEN and JAUTO bits can't be set at the same time */
-  assert_param(!((hadc->Init.DiscontinuousConvMode == ENABLE) && (pConfigInjected->AutoInjectedConv == ENABLE)));
+/**
+  * @brief  End Of Sampling callback in non-blocking mode.
+  * @param hadc ADC handle
+  * @retval None
+  */
+__weak void HAL_ADCEx_EndOfSamplingCallback(ADC_HandleTypeDef *hadc)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hadc);
 
-  /* Verification of channel number */
-  if (pConfigInjected->InjectedSingleDiff != ADC_DIFFERENTIAL_ENDED)
-  {
-    assert_param(IS_ADC_CHANNEL(hadc, pConfigInjected->InjectedChannel));
-  }
-  else
-  {
-    assert_param(IS_ADC_DIFF_CHANNEL(hadc, pConfigInjected->InjectedChannel));
-  }
+  /* NOTE : This function should not be modified. When the callback is needed,
+            function HAL_ADCEx_EndOfSamplingCallback must be implemented in the user file.
+  */
+}
+
+/**
+  * @brief  Stop ADC conversion of regular group (and injected channels in
+  *         case of auto_injection mode), disable ADC peripheral if no
+  *         conversion is on going on injected group.
+  * @param hadc ADC handle
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_ADCEx_RegularStop(ADC_HandleTypeDef *hadc)
+{
+  HAL_StatusTypeDef tmp_hal_status;
+
+  /* Check the parameters */
+  assert_param(IS_ADC_ALL_INSTANCE(hadc->Instance));
 
   /* Process locked */
   __HAL_LOCK(hadc);
 
-  /* Configuration of injected group sequencer:                               */
-  /* Hardware constraint: Must fully define injected context register JSQR    */
-  /* before make it entering into injected sequencer queue.                   */
-  /*                                                                          */
-  /* - if scan mode is disabled:                                              */
-  /*    * Injected channels sequence length is set to 0x00: 1 channel         */
-  /*      converted (channel on injected rank 1)                              */
-  /*      Parameter "InjectedNbrOfConversion" is discarded.                   */
-  /*    * Injected context register JSQR setting is simple: register is fully */
-  /*      defined on one call of this function (for injected rank 1) and can  */
-  /*      be entered into queue directly.                                     */
-  /* - if scan mode is enabled:                                               */
-  /*    * Injected channels sequence length is set to parameter               */
-  /*      "InjectedNbrOfConversion".                                          */
-  /*    * Injected context register JSQR setting more complex: register is    */
-  /*      fully defined over successive calls of this function, for each      */
-  /*      injected channel rank. It is entered into queue only when all       */
-  /*      injected ranks have been set.                                       */
-  /*   Note: Scan mode is not present by hardware on this device, but used    */
-  /*   by software for alignment over all STM32 devices.                      */
+  /* 1. Stop potential regular conversion on going */
+  tmp_hal_status = ADC_ConversionStop(hadc, ADC_REGULAR_GROUP);
 
-  if ((hadc->Init.ScanConvMode == ADC_SCAN_DISABLE)  ||
-      (pConfigInjected->InjectedNbrOfConversion == 1U))
+  /* Disable ADC peripheral if regular conversions are effectively stopped
+     and if no injected conversions are on-going */
+  if (tmp_hal_status == HAL_OK)
   {
-    /* Configuration of context register JSQR:                                */
-    /*  - number of ranks in injected group sequencer: fixed to 1st rank      */
-    /*    (scan mode disabled, only rank 1 used)                              */
-    /*  - external trigger to start conversion                                */
-    /*  - external trigger polarity                                           */
-    /*  - channel set to rank 1 (scan mode disabled, only rank 1 can be used) */
+    /* Clear HAL_ADC_STATE_REG_BUSY bit */
+    CLEAR_BIT(hadc->State, HAL_ADC_STATE_REG_BUSY);
 
-    if (pConfigInjected->InjectedRank == ADC_INJECTED_RANK_1)
+    if (LL_ADC_INJ_IsConversionOngoing(hadc->Instance) == 0UL)
     {
-      /* Enable external trigger if trigger selection is different of         */
-      /* software start.                                                      */
-      /* Note: This configuration keeps the hardware feature of parameter     */
-      /*       ExternalTrigInjecConvEdge "trigger edge none" equivalent to    */
-      /*       software start.                                                */
-      if (pConfigInjected->ExternalTrigInjecConv != ADC_INJECTED_SOFTWARE_START)
-      {
-        tmp_jsqr_context_queue_being_built = (ADC_JSQR_RK(pConfigInjected->InjectedChannel, ADC_INJECTED_RANK_1)
-                                              | (pConfigInjected->ExternalTrigInjecConv & ADC_JSQR_JEXTSEL)
-                                              | pConfigInjected->ExternalTrigInjecConvEdge
-                                             );
-      }
-      else
+      /* 2. Disable the ADC peripheral */
+      tmp_hal_status = ADC_Disable(hadc);
+
+      /* Check if ADC is effectively disabled */
+      if (tmp_hal_status == HAL_OK)
       {
-        tmp_jsqr_context_queue_being_built = (ADC_JSQR_RK(pConfigInjected->InjectedChannel, ADC_INJECTED_RANK_1));
+        /* Set ADC state */
+        ADC_STATE_CLR_SET(hadc->State,
+                          HAL_ADC_STATE_INJ_BUSY,
+                          HAL_ADC_STATE_READY);
       }
-
-      MODIFY_REG(hadc->Instance->JSQR, ADC_JSQR_FIELDS, tmp_jsqr_context_queue_being_built);
-      /* For debug and informative reasons, hadc handle saves JSQR setting */
-      hadc->InjectionConfig.ContextQueue = tmp_jsqr_context_queue_being_built;
-
+    }
+    /* Conversion on injected group is stopped, but ADC not disabled since    */
+    /* conversion on regular group is still running.                          */
+    else
+    {
+      SET_BIT(hadc->State, HAL_ADC_STATE_INJ_BUSY);
     }
   }
-  else
-  {
-    /* Case of scan mode enabled, several channels to set into injected group */
-    /* sequencer.                                                             */
-    /*                                                                        */
-    /* Procedure to define injected context register JSQR over successive     */
-    /* calls of this function, for each injected channel rank:                */
-    /* 1. Start new context and set parameters related to all injected        */
-    /*    channels: injected sequence length and trigger.                     */
 
-    /* if hadc->InjectionConfig.ChannelCount is equal to 0, this is the first */
-    /*   call of the context under setting                                    */
-    if (hadc->InjectionConfig.ChannelCount == 0U)
-    {
-      /* Initialize number of channels that will be configured on the context */
-      /*  being built                                                         */
-      hadc->InjectionConfig.ChannelCount = pConfigInjected->InjectedNbrOfConversion;
-      /* Handle hadc saves the context under build up over each HAL_ADCEx_InjectedConfigChannel()
-         call, this context will be written in JSQR register at the last call.
-         At this point, the context is merely reset  */
-      hadc->InjectionConfig.ContextQueue = 0x00000000U;
+  /* Process unlocked */
+  __HAL_UNLOCK(hadc);
 
-      /* Configuration of context register JSQR:                              */
-      /*  - number of ranks in injected group sequencer                       */
-      /*  - external trigger to start conversion                              */
-      /*  - external trigger polarity                                         */
+  /* Return function status */
+  return tmp_hal_status;
+}
 
-      /* Enable external trigger if trigger selection is different of         */
-      /* software start.                                                      */
-      /* Note: This configuration keeps the hardware feature of parameter     */
-      /*       ExternalTrigInjecConvEdge "trigger edge none" equivalent to    */
-      /*       software start.                                                */
-      if (pConfigInjected->ExternalTrigInjecConv != ADC_INJECTED_SOFTWARE_START)
-      {
-        tmp_jsqr_context_queue_being_built = ((pConfigInjected->InjectedNbrOfConversion - 1U)
-                                              | (pConfigInjected->ExternalTrigInjecConv & ADC_JSQR_JEXTSEL)
-                                              | pConfigInjected->ExternalTrigInjecConvEdge
-                                             );
-      }
-      else
-      {
-        tmp_jsqr_context_queue_being_built = ((pConfigInjected->InjectedNbrOfConversion - 1U));
-      }
 
-    }
+/**
+  * @brief  Stop ADC conversion of ADC groups regular and injected,
+  *         disable interrution of end-of-conversion,
+  *         disable ADC peripheral if no conversion is on going
+  *         on injected group.
+  * @param hadc ADC handle
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_ADCEx_RegularStop_IT(ADC_HandleTypeDef *hadc)
+{
+  HAL_StatusTypeDef tmp_hal_status;
 
-    /* 2. Continue setting of context under definition with parameter       */
-    /*    related to each channel: channel rank sequence                    */
-    /* Clear the old JSQx bits for the selected rank */
-    tmp_jsqr_context_queue_being_built &= ~ADC_JSQR_RK(ADC_SQR3_SQ10, pConfigInjected->InjectedRank);
+  /* Check the parameters */
+  assert_param(IS_ADC_ALL_INSTANCE(hadc->Instance));
 
-    /* Set the JSQx bits for the selected rank */
-    tmp_jsqr_context_queue_being_built |= ADC_JSQR_RK(pConfigInjected->InjectedChannel, pConfigInjected->InjectedRank);
+  /* Process locked */
+  __HAL_LOCK(hadc);
 
-    /* Decrease channel count  */
-    hadc->InjectionConfig.ChannelCount--;
+  /* 1. Stop potential regular conversion on going */
+  tmp_hal_status = ADC_ConversionStop(hadc, ADC_REGULAR_GROUP);
 
-    /* 3. tmp_jsqr_context_queue_being_built is fully built for this HAL_ADCEx_InjectedConfigChannel()
-          call, aggregate the setting to those already built during the previous
-          HAL_ADCEx_InjectedConfigChannel() calls (for the same context of course)  */
-    hadc->InjectionConfig.ContextQueue |= tmp_jsqr_context_queue_being_built;
+  /* Disable ADC peripheral if conversions are effectively stopped
+    and if no injected conversion is on-going */
+  if (tmp_hal_status == HAL_OK)
+  {
+    /* Clear HAL_ADC_STATE_REG_BUSY bit */
+    CLEAR_BIT(hadc->State, HAL_ADC_STATE_REG_BUSY);
 
-    /* 4. End of context setting: if this is the last channel set, then write context
-        into register JSQR and make it enter into queue                   */
-    if (hadc->InjectionConfig.ChannelCount == 0U)
-    {
-      MODIFY_REG(hadc->Instance->JSQR, ADC_JSQR_FIELDS, hadc->InjectionConfig.ContextQueue);
-    }
-  }
+    /* Disable all regular-related interrupts */
+    __HAL_ADC_DISABLE_IT(hadc, (ADC_IT_EOC | ADC_IT_EOS | ADC_IT_OVR));
 
-  /* Parameters update conditioned to ADC state:                              */
-  /* Parameters that can be updated when ADC is disabled or enabled without   */
-  /* conversion on going on injected group:                                   */
-  /*  - Injected context queue: Queue disable (active context is kept) or     */
-  /*    enable (context decremented, up to 2 contexts queued)                 */
-  /*  - Injected discontinuous mode: can be enabled only if auto-injected     */
-  /*    mode is disabled.                                                     */
-  if (LL_ADC_INJ_IsConversionOngoing(hadc->Instance) == 0UL)
-  {
-    if ((pConfigInjected->InjectedChannel == ADC_CHANNEL_0)
-        || ((pConfigInjected->InjectedChannel == ADC_CHANNEL_1)
-            && (pConfigInjected->InjectedSingleDiff == ADC_DIFFERENTIAL_ENDED))
-       )
-    {
-      LL_ADC_EnableChannel0_GPIO(hadc->Instance);
-    }
-    /* If auto-injected mode is disabled: no constraint                       */
-    if (pConfigInjected->AutoInjectedConv == DISABLE)
+    /* 2. Disable ADC peripheral if no injected conversions are on-going */
+    if (LL_ADC_INJ_IsConversionOngoing(hadc->Instance) == 0UL)
     {
-      MODIFY_REG(hadc->Instance->CFGR,
-                 ADC_CFGR_JQM | ADC_CFGR_JDISCEN,
-                 ADC_CFGR_INJECT_CONTEXT_QUEUE((uint32_t)pConfigInjected->QueueInjectedContext)           |
-                 ADC_CFGR_INJECT_DISCCONTINUOUS((uint32_t)pConfigInjected->InjectedDiscontinuousConvMode));
+      tmp_hal_status = ADC_Disable(hadc);
+      /* if no issue reported */
+      if (tmp_hal_status == HAL_OK)
+      {
+        /* Set ADC state */
+        ADC_STATE_CLR_SET(hadc->State,
+                          HAL_ADC_STATE_INJ_BUSY,
+                          HAL_ADC_STATE_READY);
+      }
     }
-    /* If auto-injected mode is enabled: Injected discontinuous setting is    */
-    /* discarded.                                                             */
     else
     {
-      MODIFY_REG(hadc->Instance->CFGR,
-                 ADC_CFGR_JQM | ADC_CFGR_JDISCEN,
-                 ADC_CFGR_INJECT_CONTEXT_QUEUE((uint32_t)pConfigInjected->QueueInjectedContext));
+      SET_BIT(hadc->State, HAL_ADC_STATE_INJ_BUSY);
     }
-
   }
 
-  /* Parameters update conditioned to ADC state:                              */
-  /* Parameters that can be updated when ADC is disabled or enabled without   */
-  /* conversion on going on regular and injected groups:                      */
-  /*  - Automatic injected conversion: can be enabled if injected group       */
-  /*    external triggers are disabled.                                       */
-  /*  - Channel sampling time                                                 */
-  /*  - Channel offset                                                        */
-  tmp_adc_is_conversion_on_going_regular = LL_ADC_REG_IsConversionOngoing(hadc->Instance);
-  tmp_adc_is_conversion_on_going_injected = LL_ADC_INJ_IsConversionOngoing(hadc->Instance);
+  /* Process unlocked */
+  __HAL_UNLOCK(hadc);
 
-  if ((tmp_adc_is_conversion_on_going_regular == 0UL)
-      && (tmp_adc_is_conversion_on_going_injected == 0UL)
-     )
+  /* Return function status */
+  return tmp_hal_status;
+}
+
+/**
+  * @brief  Stop ADC conversion of regular group (and injected group in
+  *         case of auto_injection mode), disable ADC DMA transfer, disable
+  *         ADC peripheral if no conversion is on going
+  *         on injected group.
+  * @note   HAL_ADCEx_RegularStop_DMA() function is dedicated to single-ADC mode only.
+  *         For multimode (when multimode feature is available),
+  *         HAL_ADCEx_RegularMultiModeStop_DMA() API must be used.
+  * @param hadc ADC handle
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_ADCEx_RegularStop_DMA(ADC_HandleTypeDef *hadc)
+{
+  HAL_StatusTypeDef tmp_hal_status;
+
+  /* Check the parameters */
+  assert_param(IS_ADC_ALL_INSTANCE(hadc->Instance));
+
+  /* Process locked */
+  __HAL_LOCK(hadc);
+
+  /* 1. Stop potential regular conversion on going */
+  tmp_hal_status = ADC_ConversionStop(hadc, ADC_REGULAR_GROUP);
+
+  /* Disable ADC peripheral if conversions are effectively stopped
+     and if no injected conversion is on-going */
+  if (tmp_hal_status == HAL_OK)
   {
-    /* If injected group external triggers are disabled (set to injected      */
-    /* software start): no constraint                                         */
-    if ((pConfigInjected->ExternalTrigInjecConv == ADC_INJECTED_SOFTWARE_START)
-        || (pConfigInjected->ExternalTrigInjecConvEdge == ADC_EXTERNALTRIGINJECCONV_EDGE_NONE))
+    /* Clear HAL_ADC_STATE_REG_BUSY bit */
+    CLEAR_BIT(hadc->State, HAL_ADC_STATE_REG_BUSY);
+
+    /* Disable ADC DMA (ADC DMA configuration ADC_CFGR_DMACFG is kept) */
+    CLEAR_BIT(hadc->Instance->CFGR, ADC_CFGR_DMAEN);
+
+    /* Disable the DMA channel (in case of DMA in circular mode or stop while */
+    /* while DMA transfer is on going)                                        */
+    tmp_hal_status = HAL_DMA_Abort(hadc->DMA_Handle);
+
+    /* Check if DMA channel effectively disabled */
+    if (tmp_hal_status != HAL_OK)
     {
-      if (pConfigInjected->AutoInjectedConv == ENABLE)
-      {
-        SET_BIT(hadc->Instance->CFGR, ADC_CFGR_JAUTO);
-      }
-      else
-      {
-        CLEAR_BIT(hadc->Instance->CFGR, ADC_CFGR_JAUTO);
-      }
+      /* Update ADC state machine to error */
+      SET_BIT(hadc->State, HAL_ADC_STATE_ERROR_DMA);
     }
-    /* If Automatic injected conversion was intended to be set and could not  */
-    /* due to injected group external triggers enabled, error is reported.    */
-    else
+
+    /* Disable ADC overrun interrupt */
+    __HAL_ADC_DISABLE_IT(hadc, ADC_IT_OVR);
+
+    /* 2. Disable the ADC peripheral */
+    /* Update "tmp_hal_status" only if DMA channel disabling passed,          */
+    /* to keep in memory a potential failing status.                          */
+    if (LL_ADC_INJ_IsConversionOngoing(hadc->Instance) == 0UL)
     {
-      if (pConfigInjected->AutoInjectedConv == ENABLE)
+      if (tmp_hal_status == HAL_OK)
       {
-        /* Update ADC state machine to error */
-        SET_BIT(hadc->State, HAL_ADC_STATE_ERROR_CONFIG);
-
-        tmp_hal_status = HAL_ERROR;
+        tmp_hal_status = ADC_Disable(hadc);
       }
       else
       {
-        CLEAR_BIT(hadc->Instance->CFGR, ADC_CFGR_JAUTO);
+        (void)ADC_Disable(hadc);
       }
-    }
-
-    if (pConfigInjected->InjecOversamplingMode == ENABLE)
-    {
-      assert_param(IS_ADC_OVERSAMPLING_RATIO(pConfigInjected->InjecOversampling.Ratio));
-      assert_param(IS_ADC_RIGHT_BIT_SHIFT(pConfigInjected->InjecOversampling.RightBitShift));
-
-      /*  JOVSE must be reset in case of triggered regular mode  */
-      assert_param(!(READ_BIT(hadc->Instance->CFGR2, ADC_CFGR2_ROVSE | ADC_CFGR2_TROVS)
-                     == (ADC_CFGR2_ROVSE | ADC_CFGR2_TROVS)));
-
-      /* Configuration of Injected Oversampler:                                 */
-      /*  - Oversampling Ratio                                                  */
-      /*  - Right bit shift                                                     */
 
-      /* Enable OverSampling mode */
-      MODIFY_REG(hadc->Instance->CFGR2,
-                 ADC_CFGR2_JOVSE |
-                 ADC_CFGR2_OVSR  |
-                 ADC_CFGR2_OVSS,
-                 ADC_CFGR2_JOVSE                                  |
-                 pConfigInjected->InjecOversampling.Ratio         |
-                 pConfigInjected->InjecOversampling.RightBitShift
-                );
+      /* Check if ADC is effectively disabled */
+      if (tmp_hal_status == HAL_OK)
+      {
+        /* Set ADC state */
+        ADC_STATE_CLR_SET(hadc->State,
+                          HAL_ADC_STATE_INJ_BUSY,
+                          HAL_ADC_STATE_READY);
+      }
     }
     else
     {
-      /* Disable Regular OverSampling */
-      CLEAR_BIT(hadc->Instance->CFGR2, ADC_CFGR2_JOVSE);
+      SET_BIT(hadc->State, HAL_ADC_STATE_INJ_BUSY);
     }
+  }
 
-    /* Manage specific case of sampling time 3.5 cycles replacing 2.5 cyles */
-    if (pConfigInjected->InjectedSamplingTime == ADC_SAMPLETIME_3CYCLES_5)
-    {
-      /* Set sampling time of the selected ADC channel */
-      LL_ADC_SetChannelSamplingTime(hadc->Instance, pConfigInjected->InjectedChannel, LL_ADC_SAMPLINGTIME_2CYCLES_5);
+  /* Process unlocked */
+  __HAL_UNLOCK(hadc);
 
-      /* Set ADC sampling time common configuration */
-      LL_ADC_SetSamplingTimeCommonConfig(hadc->Instance, LL_ADC_SAMPLINGTIME_COMMON_3C5_REPL_2C5);
-    }
-    else
-    {
-      /* Set sampling time of the selected ADC channel */
-      LL_ADC_SetChannelSamplingTime(hadc->Instance, pConfigInjected->InjectedChannel,
-                                    pConfigInjected->InjectedSamplingTime);
+  /* Return function status */
+  return tmp_hal_status;
+}
 
-      /* Set ADC sampling time common configuration */
-      LL_ADC_SetSamplingTimeCommonConfig(hadc->Instance, LL_ADC_SAMPLINGTIME_COMMON_DEFAULT);
-    }
-
-    /* Configure the offset: offset enable/disable, channel, offset value */
+#if defined(ADC_MULTIMODE_SUPPORT)
+/**
+  * @brief  Stop DMA-based multimode ADC conversion, disable ADC DMA transfer, disable ADC peripheral if no injected
+  *         conversion is on-going.
+  * @note   Multimode is kept enabled after this function. Multimode DMA bits
+  *         (MDMA and DMACFG bits of common CCR register) are maintained. To disable
+  *         multimode (set with HAL_ADCEx_MultiModeConfigChannel()), ADC must be
+  *         reinitialized using HAL_ADC_Init() or HAL_ADC_DeInit(), or the user can
+  *         resort to HAL_ADCEx_DisableMultiMode() API.
+  * @note   In case of DMA configured in circular mode, function
+  *         HAL_ADCEx_RegularStop_DMA() must be called after this function with handle of
+  *         ADC slave, to properly disable the DMA channel.
+  * @param hadc ADC handle of ADC master (handle of ADC slave must not be used)
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ADCEx_RegularMultiModeStop_DMA(ADC_HandleTypeDef *hadc)
+{
+  HAL_StatusTypeDef tmp_hal_status;
+  uint32_t tickstart;
+  ADC_HandleTypeDef tmp_hadc_slave;
+  uint32_t tmp_hadc_slave_conversion_on_going;
 
-    /* Shift the offset with respect to the selected ADC resolution. */
-    /* Offset has to be left-aligned on bit 11, the LSB (right bits) are set to 0 */
-    tmp_offset_shifted = ADC_OFFSET_SHIFT_RESOLUTION(hadc, pConfigInjected->InjectedOffset);
+  /* Check the parameters */
+  assert_param(IS_ADC_MULTIMODE_MASTER_INSTANCE(hadc->Instance));
 
-    if (pConfigInjected->InjectedOffsetNumber != ADC_OFFSET_NONE)
-    {
-      /* Set ADC selected offset number */
-      LL_ADC_SetOffset(hadc->Instance, pConfigInjected->InjectedOffsetNumber, pConfigInjected->InjectedChannel,
-                       tmp_offset_shifted);
+  /* Process locked */
+  __HAL_LOCK(hadc);
 
-      /* Set ADC selected offset sign & saturation */
-      LL_ADC_SetOffsetSign(hadc->Instance, pConfigInjected->InjectedOffsetNumber, pConfigInjected->InjectedOffsetSign);
-      LL_ADC_SetOffsetSaturation(hadc->Instance, pConfigInjected->InjectedOffsetNumber,
-                                 (pConfigInjected->InjectedOffsetSaturation == ENABLE) ?
-                                 LL_ADC_OFFSET_SATURATION_ENABLE : LL_ADC_OFFSET_SATURATION_DISABLE);
-    }
-    else
-    {
-      /* Scan each offset register to check if the selected channel is targeted. */
-      /* If this is the case, the corresponding offset number is disabled.       */
-      if (__LL_ADC_CHANNEL_TO_DECIMAL_NB(LL_ADC_GetOffsetChannel(hadc->Instance, LL_ADC_OFFSET_1))
-          == __LL_ADC_CHANNEL_TO_DECIMAL_NB(pConfigInjected->InjectedChannel))
-      {
-        LL_ADC_SetOffsetState(hadc->Instance, LL_ADC_OFFSET_1, LL_ADC_OFFSET_DISABLE);
-      }
-      if (__LL_ADC_CHANNEL_TO_DECIMAL_NB(LL_ADC_GetOffsetChannel(hadc->Instance, LL_ADC_OFFSET_2))
-          == __LL_ADC_CHANNEL_TO_DECIMAL_NB(pConfigInjected->InjectedChannel))
-      {
-        LL_ADC_SetOffsetState(hadc->Instance, LL_ADC_OFFSET_2, LL_ADC_OFFSET_DISABLE);
-      }
-      if (__LL_ADC_CHANNEL_TO_DECIMAL_NB(LL_ADC_GetOffsetChannel(hadc->Instance, LL_ADC_OFFSET_3))
-          == __LL_ADC_CHANNEL_TO_DECIMAL_NB(pConfigInjected->InjectedChannel))
-      {
-        LL_ADC_SetOffsetState(hadc->Instance, LL_ADC_OFFSET_3, LL_ADC_OFFSET_DISABLE);
-      }
-      if (__LL_ADC_CHANNEL_TO_DECIMAL_NB(LL_ADC_GetOffsetChannel(hadc->Instance, LL_ADC_OFFSET_4))
-          == __LL_ADC_CHANNEL_TO_DECIMAL_NB(pConfigInjected->InjectedChannel))
-      {
-        LL_ADC_SetOffsetState(hadc->Instance, LL_ADC_OFFSET_4, LL_ADC_OFFSET_DISABLE);
-      }
-    }
 
-  }
+  /* 1. Stop potential multimode conversion on going, on regular groups */
+  tmp_hal_status = ADC_ConversionStop(hadc, ADC_REGULAR_GROUP);
 
-  /* Parameters update conditioned to ADC state:                              */
-  /* Parameters that can be updated only when ADC is disabled:                */
-  /*  - Single or differential mode                                           */
-  if (LL_ADC_IsEnabled(hadc->Instance) == 0UL)
+  /* Disable ADC peripheral if conversions are effectively stopped */
+  if (tmp_hal_status == HAL_OK)
   {
-    /* Set mode single-ended or differential input of the selected ADC channel */
-    LL_ADC_SetChannelSingleDiff(hadc->Instance, pConfigInjected->InjectedChannel, pConfigInjected->InjectedSingleDiff);
+    /* Clear HAL_ADC_STATE_REG_BUSY bit */
+    CLEAR_BIT(hadc->State, HAL_ADC_STATE_REG_BUSY);
 
-    /* Configuration of differential mode */
-    /* Note: ADC channel number masked with value "0x1F" to ensure shift value within 32 bits range */
-    if (pConfigInjected->InjectedSingleDiff == ADC_DIFFERENTIAL_ENDED)
+    /* Temporary handle minimum initialization */
+    __HAL_ADC_RESET_HANDLE_STATE(&tmp_hadc_slave);
+    ADC_CLEAR_ERRORCODE(&tmp_hadc_slave);
+
+    /* Set a temporary handle of the ADC slave associated to the ADC master   */
+    ADC_MULTI_SLAVE(hadc, &tmp_hadc_slave);
+
+    if (tmp_hadc_slave.Instance == NULL)
     {
-      /* Set sampling time of the selected ADC channel */
-      LL_ADC_SetChannelSamplingTime(hadc->Instance,
-                                    (uint32_t)(__LL_ADC_DECIMAL_NB_TO_CHANNEL(
-                                                 (__LL_ADC_CHANNEL_TO_DECIMAL_NB(
-                                                    (uint32_t)pConfigInjected->InjectedChannel)
-                                                  + 1UL) & 0x1FUL)),
-                                    pConfigInjected->InjectedSamplingTime);
-    }
+      /* Update ADC state machine to error */
+      SET_BIT(hadc->State, HAL_ADC_STATE_ERROR_CONFIG);
 
-  }
+      /* Process unlocked */
+      __HAL_UNLOCK(hadc);
 
-  /* Management of internal measurement channels: Vbat/VrefInt/TempSensor   */
-  /* internal measurement paths enable: If internal channel selected,       */
-  /* enable dedicated internal buffers and path.                            */
-  /* Note: these internal measurement paths can be disabled using           */
-  /* HAL_ADC_DeInit().                                                      */
+      return HAL_ERROR;
+    }
 
-  if (__LL_ADC_IS_CHANNEL_INTERNAL(pConfigInjected->InjectedChannel))
-  {
-    tmp_config_internal_channel = LL_ADC_GetCommonPathInternalCh(__LL_ADC_COMMON_INSTANCE(hadc->Instance));
+    /* Procedure to disable the ADC peripheral: wait for conversions          */
+    /* effectively stopped (ADC master and ADC slave), then disable ADC       */
 
-    /* If the requested internal measurement path has already been enabled,   */
-    /* bypass the configuration processing.                                   */
-    if ((pConfigInjected->InjectedChannel == ADC_CHANNEL_TEMPSENSOR)
-        && ((tmp_config_internal_channel & LL_ADC_PATH_INTERNAL_TEMPSENSOR) == 0UL))
+    /* 1. Wait for ADC conversion completion for ADC master and ADC slave */
+    tickstart = HAL_GetTick();
+
+    tmp_hadc_slave_conversion_on_going = LL_ADC_REG_IsConversionOngoing((&tmp_hadc_slave)->Instance);
+    while ((LL_ADC_REG_IsConversionOngoing(hadc->Instance) == 1UL)
+           || (tmp_hadc_slave_conversion_on_going == 1UL)
+          )
     {
-      if (ADC_TEMPERATURE_SENSOR_INSTANCE(hadc))
+      if ((HAL_GetTick() - tickstart) > ADC_STOP_CONVERSION_TIMEOUT)
       {
-        LL_ADC_SetCommonPathInternalCh(__LL_ADC_COMMON_INSTANCE(hadc->Instance),
-                                       LL_ADC_PATH_INTERNAL_TEMPSENSOR | tmp_config_internal_channel);
-
-        /* Delay for temperature sensor stabilization time */
-        /* Wait loop initialization and execution */
-        /* Note: Variable divided by 2 to compensate partially              */
-        /*       CPU processing cycles, scaling in us split to not          */
-        /*       exceed 32 bits register capacity and handle low frequency. */
-        wait_loop_index = ((LL_ADC_DELAY_TEMPSENSOR_STAB_US / 10UL)
-                           * (((SystemCoreClock / (100000UL * 2UL)) + 1UL) + 1UL));
-        while (wait_loop_index != 0UL)
+        /* New check to avoid false timeout detection in case of preemption */
+        tmp_hadc_slave_conversion_on_going = LL_ADC_REG_IsConversionOngoing((&tmp_hadc_slave)->Instance);
+        if ((LL_ADC_REG_IsConversionOngoing(hadc->Instance) == 1UL)
+            || (tmp_hadc_slave_conversion_on_going == 1UL)
+           )
         {
-          wait_loop_index--;
+          /* Update ADC state machine to error */
+          SET_BIT(hadc->State, HAL_ADC_STATE_ERROR_INTERNAL);
+
+          /* Process unlocked */
+          __HAL_UNLOCK(hadc);
+
+          return HAL_ERROR;
         }
       }
+
+      tmp_hadc_slave_conversion_on_going = LL_ADC_REG_IsConversionOngoing((&tmp_hadc_slave)->Instance);
     }
-#if defined(ADC3)
-    else if (((pConfigInjected->InjectedChannel == ADC_CHANNEL_VBAT)
-              || (pConfigInjected->InjectedChannel == ADC_CHANNEL_VBAT_ADC3))
-             && ((tmp_config_internal_channel & LL_ADC_PATH_INTERNAL_VBAT) == 0UL))
-#else
-    else if ((pConfigInjected->InjectedChannel == ADC_CHANNEL_VBAT)
-             && ((tmp_config_internal_channel & LL_ADC_PATH_INTERNAL_VBAT) == 0UL))
-#endif /* ADC3 */
+
+    /* Disable the DMA channel (in case of DMA in circular mode or stop       */
+    /* while DMA transfer is on going)                                        */
+    /* Note: DMA channel of ADC slave should be stopped after this function   */
+    /* with HAL_ADCEx_RegularStop_DMA() API.                                  */
+    tmp_hal_status = HAL_DMA_Abort(hadc->DMA_Handle);
+
+    /* Check if DMA channel effectively disabled */
+    if (tmp_hal_status != HAL_OK)
     {
-      if (ADC_BATTERY_VOLTAGE_INSTANCE(hadc))
-      {
-        LL_ADC_SetCommonPathInternalCh(__LL_ADC_COMMON_INSTANCE(hadc->Instance),
-                                       LL_ADC_PATH_INTERNAL_VBAT | tmp_config_internal_channel);
-      }
+      /* Update ADC state machine to error */
+      SET_BIT(hadc->State, HAL_ADC_STATE_ERROR_DMA);
     }
-    else if ((pConfigInjected->InjectedChannel == ADC_CHANNEL_VREFINT)
-             && ((tmp_config_internal_channel & LL_ADC_PATH_INTERNAL_VREFINT) == 0UL))
+
+    /* Disable ADC overrun interrupt */
+    __HAL_ADC_DISABLE_IT(hadc, ADC_IT_OVR);
+
+    /* 2. Disable the ADC peripherals: master and slave if no injected        */
+    /*   conversion is on-going.                                              */
+    /* Update "tmp_hal_status" only if DMA channel disabling passed, to keep in */
+    /* memory a potential failing status.                                     */
+    if (tmp_hal_status == HAL_OK)
     {
-      if (ADC_VREFINT_INSTANCE(hadc))
+      if (LL_ADC_INJ_IsConversionOngoing(hadc->Instance) == 0UL)
       {
-        LL_ADC_SetCommonPathInternalCh(__LL_ADC_COMMON_INSTANCE(hadc->Instance),
-                                       LL_ADC_PATH_INTERNAL_VREFINT | tmp_config_internal_channel);
+        tmp_hal_status =  ADC_Disable(hadc);
+        if (tmp_hal_status == HAL_OK)
+        {
+          if (LL_ADC_INJ_IsConversionOngoing((&tmp_hadc_slave)->Instance) == 0UL)
+          {
+            tmp_hal_status =  ADC_Disable(&tmp_hadc_slave);
+          }
+        }
       }
-    }
-    else if (pConfigInjected->InjectedChannel == ADC_CHANNEL_VDDCORE)
-    {
-      if (ADC_VDDCORE_INSTANCE(hadc))
+
+      if (tmp_hal_status == HAL_OK)
       {
-        LL_ADC_EnableChannelVDDcore(hadc->Instance);
+        /* Both Master and Slave ADC's could be disabled. Update Master State */
+        /* Clear HAL_ADC_STATE_INJ_BUSY bit, set HAL_ADC_STATE_READY bit */
+        ADC_STATE_CLR_SET(hadc->State, HAL_ADC_STATE_INJ_BUSY, HAL_ADC_STATE_READY);
+      }
+      else
+      {
+        /* injected (Master or Slave) conversions are still on-going,
+           no Master State change */
       }
-    }
-    else
-    {
-      /* nothing to do */
     }
   }
 
@@ -2174,287 +2103,1450 @@ HAL_StatusTypeDef HAL_ADCEx_InjectedConfigChannel(ADC_HandleTypeDef *hadc,
   /* Return function status */
   return tmp_hal_status;
 }
+#endif /* ADC_MULTIMODE_SUPPORT */
 
-#if defined(ADC_MULTIMODE_SUPPORT)
 /**
-  * @brief  Enable ADC multimode and configure multimode parameters
+  * @}
+  */
+
+/** @defgroup ADCEx_Exported_Functions_Group2 ADC Extended Peripheral Control functions
+  * @brief    ADC Extended Peripheral Control functions
+  *
+@verbatim
+ ===============================================================================
+             ##### Peripheral Control functions #####
+ ===============================================================================
+    [..]  This section provides functions allowing to:
+      (+) Configure channels on injected group
+      (+) Configure multimode when multimode feature is available
+      (+) Enable or Disable Injected Queue
+      (+) Disable ADC voltage regulator
+      (+) Enter ADC deep-power-down mode
+      (+) Compute and apply an acquisition profile (oversampling and sampling time
+          from a target resolution and output data rate)
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Configure a channel to be assigned to ADC group injected.
   * @note   Possibility to update parameters on the fly:
-  *         This function initializes multimode parameters, following
-  *         calls to this function can be used to reconfigure some parameters
-  *         of structure "ADC_MultiModeTypeDef" on the fly, without resetting
-  *         the ADCs.
-  *         The setting of these parameters is conditioned to ADC state.
-  *         For parameters constraints, see comments of structure
-  *         "ADC_MultiModeTypeDef".
-  * @note   To move back configuration from multimode to single mode, ADC must
-  *         be reset (using function HAL_ADC_Init() ).
+  *         This function initializes injected group, following calls to this
+  *         function can be used to reconfigure some parameters of structure
+  *         "ADC_InjectionConfTypeDef" on the fly, without resetting the ADC.
+  *         The setting of these parameters is conditioned to ADC state:
+  *         Refer to comments of structure "ADC_InjectionConfTypeDef".
+  * @note   In case of usage of internal measurement channels:
+  *         Vbat/VrefInt/TempSensor.
+  *         These internal paths can be disabled using function
+  *         HAL_ADC_DeInit().
+  * @note   Caution: For Injected Context Queue use, a context must be fully
+  *         defined before start of injected conversion. All channels are configured
+  *         consecutively for the same ADC instance. Therefore, the number of calls to
+  *         HAL_ADCEx_InjectedConfigChannel() must be equal to the value of parameter
+  *         InjectedNbrOfConversion for each context.
+  *  - Example 1: If 1 context is intended to be used (or if there is no use of the
+  *    Injected Queue Context feature) and if the context contains 3 injected ranks
+  *    (InjectedNbrOfConversion = 3), HAL_ADCEx_InjectedConfigChannel() must be
+  *    called once for each channel (i.e. 3 times) before starting a conversion.
+  *    This function must not be called to configure a 4th injected channel:
+  *    it would start a new context into context queue.
+  *  - Example 2: If 2 contexts are intended to be used and each of them contains
+  *    3 injected ranks (InjectedNbrOfConversion = 3),
+  *    HAL_ADCEx_InjectedConfigChannel() must be called once for each channel and
+  *    for each context (3 channels x 2 contexts = 6 calls). Conversion can
+  *    start once the 1st context is set, that is after the first three
+  *    HAL_ADCEx_InjectedConfigChannel() calls. The 2nd context can be set on the fly.
+  * @param hadc ADC handle
+  * @param pConfigInjected Structure of ADC injected group and ADC channel for
+  *         injected group.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ADCEx_InjectedConfigChannel(ADC_HandleTypeDef *hadc,
+                                                  const ADC_InjectionConfTypeDef *pConfigInjected)
+{
+  HAL_StatusTypeDef tmp_hal_status = HAL_OK;
+  uint32_t tmp_offset_shifted;
+  uint32_t tmp_config_internal_channel;
+  uint32_t tmp_adc_is_conversion_on_going_regular;
+  uint32_t tmp_adc_is_conversion_on_going_injected;
+  __IO uint32_t wait_loop_index = 0;
+
+  uint32_t tmp_jsqr_context_queue_being_built = 0U;
+
+  /* Check the parameters */
+  assert_param(IS_ADC_ALL_INSTANCE(hadc->Instance));
+  assert_param(IS_ADC_SAMPLE_TIME(pConfigInjected->InjectedSamplingTime));
+  assert_param(IS_ADC_SINGLE_DIFFERENTIAL(pConfigInjected->InjectedSingleDiff));
+  assert_param(IS_FUNCTIONAL_STATE(pConfigInjected->AutoInjectedConv));
+  assert_param(IS_FUNCTIONAL_STATE(pConfigInjected->QueueInjectedContext));
+  assert_param(IS_ADC_EXTTRIGINJEC_EDGE(pConfigInjected->ExternalTrigInjecConvEdge));
+  assert_param(IS_ADC_EXTTRIGINJEC(pConfigInjected->ExternalTrigInjecConv));
+  assert_param(IS_ADC_OFFSET_NUMBER(pConfigInjected->InjectedOffsetNumber));
+  assert_param(IS_ADC_RANGE(ADC_GET_RESOLUTION(hadc), pConfigInjected->InjectedOffset));
+  assert_param(IS_ADC_OFFSET_SIGN(pConfigInjected->InjectedOffsetSign));
+  assert_param(IS_FUNCTIONAL_STATE(pConfigInjected->InjectedOffsetSaturation));
+  assert_param(IS_FUNCTIONAL_STATE(pConfigInjected->InjecOversamplingMode));
+
+  if (hadc->Init.ScanConvMode != ADC_SCAN_DISABLE)
+  {
+    assert_param(IS_ADC_INJECTED_RANK(pConfigInjected->InjectedRank));
+    assert_param(IS_ADC_INJECTED_NB_CONV(pConfigInjected->InjectedNbrOfConversion));
+    assert_param(IS_FUNCTIONAL_STATE(pConfigInjected->InjectedDiscontinuousConvMode));
+  }
+
+
+  /* if JOVSE is set, the value of the OFFSETy_EN bit in ADCx_OFRy register is
+     ignored (considered as reset) */
+  assert_param(!((pConfigInjected->InjectedOffsetNumber != ADC_OFFSET_NONE)
+                 && (pConfigInjected->InjecOversamplingMode == ENABLE)));
+
+  /* JDISCEN and JAUTO bits can't be set at the same time  */
+  assert_param(!((pConfigInjected->InjectedDiscontinuousConvMode == ENABLE)
+                 && (pConfigInjected->AutoInjectedConv == ENABLE)));
+
+  /*  DISCEN and JAUTO bits can't be set at the same time */
+  assert_param(!((hadc->Init.DiscontinuousConvMode == ENABLE) && (pConfigInjected->AutoInjectedConv == ENABLE)));
+
+  /* Verification of channel number */
+  if (pConfigInjected->InjectedSingleDiff != ADC_DIFFERENTIAL_ENDED)
+  {
+    assert_param(IS_ADC_CHANNEL(hadc, pConfigInjected->InjectedChannel));
+  }
+  else
+  {
+    assert_param(IS_ADC_DIFF_CHANNEL(hadc, pConfigInjected->InjectedChannel));
+  }
+
+  /* Process locked */
+  __HAL_LOCK(hadc);
+
+  /* Configuration of injected group sequencer:                               */
+  /* Hardware constraint: Must fully define injected context register JSQR    */
+  /* before make it entering into injected sequencer queue.                   */
+  /*                                                                          */
+  /* - if scan mode is disabled:                                              */
+  /*    * Injected channels sequence length is set to 0x00: 1 channel         */
+  /*      converted (channel on injected rank 1)                              */
+  /*      Parameter "InjectedNbrOfConversion" is discarded.                   */
+  /*    * Injected context register JSQR setting is simple: register is fully */
+  /*      defined on one call of this function (for injected rank 1) and can  */
+  /*      be entered into queue directly.                                     */
+  /* - if scan mode is enabled:                                               */
+  /*    * Injected channels sequence length is set to parameter               */
+  /*      "InjectedNbrOfConversion".                                          */
+  /*    * Injected context register JSQR setting more complex: register is    */
+  /*      fully defined over successive calls of this function, for each      */
+  /*      injected channel rank. It is entered into queue only when all       */
+  /*      injected ranks have been set.                                       */
+  /*   Note: Scan mode is not present by hardware on this device, but used    */
+  /*   by software for alignment over all STM32 devices.                      */
+
+  if ((hadc->Init.ScanConvMode == ADC_SCAN_DISABLE)  ||
+      (pConfigInjected->InjectedNbrOfConversion == 1U))
+  {
+    /* Configuration of context register JSQR:                                */
+    /*  - number of ranks in injected group sequencer: fixed to 1st rank      */
+    /*    (scan mode disabled, only rank 1 used)                              */
+    /*  - external trigger to start conversion                                */
+    /*  - external trigger polarity                                           */
+    /*  - channel set to rank 1 (scan mode disabled, only rank 1 can be used) */
+
+    if (pConfigInjected->InjectedRank == ADC_INJECTED_RANK_1)
+    {
+      /* Enable external trigger if trigger selection is different of         */
+      /* software start.                                                      */
+      /* Note: This configuration keeps the hardware feature of parameter     */
+      /*       ExternalTrigInjecConvEdge "trigger edge none" equivalent to    */
+      /*       software start.                                                */
+      if (pConfigInjected->ExternalTrigInjecConv != ADC_INJECTED_SOFTWARE_START)
+      {
+        tmp_jsqr_context_queue_being_built = (ADC_JSQR_RK(pConfigInjected->InjectedChannel, ADC_INJECTED_RANK_1)
+                                              | (pConfigInjected->ExternalTrigInjecConv & ADC_JSQR_JEXTSEL)
+                                              | pConfigInjected->ExternalTrigInjecConvEdge
+                                             );
+      }
+      else
+      {
+        tmp_jsqr_context_queue_being_built = (ADC_JSQR_RK(pConfigInjected->InjectedChannel, ADC_INJECTED_RANK_1));
+      }
+
+      MODIFY_REG(hadc->Instance->JSQR, ADC_JSQR_FIELDS, tmp_jsqr_context_queue_being_built);
+      /* For debug and informative reasons, hadc handle saves JSQR setting */
+      hadc->InjectionConfig.ContextQueue = tmp_jsqr_context_queue_being_built;
+
+    }
+  }
+  else
+  {
+    /* Case of scan mode enabled, several channels to set into injected group */
+    /* sequencer.                                                             */
+    /*                                                                        */
+    /* Procedure to define injected context register JSQR over successive     */
+    /* calls of this function, for each injected channel rank:                */
+    /* 1. Start new context and set parameters related to all injected        */
+    /*    channels: injected sequence length and trigger.                     */
+
+    /* if hadc->InjectionConfig.ChannelCount is equal to 0, this is the first */
+    /*   call of the context under setting                                    */
+    if (hadc->InjectionConfig.ChannelCount == 0U)
+    {
+      /* Initialize number of channels that will be configured on the context */
+      /*  being built                                                         */
+      hadc->InjectionConfig.ChannelCount = pConfigInjected->InjectedNbrOfConversion;
+      /* Handle hadc saves the context under build up over each HAL_ADCEx_InjectedConfigChannel()
+         call, this context will be written in JSQR register at the last call.
+         At this point, the context is merely reset  */
+      hadc->InjectionConfig.ContextQueue = 0x00000000U;
+
+      /* Configuration of context register JSQR:                              */
+      /*  - number of ranks in injected group sequencer                       */
+      /*  - external trigger to start conversion                              */
+      /*  - external trigger polarity                                         */
+
+      /* Enable external trigger if trigger selection is different of         */
+      /* software start.                                                      */
+      /* Note: This configuration keeps the hardware feature of parameter     */
+      /*       ExternalTrigInjecConvEdge "trigger edge none" equivalent to    */
+      /*       software start.                                                */
+      if (pConfigInjected->ExternalTrigInjecConv != ADC_INJECTED_SOFTWARE_START)
+      {
+        tmp_jsqr_context_queue_being_built = ((pConfigInjected->InjectedNbrOfConversion - 1U)
+                                              | (pConfigInjected->ExternalTrigInjecConv & ADC_JSQR_JEXTSEL)
+                                              | pConfigInjected->ExternalTrigInjecConvEdge
+                                             );
+      }
+      else
+      {
+        tmp_jsqr_context_queue_being_built = ((pConfigInjected->InjectedNbrOfConversion - 1U));
+      }
+
+    }
+
+    /* 2. Continue setting of context under definition with parameter       */
+    /*    related to each channel: channel rank sequence                    */
+    /* Clear the old JSQx bits for the selected rank */
+    tmp_jsqr_context_queue_being_built &= ~ADC_JSQR_RK(ADC_SQR3_SQ10, pConfigInjected->InjectedRank);
+
+    /* Set the JSQx bits for the selected rank */
+    tmp_jsqr_context_queue_being_built |= ADC_JSQR_RK(pConfigInjected->InjectedChannel, pConfigInjected->InjectedRank);
+
+    /* Decrease channel count  */
+    hadc->InjectionConfig.ChannelCount--;
+
+    /* 3. tmp_jsqr_context_queue_being_built is fully built for this HAL_ADCEx_InjectedConfigChannel()
+          call, aggregate the setting to those already built during the previous
+          HAL_ADCEx_InjectedConfigChannel() calls (for the same context of course)  */
+    hadc->InjectionConfig.ContextQueue |= tmp_jsqr_context_queue_being_built;
+
+    /* 4. End of context setting: if this is the last channel set, then write context
+        into register JSQR and make it enter into queue                   */
+    if (hadc->InjectionConfig.ChannelCount == 0U)
+    {
+      MODIFY_REG(hadc->Instance->JSQR, ADC_JSQR_FIELDS, hadc->InjectionConfig.ContextQueue);
+    }
+  }
+
+  /* Parameters update conditioned to ADC state:                              */
+  /* Parameters that can be updated when ADC is disabled or enabled without   */
+  /* conversion on going on injected group:                                   */
+  /*  - Injected context queue: Queue disable (active context is kept) or     */
+  /*    enable (context decremented, up to 2 contexts queued)                 */
+  /*  - Injected discontinuous mode: can be enabled only if auto-injected     */
+  /*    mode is disabled.                                                     */
+  if (LL_ADC_INJ_IsConversionOngoing(hadc->Instance) == 0UL)
+  {
+    if ((pConfigInjected->InjectedChannel == ADC_CHANNEL_0)
+        || ((pConfigInjected->InjectedChannel == ADC_CHANNEL_1)
+            && (pConfigInjected->InjectedSingleDiff == ADC_DIFFERENTIAL_ENDED))
+       )
+    {
+      LL_ADC_EnableChannel0_GPIO(hadc->Instance);
+    }
+    /* If auto-injected mode is disabled: no constraint                       */
+    if (pConfigInjected->AutoInjectedConv == DISABLE)
+    {
+      MODIFY_REG(hadc->Instance->CFGR,
+                 ADC_CFGR_JQM | ADC_CFGR_JDISCEN,
+                 ADC_CFGR_INJECT_CONTEXT_QUEUE((uint32_t)pConfigInjected->QueueInjectedContext)           |
+                 ADC_CFGR_INJECT_DISCCONTINUOUS((uint32_t)pConfigInjected->InjectedDiscontinuousConvMode));
+    }
+    /* If auto-injected mode is enabled: Injected discontinuous setting is    */
+    /* discarded.                                                             */
+    else
+    {
+      MODIFY_REG(hadc->Instance->CFGR,
+                 ADC_CFGR_JQM | ADC_CFGR_JDISCEN,
+                 ADC_CFGR_INJECT_CONTEXT_QUEUE((uint32_t)pConfigInjected->QueueInjectedContext));
+    }
+
+  }
+
+  /* Parameters update conditioned to ADC state:                              */
+  /* Parameters that can be updated when ADC is disabled or enabled without   */
+  /* conversion on going on regular and injected groups:                      */
+  /*  - Automatic injected conversion: can be enabled if injected group       */
+  /*    external triggers are disabled.                                       */
+  /*  - Channel sampling time                                                 */
+  /*  - Channel offset                                                        */
+  tmp_adc_is_conversion_on_going_regular = LL_ADC_REG_IsConversionOngoing(hadc->Instance);
+  tmp_adc_is_conversion_on_going_injected = LL_ADC_INJ_IsConversionOngoing(hadc->Instance);
+
+  if ((tmp_adc_is_conversion_on_going_regular == 0UL)
+      && (tmp_adc_is_conversion_on_going_injected == 0UL)
+     )
+  {
+    /* If injected group external triggers are disabled (set to injected      */
+    /* software start): no constraint                                         */
+    if ((pConfigInjected->ExternalTrigInjecConv == ADC_INJECTED_SOFTWARE_START)
+        || (pConfigInjected->ExternalTrigInjecConvEdge == ADC_EXTERNALTRIGINJECCONV_EDGE_NONE))
+    {
+      if (pConfigInjected->AutoInjectedConv == ENABLE)
+      {
+        SET_BIT(hadc->Instance->CFGR, ADC_CFGR_JAUTO);
+      }
+      else
+      {
+        CLEAR_BIT(hadc->Instance->CFGR, ADC_CFGR_JAUTO);
+      }
+    }
+    /* If Automatic injected conversion was intended to be set and could not  */
+    /* due to injected group external triggers enabled, error is reported.    */
+    else
+    {
+      if (pConfigInjected->AutoInjectedConv == ENABLE)
+      {
+        /* Update ADC state machine to error */
+        SET_BIT(hadc->State, HAL_ADC_STATE_ERROR_CONFIG);
+
+        tmp_hal_status = HAL_ERROR;
+      }
+      else
+      {
+        CLEAR_BIT(hadc->Instance->CFGR, ADC_CFGR_JAUTO);
+      }
+    }
+
+    if (pConfigInjected->InjecOversamplingMode == ENABLE)
+    {
+      assert_param(IS_ADC_OVERSAMPLING_RATIO(pConfigInjected->InjecOversampling.Ratio));
+      assert_param(IS_ADC_RIGHT_BIT_SHIFT(pConfigInjected->InjecOversampling.RightBitShift));
+
+      /*  JOVSE must be reset in case of triggered regular mode  */
+      assert_param(!(READ_BIT(hadc->Instance->CFGR2, ADC_CFGR2_ROVSE | ADC_CFGR2_TROVS)
+                     == (ADC_CFGR2_ROVSE | ADC_CFGR2_TROVS)));
+
+      /* Configuration of Injected Oversampler:                                 */
+      /*  - Oversampling Ratio                                                  */
+      /*  - Right bit shift                                                     */
+
+      /* Enable OverSampling mode */
+      MODIFY_REG(hadc->Instance->CFGR2,
+                 ADC_CFGR2_JOVSE |
+                 ADC_CFGR2_OVSR  |
+                 ADC_CFGR2_OVSS,
+                 ADC_CFGR2_JOVSE                                  |
+                 pConfigInjected->InjecOversampling.Ratio         |
+                 pConfigInjected->InjecOversampling.RightBitShift
+                );
+    }
+    else
+    {
+      /* Disable Regular OverSampling */
+      CLEAR_BIT(hadc->Instance->CFGR2, ADC_CFGR2_JOVSE);
+    }
+
+    /* Manage specific case of sampling time 3.5 cycles replacing 2.5 cyles */
+    if (pConfigInjected->InjectedSamplingTime == ADC_SAMPLETIME_3CYCLES_5)
+    {
+      /* Set sampling time of the selected ADC channel */
+      LL_ADC_SetChannelSamplingTime(hadc->Instance, pConfigInjected->InjectedChannel, LL_ADC_SAMPLINGTIME_2CYCLES_5);
+
+      /* Set ADC sampling time common configuration */
+      LL_ADC_SetSamplingTimeCommonConfig(hadc->Instance, LL_ADC_SAMPLINGTIME_COMMON_3C5_REPL_2C5);
+    }
+    else
+    {
+      /* Set sampling time of the selected ADC channel */
+      LL_ADC_SetChannelSamplingTime(hadc->Instance, pConfigInjected->InjectedChannel,
+                                    pConfigInjected->InjectedSamplingTime);
+
+      /* Set ADC sampling time common configuration */
+      LL_ADC_SetSamplingTimeCommonConfig(hadc->Instance, LL_ADC_SAMPLINGTIME_COMMON_DEFAULT);
+    }
+
+    /* Configure the offset: offset enable/disable, channel, offset value */
+
+    /* Shift the offset with respect to the selected ADC resolution. */
+    /* Offset has to be left-aligned on bit 11, the LSB (right bits) are set to 0 */
+    tmp_offset_shifted = ADC_OFFSET_SHIFT_RESOLUTION(hadc, pConfigInjected->InjectedOffset);
+
+    if (pConfigInjected->InjectedOffsetNumber != ADC_OFFSET_NONE)
+    {
+      /* Set ADC selected offset number */
+      LL_ADC_SetOffset(hadc->Instance, pConfigInjected->InjectedOffsetNumber, pConfigInjected->InjectedChannel,
+                       tmp_offset_shifted);
+
+      /* Set ADC selected offset sign & saturation */
+      LL_ADC_SetOffsetSign(hadc->Instance, pConfigInjected->InjectedOffsetNumber, pConfigInjected->InjectedOffsetSign);
+      LL_ADC_SetOffsetSaturation(hadc->Instance, pConfigInjected->InjectedOffsetNumber,
+                                 (pConfigInjected->InjectedOffsetSaturation == ENABLE) ?
+                                 LL_ADC_OFFSET_SATURATION_ENABLE : LL_ADC_OFFSET_SATURATION_DISABLE);
+    }
+    else
+    {
+      /* Scan each offset register to check if the selected channel is targeted. */
+      /* If this is the case, the corresponding offset number is disabled.       */
+      if (__LL_ADC_CHANNEL_TO_DECIMAL_NB(LL_ADC_GetOffsetChannel(hadc->Instance, LL_ADC_OFFSET_1))
+          == __LL_ADC_CHANNEL_TO_DECIMAL_NB(pConfigInjected->InjectedChannel))
+      {
+        LL_ADC_SetOffsetState(hadc->Instance, LL_ADC_OFFSET_1, LL_ADC_OFFSET_DISABLE);
+      }
+      if (__LL_ADC_CHANNEL_TO_DECIMAL_NB(LL_ADC_GetOffsetChannel(hadc->Instance, LL_ADC_OFFSET_2))
+          == __LL_ADC_CHANNEL_TO_DECIMAL_NB(pConfigInjected->InjectedChannel))
+      {
+        LL_ADC_SetOffsetState(hadc->Instance, LL_ADC_OFFSET_2, LL_ADC_OFFSET_DISABLE);
+      }
+      if (__LL_ADC_CHANNEL_TO_DECIMAL_NB(LL_ADC_GetOffsetChannel(hadc->Instance, LL_ADC_OFFSET_3))
+          == __LL_ADC_CHANNEL_TO_DECIMAL_NB(pConfigInjected->InjectedChannel))
+      {
+        LL_ADC_SetOffsetState(hadc->Instance, LL_ADC_OFFSET_3, LL_ADC_OFFSET_DISABLE);
+      }
+      if (__LL_ADC_CHANNEL_TO_DECIMAL_NB(LL_ADC_GetOffsetChannel(hadc->Instance, LL_ADC_OFFSET_4))
+          == __LL_ADC_CHANNEL_TO_DECIMAL_NB(pConfigInjected->InjectedChannel))
+      {
+        LL_ADC_SetOffsetState(hadc->Instance, LL_ADC_OFFSET_4, LL_ADC_OFFSET_DISABLE);
+      }
+    }
+
+  }
+
+  /* Parameters update conditioned to ADC state:                              */
+  /* Parameters that can be updated only when ADC is disabled:                */
+  /*  - Single or differential mode                                           */
+  if (LL_ADC_IsEnabled(hadc->Instance) == 0UL)
+  {
+    /* Set mode single-ended or differential input of the selected ADC channel */
+    LL_ADC_SetChannelSingleDiff(hadc->Instance, pConfigInjected->InjectedChannel, pConfigInjected->InjectedSingleDiff);
+
+    /* Configuration of differential mode */
+    /* Note: ADC channel number masked with value "0x1F" to ensure shift value within 32 bits range */
+    if (pConfigInjected->InjectedSingleDiff == ADC_DIFFERENTIAL_ENDED)
+    {
+      /* Set sampling time of the selected ADC channel */
+      LL_ADC_SetChannelSamplingTime(hadc->Instance,
+                                    (uint32_t)(__LL_ADC_DECIMAL_NB_TO_CHANNEL(
+                                                 (__LL_ADC_CHANNEL_TO_DECIMAL_NB(
+                                                    (uint32_t)pConfigInjected->InjectedChannel)
+                                                  + 1UL) & 0x1FUL)),
+                                    pConfigInjected->InjectedSamplingTime);
+    }
+
+  }
+
+  /* Management of internal measurement channels: Vbat/VrefInt/TempSensor   */
+  /* internal measurement paths enable: If internal channel selected,       */
+  /* enable dedicated internal buffers and path.                            */
+  /* Note: these internal measurement paths can be disabled using           */
+  /* HAL_ADC_DeInit().                                                      */
+
+  if (__LL_ADC_IS_CHANNEL_INTERNAL(pConfigInjected->InjectedChannel))
+  {
+    tmp_config_internal_channel = LL_ADC_GetCommonPathInternalCh(__LL_ADC_COMMON_INSTANCE(hadc->Instance));
+
+    /* If the requested internal measurement path has already been enabled,   */
+    /* bypass the configuration processing.                                   */
+    if ((pConfigInjected->InjectedChannel == ADC_CHANNEL_TEMPSENSOR)
+        && ((tmp_config_internal_channel & LL_ADC_PATH_INTERNAL_TEMPSENSOR) == 0UL))
+    {
+      if (ADC_TEMPERATURE_SENSOR_INSTANCE(hadc))
+      {
+        LL_ADC_SetCommonPathInternalCh(__LL_ADC_COMMON_INSTANCE(hadc->Instance),
+                                       LL_ADC_PATH_INTERNAL_TEMPSENSOR | tmp_config_internal_channel);
+
+        /* Delay for temperature sensor stabilization time */
+        /* Wait loop initialization and execution */
+        /* Note: Variable divided by 2 to compensate partially              */
+        /*       CPU processing cycles, scaling in us split to not          */
+        /*       exceed 32 bits register capacity and handle low frequency. */
+        wait_loop_index = ((LL_ADC_DELAY_TEMPSENSOR_STAB_US / 10UL)
+                           * (((SystemCoreClock / (100000UL * 2UL)) + 1UL) + 1UL));
+        while (wait_loop_index != 0UL)
+        {
+          wait_loop_index--;
+        }
+      }
+    }
+#if defined(ADC3)
+    else if (((pConfigInjected->InjectedChannel == ADC_CHANNEL_VBAT)
+              || (pConfigInjected->InjectedChannel == ADC_CHANNEL_VBAT_ADC3))
+             && ((tmp_config_internal_channel & LL_ADC_PATH_INTERNAL_VBAT) == 0UL))
+#else
+    else if ((pConfigInjected->InjectedChannel == ADC_CHANNEL_VBAT)
+             && ((tmp_config_internal_channel & LL_ADC_PATH_INTERNAL_VBAT) == 0UL))
+#endif /* ADC3 */
+    {
+      if (ADC_BATTERY_VOLTAGE_INSTANCE(hadc))
+      {
+        LL_ADC_SetCommonPathInternalCh(__LL_ADC_COMMON_INSTANCE(hadc->Instance),
+                                       LL_ADC_PATH_INTERNAL_VBAT | tmp_config_internal_channel);
+      }
+    }
+    else if ((pConfigInjected->InjectedChannel == ADC_CHANNEL_VREFINT)
+             && ((tmp_config_internal_channel & LL_ADC_PATH_INTERNAL_VREFINT) == 0UL))
+    {
+      if (ADC_VREFINT_INSTANCE(hadc))
+      {
+        LL_ADC_SetCommonPathInternalCh(__LL_ADC_COMMON_INSTANCE(hadc->Instance),
+                                       LL_ADC_PATH_INTERNAL_VREFINT | tmp_config_internal_channel);
+      }
+    }
+    else if (pConfigInjected->InjectedChannel == ADC_CHANNEL_VDDCORE)
+    {
+      if (ADC_VDDCORE_INSTANCE(hadc))
+      {
+        LL_ADC_EnableChannelVDDcore(hadc->Instance);
+      }
+    }
+    else
+    {
+      /* nothing to do */
+    }
+  }
+
+  /* Process unlocked */
+  __HAL_UNLOCK(hadc);
+
+  /* Return function status */
+  return tmp_hal_status;
+}
+
+#if defined(ADC_MULTIMODE_SUPPORT)
+/**
+  * @brief  Enable ADC multimode and configure multimode parameters
+  * @note   Possibility to update parameters on the fly:
+  *         This function initializes multimode parameters, following
+  *         calls to this function can be used to reconfigure some parameters
+  *         of structure "ADC_MultiModeTypeDef" on the fly, without resetting
+  *         the ADCs.
+  *         The setting of these parameters is conditioned to ADC state.
+  *         For parameters constraints, see comments of structure
+  *         "ADC_MultiModeTypeDef".
+  * @note   To move back configuration from multimode to single mode, ADC must
+  *         be reset (using function HAL_ADC_Init() ).
   * @param hadc Master ADC handle
   * @param pMultimode Structure of ADC multimode configuration
   * @retval HAL status
   */
-HAL_StatusTypeDef HAL_ADCEx_MultiModeConfigChannel(ADC_HandleTypeDef *hadc, const ADC_MultiModeTypeDef *pMultimode)
+HAL_StatusTypeDef HAL_ADCEx_MultiModeConfigChannel(ADC_HandleTypeDef *hadc, const ADC_MultiModeTypeDef *pMultimode)
+{
+  HAL_StatusTypeDef tmp_hal_status = HAL_OK;
+  ADC_Common_TypeDef *tmpADC_Common;
+  ADC_HandleTypeDef tmp_hadc_slave;
+  uint32_t tmp_hadc_slave_conversion_on_going;
+
+  /* Check the parameters */
+  assert_param(IS_ADC_MULTIMODE_MASTER_INSTANCE(hadc->Instance));
+  assert_param(IS_ADC_MULTIMODE(pMultimode->Mode));
+  if (pMultimode->Mode != ADC_MODE_INDEPENDENT)
+  {
+    assert_param(IS_ADC_DMA_ACCESS_MULTIMODE(pMultimode->DMAAccessMode));
+    assert_param(IS_ADC_SAMPLING_DELAY(pMultimode->TwoSamplingDelay));
+  }
+
+  /* Process locked */
+  __HAL_LOCK(hadc);
+
+  /* Temporary handle minimum initialization */
+  __HAL_ADC_RESET_HANDLE_STATE(&tmp_hadc_slave);
+  ADC_CLEAR_ERRORCODE(&tmp_hadc_slave);
+
+  ADC_MULTI_SLAVE(hadc, &tmp_hadc_slave);
+
+  if (tmp_hadc_slave.Instance == NULL)
+  {
+    /* Update ADC state machine to error */
+    SET_BIT(hadc->State, HAL_ADC_STATE_ERROR_CONFIG);
+
+    /* Process unlocked */
+    __HAL_UNLOCK(hadc);
+
+    return HAL_ERROR;
+  }
+
+  /* Parameters update conditioned to ADC state:                              */
+  /* Parameters that can be updated when ADC is disabled or enabled without   */
+  /* conversion on going on regular group:                                    */
+  /*  - Multimode DMA configuration                                           */
+  /*  - Multimode DMA mode                                                    */
+  tmp_hadc_slave_conversion_on_going = LL_ADC_REG_IsConversionOngoing((&tmp_hadc_slave)->Instance);
+  if ((LL_ADC_REG_IsConversionOngoing(hadc->Instance) == 0UL)
+      && (tmp_hadc_slave_conversion_on_going == 0UL))
+  {
+    /* Pointer to the common control register */
+    tmpADC_Common = __LL_ADC_COMMON_INSTANCE(hadc->Instance);
+
+    /* If multimode is selected, configure all multimode parameters.          */
+    /* Otherwise, reset multimode parameters (can be used in case of          */
+    /* transition from multimode to independent mode).                        */
+    if (pMultimode->Mode != ADC_MODE_INDEPENDENT)
+    {
+#if   defined(ADC3)
+      MODIFY_REG(tmpADC_Common->CCR, ADC_CCR_MDMA | ADC_CCR_DMACFG,
+                 pMultimode->DMAAccessMode |
+                 ADC_CCR_MULTI_DMACONTREQ((hadc->Init.ConversionDataManagement & ADC_CFGR_DMACFG)
+                                          >> ADC_CFGR_DMACFG_Pos));
+#else
+      MODIFY_REG(tmpADC_Common->CCR, ADC_CCR_MDMA | ADC_CCR_DMACFG,
+                 pMultimode->DMAAccessMode |
+                 ADC_CCR_MULTI_DMACONTREQ((uint32_t)hadc->Init.DMAContinuousRequests));
+#endif /* ADC3 */
+
+      /* Parameters that can be updated only when ADC is disabled:                */
+      /*  - Multimode mode selection                                              */
+      /*  - Multimode delay                                                       */
+      /*    Note: Delay range depends on selected resolution:                     */
+      /*      from 1 to 12 clock cycles for 12 bits                               */
+      /*      from 1 to 10 clock cycles for 10 bits,                              */
+      /*      from 1 to 8 clock cycles for 8 bits                                 */
+      /*      from 1 to 6 clock cycles for 6 bits                                 */
+      /*    If a higher delay is selected, it will be clipped to maximum delay    */
+      /*    range                                                                 */
+      if (__LL_ADC_IS_ENABLED_ALL_COMMON_INSTANCE(__LL_ADC_COMMON_INSTANCE(hadc->Instance)) == 0UL)
+      {
+        MODIFY_REG(tmpADC_Common->CCR,
+                   ADC_CCR_DUAL |
+                   ADC_CCR_DELAY,
+                   pMultimode->Mode |
+                   pMultimode->TwoSamplingDelay
+                  );
+      }
+    }
+    else /* ADC_MODE_INDEPENDENT */
+    {
+      CLEAR_BIT(tmpADC_Common->CCR, ADC_CCR_MDMA | ADC_CCR_DMACFG);
+
+      /* Parameters that can be updated only when ADC is disabled:                */
+      /*  - Multimode mode selection                                              */
+      /*  - Multimode delay                                                       */
+      if (__LL_ADC_IS_ENABLED_ALL_COMMON_INSTANCE(__LL_ADC_COMMON_INSTANCE(hadc->Instance)) == 0UL)
+      {
+        CLEAR_BIT(tmpADC_Common->CCR, ADC_CCR_DUAL | ADC_CCR_DELAY);
+      }
+    }
+  }
+  /* If one of the ADC sharing the same common group is enabled, no update    */
+  /* could be done on neither of the multimode structure parameters.          */
+  else
+  {
+    /* Update ADC state machine to error */
+    SET_BIT(hadc->State, HAL_ADC_STATE_ERROR_CONFIG);
+
+    tmp_hal_status = HAL_ERROR;
+  }
+
+  /* Process unlocked */
+  __HAL_UNLOCK(hadc);
+
+  /* Return function status */
+  return tmp_hal_status;
+}
+#endif /* ADC_MULTIMODE_SUPPORT */
+
+/**
+  * @brief  Enable Injected Queue
+  * @note   This function resets CFGR register JQDIS bit in order to enable the
+  *         Injected Queue. JQDIS can be written only when ADSTART and JDSTART
+  *         are both equal to 0 to ensure that no regular nor injected
+  *         conversion is ongoing.
+  * @param hadc ADC handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ADCEx_EnableInjectedQueue(ADC_HandleTypeDef *hadc)
+{
+  HAL_StatusTypeDef tmp_hal_status;
+  uint32_t tmp_adc_is_conversion_on_going_regular;
+  uint32_t tmp_adc_is_conversion_on_going_injected;
+
+  /* Check the parameters */
+  assert_param(IS_ADC_ALL_INSTANCE(hadc->Instance));
+
+  tmp_adc_is_conversion_on_going_regular = LL_ADC_REG_IsConversionOngoing(hadc->Instance);
+  tmp_adc_is_conversion_on_going_injected = LL_ADC_INJ_IsConversionOngoing(hadc->Instance);
+
+  /* Parameter can be set only if no conversion is on-going */
+  if ((tmp_adc_is_conversion_on_going_regular == 0UL)
+      && (tmp_adc_is_conversion_on_going_injected == 0UL)
+     )
+  {
+    CLEAR_BIT(hadc->Instance->CFGR, ADC_CFGR_JQDIS);
+
+    /* Update state, clear previous result related to injected queue overflow */
+    CLEAR_BIT(hadc->State, HAL_ADC_STATE_INJ_JQOVF);
+
+    tmp_hal_status = HAL_OK;
+  }
+  else
+  {
+    tmp_hal_status = HAL_ERROR;
+  }
+
+  return tmp_hal_status;
+}
+
+/**
+  * @brief  Disable Injected Queue
+  * @note   This function sets CFGR register JQDIS bit in order to disable the
+  *         Injected Queue. JQDIS can be written only when ADSTART and JDSTART
+  *         are both equal to 0 to ensure that no regular nor injected
+  *         conversion is ongoing.
+  * @param hadc ADC handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ADCEx_DisableInjectedQueue(ADC_HandleTypeDef *hadc)
+{
+  HAL_StatusTypeDef tmp_hal_status;
+  uint32_t tmp_adc_is_conversion_on_going_regular;
+  uint32_t tmp_adc_is_conversion_on_going_injected;
+
+  /* Check the parameters */
+  assert_param(IS_ADC_ALL_INSTANCE(hadc->Instance));
+
+  tmp_adc_is_conversion_on_going_regular = LL_ADC_REG_IsConversionOngoing(hadc->Instance);
+  tmp_adc_is_conversion_on_going_injected = LL_ADC_INJ_IsConversionOngoing(hadc->Instance);
+
+  /* Parameter can be set only if no conversion is on-going */
+  if ((tmp_adc_is_conversion_on_going_regular == 0UL)
+      && (tmp_adc_is_conversion_on_going_injected == 0UL)
+     )
+  {
+    LL_ADC_INJ_SetQueueMode(hadc->Instance, LL_ADC_INJ_QUEUE_DISABLE);
+    tmp_hal_status = HAL_OK;
+  }
+  else
+  {
+    tmp_hal_status = HAL_ERROR;
+  }
+
+  return tmp_hal_status;
+}
+
+/**
+  * @brief  Disable ADC voltage regulator.
+  * @note   Disabling voltage regulator allows to save power. This operation can
+  *         be carried out only when ADC is disabled.
+  * @note   To enable again the voltage regulator, the user is expected to
+  *         resort to HAL_ADC_Init() API.
+  * @param hadc ADC handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ADCEx_DisableVoltageRegulator(ADC_HandleTypeDef *hadc)
+{
+  HAL_StatusTypeDef tmp_hal_status;
+
+  /* Check the parameters */
+  assert_param(IS_ADC_ALL_INSTANCE(hadc->Instance));
+
+  /* Setting of this feature is conditioned to ADC state: ADC must be ADC disabled */
+  if (LL_ADC_IsEnabled(hadc->Instance) == 0UL)
+  {
+    LL_ADC_DisableInternalRegulator(hadc->Instance);
+    tmp_hal_status = HAL_OK;
+  }
+  else
+  {
+    tmp_hal_status = HAL_ERROR;
+  }
+
+  return tmp_hal_status;
+}
+
+/**
+  * @brief  Enter ADC deep-power-down mode
+  * @note   This mode is achieved in setting DEEPPWD bit and allows to save power
+  *         in reducing leakage currents. It is particularly interesting before
+  *         entering stop modes.
+  * @note   Setting DEEPPWD automatically clears ADVREGEN bit and disables the
+  *         ADC voltage regulator. This means that this API encompasses
+  *         HAL_ADCEx_DisableVoltageRegulator(). Additionally, the internal
+  *         calibration is lost.
+  * @note   To exit the ADC deep-power-down mode, the user is expected to
+  *         resort to HAL_ADC_Init() API as well as to relaunch a calibration
+  *         with HAL_ADCEx_Calibration_Start() API or to re-apply a previously
+  *         saved calibration factor.
+  * @param hadc ADC handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ADCEx_EnterADCDeepPowerDownMode(ADC_HandleTypeDef *hadc)
+{
+  HAL_StatusTypeDef tmp_hal_status;
+
+  /* Check the parameters */
+  assert_param(IS_ADC_ALL_INSTANCE(hadc->Instance));
+
+  /* Setting of this feature is conditioned to ADC state: ADC must be ADC disabled */
+  if (LL_ADC_IsEnabled(hadc->Instance) == 0UL)
+  {
+    LL_ADC_EnableDeepPowerDown(hadc->Instance);
+    tmp_hal_status = HAL_OK;
+  }
+  else
+  {
+    tmp_hal_status = HAL_ERROR;
+  }
+
+  return tmp_hal_status;
+}
+
+/**
+  * @brief  Compute an acquisition profile of ADC group regular from a target resolution and output data rate.
+  * @note   Each additional bit of resolution over the ADC native resolution (Init.Resolution) is obtained by an
+  *         oversampling ratio of 4 and a right bit shift of 1. The sampling time selected is the longest one
+  *         allowing the oversampled conversions of all the regular sequencer ranks within an output period.
+  * @note   The trigger timer period is the auto-reload value of a timer counting at TimerClockFreq and triggering
+  *         one regular sequence per output sample. It is left to 0 if TimerClockFreq is 0.
+  * @param hadc ADC handle
+  * @param pTarget Pointer to the acquisition target
+  * @param pProfile Pointer to the computed acquisition profile
+  * @retval HAL status, HAL_ERROR if the target can not be reached
+  */
+HAL_StatusTypeDef HAL_ADCEx_ComputeAcquisitionProfile(const ADC_HandleTypeDef *hadc,
+                                                      const ADC_AcquisitionTargetTypeDef *pTarget,
+                                                      ADC_AcquisitionProfileTypeDef *pProfile)
+{
+  /* Sampling times and their durations in ADC clock half cycles, by increasing duration */
+  static const uint32_t sampling_times[] =
+  {
+    ADC_SAMPLETIME_2CYCLES_5, ADC_SAMPLETIME_6CYCLES_5, ADC_SAMPLETIME_12CYCLES_5, ADC_SAMPLETIME_24CYCLES_5,
+    ADC_SAMPLETIME_47CYCLES_5, ADC_SAMPLETIME_92CYCLES_5, ADC_SAMPLETIME_247CYCLES_5, ADC_SAMPLETIME_640CYCLES_5
+  };
+  static const uint32_t sampling_half_cycles[] = {5UL, 13UL, 25UL, 49UL, 95UL, 185UL, 495UL, 1281UL};
+  uint32_t native_bits;
+  uint32_t extra_bits;
+  uint32_t nb_ranks;
+  uint64_t conversions_per_second;
+  uint32_t idx;
+
+  if ((pTarget == NULL) || (pProfile == NULL) || (pTarget->AdcClockFreq == 0UL) || (pTarget->OutputRate == 0UL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Native resolution: 12, 10, 8 or 6 bits */
+  native_bits = 12UL - (2UL * (hadc->Init.Resolution >> ADC_CFGR_RES_Pos));
+
+  /* The oversampler provides up to 4 additional bits (ratio 256) within the 16 bits data register */
+  if ((pTarget->TargetResolution < native_bits) || (pTarget->TargetResolution > (native_bits + 4UL))
+      || (pTarget->TargetResolution > 16UL))
+  {
+    return HAL_ERROR;
+  }
+  extra_bits = pTarget->TargetResolution - native_bits;
+
+  if (extra_bits == 0UL)
+  {
+    pProfile->OversamplingMode = DISABLE;
+    pProfile->Ratio            = ADC_OVERSAMPLING_RATIO_2;
+    pProfile->RightBitShift    = ADC_RIGHTBITSHIFT_NONE;
+  }
+  else
+  {
+    /* Ratio 4^extra_bits = 2^(2 * extra_bits), encoded as (log2(ratio) - 1) */
+    pProfile->OversamplingMode = ENABLE;
+    pProfile->Ratio            = ((2UL * extra_bits) - 1UL) << ADC_CFGR2_OVSR_Pos;
+    pProfile->RightBitShift    = extra_bits << ADC_CFGR2_OVSS_Pos;
+  }
+
+  /* Number of conversions per second: all regular ranks, oversampled, at the output rate */
+  nb_ranks = (READ_BIT(hadc->Instance->SQR1, ADC_SQR1_L) >> ADC_SQR1_L_Pos) + 1UL;
+  conversions_per_second = (uint64_t)pTarget->OutputRate * nb_ranks * (1UL << (2UL * extra_bits));
+
+  /* Select the longest sampling time fitting in the conversion period: */
+  /* (sampling + native bits + 0.5) cycles per conversion               */
+  idx = sizeof(sampling_half_cycles) / sizeof(sampling_half_cycles[0]);
+  do
+  {
+    idx--;
+    if ((conversions_per_second * (sampling_half_cycles[idx] + (2UL * native_bits) + 1UL))
+        <= (2ULL * pTarget->AdcClockFreq))
+    {
+      break;
+    }
+  } while (idx != 0UL);
+
+  if ((conversions_per_second * (sampling_half_cycles[idx] + (2UL * native_bits) + 1UL))
+      > (2ULL * pTarget->AdcClockFreq))
+  {
+    return HAL_ERROR;
+  }
+  pProfile->SamplingTime = sampling_times[idx];
+
+  /* Trigger timer auto-reload value, rounded to the nearest output period */
+  pProfile->TimerPeriod = 0UL;
+  if (pTarget->TimerClockFreq != 0UL)
+  {
+    if (pTarget->TimerClockFreq < pTarget->OutputRate)
+    {
+      return HAL_ERROR;
+    }
+    pProfile->TimerPeriod = ((pTarget->TimerClockFreq + (pTarget->OutputRate / 2UL)) / pTarget->OutputRate) - 1UL;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Apply an acquisition profile to ADC group regular, possibly while conversions are on going.
+  * @note   If ADC group regular conversions are on going, they are stopped, the oversampler and the sampling time of
+  *         the channels of all the regular sequencer ranks are updated, then the conversions are restarted.
+  *         A DMA transfer on going is not interrupted: the data following the update have the new resolution.
+  * @note   The trigger timer period of the profile is not applied by this function: it has to be applied on
+  *         the timer used as ADC trigger.
+  * @param hadc ADC handle
+  * @param pProfile Pointer to the acquisition profile, computed with HAL_ADCEx_ComputeAcquisitionProfile()
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ADCEx_ApplyAcquisitionProfile(ADC_HandleTypeDef *hadc,
+                                                    const ADC_AcquisitionProfileTypeDef *pProfile)
+{
+  static const uint32_t regular_ranks[] =
+  {
+    ADC_REGULAR_RANK_1, ADC_REGULAR_RANK_2, ADC_REGULAR_RANK_3, ADC_REGULAR_RANK_4,
+    ADC_REGULAR_RANK_5, ADC_REGULAR_RANK_6, ADC_REGULAR_RANK_7, ADC_REGULAR_RANK_8,
+    ADC_REGULAR_RANK_9, ADC_REGULAR_RANK_10, ADC_REGULAR_RANK_11, ADC_REGULAR_RANK_12,
+    ADC_REGULAR_RANK_13, ADC_REGULAR_RANK_14, ADC_REGULAR_RANK_15, ADC_REGULAR_RANK_16
+  };
+  HAL_StatusTypeDef tmp_hal_status = HAL_OK;
+  uint32_t tmp_adc_was_converting;
+  uint32_t channel;
+  uint32_t nb_ranks;
+  uint32_t rank;
+
+  /* Check the parameters */
+  assert_param(IS_ADC_ALL_INSTANCE(hadc->Instance));
+  assert_param(IS_FUNCTIONAL_STATE(pProfile->OversamplingMode));
+  assert_param(IS_ADC_OVERSAMPLING_RATIO(pProfile->Ratio));
+  assert_param(IS_ADC_RIGHT_BIT_SHIFT(pProfile->RightBitShift));
+  assert_param(IS_ADC_SAMPLE_TIME(pProfile->SamplingTime));
+
+  /* Oversampler and sampling times can not be updated during injected conversions */
+  if (LL_ADC_INJ_IsConversionOngoing(hadc->Instance) != 0UL)
+  {
+    return HAL_BUSY;
+  }
+
+  /* Process locked */
+  __HAL_LOCK(hadc);
+
+  /* Stop the regular conversions on going, DMA transfer is kept */
+  tmp_adc_was_converting = LL_ADC_REG_IsConversionOngoing(hadc->Instance);
+  if (tmp_adc_was_converting != 0UL)
+  {
+    tmp_hal_status = ADC_ConversionStop(hadc, ADC_REGULAR_GROUP);
+  }
+
+  if (tmp_hal_status == HAL_OK)
+  {
+    /* Configuration of Oversampler: ratio and right bit shift */
+    if (pProfile->OversamplingMode == ENABLE)
+    {
+      MODIFY_REG(hadc->Instance->CFGR2,
+                 ADC_CFGR2_OVSR | ADC_CFGR2_OVSS,
+                 ADC_CFGR2_ROVSE | pProfile->Ratio | pProfile->RightBitShift);
+    }
+    else
+    {
+      CLEAR_BIT(hadc->Instance->CFGR2, ADC_CFGR2_ROVSE);
+    }
+
+    /* Sampling time of the channels of all the regular sequencer ranks */
+    nb_ranks = (READ_BIT(hadc->Instance->SQR1, ADC_SQR1_L) >> ADC_SQR1_L_Pos) + 1UL;
+    for (rank = 0UL; rank < nb_ranks; rank++)
+    {
+      channel = LL_ADC_REG_GetSequencerRanks(hadc->Instance, regular_ranks[rank]);
+      LL_ADC_SetChannelSamplingTime(hadc->Instance,
+                                    __LL_ADC_DECIMAL_NB_TO_CHANNEL(__LL_ADC_CHANNEL_TO_DECIMAL_NB(channel)),
+                                    pProfile->SamplingTime);
+    }
+
+    /* Keep the initialization structure coherent with the ADC configuration */
+    hadc->Init.OversamplingMode           = pProfile->OversamplingMode;
+    hadc->Init.Oversampling.Ratio         = pProfile->Ratio;
+    hadc->Init.Oversampling.RightBitShift = pProfile->RightBitShift;
+
+    /* Restart the regular conversions */
+    if (tmp_adc_was_converting != 0UL)
+    {
+      LL_ADC_REG_StartConversion(hadc->Instance);
+    }
+  }
+
+  /* Process unlocked */
+  __HAL_UNLOCK(hadc);
+
+  return tmp_hal_status;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/** @addtogroup ADCEx_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  DMA node transfer complete callback of the deinterleaved DMA stream.
+  * @note   Each node completion fills one half of every channel buffer: the ADC half transfer and transfer
+  *         complete callbacks are called alternately.
+  * @param hdma pointer to DMA handle.
+  * @retval None
+  */
+static void ADCEx_DMADeinterleaveCplt(DMA_HandleTypeDef *hdma)
+{
+  /* Retrieve ADC handle corresponding to current DMA handle */
+  ADC_HandleTypeDef *hadc = (ADC_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+
+  if (hadc->DeinterleaveBlock == 0UL)
+  {
+    hadc->DeinterleaveBlock = 1UL;
+    ADC_DMAHalfConvCplt(hdma);
+  }
+  else
+  {
+    hadc->DeinterleaveBlock = 0UL;
+    ADC_DMAConvCplt(hdma);
+  }
+}
+
+#if defined(ADC_MULTIMODE_SUPPORT)
+/**
+  * @brief  Enable ADC master and slave, start MultiMode conversion and transfer regular results through DMA.
+  * @param hadc ADC handle of ADC master
+  * @param pData Destination Buffer address.
+  * @param Length Length of data to be transferred from ADC peripheral to memory.
+  * @param pXferCpltCallback DMA transfer complete callback
+  * @param pXferHalfCpltCallback DMA half transfer complete callback
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef ADCEx_MultiModeStartDMA(ADC_HandleTypeDef *hadc, uint32_t *pData, uint32_t Length,
+                                                 void (*pXferCpltCallback)(DMA_HandleTypeDef *hdma),
+                                                 void (*pXferHalfCpltCallback)(DMA_HandleTypeDef *hdma))
+{
+  HAL_StatusTypeDef tmp_hal_status;
+  ADC_HandleTypeDef tmp_hadc_slave;
+  ADC_Common_TypeDef *tmpADC_Common;
+  uint32_t length_bytes;
+  DMA_NodeConfTypeDef node_conf;
+
+  /* Check the parameters */
+  assert_param(IS_ADC_MULTIMODE_MASTER_INSTANCE(hadc->Instance));
+  assert_param(IS_FUNCTIONAL_STATE(hadc->Init.ContinuousConvMode));
+  assert_param(IS_ADC_EXTTRIG_EDGE(hadc->Init.ExternalTrigConvEdge));
+#if   defined(ADC3)
+#else
+  assert_param(IS_FUNCTIONAL_STATE(hadc->Init.DMAContinuousRequests));
+#endif /* ADC3 */
+
+  if (LL_ADC_REG_IsConversionOngoing(hadc->Instance) != 0UL)
+  {
+    return HAL_BUSY;
+  }
+  else
+  {
+    /* Process locked */
+    __HAL_LOCK(hadc);
+
+    /* Temporary handle minimum initialization */
+    __HAL_ADC_RESET_HANDLE_STATE(&tmp_hadc_slave);
+    ADC_CLEAR_ERRORCODE(&tmp_hadc_slave);
+
+    /* Set a temporary handle of the ADC slave associated to the ADC master   */
+    ADC_MULTI_SLAVE(hadc, &tmp_hadc_slave);
+
+    if (tmp_hadc_slave.Instance == NULL)
+    {
+      /* Set ADC state */
+      SET_BIT(hadc->State, HAL_ADC_STATE_ERROR_CONFIG);
+
+      /* Process unlocked */
+      __HAL_UNLOCK(hadc);
+
+      return HAL_ERROR;
+    }
+
+    /* Enable the ADC peripherals: master and slave (in case if not already   */
+    /* enabled previously)                                                    */
+    tmp_hal_status = ADC_Enable(hadc);
+    if (tmp_hal_status == HAL_OK)
+    {
+      tmp_hal_status = ADC_Enable(&tmp_hadc_slave);
+    }
+
+    /* Start multimode conversion of ADCs pair */
+    if (tmp_hal_status == HAL_OK)
+    {
+      /* Set ADC state */
+      ADC_STATE_CLR_SET(hadc->State,
+                        (HAL_ADC_STATE_READY | HAL_ADC_STATE_REG_EOC | HAL_ADC_STATE_REG_OVR | HAL_ADC_STATE_REG_EOSMP),
+                        HAL_ADC_STATE_REG_BUSY);
+
+      /* Set ADC error code to none */
+      ADC_CLEAR_ERRORCODE(hadc);
+
+      /* Set the DMA transfer complete callback */
+      hadc->DMA_Handle->XferCpltCallback = pXferCpltCallback;
+
+      /* Set the DMA half transfer complete callback */
+      hadc->DMA_Handle->XferHalfCpltCallback = pXferHalfCpltCallback;
+
+      /* Set the DMA error callback */
+      hadc->DMA_Handle->XferErrorCallback = ADC_DMAError ;
+
+      /* Pointer to the common control register  */
+      tmpADC_Common = __LL_ADC_COMMON_INSTANCE(hadc->Instance);
+
+      /* Manage ADC and DMA start: ADC overrun interruption, DMA start, ADC     */
+      /* start (in case of SW start):                                           */
+
+      /* Clear regular group conversion flag and overrun flag */
+      /* (To ensure of no unknown state from potential previous ADC operations) */
+      __HAL_ADC_CLEAR_FLAG(hadc, (ADC_FLAG_EOC | ADC_FLAG_EOS | ADC_FLAG_OVR));
+
+      /* Process unlocked */
+      /* Unlock before starting ADC conversions: in case of potential         */
+      /* interruption, to let the process to ADC IRQ Handler.                 */
+      __HAL_UNLOCK(hadc);
+
+      /* Enable ADC overrun interrupt */
+      __HAL_ADC_ENABLE_IT(hadc, ADC_IT_OVR);
+
+      /* Check linkedlist mode */
+      if ((hadc->DMA_Handle->Mode & DMA_LINKEDLIST) == DMA_LINKEDLIST)
+      {
+        if ((hadc->DMA_Handle->LinkedListQueue != NULL) && (hadc->DMA_Handle->LinkedListQueue->Head != NULL))
+        {
+          /* Length should be converted to number of bytes */
+          if (HAL_DMAEx_List_GetNodeConfig(&node_conf, hadc->DMA_Handle->LinkedListQueue->Head) != HAL_OK)
+          {
+            return HAL_ERROR;
+          }
+
+          /* Length should be converted to number of bytes */
+          if (node_conf.Init.SrcDataWidth == DMA_SRC_DATAWIDTH_WORD)
+          {
+            /* Word -> Bytes */
+            length_bytes = Length * 4U;
+          }
+          else if (node_conf.Init.SrcDataWidth == DMA_SRC_DATAWIDTH_HALFWORD)
+          {
+            /* Halfword -> Bytes */
+            length_bytes = Length * 2U;
+          }
+          else /* Bytes */
+          {
+            /* Same size already expressed in Bytes */
+            length_bytes = Length;
+          }
+
+          hadc->DMA_Handle->LinkedListQueue->Head->LinkRegisters[NODE_CBR1_DEFAULT_OFFSET] = (uint32_t)length_bytes;
+          hadc->DMA_Handle->LinkedListQueue->Head->LinkRegisters[NODE_CSAR_DEFAULT_OFFSET] =                  \
+              (uint32_t)&tmpADC_Common->CDR;
+          hadc->DMA_Handle->LinkedListQueue->Head->LinkRegisters[NODE_CDAR_DEFAULT_OFFSET] = (uint32_t)pData;
+          tmp_hal_status = HAL_DMAEx_List_Start_IT(hadc->DMA_Handle);
+        }
+        else
+        {
+          return HAL_ERROR;
+        }
+      }
+      else
+      {
+        /* Length should be converted to number of bytes */
+        if (hadc->DMA_Handle->Init.SrcDataWidth == DMA_SRC_DATAWIDTH_WORD)
+        {
+          /* Word -> Bytes */
+          length_bytes = Length * 4U;
+        }
+        else if (hadc->DMA_Handle->Init.SrcDataWidth == DMA_SRC_DATAWIDTH_HALFWORD)
+        {
+          /* Halfword -> Bytes */
+          length_bytes = Length * 2U;
+        }
+        else /* Bytes */
+        {
+          /* Same size already expressed in Bytes */
+          length_bytes = Length;
+        }
+
+        /* Start the DMA channel */
+        tmp_hal_status = HAL_DMA_Start_IT(hadc->DMA_Handle, (uint32_t)&tmpADC_Common->CDR, (uint32_t)pData,        \
+                                          length_bytes);
+      }
+
+      /* Enable conversion of regular group.                                    */
+      /* If software start has been selected, conversion starts immediately.    */
+      /* If external trigger has been selected, conversion will start at next   */
+      /* trigger event.                                                         */
+      /* Start ADC group regular conversion */
+      LL_ADC_REG_StartConversion(hadc->Instance);
+    }
+    else
+    {
+      /* Process unlocked */
+      __HAL_UNLOCK(hadc);
+    }
+
+    /* Return function status */
+    return tmp_hal_status;
+  }
+}
+
+/**
+  * @brief  Unpack a completed block of a dual mode streaming acquisition.
+  * @param hadc ADC handle of ADC master
+  * @param Block Index of the completed raw buffer half (0 or 1)
+  * @retval None
+  */
+static void ADCEx_MultiModeStreamBlock(ADC_HandleTypeDef *hadc, uint32_t Block)
 {
-  HAL_StatusTypeDef tmp_hal_status = HAL_OK;
-  ADC_Common_TypeDef *tmpADC_Common;
-  ADC_HandleTypeDef tmp_hadc_slave;
-  uint32_t tmp_hadc_slave_conversion_on_going;
+  ADC_MultiModeStreamTypeDef *pstream = hadc->pMultiModeStream;
+  const uint32_t *praw;
+  uint32_t timestamp = 0UL;
+  uint32_t cdar;
 
-  /* Check the parameters */
-  assert_param(IS_ADC_MULTIMODE_MASTER_INSTANCE(hadc->Instance));
-  assert_param(IS_ADC_MULTIMODE(pMultimode->Mode));
-  if (pMultimode->Mode != ADC_MODE_INDEPENDENT)
+  /* Latch the timestamp as close as possible to the block completion */
+  if (pstream->pTimestampCounter != NULL)
   {
-    assert_param(IS_ADC_DMA_ACCESS_MULTIMODE(pMultimode->DMAAccessMode));
-    assert_param(IS_ADC_SAMPLING_DELAY(pMultimode->TwoSamplingDelay));
+    timestamp = *pstream->pTimestampCounter;
   }
 
-  /* Process locked */
-  __HAL_LOCK(hadc);
-
-  /* Temporary handle minimum initialization */
-  __HAL_ADC_RESET_HANDLE_STATE(&tmp_hadc_slave);
-  ADC_CLEAR_ERRORCODE(&tmp_hadc_slave);
-
-  ADC_MULTI_SLAVE(hadc, &tmp_hadc_slave);
+  pstream->BlockIndex++;
 
-  if (tmp_hadc_slave.Instance == NULL)
+  /* Previous block not released yet: drop the new one */
+  if (pstream->BlockPending != 0UL)
   {
-    /* Update ADC state machine to error */
-    SET_BIT(hadc->State, HAL_ADC_STATE_ERROR_CONFIG);
-
-    /* Process unlocked */
-    __HAL_UNLOCK(hadc);
-
-    return HAL_ERROR;
+    pstream->DroppedBlocks++;
+    return;
   }
 
-  /* Parameters update conditioned to ADC state:                              */
-  /* Parameters that can be updated when ADC is disabled or enabled without   */
-  /* conversion on going on regular group:                                    */
-  /*  - Multimode DMA configuration                                           */
-  /*  - Multimode DMA mode                                                    */
-  tmp_hadc_slave_conversion_on_going = LL_ADC_REG_IsConversionOngoing((&tmp_hadc_slave)->Instance);
-  if ((LL_ADC_REG_IsConversionOngoing(hadc->Instance) == 0UL)
-      && (tmp_hadc_slave_conversion_on_going == 0UL))
+  /* Unpack the master (lower halfword) and slave (upper halfword) results */
+  praw = &pstream->pRawBuffer[Block * pstream->BlockSize];
+  for (uint32_t idx = 0UL; idx < pstream->BlockSize; idx++)
   {
-    /* Pointer to the common control register */
-    tmpADC_Common = __LL_ADC_COMMON_INSTANCE(hadc->Instance);
-
-    /* If multimode is selected, configure all multimode parameters.          */
-    /* Otherwise, reset multimode parameters (can be used in case of          */
-    /* transition from multimode to independent mode).                        */
-    if (pMultimode->Mode != ADC_MODE_INDEPENDENT)
-    {
-#if   defined(ADC3)
-      MODIFY_REG(tmpADC_Common->CCR, ADC_CCR_MDMA | ADC_CCR_DMACFG,
-                 pMultimode->DMAAccessMode |
-                 ADC_CCR_MULTI_DMACONTREQ((hadc->Init.ConversionDataManagement & ADC_CFGR_DMACFG)
-                                          >> ADC_CFGR_DMACFG_Pos));
-#else
-      MODIFY_REG(tmpADC_Common->CCR, ADC_CCR_MDMA | ADC_CCR_DMACFG,
-                 pMultimode->DMAAccessMode |
-                 ADC_CCR_MULTI_DMACONTREQ((uint32_t)hadc->Init.DMAContinuousRequests));
-#endif /* ADC3 */
-
-      /* Parameters that can be updated only when ADC is disabled:                */
-      /*  - Multimode mode selection                                              */
-      /*  - Multimode delay                                                       */
-      /*    Note: Delay range depends on selected resolution:                     */
-      /*      from 1 to 12 clock cycles for 12 bits                               */
-      /*      from 1 to 10 clock cycles for 10 bits,                              */
-      /*      from 1 to 8 clock cycles for 8 bits                                 */
-      /*      from 1 to 6 clock cycles for 6 bits                                 */
-      /*    If a higher delay is selected, it will be clipped to maximum delay    */
-      /*    range                                                                 */
-      if (__LL_ADC_IS_ENABLED_ALL_COMMON_INSTANCE(__LL_ADC_COMMON_INSTANCE(hadc->Instance)) == 0UL)
-      {
-        MODIFY_REG(tmpADC_Common->CCR,
-                   ADC_CCR_DUAL |
-                   ADC_CCR_DELAY,
-                   pMultimode->Mode |
-                   pMultimode->TwoSamplingDelay
-                  );
-      }
-    }
-    else /* ADC_MODE_INDEPENDENT */
-    {
-      CLEAR_BIT(tmpADC_Common->CCR, ADC_CCR_MDMA | ADC_CCR_DMACFG);
-
-      /* Parameters that can be updated only when ADC is disabled:                */
-      /*  - Multimode mode selection                                              */
-      /*  - Multimode delay                                                       */
-      if (__LL_ADC_IS_ENABLED_ALL_COMMON_INSTANCE(__LL_ADC_COMMON_INSTANCE(hadc->Instance)) == 0UL)
-      {
-        CLEAR_BIT(tmpADC_Common->CCR, ADC_CCR_DUAL | ADC_CCR_DELAY);
-      }
-    }
+    pstream->pMasterData[idx] = (uint16_t)(praw[idx] & 0xFFFFUL);
+    pstream->pSlaveData[idx]  = (uint16_t)(praw[idx] >> 16U);
   }
-  /* If one of the ADC sharing the same common group is enabled, no update    */
-  /* could be done on neither of the multimode structure parameters.          */
-  else
-  {
-    /* Update ADC state machine to error */
-    SET_BIT(hadc->State, HAL_ADC_STATE_ERROR_CONFIG);
 
-    tmp_hal_status = HAL_ERROR;
+  /* DMA back in the unpacked half: the block has been overwritten meanwhile */
+  cdar = hadc->DMA_Handle->Instance->CDAR;
+  if ((cdar >= (uint32_t)praw) && (cdar < (uint32_t)&praw[pstream->BlockSize]))
+  {
+    pstream->DroppedBlocks++;
+    return;
   }
 
-  /* Process unlocked */
-  __HAL_UNLOCK(hadc);
+  pstream->Timestamp    = timestamp;
+  pstream->BlockPending = 1UL;
 
-  /* Return function status */
-  return tmp_hal_status;
+  /* Set ADC state */
+  SET_BIT(hadc->State, HAL_ADC_STATE_REG_EOC);
+
+  /* Conversion complete callback */
+#if (USE_HAL_ADC_REGISTER_CALLBACKS == 1)
+  hadc->ConvCpltCallback(hadc);
+#else
+  HAL_ADC_ConvCpltCallback(hadc);
+#endif /* USE_HAL_ADC_REGISTER_CALLBACKS */
 }
-#endif /* ADC_MULTIMODE_SUPPORT */
 
 /**
-  * @brief  Enable Injected Queue
-  * @note   This function resets CFGR register JQDIS bit in order to enable the
-  *         Injected Queue. JQDIS can be written only when ADSTART and JDSTART
-  *         are both equal to 0 to ensure that no regular nor injected
-  *         conversion is ongoing.
-  * @param hadc ADC handle
-  * @retval HAL status
+  * @brief  DMA half transfer complete callback of the dual mode streaming acquisition.
+  * @param hdma pointer to DMA handle.
+  * @retval None
   */
-HAL_StatusTypeDef HAL_ADCEx_EnableInjectedQueue(ADC_HandleTypeDef *hadc)
+static void ADCEx_DMAStreamHalfCplt(DMA_HandleTypeDef *hdma)
 {
-  HAL_StatusTypeDef tmp_hal_status;
-  uint32_t tmp_adc_is_conversion_on_going_regular;
-  uint32_t tmp_adc_is_conversion_on_going_injected;
+  /* Retrieve ADC handle corresponding to current DMA handle */
+  ADC_HandleTypeDef *hadc = (ADC_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
 
-  /* Check the parameters */
-  assert_param(IS_ADC_ALL_INSTANCE(hadc->Instance));
+  ADCEx_MultiModeStreamBlock(hadc, 0UL);
+}
 
-  tmp_adc_is_conversion_on_going_regular = LL_ADC_REG_IsConversionOngoing(hadc->Instance);
-  tmp_adc_is_conversion_on_going_injected = LL_ADC_INJ_IsConversionOngoing(hadc->Instance);
+/**
+  * @brief  DMA transfer complete callback of the dual mode streaming acquisition.
+  * @param hdma pointer to DMA handle.
+  * @retval None
+  */
+static void ADCEx_DMAStreamCplt(DMA_HandleTypeDef *hdma)
+{
+  /* Retrieve ADC handle corresponding to current DMA handle */
+  ADC_HandleTypeDef *hadc = (ADC_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
 
-  /* Parameter can be set only if no conversion is on-going */
-  if ((tmp_adc_is_conversion_on_going_regular == 0UL)
-      && (tmp_adc_is_conversion_on_going_injected == 0UL)
-     )
-  {
-    CLEAR_BIT(hadc->Instance->CFGR, ADC_CFGR_JQDIS);
+  ADCEx_MultiModeStreamBlock(hadc, 1UL);
+}
+#endif /* ADC_MULTIMODE_SUPPORT */
 
-    /* Update state, clear previous result related to injected queue overflow */
-    CLEAR_BIT(hadc->State, HAL_ADC_STATE_INJ_JQOVF);
+/**
+  * @brief  Get the analog watchdog interrupt of a threshold triggered capture.
+  * @note   The analog watchdog flags share the bit positions of their interrupts.
+  * @param pCapture Pointer to the capture structure
+  * @retval ADC analog watchdog interrupt
+  */
+static uint32_t ADCEx_ThresholdCaptureIT(const ADC_ThresholdCaptureTypeDef *pCapture)
+{
+  uint32_t tmp_it;
 
-    tmp_hal_status = HAL_OK;
+  if (pCapture->WatchdogNumber == ADC_ANALOGWATCHDOG_1)
+  {
+    tmp_it = ADC_IT_AWD1;
+  }
+  else if (pCapture->WatchdogNumber == ADC_ANALOGWATCHDOG_2)
+  {
+    tmp_it = ADC_IT_AWD2;
   }
   else
   {
-    tmp_hal_status = HAL_ERROR;
+    tmp_it = ADC_IT_AWD3;
   }
 
-  return tmp_hal_status;
+  return tmp_it;
 }
 
 /**
-  * @brief  Disable Injected Queue
-  * @note   This function sets CFGR register JQDIS bit in order to disable the
-  *         Injected Queue. JQDIS can be written only when ADSTART and JDSTART
-  *         are both equal to 0 to ensure that no regular nor injected
-  *         conversion is ongoing.
+  * @brief  Arm the trigger of a threshold triggered capture.
   * @param hadc ADC handle
-  * @retval HAL status
+  * @retval None
   */
-HAL_StatusTypeDef HAL_ADCEx_DisableInjectedQueue(ADC_HandleTypeDef *hadc)
+static void ADCEx_ThresholdCaptureArm(ADC_HandleTypeDef *hadc)
 {
-  HAL_StatusTypeDef tmp_hal_status;
-  uint32_t tmp_adc_is_conversion_on_going_regular;
-  uint32_t tmp_adc_is_conversion_on_going_injected;
-
-  /* Check the parameters */
-  assert_param(IS_ADC_ALL_INSTANCE(hadc->Instance));
+  uint32_t tmp_it = ADCEx_ThresholdCaptureIT(hadc->pThresholdCapture);
 
-  tmp_adc_is_conversion_on_going_regular = LL_ADC_REG_IsConversionOngoing(hadc->Instance);
-  tmp_adc_is_conversion_on_going_injected = LL_ADC_INJ_IsConversionOngoing(hadc->Instance);
+  /* Discard the events that occurred while disarmed */
+  __HAL_ADC_CLEAR_FLAG(hadc, tmp_it);
+  __HAL_ADC_ENABLE_IT(hadc, tmp_it);
+}
 
-  /* Parameter can be set only if no conversion is on-going */
-  if ((tmp_adc_is_conversion_on_going_regular == 0UL)
-      && (tmp_adc_is_conversion_on_going_injected == 0UL)
-     )
-  {
-    LL_ADC_INJ_SetQueueMode(hadc->Instance, LL_ADC_INJ_QUEUE_DISABLE);
-    tmp_hal_status = HAL_OK;
-  }
-  else
-  {
-    tmp_hal_status = HAL_ERROR;
-  }
+/**
+  * @brief  Get the ring buffer index of the next DMA write of a threshold triggered capture.
+  * @param hadc ADC handle
+  * @retval Ring buffer index
+  */
+static uint32_t ADCEx_ThresholdCaptureWriteIndex(const ADC_HandleTypeDef *hadc)
+{
+  uint32_t ring_size = hadc->pThresholdCapture->RingSize;
 
-  return tmp_hal_status;
+  /* The DMA counter holds the number of bytes left until the end of the ring */
+  return (ring_size - (__HAL_DMA_GET_COUNTER(hadc->DMA_Handle) / 4UL)) % ring_size;
 }
 
 /**
-  * @brief  Disable ADC voltage regulator.
-  * @note   Disabling voltage regulator allows to save power. This operation can
-  *         be carried out only when ADC is disabled.
-  * @note   To enable again the voltage regulator, the user is expected to
-  *         resort to HAL_ADC_Init() API.
+  * @brief  Update the progress of a triggered capture and fill the capture buffer once the post-trigger
+  *         conversions are written.
   * @param hadc ADC handle
-  * @retval HAL status
+  * @retval None
   */
-HAL_StatusTypeDef HAL_ADCEx_DisableVoltageRegulator(ADC_HandleTypeDef *hadc)
+static void ADCEx_ThresholdCaptureUpdate(ADC_HandleTypeDef *hadc)
 {
-  HAL_StatusTypeDef tmp_hal_status;
-
-  /* Check the parameters */
-  assert_param(IS_ADC_ALL_INSTANCE(hadc->Instance));
+  ADC_ThresholdCaptureTypeDef *pcapture = hadc->pThresholdCapture;
+  uint32_t ring_size = pcapture->RingSize;
+  uint32_t write_index;
+  uint32_t src_index;
+  uint32_t count;
 
-  /* Setting of this feature is conditioned to ADC state: ADC must be ADC disabled */
-  if (LL_ADC_IsEnabled(hadc->Instance) == 0UL)
+  if (pcapture->Triggered == 0UL)
   {
-    LL_ADC_DisableInternalRegulator(hadc->Instance);
-    tmp_hal_status = HAL_OK;
+    return;
   }
-  else
+
+  /* Updates occur at least once per half ring, the number of new conversions is not ambiguous */
+  write_index = ADCEx_ThresholdCaptureWriteIndex(hadc);
+  pcapture->PostCount += ((write_index + ring_size) - pcapture->WriteIndex) % ring_size;
+  pcapture->WriteIndex = write_index;
+
+  if (pcapture->PostCount >= pcapture->PostTriggerSamples)
   {
-    tmp_hal_status = HAL_ERROR;
-  }
+    /* Copy the conversions around the trigger out of the ring buffer */
+    src_index = ((pcapture->TriggerIndex + ring_size) - pcapture->PreTriggerSamples) % ring_size;
+    for (count = 0UL; count < (pcapture->PreTriggerSamples + pcapture->PostTriggerSamples); count++)
+    {
+      pcapture->pCaptureBuffer[count] = pcapture->pRingBuffer[src_index];
+      src_index++;
+      if (src_index == ring_size)
+      {
+        src_index = 0UL;
+      }
+    }
 
-  return tmp_hal_status;
+    pcapture->Triggered = 0UL;
+    pcapture->CapturePending = 1UL;
+    pcapture->CaptureCount++;
+
+#if (USE_HAL_ADC_REGISTER_CALLBACKS == 1)
+    hadc->ConvCpltCallback(hadc);
+#else
+    HAL_ADC_ConvCpltCallback(hadc);
+#endif /* USE_HAL_ADC_REGISTER_CALLBACKS */
+  }
 }
 
 /**
-  * @brief  Enter ADC deep-power-down mode
-  * @note   This mode is achieved in setting DEEPPWD bit and allows to save power
-  *         in reducing leakage currents. It is particularly interesting before
-  *         entering stop modes.
-  * @note   Setting DEEPPWD automatically clears ADVREGEN bit and disables the
-  *         ADC voltage regulator. This means that this API encompasses
-  *         HAL_ADCEx_DisableVoltageRegulator(). Additionally, the internal
-  *         calibration is lost.
-  * @note   To exit the ADC deep-power-down mode, the user is expected to
-  *         resort to HAL_ADC_Init() API as well as to relaunch a calibration
-  *         with HAL_ADCEx_Calibration_Start() API or to re-apply a previously
-  *         saved calibration factor.
-  * @param hadc ADC handle
-  * @retval HAL status
+  * @brief  DMA half transfer and transfer complete callback of the threshold triggered capture.
+  * @param hdma pointer to DMA handle.
+  * @retval None
   */
-HAL_StatusTypeDef HAL_ADCEx_EnterADCDeepPowerDownMode(ADC_HandleTypeDef *hadc)
+static void ADCEx_DMACaptureUpdate(DMA_HandleTypeDef *hdma)
 {
-  HAL_StatusTypeDef tmp_hal_status;
+  /* Retrieve ADC handle corresponding to current DMA handle */
+  ADC_HandleTypeDef *hadc = (ADC_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
 
-  /* Check the parameters */
-  assert_param(IS_ADC_ALL_INSTANCE(hadc->Instance));
+  ADCEx_ThresholdCaptureUpdate(hadc);
+}
 
-  /* Setting of this feature is conditioned to ADC state: ADC must be ADC disabled */
-  if (LL_ADC_IsEnabled(hadc->Instance) == 0UL)
-  {
-    LL_ADC_EnableDeepPowerDown(hadc->Instance);
-    tmp_hal_status = HAL_OK;
-  }
-  else
+/**
+  * @brief  Analog watchdog event of a threshold triggered capture, called from HAL_ADC_IRQHandler().
+  * @note   The conversion out of the window is located in the ring buffer by stepping back over the conversions
+  *         transferred during the interrupt latency, up to the last one inside the window.
+  * @param hadc ADC handle
+  * @retval None
+  */
+void ADCEx_ThresholdCaptureTrigger(ADC_HandleTypeDef *hadc)
+{
+  ADC_ThresholdCaptureTypeDef *pcapture = hadc->pThresholdCapture;
+  uint32_t ring_size = pcapture->RingSize;
+  uint32_t trigger_index;
+  uint32_t prev_index;
+  uint32_t prev_data;
+  uint32_t count;
+
+  /* Single trigger until rearmed */
+  __HAL_ADC_DISABLE_IT(hadc, ADCEx_ThresholdCaptureIT(pcapture));
+
+  trigger_index = ((ADCEx_ThresholdCaptureWriteIndex(hadc) + ring_size) - 1UL) % ring_size;
+  for (count = 0UL; count < (ring_size / 2UL); count++)
   {
-    tmp_hal_status = HAL_ERROR;
+    prev_index = ((trigger_index + ring_size) - 1UL) % ring_size;
+    prev_data = pcapture->pRingBuffer[prev_index];
+    if ((prev_data <= pcapture->HighThreshold) && (prev_data >= pcapture->LowThreshold))
+    {
+      break;
+    }
+    trigger_index = prev_index;
   }
 
-  return tmp_hal_status;
-}
+  pcapture->TriggerIndex = trigger_index;
+  pcapture->WriteIndex = trigger_index;
+  pcapture->PostCount = 0UL;
+  pcapture->Triggered = 1UL;
 
-/**
-  * @}
-  */
+  /* Complete the capture immediately if the post-trigger conversions are already written */
+  ADCEx_ThresholdCaptureUpdate(hadc);
+}
 
 /**
   * @}
@@ -292,6 +292,12 @@ static HAL_StatusTypeDef PKA_ECDSAVerif(CCB_HandleTypeDef *hccb, CCB_ECDSACurveP
                                         CCB_ECCMulPointTypeDef *pPublicKeyOut, const uint8_t *pHash,
                                         CCB_ECDSASignTypeDef *pSignature);
 static uint32_t PKA_ECDSAVerif_Result(CCB_HandleTypeDef *hccb);
+static HAL_StatusTypeDef CCB_ECDSA_SignStart(CCB_HandleTypeDef *hccb, CCB_ECDSACurveParamTypeDef *pCurveParam,
+                                             CCB_WrappingKeyTypeDef *pWrappingKey,
+                                             CCB_ECDSAKeyBlobTypeDef *pWrappedPrivateKeyBlob, const uint8_t *pHash);
+static HAL_StatusTypeDef CCB_ECDSA_SignEnd(CCB_HandleTypeDef *hccb, CCB_ECDSACurveParamTypeDef *pCurveParam,
+                                           CCB_ECDSASignTypeDef *pSignature);
+static HAL_StatusTypeDef CCB_ECDSA_SignStartJob_IT(CCB_HandleTypeDef *hccb);
 static void CCB_PKA_RAMReset(CCB_HandleTypeDef *hccb);
 #if (defined(RNG_HTSR0_RPERRX) || defined(RNG_HTSR1_ADERRX))
 HAL_StatusTypeDef CCB_RNG_ResilientRecoverSeedError(CCB_HandleTypeDef *hccb);
@@ -340,6 +346,9 @@ HAL_StatusTypeDef HAL_CCB_Init(CCB_HandleTypeDef *hccb)
   /* PKA RAM RESET*/
   CCB_PKA_RAMReset(hccb);
 
+  /* No ECDSA signature jobs queue ongoing */
+  hccb->pSignJobs = NULL;
+
   /* Update the CCB state */
   hccb->State = HAL_CCB_STATE_READY;
 
@@ -476,6 +485,10 @@ uint32_t HAL_CCB_GetOperationError(const CCB_HandleTypeDef *hccb)
     (#) There are three type of CCB/PKA protected operations:
        (++) ECDSA sign : The operation is performed in the polling mode.
             These functions return when data operation is completed.
+            HAL_CCB_ECDSA_Sign_IT() processes a queue of signature jobs, the CPU is released
+            during the PKA computation of each job. HAL_CCB_IRQHandler() must be called from
+            the PKA interrupt handler, the end of the queue is indicated by
+            HAL_CCB_ECDSA_SignCpltCallback(), an error by HAL_CCB_ErrorCallback().
        (++) ECC Scalar Multiplication : The operation is performed using Interrupts.
             These functions return immediately.
             The end of the operation is indicated by HAL_PKA_ErrorCallback in case of error.
@@ -491,6 +504,7 @@ uint32_t HAL_CCB_GetOperationError(const CCB_HandleTypeDef *hccb)
        (++) HAL_CCB_ECDSA_WrapPrivateKey()for blob creation.
        (++) HAL_CCB_ECDSA_GenerateWrapPrivateKey()for blob creation.
        (++) HAL_CCB_ECDSA_Sign() for blob usage.
+       (++) HAL_CCB_ECDSA_Sign_IT() for blob usage of a queue of signature jobs.
        (++) HAL_CCB_ECDSA_ComputePublicKey() for blob usage.
 
     (#) ECC Scalar Multiplication functions are :
@@ -1086,267 +1100,74 @@ HAL_StatusTypeDef HAL_CCB_ECDSA_Sign(CCB_HandleTypeDef *hccb, CCB_ECDSACurvePara
                                      CCB_ECDSASignTypeDef *pSignature)
 
 {
-  uint32_t count;
-  uint32_t count_block = 0;
-  uint32_t offset;
-  uint32_t operand_size;
-  uint32_t cipherkey_size;
-
   if (hccb->State == HAL_CCB_STATE_READY)
   {
-    /* Set Operation in CCB */
-    MODIFY_REG(CCB->CR, CCB_CR_CCOP, CCB_ECDSA_SIGN_BLOB_USE);
-
-    /* Wait until OPSTEP is set to 0x01 */
-    if (CCB_WaitOperStep(hccb, 0x01, HAL_CCB_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
-    {
-      /* return error */
-      return HAL_ERROR;
-    }
-
-    /* Initialize RNG */
-    if (CCB_RNG_Init(hccb) != HAL_OK)
-    {
-      /* Set state and return error */
-      hccb->State = HAL_CCB_STATE_ERROR;
-      return HAL_ERROR;
-    }
-
-    /* Initialize PKA */
-    if (Protect_PKA_Init(hccb, CCB_ECDSA_SIGN_BLOB_USE) != HAL_OK)
-    {
-      /* Set state and return error */
-      hccb->State = HAL_CCB_STATE_ERROR;
-      return HAL_ERROR;
-    }
-
-    /*  Initialize SAES */
-    if (Protect_SAES_WaitFLAG(hccb, AES_SR_BUSY, RESET, HAL_CCB_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
-    {
-#if (defined(RNG_HTSR0_RPERRX) || defined(RNG_HTSR1_ADERRX))
-      /*Check if there is an RNG seed error */
-      if (LL_RNG_IsActiveFlag_SECS(RNG) != 0U)
-      {
-        /* Attempt to recover from the seed error */
-        if (CCB_RNG_ResilientRecoverSeedError(hccb) != HAL_OK)
-        {
-          /* Disable the SAES peripheral */
-          HAL_CCB_GET_SAES_INSTANCE(hccb)->CR &=  ~AES_CR_EN;
-
-          /* Set state and return error */
-          hccb->State = HAL_CCB_STATE_ERROR;
-          return HAL_ERROR;
-        }
-      }
-#endif /* RNG_HTSR0_RPERRX || RNG_HTSR1_ADERRX */
-    }
-
-    /* Update the state */
-    hccb->State = HAL_CCB_STATE_BUSY;
-
-    /* Wrapping Key configuration */
-    if (WrappingKeyConfiguration(hccb, CCB_ECDSA_SIGN_BLOB_USE, pWrappingKey) != HAL_OK)
-    {
-      /* Set state, error code and return error */
-      return HAL_ERROR;
-    }
-
-    /* Wait until OPSTEP is set to 0x012 */
-    if (CCB_WaitOperStep(hccb, 0x012, HAL_CCB_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
-    {
-      /* return error */
-      return HAL_ERROR;
-    }
-
-    /* Update the state */
-    hccb->State = HAL_CCB_STATE_BUSY;
-
-    /* set operand size (in word 32bits)*/
-
-    operand_size = 2UL * ((uint32_t)(((pCurveParam->modulusSizeByte) + 7UL) / 8UL) + 1UL);
-
-    if ((operand_size % 4UL) != 0UL)
-    {
-      cipherkey_size = operand_size - 2UL;
-    }
-    else
-    {
-      cipherkey_size = operand_size;
-    }
-
-    /* Set Hash message */
-    CCB_Memcpy_u8_to_u32(&HAL_CCB_GET_PKA_INSTANCE(hccb)->RAM[PKA_ECDSA_SIGN_IN_HASH_E ], pHash,
-                         pCurveParam->modulusSizeByte);
-
-    /* Initial Phase Processing */
-    if (CCB_BlobUse_InitialPhase(hccb, pWrappedPrivateKeyBlob->pIV, pWrappedPrivateKeyBlob->pTag) != HAL_OK)
-    {
-      /* return error */
-      return HAL_ERROR;
-    }
-
-    /* Wait until OPSTEP is set to 0x13 */
-    if (CCB_WaitOperStep(hccb, 0x13, HAL_CCB_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
-    {
-      /* return error */
-      return HAL_ERROR;
-    }
-
-    /* Set ECDSA parameters */
-    if (CCB_ECDSASign_SetPram(hccb, pCurveParam) != HAL_OK)
-    {
-      /* return error */
-      return HAL_ERROR;
-    }
-
-    /* Set SAES GCMPH Payload phase and trig OPSTEP that trig OPSTEP transition 0x13 --> 0x14 */
-    MODIFY_REG(HAL_CCB_GET_SAES_INSTANCE(hccb)->CR, AES_CR_GCMPH, AES_CR_GCMPH_1);
-
-    /* Wait until OPSTEP is set to 0x14 */
-    if (CCB_WaitOperStep(hccb, 0x14, HAL_CCB_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
-    {
-      /* return error */
-      return HAL_ERROR;
-    }
-
-    /* Write encrypted Key*/
-    for (offset = 0UL; offset < cipherkey_size; offset++)
-    {
-      WRITE_REG(HAL_CCB_GET_SAES_INSTANCE(hccb)->DINR, \
-                pWrappedPrivateKeyBlob->pWrappedKey[cipherkey_size - (offset + 1UL)]);
-
-      if ((offset % 4UL) == 0x3UL)
-      {
-        /* Wait until CCF flag is SET in SAES */
-        if (Protect_SAES_WaitFLAG(hccb, AES_ISR_CCF, SET, HAL_CCB_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
-        {
-          /* return error */
-          return HAL_ERROR;
-        }
-
-        /* Write key in PKA RAM */
-        for (count = 0UL; count < 4UL; count++)
-        {
-          HAL_CCB_GET_PKA_INSTANCE(hccb)->RAM[PKA_ECDSA_SIGN_IN_PRIVATE_KEY_D + count_block + count] = CCB_MAGIC_VALUE;
-        }
-        count_block += 4UL;
-      }
-    }
-
-    if ((operand_size % 4UL) != 0UL)
-    {
-      RAM_PARAM_END(HAL_CCB_GET_PKA_INSTANCE(hccb)->RAM, PKA_ECDSA_SIGN_IN_PRIVATE_KEY_D + cipherkey_size);
-    }
-    /* Wait until DATAOKF flag is SET in PKA and trig OPSTEP transition 0x14 --> 0x16 */
-    if (Protect_PKA_WaitFLAG(hccb, PKA_SR_DATAOKF, HAL_CCB_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
-    {
-      /* return error */
-      return HAL_ERROR;
-    }
-
-    /* Wait until OPSTEP is set to 0x16 */
-    if (CCB_WaitOperStep(hccb, 0x16, HAL_CCB_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+    /* Blob use sequence up to the PKA signature computation start */
+    if (CCB_ECDSA_SignStart(hccb, pCurveParam, pWrappingKey, pWrappedPrivateKeyBlob, pHash) != HAL_OK)
     {
       /* return error */
       return HAL_ERROR;
     }
 
-    /* Write random k */
-    for (offset = 0UL; offset < (operand_size - 2UL); offset++)
-    {
-      /* Wait for RNG Data Ready flag */
-      if (CCB_RNG_Wait_SET_FLAG(hccb, RNG_SR_DRDY, HAL_CCB_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
-      {
-        /* return error */
-        return HAL_ERROR;
-      }
-      HAL_CCB_GET_PKA_INSTANCE(hccb)->RAM[PKA_ECDSA_SIGN_IN_K + offset] = CCB_FAKE_VALUE;
-    }
-
-    /*  Padding at zero */
-    RAM_PARAM_END(HAL_CCB_GET_PKA_INSTANCE(hccb)->RAM, PKA_ECDSA_SIGN_IN_K + offset);
-
-    /* Wait for PKA RNGOK flag : GCMPH = 0x3 (final phase) as events that trig OPSTEP transition 0x16 --> 0x17 */
-    if (Protect_PKA_WaitFLAG(hccb, PKA_SR_RNGOKF, HAL_CCB_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+    /* Wait until end of operation flag is SET in PKA and trig OPSTEP transition 0x19 --> 0x1A */
+    if (Protect_PKA_WaitFLAG(hccb, PKA_SR_PROCENDF, HAL_CCB_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
     {
       /* return error */
       return HAL_ERROR;
     }
 
-    /* Wait until OPSTEP is set to 0x17 */
-    if (CCB_WaitOperStep(hccb, 0x17, HAL_CCB_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
-    {
-      /* return error */
-      return HAL_ERROR;
-    }
+    /* Read the signature and reset the CCB */
+    return CCB_ECDSA_SignEnd(hccb, pCurveParam, pSignature);
+  }
 
-    /* Final phase processing */
-    if (CCB_BlobUse_FinalPhase(hccb, CCB_ECDSA_SIGN_BLOB_USE, pCurveParam->modulusSizeByte) != HAL_OK)
-    {
-      /* return error */
-      return HAL_ERROR;
-    }
+  else
+  {
+    /* Set state, error code and return error */
+    hccb->State = HAL_CCB_STATE_ERROR;
+    hccb->ErrorCode = HAL_CCB_ERROR_INVALID_PARAM;
+    return HAL_ERROR;
+  }
+}
 
-    /* Wait until OPSTEP is set to 0x18 */
-    if (CCB_WaitOperStep(hccb, 0x18, HAL_CCB_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
-    {
-      /* return error */
-      return HAL_ERROR;
-    }
+/**
+  * @brief  Blob Usage: ECDSA Signature of a queue of jobs in interrupt mode.
+  * @note   The CPU is released during the PKA signature computation of each job, the end of
+  *         computation is handled by HAL_CCB_IRQHandler() which starts the next job of the queue.
+  * @note   HAL_CCB_ECDSA_SignCpltCallback() is called once all the jobs are processed,
+  *         HAL_CCB_ErrorCallback() is called when a job fails, the jobs left are not processed.
+  * @param  hccb CCB handle.
+  * @param  pJobs pointer to the array of ECDSA signature jobs.
+  * @param  JobNbr number of jobs.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_CCB_ECDSA_Sign_IT(CCB_HandleTypeDef *hccb, CCB_ECDSASignJobTypeDef *pJobs, uint32_t JobNbr)
+{
+  uint32_t count;
 
-    /* SET PKA START operation bit and trig OPSTEP transition 0x18 --> 0x19 */
-    SET_BIT(HAL_CCB_GET_PKA_INSTANCE(hccb)->CR, PKA_CR_START);
+  if ((pJobs == NULL) || (JobNbr == 0U))
+  {
+    return HAL_ERROR;
+  }
 
-    /* Wait until OPSTEP is set to 0x19 */
-    if (CCB_WaitOperStep(hccb, 0x19, HAL_CCB_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  if (hccb->State == HAL_CCB_STATE_READY)
+  {
+    for (count = 0U; count < JobNbr; count++)
     {
-      /* return error */
-      return HAL_ERROR;
+      pJobs[count].Status = HAL_BUSY;
     }
+    hccb->pSignJobs = pJobs;
+    hccb->SignJobNbr = JobNbr;
+    hccb->SignJobIndex = 0U;
 
-    /* Wait until end of operation flag is SET in PKA and trig OPSTEP transition 0x19 --> 0x1A */
-    if (Protect_PKA_WaitFLAG(hccb, PKA_SR_PROCENDF, HAL_CCB_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+    /* Start the first job */
+    if (CCB_ECDSA_SignStartJob_IT(hccb) != HAL_OK)
     {
-      /* return error */
-      return HAL_ERROR;
-    }
+      pJobs[0].Status = HAL_ERROR;
+      hccb->pSignJobs = NULL;
 
-    /* Wait until OPSTEP is set to 0x1A */
-    if (CCB_WaitOperStep(hccb, 0x1A, HAL_CCB_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
-    {
       /* return error */
       return HAL_ERROR;
     }
-
-    /* Check PKA Operation error result */
-    if ((HAL_CCB_GET_PKA_INSTANCE(hccb)->RAM[PKA_ECDSA_SIGN_OUT_ERROR]) !=  CCB_PKA_ERROR_OPERATION_NONE)
-    {
-      /* Set state and return error */
-      hccb->State = HAL_CCB_STATE_ERROR;
-      return HAL_ERROR;
-    }
-    /* Read r part signature */
-    CCB_Memcpy_u32_to_u8(pSignature->pRSign, &HAL_CCB_GET_PKA_INSTANCE(hccb)->RAM[PKA_ECDSA_SIGN_OUT_SIGNATURE_R],
-                         pCurveParam->modulusSizeByte);
-    /* Read s part signature */
-    CCB_Memcpy_u32_to_u8(pSignature->pSSign, &HAL_CCB_GET_PKA_INSTANCE(hccb)->RAM[PKA_ECDSA_SIGN_OUT_SIGNATURE_S],
-                         pCurveParam->modulusSizeByte);
-
-
-    /* set CCB IPRST  */
-    SET_BIT(hccb->Instance->CR, CCB_CR_IPRST);
-
-    /* CCB is busy while CCB IPRST is in progress */
-    if (CCB_WaitFLAG(hccb, CCB_SR_BUSY, HAL_CCB_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
-    {
-      return HAL_TIMEOUT;
-    }
-
-    /* clear CCB IPRST */
-    CLEAR_BIT(hccb->Instance->CR, CCB_CR_IPRST);
-
-    /* Update the CCB state */
-    hccb->State = HAL_CCB_STATE_READY;
   }
 
   else
@@ -1869,15 +1690,404 @@ __weak void HAL_CCB_IntrusionCallback(CCB_HandleTypeDef *hccb)
             the HAL_CCB_IntrusionCallback could be implemented in the user file
    */
 }
+
 /**
-  * @}
+  * @brief  Handle the end of the PKA computation of the ECDSA signature jobs queue.
+  * @note   This function must be called from the PKA interrupt handler.
+  * @param  hccb CCB handle
+  * @retval None
+  */
+void HAL_CCB_IRQHandler(CCB_HandleTypeDef *hccb)
+{
+  CCB_ECDSASignJobTypeDef *job;
+
+  if ((hccb->pSignJobs == NULL) || \
+      (HAL_IS_BIT_CLR(HAL_CCB_GET_PKA_INSTANCE(hccb)->CR, PKA_CR_PROCENDIE)) || \
+      (HAL_IS_BIT_CLR(HAL_CCB_GET_PKA_INSTANCE(hccb)->SR, PKA_SR_PROCENDF)))
+  {
+    return;
+  }
+
+  /* Clear the end of operation flag and disable its interrupt, trig OPSTEP transition 0x19 --> 0x1A */
+  CLEAR_BIT(HAL_CCB_GET_PKA_INSTANCE(hccb)->CR, PKA_CR_PROCENDIE);
+  SET_BIT(HAL_CCB_GET_PKA_INSTANCE(hccb)->CLRFR, PKA_SR_PROCENDF);
+
+  job = &hccb->pSignJobs[hccb->SignJobIndex];
+  job->Status = CCB_ECDSA_SignEnd(hccb, job->pCurveParam, job->pSignature);
+  if (job->Status == HAL_OK)
+  {
+    hccb->SignJobIndex++;
+    if (hccb->SignJobIndex < hccb->SignJobNbr)
+    {
+      /* Start the next job of the queue */
+      if (CCB_ECDSA_SignStartJob_IT(hccb) != HAL_OK)
+      {
+        hccb->pSignJobs[hccb->SignJobIndex].Status = HAL_ERROR;
+        hccb->pSignJobs = NULL;
+        HAL_CCB_ErrorCallback(hccb);
+      }
+    }
+    else
+    {
+      /* All the jobs are processed */
+      hccb->pSignJobs = NULL;
+      HAL_CCB_ECDSA_SignCpltCallback(hccb);
+    }
+  }
+  else
+  {
+    job->Status = HAL_ERROR;
+    hccb->pSignJobs = NULL;
+    HAL_CCB_ErrorCallback(hccb);
+  }
+}
+
+/**
+  * @brief  ECDSA signature jobs queue completed callback.
+  * @param  hccb CCB handle
+  * @retval None
   */
+__weak void HAL_CCB_ECDSA_SignCpltCallback(CCB_HandleTypeDef *hccb)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hccb);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_CCB_ECDSA_SignCpltCallback could be implemented in the user file
+   */
+}
 
 /**
-  * @}
+  * @brief  CCB error callback in interrupt mode.
+  * @param  hccb CCB handle
+  * @retval None
   */
+__weak void HAL_CCB_ErrorCallback(CCB_HandleTypeDef *hccb)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hccb);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_CCB_ErrorCallback could be implemented in the user file
+   */
+}
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  ECDSA Signature blob use sequence up to the start of the PKA signature computation.
+  * @param  hccb CCB handle.
+  * @param  pCurveParam pointer to the Curve parameters.
+  * @param  pWrappingKey pointer to the Wrapping Key structure.
+  * @param  pWrappedPrivateKeyBlob pointer to the related wrapped Private Key Blob.
+  * @param  pHash pointer to the Hash.
+  * @retval HAL status.
+  */
+static HAL_StatusTypeDef CCB_ECDSA_SignStart(CCB_HandleTypeDef *hccb, CCB_ECDSACurveParamTypeDef *pCurveParam,
+                                             CCB_WrappingKeyTypeDef *pWrappingKey,
+                                             CCB_ECDSAKeyBlobTypeDef *pWrappedPrivateKeyBlob, const uint8_t *pHash)
+{
+  uint32_t count;
+  uint32_t count_block = 0;
+  uint32_t offset;
+  uint32_t operand_size;
+  uint32_t cipherkey_size;
+
+  /* Set Operation in CCB */
+  MODIFY_REG(CCB->CR, CCB_CR_CCOP, CCB_ECDSA_SIGN_BLOB_USE);
+
+  /* Wait until OPSTEP is set to 0x01 */
+  if (CCB_WaitOperStep(hccb, 0x01, HAL_CCB_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    /* return error */
+    return HAL_ERROR;
+  }
+
+  /* Initialize RNG */
+  if (CCB_RNG_Init(hccb) != HAL_OK)
+  {
+    /* Set state and return error */
+    hccb->State = HAL_CCB_STATE_ERROR;
+    return HAL_ERROR;
+  }
+
+  /* Initialize PKA */
+  if (Protect_PKA_Init(hccb, CCB_ECDSA_SIGN_BLOB_USE) != HAL_OK)
+  {
+    /* Set state and return error */
+    hccb->State = HAL_CCB_STATE_ERROR;
+    return HAL_ERROR;
+  }
+
+  /*  Initialize SAES */
+  if (Protect_SAES_WaitFLAG(hccb, AES_SR_BUSY, RESET, HAL_CCB_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+#if (defined(RNG_HTSR0_RPERRX) || defined(RNG_HTSR1_ADERRX))
+    /*Check if there is an RNG seed error */
+    if (LL_RNG_IsActiveFlag_SECS(RNG) != 0U)
+    {
+      /* Attempt to recover from the seed error */
+      if (CCB_RNG_ResilientRecoverSeedError(hccb) != HAL_OK)
+      {
+        /* Disable the SAES peripheral */
+        HAL_CCB_GET_SAES_INSTANCE(hccb)->CR &=  ~AES_CR_EN;
+
+        /* Set state and return error */
+        hccb->State = HAL_CCB_STATE_ERROR;
+        return HAL_ERROR;
+      }
+    }
+#endif /* RNG_HTSR0_RPERRX || RNG_HTSR1_ADERRX */
+  }
+
+  /* Update the state */
+  hccb->State = HAL_CCB_STATE_BUSY;
+
+  /* Wrapping Key configuration */
+  if (WrappingKeyConfiguration(hccb, CCB_ECDSA_SIGN_BLOB_USE, pWrappingKey) != HAL_OK)
+  {
+    /* Set state, error code and return error */
+    return HAL_ERROR;
+  }
+
+  /* Wait until OPSTEP is set to 0x012 */
+  if (CCB_WaitOperStep(hccb, 0x012, HAL_CCB_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    /* return error */
+    return HAL_ERROR;
+  }
+
+  /* Update the state */
+  hccb->State = HAL_CCB_STATE_BUSY;
+
+  /* set operand size (in word 32bits)*/
+
+  operand_size = 2UL * ((uint32_t)(((pCurveParam->modulusSizeByte) + 7UL) / 8UL) + 1UL);
+
+  if ((operand_size % 4UL) != 0UL)
+  {
+    cipherkey_size = operand_size - 2UL;
+  }
+  else
+  {
+    cipherkey_size = operand_size;
+  }
+
+  /* Set Hash message */
+  CCB_Memcpy_u8_to_u32(&HAL_CCB_GET_PKA_INSTANCE(hccb)->RAM[PKA_ECDSA_SIGN_IN_HASH_E ], pHash,
+                       pCurveParam->modulusSizeByte);
+
+  /* Initial Phase Processing */
+  if (CCB_BlobUse_InitialPhase(hccb, pWrappedPrivateKeyBlob->pIV, pWrappedPrivateKeyBlob->pTag) != HAL_OK)
+  {
+    /* return error */
+    return HAL_ERROR;
+  }
+
+  /* Wait until OPSTEP is set to 0x13 */
+  if (CCB_WaitOperStep(hccb, 0x13, HAL_CCB_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    /* return error */
+    return HAL_ERROR;
+  }
+
+  /* Set ECDSA parameters */
+  if (CCB_ECDSASign_SetPram(hccb, pCurveParam) != HAL_OK)
+  {
+    /* return error */
+    return HAL_ERROR;
+  }
+
+  /* Set SAES GCMPH Payload phase and trig OPSTEP that trig OPSTEP transition 0x13 --> 0x14 */
+  MODIFY_REG(HAL_CCB_GET_SAES_INSTANCE(hccb)->CR, AES_CR_GCMPH, AES_CR_GCMPH_1);
+
+  /* Wait until OPSTEP is set to 0x14 */
+  if (CCB_WaitOperStep(hccb, 0x14, HAL_CCB_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    /* return error */
+    return HAL_ERROR;
+  }
+
+  /* Write encrypted Key*/
+  for (offset = 0UL; offset < cipherkey_size; offset++)
+  {
+    WRITE_REG(HAL_CCB_GET_SAES_INSTANCE(hccb)->DINR, \
+              pWrappedPrivateKeyBlob->pWrappedKey[cipherkey_size - (offset + 1UL)]);
+
+    if ((offset % 4UL) == 0x3UL)
+    {
+      /* Wait until CCF flag is SET in SAES */
+      if (Protect_SAES_WaitFLAG(hccb, AES_ISR_CCF, SET, HAL_CCB_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+      {
+        /* return error */
+        return HAL_ERROR;
+      }
+
+      /* Write key in PKA RAM */
+      for (count = 0UL; count < 4UL; count++)
+      {
+        HAL_CCB_GET_PKA_INSTANCE(hccb)->RAM[PKA_ECDSA_SIGN_IN_PRIVATE_KEY_D + count_block + count] = CCB_MAGIC_VALUE;
+      }
+      count_block += 4UL;
+    }
+  }
+
+  if ((operand_size % 4UL) != 0UL)
+  {
+    RAM_PARAM_END(HAL_CCB_GET_PKA_INSTANCE(hccb)->RAM, PKA_ECDSA_SIGN_IN_PRIVATE_KEY_D + cipherkey_size);
+  }
+  /* Wait until DATAOKF flag is SET in PKA and trig OPSTEP transition 0x14 --> 0x16 */
+  if (Protect_PKA_WaitFLAG(hccb, PKA_SR_DATAOKF, HAL_CCB_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    /* return error */
+    return HAL_ERROR;
+  }
+
+  /* Wait until OPSTEP is set to 0x16 */
+  if (CCB_WaitOperStep(hccb, 0x16, HAL_CCB_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    /* return error */
+    return HAL_ERROR;
+  }
+
+  /* Write random k */
+  for (offset = 0UL; offset < (operand_size - 2UL); offset++)
+  {
+    /* Wait for RNG Data Ready flag */
+    if (CCB_RNG_Wait_SET_FLAG(hccb, RNG_SR_DRDY, HAL_CCB_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+    {
+      /* return error */
+      return HAL_ERROR;
+    }
+    HAL_CCB_GET_PKA_INSTANCE(hccb)->RAM[PKA_ECDSA_SIGN_IN_K + offset] = CCB_FAKE_VALUE;
+  }
+
+  /*  Padding at zero */
+  RAM_PARAM_END(HAL_CCB_GET_PKA_INSTANCE(hccb)->RAM, PKA_ECDSA_SIGN_IN_K + offset);
+
+  /* Wait for PKA RNGOK flag : GCMPH = 0x3 (final phase) as events that trig OPSTEP transition 0x16 --> 0x17 */
+  if (Protect_PKA_WaitFLAG(hccb, PKA_SR_RNGOKF, HAL_CCB_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    /* return error */
+    return HAL_ERROR;
+  }
+
+  /* Wait until OPSTEP is set to 0x17 */
+  if (CCB_WaitOperStep(hccb, 0x17, HAL_CCB_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    /* return error */
+    return HAL_ERROR;
+  }
+
+  /* Final phase processing */
+  if (CCB_BlobUse_FinalPhase(hccb, CCB_ECDSA_SIGN_BLOB_USE, pCurveParam->modulusSizeByte) != HAL_OK)
+  {
+    /* return error */
+    return HAL_ERROR;
+  }
+
+  /* Wait until OPSTEP is set to 0x18 */
+  if (CCB_WaitOperStep(hccb, 0x18, HAL_CCB_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    /* return error */
+    return HAL_ERROR;
+  }
+
+  /* SET PKA START operation bit and trig OPSTEP transition 0x18 --> 0x19 */
+  SET_BIT(HAL_CCB_GET_PKA_INSTANCE(hccb)->CR, PKA_CR_START);
+
+  /* Wait until OPSTEP is set to 0x19 */
+  if (CCB_WaitOperStep(hccb, 0x19, HAL_CCB_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    /* return error */
+    return HAL_ERROR;
+  }
+
+  /* Return HAL OK */
+  return HAL_OK;
+}
+
+/**
+  * @brief  ECDSA Signature blob use sequence after the end of the PKA signature computation.
+  * @param  hccb CCB handle.
+  * @param  pCurveParam pointer to the Curve parameters.
+  * @param  pSignature pointer to the signature.
+  * @retval HAL status.
+  */
+static HAL_StatusTypeDef CCB_ECDSA_SignEnd(CCB_HandleTypeDef *hccb, CCB_ECDSACurveParamTypeDef *pCurveParam,
+                                           CCB_ECDSASignTypeDef *pSignature)
+{
+  /* Wait until OPSTEP is set to 0x1A */
+  if (CCB_WaitOperStep(hccb, 0x1A, HAL_CCB_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    /* return error */
+    return HAL_ERROR;
+  }
+
+  /* Check PKA Operation error result */
+  if ((HAL_CCB_GET_PKA_INSTANCE(hccb)->RAM[PKA_ECDSA_SIGN_OUT_ERROR]) !=  CCB_PKA_ERROR_OPERATION_NONE)
+  {
+    /* Set state and return error */
+    hccb->State = HAL_CCB_STATE_ERROR;
+    return HAL_ERROR;
+  }
+  /* Read r part signature */
+  CCB_Memcpy_u32_to_u8(pSignature->pRSign, &HAL_CCB_GET_PKA_INSTANCE(hccb)->RAM[PKA_ECDSA_SIGN_OUT_SIGNATURE_R],
+                       pCurveParam->modulusSizeByte);
+  /* Read s part signature */
+  CCB_Memcpy_u32_to_u8(pSignature->pSSign, &HAL_CCB_GET_PKA_INSTANCE(hccb)->RAM[PKA_ECDSA_SIGN_OUT_SIGNATURE_S],
+                       pCurveParam->modulusSizeByte);
+
+
+  /* set CCB IPRST  */
+  SET_BIT(hccb->Instance->CR, CCB_CR_IPRST);
+
+  /* CCB is busy while CCB IPRST is in progress */
+  if (CCB_WaitFLAG(hccb, CCB_SR_BUSY, HAL_CCB_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return HAL_TIMEOUT;
+  }
+
+  /* clear CCB IPRST */
+  CLEAR_BIT(hccb->Instance->CR, CCB_CR_IPRST);
+
+  /* Update the CCB state */
+  hccb->State = HAL_CCB_STATE_READY;
+
+  /* Return HAL OK */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Start the current job of the ECDSA signature jobs queue and enable the PKA end of
+  *         operation interrupt.
+  * @param  hccb CCB handle.
+  * @retval HAL status.
+  */
+static HAL_StatusTypeDef CCB_ECDSA_SignStartJob_IT(CCB_HandleTypeDef *hccb)
+{
+  const CCB_ECDSASignJobTypeDef *job = &hccb->pSignJobs[hccb->SignJobIndex];
+
+  if (CCB_ECDSA_SignStart(hccb, job->pCurveParam, job->pWrappingKey, job->pWrappedPrivateKeyBlob,
+                          job->pHash) != HAL_OK)
+  {
+    /* return error */
+    return HAL_ERROR;
+  }
+
+  /* The end of the signature computation is handled by HAL_CCB_IRQHandler() */
+  SET_BIT(HAL_CCB_GET_PKA_INSTANCE(hccb)->CR, PKA_CR_PROCENDIE);
+
+  /* Return HAL OK */
+  return HAL_OK;
+}
 
-/* Private functions ---------------------------------------------------------*/
 /**
   * @brief  Wait CCB Operation step
   * @param  hccb CCB handle
@@ -138,6 +138,8 @@
 /** @defgroup CEC_Private_Functions CEC Private Functions
   * @{
   */
+static void CEC_TxQueueRelease(CEC_HandleTypeDef *hcec);
+static void CEC_TxQueueNext(CEC_HandleTypeDef *hcec);
 /**
   * @}
   */
@@ -260,6 +262,8 @@ HAL_StatusTypeDef HAL_CEC_Init(CEC_HandleTypeDef *hcec)
   __HAL_CEC_ENABLE(hcec);
 
   hcec->ErrorCode = HAL_CEC_ERROR_NONE;
+  hcec->pRxRing = NULL;
+  hcec->pTxQueue = NULL;
   hcec->gState = HAL_CEC_STATE_READY;
   hcec->RxState = HAL_CEC_STATE_READY;
 
@@ -674,6 +678,16 @@ HAL_StatusTypeDef HAL_CEC_UnRegisterRxCpltCallback(CEC_HandleTypeDef *hcec)
          (+) HAL_CEC_Transmit_IT()
          (+) HAL_CEC_IRQHandler()
 
+    (#) Frames can also be buffered by the driver, the IRQ handler then keeps
+        reception and transmission running without any re-arming from the application:
+         (+) HAL_CEC_EnableRxRing() hands a ring of CEC_FrameTypeDef slots to the driver;
+             each received frame is committed to the ring and read back with
+             HAL_CEC_ReadFrame(). Frames received while the ring is full are dropped
+             and counted in RxRingDropCount.
+         (+) HAL_CEC_EnableTxQueue() hands a queue of CEC_FrameTypeDef slots to the driver;
+             HAL_CEC_Transmit_Queue() copies a frame into the queue and the next queued
+             frame is sent as soon as the previous one is completed or failed.
+
     (#) A set of User Callbacks are provided:
          (+) HAL_CEC_TxCpltCallback()
          (+) HAL_CEC_RxCpltCallback()
@@ -767,6 +781,162 @@ void HAL_CEC_ChangeRxBuffer(CEC_HandleTypeDef *hcec, uint8_t *Rxbuffer)
   hcec->Init.RxBuffer = Rxbuffer;
 }
 
+/**
+  * @brief Hand a ring of frame slots to the driver for reception.
+  * @param hcec CEC handle
+  * @param pFrames pointer to the frame slots
+  * @param FrameNbr number of frame slots, at least 2 (one slot is always being filled)
+  * @note  Once enabled, received frames are stored in the ring by HAL_CEC_IRQHandler()
+  *        and HAL_CEC_ChangeRxBuffer() must no longer be used.
+  *        HAL_CEC_RxCpltCallback() is still called for each committed frame.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CEC_EnableRxRing(CEC_HandleTypeDef *hcec, CEC_FrameTypeDef *pFrames, uint32_t FrameNbr)
+{
+  if ((pFrames == NULL) || (FrameNbr < 2U) || (FrameNbr > 0xFFFFU))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hcec->RxState != HAL_CEC_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hcec);
+
+  __HAL_CEC_DISABLE_IT(hcec, CEC_IT_RXBR | CEC_IT_RXEND | CEC_IER_RX_ALL_ERR);
+
+  hcec->RxRingSize = (uint16_t)FrameNbr;
+  hcec->RxRingHead = 0U;
+  hcec->RxRingTail = 0U;
+  hcec->RxRingDropCount = 0U;
+  hcec->RxXferSize = 0U;
+  hcec->pRxRing = pFrames;
+  hcec->Init.RxBuffer = pFrames[0].Data;
+
+  __HAL_CEC_ENABLE_IT(hcec, CEC_IT_RXBR | CEC_IT_RXEND | CEC_IER_RX_ALL_ERR);
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hcec);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief Read the oldest frame of the Rx ring.
+  * @param hcec CEC handle
+  * @param pFrame pointer to the frame receiving the copy
+  * @retval HAL status, HAL_ERROR when the ring is empty or not enabled
+  */
+HAL_StatusTypeDef HAL_CEC_ReadFrame(CEC_HandleTypeDef *hcec, CEC_FrameTypeDef *pFrame)
+{
+  uint32_t tail;
+
+  if ((pFrame == NULL) || (hcec->pRxRing == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  tail = hcec->RxRingTail;
+  if (tail == hcec->RxRingHead)
+  {
+    return HAL_ERROR;
+  }
+
+  *pFrame = hcec->pRxRing[tail];
+
+  /* Only the application moves the tail, the IRQ handler only moves the head */
+  tail++;
+  hcec->RxRingTail = (uint16_t)((tail == hcec->RxRingSize) ? 0U : tail);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief Hand a queue of frame slots to the driver for transmission.
+  * @param hcec CEC handle
+  * @param pFrames pointer to the frame slots
+  * @param FrameNbr number of frame slots, at least 2
+  * @note  One slot is kept free to tell a full queue from an empty one.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CEC_EnableTxQueue(CEC_HandleTypeDef *hcec, CEC_FrameTypeDef *pFrames, uint32_t FrameNbr)
+{
+  if ((pFrames == NULL) || (FrameNbr < 2U) || (FrameNbr > 0xFFFFU))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hcec->gState != HAL_CEC_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  hcec->TxQueueSize = (uint16_t)FrameNbr;
+  hcec->TxQueueHead = 0U;
+  hcec->TxQueueTail = 0U;
+  hcec->pTxQueue = pFrames;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief Queue a frame for transmission in interrupt mode.
+  * @param hcec CEC handle
+  * @param InitiatorAddress Initiator address
+  * @param DestinationAddress destination logical address
+  * @param pData pointer to input byte data buffer, copied into the queue
+  * @param Size amount of data to be sent in bytes (without counting the header).
+  *              0 means only the header is sent (ping operation).
+  * @note  Transmission starts immediately when no frame is being sent,
+  *        otherwise the frame is sent from HAL_CEC_IRQHandler() once its turn comes.
+  * @note  HAL_CEC_Transmit_IT() must not be used while the Tx queue is enabled.
+  * @retval HAL status, HAL_BUSY when the queue is full
+  */
+HAL_StatusTypeDef HAL_CEC_Transmit_Queue(CEC_HandleTypeDef *hcec, uint8_t InitiatorAddress,
+                                         uint8_t DestinationAddress, const uint8_t *pData, uint32_t Size)
+{
+  CEC_FrameTypeDef *pframe;
+  uint32_t head;
+  uint32_t next;
+  uint32_t i;
+
+  if ((hcec->pTxQueue == NULL) || ((pData == NULL) && (Size > 0U)) || (Size >= CEC_FRAME_MAX_SIZE))
+  {
+    return HAL_ERROR;
+  }
+
+  assert_param(IS_CEC_ADDRESS(DestinationAddress));
+  assert_param(IS_CEC_ADDRESS(InitiatorAddress));
+
+  head = hcec->TxQueueHead;
+  next = head + 1U;
+  if (next == hcec->TxQueueSize)
+  {
+    next = 0U;
+  }
+  if (next == hcec->TxQueueTail)
+  {
+    return HAL_BUSY;
+  }
+
+  pframe = &hcec->pTxQueue[head];
+  pframe->Size = (uint8_t)(Size + 1U);
+  pframe->Data[0] = (uint8_t)(((uint32_t)InitiatorAddress << CEC_INITIATOR_LSB_POS) | DestinationAddress);
+  for (i = 0U; i < Size; i++)
+  {
+    pframe->Data[i + 1U] = pData[i];
+  }
+
+  /* Publish the frame, then start it if the transmitter is idle */
+  hcec->TxQueueHead = (uint16_t)next;
+  CEC_TxQueueNext(hcec);
+
+  return HAL_OK;
+}
+
 /**
   * @brief This function handles CEC interrupt requests.
   * @param hcec CEC handle
@@ -777,6 +947,8 @@ void HAL_CEC_IRQHandler(CEC_HandleTypeDef *hcec)
 
   /* save interrupts register for further error or interrupts handling purposes */
   uint32_t itflag;
+  uint32_t txdone = 0U;
+  uint32_t head;
   itflag = hcec->Instance->ISR;
 
 
@@ -811,6 +983,26 @@ void HAL_CEC_IRQHandler(CEC_HandleTypeDef *hcec)
     hcec->RxState = HAL_CEC_STATE_READY;
     hcec->ErrorCode = HAL_CEC_ERROR_NONE;
     hcec->Init.RxBuffer -= hcec->RxXferSize;
+    if (hcec->pRxRing != NULL)
+    {
+      /* Commit the frame and move to the next slot, or drop it if the ring is full */
+      head = hcec->RxRingHead;
+      hcec->pRxRing[head].Size = (uint8_t)hcec->RxXferSize;
+      head++;
+      if (head == hcec->RxRingSize)
+      {
+        head = 0U;
+      }
+      if (head != hcec->RxRingTail)
+      {
+        hcec->RxRingHead = (uint16_t)head;
+      }
+      else
+      {
+        hcec->RxRingDropCount++;
+      }
+      hcec->Init.RxBuffer = hcec->pRxRing[hcec->RxRingHead].Data;
+    }
 #if (USE_HAL_CEC_REGISTER_CALLBACKS == 1U)
     hcec->RxCpltCallback(hcec, hcec->RxXferSize);
 #else
@@ -847,6 +1039,8 @@ void HAL_CEC_IRQHandler(CEC_HandleTypeDef *hcec)
     start again the Transmission under the Tx call back API */
     __HAL_UNLOCK(hcec);
     hcec->ErrorCode = HAL_CEC_ERROR_NONE;
+    txdone = 1U;
+    CEC_TxQueueRelease(hcec);
 #if (USE_HAL_CEC_REGISTER_CALLBACKS == 1U)
     hcec->TxCpltCallback(hcec);
 #else
@@ -873,6 +1067,8 @@ void HAL_CEC_IRQHandler(CEC_HandleTypeDef *hcec)
     {
       /* Set the CEC state ready to be able to start again the process */
       hcec->gState = HAL_CEC_STATE_READY;
+      txdone = 1U;
+      CEC_TxQueueRelease(hcec);
     }
     else
     {
@@ -889,6 +1085,12 @@ void HAL_CEC_IRQHandler(CEC_HandleTypeDef *hcec)
   {
     /* Nothing todo*/
   }
+
+  /* Send the next queued frame, if any */
+  if (txdone != 0U)
+  {
+    CEC_TxQueueNext(hcec);
+  }
 }
 
 /**
@@ -986,6 +1188,50 @@ uint32_t HAL_CEC_GetError(const CEC_HandleTypeDef *hcec)
 /**
   * @}
   */
+
+/** @addtogroup CEC_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief Release the queued frame whose transmission just completed or failed.
+  * @param hcec CEC handle
+  * @retval None
+  */
+static void CEC_TxQueueRelease(CEC_HandleTypeDef *hcec)
+{
+  uint32_t tail;
+
+  if ((hcec->pTxQueue != NULL) && (hcec->TxQueueTail != hcec->TxQueueHead))
+  {
+    tail = (uint32_t)hcec->TxQueueTail + 1U;
+    hcec->TxQueueTail = (uint16_t)((tail == hcec->TxQueueSize) ? 0U : tail);
+  }
+}
+
+/**
+  * @brief Start the oldest queued frame if the transmitter is idle.
+  * @param hcec CEC handle
+  * @retval None
+  */
+static void CEC_TxQueueNext(CEC_HandleTypeDef *hcec)
+{
+  const CEC_FrameTypeDef *pframe;
+
+  if ((hcec->pTxQueue != NULL) && (hcec->gState == HAL_CEC_STATE_READY) &&
+      (hcec->TxQueueTail != hcec->TxQueueHead))
+  {
+    pframe = &hcec->pTxQueue[hcec->TxQueueTail];
+    (void)HAL_CEC_Transmit_IT(hcec, (uint8_t)(pframe->Data[0] >> CEC_INITIATOR_LSB_POS),
+                              (uint8_t)(pframe->Data[0] & 0x0FU), &pframe->Data[1],
+                              (uint32_t)pframe->Size - 1U);
+  }
+}
+
+/**
+  * @}
+  */
+
 #endif /* CEC */
 #endif /* HAL_CEC_MODULE_ENABLED */
 /**
@@ -101,6 +101,11 @@
 
       (#) De-initialize the comparator using HAL_COMP_DeInit() function.
 
+      (#) For hardware overcurrent protection, HAL_COMP_ConfigFastTrip() initializes the comparator with
+          a blanking source, connects its output to a timer break input and starts it in one call.
+          HAL_COMP_FastTripSelfTest() forces a trip and measures its latency using a timer input capture.
+          It must be run before locking the comparator configuration.
+
       (#) For safety purpose, comparator configuration can be locked using HAL_COMP_Lock() function.
           The only way to unlock the comparator is a device hardware reset.
 
@@ -200,6 +205,10 @@
 /* Unit: us                                                                   */
 #define COMP_DELAY_VOLTAGE_SCALER_STAB_US (200UL)  /*!< Delay for COMP voltage scaler stabilization time */
 
+/* Timeout for the fast trip self-test comparator output capture.             */
+/* Unit: ms                                                                   */
+#define COMP_FASTTRIP_TIMEOUT_MS          (2UL)  /*!< Timeout for the fast trip self-test capture */
+
 
 /**
   * @}
@@ -1382,6 +1391,220 @@ uint32_t HAL_COMP_GetOutputLevel(const COMP_HandleTypeDef *hcomp)
 #endif /* STM32H503xx */
 }
 
+#if defined(HAL_TIM_MODULE_ENABLED)
+/**
+  * @brief  Configure the comparator and a timer break input as a hardware fast trip protection.
+  * @note   The comparator is initialized with hcomp->Init and the blanking source of sConfig, its output
+  *         is connected active high to the timer break input which is enabled, then the comparator is started.
+  * @note   With a break filter set to 0 the path from the comparator output to the timer outputs is asynchronous:
+  *         the trip latency is the comparator propagation delay (refer to device datasheet) plus the break
+  *         logic delay, independently of the timer clock. HAL_COMP_FastTripSelfTest() measures it.
+  * @note   This function must be called before enabling the timer outputs. The blanking channel is configured
+  *         in PWM mode 1 and must be started with HAL_TIM_PWM_Start() together with the power stage channels.
+  *         The dead time, off state and lock settings of the timer are kept.
+  * @param  hcomp COMP handle
+  * @param  htim TIM handle of the protected timer, initialized in PWM mode
+  * @param  sConfig Fast trip configuration
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_COMP_ConfigFastTrip(COMP_HandleTypeDef *hcomp, TIM_HandleTypeDef *htim,
+                                          const COMP_FastTripConfigTypeDef *sConfig)
+{
+  TIMEx_BreakInputConfigTypeDef breakinput;
+  TIM_OC_InitTypeDef blanking;
+  uint32_t tmpbdtr;
+
+  /* Check the handles and configuration allocation */
+  if ((hcomp == NULL) || (htim == NULL) || (sConfig == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_TIM_BREAK_INSTANCE(htim->Instance));
+  assert_param(IS_TIM_BREAKINPUT(sConfig->BreakInput));
+  assert_param(IS_TIM_BREAK_FILTER(sConfig->BreakFilter));
+  assert_param(IS_TIM_AUTOMATIC_OUTPUT_STATE(sConfig->AutomaticOutput));
+  assert_param(IS_COMP_BLANKINGSRCE(sConfig->BlankingSrce));
+
+  /* Configure the comparator with its blanking source */
+  hcomp->Init.BlankingSrce = sConfig->BlankingSrce;
+  if (HAL_COMP_Init(hcomp) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Generate the blanking window at the start of each timer period */
+  if ((sConfig->BlankingSrce != COMP_BLANKINGSRC_NONE) && (sConfig->BlankingPulse != 0UL))
+  {
+    blanking.OCMode = TIM_OCMODE_PWM1;
+    blanking.Pulse = sConfig->BlankingPulse;
+    blanking.OCPolarity = TIM_OCPOLARITY_HIGH;
+    blanking.OCNPolarity = TIM_OCNPOLARITY_HIGH;
+    blanking.OCFastMode = TIM_OCFAST_DISABLE;
+    blanking.OCIdleState = TIM_OCIDLESTATE_RESET;
+    blanking.OCNIdleState = TIM_OCNIDLESTATE_RESET;
+    if (HAL_TIM_PWM_ConfigChannel(htim, &blanking, sConfig->BlankingChannel) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  /* Connect the comparator output to the break input */
+#if defined(COMP2)
+  if (hcomp->Instance == COMP2)
+  {
+    breakinput.Source = TIM_BREAKINPUTSOURCE_COMP2;
+  }
+  else
+#endif /* COMP2 */
+  {
+    breakinput.Source = TIM_BREAKINPUTSOURCE_COMP1;
+  }
+  breakinput.Enable = TIM_BREAKINPUTSOURCE_ENABLE;
+  breakinput.Polarity = TIM_BREAKINPUTSOURCE_POLARITY_HIGH;
+  if (HAL_TIMEx_ConfigBreakInput(htim, sConfig->BreakInput, &breakinput) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  __HAL_LOCK(htim);
+
+  /* Enable the break input, active high, keeping the other BDTR settings */
+  tmpbdtr = htim->Instance->BDTR;
+  if (sConfig->BreakInput == TIM_BREAKINPUT_BRK)
+  {
+    MODIFY_REG(tmpbdtr, TIM_BDTR_BKF | TIM_BDTR_BKP | TIM_BDTR_BKE | TIM_BDTR_AOE,
+               (sConfig->BreakFilter << TIM_BDTR_BKF_Pos) | TIM_BREAKPOLARITY_HIGH | TIM_BREAK_ENABLE
+               | sConfig->AutomaticOutput);
+  }
+  else
+  {
+    assert_param(IS_TIM_BKIN2_INSTANCE(htim->Instance));
+
+    MODIFY_REG(tmpbdtr, TIM_BDTR_BK2F | TIM_BDTR_BK2P | TIM_BDTR_BK2E | TIM_BDTR_AOE,
+               (sConfig->BreakFilter << TIM_BDTR_BK2F_Pos) | TIM_BREAK2POLARITY_HIGH | TIM_BREAK2_ENABLE
+               | sConfig->AutomaticOutput);
+  }
+  htim->Instance->BDTR = tmpbdtr;
+
+  __HAL_UNLOCK(htim);
+
+  /* Enable the comparator */
+  return HAL_COMP_Start(hcomp);
+}
+
+/**
+  * @brief  Trip the fast protection and measure its latency with a timer input capture.
+  * @note   The trip is forced by inverting the comparator output polarity, the comparator output edge is
+  *         time stamped by the capture timer and the break event of the protected timer is checked. The
+  *         polarity is restored afterwards, the timer outputs stay disabled unless the automatic output is
+  *         enabled: use __HAL_TIM_MOE_ENABLE() to enable them again.
+  * @note   The measured latency starts at the polarity register write: add the comparator propagation delay
+  *         (refer to device datasheet) to get the full trip latency. Interrupts should be disabled during
+  *         the measurement.
+  * @note   Prerequisites: the fast trip is configured and armed (comparator output low, timer outputs enabled),
+  *         the comparator configuration is not locked, the capture timer counter is running and its capture
+  *         channel is configured in rising edge input capture with its input connected to the comparator
+  *         output using HAL_TIMEx_TISelection().
+  * @param  hcomp COMP handle
+  * @param  htim TIM handle of the protected timer
+  * @param  htimcapture TIM handle of the capture timer
+  * @param  CaptureChannel Channel of the capture timer connected to the comparator output
+  *         This parameter can be one of the following values:
+  *            @arg TIM_CHANNEL_1: TIM Channel 1 selected
+  *            @arg TIM_CHANNEL_2: TIM Channel 2 selected
+  *            @arg TIM_CHANNEL_3: TIM Channel 3 selected
+  *            @arg TIM_CHANNEL_4: TIM Channel 4 selected
+  * @param  pLatency Pointer to the measured latency, in capture timer clock cycles
+  * @retval HAL status, HAL_ERROR if the break event did not disable the timer outputs
+  */
+HAL_StatusTypeDef HAL_COMP_FastTripSelfTest(COMP_HandleTypeDef *hcomp, TIM_HandleTypeDef *htim,
+                                            TIM_HandleTypeDef *htimcapture, uint32_t CaptureChannel,
+                                            uint32_t *pLatency)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t captureflag;
+  uint32_t polarity;
+  uint32_t start;
+  uint32_t capture;
+  uint32_t tickstart;
+
+  /* Check the handles allocation and the comparator lock status */
+  if ((hcomp == NULL) || (htim == NULL) || (htimcapture == NULL) || (pLatency == NULL))
+  {
+    return HAL_ERROR;
+  }
+  if (__HAL_COMP_IS_LOCKED(hcomp))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_COMP_ALL_INSTANCE(hcomp->Instance));
+  assert_param(IS_TIM_BREAK_INSTANCE(htim->Instance));
+  assert_param(IS_TIM_CCX_CHANNEL(htimcapture->Instance, CaptureChannel));
+
+  /* The protection must be armed */
+  if ((HAL_COMP_GetOutputLevel(hcomp) != COMP_OUTPUT_LEVEL_LOW)
+      || (READ_BIT(htim->Instance->BDTR, TIM_BDTR_MOE) == 0UL))
+  {
+    return HAL_ERROR;
+  }
+
+  captureflag = TIM_FLAG_CC1 << (CaptureChannel >> 2U);
+  __HAL_TIM_CLEAR_FLAG(htim, TIM_FLAG_BREAK | TIM_FLAG_BREAK2);
+  __HAL_TIM_CLEAR_FLAG(htimcapture, captureflag);
+  TIM_CCxChannelCmd(htimcapture->Instance, CaptureChannel, TIM_CCx_ENABLE);
+
+  /* Invert the comparator output to trip the protection */
+  polarity = READ_BIT(hcomp->Instance->CFGR1, COMP_CFGR1_POLARITY);
+  start = __HAL_TIM_GET_COUNTER(htimcapture);
+  MODIFY_REG(hcomp->Instance->CFGR1, COMP_CFGR1_POLARITY, polarity ^ COMP_CFGR1_POLARITY);
+
+  /* Wait for the comparator output edge capture */
+  tickstart = HAL_GetTick();
+  while (READ_BIT(htimcapture->Instance->SR, captureflag) == 0UL)
+  {
+    if ((HAL_GetTick() - tickstart) > COMP_FASTTRIP_TIMEOUT_MS)
+    {
+      status = HAL_TIMEOUT;
+      break;
+    }
+  }
+
+  if (status == HAL_OK)
+  {
+    capture = __HAL_TIM_GET_COMPARE(htimcapture, CaptureChannel);
+
+    /* Check the break event disabled the timer outputs */
+    if (((htim->Instance->SR & (TIM_FLAG_BREAK | TIM_FLAG_BREAK2)) == 0UL)
+        || (READ_BIT(htim->Instance->BDTR, TIM_BDTR_MOE) != 0UL))
+    {
+      status = HAL_ERROR;
+    }
+    else if (capture >= start)
+    {
+      *pLatency = capture - start;
+    }
+    else
+    {
+      /* The capture counter rolled over */
+      *pLatency = (__HAL_TIM_GET_AUTORELOAD(htimcapture) - start) + capture + 1UL;
+    }
+  }
+
+  /* Restore the comparator output polarity */
+  MODIFY_REG(hcomp->Instance->CFGR1, COMP_CFGR1_POLARITY, polarity);
+
+  TIM_CCxChannelCmd(htimcapture->Instance, CaptureChannel, TIM_CCx_DISABLE);
+  __HAL_TIM_CLEAR_FLAG(htimcapture, captureflag);
+  __HAL_TIM_CLEAR_FLAG(htim, TIM_FLAG_BREAK | TIM_FLAG_BREAK2);
+
+  return status;
+}
+#endif /* HAL_TIM_MODULE_ENABLED */
+
 /**
   * @brief  Comparator trigger callback.
   * @param  hcomp COMP handle
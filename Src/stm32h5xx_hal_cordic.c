@@ -74,6 +74,11 @@
               i.e. it processes the data and wait till the processing is finished
               A bit faster than standard polling mode, but blocking also AHB bus
               API is HAL_CORDIC_CalculateZO
+         (++) Polling Zero-overhead batch mode: same as above, on a list of jobs
+              each with its own configuration (e.g. cosine/sine then phase/modulus),
+              CORDIC control register being only rewritten when the configuration
+              changes between two jobs
+              API is HAL_CORDIC_CalculateBatchZO
          (++) Interrupt mode: processing API is not blocking functions
               i.e. it processes the data under interrupt
               API is HAL_CORDIC_Calculate_IT
@@ -81,6 +86,18 @@
               not used for data transfer,
               i.e. the data transfer is ensured by DMA
               API is HAL_CORDIC_Calculate_DMA
+         (++) DMA streaming mode: processing API is not blocking function and
+              runs endlessly on circular input and output buffers, without any
+              software action per calculation.
+              API is HAL_CORDIC_CalculateStream_DMA, stopped by HAL_CORDIC_StopStream_DMA
+              (+++) Both DMA handles must be configured in linked-list mode, each with
+                    a circular queue of one node (see HAL_DMAEx_List_SetCircularMode()).
+                    Source, destination and size of the queue head node are set by the
+                    driver from the function parameters.
+              (+++) HAL_CORDIC_CalculateHalfCpltCallback() is called when the first half
+                    of the output buffer is updated, HAL_CORDIC_CalculateCpltCallback()
+                    when the second half is updated. The input buffer half matching the
+                    reported output half can then be refilled with new arguments.
 
       (#) Call HAL_CORDIC_DeInit() to de-initialize the CORDIC peripheral. This function
          (++) resorts to HAL_CORDIC_MspDeInit() for low-level de-initialization,
@@ -95,6 +112,7 @@
   Function HAL_CORDIC_RegisterCallback() allows to register following callbacks:
     (+) ErrorCallback             : Error Callback.
     (+) CalculateCpltCallback     : Calculate complete Callback.
+    (+) CalculateHalfCpltCallback : Calculate half complete Callback.
     (+) MspInitCallback           : CORDIC MspInit.
     (+) MspDeInitCallback         : CORDIC MspDeInit.
   This function takes as parameters the HAL peripheral handle, the Callback ID
@@ -107,6 +125,7 @@
   This function allows to reset following callbacks:
     (+) ErrorCallback             : Error Callback.
     (+) CalculateCpltCallback     : Calculate complete Callback.
+    (+) CalculateHalfCpltCallback : Calculate half complete Callback.
     (+) MspInitCallback           : CORDIC MspInit.
     (+) MspDeInitCallback         : CORDIC MspDeInit.
 
@@ -164,6 +183,10 @@ static void CORDIC_ReadOutDataIncrementPtr(const CORDIC_HandleTypeDef *hcordic,
 static void CORDIC_DMAInCplt(DMA_HandleTypeDef *hdma);
 static void CORDIC_DMAOutCplt(DMA_HandleTypeDef *hdma);
 static void CORDIC_DMAError(DMA_HandleTypeDef *hdma);
+static HAL_StatusTypeDef CORDIC_DMAStreamSetNode(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress,
+                                                 uint32_t SizeInBytes);
+static void CORDIC_DMAStreamOutHalfCplt(DMA_HandleTypeDef *hdma);
+static void CORDIC_DMAStreamOutCplt(DMA_HandleTypeDef *hdma);
 
 /**
   * @}
@@ -219,6 +242,7 @@ HAL_StatusTypeDef HAL_CORDIC_Init(CORDIC_HandleTypeDef *hcordic)
     /* Reset callbacks to legacy functions */
     hcordic->ErrorCallback         = HAL_CORDIC_ErrorCallback;         /* Legacy weak ErrorCallback */
     hcordic->CalculateCpltCallback = HAL_CORDIC_CalculateCpltCallback; /* Legacy weak CalculateCpltCallback */
+    hcordic->CalculateHalfCpltCallback = HAL_CORDIC_CalculateHalfCpltCallback; /* Legacy weak CalculateHalfCpltCallback */
 
     if (hcordic->MspInitCallback == NULL)
     {
@@ -388,6 +412,10 @@ HAL_StatusTypeDef HAL_CORDIC_RegisterCallback(CORDIC_HandleTypeDef *hcordic, HAL
         hcordic->CalculateCpltCallback = pCallback;
         break;
 
+      case HAL_CORDIC_CALCULATE_HALFCPLT_CB_ID :
+        hcordic->CalculateHalfCpltCallback = pCallback;
+        break;
+
       case HAL_CORDIC_MSPINIT_CB_ID :
         hcordic->MspInitCallback = pCallback;
         break;
@@ -469,6 +497,10 @@ HAL_StatusTypeDef HAL_CORDIC_UnRegisterCallback(CORDIC_HandleTypeDef *hcordic, H
         hcordic->CalculateCpltCallback = HAL_CORDIC_CalculateCpltCallback;
         break;
 
+      case HAL_CORDIC_CALCULATE_HALFCPLT_CB_ID :
+        hcordic->CalculateHalfCpltCallback = HAL_CORDIC_CalculateHalfCpltCallback;
+        break;
+
       case HAL_CORDIC_MSPINIT_CB_ID :
         hcordic->MspInitCallback = HAL_CORDIC_MspInit;
         break;
@@ -541,6 +573,10 @@ HAL_StatusTypeDef HAL_CORDIC_UnRegisterCallback(CORDIC_HandleTypeDef *hcordic, H
       (+) Polling mode, with Zero-Overhead register access
       (+) Interrupt mode
       (+) DMA mode
+    [..]  Sequence of calculations with different configurations is also available:
+      (+) Polling mode, with Zero-Overhead register access, on a list of jobs
+    [..]  Endless calculation on circular buffers is also available:
+      (+) DMA streaming mode, using linked-list DMA channels
 
 @endverbatim
   * @{
@@ -779,6 +815,143 @@ HAL_StatusTypeDef HAL_CORDIC_CalculateZO(CORDIC_HandleTypeDef *hcordic, const in
   }
 }
 
+/**
+  * @brief  Carry out a list of CORDIC processing jobs in Zero-Overhead mode, each
+  *         job using its own configuration.
+  * @note   CORDIC control register is only rewritten when the configuration of a job
+  *         differs from the previous one. At the end, the configuration of the last
+  *         job remains applied.
+  * @param  hcordic pointer to a CORDIC_HandleTypeDef structure that contains
+  *         the configuration information for CORDIC module.
+  * @param  pJobs Pointer to the list of jobs to process.
+  * @param  NbJobs Number of jobs in the list.
+  * @param  Timeout Specify Timeout value, applied to the whole list
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CORDIC_CalculateBatchZO(CORDIC_HandleTypeDef *hcordic, const CORDIC_BatchJobTypeDef *pJobs,
+                                              uint32_t NbJobs, uint32_t Timeout)
+{
+  uint32_t tickstart;
+  uint32_t job;
+  uint32_t index;
+  uint32_t csr;
+  uint32_t currentcsr;
+  const int32_t *p_tmp_in_buff;
+  int32_t *p_tmp_out_buff;
+
+  /* Check parameters setting */
+  if ((pJobs == NULL) || (NbJobs == 0U))
+  {
+    /* Update the error code */
+    hcordic->ErrorCode |= HAL_CORDIC_ERROR_PARAM;
+
+    /* Return error status */
+    return HAL_ERROR;
+  }
+
+  for (job = 0U; job < NbJobs; job++)
+  {
+    assert_param(IS_CORDIC_FUNCTION(pJobs[job].Config.Function));
+    assert_param(IS_CORDIC_PRECISION(pJobs[job].Config.Precision));
+    assert_param(IS_CORDIC_SCALE(pJobs[job].Config.Scale));
+    assert_param(IS_CORDIC_NBWRITE(pJobs[job].Config.NbWrite));
+    assert_param(IS_CORDIC_NBREAD(pJobs[job].Config.NbRead));
+    assert_param(IS_CORDIC_INSIZE(pJobs[job].Config.InSize));
+    assert_param(IS_CORDIC_OUTSIZE(pJobs[job].Config.OutSize));
+
+    if ((pJobs[job].pInBuff == NULL) || (pJobs[job].pOutBuff == NULL) || (pJobs[job].NbCalc == 0U))
+    {
+      /* Update the error code */
+      hcordic->ErrorCode |= HAL_CORDIC_ERROR_PARAM;
+
+      /* Return error status */
+      return HAL_ERROR;
+    }
+  }
+
+  /* Check handle state is ready */
+  if (hcordic->State == HAL_CORDIC_STATE_READY)
+  {
+    /* Reset CORDIC error code */
+    hcordic->ErrorCode = HAL_CORDIC_ERROR_NONE;
+
+    /* Change the CORDIC state */
+    hcordic->State = HAL_CORDIC_STATE_BUSY;
+
+    /* Get tick */
+    tickstart = HAL_GetTick();
+
+    currentcsr = READ_REG(hcordic->Instance->CSR);
+
+    for (job = 0U; job < NbJobs; job++)
+    {
+      /* Apply job configuration only when it changes */
+      csr = (currentcsr & ~(CORDIC_CSR_FUNC | CORDIC_CSR_PRECISION | CORDIC_CSR_SCALE |
+                            CORDIC_CSR_NARGS | CORDIC_CSR_NRES | CORDIC_CSR_ARGSIZE | CORDIC_CSR_RESSIZE)) |
+            (pJobs[job].Config.Function | pJobs[job].Config.Precision | pJobs[job].Config.Scale |
+             pJobs[job].Config.NbWrite | pJobs[job].Config.NbRead | pJobs[job].Config.InSize |
+             pJobs[job].Config.OutSize);
+      if (csr != currentcsr)
+      {
+        WRITE_REG(hcordic->Instance->CSR, csr);
+        currentcsr = csr;
+      }
+
+      p_tmp_in_buff = pJobs[job].pInBuff;
+      p_tmp_out_buff = pJobs[job].pOutBuff;
+
+      /* Write of input data in Write Data register, and increment input buffer pointer */
+      CORDIC_WriteInDataIncrementPtr(hcordic, &p_tmp_in_buff);
+
+      /* Calculation is started.
+         Provide next set of input data, until number of calculation of the job is achieved */
+      for (index = (pJobs[job].NbCalc - 1U); index > 0U; index--)
+      {
+        /* Write of input data in Write Data register, and increment input buffer pointer */
+        CORDIC_WriteInDataIncrementPtr(hcordic, &p_tmp_in_buff);
+
+        /* Read output data from Read Data register, and increment output buffer pointer
+           The reading is performed in Zero-Overhead mode:
+           reading is ordered immediately without waiting result ready flag */
+        CORDIC_ReadOutDataIncrementPtr(hcordic, &p_tmp_out_buff);
+      }
+
+      /* Read last output data of the job, before configuration of the next one */
+      CORDIC_ReadOutDataIncrementPtr(hcordic, &p_tmp_out_buff);
+
+      /* Check for the Timeout */
+      if (Timeout != HAL_MAX_DELAY)
+      {
+        if ((HAL_GetTick() - tickstart) > Timeout)
+        {
+          /* Set CORDIC error code */
+          hcordic->ErrorCode = HAL_CORDIC_ERROR_TIMEOUT;
+
+          /* Change the CORDIC state */
+          hcordic->State = HAL_CORDIC_STATE_READY;
+
+          /* Return function status */
+          return HAL_ERROR;
+        }
+      }
+    }
+
+    /* Change the CORDIC state */
+    hcordic->State = HAL_CORDIC_STATE_READY;
+
+    /* Return function status */
+    return HAL_OK;
+  }
+  else
+  {
+    /* Set CORDIC error code */
+    hcordic->ErrorCode |= HAL_CORDIC_ERROR_NOT_READY;
+
+    /* Return function status */
+    return HAL_ERROR;
+  }
+}
+
 /**
   * @brief  Carry out data of CORDIC processing in interrupt mode,
   *         according to the existing CORDIC configuration.
@@ -1028,6 +1201,180 @@ HAL_StatusTypeDef HAL_CORDIC_Calculate_DMA(CORDIC_HandleTypeDef *hcordic, const
   }
 }
 
+/**
+  * @brief  Start endless CORDIC processing in DMA streaming mode, on circular
+  *         input and output buffers.
+  * @note   hdmaIn and hdmaOut must be linked-list DMA handles, each with a circular
+  *         queue built on one node. The head node of each queue is updated with
+  *         the buffer addresses and sizes.
+  * @note   Once started, each input argument written by DMA is processed and its
+  *         result is read back by DMA without any CPU action. Half and full output
+  *         buffer updates are notified by HAL_CORDIC_CalculateHalfCpltCallback() and
+  *         HAL_CORDIC_CalculateCpltCallback().
+  * @param  hcordic pointer to a CORDIC_HandleTypeDef structure that contains
+  *         the configuration information for CORDIC module
+  * @param  pInBuff Pointer to circular buffer containing input data for CORDIC processing.
+  * @param  pOutBuff Pointer to circular buffer where output data of CORDIC processing will be stored.
+  * @param  NbCalc Number of CORDIC calculation to process per buffer loop (even number).
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CORDIC_CalculateStream_DMA(CORDIC_HandleTypeDef *hcordic, const int32_t *pInBuff,
+                                                 int32_t *pOutBuff, uint32_t NbCalc)
+{
+  uint32_t sizeinbuff;
+  uint32_t sizeoutbuff;
+
+  /* Check parameters setting */
+  if ((pInBuff == NULL) || (pOutBuff == NULL) || (NbCalc == 0U) || ((NbCalc & 1U) != 0U))
+  {
+    /* Update the error code */
+    hcordic->ErrorCode |= HAL_CORDIC_ERROR_PARAM;
+
+    /* Return error status */
+    return HAL_ERROR;
+  }
+
+  /* Check DMA handles are in circular linked-list mode */
+  if ((hcordic->hdmaIn == NULL) || (hcordic->hdmaOut == NULL)
+      || ((hcordic->hdmaIn->Mode & DMA_LINKEDLIST_CIRCULAR) != DMA_LINKEDLIST_CIRCULAR)
+      || ((hcordic->hdmaOut->Mode & DMA_LINKEDLIST_CIRCULAR) != DMA_LINKEDLIST_CIRCULAR))
+  {
+    /* Update the error code */
+    hcordic->ErrorCode |= HAL_CORDIC_ERROR_PARAM;
+
+    /* Return error status */
+    return HAL_ERROR;
+  }
+
+  if (hcordic->State == HAL_CORDIC_STATE_READY)
+  {
+    /* Reset CORDIC error code */
+    hcordic->ErrorCode = HAL_CORDIC_ERROR_NONE;
+
+    /* Change the CORDIC state */
+    hcordic->State = HAL_CORDIC_STATE_BUSY;
+
+    /* Get DMA direction */
+    hcordic->DMADirection = CORDIC_DMA_DIR_IN_OUT;
+
+    /* Retrieve the size in bytes of input and output data buffers */
+    sizeoutbuff = (HAL_IS_BIT_SET(hcordic->Instance->CSR, CORDIC_CSR_NRES)) ? (8U * NbCalc) : (4U * NbCalc);
+    sizeinbuff = (HAL_IS_BIT_SET(hcordic->Instance->CSR, CORDIC_CSR_NARGS)) ? (8U * NbCalc) : (4U * NbCalc);
+
+    /* Half and full output buffer notifications, input side is not notified */
+    hcordic->hdmaOut->XferHalfCpltCallback = CORDIC_DMAStreamOutHalfCplt;
+    hcordic->hdmaOut->XferCpltCallback = CORDIC_DMAStreamOutCplt;
+    hcordic->hdmaOut->XferErrorCallback = CORDIC_DMAError;
+    hcordic->hdmaIn->XferHalfCpltCallback = NULL;
+    hcordic->hdmaIn->XferCpltCallback = NULL;
+    hcordic->hdmaIn->XferErrorCallback = CORDIC_DMAError;
+
+    /* Enable the DMA channel managing CORDIC output data read */
+    if ((CORDIC_DMAStreamSetNode(hcordic->hdmaOut, (uint32_t)&hcordic->Instance->RDATA, (uint32_t)pOutBuff,
+                                 sizeoutbuff) != HAL_OK)
+        || (HAL_DMAEx_List_Start_IT(hcordic->hdmaOut) != HAL_OK))
+    {
+      /* Update the error code */
+      hcordic->ErrorCode |= HAL_CORDIC_ERROR_DMA;
+      hcordic->DMADirection = CORDIC_DMA_DIR_NONE;
+      hcordic->State = HAL_CORDIC_STATE_READY;
+
+      /* Return error status */
+      return HAL_ERROR;
+    }
+
+    /* Enable output data Read DMA requests */
+    SET_BIT(hcordic->Instance->CSR, CORDIC_DMA_REN);
+
+    /* Enable the DMA channel managing CORDIC input data write */
+    if ((CORDIC_DMAStreamSetNode(hcordic->hdmaIn, (uint32_t)pInBuff, (uint32_t)&hcordic->Instance->WDATA,
+                                 sizeinbuff) != HAL_OK)
+        || (HAL_DMAEx_List_Start_IT(hcordic->hdmaIn) != HAL_OK))
+    {
+      /* Stop the output side already started */
+      CLEAR_BIT(hcordic->Instance->CSR, CORDIC_DMA_REN);
+      (void)HAL_DMA_Abort(hcordic->hdmaOut);
+
+      /* Update the error code */
+      hcordic->ErrorCode |= HAL_CORDIC_ERROR_DMA;
+      hcordic->DMADirection = CORDIC_DMA_DIR_NONE;
+      hcordic->State = HAL_CORDIC_STATE_READY;
+
+      /* Return error status */
+      return HAL_ERROR;
+    }
+
+    /* Enable input data Write DMA request */
+    SET_BIT(hcordic->Instance->CSR, CORDIC_DMA_WEN);
+
+    /* Return function status */
+    return HAL_OK;
+  }
+  else
+  {
+    /* Set CORDIC error code */
+    hcordic->ErrorCode |= HAL_CORDIC_ERROR_NOT_READY;
+
+    /* Return function status */
+    return HAL_ERROR;
+  }
+}
+
+/**
+  * @brief  Stop CORDIC processing in DMA streaming mode.
+  * @note   Calculations ordered but not yet read back are discarded.
+  * @param  hcordic pointer to a CORDIC_HandleTypeDef structure that contains
+  *         the configuration information for CORDIC module
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CORDIC_StopStream_DMA(CORDIC_HandleTypeDef *hcordic)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if ((hcordic->State != HAL_CORDIC_STATE_BUSY) || (hcordic->DMADirection != CORDIC_DMA_DIR_IN_OUT))
+  {
+    /* Set CORDIC error code */
+    hcordic->ErrorCode |= HAL_CORDIC_ERROR_NOT_READY;
+
+    /* Return function status */
+    return HAL_ERROR;
+  }
+
+  /* Stop feeding arguments first, then stop reading results */
+  CLEAR_BIT(hcordic->Instance->CSR, CORDIC_DMA_WEN);
+  if (HAL_DMA_Abort(hcordic->hdmaIn) != HAL_OK)
+  {
+    status = HAL_ERROR;
+  }
+
+  CLEAR_BIT(hcordic->Instance->CSR, CORDIC_DMA_REN);
+  if (HAL_DMA_Abort(hcordic->hdmaOut) != HAL_OK)
+  {
+    status = HAL_ERROR;
+  }
+
+  /* Flush pending results, so that next calculation starts clean */
+  while (__HAL_CORDIC_GET_FLAG(hcordic, CORDIC_FLAG_RRDY) != 0U)
+  {
+    (void)READ_REG(hcordic->Instance->RDATA);
+  }
+
+  if (status != HAL_OK)
+  {
+    /* Update the error code */
+    hcordic->ErrorCode |= HAL_CORDIC_ERROR_DMA;
+  }
+
+  /* Change the CORDIC DMA direction to none */
+  hcordic->DMADirection = CORDIC_DMA_DIR_NONE;
+
+  /* Change the CORDIC state to ready */
+  hcordic->State = HAL_CORDIC_STATE_READY;
+
+  /* Return function status */
+  return status;
+}
+
 /**
   * @}
   */
@@ -1079,6 +1426,24 @@ __weak void HAL_CORDIC_CalculateCpltCallback(CORDIC_HandleTypeDef *hcordic)
    */
 }
 
+/**
+  * @brief  CORDIC calculate half complete callback.
+  * @note   Called in DMA streaming mode when the first half of the output
+  *         buffer is updated.
+  * @param  hcordic pointer to a CORDIC_HandleTypeDef structure that contains
+  *         the configuration information for CORDIC module
+  * @retval None
+  */
+__weak void HAL_CORDIC_CalculateHalfCpltCallback(CORDIC_HandleTypeDef *hcordic)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hcordic);
+
+  /* NOTE : This function should not be modified; when the callback is needed,
+            the HAL_CORDIC_CalculateHalfCpltCallback can be implemented in the user file
+   */
+}
+
 /**
   * @}
   */
@@ -1316,6 +1681,74 @@ static void CORDIC_DMAOutCplt(DMA_HandleTypeDef *hdma)
 #endif /* USE_HAL_CORDIC_REGISTER_CALLBACKS */
 }
 
+/**
+  * @brief  Set addresses and size of the head node of a circular DMA queue.
+  * @param  hdma DMA handle.
+  * @param  SrcAddress Source address.
+  * @param  DstAddress Destination address.
+  * @param  SizeInBytes Block size in bytes.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef CORDIC_DMAStreamSetNode(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress,
+                                                 uint32_t SizeInBytes)
+{
+  if ((hdma->LinkedListQueue == NULL) || (hdma->LinkedListQueue->Head == NULL)
+      || (hdma->LinkedListQueue->FirstCircularNode == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Set DMA data size */
+  MODIFY_REG(hdma->LinkedListQueue->Head->LinkRegisters[NODE_CBR1_DEFAULT_OFFSET], DMA_CBR1_BNDT, SizeInBytes);
+
+  /* Set DMA source address */
+  hdma->LinkedListQueue->Head->LinkRegisters[NODE_CSAR_DEFAULT_OFFSET] = SrcAddress;
+
+  /* Set DMA destination address */
+  hdma->LinkedListQueue->Head->LinkRegisters[NODE_CDAR_DEFAULT_OFFSET] = DstAddress;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  DMA CORDIC streaming output half buffer complete callback.
+  * @param  hdma DMA handle.
+  * @retval None
+  */
+static void CORDIC_DMAStreamOutHalfCplt(DMA_HandleTypeDef *hdma)
+{
+  CORDIC_HandleTypeDef *hcordic = (CORDIC_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+
+  /* Call calculation half complete callback */
+#if USE_HAL_CORDIC_REGISTER_CALLBACKS == 1
+  /*Call registered callback*/
+  hcordic->CalculateHalfCpltCallback(hcordic);
+#else
+  /*Call legacy weak callback*/
+  HAL_CORDIC_CalculateHalfCpltCallback(hcordic);
+#endif /* USE_HAL_CORDIC_REGISTER_CALLBACKS */
+}
+
+/**
+  * @brief  DMA CORDIC streaming output full buffer complete callback.
+  * @note   The circular DMA channel keeps running, CORDIC stays busy.
+  * @param  hdma DMA handle.
+  * @retval None
+  */
+static void CORDIC_DMAStreamOutCplt(DMA_HandleTypeDef *hdma)
+{
+  CORDIC_HandleTypeDef *hcordic = (CORDIC_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+
+  /* Call calculation complete callback */
+#if USE_HAL_CORDIC_REGISTER_CALLBACKS == 1
+  /*Call registered callback*/
+  hcordic->CalculateCpltCallback(hcordic);
+#else
+  /*Call legacy weak callback*/
+  HAL_CORDIC_CalculateCpltCallback(hcordic);
+#endif /* USE_HAL_CORDIC_REGISTER_CALLBACKS */
+}
+
 /**
   * @brief  DMA CORDIC communication error callback.
   * @param  hdma DMA handle.
@@ -84,6 +84,10 @@
     (#) Configure the necessary MPU regions using HAL_MPU_ConfigRegion() ennsuring that the MPU region configuration 
         link to the right MPU attributes number.
     (#) Enable the MPU using HAL_MPU_Enable() function.
+    (#) Alternatively, HAL_MPU_ConfigProfile() applies a whole memory map from a table of areas in one step:
+        it allocates the memory attributes indexes, programs one region per area, disables the other regions
+        and enables the MPU, e.g. code cacheable, DMA buffers non-cacheable and shareable, external memory
+        write-through. Overlapping or misaligned areas are reported as conflicts without MPU update.
 
      -@- The memory management fault exception is enabled in HAL_MPU_Enable() function and the system will enter 
          the memory management fault handler MemManage_Handler() when an illegal memory access is performed.
@@ -134,6 +138,8 @@
 /* Private types -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Private constants ---------------------------------------------------------*/
+#define MPU_PROFILE_ATTRIBUTES_NBR  8U  /* Number of memory attributes of MPU_MAIR0 and MPU_MAIR1 */
+
 /* Private macros ------------------------------------------------------------*/
 /* Private functions ---------------------------------------------------------*/
 /** @defgroup CORTEX_Private_Functions CORTEX Private Functions
@@ -141,6 +147,9 @@
   */
 static void MPU_ConfigRegion(MPU_Type *MPUx, const MPU_Region_InitTypeDef *const pMPU_RegionInit);
 static void MPU_ConfigMemoryAttributes(MPU_Type *MPUx, const MPU_Attributes_InitTypeDef *const pMPU_AttributesInit);
+static HAL_StatusTypeDef MPU_CheckProfile(const MPU_Type *MPUx, const MPU_Profile_RegionTypeDef *pRegions,
+                                          uint32_t NbRegions, uint32_t *pConflictIndex);
+static void MPU_LoadProfile(MPU_Type *MPUx, const MPU_Profile_RegionTypeDef *pRegions, uint32_t NbRegions);
 /**
   * @}
   */
@@ -763,6 +772,69 @@ void HAL_MPU_ConfigMemoryAttributes_NS(const MPU_Attributes_InitTypeDef *const p
 }
 #endif /* __ARM_FEATURE_CMSE */
 
+/**
+  * @brief  Configure the whole MPU from a memory map profile.
+  * @note   Each area of the table is programmed in the region of the same index and gets a memory
+  *         attributes index shared by the areas with the same Attributes value, the remaining regions
+  *         are disabled. The MPU is disabled during the update and then enabled with MPU_Control.
+  * @note   The profile is checked before any MPU update: an area misaligned, overlapping a previous
+  *         area (the ARMv8-M MPU faults on such accesses), beyond the number of MPU regions or
+  *         needing a ninth memory attributes value is a conflict, and the MPU is left unchanged.
+  * @param  pRegions: Pointer to the table of MPU_Profile_RegionTypeDef structures describing the areas.
+  * @param  NbRegions: Number of areas of the table.
+  * @param  MPU_Control: Specifies the control mode of the MPU, see HAL_MPU_Enable().
+  * @param  pConflictIndex: Pointer receiving the index of the first conflicting area, or NULL.
+  * @retval HAL status, HAL_ERROR on a conflict.
+  */
+HAL_StatusTypeDef HAL_MPU_ConfigProfile(const MPU_Profile_RegionTypeDef *pRegions, uint32_t NbRegions,
+                                        uint32_t MPU_Control, uint32_t *pConflictIndex)
+{
+  HAL_StatusTypeDef status;
+
+  status = MPU_CheckProfile(MPU, pRegions, NbRegions, pConflictIndex);
+
+  if (status == HAL_OK)
+  {
+    HAL_MPU_Disable();
+
+    MPU_LoadProfile(MPU, pRegions, NbRegions);
+
+    HAL_MPU_Enable(MPU_Control);
+  }
+
+  return status;
+}
+
+#if defined (__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U)
+/**
+  * @brief  Configure the whole non-secure MPU from a memory map profile.
+  * @note   See HAL_MPU_ConfigProfile().
+  * @param  pRegions: Pointer to the table of MPU_Profile_RegionTypeDef structures describing the areas.
+  * @param  NbRegions: Number of areas of the table.
+  * @param  MPU_Control: Specifies the control mode of the MPU, see HAL_MPU_Enable_NS().
+  * @param  pConflictIndex: Pointer receiving the index of the first conflicting area, or NULL.
+  * @retval HAL status, HAL_ERROR on a conflict.
+  */
+HAL_StatusTypeDef HAL_MPU_ConfigProfile_NS(const MPU_Profile_RegionTypeDef *pRegions, uint32_t NbRegions,
+                                           uint32_t MPU_Control, uint32_t *pConflictIndex)
+{
+  HAL_StatusTypeDef status;
+
+  status = MPU_CheckProfile(MPU_NS, pRegions, NbRegions, pConflictIndex);
+
+  if (status == HAL_OK)
+  {
+    HAL_MPU_Disable_NS();
+
+    MPU_LoadProfile(MPU_NS, pRegions, NbRegions);
+
+    HAL_MPU_Enable_NS(MPU_Control);
+  }
+
+  return status;
+}
+#endif /* __ARM_FEATURE_CMSE */
+
 /**
   * @}
   */
@@ -858,6 +930,147 @@ static void MPU_ConfigMemoryAttributes(MPU_Type *MPUx, const MPU_Attributes_Init
   attr_values &=  ~(0xFFUL << (attr_number * 8U));
   *(p_mair) = attr_values | ((uint32_t)pMPU_AttributesInit->Attributes << (attr_number * 8U));
 }
+
+/**
+  * @brief  Check a memory map profile against the MPU capabilities.
+  * @param  MPUx: Pointer to MPU_Type structure
+  *          This parameter can be one of the following values:
+  *            @arg MPU
+  *            @arg MPU_NS
+  * @param  pRegions: Pointer to the table of MPU_Profile_RegionTypeDef structures describing the areas.
+  * @param  NbRegions: Number of areas of the table.
+  * @param  pConflictIndex: Pointer receiving the index of the first conflicting area, or NULL.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef MPU_CheckProfile(const MPU_Type *MPUx, const MPU_Profile_RegionTypeDef *pRegions,
+                                          uint32_t NbRegions, uint32_t *pConflictIndex)
+{
+  uint8_t  attributes[MPU_PROFILE_ATTRIBUTES_NBR];
+  uint32_t attr_count = 0U;
+  uint32_t region_count;
+  uint32_t conflict = NbRegions;
+  uint32_t index;
+  uint32_t other;
+
+  if ((pRegions == NULL) || (NbRegions == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  region_count = (MPUx->TYPE & MPU_TYPE_DREGION_Msk) >> MPU_TYPE_DREGION_Pos;
+
+  for (index = 0U; (index < NbRegions) && (conflict == NbRegions); index++)
+  {
+    if ((index >= region_count) ||
+        ((pRegions[index].BaseAddress & 0x1FUL) != 0UL) || ((pRegions[index].LimitAddress & 0x1FUL) != 0x1FUL) ||
+        (pRegions[index].LimitAddress < pRegions[index].BaseAddress))
+    {
+      conflict = index;
+    }
+
+    for (other = 0U; (other < index) && (conflict == NbRegions); other++)
+    {
+      if ((pRegions[index].BaseAddress <= pRegions[other].LimitAddress) &&
+          (pRegions[other].BaseAddress <= pRegions[index].LimitAddress))
+      {
+        conflict = index;
+      }
+    }
+
+    if (conflict == NbRegions)
+    {
+      other = 0U;
+      while ((other < attr_count) && (attributes[other] != pRegions[index].Attributes))
+      {
+        other++;
+      }
+
+      if (other == attr_count)
+      {
+        if (attr_count == MPU_PROFILE_ATTRIBUTES_NBR)
+        {
+          conflict = index;
+        }
+        else
+        {
+          attributes[attr_count] = pRegions[index].Attributes;
+          attr_count++;
+        }
+      }
+    }
+  }
+
+  if (conflict != NbRegions)
+  {
+    if (pConflictIndex != NULL)
+    {
+      *pConflictIndex = conflict;
+    }
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Program the memory attributes and the regions of a checked memory map profile.
+  * @param  MPUx: Pointer to MPU_Type structure
+  *          This parameter can be one of the following values:
+  *            @arg MPU
+  *            @arg MPU_NS
+  * @param  pRegions: Pointer to the table of MPU_Profile_RegionTypeDef structures describing the areas.
+  * @param  NbRegions: Number of areas of the table.
+  * @retval None
+  */
+static void MPU_LoadProfile(MPU_Type *MPUx, const MPU_Profile_RegionTypeDef *pRegions, uint32_t NbRegions)
+{
+  MPU_Region_InitTypeDef     region_init;
+  MPU_Attributes_InitTypeDef attr_init;
+  uint8_t  attributes[MPU_PROFILE_ATTRIBUTES_NBR];
+  uint32_t attr_count = 0U;
+  uint32_t region_count;
+  uint32_t index;
+  uint32_t attr_index;
+
+  region_count = (MPUx->TYPE & MPU_TYPE_DREGION_Msk) >> MPU_TYPE_DREGION_Pos;
+
+  for (index = 0U; index < NbRegions; index++)
+  {
+    attr_index = 0U;
+    while ((attr_index < attr_count) && (attributes[attr_index] != pRegions[index].Attributes))
+    {
+      attr_index++;
+    }
+
+    /* First area with these attributes */
+    if (attr_index == attr_count)
+    {
+      attributes[attr_count] = pRegions[index].Attributes;
+      attr_count++;
+
+      attr_init.Number     = (uint8_t)attr_index;
+      attr_init.Attributes = pRegions[index].Attributes;
+      MPU_ConfigMemoryAttributes(MPUx, &attr_init);
+    }
+
+    region_init.Enable           = MPU_REGION_ENABLE;
+    region_init.Number           = (uint8_t)index;
+    region_init.BaseAddress      = pRegions[index].BaseAddress;
+    region_init.LimitAddress     = pRegions[index].LimitAddress;
+    region_init.AttributesIndex  = (uint8_t)attr_index;
+    region_init.AccessPermission = pRegions[index].AccessPermission;
+    region_init.DisableExec      = pRegions[index].DisableExec;
+    region_init.IsShareable      = pRegions[index].IsShareable;
+    MPU_ConfigRegion(MPUx, &region_init);
+  }
+
+  /* Disable the regions left from a previous configuration */
+  for (index = NbRegions; index < region_count; index++)
+  {
+    MPUx->RNR = index;
+    CLEAR_BIT(MPUx->RLAR, MPU_RLAR_EN_Msk);
+  }
+}
 /**
   * @}
   */
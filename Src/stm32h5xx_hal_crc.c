@@ -37,6 +37,19 @@
          (+) Use HAL_CRC_Calculate() function to compute the CRC value of the
              input data buffer starting with the defined initialization value
              (default or non-default) to initiate CRC calculation
+         (+) For large buffers, link a GPDMA channel to the CRC handle with
+             __HAL_LINKDMA(hcrc, hdma, hdma_crc). The channel must be initialized
+             with HAL_DMA_Init() for a software request memory to memory transfer
+             (source incremented, destination fixed, word source and destination
+             data widths, normal mode) and its IRQ handler must call HAL_DMA_IRQHandler().
+             (++) Use HAL_CRC_Calculate_DMA() or HAL_CRC_Accumulate_DMA() to start
+                  the computation. Unaligned leading and trailing input data are
+                  fed by CPU, the word aligned body is streamed to the CRC data
+                  register by DMA in blocks of up to 65532 bytes.
+             (++) At the end of the computation HAL_CRC_CpltCallback() is executed,
+                  the CRC value is then read with HAL_CRC_GetValue().
+             (++) In case of DMA transfer error HAL_CRC_ErrorCallback() is executed,
+                  the DMA error code is available with HAL_DMA_GetError(hcrc->hdma).
 
   @endverbatim
   ******************************************************************************
@@ -58,14 +71,30 @@
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
+/** @defgroup CRC_Private_Constants CRC Private Constants
+  * @{
+  */
+#define CRC_DMA_MAX_BLOCK_SIZE  0xFFFCU  /*!< Maximum DMA block size in bytes, multiple of a word */
+/**
+  * @}
+  */
+
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
 /** @defgroup CRC_Private_Functions CRC Private Functions
   * @{
   */
+static uint32_t CRC_Handle_32(CRC_HandleTypeDef *hcrc, const uint32_t pBuffer[], uint32_t BufferLength);
 static uint32_t CRC_Handle_8(CRC_HandleTypeDef *hcrc, uint8_t pBuffer[], uint32_t BufferLength);
 static uint32_t CRC_Handle_16(CRC_HandleTypeDef *hcrc, uint16_t pBuffer[], uint32_t BufferLength);
+#if defined(HAL_DMA_MODULE_ENABLED)
+static HAL_StatusTypeDef CRC_Start_DMA(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength);
+static HAL_StatusTypeDef CRC_DMA_StartBlock(CRC_HandleTypeDef *hcrc);
+static void CRC_DMA_End(CRC_HandleTypeDef *hcrc);
+static void CRC_DMAXferCplt(DMA_HandleTypeDef *hdma);
+static void CRC_DMAError(DMA_HandleTypeDef *hdma);
+#endif /* HAL_DMA_MODULE_ENABLED */
 /**
   * @}
   */
@@ -273,6 +302,9 @@ __weak void HAL_CRC_MspDeInit(CRC_HandleTypeDef *hcrc)
       (+) compute the 7, 8, 16 or 32-bit CRC value of an 8, 16 or 32-bit data buffer
           independently of the previous CRC value.
 
+      (+) compute the CRC value of a large data buffer in non-blocking mode, the
+          aligned part of the buffer being streamed to the CRC calculator by DMA.
+
 @endverbatim
   * @{
   */
@@ -294,7 +326,6 @@ __weak void HAL_CRC_MspDeInit(CRC_HandleTypeDef *hcrc)
   */
 uint32_t HAL_CRC_Accumulate(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength)
 {
-  uint32_t index;      /* CRC input data buffer index */
   uint32_t temp = 0U;  /* CRC output (read from hcrc->Instance->DR register) */
 
   /* Change CRC peripheral state */
@@ -304,11 +335,7 @@ uint32_t HAL_CRC_Accumulate(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_
   {
     case CRC_INPUTDATA_FORMAT_WORDS:
       /* Enter Data to the CRC calculator */
-      for (index = 0U; index < BufferLength; index++)
-      {
-        hcrc->Instance->DR = pBuffer[index];
-      }
-      temp = hcrc->Instance->DR;
+      temp = CRC_Handle_32(hcrc, pBuffer, BufferLength);
       break;
 
     case CRC_INPUTDATA_FORMAT_BYTES:
@@ -346,7 +373,6 @@ uint32_t HAL_CRC_Accumulate(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_
   */
 uint32_t HAL_CRC_Calculate(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength)
 {
-  uint32_t index;      /* CRC input data buffer index */
   uint32_t temp = 0U;  /* CRC output (read from hcrc->Instance->DR register) */
 
   /* Change CRC peripheral state */
@@ -360,11 +386,7 @@ uint32_t HAL_CRC_Calculate(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t
   {
     case CRC_INPUTDATA_FORMAT_WORDS:
       /* Enter 32-bit input data to the CRC calculator */
-      for (index = 0U; index < BufferLength; index++)
-      {
-        hcrc->Instance->DR = pBuffer[index];
-      }
-      temp = hcrc->Instance->DR;
+      temp = CRC_Handle_32(hcrc, pBuffer, BufferLength);
       break;
 
     case CRC_INPUTDATA_FORMAT_BYTES:
@@ -388,6 +410,114 @@ uint32_t HAL_CRC_Calculate(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t
   return temp;
 }
 
+#if defined(HAL_DMA_MODULE_ENABLED)
+/**
+  * @brief  Compute in non-blocking mode the 7, 8, 16 or 32-bit CRC value of an 8, 16
+  *         or 32-bit data buffer starting with the previously computed CRC as
+  *         initialization value, the aligned body of the buffer being fed by DMA.
+  * @param  hcrc CRC handle
+  * @param  pBuffer pointer to the input data buffer, exact input data format is
+  *         provided by hcrc->InputDataFormat.
+  * @param  BufferLength input data buffer length (number of bytes if pBuffer
+  *         type is * uint8_t, number of half-words if pBuffer type is * uint16_t,
+  *         number of words if pBuffer type is * uint32_t).
+  * @note   The input buffer must remain unchanged until HAL_CRC_CpltCallback() is executed.
+  * @note   Half-word buffers must be half-word aligned and word buffers must be word aligned.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CRC_Accumulate_DMA(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength)
+{
+  /* Check the CRC handle allocation */
+  if ((hcrc == NULL) || (hcrc->hdma == NULL) || (pBuffer == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hcrc->State != HAL_CRC_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  return CRC_Start_DMA(hcrc, pBuffer, BufferLength);
+}
+
+/**
+  * @brief  Compute in non-blocking mode the 7, 8, 16 or 32-bit CRC value of an 8, 16
+  *         or 32-bit data buffer starting with hcrc->Instance->INIT as initialization
+  *         value, the aligned body of the buffer being fed by DMA.
+  * @param  hcrc CRC handle
+  * @param  pBuffer pointer to the input data buffer, exact input data format is
+  *         provided by hcrc->InputDataFormat.
+  * @param  BufferLength input data buffer length (number of bytes if pBuffer
+  *         type is * uint8_t, number of half-words if pBuffer type is * uint16_t,
+  *         number of words if pBuffer type is * uint32_t).
+  * @note   The input buffer must remain unchanged until HAL_CRC_CpltCallback() is executed.
+  * @note   Half-word buffers must be half-word aligned and word buffers must be word aligned.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CRC_Calculate_DMA(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength)
+{
+  /* Check the CRC handle allocation */
+  if ((hcrc == NULL) || (hcrc->hdma == NULL) || (pBuffer == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hcrc->State != HAL_CRC_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  /* Reset CRC Calculation Unit (hcrc->Instance->INIT is
+  *  written in hcrc->Instance->DR) */
+  __HAL_CRC_DR_RESET(hcrc);
+
+  return CRC_Start_DMA(hcrc, pBuffer, BufferLength);
+}
+
+/**
+  * @brief  Return the current CRC value.
+  * @param  hcrc CRC handle
+  * @note   To be used once HAL_CRC_CpltCallback() is executed to retrieve the result
+  *         of HAL_CRC_Calculate_DMA() or HAL_CRC_Accumulate_DMA().
+  * @retval uint32_t CRC (returned value LSBs for CRC shorter than 32 bits)
+  */
+uint32_t HAL_CRC_GetValue(const CRC_HandleTypeDef *hcrc)
+{
+  return hcrc->Instance->DR;
+}
+
+/**
+  * @brief  CRC computation complete callback.
+  * @param  hcrc CRC handle
+  * @retval None
+  */
+__weak void HAL_CRC_CpltCallback(CRC_HandleTypeDef *hcrc)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hcrc);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_CRC_CpltCallback can be implemented in the user file
+   */
+}
+
+/**
+  * @brief  CRC DMA error callback.
+  * @param  hcrc CRC handle
+  * @retval None
+  */
+__weak void HAL_CRC_ErrorCallback(CRC_HandleTypeDef *hcrc)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hcrc);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_CRC_ErrorCallback can be implemented in the user file
+   */
+}
+#endif /* HAL_DMA_MODULE_ENABLED */
+
 /**
   * @}
   */
@@ -429,6 +559,41 @@ HAL_CRC_StateTypeDef HAL_CRC_GetState(const CRC_HandleTypeDef *hcrc)
   * @{
   */
 
+/**
+  * @brief  Enter 32-bit input data to the CRC calculator.
+  *         Specific data handling to optimize processing time.
+  * @param  hcrc CRC handle
+  * @param  pBuffer pointer to the input data buffer
+  * @param  BufferLength input data buffer length
+  * @retval uint32_t CRC (returned value LSBs for CRC shorter than 32 bits)
+  */
+static uint32_t CRC_Handle_32(CRC_HandleTypeDef *hcrc, const uint32_t pBuffer[], uint32_t BufferLength)
+{
+  uint32_t i = 0U; /* input data buffer index */
+  __IO uint32_t *pReg = &hcrc->Instance->DR;
+
+  /* Processing time optimization: loop unrolled by 8 words to limit the loop overhead
+   * between the data register writes */
+  for (; (i + 8U) <= BufferLength; i += 8U)
+  {
+    *pReg = pBuffer[i];
+    *pReg = pBuffer[i + 1U];
+    *pReg = pBuffer[i + 2U];
+    *pReg = pBuffer[i + 3U];
+    *pReg = pBuffer[i + 4U];
+    *pReg = pBuffer[i + 5U];
+    *pReg = pBuffer[i + 6U];
+    *pReg = pBuffer[i + 7U];
+  }
+  for (; i < BufferLength; i++)
+  {
+    *pReg = pBuffer[i];
+  }
+
+  /* Return the CRC computed value */
+  return hcrc->Instance->DR;
+}
+
 /**
   * @brief  Enter 8-bit input data to the CRC calculator.
   *         Specific data handling to optimize processing time.
@@ -440,18 +605,45 @@ HAL_CRC_StateTypeDef HAL_CRC_GetState(const CRC_HandleTypeDef *hcrc)
 static uint32_t CRC_Handle_8(CRC_HandleTypeDef *hcrc, uint8_t pBuffer[], uint32_t BufferLength)
 {
   uint32_t i; /* input data buffer index */
+  uint32_t nb_words = BufferLength / 4U;
+  const uint32_t *pWord;
+  __IO uint32_t *pDR = &hcrc->Instance->DR;
   uint16_t data;
   __IO uint16_t *pReg;
 
   /* Processing time optimization: 4 bytes are entered in a row with a single word write,
    * last bytes must be carefully fed to the CRC calculator to ensure a correct type
    * handling by the peripheral */
-  for (i = 0U; i < (BufferLength / 4U); i++)
+  if (((uint32_t)pBuffer & 3U) == 0U)
+  {
+    /* Word aligned buffer: single word read, byte reversed so that the first byte
+     * is entered in the MSB, loop unrolled by 8 words */
+    pWord = (const uint32_t *)(void *)pBuffer;                                         /* Derogation MisraC2012 R.11.5 */
+    for (i = 0U; (i + 8U) <= nb_words; i += 8U)
+    {
+      *pDR = __REV(pWord[i]);
+      *pDR = __REV(pWord[i + 1U]);
+      *pDR = __REV(pWord[i + 2U]);
+      *pDR = __REV(pWord[i + 3U]);
+      *pDR = __REV(pWord[i + 4U]);
+      *pDR = __REV(pWord[i + 5U]);
+      *pDR = __REV(pWord[i + 6U]);
+      *pDR = __REV(pWord[i + 7U]);
+    }
+    for (; i < nb_words; i++)
+    {
+      *pDR = __REV(pWord[i]);
+    }
+  }
+  else
   {
-    hcrc->Instance->DR = ((uint32_t)pBuffer[4U * i] << 24U) | \
-                         ((uint32_t)pBuffer[(4U * i) + 1U] << 16U) | \
-                         ((uint32_t)pBuffer[(4U * i) + 2U] << 8U)  | \
-                         (uint32_t)pBuffer[(4U * i) + 3U];
+    for (i = 0U; i < nb_words; i++)
+    {
+      *pDR = ((uint32_t)pBuffer[4U * i] << 24U) | \
+             ((uint32_t)pBuffer[(4U * i) + 1U] << 16U) | \
+             ((uint32_t)pBuffer[(4U * i) + 2U] << 8U)  | \
+             (uint32_t)pBuffer[(4U * i) + 3U];
+    }
   }
   /* last bytes specific handling */
   if ((BufferLength % 4U) != 0U)
@@ -491,14 +683,41 @@ static uint32_t CRC_Handle_8(CRC_HandleTypeDef *hcrc, uint8_t pBuffer[], uint32_
 static uint32_t CRC_Handle_16(CRC_HandleTypeDef *hcrc, uint16_t pBuffer[], uint32_t BufferLength)
 {
   uint32_t i;  /* input data buffer index */
+  uint32_t nb_words = BufferLength / 2U;
+  const uint32_t *pWord;
+  __IO uint32_t *pDR = &hcrc->Instance->DR;
   __IO uint16_t *pReg;
 
   /* Processing time optimization: 2 HalfWords are entered in a row with a single word write,
    * in case of odd length, last HalfWord must be carefully fed to the CRC calculator to ensure
    * a correct type handling by the peripheral */
-  for (i = 0U; i < (BufferLength / 2U); i++)
+  if (((uint32_t)pBuffer & 3U) == 0U)
   {
-    hcrc->Instance->DR = ((uint32_t)pBuffer[2U * i] << 16U) | (uint32_t)pBuffer[(2U * i) + 1U];
+    /* Word aligned buffer: single word read, half-words swapped so that the first
+     * half-word is entered in the MSBs, loop unrolled by 8 words */
+    pWord = (const uint32_t *)(void *)pBuffer;                                  /* Derogation MisraC2012 R.11.5 */
+    for (i = 0U; (i + 8U) <= nb_words; i += 8U)
+    {
+      *pDR = __ROR(pWord[i], 16U);
+      *pDR = __ROR(pWord[i + 1U], 16U);
+      *pDR = __ROR(pWord[i + 2U], 16U);
+      *pDR = __ROR(pWord[i + 3U], 16U);
+      *pDR = __ROR(pWord[i + 4U], 16U);
+      *pDR = __ROR(pWord[i + 5U], 16U);
+      *pDR = __ROR(pWord[i + 6U], 16U);
+      *pDR = __ROR(pWord[i + 7U], 16U);
+    }
+    for (; i < nb_words; i++)
+    {
+      *pDR = __ROR(pWord[i], 16U);
+    }
+  }
+  else
+  {
+    for (i = 0U; i < nb_words; i++)
+    {
+      *pDR = ((uint32_t)pBuffer[2U * i] << 16U) | (uint32_t)pBuffer[(2U * i) + 1U];
+    }
   }
   if ((BufferLength % 2U) != 0U)
   {
@@ -510,6 +729,194 @@ static uint32_t CRC_Handle_16(CRC_HandleTypeDef *hcrc, uint16_t pBuffer[], uint3
   return hcrc->Instance->DR;
 }
 
+#if defined(HAL_DMA_MODULE_ENABLED)
+/**
+  * @brief  Feed the unaligned head of the input buffer by CPU and start the DMA
+  *         streaming of the word aligned body.
+  * @param  hcrc CRC handle
+  * @param  pBuffer pointer to the input data buffer
+  * @param  BufferLength input data buffer length
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef CRC_Start_DMA(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength)
+{
+  DMA_DataHandlingConfTypeDef data_handling;
+  uint32_t buffer_address = (uint32_t)pBuffer;
+  uint32_t size;
+  uint32_t head;
+
+  switch (hcrc->InputDataFormat)
+  {
+    case CRC_INPUTDATA_FORMAT_BYTES:
+      /* CRC expects the first byte in the MSB: full byte reversal of the words read by DMA */
+      size = BufferLength;
+      head = (4U - (buffer_address & 3U)) & 3U;
+      data_handling.DataExchange = DMA_EXCHANGE_DEST_BYTE | DMA_EXCHANGE_DEST_HALFWORD;
+      break;
+
+    case CRC_INPUTDATA_FORMAT_HALFWORDS:
+      /* CRC expects the first half-word in the MSBs: half-word exchange of the words read by DMA */
+      size = BufferLength * 2U;
+      head = buffer_address & 2U;
+      data_handling.DataExchange = DMA_EXCHANGE_DEST_HALFWORD;
+      break;
+
+    case CRC_INPUTDATA_FORMAT_WORDS:
+      size = BufferLength * 4U;
+      head = 0U;
+      data_handling.DataExchange = DMA_EXCHANGE_NONE;
+      break;
+
+    default:
+      return HAL_ERROR;
+  }
+  data_handling.DataAlignment = DMA_DATA_RIGHTALIGN_ZEROPADDED;
+
+  if (head > size)
+  {
+    head = size;
+  }
+
+  /* Configure the DMA channel data exchange according to the input data format */
+  if (HAL_DMAEx_ConfigDataHandling(hcrc->hdma, &data_handling) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Change CRC peripheral state */
+  hcrc->State = HAL_CRC_STATE_BUSY;
+
+  /* Feed the unaligned leading data by CPU */
+  if (head != 0U)
+  {
+    if (hcrc->InputDataFormat == CRC_INPUTDATA_FORMAT_BYTES)
+    {
+      (void)CRC_Handle_8(hcrc, (uint8_t *)pBuffer, head);
+    }
+    else
+    {
+      (void)CRC_Handle_16(hcrc, (uint16_t *)(void *)pBuffer, 1U);    /* Derogation MisraC2012 R.11.5 */
+    }
+  }
+
+  hcrc->pBuffPtr  = (uint8_t *)pBuffer + head;
+  hcrc->XferTail  = (size - head) & 3U;
+  hcrc->XferCount = size - head - hcrc->XferTail;
+
+  /* Set the DMA channel callbacks */
+  hcrc->hdma->XferCpltCallback     = CRC_DMAXferCplt;
+  hcrc->hdma->XferHalfCpltCallback = NULL;
+  hcrc->hdma->XferErrorCallback    = CRC_DMAError;
+  hcrc->hdma->XferAbortCallback    = NULL;
+
+  /* Nothing to stream by DMA: feed the trailing data and complete */
+  if (hcrc->XferCount == 0U)
+  {
+    CRC_DMA_End(hcrc);
+
+    return HAL_OK;
+  }
+
+  return CRC_DMA_StartBlock(hcrc);
+}
+
+/**
+  * @brief  Start the DMA transfer of the next block of the input buffer body.
+  * @param  hcrc CRC handle
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef CRC_DMA_StartBlock(CRC_HandleTypeDef *hcrc)
+{
+  uint32_t block_size = hcrc->XferCount;
+  uint32_t src_address = (uint32_t)hcrc->pBuffPtr;
+
+  if (block_size > CRC_DMA_MAX_BLOCK_SIZE)
+  {
+    block_size = CRC_DMA_MAX_BLOCK_SIZE;
+  }
+
+  hcrc->XferCount -= block_size;
+  hcrc->pBuffPtr  += block_size;
+
+  if (HAL_DMA_Start_IT(hcrc->hdma, src_address, (uint32_t)&hcrc->Instance->DR, block_size) != HAL_OK)
+  {
+    /* Change CRC peripheral state */
+    hcrc->State = HAL_CRC_STATE_READY;
+
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Feed the trailing data of the input buffer by CPU and end the computation.
+  * @param  hcrc CRC handle
+  * @retval None
+  */
+static void CRC_DMA_End(CRC_HandleTypeDef *hcrc)
+{
+  if (hcrc->XferTail != 0U)
+  {
+    if (hcrc->InputDataFormat == CRC_INPUTDATA_FORMAT_BYTES)
+    {
+      (void)CRC_Handle_8(hcrc, hcrc->pBuffPtr, hcrc->XferTail);
+    }
+    else
+    {
+      (void)CRC_Handle_16(hcrc, (uint16_t *)(void *)hcrc->pBuffPtr, 1U);    /* Derogation MisraC2012 R.11.5 */
+    }
+    hcrc->XferTail = 0U;
+  }
+
+  /* Change CRC peripheral state */
+  hcrc->State = HAL_CRC_STATE_READY;
+
+  HAL_CRC_CpltCallback(hcrc);
+}
+
+/**
+  * @brief  DMA CRC block transfer complete callback.
+  * @param  hdma DMA handle
+  * @retval None
+  */
+static void CRC_DMAXferCplt(DMA_HandleTypeDef *hdma)
+{
+  CRC_HandleTypeDef *hcrc = (CRC_HandleTypeDef *)(hdma->Parent);
+
+  if (hcrc->XferCount != 0U)
+  {
+    /* Stream the next block of the input buffer body */
+    if (CRC_DMA_StartBlock(hcrc) != HAL_OK)
+    {
+      HAL_CRC_ErrorCallback(hcrc);
+    }
+  }
+  else
+  {
+    CRC_DMA_End(hcrc);
+  }
+}
+
+/**
+  * @brief  DMA CRC communication error callback.
+  * @param  hdma DMA handle
+  * @retval None
+  */
+static void CRC_DMAError(DMA_HandleTypeDef *hdma)
+{
+  CRC_HandleTypeDef *hcrc = (CRC_HandleTypeDef *)(hdma->Parent);
+
+  hcrc->XferCount = 0U;
+  hcrc->XferTail  = 0U;
+
+  /* Change CRC peripheral state */
+  hcrc->State = HAL_CRC_STATE_READY;
+
+  HAL_CRC_ErrorCallback(hcrc);
+}
+#endif /* HAL_DMA_MODULE_ENABLED */
+
 /**
   * @}
   */
@@ -24,6 +24,15 @@
     [..]
          (+) Set user-defined generating polynomial through HAL_CRCEx_Polynomial_Set()
          (+) Configure Input or Output data inversion
+         (+) Share the CRC calculator between several logical CRC streams:
+             (++) Capture the configuration of each stream once with HAL_CRCEx_SaveContext()
+                  right after its HAL_CRC_Init(), then HAL_CRCEx_ResetContext() to start
+                  a new computation on that stream
+             (++) Use HAL_CRCEx_AccumulateCtx() to feed data to one of the streams,
+                  the stream context is restored in the peripheral before the
+                  computation and saved back after it
+             (++) HAL_CRCEx_RestoreContext() and HAL_CRCEx_SaveContext() can also be
+                  called around the HAL_CRC_Accumulate() or HAL_CRC_Accumulate_DMA() calls
 
   @endverbatim
   ******************************************************************************
@@ -45,6 +54,18 @@
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
+/** @defgroup CRCEx_Private_Constants CRC Extended Private Constants
+  * @{
+  */
+#if defined(CRC_CR_RTYPE_OUT)
+#define CRCEX_CR_OUTPUT_INVERSION_MASK  (CRC_CR_REV_OUT | CRC_CR_RTYPE_OUT)  /*!< Output data inversion bits */
+#else
+#define CRCEX_CR_OUTPUT_INVERSION_MASK  CRC_CR_REV_OUT                       /*!< Output data inversion bits */
+#endif /* CRC_CR_RTYPE_OUT */
+/**
+  * @}
+  */
+
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
@@ -212,6 +233,149 @@ HAL_StatusTypeDef HAL_CRCEx_Output_Data_Reverse(CRC_HandleTypeDef *hcrc, uint32_
 
 
 
+/**
+  * @}
+  */
+
+/** @defgroup CRCEx_Exported_Functions_Group2 Extended context management functions
+  * @brief    Extended context management functions.
+  *
+@verbatim
+ ===============================================================================
+            ##### Extended context management functions #####
+ ===============================================================================
+    [..]  This section provides functions allowing to:
+      (+) Save and restore the CRC calculator state of a logical CRC stream
+      (+) Restart the computation of a logical CRC stream
+      (+) Accumulate data on a logical CRC stream
+
+    [..]  A context switch costs a few register accesses, no data is recomputed.
+          The application is in charge of the mutual exclusion between the tasks
+          sharing the CRC calculator, as for the other CRC computation functions.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Save the current CRC calculator state in a context.
+  * @param  hcrc CRC handle
+  * @param  pContext pointer to the context to fill
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CRCEx_SaveContext(CRC_HandleTypeDef *hcrc, CRC_ContextTypeDef *pContext)
+{
+  uint32_t control;
+
+  if ((hcrc == NULL) || (pContext == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hcrc->State != HAL_CRC_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  control = READ_REG(hcrc->Instance->CR) & ~CRC_CR_RESET;
+
+  pContext->InitValue       = READ_REG(hcrc->Instance->INIT);
+  pContext->Polynomial      = READ_REG(hcrc->Instance->POL);
+  pContext->Control         = control;
+  pContext->InputDataFormat = hcrc->InputDataFormat;
+
+  /* Read the running CRC value without output data inversion so that it can be
+     written back as initialization value when the context is restored */
+  WRITE_REG(hcrc->Instance->CR, control & ~CRCEX_CR_OUTPUT_INVERSION_MASK);
+  pContext->Value = READ_REG(hcrc->Instance->DR);
+  WRITE_REG(hcrc->Instance->CR, control);
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Restore a previously saved CRC calculator state.
+  * @param  hcrc CRC handle
+  * @param  pContext pointer to the context to restore
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CRCEx_RestoreContext(CRC_HandleTypeDef *hcrc, const CRC_ContextTypeDef *pContext)
+{
+  if ((hcrc == NULL) || (pContext == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hcrc->State != HAL_CRC_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  WRITE_REG(hcrc->Instance->POL, pContext->Polynomial);
+  WRITE_REG(hcrc->Instance->CR, pContext->Control);
+
+  /* Load the running CRC value in the data register through the INIT register,
+     then restore the stream initialization value */
+  WRITE_REG(hcrc->Instance->INIT, pContext->Value);
+  __HAL_CRC_DR_RESET(hcrc);
+  WRITE_REG(hcrc->Instance->INIT, pContext->InitValue);
+
+  hcrc->InputDataFormat = pContext->InputDataFormat;
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Restart the computation of a logical CRC stream from its initialization value.
+  * @param  pContext pointer to the context to reset
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CRCEx_ResetContext(CRC_ContextTypeDef *pContext)
+{
+  if (pContext == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  pContext->Value = pContext->InitValue;
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Compute the CRC value of a data buffer on a logical CRC stream starting
+  *         with the CRC value previously accumulated on that stream.
+  * @param  hcrc CRC handle
+  * @param  pContext pointer to the stream context, updated on return
+  * @param  pBuffer pointer to the input data buffer, exact input data format is
+  *         provided by pContext->InputDataFormat.
+  * @param  BufferLength input data buffer length (number of bytes if pBuffer
+  *         type is * uint8_t, number of half-words if pBuffer type is * uint16_t,
+  *         number of words if pBuffer type is * uint32_t).
+  * @retval uint32_t CRC (returned value LSBs for CRC shorter than 32 bits),
+  *         0 if the context can not be switched
+  */
+uint32_t HAL_CRCEx_AccumulateCtx(CRC_HandleTypeDef *hcrc, CRC_ContextTypeDef *pContext, uint32_t pBuffer[],
+                                 uint32_t BufferLength)
+{
+  uint32_t temp;
+
+  if (HAL_CRCEx_RestoreContext(hcrc, pContext) != HAL_OK)
+  {
+    return 0U;
+  }
+
+  temp = HAL_CRC_Accumulate(hcrc, pBuffer, BufferLength);
+
+  (void)HAL_CRCEx_SaveContext(hcrc, pContext);
+
+  /* Return the CRC computed value */
+  return temp;
+}
+
 /**
   * @}
   */
@@ -314,6 +314,8 @@
                                                  is 299 clock cycles.*/
 #define CRYP_TIMEOUT_GCMCCMHEADERPHASE   290U /*!< The latency of GCM/CCM header phase is 290 clock cycles.*/
 
+#define CRYP_SG_MAX_SEGMENT_SIZE         0xFFF0U /*!< Largest block aligned segment of a fragment processed at once */
+
 #define CRYP_PHASE_READY                 0x00000001U /*!< CRYP peripheral is ready for initialization. */
 #define CRYP_PHASE_PROCESS               0x00000002U /*!< CRYP peripheral is in processing phase */
 #if (USE_HAL_CRYP_SUSPEND_RESUME == 1U)
@@ -363,8 +365,12 @@ static HAL_StatusTypeDef CRYP_SetHeaderDMAConfig(CRYP_HandleTypeDef *hcryp, uint
 static void CRYP_DMAInCplt(DMA_HandleTypeDef *hdma);
 static void CRYP_DMAOutCplt(DMA_HandleTypeDef *hdma);
 static void CRYP_DMAError(DMA_HandleTypeDef *hdma);
+#if defined(USE_HAL_REQUEST) && (USE_HAL_REQUEST == 1U)
+static uint32_t CRYP_RequestComplete(CRYP_HandleTypeDef *hcryp, HAL_StatusTypeDef Status);
+#endif /* USE_HAL_REQUEST */
 static void CRYP_SetKey(CRYP_HandleTypeDef *hcryp, uint32_t KeySize);
 static void CRYP_SetIV(CRYP_HandleTypeDef *hcryp);
+static HAL_StatusTypeDef CRYP_LoadPreparedKey(CRYP_HandleTypeDef *hcryp, CRYP_PreparedKeyTypeDef *pPrepKey);
 static void CRYP_AES_IT(CRYP_HandleTypeDef *hcryp);
 static HAL_StatusTypeDef CRYP_WaitFLAG(CRYP_HandleTypeDef *hcryp, uint32_t flag, FlagStatus Status, uint32_t Timeout);
 static HAL_StatusTypeDef CRYP_GCMCCM_SetHeaderPhase(CRYP_HandleTypeDef *hcryp, uint32_t Timeout);
@@ -373,6 +379,12 @@ static void CRYP_GCMCCM_SetHeaderPhase_IT(CRYP_HandleTypeDef *hcryp);
 static HAL_StatusTypeDef CRYP_GCMCCM_SetHeaderPhase_DMA(CRYP_HandleTypeDef *hcryp);
 static HAL_StatusTypeDef CRYP_GCMCCM_SetPayloadPhase_DMA(CRYP_HandleTypeDef *hcryp);
 static HAL_StatusTypeDef CRYP_AESGCM_Process_DMA(CRYP_HandleTypeDef *hcryp);
+static HAL_StatusTypeDef CRYP_AESGCM_FinalPhase_DMA(CRYP_HandleTypeDef *hcryp);
+static HAL_StatusTypeDef CRYP_SG_Start(CRYP_HandleTypeDef *hcryp, const CRYP_FragmentTypeDef *pInput,
+                                       const CRYP_FragmentTypeDef *pOutput, uint32_t FragmentNbr, uint32_t Decrypt);
+static HAL_StatusTypeDef CRYP_SG_StartSegment(CRYP_HandleTypeDef *hcryp);
+static HAL_StatusTypeDef CRYP_SG_Continue(CRYP_HandleTypeDef *hcryp);
+static void CRYP_SG_End(CRYP_HandleTypeDef *hcryp);
 static HAL_StatusTypeDef CRYP_AESGCM_Process_IT(CRYP_HandleTypeDef *hcryp);
 static HAL_StatusTypeDef CRYP_AESGCM_Process(CRYP_HandleTypeDef *hcryp, uint32_t Timeout);
 static HAL_StatusTypeDef CRYP_AESCCM_Process(CRYP_HandleTypeDef *hcryp, uint32_t Timeout);
@@ -475,6 +487,13 @@ static void CRYP_CopyPartialOutputWord(uint32_t *pOutputWord, uint32_t word, uin
       (+) For interleave mode, API HAL_CRYP_SaveContext and HAL_CRYP_RestoreContext to be used to save then Restore CRYP
           configuration and parameters. CRYP_IVCONFIG_ONCE should be selected for KeyIVConfigSkip parameter.
           Only polling mode is supported, interleave mode should be used with HAL_CRYP_Encrypt and HAL_CRYP_Decrypt API.
+      (+) For many short ECB, CBC or CTR messages with the same key, API HAL_CRYP_PrepareKey loads the key
+          (and runs the decryption key derivation in ECB/CBC decryption) once into a CRYP_PreparedKeyTypeDef,
+          then HAL_CRYP_LoadPreparedKey only writes the CR and IV registers before each message.
+          If another key was loaded in between, the key is loaded and derived again (key registers are write-only).
+          A key prepared for decryption must only be used with the decryption APIs, and vice versa.
+          With SAES, HAL_CRYPEx_PrepareUnwrappedKey keeps an unwrapped key resident the same way, and
+          HAL_CRYPEx_ReleasePreparedKey erases a prepared key from the key registers.
 
 @endverbatim
   * @{
@@ -598,6 +617,20 @@ HAL_StatusTypeDef HAL_CRYP_Init(CRYP_HandleTypeDef *hcryp)
   /* Reset peripheral Key and IV configuration flag */
   hcryp->KeyIVConfig = 0U;
 
+  /* No GCM final phase chained to the DMA processing */
+  hcryp->pAuthTag = NULL;
+
+  /* No scatter-gather processing ongoing */
+  hcryp->SG.pIn = NULL;
+
+  /* No prepared key held in the key registers */
+  hcryp->pPreparedKey = NULL;
+
+#if defined(USE_HAL_REQUEST) && (USE_HAL_REQUEST == 1U)
+  /* No asynchronous request ongoing */
+  hcryp->pRequest = NULL;
+
+#endif /* USE_HAL_REQUEST */
   /* Change the CRYP state */
   hcryp->State = HAL_CRYP_STATE_READY;
 
@@ -698,6 +731,9 @@ HAL_StatusTypeDef HAL_CRYP_SetConfig(CRYP_HandleTypeDef *hcryp, CRYP_ConfigTypeD
     hcryp->Init.HeaderWidthUnit = pConf->HeaderWidthUnit;
     hcryp->Init.KeyIVConfigSkip = pConf->KeyIVConfigSkip;
 
+    /* The key registers are going to be written again */
+    hcryp->pPreparedKey = NULL;
+
     if (hcryp->Instance == AES)
     {
       /* Check the busy flag before writing CR register */
@@ -1291,6 +1327,7 @@ HAL_StatusTypeDef HAL_CRYP_RestoreContext(CRYP_HandleTypeDef *hcryp, CRYP_Contex
     hcryp->Init.KeyMode         = pcont->KeyMode;
     hcryp->Phase                = pcont->Phase;
     hcryp->KeyIVConfig          = pcont->KeyIVConfig;
+    hcryp->pPreparedKey         = NULL;
     /* Check the busy flag before writing CR register */
     if (CRYP_WaitFLAG(hcryp, AES_SR_BUSY, SET, CRYP_GENERAL_TIMEOUT) != HAL_OK)
     {
@@ -1321,6 +1358,149 @@ HAL_StatusTypeDef HAL_CRYP_RestoreContext(CRYP_HandleTypeDef *hcryp, CRYP_Contex
   }
 }
 
+/**
+  * @brief  Prepare the key of the current configuration once for several ECB, CBC or CTR messages.
+  * @note   The key is written, and derived for ECB/CBC decryption (Mode 2), then the Key and IV
+  *         configuration is skipped by the next processings. HAL_CRYP_LoadPreparedKey() selects it
+  *         again and sets the message IV with minimal register writes.
+  * @note   Only normal key mode with a key provided by pKey is supported.
+  * @param  hcryp pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module
+  * @param  pPrepKey pointer to a CRYP_PreparedKeyTypeDef structure filled with the prepared key.
+  * @param  Decrypt 1 to prepare the key for decryption, 0 for encryption
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CRYP_PrepareKey(CRYP_HandleTypeDef *hcryp, CRYP_PreparedKeyTypeDef *pPrepKey, uint32_t Decrypt)
+{
+  HAL_StatusTypeDef status;
+
+  /* Check the CRYP handle allocation */
+  if ((hcryp == NULL) || (pPrepKey == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hcryp->State != HAL_CRYP_STATE_READY)
+  {
+    /* Busy error code field */
+    hcryp->ErrorCode |= HAL_CRYP_ERROR_BUSY;
+    return HAL_ERROR;
+  }
+
+  if ((hcryp->Init.pKey == NULL) || (hcryp->Init.KeyMode != CRYP_KEYMODE_NORMAL) ||
+      ((hcryp->Init.Algorithm != CRYP_AES_ECB) && (hcryp->Init.Algorithm != CRYP_AES_CBC) &&
+       (hcryp->Init.Algorithm != CRYP_AES_CTR)) ||
+      ((hcryp->Instance != AES) && (hcryp->Init.KeySelect != CRYP_KEYSEL_NORMAL)))
+  {
+    hcryp->ErrorCode |= HAL_CRYP_ERROR_NOT_SUPPORTED;
+    return HAL_ERROR;
+  }
+
+  /* Change state Busy */
+  hcryp->State = HAL_CRYP_STATE_BUSY;
+  __HAL_LOCK(hcryp);
+
+  /* Store the key configuration */
+  pPrepKey->DataType      = hcryp->Init.DataType;
+  pPrepKey->KeySize       = hcryp->Init.KeySize;
+  pPrepKey->pKey          = hcryp->Init.pKey;
+  pPrepKey->Algorithm     = hcryp->Init.Algorithm;
+  pPrepKey->DataWidthUnit = hcryp->Init.DataWidthUnit;
+  pPrepKey->Decrypt       = (Decrypt != 0U) ? 1U : 0U;
+  pPrepKey->pWrappedKey   = NULL;
+
+  status = CRYP_LoadPreparedKey(hcryp, pPrepKey);
+  if (status == HAL_OK)
+  {
+    /* Change the CRYP peripheral state */
+    hcryp->State = HAL_CRYP_STATE_READY;
+    __HAL_UNLOCK(hcryp);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Select a prepared key and set the IV of the next message.
+  * @note   When the prepared key is still held in the key registers, only the CR and IV
+  *         registers are written, otherwise the key is loaded (and derived) again.
+  * @param  hcryp pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module
+  * @param  pPrepKey pointer to a CRYP_PreparedKeyTypeDef structure filled by HAL_CRYP_PrepareKey().
+  * @param  pInitVect pointer to the IV of the next message, not used in ECB mode.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CRYP_LoadPreparedKey(CRYP_HandleTypeDef *hcryp, CRYP_PreparedKeyTypeDef *pPrepKey,
+                                           uint32_t *pInitVect)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  /* Check the CRYP handle allocation */
+  if ((hcryp == NULL) || (pPrepKey == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hcryp->State != HAL_CRYP_STATE_READY)
+  {
+    /* Busy error code field */
+    hcryp->ErrorCode |= HAL_CRYP_ERROR_BUSY;
+    return HAL_ERROR;
+  }
+
+  if ((hcryp->pPreparedKey != pPrepKey) && (pPrepKey->pWrappedKey != NULL))
+  {
+    /* The unwrapped key is no longer in the key registers, it must be unwrapped again */
+    hcryp->ErrorCode |= HAL_CRYP_ERROR_KEY;
+    return HAL_ERROR;
+  }
+
+  /* Change state Busy */
+  hcryp->State = HAL_CRYP_STATE_BUSY;
+  __HAL_LOCK(hcryp);
+
+  /* Restore the key configuration, already checked by HAL_CRYP_PrepareKey() */
+  hcryp->Init.DataType      = pPrepKey->DataType;
+  hcryp->Init.KeySize       = pPrepKey->KeySize;
+  hcryp->Init.pKey          = pPrepKey->pKey;
+  hcryp->Init.Algorithm     = pPrepKey->Algorithm;
+  hcryp->Init.DataWidthUnit = pPrepKey->DataWidthUnit;
+  hcryp->Init.pInitVect     = pInitVect;
+
+  if (hcryp->pPreparedKey != pPrepKey)
+  {
+    /* The key registers were written in between, load and derive the key again */
+    status = CRYP_LoadPreparedKey(hcryp, pPrepKey);
+  }
+  else
+  {
+    /* Check the busy flag before writing CR register */
+    if (CRYP_WaitFLAG(hcryp, AES_SR_BUSY, SET, CRYP_GENERAL_TIMEOUT) != HAL_OK)
+    {
+      hcryp->State = HAL_CRYP_STATE_READY;
+      __HAL_UNLOCK(hcryp);
+      return HAL_ERROR;
+    }
+    WRITE_REG(hcryp->Instance->CR, pPrepKey->CR_Reg);
+    hcryp->Phase = CRYP_PHASE_READY;
+  }
+
+  if (status == HAL_OK)
+  {
+    /* Set the IV of the message */
+    if (hcryp->Init.Algorithm != CRYP_AES_ECB)
+    {
+      CRYP_SetIV(hcryp);
+    }
+
+    /* Change the CRYP peripheral state */
+    hcryp->State = HAL_CRYP_STATE_READY;
+    __HAL_UNLOCK(hcryp);
+  }
+
+  return status;
+}
+
 /**
   * @}
   */
@@ -1345,6 +1525,18 @@ HAL_StatusTypeDef HAL_CRYP_RestoreContext(CRYP_HandleTypeDef *hcryp, CRYP_Contex
       (+) Polling mode : HAL_CRYP_Encrypt & HAL_CRYP_Decrypt
       (+) Interrupt mode : HAL_CRYP_Encrypt_IT & HAL_CRYP_Decrypt_IT
       (+) DMA mode : HAL_CRYP_Encrypt_DMA & HAL_CRYP_Decrypt_DMA
+    [..]  Fragmented buffers can be processed in DMA mode without intermediate copy
+          with HAL_CRYP_EncryptSG & HAL_CRYP_DecryptSG:
+      (+) input and output are arrays of fragments with the same sizes (e.g. in place
+          processing of a chain of network buffers)
+      (+) the word aligned block aligned part of each fragment is processed by DMA, the
+          blocks straddling fragments are gathered, processed and scattered back by the driver
+      (+) HAL_CRYP_OutCpltCallback() is called once the whole message is processed
+      (+) ECB, CBC and CTR messages must be a multiple of 16 bytes, CCM is not supported
+    [..]  With USE_HAL_REQUEST set to 1, HAL_CRYP_Request_Start() is the Start function of a
+          HAL_RequestTypeDef encrypting or decrypting (Operation field) Size data from pSrc to
+          pDst in DMA mode. The request is completed at the end of the output DMA transfer,
+          HAL_CRYP_OutCpltCallback() and HAL_CRYP_ErrorCallback() are not called for it.
 
 @endverbatim
   * @{
@@ -2118,6 +2310,87 @@ HAL_StatusTypeDef HAL_CRYP_Decrypt_DMA(CRYP_HandleTypeDef *hcryp, uint32_t *pInp
   return status;
 }
 
+/**
+  * @brief  Encryption in DMA mode of a message split in several fragments.
+  * @note   The block aligned parts of the fragments are processed in DMA mode, the
+  *         blocks straddling two fragments are gathered and scattered by the driver.
+  * @param  hcryp pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module
+  * @param  pInput Pointer to the input fragments array (plaintext)
+  * @param  pOutput Pointer to the output fragments array (ciphertext), each output fragment
+  *         must have the size of the input fragment of the same index
+  * @param  FragmentNbr Number of fragments
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CRYP_EncryptSG(CRYP_HandleTypeDef *hcryp, const CRYP_FragmentTypeDef *pInput,
+                                     const CRYP_FragmentTypeDef *pOutput, uint32_t FragmentNbr)
+{
+  return CRYP_SG_Start(hcryp, pInput, pOutput, FragmentNbr, 0U);
+}
+
+/**
+  * @brief  Decryption in DMA mode of a message split in several fragments.
+  * @note   The block aligned parts of the fragments are processed in DMA mode, the
+  *         blocks straddling two fragments are gathered and scattered by the driver.
+  * @param  hcryp pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module
+  * @param  pInput Pointer to the input fragments array (ciphertext)
+  * @param  pOutput Pointer to the output fragments array (plaintext), each output fragment
+  *         must have the size of the input fragment of the same index
+  * @param  FragmentNbr Number of fragments
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CRYP_DecryptSG(CRYP_HandleTypeDef *hcryp, const CRYP_FragmentTypeDef *pInput,
+                                     const CRYP_FragmentTypeDef *pOutput, uint32_t FragmentNbr)
+{
+  return CRYP_SG_Start(hcryp, pInput, pOutput, FragmentNbr, 1U);
+}
+
+#if defined(USE_HAL_REQUEST) && (USE_HAL_REQUEST == 1U)
+/**
+  * @brief  Start the DMA processing of an asynchronous request.
+  * @note   Set as the Start function of the request, called by HAL_Request_Submit().
+  * @param  pReq pointer to the request, its Handle is the CRYP handle and its Operation a value
+  *         of @ref CRYP_Request_Operation. pSrc and pDst must be word aligned.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CRYP_Request_Start(HAL_RequestTypeDef *pReq)
+{
+  CRYP_HandleTypeDef *hcryp = (CRYP_HandleTypeDef *)pReq->Handle;
+  HAL_StatusTypeDef status;
+
+  if ((pReq->pSrc == NULL) || (pReq->pDst == NULL) || (pReq->Size > 0xFFFFU))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hcryp->pRequest != NULL)
+  {
+    return HAL_BUSY;
+  }
+
+  hcryp->pRequest = pReq;
+
+  if (pReq->Operation == HAL_CRYP_REQUEST_DECRYPT)
+  {
+    status = HAL_CRYP_Decrypt_DMA(hcryp, (uint32_t *)(void *)pReq->pSrc, (uint16_t)pReq->Size,
+                                  (uint32_t *)(void *)pReq->pDst);
+  }
+  else
+  {
+    status = HAL_CRYP_Encrypt_DMA(hcryp, (uint32_t *)(void *)pReq->pSrc, (uint16_t)pReq->Size,
+                                  (uint32_t *)(void *)pReq->pDst);
+  }
+
+  if (status != HAL_OK)
+  {
+    hcryp->pRequest = NULL;
+  }
+
+  return status;
+}
+#endif /* USE_HAL_REQUEST */
+
 /**
   * @}
   */
@@ -3343,10 +3616,36 @@ static void CRYP_DMAOutCplt(DMA_HandleTypeDef *hdma)
     __HAL_CRYP_DISABLE(hcryp);
   }
 
+  /* Scatter-gather processing: go on with the next segment of the message */
+  if (hcryp->SG.pIn != NULL)
+  {
+    if (CRYP_SG_Continue(hcryp) != HAL_OK)
+    {
+      return;
+    }
+  }
+
+  /* GCM final phase chained to the payload phase */
+  if (hcryp->pAuthTag != NULL)
+  {
+    if (CRYP_AESGCM_FinalPhase_DMA(hcryp) != HAL_OK)
+    {
+      return;
+    }
+  }
+
   /* Change the CRYP state to ready */
   hcryp->State = HAL_CRYP_STATE_READY;
   __HAL_UNLOCK(hcryp);
 
+#if defined(USE_HAL_REQUEST) && (USE_HAL_REQUEST == 1U)
+  /* Asynchronous request : complete it instead of the callback */
+  if (CRYP_RequestComplete(hcryp, HAL_OK) != 0U)
+  {
+    return;
+  }
+
+#endif /* USE_HAL_REQUEST */
   /* Call output data transfer complete callback */
 #if (USE_HAL_CRYP_REGISTER_CALLBACKS == 1U)
   /*Call registered Output complete callback*/
@@ -3369,12 +3668,27 @@ static void CRYP_DMAError(DMA_HandleTypeDef *hdma)
   /* Change the CRYP peripheral state */
   hcryp->State = HAL_CRYP_STATE_READY;
 
+  /* Cancel the chained GCM final phase and scatter-gather processing */
+  hcryp->pAuthTag = NULL;
+  if (hcryp->SG.pIn != NULL)
+  {
+    CRYP_SG_End(hcryp);
+  }
+
   /* DMA error code field */
   hcryp->ErrorCode |= HAL_CRYP_ERROR_DMA;
 
   /* Clear CCF flag */
   __HAL_CRYP_CLEAR_FLAG(hcryp, CRYP_CLEAR_CCF);
 
+#if defined(USE_HAL_REQUEST) && (USE_HAL_REQUEST == 1U)
+  /* Asynchronous request : complete it instead of the callback */
+  if (CRYP_RequestComplete(hcryp, HAL_ERROR) != 0U)
+  {
+    return;
+  }
+
+#endif /* USE_HAL_REQUEST */
   /* Call error callback */
 #if (USE_HAL_CRYP_REGISTER_CALLBACKS == 1U)
   /*Call registered error callback*/
@@ -3385,6 +3699,31 @@ static void CRYP_DMAError(DMA_HandleTypeDef *hdma)
 #endif /* USE_HAL_CRYP_REGISTER_CALLBACKS */
 }
 
+#if defined(USE_HAL_REQUEST) && (USE_HAL_REQUEST == 1U)
+/**
+  * @brief  Complete the ongoing asynchronous request.
+  * @param  hcryp pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module
+  * @param  Status completion status of the request
+  * @retval 1 if a request was ongoing, 0 otherwise
+  */
+static uint32_t CRYP_RequestComplete(CRYP_HandleTypeDef *hcryp, HAL_StatusTypeDef Status)
+{
+  HAL_RequestTypeDef *preq = hcryp->pRequest;
+
+  if (preq == NULL)
+  {
+    return 0U;
+  }
+
+  /* The next request of the chain may be started on this CRYP */
+  hcryp->pRequest = NULL;
+  HAL_Request_Complete(preq, Status);
+
+  return 1U;
+}
+#endif /* USE_HAL_REQUEST */
+
 /**
   * @brief  Set the DMA configuration and start the DMA transfer
   * @param  hcryp pointer to a CRYP_HandleTypeDef structure that contains
@@ -3800,6 +4139,71 @@ static void CRYP_SetKey(CRYP_HandleTypeDef *hcryp, uint32_t KeySize)
   }
 }
 
+/**
+  * @brief  Write the key of a prepared key in the key registers, derive it for ECB/CBC decryption,
+  *         and set the Key and IV configuration as done for the next processings.
+  * @param  hcryp pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module
+  * @param  pPrepKey pointer to a CRYP_PreparedKeyTypeDef structure
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef CRYP_LoadPreparedKey(CRYP_HandleTypeDef *hcryp, CRYP_PreparedKeyTypeDef *pPrepKey)
+{
+  uint32_t mode;
+
+  /* Check the busy flag before writing CR register */
+  if (CRYP_WaitFLAG(hcryp, AES_SR_BUSY, SET, CRYP_GENERAL_TIMEOUT) != HAL_OK)
+  {
+    hcryp->State = HAL_CRYP_STATE_READY;
+    __HAL_UNLOCK(hcryp);
+    return HAL_ERROR;
+  }
+
+  /* The key registers no longer hold a prepared key until the end of the preparation */
+  hcryp->pPreparedKey = NULL;
+
+  /* Set the key size, data type, AlgoMode and normal key mode */
+  MODIFY_REG(hcryp->Instance->CR, AES_CR_DATATYPE | AES_CR_KEYSIZE | AES_CR_CHMOD | AES_CR_KMOD | AES_CR_NPBLB,
+             pPrepKey->DataType | pPrepKey->KeySize | pPrepKey->Algorithm | CRYP_KEYMODE_NORMAL);
+
+  if ((pPrepKey->Decrypt != 0U) && (pPrepKey->Algorithm != CRYP_AES_CTR))
+  {
+    /* Key preparation for decryption, operating mode 2 */
+    MODIFY_REG(hcryp->Instance->CR, AES_CR_MODE, CRYP_OPERATINGMODE_KEYDERIVATION);
+    CRYP_SetKey(hcryp, pPrepKey->KeySize);
+
+    /* Enable CRYP */
+    __HAL_CRYP_ENABLE(hcryp);
+
+    /* Wait for CCF flag to be raised */
+    if (CRYP_WaitOnCCFlag(hcryp, CRYP_GENERAL_TIMEOUT) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+    /* Clear CCF Flag */
+    __HAL_CRYP_CLEAR_FLAG(hcryp, CRYP_CLEAR_CCF);
+
+    /* Disable CRYP, the derived key is kept in the key registers */
+    __HAL_CRYP_DISABLE(hcryp);
+  }
+  else
+  {
+    CRYP_SetKey(hcryp, pPrepKey->KeySize);
+  }
+
+  mode = (pPrepKey->Decrypt != 0U) ? CRYP_OPERATINGMODE_DECRYPT : CRYP_OPERATINGMODE_ENCRYPT;
+  MODIFY_REG(hcryp->Instance->CR, AES_CR_MODE, mode);
+  pPrepKey->CR_Reg = READ_REG(hcryp->Instance->CR);
+
+  /* Skip the Key and IV configuration in the next processings */
+  hcryp->Init.KeyIVConfigSkip = CRYP_KEYIVCONFIG_ONCE;
+  hcryp->KeyIVConfig = 1U;
+  hcryp->Phase = CRYP_PHASE_READY;
+  hcryp->pPreparedKey = pPrepKey;
+
+  return HAL_OK;
+}
+
 /**
   * @brief  Writes initialization vector in IV registers.
   * @param  hcryp pointer to a CRYP_HandleTypeDef structure that contains
@@ -4613,6 +5017,315 @@ static HAL_StatusTypeDef CRYP_AESGCM_Process_DMA(CRYP_HandleTypeDef *hcryp)
   return HAL_OK;
 }
 
+/**
+  * @brief  AES GCM final phase chained to the end of the DMA payload phase:
+  *         generate the authentication TAG in hcryp->pAuthTag.
+  * @note   On error, the CRYP state is set to ready and the error callback is called.
+  * @param  hcryp pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef CRYP_AESGCM_FinalPhase_DMA(CRYP_HandleTypeDef *hcryp)
+{
+  /* Assume first Init.HeaderSize is in words */
+  uint64_t headerlength = (uint64_t)hcryp->Init.HeaderSize * 32U; /* Header length in bits */
+  uint64_t inputlength = (uint64_t)hcryp->SizesSum * 8U; /* Input length in bits */
+  uint32_t tagaddr = (uint32_t)hcryp->pAuthTag;
+  uint32_t count;
+
+  /* Correct headerlength if Init.HeaderSize is actually in bytes */
+  if (hcryp->Init.HeaderWidthUnit == CRYP_HEADERWIDTHUNIT_BYTE)
+  {
+    headerlength /= 4U;
+  }
+
+  hcryp->pAuthTag = NULL;
+
+  /* Select final phase */
+  MODIFY_REG(hcryp->Instance->CR, AES_CR_GCMPH, CRYP_PHASE_FINAL);
+
+  /* Write into the AES_DINR register the number of bits in header (64 bits)
+  followed by the number of bits in the payload */
+  hcryp->Instance->DINR = 0U;
+  hcryp->Instance->DINR = (uint32_t)(headerlength);
+  hcryp->Instance->DINR = 0U;
+  hcryp->Instance->DINR = (uint32_t)(inputlength);
+
+  /* Wait for CCF flag to be raised, the final phase latency is a single block one */
+  count = CRYP_TIMEOUT_GCMCCMHEADERPHASE;
+  do
+  {
+    count--;
+    if (count == 0U)
+    {
+      /* Disable the CRYP peripheral clock */
+      __HAL_CRYP_DISABLE(hcryp);
+
+      /* Change state */
+      hcryp->ErrorCode |= HAL_CRYP_ERROR_TIMEOUT;
+      hcryp->State = HAL_CRYP_STATE_READY;
+
+      /* Process unlocked */
+      __HAL_UNLOCK(hcryp);
+
+#if (USE_HAL_CRYP_REGISTER_CALLBACKS == 1U)
+      /*Call registered error callback*/
+      hcryp->ErrorCallback(hcryp);
+#else
+      /*Call legacy weak error callback*/
+      HAL_CRYP_ErrorCallback(hcryp);
+#endif /* USE_HAL_CRYP_REGISTER_CALLBACKS */
+      return HAL_ERROR;
+    }
+  } while (HAL_IS_BIT_CLR(hcryp->Instance->ISR, AES_ISR_CCF));
+
+  /* Read the authentication TAG in the output FIFO */
+  for (count = 0U; count < 4U; count++)
+  {
+    *(uint32_t *)(tagaddr) = hcryp->Instance->DOUTR;
+    tagaddr += 4U;
+  }
+
+  /* Clear CCF flag */
+  __HAL_CRYP_CLEAR_FLAG(hcryp, CRYP_CLEAR_CCF);
+
+  /* Disable the peripheral */
+  __HAL_CRYP_DISABLE(hcryp);
+
+  /* The message is complete */
+  hcryp->Phase = CRYP_PHASE_READY;
+
+  return HAL_OK;
+}
+
+
+/**
+  * @brief  Check and start the scatter-gather processing of a fragmented message.
+  * @param  hcryp pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module
+  * @param  pInput Pointer to the input fragments array
+  * @param  pOutput Pointer to the output fragments array
+  * @param  FragmentNbr Number of fragments
+  * @param  Decrypt 1 for decryption, 0 for encryption
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef CRYP_SG_Start(CRYP_HandleTypeDef *hcryp, const CRYP_FragmentTypeDef *pInput,
+                                       const CRYP_FragmentTypeDef *pOutput, uint32_t FragmentNbr, uint32_t Decrypt)
+{
+  uint32_t total_size = 0U;
+  uint32_t index;
+
+  /* Check the CRYP handle and fragments allocation */
+  if ((hcryp == NULL) || (pInput == NULL) || (pOutput == NULL) || (FragmentNbr == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hcryp->State != HAL_CRYP_STATE_READY)
+  {
+    /* Busy error code field */
+    hcryp->ErrorCode |= HAL_CRYP_ERROR_BUSY;
+    return HAL_ERROR;
+  }
+
+  /* Output fragments mirror the input ones */
+  for (index = 0U; index < FragmentNbr; index++)
+  {
+    if ((pInput[index].Size != pOutput[index].Size) ||
+        ((pInput[index].Size != 0U) && ((pInput[index].pBuffer == NULL) || (pOutput[index].pBuffer == NULL))))
+    {
+      return HAL_ERROR;
+    }
+    total_size += pInput[index].Size;
+  }
+
+  /* Only the last segment of a GCM message may be a partial block, CCM can not be split,
+     segments use the chained Key and IV configuration */
+  if ((total_size == 0U) || (hcryp->Init.Algorithm == CRYP_AES_CCM) ||
+      ((hcryp->Init.Algorithm != CRYP_AES_GCM_GMAC) && ((total_size % 16U) != 0U)) ||
+      ((hcryp->Init.DataWidthUnit == CRYP_DATAWIDTHUNIT_WORD) && ((total_size % 4U) != 0U)) ||
+      (hcryp->Init.KeyIVConfigSkip == CRYP_KEYNOCONFIG))
+  {
+    hcryp->ErrorCode |= HAL_CRYP_ERROR_NOT_SUPPORTED;
+    return HAL_ERROR;
+  }
+
+  hcryp->SG.pIn             = pInput;
+  hcryp->SG.pOut            = pOutput;
+  hcryp->SG.FragmentNbr     = FragmentNbr;
+  hcryp->SG.Index           = 0U;
+  hcryp->SG.Offset          = 0U;
+  hcryp->SG.Remaining       = total_size;
+  hcryp->SG.BlockSize       = 0U;
+  hcryp->SG.Decrypt         = Decrypt;
+  hcryp->SG.KeyIVConfigSkip = hcryp->Init.KeyIVConfigSkip;
+
+  /* The segments are processed as successive parts of a single message */
+  if (hcryp->Init.KeyIVConfigSkip == CRYP_KEYIVCONFIG_ALWAYS)
+  {
+    hcryp->Init.KeyIVConfigSkip = CRYP_KEYIVCONFIG_ONCE;
+    hcryp->KeyIVConfig = 0U;
+  }
+
+  if (CRYP_SG_StartSegment(hcryp) != HAL_OK)
+  {
+    CRYP_SG_End(hcryp);
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Start the processing of the next segment of a fragmented message: the block
+  *         aligned part of the current fragment, or a block gathered from several fragments.
+  * @param  hcryp pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef CRYP_SG_StartSegment(CRYP_HandleTypeDef *hcryp)
+{
+  CRYP_SGStateTypeDef *sg = &hcryp->SG;
+  uint8_t *p_block = (uint8_t *)sg->BlockIn;
+  uint8_t *p_in;
+  uint8_t *p_out;
+  uint32_t size;
+  uint32_t index;
+
+  /* Skip the fully processed and empty fragments */
+  while (sg->Offset == sg->pIn[sg->Index].Size)
+  {
+    sg->Index++;
+    sg->Offset = 0U;
+  }
+
+  p_in  = &sg->pIn[sg->Index].pBuffer[sg->Offset];
+  p_out = &sg->pOut[sg->Index].pBuffer[sg->Offset];
+  size  = sg->pIn[sg->Index].Size - sg->Offset;
+
+  if ((size >= 16U) && ((((uint32_t)p_in | (uint32_t)p_out) & 3U) == 0U))
+  {
+    /* Block aligned part of the fragment processed in place by DMA */
+    size &= ~15U;
+    if (size > CRYP_SG_MAX_SEGMENT_SIZE)
+    {
+      size = CRYP_SG_MAX_SEGMENT_SIZE;
+    }
+    sg->Offset    += size;
+    sg->BlockSize  = 0U;
+  }
+  else
+  {
+    /* Gather the next block, possibly straddling several fragments */
+    size = (sg->Remaining < 16U) ? sg->Remaining : 16U;
+    sg->BlockIndex  = sg->Index;
+    sg->BlockOffset = sg->Offset;
+    sg->BlockSize   = size;
+    for (index = 0U; index < 4U; index++)
+    {
+      sg->BlockIn[index] = 0U;
+    }
+    for (index = 0U; index < size; index++)
+    {
+      while (sg->Offset == sg->pIn[sg->Index].Size)
+      {
+        sg->Index++;
+        sg->Offset = 0U;
+      }
+      p_block[index] = sg->pIn[sg->Index].pBuffer[sg->Offset];
+      sg->Offset++;
+    }
+    p_in  = (uint8_t *)sg->BlockIn;
+    p_out = (uint8_t *)sg->BlockOut;
+  }
+  sg->Remaining -= size;
+
+  /* Convert the segment size according to DataWidthUnit */
+  if (hcryp->Init.DataWidthUnit == CRYP_DATAWIDTHUNIT_WORD)
+  {
+    size /= 4U;
+  }
+
+  if (sg->Decrypt != 0U)
+  {
+    return HAL_CRYP_Decrypt_DMA(hcryp, (uint32_t *)(void *)p_in, (uint16_t)size, (uint32_t *)(void *)p_out);
+  }
+  return HAL_CRYP_Encrypt_DMA(hcryp, (uint32_t *)(void *)p_in, (uint16_t)size, (uint32_t *)(void *)p_out);
+}
+
+/**
+  * @brief  End of a segment of a fragmented message: scatter the output block if any
+  *         and start the next segment.
+  * @param  hcryp pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module
+  * @retval HAL_OK when the whole message is processed, HAL_BUSY when the next
+  *         segment is started, HAL_ERROR on error (error callback already called)
+  */
+static HAL_StatusTypeDef CRYP_SG_Continue(CRYP_HandleTypeDef *hcryp)
+{
+  CRYP_SGStateTypeDef *sg = &hcryp->SG;
+  const uint8_t *p_block = (const uint8_t *)sg->BlockOut;
+  uint32_t frag_index;
+  uint32_t frag_offset;
+  uint32_t index;
+
+  /* Scatter the block straddling several fragments */
+  if (sg->BlockSize != 0U)
+  {
+    frag_index  = sg->BlockIndex;
+    frag_offset = sg->BlockOffset;
+    for (index = 0U; index < sg->BlockSize; index++)
+    {
+      while (frag_offset == sg->pOut[frag_index].Size)
+      {
+        frag_index++;
+        frag_offset = 0U;
+      }
+      sg->pOut[frag_index].pBuffer[frag_offset] = p_block[index];
+      frag_offset++;
+    }
+    sg->BlockSize = 0U;
+  }
+
+  if (sg->Remaining == 0U)
+  {
+    CRYP_SG_End(hcryp);
+    return HAL_OK;
+  }
+
+  /* Release the peripheral for the next segment */
+  hcryp->State = HAL_CRYP_STATE_READY;
+  __HAL_UNLOCK(hcryp);
+
+  if (CRYP_SG_StartSegment(hcryp) != HAL_OK)
+  {
+    CRYP_SG_End(hcryp);
+    hcryp->State = HAL_CRYP_STATE_READY;
+
+#if (USE_HAL_CRYP_REGISTER_CALLBACKS == 1U)
+    /*Call registered error callback*/
+    hcryp->ErrorCallback(hcryp);
+#else
+    /*Call legacy weak error callback*/
+    HAL_CRYP_ErrorCallback(hcryp);
+#endif /* USE_HAL_CRYP_REGISTER_CALLBACKS */
+    return HAL_ERROR;
+  }
+
+  return HAL_BUSY;
+}
+
+/**
+  * @brief  End the scatter-gather processing and restore the user Key and IV configuration setting.
+  * @param  hcryp pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module
+  * @retval None
+  */
+static void CRYP_SG_End(CRYP_HandleTypeDef *hcryp)
+{
+  hcryp->Init.KeyIVConfigSkip = hcryp->SG.KeyIVConfigSkip;
+  hcryp->SG.pIn = NULL;
+}
 
 /**
   * @brief  AES CCM encryption/decryption processing in polling mode
@@ -5557,6 +6270,7 @@ static void CRYP_GCMCCM_SetPayloadPhase_IT(CRYP_HandleTypeDef *hcryp)
   */
 static HAL_StatusTypeDef CRYP_GCMCCM_SetPayloadPhase_DMA(CRYP_HandleTypeDef *hcryp)
 {
+  HAL_StatusTypeDef status;
   uint32_t index;
   uint32_t npblb;
   uint32_t lastwordsize;
@@ -5669,6 +6383,25 @@ static HAL_StatusTypeDef CRYP_GCMCCM_SetPayloadPhase_DMA(CRYP_HandleTypeDef *hcr
       hcryp->CrypOutCount++;
     }
 
+    /* Scatter-gather processing: go on with the next segment of the message */
+    if (hcryp->SG.pIn != NULL)
+    {
+      status = CRYP_SG_Continue(hcryp);
+      if (status != HAL_OK)
+      {
+        return (status == HAL_BUSY) ? HAL_OK : HAL_ERROR;
+      }
+    }
+
+    /* GCM final phase chained to the payload phase */
+    if (hcryp->pAuthTag != NULL)
+    {
+      if (CRYP_AESGCM_FinalPhase_DMA(hcryp) != HAL_OK)
+      {
+        return HAL_ERROR;
+      }
+    }
+
     /* Change the CRYP state to ready */
     hcryp->State = HAL_CRYP_STATE_READY;
 
@@ -40,6 +40,7 @@
   * @{
   */
 #define CRYPEx_GENERAL_TIMEOUT                         82U
+#define CRYPEx_STREAM_MAX_SEGMENT_SIZE                 0xFFF0U /*!< Largest block aligned segment processed at once */
 #define CRYP_PHASE_INIT                              0x00000000U             /*!< GCM/GMAC (or CCM) init phase */
 #define CRYP_PHASE_HEADER                            AES_CR_GCMPH_0          /*!< GCM/GMAC or CCM header phase */
 #define CRYP_PHASE_PAYLOAD                           AES_CR_GCMPH_1          /*!< GCM(/CCM) payload phase   */
@@ -50,6 +51,7 @@
 #define CRYP_OPERATINGMODE_DECRYPT                   AES_CR_MODE_1           /*!< Decryption       */
 #define CRYP_OPERATINGMODE_KEYDERIVATION_DECRYPT     AES_CR_MODE             /*!< Key derivation and decryption only used when performing ECB and CBC decryptions  */
 
+#define  CRYPEx_PHASE_READY         0x01U     /*!< CRYP peripheral is ready for initialization */
 #define  CRYPEx_PHASE_PROCESS       0x02U     /*!< CRYP peripheral is in processing phase */
 #define  CRYPEx_PHASE_FINAL         0x03U     /*!< CRYP peripheral is in final phase this is relevant only with CCM and GCM modes */
 
@@ -68,6 +70,9 @@ static HAL_StatusTypeDef CRYPEx_KeyDecrypt(CRYP_HandleTypeDef *hcryp, uint32_t T
 static HAL_StatusTypeDef CRYPEx_KeyEncrypt(CRYP_HandleTypeDef *hcryp, uint32_t Timeout);
 static HAL_StatusTypeDef CRYPEx_KeyGeneration(CRYP_HandleTypeDef *hcryp, uint32_t Timeout);
 static HAL_StatusTypeDef CRYPEx_WaitFLAG(CRYP_HandleTypeDef *hcryp, uint32_t flag, FlagStatus Status, uint32_t Timeout);
+static HAL_StatusTypeDef CRYPEx_StreamProcess(CRYP_HandleTypeDef *hcryp, const CRYP_StreamTypeDef *pStream,
+                                              uint8_t *pInput, uint32_t Size, uint8_t *pOutput, uint32_t Timeout);
+static void CRYPEx_StreamEnd(CRYP_HandleTypeDef *hcryp, const CRYP_StreamTypeDef *pStream);
 /* Exported functions---------------------------------------------------------*/
 /** @addtogroup CRYPEx_Exported_Functions
   * @{
@@ -85,6 +90,21 @@ static HAL_StatusTypeDef CRYPEx_WaitFLAG(CRYP_HandleTypeDef *hcryp, uint32_t fla
       (#)HAL_CRYPEx_AESGCM_GenerateAuthTAG
       (#)HAL_CRYPEx_AESCCM_GenerateAuthTAG
          they should be used after Encrypt/Decrypt operation.
+    [..]  This section also provides functions allowing to run a whole GCM message
+          (header, payload and authentication TAG) in DMA mode with a single call
+      (#)HAL_CRYPEx_AESGCM_Encrypt_DMA
+      (#)HAL_CRYPEx_AESGCM_Decrypt_DMA
+         the final phase is chained to the end of the payload phase and the TAG is
+         available when HAL_CRYP_OutCpltCallback() is called.
+    [..]  This section also provides functions allowing to process a GCM or CCM message
+          arriving by chunks of any size, the payload length not being known up front
+          (in CCM it is anyway part of B0), in Polling mode
+      (#)HAL_CRYPEx_AES_StreamInit starts the message (init and header phases)
+      (#)HAL_CRYPEx_AES_StreamUpdate processes the whole blocks of the chunk, the
+         remaining bytes being kept until the next chunk
+      (#)HAL_CRYPEx_AES_StreamFinal processes the last partial block and generates
+         the authentication TAG
+         the CRYP configuration must not be changed before the end of the message.
 
 @endverbatim
   * @{
@@ -305,6 +325,326 @@ HAL_StatusTypeDef HAL_CRYPEx_AESCCM_GenerateAuthTAG(CRYP_HandleTypeDef *hcryp, c
   return HAL_OK;
 }
 
+/**
+  * @brief  GCM encryption in DMA mode with the authentication TAG generation chained
+  *         to the payload phase.
+  * @note   Header and payload phases are run as in HAL_CRYP_Encrypt_DMA(), then the
+  *         final phase is performed from the payload completion, without any
+  *         software polling between the phases. HAL_CRYP_OutCpltCallback() is
+  *         called once the TAG is available.
+  * @param  hcryp pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module
+  * @param  pInput Pointer to the input buffer (plaintext)
+  * @param  Size Length of the input buffer, non null, in word or in byte according to DataWidthUnit
+  * @param  pOutput Pointer to the output buffer (ciphertext)
+  * @param  pAuthTag Pointer to the 128-bit authentication TAG buffer
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CRYPEx_AESGCM_Encrypt_DMA(CRYP_HandleTypeDef *hcryp, uint32_t *pInput, uint16_t Size,
+                                                uint32_t *pOutput, uint32_t *pAuthTag)
+{
+  HAL_StatusTypeDef status;
+
+  /* Check the CRYP handle and TAG buffer allocation */
+  if ((hcryp == NULL) || (pAuthTag == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hcryp->State != HAL_CRYP_STATE_READY)
+  {
+    /* Busy error code field */
+    hcryp->ErrorCode |= HAL_CRYP_ERROR_BUSY;
+    return HAL_ERROR;
+  }
+
+  /* The final phase is chained to the end of the payload phase, GMAC does not have any */
+  if ((hcryp->Init.Algorithm != CRYP_AES_GCM_GMAC) || (Size == 0U))
+  {
+    hcryp->ErrorCode |= HAL_CRYP_ERROR_NOT_SUPPORTED;
+    return HAL_ERROR;
+  }
+
+  hcryp->pAuthTag = pAuthTag;
+
+  status = HAL_CRYP_Encrypt_DMA(hcryp, pInput, Size, pOutput);
+  if (status != HAL_OK)
+  {
+    hcryp->pAuthTag = NULL;
+  }
+
+  /* Return function status */
+  return status;
+}
+
+/**
+  * @brief  GCM decryption in DMA mode with the authentication TAG generation chained
+  *         to the payload phase.
+  * @note   Header and payload phases are run as in HAL_CRYP_Decrypt_DMA(), then the
+  *         final phase is performed from the payload completion, without any
+  *         software polling between the phases. HAL_CRYP_OutCpltCallback() is
+  *         called once the TAG is available.
+  * @param  hcryp pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module
+  * @param  pInput Pointer to the input buffer (ciphertext)
+  * @param  Size Length of the input buffer, non null, in word or in byte according to DataWidthUnit
+  * @param  pOutput Pointer to the output buffer (plaintext)
+  * @param  pAuthTag Pointer to the 128-bit authentication TAG buffer
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CRYPEx_AESGCM_Decrypt_DMA(CRYP_HandleTypeDef *hcryp, uint32_t *pInput, uint16_t Size,
+                                                uint32_t *pOutput, uint32_t *pAuthTag)
+{
+  HAL_StatusTypeDef status;
+
+  /* Check the CRYP handle and TAG buffer allocation */
+  if ((hcryp == NULL) || (pAuthTag == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hcryp->State != HAL_CRYP_STATE_READY)
+  {
+    /* Busy error code field */
+    hcryp->ErrorCode |= HAL_CRYP_ERROR_BUSY;
+    return HAL_ERROR;
+  }
+
+  /* The final phase is chained to the end of the payload phase, GMAC does not have any */
+  if ((hcryp->Init.Algorithm != CRYP_AES_GCM_GMAC) || (Size == 0U))
+  {
+    hcryp->ErrorCode |= HAL_CRYP_ERROR_NOT_SUPPORTED;
+    return HAL_ERROR;
+  }
+
+  hcryp->pAuthTag = pAuthTag;
+
+  status = HAL_CRYP_Decrypt_DMA(hcryp, pInput, Size, pOutput);
+  if (status != HAL_OK)
+  {
+    hcryp->pAuthTag = NULL;
+  }
+
+  /* Return function status */
+  return status;
+}
+
+/**
+  * @brief  Start the streaming processing of a GCM/GMAC or CCM message: the init and
+  *         header phases are performed, the payload is then given by chunks through
+  *         HAL_CRYPEx_AES_StreamUpdate().
+  * @note   Key, IV (or B0) and header are taken from the current CRYP configuration.
+  * @param  hcryp pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module
+  * @param  pStream pointer to the streaming processing structure
+  * @param  Decrypt 1 for decryption, 0 for encryption
+  * @param  Timeout Specify Timeout value
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CRYPEx_AES_StreamInit(CRYP_HandleTypeDef *hcryp, CRYP_StreamTypeDef *pStream, uint32_t Decrypt,
+                                            uint32_t Timeout)
+{
+  HAL_StatusTypeDef status;
+
+  /* Check the CRYP handle and streaming structure allocation */
+  if ((hcryp == NULL) || (pStream == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hcryp->State != HAL_CRYP_STATE_READY)
+  {
+    /* Busy error code field */
+    hcryp->ErrorCode |= HAL_CRYP_ERROR_BUSY;
+    return HAL_ERROR;
+  }
+
+  /* The chunks are processed as successive parts of a single authenticated message */
+  if (((hcryp->Init.Algorithm != CRYP_AES_GCM_GMAC) && (hcryp->Init.Algorithm != CRYP_AES_CCM)) ||
+      (hcryp->Init.KeyIVConfigSkip == CRYP_KEYNOCONFIG))
+  {
+    hcryp->ErrorCode |= HAL_CRYP_ERROR_NOT_SUPPORTED;
+    return HAL_ERROR;
+  }
+
+  pStream->BlockSize       = 0U;
+  pStream->Decrypt         = Decrypt;
+  pStream->KeyIVConfigSkip = hcryp->Init.KeyIVConfigSkip;
+
+  hcryp->Init.KeyIVConfigSkip = CRYP_KEYIVCONFIG_ONCE;
+  hcryp->KeyIVConfig = 0U;
+
+  /* Init and header phases, without any payload */
+  status = CRYPEx_StreamProcess(hcryp, pStream, (uint8_t *)pStream->Block, 0U, (uint8_t *)pStream->Block, Timeout);
+  if (status != HAL_OK)
+  {
+    CRYPEx_StreamEnd(hcryp, pStream);
+  }
+
+  /* Return function status */
+  return status;
+}
+
+/**
+  * @brief  Process a payload chunk of a message started by HAL_CRYPEx_AES_StreamInit().
+  * @note   Only whole blocks are processed, the bytes of an incomplete block are kept
+  *         in the streaming structure and processed with the next chunk. The output
+  *         buffer must hold Size + 15 bytes.
+  * @note   Word aligned input and output are processed in place, others block by block.
+  * @note   The message is aborted on error.
+  * @param  hcryp pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module
+  * @param  pStream pointer to the streaming processing structure
+  * @param  pInput Pointer to the payload chunk
+  * @param  Size Length of the payload chunk in bytes
+  * @param  pOutput Pointer to the output buffer
+  * @param  pOutputSize Pointer to the number of bytes written in the output buffer
+  * @param  Timeout Specify Timeout value
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CRYPEx_AES_StreamUpdate(CRYP_HandleTypeDef *hcryp, CRYP_StreamTypeDef *pStream, uint8_t *pInput,
+                                              uint32_t Size, uint8_t *pOutput, uint32_t *pOutputSize, uint32_t Timeout)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t block_out[4];
+  uint8_t *p_block;
+  const uint8_t *p_block_out = (const uint8_t *)block_out;
+  uint32_t insize = 0U;
+  uint32_t outsize = 0U;
+  uint32_t size;
+  uint32_t index;
+
+  /* Check the chunk and output allocation */
+  if ((hcryp == NULL) || (pStream == NULL) || (pOutputSize == NULL) ||
+      ((Size != 0U) && ((pInput == NULL) || (pOutput == NULL))))
+  {
+    return HAL_ERROR;
+  }
+
+  p_block = (uint8_t *)pStream->Block;
+
+  while ((insize < Size) && (status == HAL_OK))
+  {
+    if ((pStream->BlockSize == 0U) && ((Size - insize) >= 16U) &&
+        ((((uint32_t)&pInput[insize] | (uint32_t)&pOutput[outsize]) & 3U) == 0U))
+    {
+      /* Block aligned part of the chunk processed in place */
+      size = (Size - insize) & ~15U;
+      if (size > CRYPEx_STREAM_MAX_SEGMENT_SIZE)
+      {
+        size = CRYPEx_STREAM_MAX_SEGMENT_SIZE;
+      }
+      status = CRYPEx_StreamProcess(hcryp, pStream, &pInput[insize], size, &pOutput[outsize], Timeout);
+      insize += size;
+      outsize += size;
+    }
+    else
+    {
+      /* Gather the next block */
+      size = 16U - pStream->BlockSize;
+      if (size > (Size - insize))
+      {
+        size = Size - insize;
+      }
+      for (index = 0U; index < size; index++)
+      {
+        p_block[pStream->BlockSize] = pInput[insize];
+        pStream->BlockSize++;
+        insize++;
+      }
+
+      if (pStream->BlockSize == 16U)
+      {
+        status = CRYPEx_StreamProcess(hcryp, pStream, p_block, 16U, (uint8_t *)block_out, Timeout);
+        for (index = 0U; index < 16U; index++)
+        {
+          pOutput[outsize] = p_block_out[index];
+          outsize++;
+        }
+        pStream->BlockSize = 0U;
+      }
+    }
+  }
+
+  *pOutputSize = outsize;
+
+  if (status != HAL_OK)
+  {
+    CRYPEx_StreamEnd(hcryp, pStream);
+  }
+
+  /* Return function status */
+  return status;
+}
+
+/**
+  * @brief  End a message started by HAL_CRYPEx_AES_StreamInit(): process the pending
+  *         bytes as the last partial block then generate the authentication TAG.
+  * @param  hcryp pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module
+  * @param  pStream pointer to the streaming processing structure
+  * @param  pOutput Pointer to the output buffer, up to 15 bytes
+  * @param  pOutputSize Pointer to the number of bytes written in the output buffer
+  * @param  pAuthTag Pointer to the 128-bit authentication TAG buffer
+  * @param  Timeout Specify Timeout value
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CRYPEx_AES_StreamFinal(CRYP_HandleTypeDef *hcryp, CRYP_StreamTypeDef *pStream, uint8_t *pOutput,
+                                             uint32_t *pOutputSize, uint32_t *pAuthTag, uint32_t Timeout)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t block_out[4];
+  const uint8_t *p_block_out = (const uint8_t *)block_out;
+  uint32_t index;
+
+  /* Check the output and TAG buffers allocation */
+  if ((hcryp == NULL) || (pStream == NULL) || (pOutputSize == NULL) || (pAuthTag == NULL) ||
+      ((pStream->BlockSize != 0U) && (pOutput == NULL)))
+  {
+    return HAL_ERROR;
+  }
+
+  *pOutputSize = 0U;
+
+  if (pStream->BlockSize != 0U)
+  {
+    /* The last partial block is a whole number of words in word data width unit */
+    if ((hcryp->Init.DataWidthUnit == CRYP_DATAWIDTHUNIT_WORD) && ((pStream->BlockSize % 4U) != 0U))
+    {
+      hcryp->ErrorCode |= HAL_CRYP_ERROR_NOT_SUPPORTED;
+      status = HAL_ERROR;
+    }
+    else
+    {
+      status = CRYPEx_StreamProcess(hcryp, pStream, (uint8_t *)pStream->Block, pStream->BlockSize,
+                                    (uint8_t *)block_out, Timeout);
+      for (index = 0U; index < pStream->BlockSize; index++)
+      {
+        pOutput[index] = p_block_out[index];
+      }
+      *pOutputSize = pStream->BlockSize;
+      pStream->BlockSize = 0U;
+    }
+  }
+
+  if (status == HAL_OK)
+  {
+    if (hcryp->Init.Algorithm == CRYP_AES_GCM_GMAC)
+    {
+      status = HAL_CRYPEx_AESGCM_GenerateAuthTAG(hcryp, pAuthTag, Timeout);
+    }
+    else
+    {
+      status = HAL_CRYPEx_AESCCM_GenerateAuthTAG(hcryp, pAuthTag, Timeout);
+    }
+  }
+
+  CRYPEx_StreamEnd(hcryp, pStream);
+
+  /* Return function status */
+  return status;
+}
+
 /**
   * @}
   */
@@ -323,6 +663,10 @@ HAL_StatusTypeDef HAL_CRYPEx_AESCCM_GenerateAuthTAG(CRYP_HandleTypeDef *hcryp, c
            - Derived hardware unique key (DHUK)
            - XOR of DHUK and BHK
            - Boot hardware key (BHK)
+    [..]  HAL_CRYPEx_PrepareUnwrappedKey unwraps a key once and keeps it resident in the
+          key registers as a prepared key: HAL_CRYP_LoadPreparedKey then selects it for
+          each message without unwrapping it again. HAL_CRYPEx_ReleasePreparedKey erases
+          it from the key registers by a peripheral software reset.
 
 @endverbatim
   * @{
@@ -459,6 +803,215 @@ HAL_StatusTypeDef HAL_CRYPEx_UnwrapKey(CRYP_HandleTypeDef *hcryp, uint32_t *pInp
   return status;
 }
 
+/**
+  * @brief  Unwrap a key once and keep it resident in the key registers as a prepared key.
+  * @note   The key is unwrapped with the current configuration (hardware key selection in
+  *         wrapped key mode, ECB or CBC algorithm), it is then used in normal key mode
+  *         with the same algorithm, and derived once for decryption.
+  *         HAL_CRYP_LoadPreparedKey() selects it and sets the IV of each message.
+  * @note   HAL_CRYP_LoadPreparedKey() fails with HAL_CRYP_ERROR_KEY when another key was
+  *         loaded in between, the key must then be prepared again.
+  * @param  hcryp pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module
+  * @param  pPrepKey pointer to a CRYP_PreparedKeyTypeDef structure filled with the prepared key.
+  * @param  pWrappedKey Pointer to the wrapped key
+  * @param  Decrypt 1 to prepare the key for decryption, 0 for encryption
+  * @param  Timeout Specify Timeout value
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CRYPEx_PrepareUnwrappedKey(CRYP_HandleTypeDef *hcryp, CRYP_PreparedKeyTypeDef *pPrepKey,
+                                                 uint32_t *pWrappedKey, uint32_t Decrypt, uint32_t Timeout)
+{
+  uint32_t tickstart;
+
+  /* Check the CRYP handle and keys allocation */
+  if ((hcryp == NULL) || (pPrepKey == NULL) || (pWrappedKey == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hcryp->State != HAL_CRYP_STATE_READY)
+  {
+    /* Busy error code field */
+    hcryp->ErrorCode |= HAL_CRYP_ERROR_BUSY;
+    return HAL_ERROR;
+  }
+
+  if ((hcryp->Instance == AES) || (hcryp->Init.KeyMode != CRYP_KEYMODE_WRAPPED) ||
+      (hcryp->Init.KeySelect == CRYP_KEYSEL_NORMAL) ||
+      ((hcryp->Init.Algorithm != CRYP_AES_ECB) && (hcryp->Init.Algorithm != CRYP_AES_CBC)))
+  {
+    hcryp->ErrorCode |= HAL_CRYP_ERROR_NOT_SUPPORTED;
+    return HAL_ERROR;
+  }
+
+  /* The key registers no longer hold a prepared key until the end of the preparation */
+  hcryp->pPreparedKey = NULL;
+
+  /* Unwrap the key in the key registers */
+  if (HAL_CRYPEx_UnwrapKey(hcryp, pWrappedKey, Timeout) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Change state Busy */
+  hcryp->State = HAL_CRYP_STATE_BUSY;
+  __HAL_LOCK(hcryp);
+
+  /* Check the busy flag before writing CR register */
+  if (CRYPEx_WaitFLAG(hcryp, AES_SR_BUSY, SET, CRYPEx_GENERAL_TIMEOUT) != HAL_OK)
+  {
+    hcryp->State = HAL_CRYP_STATE_READY;
+    __HAL_UNLOCK(hcryp);
+    return HAL_ERROR;
+  }
+
+  /* The unwrapped key is used as a normal key */
+  MODIFY_REG(hcryp->Instance->CR, AES_CR_KEYSEL | AES_CR_KMOD, CRYP_KEYSEL_NORMAL | CRYP_KEYMODE_NORMAL);
+  hcryp->Init.KeySelect = CRYP_KEYSEL_NORMAL;
+  hcryp->Init.KeyMode   = CRYP_KEYMODE_NORMAL;
+  hcryp->Init.pKey      = NULL;
+
+  if (Decrypt != 0U)
+  {
+    /* Key preparation for decryption, operating mode 2 */
+    MODIFY_REG(hcryp->Instance->CR, AES_CR_MODE, CRYP_OPERATINGMODE_KEYDERIVATION);
+
+    /* Enable CRYP */
+    __HAL_CRYP_ENABLE(hcryp);
+
+    /* Wait for CCF flag to be raised */
+    tickstart = HAL_GetTick();
+    while (HAL_IS_BIT_CLR(hcryp->Instance->ISR, AES_ISR_CCF))
+    {
+      /* Check for the Timeout */
+      if (((HAL_GetTick() - tickstart) > Timeout) || (Timeout == 0U))
+      {
+        /* Disable the CRYP peripheral clock */
+        __HAL_CRYP_DISABLE(hcryp);
+
+        /* Change state */
+        hcryp->ErrorCode |= HAL_CRYP_ERROR_TIMEOUT;
+        hcryp->State = HAL_CRYP_STATE_READY;
+        __HAL_UNLOCK(hcryp);
+        return HAL_ERROR;
+      }
+    }
+    /* Clear CCF Flag */
+    __HAL_CRYP_CLEAR_FLAG(hcryp, CRYP_CLEAR_CCF);
+
+    /* Disable CRYP, the derived key is kept in the key registers */
+    __HAL_CRYP_DISABLE(hcryp);
+
+    MODIFY_REG(hcryp->Instance->CR, AES_CR_MODE, CRYP_OPERATINGMODE_DECRYPT);
+  }
+  else
+  {
+    MODIFY_REG(hcryp->Instance->CR, AES_CR_MODE, CRYP_OPERATINGMODE_ENCRYPT);
+  }
+
+  /* Store the key configuration */
+  pPrepKey->DataType      = hcryp->Init.DataType;
+  pPrepKey->KeySize       = hcryp->Init.KeySize;
+  pPrepKey->pKey          = NULL;
+  pPrepKey->Algorithm     = hcryp->Init.Algorithm;
+  pPrepKey->DataWidthUnit = hcryp->Init.DataWidthUnit;
+  pPrepKey->Decrypt       = (Decrypt != 0U) ? 1U : 0U;
+  pPrepKey->CR_Reg        = READ_REG(hcryp->Instance->CR);
+  pPrepKey->pWrappedKey   = pWrappedKey;
+
+  /* Skip the Key and IV configuration in the next processings */
+  hcryp->Init.KeyIVConfigSkip = CRYP_KEYIVCONFIG_ONCE;
+  hcryp->KeyIVConfig = 1U;
+  hcryp->Phase = CRYPEx_PHASE_READY;
+  hcryp->pPreparedKey = pPrepKey;
+
+  /* Change the CRYP peripheral state */
+  hcryp->State = HAL_CRYP_STATE_READY;
+  __HAL_UNLOCK(hcryp);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Release a prepared key: when it is held in the key registers, they are erased
+  *         by a peripheral software reset, the configuration registers being restored.
+  * @note   The key configuration has to be set again (HAL_CRYP_SetConfig()) before the
+  *         next processing.
+  * @param  hcryp pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module
+  * @param  pPrepKey pointer to the CRYP_PreparedKeyTypeDef structure to release.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CRYPEx_ReleasePreparedKey(CRYP_HandleTypeDef *hcryp, CRYP_PreparedKeyTypeDef *pPrepKey)
+{
+  uint32_t cr_value;
+
+  /* Check the CRYP handle allocation */
+  if ((hcryp == NULL) || (pPrepKey == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hcryp->State != HAL_CRYP_STATE_READY)
+  {
+    /* Busy error code field */
+    hcryp->ErrorCode |= HAL_CRYP_ERROR_BUSY;
+    return HAL_ERROR;
+  }
+
+  /* Change state Busy */
+  hcryp->State = HAL_CRYP_STATE_BUSY;
+  __HAL_LOCK(hcryp);
+
+  if (hcryp->pPreparedKey == pPrepKey)
+  {
+    /* Check the busy flag before writing CR register */
+    if (CRYPEx_WaitFLAG(hcryp, AES_SR_BUSY, SET, CRYPEx_GENERAL_TIMEOUT) != HAL_OK)
+    {
+      hcryp->State = HAL_CRYP_STATE_READY;
+      __HAL_UNLOCK(hcryp);
+      return HAL_ERROR;
+    }
+    cr_value = READ_REG(hcryp->Instance->CR) & ~(AES_CR_EN | AES_CR_KEYSEL | AES_CR_KMOD);
+
+    /* Disable the CRYP peripheral clock */
+    __HAL_CRYP_DISABLE(hcryp);
+
+    /* Set IPRST for software reset, clearing the key registers */
+    SET_BIT(hcryp->Instance->CR, AES_CR_IPRST);
+
+    /* Clear IPRST to allow writing registers */
+    CLEAR_BIT(hcryp->Instance->CR, AES_CR_IPRST);
+
+    /* Wait for the end of the SAES initialization */
+    if (CRYPEx_WaitFLAG(hcryp, AES_SR_BUSY, SET, CRYPEx_GENERAL_TIMEOUT) != HAL_OK)
+    {
+      hcryp->State = HAL_CRYP_STATE_READY;
+      __HAL_UNLOCK(hcryp);
+      return HAL_ERROR;
+    }
+
+    /* Restore the configuration, in normal key mode */
+    WRITE_REG(hcryp->Instance->CR, cr_value);
+
+    hcryp->pPreparedKey = NULL;
+    hcryp->KeyIVConfig = 0U;
+    hcryp->Phase = CRYPEx_PHASE_READY;
+  }
+
+  /* Erase the key configuration */
+  pPrepKey->pKey        = NULL;
+  pPrepKey->pWrappedKey = NULL;
+  pPrepKey->CR_Reg      = 0U;
+
+  /* Change the CRYP peripheral state */
+  hcryp->State = HAL_CRYP_STATE_READY;
+  __HAL_UNLOCK(hcryp);
+
+  return HAL_OK;
+}
+
 /**
   * @}
   */
@@ -916,6 +1469,48 @@ static HAL_StatusTypeDef CRYPEx_WaitFLAG(CRYP_HandleTypeDef *hcryp, uint32_t fla
   return HAL_OK;
 }
 
+/**
+  * @brief  Process a part of a streamed message in Polling mode.
+  * @param  hcryp pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module
+  * @param  pStream pointer to the streaming processing structure
+  * @param  pInput Pointer to the input data, word aligned
+  * @param  Size Length of the input data in bytes
+  * @param  pOutput Pointer to the output data, word aligned
+  * @param  Timeout Specify Timeout value
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef CRYPEx_StreamProcess(CRYP_HandleTypeDef *hcryp, const CRYP_StreamTypeDef *pStream,
+                                              uint8_t *pInput, uint32_t Size, uint8_t *pOutput, uint32_t Timeout)
+{
+  uint32_t size = Size;
+
+  /* Convert the size according to DataWidthUnit */
+  if (hcryp->Init.DataWidthUnit == CRYP_DATAWIDTHUNIT_WORD)
+  {
+    size /= 4U;
+  }
+
+  if (pStream->Decrypt != 0U)
+  {
+    return HAL_CRYP_Decrypt(hcryp, (uint32_t *)(void *)pInput, (uint16_t)size, (uint32_t *)(void *)pOutput, Timeout);
+  }
+  return HAL_CRYP_Encrypt(hcryp, (uint32_t *)(void *)pInput, (uint16_t)size, (uint32_t *)(void *)pOutput, Timeout);
+}
+
+/**
+  * @brief  End of a streamed message: restore the user Key and IV configuration setting.
+  * @param  hcryp pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module
+  * @param  pStream pointer to the streaming processing structure
+  * @retval None
+  */
+static void CRYPEx_StreamEnd(CRYP_HandleTypeDef *hcryp, const CRYP_StreamTypeDef *pStream)
+{
+  hcryp->Init.KeyIVConfigSkip = pStream->KeyIVConfigSkip;
+  hcryp->KeyIVConfig = 0U;
+}
+
 /**
   * @}
   */
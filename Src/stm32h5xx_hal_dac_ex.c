@@ -40,6 +40,19 @@
           transfer completion (half complete or complete), errors or underrun.
       (+) Use HAL_DACEx_DualStop_DMA() to disable both channel and stop conversion
           for dual mode operation using DMA to feed DAC converters.
+     *** Waveform streaming operation ***
+     ====================================
+     [..]
+      (+) Initialize the DMA channel with HAL_DMAEx_List_Init() in DMA_LINKEDLIST_CIRCULAR
+          mode and link it to the DAC handle.
+      (+) Use HAL_DACEx_StreamStart_DMA() to start a continuous conversion of 2 blocks
+          transferred alternately by a circular DMA queue, in single or dual mode
+          (packed DHR12RD, DHR12LD or DHR8RD data).
+      (+) Refill the first block in HAL_DAC_ConvHalfCpltCallbackCh1() and the second block
+          in HAL_DAC_ConvCpltCallbackCh1() (HAL_DACEx_ConvHalfCpltCallbackCh2() and
+          HAL_DACEx_ConvCpltCallbackCh2() for channel 2), or replace the transferred block
+          buffer with HAL_DACEx_StreamSetBuffer().
+      (+) Use HAL_DAC_Stop_DMA() or HAL_DACEx_DualStop_DMA() to stop the streaming.
       (+) When Dual mode is enabled (i.e. DAC Channel1 and Channel2 are used simultaneously) :
           Use HAL_DACEx_DualGetValue() to get digital data to be converted and use
           HAL_DACEx_DualSetValue() to set digital value to converted simultaneously in
@@ -92,6 +105,8 @@
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
+static void DAC_DMAStreamCpltCh1(DMA_HandleTypeDef *hdma);
+static void DAC_DMAStreamCpltCh2(DMA_HandleTypeDef *hdma);
 /* Exported functions --------------------------------------------------------*/
 
 /** @defgroup DACEx_Exported_Functions DACEx Exported Functions
@@ -110,6 +125,7 @@
       (+) Stop conversion.
       (+) Start conversion and enable DMA transfer.
       (+) Stop conversion and disable DMA transfer.
+      (+) Start waveform streaming conversion on a circular DMA queue.
       (+) Get result of conversion.
       (+) Get result of dual mode conversion.
 
@@ -461,6 +477,322 @@ HAL_StatusTypeDef HAL_DACEx_DualStop_DMA(DAC_HandleTypeDef *hdac, uint32_t Chann
 }
 
 
+
+/**
+  * @brief  Enables DAC and starts a waveform streaming conversion, fed by a circular DMA queue of 2 blocks.
+  * @note   The DMA channel of the selected DAC channel must be initialized with HAL_DMAEx_List_Init() in
+  *         DMA_LINKEDLIST_CIRCULAR mode. Its queue is built by this function from the user queue and nodes,
+  *         and linked to the DMA channel.
+  * @note   HAL_DAC_ConvHalfCpltCallbackCh1() (HAL_DACEx_ConvHalfCpltCallbackCh2() for channel 2) is called
+  *         when the first block has been transferred and HAL_DAC_ConvCpltCallbackCh1()
+  *         (HAL_DACEx_ConvCpltCallbackCh2() for channel 2) when the second block has been transferred: the
+  *         transferred block can then be refilled in place, or replaced using HAL_DACEx_StreamSetBuffer(),
+  *         while the other block is being converted.
+  * @note   In dual mode, both channels are enabled and the blocks hold packed data of both channels
+  *         (DHR12RD, DHR12LD or DHR8RD format): 32-bit data for 12-bit alignments, 16-bit data for 8-bit
+  *         alignment. In single mode, the blocks hold 16-bit data for 12-bit alignments and 8-bit data for
+  *         8-bit alignment.
+  * @note   Use HAL_DAC_Stop_DMA() (HAL_DACEx_DualStop_DMA() in dual mode) to stop the streaming.
+  * @param  hdac pointer to a DAC_HandleTypeDef structure that contains
+  *         the configuration information for the specified DAC.
+  * @param  Channel The DAC channel that will request data from DMA.
+  *          This parameter can be one of the following values:
+  *            @arg DAC_CHANNEL_1: DAC Channel1 selected
+  *            @arg DAC_CHANNEL_2: DAC Channel2 selected
+  * @param  pConfig pointer to a DAC_StreamConfTypeDef structure that contains the streaming configuration.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DACEx_StreamStart_DMA(DAC_HandleTypeDef *hdac, uint32_t Channel,
+                                            const DAC_StreamConfTypeDef *pConfig)
+{
+  HAL_StatusTypeDef status;
+  DMA_HandleTypeDef *hdma;
+  DMA_NodeConfTypeDef node_conf;
+  uint32_t tmpreg;
+  uint32_t data_size;
+  __IO uint32_t wait_loop_index;
+
+  /* Check the DAC peripheral handle and the streaming configuration */
+  if ((hdac == NULL) || (pConfig == NULL) || (pConfig->pQueue == NULL) || (pConfig->pNodes == NULL)
+      || (pConfig->pBuffer[0U] == NULL) || (pConfig->pBuffer[1U] == NULL) || (pConfig->BlockLength == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_DAC_CHANNEL(Channel));
+  assert_param(IS_DAC_ALIGN(pConfig->Alignment));
+  assert_param(IS_FUNCTIONAL_STATE(pConfig->DualMode));
+
+  hdma = (Channel == DAC_CHANNEL_1) ? hdac->DMA_Handle1 : hdac->DMA_Handle2;
+
+  /* Check the DMA channel circular linked-list mode */
+  if ((hdma == NULL) || (hdma->Mode != DMA_LINKEDLIST_CIRCULAR))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Get the data holding register and the data size */
+  if (pConfig->DualMode == ENABLE)
+  {
+    switch (pConfig->Alignment)
+    {
+      case DAC_ALIGN_12B_R:
+        tmpreg = (uint32_t)&hdac->Instance->DHR12RD;
+        data_size = 4U;
+        break;
+      case DAC_ALIGN_12B_L:
+        tmpreg = (uint32_t)&hdac->Instance->DHR12LD;
+        data_size = 4U;
+        break;
+      default: /* case DAC_ALIGN_8B_R */
+        tmpreg = (uint32_t)&hdac->Instance->DHR8RD;
+        data_size = 2U;
+        break;
+    }
+  }
+  else
+  {
+    switch (pConfig->Alignment)
+    {
+      case DAC_ALIGN_12B_R:
+        tmpreg = (Channel == DAC_CHANNEL_1) ? (uint32_t)&hdac->Instance->DHR12R1 : (uint32_t)&hdac->Instance->DHR12R2;
+        data_size = 2U;
+        break;
+      case DAC_ALIGN_12B_L:
+        tmpreg = (Channel == DAC_CHANNEL_1) ? (uint32_t)&hdac->Instance->DHR12L1 : (uint32_t)&hdac->Instance->DHR12L2;
+        data_size = 2U;
+        break;
+      default: /* case DAC_ALIGN_8B_R */
+        tmpreg = (Channel == DAC_CHANNEL_1) ? (uint32_t)&hdac->Instance->DHR8R1 : (uint32_t)&hdac->Instance->DHR8R2;
+        data_size = 1U;
+        break;
+    }
+  }
+
+  /* Check the block size in bytes */
+  if ((pConfig->BlockLength * data_size) > DMA_CBR1_BNDT)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process locked */
+  __HAL_LOCK(hdac);
+
+  /* Prepare the node of the first block */
+  node_conf.NodeType                            = DMA_GPDMA_LINEAR_NODE;
+  node_conf.Init.Request                        = pConfig->Request;
+  node_conf.Init.BlkHWRequest                   = DMA_BREQ_SINGLE_BURST;
+  node_conf.Init.Direction                      = DMA_MEMORY_TO_PERIPH;
+  node_conf.Init.SrcInc                         = DMA_SINC_INCREMENTED;
+  node_conf.Init.DestInc                        = DMA_DINC_FIXED;
+  node_conf.Init.SrcDataWidth                   = (data_size == 4U) ? DMA_SRC_DATAWIDTH_WORD :
+                                                  ((data_size == 2U) ? DMA_SRC_DATAWIDTH_HALFWORD :
+                                                   DMA_SRC_DATAWIDTH_BYTE);
+  node_conf.Init.DestDataWidth                  = (data_size == 4U) ? DMA_DEST_DATAWIDTH_WORD :
+                                                  ((data_size == 2U) ? DMA_DEST_DATAWIDTH_HALFWORD :
+                                                   DMA_DEST_DATAWIDTH_BYTE);
+  node_conf.Init.Priority                       = hdma->InitLinkedList.Priority;
+  node_conf.Init.SrcBurstLength                 = 1U;
+  node_conf.Init.DestBurstLength                = 1U;
+  node_conf.Init.TransferAllocatedPort          = DMA_SRC_ALLOCATED_PORT0 | DMA_DEST_ALLOCATED_PORT0;
+  node_conf.Init.TransferEventMode              = DMA_TCEM_EACH_LL_ITEM_TRANSFER;
+  node_conf.Init.Mode                           = DMA_NORMAL;
+  node_conf.DataHandlingConfig.DataExchange     = DMA_EXCHANGE_NONE;
+  node_conf.DataHandlingConfig.DataAlignment    = DMA_DATA_RIGHTALIGN_ZEROPADDED;
+  node_conf.TriggerConfig.TriggerPolarity       = DMA_TRIG_POLARITY_MASKED;
+  node_conf.TriggerConfig.TriggerMode           = 0U;
+  node_conf.TriggerConfig.TriggerSelection      = 0U;
+  node_conf.SrcAddress                          = (uint32_t)pConfig->pBuffer[0U];
+  node_conf.DstAddress                          = tmpreg;
+  node_conf.DataSize                            = pConfig->BlockLength * data_size;
+#if defined (__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U)
+  node_conf.SrcSecure                           = DMA_CHANNEL_SRC_SEC;
+  node_conf.DestSecure                          = DMA_CHANNEL_DEST_SEC;
+#endif /* (__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U) */
+
+  /* Build the circular streaming queue: one node per block */
+  status = HAL_DMAEx_List_ResetQ(pConfig->pQueue);
+
+  if (status == HAL_OK)
+  {
+    status = HAL_DMAEx_List_BuildNode(&node_conf, &pConfig->pNodes[0U]);
+  }
+  if (status == HAL_OK)
+  {
+    status = HAL_DMAEx_List_InsertNode_Tail(pConfig->pQueue, &pConfig->pNodes[0U]);
+  }
+  if (status == HAL_OK)
+  {
+    node_conf.SrcAddress = (uint32_t)pConfig->pBuffer[1U];
+    status = HAL_DMAEx_List_BuildNode(&node_conf, &pConfig->pNodes[1U]);
+  }
+  if (status == HAL_OK)
+  {
+    status = HAL_DMAEx_List_InsertNode_Tail(pConfig->pQueue, &pConfig->pNodes[1U]);
+  }
+  if (status == HAL_OK)
+  {
+    status = HAL_DMAEx_List_SetCircularMode(pConfig->pQueue);
+  }
+  if (status == HAL_OK)
+  {
+    status = HAL_DMAEx_List_LinkQ(hdma, pConfig->pQueue);
+  }
+
+  if (status != HAL_OK)
+  {
+    /* Process Unlocked */
+    __HAL_UNLOCK(hdac);
+
+    return HAL_ERROR;
+  }
+
+  /* Change DAC state */
+  hdac->State = HAL_DAC_STATE_BUSY;
+
+  /* Set the DMA callbacks: each node completion is a block, the half transfer event of the nodes is not used */
+  hdma->XferHalfCpltCallback = NULL;
+
+  if (Channel == DAC_CHANNEL_1)
+  {
+    /* First block to complete */
+    hdac->StreamBlockCh1 = 0U;
+
+    /* Set the DMA transfer complete and error callbacks for channel1 */
+    hdma->XferCpltCallback = DAC_DMAStreamCpltCh1;
+    hdma->XferErrorCallback = DAC_DMAErrorCh1;
+
+    /* Enable the selected DAC channel1 DMA request */
+    SET_BIT(hdac->Instance->CR, DAC_CR_DMAEN1);
+
+    /* Enable the DAC DMA underrun interrupt */
+    __HAL_DAC_ENABLE_IT(hdac, DAC_IT_DMAUDR1);
+  }
+  else
+  {
+    /* First block to complete */
+    hdac->StreamBlockCh2 = 0U;
+
+    /* Set the DMA transfer complete and error callbacks for channel2 */
+    hdma->XferCpltCallback = DAC_DMAStreamCpltCh2;
+    hdma->XferErrorCallback = DAC_DMAErrorCh2;
+
+    /* Enable the selected DAC channel2 DMA request */
+    SET_BIT(hdac->Instance->CR, DAC_CR_DMAEN2);
+
+    /* Enable the DAC DMA underrun interrupt */
+    __HAL_DAC_ENABLE_IT(hdac, DAC_IT_DMAUDR2);
+  }
+
+  /* Enable the DMA channel */
+  status = HAL_DMAEx_List_Start_IT(hdma);
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hdac);
+
+  if (status == HAL_OK)
+  {
+    /* Enable the Peripheral */
+    if (pConfig->DualMode == ENABLE)
+    {
+      __HAL_DAC_ENABLE(hdac, DAC_CHANNEL_1);
+      __HAL_DAC_ENABLE(hdac, DAC_CHANNEL_2);
+    }
+    else
+    {
+      __HAL_DAC_ENABLE(hdac, Channel);
+    }
+    /* Ensure minimum wait before using peripheral after enabling it */
+    /* Wait loop initialization and execution */
+    /* Note: Variable divided by 2 to compensate partially              */
+    /*       CPU processing cycles, scaling in us split to not          */
+    /*       exceed 32 bits register capacity and handle low frequency. */
+    wait_loop_index = ((DAC_DELAY_STARTUP_US / 10UL) * ((SystemCoreClock / (100000UL * 2UL)) + 1UL));
+    while (wait_loop_index != 0UL)
+    {
+      wait_loop_index--;
+    }
+  }
+  else
+  {
+    hdac->ErrorCode |= HAL_DAC_ERROR_DMA;
+  }
+
+  /* Return function status */
+  return status;
+}
+
+/**
+  * @brief  Replace the buffer of a block of a waveform streaming conversion.
+  * @note   The block must not be the one being transferred: this function is intended to be called from the
+  *         half transfer complete callback for block 0 and from the transfer complete callback for block 1.
+  *         The new buffer must have the length and data format of the streaming configuration.
+  * @param  hdac pointer to a DAC_HandleTypeDef structure that contains
+  *         the configuration information for the specified DAC.
+  * @param  Channel The DAC channel that requests data from DMA.
+  *          This parameter can be one of the following values:
+  *            @arg DAC_CHANNEL_1: DAC Channel1 selected
+  *            @arg DAC_CHANNEL_2: DAC Channel2 selected
+  * @param  Block The block index (0 or 1).
+  * @param  pData The new block buffer address.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DACEx_StreamSetBuffer(DAC_HandleTypeDef *hdac, uint32_t Channel, uint32_t Block,
+                                            const uint32_t *pData)
+{
+  DMA_HandleTypeDef *hdma;
+  DMA_NodeTypeDef *pnode;
+  uint32_t cllr_offset;
+  uint32_t current_block;
+
+  /* Check the DAC peripheral handle */
+  if ((hdac == NULL) || (pData == NULL) || (Block > 1U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_DAC_CHANNEL(Channel));
+
+  if (Channel == DAC_CHANNEL_1)
+  {
+    hdma = hdac->DMA_Handle1;
+    current_block = hdac->StreamBlockCh1;
+  }
+  else
+  {
+    hdma = hdac->DMA_Handle2;
+    current_block = hdac->StreamBlockCh2;
+  }
+
+  if ((hdac->State != HAL_DAC_STATE_BUSY) || (hdma == NULL) || (hdma->LinkedListQueue == NULL)
+      || (hdma->LinkedListQueue->Head == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* The block being transferred can not be replaced */
+  if (Block == current_block)
+  {
+    return HAL_BUSY;
+  }
+
+  /* Get the block node: the head node, or the node it is linked to */
+  pnode = hdma->LinkedListQueue->Head;
+  if (Block == 1U)
+  {
+    cllr_offset = (pnode->NodeInfo & NODE_CLLR_IDX) >> NODE_CLLR_IDX_POS;
+    pnode = (DMA_NodeTypeDef *)((hdma->Instance->CLBAR & DMA_CLBAR_LBA) |
+                                (pnode->LinkRegisters[cllr_offset] & DMA_CLLR_LA));
+  }
+
+  /* Set DMA source address of the block */
+  pnode->LinkRegisters[NODE_CSAR_DEFAULT_OFFSET] = (uint32_t)pData;
+
+  return HAL_OK;
+}
+
 /**
   * @brief  Enable or disable the selected DAC channel wave generation.
   * @param  hdac pointer to a DAC_HandleTypeDef structure that contains
@@ -995,6 +1327,70 @@ void DAC_DMAErrorCh2(DMA_HandleTypeDef *hdma)
   hdac->State = HAL_DAC_STATE_READY;
 }
 
+/**
+  * @brief  DMA node transfer complete callback of channel 1 waveform streaming.
+  * @param  hdma pointer to a DMA_HandleTypeDef structure that contains
+  *                the configuration information for the specified DMA module.
+  * @retval None
+  */
+static void DAC_DMAStreamCpltCh1(DMA_HandleTypeDef *hdma)
+{
+  DAC_HandleTypeDef *hdac = (DAC_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+
+  if (hdac->StreamBlockCh1 == 0U)
+  {
+    hdac->StreamBlockCh1 = 1U;
+    /* First block transferred */
+#if (USE_HAL_DAC_REGISTER_CALLBACKS == 1)
+    hdac->ConvHalfCpltCallbackCh1(hdac);
+#else
+    HAL_DAC_ConvHalfCpltCallbackCh1(hdac);
+#endif /* USE_HAL_DAC_REGISTER_CALLBACKS */
+  }
+  else
+  {
+    hdac->StreamBlockCh1 = 0U;
+    /* Second block transferred */
+#if (USE_HAL_DAC_REGISTER_CALLBACKS == 1)
+    hdac->ConvCpltCallbackCh1(hdac);
+#else
+    HAL_DAC_ConvCpltCallbackCh1(hdac);
+#endif /* USE_HAL_DAC_REGISTER_CALLBACKS */
+  }
+}
+
+/**
+  * @brief  DMA node transfer complete callback of channel 2 waveform streaming.
+  * @param  hdma pointer to a DMA_HandleTypeDef structure that contains
+  *                the configuration information for the specified DMA module.
+  * @retval None
+  */
+static void DAC_DMAStreamCpltCh2(DMA_HandleTypeDef *hdma)
+{
+  DAC_HandleTypeDef *hdac = (DAC_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+
+  if (hdac->StreamBlockCh2 == 0U)
+  {
+    hdac->StreamBlockCh2 = 1U;
+    /* First block transferred */
+#if (USE_HAL_DAC_REGISTER_CALLBACKS == 1)
+    hdac->ConvHalfCpltCallbackCh2(hdac);
+#else
+    HAL_DACEx_ConvHalfCpltCallbackCh2(hdac);
+#endif /* USE_HAL_DAC_REGISTER_CALLBACKS */
+  }
+  else
+  {
+    hdac->StreamBlockCh2 = 0U;
+    /* Second block transferred */
+#if (USE_HAL_DAC_REGISTER_CALLBACKS == 1)
+    hdac->ConvCpltCallbackCh2(hdac);
+#else
+    HAL_DACEx_ConvCpltCallbackCh2(hdac);
+#endif /* USE_HAL_DAC_REGISTER_CALLBACKS */
+  }
+}
+
 
 /**
   * @}
@@ -63,6 +63,38 @@
     [..]  Use HAL_DCACHE_GetState() function to return the DCACHE state and HAL_DCACHE_GetError()
           in case of error detection.
 
+     *** Memory pool ***
+     ===================
+    [..]
+        (+) Use HAL_DCACHE_Pool_Init() to manage a cacheable memory region (e.g. a PSRAM mapped by
+            XSPI or FMC) as a pool of buffers allocated with HAL_DCACHE_Pool_Alloc():
+            (++) Buffers start on a cache line and are padded to a whole number of cache lines, so
+                 that the cache maintenance of a buffer never affects its neighbours.
+            (++) Buffers are freed together with HAL_DCACHE_Pool_Release() back to a mark got with
+                 HAL_DCACHE_Pool_GetMark(), or all at once with HAL_DCACHE_Pool_Reset().
+            (++) The allocation can be called from thread and interrupt context.
+        (+) Use HAL_DCACHE_Pool_Clean() after the CPU wrote a pool buffer read by a peripheral
+            (e.g. a frame buffer read by a display DMA), and HAL_DCACHE_Pool_Invalidate() before
+            the CPU reads a pool buffer written by a peripheral.
+
+     *** DMA coherency ***
+     =====================
+    [..]
+        (+) Set USE_HAL_DCACHE_DMA_COHERENCY to 1 in the HAL configuration file and register the
+            DCACHE handle with HAL_DCACHE_DMA_Register() to let the SPI, SD and XSPI drivers
+            maintain the coherency of their DMA buffers:
+            (++) The buffer is cleaned (transmit) or cleaned and invalidated (receive) before the
+                 transfer. The command is started with HAL_DCACHE_DMA_PrepareTx() or
+                 HAL_DCACHE_DMA_PrepareRx() while the transfer is configured, and waited for with
+                 HAL_DCACHE_DMA_WaitPrepared() just before the DMA is enabled.
+            (++) The received buffer is invalidated with HAL_DCACHE_DMA_CompleteRx() when the
+                 transfer ends, before the transfer complete callback.
+            (++) The cache lines are aligned out of the buffer. Buffers starting and ending on a
+                 cache line (e.g. allocated with HAL_DCACHE_Pool_Alloc()) are recommended, the
+                 partial lines at the edges of a received buffer being cleaned and invalidated.
+        (+) The functions do nothing when no handle is registered or when the DCACHE is disabled,
+            and can also be called around the DMA transfers of the other drivers.
+
      *** DCACHE HAL driver macros list ***
      =============================================
      [..]
@@ -133,15 +165,20 @@
 
 #define DCACHE_POLLING_MODE                    0U
 #define DCACHE_IT_MODE                         1U
+#define DCACHE_START_MODE                      2U
 
 /**
   * @}
   */
 
 /* Private variables ---------------------------------------------------------*/
+/* DCACHE handle used for the DMA buffers of the drivers, NULL when not registered */
+static DCACHE_HandleTypeDef *pDCacheDMAHandle = NULL;
+
 /* Private function prototypes -----------------------------------------------*/
 static HAL_StatusTypeDef DCACHE_CommandByAddr(DCACHE_HandleTypeDef *hdcache, uint32_t Command,
                                               const uint32_t *const pAddr, uint32_t dSize, uint32_t mode);
+static HAL_StatusTypeDef DCACHE_DMA_Start(uint32_t Command, const void *pBuffer, uint32_t Size);
 
 /* Exported functions --------------------------------------------------------*/
 /** @addtogroup DCACHE_Exported_Functions DCACHE Exported Functions
@@ -1375,6 +1412,376 @@ uint32_t HAL_DCACHE_GetError(const DCACHE_HandleTypeDef *hdcache)
   return hdcache->ErrorCode;
 }
 
+/**
+  * @}
+  */
+
+/** @addtogroup DCACHE_Exported_Functions_Group5
+  *
+@verbatim
+ ===============================================================================
+            #####          Memory Pool          #####
+ ===============================================================================
+    [..]
+    This subsection provides a set of functions allowing to allocate cache line
+    aligned buffers in a cacheable memory region and to maintain their coherency.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initialize a memory pool on a cacheable memory region.
+  * @param  pPool Pointer to a DCACHE_PoolTypeDef structure receiving the pool information.
+  * @param  BaseAddress Start address of the region, rounded up to a cache line.
+  * @param  Size Size in bytes of the region, rounded down to a whole number of cache lines.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DCACHE_Pool_Init(DCACHE_PoolTypeDef *pPool, uint32_t BaseAddress, uint32_t Size)
+{
+  uint32_t start;
+  uint32_t end;
+
+  /* Check the pool parameters */
+  if ((pPool == NULL) || (Size < DCACHE_LINE_SIZE) || (BaseAddress > (0xFFFFFFFFU - Size)))
+  {
+    return HAL_ERROR;
+  }
+
+  start = (BaseAddress + (DCACHE_LINE_SIZE - 1U)) & ~(DCACHE_LINE_SIZE - 1U);
+  end   = (BaseAddress + Size) & ~(DCACHE_LINE_SIZE - 1U);
+  if (end <= start)
+  {
+    return HAL_ERROR;
+  }
+
+  pPool->BaseAddress   = start;
+  pPool->Size          = end - start;
+  pPool->Offset        = 0U;
+  pPool->HighWatermark = 0U;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Allocate a buffer from a memory pool.
+  * @param  pPool Pointer to a DCACHE_PoolTypeDef structure that contains the pool information.
+  * @param  Size Size in bytes of the buffer, rounded up to a whole number of cache lines.
+  * @param  Alignment Alignment in bytes of the buffer, power of two, a cache line at least.
+  * @note   This function can be called from thread and interrupt context.
+  * @retval Pointer to the allocated buffer, NULL when the pool has not enough free space.
+  */
+void *HAL_DCACHE_Pool_Alloc(DCACHE_PoolTypeDef *pPool, uint32_t Size, uint32_t Alignment)
+{
+  void *pbuffer = NULL;
+  uint32_t align;
+  uint32_t size;
+  uint32_t offset;
+  uint32_t primask_bit;
+
+  /* Check the allocation parameters */
+  if ((pPool == NULL) || (Size == 0U) || (Size > pPool->Size) || ((Alignment & (Alignment - 1U)) != 0U))
+  {
+    return NULL;
+  }
+
+  align = (Alignment < DCACHE_LINE_SIZE) ? DCACHE_LINE_SIZE : Alignment;
+  size  = (Size + (DCACHE_LINE_SIZE - 1U)) & ~(DCACHE_LINE_SIZE - 1U);
+
+  /* Enter critical section */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  /* Align the absolute address of the buffer */
+  offset = ((pPool->BaseAddress + pPool->Offset + (align - 1U)) & ~(align - 1U)) - pPool->BaseAddress;
+  if ((offset <= pPool->Size) && (size <= (pPool->Size - offset)))
+  {
+    pbuffer = (void *)(pPool->BaseAddress + offset);
+    pPool->Offset = offset + size;
+    if (pPool->Offset > pPool->HighWatermark)
+    {
+      pPool->HighWatermark = pPool->Offset;
+    }
+  }
+
+  /* Exit critical section */
+  __set_PRIMASK(primask_bit);
+
+  return pbuffer;
+}
+
+/**
+  * @brief  Get the current allocation mark of a memory pool.
+  * @param  pPool Pointer to a DCACHE_PoolTypeDef structure that contains the pool information.
+  * @retval Mark to give to HAL_DCACHE_Pool_Release() to free the buffers allocated afterwards.
+  */
+uint32_t HAL_DCACHE_Pool_GetMark(const DCACHE_PoolTypeDef *pPool)
+{
+  return pPool->Offset;
+}
+
+/**
+  * @brief  Free the buffers of a memory pool allocated after a mark.
+  * @param  pPool Pointer to a DCACHE_PoolTypeDef structure that contains the pool information.
+  * @param  Mark Allocation mark got with HAL_DCACHE_Pool_GetMark().
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DCACHE_Pool_Release(DCACHE_PoolTypeDef *pPool, uint32_t Mark)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t primask_bit;
+
+  if (pPool == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Enter critical section */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  if (Mark <= pPool->Offset)
+  {
+    pPool->Offset = Mark;
+  }
+  else
+  {
+    /* Mark got before a previous release */
+    status = HAL_ERROR;
+  }
+
+  /* Exit critical section */
+  __set_PRIMASK(primask_bit);
+
+  return status;
+}
+
+/**
+  * @brief  Free all the buffers of a memory pool.
+  * @param  pPool Pointer to a DCACHE_PoolTypeDef structure that contains the pool information.
+  * @retval None
+  */
+void HAL_DCACHE_Pool_Reset(DCACHE_PoolTypeDef *pPool)
+{
+  pPool->Offset = 0U;
+}
+
+/**
+  * @brief  Get the free size of a memory pool.
+  * @param  pPool Pointer to a DCACHE_PoolTypeDef structure that contains the pool information.
+  * @retval Number of bytes remaining after the last allocated buffer.
+  */
+uint32_t HAL_DCACHE_Pool_GetFreeSize(const DCACHE_PoolTypeDef *pPool)
+{
+  return (pPool->Size - pPool->Offset);
+}
+
+/**
+  * @brief  Clean the cache lines of a memory pool buffer written by the CPU.
+  * @param  hdcache Pointer to a DCACHE_HandleTypeDef structure that contains
+  *                 the configuration information for the specified DCACHEx peripheral.
+  * @param  pPool Pointer to a DCACHE_PoolTypeDef structure that contains the pool information.
+  * @param  pBuffer Pointer to the buffer, or to a part of the buffer, to clean.
+  * @param  Size Size in bytes of the range to clean.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DCACHE_Pool_Clean(DCACHE_HandleTypeDef *hdcache, const DCACHE_PoolTypeDef *pPool,
+                                        const void *pBuffer, uint32_t Size)
+{
+  uint32_t start = (uint32_t)pBuffer;
+
+  /* Check the range is in the pool, the pool buffers holding whole cache lines */
+  if ((pPool == NULL) || (Size == 0U) || (start < pPool->BaseAddress) ||
+      ((start - pPool->BaseAddress) > pPool->Size) || (Size > (pPool->Size - (start - pPool->BaseAddress))))
+  {
+    return HAL_ERROR;
+  }
+
+  return HAL_DCACHE_CleanByAddr(hdcache, (const uint32_t *)start, Size);
+}
+
+/**
+  * @brief  Invalidate the cache lines of a memory pool buffer written by a peripheral.
+  * @param  hdcache Pointer to a DCACHE_HandleTypeDef structure that contains
+  *                 the configuration information for the specified DCACHEx peripheral.
+  * @param  pPool Pointer to a DCACHE_PoolTypeDef structure that contains the pool information.
+  * @param  pBuffer Pointer to the buffer, or to a part of the buffer, to invalidate.
+  * @param  Size Size in bytes of the range to invalidate.
+  * @note   The whole cache lines of the range are invalidated, which only discards data of the
+  *         same pool buffer as the buffers are padded to whole cache lines.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DCACHE_Pool_Invalidate(DCACHE_HandleTypeDef *hdcache, const DCACHE_PoolTypeDef *pPool,
+                                             const void *pBuffer, uint32_t Size)
+{
+  uint32_t start = (uint32_t)pBuffer;
+
+  /* Check the range is in the pool, the pool buffers holding whole cache lines */
+  if ((pPool == NULL) || (Size == 0U) || (start < pPool->BaseAddress) ||
+      ((start - pPool->BaseAddress) > pPool->Size) || (Size > (pPool->Size - (start - pPool->BaseAddress))))
+  {
+    return HAL_ERROR;
+  }
+
+  return HAL_DCACHE_InvalidateByAddr(hdcache, (const uint32_t *)start, Size);
+}
+
+/**
+  * @}
+  */
+
+/** @addtogroup DCACHE_Exported_Functions_Group6
+  *
+@verbatim
+ ===============================================================================
+            #####          DMA Coherency          #####
+ ===============================================================================
+    [..]
+    This subsection provides a set of functions allowing the drivers to keep their
+    DMA buffers coherent with the DCACHE.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Register the DCACHE handle used for the DMA buffers maintenance.
+  * @param  hdcache Pointer to a DCACHE_HandleTypeDef structure that contains
+  *                 the configuration information for the specified DCACHEx peripheral,
+  *                 NULL to stop the DMA buffers maintenance.
+  * @retval None
+  */
+void HAL_DCACHE_DMA_Register(DCACHE_HandleTypeDef *hdcache)
+{
+  pDCacheDMAHandle = hdcache;
+}
+
+/**
+  * @brief  Start the clean of a buffer read by a DMA.
+  * @param  pBuffer Pointer to the buffer.
+  * @param  Size Size in bytes of the buffer.
+  * @note   The command runs in the background, HAL_DCACHE_DMA_WaitPrepared() must be called
+  *         before the DMA is enabled.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DCACHE_DMA_PrepareTx(const void *pBuffer, uint32_t Size)
+{
+  return DCACHE_DMA_Start(DCACHE_COMMAND_CLEAN, pBuffer, Size);
+}
+
+/**
+  * @brief  Start the clean and invalidation of a buffer written by a DMA.
+  * @param  pBuffer Pointer to the buffer.
+  * @param  Size Size in bytes of the buffer.
+  * @note   The dirty lines are written back so that they are not evicted over the received
+  *         data. HAL_DCACHE_DMA_WaitPrepared() must be called before the DMA is enabled.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DCACHE_DMA_PrepareRx(const void *pBuffer, uint32_t Size)
+{
+  return DCACHE_DMA_Start(DCACHE_COMMAND_CLEAN_INVALIDATE, pBuffer, Size);
+}
+
+/**
+  * @brief  Wait for the end of the command started by HAL_DCACHE_DMA_PrepareTx() or
+  *         HAL_DCACHE_DMA_PrepareRx().
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DCACHE_DMA_WaitPrepared(void)
+{
+  DCACHE_HandleTypeDef *hdcache = pDCacheDMAHandle;
+  uint32_t tickstart;
+
+  if ((hdcache == NULL) || (READ_BIT(hdcache->Instance->CR, DCACHE_CR_EN) == 0U))
+  {
+    return HAL_OK;
+  }
+
+  /* Get timeout */
+  tickstart = HAL_GetTick();
+
+  /* Wait for the end of the running command */
+  while (READ_BIT(hdcache->Instance->SR, DCACHE_SR_BUSYCMDF) != 0U)
+  {
+    if ((HAL_GetTick() - tickstart) > DCACHE_COMMAND_TIMEOUT_VALUE)
+    {
+      if (READ_BIT(hdcache->Instance->SR, DCACHE_SR_BUSYCMDF) != 0U)
+      {
+        /* Update error code */
+        hdcache->ErrorCode = HAL_DCACHE_ERROR_TIMEOUT;
+
+        /* Change the DCACHE state */
+        hdcache->State = HAL_DCACHE_STATE_ERROR;
+
+        return HAL_ERROR;
+      }
+    }
+  }
+
+  /* Clear the end of command flag */
+  WRITE_REG(hdcache->Instance->FCR, DCACHE_FCR_CCMDENDF);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Invalidate a buffer written by a DMA, once the transfer is complete.
+  * @param  pBuffer Pointer to the buffer.
+  * @param  Size Size in bytes of the buffer.
+  * @note   The partial cache lines at the edges of the buffer are cleaned and invalidated to keep
+  *         the data of the neighbour variables.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DCACHE_DMA_CompleteRx(const void *pBuffer, uint32_t Size)
+{
+  DCACHE_HandleTypeDef *hdcache = pDCacheDMAHandle;
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t start = (uint32_t)pBuffer;
+  uint32_t end = start + Size;
+  uint32_t first = (start + DCACHE_LINE_SIZE - 1U) & ~(DCACHE_LINE_SIZE - 1U);
+  uint32_t last = end & ~(DCACHE_LINE_SIZE - 1U);
+
+  if ((hdcache == NULL) || (Size == 0U) || (READ_BIT(hdcache->Instance->CR, DCACHE_CR_EN) == 0U))
+  {
+    return HAL_OK;
+  }
+
+  /* Let a previous command end */
+  if (HAL_DCACHE_DMA_WaitPrepared() != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  if (first >= last)
+  {
+    /* No whole cache line in the buffer */
+    return DCACHE_CommandByAddr(hdcache, DCACHE_COMMAND_CLEAN_INVALIDATE,
+                                (const uint32_t *)(start & ~(DCACHE_LINE_SIZE - 1U)),
+                                (end - (start & ~(DCACHE_LINE_SIZE - 1U))), DCACHE_POLLING_MODE);
+  }
+
+  if (start != first)
+  {
+    status = DCACHE_CommandByAddr(hdcache, DCACHE_COMMAND_CLEAN_INVALIDATE,
+                                  (const uint32_t *)(first - DCACHE_LINE_SIZE), DCACHE_LINE_SIZE,
+                                  DCACHE_POLLING_MODE);
+  }
+
+  if (status == HAL_OK)
+  {
+    status = DCACHE_CommandByAddr(hdcache, DCACHE_COMMAND_INVALIDATE, (const uint32_t *)first, (last - first),
+                                  DCACHE_POLLING_MODE);
+  }
+
+  if ((status == HAL_OK) && (end != last))
+  {
+    status = DCACHE_CommandByAddr(hdcache, DCACHE_COMMAND_CLEAN_INVALIDATE, (const uint32_t *)last,
+                                  DCACHE_LINE_SIZE, DCACHE_POLLING_MODE);
+  }
+
+  return status;
+}
+
 /**
   * @}
   */
@@ -1398,7 +1805,7 @@ uint32_t HAL_DCACHE_GetError(const DCACHE_HandleTypeDef *hdcache)
   * @param  pAddr Start address of region to be Cleaned, Invalidated or Cleaned and Invalidated.
   * @param  dSize Size of the region to be Cleaned, Invalidated or Cleaned and Invalidated (in bytes).
   * @param  mode mode to be applied for the DCACHE
-  *                       DCACHE_IT_MODE, DCACHE_POLLING_MODE.
+  *                       DCACHE_IT_MODE, DCACHE_POLLING_MODE, DCACHE_START_MODE.
   * @retval HAL status
   */
 static HAL_StatusTypeDef DCACHE_CommandByAddr(DCACHE_HandleTypeDef *hdcache, uint32_t Command,
@@ -1443,6 +1850,14 @@ static HAL_StatusTypeDef DCACHE_CommandByAddr(DCACHE_HandleTypeDef *hdcache, uin
       /* Launch cache command */
       SET_BIT(hdcache->Instance->CR, DCACHE_CR_STARTCMD);
     }
+    else if (mode == DCACHE_START_MODE)
+    {
+      /* Make sure that end of cache command interrupt is disabled */
+      CLEAR_BIT(hdcache->Instance->IER, DCACHE_IER_CMDENDIE);
+
+      /* Launch cache command, the end being waited for by the caller */
+      SET_BIT(hdcache->Instance->CR, DCACHE_CR_STARTCMD);
+    }
     else
     {
       /* Make sure that end of cache command interrupt is disabled */
@@ -1479,6 +1894,34 @@ static HAL_StatusTypeDef DCACHE_CommandByAddr(DCACHE_HandleTypeDef *hdcache, uin
   return status;
 }
 
+/**
+  * @brief  Start a DCACHE command on the cache lines of a DMA buffer.
+  * @param  Command command to be applied for the DCACHE
+  *                       DCACHE_COMMAND_CLEAN, DCACHE_COMMAND_CLEAN_INVALIDATE
+  * @param  pBuffer Pointer to the buffer.
+  * @param  Size Size in bytes of the buffer.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef DCACHE_DMA_Start(uint32_t Command, const void *pBuffer, uint32_t Size)
+{
+  DCACHE_HandleTypeDef *hdcache = pDCacheDMAHandle;
+  uint32_t start = (uint32_t)pBuffer & ~(DCACHE_LINE_SIZE - 1U);
+  uint32_t end = ((uint32_t)pBuffer + Size + DCACHE_LINE_SIZE - 1U) & ~(DCACHE_LINE_SIZE - 1U);
+
+  if ((hdcache == NULL) || (Size == 0U) || (READ_BIT(hdcache->Instance->CR, DCACHE_CR_EN) == 0U))
+  {
+    return HAL_OK;
+  }
+
+  /* A single command runs at a time: let the previous one end */
+  if (HAL_DCACHE_DMA_WaitPrepared() != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  return DCACHE_CommandByAddr(hdcache, Command, (const uint32_t *)start, (end - start), DCACHE_START_MODE);
+}
+
 /**
   * @}
   */
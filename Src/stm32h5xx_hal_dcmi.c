@@ -48,6 +48,12 @@
         window from the received image using HAL_DCMI_ConfigCrop()
         and HAL_DCMI_EnableCrop() functions
 
+    (#) Alternatively, capture continuously into a ring of FrameCount consecutive
+        buffers described by a user DCMI_FrameRingTypeDef using HAL_DCMI_FrameRing_Start().
+        HAL_DCMI_FrameReadyCallback() gives the index and timestamp of each captured
+        frame, which is processed while the next one is captured and then given back
+        with HAL_DCMI_FrameRing_Release().
+
     (#) The capture can be stopped using HAL_DCMI_Stop() function.
 
     (#) To control DCMI state you can use the function HAL_DCMI_GetState().
@@ -114,6 +120,10 @@
     using HAL_DCMI_RegisterCallback before calling HAL_DCMI_DeInit
     or HAL_DCMI_Init function.
 
+    The frame ring FrameReadyCallback, which has a specific prototype, is
+    registered with HAL_DCMI_RegisterFrameReadyCallback() and reset to the weak
+    function with HAL_DCMI_UnRegisterFrameReadyCallback().
+
     When the compilation define USE_HAL_DCMI_REGISTER_CALLBACKS is set to 0 or
     not defined, the callback registering feature is not available
     and weak (surcharged) callbacks are used.
@@ -160,6 +170,7 @@
   */
 static void       DCMI_DMAXferCplt(DMA_HandleTypeDef *hdma);
 static void       DCMI_DMAError(DMA_HandleTypeDef *hdma);
+static HAL_StatusTypeDef DCMI_StartNodes(DCMI_HandleTypeDef *hdcmi, uint32_t pData);
 
 /**
   * @}
@@ -224,6 +235,7 @@ HAL_StatusTypeDef HAL_DCMI_Init(DCMI_HandleTypeDef *hdcmi)
     hdcmi->VsyncEventCallback = HAL_DCMI_VsyncEventCallback; /* Legacy weak VsyncEventCallback  */
     hdcmi->LineEventCallback  = HAL_DCMI_LineEventCallback;  /* Legacy weak LineEventCallback   */
     hdcmi->ErrorCallback      = HAL_DCMI_ErrorCallback;      /* Legacy weak ErrorCallback       */
+    hdcmi->FrameReadyCallback = HAL_DCMI_FrameReadyCallback; /* Legacy weak FrameReadyCallback  */
 
     if (hdcmi->MspInitCallback == NULL)
     {
@@ -275,6 +287,9 @@ HAL_StatusTypeDef HAL_DCMI_Init(DCMI_HandleTypeDef *hdcmi)
   /* Update error code */
   hdcmi->ErrorCode = HAL_DCMI_ERROR_NONE;
 
+  /* No frame ring running */
+  hdcmi->pFrameRing = NULL;
+
   /* Initialize the DCMI state*/
   hdcmi->State  = HAL_DCMI_STATE_READY;
 
@@ -360,6 +375,8 @@ __weak void HAL_DCMI_MspDeInit(DCMI_HandleTypeDef *hdcmi)
     [..]  This section provides functions allowing to:
       (+) Configure destination address and data length and
           Enables DCMI DMA request and enables DCMI capture
+      (+) Start a continuous capture into a ring of frame buffers
+          and give the captured frames back to the ring.
       (+) Stop the DCMI capture.
       (+) Handles DCMI interrupt request.
 
@@ -380,9 +397,6 @@ HAL_StatusTypeDef HAL_DCMI_Start_DMA(DCMI_HandleTypeDef *hdcmi, uint32_t DCMI_Mo
 {
   uint32_t tmp_length = Length;
   HAL_StatusTypeDef status = HAL_OK;
-  uint32_t cllr_offset;
-  uint32_t tmp1;
-  uint32_t tmp2;
 
   /* Check function parameters */
   assert_param(IS_DCMI_CAPTURE_MODE(DCMI_Mode));
@@ -393,6 +407,9 @@ HAL_StatusTypeDef HAL_DCMI_Start_DMA(DCMI_HandleTypeDef *hdcmi, uint32_t DCMI_Mo
   /* Lock the DCMI peripheral state */
   hdcmi->State = HAL_DCMI_STATE_BUSY;
 
+  /* Single destination buffer, no frame ring */
+  hdcmi->pFrameRing = NULL;
+
   /* Enable DCMI by setting DCMIEN bit */
   __HAL_DCMI_ENABLE(hdcmi);
 
@@ -476,93 +493,7 @@ HAL_StatusTypeDef HAL_DCMI_Start_DMA(DCMI_HandleTypeDef *hdcmi, uint32_t DCMI_Mo
     hdcmi->XferCount = (hdcmi->XferCount - 1U);
     hdcmi->XferTransferNumber = hdcmi->XferCount;
 
-    if ((hdcmi->DMA_Handle->Mode & DMA_LINKEDLIST) == DMA_LINKEDLIST)
-    {
-      if ((hdcmi->DMA_Handle->LinkedListQueue != 0U) && (hdcmi->DMA_Handle->LinkedListQueue->Head != 0U))
-      {
-        /* Update first node */
-
-        /* Set DMA Data size */
-        hdcmi->DMA_Handle->LinkedListQueue->Head->LinkRegisters[NODE_CBR1_DEFAULT_OFFSET] = hdcmi->XferSize ;
-
-        /* Set DMA Source address */
-        hdcmi->DMA_Handle->LinkedListQueue->Head->LinkRegisters[NODE_CSAR_DEFAULT_OFFSET] = \
-            (uint32_t)&hdcmi->Instance->DR;
-
-        /* Set DMA Destination address */
-        hdcmi->DMA_Handle->LinkedListQueue->Head->LinkRegisters[NODE_CDAR_DEFAULT_OFFSET] = (uint32_t)pData;
-
-        /* Get CLLR offset */
-        cllr_offset = (hdcmi->DMA_Handle->LinkedListQueue->Head->NodeInfo & NODE_CLLR_IDX) >> 8U;
-
-        /* Update second node */
-        if (hdcmi->DMA_Handle->LinkedListQueue->Head->LinkRegisters[cllr_offset] != 0U)
-        {
-          tmp1 = (uint32_t)hdcmi->DMA_Handle->LinkedListQueue->Head ;
-          tmp2 = hdcmi->DMA_Handle->LinkedListQueue->Head->LinkRegisters[cllr_offset];
-          /* Update second node */
-
-          /* Set DMA Data size */
-          ((DMA_NodeTypeDef *)((tmp1 & DMA_CLBAR_LBA) + \
-                               (tmp2 & DMA_CLLR_LA)))->LinkRegisters[NODE_CBR1_DEFAULT_OFFSET] = hdcmi->XferSize;
-
-          /* Set DMA Source address */
-          ((DMA_NodeTypeDef *)((tmp1 & DMA_CLBAR_LBA) + \
-                               (tmp2 & DMA_CLLR_LA)))->LinkRegisters[NODE_CSAR_DEFAULT_OFFSET] = \
-                                   (uint32_t)&hdcmi->Instance->DR;
-
-          /* Set DMA Destination address */
-          ((DMA_NodeTypeDef *)((tmp1 & DMA_CLBAR_LBA) + \
-                               (tmp2 & DMA_CLLR_LA)))->LinkRegisters[NODE_CDAR_DEFAULT_OFFSET] = \
-                                   (uint32_t)pData + hdcmi->XferSize;
-
-          if (HAL_DMAEx_List_Start_IT(hdcmi->DMA_Handle) != HAL_OK)
-          {
-            /* Set Error Code */
-            hdcmi->ErrorCode = HAL_DCMI_ERROR_DMA;
-            /* Change DCMI state */
-            hdcmi->State = HAL_DCMI_STATE_READY;
-            /* Release Lock */
-            __HAL_UNLOCK(hdcmi);
-            /* Return function status */
-            status = HAL_ERROR;
-          }
-        }
-        else
-        {
-          /* Set Error Code */
-          hdcmi->ErrorCode = HAL_DCMI_ERROR_DMA;
-          /* Change DCMI state */
-          hdcmi->State = HAL_DCMI_STATE_READY;
-          /* Release Lock */
-          __HAL_UNLOCK(hdcmi);
-          /* Return function status */
-          status = HAL_ERROR;
-        }
-      }
-      else
-      {
-        /* Set Error Code */
-        hdcmi->ErrorCode = HAL_DCMI_ERROR_DMA;
-        /* Change DCMI state */
-        hdcmi->State = HAL_DCMI_STATE_READY;
-        /* Release Lock */
-        __HAL_UNLOCK(hdcmi);
-        /* Return function status */
-        status = HAL_ERROR;
-      }
-    }
-    else
-    {
-      /* Set Error Code */
-      hdcmi->ErrorCode = HAL_DCMI_ERROR_DMA;
-      /* Change DCMI state */
-      hdcmi->State = HAL_DCMI_STATE_READY;
-      /* Release Lock */
-      __HAL_UNLOCK(hdcmi);
-      /* Return function status */
-      status = HAL_ERROR;
-    }
+    status = DCMI_StartNodes(hdcmi, pData);
   }
   if (status == HAL_OK)
   {
@@ -628,6 +559,9 @@ HAL_StatusTypeDef HAL_DCMI_Stop(DCMI_HandleTypeDef *hdcmi)
   /* Disable the DMA */
   (void)HAL_DMA_Abort(hdcmi->DMA_Handle);
 
+  /* Detach the frame ring, if any */
+  hdcmi->pFrameRing = NULL;
+
   /* Update error code */
   hdcmi->ErrorCode |= HAL_DCMI_ERROR_NONE;
 
@@ -713,6 +647,155 @@ HAL_StatusTypeDef HAL_DCMI_Resume(DCMI_HandleTypeDef *hdcmi)
   return HAL_OK;
 }
 
+/**
+  * @brief  Start a continuous capture into a ring of frame buffers.
+  * @note   The FrameCount buffers are consecutive in memory from FrameAddress. The two
+  *         linked-list nodes of the DMA queue walk the whole ring so no additional node
+  *         memory is needed; the DMA channel must be in linked-list mode with a circular queue.
+  * @note   Frame boundaries are derived from the DMA node transfers: each captured frame
+  *         (after crop) must be exactly FrameSize bytes.
+  * @note   HAL_DCMI_FrameReadyCallback() is called with the index of a completed frame,
+  *         which is then owned by the application until HAL_DCMI_FrameRing_Release().
+  *         The DMA never stalls: a buffer still owned when the capture wraps onto it is
+  *         overwritten, counted in Overwrites and implicitly released.
+  * @note   The capture is stopped with HAL_DCMI_Stop().
+  * @param  hdcmi pointer to a DCMI_HandleTypeDef structure that contains
+  *                the configuration information for DCMI.
+  * @param  pRing pointer to a DCMI_FrameRingTypeDef structure describing the frame
+  *               buffers. It must remain valid until the capture is stopped.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DCMI_FrameRing_Start(DCMI_HandleTypeDef *hdcmi, DCMI_FrameRingTypeDef *pRing)
+{
+  HAL_StatusTypeDef status;
+  uint32_t xfersize;
+  uint32_t nodes = 1U;
+
+  /* Check the frame ring parameters */
+  if (pRing == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  if ((pRing->FrameCount < 2U) || (pRing->FrameCount > DCMI_FRAME_RING_MAX_FRAMES) || \
+      (pRing->FrameSize == 0U) || ((pRing->FrameSize % 4U) != 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Split the frame in equal node transfers not exceeding 0xFFFF bytes */
+  xfersize = pRing->FrameSize;
+  while (xfersize > 0xFFFFU)
+  {
+    xfersize = (xfersize / 2U);
+    nodes = nodes * 2U;
+  }
+
+  if (((xfersize * nodes) != pRing->FrameSize) || ((xfersize % 4U) != 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hdcmi);
+
+  if (hdcmi->State != HAL_DCMI_STATE_READY)
+  {
+    /* Process Unlocked */
+    __HAL_UNLOCK(hdcmi);
+
+    return HAL_BUSY;
+  }
+
+  /* Lock the DCMI peripheral state */
+  hdcmi->State = HAL_DCMI_STATE_BUSY;
+
+  /* Enable DCMI by setting DCMIEN bit */
+  __HAL_DCMI_ENABLE(hdcmi);
+
+  /* The frame ring is always captured in continuous mode */
+  hdcmi->Instance->CR &= ~(DCMI_CR_CM);
+  hdcmi->Instance->CR |= (uint32_t)(DCMI_MODE_CONTINUOUS);
+
+  /* Set the DMA memory0 conversion complete callback */
+  hdcmi->DMA_Handle->XferCpltCallback = DCMI_DMAXferCplt;
+
+  /* Set the DMA error callback */
+  hdcmi->DMA_Handle->XferErrorCallback = DCMI_DMAError;
+
+  /* Set the dma abort callback */
+  hdcmi->DMA_Handle->XferAbortCallback = NULL;
+
+  /* Reset the frame ring */
+  pRing->NodesPerFrame = nodes;
+  pRing->NodeIndex     = 0U;
+  pRing->WriteIndex    = 0U;
+  pRing->ReadyMask     = 0U;
+  pRing->Overwrites    = 0U;
+  hdcmi->pFrameRing    = pRing;
+
+  /* The whole ring is walked by the nodes as one large buffer */
+  hdcmi->XferSize = xfersize;
+  hdcmi->pBuffPtr = pRing->FrameAddress;
+  hdcmi->XferCount = (pRing->FrameCount * nodes) - 1U;
+  hdcmi->XferTransferNumber = hdcmi->XferCount;
+
+  status = DCMI_StartNodes(hdcmi, pRing->FrameAddress);
+
+  if (status == HAL_OK)
+  {
+    /* Enable Capture */
+    hdcmi->Instance->CR |= DCMI_CR_CAPTURE;
+  }
+  else
+  {
+    /* Set Error Code */
+    hdcmi->ErrorCode = HAL_DCMI_ERROR_DMA;
+    /* Detach the frame ring */
+    hdcmi->pFrameRing = NULL;
+    /* Change DCMI state */
+    hdcmi->State = HAL_DCMI_STATE_READY;
+    /* Return function status */
+    status = HAL_ERROR;
+  }
+
+  /* Release Lock */
+  __HAL_UNLOCK(hdcmi);
+
+  /* Return function status */
+  return status;
+}
+
+/**
+  * @brief  Give a frame buffer delivered by HAL_DCMI_FrameReadyCallback() back to the ring.
+  * @note   This function can be called from thread or interrupt context.
+  * @param  hdcmi pointer to a DCMI_HandleTypeDef structure that contains
+  *                the configuration information for DCMI.
+  * @param  FrameIndex Index of the frame buffer, from 0 to FrameCount - 1.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DCMI_FrameRing_Release(DCMI_HandleTypeDef *hdcmi, uint32_t FrameIndex)
+{
+  DCMI_FrameRingTypeDef *pring = hdcmi->pFrameRing;
+  uint32_t primask_bit;
+
+  if ((pring == NULL) || (FrameIndex >= pring->FrameCount))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Enter critical section: ReadyMask is also updated by the DMA interrupt */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  pring->ReadyMask &= ~(1UL << FrameIndex);
+
+  /* Exit critical section */
+  __set_PRIMASK(primask_bit);
+
+  return HAL_OK;
+}
+
 /**
   * @brief  Handles DCMI interrupt request.
   * @param  hdcmi pointer to a DCMI_HandleTypeDef structure that contains
@@ -882,6 +965,26 @@ __weak void HAL_DCMI_FrameEventCallback(DCMI_HandleTypeDef *hdcmi)
    */
 }
 
+/**
+  * @brief  Frame Ready callback, a frame of the ring has been fully captured.
+  * @param  hdcmi pointer to a DCMI_HandleTypeDef structure that contains
+  *                the configuration information for DCMI.
+  * @param  FrameIndex Index of the captured frame buffer in the ring.
+  * @param  Timestamp  HAL tick value at the end of the frame transfer.
+  * @retval None
+  */
+__weak void HAL_DCMI_FrameReadyCallback(DCMI_HandleTypeDef *hdcmi, uint32_t FrameIndex, uint32_t Timestamp)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hdcmi);
+  UNUSED(FrameIndex);
+  UNUSED(Timestamp);
+
+  /* NOTE : This function Should not be modified, when the callback is needed,
+            the HAL_DCMI_FrameReadyCallback could be implemented in the user file
+   */
+}
+
 /**
   * @}
   */
@@ -1245,6 +1348,68 @@ HAL_StatusTypeDef HAL_DCMI_UnRegisterCallback(DCMI_HandleTypeDef *hdcmi, HAL_DCM
 
   return status;
 }
+
+/**
+  * @brief  Register the user DCMI Frame Ready Callback
+  *         To be used instead of the weak predefined callback
+  * @param  hdcmi pointer to a DCMI_HandleTypeDef structure that contains
+  *                the configuration information for DCMI.
+  * @param  pCallback pointer to the Frame Ready Callback function
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DCMI_RegisterFrameReadyCallback(DCMI_HandleTypeDef *hdcmi,
+                                                      pDCMI_FrameReadyCallbackTypeDef pCallback)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if (pCallback == NULL)
+  {
+    /* update the error code */
+    hdcmi->ErrorCode |= HAL_DCMI_ERROR_INVALID_CALLBACK;
+    /* update return status */
+    return HAL_ERROR;
+  }
+
+  if (hdcmi->State == HAL_DCMI_STATE_READY)
+  {
+    hdcmi->FrameReadyCallback = pCallback;
+  }
+  else
+  {
+    /* update the error code */
+    hdcmi->ErrorCode |= HAL_DCMI_ERROR_INVALID_CALLBACK;
+    /* update return status */
+    status = HAL_ERROR;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  UnRegister the DCMI Frame Ready Callback
+  *         DCMI Frame Ready Callback is redirected to the weak HAL_DCMI_FrameReadyCallback() predefined callback
+  * @param  hdcmi pointer to a DCMI_HandleTypeDef structure that contains
+  *                the configuration information for DCMI.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DCMI_UnRegisterFrameReadyCallback(DCMI_HandleTypeDef *hdcmi)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if (hdcmi->State == HAL_DCMI_STATE_READY)
+  {
+    hdcmi->FrameReadyCallback = HAL_DCMI_FrameReadyCallback; /* Legacy weak FrameReadyCallback */
+  }
+  else
+  {
+    /* update the error code */
+    hdcmi->ErrorCode |= HAL_DCMI_ERROR_INVALID_CALLBACK;
+    /* update return status */
+    status = HAL_ERROR;
+  }
+
+  return status;
+}
 #endif /* USE_HAL_DCMI_REGISTER_CALLBACKS */
 
 /**
@@ -1259,6 +1424,70 @@ HAL_StatusTypeDef HAL_DCMI_UnRegisterCallback(DCMI_HandleTypeDef *hdcmi, HAL_DCM
 /** @defgroup DCMI_Private_Functions DCMI Private Functions
   * @{
   */
+/**
+  * @brief  Program the two linked-list nodes walking the destination buffer and start the DMA.
+  * @note   XferSize, XferCount and XferTransferNumber must be set: the nodes of the
+  *         user queue are updated in DCMI_DMAXferCplt() for the following transfers.
+  * @param  hdcmi pointer to a DCMI_HandleTypeDef structure that contains
+  *                the configuration information for DCMI.
+  * @param  pData The destination memory Buffer address.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef DCMI_StartNodes(DCMI_HandleTypeDef *hdcmi, uint32_t pData)
+{
+  HAL_StatusTypeDef status = HAL_ERROR;
+  uint32_t cllr_offset;
+  uint32_t tmp1;
+  uint32_t tmp2;
+
+  if ((hdcmi->DMA_Handle->Mode & DMA_LINKEDLIST) == DMA_LINKEDLIST)
+  {
+    if ((hdcmi->DMA_Handle->LinkedListQueue != 0U) && (hdcmi->DMA_Handle->LinkedListQueue->Head != 0U))
+    {
+      /* Update first node */
+
+      /* Set DMA Data size */
+      hdcmi->DMA_Handle->LinkedListQueue->Head->LinkRegisters[NODE_CBR1_DEFAULT_OFFSET] = hdcmi->XferSize ;
+
+      /* Set DMA Source address */
+      hdcmi->DMA_Handle->LinkedListQueue->Head->LinkRegisters[NODE_CSAR_DEFAULT_OFFSET] = \
+          (uint32_t)&hdcmi->Instance->DR;
+
+      /* Set DMA Destination address */
+      hdcmi->DMA_Handle->LinkedListQueue->Head->LinkRegisters[NODE_CDAR_DEFAULT_OFFSET] = (uint32_t)pData;
+
+      /* Get CLLR offset */
+      cllr_offset = (hdcmi->DMA_Handle->LinkedListQueue->Head->NodeInfo & NODE_CLLR_IDX) >> 8U;
+
+      /* Update second node */
+      if (hdcmi->DMA_Handle->LinkedListQueue->Head->LinkRegisters[cllr_offset] != 0U)
+      {
+        tmp1 = (uint32_t)hdcmi->DMA_Handle->LinkedListQueue->Head ;
+        tmp2 = hdcmi->DMA_Handle->LinkedListQueue->Head->LinkRegisters[cllr_offset];
+        /* Update second node */
+
+        /* Set DMA Data size */
+        ((DMA_NodeTypeDef *)((tmp1 & DMA_CLBAR_LBA) + \
+                             (tmp2 & DMA_CLLR_LA)))->LinkRegisters[NODE_CBR1_DEFAULT_OFFSET] = hdcmi->XferSize;
+
+        /* Set DMA Source address */
+        ((DMA_NodeTypeDef *)((tmp1 & DMA_CLBAR_LBA) + \
+                             (tmp2 & DMA_CLLR_LA)))->LinkRegisters[NODE_CSAR_DEFAULT_OFFSET] = \
+                                 (uint32_t)&hdcmi->Instance->DR;
+
+        /* Set DMA Destination address */
+        ((DMA_NodeTypeDef *)((tmp1 & DMA_CLBAR_LBA) + \
+                             (tmp2 & DMA_CLLR_LA)))->LinkRegisters[NODE_CDAR_DEFAULT_OFFSET] = \
+                                 (uint32_t)pData + hdcmi->XferSize;
+
+        status = HAL_DMAEx_List_Start_IT(hdcmi->DMA_Handle);
+      }
+    }
+  }
+
+  return status;
+}
+
 /**
   * @brief  DMA conversion complete callback.
   * @param  hdma pointer to a DMA_HandleTypeDef structure that contains
@@ -1276,6 +1505,8 @@ static void DCMI_DMAXferCplt(DMA_HandleTypeDef *hdma)
   uint32_t transfernumber;
   uint32_t transfercount;
   uint32_t transfersize ;
+  DCMI_FrameRingTypeDef *pring;
+  uint32_t frame;
 
   /* Update Nodes destinations */
   if (hdcmi->XferSize != 0U)
@@ -1329,6 +1560,35 @@ static void DCMI_DMAXferCplt(DMA_HandleTypeDef *hdma)
       hdcmi->State = HAL_DCMI_STATE_READY;
     }
   }
+
+  /* Frame ring: a frame is complete once all its node transfers are done */
+  pring = hdcmi->pFrameRing;
+  if (pring != NULL)
+  {
+    pring->NodeIndex++;
+    if (pring->NodeIndex >= pring->NodesPerFrame)
+    {
+      pring->NodeIndex = 0U;
+      frame = pring->WriteIndex;
+
+      pring->WriteIndex = ((frame + 1U) < pring->FrameCount) ? (frame + 1U) : 0U;
+      pring->ReadyMask |= (1UL << frame);
+
+      /* The next buffer is still owned by the application: it is being overwritten */
+      if ((pring->ReadyMask & (1UL << pring->WriteIndex)) != 0U)
+      {
+        pring->ReadyMask &= ~(1UL << pring->WriteIndex);
+        pring->Overwrites++;
+      }
+
+#if (USE_HAL_DCMI_REGISTER_CALLBACKS == 1)
+      /* Frame ready Callback */
+      hdcmi->FrameReadyCallback(hdcmi, frame, HAL_GetTick());
+#else
+      HAL_DCMI_FrameReadyCallback(hdcmi, frame, HAL_GetTick());
+#endif /* USE_HAL_DCMI_REGISTER_CALLBACKS */
+    }
+  }
 }
 
 /**
@@ -452,6 +452,9 @@ HAL_StatusTypeDef HAL_DMA_DeInit(DMA_HandleTypeDef *const hdma)
     [..]
       (+) The HAL_DMA_Start() function allows to start the DMA channel transfer in normal mode (Blocking mode).
       (+) The HAL_DMA_Start_IT() function allows to start the DMA channel transfer in normal mode (Non-blocking mode).
+      (+) The HAL_DMA_Restart() function allows to start again, with new addresses and data size, a channel which
+          transfer started by HAL_DMA_Start_IT() is complete. Only the data size, the flags, the addresses and the
+          channel enable are written, the channel configuration and interrupts of the previous start being kept.
       (+) The HAL_DMA_Abort() function allows to abort any on-going transfer (Blocking mode).
       (+) The HAL_DMA_Abort_IT() function allows to abort any on-going transfer (Non-blocking mode).
       (+) The HAL_DMA_PollForTransfer() function allows to poll on half transfer and transfer complete (Blocking mode).
@@ -493,6 +496,8 @@ HAL_StatusTypeDef HAL_DMA_Start(DMA_HandleTypeDef *const hdma,
 
   /* Check the parameters */
   assert_param(IS_DMA_BLOCK_SIZE(SrcDataSize));
+  assert_param(IS_HAL_MEM_REACHABLE(HAL_MEM_MASTER_GPDMA, SrcAddress, 1U));
+  assert_param(IS_HAL_MEM_REACHABLE(HAL_MEM_MASTER_GPDMA, DstAddress, 1U));
 
   /* Process locked */
   __HAL_LOCK(hdma);
@@ -554,10 +559,14 @@ HAL_StatusTypeDef HAL_DMA_Start_IT(DMA_HandleTypeDef *const hdma,
 
   /* Check the parameters */
   assert_param(IS_DMA_BLOCK_SIZE(SrcDataSize));
+  assert_param(IS_HAL_MEM_REACHABLE(HAL_MEM_MASTER_GPDMA, SrcAddress, 1U));
+  assert_param(IS_HAL_MEM_REACHABLE(HAL_MEM_MASTER_GPDMA, DstAddress, 1U));
 
   /* Process locked */
   __HAL_LOCK(hdma);
 
+  HAL_TRACE_ENTER(HAL_TRACE_ID_DMA_START, hdma);
+
   /* Check DMA channel state */
   if (hdma->State == HAL_DMA_STATE_READY)
   {
@@ -570,6 +579,12 @@ HAL_StatusTypeDef HAL_DMA_Start_IT(DMA_HandleTypeDef *const hdma,
     /* Configure the source address, destination address, the data size and clear flags */
     DMA_SetConfig(hdma, SrcAddress, DstAddress, SrcDataSize);
 
+#if (USE_HAL_DMA_STATISTICS == 1U)
+    /* Store the transfer start time and size */
+    hdma->XferStartTimeStamp = DWT->CYCCNT;
+    hdma->XferSize           = SrcDataSize;
+#endif /* USE_HAL_DMA_STATISTICS */
+
     /* Enable common interrupts: Transfer Complete and Transfer Errors ITs */
     __HAL_DMA_ENABLE_IT(hdma, (DMA_IT_TC | DMA_IT_DTE | DMA_IT_ULE | DMA_IT_USE | DMA_IT_TO));
 
@@ -598,9 +613,64 @@ HAL_StatusTypeDef HAL_DMA_Start_IT(DMA_HandleTypeDef *const hdma,
     /* Process unlocked */
     __HAL_UNLOCK(hdma);
 
+    HAL_TRACE_EXIT(HAL_TRACE_ID_DMA_START, hdma);
+
     return HAL_ERROR;
   }
 
+  HAL_TRACE_EXIT(HAL_TRACE_ID_DMA_START, hdma);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Restart the DMA channel transfer in normal mode with new addresses and data size (Non-blocking mode).
+  * @param  hdma        : Pointer to a DMA_HandleTypeDef structure that contains the configuration information for
+  *                       the specified DMA Channel.
+  * @param  SrcAddress  : The source data address.
+  * @param  DstAddress  : The destination data address.
+  * @param  SrcDataSize : The length of data to be transferred from source to destination in bytes.
+  * @note   The previous transfer of the channel must have been started by HAL_DMA_Start_IT() and ended by its
+  *         transfer complete interrupt, e.g. this function can be called from the transfer complete callback.
+  *         The channel configuration and the interrupts enabled at this start are kept: the callbacks can not be
+  *         changed between restarts. The parameters are not checked.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_DMA_Restart(DMA_HandleTypeDef *const hdma,
+                                  uint32_t SrcAddress,
+                                  uint32_t DstAddress,
+                                  uint32_t SrcDataSize)
+{
+  /* Process locked */
+  __HAL_LOCK(hdma);
+
+  /* Check DMA channel state */
+  if (hdma->State != HAL_DMA_STATE_READY)
+  {
+    /* Update the DMA channel error code */
+    hdma->ErrorCode = HAL_DMA_ERROR_BUSY;
+
+    /* Process unlocked */
+    __HAL_UNLOCK(hdma);
+
+    return HAL_ERROR;
+  }
+
+  /* Update the DMA channel state */
+  hdma->State = HAL_DMA_STATE_BUSY;
+
+  /* Configure the source address, destination address, the data size and clear flags */
+  DMA_SetConfig(hdma, SrcAddress, DstAddress, SrcDataSize);
+
+#if (USE_HAL_DMA_STATISTICS == 1U)
+  /* Store the transfer start time and size */
+  hdma->XferStartTimeStamp = DWT->CYCCNT;
+  hdma->XferSize           = SrcDataSize;
+#endif /* USE_HAL_DMA_STATISTICS */
+
+  /* Enable DMA channel */
+  __HAL_DMA_ENABLE(hdma);
+
   return HAL_OK;
 }
 
@@ -921,6 +991,12 @@ void HAL_DMA_IRQHandler(DMA_HandleTypeDef *const hdma)
 #if defined (__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U)
   uint32_t global_active_flag_s = IS_DMA_GLOBAL_ACTIVE_FLAG_S(p_dma_instance, global_it_flag);
 #endif /* (__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U) */
+#if (USE_HAL_DMA_STATISTICS == 1U)
+  uint32_t isr_timestamp = DWT->CYCCNT;
+  uint32_t cycles;
+#endif /* USE_HAL_DMA_STATISTICS */
+
+  HAL_TRACE_ENTER(HAL_TRACE_ID_DMA_IRQ, hdma);
 
   /* Global Interrupt Flag management *********************************************************************************/
 #if defined (__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U)
@@ -929,6 +1005,7 @@ void HAL_DMA_IRQHandler(DMA_HandleTypeDef *const hdma)
   if (global_active_flag_ns == 0U)
 #endif /* (__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U) */
   {
+    HAL_TRACE_EXIT(HAL_TRACE_ID_DMA_IRQ, hdma);
     return; /* the global interrupt flag for the current channel is down , nothing to do */
   }
 
@@ -943,6 +1020,10 @@ void HAL_DMA_IRQHandler(DMA_HandleTypeDef *const hdma)
 
       /* Update the DMA channel error code */
       hdma->ErrorCode |= HAL_DMA_ERROR_DTE;
+
+#if (USE_HAL_DMA_STATISTICS == 1U)
+      hdma->Statistics.DTECount++;
+#endif /* USE_HAL_DMA_STATISTICS */
     }
   }
 
@@ -957,6 +1038,10 @@ void HAL_DMA_IRQHandler(DMA_HandleTypeDef *const hdma)
 
       /* Update the DMA channel error code */
       hdma->ErrorCode |= HAL_DMA_ERROR_ULE;
+
+#if (USE_HAL_DMA_STATISTICS == 1U)
+      hdma->Statistics.ULECount++;
+#endif /* USE_HAL_DMA_STATISTICS */
     }
   }
 
@@ -971,6 +1056,10 @@ void HAL_DMA_IRQHandler(DMA_HandleTypeDef *const hdma)
 
       /* Update the DMA channel error code */
       hdma->ErrorCode |= HAL_DMA_ERROR_USE;
+
+#if (USE_HAL_DMA_STATISTICS == 1U)
+      hdma->Statistics.USECount++;
+#endif /* USE_HAL_DMA_STATISTICS */
     }
   }
 
@@ -985,6 +1074,10 @@ void HAL_DMA_IRQHandler(DMA_HandleTypeDef *const hdma)
 
       /* Update the DMA channel error code */
       hdma->ErrorCode |= HAL_DMA_ERROR_TO;
+
+#if (USE_HAL_DMA_STATISTICS == 1U)
+      hdma->Statistics.TOCount++;
+#endif /* USE_HAL_DMA_STATISTICS */
     }
   }
 
@@ -1047,6 +1140,7 @@ void HAL_DMA_IRQHandler(DMA_HandleTypeDef *const hdma)
           hdma->XferAbortCallback(hdma);
         }
 
+        HAL_TRACE_EXIT(HAL_TRACE_ID_DMA_IRQ, hdma);
         return;
       }
       else
@@ -1096,6 +1190,22 @@ void HAL_DMA_IRQHandler(DMA_HandleTypeDef *const hdma)
         }
       }
 
+#if (USE_HAL_DMA_STATISTICS == 1U)
+      /* Update the transfer statistics at the end of transfer */
+      if (hdma->State == HAL_DMA_STATE_READY)
+      {
+        cycles = isr_timestamp - hdma->XferStartTimeStamp;
+
+        hdma->Statistics.XferCount++;
+        hdma->Statistics.XferBytes  += hdma->XferSize;
+        hdma->Statistics.XferCycles += cycles;
+        if (cycles > hdma->Statistics.XferCyclesMax)
+        {
+          hdma->Statistics.XferCyclesMax = cycles;
+        }
+      }
+#endif /* USE_HAL_DMA_STATISTICS */
+
       /* Clear TC and HT transfer flags */
       __HAL_DMA_CLEAR_FLAG(hdma, (DMA_FLAG_TC | DMA_FLAG_HT));
 
@@ -1137,6 +1247,17 @@ void HAL_DMA_IRQHandler(DMA_HandleTypeDef *const hdma)
       hdma->XferErrorCallback(hdma);
     }
   }
+
+#if (USE_HAL_DMA_STATISTICS == 1U)
+  /* Update the maximum interrupt handler duration */
+  cycles = DWT->CYCCNT - isr_timestamp;
+  if (cycles > hdma->Statistics.ISRCyclesMax)
+  {
+    hdma->Statistics.ISRCyclesMax = cycles;
+  }
+#endif /* USE_HAL_DMA_STATISTICS */
+
+  HAL_TRACE_EXIT(HAL_TRACE_ID_DMA_IRQ, hdma);
 }
 
 /**
@@ -93,6 +93,11 @@
 
       (#) Optionally, configure the line watermark in using the API HAL_DMA2D_ProgramLineEvent().
 
+      (#) Optionally, blend into the frame buffer being displayed with HAL_DMA2D_TiledBlendingStart_IT():
+          the transfer is split in tiles of TileHeight lines, each one started once the LTDC has
+          scanned it out. Call HAL_DMA2D_TiledBlending_LineEvent() from HAL_LTDC_LineEventCallback().
+          Smaller tiles leave more bandwidth to the LTDC, larger ones cost less interrupts.
+
       (#) Optionally, configure the dead time value in the AHB clock cycle inserted between two
           consecutive accesses on the AHB master port in using the API HAL_DMA2D_ConfigDeadTime()
           and enable/disable the functionality  with the APIs HAL_DMA2D_EnableDeadTime() or
@@ -263,6 +268,13 @@
                  The CLUT Color Mode, the CLUT size and enable the CLUT loading then copy the instructions
                  to the command list buffer.
 
+      [...] Partial frame composition
+            (+)Declare the modified areas of a frame with HAL_DMA2D_CL_DirtyRegion_Add() on a region set up
+               by HAL_DMA2D_CL_DirtyRegion_Init(). Overlapping areas are coalesced into disjoint rectangles.
+            (+)Append only the dirty rectangles to the command list with HAL_DMA2D_CL_AddRegionCopyCMD()
+               or HAL_DMA2D_CL_AddRegionBlendingCMD(), instead of one full frame operation.
+            (+)Empty the region with HAL_DMA2D_CL_DirtyRegion_Reset() before tracking the next frame.
+
       [...] Linear Command Lists Insersion
             (+)Insert Command Lists into the Ring Buffer HAL_DMA2D_CL_InsertCommandList()
                Once your command lists are prepared, you insert them into the ring buffer .
@@ -424,10 +436,18 @@ const uint32_t LDM_Decoder[HAL_DMA2D_CL_LDM_REG_NUM] =
 #if (USE_DMA2D_COMMAND_LIST_MODE == 1)
 static void DMA2D_CL_SetConfig(DMA2D_CL_HandleTypeDef *hdma2d, uint32_t pdata, uint32_t DstAddress, uint32_t Width,
                                uint32_t Height);
+static void DMA2D_CL_RectUnion(const DMA2D_CL_RectTypeDef *pRectA, const DMA2D_CL_RectTypeDef *pRectB,
+                               DMA2D_CL_RectTypeDef *pResult);
+static uint32_t DMA2D_CL_RectOverlap(const DMA2D_CL_RectTypeDef *pRectA, const DMA2D_CL_RectTypeDef *pRectB);
+static uint32_t DMA2D_CL_RectArea(const DMA2D_CL_RectTypeDef *pRect);
 #endif /* USE_DMA2D_COMMAND_LIST_MODE == 1 */
 #if (USE_DMA2D_COMMAND_LIST_MODE == 0)
 static void DMA2D_SetConfig(DMA2D_HandleTypeDef *hdma2d, uint32_t pdata, uint32_t DstAddress, uint32_t Width,
                             uint32_t Height);
+#if defined(HAL_LTDC_MODULE_ENABLED)
+static void DMA2D_TiledBlending_StartTile(DMA2D_HandleTypeDef *hdma2d);
+static uint32_t DMA2D_TiledBlending_Continue(DMA2D_HandleTypeDef *hdma2d);
+#endif /* HAL_LTDC_MODULE_ENABLED */
 #endif /* USE_DMA2D_COMMAND_LIST_MODE == 0 */
 /**
   * @}
@@ -526,6 +546,10 @@ HAL_StatusTypeDef HAL_DMA2D_Init(DMA2D_HandleTypeDef *hdma2d)
   /* Update error code */
   hdma2d->ErrorCode = HAL_DMA2D_ERROR_NONE;
 
+#if defined(HAL_LTDC_MODULE_ENABLED)
+  hdma2d->pTiledBlending = NULL;
+#endif /* HAL_LTDC_MODULE_ENABLED */
+
   /* Initialize the DMA2D state*/
   hdma2d->State  = HAL_DMA2D_STATE_READY;
 
@@ -869,6 +893,7 @@ HAL_StatusTypeDef HAL_DMA2D_UnRegisterCallback(DMA2D_HandleTypeDef *hdma2d, HAL_
           start the DMA2D transfer with interrupt.
       (+) Configure the source for foreground and background, destination address
           and data size then start a MultiBuffer DMA2D transfer with interrupt.
+      (+) Start a MultiBuffer DMA2D transfer split in line tiles following the LTDC raster.
       (+) Abort DMA2D transfer.
       (+) Suspend DMA2D transfer.
       (+) Resume DMA2D transfer.
@@ -1073,6 +1098,113 @@ HAL_StatusTypeDef HAL_DMA2D_BlendingStart_IT(DMA2D_HandleTypeDef *hdma2d, uint32
   return HAL_OK;
 }
 
+#if defined(HAL_LTDC_MODULE_ENABLED)
+/**
+  * @brief  Start a multi-source DMA2D transfer split in line tiles chasing the LTDC raster.
+  * @note   Each tile of TileHeight lines is blended only once the LTDC has scanned it out, so the DMA2D
+  *         never writes lines ahead of the raster (no tearing) and the LTDC keeps the memory bandwidth
+  *         between two tiles (no FIFO underrun). HAL_DMA2D_TiledBlending_LineEvent() must be called from
+  *         HAL_LTDC_LineEventCallback(); the LTDC line event is reprogrammed at each tile boundary.
+  * @note   The line offsets of the layers and the output must match the pitches of pTiled. The transfer
+  *         complete callback is called once, at the end of the last tile.
+  * @param  hdma2d Pointer to a DMA2D_HandleTypeDef structure that contains
+  *                 the configuration information for the DMA2D.
+  * @param  pTiled Pointer to a DMA2D_TiledBlendingTypeDef structure describing the blending, which
+  *                must remain valid until the end of the transfer.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DMA2D_TiledBlendingStart_IT(DMA2D_HandleTypeDef *hdma2d, DMA2D_TiledBlendingTypeDef *pTiled)
+{
+  uint32_t line;
+
+  if ((pTiled == NULL) || (pTiled->hltdc == NULL) || (pTiled->TileHeight == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_DMA2D_LINE(pTiled->Height));
+  assert_param(IS_DMA2D_PIXEL(pTiled->Width));
+
+  if ((hdma2d->Init.Mode != DMA2D_M2M_BLEND) && (hdma2d->Init.Mode != DMA2D_M2M_BLEND_FG) &&
+      (hdma2d->Init.Mode != DMA2D_M2M_BLEND_BG))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process locked */
+  __HAL_LOCK(hdma2d);
+
+  /* Change DMA2D peripheral state */
+  hdma2d->State = HAL_DMA2D_STATE_BUSY;
+
+  pTiled->NextLine    = 0U;
+  pTiled->ScannedLine = 0U;
+  pTiled->Running     = 0U;
+  hdma2d->pTiledBlending = pTiled;
+
+  /* Wait for the raster to leave the first tile */
+  line = (pTiled->TileHeight < pTiled->Height) ? pTiled->TileHeight : pTiled->Height;
+  if (HAL_LTDC_ProgramLineEvent(pTiled->hltdc, pTiled->RasterOffset + line) != HAL_OK)
+  {
+    hdma2d->pTiledBlending = NULL;
+    hdma2d->State = HAL_DMA2D_STATE_READY;
+
+    /* Process Unlocked */
+    __HAL_UNLOCK(hdma2d);
+
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Notify the tiled blending that the LTDC raster reached the programmed line.
+  * @note   To be called from HAL_LTDC_LineEventCallback(). It starts the next tile when the DMA2D
+  *         is idle and programs the LTDC line event at the end of the following tile.
+  * @param  hdma2d Pointer to a DMA2D_HandleTypeDef structure that contains
+  *                 the configuration information for the DMA2D.
+  * @retval HAL status, HAL_ERROR when no tiled blending is ongoing
+  */
+HAL_StatusTypeDef HAL_DMA2D_TiledBlending_LineEvent(DMA2D_HandleTypeDef *hdma2d)
+{
+  DMA2D_TiledBlendingTypeDef *p_tiled;
+  uint32_t primask_bit;
+  uint32_t line;
+
+  p_tiled = hdma2d->pTiledBlending;
+  if (p_tiled == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* The transfer complete interrupt may also start a tile */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  /* The programmed line is the end of the tile following the last scanned one */
+  line = p_tiled->ScannedLine + p_tiled->TileHeight;
+  p_tiled->ScannedLine = (line < p_tiled->Height) ? line : p_tiled->Height;
+
+  if ((p_tiled->Running == 0U) && (p_tiled->NextLine < p_tiled->ScannedLine))
+  {
+    DMA2D_TiledBlending_StartTile(hdma2d);
+  }
+
+  __set_PRIMASK(primask_bit);
+
+  if (p_tiled->ScannedLine < p_tiled->Height)
+  {
+    line = p_tiled->ScannedLine + p_tiled->TileHeight;
+    line = (line < p_tiled->Height) ? line : p_tiled->Height;
+    (void)HAL_LTDC_ProgramLineEvent(p_tiled->hltdc, p_tiled->RasterOffset + line);
+  }
+
+  return HAL_OK;
+}
+#endif /* HAL_LTDC_MODULE_ENABLED */
+
 /**
   * @brief  Abort the DMA2D Transfer.
   * @param  hdma2d  pointer to a DMA2D_HandleTypeDef structure that contains
@@ -1113,6 +1245,11 @@ HAL_StatusTypeDef HAL_DMA2D_Abort(DMA2D_HandleTypeDef *hdma2d)
   /* Disable the Transfer Complete, Transfer Error and Configuration Error interrupts */
   __HAL_DMA2D_DISABLE_IT(hdma2d, DMA2D_IT_TC | DMA2D_IT_TE | DMA2D_IT_CE);
 
+#if defined(HAL_LTDC_MODULE_ENABLED)
+  /* Drop the remaining tiles of a tiled blending */
+  hdma2d->pTiledBlending = NULL;
+#endif /* HAL_LTDC_MODULE_ENABLED */
+
   /* Change the DMA2D state*/
   hdma2d->State = HAL_DMA2D_STATE_READY;
 
@@ -1885,19 +2022,25 @@ void HAL_DMA2D_IRQHandler(DMA2D_HandleTypeDef *hdma2d)
       /* Clear the transfer complete flag */
       __HAL_DMA2D_CLEAR_FLAG(hdma2d, DMA2D_FLAG_TC);
 
-      /* Update error code */
-      hdma2d->ErrorCode |= HAL_DMA2D_ERROR_NONE;
+#if defined(HAL_LTDC_MODULE_ENABLED)
+      /* Tiled blending: complete only after the last tile */
+      if (DMA2D_TiledBlending_Continue(hdma2d) == 0U)
+#endif /* HAL_LTDC_MODULE_ENABLED */
+      {
+        /* Update error code */
+        hdma2d->ErrorCode |= HAL_DMA2D_ERROR_NONE;
 
-      /* Change DMA2D state */
-      hdma2d->State = HAL_DMA2D_STATE_READY;
+        /* Change DMA2D state */
+        hdma2d->State = HAL_DMA2D_STATE_READY;
 
-      /* Process Unlocked */
-      __HAL_UNLOCK(hdma2d);
+        /* Process Unlocked */
+        __HAL_UNLOCK(hdma2d);
 
-      if (hdma2d->XferCpltCallback != NULL)
-      {
-        /* Transfer complete Callback */
-        hdma2d->XferCpltCallback(hdma2d);
+        if (hdma2d->XferCpltCallback != NULL)
+        {
+          /* Transfer complete Callback */
+          hdma2d->XferCpltCallback(hdma2d);
+        }
       }
     }
   }
@@ -2496,6 +2639,99 @@ static void DMA2D_SetConfig(DMA2D_HandleTypeDef *hdma2d, uint32_t pdata, uint32_
     WRITE_REG(hdma2d->Instance->FGMAR, pdata);
   }
 }
+
+#if defined(HAL_LTDC_MODULE_ENABLED)
+/**
+  * @brief  Start the DMA2D transfer of the next tile of the ongoing tiled blending.
+  * @param  hdma2d Pointer to a DMA2D_HandleTypeDef structure that contains
+  *                 the configuration information for the DMA2D.
+  * @retval None
+  */
+static void DMA2D_TiledBlending_StartTile(DMA2D_HandleTypeDef *hdma2d)
+{
+  DMA2D_TiledBlendingTypeDef *p_tiled = hdma2d->pTiledBlending;
+  uint32_t first_line = p_tiled->NextLine;
+  uint32_t lines = p_tiled->Height - first_line;
+  uint32_t dst_address;
+
+  if (lines > p_tiled->TileHeight)
+  {
+    lines = p_tiled->TileHeight;
+  }
+
+  dst_address = p_tiled->DstAddress + (first_line * p_tiled->DstPitch);
+
+  if (hdma2d->Init.Mode == DMA2D_M2M_BLEND_FG)
+  {
+    /*blending & fixed FG*/
+    WRITE_REG(hdma2d->Instance->FGCOLR, p_tiled->SrcAddress1);
+    DMA2D_SetConfig(hdma2d, p_tiled->SrcAddress2 + (first_line * p_tiled->SrcPitch2), dst_address,
+                    p_tiled->Width, lines);
+  }
+  else if (hdma2d->Init.Mode == DMA2D_M2M_BLEND_BG)
+  {
+    /*blending & fixed BG*/
+    WRITE_REG(hdma2d->Instance->BGCOLR, p_tiled->SrcAddress2);
+    DMA2D_SetConfig(hdma2d, p_tiled->SrcAddress1 + (first_line * p_tiled->SrcPitch1), dst_address,
+                    p_tiled->Width, lines);
+  }
+  else
+  {
+    WRITE_REG(hdma2d->Instance->BGMAR, p_tiled->SrcAddress2 + (first_line * p_tiled->SrcPitch2));
+    DMA2D_SetConfig(hdma2d, p_tiled->SrcAddress1 + (first_line * p_tiled->SrcPitch1), dst_address,
+                    p_tiled->Width, lines);
+  }
+
+  p_tiled->NextLine = first_line + lines;
+  p_tiled->Running = 1U;
+
+  /* Enable the transfer complete, transfer error and configuration error interrupts */
+  __HAL_DMA2D_ENABLE_IT(hdma2d, DMA2D_IT_TC | DMA2D_IT_TE | DMA2D_IT_CE);
+
+  /* Enable the Peripheral */
+  __HAL_DMA2D_ENABLE(hdma2d);
+}
+
+/**
+  * @brief  Handle the end of a tile of the ongoing tiled blending.
+  * @param  hdma2d Pointer to a DMA2D_HandleTypeDef structure that contains
+  *                 the configuration information for the DMA2D.
+  * @retval 1 when tiles remain to be blended, 0 when the transfer is complete
+  */
+static uint32_t DMA2D_TiledBlending_Continue(DMA2D_HandleTypeDef *hdma2d)
+{
+  DMA2D_TiledBlendingTypeDef *p_tiled = hdma2d->pTiledBlending;
+  uint32_t primask_bit;
+  uint32_t pending = 0U;
+
+  if (p_tiled != NULL)
+  {
+    /* The LTDC line event may also start a tile */
+    primask_bit = __get_PRIMASK();
+    __disable_irq();
+
+    p_tiled->Running = 0U;
+
+    if (p_tiled->NextLine < p_tiled->Height)
+    {
+      /* Otherwise the next tile is started by the LTDC line event */
+      if (p_tiled->NextLine < p_tiled->ScannedLine)
+      {
+        DMA2D_TiledBlending_StartTile(hdma2d);
+      }
+      pending = 1U;
+    }
+    else
+    {
+      hdma2d->pTiledBlending = NULL;
+    }
+
+    __set_PRIMASK(primask_bit);
+  }
+
+  return pending;
+}
+#endif /* HAL_LTDC_MODULE_ENABLED */
 #endif /* USE_DMA2D_COMMAND_LIST_MODE == 0 */
 #if (USE_DMA2D_COMMAND_LIST_MODE == 1)
 /** @defgroup DMA2D_Exported_Functions_Group5 DMA2D Command List (CL) functions
@@ -3214,6 +3450,268 @@ HAL_StatusTypeDef HAL_DMA2D_CL_AddBlendingCMD(DMA2D_CL_HandleTypeDef *hdma2d, ui
 
   return HAL_OK;
 }
+
+/**
+  * @brief  Initialize a dirty region tracking the modified rectangles of a frame.
+  * @param  pRegion      Pointer to a DMA2D_CL_DirtyRegionTypeDef structure to be initialized.
+  * @param  pRects       User array of MaxRects rectangles.
+  * @param  MaxRects     Number of entries of pRects.
+  * @param  FrameWidth   Width of the frame buffers, in pixels.
+  * @param  FrameHeight  Height of the frame buffers, in lines.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DMA2D_CL_DirtyRegion_Init(DMA2D_CL_DirtyRegionTypeDef *pRegion, DMA2D_CL_RectTypeDef *pRects,
+                                                uint32_t MaxRects, uint32_t FrameWidth, uint32_t FrameHeight)
+{
+  if ((pRegion == NULL) || (pRects == NULL) || (MaxRects == 0U) || (FrameWidth == 0U) || (FrameHeight == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_DMA2D_PIXEL(FrameWidth));
+  assert_param(IS_DMA2D_LINE(FrameHeight));
+
+  pRegion->pRects      = pRects;
+  pRegion->MaxRects    = MaxRects;
+  pRegion->RectCount   = 0U;
+  pRegion->FrameWidth  = FrameWidth;
+  pRegion->FrameHeight = FrameHeight;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Add a modified rectangle to a dirty region.
+  * @note   The rectangle is clipped to the frame. Overlapping rectangles are merged into their bounding box,
+  *         so that the region is made of disjoint rectangles and no pixel is drawn twice. Touching or close
+  *         rectangles are merged when their bounding box is not larger than the two of them. When the region
+  *         is full, the rectangle is merged with the one whose bounding box grows the least.
+  * @param  pRegion Pointer to a DMA2D_CL_DirtyRegionTypeDef structure.
+  * @param  pRect   Pointer to the modified rectangle.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DMA2D_CL_DirtyRegion_Add(DMA2D_CL_DirtyRegionTypeDef *pRegion,
+                                               const DMA2D_CL_RectTypeDef *pRect)
+{
+  DMA2D_CL_RectTypeDef rect;
+  DMA2D_CL_RectTypeDef merged;
+  uint32_t index;
+  uint32_t best_index;
+  uint32_t best_growth;
+  uint32_t growth;
+  uint32_t found;
+
+  if ((pRegion == NULL) || (pRect == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Clip the rectangle to the frame */
+  if ((pRect->X >= pRegion->FrameWidth) || (pRect->Y >= pRegion->FrameHeight) ||
+      (pRect->Width == 0U) || (pRect->Height == 0U))
+  {
+    return HAL_OK;
+  }
+
+  rect = *pRect;
+  if (rect.Width > (pRegion->FrameWidth - rect.X))
+  {
+    rect.Width = pRegion->FrameWidth - rect.X;
+  }
+  if (rect.Height > (pRegion->FrameHeight - rect.Y))
+  {
+    rect.Height = pRegion->FrameHeight - rect.Y;
+  }
+
+  do
+  {
+    /* Absorb every rectangle overlapping the new one, or worth merging with it */
+    do
+    {
+      found = 0U;
+      for (index = 0U; (index < pRegion->RectCount) && (found == 0U); index++)
+      {
+        DMA2D_CL_RectUnion(&rect, &pRegion->pRects[index], &merged);
+
+        if ((DMA2D_CL_RectOverlap(&rect, &pRegion->pRects[index]) != 0U) ||
+            (DMA2D_CL_RectArea(&merged) <= (DMA2D_CL_RectArea(&rect) + DMA2D_CL_RectArea(&pRegion->pRects[index]))))
+        {
+          rect = merged;
+
+          /* Remove the absorbed rectangle */
+          pRegion->RectCount--;
+          pRegion->pRects[index] = pRegion->pRects[pRegion->RectCount];
+          found = 1U;
+        }
+      }
+    } while (found != 0U);
+
+    if (pRegion->RectCount < pRegion->MaxRects)
+    {
+      pRegion->pRects[pRegion->RectCount] = rect;
+      pRegion->RectCount++;
+      found = 1U;
+    }
+    else
+    {
+      /* Region full: merge with the rectangle growing the least, then check the overlaps again */
+      best_index = 0U;
+      best_growth = 0xFFFFFFFFU;
+      for (index = 0U; index < pRegion->RectCount; index++)
+      {
+        DMA2D_CL_RectUnion(&rect, &pRegion->pRects[index], &merged);
+        growth = DMA2D_CL_RectArea(&merged) - DMA2D_CL_RectArea(&pRegion->pRects[index]);
+        if (growth < best_growth)
+        {
+          best_growth = growth;
+          best_index = index;
+        }
+      }
+
+      DMA2D_CL_RectUnion(&rect, &pRegion->pRects[best_index], &merged);
+      rect = merged;
+      pRegion->RectCount--;
+      pRegion->pRects[best_index] = pRegion->pRects[pRegion->RectCount];
+    }
+  } while (found == 0U);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Empty a dirty region, typically once the frame is composed.
+  * @param  pRegion Pointer to a DMA2D_CL_DirtyRegionTypeDef structure.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DMA2D_CL_DirtyRegion_Reset(DMA2D_CL_DirtyRegionTypeDef *pRegion)
+{
+  if (pRegion == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  pRegion->RectCount = 0U;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Append one copy operation per dirty rectangle of a region to a command list.
+  * @note   The source and destination frame buffers have the frame geometry of the region. The layer
+  *         configuration (color modes) is the one previously added; the foreground input offset and output
+  *         offset are programmed for each rectangle and left so afterwards.
+  * @note   Only Memory-to-Memory and Memory-to-Memory with pixel format conversion modes are supported.
+  * @param  hdma2d       pointer to a DMA2D_CL_HandleTypeDef structure that contains the configuration information
+  * @param  pRegion      Pointer to the dirty region.
+  * @param  pSrc         Source frame buffer.
+  * @param  pDst         Destination frame buffer.
+  * @param  pCommandList Pointer to a DMA2D_CL_CommandListTypeDef structure that holds
+  *                      the command list where the copy commands will be appended.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DMA2D_CL_AddRegionCopyCMD(DMA2D_CL_HandleTypeDef *hdma2d,
+                                                const DMA2D_CL_DirtyRegionTypeDef *pRegion,
+                                                const DMA2D_CL_FrameBufferTypeDef *pSrc,
+                                                const DMA2D_CL_FrameBufferTypeDef *pDst,
+                                                DMA2D_CL_CommandListTypeDef *pCommandList)
+{
+  const DMA2D_CL_RectTypeDef *p_rect;
+  uint32_t index;
+  uint32_t offset;
+
+  if ((hdma2d == NULL) || (pRegion == NULL) || (pSrc == NULL) || (pDst == NULL) || (pCommandList == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  if ((hdma2d->Init.Mode != DMA2D_M2M) && (hdma2d->Init.Mode != DMA2D_M2M_PFC))
+  {
+    return HAL_ERROR;
+  }
+
+  for (index = 0U; index < pRegion->RectCount; index++)
+  {
+    p_rect = &pRegion->pRects[index];
+    offset = (p_rect->Y * pRegion->FrameWidth) + p_rect->X;
+
+    /* Line offsets skipping the pixels out of the rectangle */
+    DMA2D_CL_LDM_WRITE_REG(hdma2d, DMA2D_CL_FGOR_REG, pRegion->FrameWidth - p_rect->Width);
+    DMA2D_CL_LDM_MODIFY_REG(hdma2d, DMA2D_CL_OOR_REG, DMA2D_OOR_LO, pRegion->FrameWidth - p_rect->Width);
+
+    if (HAL_DMA2D_CL_AddCopyCMD(hdma2d, pSrc->Address + (offset * pSrc->PixelSize),
+                                pDst->Address + (offset * pDst->PixelSize),
+                                p_rect->Width, p_rect->Height, pCommandList) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Append one blending operation per dirty rectangle of a region to a command list.
+  * @note   The foreground, background and destination frame buffers have the frame geometry of the region.
+  *         The layers configuration is the one previously added; the input offsets and output offset are
+  *         programmed for each rectangle and left so afterwards.
+  * @note   Only the Memory-to-Memory with blending mode is supported. The destination may be the background
+  *         frame buffer, the rectangles of a region being disjoint.
+  * @param  hdma2d       pointer to a DMA2D_CL_HandleTypeDef structure that contains the configuration information
+  * @param  pRegion      Pointer to the dirty region.
+  * @param  pFg          Foreground frame buffer.
+  * @param  pBg          Background frame buffer.
+  * @param  pDst         Destination frame buffer.
+  * @param  pCommandList Pointer to a DMA2D_CL_CommandListTypeDef structure that holds
+  *                      the command list where the blending commands will be appended.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DMA2D_CL_AddRegionBlendingCMD(DMA2D_CL_HandleTypeDef *hdma2d,
+                                                    const DMA2D_CL_DirtyRegionTypeDef *pRegion,
+                                                    const DMA2D_CL_FrameBufferTypeDef *pFg,
+                                                    const DMA2D_CL_FrameBufferTypeDef *pBg,
+                                                    const DMA2D_CL_FrameBufferTypeDef *pDst,
+                                                    DMA2D_CL_CommandListTypeDef *pCommandList)
+{
+  const DMA2D_CL_RectTypeDef *p_rect;
+  uint32_t index;
+  uint32_t offset;
+  uint32_t line_offset;
+
+  if ((hdma2d == NULL) || (pRegion == NULL) || (pFg == NULL) || (pBg == NULL) || (pDst == NULL) ||
+      (pCommandList == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hdma2d->Init.Mode != DMA2D_M2M_BLEND)
+  {
+    return HAL_ERROR;
+  }
+
+  for (index = 0U; index < pRegion->RectCount; index++)
+  {
+    p_rect = &pRegion->pRects[index];
+    offset = (p_rect->Y * pRegion->FrameWidth) + p_rect->X;
+    line_offset = pRegion->FrameWidth - p_rect->Width;
+
+    /* Line offsets skipping the pixels out of the rectangle */
+    DMA2D_CL_LDM_WRITE_REG(hdma2d, DMA2D_CL_FGOR_REG, line_offset);
+    DMA2D_CL_LDM_WRITE_REG(hdma2d, DMA2D_CL_BGOR_REG, line_offset);
+    DMA2D_CL_LDM_MODIFY_REG(hdma2d, DMA2D_CL_OOR_REG, DMA2D_OOR_LO, line_offset);
+
+    if (HAL_DMA2D_CL_AddBlendingCMD(hdma2d, pFg->Address + (offset * pFg->PixelSize),
+                                    pBg->Address + (offset * pBg->PixelSize),
+                                    pDst->Address + (offset * pDst->PixelSize),
+                                    p_rect->Width, p_rect->Height, pCommandList) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  return HAL_OK;
+}
+
 /**
   * @brief  Sets up the DMA2D Command List structure by specifying its buffer address and size.
   * @param  Address      Pointer to the memory region allocated for the command list.
@@ -4299,6 +4797,54 @@ static void DMA2D_CL_SetConfig(DMA2D_CL_HandleTypeDef *hdma2d, uint32_t pdata, u
     DMA2D_CL_LDM_WRITE_REG(hdma2d, DMA2D_CL_FGMAR_REG, pdata);
   }
 }
+
+/**
+  * @brief  Compute the bounding box of two rectangles.
+  * @param  pRectA  first rectangle
+  * @param  pRectB  second rectangle
+  * @param  pResult bounding box
+  * @retval None
+  */
+static void DMA2D_CL_RectUnion(const DMA2D_CL_RectTypeDef *pRectA, const DMA2D_CL_RectTypeDef *pRectB,
+                               DMA2D_CL_RectTypeDef *pResult)
+{
+  uint32_t x_end = ((pRectA->X + pRectA->Width) > (pRectB->X + pRectB->Width)) ?
+                   (pRectA->X + pRectA->Width) : (pRectB->X + pRectB->Width);
+  uint32_t y_end = ((pRectA->Y + pRectA->Height) > (pRectB->Y + pRectB->Height)) ?
+                   (pRectA->Y + pRectA->Height) : (pRectB->Y + pRectB->Height);
+
+  pResult->X      = (pRectA->X < pRectB->X) ? pRectA->X : pRectB->X;
+  pResult->Y      = (pRectA->Y < pRectB->Y) ? pRectA->Y : pRectB->Y;
+  pResult->Width  = x_end - pResult->X;
+  pResult->Height = y_end - pResult->Y;
+}
+
+/**
+  * @brief  Check whether two rectangles share at least one pixel.
+  * @param  pRectA first rectangle
+  * @param  pRectB second rectangle
+  * @retval 1 when the rectangles overlap, 0 otherwise
+  */
+static uint32_t DMA2D_CL_RectOverlap(const DMA2D_CL_RectTypeDef *pRectA, const DMA2D_CL_RectTypeDef *pRectB)
+{
+  if ((pRectA->X < (pRectB->X + pRectB->Width)) && (pRectB->X < (pRectA->X + pRectA->Width)) &&
+      (pRectA->Y < (pRectB->Y + pRectB->Height)) && (pRectB->Y < (pRectA->Y + pRectA->Height)))
+  {
+    return 1U;
+  }
+
+  return 0U;
+}
+
+/**
+  * @brief  Compute the area of a rectangle.
+  * @param  pRect rectangle
+  * @retval Area in pixels
+  */
+static uint32_t DMA2D_CL_RectArea(const DMA2D_CL_RectTypeDef *pRect)
+{
+  return pRect->Width * pRect->Height;
+}
 #endif /* USE_DMA2D_COMMAND_LIST_MODE == 1 */
 /**
   * @}
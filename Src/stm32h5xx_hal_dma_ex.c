@@ -509,6 +509,88 @@
 
           (+) Use HAL_DMAEx_GetFifoLevel() to get the DMA channel FIFO level (available beats in FIFO).
 
+    *** Channel allocation ***
+    ==========================
+    [..]
+      Instead of statically assigning a channel to each peripheral, the channels can be allocated at run time
+      according to the transfer needs.
+
+          (+) Use HAL_DMAEx_ReserveChannel() to exclude the statically assigned channels from the allocator.
+
+          (+) Use HAL_DMAEx_AcquireChannel() to get a free channel providing the required features, before
+              HAL_DMA_Init() or HAL_DMAEx_List_Init().
+
+          (+) Use HAL_DMAEx_ReleaseChannel() to give back the channel after its de-initialization.
+
+    *** Memory copy and set ***
+    ===========================
+    [..]
+      A memory to memory channel, initialized once with HAL_DMA_Init(), can be used as a copy service.
+
+          (+) Use HAL_DMAEx_Memcpy() or HAL_DMAEx_Memcpy_IT() to copy a memory area.
+
+          (+) Use HAL_DMAEx_Memset() or HAL_DMAEx_Memset_IT() to set a memory area to a byte value.
+
+          (+) Below DMA_MEMCPY_CPU_THRESHOLD bytes (defined in stm32h5xx_hal_conf.h), the operation is executed by CPU.
+
+    *** Statistics ***
+    ==================
+    [..]
+      When USE_HAL_DMA_STATISTICS is set in stm32h5xx_hal_conf.h, the channel transfers and errors are recorded.
+
+          (+) Use HAL_DMAEx_ResetStatistics() to clear the statistics and enable the DWT cycle counter.
+
+          (+) Use HAL_DMAEx_GetStatistics() to get the transfer count, bytes, cycles, error counts and maximum
+              interrupt handler duration.
+
+    *** Event capture ***
+    =====================
+    [..]
+      A register can be captured in a ring buffer on each hardware trigger event, without CPU interrupt : GPIO port
+      snapshot or timer counter on an EXTI line edge, for instance.
+
+          (+) Configure the EXTI line edge, without interrupt, with HAL_GPIO_Init() in GPIO_MODE_EVT_RISING,
+              GPIO_MODE_EVT_FALLING or GPIO_MODE_EVT_RISING_FALLING mode.
+
+          (+) Use HAL_DMAEx_List_Init() to initialize the channel in DMA_LINKEDLIST_CIRCULAR mode.
+
+          (+) Use HAL_DMAEx_EventCapture_Start() to build the capture ring and start the channel : one data per
+              trigger event.
+
+          (+) Use HAL_DMAEx_EventCapture_GetIndex() to get the ring index of the next captured data.
+
+          (+) Use HAL_DMAEx_EventCapture_Stop() to stop the capture.
+
+    *** Peripheral pipeline ***
+    ===========================
+    [..]
+      Data can flow from peripheral to peripheral (e.g. SPI to AES to USART) through small intermediate buffers, each
+      stage being started by hardware trigger instead of a transfer complete callback.
+
+          (+) Use HAL_DMAEx_List_Init() to initialize two channels per stage in DMA_LINKEDLIST_CIRCULAR mode, and enable
+              the DMA requests of the peripherals.
+
+          (+) Describe the stages in an array of DMA_PipelineStageTypeDef and use HAL_DMAEx_Pipeline_Start() to start
+              all the channels.
+
+          (+) The pipeline XferCpltCallback is called once BlockNbr blocks are delivered by the last stage, or use
+              HAL_DMAEx_Pipeline_Stop() to stop the pipeline.
+
+    *** Bus profiling ***
+    =====================
+    [..]
+      The bus contention between the masters accessing the same memories (e.g. SRAM1 and SRAM2) can be measured to
+      choose the buffers placement.
+
+          (+) Use HAL_DMA_Init() to initialize memory to memory channels in DMA_NORMAL mode.
+
+          (+) Describe the copies in an array of DMA_BusTrafficTypeDef, at most one of them being run by the CPU, and
+              use HAL_DMAEx_BusProfile() : each copy is run alone then all together, and its bandwidth and slowdown
+              are reported.
+
+          (+) The other masters (e.g. DMA2D or ETH) started by the application before the call are part of the
+              measured contention.
+
     @endverbatim
   **********************************************************************************************************************
   */
@@ -528,9 +610,29 @@
 #ifdef HAL_DMA_MODULE_ENABLED
 
 /* Private types -----------------------------------------------------------------------------------------------------*/
-/* Private variables -------------------------------------------------------------------------------------------------*/
 /* Private Constants -------------------------------------------------------------------------------------------------*/
+#define DMA_CHANNEL_PER_INSTANCE (8U)  /* Number of channels per GPDMA instance           */
+#define DMA_CHANNEL_NUMBER       (16U) /* Number of channels managed by channel allocator */
+#define DMA_BUS_PROFILE_SLICE    (64U) /* Bytes copied by CPU between two checks of the profiled channels */
+#define DMA_BUS_PROFILE_MAX_NBR  (32U) /* Maximum number of profiled traffics                            */
+
+/* Private variables -------------------------------------------------------------------------------------------------*/
+/* Channel allocator table */
+static DMA_Channel_TypeDef *const DMA_ChannelTable[DMA_CHANNEL_NUMBER] =
+{
+  GPDMA1_Channel0, GPDMA1_Channel1, GPDMA1_Channel2, GPDMA1_Channel3,
+  GPDMA1_Channel4, GPDMA1_Channel5, GPDMA1_Channel6, GPDMA1_Channel7,
+  GPDMA2_Channel0, GPDMA2_Channel1, GPDMA2_Channel2, GPDMA2_Channel3,
+  GPDMA2_Channel4, GPDMA2_Channel5, GPDMA2_Channel6, GPDMA2_Channel7
+};
+
+/* Channel allocator state : one bit per allocated or reserved channel of the table */
+static uint32_t DMA_ChannelAllocMask = 0U;
+
 /* Private macros ----------------------------------------------------------------------------------------------------*/
+/* Size in bytes of a data of width WIDTH, a value of @ref DMA_Source_Data_Width */
+#define DMA_PIPELINE_DATA_SIZE(WIDTH) (1UL << ((WIDTH) >> DMA_CTR1_SDW_LOG2_Pos))
+
 /* Private function prototypes ---------------------------------------------------------------------------------------*/
 static void DMA_List_Init(DMA_HandleTypeDef const *const hdma);
 static void DMA_List_BuildNode(DMA_NodeConfTypeDef const *const pNodeConfig,
@@ -570,6 +672,27 @@ static void DMA_List_FormatNode(DMA_NodeTypeDef *const pNode,
 static void DMA_List_ClearUnusedFields(DMA_NodeTypeDef *const pNode,
                                        uint32_t FirstUnusedField);
 static void DMA_List_CleanQueue(DMA_QListTypeDef *const pQList);
+static uint32_t DMA_GetChannelFeatures(uint32_t ChannelIdx);
+static HAL_StatusTypeDef DMA_MemConfig(DMA_HandleTypeDef *const hdma,
+                                       uint32_t SrcAddress,
+                                       uint32_t DstAddress,
+                                       uint32_t Size,
+                                       uint32_t SrcInc);
+static void DMA_CpuMemcpy(void *pDst, void const *pSrc, uint32_t Size);
+static void DMA_CpuMemset(void *pDst, uint8_t Value, uint32_t Size);
+static HAL_StatusTypeDef DMA_Pipeline_LinkRing(DMA_HandleTypeDef *const hdma,
+                                               DMA_QListTypeDef *const pQList,
+                                               DMA_NodeTypeDef *const pNodes,
+                                               DMA_NodeConfTypeDef *const pNodeConfig,
+                                               uint32_t BufferAddress,
+                                               uint32_t BlockSize);
+static HAL_StatusTypeDef DMA_Pipeline_StartChannel(DMA_PipelineTypeDef *const pPipeline,
+                                                   DMA_HandleTypeDef *const hdma,
+                                                   uint32_t LastChannel);
+static HAL_StatusTypeDef DMA_Pipeline_StopChannel(DMA_HandleTypeDef *const hdma);
+static void DMA_Pipeline_BlockCplt(DMA_HandleTypeDef *hdma);
+static void DMA_Pipeline_Error(DMA_HandleTypeDef *hdma);
+static void DMA_BusProfile_CpuCopy(DMA_BusTrafficTypeDef const *const pTraffic, uint32_t Offset, uint32_t Size);
 
 /* Exported functions ------------------------------------------------------------------------------------------------*/
 
@@ -793,6 +916,8 @@ HAL_StatusTypeDef HAL_DMAEx_List_DeInit(DMA_HandleTypeDef *const hdma)
     [..]
       This section provides functions allowing to :
       (+) Configure to start DMA transfer in linked-list mode.
+      (+) Swap the buffer of the next node of a running circular linked-list queue.
+      (+) Start strided memory to memory copy of a rectangular area.
 
     [..]
       (+) The HAL_DMAEx_List_Start() function allows to start the DMA channel transfer in linked-list mode (Blocking
@@ -801,6 +926,12 @@ HAL_StatusTypeDef HAL_DMAEx_List_DeInit(DMA_HandleTypeDef *const hdma)
           (Non-blocking mode).
               (++) It is mandatory to register a linked-list queue to be executed by a DMA channel before starting
                    transfer otherwise a HAL_ERROR will be returned.
+      (+) The HAL_DMAEx_List_SwapNextNodeBuffer() function allows to patch the memory buffer address of the next node
+          to be executed, using the channel CLLR register, without suspending the DMA channel. It is intended to be
+          called from the half transfer or transfer complete callback to rotate buffers of a circular queue.
+      (+) The HAL_DMAEx_Copy2D_IT() function allows to copy a rectangular area (camera region of interest, matrix
+          tile...) between two strided buffers. A single repeated block node is used on 2D addressing channels and one
+          node per line on linear addressing channels. The end of copy is signaled by the transfer complete callback.
 
 @endverbatim
   * @{
@@ -898,6 +1029,8 @@ HAL_StatusTypeDef HAL_DMAEx_List_Start_IT(DMA_HandleTypeDef *const hdma)
     return HAL_ERROR;
   }
 
+  HAL_TRACE_ENTER(HAL_TRACE_ID_DMA_LIST_START, hdma);
+
   /* Check DMA channel state */
   dma_state = hdma->State;
   ccr_value = hdma->Instance->CCR & DMA_CCR_LSM;
@@ -940,6 +1073,12 @@ HAL_StatusTypeDef HAL_DMAEx_List_Start_IT(DMA_HandleTypeDef *const hdma)
       /* Update DMA registers for linked-list transfer */
       hdma->Instance->CLBAR = ((uint32_t)hdma->LinkedListQueue->Head & DMA_CLBAR_LBA);
       hdma->Instance->CLLR  = ((uint32_t)hdma->LinkedListQueue->Head & DMA_CLLR_LA) | cllr_mask;
+
+#if (USE_HAL_DMA_STATISTICS == 1U)
+      /* Store the transfer start time, the linked-list transfer size is not known */
+      hdma->XferStartTimeStamp = DWT->CYCCNT;
+      hdma->XferSize           = 0U;
+#endif /* USE_HAL_DMA_STATISTICS */
     }
 
     /* Enable DMA channel */
@@ -953,11 +1092,246 @@ HAL_StatusTypeDef HAL_DMAEx_List_Start_IT(DMA_HandleTypeDef *const hdma)
     /* Process unlocked */
     __HAL_UNLOCK(hdma);
 
+    HAL_TRACE_EXIT(HAL_TRACE_ID_DMA_LIST_START, hdma);
+
+    return HAL_ERROR;
+  }
+
+  HAL_TRACE_EXIT(HAL_TRACE_ID_DMA_LIST_START, hdma);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Swap the memory buffer of the next node to be executed by a running circular linked-list queue, without
+  *         suspending the DMA channel.
+  * @param  hdma          : Pointer to a DMA_HandleTypeDef structure that contains the configuration information for
+  *                         the specified DMA Channel.
+  * @param  BufferAddress : The new memory buffer address of the next node.
+  * @param  ppNode        : Pointer to be filled with the patched node address (can be NULL).
+  * @note   The memory side of the node is its destination address, excepted for memory to peripheral nodes where the
+  *         source address is patched. The address is patched with a single store, so that the DMA channel never
+  *         loads an inconsistent node.
+  * @note   This function is intended to be called from the half transfer or transfer complete callback of the
+  *         current node, as far as possible from the end of the current block. The queue must be in static format.
+  * @retval HAL_OK when the next node is patched before being loaded, HAL_BUSY when the DMA channel loaded it
+  *         meanwhile (the new buffer may only be used at the next queue cycle), HAL_ERROR otherwise.
+  */
+HAL_StatusTypeDef HAL_DMAEx_List_SwapNextNodeBuffer(DMA_HandleTypeDef *const hdma,
+                                                    uint32_t BufferAddress,
+                                                    DMA_NodeTypeDef **const ppNode)
+{
+  DMA_NodeTypeDef *pnode;
+  uint32_t cllr_value;
+  uint32_t reg_offset;
+
+  /* Check the DMA peripheral handle and the linked-list queue parameters */
+  if ((hdma == NULL) || (hdma->LinkedListQueue == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check DMA channel state and queue format */
+  if ((hdma->State != HAL_DMA_STATE_BUSY) || (hdma->LinkedListQueue->Type != QUEUE_TYPE_STATIC))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Get the next node to be executed from the channel linked-list registers */
+  cllr_value = hdma->Instance->CLLR;
+  if ((cllr_value & DMA_CLLR_LA) == 0U)
+  {
+    /* No next node, the current node is the last one */
     return HAL_ERROR;
   }
+  pnode = (DMA_NodeTypeDef *)((hdma->Instance->CLBAR & DMA_CLBAR_LBA) | (cllr_value & DMA_CLLR_LA));
+
+  /* Select the memory side address register of the node */
+  if ((pnode->LinkRegisters[NODE_CTR2_DEFAULT_OFFSET] & DMA_CTR2_DREQ) != 0U)
+  {
+    reg_offset = NODE_CSAR_DEFAULT_OFFSET;
+  }
+  else
+  {
+    reg_offset = NODE_CDAR_DEFAULT_OFFSET;
+  }
+
+  /* Patch the node */
+  pnode->LinkRegisters[reg_offset] = BufferAddress;
+  __DSB();
+
+  if (ppNode != NULL)
+  {
+    *ppNode = pnode;
+  }
+
+  /* Check that the node was not loaded meanwhile */
+  if (hdma->Instance->CLLR != cllr_value)
+  {
+    return HAL_BUSY;
+  }
 
   return HAL_OK;
 }
+
+/**
+  * @brief  Start a strided memory to memory copy of a rectangular area (Non-blocking mode).
+  * @param  hdma       : Pointer to a DMA_HandleTypeDef structure that contains the configuration information for the
+  *                      specified DMA Channel, initialized in DMA_LINKEDLIST_NORMAL mode.
+  * @param  pQList     : Pointer to a DMA_QListTypeDef structure used to build the copy queue.
+  * @param  pNodes     : Pointer to the node array used to build the copy queue. It must contain one node for 2D
+  *                      addressing channels and Rows nodes for linear addressing channels.
+  * @param  SrcAddress : The source area address.
+  * @param  SrcStride  : The source line stride in bytes.
+  * @param  DstAddress : The destination area address.
+  * @param  DstStride  : The destination line stride in bytes.
+  * @param  Width      : The area width (line length) in bytes.
+  * @param  Rows       : The area number of lines.
+  * @note   On 2D addressing channels, the copy is executed by a single repeated block node. On linear addressing
+  *         channels, the copy is executed by one node per line, with a transfer complete event on the last one only.
+  * @note   The widest data width allowed by the addresses, strides and width alignment is used.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_DMAEx_Copy2D_IT(DMA_HandleTypeDef *const hdma,
+                                      DMA_QListTypeDef *const pQList,
+                                      DMA_NodeTypeDef *const pNodes,
+                                      uint32_t SrcAddress,
+                                      uint32_t SrcStride,
+                                      uint32_t DstAddress,
+                                      uint32_t DstStride,
+                                      uint32_t Width,
+                                      uint32_t Rows)
+{
+  DMA_NodeConfTypeDef node_config;
+  uint32_t alignment;
+  uint32_t node_nbr;
+
+  /* Check the DMA peripheral handle, queue and node parameters */
+  if ((hdma == NULL) || (pQList == NULL) || (pNodes == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the area parameters */
+  if ((Width == 0U) || ((Width & ~DMA_CBR1_BNDT) != 0U) || (Rows == 0U) || (SrcStride < Width) ||
+      (DstStride < Width))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the DMA Mode is DMA_LINKEDLIST_NORMAL */
+  if (hdma->Mode != DMA_LINKEDLIST_NORMAL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check DMA channel state */
+  if (hdma->State != HAL_DMA_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  /* Select the widest data width allowed by the area alignment */
+  alignment = SrcAddress | SrcStride | DstAddress | DstStride | Width;
+  if ((alignment & 0x3U) == 0U)
+  {
+    node_config.Init.SrcDataWidth  = DMA_SRC_DATAWIDTH_WORD;
+    node_config.Init.DestDataWidth = DMA_DEST_DATAWIDTH_WORD;
+  }
+  else if ((alignment & 0x1U) == 0U)
+  {
+    node_config.Init.SrcDataWidth  = DMA_SRC_DATAWIDTH_HALFWORD;
+    node_config.Init.DestDataWidth = DMA_DEST_DATAWIDTH_HALFWORD;
+  }
+  else
+  {
+    node_config.Init.SrcDataWidth  = DMA_SRC_DATAWIDTH_BYTE;
+    node_config.Init.DestDataWidth = DMA_DEST_DATAWIDTH_BYTE;
+  }
+
+  /* Prepare the memory to memory node configuration */
+  node_config.Init.Request                     = DMA_REQUEST_SW;
+  node_config.Init.BlkHWRequest                = DMA_BREQ_SINGLE_BURST;
+  node_config.Init.Direction                   = DMA_MEMORY_TO_MEMORY;
+  node_config.Init.SrcInc                      = DMA_SINC_INCREMENTED;
+  node_config.Init.DestInc                     = DMA_DINC_INCREMENTED;
+  node_config.Init.Priority                    = hdma->InitLinkedList.Priority;
+  node_config.Init.SrcBurstLength              = 1U;
+  node_config.Init.DestBurstLength             = 1U;
+  node_config.Init.TransferAllocatedPort       = DMA_SRC_ALLOCATED_PORT0 | DMA_DEST_ALLOCATED_PORT0;
+  node_config.Init.TransferEventMode           = DMA_TCEM_LAST_LL_ITEM_TRANSFER;
+  node_config.Init.Mode                        = DMA_NORMAL;
+  node_config.DataHandlingConfig.DataExchange  = DMA_EXCHANGE_NONE;
+  node_config.DataHandlingConfig.DataAlignment = DMA_DATA_RIGHTALIGN_ZEROPADDED;
+  node_config.TriggerConfig.TriggerPolarity    = DMA_TRIG_POLARITY_MASKED;
+  node_config.TriggerConfig.TriggerMode        = 0U;
+  node_config.TriggerConfig.TriggerSelection   = 0U;
+  node_config.SrcAddress                       = SrcAddress;
+  node_config.DstAddress                       = DstAddress;
+  node_config.DataSize                         = Width;
+#if defined (__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U)
+  node_config.SrcSecure                        = DMA_CHANNEL_SRC_SEC;
+  node_config.DestSecure                       = DMA_CHANNEL_DEST_SEC;
+#endif /* (__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U) */
+
+  /* 2D addressing channel : the lines are repeated blocks of a single node */
+  if (IS_DMA_2D_ADDRESSING_INSTANCE(hdma->Instance) != 0U)
+  {
+    if ((Rows > 2048U) || ((SrcStride - Width) > 65535U) || ((DstStride - Width) > 65535U))
+    {
+      return HAL_ERROR;
+    }
+
+    node_config.NodeType                            = DMA_GPDMA_2D_NODE;
+    node_config.RepeatBlockConfig.RepeatCount       = Rows;
+    node_config.RepeatBlockConfig.SrcAddrOffset     = 0;
+    node_config.RepeatBlockConfig.DestAddrOffset    = 0;
+    node_config.RepeatBlockConfig.BlkSrcAddrOffset  = (int32_t)(SrcStride - Width);
+    node_config.RepeatBlockConfig.BlkDestAddrOffset = (int32_t)(DstStride - Width);
+    node_nbr = 1U;
+  }
+  /* Linear addressing channel : one node per line */
+  else
+  {
+    node_config.NodeType = DMA_GPDMA_LINEAR_NODE;
+    node_nbr = Rows;
+  }
+
+  /* Build the copy queue, the first node is the template of the other lines */
+  if (HAL_DMAEx_List_ResetQ(pQList) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  if (HAL_DMAEx_List_BuildNode(&node_config, &pNodes[0U]) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  if (HAL_DMAEx_List_InsertNode_Tail(pQList, &pNodes[0U]) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  for (uint32_t node_idx = 1U; node_idx < node_nbr; node_idx++)
+  {
+    (void)HAL_DMAEx_List_CloneNode(&pNodes[0U], &pNodes[node_idx], SrcAddress + (node_idx * SrcStride),
+                                   DstAddress + (node_idx * DstStride), Width);
+
+    if (HAL_DMAEx_List_InsertNode_Tail(pQList, &pNodes[node_idx]) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  /* Link the copy queue to the DMA channel and start it */
+  if (HAL_DMAEx_List_LinkQ(hdma, pQList) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  return HAL_DMAEx_List_Start_IT(hdma);
+}
 /**
   * @}
   */
@@ -983,6 +1357,8 @@ HAL_StatusTypeDef HAL_DMAEx_List_Start_IT(DMA_HandleTypeDef *const hdma)
       (+) Convert dynamic linked-list queue to static format.
       (+) Link linked-list queue to DMA channel.
       (+) Unlink linked-list queue from DMA channel.
+      (+) Allocate and release linked-list nodes from a static node pool.
+      (+) Clone linked-list node from a pre-built template node.
 
     [..]
       (+) The HAL_DMAEx_List_BuildNode() function allows to build linked-list node.
@@ -997,6 +1373,9 @@ HAL_StatusTypeDef HAL_DMAEx_List_Start_IT(DMA_HandleTypeDef *const hdma)
 
       (+) The HAL_DMAEx_List_InsertNode_Head() and HAL_DMAEx_List_InsertNode_Tail() functions allow to insert built
           linked-list node to the head (respectively the tail) of static linked-list queue.
+          The queue keeps a tail node cache, so that consecutive HAL_DMAEx_List_InsertNode_Tail() calls are executed
+          in constant time. The cache is invalidated by the other queue management functions and rebuilt by the next
+          tail insertion.
 
       (+) The HAL_DMAEx_List_RemoveNode() function allows to remove selected built linked-list node from static
           linked-list queue.
@@ -1040,6 +1419,14 @@ HAL_StatusTypeDef HAL_DMAEx_List_Start_IT(DMA_HandleTypeDef *const hdma)
       (+) The HAL_DMAEx_List_UnLinkQ() function allows to unlink the (Dynamic / Static) linked-list queue from DMA
           channel when execution is completed.
 
+      (+) The HAL_DMAEx_List_InitNodePool() function allows to give a user node array to a node pool.
+          The HAL_DMAEx_List_AllocNode() and HAL_DMAEx_List_FreeNode() functions allow to allocate (respectively
+          release) a node from (respectively to) the pool in constant time, from thread or interrupt context.
+
+      (+) The HAL_DMAEx_List_CloneNode() function allows to fill a node from a template node built once with
+          HAL_DMAEx_List_BuildNode(), patching only the source address, destination address and data size.
+          (Optimized per transfer node construction)
+
 @endverbatim
   * @{
   */
@@ -1193,6 +1580,9 @@ HAL_StatusTypeDef HAL_DMAEx_List_InsertNode(DMA_QListTypeDef *const pQList,
   /* Update the queue state */
   pQList->State = HAL_DMA_QUEUE_STATE_BUSY;
 
+  /* Invalidate the queue tail node cache */
+  pQList->Tail = NULL;
+
   /* Update the queue error code */
   pQList->ErrorCode = HAL_DMA_QUEUE_ERROR_NONE;
 
@@ -1328,6 +1718,7 @@ HAL_StatusTypeDef HAL_DMAEx_List_InsertNode_Head(DMA_QListTypeDef *const pQList,
   if (pQList->Head == NULL)
   {
     pQList->Head = pNewNode;
+    pQList->Tail = pNewNode;
   }
   /* Not empty queue */
   else
@@ -1409,9 +1800,15 @@ HAL_StatusTypeDef HAL_DMAEx_List_InsertNode_Tail(DMA_QListTypeDef *const pQList,
     /* Get CLLR register mask and offset */
     DMA_List_GetCLLRNodeInfo(pNewNode, &cllr_mask, &cllr_offset);
 
-    /* Find node and get its position in selected queue */
-    node_info.cllr_offset = cllr_offset;
-    (void)DMA_List_FindNode(pQList, NULL, &node_info);
+    /* Find the last queue node when the tail node cache is not valid */
+    if (pQList->Tail == NULL)
+    {
+      /* Find node and get its position in selected queue */
+      node_info.cllr_offset = cllr_offset;
+      (void)DMA_List_FindNode(pQList, NULL, &node_info);
+
+      pQList->Tail = (DMA_NodeTypeDef *)node_info.currentnode_addr;
+    }
 
     /* Check if queue is circular */
     if (pQList->FirstCircularNode != NULL)
@@ -1419,10 +1816,12 @@ HAL_StatusTypeDef HAL_DMAEx_List_InsertNode_Tail(DMA_QListTypeDef *const pQList,
       pNewNode->LinkRegisters[cllr_offset] = ((uint32_t)pQList->FirstCircularNode & DMA_CLLR_LA) | cllr_mask;
     }
 
-    ((DMA_NodeTypeDef *)node_info.currentnode_addr)->LinkRegisters[cllr_offset] =
-      ((uint32_t)pNewNode & DMA_CLLR_LA) | cllr_mask;
+    pQList->Tail->LinkRegisters[cllr_offset] = ((uint32_t)pNewNode & DMA_CLLR_LA) | cllr_mask;
   }
 
+  /* Update the queue tail node cache */
+  pQList->Tail = pNewNode;
+
   /* Increment queue node number */
   pQList->NodeNumber++;
 
@@ -1479,6 +1878,9 @@ HAL_StatusTypeDef HAL_DMAEx_List_RemoveNode(DMA_QListTypeDef *const pQList,
   /* Update the queue state */
   pQList->State = HAL_DMA_QUEUE_STATE_BUSY;
 
+  /* Invalidate the queue tail node cache */
+  pQList->Tail = NULL;
+
   /* Update the queue error code */
   pQList->ErrorCode = HAL_DMA_QUEUE_ERROR_NONE;
 
@@ -1743,6 +2145,9 @@ HAL_StatusTypeDef HAL_DMAEx_List_RemoveNode_Tail(DMA_QListTypeDef *const pQList)
 
     /* Clear first circular node */
     pQList->FirstCircularNode = NULL;
+
+    /* Update the queue tail node cache */
+    pQList->Tail = (DMA_NodeTypeDef *)(node_info.previousnode_addr);
   }
 
   /* Decrement node number */
@@ -1831,6 +2236,9 @@ HAL_StatusTypeDef HAL_DMAEx_List_ReplaceNode(DMA_QListTypeDef *const pQList,
   /* Update the queue state */
   pQList->State = HAL_DMA_QUEUE_STATE_BUSY;
 
+  /* Invalidate the queue tail node cache */
+  pQList->Tail = NULL;
+
   /* Update the queue error code */
   pQList->ErrorCode = HAL_DMA_QUEUE_ERROR_NONE;
 
@@ -1993,6 +2401,9 @@ HAL_StatusTypeDef HAL_DMAEx_List_ReplaceNode_Head(DMA_QListTypeDef *const pQList
   /* Update the queue state */
   pQList->State = HAL_DMA_QUEUE_STATE_BUSY;
 
+  /* Invalidate the queue tail node cache */
+  pQList->Tail = NULL;
+
   /* Update the queue error code */
   pQList->ErrorCode = HAL_DMA_QUEUE_ERROR_NONE;
 
@@ -2072,6 +2483,9 @@ HAL_StatusTypeDef HAL_DMAEx_List_ReplaceNode_Tail(DMA_QListTypeDef *const pQList
   /* Update the queue state */
   pQList->State = HAL_DMA_QUEUE_STATE_BUSY;
 
+  /* Invalidate the queue tail node cache */
+  pQList->Tail = NULL;
+
   /* Update the queue error code */
   pQList->ErrorCode = HAL_DMA_QUEUE_ERROR_NONE;
 
@@ -2161,6 +2575,9 @@ HAL_StatusTypeDef HAL_DMAEx_List_ResetQ(DMA_QListTypeDef *const pQList)
   /* Update the queue state */
   pQList->State = HAL_DMA_QUEUE_STATE_BUSY;
 
+  /* Invalidate the queue tail node cache */
+  pQList->Tail = NULL;
+
   /* Update the queue error code */
   pQList->ErrorCode = HAL_DMA_QUEUE_ERROR_NONE;
 
@@ -2285,6 +2702,9 @@ HAL_StatusTypeDef HAL_DMAEx_List_InsertQ(DMA_QListTypeDef *const pSrcQList,
   /* Update the destination queue state */
   pDestQList->State = HAL_DMA_QUEUE_STATE_BUSY;
 
+  /* Invalidate the queue tail node cache */
+  pDestQList->Tail = NULL;
+
   /* Update the destination queue error code */
   pDestQList->ErrorCode = HAL_DMA_QUEUE_ERROR_NONE;
 
@@ -2483,6 +2903,9 @@ HAL_StatusTypeDef HAL_DMAEx_List_InsertQ_Head(DMA_QListTypeDef *const pSrcQList,
   /* Update the destination queue state */
   pDestQList->State = HAL_DMA_QUEUE_STATE_BUSY;
 
+  /* Invalidate the queue tail node cache */
+  pDestQList->Tail = NULL;
+
   /* Update the destination queue error code */
   pDestQList->ErrorCode = HAL_DMA_QUEUE_ERROR_NONE;
 
@@ -2620,6 +3043,9 @@ HAL_StatusTypeDef HAL_DMAEx_List_InsertQ_Tail(DMA_QListTypeDef *const pSrcQList,
   /* Update the destination queue state */
   pDestQList->State = HAL_DMA_QUEUE_STATE_BUSY;
 
+  /* Invalidate the queue tail node cache */
+  pDestQList->Tail = NULL;
+
   /* Update the destination queue error code */
   pDestQList->ErrorCode = HAL_DMA_QUEUE_ERROR_NONE;
 
@@ -3233,6 +3659,141 @@ HAL_StatusTypeDef HAL_DMAEx_List_UnLinkQ(DMA_HandleTypeDef *const hdma)
 
   return HAL_OK;
 }
+
+/**
+  * @brief  Initialize a linked-list node pool from a user node array.
+  * @param  pPool   : Pointer to a DMA_NodePoolTypeDef structure that contains node pool information.
+  * @param  pNodes  : Pointer to the DMA_NodeTypeDef array given to the pool.
+  * @param  NodeNbr : Number of nodes in the array.
+  * @note   The node array follows the same placement constraints as any linked-list node (32bit aligned, in the DMA
+  *         64 KByte addressable space).
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_DMAEx_List_InitNodePool(DMA_NodePoolTypeDef *const pPool,
+                                              DMA_NodeTypeDef *const pNodes,
+                                              uint32_t NodeNbr)
+{
+  /* Check the node pool parameters */
+  if ((pPool == NULL) || (pNodes == NULL) || (NodeNbr == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Chain all pool nodes in the free list through their first register */
+  for (uint32_t node_idx = 0U; node_idx < (NodeNbr - 1U); node_idx++)
+  {
+    pNodes[node_idx].LinkRegisters[0U] = (uint32_t)&pNodes[node_idx + 1U];
+  }
+  pNodes[NodeNbr - 1U].LinkRegisters[0U] = 0U;
+
+  pPool->pFree   = pNodes;
+  pPool->NodeNbr = NodeNbr;
+  pPool->FreeNbr = NodeNbr;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Allocate a linked-list node from a node pool.
+  * @param  pPool : Pointer to a DMA_NodePoolTypeDef structure that contains node pool information.
+  * @note   This function can be called from thread and interrupt context.
+  * @retval Pointer to the allocated node, NULL when the pool is empty.
+  */
+DMA_NodeTypeDef *HAL_DMAEx_List_AllocNode(DMA_NodePoolTypeDef *const pPool)
+{
+  DMA_NodeTypeDef *pnode;
+  uint32_t primask_bit;
+
+  /* Enter critical section */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  pnode = pPool->pFree;
+  if (pnode != NULL)
+  {
+    pPool->pFree = (DMA_NodeTypeDef *)pnode->LinkRegisters[0U];
+    pPool->FreeNbr--;
+  }
+
+  /* Exit critical section */
+  __set_PRIMASK(primask_bit);
+
+  return pnode;
+}
+
+/**
+  * @brief  Release a linked-list node to its node pool.
+  * @param  pPool : Pointer to a DMA_NodePoolTypeDef structure that contains node pool information.
+  * @param  pNode : Pointer to a DMA_NodeTypeDef structure previously allocated from the pool.
+  * @note   The node must have been removed from any queue before being released.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_DMAEx_List_FreeNode(DMA_NodePoolTypeDef *const pPool,
+                                          DMA_NodeTypeDef *const pNode)
+{
+  uint32_t primask_bit;
+
+  /* Check the node pool parameters */
+  if ((pPool == NULL) || (pNode == NULL) || (pPool->FreeNbr >= pPool->NodeNbr))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Enter critical section */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  pNode->LinkRegisters[0U] = (uint32_t)pPool->pFree;
+  pPool->pFree = pNode;
+  pPool->FreeNbr++;
+
+  /* Exit critical section */
+  __set_PRIMASK(primask_bit);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Clone a template node, patching only its source address, destination address and data size.
+  * @param  pTemplate  : Pointer to a template DMA_NodeTypeDef structure, built once with HAL_DMAEx_List_BuildNode().
+  * @param  pNode      : Pointer to the DMA_NodeTypeDef structure to be filled.
+  * @param  SrcAddress : The source data address.
+  * @param  DstAddress : The destination data address.
+  * @param  DataSize   : The data size in bytes (block size of the node).
+  * @note   The template is checked when built, so the clone does not check the register fields again. The template
+  *         must be kept in static format : it must not be inserted in a queue converted to dynamic format.
+  * @note   The cloned node is not linked to any node and can be inserted in a queue.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_DMAEx_List_CloneNode(DMA_NodeTypeDef const *const pTemplate,
+                                           DMA_NodeTypeDef *const pNode,
+                                           uint32_t SrcAddress,
+                                           uint32_t DstAddress,
+                                           uint32_t DataSize)
+{
+  uint32_t cllr_offset;
+
+  /* Check the template and node parameters */
+  if ((pTemplate == NULL) || (pNode == NULL) || ((DataSize & ~DMA_CBR1_BNDT) != 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Copy the template registers and information */
+  DMA_List_FillNode(pTemplate, pNode);
+
+  /* Patch the transfer fields, block repeat count is kept from template */
+  pNode->LinkRegisters[NODE_CBR1_DEFAULT_OFFSET] =
+    (pTemplate->LinkRegisters[NODE_CBR1_DEFAULT_OFFSET] & ~DMA_CBR1_BNDT) | DataSize;
+  pNode->LinkRegisters[NODE_CSAR_DEFAULT_OFFSET] = SrcAddress;
+  pNode->LinkRegisters[NODE_CDAR_DEFAULT_OFFSET] = DstAddress;
+
+  /* Unlink the cloned node */
+  DMA_List_GetCLLRNodeInfo(pNode, NULL, &cllr_offset);
+  pNode->LinkRegisters[cllr_offset] = 0U;
+
+  return HAL_OK;
+}
 /**
   * @}
   */
@@ -3248,6 +3809,7 @@ HAL_StatusTypeDef HAL_DMAEx_List_UnLinkQ(DMA_HandleTypeDef *const hdma)
       (+) Configure DMA channel data handling.
       (+) Configure DMA channel repeated block.
       (+) Configure DMA channel trigger.
+      (+) Get the trigger selection of a DMA channel transfer complete event.
 
     [..]
       (+) The HAL_DMAEx_ConfigDataHandling() function allows to configure DMA channel data handling.
@@ -3256,6 +3818,9 @@ HAL_StatusTypeDef HAL_DMAEx_List_UnLinkQ(DMA_HandleTypeDef *const hdma)
 
       (+) The HAL_DMAEx_ConfigTrigger() function allows to configure DMA channel HW triggers.
 
+      (+) The HAL_DMAEx_GetTransferCpltTrigger() function gives the trigger selection of the transfer complete event
+          of a channel, to start the transfers of another channel at the end of its blocks.
+
       (+) The HAL_DMAEx_ConfigRepeatBlock() function allows to configure DMA channel repeated block.
               (++) This feature is available only for channel that supports 2 dimensions addressing capability.
 
@@ -3477,6 +4042,37 @@ HAL_StatusTypeDef HAL_DMAEx_ConfigRepeatBlock(DMA_HandleTypeDef *const hdma,
 
   return HAL_OK;
 }
+
+/**
+  * @brief  Get the trigger selection of the transfer complete event of a DMA channel.
+  * @note   The transfer complete event of a channel is a trigger input of all the GPDMA channels : a block transfer of
+  *         a channel can be started at the end of a block of another channel, without CPU.
+  * @param  hdma     : Pointer to a DMA_HandleTypeDef structure that contains the configuration information for the
+  *                    specified DMA Channel.
+  * @param  pTrigger : Pointer to the trigger selection, a value of @ref DMAEx_Trigger_Selection.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_DMAEx_GetTransferCpltTrigger(DMA_HandleTypeDef const *const hdma, uint32_t *const pTrigger)
+{
+  /* Check the DMA peripheral handle and the trigger pointer */
+  if ((hdma == NULL) || (pTrigger == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  for (uint32_t idx = 0U; idx < DMA_CHANNEL_NUMBER; idx++)
+  {
+    if (DMA_ChannelTable[idx] == hdma->Instance)
+    {
+      /* The channel transfer complete triggers follow the channel table order on both GPDMA instances */
+      *pTrigger = GPDMA1_TRIGGER_GPDMA1_CH0_TCF + idx;
+
+      return HAL_OK;
+    }
+  }
+
+  return HAL_ERROR;
+}
 /**
   * @}
   */
@@ -3676,14 +4272,1059 @@ uint32_t HAL_DMAEx_GetFifoLevel(DMA_HandleTypeDef const *const hdma)
   * @}
   */
 
-/**
-  * @}
-  */
+/** @addtogroup DMAEx_Exported_Functions_Group7
+  *
+@verbatim
+  ======================================================================================================================
+                         ##### Channel Allocation Functions #####
+  ======================================================================================================================
+    [..]
+      This section provides functions allowing to :
+      (+) Acquire a free DMA channel according to the required channel features.
+      (+) Release a DMA channel previously acquired.
+      (+) Reserve a DMA channel statically assigned by the application.
 
-/* Private functions -------------------------------------------------------------------------------------------------*/
-/** @defgroup DMAEx_Private_Functions DMAEx Private Functions
-  * @brief    DMAEx Private Functions
-  * @{
+    [..]
+      (+) The HAL_DMAEx_ReserveChannel() function allows to exclude a statically assigned channel from the allocator.
+
+      (+) The HAL_DMAEx_AcquireChannel() function allows to set the handle instance to a free channel providing the
+          required features (@ref DMAEx_Channel_Features). The least capable matching channel is selected, so that
+          2D addressing channels are kept for the transfers that need them. The handle is then initialized with
+          HAL_DMA_Init() or HAL_DMAEx_List_Init() and linked to the peripheral handle as for a static channel.
+
+      (+) The HAL_DMAEx_ReleaseChannel() function allows to give back an acquired channel, after its de-initialization.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Reserve a DMA channel statically assigned by the application, excluding it from the channel allocator.
+  * @param  Instance : Pointer to the DMA channel instance.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_DMAEx_ReserveChannel(DMA_Channel_TypeDef *const Instance)
+{
+  HAL_StatusTypeDef status = HAL_ERROR;
+  uint32_t primask_bit;
+
+  /* Enter critical section */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  for (uint32_t channel_idx = 0U; channel_idx < DMA_CHANNEL_NUMBER; channel_idx++)
+  {
+    if ((DMA_ChannelTable[channel_idx] == Instance) && ((DMA_ChannelAllocMask & (1UL << channel_idx)) == 0U))
+    {
+      DMA_ChannelAllocMask |= (1UL << channel_idx);
+      status = HAL_OK;
+    }
+  }
+
+  /* Exit critical section */
+  __set_PRIMASK(primask_bit);
+
+  return status;
+}
+
+/**
+  * @brief  Acquire a free DMA channel providing the required features.
+  * @param  hdma     : Pointer to a DMA_HandleTypeDef structure that contains the configuration information for the
+  *                    specified DMA Channel.
+  * @param  Features : The required channel features.
+  *                    This parameter can be a combination of @ref DMAEx_Channel_Features.
+  * @note   On success, the handle instance is set to the acquired channel.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_DMAEx_AcquireChannel(DMA_HandleTypeDef *const hdma,
+                                           uint32_t Features)
+{
+  uint32_t primask_bit;
+  uint32_t channel_features;
+  uint32_t required_caps;
+  uint32_t required_instances;
+  uint32_t selected_idx = DMA_CHANNEL_NUMBER;
+  uint32_t selected_features = 0U;
+
+  /* Check the DMA peripheral handle */
+  if (hdma == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_DMA_CHANNEL_FEATURES(Features));
+
+  /* Split the required capabilities and instances, any instance when none is selected */
+  required_caps      = Features & DMA_CHANNEL_FEATURE_CAPS_MASK;
+  required_instances = Features & DMA_CHANNEL_FEATURE_INSTANCE_MASK;
+  if (required_instances == 0U)
+  {
+    required_instances = DMA_CHANNEL_FEATURE_INSTANCE_MASK;
+  }
+
+  /* Enter critical section */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  /* Select the free matching channel with the least features */
+  for (uint32_t channel_idx = 0U; channel_idx < DMA_CHANNEL_NUMBER; channel_idx++)
+  {
+    channel_features = DMA_GetChannelFeatures(channel_idx);
+
+    if (((DMA_ChannelAllocMask & (1UL << channel_idx)) == 0U)   &&
+        ((channel_features & required_caps) == required_caps) &&
+        ((channel_features & required_instances) != 0U))
+    {
+      if ((selected_idx == DMA_CHANNEL_NUMBER) ||
+          ((channel_features & DMA_CHANNEL_FEATURE_CAPS_MASK) < (selected_features & DMA_CHANNEL_FEATURE_CAPS_MASK)))
+      {
+        selected_idx      = channel_idx;
+        selected_features = channel_features;
+      }
+    }
+  }
+
+  if (selected_idx != DMA_CHANNEL_NUMBER)
+  {
+    DMA_ChannelAllocMask |= (1UL << selected_idx);
+  }
+
+  /* Exit critical section */
+  __set_PRIMASK(primask_bit);
+
+  if (selected_idx == DMA_CHANNEL_NUMBER)
+  {
+    /* Update the DMA channel error code */
+    hdma->ErrorCode = HAL_DMA_ERROR_BUSY;
+
+    return HAL_ERROR;
+  }
+
+  /* Link the acquired channel to the handle */
+  hdma->Instance = DMA_ChannelTable[selected_idx];
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Release a DMA channel previously acquired or reserved.
+  * @param  hdma : Pointer to a DMA_HandleTypeDef structure that contains the configuration information for the
+  *                specified DMA Channel.
+  * @note   The DMA channel must be de-initialized before being released.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_DMAEx_ReleaseChannel(DMA_HandleTypeDef *const hdma)
+{
+  HAL_StatusTypeDef status = HAL_ERROR;
+  uint32_t primask_bit;
+
+  /* Check the DMA peripheral handle */
+  if (hdma == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check DMA channel state */
+  if ((hdma->State == HAL_DMA_STATE_BUSY) || (hdma->State == HAL_DMA_STATE_SUSPEND))
+  {
+    /* Update the DMA channel error code */
+    hdma->ErrorCode = HAL_DMA_ERROR_BUSY;
+
+    return HAL_ERROR;
+  }
+
+  /* Enter critical section */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  for (uint32_t channel_idx = 0U; channel_idx < DMA_CHANNEL_NUMBER; channel_idx++)
+  {
+    if ((DMA_ChannelTable[channel_idx] == hdma->Instance) && ((DMA_ChannelAllocMask & (1UL << channel_idx)) != 0U))
+    {
+      DMA_ChannelAllocMask &= ~(1UL << channel_idx);
+      status = HAL_OK;
+    }
+  }
+
+  /* Exit critical section */
+  __set_PRIMASK(primask_bit);
+
+  return status;
+}
+/**
+  * @}
+  */
+
+/** @addtogroup DMAEx_Exported_Functions_Group8
+  *
+@verbatim
+  ======================================================================================================================
+                         ##### Memory Copy and Set Functions #####
+  ======================================================================================================================
+    [..]
+      This section provides functions allowing to :
+      (+) Copy a memory area using a memory to memory DMA channel.
+      (+) Set a memory area to a byte value using a memory to memory DMA channel.
+
+    [..]
+      (+) The DMA channel is reserved to these operations and initialized once with HAL_DMA_Init() in DMA_NORMAL mode
+          with DMA_MEMORY_TO_MEMORY direction. The data width, burst length and increment mode are then programmed
+          by each operation from the buffers alignment, without a new channel initialization.
+
+      (+) The HAL_DMAEx_Memcpy() and HAL_DMAEx_Memset() functions execute the operation in polling mode (Blocking
+          mode).
+
+      (+) The HAL_DMAEx_Memcpy_IT() and HAL_DMAEx_Memset_IT() functions start the operation in interrupt mode
+          (Non-blocking mode). The end of operation is signaled by the channel XferCpltCallback.
+
+      (+) Below DMA_MEMCPY_CPU_THRESHOLD bytes, the DMA channel setup costs more than the copy : the CPU executes the
+          operation, and the XferCpltCallback is called before returning in interrupt mode.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Copy a memory area in polling mode (Blocking mode).
+  * @param  hdma    : Pointer to a DMA_HandleTypeDef structure that contains the configuration information for the
+  *                   specified DMA Channel.
+  * @param  pDst    : The destination area address.
+  * @param  pSrc    : The source area address.
+  * @param  Size    : The area size in bytes (up to 65535 bytes).
+  * @param  Timeout : Timeout duration.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_DMAEx_Memcpy(DMA_HandleTypeDef *const hdma,
+                                   void *pDst,
+                                   void const *pSrc,
+                                   uint32_t Size,
+                                   uint32_t Timeout)
+{
+  uint32_t src_addr = (uint32_t)pSrc;
+  uint32_t dst_addr = (uint32_t)pDst;
+
+  /* CPU copy of small areas */
+  if (Size < DMA_MEMCPY_CPU_THRESHOLD)
+  {
+    DMA_CpuMemcpy(pDst, pSrc, Size);
+
+    return HAL_OK;
+  }
+
+  if (DMA_MemConfig(hdma, src_addr, dst_addr, Size, DMA_SINC_INCREMENTED) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  if (HAL_DMA_Start(hdma, src_addr, dst_addr, Size) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  return HAL_DMA_PollForTransfer(hdma, HAL_DMA_FULL_TRANSFER, Timeout);
+}
+
+/**
+  * @brief  Start the copy of a memory area in interrupt mode (Non-blocking mode).
+  * @param  hdma    : Pointer to a DMA_HandleTypeDef structure that contains the configuration information for the
+  *                   specified DMA Channel.
+  * @param  pDst    : The destination area address.
+  * @param  pSrc    : The source area address.
+  * @param  Size    : The area size in bytes (up to 65535 bytes).
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_DMAEx_Memcpy_IT(DMA_HandleTypeDef *const hdma,
+                                      void *pDst,
+                                      void const *pSrc,
+                                      uint32_t Size)
+{
+  uint32_t src_addr = (uint32_t)pSrc;
+  uint32_t dst_addr = (uint32_t)pDst;
+
+  /* CPU copy of small areas */
+  if (Size < DMA_MEMCPY_CPU_THRESHOLD)
+  {
+    DMA_CpuMemcpy(pDst, pSrc, Size);
+
+    if (hdma->XferCpltCallback != NULL)
+    {
+      hdma->XferCpltCallback(hdma);
+    }
+
+    return HAL_OK;
+  }
+
+  if (DMA_MemConfig(hdma, src_addr, dst_addr, Size, DMA_SINC_INCREMENTED) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  return HAL_DMA_Start_IT(hdma, src_addr, dst_addr, Size);
+}
+
+/**
+  * @brief  Set a memory area to a byte value in polling mode (Blocking mode).
+  * @param  hdma    : Pointer to a DMA_HandleTypeDef structure that contains the configuration information for the
+  *                   specified DMA Channel.
+  * @param  pDst    : The destination area address.
+  * @param  Value   : The byte value.
+  * @param  Size    : The area size in bytes (up to 65535 bytes).
+  * @param  Timeout : Timeout duration.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_DMAEx_Memset(DMA_HandleTypeDef *const hdma,
+                                   void *pDst,
+                                   uint8_t Value,
+                                   uint32_t Size,
+                                   uint32_t Timeout)
+{
+  uint32_t dst_addr = (uint32_t)pDst;
+
+  /* CPU set of small areas */
+  if (Size < DMA_MEMCPY_CPU_THRESHOLD)
+  {
+    DMA_CpuMemset(pDst, Value, Size);
+
+    return HAL_OK;
+  }
+
+  if (DMA_MemConfig(hdma, (uint32_t)&hdma->MemsetPattern, dst_addr, Size, DMA_SINC_FIXED) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  /* The source pattern is read at each beat, whatever the data width */
+  hdma->MemsetPattern = (uint32_t)Value * 0x01010101U;
+
+  if (HAL_DMA_Start(hdma, (uint32_t)&hdma->MemsetPattern, dst_addr, Size) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  return HAL_DMA_PollForTransfer(hdma, HAL_DMA_FULL_TRANSFER, Timeout);
+}
+
+/**
+  * @brief  Start to set a memory area to a byte value in interrupt mode (Non-blocking mode).
+  * @param  hdma    : Pointer to a DMA_HandleTypeDef structure that contains the configuration information for the
+  *                   specified DMA Channel.
+  * @param  pDst    : The destination area address.
+  * @param  Value   : The byte value.
+  * @param  Size    : The area size in bytes (up to 65535 bytes).
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_DMAEx_Memset_IT(DMA_HandleTypeDef *const hdma,
+                                      void *pDst,
+                                      uint8_t Value,
+                                      uint32_t Size)
+{
+  uint32_t dst_addr = (uint32_t)pDst;
+
+  /* CPU set of small areas */
+  if (Size < DMA_MEMCPY_CPU_THRESHOLD)
+  {
+    DMA_CpuMemset(pDst, Value, Size);
+
+    if (hdma->XferCpltCallback != NULL)
+    {
+      hdma->XferCpltCallback(hdma);
+    }
+
+    return HAL_OK;
+  }
+
+  if (DMA_MemConfig(hdma, (uint32_t)&hdma->MemsetPattern, dst_addr, Size, DMA_SINC_FIXED) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  /* The source pattern is read at each beat, whatever the data width */
+  hdma->MemsetPattern = (uint32_t)Value * 0x01010101U;
+
+  return HAL_DMA_Start_IT(hdma, (uint32_t)&hdma->MemsetPattern, dst_addr, Size);
+}
+/**
+  * @}
+  */
+
+#if (USE_HAL_DMA_STATISTICS == 1U)
+/** @addtogroup DMAEx_Exported_Functions_Group9
+  *
+@verbatim
+  ======================================================================================================================
+                         ##### Statistics Functions #####
+  ======================================================================================================================
+    [..]
+      This section provides functions allowing to :
+      (+) Get the DMA channel statistics.
+      (+) Reset the DMA channel statistics.
+
+    [..]
+      (+) When USE_HAL_DMA_STATISTICS is set in stm32h5xx_hal_conf.h, each interrupt mode transfer is measured with
+          the DWT cycle counter from its start to its transfer complete event, and the channel errors and the
+          HAL_DMA_IRQHandler() duration are recorded.
+
+      (+) The HAL_DMAEx_ResetStatistics() function allows to clear the statistics and to enable the DWT cycle counter.
+          It is called once before the first transfer to be measured.
+
+      (+) The HAL_DMAEx_GetStatistics() function allows to get a copy of the statistics.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Get the DMA channel statistics.
+  * @param  hdma        : Pointer to a DMA_HandleTypeDef structure that contains the configuration information for the
+  *                       specified DMA Channel.
+  * @param  pStatistics : Pointer to a DMA_StatisticsTypeDef structure to be filled.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_DMAEx_GetStatistics(DMA_HandleTypeDef const *const hdma,
+                                          DMA_StatisticsTypeDef *const pStatistics)
+{
+  uint32_t primask_bit;
+
+  /* Check the DMA peripheral handle and statistics parameters */
+  if ((hdma == NULL) || (pStatistics == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Get a consistent copy of the statistics updated under interrupt */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  *pStatistics = hdma->Statistics;
+
+  __set_PRIMASK(primask_bit);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Reset the DMA channel statistics.
+  * @param  hdma : Pointer to a DMA_HandleTypeDef structure that contains the configuration information for the
+  *                specified DMA Channel.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_DMAEx_ResetStatistics(DMA_HandleTypeDef *const hdma)
+{
+  uint32_t primask_bit;
+
+  /* Check the DMA peripheral handle */
+  if (hdma == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Enable the DWT cycle counter used for time measurement */
+  HAL_CycleCounter_Enable();
+
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  hdma->Statistics.XferCount     = 0U;
+  hdma->Statistics.XferBytes     = 0U;
+  hdma->Statistics.XferCycles    = 0U;
+  hdma->Statistics.XferCyclesMax = 0U;
+  hdma->Statistics.DTECount      = 0U;
+  hdma->Statistics.ULECount      = 0U;
+  hdma->Statistics.USECount      = 0U;
+  hdma->Statistics.TOCount       = 0U;
+  hdma->Statistics.ISRCyclesMax  = 0U;
+
+  __set_PRIMASK(primask_bit);
+
+  return HAL_OK;
+}
+/**
+  * @}
+  */
+#endif /* USE_HAL_DMA_STATISTICS */
+
+/** @addtogroup DMAEx_Exported_Functions_Group10
+  *
+@verbatim
+  ======================================================================================================================
+                         ##### Event Capture Functions #####
+  ======================================================================================================================
+    [..]
+      This section provides functions allowing to :
+      (+) Start the capture of a register in a ring buffer on each trigger event.
+      (+) Stop the capture.
+      (+) Get the ring index of the next captured data.
+
+    [..]
+      (+) The channel transfers one data from the fixed source register to the incremented ring buffer on each hit of
+          the trigger (DMA_TRIGM_SINGLE_BURST_TRANSFER), with a software request : EXTI line events are captured at
+          hardware speed without interrupt handler latency. On GPDMA, the EXTI lines 0 to 7 are trigger inputs.
+
+      (+) The ring is a single node circular queue. When XferHalfCpltCallback is set before the start, it is called
+          when the first half of the ring is filled, and XferCpltCallback when the second half is filled, allowing to
+          process the captured data by blocks.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Start the capture of a register in a ring buffer on each trigger event.
+  * @param  hdma    : Pointer to a DMA_HandleTypeDef structure that contains the configuration information for the
+  *                   specified DMA Channel, initialized in DMA_LINKEDLIST_CIRCULAR mode.
+  * @param  pConfig : Pointer to a DMA_EventCaptureConfTypeDef structure that contains the capture configuration.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_DMAEx_EventCapture_Start(DMA_HandleTypeDef *const hdma,
+                                               DMA_EventCaptureConfTypeDef const *const pConfig)
+{
+  DMA_NodeConfTypeDef node_conf;
+  HAL_StatusTypeDef status;
+  uint32_t data_size;
+
+  /* Check the DMA peripheral handle and the capture parameters */
+  if ((hdma == NULL) || (pConfig == NULL) || (pConfig->pQueue == NULL) || (pConfig->pNode == NULL)
+      || (pConfig->pBuffer == NULL) || (pConfig->Length == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_DMA_SOURCE_DATA_WIDTH(pConfig->DataWidth));
+  assert_param(IS_DMA_TRIGGER_POLARITY(pConfig->TriggerPolarity));
+  assert_param(IS_DMA_TRIGGER_SELECTION(pConfig->Trigger));
+
+  /* Check the DMA channel circular linked-list mode */
+  if (hdma->Mode != DMA_LINKEDLIST_CIRCULAR)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Get the destination data width of the same size */
+  switch (pConfig->DataWidth)
+  {
+    case DMA_SRC_DATAWIDTH_BYTE:
+      node_conf.Init.DestDataWidth = DMA_DEST_DATAWIDTH_BYTE;
+      data_size = 1U;
+      break;
+    case DMA_SRC_DATAWIDTH_HALFWORD:
+      node_conf.Init.DestDataWidth = DMA_DEST_DATAWIDTH_HALFWORD;
+      data_size = 2U;
+      break;
+    default: /* case DMA_SRC_DATAWIDTH_WORD */
+      node_conf.Init.DestDataWidth = DMA_DEST_DATAWIDTH_WORD;
+      data_size = 4U;
+      break;
+  }
+
+  /* Check the ring size in bytes */
+  if (pConfig->Length > (DMA_CBR1_BNDT / data_size))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Prepare the node : one data from the fixed register to the ring buffer on each trigger hit */
+  node_conf.NodeType                            = DMA_GPDMA_LINEAR_NODE;
+  node_conf.Init.Request                        = DMA_REQUEST_SW;
+  node_conf.Init.BlkHWRequest                   = DMA_BREQ_SINGLE_BURST;
+  node_conf.Init.Direction                      = DMA_MEMORY_TO_MEMORY;
+  node_conf.Init.SrcInc                         = DMA_SINC_FIXED;
+  node_conf.Init.DestInc                        = DMA_DINC_INCREMENTED;
+  node_conf.Init.SrcDataWidth                   = pConfig->DataWidth;
+  node_conf.Init.Priority                       = hdma->InitLinkedList.Priority;
+  node_conf.Init.SrcBurstLength                 = 1U;
+  node_conf.Init.DestBurstLength                = 1U;
+  node_conf.Init.TransferAllocatedPort          = DMA_SRC_ALLOCATED_PORT0 | DMA_DEST_ALLOCATED_PORT0;
+  node_conf.Init.TransferEventMode              = DMA_TCEM_BLOCK_TRANSFER;
+  node_conf.Init.Mode                           = DMA_NORMAL;
+  node_conf.DataHandlingConfig.DataExchange     = DMA_EXCHANGE_NONE;
+  node_conf.DataHandlingConfig.DataAlignment    = DMA_DATA_RIGHTALIGN_ZEROPADDED;
+  node_conf.TriggerConfig.TriggerPolarity       = pConfig->TriggerPolarity;
+  node_conf.TriggerConfig.TriggerMode           = DMA_TRIGM_SINGLE_BURST_TRANSFER;
+  node_conf.TriggerConfig.TriggerSelection      = pConfig->Trigger;
+  node_conf.SrcAddress                          = pConfig->SrcAddress;
+  node_conf.DstAddress                          = (uint32_t)pConfig->pBuffer;
+  node_conf.DataSize                            = pConfig->Length * data_size;
+#if defined (__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U)
+  node_conf.SrcSecure                           = DMA_CHANNEL_SRC_SEC;
+  node_conf.DestSecure                          = DMA_CHANNEL_DEST_SEC;
+#endif /* (__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U) */
+
+  /* Build the capture ring : a single node linked to itself */
+  status = HAL_DMAEx_List_ResetQ(pConfig->pQueue);
+
+  if (status == HAL_OK)
+  {
+    status = HAL_DMAEx_List_BuildNode(&node_conf, pConfig->pNode);
+  }
+  if (status == HAL_OK)
+  {
+    status = HAL_DMAEx_List_InsertNode_Tail(pConfig->pQueue, pConfig->pNode);
+  }
+  if (status == HAL_OK)
+  {
+    status = HAL_DMAEx_List_SetCircularMode(pConfig->pQueue);
+  }
+  if (status == HAL_OK)
+  {
+    status = HAL_DMAEx_List_LinkQ(hdma, pConfig->pQueue);
+  }
+  if (status == HAL_OK)
+  {
+    status = HAL_DMAEx_List_Start_IT(hdma);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Stop the capture started by HAL_DMAEx_EventCapture_Start().
+  * @param  hdma : Pointer to a DMA_HandleTypeDef structure that contains the configuration information for the
+  *                specified DMA Channel.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_DMAEx_EventCapture_Stop(DMA_HandleTypeDef *const hdma)
+{
+  /* Check the DMA peripheral handle */
+  if (hdma == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  if (HAL_DMA_Abort(hdma) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  return HAL_DMAEx_List_UnLinkQ(hdma);
+}
+
+/**
+  * @brief  Get the ring index of the next captured data.
+  * @param  hdma    : Pointer to a DMA_HandleTypeDef structure that contains the configuration information for the
+  *                   specified DMA Channel.
+  * @param  pConfig : Pointer to the DMA_EventCaptureConfTypeDef structure used to start the capture.
+  * @retval Index in range 0 to Length - 1, the data before it in the ring being captured.
+  */
+uint32_t HAL_DMAEx_EventCapture_GetIndex(DMA_HandleTypeDef const *const hdma,
+                                         DMA_EventCaptureConfTypeDef const *const pConfig)
+{
+  uint32_t data_size;
+  uint32_t remaining;
+
+  /* Check the DMA peripheral handle and the capture parameters */
+  if ((hdma == NULL) || (pConfig == NULL) || (pConfig->Length == 0U))
+  {
+    return 0U;
+  }
+
+  data_size = (pConfig->DataWidth == DMA_SRC_DATAWIDTH_BYTE) ? 1U :
+              ((pConfig->DataWidth == DMA_SRC_DATAWIDTH_HALFWORD) ? 2U : 4U);
+
+  /* Remaining data of the current ring lap */
+  remaining = (hdma->Instance->CBR1 & DMA_CBR1_BNDT) / data_size;
+
+  return (remaining >= pConfig->Length) ? 0U : (pConfig->Length - remaining);
+}
+/**
+  * @}
+  */
+
+/** @addtogroup DMAEx_Exported_Functions_Group11
+  *
+@verbatim
+  ======================================================================================================================
+                         ##### Pipeline Functions #####
+  ======================================================================================================================
+    [..]
+      This section provides functions allowing to :
+      (+) Start a peripheral to peripheral pipeline.
+      (+) Stop the pipeline.
+
+    [..]
+      (+) Each stage fills a buffer of two blocks from its source peripheral and drains it to its destination
+          peripheral. Each block transfer of the drain channel is triggered by the transfer complete event of the fill
+          channel (DMA_TRIGM_BLOCK_TRANSFER) : the stages run back to back without CPU handoff.
+
+      (+) The drain channel must empty a block before the fill channel completes the next one, the buffer does not
+          hold more than two blocks.
+
+      (+) The Parent field and the transfer callbacks of the channels are used by the pipeline. Only the transfer
+          complete interrupt of the last drain channel is enabled, to count the delivered blocks.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Start a peripheral to peripheral pipeline.
+  * @param  pPipeline : Pointer to a DMA_PipelineTypeDef structure that contains the pipeline configuration.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_DMAEx_Pipeline_Start(DMA_PipelineTypeDef *const pPipeline)
+{
+  DMA_PipelineStageTypeDef *pstage;
+  DMA_NodeConfTypeDef node_conf;
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t trigger;
+  uint32_t idx;
+
+  /* Check the pipeline parameters */
+  if ((pPipeline == NULL) || (pPipeline->pStages == NULL) || (pPipeline->StageNbr == 0U)
+      || (pPipeline->BlockSize == 0U) || (pPipeline->BlockSize > DMA_CBR1_BNDT))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the stages parameters */
+  for (idx = 0U; idx < pPipeline->StageNbr; idx++)
+  {
+    pstage = &pPipeline->pStages[idx];
+
+    assert_param(IS_DMA_REQUEST(pstage->SrcRequest));
+    assert_param(IS_DMA_REQUEST(pstage->DstRequest));
+    assert_param(IS_DMA_SOURCE_DATA_WIDTH(pstage->SrcDataWidth));
+    assert_param(IS_DMA_SOURCE_DATA_WIDTH(pstage->DstDataWidth));
+
+    if ((pstage->hdmaFill == NULL) || (pstage->hdmaDrain == NULL) || (pstage->pBuffer == NULL))
+    {
+      return HAL_ERROR;
+    }
+
+    if ((pstage->hdmaFill->Mode != DMA_LINKEDLIST_CIRCULAR) || (pstage->hdmaDrain->Mode != DMA_LINKEDLIST_CIRCULAR)
+        || (HAL_DMAEx_GetTransferCpltTrigger(pstage->hdmaFill, &trigger) != HAL_OK))
+    {
+      return HAL_ERROR;
+    }
+
+    if (((pPipeline->BlockSize % DMA_PIPELINE_DATA_SIZE(pstage->SrcDataWidth)) != 0U)
+        || ((pPipeline->BlockSize % DMA_PIPELINE_DATA_SIZE(pstage->DstDataWidth)) != 0U))
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  /* Prepare the nodes common configuration */
+  node_conf.NodeType                            = DMA_GPDMA_LINEAR_NODE;
+  node_conf.Init.BlkHWRequest                   = DMA_BREQ_SINGLE_BURST;
+  node_conf.Init.SrcBurstLength                 = 1U;
+  node_conf.Init.DestBurstLength                = 1U;
+  node_conf.Init.TransferAllocatedPort          = DMA_SRC_ALLOCATED_PORT0 | DMA_DEST_ALLOCATED_PORT0;
+  node_conf.Init.TransferEventMode              = DMA_TCEM_BLOCK_TRANSFER;
+  node_conf.Init.Mode                           = DMA_NORMAL;
+  node_conf.DataHandlingConfig.DataExchange     = DMA_EXCHANGE_NONE;
+  node_conf.DataHandlingConfig.DataAlignment    = DMA_DATA_RIGHTALIGN_ZEROPADDED;
+  node_conf.TriggerConfig.TriggerMode           = DMA_TRIGM_BLOCK_TRANSFER;
+  node_conf.DataSize                            = pPipeline->BlockSize;
+#if defined (__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U)
+  node_conf.SrcSecure                           = DMA_CHANNEL_SRC_SEC;
+  node_conf.DestSecure                          = DMA_CHANNEL_DEST_SEC;
+#endif /* (__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U) */
+
+  /* Build the rings of the stages */
+  for (idx = 0U; (idx < pPipeline->StageNbr) && (status == HAL_OK); idx++)
+  {
+    pstage = &pPipeline->pStages[idx];
+
+    /* Fill channel : source peripheral to the buffer halves, paced by the peripheral request */
+    node_conf.Init.Request                      = pstage->SrcRequest;
+    node_conf.Init.Direction                    = DMA_PERIPH_TO_MEMORY;
+    node_conf.Init.SrcInc                       = DMA_SINC_FIXED;
+    node_conf.Init.DestInc                      = DMA_DINC_INCREMENTED;
+    node_conf.Init.SrcDataWidth                 = pstage->SrcDataWidth;
+    node_conf.Init.DestDataWidth                = pstage->SrcDataWidth << DMA_CTR1_DDW_LOG2_Pos;
+    node_conf.Init.Priority                     = pstage->hdmaFill->InitLinkedList.Priority;
+    node_conf.TriggerConfig.TriggerPolarity     = DMA_TRIG_POLARITY_MASKED;
+    node_conf.TriggerConfig.TriggerSelection    = 0U;
+    node_conf.SrcAddress                        = pstage->SrcAddress;
+
+    status = DMA_Pipeline_LinkRing(pstage->hdmaFill, &pstage->FillQueue, pstage->FillNodes, &node_conf,
+                                   (uint32_t)pstage->pBuffer, pPipeline->BlockSize);
+
+    /* Drain channel : buffer halves to the destination peripheral, one block per fill block */
+    if (status == HAL_OK)
+    {
+      (void)HAL_DMAEx_GetTransferCpltTrigger(pstage->hdmaFill, &trigger);
+
+      node_conf.Init.Request                    = pstage->DstRequest;
+      node_conf.Init.Direction                  = DMA_MEMORY_TO_PERIPH;
+      node_conf.Init.SrcInc                     = DMA_SINC_INCREMENTED;
+      node_conf.Init.DestInc                    = DMA_DINC_FIXED;
+      node_conf.Init.SrcDataWidth               = pstage->DstDataWidth;
+      node_conf.Init.DestDataWidth              = pstage->DstDataWidth << DMA_CTR1_DDW_LOG2_Pos;
+      node_conf.Init.Priority                   = pstage->hdmaDrain->InitLinkedList.Priority;
+      node_conf.TriggerConfig.TriggerPolarity   = DMA_TRIG_POLARITY_RISING;
+      node_conf.TriggerConfig.TriggerSelection  = trigger;
+      node_conf.DstAddress                      = pstage->DstAddress;
+
+      status = DMA_Pipeline_LinkRing(pstage->hdmaDrain, &pstage->DrainQueue, pstage->DrainNodes, &node_conf,
+                                     (uint32_t)pstage->pBuffer, pPipeline->BlockSize);
+    }
+  }
+
+  /* Start the stages from the last one : each drain channel waits for the blocks of its fill channel */
+  pPipeline->BlockCount = 0U;
+  idx = pPipeline->StageNbr;
+  while ((idx > 0U) && (status == HAL_OK))
+  {
+    idx--;
+    pstage = &pPipeline->pStages[idx];
+
+    status = DMA_Pipeline_StartChannel(pPipeline, pstage->hdmaDrain, (idx == (pPipeline->StageNbr - 1U)) ? 1U : 0U);
+
+    if (status == HAL_OK)
+    {
+      status = DMA_Pipeline_StartChannel(pPipeline, pstage->hdmaFill, 0U);
+    }
+  }
+
+  if (status != HAL_OK)
+  {
+    (void)HAL_DMAEx_Pipeline_Stop(pPipeline);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Stop the pipeline started by HAL_DMAEx_Pipeline_Start().
+  * @param  pPipeline : Pointer to the DMA_PipelineTypeDef structure used to start the pipeline.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_DMAEx_Pipeline_Stop(DMA_PipelineTypeDef *const pPipeline)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  /* Check the pipeline parameters */
+  if ((pPipeline == NULL) || (pPipeline->pStages == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Stop the stages from the first one */
+  for (uint32_t idx = 0U; idx < pPipeline->StageNbr; idx++)
+  {
+    if (DMA_Pipeline_StopChannel(pPipeline->pStages[idx].hdmaFill) != HAL_OK)
+    {
+      status = HAL_ERROR;
+    }
+
+    if (DMA_Pipeline_StopChannel(pPipeline->pStages[idx].hdmaDrain) != HAL_OK)
+    {
+      status = HAL_ERROR;
+    }
+  }
+
+  return status;
+}
+/**
+  * @}
+  */
+/**
+  * @}
+  */
+
+/** @addtogroup DMAEx_Exported_Functions_Group12
+  *
+@verbatim
+  ======================================================================================================================
+                         ##### Bus Profiling Functions #####
+  ======================================================================================================================
+    [..]
+      This section provides functions allowing to :
+      (+) Measure the bandwidth and the bus contention of concurrent memory copies.
+
+    [..]
+      (+) Each traffic is first run alone, then all the traffics are started together : the DWT cycle counter gives
+          the duration of each copy in both cases. The slowdown of a copy is its concurrent duration in percent of its
+          duration alone.
+
+      (+) The CPU copy is run by words, the channels being checked every DMA_BUS_PROFILE_SLICE bytes : the end of a
+          channel transfer is detected with this granularity.
+
+      (+) The channels are used in polling mode, their interrupts are not needed.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Measure the bandwidth and the bus contention of concurrent memory copies.
+  * @param  pTraffic   : Pointer to an array of DMA_BusTrafficTypeDef structures describing the copies, filled with the
+  *                      measurements.
+  * @param  TrafficNbr : Number of copies, at most 32.
+  * @param  Timeout    : Timeout duration of each step in milliseconds.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_DMAEx_BusProfile(DMA_BusTrafficTypeDef *const pTraffic, uint32_t TrafficNbr, uint32_t Timeout)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  DMA_BusTrafficTypeDef *p_cpu = NULL;
+  DMA_BusTrafficTypeDef *p_traffic;
+  uint32_t pending = 0U;
+  uint32_t offset = 0U;
+  uint32_t slice;
+  uint32_t start;
+  uint32_t tickstart;
+
+  /* Check the traffics, only one of them run by CPU */
+  if ((pTraffic == NULL) || (TrafficNbr == 0U) || (TrafficNbr > DMA_BUS_PROFILE_MAX_NBR))
+  {
+    return HAL_ERROR;
+  }
+
+  for (uint32_t idx = 0U; idx < TrafficNbr; idx++)
+  {
+    p_traffic = &pTraffic[idx];
+
+    if (p_traffic->Size == 0U)
+    {
+      return HAL_ERROR;
+    }
+
+    if (p_traffic->hdma == NULL)
+    {
+      if ((p_cpu != NULL) || (((p_traffic->SrcAddress | p_traffic->DstAddress | p_traffic->Size) & 3U) != 0U))
+      {
+        return HAL_ERROR;
+      }
+      p_cpu = p_traffic;
+    }
+    else if (p_traffic->hdma->State != HAL_DMA_STATE_READY)
+    {
+      return HAL_BUSY;
+    }
+    else
+    {
+      /* Channel traffic */
+    }
+  }
+
+  /* Enable the DWT cycle counter used for time measurement */
+  HAL_CycleCounter_Enable();
+
+  /* Run each traffic alone */
+  for (uint32_t idx = 0U; (idx < TrafficNbr) && (status == HAL_OK); idx++)
+  {
+    p_traffic = &pTraffic[idx];
+    start = HAL_CycleCounter_Get();
+
+    if (p_traffic->hdma == NULL)
+    {
+      DMA_BusProfile_CpuCopy(p_traffic, 0U, p_traffic->Size);
+    }
+    else
+    {
+      status = HAL_DMA_Start(p_traffic->hdma, p_traffic->SrcAddress, p_traffic->DstAddress, p_traffic->Size);
+      if (status == HAL_OK)
+      {
+        status = HAL_DMA_PollForTransfer(p_traffic->hdma, HAL_DMA_FULL_TRANSFER, Timeout);
+      }
+    }
+
+    p_traffic->SoloCycles = HAL_CycleCounter_Get() - start;
+  }
+
+  if (status != HAL_OK)
+  {
+    return status;
+  }
+
+  /* Start all the channel traffics together */
+  start = HAL_CycleCounter_Get();
+  for (uint32_t idx = 0U; (idx < TrafficNbr) && (status == HAL_OK); idx++)
+  {
+    p_traffic = &pTraffic[idx];
+
+    if (p_traffic->hdma != NULL)
+    {
+      status = HAL_DMA_Start(p_traffic->hdma, p_traffic->SrcAddress, p_traffic->DstAddress, p_traffic->Size);
+      if (status == HAL_OK)
+      {
+        pending |= (1UL << idx);
+      }
+    }
+  }
+
+  /* Run the CPU traffic by slices and record the end of each traffic */
+  tickstart = HAL_GetTick();
+  while ((status == HAL_OK) && ((pending != 0U) || ((p_cpu != NULL) && (offset < p_cpu->Size))))
+  {
+    if ((p_cpu != NULL) && (offset < p_cpu->Size))
+    {
+      slice = ((p_cpu->Size - offset) < DMA_BUS_PROFILE_SLICE) ? (p_cpu->Size - offset) : DMA_BUS_PROFILE_SLICE;
+      DMA_BusProfile_CpuCopy(p_cpu, offset, slice);
+      offset += slice;
+
+      if (offset == p_cpu->Size)
+      {
+        p_cpu->SharedCycles = HAL_CycleCounter_Get() - start;
+      }
+    }
+
+    for (uint32_t idx = 0U; idx < TrafficNbr; idx++)
+    {
+      if (((pending & (1UL << idx)) != 0U) && ((pTraffic[idx].hdma->Instance->CSR & DMA_FLAG_IDLE) != 0U))
+      {
+        pTraffic[idx].SharedCycles = HAL_CycleCounter_Get() - start;
+        pending &= ~(1UL << idx);
+
+        /* Clear the flags, check the errors and release the channel */
+        status = HAL_DMA_PollForTransfer(pTraffic[idx].hdma, HAL_DMA_FULL_TRANSFER, 0U);
+        if (status != HAL_OK)
+        {
+          break;
+        }
+      }
+    }
+
+    if ((status == HAL_OK) && ((HAL_GetTick() - tickstart) > Timeout))
+    {
+      status = HAL_TIMEOUT;
+    }
+  }
+
+  /* Stop the channels still running on error */
+  for (uint32_t idx = 0U; idx < TrafficNbr; idx++)
+  {
+    if ((pending & (1UL << idx)) != 0U)
+    {
+      (void)HAL_DMA_Abort(pTraffic[idx].hdma);
+    }
+  }
+
+  if (status != HAL_OK)
+  {
+    return status;
+  }
+
+  /* Compute the bandwidth and the slowdown of each traffic */
+  for (uint32_t idx = 0U; idx < TrafficNbr; idx++)
+  {
+    p_traffic = &pTraffic[idx];
+
+    p_traffic->Bandwidth = (p_traffic->SharedCycles == 0U) ? 0U :
+                           (uint32_t)(((uint64_t)p_traffic->Size * SystemCoreClock) /
+                                      ((uint64_t)p_traffic->SharedCycles * 1000U));
+    p_traffic->Slowdown  = (p_traffic->SoloCycles == 0U) ? 0U :
+                           (uint32_t)(((uint64_t)p_traffic->SharedCycles * 100U) / p_traffic->SoloCycles);
+  }
+
+  return HAL_OK;
+}
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/* Private functions -------------------------------------------------------------------------------------------------*/
+/** @defgroup DMAEx_Private_Functions DMAEx Private Functions
+  * @brief    DMAEx Private Functions
+  * @{
   */
 
 /**
@@ -4748,6 +6389,9 @@ static void DMA_List_CleanQueue(DMA_QListTypeDef *const pQList)
   /* Clear head node */
   pQList->Head = NULL;
 
+  /* Clear tail node cache */
+  pQList->Tail = NULL;
+
   /* Clear first circular queue node */
   pQList->FirstCircularNode = NULL;
 
@@ -4763,6 +6407,318 @@ static void DMA_List_CleanQueue(DMA_QListTypeDef *const pQList)
   /* Reset queue type */
   pQList->Type = QUEUE_TYPE_STATIC;
 }
+
+/**
+  * @brief  Get the features of a DMA channel of the channel allocator table.
+  * @param  ChannelIdx : The channel index in the channel allocator table.
+  * @retval The channel features, combination of @ref DMAEx_Channel_Features.
+  */
+static uint32_t DMA_GetChannelFeatures(uint32_t ChannelIdx)
+{
+  uint32_t features;
+
+  /* Get the DMA instance of the channel */
+  if (ChannelIdx < DMA_CHANNEL_PER_INSTANCE)
+  {
+    features = DMA_CHANNEL_FEATURE_GPDMA1;
+  }
+  else
+  {
+    features = DMA_CHANNEL_FEATURE_GPDMA2;
+  }
+
+  /* Get the channel capabilities, the 2D addressing channels have the 32 bytes FIFO */
+  if (IS_DMA_2D_ADDRESSING_INSTANCE(DMA_ChannelTable[ChannelIdx]) != 0U)
+  {
+    features |= DMA_CHANNEL_FEATURE_2D_ADDR | DMA_CHANNEL_FEATURE_FIFO_32BYTES;
+  }
+
+  return features;
+}
+
+/**
+  * @brief  Configure the transfer parameters of a memory to memory DMA channel from the buffers alignment.
+  * @param  hdma       : Pointer to a DMA_HandleTypeDef structure that contains the configuration information for the
+  *                      specified DMA Channel.
+  * @param  SrcAddress : The source address.
+  * @param  DstAddress : The destination address.
+  * @param  Size       : The transfer size in bytes.
+  * @param  SrcInc     : The source increment mode.
+  * @retval HAL status.
+  */
+static HAL_StatusTypeDef DMA_MemConfig(DMA_HandleTypeDef *const hdma,
+                                       uint32_t SrcAddress,
+                                       uint32_t DstAddress,
+                                       uint32_t Size,
+                                       uint32_t SrcInc)
+{
+  uint32_t addr_alignment;
+  uint32_t alignment;
+  uint32_t burst_length = 1U;
+
+  /* Check the DMA peripheral handle and size parameters */
+  if ((hdma == NULL) || (Size == 0U) || ((Size & ~DMA_CBR1_BNDT) != 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the DMA channel mode and state */
+  if ((hdma->Mode != DMA_NORMAL) || (hdma->Init.Direction != DMA_MEMORY_TO_MEMORY) ||
+      (hdma->State != HAL_DMA_STATE_READY))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Select the widest data width allowed by the buffers alignment */
+  addr_alignment = DstAddress;
+  if (SrcInc == DMA_SINC_INCREMENTED)
+  {
+    addr_alignment |= SrcAddress;
+  }
+  alignment = addr_alignment | Size;
+
+  if ((alignment & 0x3U) == 0U)
+  {
+    hdma->Init.SrcDataWidth  = DMA_SRC_DATAWIDTH_WORD;
+    hdma->Init.DestDataWidth = DMA_DEST_DATAWIDTH_WORD;
+
+    /* Select the burst length filling the channel FIFO, bursts stay inside 1 KByte address boundaries */
+    burst_length = (IS_DMA_2D_ADDRESSING_INSTANCE(hdma->Instance) != 0U) ? 4U : 2U;
+    if ((addr_alignment & ((burst_length * 4U) - 1U)) != 0U)
+    {
+      burst_length = 1U;
+    }
+  }
+  else if ((alignment & 0x1U) == 0U)
+  {
+    hdma->Init.SrcDataWidth  = DMA_SRC_DATAWIDTH_HALFWORD;
+    hdma->Init.DestDataWidth = DMA_DEST_DATAWIDTH_HALFWORD;
+  }
+  else
+  {
+    hdma->Init.SrcDataWidth  = DMA_SRC_DATAWIDTH_BYTE;
+    hdma->Init.DestDataWidth = DMA_DEST_DATAWIDTH_BYTE;
+  }
+
+  hdma->Init.SrcInc          = SrcInc;
+  hdma->Init.DestInc         = DMA_DINC_INCREMENTED;
+  hdma->Init.SrcBurstLength  = burst_length;
+  hdma->Init.DestBurstLength = burst_length;
+
+  /* Update the DMA channel transfer register (CTR1) */
+  MODIFY_REG(hdma->Instance->CTR1,
+             (DMA_CTR1_SINC | DMA_CTR1_SDW_LOG2 | DMA_CTR1_SBL_1 | DMA_CTR1_DINC | DMA_CTR1_DDW_LOG2 | DMA_CTR1_DBL_1),
+             (hdma->Init.SrcInc | hdma->Init.SrcDataWidth | hdma->Init.DestInc | hdma->Init.DestDataWidth |
+              (((burst_length - 1U) << DMA_CTR1_SBL_1_Pos) & DMA_CTR1_SBL_1) |
+              (((burst_length - 1U) << DMA_CTR1_DBL_1_Pos) & DMA_CTR1_DBL_1)));
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Copy a small memory area by CPU.
+  * @param  pDst : The destination area address.
+  * @param  pSrc : The source area address.
+  * @param  Size : The area size in bytes.
+  * @retval None.
+  */
+static void DMA_CpuMemcpy(void *pDst, void const *pSrc, uint32_t Size)
+{
+  uint8_t *pdst = (uint8_t *)pDst;
+  uint8_t const *psrc = (uint8_t const *)pSrc;
+
+  for (uint32_t idx = 0U; idx < Size; idx++)
+  {
+    pdst[idx] = psrc[idx];
+  }
+}
+
+/**
+  * @brief  Set a small memory area by CPU.
+  * @param  pDst  : The destination area address.
+  * @param  Value : The byte value.
+  * @param  Size  : The area size in bytes.
+  * @retval None.
+  */
+static void DMA_CpuMemset(void *pDst, uint8_t Value, uint32_t Size)
+{
+  uint8_t *pdst = (uint8_t *)pDst;
+
+  for (uint32_t idx = 0U; idx < Size; idx++)
+  {
+    pdst[idx] = Value;
+  }
+}
+
+/**
+  * @brief  Build the two nodes ring of a pipeline channel and link it to the channel.
+  * @param  hdma          : Pointer to a DMA_HandleTypeDef structure that contains the configuration information for
+  *                         the specified DMA Channel.
+  * @param  pQList        : Pointer to the ring queue.
+  * @param  pNodes        : Pointer to the two ring nodes.
+  * @param  pNodeConfig   : Pointer to the node configuration, its memory address is set per buffer half.
+  * @param  BufferAddress : The intermediate buffer address.
+  * @param  BlockSize     : The block size in bytes.
+  * @retval HAL status.
+  */
+static HAL_StatusTypeDef DMA_Pipeline_LinkRing(DMA_HandleTypeDef *const hdma,
+                                               DMA_QListTypeDef *const pQList,
+                                               DMA_NodeTypeDef *const pNodes,
+                                               DMA_NodeConfTypeDef *const pNodeConfig,
+                                               uint32_t BufferAddress,
+                                               uint32_t BlockSize)
+{
+  HAL_StatusTypeDef status;
+
+  status = HAL_DMAEx_List_ResetQ(pQList);
+
+  for (uint32_t half = 0U; (half < 2U) && (status == HAL_OK); half++)
+  {
+    if (pNodeConfig->Init.Direction == DMA_PERIPH_TO_MEMORY)
+    {
+      pNodeConfig->DstAddress = BufferAddress + (half * BlockSize);
+    }
+    else
+    {
+      pNodeConfig->SrcAddress = BufferAddress + (half * BlockSize);
+    }
+
+    status = HAL_DMAEx_List_BuildNode(pNodeConfig, &pNodes[half]);
+
+    if (status == HAL_OK)
+    {
+      status = HAL_DMAEx_List_InsertNode_Tail(pQList, &pNodes[half]);
+    }
+  }
+
+  if (status == HAL_OK)
+  {
+    status = HAL_DMAEx_List_SetCircularMode(pQList);
+  }
+  if (status == HAL_OK)
+  {
+    status = HAL_DMAEx_List_LinkQ(hdma, pQList);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Start a pipeline channel.
+  * @param  pPipeline   : Pointer to the pipeline owning the channel.
+  * @param  hdma        : Pointer to a DMA_HandleTypeDef structure that contains the configuration information for the
+  *                       specified DMA Channel.
+  * @param  LastChannel : 1 for the drain channel of the last stage, counting the delivered blocks, 0 otherwise.
+  * @retval HAL status.
+  */
+static HAL_StatusTypeDef DMA_Pipeline_StartChannel(DMA_PipelineTypeDef *const pPipeline,
+                                                   DMA_HandleTypeDef *const hdma,
+                                                   uint32_t LastChannel)
+{
+  HAL_StatusTypeDef status;
+
+  hdma->Parent               = pPipeline;
+  hdma->XferCpltCallback     = (LastChannel != 0U) ? DMA_Pipeline_BlockCplt : NULL;
+  hdma->XferHalfCpltCallback = NULL;
+  hdma->XferErrorCallback    = DMA_Pipeline_Error;
+
+  status = HAL_DMAEx_List_Start_IT(hdma);
+
+  /* Only the errors interrupt the CPU on the other channels */
+  if ((status == HAL_OK) && (LastChannel == 0U))
+  {
+    __HAL_DMA_DISABLE_IT(hdma, DMA_IT_TC);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Stop a pipeline channel and unlink its ring.
+  * @param  hdma : Pointer to a DMA_HandleTypeDef structure that contains the configuration information for the
+  *                specified DMA Channel.
+  * @retval HAL status.
+  */
+static HAL_StatusTypeDef DMA_Pipeline_StopChannel(DMA_HandleTypeDef *const hdma)
+{
+  if (hdma == NULL)
+  {
+    return HAL_OK;
+  }
+
+  /* A channel stopped on error is already in ready state */
+  if (hdma->State == HAL_DMA_STATE_BUSY)
+  {
+    if (HAL_DMA_Abort(hdma) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  if (hdma->LinkedListQueue == NULL)
+  {
+    return HAL_OK;
+  }
+
+  return HAL_DMAEx_List_UnLinkQ(hdma);
+}
+
+/**
+  * @brief  Count the blocks delivered by the last stage of a pipeline.
+  * @param  hdma : Pointer to the drain channel handle of the last stage.
+  * @retval None.
+  */
+static void DMA_Pipeline_BlockCplt(DMA_HandleTypeDef *hdma)
+{
+  DMA_PipelineTypeDef *ppipeline = (DMA_PipelineTypeDef *)hdma->Parent;
+
+  ppipeline->BlockCount++;
+
+  if ((ppipeline->BlockNbr != 0U) && (ppipeline->BlockCount == ppipeline->BlockNbr))
+  {
+    (void)HAL_DMAEx_Pipeline_Stop(ppipeline);
+
+    if (ppipeline->XferCpltCallback != NULL)
+    {
+      ppipeline->XferCpltCallback(ppipeline);
+    }
+  }
+}
+
+/**
+  * @brief  Stop a pipeline on a channel error.
+  * @param  hdma : Pointer to the channel handle in error.
+  * @retval None.
+  */
+static void DMA_Pipeline_Error(DMA_HandleTypeDef *hdma)
+{
+  DMA_PipelineTypeDef *ppipeline = (DMA_PipelineTypeDef *)hdma->Parent;
+
+  (void)HAL_DMAEx_Pipeline_Stop(ppipeline);
+
+  if (ppipeline->XferErrorCallback != NULL)
+  {
+    ppipeline->XferErrorCallback(ppipeline);
+  }
+}
+
+/**
+  * @brief  Copy a slice of a CPU bus traffic by words.
+  * @param  pTraffic : Pointer to the CPU traffic.
+  * @param  Offset   : The slice offset in bytes, a multiple of 4.
+  * @param  Size     : The slice size in bytes, a multiple of 4.
+  * @retval None.
+  */
+static void DMA_BusProfile_CpuCopy(DMA_BusTrafficTypeDef const *const pTraffic, uint32_t Offset, uint32_t Size)
+{
+  __IO uint32_t *pdst = (__IO uint32_t *)(pTraffic->DstAddress + Offset);
+  __IO const uint32_t *psrc = (__IO const uint32_t *)(pTraffic->SrcAddress + Offset);
+
+  for (uint32_t idx = 0U; idx < (Size / 4U); idx++)
+  {
+    pdst[idx] = psrc[idx];
+  }
+}
 /**
   * @}
   */
@@ -115,6 +115,17 @@
 
       (+) Use HAL_DTS_Stop_IT() to disable and stop the DTS sensor in interrupt mode.
 
+      (+) Use HAL_DTS_Governor_Start() to scale the clocks with the temperature:
+
+          (++) Fill a DTS_GovernorTypeDef structure with clock profiles built by HAL_RCCEx_InitProfile(),
+               from the fastest to the slowest, and the temperature window.
+          (++) The fastest profile is applied, the DTS thresholds are set from the temperature window and the
+               sensor is started in interrupt mode.
+          (++) Above the high temperature the next slower profile is applied, below the low temperature the
+               next faster one, at most once per MinInterval. HAL_DTS_GovernorCallback() reports the new level.
+          (++) The DTS interrupt priority must be lower than the tick one, the profile switch using the tick.
+          (++) Use HAL_DTS_Governor_Stop() to stop the sensor, the applied profile being kept.
+
       (+) De-initialize the DTS using HAL_DTS_DeInit() function.
 
     *** Callback and interrupts ***
@@ -199,6 +210,16 @@
 /* Private macro -----------------------------------------------------------------------------------------------------*/
 /* Private variables -------------------------------------------------------------------------------------------------*/
 /* Private function prototypes ---------------------------------------------------------------------------------------*/
+/** @addtogroup DTS_Private_Functions
+  * @{
+  */
+static HAL_StatusTypeDef DTS_TemperatureToCount(const DTS_HandleTypeDef *hdts, int32_t Temperature, uint32_t *pCount);
+static HAL_StatusTypeDef DTS_GovernorSetWindow(DTS_HandleTypeDef *hdts);
+static void DTS_GovernorEvent(DTS_HandleTypeDef *hdts, uint32_t AboveHigh);
+/**
+  * @}
+  */
+
 /* Exported functions ------------------------------------------------------------------------------------------------*/
 /** @defgroup DTS_Exported_Functions DTS Exported Functions
   * @{
@@ -319,6 +340,8 @@ HAL_StatusTypeDef HAL_DTS_Init(DTS_HandleTypeDef *hdts)
   MODIFY_REG(hdts->Instance->ITR1, DTS_ITR1_TS1_HITTHD, (hdts->Init.HighThreshold << DTS_ITR1_TS1_HITTHD_Pos));
   MODIFY_REG(hdts->Instance->ITR1, DTS_ITR1_TS1_LITTHD, hdts->Init.LowThreshold);
 
+  hdts->pGovernor = NULL;
+
   /* Change the DTS state */
   hdts->State = HAL_DTS_STATE_READY;
 
@@ -890,6 +913,11 @@ void HAL_DTS_IRQHandler(DTS_HandleTypeDef *hdts)
   {
     __HAL_DTS_CLEAR_FLAG(hdts, DTS_FLAG_TS1_AITL);
 
+    if (hdts->pGovernor != NULL)
+    {
+      DTS_GovernorEvent(hdts, 0U);
+    }
+
 #if (USE_HAL_DTS_REGISTER_CALLBACKS == 1U)
     hdts->AsyncLowCallback(hdts);
 #else
@@ -902,6 +930,11 @@ void HAL_DTS_IRQHandler(DTS_HandleTypeDef *hdts)
   {
     __HAL_DTS_CLEAR_FLAG(hdts, DTS_FLAG_TS1_AITH);
 
+    if (hdts->pGovernor != NULL)
+    {
+      DTS_GovernorEvent(hdts, 1U);
+    }
+
 #if (USE_HAL_DTS_REGISTER_CALLBACKS == 1U)
     hdts->AsyncHighCallback(hdts);
 #else
@@ -926,6 +959,11 @@ void HAL_DTS_IRQHandler(DTS_HandleTypeDef *hdts)
   {
     __HAL_DTS_CLEAR_FLAG(hdts, DTS_FLAG_TS1_ITL);
 
+    if (hdts->pGovernor != NULL)
+    {
+      DTS_GovernorEvent(hdts, 0U);
+    }
+
 #if (USE_HAL_DTS_REGISTER_CALLBACKS == 1U)
     hdts->LowCallback(hdts);
 #else
@@ -938,6 +976,11 @@ void HAL_DTS_IRQHandler(DTS_HandleTypeDef *hdts)
   {
     __HAL_DTS_CLEAR_FLAG(hdts, DTS_FLAG_TS1_ITH);
 
+    if (hdts->pGovernor != NULL)
+    {
+      DTS_GovernorEvent(hdts, 1U);
+    }
+
 #if (USE_HAL_DTS_REGISTER_CALLBACKS == 1U)
     hdts->HighCallback(hdts);
 #else
@@ -1074,6 +1117,271 @@ HAL_DTS_StateTypeDef HAL_DTS_GetState(const DTS_HandleTypeDef *hdts)
   * @}
   */
 
+/** @defgroup DTS_Exported_Functions_Group4 Thermal Governor functions
+  *  @brief    Thermal Governor functions.
+  *
+@verbatim
+ =======================================================================================================================
+                                     ##### Thermal Governor functions #####
+ =======================================================================================================================
+    [..]
+    This subsection provides functions to step the system clocks down and up with the temperature.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Apply the fastest clock profile and start the DTS thermal governor.
+  * @param  hdts  DTS handle
+  * @param  pGovernor  Pointer to a DTS_GovernorTypeDef structure that contains the governor configuration,
+  *         kept by the driver until HAL_DTS_Governor_Stop().
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DTS_Governor_Start(DTS_HandleTypeDef *hdts, DTS_GovernorTypeDef *pGovernor)
+{
+  HAL_StatusTypeDef status;
+
+  /* Check the DTS handle and governor allocation */
+  if ((hdts == NULL) || (pGovernor == NULL) || (pGovernor->pProfiles == NULL) || (pGovernor->NbProfiles == 0UL) ||
+      (pGovernor->LowTemperature >= pGovernor->HighTemperature))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hdts->State != HAL_DTS_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  pGovernor->Level       = 0UL;
+  pGovernor->NbStepsDown = 0UL;
+  pGovernor->NbStepsUp   = 0UL;
+
+  if (HAL_RCCEx_SwitchProfile(&pGovernor->pProfiles[0]) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+  pGovernor->LastChange = HAL_GetTick();
+
+  hdts->pGovernor = pGovernor;
+
+  /* Thresholds of the temperature window */
+  status = DTS_GovernorSetWindow(hdts);
+
+  if (status == HAL_OK)
+  {
+    status = HAL_DTS_Start_IT(hdts);
+  }
+
+  if (status != HAL_OK)
+  {
+    hdts->pGovernor = NULL;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Stop the DTS thermal governor and the DTS sensor.
+  * @param  hdts  DTS handle
+  * @note   The applied clock profile is kept.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DTS_Governor_Stop(DTS_HandleTypeDef *hdts)
+{
+  /* Check the DTS handle allocation */
+  if (hdts == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  hdts->pGovernor = NULL;
+
+  return HAL_DTS_Stop_IT(hdts);
+}
+
+/**
+  * @brief  DTS thermal governor profile change callback.
+  * @param  hdts  DTS handle
+  * @param  Level  Index of the applied clock profile
+  * @retval None
+  */
+__weak void HAL_DTS_GovernorCallback(DTS_HandleTypeDef *hdts, uint32_t Level)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hdts);
+  UNUSED(Level);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+  the HAL_DTS_GovernorCallback should be implemented in the user file
+  */
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/** @defgroup DTS_Private_Functions DTS Private Functions
+  * @{
+  */
+
+/**
+  * @brief  Convert a temperature to the measured value compared to the DTS thresholds.
+  * @param  hdts  DTS handle
+  * @param  Temperature  Temperature in deg C
+  * @param  pCount  Measured value, saturated to the threshold range
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef DTS_TemperatureToCount(const DTS_HandleTypeDef *hdts, int32_t Temperature, uint32_t *pCount)
+{
+  uint32_t t0_temp;
+  uint32_t t0_freq;
+  uint32_t ramp_coeff;
+  uint32_t sampling = hdts->Init.SamplingTime >> DTS_CFGR1_TS1_SMP_TIME_Pos;
+  int32_t freq;
+  uint64_t count;
+
+  /* Read factory settings */
+  t0_temp = hdts->Instance->T0VALR1 >> DTS_T0VALR1_TS1_T0_Pos;
+
+  if (t0_temp == 0UL)
+  {
+    t0_temp = DTS_FACTORY_TEMPERATURE1; /* 30 deg C */
+  }
+  else if (t0_temp == 1UL)
+  {
+    t0_temp = DTS_FACTORY_TEMPERATURE2; /* 130 deg C */
+  }
+  else
+  {
+    return HAL_ERROR;
+  }
+
+  t0_freq = (hdts->Instance->T0VALR1 & DTS_T0VALR1_TS1_FMT0) * 100UL; /* Hz */
+
+  ramp_coeff = hdts->Instance->RAMPVALR & DTS_RAMPVALR_TS1_RAMP_COEFF; /* deg C/Hz */
+
+  /* Sensor frequency at the temperature */
+  freq = (int32_t)t0_freq + ((Temperature - (int32_t)t0_temp) * (int32_t)ramp_coeff);
+
+  if ((sampling == 0UL) || (freq <= 0))
+  {
+    return HAL_ERROR;
+  }
+
+  if ((hdts->Init.RefClock) == DTS_REFCLKSEL_LSE)
+  {
+    /* Number of sensor periods during the LSE sampling time */
+    count = ((uint64_t)freq * sampling) / LSE_VALUE;
+  }
+  else
+  {
+    /* Number of PCLK periods during the sensor sampling time */
+    count = ((uint64_t)HAL_RCC_GetPCLK1Freq() * sampling) / (uint32_t)freq;
+  }
+
+  *pCount = (count > 0xFFFFUL) ? 0xFFFFUL : (uint32_t)count;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Program the DTS thresholds from the governor temperature window.
+  * @param  hdts  DTS handle
+  * @note   No event is generated on the side of the window where there is no profile to move to.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef DTS_GovernorSetWindow(DTS_HandleTypeDef *hdts)
+{
+  const DTS_GovernorTypeDef *governor = hdts->pGovernor;
+  uint32_t hot;
+  uint32_t cold;
+  uint32_t high;
+  uint32_t low;
+
+  if ((DTS_TemperatureToCount(hdts, governor->HighTemperature, &hot) != HAL_OK) ||
+      (DTS_TemperatureToCount(hdts, governor->LowTemperature, &cold) != HAL_OK))
+  {
+    return HAL_ERROR;
+  }
+
+  if ((hdts->Init.RefClock) == DTS_REFCLKSEL_LSE)
+  {
+    /* The measured value rises with the temperature */
+    low  = (governor->Level == 0UL) ? 0UL : cold;
+    high = (governor->Level == (governor->NbProfiles - 1UL)) ? 0xFFFFUL : hot;
+  }
+  else
+  {
+    /* The measured value falls with the temperature */
+    low  = (governor->Level == (governor->NbProfiles - 1UL)) ? 0UL : hot;
+    high = (governor->Level == 0UL) ? 0xFFFFUL : cold;
+  }
+
+  MODIFY_REG(hdts->Instance->ITR1, DTS_ITR1_TS1_HITTHD, (high << DTS_ITR1_TS1_HITTHD_Pos));
+  MODIFY_REG(hdts->Instance->ITR1, DTS_ITR1_TS1_LITTHD, low);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Step the clock profile on a DTS threshold event.
+  * @param  hdts  DTS handle
+  * @param  AboveHigh  1 when the measured value is above the high threshold, 0 when below the low one
+  * @retval None
+  */
+static void DTS_GovernorEvent(DTS_HandleTypeDef *hdts, uint32_t AboveHigh)
+{
+  DTS_GovernorTypeDef *governor = hdts->pGovernor;
+  uint32_t level = governor->Level;
+  uint32_t hot;
+
+  if ((HAL_GetTick() - governor->LastChange) < governor->MinInterval)
+  {
+    return;
+  }
+
+  /* The measured value falls with the temperature when counted with PCLK */
+  hot = ((hdts->Init.RefClock) == DTS_REFCLKSEL_LSE) ? AboveHigh : (1UL - AboveHigh);
+
+  if ((hot != 0UL) && (level < (governor->NbProfiles - 1UL)))
+  {
+    level++;
+  }
+  else if ((hot == 0UL) && (level > 0UL))
+  {
+    level--;
+  }
+  else
+  {
+    return;
+  }
+
+  if (HAL_RCCEx_SwitchProfile(&governor->pProfiles[level]) == HAL_OK)
+  {
+    if (level > governor->Level)
+    {
+      governor->NbStepsDown++;
+    }
+    else
+    {
+      governor->NbStepsUp++;
+    }
+    governor->Level = level;
+    governor->LastChange = HAL_GetTick();
+
+    /* PCLK may have changed with the profile */
+    (void)DTS_GovernorSetWindow(hdts);
+
+    HAL_DTS_GovernorCallback(hdts, level);
+  }
+}
+
 /**
   * @}
   */
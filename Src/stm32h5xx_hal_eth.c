@@ -58,15 +58,51 @@
 
       (#) When data is received user can call the following API to get received data:
           (##) HAL_ETH_ReadData(): Read a received packet
+          (##) HAL_ETH_ReadDataBurst(): Read up to a given budget of received packets
+               and give the Rx descriptors back to the DMA in one pass
+          (##) HAL_ETH_GetRxFlow(): Get the L3/L4 filter flow of the last received packet, the Rx
+               buffers can be refilled from per flow pools with HAL_ETH_RegisterRxFlowAllocateCallback()
+          (##) HAL_ETH_SetRxCoalescing(): Use the DMA Rx watchdog timer to raise a single
+               Rx complete interrupt for a burst of received packets
+
+      (#) A reference fixed-size buffer pool avoids the heap allocations in the Rx and Tx callbacks:
+          (##) HAL_ETH_BufferPool_Init(): Split a static memory, e.g. placed with __SRAM1_BUFFER, into
+               cache line aligned buffers and register the pool Rx allocate, Rx link and Tx free callbacks
+          (##) HAL_ETH_ReadData() then returns the first ETH_PoolBufferTypeDef of the packet, chained by
+               pNext, to be given back with HAL_ETH_BufferPool_Free() once processed
+          (##) HAL_ETH_BufferPool_Alloc() gets a buffer to transmit, the ETH_PoolBufferTypeDef of the
+               packet is then passed in the pData field of ETH_TxPacketConfigTypeDef so that the
+               buffers are freed once transmitted
+          (##) The free list is updated with exclusive accesses: the pool can be used from the
+               interrupt and thread contexts without masking the interrupts
+          (##) When USE_HAL_ETH_REGISTER_CALLBACKS is 0, HAL_ETH_RxAllocateCallback(),
+               HAL_ETH_RxLinkCallback() and HAL_ETH_TxFreeCallback() must call the pool functions
+               HAL_ETH_BufferPool_RxAllocate(), HAL_ETH_BufferPool_RxLink() and HAL_ETH_BufferPool_TxFree()
+          (##) With a USB device, HAL_ETH_Bridge_Init() bridges the pool with an IN and an OUT endpoint:
+               HAL_ETH_Bridge_ToPCD() sends a packet returned by HAL_ETH_ReadData() from its Rx buffers,
+               and the packets received on the OUT endpoint are transmitted from the pool buffer they
+               were received in. HAL_PCD_DataInStageCallback() and HAL_PCD_DataOutStageCallback() must
+               call HAL_ETH_Bridge_PCDDataIn() and HAL_ETH_Bridge_PCDDataOut() for the bridge endpoints
 
       (#) For transmission path, two APIs are available:
          (##) HAL_ETH_Transmit(): Transmit an ETH frame in blocking mode
          (##) HAL_ETH_Transmit_IT(): Transmit an ETH frame in interrupt mode,
               HAL_ETH_TxCpltCallback() will be executed when end of transfer occur
+         (##) HAL_ETH_TransmitBatch_IT(): Queue several ETH frames in interrupt mode
+              with a single DMA tail pointer update, HAL_ETH_TxCpltCallback() will be
+              executed when the last frame of the batch is transmitted
 
       (#) Communication with an external PHY device:
          (##) HAL_ETH_ReadPHYRegister(): Read a register from an external PHY
          (##) HAL_ETH_WritePHYRegister(): Write data to an external RHY register
+         (##) HAL_ETH_MDIO_Submit(): Queue a batch of PHY register accesses, run in the
+              background by HAL_ETH_MDIO_Process(), HAL_ETH_MDIOCpltCallback() is executed
+              once the whole batch is complete
+         (##) HAL_ETH_MDIO_StartLinkMonitor(): Poll a PHY status register in the background
+              from HAL_ETH_MDIO_Process(), HAL_ETH_LinkChangeCallback() is executed when
+              the monitored bits change
+         (##) HAL_ETH_MDIO_Process(): Advance the MDIO transfers without waiting for the bus,
+              to be called periodically (e.g. from a timer or the idle task)
 
       (#) Configure the Ethernet MAC after ETH peripheral initialization
           (##) HAL_ETH_GetMACConfig(): Get MAC actual configuration into ETH_MACConfigTypeDef
@@ -87,6 +123,10 @@
           (##) HAL_ETH_PTP_InsertTxTimestamp(): Insert Timestamp in transmission
           (##) HAL_ETH_PTP_GetTxTimestamp(): Get transmission timestamp
           (##) HAL_ETH_PTP_GetRxTimestamp(): Get reception timestamp
+          (##) HAL_ETH_PTP_ReadDataBurst(): Read received packets along with their reception timestamp
+          (##) HAL_ETH_PTP_ReleaseTxPacket(): Release transmitted packets along with their transmission timestamp
+          (##) HAL_ETH_PTP_ServoInit(): Initialize the PTP clock servo
+          (##) HAL_ETH_PTP_ServoUpdate(): Correct the PTP clock from a measured offset to the master clock
 
       -@- The ARP offload feature is not supported in this driver.
 
@@ -106,6 +146,8 @@
     (+) PMTCallback      : Power Management Callback
     (+) EEECallback      : EEE Callback.
     (+) WakeUpCallback   : Wake UP Callback
+    (+) MDIOCpltCallback : MDIO Complete Callback.
+    (+) LinkChangeCallback: Link Change Callback.
     (+) MspInitCallback  : MspInit Callback.
     (+) MspDeInitCallback: MspDeInit Callback.
 
@@ -135,6 +177,8 @@
     (+) PMTCallback      : Power Management Callback
     (+) EEECallback      : EEE Callback.
     (+) WakeUpCallback   : Wake UP Callback
+    (+) MDIOCpltCallback : MDIO Complete Callback.
+    (+) LinkChangeCallback: Link Change Callback.
     (+) MspInitCallback  : MspInit Callback.
     (+) MspDeInitCallback: MspDeInit Callback.
 
@@ -247,6 +291,7 @@
 #define ETH_MACSTSUR_VALUE            0xFFFFFFFFU
 #define ETH_MACSTNUR_VALUE            0xBB9ACA00U
 #define ETH_SEGMENT_SIZE_DEFAULT      0x218U
+#define ETH_DESC_RING_MAX_CNT         1024U
 /**
   * @}
   */
@@ -256,18 +301,27 @@
   * @{
   */
 /* Helper macros for TX descriptor handling */
-#define INCR_TX_DESC_INDEX(inx, offset) do {\
-                                             (inx) += (offset);\
-                                             if ((inx) >= (uint32_t)ETH_TX_DESC_CNT){\
-                                             (inx) = ((inx) - (uint32_t)ETH_TX_DESC_CNT);}\
-                                           } while (0)
+#define INCR_TX_DESC_INDEX(inx, offset, cnt) do {\
+                                                  (inx) += (offset);\
+                                                  if ((inx) >= (uint32_t)(cnt)){\
+                                                  (inx) = ((inx) - (uint32_t)(cnt));}\
+                                                } while (0)
 
 /* Helper macros for RX descriptor handling */
-#define INCR_RX_DESC_INDEX(inx, offset) do {\
-                                             (inx) += (offset);\
-                                             if ((inx) >= (uint32_t)ETH_RX_DESC_CNT){\
-                                             (inx) = ((inx) - (uint32_t)ETH_RX_DESC_CNT);}\
-                                           } while (0)
+#define INCR_RX_DESC_INDEX(inx, offset, cnt) do {\
+                                                  (inx) += (offset);\
+                                                  if ((inx) >= (uint32_t)(cnt)){\
+                                                  (inx) = ((inx) - (uint32_t)(cnt));}\
+                                                } while (0)
+/**
+  * @}
+  */
+/* Private variables ---------------------------------------------------------*/
+/** @defgroup ETH_Private_Variables ETH Private Variables
+  * @{
+  */
+/* Pool used by the buffer pool callbacks, which have no handle parameter */
+static ETH_BufferPoolTypeDef *pETHBufferPool = NULL;
 /**
   * @}
   */
@@ -283,6 +337,13 @@ static void ETH_DMARxDescListInit(ETH_HandleTypeDef *heth);
 static uint32_t ETH_Prepare_Tx_Descriptors(ETH_HandleTypeDef *heth, const ETH_TxPacketConfigTypeDef *pTxConfig,
                                            uint32_t ItMode);
 static void ETH_UpdateDescriptor(ETH_HandleTypeDef *heth);
+static uint32_t ETH_GetRxPacket(ETH_HandleTypeDef *heth);
+static uint32_t ETH_ReleaseTxPackets(ETH_HandleTypeDef *heth, ETH_PacketRecordTypeDef *pRecords,
+                                     uint32_t MaxRecords);
+static void ETH_MDIO_StartTransfer(ETH_HandleTypeDef *heth, ETH_MDIOTransferTypeDef *pXfer);
+#if defined(HAL_PCD_MODULE_ENABLED) && defined(USB_DRD_FS)
+static void ETH_Bridge_ArmOut(ETH_PCDBridgeTypeDef *pBridge);
+#endif /* HAL_PCD_MODULE_ENABLED && USB_DRD_FS */
 
 #if (USE_HAL_ETH_REGISTER_CALLBACKS == 1)
 static void ETH_InitCallbacksToDefault(ETH_HandleTypeDef *heth);
@@ -318,8 +379,9 @@ static HAL_StatusTypeDef HAL_ETH_PTP_AddendUpdate(ETH_HandleTypeDef *heth, int32
           the selected configuration:
         (++) MAC address
         (++) Media interface (MII or RMII)
-        (++) Rx DMA Descriptors Tab
-        (++) Tx DMA Descriptors Tab
+        (++) Rx DMA Descriptors Tab and its depth (RxDescNbr)
+        (++) Tx DMA Descriptors Tab and its depth (TxDescNbr)
+        (++) Tx packet addresses array, mandatory when TxDescNbr exceeds ETH_TX_DESC_CNT
         (++) Length of Rx Buffers
 
       (+) Call the function HAL_ETH_DeInit() to restore the default configuration
@@ -428,6 +490,35 @@ HAL_StatusTypeDef HAL_ETH_Init(ETH_HandleTypeDef *heth)
     MODIFY_REG(heth->Instance->DMACRCR, ETH_DMACRCR_RBSZ, ((heth->Init.RxBuffLen) << 1));
   }
 
+  /* Set the descriptor rings depth, the default one being selected when not provided */
+  if (heth->Init.TxDescNbr == 0U)
+  {
+    heth->Init.TxDescNbr = ETH_TX_DESC_CNT;
+  }
+  if (heth->Init.RxDescNbr == 0U)
+  {
+    heth->Init.RxDescNbr = ETH_RX_DESC_CNT;
+  }
+
+  /* Check the rings depth against the DMA ring length field, the handle default
+     packet addresses array can only track up to ETH_TX_DESC_CNT descriptors */
+  if ((heth->Init.TxDescNbr > ETH_DESC_RING_MAX_CNT) || (heth->Init.RxDescNbr > ETH_DESC_RING_MAX_CNT)
+      || ((heth->Init.TxPacketAddress == NULL) && (heth->Init.TxDescNbr > ETH_TX_DESC_CNT)))
+  {
+    /* Set Error Code */
+    heth->ErrorCode = HAL_ETH_ERROR_PARAM;
+    /* Set State as Error */
+    heth->gState = HAL_ETH_STATE_ERROR;
+    /* Return Error */
+    return HAL_ERROR;
+  }
+
+  /* The descriptors are accessed by the Ethernet DMA */
+  assert_param(IS_HAL_MEM_REACHABLE(HAL_MEM_MASTER_ETH, heth->Init.TxDesc,
+                                    heth->Init.TxDescNbr * sizeof(ETH_DMADescTypeDef)));
+  assert_param(IS_HAL_MEM_REACHABLE(HAL_MEM_MASTER_ETH, heth->Init.RxDesc,
+                                    heth->Init.RxDescNbr * sizeof(ETH_DMADescTypeDef)));
+
   /*------------------ DMA Tx Descriptors Configuration ----------------------*/
   ETH_DMATxDescListInit(heth);
 
@@ -449,6 +540,17 @@ HAL_StatusTypeDef HAL_ETH_Init(ETH_HandleTypeDef *heth)
   SET_BIT(heth->Instance->MMCTIMR, ETH_MMCTIMR_TXLPITRCIM | ETH_MMCTIMR_TXLPIUSCIM | \
           ETH_MMCTIMR_TXGPKTIM | ETH_MMCTIMR_TXMCOLGPIM | ETH_MMCTIMR_TXSCOLGPIM);
 
+  heth->RxBuffUnavailableCnt = 0U;
+  heth->rxFlowAllocateCallback = NULL;
+  heth->pMDIOXfer = NULL;
+  heth->pMDIOXferActive = NULL;
+  heth->MDIOLinkMask = 0U;
+#if (USE_ETH_RX_LATENCY != 0U)
+  heth->RxIrqTimeStamp = 0U;
+  heth->RxLatencyMin = UINT32_MAX;
+  heth->RxLatencyMax = 0U;
+#endif /* USE_ETH_RX_LATENCY */
+
   heth->ErrorCode = HAL_ETH_ERROR_NONE;
   heth->gState = HAL_ETH_STATE_READY;
 
@@ -531,6 +633,8 @@ __weak void HAL_ETH_MspDeInit(ETH_HandleTypeDef *heth)
   *          @arg @ref HAL_ETH_PMT_CB_ID         Power Management Callback ID
   *          @arg @ref HAL_ETH_EEE_CB_ID         EEE Callback ID
   *          @arg @ref HAL_ETH_WAKEUP_CB_ID      Wake UP Callback ID
+  *          @arg @ref HAL_ETH_MDIO_COMPLETE_CB_ID MDIO Complete Callback ID
+  *          @arg @ref HAL_ETH_LINK_CHANGE_CB_ID Link Change Callback ID
   *          @arg @ref HAL_ETH_MSPINIT_CB_ID     MspInit callback ID
   *          @arg @ref HAL_ETH_MSPDEINIT_CB_ID   MspDeInit callback ID
   * @param pCallback pointer to the Callback function
@@ -576,6 +680,14 @@ HAL_StatusTypeDef HAL_ETH_RegisterCallback(ETH_HandleTypeDef *heth, HAL_ETH_Call
         heth->WakeUpCallback = pCallback;
         break;
 
+      case HAL_ETH_MDIO_COMPLETE_CB_ID :
+        heth->MDIOCpltCallback = pCallback;
+        break;
+
+      case HAL_ETH_LINK_CHANGE_CB_ID :
+        heth->LinkChangeCallback = pCallback;
+        break;
+
       case HAL_ETH_MSPINIT_CB_ID :
         heth->MspInitCallback = pCallback;
         break;
@@ -635,6 +747,8 @@ HAL_StatusTypeDef HAL_ETH_RegisterCallback(ETH_HandleTypeDef *heth, HAL_ETH_Call
   *          @arg @ref HAL_ETH_PMT_CB_ID         Power Management Callback ID
   *          @arg @ref HAL_ETH_EEE_CB_ID         EEE Callback ID
   *          @arg @ref HAL_ETH_WAKEUP_CB_ID      Wake UP Callback ID
+  *          @arg @ref HAL_ETH_MDIO_COMPLETE_CB_ID MDIO Complete Callback ID
+  *          @arg @ref HAL_ETH_LINK_CHANGE_CB_ID Link Change Callback ID
   *          @arg @ref HAL_ETH_MSPINIT_CB_ID     MspInit callback ID
   *          @arg @ref HAL_ETH_MSPDEINIT_CB_ID   MspDeInit callback ID
   * @retval status
@@ -671,6 +785,14 @@ HAL_StatusTypeDef HAL_ETH_UnRegisterCallback(ETH_HandleTypeDef *heth, HAL_ETH_Ca
         heth->WakeUpCallback = HAL_ETH_WakeUpCallback;
         break;
 
+      case HAL_ETH_MDIO_COMPLETE_CB_ID :
+        heth->MDIOCpltCallback = HAL_ETH_MDIOCpltCallback;
+        break;
+
+      case HAL_ETH_LINK_CHANGE_CB_ID :
+        heth->LinkChangeCallback = HAL_ETH_LinkChangeCallback;
+        break;
+
       case HAL_ETH_MSPINIT_CB_ID :
         heth->MspInitCallback = HAL_ETH_MspInit;
         break;
@@ -751,7 +873,7 @@ HAL_StatusTypeDef HAL_ETH_Start(ETH_HandleTypeDef *heth)
     heth->gState = HAL_ETH_STATE_BUSY;
 
     /* Set number of descriptors to build */
-    heth->RxDescList.RxBuildDescCnt = ETH_RX_DESC_CNT;
+    heth->RxDescList.RxBuildDescCnt = heth->Init.RxDescNbr;
 
     /* Build all descriptors */
     ETH_UpdateDescriptor(heth);
@@ -800,7 +922,7 @@ HAL_StatusTypeDef HAL_ETH_Start_IT(ETH_HandleTypeDef *heth)
     heth->RxDescList.ItMode = 1U;
 
     /* Set number of descriptors to build */
-    heth->RxDescList.RxBuildDescCnt = ETH_RX_DESC_CNT;
+    heth->RxDescList.RxBuildDescCnt = heth->Init.RxDescNbr;
 
     /* Build all descriptors */
     ETH_UpdateDescriptor(heth);
@@ -919,9 +1041,9 @@ HAL_StatusTypeDef HAL_ETH_Stop_IT(ETH_HandleTypeDef *heth)
     CLEAR_BIT(heth->Instance->MACCR, ETH_MACCR_TE);
 
     /* Clear IOC bit to all Rx descriptors */
-    for (descindex = 0; descindex < (uint32_t)ETH_RX_DESC_CNT; descindex++)
+    for (descindex = 0; descindex < heth->Init.RxDescNbr; descindex++)
     {
-      dmarxdesc = (ETH_DMADescTypeDef *)heth->RxDescList.RxDesc[descindex];
+      dmarxdesc = &heth->Init.RxDesc[descindex];
       CLEAR_BIT(dmarxdesc->DESC3, ETH_DMARXNDESCRF_IOC);
     }
 
@@ -970,14 +1092,14 @@ HAL_StatusTypeDef HAL_ETH_Transmit(ETH_HandleTypeDef *heth, ETH_TxPacketConfigTy
     /* Ensure completion of descriptor preparation before transmission start */
     __DSB();
 
-    dmatxdesc = (ETH_DMADescTypeDef *)(&heth->TxDescList)->TxDesc[heth->TxDescList.CurTxDesc];
+    dmatxdesc = &heth->Init.TxDesc[heth->TxDescList.CurTxDesc];
 
     /* Incr current tx desc index */
-    INCR_TX_DESC_INDEX(heth->TxDescList.CurTxDesc, 1U);
+    INCR_TX_DESC_INDEX(heth->TxDescList.CurTxDesc, 1U, heth->Init.TxDescNbr);
 
     /* Start transmission */
     /* issue a poll command to Tx DMA by writing address of next immediate free descriptor */
-    WRITE_REG(heth->Instance->DMACTDTPR, (uint32_t)(heth->TxDescList.TxDesc[heth->TxDescList.CurTxDesc]));
+    WRITE_REG(heth->Instance->DMACTDTPR, (uint32_t)(&heth->Init.TxDesc[heth->TxDescList.CurTxDesc]));
 
     tickstart = HAL_GetTick();
 
@@ -1045,11 +1167,11 @@ HAL_StatusTypeDef HAL_ETH_Transmit_IT(ETH_HandleTypeDef *heth, ETH_TxPacketConfi
     __DSB();
 
     /* Incr current tx desc index */
-    INCR_TX_DESC_INDEX(heth->TxDescList.CurTxDesc, 1U);
+    INCR_TX_DESC_INDEX(heth->TxDescList.CurTxDesc, 1U, heth->Init.TxDescNbr);
 
     /* Start transmission */
     /* issue a poll command to Tx DMA by writing address of next immediate free descriptor */
-    WRITE_REG(heth->Instance->DMACTDTPR, (uint32_t)(heth->TxDescList.TxDesc[heth->TxDescList.CurTxDesc]));
+    WRITE_REG(heth->Instance->DMACTDTPR, (uint32_t)(&heth->Init.TxDesc[heth->TxDescList.CurTxDesc]));
 
     return HAL_OK;
 
@@ -1060,6 +1182,85 @@ HAL_StatusTypeDef HAL_ETH_Transmit_IT(ETH_HandleTypeDef *heth, ETH_TxPacketConfi
   }
 }
 
+/**
+  * @brief  Sends a batch of Ethernet Packets in interrupt mode.
+  * @note   All packets are queued on the Tx descriptor ring before the DMA
+  *         tail pointer is written once, and only the last queued packet
+  *         requests an interrupt on completion. Transmitted packets are
+  *         then released in bulk through HAL_ETH_ReleaseTxPacket().
+  * @note   If the ring gets full before the whole batch is queued, the already
+  *         queued packets are transmitted and HAL_ERROR is returned with
+  *         HAL_ETH_ERROR_BUSY set in the error code.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pTxConfig: Array of PacketCount packet configurations to be transmitted
+  * @param  PacketCount: Number of packets in the pTxConfig array
+  * @param  pQueuedCount: Pointer to hold the number of packets actually queued
+  *         (can be NULL)
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_TransmitBatch_IT(ETH_HandleTypeDef *heth, ETH_TxPacketConfigTypeDef *pTxConfig,
+                                           uint32_t PacketCount, uint32_t *pQueuedCount)
+{
+  ETH_DMADescTypeDef *dmatxdesc;
+  uint32_t lastdescidx = 0U;
+  uint32_t queued = 0U;
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if ((pTxConfig == NULL) || (PacketCount == 0U))
+  {
+    heth->ErrorCode |= HAL_ETH_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  if (heth->gState != HAL_ETH_STATE_STARTED)
+  {
+    return HAL_ERROR;
+  }
+
+  while ((queued < PacketCount) && (status == HAL_OK))
+  {
+    /* Save the packet pointer to release.  */
+    heth->TxDescList.CurrentPacketAddress = (uint32_t *)pTxConfig[queued].pData;
+
+    /* Config DMA Tx descriptors without interrupt on completion */
+    if (ETH_Prepare_Tx_Descriptors(heth, &pTxConfig[queued], 0U) != HAL_ETH_ERROR_NONE)
+    {
+      heth->ErrorCode |= HAL_ETH_ERROR_BUSY;
+      status = HAL_ERROR;
+    }
+    else
+    {
+      /* Keep the last descriptor of this packet and incr current tx desc index */
+      lastdescidx = heth->TxDescList.CurTxDesc;
+      INCR_TX_DESC_INDEX(heth->TxDescList.CurTxDesc, 1U, heth->Init.TxDescNbr);
+      queued++;
+    }
+  }
+
+  if (queued != 0U)
+  {
+    /* Request a single Tx complete interrupt for the whole batch: the DMA does not
+       fetch this descriptor before the tail pointer is updated below */
+    dmatxdesc = &heth->Init.TxDesc[lastdescidx];
+    SET_BIT(dmatxdesc->DESC2, ETH_DMATXNDESCRF_IOC);
+
+    /* Ensure completion of descriptor preparation before transmission start */
+    __DSB();
+
+    /* Start transmission */
+    /* issue a single poll command to Tx DMA for all the queued packets */
+    WRITE_REG(heth->Instance->DMACTDTPR, (uint32_t)(&heth->Init.TxDesc[heth->TxDescList.CurTxDesc]));
+  }
+
+  if (pQueuedCount != NULL)
+  {
+    *pQueuedCount = queued;
+  }
+
+  return status;
+}
+
 /**
   * @brief  Read a received packet.
   * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
@@ -1069,14 +1270,7 @@ HAL_StatusTypeDef HAL_ETH_Transmit_IT(ETH_HandleTypeDef *heth, ETH_TxPacketConfi
   */
 HAL_StatusTypeDef HAL_ETH_ReadData(ETH_HandleTypeDef *heth, void **pAppBuff)
 {
-  uint32_t descidx;
-  uint32_t descidx_next;
-  ETH_DMADescTypeDef *dmarxdesc_next;
-  ETH_DMADescTypeDef *dmarxdesc;
-  uint32_t desccnt = 0U;
-  uint32_t desccntmax;
-  uint32_t bufflength;
-  uint8_t rxdataready = 0U;
+  uint32_t rxdataready;
 
   if (pAppBuff == NULL)
   {
@@ -1089,9 +1283,140 @@ HAL_StatusTypeDef HAL_ETH_ReadData(ETH_HandleTypeDef *heth, void **pAppBuff)
     return HAL_ERROR;
   }
 
+  rxdataready = ETH_GetRxPacket(heth);
+
+  if ((heth->RxDescList.RxBuildDescCnt) != 0U)
+  {
+    /* Update Descriptors */
+    ETH_UpdateDescriptor(heth);
+  }
+
+  if (rxdataready == 1U)
+  {
+    /* Return received packet */
+    *pAppBuff = heth->RxDescList.pRxStart;
+    /* Reset first element */
+    heth->RxDescList.pRxStart = NULL;
+
+    return HAL_OK;
+  }
+
+  /* Packet not ready */
+  return HAL_ERROR;
+}
+
+/**
+  * @brief  Read up to Budget received packets in one pass.
+  * @note   Each received packet is handed over to RxPacketCallback as soon as
+  *         it is complete, and the used Rx descriptors are refilled through the
+  *         RxAllocateCallback only once, after the last packet of the burst.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  Budget: Maximum number of packets to read
+  * @param  RxPacketCallback: pointer to function receiving each packet
+  * @param  pPacketCount: Pointer to hold the number of packets read (can be NULL)
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_ReadDataBurst(ETH_HandleTypeDef *heth, uint32_t Budget,
+                                        pETH_rxPacketCallbackTypeDef RxPacketCallback, uint32_t *pPacketCount)
+{
+  void *appbuff;
+  uint32_t rxcount = 0U;
+
+  if ((RxPacketCallback == NULL) || (Budget == 0U))
+  {
+    heth->ErrorCode |= HAL_ETH_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  if (heth->gState != HAL_ETH_STATE_STARTED)
+  {
+    return HAL_ERROR;
+  }
+
+  while ((rxcount < Budget) && (ETH_GetRxPacket(heth) == 1U))
+  {
+    appbuff = heth->RxDescList.pRxStart;
+    /* Reset first element */
+    heth->RxDescList.pRxStart = NULL;
+
+    /* Return received packet */
+    RxPacketCallback(appbuff);
+    rxcount++;
+  }
+
+  if ((heth->RxDescList.RxBuildDescCnt) != 0U)
+  {
+    /* Update all the released descriptors at once */
+    ETH_UpdateDescriptor(heth);
+  }
+
+  if (pPacketCount != NULL)
+  {
+    *pPacketCount = rxcount;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Enable or disable the Rx interrupt coalescing.
+  * @note   When enabled, Rx descriptors are built without the interrupt on
+  *         completion bit and the Rx complete interrupt is raised by the DMA Rx
+  *         watchdog timer once it expires after the last received packet.
+  *         The new setting applies to the descriptors built after this call,
+  *         it should preferably be set before HAL_ETH_Start_IT().
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  WatchdogCount: Rx watchdog timeout in units of 256 AHB clock cycles.
+  *         This parameter can be a value from 0x1 to 0xFF, 0 disables the coalescing
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_SetRxCoalescing(ETH_HandleTypeDef *heth, uint32_t WatchdogCount)
+{
+  if (WatchdogCount > 0xFFU)
+  {
+    heth->ErrorCode |= HAL_ETH_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  if ((heth->gState != HAL_ETH_STATE_READY) && (heth->gState != HAL_ETH_STATE_STARTED))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Program the Rx interrupt watchdog timer */
+  WRITE_REG(heth->Instance->DMACRIWTR, WatchdogCount);
+
+  heth->RxDescList.RxIntWatchdog = WatchdogCount;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Process the Rx descriptors released by the DMA up to the end of
+  *         the next received packet, without giving them back to the DMA.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @retval 1 if a complete packet is available in RxDescList.pRxStart, 0 otherwise
+  */
+static uint32_t ETH_GetRxPacket(ETH_HandleTypeDef *heth)
+{
+  uint32_t descidx;
+  uint32_t descidx_next;
+  ETH_DMADescTypeDef *dmarxdesc_next;
+  ETH_DMADescTypeDef *dmarxdesc;
+  uint32_t desccnt = 0U;
+  uint32_t desccntmax;
+  uint32_t bufflength;
+  uint32_t rxdataready = 0U;
+#if (USE_ETH_RX_LATENCY != 0U)
+  uint32_t latency;
+#endif /* USE_ETH_RX_LATENCY */
+
   descidx = heth->RxDescList.RxDescIdx;
-  dmarxdesc = (ETH_DMADescTypeDef *)heth->RxDescList.RxDesc[descidx];
-  desccntmax = ETH_RX_DESC_CNT - heth->RxDescList.RxBuildDescCnt;
+  dmarxdesc = &heth->Init.RxDesc[descidx];
+  desccntmax = heth->Init.RxDescNbr - heth->RxDescList.RxBuildDescCnt;
 
   /* Check if descriptor is not owned by DMA */
   while ((READ_BIT(dmarxdesc->DESC3, ETH_DMARXNDESCWBF_OWN) == (uint32_t)RESET) && (desccnt < desccntmax)
@@ -1105,6 +1430,9 @@ HAL_StatusTypeDef HAL_ETH_ReadData(ETH_HandleTypeDef *heth, void **pAppBuff)
       {
         heth->RxDescList.RxDescCnt = 0;
         heth->RxDescList.RxDataLength = 0;
+        /* No timestamp until the context descriptor of this packet is found */
+        heth->RxDescList.TimeStamp.TimeStampHigh = UINT32_MAX;
+        heth->RxDescList.TimeStamp.TimeStampLow = UINT32_MAX;
       }
 
       /* Get the Frame Length of the received packet */
@@ -1119,12 +1447,35 @@ HAL_StatusTypeDef HAL_ETH_ReadData(ETH_HandleTypeDef *heth, void **pAppBuff)
         /* Packet ready */
         rxdataready = 1;
 
+        /* Classify the packet from the L3/L4 filter match status */
+        if (READ_BIT(dmarxdesc->DESC2, ETH_DMARXNDESCWBF_L3FM | ETH_DMARXNDESCWBF_L4FM) == 0U)
+        {
+          heth->RxDescList.RxFlow = ETH_RX_FLOW_DEFAULT;
+        }
+        else if (READ_BIT(dmarxdesc->DESC2, ETH_DMARXNDESCWBF_L3L4FM) == 0U)
+        {
+          heth->RxDescList.RxFlow = ETH_RX_FLOW_FILTER0;
+        }
+        else
+        {
+          heth->RxDescList.RxFlow = ETH_RX_FLOW_FILTER1;
+        }
+
+        /* Tag all the descriptors of the packet so that their buffers are refilled from the flow pool */
+        descidx_next = (heth->Init.RxDescNbr + descidx - heth->RxDescList.RxDescCnt) % heth->Init.RxDescNbr;
+        while (descidx_next != descidx)
+        {
+          WRITE_REG(heth->Init.RxDesc[descidx_next].BackupAddr1, heth->RxDescList.RxFlow);
+          INCR_RX_DESC_INDEX(descidx_next, 1U, heth->Init.RxDescNbr);
+        }
+        WRITE_REG(dmarxdesc->BackupAddr1, heth->RxDescList.RxFlow);
+
         if (READ_BIT(dmarxdesc->DESC1, ETH_DMARXNDESCWBF_TSA) != (uint32_t)RESET)
         {
           descidx_next = descidx;
-          INCR_RX_DESC_INDEX(descidx_next, 1U);
+          INCR_RX_DESC_INDEX(descidx_next, 1U, heth->Init.RxDescNbr);
 
-          dmarxdesc_next = (ETH_DMADescTypeDef *)heth->RxDescList.RxDesc[descidx_next];
+          dmarxdesc_next = &heth->Init.RxDesc[descidx_next];
 
           if (READ_BIT(dmarxdesc_next->DESC3, ETH_DMARXNDESCWBF_CTXT) != (uint32_t)RESET)
           {
@@ -1154,33 +1505,33 @@ HAL_StatusTypeDef HAL_ETH_ReadData(ETH_HandleTypeDef *heth, void **pAppBuff)
     }
 
     /* Increment current rx descriptor index */
-    INCR_RX_DESC_INDEX(descidx, 1U);
+    INCR_RX_DESC_INDEX(descidx, 1U, heth->Init.RxDescNbr);
     /* Get current descriptor address */
-    dmarxdesc = (ETH_DMADescTypeDef *)heth->RxDescList.RxDesc[descidx];
+    dmarxdesc = &heth->Init.RxDesc[descidx];
     desccnt++;
   }
 
   heth->RxDescList.RxBuildDescCnt += desccnt;
-  if ((heth->RxDescList.RxBuildDescCnt) != 0U)
-  {
-    /* Update Descriptors */
-    ETH_UpdateDescriptor(heth);
-  }
-
   heth->RxDescList.RxDescIdx = descidx;
 
-  if (rxdataready == 1U)
+#if (USE_ETH_RX_LATENCY != 0U)
+  if ((rxdataready == 1U) && (heth->RxIrqTimeStamp != 0U))
   {
-    /* Return received packet */
-    *pAppBuff = heth->RxDescList.pRxStart;
-    /* Reset first element */
-    heth->RxDescList.pRxStart = NULL;
+    latency = DWT->CYCCNT - heth->RxIrqTimeStamp;
+    heth->RxIrqTimeStamp = 0U;
 
-    return HAL_OK;
+    if (latency < heth->RxLatencyMin)
+    {
+      heth->RxLatencyMin = latency;
+    }
+    if (latency > heth->RxLatencyMax)
+    {
+      heth->RxLatencyMax = latency;
+    }
   }
+#endif /* USE_ETH_RX_LATENCY */
 
-  /* Packet not ready */
-  return HAL_ERROR;
+  return rxdataready;
 }
 
 /**
@@ -1201,7 +1552,7 @@ static void ETH_UpdateDescriptor(ETH_HandleTypeDef *heth)
   uint8_t allocStatus = 1U;
 
   descidx = heth->RxDescList.RxBuildDescIdx;
-  dmarxdesc = (ETH_DMADescTypeDef *)heth->RxDescList.RxDesc[descidx];
+  dmarxdesc = &heth->Init.RxDesc[descidx];
   desccount = heth->RxDescList.RxBuildDescCnt;
 
   while ((desccount > 0U) && (allocStatus != 0U))
@@ -1210,13 +1561,21 @@ static void ETH_UpdateDescriptor(ETH_HandleTypeDef *heth)
     if (READ_REG(dmarxdesc->BackupAddr0) == 0U)
     {
       /* Get a new buffer. */
+      if (heth->rxFlowAllocateCallback != NULL)
+      {
+        /* Refill from the pool of the flow which consumed the previous buffer */
+        heth->rxFlowAllocateCallback(&buff, READ_REG(dmarxdesc->BackupAddr1));
+      }
+      else
+      {
 #if (USE_HAL_ETH_REGISTER_CALLBACKS == 1)
-      /*Call registered Allocate callback*/
-      heth->rxAllocateCallback(&buff);
+        /*Call registered Allocate callback*/
+        heth->rxAllocateCallback(&buff);
 #else
-      /* Allocate callback */
-      HAL_ETH_RxAllocateCallback(&buff);
+        /* Allocate callback */
+        HAL_ETH_RxAllocateCallback(&buff);
 #endif  /* USE_HAL_ETH_REGISTER_CALLBACKS */
+      }
       if (buff == NULL)
       {
         allocStatus = 0U;
@@ -1236,7 +1595,7 @@ static void ETH_UpdateDescriptor(ETH_HandleTypeDef *heth)
     if (allocStatus != 0U)
     {
 
-      if (heth->RxDescList.ItMode != 0U)
+      if ((heth->RxDescList.ItMode != 0U) && (heth->RxDescList.RxIntWatchdog == 0U))
       {
         WRITE_REG(dmarxdesc->DESC3, ETH_DMARXNDESCRF_OWN | ETH_DMARXNDESCRF_BUF1V | ETH_DMARXNDESCRF_IOC);
       }
@@ -1246,9 +1605,9 @@ static void ETH_UpdateDescriptor(ETH_HandleTypeDef *heth)
       }
 
       /* Increment current rx descriptor index */
-      INCR_RX_DESC_INDEX(descidx, 1U);
+      INCR_RX_DESC_INDEX(descidx, 1U, heth->Init.RxDescNbr);
       /* Get current descriptor address */
-      dmarxdesc = (ETH_DMADescTypeDef *)heth->RxDescList.RxDesc[descidx];
+      dmarxdesc = &heth->Init.RxDesc[descidx];
       desccount--;
     }
   }
@@ -1256,7 +1615,7 @@ static void ETH_UpdateDescriptor(ETH_HandleTypeDef *heth)
   if (heth->RxDescList.RxBuildDescCnt != desccount)
   {
     /* Set the tail pointer index */
-    tailidx = (ETH_RX_DESC_CNT + descidx - 1U) % ETH_RX_DESC_CNT;
+    tailidx = (heth->Init.RxDescNbr + descidx - 1U) % heth->Init.RxDescNbr;
 
     /* DMB instruction to avoid race condition */
     __DMB();
@@ -1389,6 +1748,62 @@ HAL_StatusTypeDef HAL_ETH_GetRxDataErrorCode(const ETH_HandleTypeDef *heth, uint
   return HAL_OK;
 }
 
+/**
+  * @brief  Get the flow of the last received packet.
+  * @note   The flow is given by the L3/L4 filter matched by the packet, it can be
+  *         used to dispatch high priority flows before the bulk traffic.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pFlow: pointer to uint32_t to hold the flow, a value of @ref ETH_Rx_Flow
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_GetRxFlow(const ETH_HandleTypeDef *heth, uint32_t *pFlow)
+{
+  *pFlow = heth->RxDescList.RxFlow;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Register the Rx per flow alloc callback.
+  * @note   Once registered, this callback replaces the Rx alloc callback: each Rx
+  *         buffer handed over to the application is replaced by a buffer taken
+  *         from the pool of the flow of its packet, so that a bulk flow running
+  *         out of buffers does not consume the buffers of the other flows.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  rxFlowAllocateCallback: pointer to function to alloc buffer from a flow pool
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_RegisterRxFlowAllocateCallback(ETH_HandleTypeDef *heth,
+                                                         pETH_rxFlowAllocateCallbackTypeDef rxFlowAllocateCallback)
+{
+  if (rxFlowAllocateCallback == NULL)
+  {
+    /* No buffer to save */
+    return HAL_ERROR;
+  }
+
+  /* Set function to allocate buffer per flow */
+  heth->rxFlowAllocateCallback = rxFlowAllocateCallback;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Unregister the Rx per flow alloc callback.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_UnRegisterRxFlowAllocateCallback(ETH_HandleTypeDef *heth)
+{
+  /* Back to the Rx alloc callback */
+  heth->rxFlowAllocateCallback = NULL;
+
+  return HAL_OK;
+}
+
 /**
   * @brief  Set the Tx free function.
   * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
@@ -1446,94 +1861,386 @@ __weak void HAL_ETH_TxFreeCallback(uint32_t *buff)
   */
 HAL_StatusTypeDef HAL_ETH_ReleaseTxPacket(ETH_HandleTypeDef *heth)
 {
-  ETH_TxDescListTypeDef *dmatxdesclist = &heth->TxDescList;
-  uint32_t numOfBuf =  dmatxdesclist->BuffersInUse;
-  uint32_t idx =       dmatxdesclist->releaseIndex;
-  uint8_t pktTxStatus = 1U;
-  uint8_t pktInUse;
-#ifdef HAL_ETH_USE_PTP
-  ETH_TimeStampTypeDef *timestamp = &heth->TxTimestamp;
-#endif /* HAL_ETH_USE_PTP */
+  (void)ETH_ReleaseTxPackets(heth, NULL, 0U);
 
-  /* Loop through buffers in use.  */
-  while ((numOfBuf != 0U) && (pktTxStatus != 0U))
-  {
-    pktInUse = 1U;
-    numOfBuf--;
-    /* If no packet, just examine the next packet.  */
-    if (dmatxdesclist->PacketAddress[idx] == NULL)
-    {
-      /* No packet in use, skip to next.  */
-      INCR_TX_DESC_INDEX(idx, 1U);
-      pktInUse = 0U;
-    }
+  return HAL_OK;
+}
 
-    if (pktInUse != 0U)
-    {
-      /* Determine if the packet has been transmitted.  */
-      if ((heth->Init.TxDesc[idx].DESC3 & ETH_DMATXNDESCRF_OWN) == 0U)
-      {
-#ifdef HAL_ETH_USE_PTP
+/**
+  * @brief  Initialize the buffer pool and register its Rx allocate, Rx link and Tx free callbacks.
+  * @note   A single pool is used by the callbacks, the last initialized one.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pPool: pointer to the pool structure, which must stay valid
+  * @param  pMemory: Pool memory of ETH_BUFFER_POOL_SIZE(BufferSize, BufferNbr) bytes,
+  *         aligned on ETH_BUFFER_POOL_ALIGN
+  * @param  BufferSize: Data size of each buffer, multiple of ETH_BUFFER_POOL_ALIGN
+  *         and at least the Rx buffers length
+  * @param  BufferNbr: Number of buffers of the pool
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_BufferPool_Init(ETH_HandleTypeDef *heth, ETH_BufferPoolTypeDef *pPool, uint8_t *pMemory,
+                                          uint32_t BufferSize, uint32_t BufferNbr)
+{
+  ETH_PoolBufferTypeDef *pbuffer;
+  uint32_t address;
+  uint32_t index;
 
-        /* Disable Ptp transmission */
-        CLEAR_BIT(heth->Init.TxDesc[idx].DESC2, ETH_DMATXNDESCRF_TTSE);
+  if ((pPool == NULL) || (pMemory == NULL) || (BufferNbr == 0U) || (BufferSize < heth->Init.RxBuffLen)
+      || ((BufferSize % ETH_BUFFER_POOL_ALIGN) != 0U) || (((uint32_t)pMemory % ETH_BUFFER_POOL_ALIGN) != 0U))
+  {
+    heth->ErrorCode |= HAL_ETH_ERROR_PARAM;
+    return HAL_ERROR;
+  }
 
-        if ((heth->Init.TxDesc[idx].DESC3 & ETH_DMATXNDESCWBF_LD)
-            && (heth->Init.TxDesc[idx].DESC3 & ETH_DMATXNDESCWBF_TTSS))
-        {
-          /* Get timestamp low */
-          timestamp->TimeStampLow = heth->Init.TxDesc[idx].DESC0;
-          /* Get timestamp high */
-          timestamp->TimeStampHigh = heth->Init.TxDesc[idx].DESC1;
-        }
-        else
-        {
-          timestamp->TimeStampHigh = timestamp->TimeStampLow = UINT32_MAX;
-        }
-#endif /* HAL_ETH_USE_PTP */
+  pPool->pMemory = pMemory;
+  pPool->BufferSize = BufferSize;
+  pPool->BufferNbr = BufferNbr;
 
-#if (USE_HAL_ETH_REGISTER_CALLBACKS == 1)
-        /*Call registered callbacks*/
-#ifdef HAL_ETH_USE_PTP
-        /* Handle Ptp  */
-        if (timestamp->TimeStampHigh != UINT32_MAX && timestamp->TimeStampLow != UINT32_MAX)
-        {
-          heth->txPtpCallback(dmatxdesclist->PacketAddress[idx], timestamp);
-        }
-#endif  /* HAL_ETH_USE_PTP */
-        /* Release the packet.  */
-        heth->txFreeCallback(dmatxdesclist->PacketAddress[idx]);
-#else
-        /* Call callbacks */
-#ifdef HAL_ETH_USE_PTP
-        /* Handle Ptp  */
-        if (timestamp->TimeStampHigh != UINT32_MAX && timestamp->TimeStampLow != UINT32_MAX)
-        {
-          HAL_ETH_TxPtpCallback(dmatxdesclist->PacketAddress[idx], timestamp);
-        }
-#endif  /* HAL_ETH_USE_PTP */
-        /* Release the packet.  */
-        HAL_ETH_TxFreeCallback(dmatxdesclist->PacketAddress[idx]);
-#endif  /* USE_HAL_ETH_REGISTER_CALLBACKS */
+  /* Chain all the buffers in the free list, the last one first */
+  pPool->FreeList = 0U;
+  for (index = BufferNbr; index > 0U; index--)
+  {
+    address = (uint32_t)pMemory + ((index - 1U) * (ETH_BUFFER_POOL_HEADER_SIZE + BufferSize));
+    pbuffer = (ETH_PoolBufferTypeDef *)address;
+    pbuffer->pData = (uint8_t *)(address + ETH_BUFFER_POOL_HEADER_SIZE);
+    pbuffer->Length = 0U;
+    pbuffer->pNext = (ETH_PoolBufferTypeDef *)pPool->FreeList;
+    pPool->FreeList = address;
+  }
 
-        /* Clear the entry in the in-use array.  */
-        dmatxdesclist->PacketAddress[idx] = NULL;
+  pETHBufferPool = pPool;
 
-        /* Update the transmit relesae index and number of buffers in use.  */
-        INCR_TX_DESC_INDEX(idx, 1U);
-        dmatxdesclist->BuffersInUse = numOfBuf;
-        dmatxdesclist->releaseIndex = idx;
-      }
-      else
-      {
-        /* Get out of the loop!  */
-        pktTxStatus = 0U;
-      }
+  heth->rxAllocateCallback = HAL_ETH_BufferPool_RxAllocate;
+  heth->rxLinkCallback = HAL_ETH_BufferPool_RxLink;
+  heth->txFreeCallback = HAL_ETH_BufferPool_TxFree;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Get a buffer from the pool.
+  * @note   The buffer is taken with exclusive accesses: an interrupt between the load and
+  *         the store of the free list head makes the store fail and the access is retried.
+  * @retval Buffer header, NULL when the pool is empty
+  */
+ETH_PoolBufferTypeDef *HAL_ETH_BufferPool_Alloc(void)
+{
+  ETH_PoolBufferTypeDef *pbuffer;
+
+  if (pETHBufferPool == NULL)
+  {
+    return NULL;
+  }
+
+  do
+  {
+    pbuffer = (ETH_PoolBufferTypeDef *)__LDREXW(&pETHBufferPool->FreeList);
+    if (pbuffer == NULL)
+    {
+      __CLREX();
+      return NULL;
     }
+  } while (__STREXW((uint32_t)pbuffer->pNext, &pETHBufferPool->FreeList) != 0U);
+
+  pbuffer->pNext = NULL;
+  pbuffer->Length = 0U;
+
+  return pbuffer;
+}
+
+/**
+  * @brief  Give a chain of buffers back to the pool.
+  * @param  pBuffer: First buffer header of the chain, linked by pNext, can be NULL
+  * @retval None
+  */
+void HAL_ETH_BufferPool_Free(ETH_PoolBufferTypeDef *pBuffer)
+{
+  ETH_PoolBufferTypeDef *plast = pBuffer;
+
+  if ((pBuffer == NULL) || (pETHBufferPool == NULL))
+  {
+    return;
+  }
+
+  while (plast->pNext != NULL)
+  {
+    plast = plast->pNext;
   }
+
+  /* Insert the whole chain at the head of the free list */
+  do
+  {
+    plast->pNext = (ETH_PoolBufferTypeDef *)__LDREXW(&pETHBufferPool->FreeList);
+  } while (__STREXW((uint32_t)pBuffer, &pETHBufferPool->FreeList) != 0U);
+}
+
+/**
+  * @brief  Rx allocate callback of the buffer pool.
+  * @param  buff: pointer to the allocated buffer data, NULL when the pool is empty
+  * @retval None
+  */
+void HAL_ETH_BufferPool_RxAllocate(uint8_t **buff)
+{
+  ETH_PoolBufferTypeDef *pbuffer = HAL_ETH_BufferPool_Alloc();
+
+  *buff = (pbuffer != NULL) ? pbuffer->pData : NULL;
+}
+
+/**
+  * @brief  Rx link callback of the buffer pool, chaining the buffers of a packet.
+  * @param  pStart: pointer to the first buffer header of the packet
+  * @param  pEnd: pointer to the last buffer header of the packet
+  * @param  buff: pointer to received data
+  * @param  Length: received data length
+  * @retval None
+  */
+void HAL_ETH_BufferPool_RxLink(void **pStart, void **pEnd, uint8_t *buff, uint16_t Length)
+{
+  ETH_PoolBufferTypeDef *pbuffer = (ETH_PoolBufferTypeDef *)((uint32_t)buff - ETH_BUFFER_POOL_HEADER_SIZE);
+
+  pbuffer->Length = Length;
+  pbuffer->pNext = NULL;
+
+  if (*pStart == NULL)
+  {
+    *pStart = pbuffer;
+  }
+  else
+  {
+    ((ETH_PoolBufferTypeDef *)*pEnd)->pNext = pbuffer;
+  }
+  *pEnd = pbuffer;
+}
+
+/**
+  * @brief  Tx free callback of the buffer pool.
+  * @param  buff: First buffer header of the transmitted packet, as given in the pData field
+  *         of ETH_TxPacketConfigTypeDef
+  * @retval None
+  */
+void HAL_ETH_BufferPool_TxFree(uint32_t *buff)
+{
+  HAL_ETH_BufferPool_Free((ETH_PoolBufferTypeDef *)buff);
+}
+
+#if defined(HAL_PCD_MODULE_ENABLED) && defined(USB_DRD_FS)
+/**
+  * @brief  Initialize the bridge between the ETH buffer pool and two USB endpoints.
+  * @note   The buffer pool must be initialized and the endpoints opened with HAL_PCD_EP_Open().
+  *         The OUT endpoint is armed with a pool buffer by this function.
+  * @note   The Rx buffers length must be a multiple of the IN endpoint max packet size, so that
+  *         the buffers of a packet are sent back to back, and the pool buffer size a multiple of
+  *         the OUT endpoint max packet size. A packet received on the OUT endpoint must fit in
+  *         one pool buffer and be ended by a short or zero-length packet.
+  * @param  pBridge: pointer to the bridge structure, which must stay valid
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  hpcd: PCD handle
+  * @param  InEpAddr: IN endpoint address
+  * @param  OutEpAddr: OUT endpoint address
+  * @param  pTxConfig: Tx packet configuration (attributes, CRC, checksum...) applied to the packets
+  *         received on the OUT endpoint, the buffer and length fields are ignored
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_Bridge_Init(ETH_PCDBridgeTypeDef *pBridge, ETH_HandleTypeDef *heth, PCD_HandleTypeDef *hpcd,
+                                      uint8_t InEpAddr, uint8_t OutEpAddr, const ETH_TxPacketConfigTypeDef *pTxConfig)
+{
+  uint32_t inmaxpacket;
+  uint32_t outmaxpacket;
+
+  if ((pBridge == NULL) || (hpcd == NULL) || (pTxConfig == NULL) || (pETHBufferPool == NULL))
+  {
+    heth->ErrorCode |= HAL_ETH_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  inmaxpacket = hpcd->IN_ep[InEpAddr & EP_ADDR_MSK].maxpacket;
+  outmaxpacket = hpcd->OUT_ep[OutEpAddr & EP_ADDR_MSK].maxpacket;
+
+  if ((inmaxpacket == 0U) || (outmaxpacket == 0U) || ((heth->Init.RxBuffLen % inmaxpacket) != 0U)
+      || ((pETHBufferPool->BufferSize % outmaxpacket) != 0U))
+  {
+    heth->ErrorCode |= HAL_ETH_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  pBridge->heth = heth;
+  pBridge->hpcd = hpcd;
+  pBridge->InEpAddr = InEpAddr;
+  pBridge->OutEpAddr = OutEpAddr;
+  pBridge->InZlp = 0U;
+  pBridge->TxConfig = *pTxConfig;
+  pBridge->TxBuffer.next = NULL;
+  pBridge->pInHead = NULL;
+  pBridge->pInTail = NULL;
+  pBridge->pInBuffer = NULL;
+  pBridge->pOutBuffer = NULL;
+  pBridge->DropCount = 0U;
+
+  ETH_Bridge_ArmOut(pBridge);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Send a received packet on the IN endpoint of the bridge.
+  * @note   The packet returned by HAL_ETH_ReadData() is queued as is: the endpoint sends
+  *         the Rx buffers directly, which are given back to the pool once sent.
+  * @note   This function can be called from the ETH interrupt or the thread context.
+  * @param  pBridge: pointer to the bridge structure
+  * @param  pPacket: First buffer header of the packet, chained by pNext
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_Bridge_ToPCD(ETH_PCDBridgeTypeDef *pBridge, ETH_PoolBufferTypeDef *pPacket)
+{
+  uint32_t primask_bit;
+  uint32_t start = 0U;
+
+  if ((pBridge == NULL) || (pPacket == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  pPacket->pNextPacket = NULL;
+
+  /* The queue is also updated by the IN endpoint completion */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  if (pBridge->pInTail == NULL)
+  {
+    pBridge->pInHead = pPacket;
+    pBridge->pInBuffer = pPacket;
+    start = 1U;
+  }
+  else
+  {
+    pBridge->pInTail->pNextPacket = pPacket;
+  }
+  pBridge->pInTail = pPacket;
+
+  __set_PRIMASK(primask_bit);
+
+  /* Otherwise the packet is sent once the previous ones are complete */
+  if (start != 0U)
+  {
+    (void)HAL_PCD_EP_Transmit(pBridge->hpcd, pBridge->InEpAddr, pPacket->pData, pPacket->Length);
+  }
+
   return HAL_OK;
 }
 
+/**
+  * @brief  Continue the bridge IN transfer, to be called from HAL_PCD_DataInStageCallback()
+  *         for the bridge IN endpoint.
+  * @note   The next buffer of the packet is sent, or a zero-length packet when the packet length
+  *         is a multiple of the max packet size. Once the packet is complete, its buffers are
+  *         given back to the pool and the next queued packet is started.
+  * @param  pBridge: pointer to the bridge structure
+  * @retval None
+  */
+void HAL_ETH_Bridge_PCDDataIn(ETH_PCDBridgeTypeDef *pBridge)
+{
+  ETH_PoolBufferTypeDef *pbuffer = pBridge->pInBuffer;
+  ETH_PoolBufferTypeDef *ppacket;
+  uint32_t primask_bit;
+
+  if (pbuffer == NULL)
+  {
+    return;
+  }
+
+  if (pbuffer->pNext != NULL)
+  {
+    pBridge->pInBuffer = pbuffer->pNext;
+    (void)HAL_PCD_EP_Transmit(pBridge->hpcd, pBridge->InEpAddr, pbuffer->pNext->pData, pbuffer->pNext->Length);
+    return;
+  }
+
+  if ((pBridge->InZlp == 0U)
+      && ((pbuffer->Length % pBridge->hpcd->IN_ep[pBridge->InEpAddr & EP_ADDR_MSK].maxpacket) == 0U))
+  {
+    /* End the packet on the host side */
+    pBridge->InZlp = 1U;
+    (void)HAL_PCD_EP_Transmit(pBridge->hpcd, pBridge->InEpAddr, NULL, 0U);
+    return;
+  }
+  pBridge->InZlp = 0U;
+
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  ppacket = pBridge->pInHead;
+  pBridge->pInHead = ppacket->pNextPacket;
+  if (pBridge->pInHead == NULL)
+  {
+    pBridge->pInTail = NULL;
+  }
+  pBridge->pInBuffer = pBridge->pInHead;
+
+  __set_PRIMASK(primask_bit);
+
+  /* The buffers are available again for the ETH Rx descriptors */
+  HAL_ETH_BufferPool_Free(ppacket);
+
+  if (pBridge->pInBuffer != NULL)
+  {
+    (void)HAL_PCD_EP_Transmit(pBridge->hpcd, pBridge->InEpAddr, pBridge->pInBuffer->pData,
+                              pBridge->pInBuffer->Length);
+  }
+
+  /* Re-arm the OUT endpoint if the pool was empty */
+  if (pBridge->pOutBuffer == NULL)
+  {
+    ETH_Bridge_ArmOut(pBridge);
+  }
+}
+
+/**
+  * @brief  Transmit the packet received on the bridge OUT endpoint, to be called from
+  *         HAL_PCD_DataOutStageCallback() for the bridge OUT endpoint.
+  * @note   The pool buffer filled by the endpoint is given to HAL_ETH_Transmit_IT() and freed by
+  *         the pool Tx free callback once transmitted. The packet is dropped when no Tx descriptor
+  *         is available. The endpoint is then armed with a new pool buffer.
+  * @param  pBridge: pointer to the bridge structure
+  * @retval None
+  */
+void HAL_ETH_Bridge_PCDDataOut(ETH_PCDBridgeTypeDef *pBridge)
+{
+  ETH_PoolBufferTypeDef *pbuffer = pBridge->pOutBuffer;
+
+  if (pbuffer == NULL)
+  {
+    return;
+  }
+  pBridge->pOutBuffer = NULL;
+
+  pbuffer->Length = HAL_PCD_EP_GetRxCount(pBridge->hpcd, pBridge->OutEpAddr);
+
+  if (pbuffer->Length != 0U)
+  {
+    pBridge->TxBuffer.buffer = pbuffer->pData;
+    pBridge->TxBuffer.len = pbuffer->Length;
+    pBridge->TxConfig.Length = pbuffer->Length;
+    pBridge->TxConfig.TxBuffer = &pBridge->TxBuffer;
+    pBridge->TxConfig.pData = pbuffer;
+
+    if (HAL_ETH_Transmit_IT(pBridge->heth, &pBridge->TxConfig) != HAL_OK)
+    {
+      pBridge->DropCount++;
+      HAL_ETH_BufferPool_Free(pbuffer);
+    }
+  }
+  else
+  {
+    HAL_ETH_BufferPool_Free(pbuffer);
+  }
+
+  ETH_Bridge_ArmOut(pBridge);
+}
+#endif /* HAL_PCD_MODULE_ENABLED && USB_DRD_FS */
+
 #ifdef HAL_ETH_USE_PTP
 /**
   * @brief  Set the Ethernet PTP configuration.
@@ -1845,7 +2552,7 @@ HAL_StatusTypeDef HAL_ETH_PTP_InsertTxTimestamp(ETH_HandleTypeDef *heth)
 {
   ETH_TxDescListTypeDef *dmatxdesclist = &heth->TxDescList;
   uint32_t descidx = dmatxdesclist->CurTxDesc;
-  ETH_DMADescTypeDef *dmatxdesc = (ETH_DMADescTypeDef *)dmatxdesclist->TxDesc[descidx];
+  ETH_DMADescTypeDef *dmatxdesc = &heth->Init.TxDesc[descidx];
 
   if (heth->IsPtpConfigured == HAL_ETH_PTP_CONFIGURED)
   {
@@ -1874,7 +2581,7 @@ HAL_StatusTypeDef HAL_ETH_PTP_GetTxTimestamp(ETH_HandleTypeDef *heth, ETH_TimeSt
 {
   ETH_TxDescListTypeDef *dmatxdesclist = &heth->TxDescList;
   uint32_t idx =       dmatxdesclist->releaseIndex;
-  ETH_DMADescTypeDef *dmatxdesc = (ETH_DMADescTypeDef *)dmatxdesclist->TxDesc[idx];
+  ETH_DMADescTypeDef *dmatxdesc = &heth->Init.TxDesc[idx];
 
   if (heth->IsPtpConfigured == HAL_ETH_PTP_CONFIGURED)
   {
@@ -1920,6 +2627,207 @@ HAL_StatusTypeDef HAL_ETH_PTP_GetRxTimestamp(ETH_HandleTypeDef *heth, ETH_TimeSt
   }
 }
 
+/**
+  * @brief  Read up to MaxRecords received packets along with their receive timestamp.
+  * @note   Each completion record holds the packet built by the Rx link callback and
+  *         the timestamp written back by the DMA in the packet context descriptor,
+  *         so that no HAL_ETH_PTP_GetRxTimestamp() call is needed per packet.
+  *         The used Rx descriptors are refilled once, after the last packet.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pRecords: Pointer to the completion records array
+  * @param  MaxRecords: Number of entries of pRecords
+  * @param  pRecordCount: Pointer to hold the number of records filled
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_PTP_ReadDataBurst(ETH_HandleTypeDef *heth, ETH_PacketRecordTypeDef *pRecords,
+                                            uint32_t MaxRecords, uint32_t *pRecordCount)
+{
+  uint32_t reccnt = 0U;
+
+  if ((pRecords == NULL) || (MaxRecords == 0U) || (pRecordCount == NULL))
+  {
+    heth->ErrorCode |= HAL_ETH_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  if (heth->gState != HAL_ETH_STATE_STARTED)
+  {
+    return HAL_ERROR;
+  }
+
+  while ((reccnt < MaxRecords) && (ETH_GetRxPacket(heth) == 1U))
+  {
+    pRecords[reccnt].pBuff = heth->RxDescList.pRxStart;
+    pRecords[reccnt].TimeStamp = heth->RxDescList.TimeStamp;
+    /* Reset first element */
+    heth->RxDescList.pRxStart = NULL;
+    reccnt++;
+  }
+
+  if ((heth->RxDescList.RxBuildDescCnt) != 0U)
+  {
+    /* Update all the released descriptors at once */
+    ETH_UpdateDescriptor(heth);
+  }
+
+  *pRecordCount = reccnt;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Release up to MaxRecords transmitted Tx packets along with their transmit timestamp.
+  * @note   The timestamps are delivered in the completion records instead of
+  *         the Tx Ptp callback. The packets are still released through the Tx
+  *         free callback, the record pBuff field only identifies the packet.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pRecords: Pointer to the completion records array
+  * @param  MaxRecords: Number of entries of pRecords
+  * @param  pRecordCount: Pointer to hold the number of records filled
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_PTP_ReleaseTxPacket(ETH_HandleTypeDef *heth, ETH_PacketRecordTypeDef *pRecords,
+                                              uint32_t MaxRecords, uint32_t *pRecordCount)
+{
+  if ((pRecords == NULL) || (MaxRecords == 0U) || (pRecordCount == NULL))
+  {
+    heth->ErrorCode |= HAL_ETH_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  *pRecordCount = ETH_ReleaseTxPackets(heth, pRecords, MaxRecords);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Initialize the PTP clock servo.
+  * @note   The Kp, Ki, StepThreshold and MaxAdjustment fields must be set by the
+  *         user, the nominal addend is taken from the current addend register.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pServo: pointer to a ETH_PTP_ServoTypeDef structure
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_PTP_ServoInit(ETH_HandleTypeDef *heth, ETH_PTP_ServoTypeDef *pServo)
+{
+  if (pServo == NULL)
+  {
+    heth->ErrorCode |= HAL_ETH_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  if (heth->IsPtpConfigured != HAL_ETH_PTP_CONFIGURED)
+  {
+    return HAL_ERROR;
+  }
+
+  pServo->BaseAddend = READ_REG(heth->Instance->MACTSAR);
+  pServo->Integral = 0;
+  pServo->Adjustment = 0;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Run one iteration of the PTP clock servo.
+  * @note   Offsets larger than StepThreshold are corrected at once with
+  *         HAL_ETH_PTP_AddTimeOffset(), smaller ones are removed by a PI
+  *         controller slewing the clock frequency through the addend register.
+  *         The addend update is not waited for, HAL_BUSY is returned when the
+  *         previous one is still pending.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pServo: pointer to a ETH_PTP_ServoTypeDef structure
+  * @param  OffsetNs: Offset of the local clock from the master clock in nanoseconds
+  *         (positive when the local clock is ahead)
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_PTP_ServoUpdate(ETH_HandleTypeDef *heth, ETH_PTP_ServoTypeDef *pServo, int64_t OffsetNs)
+{
+  ETH_TimeTypeDef timeoffset;
+  uint64_t absoffset;
+  int64_t adjustment;
+  int64_t proportional;
+  int64_t integral;
+
+  if (pServo == NULL)
+  {
+    heth->ErrorCode |= HAL_ETH_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  if (heth->IsPtpConfigured != HAL_ETH_PTP_CONFIGURED)
+  {
+    return HAL_ERROR;
+  }
+
+  if (READ_BIT(heth->Instance->MACTSCR, ETH_MACTSCR_TSADDREG) != 0U)
+  {
+    return HAL_BUSY;
+  }
+
+  absoffset = (OffsetNs < 0) ? (uint64_t)(-OffsetNs) : (uint64_t)OffsetNs;
+
+  if (absoffset > pServo->StepThreshold)
+  {
+    /* Step the clock and restart the frequency control loop */
+    timeoffset.Seconds = (uint32_t)(absoffset / 1000000000U);
+    timeoffset.NanoSeconds = (uint32_t)(absoffset % 1000000000U);
+    if (HAL_ETH_PTP_AddTimeOffset(heth, (OffsetNs > 0) ? HAL_ETH_PTP_NEGATIVE_UPDATE : HAL_ETH_PTP_POSITIVE_UPDATE,
+                                  &timeoffset) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+    pServo->Integral = 0;
+    adjustment = 0;
+  }
+  else
+  {
+    /* PI controller, gains in ppb per nanosecond with 8 fractional bits */
+    integral = (int64_t)pServo->Integral + (((int64_t)pServo->Ki * OffsetNs) / 256);
+    if (integral > pServo->MaxAdjustment)
+    {
+      integral = pServo->MaxAdjustment;
+    }
+    else if (integral < -pServo->MaxAdjustment)
+    {
+      integral = -pServo->MaxAdjustment;
+    }
+    else
+    {
+      /* Integral term within range */
+    }
+    pServo->Integral = (int32_t)integral;
+
+    proportional = ((int64_t)pServo->Kp * OffsetNs) / 256;
+    adjustment = -(proportional + integral);
+    if (adjustment > pServo->MaxAdjustment)
+    {
+      adjustment = pServo->MaxAdjustment;
+    }
+    else if (adjustment < -pServo->MaxAdjustment)
+    {
+      adjustment = -pServo->MaxAdjustment;
+    }
+    else
+    {
+      /* Adjustment within range */
+    }
+  }
+
+  pServo->Adjustment = (int32_t)adjustment;
+
+  /* Apply the frequency adjustment relatively to the nominal addend */
+  WRITE_REG(heth->Instance->MACTSAR,
+            (uint32_t)((int64_t)pServo->BaseAddend + (((int64_t)pServo->BaseAddend * adjustment) / 1000000000)));
+  SET_BIT(heth->Instance->MACTSCR, ETH_MACTSCR_TSADDREG);
+
+  return HAL_OK;
+}
+
 /**
   * @brief  Register the Tx Ptp callback.
   * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
@@ -1984,12 +2892,22 @@ void HAL_ETH_IRQHandler(ETH_HandleTypeDef *heth)
   uint32_t dma_itsource = READ_REG(heth->Instance->DMACIER);
   uint32_t exti_flag = READ_REG(EXTI->RPR2);
 
+  HAL_TRACE_ENTER(HAL_TRACE_ID_ETH_IRQ, heth);
+
   /* Packet received */
   if (((dma_flag & ETH_DMACSR_RI) != 0U) && ((dma_itsource & ETH_DMACIER_RIE) != 0U))
   {
     /* Clear the Eth DMA Rx IT pending bits */
     __HAL_ETH_DMA_CLEAR_IT(heth, ETH_DMACSR_RI | ETH_DMACSR_NIS);
 
+#if (USE_ETH_RX_LATENCY != 0U)
+    /* Save the interrupt time to measure the latency until the packet is read */
+    if (heth->RxIrqTimeStamp == 0U)
+    {
+      heth->RxIrqTimeStamp = DWT->CYCCNT | 1U;
+    }
+#endif /* USE_ETH_RX_LATENCY */
+
 #if (USE_HAL_ETH_REGISTER_CALLBACKS == 1)
     /*Call registered Receive complete callback*/
     heth->RxCpltCallback(heth);
@@ -2036,6 +2954,12 @@ void HAL_ETH_IRQHandler(ETH_HandleTypeDef *heth)
       heth->DMAErrorCode = READ_BIT(heth->Instance->DMACSR, (ETH_DMACSR_CDE | ETH_DMACSR_ETI | ETH_DMACSR_RWT |
                                                              ETH_DMACSR_RBU | ETH_DMACSR_AIS));
 
+      /* Count the Rx ring exhausted events */
+      if ((heth->DMAErrorCode & ETH_DMACSR_RBU) != 0U)
+      {
+        heth->RxBuffUnavailableCnt++;
+      }
+
       /* Clear the interrupt summary flag */
       __HAL_ETH_DMA_CLEAR_IT(heth, (ETH_DMACSR_CDE | ETH_DMACSR_ETI | ETH_DMACSR_RWT |
                                     ETH_DMACSR_RBU | ETH_DMACSR_AIS));
@@ -2117,6 +3041,8 @@ void HAL_ETH_IRQHandler(ETH_HandleTypeDef *heth)
     HAL_ETH_WakeUpCallback(heth);
 #endif /* USE_HAL_ETH_REGISTER_CALLBACKS */
   }
+
+  HAL_TRACE_EXIT(HAL_TRACE_ID_ETH_IRQ, heth);
 }
 
 /**
@@ -2175,37 +3101,67 @@ __weak void HAL_ETH_PMTCallback(ETH_HandleTypeDef *heth)
   /* Prevent unused argument(s) compilation warning */
   UNUSED(heth);
   /* NOTE : This function Should not be modified, when the callback is needed,
-  the HAL_ETH_PMTCallback could be implemented in the user file
-  */
+  the HAL_ETH_PMTCallback could be implemented in the user file
+  */
+}
+
+/**
+  * @brief  Energy Efficient Etherent IT callback
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @retval None
+  */
+__weak void HAL_ETH_EEECallback(ETH_HandleTypeDef *heth)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(heth);
+  /* NOTE : This function Should not be modified, when the callback is needed,
+  the HAL_ETH_EEECallback could be implemented in the user file
+  */
+}
+
+/**
+  * @brief  ETH WAKEUP interrupt callback
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @retval None
+  */
+__weak void HAL_ETH_WakeUpCallback(ETH_HandleTypeDef *heth)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(heth);
+  /* NOTE : This function Should not be modified, when the callback is needed,
+            the HAL_ETH_WakeUpCallback could be implemented in the user file
+   */
 }
 
 /**
-  * @brief  Energy Efficient Etherent IT callback
+  * @brief  MDIO transfers batch complete callback
   * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
   *         the configuration information for ETHERNET module
   * @retval None
   */
-__weak void HAL_ETH_EEECallback(ETH_HandleTypeDef *heth)
+__weak void HAL_ETH_MDIOCpltCallback(ETH_HandleTypeDef *heth)
 {
   /* Prevent unused argument(s) compilation warning */
   UNUSED(heth);
   /* NOTE : This function Should not be modified, when the callback is needed,
-  the HAL_ETH_EEECallback could be implemented in the user file
-  */
+            the HAL_ETH_MDIOCpltCallback could be implemented in the user file
+   */
 }
 
 /**
-  * @brief  ETH WAKEUP interrupt callback
+  * @brief  PHY link change callback
   * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
   *         the configuration information for ETHERNET module
   * @retval None
   */
-__weak void HAL_ETH_WakeUpCallback(ETH_HandleTypeDef *heth)
+__weak void HAL_ETH_LinkChangeCallback(ETH_HandleTypeDef *heth)
 {
   /* Prevent unused argument(s) compilation warning */
   UNUSED(heth);
   /* NOTE : This function Should not be modified, when the callback is needed,
-            the HAL_ETH_WakeUpCallback could be implemented in the user file
+            the HAL_ETH_LinkChangeCallback could be implemented in the user file
    */
 }
 
@@ -2319,6 +3275,208 @@ HAL_StatusTypeDef HAL_ETH_WritePHYRegister(const ETH_HandleTypeDef *heth, uint32
   return HAL_OK;
 }
 
+/**
+  * @brief  Submit a batch of PHY register accesses.
+  * @note   The transfers are run one after the other by HAL_ETH_MDIO_Process()
+  *         without waiting for the MDIO bus, HAL_ETH_MDIOCpltCallback() is
+  *         executed once the last one is complete. Read values are stored in
+  *         the Value field of each transfer, pXfer must stay valid until then.
+  * @note   HAL_ETH_ReadPHYRegister() and HAL_ETH_WritePHYRegister() return an
+  *         error while a background transfer is on the bus.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pXfer: pointer to the MDIO transfers array
+  * @param  XferCount: Number of transfers of the pXfer array
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_MDIO_Submit(ETH_HandleTypeDef *heth, ETH_MDIOTransferTypeDef *pXfer, uint32_t XferCount)
+{
+  if ((pXfer == NULL) || (XferCount == 0U))
+  {
+    heth->ErrorCode |= HAL_ETH_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  if (heth->pMDIOXfer != NULL)
+  {
+    return HAL_BUSY;
+  }
+
+  heth->MDIOXferCount = XferCount;
+  heth->MDIOXferIdx = 0U;
+  heth->pMDIOXfer = pXfer;
+
+  /* Start the first transfer if the bus is free */
+  HAL_ETH_MDIO_Process(heth);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Start the PHY link monitor.
+  * @note   The PHY register is read in the background by HAL_ETH_MDIO_Process()
+  *         every Period milliseconds, HAL_ETH_LinkChangeCallback() is executed
+  *         when the bits selected by Mask change.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  PHYAddr: PHY port address, must be a value from 0 to 31
+  * @param  PHYReg: PHY status register address (e.g. BMSR), must be a value from 0 to 31
+  * @param  Mask: Link status bits of the PHY register, must not be 0
+  * @param  Period: Polling period in milliseconds
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_MDIO_StartLinkMonitor(ETH_HandleTypeDef *heth, uint32_t PHYAddr, uint32_t PHYReg,
+                                                uint32_t Mask, uint32_t Period)
+{
+  if ((PHYAddr > 31U) || (PHYReg > 31U) || (Mask == 0U))
+  {
+    heth->ErrorCode |= HAL_ETH_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  if (heth->pMDIOXferActive == &heth->MDIOLinkXfer)
+  {
+    return HAL_BUSY;
+  }
+
+  heth->MDIOLinkXfer.Operation = ETH_MDIO_READ;
+  heth->MDIOLinkXfer.PHYAddr = PHYAddr;
+  heth->MDIOLinkXfer.PHYReg = PHYReg;
+  heth->MDIOLinkStatus = 0U;
+  heth->MDIOLinkPeriod = Period;
+  /* Poll at the next process call */
+  heth->MDIOLinkTickStart = HAL_GetTick() - Period;
+  heth->MDIOLinkMask = Mask;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the PHY link monitor.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_MDIO_StopLinkMonitor(ETH_HandleTypeDef *heth)
+{
+  heth->MDIOLinkMask = 0U;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Get the last link status read by the PHY link monitor.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @retval PHY register value masked with the link monitor mask
+  */
+uint32_t HAL_ETH_MDIO_GetLinkStatus(const ETH_HandleTypeDef *heth)
+{
+  return heth->MDIOLinkStatus;
+}
+
+/**
+  * @brief  Advance the background MDIO transfers.
+  * @note   This function never waits for the MDIO bus: it completes the transfer
+  *         on the bus if it is over, then starts the next batch transfer or the
+  *         link monitor poll when it is due.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @retval None
+  */
+void HAL_ETH_MDIO_Process(ETH_HandleTypeDef *heth)
+{
+  ETH_MDIOTransferTypeDef *pxfer = heth->pMDIOXferActive;
+  uint32_t linkstatus;
+
+  if (pxfer != NULL)
+  {
+    /* Check for the Busy flag */
+    if (READ_BIT(heth->Instance->MACMDIOAR, ETH_MACMDIOAR_MB) != (uint32_t)RESET)
+    {
+      if ((HAL_GetTick() - heth->MDIOTickStart) > ETH_MDIO_BUS_TIMEOUT)
+      {
+        /* Abort the batch and the link monitor poll */
+        heth->pMDIOXferActive = NULL;
+        heth->pMDIOXfer = NULL;
+        heth->ErrorCode |= HAL_ETH_ERROR_TIMEOUT;
+#if (USE_HAL_ETH_REGISTER_CALLBACKS == 1)
+        /* Call registered Error callback*/
+        heth->ErrorCallback(heth);
+#else
+        /* Ethernet Error callback */
+        HAL_ETH_ErrorCallback(heth);
+#endif  /* USE_HAL_ETH_REGISTER_CALLBACKS */
+      }
+      return;
+    }
+
+    heth->pMDIOXferActive = NULL;
+
+    if (pxfer->Operation == ETH_MDIO_READ)
+    {
+      /* Get MACMIIDR value */
+      pxfer->Value = (uint16_t)heth->Instance->MACMDIODR;
+    }
+
+    if (pxfer == &heth->MDIOLinkXfer)
+    {
+      linkstatus = pxfer->Value & heth->MDIOLinkMask;
+      if ((heth->MDIOLinkMask != 0U) && (linkstatus != heth->MDIOLinkStatus))
+      {
+        heth->MDIOLinkStatus = linkstatus;
+#if (USE_HAL_ETH_REGISTER_CALLBACKS == 1)
+        /* Call registered Link Change callback*/
+        heth->LinkChangeCallback(heth);
+#else
+        /* Link Change callback */
+        HAL_ETH_LinkChangeCallback(heth);
+#endif  /* USE_HAL_ETH_REGISTER_CALLBACKS */
+      }
+    }
+    else
+    {
+      heth->MDIOXferIdx++;
+      if (heth->MDIOXferIdx == heth->MDIOXferCount)
+      {
+        /* Batch complete, a new one may be submitted from the callback */
+        heth->pMDIOXfer = NULL;
+#if (USE_HAL_ETH_REGISTER_CALLBACKS == 1)
+        /* Call registered MDIO Complete callback*/
+        heth->MDIOCpltCallback(heth);
+#else
+        /* MDIO Complete callback */
+        HAL_ETH_MDIOCpltCallback(heth);
+#endif  /* USE_HAL_ETH_REGISTER_CALLBACKS */
+      }
+    }
+  }
+
+  if ((heth->pMDIOXferActive == NULL)
+      && (READ_BIT(heth->Instance->MACMDIOAR, ETH_MACMDIOAR_MB) == (uint32_t)RESET))
+  {
+    /* The batch transfers have priority over the link monitor */
+    if (heth->pMDIOXfer != NULL)
+    {
+      pxfer = &heth->pMDIOXfer[heth->MDIOXferIdx];
+    }
+    else if ((heth->MDIOLinkMask != 0U) && ((HAL_GetTick() - heth->MDIOLinkTickStart) >= heth->MDIOLinkPeriod))
+    {
+      pxfer = &heth->MDIOLinkXfer;
+      heth->MDIOLinkTickStart = HAL_GetTick();
+    }
+    else
+    {
+      pxfer = NULL;
+    }
+
+    if (pxfer != NULL)
+    {
+      ETH_MDIO_StartTransfer(heth, pxfer);
+    }
+  }
+}
+
 /**
   * @}
   */
@@ -2883,6 +4041,182 @@ uint32_t HAL_ETH_GetTxBuffersNumber(const ETH_HandleTypeDef *heth)
   * @}
   */
 
+/**
+  * @brief  Start a PHY register access without waiting for its completion.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pXfer: pointer to the MDIO transfer to start
+  * @retval None
+  */
+static void ETH_MDIO_StartTransfer(ETH_HandleTypeDef *heth, ETH_MDIOTransferTypeDef *pXfer)
+{
+  uint32_t tmpreg;
+
+  /* Get the  MACMDIOAR value */
+  WRITE_REG(tmpreg, heth->Instance->MACMDIOAR);
+
+  /* Prepare the MDIO Address Register value
+     - Set the PHY device address
+     - Set the PHY register address
+     - Set the read or write mode
+     - Set the MII Busy bit */
+
+  MODIFY_REG(tmpreg, ETH_MACMDIOAR_PA, (pXfer->PHYAddr << 21));
+  MODIFY_REG(tmpreg, ETH_MACMDIOAR_RDA, (pXfer->PHYReg << 16));
+  if (pXfer->Operation == ETH_MDIO_WRITE)
+  {
+    MODIFY_REG(tmpreg, ETH_MACMDIOAR_MOC, ETH_MACMDIOAR_MOC_WR);
+
+    /* Give the value to the MII data register */
+    WRITE_REG(heth->Instance->MACMDIODR, (uint16_t)pXfer->Value);
+  }
+  else
+  {
+    MODIFY_REG(tmpreg, ETH_MACMDIOAR_MOC, ETH_MACMDIOAR_MOC_RD);
+  }
+  SET_BIT(tmpreg, ETH_MACMDIOAR_MB);
+
+  heth->pMDIOXferActive = pXfer;
+  heth->MDIOTickStart = HAL_GetTick();
+
+  /* Write the result value into the MDII Address register */
+  WRITE_REG(heth->Instance->MACMDIOAR, tmpreg);
+}
+
+#if defined(HAL_PCD_MODULE_ENABLED) && defined(USB_DRD_FS)
+/**
+  * @brief  Arm the bridge OUT endpoint with a pool buffer.
+  * @note   When the pool is empty, the endpoint is armed again once an IN packet is sent.
+  * @param  pBridge: pointer to the bridge structure
+  * @retval None
+  */
+static void ETH_Bridge_ArmOut(ETH_PCDBridgeTypeDef *pBridge)
+{
+  ETH_PoolBufferTypeDef *pbuffer = HAL_ETH_BufferPool_Alloc();
+
+  if (pbuffer != NULL)
+  {
+    pBridge->pOutBuffer = pbuffer;
+    (void)HAL_PCD_EP_Receive(pBridge->hpcd, pBridge->OutEpAddr, pbuffer->pData, pETHBufferPool->BufferSize);
+  }
+}
+#endif /* HAL_PCD_MODULE_ENABLED && USB_DRD_FS */
+
+/**
+  * @brief  Release the transmitted Tx packets, filling the completion records if any.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pRecords: Pointer to the completion records array, NULL to report the
+  *         Tx timestamps through the Tx Ptp callback
+  * @param  MaxRecords: Number of entries of pRecords
+  * @retval Number of completion records filled
+  */
+static uint32_t ETH_ReleaseTxPackets(ETH_HandleTypeDef *heth, ETH_PacketRecordTypeDef *pRecords,
+                                     uint32_t MaxRecords)
+{
+  ETH_TxDescListTypeDef *dmatxdesclist = &heth->TxDescList;
+  uint32_t numOfBuf =  dmatxdesclist->BuffersInUse;
+  uint32_t idx =       dmatxdesclist->releaseIndex;
+  uint8_t pktTxStatus = 1U;
+  uint8_t pktInUse;
+  uint32_t reccnt = 0U;
+#ifdef HAL_ETH_USE_PTP
+  ETH_TimeStampTypeDef *timestamp = &heth->TxTimestamp;
+#endif /* HAL_ETH_USE_PTP */
+
+  /* Loop through buffers in use.  */
+  while ((numOfBuf != 0U) && (pktTxStatus != 0U) && ((pRecords == NULL) || (reccnt < MaxRecords)))
+  {
+    pktInUse = 1U;
+    numOfBuf--;
+    /* If no packet, just examine the next packet.  */
+    if (dmatxdesclist->PacketAddress[idx] == NULL)
+    {
+      /* No packet in use, skip to next.  */
+      INCR_TX_DESC_INDEX(idx, 1U, heth->Init.TxDescNbr);
+      pktInUse = 0U;
+    }
+
+    if (pktInUse != 0U)
+    {
+      /* Determine if the packet has been transmitted.  */
+      if ((heth->Init.TxDesc[idx].DESC3 & ETH_DMATXNDESCRF_OWN) == 0U)
+      {
+#ifdef HAL_ETH_USE_PTP
+
+        /* Disable Ptp transmission */
+        CLEAR_BIT(heth->Init.TxDesc[idx].DESC2, ETH_DMATXNDESCRF_TTSE);
+
+        if ((heth->Init.TxDesc[idx].DESC3 & ETH_DMATXNDESCWBF_LD)
+            && (heth->Init.TxDesc[idx].DESC3 & ETH_DMATXNDESCWBF_TTSS))
+        {
+          /* Get timestamp low */
+          timestamp->TimeStampLow = heth->Init.TxDesc[idx].DESC0;
+          /* Get timestamp high */
+          timestamp->TimeStampHigh = heth->Init.TxDesc[idx].DESC1;
+        }
+        else
+        {
+          timestamp->TimeStampHigh = timestamp->TimeStampLow = UINT32_MAX;
+        }
+#endif /* HAL_ETH_USE_PTP */
+
+#if (USE_HAL_ETH_REGISTER_CALLBACKS == 1)
+        /*Call registered callbacks*/
+#ifdef HAL_ETH_USE_PTP
+        if (pRecords != NULL)
+        {
+          /* Deliver the timestamp with the packet completion record */
+          pRecords[reccnt].pBuff = dmatxdesclist->PacketAddress[idx];
+          pRecords[reccnt].TimeStamp = *timestamp;
+          reccnt++;
+        }
+        /* Handle Ptp  */
+        else if (timestamp->TimeStampHigh != UINT32_MAX && timestamp->TimeStampLow != UINT32_MAX)
+        {
+          heth->txPtpCallback(dmatxdesclist->PacketAddress[idx], timestamp);
+        }
+#endif  /* HAL_ETH_USE_PTP */
+        /* Release the packet.  */
+        heth->txFreeCallback(dmatxdesclist->PacketAddress[idx]);
+#else
+        /* Call callbacks */
+#ifdef HAL_ETH_USE_PTP
+        if (pRecords != NULL)
+        {
+          /* Deliver the timestamp with the packet completion record */
+          pRecords[reccnt].pBuff = dmatxdesclist->PacketAddress[idx];
+          pRecords[reccnt].TimeStamp = *timestamp;
+          reccnt++;
+        }
+        /* Handle Ptp  */
+        else if (timestamp->TimeStampHigh != UINT32_MAX && timestamp->TimeStampLow != UINT32_MAX)
+        {
+          HAL_ETH_TxPtpCallback(dmatxdesclist->PacketAddress[idx], timestamp);
+        }
+#endif  /* HAL_ETH_USE_PTP */
+        /* Release the packet.  */
+        HAL_ETH_TxFreeCallback(dmatxdesclist->PacketAddress[idx]);
+#endif  /* USE_HAL_ETH_REGISTER_CALLBACKS */
+
+        /* Clear the entry in the in-use array.  */
+        dmatxdesclist->PacketAddress[idx] = NULL;
+
+        /* Update the transmit relesae index and number of buffers in use.  */
+        INCR_TX_DESC_INDEX(idx, 1U, heth->Init.TxDescNbr);
+        dmatxdesclist->BuffersInUse = numOfBuf;
+        dmatxdesclist->releaseIndex = idx;
+      }
+      else
+      {
+        /* Get out of the loop!  */
+        pktTxStatus = 0U;
+      }
+    }
+  }
+  return reccnt;
+}
+
 /** @addtogroup ETH_Private_Functions   ETH Private Functions
   * @{
   */
@@ -3110,7 +4444,17 @@ static void ETH_DMATxDescListInit(ETH_HandleTypeDef *heth)
   uint32_t i;
 
   /* Fill each DMATxDesc descriptor with the right values */
-  for (i = 0; i < (uint32_t)ETH_TX_DESC_CNT; i++)
+  /* Select the packet addresses array: user provided one or handle default one */
+  if (heth->Init.TxPacketAddress != NULL)
+  {
+    heth->TxDescList.PacketAddress = heth->Init.TxPacketAddress;
+  }
+  else
+  {
+    heth->TxDescList.PacketAddress = heth->TxDescList.PacketAddressTab;
+  }
+
+  for (i = 0; i < heth->Init.TxDescNbr; i++)
   {
     dmatxdesc = heth->Init.TxDesc + i;
 
@@ -3119,14 +4463,13 @@ static void ETH_DMATxDescListInit(ETH_HandleTypeDef *heth)
     WRITE_REG(dmatxdesc->DESC2, 0x0U);
     WRITE_REG(dmatxdesc->DESC3, 0x0U);
 
-    WRITE_REG(heth->TxDescList.TxDesc[i], (uint32_t)dmatxdesc);
-
+    heth->TxDescList.PacketAddress[i] = NULL;
   }
 
   heth->TxDescList.CurTxDesc = 0;
 
   /* Set Transmit Descriptor Ring Length */
-  WRITE_REG(heth->Instance->DMACTDRLR, (ETH_TX_DESC_CNT - 1U));
+  WRITE_REG(heth->Instance->DMACTDRLR, (heth->Init.TxDescNbr - 1U));
 
   /* Set Transmit Descriptor List Address */
   WRITE_REG(heth->Instance->DMACTDLAR, (uint32_t) heth->Init.TxDesc);
@@ -3147,7 +4490,7 @@ static void ETH_DMARxDescListInit(ETH_HandleTypeDef *heth)
   ETH_DMADescTypeDef *dmarxdesc;
   uint32_t i;
 
-  for (i = 0; i < (uint32_t)ETH_RX_DESC_CNT; i++)
+  for (i = 0; i < heth->Init.RxDescNbr; i++)
   {
     dmarxdesc =  heth->Init.RxDesc + i;
 
@@ -3157,10 +4500,6 @@ static void ETH_DMARxDescListInit(ETH_HandleTypeDef *heth)
     WRITE_REG(dmarxdesc->DESC3, 0x0U);
     WRITE_REG(dmarxdesc->BackupAddr0, 0x0U);
     WRITE_REG(dmarxdesc->BackupAddr1, 0x0U);
-
-    /* Set Rx descritors addresses */
-    WRITE_REG(heth->RxDescList.RxDesc[i], (uint32_t)dmarxdesc);
-
   }
 
   WRITE_REG(heth->RxDescList.RxDescIdx, 0U);
@@ -3168,15 +4507,16 @@ static void ETH_DMARxDescListInit(ETH_HandleTypeDef *heth)
   WRITE_REG(heth->RxDescList.RxBuildDescIdx, 0U);
   WRITE_REG(heth->RxDescList.RxBuildDescCnt, 0U);
   WRITE_REG(heth->RxDescList.ItMode, 0U);
+  WRITE_REG(heth->RxDescList.RxIntWatchdog, 0U);
 
   /* Set Receive Descriptor Ring Length */
-  WRITE_REG(heth->Instance->DMACRDRLR, ((uint32_t)(ETH_RX_DESC_CNT - 1U)));
+  WRITE_REG(heth->Instance->DMACRDRLR, ((uint32_t)(heth->Init.RxDescNbr - 1U)));
 
   /* Set Receive Descriptor List Address */
   WRITE_REG(heth->Instance->DMACRDLAR, (uint32_t) heth->Init.RxDesc);
 
   /* Set Receive Descriptor Tail pointer Address */
-  WRITE_REG(heth->Instance->DMACRDTPR, ((uint32_t)(heth->Init.RxDesc + (uint32_t)(ETH_RX_DESC_CNT - 1U))));
+  WRITE_REG(heth->Instance->DMACRDTPR, ((uint32_t)(heth->Init.RxDesc + (uint32_t)(heth->Init.RxDescNbr - 1U))));
 }
 
 /**
@@ -3196,7 +4536,7 @@ static uint32_t ETH_Prepare_Tx_Descriptors(ETH_HandleTypeDef *heth, const ETH_Tx
   uint32_t firstdescidx = dmatxdesclist->CurTxDesc;
   uint32_t idx;
   uint32_t descnbr = 0;
-  ETH_DMADescTypeDef *dmatxdesc = (ETH_DMADescTypeDef *)dmatxdesclist->TxDesc[descidx];
+  ETH_DMADescTypeDef *dmatxdesc = &heth->Init.TxDesc[descidx];
 
   ETH_BufferTypeDef  *txbuffer = pTxConfig->TxBuffer;
   uint32_t           bd_count = 0;
@@ -3259,16 +4599,16 @@ static uint32_t ETH_Prepare_Tx_Descriptors(ETH_HandleTypeDef *heth, const ETH_Tx
     /* Set own bit */
     SET_BIT(dmatxdesc->DESC3, ETH_DMATXCDESC_OWN);
     /* Increment current tx descriptor index */
-    INCR_TX_DESC_INDEX(descidx, 1U);
+    INCR_TX_DESC_INDEX(descidx, 1U, heth->Init.TxDescNbr);
     /* Get current descriptor address */
-    dmatxdesc = (ETH_DMADescTypeDef *)dmatxdesclist->TxDesc[descidx];
+    dmatxdesc = &heth->Init.TxDesc[descidx];
 
     descnbr += 1U;
 
     /* Current Tx Descriptor Owned by DMA: cannot be used by the application  */
     if (READ_BIT(dmatxdesc->DESC3, ETH_DMATXNDESCWBF_OWN) == ETH_DMATXNDESCWBF_OWN)
     {
-      dmatxdesc = (ETH_DMADescTypeDef *)dmatxdesclist->TxDesc[firstdescidx];
+      dmatxdesc = &heth->Init.TxDesc[firstdescidx];
       /* Ensure rest of descriptor is written to RAM before the OWN bit */
       __DMB();
       /* Clear own bit */
@@ -3355,9 +4695,9 @@ static uint32_t ETH_Prepare_Tx_Descriptors(ETH_HandleTypeDef *heth, const ETH_Tx
     /* Clear the LD bit of previous descriptor */
     CLEAR_BIT(dmatxdesc->DESC3, ETH_DMATXNDESCRF_LD);
     /* Increment current tx descriptor index */
-    INCR_TX_DESC_INDEX(descidx, 1U);
+    INCR_TX_DESC_INDEX(descidx, 1U, heth->Init.TxDescNbr);
     /* Get current descriptor address */
-    dmatxdesc = (ETH_DMADescTypeDef *)dmatxdesclist->TxDesc[descidx];
+    dmatxdesc = &heth->Init.TxDesc[descidx];
 
     /* Clear the FD bit of new Descriptor */
     CLEAR_BIT(dmatxdesc->DESC3, ETH_DMATXNDESCRF_FD);
@@ -3367,7 +4707,7 @@ static uint32_t ETH_Prepare_Tx_Descriptors(ETH_HandleTypeDef *heth, const ETH_Tx
         || (dmatxdesclist->PacketAddress[descidx] != NULL))
     {
       descidx = firstdescidx;
-      dmatxdesc = (ETH_DMADescTypeDef *)dmatxdesclist->TxDesc[descidx];
+      dmatxdesc = &heth->Init.TxDesc[descidx];
 
       /* clear previous desc own bit */
       for (idx = 0; idx < descnbr; idx ++)
@@ -3378,9 +4718,9 @@ static uint32_t ETH_Prepare_Tx_Descriptors(ETH_HandleTypeDef *heth, const ETH_Tx
         CLEAR_BIT(dmatxdesc->DESC3, ETH_DMATXNDESCRF_OWN);
 
         /* Increment current tx descriptor index */
-        INCR_TX_DESC_INDEX(descidx, 1U);
+        INCR_TX_DESC_INDEX(descidx, 1U, heth->Init.TxDescNbr);
         /* Get current descriptor address */
-        dmatxdesc = (ETH_DMADescTypeDef *)dmatxdesclist->TxDesc[descidx];
+        dmatxdesc = &heth->Init.TxDesc[descidx];
       }
 
       return HAL_ETH_ERROR_BUSY;
@@ -3482,6 +4822,8 @@ static void ETH_InitCallbacksToDefault(ETH_HandleTypeDef *heth)
   heth->PMTCallback      = HAL_ETH_PMTCallback;       /* Legacy weak PMTCallback      */
   heth->EEECallback      = HAL_ETH_EEECallback;       /* Legacy weak EEECallback      */
   heth->WakeUpCallback   = HAL_ETH_WakeUpCallback;    /* Legacy weak WakeUpCallback   */
+  heth->MDIOCpltCallback = HAL_ETH_MDIOCpltCallback;  /* Legacy weak MDIOCpltCallback */
+  heth->LinkChangeCallback = HAL_ETH_LinkChangeCallback; /* Legacy weak LinkChangeCallback */
   heth->rxLinkCallback   = HAL_ETH_RxLinkCallback;    /* Legacy weak RxLinkCallback   */
   heth->txFreeCallback   = HAL_ETH_TxFreeCallback;    /* Legacy weak TxFreeCallback   */
 #ifdef HAL_ETH_USE_PTP
@@ -82,6 +82,8 @@
       (+) Configure L3 and L4 filters
       (+) Configure Extended VLAN features
       (+) Configure Energy Efficient Ethernet module
+      (+) Transmit large TCP payloads using the TCP segmentation offload
+      (+) Get the MMC counters and the descriptors rings statistics
 
 @endverbatim
   * @{
@@ -640,6 +642,237 @@ uint32_t HAL_ETHEx_GetMACLPIEvent(const ETH_HandleTypeDef *heth)
   return heth->MACLPIEvent;
 }
 
+/**
+  * @brief  Enables the automatic Low Power Idle (LPI) mode.
+  * @note   The MAC measures the Tx idle time with its LPI entry timer: the LPI
+  *         state is entered once no packet has been transmitted for EntryTime,
+  *         and left as soon as a new packet is queued for transmission.
+  *         This function should be called once the link is up with EEE
+  *         negotiated by the PHY, as it reports the PHY link status as up.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pLPIConfig: pointer to a ETH_AutoLPIConfigTypeDef structure that contains
+  *         the automatic LPI timers
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETHEx_EnableAutoLPI(ETH_HandleTypeDef *heth, const ETH_AutoLPIConfigTypeDef *pLPIConfig)
+{
+  if (pLPIConfig == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  if ((pLPIConfig->EntryTime < 0x8U) || (pLPIConfig->EntryTime > 0xFFFF8U) || ((pLPIConfig->EntryTime & 0x7U) != 0U)
+      || (pLPIConfig->TxWaitTime > 0xFFFFU) || (pLPIConfig->LinkStatusTime > 0x3FFU))
+  {
+    heth->ErrorCode |= HAL_ETH_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  /* Program the LPI timers, the 1us tick is set by HAL_ETH_Init() */
+  WRITE_REG(heth->Instance->MACLTCR, ((pLPIConfig->LinkStatusTime << ETH_MACLTCR_LST_Pos) |
+                                      pLPIConfig->TxWaitTime));
+  WRITE_REG(heth->Instance->MACLETR, pLPIConfig->EntryTime);
+
+  /* Enable LPI Interrupts */
+  __HAL_ETH_MAC_ENABLE_IT(heth, ETH_MACIER_LPIIE);
+
+  /* Enable the LPI entry timer with automatic exit on transmission */
+  MODIFY_REG(heth->Instance->MACLCSR, (ETH_MACLCSR_LPIEN | ETH_MACLCSR_LPITXA | ETH_MACLCSR_LPITCSE |
+                                       ETH_MACLCSR_LPIATE | ETH_MACLCSR_PLS),
+             (((uint32_t)pLPIConfig->TxClockStop << 21) |
+              ETH_MACLCSR_LPITXA | ETH_MACLCSR_LPIATE | ETH_MACLCSR_PLS));
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Disables the automatic Low Power Idle (LPI) mode.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @retval None
+  */
+void HAL_ETHEx_DisableAutoLPI(ETH_HandleTypeDef *heth)
+{
+  /* Stop the LPI entry timer and exit low power mode */
+  CLEAR_BIT(heth->Instance->MACLCSR, (ETH_MACLCSR_LPIEN | ETH_MACLCSR_LPITXA | ETH_MACLCSR_LPITCSE |
+                                      ETH_MACLCSR_LPIATE));
+
+  /* Disable LPI Interrupts */
+  __HAL_ETH_MAC_DISABLE_IT(heth, ETH_MACIER_LPIIE);
+}
+
+/**
+  * @brief  Get a snapshot of the ETH statistics.
+  * @note   MMC counters are free running. Tx underflow, Rx overflow and Rx missed
+  *         packets counters are cleared by hardware on read, they hold the number
+  *         of packets since the previous snapshot.
+  * @note   When USE_ETH_RX_LATENCY is set, the latency between the Rx complete
+  *         interrupt and the read of the packet is measured using the DWT cycle
+  *         counter enabled by HAL_ETHEx_ResetStatistics().
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pStatistics: pointer to a ETH_StatisticsTypeDef structure to be filled
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETHEx_GetStatistics(const ETH_HandleTypeDef *heth, ETH_StatisticsTypeDef *pStatistics)
+{
+  uint32_t mtlrxcnt;
+
+  if (pStatistics == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* MMC counters */
+  pStatistics->TxGoodPackets = READ_REG(heth->Instance->MMCTPCGR);
+  pStatistics->TxSingleCollisionGoodPackets = READ_REG(heth->Instance->MMCTSCGPR);
+  pStatistics->TxMultipleCollisionGoodPackets = READ_REG(heth->Instance->MMCTMCGPR);
+  pStatistics->RxUnicastGoodPackets = READ_REG(heth->Instance->MMCRUPGR);
+  pStatistics->RxCRCErrorPackets = READ_REG(heth->Instance->MMCRCRCEPR);
+  pStatistics->RxAlignmentErrorPackets = READ_REG(heth->Instance->MMCRAEPR);
+
+  /* MTL and DMA clear on read counters */
+  pStatistics->TxUnderflowPackets = READ_BIT(heth->Instance->MTLTQUR, ETH_MTLTQUR_UFPKTCNT);
+  mtlrxcnt = READ_REG(heth->Instance->MTLRQMPOCR);
+  pStatistics->RxOverflowPackets = READ_BIT(mtlrxcnt, ETH_MTLRQMPOCR_OVFPKTCNT);
+  pStatistics->RxMissedPackets = READ_BIT(heth->Instance->DMACMFCR, ETH_DMACMFCR_MFC);
+
+  /* Descriptors rings occupancy */
+  pStatistics->RxBuffUnavailableEvents = heth->RxBuffUnavailableCnt;
+  pStatistics->TxDescInUse = heth->TxDescList.BuffersInUse;
+  pStatistics->RxDescOwnedByDMA = heth->Init.RxDescNbr - heth->RxDescList.RxBuildDescCnt;
+
+#if (USE_ETH_RX_LATENCY != 0U)
+  pStatistics->RxLatencyMin = heth->RxLatencyMin;
+  pStatistics->RxLatencyMax = heth->RxLatencyMax;
+#else
+  pStatistics->RxLatencyMin = 0U;
+  pStatistics->RxLatencyMax = 0U;
+#endif /* USE_ETH_RX_LATENCY */
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Reset the ETH statistics.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @retval None
+  */
+void HAL_ETHEx_ResetStatistics(ETH_HandleTypeDef *heth)
+{
+  /* Reset all MMC counters */
+  SET_BIT(heth->Instance->MMCCR, ETH_MMCCR_CNTRST);
+
+  /* Clear the MTL and DMA counters by reading them */
+  (void)READ_REG(heth->Instance->MTLTQUR);
+  (void)READ_REG(heth->Instance->MTLRQMPOCR);
+  (void)READ_REG(heth->Instance->DMACMFCR);
+
+  heth->RxBuffUnavailableCnt = 0U;
+
+#if (USE_ETH_RX_LATENCY != 0U)
+  /* Enable the DWT cycle counter used for latency measurement */
+  HAL_CycleCounter_Enable();
+
+  heth->RxIrqTimeStamp = 0U;
+  heth->RxLatencyMin = UINT32_MAX;
+  heth->RxLatencyMax = 0U;
+#endif /* USE_ETH_RX_LATENCY */
+}
+
+/**
+  * @brief  Sends a large TCP payload using the TCP segmentation offload.
+  * @note   The DMA splits the payload in MaxSegmentSize frames, each one being
+  *         built from the headers template with IP and TCP checksums inserted by
+  *         the hardware, so that the payload bytes are never touched by the CPU.
+  * @note   The TCP segmentation must be enabled in the DMA configuration
+  *         (TCPSegmentation field of ETH_DMAConfigTypeDef) and the Tx descriptor
+  *         ring must be deep enough to hold the context descriptor and the
+  *         chained header and payload buffers.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pTSOConfig: pointer to a ETH_TSOConfigTypeDef structure that contains
+  *         the headers template and the payload to be segmented
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETHEx_TransmitTSO_IT(ETH_HandleTypeDef *heth, const ETH_TSOConfigTypeDef *pTSOConfig)
+{
+  ETH_TxPacketConfigTypeDef txconfig;
+  ETH_BufferTypeDef *txbuffer;
+  const uint8_t *payload;
+  uint32_t remaining;
+  uint32_t chunk;
+  uint32_t idx;
+
+  if ((pTSOConfig == NULL) || (pTSOConfig->pBuffers == NULL) || (pTSOConfig->pHeader == NULL)
+      || (pTSOConfig->pPayload == NULL))
+  {
+    heth->ErrorCode |= HAL_ETH_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  if ((pTSOConfig->HeaderLen == 0U) || (pTSOConfig->HeaderLen > ETH_DMATXNDESCRF_HL)
+      || (pTSOConfig->TCPHeaderLen < 0x5U) || (pTSOConfig->TCPHeaderLen > 0xFU)
+      || (pTSOConfig->PayloadLen == 0U) || (pTSOConfig->PayloadLen > ETH_DMATXNDESCRF_TPL)
+      || (pTSOConfig->MaxSegmentSize < 0x40U) || (pTSOConfig->MaxSegmentSize > ETH_DMATXCDESC_MSS)
+      || (pTSOConfig->BuffersNbr < (1U + ((pTSOConfig->PayloadLen + ETH_TSO_PAYLOAD_CHUNK_MAX - 1U) /
+                                          ETH_TSO_PAYLOAD_CHUNK_MAX))))
+  {
+    heth->ErrorCode |= HAL_ETH_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  /* TCP segmentation must be enabled on the Tx DMA channel */
+  if (READ_BIT(heth->Instance->DMACTCR, ETH_DMACTCR_TSE) == 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Headers template in the first buffer */
+  txbuffer = &pTSOConfig->pBuffers[0];
+  txbuffer->buffer = pTSOConfig->pHeader;
+  txbuffer->len = pTSOConfig->HeaderLen;
+
+  /* Chain the payload in buffers of at most ETH_TSO_PAYLOAD_CHUNK_MAX bytes */
+  payload = pTSOConfig->pPayload;
+  remaining = pTSOConfig->PayloadLen;
+  idx = 1U;
+  while (remaining > 0U)
+  {
+    chunk = (remaining > ETH_TSO_PAYLOAD_CHUNK_MAX) ? ETH_TSO_PAYLOAD_CHUNK_MAX : remaining;
+
+    txbuffer->next = &pTSOConfig->pBuffers[idx];
+    txbuffer = txbuffer->next;
+    txbuffer->buffer = (uint8_t *)payload;
+    txbuffer->len = chunk;
+
+    payload += chunk;
+    remaining -= chunk;
+    idx++;
+  }
+  txbuffer->next = NULL;
+
+  /* Checksums are always inserted by the hardware for segmented packets */
+  txconfig.Attributes = ETH_TX_PACKETS_FEATURES_TSO;
+  txconfig.Length = pTSOConfig->HeaderLen + pTSOConfig->PayloadLen;
+  txconfig.TxBuffer = pTSOConfig->pBuffers;
+  txconfig.SrcAddrCtrl = ETH_SRC_ADDR_CONTROL_DISABLE;
+  txconfig.CRCPadCtrl = ETH_CRC_PAD_INSERT;
+  txconfig.ChecksumCtrl = ETH_CHECKSUM_IPHDR_PAYLOAD_INSERT_PHDR_CALC;
+  txconfig.MaxSegmentSize = pTSOConfig->MaxSegmentSize;
+  txconfig.PayloadLen = pTSOConfig->PayloadLen;
+  txconfig.TCPHeaderLen = pTSOConfig->TCPHeaderLen;
+  txconfig.VlanTag = 0U;
+  txconfig.VlanCtrl = ETH_VLAN_DISABLE;
+  txconfig.InnerVlanTag = 0U;
+  txconfig.InnerVlanCtrl = ETH_INNER_VLAN_DISABLE;
+  txconfig.pData = pTSOConfig->pData;
+
+  return HAL_ETH_Transmit_IT(heth, &txconfig);
+}
+
 /**
   * @}
   */
@@ -502,6 +502,8 @@ void HAL_EXTI_IRQHandler(const EXTI_HandleTypeDef *hexti)
   uint32_t maskline;
   uint32_t offset;
 
+  HAL_TRACE_ENTER(HAL_TRACE_ID_EXTI_IRQ, hexti);
+
   /* Compute line register offset and line mask */
   offset = ((hexti->Line & EXTI_REG_MASK) >> EXTI_REG_SHIFT);
   maskline = (1UL << (hexti->Line & EXTI_PIN_MASK));
@@ -537,6 +539,8 @@ void HAL_EXTI_IRQHandler(const EXTI_HandleTypeDef *hexti)
       hexti->FallingCallback();
     }
   }
+
+  HAL_TRACE_EXIT(HAL_TRACE_ID_EXTI_IRQ, hexti);
 }
 
 
@@ -31,6 +31,7 @@
       (#) If needed , configure the reception filters and optional features using
           the following configuration functions:
             (++) HAL_FDCAN_ConfigFilter
+            (++) HAL_FDCAN_ConfigFilterList
             (++) HAL_FDCAN_ConfigGlobalFilter
             (++) HAL_FDCAN_ConfigExtendedIdMask
             (++) HAL_FDCAN_ConfigRxFifoOverwrite
@@ -48,6 +49,7 @@
             (++) HAL_FDCAN_DisableISOMode
             (++) HAL_FDCAN_EnableEdgeFiltering
             (++) HAL_FDCAN_DisableEdgeFiltering
+            (++) HAL_FDCAN_EvaluateBuffering
 
       (#) Start the FDCAN module using HAL_FDCAN_Start function. At this level
           the node is active on the bus: it can send and receive messages.
@@ -63,8 +65,31 @@
           It is then possible to abort later on the corresponding Tx Request using
           HAL_FDCAN_AbortTxRequest API.
 
+      (#) To keep the bus loaded under high traffic, a software Tx priority queue
+          can be attached to the started FDCAN module using HAL_FDCAN_TxQueue_Start,
+          with a user array of message pointers. Messages added using
+          HAL_FDCAN_TxQueue_Add are handed to the Tx FIFO/Queue in Priority order
+          each time a Tx buffer is released, from the FDCAN interrupt:
+            (++) Activate at least the FDCAN_IT_TX_EVT_FIFO_NEW_DATA notification,
+                 FDCAN_IT_TX_COMPLETE or FDCAN_IT_TX_FIFO_EMPTY refilling earlier.
+            (++) The queue stores a Tx event for each message, using the message
+                 marker to correlate it. On completion, the TxTimestamp and EventType
+                 fields of the message are updated and pTxCompleteCallback is called.
+            (++) While the queue is attached, the Tx event FIFO is read by the queue:
+                 HAL_FDCAN_TxEventFifoCallback is no more called for new Tx events,
+                 and other Tx requests should not store Tx events.
+            (++) Messages handed to the hardware must not be aborted using
+                 HAL_FDCAN_AbortTxRequest.
+          HAL_FDCAN_TxQueue_Stop detaches the queue, dropping the queued messages.
+
       (#) When a message is received into the FDCAN message RAM, it can be
           retrieved using the HAL_FDCAN_GetRxMessage function.
+          All the messages pending in a Rx FIFO can be retrieved at once using
+          the HAL_FDCAN_GetRxMessages function, with a single acknowledge.
+          For zero-copy processing, the HAL_FDCAN_PeekRxFifo function returns
+          pointers to the pending elements in the message RAM, decoded with
+          HAL_FDCAN_DecodeRxElement and acknowledged afterwards with the
+          HAL_FDCAN_ReleaseRxFifo function.
 
       (#) Calling the HAL_FDCAN_Stop function stops the FDCAN module by entering
           it to initialization mode and re-enabling access to configuration
@@ -215,6 +240,9 @@
 #define SRAMCAN_TEF_NBR                  ( 3U)         /* TX Event FIFO Elements Number         */
 #define SRAMCAN_TFQ_NBR                  ( 3U)         /* TX FIFO/Queue Elements Number         */
 
+#define FDCAN_TX_QUEUE_MARKER_NBR        ( 8U)         /* Tx queue message markers, size of the pInFlight table,
+                                                          covering SRAMCAN_TFQ_NBR + SRAMCAN_TEF_NBR messages */
+
 #define SRAMCAN_FLS_SIZE            ( 1U * 4U)         /* Filter Standard Element Size in bytes */
 #define SRAMCAN_FLE_SIZE            ( 2U * 4U)         /* Filter Extended Element Size in bytes */
 #define SRAMCAN_RF0_SIZE            (18U * 4U)         /* RX FIFO 0 Elements Size in bytes      */
@@ -234,6 +262,14 @@
                                                                                             Address                  */
 #define SRAMCAN_SIZE  ((uint32_t)(SRAMCAN_TFQSA + (SRAMCAN_TFQ_NBR * SRAMCAN_TFQ_SIZE))) /* Message RAM size         */
 
+#define FDCAN_CLASSIC_STD_BITS         (47U)        /* Classic standard frame bits with IFS, without data     */
+#define FDCAN_CLASSIC_EXT_BITS         (67U)        /* Classic extended frame bits with IFS, without data     */
+#define FDCAN_FD_STD_ARB_BITS          (17U)        /* FD standard frame bits up to BRS, nominal bit rate     */
+#define FDCAN_FD_EXT_ARB_BITS          (36U)        /* FD extended frame bits up to BRS, nominal bit rate     */
+#define FDCAN_FD_CRC17_BITS            (32U)        /* ESI, DLC, stuff count and CRC17 with fixed stuff bits  */
+#define FDCAN_FD_CRC21_BITS            (37U)        /* ESI, DLC, stuff count and CRC21 with fixed stuff bits  */
+#define FDCAN_FD_TAIL_BITS             (13U)        /* CRC delimiter, ACK, EOF and IFS, nominal bit rate      */
+
 /**
   * @}
   */
@@ -255,6 +291,10 @@ static const uint8_t DLCtoBytes[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24,
 static void FDCAN_CalcultateRamBlockAddresses(FDCAN_HandleTypeDef *hfdcan);
 static void FDCAN_CopyMessageToRAM(const FDCAN_HandleTypeDef *hfdcan, const FDCAN_TxHeaderTypeDef *pTxHeader,
                                    const uint8_t *pTxData, uint32_t BufferIndex);
+static uint32_t FDCAN_GetRxFifoPending(const FDCAN_HandleTypeDef *hfdcan, uint32_t RxLocation, uint32_t *pGetIndex);
+static void FDCAN_TxQueue_Refill(FDCAN_HandleTypeDef *hfdcan);
+static uint32_t FDCAN_CountFilterElements(const FDCAN_FilterTypeDef *pFilters, uint32_t SegmentCount);
+static void FDCAN_TxQueue_ProcessEvents(FDCAN_HandleTypeDef *hfdcan);
 /**
   * @}
   */
@@ -517,6 +557,9 @@ HAL_StatusTypeDef HAL_FDCAN_Init(FDCAN_HandleTypeDef *hfdcan)
   /* Initialize the Latest Tx request buffer index */
   hfdcan->LatestTxFifoQRequest = 0U;
 
+  /* No software Tx queue attached */
+  hfdcan->pTxQueue = NULL;
+
   /* Initialize the error code */
   hfdcan->ErrorCode = HAL_FDCAN_ERROR_NONE;
 
@@ -1258,6 +1301,8 @@ HAL_StatusTypeDef HAL_FDCAN_UnRegisterErrorStatusCallback(FDCAN_HandleTypeDef *h
   ==============================================================================
     [..]  This section provides functions allowing to:
       (+) HAL_FDCAN_ConfigFilter                  : Configure the FDCAN reception filters
+      (+) HAL_FDCAN_ConfigFilterList              : Configure the FDCAN reception filters from a list of
+                                                    identifiers, merged into range and dual ID elements
       (+) HAL_FDCAN_ConfigGlobalFilter            : Configure the FDCAN global filter
       (+) HAL_FDCAN_ConfigExtendedIdMask          : Configure the extended ID mask
       (+) HAL_FDCAN_ConfigRxFifoOverwrite         : Configure the Rx FIFO operation mode
@@ -1279,6 +1324,16 @@ HAL_StatusTypeDef HAL_FDCAN_UnRegisterErrorStatusCallback(FDCAN_HandleTypeDef *h
       (+) HAL_FDCAN_DisableISOMode                : Disable ISO 11898-1 protocol mode
       (+) HAL_FDCAN_EnableEdgeFiltering           : Enable edge filtering during bus integration
       (+) HAL_FDCAN_DisableEdgeFiltering          : Disable edge filtering during bus integration
+      (+) HAL_FDCAN_EvaluateBuffering             : Evaluate the message RAM buffering of a traffic profile
+
+    [..]
+      The message RAM has a fixed layout of 3 Rx FIFO 0, 3 Rx FIFO 1 and 3 Tx FIFO/Queue elements of
+      64 data bytes. HAL_FDCAN_EvaluateBuffering() computes from the bit timing of the handle how many
+      elements a burst of the shortest frames fills during the Rx service latency, and the headroom
+      left with one Rx FIFO or with the burst split between the two Rx FIFOs by the filters. A negative
+      headroom means frames are lost: split the traffic, use HAL_FDCAN_GetRxMessages() to empty a FIFO
+      in one interrupt, or lower the interrupt latency. The software Tx queue size needed by the Tx
+      bursts is also reported.
 
 @endverbatim
   * @{
@@ -1361,6 +1416,207 @@ HAL_StatusTypeDef HAL_FDCAN_ConfigFilter(FDCAN_HandleTypeDef *hfdcan, const FDCA
   }
 }
 
+/**
+  * @brief  Configure the FDCAN reception filters from a list of identifiers.
+  * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified FDCAN.
+  * @param  IdType Identifier type of the list.
+  *         This parameter can be a value of @ref FDCAN_id_type.
+  * @param  pIds pointer to the list of identifiers with their routing. The list is sorted in place.
+  * @param  IdCount Number of entries of the list.
+  * @param  pFilters pointer to a work array of IdCount FDCAN_FilterTypeDef structures,
+  *         returning the filter elements programmed.
+  * @param  pFilterCount pointer to the number of filter elements programmed.
+  * @note   Consecutive identifiers of same routing are merged into range elements, and the
+  *         remaining single identifiers are paired into dual ID elements. When the elements
+  *         still exceed Init.StdFiltersNbr or Init.ExtFiltersNbr, the closest ranges of same
+  *         routing are merged: the identifiers of the gap are accepted too and must be
+  *         discarded by software. Gaps holding identifiers of another routing are never merged.
+  * @note   The filter elements not used, up to Init.StdFiltersNbr or Init.ExtFiltersNbr,
+  *         are disabled.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_FDCAN_ConfigFilterList(FDCAN_HandleTypeDef *hfdcan, uint32_t IdType,
+                                             FDCAN_FilterIdTypeDef *pIds, uint32_t IdCount,
+                                             FDCAN_FilterTypeDef *pFilters, uint32_t *pFilterCount)
+{
+  FDCAN_FilterIdTypeDef Entry;
+  FDCAN_FilterTypeDef Disabled;
+  uint32_t PendingDual[8U];
+  uint32_t FiltersNbr;
+  uint32_t SegmentCount;
+  uint32_t ElementCount;
+  uint32_t Index;
+  uint32_t Pos;
+  uint32_t Best;
+  uint32_t BestGain;
+  uint32_t BestGap;
+  uint32_t Gain;
+  uint32_t Gap;
+  uint32_t Config;
+  HAL_FDCAN_StateTypeDef state = hfdcan->State;
+
+  /* Check function parameters */
+  assert_param(IS_FDCAN_ID_TYPE(IdType));
+
+  if ((pIds == NULL) || (pFilters == NULL) || (pFilterCount == NULL) || (IdCount == 0U))
+  {
+    /* Update error code */
+    hfdcan->ErrorCode |= HAL_FDCAN_ERROR_PARAM;
+
+    return HAL_ERROR;
+  }
+
+  if ((state != HAL_FDCAN_STATE_READY) && (state != HAL_FDCAN_STATE_BUSY))
+  {
+    /* Update error code */
+    hfdcan->ErrorCode |= HAL_FDCAN_ERROR_NOT_INITIALIZED;
+
+    return HAL_ERROR;
+  }
+
+  FiltersNbr = (IdType == FDCAN_STANDARD_ID) ? hfdcan->Init.StdFiltersNbr : hfdcan->Init.ExtFiltersNbr;
+
+  /* Sort the identifiers by increasing value */
+  for (Index = 1U; Index < IdCount; Index++)
+  {
+    Entry = pIds[Index];
+    Pos = Index;
+    while ((Pos > 0U) && (pIds[Pos - 1U].Identifier > Entry.Identifier))
+    {
+      pIds[Pos] = pIds[Pos - 1U];
+      Pos--;
+    }
+    pIds[Pos] = Entry;
+  }
+
+  /* Build the runs of consecutive identifiers of same routing */
+  SegmentCount = 0U;
+  for (Index = 0U; Index < IdCount; Index++)
+  {
+    assert_param(IS_FDCAN_FILTER_CFG(pIds[Index].FilterConfig));
+
+    if ((SegmentCount != 0U) && (pFilters[SegmentCount - 1U].FilterID2 == pIds[Index].Identifier) &&
+        (pFilters[SegmentCount - 1U].FilterConfig != pIds[Index].FilterConfig))
+    {
+      /* Same identifier with two different routings */
+      hfdcan->ErrorCode |= HAL_FDCAN_ERROR_PARAM;
+
+      return HAL_ERROR;
+    }
+
+    if ((SegmentCount != 0U) && (pFilters[SegmentCount - 1U].FilterConfig == pIds[Index].FilterConfig) &&
+        (pIds[Index].Identifier <= (pFilters[SegmentCount - 1U].FilterID2 + 1U)))
+    {
+      pFilters[SegmentCount - 1U].FilterID2 = pIds[Index].Identifier;
+    }
+    else
+    {
+      pFilters[SegmentCount].IdType = IdType;
+      pFilters[SegmentCount].FilterType = FDCAN_FILTER_RANGE;
+      pFilters[SegmentCount].FilterConfig = pIds[Index].FilterConfig;
+      pFilters[SegmentCount].FilterID1 = pIds[Index].Identifier;
+      pFilters[SegmentCount].FilterID2 = pIds[Index].Identifier;
+      SegmentCount++;
+    }
+  }
+
+  /* Merge the closest neighbour runs of same routing until the elements fit */
+  ElementCount = FDCAN_CountFilterElements(pFilters, SegmentCount);
+  while (ElementCount > FiltersNbr)
+  {
+    Best = SegmentCount;
+    BestGain = 0U;
+    BestGap = 0xFFFFFFFFU;
+    for (Index = 0U; (Index + 1U) < SegmentCount; Index++)
+    {
+      if (pFilters[Index].FilterConfig == pFilters[Index + 1U].FilterConfig)
+      {
+        /* Two ranges merged save one element, a single merged into a range saves half a dual element */
+        Gain = (((pFilters[Index].FilterID1 != pFilters[Index].FilterID2) ? 2U : 1U) +
+                ((pFilters[Index + 1U].FilterID1 != pFilters[Index + 1U].FilterID2) ? 2U : 1U)) - 2U;
+        Gap = pFilters[Index + 1U].FilterID1 - pFilters[Index].FilterID2;
+        if ((Gain > BestGain) || ((Gain == BestGain) && (Gap < BestGap)))
+        {
+          Best = Index;
+          BestGain = Gain;
+          BestGap = Gap;
+        }
+      }
+    }
+
+    if (Best == SegmentCount)
+    {
+      /* Not enough filter elements for the routings of the list */
+      hfdcan->ErrorCode |= HAL_FDCAN_ERROR_PARAM;
+
+      return HAL_ERROR;
+    }
+
+    pFilters[Best].FilterID2 = pFilters[Best + 1U].FilterID2;
+    for (Index = Best + 1U; (Index + 1U) < SegmentCount; Index++)
+    {
+      pFilters[Index] = pFilters[Index + 1U];
+    }
+    SegmentCount--;
+
+    ElementCount = FDCAN_CountFilterElements(pFilters, SegmentCount);
+  }
+
+  /* Emit the range elements and pair the single identifiers of same routing into dual elements */
+  for (Config = 0U; Config < 8U; Config++)
+  {
+    PendingDual[Config] = 0xFFFFFFFFU;
+  }
+  Pos = 0U;
+  for (Index = 0U; Index < SegmentCount; Index++)
+  {
+    Config = pFilters[Index].FilterConfig & 0x7U;
+
+    if (pFilters[Index].FilterID1 != pFilters[Index].FilterID2)
+    {
+      pFilters[Pos] = pFilters[Index];
+      Pos++;
+    }
+    else if (PendingDual[Config] != 0xFFFFFFFFU)
+    {
+      pFilters[PendingDual[Config]].FilterID2 = pFilters[Index].FilterID1;
+      PendingDual[Config] = 0xFFFFFFFFU;
+    }
+    else
+    {
+      pFilters[Pos] = pFilters[Index];
+      pFilters[Pos].FilterType = FDCAN_FILTER_DUAL;
+      PendingDual[Config] = Pos;
+      Pos++;
+    }
+  }
+
+  /* Program the filter elements */
+  for (Index = 0U; Index < Pos; Index++)
+  {
+    pFilters[Index].FilterIndex = Index;
+    (void)HAL_FDCAN_ConfigFilter(hfdcan, &pFilters[Index]);
+  }
+
+  /* Disable the filter elements left */
+  Disabled.IdType = IdType;
+  Disabled.FilterType = FDCAN_FILTER_RANGE;
+  Disabled.FilterConfig = FDCAN_FILTER_DISABLE;
+  Disabled.FilterID1 = 0U;
+  Disabled.FilterID2 = 0U;
+  for (Index = Pos; Index < FiltersNbr; Index++)
+  {
+    Disabled.FilterIndex = Index;
+    (void)HAL_FDCAN_ConfigFilter(hfdcan, &Disabled);
+  }
+
+  *pFilterCount = Pos;
+
+  /* Return function status */
+  return HAL_OK;
+}
+
 /**
   * @brief  Configure the FDCAN global filter.
   * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
@@ -1950,6 +2206,111 @@ HAL_StatusTypeDef HAL_FDCAN_DisableEdgeFiltering(FDCAN_HandleTypeDef *hfdcan)
   }
 }
 
+/**
+  * @brief  Evaluate the message RAM buffering of a traffic profile.
+  * @note   The bit rates are computed from the bit timing of the handle and the FDCAN
+  *         kernel clock. The frame duration ignores the dynamic stuff bits, giving the
+  *         highest frame rate of the burst.
+  * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified FDCAN.
+  * @param  pProfile pointer to an FDCAN_TrafficProfileTypeDef structure describing the traffic.
+  * @param  pReport pointer to an FDCAN_BufferingReportTypeDef structure receiving the evaluation.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_FDCAN_EvaluateBuffering(const FDCAN_HandleTypeDef *hfdcan,
+                                              const FDCAN_TrafficProfileTypeDef *pProfile,
+                                              FDCAN_BufferingReportTypeDef *pReport)
+{
+  uint32_t clock;
+  uint32_t bytes;
+  uint32_t nominalbits;
+  uint32_t databits;
+  uint32_t frametime;
+  uint32_t needed;
+  uint32_t neededsplit;
+
+  if ((pProfile == NULL) || (pReport == NULL) || (pProfile->DataLength > FDCAN_DLC_BYTES_64))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check function parameters */
+  assert_param(IS_FDCAN_ID_TYPE(pProfile->IdType));
+  assert_param(IS_FDCAN_FDF(pProfile->FDFormat));
+  assert_param(IS_FDCAN_BRS(pProfile->BitRateSwitch));
+
+  /* Get the FDCAN clock after the common divider */
+  clock = (uint32_t)HAL_RCCEx_GetPeriphCLKFreq(RCC_PERIPHCLK_FDCAN);
+  if (hfdcan->Init.ClockDivider != FDCAN_CLOCK_DIV1)
+  {
+    clock /= (hfdcan->Init.ClockDivider * 2U);
+  }
+
+  pReport->NominalBitRate = clock / (hfdcan->Init.NominalPrescaler *
+                                     (1U + hfdcan->Init.NominalTimeSeg1 + hfdcan->Init.NominalTimeSeg2));
+  if (hfdcan->Init.FrameFormat == FDCAN_FRAME_FD_BRS)
+  {
+    pReport->DataBitRate = clock / (hfdcan->Init.DataPrescaler *
+                                    (1U + hfdcan->Init.DataTimeSeg1 + hfdcan->Init.DataTimeSeg2));
+  }
+  else
+  {
+    pReport->DataBitRate = pReport->NominalBitRate;
+  }
+
+  if ((pReport->NominalBitRate == 0U) || (pReport->DataBitRate == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Count the frame bits of each phase */
+  bytes = DLCtoBytes[pProfile->DataLength];
+  if (pProfile->FDFormat == FDCAN_CLASSIC_CAN)
+  {
+    bytes = (bytes > 8U) ? 8U : bytes;
+    nominalbits = ((pProfile->IdType == FDCAN_STANDARD_ID) ? FDCAN_CLASSIC_STD_BITS : FDCAN_CLASSIC_EXT_BITS)
+                  + (8U * bytes);
+    databits = 0U;
+  }
+  else
+  {
+    nominalbits = ((pProfile->IdType == FDCAN_STANDARD_ID) ? FDCAN_FD_STD_ARB_BITS : FDCAN_FD_EXT_ARB_BITS)
+                  + FDCAN_FD_TAIL_BITS;
+    databits = ((bytes > 16U) ? FDCAN_FD_CRC21_BITS : FDCAN_FD_CRC17_BITS) + (8U * bytes);
+    if (pProfile->BitRateSwitch != FDCAN_BRS_ON)
+    {
+      nominalbits += databits;
+      databits = 0U;
+    }
+  }
+
+  frametime = (uint32_t)((((uint64_t)nominalbits * 1000000000U) / pReport->NominalBitRate) +
+                         (((uint64_t)databits * 1000000000U) / pReport->DataBitRate));
+  pReport->FrameTime = frametime;
+
+  /* Elements filled until the FIFO is read: the first frame of the burst and the
+     frames completed during the service latency */
+  needed = 1U + (uint32_t)((((uint64_t)pProfile->RxServiceLatency * 1000U) + frametime - 1U) / frametime);
+  if (needed > pProfile->RxBurstLength)
+  {
+    needed = pProfile->RxBurstLength;
+  }
+  neededsplit = (needed + 1U) / 2U;
+
+  pReport->RxElementsNeeded = needed;
+  pReport->RxFifoHeadroom = (int32_t)SRAMCAN_RF0_NBR - (int32_t)needed;
+  pReport->RxSplitHeadroom = (int32_t)SRAMCAN_RF0_NBR - (int32_t)neededsplit;
+  pReport->MaxRxLatency = ((SRAMCAN_RF0_NBR - 1U) * frametime) / 1000U;
+  pReport->MaxRxSplitLatency = (((SRAMCAN_RF0_NBR + SRAMCAN_RF1_NBR) - 1U) * frametime) / 1000U;
+
+  /* Tx frames not fitting in the Tx FIFO/Queue wait in the software Tx queue */
+  pReport->TxQueueSize = (pProfile->TxBurstLength > SRAMCAN_TFQ_NBR) ?
+                         (pProfile->TxBurstLength - SRAMCAN_TFQ_NBR) : 0U;
+  pReport->TxRefillTime = (SRAMCAN_TFQ_NBR * frametime) / 1000U;
+
+  return HAL_OK;
+}
+
 /**
   * @}
   */
@@ -1968,7 +2329,14 @@ HAL_StatusTypeDef HAL_FDCAN_DisableEdgeFiltering(FDCAN_HandleTypeDef *hfdcan)
                                                     transmission request
       (+) HAL_FDCAN_GetLatestTxFifoQRequestBuffer : Get Tx buffer index of latest Tx FIFO/Queue request
       (+) HAL_FDCAN_AbortTxRequest                : Abort transmission request
+      (+) HAL_FDCAN_TxQueue_Start                 : Attach a software Tx priority queue
+      (+) HAL_FDCAN_TxQueue_Add                   : Add a message to the software Tx priority queue
+      (+) HAL_FDCAN_TxQueue_Stop                  : Detach the software Tx priority queue
       (+) HAL_FDCAN_GetRxMessage                  : Get an FDCAN frame from the Rx FIFO zone into the message RAM
+      (+) HAL_FDCAN_GetRxMessages                 : Get all the pending FDCAN frames of a Rx FIFO
+      (+) HAL_FDCAN_PeekRxFifo                    : Get pointers to the pending Rx FIFO elements in the message RAM
+      (+) HAL_FDCAN_ReleaseRxFifo                 : Acknowledge Rx FIFO elements processed in the message RAM
+      (+) HAL_FDCAN_DecodeRxElement               : Decode the header of a Rx FIFO element
       (+) HAL_FDCAN_GetTxEvent                    : Get an FDCAN Tx event from the Tx Event FIFO zone
                                                     into the message RAM
       (+) HAL_FDCAN_GetHighPriorityMessageStatus  : Get high priority message status
@@ -2208,6 +2576,144 @@ HAL_StatusTypeDef HAL_FDCAN_AbortTxRequest(FDCAN_HandleTypeDef *hfdcan, uint32_t
   }
 }
 
+/**
+  * @brief  Attach a software Tx priority queue to the started FDCAN module.
+  * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified FDCAN.
+  * @param  pQueue pointer to a FDCAN_TxQueueTypeDef structure. The pTxCompleteCallback
+  *         field must be set before calling this function, or NULL.
+  * @param  pSlots pointer to a user array of Size message pointers.
+  * @param  Size number of queued messages the array can hold.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_FDCAN_TxQueue_Start(FDCAN_HandleTypeDef *hfdcan, FDCAN_TxQueueTypeDef *pQueue,
+                                          FDCAN_TxQueueMessageTypeDef **pSlots, uint32_t Size)
+{
+  uint32_t Marker;
+
+  if ((pQueue == NULL) || (pSlots == NULL) || (Size == 0U))
+  {
+    /* Update error code */
+    hfdcan->ErrorCode |= HAL_FDCAN_ERROR_PARAM;
+
+    return HAL_ERROR;
+  }
+
+  if (hfdcan->State != HAL_FDCAN_STATE_BUSY)
+  {
+    /* Update error code */
+    hfdcan->ErrorCode |= HAL_FDCAN_ERROR_NOT_STARTED;
+
+    return HAL_ERROR;
+  }
+
+  pQueue->pSlots = pSlots;
+  pQueue->Size = Size;
+  pQueue->Count = 0U;
+  pQueue->NextMarker = 0U;
+  for (Marker = 0U; Marker < FDCAN_TX_QUEUE_MARKER_NBR; Marker++)
+  {
+    pQueue->pInFlight[Marker] = NULL;
+  }
+
+  hfdcan->pTxQueue = pQueue;
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Add a message to the software Tx priority queue.
+  * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified FDCAN.
+  * @param  pMessage pointer to a FDCAN_TxQueueMessageTypeDef structure, owned by the
+  *         queue until its pTxCompleteCallback is called.
+  * @note   The message is handed to the Tx FIFO/Queue immediately when a Tx buffer is free.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_FDCAN_TxQueue_Add(FDCAN_HandleTypeDef *hfdcan, FDCAN_TxQueueMessageTypeDef *pMessage)
+{
+  FDCAN_TxQueueTypeDef *pQueue = hfdcan->pTxQueue;
+  uint32_t primask_bit;
+  uint32_t Index;
+
+  /* Check function parameters */
+  assert_param(IS_FDCAN_ID_TYPE(pMessage->Header.IdType));
+  assert_param(IS_FDCAN_FRAME_TYPE(pMessage->Header.TxFrameType));
+  assert_param(IS_FDCAN_DLC(pMessage->Header.DataLength));
+  assert_param(IS_FDCAN_ESI(pMessage->Header.ErrorStateIndicator));
+  assert_param(IS_FDCAN_BRS(pMessage->Header.BitRateSwitch));
+  assert_param(IS_FDCAN_FDF(pMessage->Header.FDFormat));
+
+  if ((hfdcan->State != HAL_FDCAN_STATE_BUSY) || (pQueue == NULL))
+  {
+    /* Update error code */
+    hfdcan->ErrorCode |= HAL_FDCAN_ERROR_NOT_STARTED;
+
+    return HAL_ERROR;
+  }
+
+  /* Enter critical section: the queue is also refilled from the FDCAN interrupt */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  if (pQueue->Count >= pQueue->Size)
+  {
+    /* Exit critical section: restore previous priority mask */
+    __set_PRIMASK(primask_bit);
+
+    /* Update error code */
+    hfdcan->ErrorCode |= HAL_FDCAN_ERROR_FIFO_FULL;
+
+    return HAL_ERROR;
+  }
+
+  /* Keep the slots sorted by decreasing Priority value, the next message to send being the last one.
+     A new message is placed before the messages of equal priority to preserve submission order */
+  Index = pQueue->Count;
+  while ((Index > 0U) && (pQueue->pSlots[Index - 1U]->Priority <= pMessage->Priority))
+  {
+    pQueue->pSlots[Index] = pQueue->pSlots[Index - 1U];
+    Index--;
+  }
+  pQueue->pSlots[Index] = pMessage;
+  pQueue->Count++;
+
+  /* Hand the highest priority messages to the free Tx buffers */
+  FDCAN_TxQueue_Refill(hfdcan);
+
+  /* Exit critical section: restore previous priority mask */
+  __set_PRIMASK(primask_bit);
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Detach the software Tx priority queue.
+  * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified FDCAN.
+  * @note   Queued messages are dropped, messages already handed to the Tx FIFO/Queue
+  *         are still transmitted but not reported.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_FDCAN_TxQueue_Stop(FDCAN_HandleTypeDef *hfdcan)
+{
+  uint32_t primask_bit;
+
+  /* Enter critical section */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  hfdcan->pTxQueue = NULL;
+
+  /* Exit critical section: restore previous priority mask */
+  __set_PRIMASK(primask_bit);
+
+  /* Return function status */
+  return HAL_OK;
+}
+
 /**
   * @brief  Get an FDCAN frame from the Rx FIFO zone into the message RAM.
   * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
@@ -2363,6 +2869,236 @@ HAL_StatusTypeDef HAL_FDCAN_GetRxMessage(FDCAN_HandleTypeDef *hfdcan, uint32_t R
   }
 }
 
+/**
+  * @brief  Get all the FDCAN frames pending in a Rx FIFO, with a single acknowledge.
+  * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified FDCAN.
+  * @param  RxLocation Location of the received messages to be read.
+  *         This parameter can be a value of @arg FDCAN_Rx_location.
+  * @param  pRxHeaders pointer to an array of MaxCount FDCAN_RxHeaderTypeDef structures.
+  * @param  pRxData pointer to a buffer of MaxCount slots of DataStride bytes, the payload
+  *         of the message n being stored at pRxData + (n * DataStride).
+  * @param  DataStride Size in bytes of a payload slot (8 for classic frames, 64 for FD frames).
+  * @param  MaxCount Maximum number of messages to retrieve.
+  * @param  pCount pointer to the number of messages retrieved.
+  * @note   The retrieval stops before a message whose payload exceeds DataStride, this message
+  *         being left in the Rx FIFO and HAL_FDCAN_ERROR_PARAM set.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_FDCAN_GetRxMessages(FDCAN_HandleTypeDef *hfdcan, uint32_t RxLocation,
+                                          FDCAN_RxHeaderTypeDef *pRxHeaders, uint8_t *pRxData,
+                                          uint32_t DataStride, uint32_t MaxCount, uint32_t *pCount)
+{
+  const FDCAN_RxElementTypeDef *pElements[SRAMCAN_RF0_NBR];
+  const uint8_t *pData;
+  uint8_t *pDest;
+  uint32_t Pending;
+  uint32_t Count = 0U;
+  uint32_t ByteCounter;
+  uint32_t Bytes;
+  HAL_StatusTypeDef status = HAL_OK;
+
+  /* Check function parameters */
+  assert_param(IS_FDCAN_RX_FIFO(RxLocation));
+
+  if (pCount == NULL)
+  {
+    return HAL_ERROR;
+  }
+  *pCount = 0U;
+
+  if (hfdcan->State != HAL_FDCAN_STATE_BUSY)
+  {
+    /* Update error code */
+    hfdcan->ErrorCode |= HAL_FDCAN_ERROR_NOT_STARTED;
+
+    return HAL_ERROR;
+  }
+
+  Pending = HAL_FDCAN_PeekRxFifo(hfdcan, RxLocation, pElements, MaxCount);
+  if (Pending == 0U)
+  {
+    /* Update error code */
+    hfdcan->ErrorCode |= HAL_FDCAN_ERROR_FIFO_EMPTY;
+
+    return HAL_ERROR;
+  }
+
+  while (Count < Pending)
+  {
+    HAL_FDCAN_DecodeRxElement(pElements[Count], &pRxHeaders[Count]);
+
+    Bytes = DLCtoBytes[pRxHeaders[Count].DataLength];
+    if (Bytes > DataStride)
+    {
+      /* Update error code */
+      hfdcan->ErrorCode |= HAL_FDCAN_ERROR_PARAM;
+
+      status = HAL_ERROR;
+      break;
+    }
+
+    /* Retrieve Rx payload */
+    pData = (const uint8_t *)pElements[Count]->Data;
+    pDest = &pRxData[Count * DataStride];
+    for (ByteCounter = 0; ByteCounter < Bytes; ByteCounter++)
+    {
+      pDest[ByteCounter] = pData[ByteCounter];
+    }
+
+    Count++;
+  }
+
+  /* Acknowledge all the elements read at once */
+  if (Count != 0U)
+  {
+    (void)HAL_FDCAN_ReleaseRxFifo(hfdcan, RxLocation, Count);
+  }
+
+  *pCount = Count;
+
+  /* Return function status */
+  return status;
+}
+
+/**
+  * @brief  Get pointers to the FDCAN elements pending in a Rx FIFO of the message RAM.
+  * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified FDCAN.
+  * @param  RxLocation Location of the received messages to be read.
+  *         This parameter can be a value of @arg FDCAN_Rx_location.
+  * @param  pElements array of MaxCount pointers receiving the pending elements, oldest first.
+  * @param  MaxCount Maximum number of elements returned.
+  * @note   The elements stay in the message RAM until acknowledged with HAL_FDCAN_ReleaseRxFifo.
+  *         In Rx FIFO overwrite mode, the oldest element of a full FIFO is not returned, and
+  *         the returned elements may be overwritten if the FIFO stays full.
+  * @retval Number of elements returned.
+  */
+uint32_t HAL_FDCAN_PeekRxFifo(FDCAN_HandleTypeDef *hfdcan, uint32_t RxLocation,
+                              const FDCAN_RxElementTypeDef *pElements[], uint32_t MaxCount)
+{
+  uint32_t GetIndex;
+  uint32_t Pending;
+  uint32_t Index;
+
+  /* Check function parameters */
+  assert_param(IS_FDCAN_RX_FIFO(RxLocation));
+
+  if (hfdcan->State != HAL_FDCAN_STATE_BUSY)
+  {
+    return 0U;
+  }
+
+  Pending = FDCAN_GetRxFifoPending(hfdcan, RxLocation, &GetIndex);
+  if (Pending > MaxCount)
+  {
+    Pending = MaxCount;
+  }
+
+  for (Index = 0U; Index < Pending; Index++)
+  {
+    if (RxLocation == FDCAN_RX_FIFO0) /* Rx element is assigned to the Rx FIFO 0 */
+    {
+      pElements[Index] = (const FDCAN_RxElementTypeDef *)(hfdcan->msgRam.RxFIFO0SA +
+                                                          (((GetIndex + Index) % SRAMCAN_RF0_NBR) * SRAMCAN_RF0_SIZE));
+    }
+    else /* Rx element is assigned to the Rx FIFO 1 */
+    {
+      pElements[Index] = (const FDCAN_RxElementTypeDef *)(hfdcan->msgRam.RxFIFO1SA +
+                                                          (((GetIndex + Index) % SRAMCAN_RF1_NBR) * SRAMCAN_RF1_SIZE));
+    }
+  }
+
+  return Pending;
+}
+
+/**
+  * @brief  Acknowledge the oldest elements of a Rx FIFO processed in the message RAM.
+  * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified FDCAN.
+  * @param  RxLocation Location of the received messages.
+  *         This parameter can be a value of @arg FDCAN_Rx_location.
+  * @param  Count Number of elements returned by HAL_FDCAN_PeekRxFifo to acknowledge.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_FDCAN_ReleaseRxFifo(FDCAN_HandleTypeDef *hfdcan, uint32_t RxLocation, uint32_t Count)
+{
+  uint32_t GetIndex;
+  uint32_t Pending;
+
+  /* Check function parameters */
+  assert_param(IS_FDCAN_RX_FIFO(RxLocation));
+
+  if (hfdcan->State != HAL_FDCAN_STATE_BUSY)
+  {
+    /* Update error code */
+    hfdcan->ErrorCode |= HAL_FDCAN_ERROR_NOT_STARTED;
+
+    return HAL_ERROR;
+  }
+
+  Pending = FDCAN_GetRxFifoPending(hfdcan, RxLocation, &GetIndex);
+  if ((Count == 0U) || (Count > Pending))
+  {
+    /* Update error code */
+    hfdcan->ErrorCode |= HAL_FDCAN_ERROR_PARAM;
+
+    return HAL_ERROR;
+  }
+
+  if (RxLocation == FDCAN_RX_FIFO0) /* Rx element is assigned to the Rx FIFO 0 */
+  {
+    /* Acknowledge the last element read so that the GetIndex moves past all the elements read */
+    hfdcan->Instance->RXF0A = (GetIndex + Count - 1U) % SRAMCAN_RF0_NBR;
+  }
+  else /* Rx element is assigned to the Rx FIFO 1 */
+  {
+    /* Acknowledge the last element read so that the GetIndex moves past all the elements read */
+    hfdcan->Instance->RXF1A = (GetIndex + Count - 1U) % SRAMCAN_RF1_NBR;
+  }
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Decode the header of an FDCAN Rx FIFO element of the message RAM.
+  * @param  pElement pointer to an element returned by HAL_FDCAN_PeekRxFifo.
+  * @param  pRxHeader pointer to a FDCAN_RxHeaderTypeDef structure.
+  * @note   The payload can be read directly from pElement->Data.
+  * @retval None
+  */
+void HAL_FDCAN_DecodeRxElement(const FDCAN_RxElementTypeDef *pElement, FDCAN_RxHeaderTypeDef *pRxHeader)
+{
+  uint32_t R0 = pElement->Header[0U];
+  uint32_t R1 = pElement->Header[1U];
+
+  /* Retrieve IdType */
+  pRxHeader->IdType = R0 & FDCAN_ELEMENT_MASK_XTD;
+
+  /* Retrieve Identifier */
+  if (pRxHeader->IdType == FDCAN_STANDARD_ID) /* Standard ID element */
+  {
+    pRxHeader->Identifier = ((R0 & FDCAN_ELEMENT_MASK_STDID) >> 18U);
+  }
+  else /* Extended ID element */
+  {
+    pRxHeader->Identifier = (R0 & FDCAN_ELEMENT_MASK_EXTID);
+  }
+
+  /* Retrieve RxFrameType, ErrorStateIndicator */
+  pRxHeader->RxFrameType = (R0 & FDCAN_ELEMENT_MASK_RTR);
+  pRxHeader->ErrorStateIndicator = (R0 & FDCAN_ELEMENT_MASK_ESI);
+
+  /* Retrieve RxTimestamp, DataLength, BitRateSwitch, FDFormat, FilterIndex and NonMatchingFrame */
+  pRxHeader->RxTimestamp = (R1 & FDCAN_ELEMENT_MASK_TS);
+  pRxHeader->DataLength = ((R1 & FDCAN_ELEMENT_MASK_DLC) >> 16U);
+  pRxHeader->BitRateSwitch = (R1 & FDCAN_ELEMENT_MASK_BRS);
+  pRxHeader->FDFormat = (R1 & FDCAN_ELEMENT_MASK_FDF);
+  pRxHeader->FilterIndex = ((R1 & FDCAN_ELEMENT_MASK_FIDX) >> 24U);
+  pRxHeader->IsFilterMatchingFrame = ((R1 & FDCAN_ELEMENT_MASK_ANMF) >> 31U);
+}
+
 /**
   * @brief  Get an FDCAN Tx event from the Tx Event FIFO zone into the message RAM.
   * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
@@ -2914,6 +3650,8 @@ void HAL_FDCAN_IRQHandler(FDCAN_HandleTypeDef *hfdcan)
   uint32_t itsource;
   uint32_t itflag;
 
+  HAL_TRACE_ENTER(HAL_TRACE_ID_FDCAN_IRQ, hfdcan);
+
   TxEventFifoITs = hfdcan->Instance->IR & FDCAN_TX_EVENT_FIFO_MASK;
   TxEventFifoITs &= hfdcan->Instance->IE;
   RxFifo0ITs = hfdcan->Instance->IR & FDCAN_RX_FIFO0_MASK;
@@ -2973,13 +3711,24 @@ void HAL_FDCAN_IRQHandler(FDCAN_HandleTypeDef *hfdcan)
     /* Clear the Tx Event FIFO flags */
     __HAL_FDCAN_CLEAR_FLAG(hfdcan, TxEventFifoITs);
 
+    if (hfdcan->pTxQueue != NULL)
+    {
+      /* New Tx events complete the messages of the software Tx queue */
+      FDCAN_TxQueue_ProcessEvents(hfdcan);
+      FDCAN_TxQueue_Refill(hfdcan);
+      TxEventFifoITs &= ~FDCAN_FLAG_TX_EVT_FIFO_NEW_DATA;
+    }
+
+    if (TxEventFifoITs != 0U)
+    {
 #if USE_HAL_FDCAN_REGISTER_CALLBACKS == 1
-    /* Call registered callback*/
-    hfdcan->TxEventFifoCallback(hfdcan, TxEventFifoITs);
+      /* Call registered callback*/
+      hfdcan->TxEventFifoCallback(hfdcan, TxEventFifoITs);
 #else
-    /* Tx Event FIFO Callback */
-    HAL_FDCAN_TxEventFifoCallback(hfdcan, TxEventFifoITs);
+      /* Tx Event FIFO Callback */
+      HAL_FDCAN_TxEventFifoCallback(hfdcan, TxEventFifoITs);
 #endif /* USE_HAL_FDCAN_REGISTER_CALLBACKS */
+    }
   }
 
   /* Rx FIFO 0 interrupts management ******************************************/
@@ -3020,6 +3769,12 @@ void HAL_FDCAN_IRQHandler(FDCAN_HandleTypeDef *hfdcan)
       /* Clear the Tx FIFO empty flag */
       __HAL_FDCAN_CLEAR_FLAG(hfdcan, FDCAN_FLAG_TX_FIFO_EMPTY);
 
+      if (hfdcan->pTxQueue != NULL)
+      {
+        /* Refill the Tx FIFO/Queue from the software Tx queue */
+        FDCAN_TxQueue_Refill(hfdcan);
+      }
+
 #if USE_HAL_FDCAN_REGISTER_CALLBACKS == 1
       /* Call registered callback*/
       hfdcan->TxFifoEmptyCallback(hfdcan);
@@ -3042,6 +3797,12 @@ void HAL_FDCAN_IRQHandler(FDCAN_HandleTypeDef *hfdcan)
       /* Clear the Transmission Complete flag */
       __HAL_FDCAN_CLEAR_FLAG(hfdcan, FDCAN_FLAG_TX_COMPLETE);
 
+      if (hfdcan->pTxQueue != NULL)
+      {
+        /* Refill the Tx FIFO/Queue from the software Tx queue */
+        FDCAN_TxQueue_Refill(hfdcan);
+      }
+
 #if USE_HAL_FDCAN_REGISTER_CALLBACKS == 1
       /* Call registered callback*/
       hfdcan->TxBufferCompleteCallback(hfdcan, TransmittedBuffers);
@@ -3136,6 +3897,8 @@ void HAL_FDCAN_IRQHandler(FDCAN_HandleTypeDef *hfdcan)
     HAL_FDCAN_ErrorCallback(hfdcan);
 #endif /* USE_HAL_FDCAN_REGISTER_CALLBACKS */
   }
+
+  HAL_TRACE_EXIT(HAL_TRACE_ID_FDCAN_IRQ, hfdcan);
 }
 
 /**
@@ -3531,6 +4294,175 @@ static void FDCAN_CopyMessageToRAM(const FDCAN_HandleTypeDef *hfdcan, const FDCA
   }
 }
 
+/**
+  * @brief  Get the number of pending elements of a Rx FIFO and the index of the oldest one.
+  * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified FDCAN.
+  * @param  RxLocation Location of the received messages.
+  * @param  pGetIndex pointer to the index of the oldest pending element.
+  * @note   In overwrite mode, the oldest element of a full FIFO is skipped as it may be
+  *         overwritten at any time.
+  * @retval Number of pending elements.
+  */
+static uint32_t FDCAN_GetRxFifoPending(const FDCAN_HandleTypeDef *hfdcan, uint32_t RxLocation, uint32_t *pGetIndex)
+{
+  uint32_t Status;
+  uint32_t FillLevel;
+  uint32_t GetIndex;
+  uint32_t Overwrite;
+
+  if (RxLocation == FDCAN_RX_FIFO0) /* Rx element is assigned to the Rx FIFO 0 */
+  {
+    Status    = hfdcan->Instance->RXF0S;
+    FillLevel = Status & FDCAN_RXF0S_F0FL;
+    GetIndex  = (Status & FDCAN_RXF0S_F0GI) >> FDCAN_RXF0S_F0GI_Pos;
+    Overwrite = (((Status & FDCAN_RXF0S_F0F) != 0U) &&
+                 (((hfdcan->Instance->RXGFC & FDCAN_RXGFC_F0OM) >> FDCAN_RXGFC_F0OM_Pos) == FDCAN_RX_FIFO_OVERWRITE))
+                ? 1U : 0U;
+    if ((Overwrite == 1U) && (FillLevel != 0U))
+    {
+      GetIndex = (GetIndex + 1U) % SRAMCAN_RF0_NBR;
+      FillLevel--;
+    }
+  }
+  else /* Rx element is assigned to the Rx FIFO 1 */
+  {
+    Status    = hfdcan->Instance->RXF1S;
+    FillLevel = Status & FDCAN_RXF1S_F1FL;
+    GetIndex  = (Status & FDCAN_RXF1S_F1GI) >> FDCAN_RXF1S_F1GI_Pos;
+    Overwrite = (((Status & FDCAN_RXF1S_F1F) != 0U) &&
+                 (((hfdcan->Instance->RXGFC & FDCAN_RXGFC_F1OM) >> FDCAN_RXGFC_F1OM_Pos) == FDCAN_RX_FIFO_OVERWRITE))
+                ? 1U : 0U;
+    if ((Overwrite == 1U) && (FillLevel != 0U))
+    {
+      GetIndex = (GetIndex + 1U) % SRAMCAN_RF1_NBR;
+      FillLevel--;
+    }
+  }
+
+  *pGetIndex = GetIndex;
+
+  return FillLevel;
+}
+
+/**
+  * @brief  Hand the highest priority messages of the software Tx queue to the free Tx buffers.
+  * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified FDCAN.
+  * @note   A message is handed only when the message marker it will use is free, so that
+  *         each Tx event can be matched to its message.
+  * @retval None
+  */
+/**
+  * @brief  Count the filter elements needed by a list of identifier runs.
+  * @param  pFilters pointer to the runs, single identifiers having FilterID1 equal to FilterID2.
+  * @param  SegmentCount Number of runs.
+  * @retval Number of range elements plus dual elements pairing the single identifiers of same routing.
+  */
+static uint32_t FDCAN_CountFilterElements(const FDCAN_FilterTypeDef *pFilters, uint32_t SegmentCount)
+{
+  uint32_t Singles[8U] = {0U};
+  uint32_t Elements = 0U;
+  uint32_t Index;
+
+  for (Index = 0U; Index < SegmentCount; Index++)
+  {
+    if (pFilters[Index].FilterID1 != pFilters[Index].FilterID2)
+    {
+      Elements++;
+    }
+    else
+    {
+      Singles[pFilters[Index].FilterConfig & 0x7U]++;
+    }
+  }
+
+  for (Index = 0U; Index < 8U; Index++)
+  {
+    Elements += (Singles[Index] + 1U) / 2U;
+  }
+
+  return Elements;
+}
+
+static void FDCAN_TxQueue_Refill(FDCAN_HandleTypeDef *hfdcan)
+{
+  FDCAN_TxQueueTypeDef *pQueue = hfdcan->pTxQueue;
+  FDCAN_TxQueueMessageTypeDef *pMessage;
+  FDCAN_TxHeaderTypeDef TxHeader;
+  uint32_t PutIndex;
+
+  while ((pQueue->Count != 0U) && ((hfdcan->Instance->TXFQS & FDCAN_TXFQS_TFQF) == 0U) &&
+         (pQueue->pInFlight[pQueue->NextMarker] == NULL))
+  {
+    pMessage = pQueue->pSlots[pQueue->Count - 1U];
+    pQueue->Count--;
+
+    /* Store a Tx event tagged with the message marker */
+    TxHeader = pMessage->Header;
+    TxHeader.TxEventFifoControl = FDCAN_STORE_TX_EVENTS;
+    TxHeader.MessageMarker = pQueue->NextMarker;
+
+    /* Retrieve the Tx FIFO PutIndex */
+    PutIndex = ((hfdcan->Instance->TXFQS & FDCAN_TXFQS_TFQPI) >> FDCAN_TXFQS_TFQPI_Pos);
+
+    /* Add the message to the Tx FIFO/Queue */
+    FDCAN_CopyMessageToRAM(hfdcan, &TxHeader, pMessage->pData, PutIndex);
+
+    pQueue->pInFlight[pQueue->NextMarker] = pMessage;
+    pQueue->NextMarker = (pQueue->NextMarker + 1U) % FDCAN_TX_QUEUE_MARKER_NBR;
+
+    /* Activate the corresponding transmission request */
+    hfdcan->Instance->TXBAR = ((uint32_t)1 << PutIndex);
+
+    /* Store the Latest Tx FIFO/Queue Request Buffer Index */
+    hfdcan->LatestTxFifoQRequest = ((uint32_t)1 << PutIndex);
+  }
+}
+
+/**
+  * @brief  Read the Tx event FIFO and complete the matching messages of the software Tx queue.
+  * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified FDCAN.
+  * @retval None
+  */
+static void FDCAN_TxQueue_ProcessEvents(FDCAN_HandleTypeDef *hfdcan)
+{
+  FDCAN_TxQueueTypeDef *pQueue = hfdcan->pTxQueue;
+  FDCAN_TxQueueMessageTypeDef *pMessage;
+  const uint32_t *TxEventAddress;
+  uint32_t GetIndex;
+  uint32_t Marker;
+
+  while ((hfdcan->Instance->TXEFS & FDCAN_TXEFS_EFFL) != 0U)
+  {
+    /* Calculate Tx event FIFO element address, second word holding timestamp, event type and marker */
+    GetIndex = ((hfdcan->Instance->TXEFS & FDCAN_TXEFS_EFGI) >> FDCAN_TXEFS_EFGI_Pos);
+    TxEventAddress = (uint32_t *)(hfdcan->msgRam.TxEventFIFOSA + (GetIndex * SRAMCAN_TEF_SIZE));
+    TxEventAddress++;
+
+    Marker = ((*TxEventAddress & FDCAN_ELEMENT_MASK_MM) >> 24U);
+    if (Marker < FDCAN_TX_QUEUE_MARKER_NBR)
+    {
+      pMessage = pQueue->pInFlight[Marker];
+      if (pMessage != NULL)
+      {
+        pQueue->pInFlight[Marker] = NULL;
+        pMessage->TxTimestamp = (*TxEventAddress & FDCAN_ELEMENT_MASK_TS);
+        pMessage->EventType = (*TxEventAddress & FDCAN_ELEMENT_MASK_ET);
+
+        if (pQueue->pTxCompleteCallback != NULL)
+        {
+          pQueue->pTxCompleteCallback(hfdcan, pMessage);
+        }
+      }
+    }
+
+    /* Acknowledge the Tx Event FIFO that the oldest element is read so that it increments the GetIndex */
+    hfdcan->Instance->TXEFA = GetIndex;
+  }
+}
+
 /**
   * @}
   */
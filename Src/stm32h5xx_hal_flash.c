@@ -54,6 +54,11 @@
            (++) There Two modes of programming :
             (+++) Polling mode using HAL_FLASH_Program() function
             (+++) Interrupt mode using HAL_FLASH_Program_IT() function
+           (++) Programming of a buffer of quad-words (user area) in one call :
+            (+++) Polling mode using HAL_FLASHEx_ProgramBuffer() function, the next quad-word being
+                  written as soon as the write buffer is free
+            (+++) Interrupt mode using HAL_FLASHEx_ProgramBuffer_IT() function, with one
+                  HAL_FLASH_EndOfOperationCallback() call at the end of the buffer
 
       (#) Interrupts and flags management functions :
            (++) Handle FLASH interrupts by calling HAL_FLASH_IRQHandler()
@@ -110,7 +115,11 @@ FLASH_ProcessTypeDef pFlash = {.Lock = HAL_UNLOCKED, \
                                .Address = 0U, \
                                .Bank = FLASH_BANK_1, \
                                .Sector = 0U, \
-                               .NbSectorsToErase = 0U
+                               .NbSectorsToErase = 0U, \
+                               .DataAddress = 0U, \
+                               .NbQuadWordsToProgram = 0U, \
+                               .pQueue = NULL, \
+                               .pEccMonitor = NULL
                               };
 /**
   * @}
@@ -361,6 +370,170 @@ HAL_StatusTypeDef HAL_FLASH_Program_IT(uint32_t TypeProgram, uint32_t FlashAddre
   return status;
 }
 
+/**
+  * @brief  Program a buffer of quad-words at a specified address.
+  * @note   The next quad-word is written in the write buffer as soon as it is free, while the
+  *         previous one is programmed, and the completion is checked once at the end.
+  * @param  TypeProgram Indicate the way to program at a specified address.
+  *         This parameter can be FLASH_TYPEPROGRAM_QUADWORD or FLASH_TYPEPROGRAM_QUADWORD_NS
+  * @param  FlashAddress specifies the address to be programmed.
+  *         This parameter shall be aligned to the Flash word (128-bit)
+  * @param  DataAddress specifies the address of data to be programmed
+  *         This parameter shall be 32-bit aligned
+  * @param  Size specifies the number of bytes to be programmed, multiple of 16
+  * @retval HAL_StatusTypeDef HAL Status
+  */
+HAL_StatusTypeDef HAL_FLASHEx_ProgramBuffer(uint32_t TypeProgram, uint32_t FlashAddress, uint32_t DataAddress,
+                                            uint32_t Size)
+{
+  HAL_StatusTypeDef status;
+  __IO uint32_t *reg_cr;
+  const __IO uint32_t *reg_sr;
+  uint32_t remaining = Size;
+  uint32_t flash_address = FlashAddress;
+  uint32_t data_address = DataAddress;
+  uint32_t tickstart;
+
+  /* Check the parameters */
+  assert_param((TypeProgram & (~FLASH_NON_SECURE_MASK)) == FLASH_TYPEPROGRAM_QUADWORD);
+  assert_param(IS_FLASH_USER_MEM_ADDRESS(FlashAddress));
+
+  if ((Size == 0U) || ((Size & 0xFU) != 0U) || ((FlashAddress & 0xFU) != 0U) || ((DataAddress & 0x3U) != 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Reset error code */
+  pFlash.ErrorCode = HAL_FLASH_ERROR_NONE;
+
+  /* Wait for last operation to be completed */
+  status = FLASH_WaitForLastOperation(FLASH_TIMEOUT_VALUE);
+
+  if (status == HAL_OK)
+  {
+    /* Set current operation type */
+    pFlash.ProcedureOnGoing = TypeProgram;
+
+    /* Access to SECCR/NSCR and SECSR/NSSR depends on operation type */
+#if defined (FLASH_OPTSR2_TZEN)
+    reg_cr = IS_FLASH_SECURE_OPERATION() ? &(FLASH->SECCR) : &(FLASH_NS->NSCR);
+    reg_sr = IS_FLASH_SECURE_OPERATION() ? &(FLASH->SECSR) : &(FLASH_NS->NSSR);
+#else
+    reg_cr = &(FLASH_NS->NSCR);
+    reg_sr = &(FLASH_NS->NSSR);
+#endif /* FLASH_OPTSR2_TZEN */
+
+    tickstart = HAL_GetTick();
+
+    while (remaining != 0U)
+    {
+      if (((*reg_sr) & FLASH_FLAG_SR_ERRORS) != 0U)
+      {
+        /* Error reported by FLASH_WaitForLastOperation() */
+        break;
+      }
+      else if (((*reg_sr) & FLASH_FLAG_WBNE) == 0U)
+      {
+        /* Write buffer free: the previous quad-word is programmed from the data buffer meanwhile */
+        FLASH_Program_QuadWord(flash_address, data_address);
+        flash_address += 16U;
+        data_address += 16U;
+        remaining -= 16U;
+        tickstart = HAL_GetTick();
+      }
+      else if ((HAL_GetTick() - tickstart) > FLASH_TIMEOUT_VALUE)
+      {
+        status = HAL_TIMEOUT;
+        break;
+      }
+      else
+      {
+        /* Write buffer still full */
+      }
+    }
+
+    if (status == HAL_OK)
+    {
+      /* Wait for the last quad-words to be programmed */
+      status = FLASH_WaitForLastOperation(FLASH_TIMEOUT_VALUE);
+    }
+
+    /* If the program operation is completed, disable the PG */
+    CLEAR_BIT((*reg_cr), FLASH_CR_PG);
+  }
+
+  /* return status */
+  return status;
+}
+
+/**
+  * @brief  Program a buffer of quad-words at a specified address with interrupt enabled.
+  * @note   The quad-words are programmed one by one from HAL_FLASH_IRQHandler() and
+  *         HAL_FLASH_EndOfOperationCallback() is called once, with the address of the last
+  *         quad-word, at the end of the buffer. The data must stay available until then.
+  * @param  TypeProgram Indicate the way to program at a specified address.
+  *         This parameter can be FLASH_TYPEPROGRAM_QUADWORD or FLASH_TYPEPROGRAM_QUADWORD_NS
+  * @param  FlashAddress specifies the address to be programmed.
+  *         This parameter shall be aligned to the Flash word (128-bit)
+  * @param  DataAddress specifies the address of data to be programmed
+  *         This parameter shall be 32-bit aligned
+  * @param  Size specifies the number of bytes to be programmed, multiple of 16
+  * @retval HAL Status
+  */
+HAL_StatusTypeDef HAL_FLASHEx_ProgramBuffer_IT(uint32_t TypeProgram, uint32_t FlashAddress, uint32_t DataAddress,
+                                               uint32_t Size)
+{
+  HAL_StatusTypeDef status;
+  __IO uint32_t *reg_cr;
+
+  /* Check the parameters */
+  assert_param((TypeProgram & (~FLASH_NON_SECURE_MASK)) == FLASH_TYPEPROGRAM_QUADWORD);
+  assert_param(IS_FLASH_USER_MEM_ADDRESS(FlashAddress));
+
+  if ((Size == 0U) || ((Size & 0xFU) != 0U) || ((FlashAddress & 0xFU) != 0U) || ((DataAddress & 0x3U) != 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Reset error code */
+  pFlash.ErrorCode = HAL_FLASH_ERROR_NONE;
+
+  /* Wait for last operation to be completed */
+  status = FLASH_WaitForLastOperation(FLASH_TIMEOUT_VALUE);
+
+  if (status == HAL_OK)
+  {
+    /* Set internal variables used by the IRQ handler */
+    pFlash.ProcedureOnGoing = TypeProgram;
+    pFlash.Address = FlashAddress;
+    pFlash.DataAddress = DataAddress + 16U;
+    pFlash.NbQuadWordsToProgram = (Size / 16U) - 1U;
+
+    /* Access to SECCR or NSCR depends on operation type */
+#if defined (FLASH_OPTSR2_TZEN)
+    reg_cr = IS_FLASH_SECURE_OPERATION() ? &(FLASH->SECCR) : &(FLASH_NS->NSCR);
+#else
+    reg_cr = &(FLASH_NS->NSCR);
+#endif /* FLASH_OPTSR2_TZEN */
+
+    /* Enable End of Operation and Error interrupts */
+#if defined (FLASH_SR_OBKERR)
+    (*reg_cr) |= (FLASH_IT_EOP     | FLASH_IT_WRPERR | FLASH_IT_PGSERR | \
+                  FLASH_IT_STRBERR | FLASH_IT_INCERR | FLASH_IT_OBKERR | \
+                  FLASH_IT_OBKWERR);
+#else
+    (*reg_cr) |= (FLASH_IT_EOP     | FLASH_IT_WRPERR | FLASH_IT_PGSERR | \
+                  FLASH_IT_STRBERR | FLASH_IT_INCERR);
+#endif /* FLASH_SR_OBKERR */
+
+    /* Program the first quad-word, the next ones are programmed on End of Operation */
+    FLASH_Program_QuadWord(FlashAddress, DataAddress);
+  }
+
+  /* return status */
+  return status;
+}
+
 /**
   * @brief This function handles FLASH interrupt request.
   * @retval None
@@ -368,6 +541,7 @@ HAL_StatusTypeDef HAL_FLASH_Program_IT(uint32_t TypeProgram, uint32_t FlashAddre
 void HAL_FLASH_IRQHandler(void)
 {
   uint32_t param = 0U;
+  uint32_t buffer_ongoing = 0U;
   uint32_t errorflag;
   __IO uint32_t *reg_cr;
   __IO uint32_t *reg_ccr;
@@ -431,6 +605,7 @@ void HAL_FLASH_IRQHandler(void)
 
     /* Stop the procedure ongoing */
     pFlash.ProcedureOnGoing = 0U;
+    pFlash.NbQuadWordsToProgram = 0U;
 
     /* FLASH error interrupt user callback */
     HAL_FLASH_OperationErrorCallback(param);
@@ -462,19 +637,38 @@ void HAL_FLASH_IRQHandler(void)
         pFlash.ProcedureOnGoing = 0U;
       }
     }
+    else if (((pFlash.ProcedureOnGoing & (~FLASH_NON_SECURE_MASK)) == FLASH_TYPEPROGRAM_QUADWORD) &&
+             (pFlash.NbQuadWordsToProgram != 0U))
+    {
+      /* Program the next quad-word of the buffer */
+      pFlash.NbQuadWordsToProgram--;
+      pFlash.Address += 16U;
+      FLASH_Program_QuadWord(pFlash.Address, pFlash.DataAddress);
+      pFlash.DataAddress += 16U;
+      buffer_ongoing = 1U;
+    }
     else
     {
       /* Clear the procedure ongoing */
       pFlash.ProcedureOnGoing = 0U;
     }
 
-    /* FLASH EOP interrupt user callback */
-    HAL_FLASH_EndOfOperationCallback(param);
+    if (buffer_ongoing == 0U)
+    {
+      /* FLASH EOP interrupt user callback */
+      HAL_FLASH_EndOfOperationCallback(param);
+    }
   }
 
   /* Check FLASH ECC correction flag */
   if ((*reg_ecccorr & FLASH_ECCR_ECCC) != 0U)
   {
+    if (pFlash.pEccMonitor != NULL)
+    {
+      /* Log the corrected address */
+      FLASH_EccMonitorRecord(FLASH_ECC_EVENT_CORRECTION);
+    }
+
     /* Call User callback */
     HAL_FLASHEx_EccCorrectionCallback();
 
@@ -482,6 +676,12 @@ void HAL_FLASH_IRQHandler(void)
     FLASH->ECCCORR |= FLASH_ECCR_ECCC;
   }
 
+  if ((pFlash.ProcedureOnGoing == 0U) && (pFlash.pQueue != NULL))
+  {
+    /* Start the next operation of the background queue */
+    FLASH_QueueProcess(errorflag);
+  }
+
   if (pFlash.ProcedureOnGoing == 0U)
   {
     /* Disable Flash Operation and Error source interrupt */
@@ -49,6 +49,36 @@
            (++) There are two modes of erase :
              (+++) Polling Mode using HAL_FLASHEx_Erase()
              (+++) Interrupt Mode using HAL_FLASHEx_Erase_IT()
+           (++) Background operations queue, to erase and program the inactive bank while the code
+                keeps executing from the active bank (read-while-write):
+             (+++) Initialize the queue with HAL_FLASHEx_Queue_Init(), with a user array of operations
+             (+++) Enable the FLASH interrupt and call HAL_FLASH_IRQHandler() from FLASH_IRQHandler()
+             (+++) Queue sectors erase and buffer program operations with HAL_FLASHEx_Queue_Add(): they
+                   are run one after the other from the FLASH interrupt
+             (+++) HAL_FLASHEx_QueueProgressCallback() is called after each completed operation.
+                   On error, HAL_FLASH_OperationErrorCallback() is called and the queue is flushed
+
+      (#) Flash high-cycle data key-value store (EEPROM emulation):
+           (++) Enable the high-cycle data sectors with HAL_FLASHEx_OBProgram() (OPTIONBYTE_EDATA)
+           (++) Fill Bank, FirstSector, NbSectors, pIndex and NbKeys of a FLASH_EEStoreTypeDef
+                structure and call HAL_FLASHEx_EEStore_Init(): the latest record of each key is
+                indexed in the pIndex RAM array, the store being formatted if empty
+           (++) Read a value with HAL_FLASHEx_EEStore_Read(), from the index without any search
+           (++) Write a value with HAL_FLASHEx_EEStore_Write(): a record is appended in the log
+                with 16-bit programming, the sectors are never rewritten
+           (++) The oldest sector is compacted a few records per write once the store is almost full,
+                and erased when it holds no latest record anymore. HAL_FLASHEx_EEStore_Compact()
+                can also be called in idle time
+
+      (#) Dual-bank image update (A/B over-the-air update):
+           (++) Fill ImageSize, and optionally hhash and pDigest, of a FLASH_OTATypeDef structure and
+                call HAL_FLASHEx_OTA_Start(): the image is written in the inactive bank, the one
+                mapped at FLASH_BASE + FLASH_BANK_SIZE
+           (++) Pass the image chunks as they are received to HAL_FLASHEx_OTA_Write(): the sectors
+                are erased as they are reached, the chunk is programmed while the HASH peripheral
+                computes its digest by DMA, the expected digest is checked with the last chunk
+           (++) Call HAL_FLASHEx_OTA_Swap() to toggle the SWAP_BANK option byte, the new image is
+                executed after the next system reset
 
       (#) Option Bytes Programming functions: Use HAL_FLASHEx_OBProgram() to:
         (++) Configure the write protection per bank
@@ -99,6 +129,21 @@
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
+#if defined (FLASH_EDATAR_EDATA_EN)
+/** @defgroup FLASHEx_Private_Constants_EEStore FLASHEx EEStore Private Constants
+  * @{
+  */
+#define FLASH_EESTORE_RECORD_SIZE    8U       /* Key, value low and high half-words, check half-word */
+#define FLASH_EESTORE_SLOTS          (FLASH_EDATA_SECTOR_SIZE / FLASH_EESTORE_RECORD_SIZE) /* Records per sector,
+                                                                                              header included */
+#define FLASH_EESTORE_MAGIC          0x5AA5U  /* Sector header marker, also used in the record check */
+#define FLASH_EESTORE_ERASED         0xFFFFU  /* Erased half-word */
+#define FLASH_EESTORE_NO_RECORD      0xFFFFU  /* Index entry of a key never written */
+#define FLASH_EESTORE_COMPACT_STEP   4U       /* Records moved per compaction step */
+/**
+  * @}
+  */
+#endif /* FLASH_EDATAR_EDATA_EN */
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
@@ -106,6 +151,19 @@
   * @{
   */
 static void FLASH_MassErase(uint32_t Banks);
+static uint32_t FLASH_QueueGetBank(uint32_t Address);
+static void FLASH_QueueRun(FLASH_QueueTypeDef *pQueue);
+static void FLASH_EccDecode(uint32_t EccReg, FLASH_EccInfoTypeDef *pData);
+#if defined (FLASH_EDATAR_EDATA_EN)
+static void FLASH_EccRelocate(FLASH_EEStoreTypeDef *pStore, const FLASH_EccLogEntryTypeDef *pEntry);
+#endif /* FLASH_EDATAR_EDATA_EN */
+#if defined (FLASH_EDATAR_EDATA_EN)
+static HAL_StatusTypeDef FLASH_EEStoreEraseSectors(const FLASH_EEStoreTypeDef *pStore, uint32_t Sector,
+                                                   uint32_t NbSectors);
+static HAL_StatusTypeDef FLASH_EEStoreOpenSector(FLASH_EEStoreTypeDef *pStore, uint32_t Sector);
+static HAL_StatusTypeDef FLASH_EEStoreAppend(FLASH_EEStoreTypeDef *pStore, uint32_t Key, uint32_t Value);
+static uint32_t FLASH_EEStoreFreeSectors(const FLASH_EEStoreTypeDef *pStore);
+#endif /* FLASH_EDATAR_EDATA_EN */
 #if defined (FLASH_SR_OBKERR)
 static void FLASH_OBKErase(void);
 #endif /* FLASH_SR_OBKERR */
@@ -320,6 +378,168 @@ HAL_StatusTypeDef HAL_FLASHEx_Erase_IT(FLASH_EraseInitTypeDef *pEraseInit)
   return status;
 }
 
+/**
+  * @brief  Initialize the background operations queue.
+  * @param  pQueue pointer to the queue structure
+  * @param  pOps pointer to the operations array of the queue
+  * @param  Size number of operations of the array
+  * @retval HAL Status
+  */
+HAL_StatusTypeDef HAL_FLASHEx_Queue_Init(FLASH_QueueTypeDef *pQueue, FLASH_QueueOpTypeDef *pOps, uint32_t Size)
+{
+  if ((pQueue == NULL) || (pOps == NULL) || (Size == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  if ((pFlash.pQueue != NULL) && (pFlash.pQueue->Active != 0U))
+  {
+    return HAL_BUSY;
+  }
+
+  pQueue->pOps        = pOps;
+  pQueue->Size        = Size;
+  pQueue->Head        = 0U;
+  pQueue->Tail        = 0U;
+  pQueue->NbPending   = 0U;
+  pQueue->NbCompleted = 0U;
+  pQueue->Active      = 0U;
+  pQueue->ErrorCode   = HAL_FLASH_ERROR_NONE;
+
+  pFlash.pQueue = pQueue;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  De-initialize the background operations queue.
+  * @param  pQueue pointer to the queue structure
+  * @retval HAL Status
+  */
+HAL_StatusTypeDef HAL_FLASHEx_Queue_DeInit(FLASH_QueueTypeDef *pQueue)
+{
+  if ((pQueue == NULL) || (pFlash.pQueue != pQueue))
+  {
+    return HAL_ERROR;
+  }
+
+  if (pQueue->Active != 0U)
+  {
+    return HAL_BUSY;
+  }
+
+  pFlash.pQueue = NULL;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Queue an operation on the inactive bank, started at once if the FLASH is idle.
+  * @note   The operations on the bank the code is executed from are rejected, the
+  *         operation being otherwise blocking for the CPU.
+  * @note   The FLASH control register must be unlocked with HAL_FLASH_Unlock().
+  * @param  pQueue pointer to the queue structure
+  * @param  pOp pointer to the operation, copied in the queue
+  * @retval HAL Status
+  */
+HAL_StatusTypeDef HAL_FLASHEx_Queue_Add(FLASH_QueueTypeDef *pQueue, const FLASH_QueueOpTypeDef *pOp)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t active_bank;
+  uint32_t op_bank;
+  uint32_t primask_bit;
+
+  if ((pQueue == NULL) || (pOp == NULL) || (pFlash.pQueue != pQueue))
+  {
+    return HAL_ERROR;
+  }
+
+  if ((pOp->Operation & (~FLASH_NON_SECURE_MASK)) == FLASH_TYPEERASE_SECTORS)
+  {
+    /* Check the parameters */
+    assert_param(IS_FLASH_SECTOR(pOp->Sector));
+
+    if ((pOp->NbSectors == 0U) || ((pOp->Banks != FLASH_BANK_1) && (pOp->Banks != FLASH_BANK_2)))
+    {
+      return HAL_ERROR;
+    }
+    op_bank = pOp->Banks;
+  }
+  else if ((pOp->Operation & (~FLASH_NON_SECURE_MASK)) == FLASH_TYPEPROGRAM_QUADWORD)
+  {
+    /* Check the parameters */
+    assert_param(IS_FLASH_USER_MEM_ADDRESS(pOp->FlashAddress));
+
+    if ((pOp->Size == 0U) || ((pOp->Size & 0xFU) != 0U) ||
+        (FLASH_QueueGetBank(pOp->FlashAddress) != FLASH_QueueGetBank(pOp->FlashAddress + pOp->Size - 1U)))
+    {
+      return HAL_ERROR;
+    }
+    op_bank = FLASH_QueueGetBank(pOp->FlashAddress);
+  }
+  else
+  {
+    return HAL_ERROR;
+  }
+
+  /* Bank the code is executed from, not accessible during the operation */
+  active_bank = FLASH_QueueGetBank((uint32_t)&HAL_FLASHEx_Queue_Add);
+
+  if (op_bank == active_bank)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Enter critical section: the queue is also updated by the FLASH interrupt */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  if (pQueue->NbPending == pQueue->Size)
+  {
+    status = HAL_BUSY;
+  }
+  else
+  {
+    pQueue->pOps[pQueue->Head] = *pOp;
+    pQueue->Head = (pQueue->Head + 1U) % pQueue->Size;
+    pQueue->NbPending++;
+
+    /* Started by the FLASH interrupt if an operation is on-going */
+    if ((pQueue->Active == 0U) && (pFlash.ProcedureOnGoing == 0U))
+    {
+      pQueue->ErrorCode = HAL_FLASH_ERROR_NONE;
+      FLASH_QueueRun(pQueue);
+
+      if (pQueue->Active == 0U)
+      {
+        status = HAL_ERROR;
+      }
+    }
+  }
+
+  /* Exit critical section: restore previous priority mask */
+  __set_PRIMASK(primask_bit);
+
+  return status;
+}
+
+/**
+  * @brief  FLASH background queue progress callback.
+  * @param  NbCompleted Number of operations completed since the queue initialization
+  * @param  NbPending Number of operations still queued
+  * @retval None
+  */
+__weak void HAL_FLASHEx_QueueProgressCallback(uint32_t NbCompleted, uint32_t NbPending)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(NbCompleted);
+  UNUSED(NbPending);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_FLASHEx_QueueProgressCallback could be implemented in the user file
+   */
+}
+
 /**
   * @brief  Program option bytes
   * @param  pOBInit pointer to an FLASH_OBInitStruct structure that
@@ -1020,158 +1240,569 @@ void FLASH_Erase_Sector(uint32_t Sector, uint32_t Banks)
   }
 }
 
-#if defined (FLASH_SR_OBKERR)
 /**
-  * @brief  Erase of FLASH OBK
+  * @brief  Complete the on-going operation of the background queue and start the next one.
+  * @note   Called by HAL_FLASH_IRQHandler() once the FLASH procedure is over.
+  * @param  ErrorFlags FLASH error flags of the completed operation
   * @retval None
   */
-static void FLASH_OBKErase()
+void FLASH_QueueProcess(uint32_t ErrorFlags)
 {
-  __IO uint32_t *reg_obkcfgr;
+  FLASH_QueueTypeDef *queue = pFlash.pQueue;
 
-  /* Access to SECOBKCFGR or NSOBKCFGR registers depends on operation type */
-  reg_obkcfgr = IS_FLASH_SECURE_OPERATION() ? &(FLASH->SECOBKCFGR) : &(FLASH_NS->NSOBKCFGR);
+  if (queue->Active != 0U)
+  {
+    queue->Active = 0U;
 
-  /* Set OBK Erase Bit */
-  SET_BIT((*reg_obkcfgr), FLASH_OBKCFGR_ALT_SECT_ERASE);
+    if (ErrorFlags != 0U)
+    {
+      /* The following operations may depend on the failed one: flush the queue */
+      queue->ErrorCode = ErrorFlags;
+      queue->Head = queue->Tail;
+      queue->NbPending = 0U;
+    }
+    else
+    {
+      queue->Tail = (queue->Tail + 1U) % queue->Size;
+      queue->NbPending--;
+      queue->NbCompleted++;
+
+      HAL_FLASHEx_QueueProgressCallback(queue->NbCompleted, queue->NbPending);
+    }
+  }
+
+  /* The callback may have queued and started an operation */
+  if ((queue->Active == 0U) && (queue->NbPending != 0U) && (pFlash.ProcedureOnGoing == 0U))
+  {
+    FLASH_QueueRun(queue);
+  }
 }
-#endif /* FLASH_SR_OBKERR */
 
 /**
-  * @brief  Enable the write protection of the desired bank1 or bank 2 sectors
-  * @param  WRPSector specifies the sectors to be write protected.
-  *         This parameter can be a value of @ref FLASH_OB_Write_Protection_Sectors
-  *
-  * @param  Banks the specific bank to apply WRP sectors
-  *          This parameter can be one of the following values:
-  *            @arg FLASH_BANK_1: enable WRP on specified bank1 sectors
-  *            @arg FLASH_BANK_2: enable WRP on specified bank2 sectors
-  *            @arg FLASH_BANK_BOTH: enable WRP on both bank1 and bank2 specified sectors
-  *
+  * @brief  Start the operation at the tail of the background queue.
+  * @note   The queue is flushed if the operation cannot be started.
+  * @param  pQueue pointer to the queue structure
   * @retval None
   */
-static void FLASH_OB_EnableWRP(uint64_t WRPSector, uint32_t Banks)
+static void FLASH_QueueRun(FLASH_QueueTypeDef *pQueue)
 {
-  /* Check the parameters */
-  assert_param(IS_FLASH_BANK(Banks));
-#if defined(OB_WRP_SECTOR_128TO131)
-  uint32_t WRPSector_Group1 = (uint32_t)(WRPSector & 0xFFFFFFFF);
-  uint32_t WRPSector_Group2 = (uint32_t)((WRPSector >> 32) & 0xFFFFFFFF);
-  if ((Banks & FLASH_BANK_1) == FLASH_BANK_1)
+  FLASH_EraseInitTypeDef erase_init;
+  const FLASH_QueueOpTypeDef *op = &pQueue->pOps[pQueue->Tail];
+  HAL_StatusTypeDef status;
+
+  pQueue->Active = 1U;
+
+  if ((op->Operation & (~FLASH_NON_SECURE_MASK)) == FLASH_TYPEERASE_SECTORS)
   {
-    if (WRPSector_Group1 != 0)
-    {
-        /* Enable Write Protection for bank 1 Group1 */
-        FLASH->WRP11R_PRG &= (~(WRPSector_Group1 & FLASH_WRPR_WRPSG));
-    }
-    if (WRPSector_Group2 != 0)
-    {
-        /* Enable Write Protection for bank 1 Group2 */
-        FLASH->WRP12R_PRG &= (~(WRPSector_Group2 & FLASH_WRPR_WRPSG));
-    }
+    erase_init.TypeErase = op->Operation;
+    erase_init.Banks     = op->Banks;
+    erase_init.Sector    = op->Sector;
+    erase_init.NbSectors = op->NbSectors;
+    status = HAL_FLASHEx_Erase_IT(&erase_init);
   }
-  if ((Banks & FLASH_BANK_2) == FLASH_BANK_2)
+  else
   {
-    if (WRPSector_Group1 != 0)
-    {
-        /* Enable Write Protection for bank 2 Group1 */
-        FLASH->WRP21R_PRG &= (~(WRPSector_Group1 & FLASH_WRPR_WRPSG));
-    }
-    if (WRPSector_Group2 != 0)
-    {
-        /* Enable Write Protection for bank 2 Group2 */
-        FLASH->WRP22R_PRG &= (~(WRPSector_Group2 & FLASH_WRPR_WRPSG));
-    }
+    status = HAL_FLASHEx_ProgramBuffer_IT(op->Operation, op->FlashAddress, op->DataAddress, op->Size);
   }
-#else
-  if ((Banks & FLASH_BANK_1) == FLASH_BANK_1)
+
+  if (status != HAL_OK)
   {
-    /* Enable Write Protection for bank 1 */
-    FLASH->WRP1R_PRG &= (~((uint32_t)(WRPSector & FLASH_WRPR_WRPSG)));
+    pQueue->ErrorCode = pFlash.ErrorCode;
+    pQueue->Head = pQueue->Tail;
+    pQueue->NbPending = 0U;
+    pQueue->Active = 0U;
   }
+}
 
-  if ((Banks & FLASH_BANK_2) == FLASH_BANK_2)
+/**
+  * @brief  Get the bank of an address of the user Flash, the bank swap being taken into account.
+  * @param  Address address in the user Flash
+  * @retval FLASH_BANK_1 or FLASH_BANK_2
+  */
+static uint32_t FLASH_QueueGetBank(uint32_t Address)
+{
+  uint32_t bank = ((Address - FLASH_BASE) < FLASH_BANK_SIZE) ? FLASH_BANK_1 : FLASH_BANK_2;
+
+  if ((FLASH->OPTSR_CUR & FLASH_OPTSR_SWAP_BANK) != 0U)
   {
-    /* Enable Write Protection for bank 2 */
-    FLASH->WRP2R_PRG &= (~((uint32_t)(WRPSector & FLASH_WRPR_WRPSG)));
+    bank = (bank == FLASH_BANK_1) ? FLASH_BANK_2 : FLASH_BANK_1;
   }
-#endif /* OB_WRP_SECTOR_128TO131 */
+
+  return bank;
 }
 
 /**
-  * @brief  Disable the write protection of the desired bank1 or bank 2 sectors
-  * @param  WRPSector specifies the sectors to disable write protection.
-  *         This parameter can be a value of @ref FLASH_OB_Write_Protection_Sectors
-  *
-  * @param  Banks the specific bank to apply WRP sectors
-  *          This parameter can be one of the following values:
-  *            @arg FLASH_BANK_1: disable WRP on specified bank1 sectors
-  *            @arg FLASH_BANK_2: disable WRP on specified bank2 sectors
-  *            @arg FLASH_BANK_BOTH: disable WRP on both bank1 and bank2 specified sectors
-  *
+  * @brief  Decode the area and the address of an ECC error.
+  * @param  EccReg value of the ECCCORR or ECCDETR register
+  * @param  pData Pointer to an FLASH_EccInfoTypeDef structure receiving the area and the address
   * @retval None
   */
-static void FLASH_OB_DisableWRP(uint64_t WRPSector, uint32_t Banks)
+static void FLASH_EccDecode(uint32_t EccReg, FLASH_EccInfoTypeDef *pData)
 {
-  /* Check the parameters */
-  assert_param(IS_FLASH_BANK(Banks));
-#if defined(OB_WRP_SECTOR_128TO131)
-  uint32_t WRPSector_Group1 = (uint32_t)(WRPSector & 0xFFFFFFFF);
-  uint32_t WRPSector_Group2 = (uint32_t)((WRPSector >> 32) & 0xFFFFFFFF);
-  if ((Banks & FLASH_BANK_1) == FLASH_BANK_1)
+  uint32_t addr_reg = (EccReg & FLASH_ECCR_ADDR_ECC);
+
+  /* Get area value, the flags and the interrupt enable excluded */
+  pData->Area = EccReg & (~(FLASH_ECCR_ECCIE | FLASH_ECCR_ADDR_ECC | FLASH_ECCR_ECCC | FLASH_ECCR_ECCD));
+
+  /* Get address value according to area value*/
+  switch (pData->Area)
+  {
+    case FLASH_ECC_AREA_USER_BANK1:
+      /*
+       * One error detection/correction or two error detections per 128-bit flash word
+       * Therefore, the address returned by ECC registers in bank1 represents 128-bit flash word,
+       * to get the correct address value, we must do a shift by 4 bits
+      */
+      addr_reg = ((uint32_t)addr_reg << 4U) & 0xFFFFFFFFU;
+      pData->Address = (FLASH_BASE + addr_reg) & 0xFFFFFFFFU;
+      break;
+    case FLASH_ECC_AREA_USER_BANK2:
+      /*
+       * One error detection/correction or two error detections per 128-bit flash word
+       * Therefore, the address returned by ECC registers in bank2 represents 128-bit flash word,
+       * to get the correct address value, we must do a shift by 4 bits
+      */
+      addr_reg = ((uint32_t)addr_reg << 4U) & 0xFFFFFFFFU;
+      pData->Address = (FLASH_BASE + FLASH_BANK_SIZE + addr_reg) & 0xFFFFFFFFU;
+      break;
+    case FLASH_ECC_AREA_SYSTEM:
+      /* check system flash bank */
+      if ((EccReg & FLASH_ECCR_BK_ECC) == FLASH_ECCR_BK_ECC)
+      {
+        pData->Address = (FLASH_SYSTEM_BASE + FLASH_SYSTEM_SIZE + addr_reg) & 0xFFFFFFFFU;
+      }
+      else
+      {
+        pData->Address = (FLASH_SYSTEM_BASE + addr_reg) & 0xFFFFFFFFU;
+      }
+      break;
+#if defined (FLASH_SR_OBKERR)
+    case FLASH_ECC_AREA_OBK:
+      pData->Address = (FLASH_OBK_BASE + addr_reg) & 0xFFFFFFFFU;
+      break;
+#endif /* FLASH_SR_OBKERR */
+#if defined (FLASH_EDATAR_EDATA_EN)
+    case FLASH_ECC_AREA_EDATA_BANK1:
+      /* check flash high-cycle data bank */
+        /*
+         * addr_reg is the address returned by the ECC register along with an offset value depends on area
+         * To calculate the exact address set by user while an ECC occurred, we must subtract the offset value,
+         * In addition, the address returned by ECC registers represents 128-bit flash word (multiply by 4),
+        */
+        pData->Address = (FLASH_EDATA_BASE + ((addr_reg - FLASH_ADDRESS_OFFSET_EDATA) * 4U)) & 0xFFFFFFFFU;
+      break;
+    case FLASH_ECC_AREA_EDATA_BANK2:
+      /* check flash high-cycle data bank */
+        /*
+         * addr_reg is the address returned by the ECC register along with an offset value depends on area
+         * To calculate the exact address set by user while an ECC occurred, we must subtract the offset value,
+         * In addition, the address returned by ECC registers represents 128-bit flash word (multiply by 4),
+        */
+        pData->Address = (FLASH_EDATA_BASE + FLASH_EDATA_BANK_SIZE + \
+                         ((addr_reg - FLASH_ADDRESS_OFFSET_EDATA) * 4U)) & 0xFFFFFFFFU;
+      break;
+#endif /* FLASH_EDATAR_EDATA_EN */
+    case FLASH_ECC_AREA_OTP:
+      /* Address returned by the ECC is an halfword, multiply by 4 to get the exact address*/
+      pData->Address = (FLASH_OTP_BASE + ((addr_reg - FLASH_ADDRESS_OFFSET_OTP) * 4U)) & 0xFFFFFFFFU;
+      break;
+
+    default:
+      /* Do nothing */
+      break;
+  }
+}
+
+/**
+  * @brief  Log the address of an ECC error in the monitor.
+  * @note   Called from the ECC correction interrupt and the ECC detection NMI, before
+  *         the ECC flag is cleared.
+  * @param  Event ECC error event, a value of @ref FLASH_ECC_Event
+  * @retval None
+  */
+void FLASH_EccMonitorRecord(uint32_t Event)
+{
+  FLASH_EccMonitorTypeDef *monitor = pFlash.pEccMonitor;
+  FLASH_EccInfoTypeDef info = {0};
+  FLASH_EccLogEntryTypeDef *entry;
+  uint32_t index;
+
+  if (Event == FLASH_ECC_EVENT_CORRECTION)
   {
-    if (WRPSector_Group1 != 0)
-    {
-      /* Disable Write Protection for bank 1 group1 */
-      FLASH->WRP11R_PRG |= (WRPSector_Group1 & FLASH_WRPR_WRPSG);
-    }
-    if (WRPSector_Group2 != 0)
-    {
-      /* Disable Write Protection for bank 1 group2 */
-      FLASH->WRP12R_PRG |= (WRPSector_Group2 & FLASH_WRPR_WRPSG);
-    }
+    FLASH_EccDecode(FLASH->ECCCORR, &info);
+    monitor->NbCorrections++;
+  }
+  else
+  {
+    FLASH_EccDecode(FLASH->ECCDETR, &info);
+    monitor->NbDetections++;
   }
 
-  if ((Banks & FLASH_BANK_2) == FLASH_BANK_2)
+  /* An address already logged is only counted */
+  for (index = 0U; index < monitor->NbEntries; index++)
   {
-    if (WRPSector_Group1 != 0)
-    {
-      /* Disable Write Protection for bank 2 group1 */
-      FLASH->WRP21R_PRG |= (WRPSector_Group1 & FLASH_WRPR_WRPSG);
-    }
-    if (WRPSector_Group2 != 0)
+    entry = &monitor->pLog[index];
+    if ((entry->Address == info.Address) && (entry->Event == Event))
     {
-      /* Disable Write Protection for bank 2 group2 */
-      FLASH->WRP22R_PRG |= (WRPSector_Group2 & FLASH_WRPR_WRPSG);
+      entry->Count++;
+      return;
     }
   }
-#else
-  if ((Banks & FLASH_BANK_1) == FLASH_BANK_1)
+
+  if (monitor->NbEntries < monitor->Size)
   {
-    /* Disable Write Protection for bank 1 */
-    FLASH->WRP1R_PRG |= (uint32_t)(WRPSector & FLASH_WRPR_WRPSG);
+    entry = &monitor->pLog[monitor->NbEntries];
+    entry->Area    = info.Area;
+    entry->Address = info.Address;
+    entry->Event   = Event;
+    entry->Count   = 1U;
+    entry->Handled = 0U;
+    monitor->NbEntries++;
   }
-
-  if ((Banks & FLASH_BANK_2) == FLASH_BANK_2)
+  else
   {
-    /* Disable Write Protection for bank 2 */
-    FLASH->WRP2R_PRG |= (uint32_t)(WRPSector & FLASH_WRPR_WRPSG);
+    monitor->NbLost++;
   }
-#endif /* OB_WRP_SECTOR_128TO131 */
 }
 
+#if defined (FLASH_EDATAR_EDATA_EN)
 /**
-  * @brief  Get the write protection of the given bank 1 or bank 2 sectors
-  * @param[in]  Bank specifies the bank where to get the write protection sectors.
-  *         This parameter can be exclusively one of the following values:
-  *         @arg FLASH_BANK_1: Get bank1 WRP sectors
-  *         @arg FLASH_BANK_2: Get bank2 WRP sectors
-  *
-  * @param[out]  WRPState returns the write protection state of the returned sectors.
-  *         This parameter can be one of the following values:
-  *         @arg WRPState: OB_WRPSTATE_DISABLE or OB_WRPSTATE_ENABLE
-
-  * @param[out]  WRPSector returns the write protected sectors on the given bank .
+  * @brief  Relocate the record of the key-value store hit by an ECC error.
+  * @note   A corrected record is written again at the head of the store. A record with a
+  *         double error is dropped from the index, its read failing instead of raising an NMI.
+  * @param  pStore pointer to the store structure
+  * @param  pEntry pointer to the ECC log entry
+  * @retval None
+  */
+static void FLASH_EccRelocate(FLASH_EEStoreTypeDef *pStore, const FLASH_EccLogEntryTypeDef *pEntry)
+{
+  uint32_t location;
+  uint32_t address;
+  uint32_t key;
+
+  if ((pEntry->Address < pStore->BaseAddress) ||
+      (pEntry->Address >= (pStore->BaseAddress + (pStore->NbSectors * FLASH_EDATA_SECTOR_SIZE))))
+  {
+    return;
+  }
+
+  location = (pEntry->Address - pStore->BaseAddress) / FLASH_EESTORE_RECORD_SIZE;
+
+  /* The key is searched in the index: the failing record is not read */
+  for (key = 0U; key < pStore->NbKeys; key++)
+  {
+    if (pStore->pIndex[key] == location)
+    {
+      if (pEntry->Event == FLASH_ECC_EVENT_CORRECTION)
+      {
+        address = pStore->BaseAddress + (location * FLASH_EESTORE_RECORD_SIZE);
+        (void)FLASH_EEStoreAppend(pStore, key, (uint32_t)(*(__IO uint16_t *)(address + 2U)) |
+                                  ((uint32_t)(*(__IO uint16_t *)(address + 4U)) << 16U));
+      }
+      else
+      {
+        pStore->LiveCount[location / FLASH_EESTORE_SLOTS]--;
+        pStore->pIndex[key] = FLASH_EESTORE_NO_RECORD;
+      }
+      break;
+    }
+  }
+}
+#endif /* FLASH_EDATAR_EDATA_EN */
+
+#if defined (FLASH_EDATAR_EDATA_EN)
+/**
+  * @brief  Erase sectors of the key-value store.
+  * @param  pStore pointer to the store structure
+  * @param  Sector first sector to erase, position in the store
+  * @param  NbSectors number of sectors to erase
+  * @retval HAL Status
+  */
+static HAL_StatusTypeDef FLASH_EEStoreEraseSectors(const FLASH_EEStoreTypeDef *pStore, uint32_t Sector,
+                                                   uint32_t NbSectors)
+{
+  FLASH_EraseInitTypeDef erase_init;
+  uint32_t sector_error;
+
+  /* The high-cycle data sectors are the last sectors of the bank */
+  erase_init.TypeErase = FLASH_TYPEERASE_SECTORS;
+  erase_init.Banks     = pStore->Bank;
+  erase_init.Sector    = (FLASH_SECTOR_NB - FLASH_EDATA_SECTOR_NB) + pStore->FirstSector + Sector;
+  erase_init.NbSectors = NbSectors;
+
+  return HAL_FLASHEx_Erase(&erase_init, &sector_error);
+}
+
+/**
+  * @brief  Open a sector of the key-value store for writing.
+  * @note   The sector is erased if not blank, after an interrupted erase for instance.
+  * @param  pStore pointer to the store structure
+  * @param  Sector sector to open, position in the store
+  * @retval HAL Status
+  */
+static HAL_StatusTypeDef FLASH_EEStoreOpenSector(FLASH_EEStoreTypeDef *pStore, uint32_t Sector)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t address = pStore->BaseAddress + (Sector * FLASH_EDATA_SECTOR_SIZE);
+  uint16_t data;
+  uint32_t offset;
+
+  for (offset = 0U; offset < FLASH_EDATA_SECTOR_SIZE; offset += 2U)
+  {
+    if (*(__IO uint16_t *)(address + offset) != FLASH_EESTORE_ERASED)
+    {
+      status = FLASH_EEStoreEraseSectors(pStore, Sector, 1U);
+      break;
+    }
+  }
+
+  if (status == HAL_OK)
+  {
+    /* Sequence number first: the header is only valid once the marker is programmed */
+    data = (uint16_t)(pStore->Sequence + 1U);
+    status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_HALFWORD_EDATA, address + 2U, (uint32_t)&data);
+  }
+
+  if (status == HAL_OK)
+  {
+    data = FLASH_EESTORE_MAGIC;
+    status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_HALFWORD_EDATA, address, (uint32_t)&data);
+  }
+
+  if (status == HAL_OK)
+  {
+    pStore->Sequence++;
+    pStore->HeadSector = Sector;
+    pStore->HeadSlot = 1U;
+    pStore->LiveCount[Sector] = 0U;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Append a record at the head of the key-value store and index it.
+  * @param  pStore pointer to the store structure
+  * @param  Key key of the record
+  * @param  Value value of the record
+  * @retval HAL Status
+  */
+static HAL_StatusTypeDef FLASH_EEStoreAppend(FLASH_EEStoreTypeDef *pStore, uint32_t Key, uint32_t Value)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint16_t record[FLASH_EESTORE_RECORD_SIZE / 2U];
+  uint32_t address;
+  uint32_t location;
+  uint32_t index;
+
+  if (pStore->HeadSlot == FLASH_EESTORE_SLOTS)
+  {
+    /* Head sector full: the next one must have been freed by the compaction */
+    if (((pStore->HeadSector + 1U) % pStore->NbSectors) == pStore->TailSector)
+    {
+      return HAL_ERROR;
+    }
+    status = FLASH_EEStoreOpenSector(pStore, (pStore->HeadSector + 1U) % pStore->NbSectors);
+  }
+
+  if (status == HAL_OK)
+  {
+    location = (pStore->HeadSector * FLASH_EESTORE_SLOTS) + pStore->HeadSlot;
+    address = pStore->BaseAddress + (location * FLASH_EESTORE_RECORD_SIZE);
+
+    /* The slot is consumed even if the programming fails */
+    pStore->HeadSlot++;
+
+    /* Key first and check last: an interrupted record is detected by its check */
+    record[0] = (uint16_t)Key;
+    record[1] = (uint16_t)(Value & 0xFFFFU);
+    record[2] = (uint16_t)(Value >> 16U);
+    record[3] = (uint16_t)(record[0] ^ record[1] ^ record[2] ^ FLASH_EESTORE_MAGIC);
+
+    for (index = 0U; (index < (FLASH_EESTORE_RECORD_SIZE / 2U)) && (status == HAL_OK); index++)
+    {
+      status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_HALFWORD_EDATA, address + (index * 2U),
+                                 (uint32_t)&record[index]);
+    }
+
+    if (status == HAL_OK)
+    {
+      if (pStore->pIndex[Key] != FLASH_EESTORE_NO_RECORD)
+      {
+        pStore->LiveCount[pStore->pIndex[Key] / FLASH_EESTORE_SLOTS]--;
+      }
+      pStore->pIndex[Key] = (uint16_t)location;
+      pStore->LiveCount[pStore->HeadSector]++;
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Get the number of free sectors of the key-value store.
+  * @param  pStore pointer to the store structure
+  * @retval Number of sectors neither written nor being written
+  */
+static uint32_t FLASH_EEStoreFreeSectors(const FLASH_EEStoreTypeDef *pStore)
+{
+  return pStore->NbSectors -
+         (((pStore->HeadSector + pStore->NbSectors - pStore->TailSector) % pStore->NbSectors) + 1U);
+}
+#endif /* FLASH_EDATAR_EDATA_EN */
+
+#if defined (FLASH_SR_OBKERR)
+/**
+  * @brief  Erase of FLASH OBK
+  * @retval None
+  */
+static void FLASH_OBKErase()
+{
+  __IO uint32_t *reg_obkcfgr;
+
+  /* Access to SECOBKCFGR or NSOBKCFGR registers depends on operation type */
+  reg_obkcfgr = IS_FLASH_SECURE_OPERATION() ? &(FLASH->SECOBKCFGR) : &(FLASH_NS->NSOBKCFGR);
+
+  /* Set OBK Erase Bit */
+  SET_BIT((*reg_obkcfgr), FLASH_OBKCFGR_ALT_SECT_ERASE);
+}
+#endif /* FLASH_SR_OBKERR */
+
+/**
+  * @brief  Enable the write protection of the desired bank1 or bank 2 sectors
+  * @param  WRPSector specifies the sectors to be write protected.
+  *         This parameter can be a value of @ref FLASH_OB_Write_Protection_Sectors
+  *
+  * @param  Banks the specific bank to apply WRP sectors
+  *          This parameter can be one of the following values:
+  *            @arg FLASH_BANK_1: enable WRP on specified bank1 sectors
+  *            @arg FLASH_BANK_2: enable WRP on specified bank2 sectors
+  *            @arg FLASH_BANK_BOTH: enable WRP on both bank1 and bank2 specified sectors
+  *
+  * @retval None
+  */
+static void FLASH_OB_EnableWRP(uint64_t WRPSector, uint32_t Banks)
+{
+  /* Check the parameters */
+  assert_param(IS_FLASH_BANK(Banks));
+#if defined(OB_WRP_SECTOR_128TO131)
+  uint32_t WRPSector_Group1 = (uint32_t)(WRPSector & 0xFFFFFFFF);
+  uint32_t WRPSector_Group2 = (uint32_t)((WRPSector >> 32) & 0xFFFFFFFF);
+  if ((Banks & FLASH_BANK_1) == FLASH_BANK_1)
+  {
+    if (WRPSector_Group1 != 0)
+    {
+        /* Enable Write Protection for bank 1 Group1 */
+        FLASH->WRP11R_PRG &= (~(WRPSector_Group1 & FLASH_WRPR_WRPSG));
+    }
+    if (WRPSector_Group2 != 0)
+    {
+        /* Enable Write Protection for bank 1 Group2 */
+        FLASH->WRP12R_PRG &= (~(WRPSector_Group2 & FLASH_WRPR_WRPSG));
+    }
+  }
+  if ((Banks & FLASH_BANK_2) == FLASH_BANK_2)
+  {
+    if (WRPSector_Group1 != 0)
+    {
+        /* Enable Write Protection for bank 2 Group1 */
+        FLASH->WRP21R_PRG &= (~(WRPSector_Group1 & FLASH_WRPR_WRPSG));
+    }
+    if (WRPSector_Group2 != 0)
+    {
+        /* Enable Write Protection for bank 2 Group2 */
+        FLASH->WRP22R_PRG &= (~(WRPSector_Group2 & FLASH_WRPR_WRPSG));
+    }
+  }
+#else
+  if ((Banks & FLASH_BANK_1) == FLASH_BANK_1)
+  {
+    /* Enable Write Protection for bank 1 */
+    FLASH->WRP1R_PRG &= (~((uint32_t)(WRPSector & FLASH_WRPR_WRPSG)));
+  }
+
+  if ((Banks & FLASH_BANK_2) == FLASH_BANK_2)
+  {
+    /* Enable Write Protection for bank 2 */
+    FLASH->WRP2R_PRG &= (~((uint32_t)(WRPSector & FLASH_WRPR_WRPSG)));
+  }
+#endif /* OB_WRP_SECTOR_128TO131 */
+}
+
+/**
+  * @brief  Disable the write protection of the desired bank1 or bank 2 sectors
+  * @param  WRPSector specifies the sectors to disable write protection.
+  *         This parameter can be a value of @ref FLASH_OB_Write_Protection_Sectors
+  *
+  * @param  Banks the specific bank to apply WRP sectors
+  *          This parameter can be one of the following values:
+  *            @arg FLASH_BANK_1: disable WRP on specified bank1 sectors
+  *            @arg FLASH_BANK_2: disable WRP on specified bank2 sectors
+  *            @arg FLASH_BANK_BOTH: disable WRP on both bank1 and bank2 specified sectors
+  *
+  * @retval None
+  */
+static void FLASH_OB_DisableWRP(uint64_t WRPSector, uint32_t Banks)
+{
+  /* Check the parameters */
+  assert_param(IS_FLASH_BANK(Banks));
+#if defined(OB_WRP_SECTOR_128TO131)
+  uint32_t WRPSector_Group1 = (uint32_t)(WRPSector & 0xFFFFFFFF);
+  uint32_t WRPSector_Group2 = (uint32_t)((WRPSector >> 32) & 0xFFFFFFFF);
+  if ((Banks & FLASH_BANK_1) == FLASH_BANK_1)
+  {
+    if (WRPSector_Group1 != 0)
+    {
+      /* Disable Write Protection for bank 1 group1 */
+      FLASH->WRP11R_PRG |= (WRPSector_Group1 & FLASH_WRPR_WRPSG);
+    }
+    if (WRPSector_Group2 != 0)
+    {
+      /* Disable Write Protection for bank 1 group2 */
+      FLASH->WRP12R_PRG |= (WRPSector_Group2 & FLASH_WRPR_WRPSG);
+    }
+  }
+
+  if ((Banks & FLASH_BANK_2) == FLASH_BANK_2)
+  {
+    if (WRPSector_Group1 != 0)
+    {
+      /* Disable Write Protection for bank 2 group1 */
+      FLASH->WRP21R_PRG |= (WRPSector_Group1 & FLASH_WRPR_WRPSG);
+    }
+    if (WRPSector_Group2 != 0)
+    {
+      /* Disable Write Protection for bank 2 group2 */
+      FLASH->WRP22R_PRG |= (WRPSector_Group2 & FLASH_WRPR_WRPSG);
+    }
+  }
+#else
+  if ((Banks & FLASH_BANK_1) == FLASH_BANK_1)
+  {
+    /* Disable Write Protection for bank 1 */
+    FLASH->WRP1R_PRG |= (uint32_t)(WRPSector & FLASH_WRPR_WRPSG);
+  }
+
+  if ((Banks & FLASH_BANK_2) == FLASH_BANK_2)
+  {
+    /* Disable Write Protection for bank 2 */
+    FLASH->WRP2R_PRG |= (uint32_t)(WRPSector & FLASH_WRPR_WRPSG);
+  }
+#endif /* OB_WRP_SECTOR_128TO131 */
+}
+
+/**
+  * @brief  Get the write protection of the given bank 1 or bank 2 sectors
+  * @param[in]  Bank specifies the bank where to get the write protection sectors.
+  *         This parameter can be exclusively one of the following values:
+  *         @arg FLASH_BANK_1: Get bank1 WRP sectors
+  *         @arg FLASH_BANK_2: Get bank2 WRP sectors
+  *
+  * @param[out]  WRPState returns the write protection state of the returned sectors.
+  *         This parameter can be one of the following values:
+  *         @arg WRPState: OB_WRPSTATE_DISABLE or OB_WRPSTATE_ENABLE
+
+  * @param[out]  WRPSector returns the write protected sectors on the given bank .
   *         This parameter can be a value of @ref FLASH_OB_Write_Protection_Sectors
   *
   * @retval None
@@ -1972,6 +2603,12 @@ static void FLASH_OB_GetEDATA(uint32_t Bank, uint32_t *EDATASize)
     [..]
     This subsection provides a set of functions allowing to manage the Extended FLASH
     ECC Operations.
+    [..]
+    The ECC errors monitor started by HAL_FLASHEx_EccMonitor_Start() logs the failing
+    addresses reported by HAL_FLASH_IRQHandler() and HAL_FLASHEx_ECCD_IRQHandler() in a
+    user array, each address once with a report counter. HAL_FLASHEx_EccMonitor_Process(),
+    called in thread context, relocates the records of the key-value store linked in the
+    monitor pStore field and hit by an error.
 
 @endverbatim
   * @{
@@ -2007,110 +2644,39 @@ void HAL_FLASHEx_GetEccInfo(FLASH_EccInfoTypeDef *pData)
   uint32_t correction_reg = FLASH->ECCCORR;
   uint32_t detection_reg = FLASH->ECCDETR;
   uint32_t data_reg = FLASH->ECCDR;
-  uint32_t addr_reg = 0xFFFFFFFFU;
 
   /* Check if the operation is a correction or a detection*/
   if ((correction_reg & FLASH_ECCR_ECCC) != 0U)
   {
-    /*  Get area and offset address values from ECCCORR register*/
-    pData->Area = correction_reg & (~(FLASH_ECCR_ECCIE | FLASH_ECCR_ADDR_ECC | FLASH_ECCR_ECCC));
-    addr_reg = (correction_reg & FLASH_ECCR_ADDR_ECC);
+    FLASH_EccDecode(correction_reg, pData);
   }
   else if ((detection_reg & FLASH_ECCR_ECCD) != 0U)
   {
-    /* Get area and offset address values from ECCDETR register */
-    pData->Area = detection_reg & (~(FLASH_ECCR_ADDR_ECC | FLASH_ECCR_ECCD));
-    addr_reg = (detection_reg & FLASH_ECCR_ADDR_ECC);
+    FLASH_EccDecode(detection_reg, pData);
   }
   else
   {
     /* Do nothing */
   }
 
-  /* Check that an ECC single or double error has occurred to continue the calculation of area address */
-  if (addr_reg != 0xFFFFFFFFU)
+  pData->Data = data_reg & FLASH_ECCR_ADDR_ECC;
+}
+
+/**
+  * @brief Handle Flash ECC Detection interrupt request.
+  * @retval None
+  */
+void HAL_FLASHEx_ECCD_IRQHandler(void)
+{
+  /* Check if the ECC double error occurred*/
+  if (READ_BIT(FLASH->ECCDETR, FLASH_ECCR_ECCD) != 0U)
   {
-    /* Get address value according to area value*/
-    switch (pData->Area)
+    if (pFlash.pEccMonitor != NULL)
     {
-      case FLASH_ECC_AREA_USER_BANK1:
-        /*
-         * One error detection/correction or two error detections per 128-bit flash word
-         * Therefore, the address returned by ECC registers in bank1 represents 128-bit flash word,
-         * to get the correct address value, we must do a shift by 4 bits
-        */
-        addr_reg = ((uint32_t)addr_reg << 4U) & 0xFFFFFFFFU;
-        pData->Address = (FLASH_BASE + addr_reg) & 0xFFFFFFFFU;
-        break;
-      case FLASH_ECC_AREA_USER_BANK2:
-        /*
-         * One error detection/correction or two error detections per 128-bit flash word
-         * Therefore, the address returned by ECC registers in bank2 represents 128-bit flash word,
-         * to get the correct address value, we must do a shift by 4 bits
-        */
-        addr_reg = ((uint32_t)addr_reg << 4U) & 0xFFFFFFFFU;
-        pData->Address = (FLASH_BASE + FLASH_BANK_SIZE + addr_reg) & 0xFFFFFFFFU;
-        break;
-      case FLASH_ECC_AREA_SYSTEM:
-        /* check system flash bank */
-        if ((correction_reg & FLASH_ECCR_BK_ECC) == FLASH_ECCR_BK_ECC)
-        {
-          pData->Address = (FLASH_SYSTEM_BASE + FLASH_SYSTEM_SIZE + addr_reg) & 0xFFFFFFFFU;
-        }
-        else
-        {
-          pData->Address = (FLASH_SYSTEM_BASE + addr_reg) & 0xFFFFFFFFU;
-        }
-        break;
-#if defined (FLASH_SR_OBKERR)
-      case FLASH_ECC_AREA_OBK:
-        pData->Address = (FLASH_OBK_BASE + addr_reg) & 0xFFFFFFFFU;
-        break;
-#endif /* FLASH_SR_OBKERR */
-#if defined (FLASH_EDATAR_EDATA_EN)
-      case FLASH_ECC_AREA_EDATA_BANK1:
-        /* check flash high-cycle data bank */
-          /*
-           * addr_reg is the address returned by the ECC register along with an offset value depends on area
-           * To calculate the exact address set by user while an ECC occurred, we must subtract the offset value,
-           * In addition, the address returned by ECC registers represents 128-bit flash word (multiply by 4),
-          */
-          pData->Address = (FLASH_EDATA_BASE + ((addr_reg - FLASH_ADDRESS_OFFSET_EDATA) * 4U)) & 0xFFFFFFFFU;
-        break;
-      case FLASH_ECC_AREA_EDATA_BANK2:
-        /* check flash high-cycle data bank */
-          /*
-           * addr_reg is the address returned by the ECC register along with an offset value depends on area
-           * To calculate the exact address set by user while an ECC occurred, we must subtract the offset value,
-           * In addition, the address returned by ECC registers represents 128-bit flash word (multiply by 4),
-          */
-          pData->Address = (FLASH_EDATA_BASE + FLASH_EDATA_BANK_SIZE + \
-                           ((addr_reg - FLASH_ADDRESS_OFFSET_EDATA) * 4U)) & 0xFFFFFFFFU;
-        break;
-#endif /* FLASH_EDATAR_EDATA_EN */
-      case FLASH_ECC_AREA_OTP:
-        /* Address returned by the ECC is an halfword, multiply by 4 to get the exact address*/
-        pData->Address = (FLASH_OTP_BASE + ((addr_reg - FLASH_ADDRESS_OFFSET_OTP) * 4U)) & 0xFFFFFFFFU;
-        break;
-
-      default:
-        /* Do nothing */
-        break;
+      /* Log the failing address */
+      FLASH_EccMonitorRecord(FLASH_ECC_EVENT_DETECTION);
     }
-  }
-
-  pData->Data = data_reg & FLASH_ECCR_ADDR_ECC;
-}
 
-/**
-  * @brief Handle Flash ECC Detection interrupt request.
-  * @retval None
-  */
-void HAL_FLASHEx_ECCD_IRQHandler(void)
-{
-  /* Check if the ECC double error occurred*/
-  if (READ_BIT(FLASH->ECCDETR, FLASH_ECCR_ECCD) != 0U)
-  {
     /* FLASH ECC detection user callback */
     HAL_FLASHEx_EccDetectionCallback();
 
@@ -2143,6 +2709,614 @@ __weak void HAL_FLASHEx_EccDetectionCallback(void)
    */
 }
 
+/**
+  * @brief  Start the ECC errors monitor.
+  * @note   The ECC correction interrupt is enabled. The ECC detection is reported by the NMI:
+  *         HAL_FLASHEx_ECCD_IRQHandler() must be called from NMI_Handler().
+  * @param  pMonitor pointer to the monitor structure
+  * @param  pLog pointer to the user log array
+  * @param  Size number of entries of the log array
+  * @retval HAL Status
+  */
+HAL_StatusTypeDef HAL_FLASHEx_EccMonitor_Start(FLASH_EccMonitorTypeDef *pMonitor, FLASH_EccLogEntryTypeDef *pLog,
+                                               uint32_t Size)
+{
+  if ((pMonitor == NULL) || (pLog == NULL) || (Size == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  pMonitor->pLog          = pLog;
+  pMonitor->Size          = Size;
+  pMonitor->NbEntries     = 0U;
+  pMonitor->NbCorrections = 0U;
+  pMonitor->NbDetections  = 0U;
+  pMonitor->NbLost        = 0U;
+
+  pFlash.pEccMonitor = pMonitor;
+
+  HAL_FLASHEx_EnableEccCorrectionInterrupt();
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the ECC errors monitor.
+  * @note   The ECC correction interrupt is left enabled.
+  * @param  pMonitor pointer to the monitor structure
+  * @retval HAL Status
+  */
+HAL_StatusTypeDef HAL_FLASHEx_EccMonitor_Stop(const FLASH_EccMonitorTypeDef *pMonitor)
+{
+  if ((pMonitor == NULL) || (pFlash.pEccMonitor != pMonitor))
+  {
+    return HAL_ERROR;
+  }
+
+  pFlash.pEccMonitor = NULL;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Process the new entries of the ECC errors log.
+  * @note   To be called in thread context: the records of the key-value store hit by an
+  *         ECC error are relocated. The FLASH control register must be unlocked.
+  * @param  pMonitor pointer to the monitor structure
+  * @retval HAL Status
+  */
+HAL_StatusTypeDef HAL_FLASHEx_EccMonitor_Process(FLASH_EccMonitorTypeDef *pMonitor)
+{
+  uint32_t index;
+
+  if (pMonitor == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  for (index = 0U; index < pMonitor->NbEntries; index++)
+  {
+    if (pMonitor->pLog[index].Handled == 0U)
+    {
+      pMonitor->pLog[index].Handled = 1U;
+
+#if defined (FLASH_EDATAR_EDATA_EN)
+      if (pMonitor->pStore != NULL)
+      {
+        FLASH_EccRelocate(pMonitor->pStore, &pMonitor->pLog[index]);
+      }
+#endif /* FLASH_EDATAR_EDATA_EN */
+    }
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @}
+  */
+
+#if defined (FLASH_EDATAR_EDATA_EN)
+/** @defgroup FLASHEx_Exported_Functions_Group4 Extended high-cycle data storage functions
+  *  @brief   Extended high-cycle data storage functions
+  *
+@verbatim
+ ===============================================================================
+             ##### Extended high-cycle data storage functions #####
+ ===============================================================================
+    [..]
+    This subsection provides a set of functions allowing to store 32-bit values by key
+    in the Flash high-cycle data sectors (EEPROM emulation).
+    [..]
+    The store is a log of 8-byte records (key, value, check) programmed by 16-bit
+    half-words. The sectors are written one after the other in a ring, each one starting
+    with a header holding a sequence number. The location of the latest record of each key
+    is kept in a RAM index rebuilt by HAL_FLASHEx_EEStore_Init().
+    [..]
+    Once a single free sector remains, the oldest sector is compacted: its latest records
+    are appended at the head a few at a time, then the sector is erased. The store must have
+    at least 3 sectors and the number of keys must not exceed the records of
+    (NbSectors - 2) sectors.
+    [..]
+    The FLASH control register must be unlocked with HAL_FLASH_Unlock() before any write,
+    format or compaction step.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initialize the key-value store and build its index from the log.
+  * @note   The store is formatted if it holds no valid sector.
+  * @param  pStore pointer to the store structure, with Bank, FirstSector, NbSectors,
+  *         pIndex and NbKeys set
+  * @retval HAL Status
+  */
+HAL_StatusTypeDef HAL_FLASHEx_EEStore_Init(FLASH_EEStoreTypeDef *pStore)
+{
+  uint32_t sector;
+  uint32_t slot;
+  uint32_t address;
+  uint32_t location;
+  uint32_t found = 0U;
+  int16_t  diff;
+  int16_t  head_diff = 0;
+  int16_t  tail_diff = 0;
+  uint16_t reference = 0U;
+  uint16_t record[FLASH_EESTORE_RECORD_SIZE / 2U];
+
+  if ((pStore == NULL) || (pStore->pIndex == NULL) || (pStore->NbSectors < 3U) ||
+      ((pStore->FirstSector + pStore->NbSectors) > FLASH_EDATA_SECTOR_NB) ||
+      ((pStore->Bank != FLASH_BANK_1) && (pStore->Bank != FLASH_BANK_2)) || (pStore->NbKeys == 0U) ||
+      (pStore->NbKeys > ((pStore->NbSectors - 2U) * (FLASH_EESTORE_SLOTS - 1U))))
+  {
+    return HAL_ERROR;
+  }
+
+  pStore->BaseAddress = FLASH_EDATA_BASE + (pStore->FirstSector * FLASH_EDATA_SECTOR_SIZE);
+  if (pStore->Bank == FLASH_BANK_2)
+  {
+    pStore->BaseAddress += FLASH_EDATA_BANK_SIZE;
+  }
+
+  for (slot = 0U; slot < pStore->NbKeys; slot++)
+  {
+    pStore->pIndex[slot] = FLASH_EESTORE_NO_RECORD;
+  }
+
+  /* Find the oldest and the newest sectors from their sequence numbers */
+  for (sector = 0U; sector < pStore->NbSectors; sector++)
+  {
+    pStore->LiveCount[sector] = 0U;
+    address = pStore->BaseAddress + (sector * FLASH_EDATA_SECTOR_SIZE);
+
+    if (*(__IO uint16_t *)address == FLASH_EESTORE_MAGIC)
+    {
+      if (found == 0U)
+      {
+        reference = *(__IO uint16_t *)(address + 2U);
+        pStore->HeadSector = sector;
+        pStore->TailSector = sector;
+        found = 1U;
+      }
+
+      diff = (int16_t)(uint16_t)(*(__IO uint16_t *)(address + 2U) - reference);
+      if (diff > head_diff)
+      {
+        head_diff = diff;
+        pStore->HeadSector = sector;
+      }
+      if (diff < tail_diff)
+      {
+        tail_diff = diff;
+        pStore->TailSector = sector;
+      }
+    }
+  }
+
+  if (found == 0U)
+  {
+    return HAL_FLASHEx_EEStore_Format(pStore);
+  }
+
+  pStore->Sequence = (uint16_t)(reference + (uint16_t)head_diff);
+  pStore->CompactSlot = 1U;
+
+  /* Replay the log from the oldest sector, the latest record of a key being kept */
+  sector = pStore->TailSector;
+  for (;;)
+  {
+    for (slot = 1U; slot < FLASH_EESTORE_SLOTS; slot++)
+    {
+      location = (sector * FLASH_EESTORE_SLOTS) + slot;
+      address = pStore->BaseAddress + (location * FLASH_EESTORE_RECORD_SIZE);
+
+      record[0] = *(__IO uint16_t *)address;
+      if (record[0] == FLASH_EESTORE_ERASED)
+      {
+        break;
+      }
+      record[1] = *(__IO uint16_t *)(address + 2U);
+      record[2] = *(__IO uint16_t *)(address + 4U);
+      record[3] = *(__IO uint16_t *)(address + 6U);
+
+      if ((record[3] == (uint16_t)(record[0] ^ record[1] ^ record[2] ^ FLASH_EESTORE_MAGIC)) &&
+          (record[0] < pStore->NbKeys))
+      {
+        if (pStore->pIndex[record[0]] != FLASH_EESTORE_NO_RECORD)
+        {
+          pStore->LiveCount[pStore->pIndex[record[0]] / FLASH_EESTORE_SLOTS]--;
+        }
+        pStore->pIndex[record[0]] = (uint16_t)location;
+        pStore->LiveCount[sector]++;
+      }
+    }
+
+    if (sector == pStore->HeadSector)
+    {
+      pStore->HeadSlot = slot;
+      break;
+    }
+    sector = (sector + 1U) % pStore->NbSectors;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Erase all the sectors of the key-value store and open the first one.
+  * @note   The store must have been initialized with HAL_FLASHEx_EEStore_Init().
+  * @param  pStore pointer to the store structure
+  * @retval HAL Status
+  */
+HAL_StatusTypeDef HAL_FLASHEx_EEStore_Format(FLASH_EEStoreTypeDef *pStore)
+{
+  HAL_StatusTypeDef status;
+  uint32_t index;
+
+  if ((pStore == NULL) || (pStore->BaseAddress == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  for (index = 0U; index < pStore->NbKeys; index++)
+  {
+    pStore->pIndex[index] = FLASH_EESTORE_NO_RECORD;
+  }
+  for (index = 0U; index < pStore->NbSectors; index++)
+  {
+    pStore->LiveCount[index] = 0U;
+  }
+
+  status = FLASH_EEStoreEraseSectors(pStore, 0U, pStore->NbSectors);
+
+  if (status == HAL_OK)
+  {
+    pStore->Sequence = 0U;
+    pStore->TailSector = 0U;
+    pStore->CompactSlot = 1U;
+    status = FLASH_EEStoreOpenSector(pStore, 0U);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Read the latest value of a key.
+  * @param  pStore pointer to the store structure
+  * @param  Key key to read
+  * @param  pValue pointer to the value
+  * @retval HAL Status, HAL_ERROR if the key was never written
+  */
+HAL_StatusTypeDef HAL_FLASHEx_EEStore_Read(const FLASH_EEStoreTypeDef *pStore, uint32_t Key, uint32_t *pValue)
+{
+  uint32_t address;
+
+  if ((pStore == NULL) || (pValue == NULL) || (Key >= pStore->NbKeys) ||
+      (pStore->pIndex[Key] == FLASH_EESTORE_NO_RECORD))
+  {
+    return HAL_ERROR;
+  }
+
+  address = pStore->BaseAddress + ((uint32_t)pStore->pIndex[Key] * FLASH_EESTORE_RECORD_SIZE);
+  *pValue = (uint32_t)(*(__IO uint16_t *)(address + 2U)) | ((uint32_t)(*(__IO uint16_t *)(address + 4U)) << 16U);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Write the value of a key.
+  * @note   Nothing is programmed if the value is unchanged. A compaction step is run
+  *         after the write once the store is almost full.
+  * @param  pStore pointer to the store structure
+  * @param  Key key to write
+  * @param  Value value to write
+  * @retval HAL Status
+  */
+HAL_StatusTypeDef HAL_FLASHEx_EEStore_Write(FLASH_EEStoreTypeDef *pStore, uint32_t Key, uint32_t Value)
+{
+  HAL_StatusTypeDef status;
+  uint32_t current;
+
+  if ((pStore == NULL) || (Key >= pStore->NbKeys))
+  {
+    return HAL_ERROR;
+  }
+
+  if ((HAL_FLASHEx_EEStore_Read(pStore, Key, &current) == HAL_OK) && (current == Value))
+  {
+    return HAL_OK;
+  }
+
+  status = FLASH_EEStoreAppend(pStore, Key, Value);
+
+  if (status == HAL_OK)
+  {
+    status = HAL_FLASHEx_EEStore_Compact(pStore);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Run one compaction step of the key-value store, if almost full.
+  * @note   A few latest records of the oldest sector are moved to the head, the sector
+  *         being erased once it holds no latest record anymore.
+  * @param  pStore pointer to the store structure
+  * @retval HAL Status
+  */
+HAL_StatusTypeDef HAL_FLASHEx_EEStore_Compact(FLASH_EEStoreTypeDef *pStore)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t moved = 0U;
+  uint32_t location;
+  uint32_t address;
+  uint32_t key;
+
+  if (pStore == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  if (FLASH_EEStoreFreeSectors(pStore) > 1U)
+  {
+    return HAL_OK;
+  }
+
+  while ((moved < FLASH_EESTORE_COMPACT_STEP) && (pStore->LiveCount[pStore->TailSector] != 0U) &&
+         (pStore->CompactSlot < FLASH_EESTORE_SLOTS) && (status == HAL_OK))
+  {
+    location = (pStore->TailSector * FLASH_EESTORE_SLOTS) + pStore->CompactSlot;
+    address = pStore->BaseAddress + (location * FLASH_EESTORE_RECORD_SIZE);
+    key = *(__IO uint16_t *)address;
+
+    /* Only the latest record of a key is moved */
+    if ((key < pStore->NbKeys) && (pStore->pIndex[key] == location))
+    {
+      status = FLASH_EEStoreAppend(pStore, key, (uint32_t)(*(__IO uint16_t *)(address + 2U)) |
+                                   ((uint32_t)(*(__IO uint16_t *)(address + 4U)) << 16U));
+      moved++;
+    }
+    pStore->CompactSlot++;
+  }
+
+  if ((status == HAL_OK) && (pStore->LiveCount[pStore->TailSector] == 0U))
+  {
+    /* No latest record left: the sector is free */
+    status = FLASH_EEStoreEraseSectors(pStore, pStore->TailSector, 1U);
+
+    if (status == HAL_OK)
+    {
+      pStore->TailSector = (pStore->TailSector + 1U) % pStore->NbSectors;
+      pStore->CompactSlot = 1U;
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @}
+  */
+#endif /* FLASH_EDATAR_EDATA_EN */
+
+/** @defgroup FLASHEx_Exported_Functions_Group5 Extended dual-bank image update functions
+  *  @brief   Extended dual-bank image update functions
+  *
+@verbatim
+ ===============================================================================
+             ##### Extended dual-bank image update functions #####
+ ===============================================================================
+    [..]
+    This subsection provides a set of functions allowing to update the application
+    image in the inactive bank while running from the active one, then to swap the banks.
+    [..]
+    The image is streamed chunk by chunk: no RAM copy of the image is needed and the
+    erase, the programming and the digest computation of a chunk are overlapped. With
+    a HASH handle, each chunk is hashed by DMA from the caller buffer while it is
+    programmed, the HASH input DMA channel interrupt must be enabled.
+    [..]
+    The FLASH control register must be unlocked with HAL_FLASH_Unlock() before any write
+    or swap step.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Start the update of the inactive bank.
+  * @param  pOTA pointer to the update structure, with ImageSize, hhash and pDigest set
+  * @retval HAL Status
+  */
+HAL_StatusTypeDef HAL_FLASHEx_OTA_Start(FLASH_OTATypeDef *pOTA)
+{
+  if ((pOTA == NULL) || (pOTA->ImageSize == 0U) || (pOTA->ImageSize > FLASH_BANK_SIZE))
+  {
+    return HAL_ERROR;
+  }
+
+#if defined (HASH) && defined (HAL_HASH_MODULE_ENABLED)
+  if ((pOTA->hhash != NULL) &&
+      ((pOTA->pDigest == NULL) || (HAL_HASH_GetState(pOTA->hhash) != HAL_HASH_STATE_READY)))
+  {
+    return HAL_ERROR;
+  }
+#endif /* HASH && HAL_HASH_MODULE_ENABLED */
+
+  /* The inactive bank is the one mapped at the second half of the user Flash */
+  pOTA->Bank = FLASH_QueueGetBank(FLASH_BASE + FLASH_BANK_SIZE);
+  pOTA->Offset = 0U;
+  pOTA->NbErasedSectors = 0U;
+  pOTA->Complete = 0U;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Program the next chunk of the image in the inactive bank.
+  * @note   The sectors reached by the chunk are erased first. With a HASH handle, the digest
+  *         of the chunk is computed by DMA while it is programmed and the digest of the image
+  *         is compared with the expected one once the last chunk is programmed.
+  * @note   On error, the update must be restarted with HAL_FLASHEx_OTA_Start().
+  * @param  pOTA pointer to the update structure
+  * @param  pData pointer to the chunk, 32-bit aligned
+  * @param  Size size of the chunk in bytes, multiple of 16 except for the last chunk
+  * @retval HAL Status, HAL_ERROR if the digest of the image does not match
+  */
+HAL_StatusTypeDef HAL_FLASHEx_OTA_Write(FLASH_OTATypeDef *pOTA, const uint8_t *pData, uint32_t Size)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  FLASH_EraseInitTypeDef erase_init;
+  uint32_t sector_error;
+  uint32_t address;
+  uint32_t end;
+  uint32_t aligned_size;
+  uint32_t last;
+  uint32_t index;
+  uint32_t quad_word[4];
+#if defined (HASH) && defined (HAL_HASH_MODULE_ENABLED)
+  uint32_t tickstart;
+  uint8_t  diff = 0U;
+#endif /* HASH && HAL_HASH_MODULE_ENABLED */
+
+  if ((pOTA == NULL) || (pData == NULL) || (Size == 0U) || (pOTA->Bank == 0U) ||
+      (((uint32_t)pData & 3U) != 0U) || (Size > (pOTA->ImageSize - pOTA->Offset)))
+  {
+    return HAL_ERROR;
+  }
+
+  end = pOTA->Offset + Size;
+  last = (end == pOTA->ImageSize) ? 1U : 0U;
+  if ((last == 0U) && ((Size % 16U) != 0U))
+  {
+    return HAL_ERROR;
+  }
+
+#if defined (HASH) && defined (HAL_HASH_MODULE_ENABLED)
+  if (pOTA->hhash != NULL)
+  {
+    /* Hash the chunk while it is programmed, the digest is computed at the end of the last one */
+    if (last != 0U)
+    {
+      __HAL_HASH_RESET_MDMAT(pOTA->hhash);
+    }
+    else
+    {
+      __HAL_HASH_SET_MDMAT(pOTA->hhash);
+    }
+    status = HAL_HASH_Start_DMA(pOTA->hhash, pData, Size, pOTA->Digest);
+  }
+#endif /* HASH && HAL_HASH_MODULE_ENABLED */
+
+  /* Erase the sectors reached by the chunk */
+  erase_init.TypeErase = FLASH_TYPEERASE_SECTORS;
+  erase_init.Banks = pOTA->Bank;
+  erase_init.NbSectors = 1U;
+  while ((status == HAL_OK) && ((pOTA->NbErasedSectors * FLASH_SECTOR_SIZE) < end))
+  {
+    erase_init.Sector = pOTA->NbErasedSectors;
+    status = HAL_FLASHEx_Erase(&erase_init, &sector_error);
+    pOTA->NbErasedSectors++;
+  }
+
+  /* Program the whole quad-words, then the last bytes padded with the erased value */
+  address = FLASH_BASE + FLASH_BANK_SIZE + pOTA->Offset;
+  aligned_size = Size & ~15U;
+  if ((status == HAL_OK) && (aligned_size != 0U))
+  {
+    status = HAL_FLASHEx_ProgramBuffer(FLASH_TYPEPROGRAM_QUADWORD, address, (uint32_t)pData, aligned_size);
+  }
+  if ((status == HAL_OK) && (aligned_size != Size))
+  {
+    for (index = 0U; index < 4U; index++)
+    {
+      quad_word[index] = 0xFFFFFFFFU;
+    }
+    for (index = 0U; index < (Size - aligned_size); index++)
+    {
+      ((uint8_t *)quad_word)[index] = pData[aligned_size + index];
+    }
+    status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_QUADWORD, address + aligned_size, (uint32_t)quad_word);
+  }
+
+#if defined (HASH) && defined (HAL_HASH_MODULE_ENABLED)
+  if (pOTA->hhash != NULL)
+  {
+    /* Wait for the end of the chunk hashing, the caller buffer may be reused afterwards */
+    tickstart = HAL_GetTick();
+    while (HAL_HASH_GetState(pOTA->hhash) == HAL_HASH_STATE_BUSY)
+    {
+      if ((HAL_GetTick() - tickstart) > FLASH_TIMEOUT_VALUE)
+      {
+        status = HAL_TIMEOUT;
+        break;
+      }
+    }
+
+    if ((status == HAL_OK) && (last != 0U))
+    {
+      /* Compare the whole digest, without early exit */
+      for (index = 0U; index < HASH_DIGEST_LENGTH(pOTA->hhash); index++)
+      {
+        diff |= (uint8_t)(pOTA->Digest[index] ^ pOTA->pDigest[index]);
+      }
+      if (diff != 0U)
+      {
+        status = HAL_ERROR;
+      }
+    }
+  }
+#endif /* HASH && HAL_HASH_MODULE_ENABLED */
+
+  if (status == HAL_OK)
+  {
+    pOTA->Offset = end;
+    pOTA->Complete = last;
+  }
+  else
+  {
+    pOTA->Bank = 0U;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Swap the banks once the image is completely programmed and verified.
+  * @note   The SWAP_BANK option byte is toggled, the new image is executed after the next
+  *         system reset.
+  * @param  pOTA pointer to the update structure
+  * @retval HAL Status
+  */
+HAL_StatusTypeDef HAL_FLASHEx_OTA_Swap(const FLASH_OTATypeDef *pOTA)
+{
+  HAL_StatusTypeDef status;
+  FLASH_OBProgramInitTypeDef ob_init;
+
+  if ((pOTA == NULL) || (pOTA->Bank == 0U) || (pOTA->Complete == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  ob_init.OptionType = OPTIONBYTE_USER;
+  ob_init.USERType = OB_USER_SWAP_BANK;
+  ob_init.USERConfig = (FLASH->OPTSR_CUR & FLASH_OPTSR_SWAP_BANK) ^ FLASH_OPTSR_SWAP_BANK;
+  ob_init.USERConfig2 = 0U;
+
+  status = HAL_FLASH_OB_Unlock();
+  if (status == HAL_OK)
+  {
+    status = HAL_FLASHEx_OBProgram(&ob_init);
+    if (status == HAL_OK)
+    {
+      status = HAL_FLASH_OB_Launch();
+    }
+    (void)HAL_FLASH_OB_Lock();
+  }
+
+  return status;
+}
+
 /**
   * @}
   */
@@ -81,6 +81,13 @@
                In the DMA case, HAL_FMAC_FilterConfigCallback() is called when
                the handling is over.
 
+       (#) Optionally, to switch between filter presets at run time, load several
+           coefficient banks (each one in its own X2 area of the internal memory) with
+           HAL_FMAC_LoadCoeffBank_DMA(), HAL_FMAC_FilterConfigCallback() being called at
+           the end of each load. Once the filter is running, HAL_FMAC_SwapCoeffBank()
+           selects another loaded bank: the filter is only stopped during the few
+           register writes needed to point X2 and the P, Q, R parameters to the new bank.
+
        (#) Optionally, the user can enable the error interruption related to
            saturation by calling __HAL_FMAC_ENABLE_IT. This helps in debugging the
            filter. If a saturation occurs, the interruption will be triggered in loop.
@@ -102,6 +109,25 @@
            without updating the provided buffer. The IP processing will be active until
            HAL_FMAC_FilterStop() is called.
 
+       (#) Alternatively, when both input and output buffers are accessed via DMA, start
+           a continuous filtering on circular input and output rings using
+           HAL_FMAC_FilterStartStream(). Both DMA handles must be configured in
+           linked-list mode, each with a circular queue (see HAL_DMAEx_List_SetCircularMode()),
+           the driver sets the source, destination and size of the queue head node.
+           Half and complete callbacks are then called at each ring loop, without any
+           call to HAL_FMAC_AppendFilterData() or HAL_FMAC_ConfigFilterOutputBuffer().
+           The processing is active until HAL_FMAC_FilterStop() is called.
+
+       (#) Alternatively, when both input and output buffers are accessed via DMA, several
+           independent logical channels can share the FMAC using HAL_FMAC_ChannelsStart_DMA().
+           The blocks of the channels are processed round-robin: before each block, the
+           channel coefficient bank is selected and the channel history (last inputs and,
+           for IIR, last outputs) is preloaded; at the end of the block the history is
+           saved and HAL_FMAC_OutputDataReadyCallback() is called, the completed channel
+           being given by hfmac->ChannelIndex. The callback can provide the next blocks of
+           the channel by updating its pInput and pOutput fields. The processing goes on
+           until HAL_FMAC_ChannelsStop() is called.
+
        (#) If the input internal buffer is accessed via DMA, HAL_FMAC_HalfGetDataCallback()
            will be called to indicate that half of the input buffer has been handled.
 
@@ -343,6 +369,13 @@ static void FMAC_DMAOutputDataReady(DMA_HandleTypeDef *hdma);
 static void FMAC_DMAFilterConfig(DMA_HandleTypeDef *hdma);
 static void FMAC_DMAFilterPreload(DMA_HandleTypeDef *hdma);
 static void FMAC_DMAError(DMA_HandleTypeDef *hdma);
+static HAL_StatusTypeDef FMAC_DMAStreamStart(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress,
+                                             uint32_t SizeInBytes);
+static void FMAC_DMAStreamGetData(DMA_HandleTypeDef *hdma);
+static void FMAC_DMAStreamOutputDataReady(DMA_HandleTypeDef *hdma);
+static HAL_StatusTypeDef FMAC_ChannelStart(FMAC_HandleTypeDef *hfmac);
+static void FMAC_ChannelSaveHistory(int16_t *pHistory, uint32_t HistorySize, const int16_t *pData, uint32_t DataSize);
+static void FMAC_ChannelBlockCplt(FMAC_HandleTypeDef *hfmac);
 
 /* Functions Definition ------------------------------------------------------*/
 /** @defgroup FMAC_Exported_Functions FMAC Exported Functions
@@ -420,6 +453,11 @@ HAL_StatusTypeDef HAL_FMAC_Init(FMAC_HandleTypeDef *hfmac)
   hfmac->FilterParam = 0U;
   FMAC_ResetDataPointers(hfmac);
 
+  /* No multi-channel processing */
+  hfmac->pChannels = NULL;
+  hfmac->ChannelNbr = 0U;
+  hfmac->ChannelIndex = 0U;
+
   /* Reset FMAC unit (internal pointers) */
   if (FMAC_Reset(hfmac) == HAL_ERROR)
   {
@@ -773,7 +811,10 @@ HAL_StatusTypeDef HAL_FMAC_UnRegisterCallback(FMAC_HandleTypeDef *hfmac, HAL_FMA
     [..]  This section provides functions allowing to:
       (+) Configure the FMAC peripheral: memory area, filter type and parameters,
           way to access to the input and output memory area (none, polling, IT, DMA).
+      (+) Load coefficient banks and swap them while the filter is running.
       (+) Start the FMAC processing (filter).
+      (+) Start the FMAC continuous processing on circular input and output rings.
+      (+) Start and stop the FMAC round-robin processing of several logical channels.
       (+) Handle the input data that will be provided into FMAC.
       (+) Handle the output data provided by FMAC.
       (+) Stop the FMAC processing (filter).
@@ -814,6 +855,188 @@ HAL_StatusTypeDef HAL_FMAC_FilterConfig_DMA(FMAC_HandleTypeDef *hfmac, FMAC_Filt
   return (FMAC_FilterConfig(hfmac, pConfig, PRELOAD_ACCESS_DMA));
 }
 
+/**
+  * @brief  Load a coefficient bank into its coefficient area of the FMAC internal memory.
+  * @note   The coefficients are loaded using DMA (hdmaPreload). HAL_FMAC_FilterConfigCallback()
+  *         is called at the end of the load. The filter must be stopped.
+  * @note   At the end of the load, the coefficient buffer (X2) points to the loaded bank.
+  *         The filter configuration (FilterParam) is kept: use HAL_FMAC_SwapCoeffBank()
+  *         to select the bank to use.
+  * @param  hfmac pointer to a FMAC_HandleTypeDef structure that contains
+  *         the configuration information for FMAC module.
+  * @param  pBank pointer to a FMAC_CoeffBankTypeDef structure that contains the bank information.
+  * @retval HAL_StatusTypeDef HAL status
+  */
+HAL_StatusTypeDef HAL_FMAC_LoadCoeffBank_DMA(FMAC_HandleTypeDef *hfmac, const FMAC_CoeffBankTypeDef *pBank)
+{
+  HAL_StatusTypeDef status;
+
+  /* Check the function parameters */
+  if ((pBank == NULL) || (pBank->pCoeffB == NULL) || (pBank->CoeffBSize == 0U) || (pBank->CoeffBufferSize == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* The provided coefficients should match the bank X2 size */
+  assert_param(((uint32_t)pBank->CoeffASize + (uint32_t)pBank->CoeffBSize) <= (uint32_t)pBank->CoeffBufferSize);
+
+  /* Check the START bit state */
+  if (FMAC_GET_START_BIT(hfmac) != 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check handle state is ready */
+  if (hfmac->State != HAL_FMAC_STATE_READY)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Change the FMAC state */
+  hfmac->State = HAL_FMAC_STATE_BUSY;
+
+  /* FMAC_X2BUFCFG: Point the coefficient buffer to the bank area */
+  MODIFY_REG(hfmac->Instance->X2BUFCFG,                                                                   \
+             (FMAC_X2BUFCFG_X2_BASE | FMAC_X2BUFCFG_X2_BUF_SIZE),                                         \
+             (((((uint32_t)(pBank->CoeffBaseAddress)) << FMAC_X2BUFCFG_X2_BASE_Pos)     & FMAC_X2BUFCFG_X2_BASE) | \
+              ((((uint32_t)(pBank->CoeffBufferSize))  << FMAC_X2BUFCFG_X2_BUF_SIZE_Pos) & \
+               FMAC_X2BUFCFG_X2_BUF_SIZE)));
+
+  /* Write number of values to be loaded, the data load function and start the operation */
+  WRITE_REG(hfmac->Instance->PARAM,                      \
+            (((uint32_t)(pBank->CoeffBSize) << FMAC_PARAM_P_Pos) | \
+             ((uint32_t)(pBank->CoeffASize) << FMAC_PARAM_Q_Pos) | \
+             FMAC_FUNC_LOAD_X2 | FMAC_PARAM_START));
+
+  /* CoeffA is loaded from the DMA complete callback, if needed */
+  if ((pBank->pCoeffA != NULL) && (pBank->CoeffASize != 0U))
+  {
+    hfmac->pInput = pBank->pCoeffA;
+    hfmac->InputCurrentSize = pBank->CoeffASize;
+  }
+  else
+  {
+    hfmac->pInput = NULL;
+    hfmac->InputCurrentSize = 0U;
+  }
+
+  /* Set the FMAC DMA transfer complete callback */
+  hfmac->hdmaPreload->XferHalfCpltCallback = NULL;
+  hfmac->hdmaPreload->XferCpltCallback = FMAC_DMAFilterConfig;
+  /* Set the DMA error callback */
+  hfmac->hdmaPreload->XferErrorCallback = FMAC_DMAError;
+
+  /* Enable the DMA stream managing FMAC preload data write */
+  if ((hfmac->hdmaPreload->Mode & DMA_LINKEDLIST) == DMA_LINKEDLIST)
+  {
+    if ((hfmac->hdmaPreload->LinkedListQueue != NULL) && (hfmac->hdmaPreload->LinkedListQueue->Head != NULL))
+    {
+      /* Enable the DMA channel */
+      hfmac->hdmaPreload->LinkedListQueue->Head->LinkRegisters[NODE_CBR1_DEFAULT_OFFSET] =
+        (uint32_t)(2UL * pBank->CoeffBSize);   /* Set DMA data size           */
+      hfmac->hdmaPreload->LinkedListQueue->Head->LinkRegisters[NODE_CSAR_DEFAULT_OFFSET] =
+        (uint32_t)pBank->pCoeffB;              /* Set DMA source address      */
+      hfmac->hdmaPreload->LinkedListQueue->Head->LinkRegisters[NODE_CDAR_DEFAULT_OFFSET] =
+        (uint32_t)&hfmac->Instance->WDATA;     /* Set DMA destination address */
+
+      status = HAL_DMAEx_List_Start_IT(hfmac->hdmaPreload);
+    }
+    else
+    {
+      status = HAL_ERROR;
+    }
+  }
+  else
+  {
+    status = HAL_DMA_Start_IT(hfmac->hdmaPreload, (uint32_t)pBank->pCoeffB, \
+                              (uint32_t)&hfmac->Instance->WDATA, (uint32_t)(2UL * pBank->CoeffBSize));
+  }
+
+  if (status != HAL_OK)
+  {
+    /* Abort the load operation */
+    CLEAR_BIT(hfmac->Instance->PARAM, FMAC_PARAM_START);
+    hfmac->pInput = NULL;
+    hfmac->InputCurrentSize = 0U;
+    hfmac->ErrorCode |= HAL_FMAC_ERROR_DMA;
+    hfmac->State = HAL_FMAC_STATE_READY;
+
+    /* Return error status */
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Select a previously loaded coefficient bank.
+  * @note   If the filter is running, it is stopped only for the time needed to point the
+  *         coefficient buffer (X2) and the P, Q, R parameters to the new bank, then restarted
+  *         (interrupts are masked meanwhile). Input and output buffer configurations, as well
+  *         as the DMA or IT accesses in progress, are kept.
+  * @note   If the filter is stopped, the bank will be used at the next filter start.
+  * @param  hfmac pointer to a FMAC_HandleTypeDef structure that contains
+  *         the configuration information for FMAC module.
+  * @param  pBank pointer to a FMAC_CoeffBankTypeDef structure already loaded by
+  *         HAL_FMAC_LoadCoeffBank_DMA().
+  * @retval HAL_StatusTypeDef HAL status
+  */
+HAL_StatusTypeDef HAL_FMAC_SwapCoeffBank(FMAC_HandleTypeDef *hfmac, const FMAC_CoeffBankTypeDef *pBank)
+{
+  uint32_t x2bufcfg;
+  uint32_t param;
+  uint32_t primask_bit;
+
+  /* Check the function parameters */
+  if ((pBank == NULL) || (pBank->CoeffBufferSize == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check that a valid configuration was done previously */
+  if (hfmac->FilterParam == 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check handle state is ready */
+  if (hfmac->State != HAL_FMAC_STATE_READY)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Prepare the new register values before stopping the filter */
+  x2bufcfg = (READ_REG(hfmac->Instance->X2BUFCFG) & ~(FMAC_X2BUFCFG_X2_BASE | FMAC_X2BUFCFG_X2_BUF_SIZE)) |
+             ((((uint32_t)(pBank->CoeffBaseAddress)) << FMAC_X2BUFCFG_X2_BASE_Pos)     & FMAC_X2BUFCFG_X2_BASE) |
+             ((((uint32_t)(pBank->CoeffBufferSize))  << FMAC_X2BUFCFG_X2_BUF_SIZE_Pos) & FMAC_X2BUFCFG_X2_BUF_SIZE);
+
+  param = (hfmac->FilterParam & ~(FMAC_PARAM_P | FMAC_PARAM_Q | FMAC_PARAM_R)) |
+          ((((uint32_t)(pBank->P)) << FMAC_PARAM_P_Pos) & FMAC_PARAM_P) |
+          ((((uint32_t)(pBank->Q)) << FMAC_PARAM_Q_Pos) & FMAC_PARAM_Q) |
+          ((((uint32_t)(pBank->R)) << FMAC_PARAM_R_Pos) & FMAC_PARAM_R);
+
+  /* Keep the stop window as short as possible */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  if (FMAC_GET_START_BIT(hfmac) != 0U)
+  {
+    CLEAR_BIT(hfmac->Instance->PARAM, FMAC_PARAM_START);
+    WRITE_REG(hfmac->Instance->X2BUFCFG, x2bufcfg);
+    WRITE_REG(hfmac->Instance->PARAM, param);
+  }
+  else
+  {
+    WRITE_REG(hfmac->Instance->X2BUFCFG, x2bufcfg);
+  }
+
+  hfmac->FilterParam = param;
+
+  __set_PRIMASK(primask_bit);
+
+  return HAL_OK;
+}
+
 /**
   * @brief  Preload the input (FIR, IIR) and output data (IIR) of the FMAC filter.
   * @note   The set(s) of data will be used by FMAC as soon as @ref HAL_FMAC_FilterStart is called.
@@ -952,6 +1175,114 @@ HAL_StatusTypeDef HAL_FMAC_FilterStart(FMAC_HandleTypeDef *hfmac, int16_t *pOutp
   return status;
 }
 
+/**
+  * @brief  Start the FMAC continuous processing (filter) on circular input and output rings.
+  * @note   Input and output accesses must be configured as FMAC_BUFFER_ACCESS_DMA, and
+  *         hdmaIn and hdmaOut must be circular linked-list DMA handles. The head node of
+  *         each queue is updated with the ring addresses and sizes.
+  * @note   HAL_FMAC_HalfGetDataCallback()/HAL_FMAC_GetDataCallback() indicate which half of
+  *         the input ring can be refilled, HAL_FMAC_HalfOutputDataReadyCallback()/
+  *         HAL_FMAC_OutputDataReadyCallback() which half of the output ring is ready.
+  *         The processing goes on until HAL_FMAC_FilterStop() is called.
+  * @param  hfmac pointer to a FMAC_HandleTypeDef structure that contains
+  *         the configuration information for FMAC module.
+  * @param  pInput pointer to the circular input ring.
+  * @param  InputSize number of samples of the input ring.
+  * @param  pOutput pointer to the circular output ring.
+  * @param  OutputSize number of samples of the output ring.
+  * @retval HAL_StatusTypeDef HAL status
+  */
+HAL_StatusTypeDef HAL_FMAC_FilterStartStream(FMAC_HandleTypeDef *hfmac, int16_t *pInput, uint16_t InputSize,
+                                             int16_t *pOutput, uint16_t OutputSize)
+{
+  HAL_StatusTypeDef status;
+
+  /* Check the function parameters */
+  if ((pInput == NULL) || (pOutput == NULL) || (InputSize == 0U) || (OutputSize == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the START bit state */
+  if (FMAC_GET_START_BIT(hfmac) != 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check that a valid configuration was done previously */
+  if (hfmac->FilterParam == 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the FMAC configuration: both rings are handled by DMA */
+  if ((hfmac->InputAccess != FMAC_BUFFER_ACCESS_DMA) || (hfmac->OutputAccess != FMAC_BUFFER_ACCESS_DMA))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check handle state is ready */
+  if ((hfmac->State == HAL_FMAC_STATE_READY) && (hfmac->WrState == HAL_FMAC_STATE_READY)
+      && (hfmac->RdState == HAL_FMAC_STATE_READY))
+  {
+    /* Change the FMAC state */
+    hfmac->State = HAL_FMAC_STATE_BUSY;
+
+    /* CR: Configure the input and output access through DMA */
+    MODIFY_REG(hfmac->Instance->CR, \
+               FMAC_IT_RIEN | FMAC_IT_WIEN | FMAC_DMA_REN | FMAC_CR_DMAWEN, \
+               FMAC_DMA_WEN | FMAC_DMA_REN);
+
+    /* Data pointers are not used, the rings are handled by DMA only */
+    hfmac->pInput = NULL;
+    hfmac->pInputSize = NULL;
+    hfmac->InputCurrentSize = 0U;
+    hfmac->pOutput = NULL;
+    hfmac->pOutputSize = NULL;
+    hfmac->OutputCurrentSize = 0U;
+
+    /* Set the FMAC DMA transfer callbacks, state is kept at each ring loop */
+    hfmac->hdmaOut->XferHalfCpltCallback = FMAC_DMAHalfOutputDataReady;
+    hfmac->hdmaOut->XferCpltCallback = FMAC_DMAStreamOutputDataReady;
+    hfmac->hdmaOut->XferErrorCallback = FMAC_DMAError;
+    hfmac->hdmaIn->XferHalfCpltCallback = FMAC_DMAHalfGetData;
+    hfmac->hdmaIn->XferCpltCallback = FMAC_DMAStreamGetData;
+    hfmac->hdmaIn->XferErrorCallback = FMAC_DMAError;
+
+    /* Enable the DMA channel managing FMAC output data read */
+    hfmac->RdState = HAL_FMAC_STATE_BUSY_RD;
+    status = FMAC_DMAStreamStart(hfmac->hdmaOut, (uint32_t)&hfmac->Instance->RDATA, (uint32_t)pOutput,
+                                 (uint32_t)(4UL * OutputSize));
+
+    if (status == HAL_OK)
+    {
+      /* PARAM: Start the filter ( this can generate DMA requests before the end of the function ) */
+      WRITE_REG(hfmac->Instance->PARAM, (uint32_t)(hfmac->FilterParam));
+
+      /* Enable the DMA channel managing FMAC input data write */
+      hfmac->WrState = HAL_FMAC_STATE_BUSY_WR;
+      status = FMAC_DMAStreamStart(hfmac->hdmaIn, (uint32_t)pInput, (uint32_t)&hfmac->Instance->WDATA,
+                                   (uint32_t)(2UL * InputSize));
+    }
+
+    /* Reset the busy flag (do not overwrite the possible write and read flag) */
+    hfmac->State = HAL_FMAC_STATE_READY;
+
+    if (status != HAL_OK)
+    {
+      /* Stop the part already started */
+      (void)HAL_FMAC_FilterStop(hfmac);
+      status = HAL_ERROR;
+    }
+  }
+  else
+  {
+    status = HAL_ERROR;
+  }
+
+  return status;
+}
+
 /**
   * @brief  Provide a new input buffer that will be loaded into the FMAC input memory area.
   * @param  hfmac pointer to a FMAC_HandleTypeDef structure that contains
@@ -1267,6 +1598,89 @@ HAL_StatusTypeDef HAL_FMAC_FilterStop(FMAC_HandleTypeDef *hfmac)
   return status;
 }
 
+/**
+  * @brief  Start the round-robin processing of several logical channels with DMA.
+  * @note   Input and output accesses must be configured as FMAC_BUFFER_ACCESS_DMA and the
+  *         filter must be configured and stopped. The X1 and Y buffers must be able to hold
+  *         the preloaded histories.
+  * @note   At the end of each block, HAL_FMAC_OutputDataReadyCallback() is called with
+  *         hfmac->ChannelIndex giving the completed channel. HAL_FMAC_GetDataCallback()
+  *         is not called in this mode.
+  * @param  hfmac pointer to a FMAC_HandleTypeDef structure that contains
+  *         the configuration information for FMAC module.
+  * @param  pChannels pointer to the array of logical channels.
+  * @param  NbChannels number of logical channels.
+  * @retval HAL_StatusTypeDef HAL status
+  */
+HAL_StatusTypeDef HAL_FMAC_ChannelsStart_DMA(FMAC_HandleTypeDef *hfmac, FMAC_ChannelTypeDef *pChannels,
+                                             uint32_t NbChannels)
+{
+  HAL_StatusTypeDef status;
+
+  /* Check the function parameters */
+  if ((pChannels == NULL) || (NbChannels == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the START bit state */
+  if (FMAC_GET_START_BIT(hfmac) != 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check that a valid configuration was done previously */
+  if (hfmac->FilterParam == 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the FMAC configuration: blocks are handled by DMA */
+  if ((hfmac->InputAccess != FMAC_BUFFER_ACCESS_DMA) || (hfmac->OutputAccess != FMAC_BUFFER_ACCESS_DMA))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check handle state is ready and no multi-channel processing is running */
+  if ((hfmac->State != HAL_FMAC_STATE_READY) || (hfmac->pChannels != NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  hfmac->ChannelNbr = NbChannels;
+  hfmac->ChannelIndex = 0U;
+  hfmac->pChannels = pChannels;
+
+  /* Start the block of the first channel */
+  status = FMAC_ChannelStart(hfmac);
+  if (status != HAL_OK)
+  {
+    hfmac->pChannels = NULL;
+    (void)HAL_FMAC_FilterStop(hfmac);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Stop the round-robin processing of the logical channels.
+  * @note   The block in progress is discarded and the history of its channel is not updated.
+  * @param  hfmac pointer to a FMAC_HandleTypeDef structure that contains
+  *         the configuration information for FMAC module.
+  * @retval HAL_StatusTypeDef HAL status
+  */
+HAL_StatusTypeDef HAL_FMAC_ChannelsStop(FMAC_HandleTypeDef *hfmac)
+{
+  if (hfmac->pChannels == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  hfmac->pChannels = NULL;
+
+  return HAL_FMAC_FilterStop(hfmac);
+}
+
 /**
   * @}
   */
@@ -2446,6 +2860,12 @@ static void FMAC_DMAGetData(DMA_HandleTypeDef *hdma)
   /* Reset the pointers to indicate new data will be needed */
   FMAC_ResetInputStateAndDataPointers(hfmac);
 
+  /* Multi-channel processing: the block end is handled on the output side */
+  if (hfmac->pChannels != NULL)
+  {
+    return;
+  }
+
   /* Call get data callback */
 #if (USE_HAL_FMAC_REGISTER_CALLBACKS == 1)
   hfmac->GetDataCallback(hfmac);
@@ -2483,6 +2903,13 @@ static void FMAC_DMAOutputDataReady(DMA_HandleTypeDef *hdma)
   /* Reset the pointers to indicate new data will be needed */
   FMAC_ResetOutputStateAndDataPointers(hfmac);
 
+  /* Multi-channel processing: go on with the next channel */
+  if (hfmac->pChannels != NULL)
+  {
+    FMAC_ChannelBlockCplt(hfmac);
+    return;
+  }
+
   /* Call output data ready callback */
 #if (USE_HAL_FMAC_REGISTER_CALLBACKS == 1)
   hfmac->OutputDataReadyCallback(hfmac);
@@ -2491,6 +2918,214 @@ static void FMAC_DMAOutputDataReady(DMA_HandleTypeDef *hdma)
 #endif /* USE_HAL_FMAC_REGISTER_CALLBACKS */
 }
 
+/**
+  * @brief  Start the block of the current logical channel.
+  * @note   The filter must be stopped: the internal pointers are reset, the channel
+  *         coefficient bank is selected, the channel history is preloaded, then the
+  *         filter and the input/output DMA transfers are started.
+  * @param  hfmac FMAC handle.
+  * @retval HAL_StatusTypeDef HAL status
+  */
+static HAL_StatusTypeDef FMAC_ChannelStart(FMAC_HandleTypeDef *hfmac)
+{
+  FMAC_ChannelTypeDef *p_channel = &hfmac->pChannels[hfmac->ChannelIndex];
+  uint32_t xhistory;
+  uint32_t yhistory;
+
+  if ((p_channel->pInput == NULL) || (p_channel->pOutput == NULL) || (p_channel->NbSamples == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Reset FMAC unit (internal pointers) */
+  if (FMAC_Reset(hfmac) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Select the coefficients of the channel */
+  if (p_channel->pBank != NULL)
+  {
+    if (HAL_FMAC_SwapCoeffBank(hfmac, p_channel->pBank) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  /* Restore the filter state of the channel */
+  xhistory = ((hfmac->FilterParam & FMAC_PARAM_P) >> FMAC_PARAM_P_Pos) - 1U;
+  yhistory = ((hfmac->FilterParam & FMAC_PARAM_FUNC) == FMAC_FUNC_IIR_DIRECT_FORM_1) ?
+             ((hfmac->FilterParam & FMAC_PARAM_Q) >> FMAC_PARAM_Q_Pos) : 0U;
+
+  if (FMAC_FilterPreload(hfmac, (xhistory != 0U) ? p_channel->pInputHistory : NULL, (uint8_t)xhistory,
+                         (yhistory != 0U) ? p_channel->pOutputHistory : NULL, (uint8_t)yhistory,
+                         PRELOAD_ACCESS_POLLING) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Start the filter with the channel output block, then feed the channel input block */
+  if (HAL_FMAC_FilterStart(hfmac, p_channel->pOutput, &p_channel->NbSamples) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  return HAL_FMAC_AppendFilterData(hfmac, p_channel->pInput, &p_channel->NbSamples);
+}
+
+/**
+  * @brief  Update a channel history with the last samples of a block.
+  * @param  pHistory history buffer (oldest sample first).
+  * @param  HistorySize number of samples of the history.
+  * @param  pData block of samples.
+  * @param  DataSize number of samples of the block.
+  * @retval None
+  */
+static void FMAC_ChannelSaveHistory(int16_t *pHistory, uint32_t HistorySize, const int16_t *pData, uint32_t DataSize)
+{
+  uint32_t index;
+
+  if (DataSize >= HistorySize)
+  {
+    for (index = 0U; index < HistorySize; index++)
+    {
+      pHistory[index] = pData[DataSize - HistorySize + index];
+    }
+  }
+  else
+  {
+    /* Keep the most recent part of the previous history */
+    for (index = 0U; index < (HistorySize - DataSize); index++)
+    {
+      pHistory[index] = pHistory[index + DataSize];
+    }
+    for (index = 0U; index < DataSize; index++)
+    {
+      pHistory[HistorySize - DataSize + index] = pData[index];
+    }
+  }
+}
+
+/**
+  * @brief  End of the block of the current logical channel: save its history and
+  *         start the block of the next channel.
+  * @param  hfmac FMAC handle.
+  * @retval None
+  */
+static void FMAC_ChannelBlockCplt(FMAC_HandleTypeDef *hfmac)
+{
+  FMAC_ChannelTypeDef *p_channel = &hfmac->pChannels[hfmac->ChannelIndex];
+  uint32_t xhistory;
+  uint32_t yhistory;
+
+  /* Save the filter state of the channel */
+  xhistory = ((hfmac->FilterParam & FMAC_PARAM_P) >> FMAC_PARAM_P_Pos) - 1U;
+  yhistory = ((hfmac->FilterParam & FMAC_PARAM_FUNC) == FMAC_FUNC_IIR_DIRECT_FORM_1) ?
+             ((hfmac->FilterParam & FMAC_PARAM_Q) >> FMAC_PARAM_Q_Pos) : 0U;
+
+  if (xhistory != 0U)
+  {
+    FMAC_ChannelSaveHistory(p_channel->pInputHistory, xhistory, p_channel->pInput, p_channel->NbSamples);
+  }
+  if (yhistory != 0U)
+  {
+    FMAC_ChannelSaveHistory(p_channel->pOutputHistory, yhistory, p_channel->pOutput, p_channel->NbSamples);
+  }
+
+  /* Stop the filter, the next channel starts from a reset unit */
+  (void)HAL_FMAC_FilterStop(hfmac);
+
+  /* Call output data ready callback for the completed channel */
+#if (USE_HAL_FMAC_REGISTER_CALLBACKS == 1)
+  hfmac->OutputDataReadyCallback(hfmac);
+#else
+  HAL_FMAC_OutputDataReadyCallback(hfmac);
+#endif /* USE_HAL_FMAC_REGISTER_CALLBACKS */
+
+  /* The processing may have been stopped from the callback */
+  if (hfmac->pChannels != NULL)
+  {
+    hfmac->ChannelIndex = ((hfmac->ChannelIndex + 1U) == hfmac->ChannelNbr) ? 0U : (hfmac->ChannelIndex + 1U);
+
+    if (FMAC_ChannelStart(hfmac) != HAL_OK)
+    {
+      hfmac->pChannels = NULL;
+      (void)HAL_FMAC_FilterStop(hfmac);
+
+      /* Set FMAC handle error code */
+      hfmac->ErrorCode |= HAL_FMAC_ERROR_DMA;
+
+      /* Call user callback */
+#if (USE_HAL_FMAC_REGISTER_CALLBACKS == 1)
+      hfmac->ErrorCallback(hfmac);
+#else
+      HAL_FMAC_ErrorCallback(hfmac);
+#endif /* USE_HAL_FMAC_REGISTER_CALLBACKS */
+    }
+  }
+}
+
+/**
+  * @brief  Set the head node of a circular DMA queue and start the DMA channel.
+  * @param  hdma DMA handle.
+  * @param  SrcAddress Source address.
+  * @param  DstAddress Destination address.
+  * @param  SizeInBytes Block size in bytes.
+  * @retval HAL_StatusTypeDef HAL status
+  */
+static HAL_StatusTypeDef FMAC_DMAStreamStart(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress,
+                                             uint32_t SizeInBytes)
+{
+  if (((hdma->Mode & DMA_LINKEDLIST_CIRCULAR) != DMA_LINKEDLIST_CIRCULAR)
+      || (hdma->LinkedListQueue == NULL) || (hdma->LinkedListQueue->Head == NULL)
+      || (hdma->LinkedListQueue->FirstCircularNode == NULL))
+  {
+    /* Return error status */
+    return HAL_ERROR;
+  }
+
+  hdma->LinkedListQueue->Head->LinkRegisters[NODE_CBR1_DEFAULT_OFFSET] = SizeInBytes; /* Set DMA data size           */
+  hdma->LinkedListQueue->Head->LinkRegisters[NODE_CSAR_DEFAULT_OFFSET] = SrcAddress;  /* Set DMA source address      */
+  hdma->LinkedListQueue->Head->LinkRegisters[NODE_CDAR_DEFAULT_OFFSET] = DstAddress;  /* Set DMA destination address */
+
+  /* Enable the DMA channel */
+  return HAL_DMAEx_List_Start_IT(hdma);
+}
+
+/**
+  * @brief  DMA FMAC Input ring loop complete callback (continuous processing).
+  * @param  hdma DMA handle.
+  * @retval None
+  */
+static void FMAC_DMAStreamGetData(DMA_HandleTypeDef *hdma)
+{
+  FMAC_HandleTypeDef *hfmac = (FMAC_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+
+  /* Call get data callback, the ring keeps on being written */
+#if (USE_HAL_FMAC_REGISTER_CALLBACKS == 1)
+  hfmac->GetDataCallback(hfmac);
+#else
+  HAL_FMAC_GetDataCallback(hfmac);
+#endif /* USE_HAL_FMAC_REGISTER_CALLBACKS */
+}
+
+/**
+  * @brief  DMA FMAC Output ring loop complete callback (continuous processing).
+  * @param  hdma DMA handle.
+  * @retval None
+  */
+static void FMAC_DMAStreamOutputDataReady(DMA_HandleTypeDef *hdma)
+{
+  FMAC_HandleTypeDef *hfmac = (FMAC_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+
+  /* Call output data ready callback, the ring keeps on being filled */
+#if (USE_HAL_FMAC_REGISTER_CALLBACKS == 1)
+  hfmac->OutputDataReadyCallback(hfmac);
+#else
+  HAL_FMAC_OutputDataReadyCallback(hfmac);
+#endif /* USE_HAL_FMAC_REGISTER_CALLBACKS */
+}
+
 /**
   * @brief  DMA FMAC Filter Configuration process complete callback.
   * @param  hdma DMA handle.
@@ -2710,6 +3345,9 @@ static void FMAC_DMAError(DMA_HandleTypeDef *hdma)
   /* Set FMAC handle state to error */
   hfmac->State = HAL_FMAC_STATE_ERROR;
 
+  /* Stop the multi-channel processing, if any */
+  hfmac->pChannels = NULL;
+
   /* Set FMAC handle error code to DMA error */
   hfmac->ErrorCode |= HAL_FMAC_ERROR_DMA;
 
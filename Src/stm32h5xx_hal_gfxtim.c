@@ -13,6 +13,7 @@
   *           + External Tearing Effect line management & synchronization
   *           + Four programmable event generators with external trigger generation
   *           + One watchdog counter
+  *           + Frame pacing of the rendering and display refresh
   ******************************************************************************
   * @attention
   *
@@ -51,6 +52,24 @@
       (#) Use HAL_GFXTIM_GetState() to get the current GFXTIM or ADF instance state.
       (#) Use HAL_GFXTIM_GetErrorCode() to get the current GFXTIM or ADF instance error code.
 
+    *** Frame pacing ***
+    ====================
+    [..]
+      (#) Configure the GFXTIM timers generating the frame event (e.g. tearing effect
+          or relative frame counter reload) and the render event (e.g. absolute line
+          counter compare), their interrupts being enabled by the frame pacer.
+      (#) Fill a GFXTIM_FramePacerTypeDef structure with the events, 2 or 3 frame
+          buffers, the flip callback starting the display refresh from a buffer and
+          the render callback starting the rendering (e.g. a DMA2D command list)
+          into a buffer, then call HAL_GFXTIM_FramePacer_Start().
+      (#) At each render event, a free buffer is passed to the render callback if
+          no rendering is ongoing. Call HAL_GFXTIM_FramePacer_Present() when the
+          rendering is complete (e.g. from the DMA2D transfer complete callback).
+      (#) At each frame event, the presented buffer becomes the front buffer and
+          is passed to the flip callback. Without presented buffer the display
+          keeps the previous frame and RepeatCount is incremented.
+      (#) Call HAL_GFXTIM_FramePacer_Stop() to stop the frame pacing.
+
 
 
 #if defined(GENERATOR_CALLBACKS_REGISTERING_AVAILABLE)
@@ -140,6 +159,16 @@
   * @{
   */
 
+/* Private function prototypes -----------------------------------------------*/
+/** @defgroup GFXTIM_Private_Functions GFXTIM Private Functions
+  * @{
+  */
+static void GFXTIM_FramePacerProcess(GFXTIM_HandleTypeDef *hgfxtim, uint32_t interrupts);
+static void GFXTIM_FramePacerRender(GFXTIM_FramePacerTypeDef *pPacer);
+/**
+  * @}
+  */
+
 /* Exported functions ---------------------------------------------------------*/
 /** @defgroup GFXTIM_Exported_Functions  GFXTIM Exported Functions
   * @{
@@ -221,6 +250,7 @@ HAL_StatusTypeDef HAL_GFXTIM_Init(GFXTIM_HandleTypeDef *hgfxtim)
 
       /* Update error code and state */
       hgfxtim->ErrorCode = GFXTIM_ERROR_NONE;
+      hgfxtim->pFramePacer = NULL;
       hgfxtim->State = HAL_GFXTIM_STATE_READY;
       status = HAL_OK;
     }
@@ -257,6 +287,7 @@ HAL_StatusTypeDef HAL_GFXTIM_DeInit(GFXTIM_HandleTypeDef *hgfxtim)
 #endif /* USE_HAL_GFXTIM_REGISTER_CALLBACKS */
 
       /* Update state */
+      hgfxtim->pFramePacer = NULL;
       hgfxtim->State = HAL_GFXTIM_STATE_RESET;
       status = HAL_OK;
     }
@@ -1849,6 +1880,12 @@ void HAL_GFXTIM_IRQHandler(GFXTIM_HandleTypeDef *hgfxtim)
   tmp_reg2 = READ_REG(hgfxtim->Instance->IER);
   interrupts = tmp_reg1 & tmp_reg2;
 
+  /* Flip and render scheduling take place before the user callbacks */
+  if (hgfxtim->pFramePacer != NULL)
+  {
+    GFXTIM_FramePacerProcess(hgfxtim, interrupts);
+  }
+
   if ((interrupts & GFXTIM_ISR_AFCC1F) != 0U)
   {
 #if (USE_HAL_GFXTIM_REGISTER_CALLBACKS == 1U)
@@ -2018,6 +2055,194 @@ uint32_t HAL_GFXTIM_GetError(const GFXTIM_HandleTypeDef *hgfxtim)
   * @}
   */
 
+/** @defgroup GFXTIM_Exported_Functions_Group8  Frame pacing functions
+  * @brief    Frame pacing functions
+  *
+@verbatim
+  ==============================================================================
+                          ##### Frame pacing functions #####
+  ==============================================================================
+    [..]  This section provides functions allowing to :
+      (+) Start and stop the frame pacer.
+      (+) Present a rendered frame buffer for the next flip.
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Start the frame pacer.
+  * @note   The interrupts of the frame and render events are enabled, the GFXTIM
+  *         interrupt must be enabled in the NVIC. The first buffer is the front
+  *         buffer, the first rendering starts at the next render event.
+  * @note   The flip callback must not start a display refresh lasting more than
+  *         a frame period: the previous front buffer is rendered into again once
+  *         the flip callback returns.
+  * @param  hgfxtim GFXTIM handle.
+  * @param  pPacer Frame pacer, it must stay valid until HAL_GFXTIM_FramePacer_Stop().
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_GFXTIM_FramePacer_Start(GFXTIM_HandleTypeDef *hgfxtim, GFXTIM_FramePacerTypeDef *pPacer)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if ((pPacer == NULL) || (pPacer->FlipCallback == NULL) || (pPacer->RenderCallback == NULL))
+  {
+    status = HAL_ERROR;
+  }
+  else if (hgfxtim->State != HAL_GFXTIM_STATE_READY)
+  {
+    status = HAL_ERROR;
+  }
+  else if (hgfxtim->pFramePacer != NULL)
+  {
+    status = HAL_BUSY;
+  }
+  else
+  {
+    /* Check parameters */
+    assert_param(IS_GFXTIM_FRAMEPACER_EVENT(pPacer->FrameEvent));
+    assert_param((pPacer->RenderEvent == 0U) || IS_GFXTIM_FRAMEPACER_EVENT(pPacer->RenderEvent));
+    assert_param(IS_GFXTIM_FRAMEPACER_BUFFER_NB(pPacer->BufferNb));
+
+    pPacer->FrontBuffer = 0U;
+    pPacer->QueuedBuffer = GFXTIM_FRAMEPACER_NO_BUFFER;
+    pPacer->RenderBuffer = GFXTIM_FRAMEPACER_NO_BUFFER;
+    pPacer->FrameCount = 0U;
+    pPacer->RepeatCount = 0U;
+
+    /* Clear the pending events, IER and ISR bits have the same positions */
+    WRITE_REG(hgfxtim->Instance->ICR, pPacer->FrameEvent | pPacer->RenderEvent);
+    hgfxtim->pFramePacer = pPacer;
+    SET_BIT(hgfxtim->Instance->IER, pPacer->FrameEvent | pPacer->RenderEvent);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Stop the frame pacer.
+  * @note   The interrupts of the frame and render events are disabled, an ongoing
+  *         rendering or display refresh is not aborted.
+  * @param  hgfxtim GFXTIM handle.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_GFXTIM_FramePacer_Stop(GFXTIM_HandleTypeDef *hgfxtim)
+{
+  const GFXTIM_FramePacerTypeDef *ppacer = hgfxtim->pFramePacer;
+
+  if (ppacer == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  CLEAR_BIT(hgfxtim->Instance->IER, ppacer->FrameEvent | ppacer->RenderEvent);
+  hgfxtim->pFramePacer = NULL;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Present the rendered buffer, it is flipped at the next frame event.
+  * @note   This function can be called from the rendering completion callback.
+  * @param  hgfxtim GFXTIM handle.
+  * @retval HAL status, HAL_ERROR when no rendering is ongoing.
+  */
+HAL_StatusTypeDef HAL_GFXTIM_FramePacer_Present(GFXTIM_HandleTypeDef *hgfxtim)
+{
+  GFXTIM_FramePacerTypeDef *ppacer = hgfxtim->pFramePacer;
+  uint32_t events;
+
+  if ((ppacer == NULL) || (ppacer->RenderBuffer == GFXTIM_FRAMEPACER_NO_BUFFER))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Mask the pacer events while the buffer indexes are updated */
+  events = ppacer->FrameEvent | ppacer->RenderEvent;
+  CLEAR_BIT(hgfxtim->Instance->IER, events);
+
+  /* The rendering only starts on a free buffer, no buffer is queued */
+  ppacer->QueuedBuffer = ppacer->RenderBuffer;
+  ppacer->RenderBuffer = GFXTIM_FRAMEPACER_NO_BUFFER;
+
+  SET_BIT(hgfxtim->Instance->IER, events);
+
+  return HAL_OK;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/** @addtogroup GFXTIM_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Flip the presented buffer and schedule the next rendering.
+  * @param  hgfxtim GFXTIM handle.
+  * @param  interrupts Pending and enabled GFXTIM interrupts.
+  * @retval None.
+  */
+static void GFXTIM_FramePacerProcess(GFXTIM_HandleTypeDef *hgfxtim, uint32_t interrupts)
+{
+  GFXTIM_FramePacerTypeDef *ppacer = hgfxtim->pFramePacer;
+
+  if ((interrupts & ppacer->FrameEvent) != 0U)
+  {
+    ppacer->FrameCount++;
+    if (ppacer->QueuedBuffer != GFXTIM_FRAMEPACER_NO_BUFFER)
+    {
+      /* The previous front buffer becomes free */
+      ppacer->FrontBuffer = ppacer->QueuedBuffer;
+      ppacer->QueuedBuffer = GFXTIM_FRAMEPACER_NO_BUFFER;
+      ppacer->FlipCallback(ppacer, ppacer->BufferAddress[ppacer->FrontBuffer]);
+    }
+    else
+    {
+      /* Late rendering, the display keeps the previous frame */
+      ppacer->RepeatCount++;
+    }
+
+    if (ppacer->RenderEvent == 0U)
+    {
+      GFXTIM_FramePacerRender(ppacer);
+    }
+  }
+
+  if ((interrupts & ppacer->RenderEvent) != 0U)
+  {
+    GFXTIM_FramePacerRender(ppacer);
+  }
+}
+
+/**
+  * @brief  Start the rendering into a free buffer if none is ongoing.
+  * @param  pPacer Frame pacer.
+  * @retval None.
+  */
+static void GFXTIM_FramePacerRender(GFXTIM_FramePacerTypeDef *pPacer)
+{
+  uint32_t index;
+
+  if (pPacer->RenderBuffer == GFXTIM_FRAMEPACER_NO_BUFFER)
+  {
+    for (index = 0U; index < pPacer->BufferNb; index++)
+    {
+      if ((index != pPacer->FrontBuffer) && (index != pPacer->QueuedBuffer))
+      {
+        pPacer->RenderBuffer = index;
+        pPacer->RenderCallback(pPacer, pPacer->BufferAddress[index]);
+        break;
+      }
+    }
+  }
+}
+
 /**
   * @}
   */
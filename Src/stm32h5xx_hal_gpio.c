@@ -88,6 +88,14 @@
 
    (#) To lock pin configuration until next reset use HAL_GPIO_LockPin().
 
+    (#) To output a sequence of pin patterns at a fixed rate without the CPU (parallel
+        bus, bit-banged protocol), use HAL_GPIO_StreamStart_DMA(): a DMA channel paced
+        by a timer update event writes one BSRR value per event.
+
+    (#) To capture the port input data (IDR) on each edge of an EXTI line without CPU
+        interrupt, configure the pin in GPIO_MODE_EVT_xxx mode and use
+        HAL_DMAEx_EventCapture_Start() with the EXTI line as DMA trigger.
+
     (#) During and just after reset, the alternate functions are not
         active and the GPIO pins are configured in input floating mode (except JTAG
         pins).
@@ -577,6 +585,8 @@ void HAL_GPIO_DisableHighSPeedLowVoltage(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin)
   */
 void HAL_GPIO_EXTI_IRQHandler(uint16_t GPIO_Pin)
 {
+  HAL_TRACE_ENTER(HAL_TRACE_ID_GPIO_EXTI_IRQ, NULL);
+
   /* EXTI line interrupt detected */
   if (__HAL_GPIO_EXTI_GET_RISING_IT(GPIO_Pin) != 0U)
   {
@@ -589,6 +599,8 @@ void HAL_GPIO_EXTI_IRQHandler(uint16_t GPIO_Pin)
     __HAL_GPIO_EXTI_CLEAR_FALLING_IT(GPIO_Pin);
     HAL_GPIO_EXTI_Falling_Callback(GPIO_Pin);
   }
+
+  HAL_TRACE_EXIT(HAL_TRACE_ID_GPIO_EXTI_IRQ, NULL);
 }
 
 /**
@@ -739,6 +751,139 @@ HAL_StatusTypeDef HAL_GPIO_GetConfigPinAttributes(const GPIO_TypeDef *GPIOx, uin
 
 #endif /* __ARM_FEATURE_CMSE */
 
+#if defined(HAL_DMA_MODULE_ENABLED)
+
+/** @defgroup GPIO_Exported_Functions_Group4 IO streaming functions
+  *  @brief GPIO pin patterns streaming by DMA.
+  *
+@verbatim
+ ===============================================================================
+                       ##### IO streaming functions #####
+ ===============================================================================
+  [..]
+    (#) Configure the bus pins in output mode with HAL_GPIO_Init(), with a speed
+        fitting the stream rate.
+    (#) Build the BSRR values of the stream, with __HAL_GPIO_BSRR_PATTERN() or with
+        HAL_GPIO_BuildBusPatterns() for a parallel bus with a write strobe (8080 style).
+    (#) Initialize a DMA channel in normal mode with HAL_DMA_Init(): request of the
+        pacing timer update event (e.g. GPDMA1_REQUEST_TIM2_UP), memory to peripheral,
+        source incremented, destination fixed, word data width.
+    (#) Initialize the pacing timer with HAL_TIM_Base_Init(), its period giving the
+        patterns rate, and enable its update DMA request with __HAL_TIM_ENABLE_DMA().
+    (#) Start the stream with HAL_GPIO_StreamStart_DMA() and the timer with
+        HAL_TIM_Base_Start(). The end of the stream is notified by the DMA transfer
+        complete callback, and the stream is aborted with HAL_GPIO_StreamStop_DMA().
+    (#) The same patterns can be output again with HAL_DMA_Restart().
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Build the BSRR values writing data words on a parallel bus.
+  * @note   With a StrobePin, each data word gives 2 patterns: the data with the
+  *         strobe reset, then the strobe set (write on the rising edge). Otherwise,
+  *         each data word gives one pattern.
+  * @param  pData Data words to be written
+  * @param  Size Number of data words
+  * @param  pPatterns BSRR values buffer, of Size or 2 x Size words with a StrobePin
+  * @param  DataPins specifies the consecutive port bits of the data bus.
+  * @param  DataPosition Position of the data bit 0 in the port
+  * @param  StrobePin specifies the port bit of the write strobe, or 0 if none.
+  * @retval Number of patterns built
+  */
+uint32_t HAL_GPIO_BuildBusPatterns(const uint16_t *pData, uint32_t Size, uint32_t *pPatterns,
+                                   uint16_t DataPins, uint32_t DataPosition, uint16_t StrobePin)
+{
+  uint32_t pattern;
+  uint32_t count = 0U;
+  uint32_t i;
+
+  /* Check null pointer */
+  if ((pData == NULL) || (pPatterns == NULL))
+  {
+    return 0U;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_GPIO_PIN(DataPins));
+  assert_param(DataPosition < 16U);
+  assert_param((DataPins & StrobePin) == 0U);
+
+  for (i = 0U; i < Size; i++)
+  {
+    pattern = __HAL_GPIO_BSRR_PATTERN(DataPins, ((uint32_t)pData[i] << DataPosition));
+
+    if (StrobePin != 0U)
+    {
+      pPatterns[count] = pattern | ((uint32_t)StrobePin << 16U);
+      count++;
+      pPatterns[count] = (uint32_t)StrobePin;
+    }
+    else
+    {
+      pPatterns[count] = pattern;
+    }
+    count++;
+  }
+
+  return count;
+}
+
+/**
+  * @brief  Start writing a sequence of BSRR values to a GPIO port by DMA.
+  * @note   The DMA channel is paced by its request, typically a timer update event.
+  * @param  GPIOx: where x can be (A..I) for stm32h56xxx and stm32h57xxx family lines and
+  *         (A..D or H) for stm32h503xx family line to select the GPIO peripheral for STM32H5 family
+  * @param  hdma DMA handle, initialized in normal mode from memory to peripheral
+  * @param  pPatterns BSRR values to be written
+  * @param  Count Number of BSRR values
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_GPIO_StreamStart_DMA(GPIO_TypeDef *GPIOx, DMA_HandleTypeDef *hdma,
+                                           const uint32_t *pPatterns, uint32_t Count)
+{
+  /* Check null pointer */
+  if ((hdma == NULL) || (pPatterns == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_GPIO_ALL_INSTANCE(GPIOx));
+
+  /* One block of Count words */
+  if ((Count == 0U) || ((Count * 4U) > DMA_CBR1_BNDT) || ((hdma->Mode & DMA_LINKEDLIST) == DMA_LINKEDLIST))
+  {
+    return HAL_ERROR;
+  }
+
+  return HAL_DMA_Start_IT(hdma, (uint32_t)pPatterns, (uint32_t)&GPIOx->BSRR, Count * 4U);
+}
+
+/**
+  * @brief  Abort a GPIO stream started by HAL_GPIO_StreamStart_DMA().
+  * @note   The pins keep the last pattern written.
+  * @param  hdma DMA handle of the stream
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_GPIO_StreamStop_DMA(DMA_HandleTypeDef *hdma)
+{
+  /* Check null pointer */
+  if (hdma == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  return HAL_DMA_Abort(hdma);
+}
+
+/**
+  * @}
+  */
+
+#endif /* HAL_DMA_MODULE_ENABLED */
+
 
 /**
   * @}
@@ -77,6 +77,10 @@
     (#) Configure or get back MPCBB memories attributes using
         HAL_GTZC_MPCBB_ConfigMemAttributes() / HAL_GTZC_MPCBB_GetConfigMemAttributes()
 
+    (#) Apply a constant map of secure and privileged blocks, built at compile time
+        with HAL_GTZC_MPCBB_BLOCKS(), using HAL_GTZC_MPCBB_ConfigMap(). One register
+        is written per super-block, and only when its value changes
+
     (#) Lock MPCBB configuration or get lock status using HAL_GTZC_MPCBB_Lock() /
         HAL_GTZC_MPCBB_GetLock()
 
@@ -242,6 +246,8 @@
 
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
+static GTZC_MPCBB_TypeDef *GTZC_MPCBB_GetInstance(uint32_t MemAddress, uint32_t EndAddress,
+                                                  uint32_t *pBaseAddress);
 /* Exported functions --------------------------------------------------------*/
 
 /** @defgroup GTZC_Exported_Functions GTZC Exported Functions
@@ -1440,6 +1446,90 @@ HAL_StatusTypeDef HAL_GTZC_MPCBB_GetConfigMemAttributes(uint32_t MemAddress,
   return HAL_OK;
 }
 
+/**
+  * @brief  Apply a map of MPCBB block attributes, one register written per super-block
+  *         and only when its value changes.
+  * @param  pMap pointer to the map entries, usually a constant table built at compile time.
+  *         The structure description is available in @ref GTZC_Exported_Types.
+  * @param  NbEntries number of map entries.
+  * @note   An error is returned when an attribute change is needed on a locked super-block,
+  *         the previous entries being applied.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_GTZC_MPCBB_ConfigMap(const MPCBB_AttributeMapTypeDef *pMap,
+                                           uint32_t NbEntries)
+{
+  GTZC_MPCBB_TypeDef *mpcbb_ptr;
+  const MPCBB_AttributeMapTypeDef *entry;
+  uint32_t base_address;
+  uint32_t end_address;
+  uint32_t superblock;
+  uint32_t locked;
+  uint32_t e;
+  uint32_t i;
+
+  if (pMap == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  for (e = 0U; e < NbEntries; e++)
+  {
+    entry = &pMap[e];
+
+    /* check that MemAddress is well super-block aligned */
+    if (((entry->MemAddress % GTZC_MPCBB_SUPERBLOCK_SIZE) != 0U) || (entry->NbSuperBlocks == 0U))
+    {
+      return HAL_ERROR;
+    }
+
+    end_address = entry->MemAddress + (entry->NbSuperBlocks * GTZC_MPCBB_SUPERBLOCK_SIZE) - 1U;
+    mpcbb_ptr = GTZC_MPCBB_GetInstance(entry->MemAddress, end_address, &base_address);
+    if (mpcbb_ptr == NULL)
+    {
+      return HAL_ERROR;
+    }
+
+    superblock = (entry->MemAddress - base_address) / GTZC_MPCBB_SUPERBLOCK_SIZE;
+
+#if defined(__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U)
+    /* limitation: code not portable with memory > 512K */
+    locked = READ_REG(mpcbb_ptr->CFGLOCKR1);
+#else
+    locked = 0U;
+#endif /* defined(__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U) */
+
+    for (i = 0U; i < entry->NbSuperBlocks; i++)
+    {
+#if defined(__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U)
+      /* secure configuration */
+      if ((entry->pSecConfig != NULL) && (READ_REG(mpcbb_ptr->SECCFGR[superblock]) != entry->pSecConfig[i]))
+      {
+        if ((locked & (1UL << superblock)) != 0U)
+        {
+          return HAL_ERROR;
+        }
+        WRITE_REG(mpcbb_ptr->SECCFGR[superblock], entry->pSecConfig[i]);
+      }
+#endif /* defined(__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U) */
+
+      /* privilege configuration */
+      if ((entry->pPrivConfig != NULL) && (READ_REG(mpcbb_ptr->PRIVCFGR[superblock]) != entry->pPrivConfig[i]))
+      {
+        if ((locked & (1UL << superblock)) != 0U)
+        {
+          return HAL_ERROR;
+        }
+        WRITE_REG(mpcbb_ptr->PRIVCFGR[superblock], entry->pPrivConfig[i]);
+      }
+
+      superblock++;
+    }
+  }
+
+  return HAL_OK;
+}
+
 #if defined(__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U)
 /**
   * @brief  Lock MPCBB super-blocks on the SRAM passed as parameter.
@@ -2075,6 +2165,104 @@ __weak void HAL_GTZC_TZIC_Callback(uint32_t PeriphId)
 
 #endif /* defined(__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U) */
 
+/**
+  * @}
+  */
+
+/** @defgroup GTZC_Private_Functions GTZC Private Functions
+  * @{
+  */
+
+/**
+  * @brief  Get the MPCBB of the SRAM holding an address range.
+  * @param  MemAddress start address of the range.
+  * @param  EndAddress end address of the range.
+  * @param  pBaseAddress SRAM base address in the alias of the range.
+  * @retval MPCBB instance, NULL when the range is not within one SRAM.
+  */
+static GTZC_MPCBB_TypeDef *GTZC_MPCBB_GetInstance(uint32_t MemAddress, uint32_t EndAddress,
+                                                  uint32_t *pBaseAddress)
+{
+  GTZC_MPCBB_TypeDef *mpcbb_ptr = NULL;
+
+  if (((IS_ADDRESS_IN_NS(SRAM1, MemAddress))
+       && (IS_ADDRESS_IN_NS(SRAM1, EndAddress))) != 0U)
+  {
+    mpcbb_ptr = GTZC_MPCBB1;
+    *pBaseAddress = SRAM1_BASE_NS;
+  }
+#if defined (GTZC_TZIC1)
+  else if (((IS_ADDRESS_IN_S(SRAM1, MemAddress))
+            && (IS_ADDRESS_IN_S(SRAM1, EndAddress))) != 0U)
+  {
+    mpcbb_ptr = GTZC_MPCBB1;
+    *pBaseAddress = SRAM1_BASE_S;
+  }
+#endif /* defined (GTZC_TZIC1) */
+  else if (((IS_ADDRESS_IN_NS(SRAM2, MemAddress))
+            && (IS_ADDRESS_IN_NS(SRAM2, EndAddress))) != 0U)
+  {
+    mpcbb_ptr = GTZC_MPCBB2;
+    *pBaseAddress = SRAM2_BASE_NS;
+  }
+#if defined (GTZC_TZIC1)
+  else if (((IS_ADDRESS_IN_S(SRAM2, MemAddress))
+            && (IS_ADDRESS_IN_S(SRAM2, EndAddress))) != 0U)
+  {
+    mpcbb_ptr = GTZC_MPCBB2;
+    *pBaseAddress = SRAM2_BASE_S;
+  }
+#endif /* defined (GTZC_TZIC1) */
+#if defined(GTZC_MPCBB3)
+  else if (((IS_ADDRESS_IN_NS(SRAM3, MemAddress))
+            && (IS_ADDRESS_IN_NS(SRAM3, EndAddress))) != 0U)
+  {
+    mpcbb_ptr = GTZC_MPCBB3;
+    *pBaseAddress = SRAM3_BASE_NS;
+  }
+  else if (((IS_ADDRESS_IN_S(SRAM3, MemAddress))
+            && (IS_ADDRESS_IN_S(SRAM3, EndAddress))) != 0U)
+  {
+    mpcbb_ptr = GTZC_MPCBB3;
+    *pBaseAddress = SRAM3_BASE_S;
+  }
+#endif /* defined (GTZC_MPCBB3) */
+#if defined(GTZC_MPCBB4)
+  else if (((IS_ADDRESS_IN_NS(SRAM4, MemAddress))
+            && (IS_ADDRESS_IN_NS(SRAM4, EndAddress))) != 0U)
+  {
+    mpcbb_ptr = GTZC_MPCBB4;
+    *pBaseAddress = SRAM4_BASE_NS;
+  }
+  else if (((IS_ADDRESS_IN_S(SRAM4, MemAddress))
+            && (IS_ADDRESS_IN_S(SRAM4, EndAddress))) != 0U)
+  {
+    mpcbb_ptr = GTZC_MPCBB4;
+    *pBaseAddress = SRAM4_BASE_S;
+  }
+#endif /* defined(GTZC_MPCBB4) */
+#if defined (GTZC_MPCBB5)
+  else if (((IS_ADDRESS_IN_NS(SRAM5, MemAddress))
+            && (IS_ADDRESS_IN_NS(SRAM5, EndAddress))) != 0U)
+  {
+    mpcbb_ptr = GTZC_MPCBB5;
+    *pBaseAddress = SRAM5_BASE_NS;
+  }
+  else if (((IS_ADDRESS_IN_S(SRAM5, MemAddress))
+            && (IS_ADDRESS_IN_S(SRAM5, EndAddress))) != 0U)
+  {
+    mpcbb_ptr = GTZC_MPCBB5;
+    *pBaseAddress = SRAM5_BASE_S;
+  }
+#endif /* defined(GTZC_MPCBB5) */
+  else
+  {
+    /* nothing to do */
+  }
+
+  return mpcbb_ptr;
+}
+
 /**
   * @}
   */
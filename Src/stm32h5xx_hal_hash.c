@@ -81,6 +81,20 @@
              same API HAL_HASH_Start_DMA()for HASH and HAL_HASH_HMAC_Start_DMA() API for HMAC and
              retrieve as well the computed digest.
 
+        (##) In DMA mode, a message split in several fragments can also be hashed in a single
+             hardware pass with HAL_HASH_StartSG(). The input DMA channel must be initialized
+             in linked-list normal mode, the API builds one node per fragment in the queue and
+             node array provided by the user and links the queue to the input DMA channel.
+
+        (##) A flash or memory-mapped external memory region (e.g. a firmware image to verify)
+             is hashed in DMA mode with HAL_HASH_StartRegion_DMA(): the region is split in
+             chunks of HASH_REGION_CHUNK_SIZE bytes chained in the input DMA channel queue,
+             read by bursts. The CRC of the region can be computed by the same DMA channel.
+
+        (##) A message can be encrypted by the CRYP peripheral then authenticated with
+             HAL_HASH_HMAC_EncryptThenMAC(): the HMAC of each encrypted chunk is started by the
+             CRYP output DMA channel, overlapping the encryption and the authentication.
+
     (#)To use this driver (version 2.0.0) with application developed with old driver (version 1.0.0) user have to:
         (##) Add Algorithm as parameter like DataType or KeySize.
         (##) Use new API HAL_HASH_Start() for HASH and HAL_HASH_HMAC_Start() for HMAC processing instead of old API
@@ -120,18 +134,6 @@
   * @}
   */
 
-/** @defgroup HASH_Number_Of_CSR_Registers HASH Number of Context Swap Registers
-  * @{
-  */
-#if defined(HASH_ALGOSELECTION_SHA512)
-#define HASH_NUMBER_OF_CSR_REGISTERS              103U /*!< Number of Context Swap Registers */
-#else
-#define HASH_NUMBER_OF_CSR_REGISTERS              54U                          /*!< Number of Context Swap Registers */
-#endif /* HASH_ALGOSELECTION_SHA512 */
-/**
-  * @}
-  */
-
 /* Private Constants ---------------------------------------------------------*/
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
@@ -144,6 +146,9 @@ static void HASH_WriteData(HASH_HandleTypeDef *hhash, const uint8_t *pInBuffer,
 static HAL_StatusTypeDef HASH_WriteData_IT(HASH_HandleTypeDef *hhash);
 static void HASH_DMAXferCplt(DMA_HandleTypeDef *hdma);
 static void HASH_DMAError(DMA_HandleTypeDef *hdma);
+#if defined(USE_HAL_REQUEST) && (USE_HAL_REQUEST == 1U)
+static uint32_t HASH_RequestComplete(HASH_HandleTypeDef *hhash, HAL_StatusTypeDef Status);
+#endif /* USE_HAL_REQUEST */
 static HAL_StatusTypeDef HASH_WaitOnFlagUntilTimeout(HASH_HandleTypeDef *hhash, uint32_t Flag, FlagStatus Status,
                                                      uint32_t Timeout);
 /**
@@ -174,6 +179,8 @@ static HAL_StatusTypeDef HASH_WaitOnFlagUntilTimeout(HASH_HandleTypeDef *hhash,
           (+) Data Type : no swap, half word swap, bit swap or byte swap
           (+) Algorithm : MD5,SHA1 or SHA2
       (+) Get HASH configuration (HAL_HASH_GetConfig) from the specified parameters in the HASH_HandleTypeDef
+      (+) Save (HAL_HASH_SaveContext) and restore (HAL_HASH_RestoreContext) the context of a HASH
+          stream in a HASH_ContextTypeDef, to interleave several message digests computations
 
 @endverbatim
   * @{
@@ -245,6 +252,11 @@ HAL_StatusTypeDef HAL_HASH_Init(HASH_HandleTypeDef *hhash)
   /* Reset error code field */
   hhash->ErrorCode = HAL_HASH_ERROR_NONE;
 
+#if defined(USE_HAL_REQUEST) && (USE_HAL_REQUEST == 1U)
+  /* No asynchronous request ongoing */
+  hhash->pRequest = NULL;
+
+#endif /* USE_HAL_REQUEST */
 #if (USE_HAL_HASH_SUSPEND_RESUME == 1U)
   /* Reset suspension request flag */
   hhash->SuspendRequest = HAL_HASH_SUSPEND_NONE;
@@ -714,6 +726,119 @@ void HAL_HASH_Resume(HASH_HandleTypeDef *hhash, uint8_t *pMemBuffer)
   hhash->pHashKeyBuffPtr   = hhash->pHashKeyBuffPtr_saved;
 }
 
+#endif /* USE_HAL_HASH_SUSPEND_RESUME */
+
+/**
+  * @brief  Save the context of the current HASH stream in caller memory.
+  * @note   The IMR, STR, CR and all the CSR registers are saved together with the
+  *         handle configuration and phase. The HASH handle is then ready to start
+  *         the processing of another stream.
+  * @note   To be called between two HASH processing calls (e.g. after HAL_HASH_Accumulate()
+  *         or a multi-buffer HAL_HASH_Start_DMA()), the API waits for the end of the
+  *         current block processing.
+  * @param  hhash HASH handle.
+  * @param  pContext pointer to the HASH context structure where the stream context is saved.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_HASH_SaveContext(HASH_HandleTypeDef *hhash, HASH_ContextTypeDef *pContext)
+{
+  uint32_t i;
+
+  /* Check the HASH handle allocation */
+  if ((hhash == NULL) || (pContext == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hhash->State != HAL_HASH_STATE_READY)
+  {
+    /* Busy error code field */
+    hhash->ErrorCode |= HAL_HASH_ERROR_BUSY;
+    return HAL_ERROR;
+  }
+
+  /* The context swap registers are consistent once the hash core is idle */
+  if (HASH_WaitOnFlagUntilTimeout(hhash, HASH_FLAG_BUSY, SET, HASH_TIMEOUTVALUE) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Save HASH handle parameters */
+  pContext->Init         = hhash->Init;
+  pContext->Phase        = hhash->Phase;
+  pContext->Accumulation = hhash->Accumulation;
+
+  /* Save IMR, STR and CR registers content, only the r/w bits are saved */
+  pContext->IMR_Reg = READ_BIT(hhash->Instance->IMR, HASH_IT_DINI | HASH_IT_DCI);
+  pContext->STR_Reg = READ_BIT(hhash->Instance->STR, HASH_STR_NBLW);
+  pContext->CR_Reg  = READ_BIT(hhash->Instance->CR, HASH_CR_DMAE | HASH_CR_DATATYPE | HASH_CR_MODE | HASH_CR_ALGO |
+                               HASH_CR_LKEY | HASH_CR_MDMAT);
+
+  /* Save all the CSR registers */
+  for (i = 0U; i < HASH_NUMBER_OF_CSR_REGISTERS; i++)
+  {
+    pContext->CSR_Reg[i] = hhash->Instance->CSR[i];
+  }
+
+  /* The next processing on this handle starts a new message */
+  hhash->Phase = HAL_HASH_PHASE_READY;
+  hhash->Accumulation = 0U;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Restore the context of a HASH stream previously saved by HAL_HASH_SaveContext().
+  * @note   The processing of the stream then goes on with the HASH processing APIs.
+  * @param  hhash HASH handle.
+  * @param  pContext pointer to the HASH context structure holding the stream context.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_HASH_RestoreContext(HASH_HandleTypeDef *hhash, const HASH_ContextTypeDef *pContext)
+{
+  uint32_t i;
+
+  /* Check the HASH handle allocation */
+  if ((hhash == NULL) || (pContext == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hhash->State != HAL_HASH_STATE_READY)
+  {
+    /* Busy error code field */
+    hhash->ErrorCode |= HAL_HASH_ERROR_BUSY;
+    return HAL_ERROR;
+  }
+
+  if (HASH_WaitOnFlagUntilTimeout(hhash, HASH_FLAG_BUSY, SET, HASH_TIMEOUTVALUE) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Restore IMR, STR and CR registers content */
+  WRITE_REG(hhash->Instance->IMR, pContext->IMR_Reg);
+  WRITE_REG(hhash->Instance->STR, pContext->STR_Reg);
+  WRITE_REG(hhash->Instance->CR, pContext->CR_Reg);
+
+  /* Reset the HASH processor before restoring the Context Swap Registers (CSR) */
+  SET_BIT(hhash->Instance->CR, HASH_CR_INIT);
+
+  /* Restore all the CSR registers */
+  for (i = 0U; i < HASH_NUMBER_OF_CSR_REGISTERS; i++)
+  {
+    WRITE_REG(hhash->Instance->CSR[i], pContext->CSR_Reg[i]);
+  }
+
+  /* Restore HASH handle parameters */
+  hhash->Init         = pContext->Init;
+  hhash->Phase        = pContext->Phase;
+  hhash->Accumulation = pContext->Accumulation;
+
+  return HAL_OK;
+}
+
+#if (USE_HAL_HASH_SUSPEND_RESUME == 1U)
 /**
   * @brief  Initiate HASH processing suspension when in interruption mode.
   * @param  hhash HASH handle.
@@ -844,6 +969,15 @@ HAL_StatusTypeDef HAL_HASH_ProcessSuspend(HASH_HandleTypeDef *hhash)
           before entering the last buffer, reset the MDMAT bit with __HAL_HASH_RESET_MDMAT()
           macro then wrap-up the HASH processing in feeding the last input buffer through the
           same API HAL_HASH_Start_DMA()
+      (+) DMA scatter-gather mode : HAL_HASH_StartSG(), all the fragments are chained in a
+          DMA linked-list and the digest is computed in one call
+      (+) DMA memory region mode : HAL_HASH_StartRegion_DMA(), the region is read by bursts
+          and optionally fed to the CRC peripheral as well
+
+    [..]  With USE_HAL_REQUEST set to 1, HAL_HASH_Request_Start() is the Start function of a
+          HAL_RequestTypeDef computing the digest or the HMAC (Operation field) of the Size bytes
+          of pSrc into pDst in DMA mode. The request is completed once the digest is read,
+          HAL_HASH_DgstCpltCallback() and HAL_HASH_ErrorCallback() are not called for it.
 
 @endverbatim
   * @{
@@ -1130,6 +1264,442 @@ HAL_StatusTypeDef HAL_HASH_Start_DMA(HASH_HandleTypeDef *hhash, const uint8_t *c
   return status;
 }
 
+#if defined(USE_HAL_REQUEST) && (USE_HAL_REQUEST == 1U)
+/**
+  * @brief  Start the DMA processing of an asynchronous request.
+  * @note   Set as the Start function of the request, called by HAL_Request_Submit().
+  * @param  pReq pointer to the request, its Handle is the HASH handle and its Operation a value
+  *         of @ref HASH_Request_Operation.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_HASH_Request_Start(HAL_RequestTypeDef *pReq)
+{
+  HASH_HandleTypeDef *hhash = (HASH_HandleTypeDef *)pReq->Handle;
+  HAL_StatusTypeDef status;
+
+  if ((pReq->pSrc == NULL) || (pReq->pDst == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hhash->pRequest != NULL)
+  {
+    return HAL_BUSY;
+  }
+
+  hhash->pRequest = pReq;
+
+  if (pReq->Operation == HAL_HASH_REQUEST_HMAC)
+  {
+    status = HAL_HASH_HMAC_Start_DMA(hhash, pReq->pSrc, pReq->Size, pReq->pDst);
+  }
+  else
+  {
+    status = HAL_HASH_Start_DMA(hhash, pReq->pSrc, pReq->Size, pReq->pDst);
+  }
+
+  if (status != HAL_OK)
+  {
+    hhash->pRequest = NULL;
+  }
+
+  return status;
+}
+#endif /* USE_HAL_REQUEST */
+
+/**
+  * @brief  HASH peripheral processes in DMA mode a message split in several fragments
+  *         then reads the computed digest.
+  * @note   The input DMA channel must be initialized in linked-list normal mode
+  *         (DMA_LINKEDLIST_NORMAL), pQList is linked to it by this API.
+  * @note   Fragments are read by word: all of them must be word aligned and all but
+  *         the last one must have a size multiple of 4 bytes. Each fragment is limited
+  *         to 65532 bytes.
+  * @note   MDMAT bit must be reset, the digest is computed at the end of the last fragment.
+  * @param  hhash HASH handle.
+  * @param  pFragments pointer to the array of input fragments (message to be hashed).
+  * @param  FragmentNbr number of fragments.
+  * @param  pQList pointer to the DMA queue used to chain the fragments.
+  * @param  pNodes pointer to an array of FragmentNbr DMA nodes.
+  * @param  pOutBuffer pointer to the computed digest.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_HASH_StartSG(HASH_HandleTypeDef *hhash, const HASH_FragmentTypeDef *pFragments,
+                                   uint32_t FragmentNbr, DMA_QListTypeDef *pQList, DMA_NodeTypeDef *pNodes,
+                                   uint8_t *const pOutBuffer)
+{
+  HAL_StatusTypeDef status;
+  DMA_NodeConfTypeDef node_config;
+  uint32_t total_size = 0U;
+  uint32_t block_size;
+  uint32_t index;
+
+  /* Check the hash handle, fragments and DMA resources allocation */
+  if ((hhash == NULL) || (hhash->hdmain == NULL) || (pFragments == NULL) || (FragmentNbr == 0U) ||
+      (pQList == NULL) || (pNodes == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the input DMA channel mode and the single digest operation */
+  if ((hhash->hdmain->Mode != DMA_LINKEDLIST_NORMAL) || ((hhash->Instance->CR & HASH_CR_MDMAT) != 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hhash->State != HAL_HASH_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  /* Check the fragments alignment and size */
+  for (index = 0U; index < FragmentNbr; index++)
+  {
+    block_size = pFragments[index].Size;
+    if ((pFragments[index].pBuffer == NULL) || (block_size == 0U) || (block_size > (DMA_CBR1_BNDT & ~3U)) ||
+        (((uint32_t)pFragments[index].pBuffer & 3U) != 0U) ||
+        ((index != (FragmentNbr - 1U)) && ((block_size % 4U) != 0U)))
+    {
+      return HAL_ERROR;
+    }
+    total_size += block_size;
+  }
+
+  /* Prepare the memory to HASH_DIN node configuration */
+  node_config.NodeType                         = DMA_GPDMA_LINEAR_NODE;
+  node_config.Init.Request                     = GPDMA1_REQUEST_HASH_IN;
+  node_config.Init.BlkHWRequest                = DMA_BREQ_SINGLE_BURST;
+  node_config.Init.Direction                   = DMA_MEMORY_TO_PERIPH;
+  node_config.Init.SrcInc                      = DMA_SINC_INCREMENTED;
+  node_config.Init.DestInc                     = DMA_DINC_FIXED;
+  node_config.Init.SrcDataWidth                = DMA_SRC_DATAWIDTH_WORD;
+  node_config.Init.DestDataWidth               = DMA_DEST_DATAWIDTH_WORD;
+  node_config.Init.Priority                    = hhash->hdmain->InitLinkedList.Priority;
+  node_config.Init.SrcBurstLength              = 1U;
+  node_config.Init.DestBurstLength             = 1U;
+  node_config.Init.TransferAllocatedPort       = DMA_SRC_ALLOCATED_PORT0 | DMA_DEST_ALLOCATED_PORT0;
+  node_config.Init.TransferEventMode           = DMA_TCEM_LAST_LL_ITEM_TRANSFER;
+  node_config.Init.Mode                        = DMA_NORMAL;
+  node_config.DataHandlingConfig.DataExchange  = DMA_EXCHANGE_NONE;
+  node_config.DataHandlingConfig.DataAlignment = DMA_DATA_RIGHTALIGN_ZEROPADDED;
+  node_config.TriggerConfig.TriggerPolarity    = DMA_TRIG_POLARITY_MASKED;
+  node_config.TriggerConfig.TriggerMode        = 0U;
+  node_config.TriggerConfig.TriggerSelection   = 0U;
+  node_config.SrcAddress                       = (uint32_t)pFragments[0U].pBuffer;
+  node_config.DstAddress                       = (uint32_t)&hhash->Instance->DIN;
+  node_config.DataSize                         = (pFragments[0U].Size + 3U) & ~3U;
+#if defined (__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U)
+  node_config.SrcSecure                        = DMA_CHANNEL_SRC_SEC;
+  node_config.DestSecure                       = DMA_CHANNEL_DEST_SEC;
+#endif /* (__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U) */
+
+  /* Build the fragments queue, the first node is the template of the other fragments */
+  if ((HAL_DMAEx_List_ResetQ(pQList) != HAL_OK) || (HAL_DMAEx_List_BuildNode(&node_config, &pNodes[0U]) != HAL_OK) ||
+      (HAL_DMAEx_List_InsertNode_Tail(pQList, &pNodes[0U]) != HAL_OK))
+  {
+    return HAL_ERROR;
+  }
+
+  for (index = 1U; index < FragmentNbr; index++)
+  {
+    /* Last fragment size is rounded up to a whole word, NBLW gives the number of valid bits */
+    (void)HAL_DMAEx_List_CloneNode(&pNodes[0U], &pNodes[index], (uint32_t)pFragments[index].pBuffer,
+                                   (uint32_t)&hhash->Instance->DIN, (pFragments[index].Size + 3U) & ~3U);
+
+    if (HAL_DMAEx_List_InsertNode_Tail(pQList, &pNodes[index]) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  if (HAL_DMAEx_List_LinkQ(hhash->hdmain, pQList) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hhash);
+
+  /* Change the HASH state */
+  hhash->State = HAL_HASH_STATE_BUSY;
+
+  /* Reset HashInCount and Initialize Size, pHashInBuffPtr and pHashOutBuffPtr parameters */
+  hhash->HashInCount = 0U;
+  hhash->pHashInBuffPtr = pFragments[0U].pBuffer;
+  hhash->pHashOutBuffPtr = pOutBuffer;
+  hhash->Size = total_size;
+
+  /* Check if initialization phase has already been performed */
+  if (hhash->Phase == HAL_HASH_PHASE_READY)
+  {
+    /* Set HASH mode */
+    CLEAR_BIT(hhash->Instance->CR, HASH_CR_MODE);
+    /* Reset the HASH processor core */
+    MODIFY_REG(hhash->Instance->CR, HASH_CR_INIT, HASH_CR_INIT);
+
+    /* Set the phase */
+    hhash->Phase = HAL_HASH_PHASE_PROCESS;
+  }
+
+  /* Configure the number of valid bits in last word of the message, only the
+     last fragment may have a size which is not a multiple of 4 */
+  MODIFY_REG(hhash->Instance->STR, HASH_STR_NBLW, 8U * (total_size % 4U));
+
+  /* Set the HASH DMA transfer complete callback */
+  hhash->hdmain->XferCpltCallback = HASH_DMAXferCplt;
+  /* Set the DMA error callback */
+  hhash->hdmain->XferErrorCallback = HASH_DMAError;
+
+  status = HAL_DMAEx_List_Start_IT(hhash->hdmain);
+  if (status != HAL_OK)
+  {
+    /* DMA error code field */
+    hhash->ErrorCode |= HAL_HASH_ERROR_DMA;
+    hhash->State = HAL_HASH_STATE_READY;
+
+    /* Process Unlocked */
+    __HAL_UNLOCK(hhash);
+
+    /* Return error */
+#if (USE_HAL_HASH_REGISTER_CALLBACKS == 1U)
+    /*Call registered error callback*/
+    hhash->ErrorCallback(hhash);
+#else
+    /*Call legacy weak error callback*/
+    HAL_HASH_ErrorCallback(hhash);
+#endif /* USE_HAL_HASH_REGISTER_CALLBACKS */
+  }
+  else
+  {
+    /* Enable DMA requests */
+    SET_BIT(hhash->Instance->CR, HASH_CR_DMAE);
+  }
+
+  /* Return function status */
+  return status;
+}
+
+/**
+  * @brief  HASH peripheral processes in DMA mode a flash or memory-mapped memory region
+  *         then reads the computed digest.
+  * @note   The input DMA channel must be initialized in linked-list normal mode
+  *         (DMA_LINKEDLIST_NORMAL), pConfig->pQList is linked to it by this API.
+  * @note   The region is read by bursts of 8 words with a 32 bytes FIFO channel, 2 words otherwise.
+  * @note   When pConfig->hcrc is not NULL, the CRC data register is reset then each chunk is also
+  *         written to it by the input DMA channel before being hashed. The CRC of the region is read
+  *         from the CRC data register once the digest is computed.
+  * @note   MDMAT bit must be reset, the digest is computed at the end of the region.
+  * @param  hhash HASH handle.
+  * @param  pConfig pointer to the region configuration.
+  * @param  pOutBuffer pointer to the computed digest.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_HASH_StartRegion_DMA(HASH_HandleTypeDef *hhash, const HASH_RegionConfTypeDef *pConfig,
+                                           uint8_t *const pOutBuffer)
+{
+  HAL_StatusTypeDef status;
+  DMA_NodeConfTypeDef node_config;
+  uint32_t chunk_nbr;
+  uint32_t node_per_chunk = 1U;
+  uint32_t chunk_address;
+  uint32_t chunk_size;
+  uint32_t index;
+#if defined(HAL_CRC_MODULE_ENABLED)
+  DMA_NodeConfTypeDef crc_node_config;
+#endif /* HAL_CRC_MODULE_ENABLED */
+
+  /* Check the hash handle, region and DMA resources allocation */
+  if ((hhash == NULL) || (hhash->hdmain == NULL) || (pConfig == NULL) || (pConfig->Size == 0U) ||
+      ((pConfig->Address & 3U) != 0U) || (pConfig->pQList == NULL) || (pConfig->pNodes == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the input DMA channel mode and the single digest operation */
+  if ((hhash->hdmain->Mode != DMA_LINKEDLIST_NORMAL) || ((hhash->Instance->CR & HASH_CR_MDMAT) != 0U))
+  {
+    return HAL_ERROR;
+  }
+
+#if defined(HAL_CRC_MODULE_ENABLED)
+  if (pConfig->hcrc != NULL)
+  {
+    /* The CRC is fed by words */
+    if (((pConfig->Size % 4U) != 0U) || (pConfig->hcrc->InputDataFormat != CRC_INPUTDATA_FORMAT_WORDS))
+    {
+      return HAL_ERROR;
+    }
+    node_per_chunk = 2U;
+  }
+#endif /* HAL_CRC_MODULE_ENABLED */
+
+  chunk_nbr = (pConfig->Size + HASH_REGION_CHUNK_SIZE - 1U) / HASH_REGION_CHUNK_SIZE;
+  if (pConfig->NodeNbr < (chunk_nbr * node_per_chunk))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hhash->State != HAL_HASH_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  /* Prepare the memory to HASH_DIN node configuration */
+  node_config.NodeType                         = DMA_GPDMA_LINEAR_NODE;
+  node_config.Init.Request                     = GPDMA1_REQUEST_HASH_IN;
+  node_config.Init.BlkHWRequest                = DMA_BREQ_SINGLE_BURST;
+  node_config.Init.Direction                   = DMA_MEMORY_TO_PERIPH;
+  node_config.Init.SrcInc                      = DMA_SINC_INCREMENTED;
+  node_config.Init.DestInc                     = DMA_DINC_FIXED;
+  node_config.Init.SrcDataWidth                = DMA_SRC_DATAWIDTH_WORD;
+  node_config.Init.DestDataWidth               = DMA_DEST_DATAWIDTH_WORD;
+  node_config.Init.Priority                    = hhash->hdmain->InitLinkedList.Priority;
+  /* Read the region by the largest burst the channel FIFO can hold */
+  node_config.Init.SrcBurstLength              = (IS_DMA_2D_ADDRESSING_INSTANCE(hhash->hdmain->Instance) != 0U) ?
+                                                 8U : 2U;
+  node_config.Init.DestBurstLength             = 1U;
+  node_config.Init.TransferAllocatedPort       = DMA_SRC_ALLOCATED_PORT0 | DMA_DEST_ALLOCATED_PORT0;
+  node_config.Init.TransferEventMode           = DMA_TCEM_LAST_LL_ITEM_TRANSFER;
+  node_config.Init.Mode                        = DMA_NORMAL;
+  node_config.DataHandlingConfig.DataExchange  = DMA_EXCHANGE_NONE;
+  node_config.DataHandlingConfig.DataAlignment = DMA_DATA_RIGHTALIGN_ZEROPADDED;
+  node_config.TriggerConfig.TriggerPolarity    = DMA_TRIG_POLARITY_MASKED;
+  node_config.TriggerConfig.TriggerMode        = 0U;
+  node_config.TriggerConfig.TriggerSelection   = 0U;
+  node_config.SrcAddress                       = pConfig->Address;
+  node_config.DstAddress                       = (uint32_t)&hhash->Instance->DIN;
+  node_config.DataSize                         = HASH_REGION_CHUNK_SIZE;
+#if defined (__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U)
+  node_config.SrcSecure                        = DMA_CHANNEL_SRC_SEC;
+  node_config.DestSecure                       = DMA_CHANNEL_DEST_SEC;
+#endif /* (__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U) */
+
+  if (HAL_DMAEx_List_ResetQ(pConfig->pQList) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+#if defined(HAL_CRC_MODULE_ENABLED)
+  if (pConfig->hcrc != NULL)
+  {
+    /* The memory to CRC_DR nodes are software requested, the destination is fixed */
+    crc_node_config                            = node_config;
+    crc_node_config.Init.Request               = DMA_REQUEST_SW;
+    crc_node_config.Init.Direction             = DMA_MEMORY_TO_MEMORY;
+    crc_node_config.Init.DestBurstLength       = crc_node_config.Init.SrcBurstLength;
+    crc_node_config.DstAddress                 = (uint32_t)&pConfig->hcrc->Instance->DR;
+
+    if (HAL_DMAEx_List_BuildNode(&crc_node_config, &pConfig->pNodes[1U]) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+
+    /* Reset the CRC calculation unit */
+    __HAL_CRC_DR_RESET(pConfig->hcrc);
+  }
+#endif /* HAL_CRC_MODULE_ENABLED */
+
+  /* The first node is the template of the other chunks */
+  if (HAL_DMAEx_List_BuildNode(&node_config, &pConfig->pNodes[0U]) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  for (index = 0U; index < chunk_nbr; index++)
+  {
+    chunk_address = pConfig->Address + (index * HASH_REGION_CHUNK_SIZE);
+    chunk_size = ((index + 1U) < chunk_nbr) ? HASH_REGION_CHUNK_SIZE :
+                 (pConfig->Size - (index * HASH_REGION_CHUNK_SIZE));
+
+#if defined(HAL_CRC_MODULE_ENABLED)
+    /* Feed the CRC with the chunk before hashing it, the last node of the queue feeds the HASH */
+    if (pConfig->hcrc != NULL)
+    {
+      (void)HAL_DMAEx_List_CloneNode(&pConfig->pNodes[1U], &pConfig->pNodes[(2U * index) + 1U], chunk_address,
+                                     (uint32_t)&pConfig->hcrc->Instance->DR, chunk_size);
+
+      if (HAL_DMAEx_List_InsertNode_Tail(pConfig->pQList, &pConfig->pNodes[(2U * index) + 1U]) != HAL_OK)
+      {
+        return HAL_ERROR;
+      }
+    }
+#endif /* HAL_CRC_MODULE_ENABLED */
+
+    /* Last chunk size is rounded up to a whole word, NBLW gives the number of valid bits */
+    (void)HAL_DMAEx_List_CloneNode(&pConfig->pNodes[0U], &pConfig->pNodes[node_per_chunk * index], chunk_address,
+                                   (uint32_t)&hhash->Instance->DIN, (chunk_size + 3U) & ~3U);
+
+    if (HAL_DMAEx_List_InsertNode_Tail(pConfig->pQList, &pConfig->pNodes[node_per_chunk * index]) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  if (HAL_DMAEx_List_LinkQ(hhash->hdmain, pConfig->pQList) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hhash);
+
+  /* Change the HASH state */
+  hhash->State = HAL_HASH_STATE_BUSY;
+
+  /* Reset HashInCount and Initialize Size, pHashInBuffPtr and pHashOutBuffPtr parameters */
+  hhash->HashInCount = 0U;
+  hhash->pHashInBuffPtr = (const uint8_t *)pConfig->Address;
+  hhash->pHashOutBuffPtr = pOutBuffer;
+  hhash->Size = pConfig->Size;
+
+  /* Check if initialization phase has already been performed */
+  if (hhash->Phase == HAL_HASH_PHASE_READY)
+  {
+    /* Set HASH mode */
+    CLEAR_BIT(hhash->Instance->CR, HASH_CR_MODE);
+    /* Reset the HASH processor core */
+    MODIFY_REG(hhash->Instance->CR, HASH_CR_INIT, HASH_CR_INIT);
+
+    /* Set the phase */
+    hhash->Phase = HAL_HASH_PHASE_PROCESS;
+  }
+
+  /* Configure the number of valid bits in last word of the message */
+  MODIFY_REG(hhash->Instance->STR, HASH_STR_NBLW, 8U * (pConfig->Size % 4U));
+
+  /* Set the HASH DMA transfer complete callback */
+  hhash->hdmain->XferCpltCallback = HASH_DMAXferCplt;
+  /* Set the DMA error callback */
+  hhash->hdmain->XferErrorCallback = HASH_DMAError;
+
+  status = HAL_DMAEx_List_Start_IT(hhash->hdmain);
+  if (status != HAL_OK)
+  {
+    /* DMA error code field */
+    hhash->ErrorCode |= HAL_HASH_ERROR_DMA;
+    hhash->State = HAL_HASH_STATE_READY;
+
+    /* Process Unlocked */
+    __HAL_UNLOCK(hhash);
+
+    /* Return error */
+#if (USE_HAL_HASH_REGISTER_CALLBACKS == 1U)
+    /*Call registered error callback*/
+    hhash->ErrorCallback(hhash);
+#else
+    /*Call legacy weak error callback*/
+    HAL_HASH_ErrorCallback(hhash);
+#endif /* USE_HAL_HASH_REGISTER_CALLBACKS */
+  }
+  else
+  {
+    /* Enable DMA requests */
+    SET_BIT(hhash->Instance->CR, HASH_CR_DMAE);
+  }
+
+  /* Return function status */
+  return status;
+}
 
 /**
   * @brief  HASH peripheral processes in polling mode several input buffers.
@@ -1456,6 +2026,14 @@ HAL_StatusTypeDef HAL_HASH_AccumulateLast_IT(HASH_HandleTypeDef *hhash, const ui
           macro then wrap-up the HMAC processing in feeding the last input buffer through the
           same API HAL_HASH_HMAC_Start_DMA()
 
+    [..]  For encrypt-then-MAC processing, HAL_HASH_HMAC_EncryptThenMAC() encrypts the message
+          by chunks with HAL_CRYP_EncryptSG() and computes the HMAC of the ciphertext:
+      (+) the input DMA channel must be initialized in linked-list normal mode, each node of
+          the HMAC is triggered by the transfer complete event of the CRYP output DMA channel
+      (+) the CRYP must be configured (algorithm, key, IV) and the CRYP output callback is
+          called once the message is encrypted, HAL_HASH_DgstCpltCallback() once its HMAC is
+          computed
+
 @endverbatim
   * @{
   */
@@ -2193,6 +2771,216 @@ HAL_StatusTypeDef HAL_HASH_HMAC_Start_DMA(HASH_HandleTypeDef *hhash, const uint8
   return status;
 }
 
+#if defined(AES) && defined(HAL_CRYP_MODULE_ENABLED)
+/**
+  * @brief  Encrypt a message by chunks with the CRYP peripheral and compute in parallel
+  *         the HMAC of the ciphertext.
+  * @note   The HMAC DMA transfer of each chunk is triggered by the end of the CRYP output
+  *         DMA transfer of the chunk, both peripherals work in parallel on successive chunks.
+  * @param  hhash HASH handle, its input DMA channel initialized in linked-list normal mode.
+  * @param  pConfig pointer to the encrypt-then-MAC configuration.
+  * @param  pOutBuffer pointer to the computed HMAC.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_HASH_HMAC_EncryptThenMAC(HASH_HandleTypeDef *hhash, const HASH_EtMConfTypeDef *pConfig,
+                                               uint8_t *const pOutBuffer)
+{
+  HAL_StatusTypeDef status;
+  DMA_NodeConfTypeDef node_config;
+  uint32_t chunk_nbr;
+  uint32_t trigger;
+  uint32_t count;
+  uint32_t offset;
+  uint32_t size;
+  uint32_t index;
+
+  /* Check the hash handle, the configuration and the DMA resources allocation */
+  if ((hhash == NULL) || (hhash->hdmain == NULL) || (pConfig == NULL) || (pConfig->hcryp == NULL) ||
+      (pConfig->pPlain == NULL) || (pConfig->pCipher == NULL) || (pConfig->pFragments == NULL) ||
+      (pConfig->pQList == NULL) || (pConfig->pNodes == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the message and chunks sizes and alignment */
+  if ((pConfig->Size == 0U) || ((pConfig->Size % 16U) != 0U) || (pConfig->ChunkSize == 0U) ||
+      ((pConfig->ChunkSize % 16U) != 0U) || (pConfig->ChunkSize > 0xFFF0U) ||
+      ((((uint32_t)pConfig->pPlain | (uint32_t)pConfig->pCipher) & 3U) != 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the input DMA channel mode, the single digest operation and the CRYP output trigger */
+  if ((hhash->hdmain->Mode != DMA_LINKEDLIST_NORMAL) || ((hhash->Instance->CR & HASH_CR_MDMAT) != 0U) ||
+      (HAL_DMAEx_GetTransferCpltTrigger(pConfig->hcryp->hdmaout, &trigger) != HAL_OK))
+  {
+    return HAL_ERROR;
+  }
+
+  if ((hhash->State != HAL_HASH_STATE_READY) || (hhash->Phase != HAL_HASH_PHASE_READY))
+  {
+    return HAL_BUSY;
+  }
+
+  /* Split the message in chunks : plaintext fragments then ciphertext fragments */
+  chunk_nbr = (pConfig->Size + pConfig->ChunkSize - 1U) / pConfig->ChunkSize;
+  for (index = 0U; index < chunk_nbr; index++)
+  {
+    offset = index * pConfig->ChunkSize;
+    size = ((pConfig->Size - offset) < pConfig->ChunkSize) ? (pConfig->Size - offset) : pConfig->ChunkSize;
+    pConfig->pFragments[index].pBuffer = &pConfig->pPlain[offset];
+    pConfig->pFragments[index].Size = size;
+    pConfig->pFragments[chunk_nbr + index].pBuffer = &pConfig->pCipher[offset];
+    pConfig->pFragments[chunk_nbr + index].Size = size;
+  }
+
+  /* Prepare the ciphertext to HASH_DIN node configuration, one block per encrypted chunk */
+  node_config.NodeType                         = DMA_GPDMA_LINEAR_NODE;
+  node_config.Init.Request                     = GPDMA1_REQUEST_HASH_IN;
+  node_config.Init.BlkHWRequest                = DMA_BREQ_SINGLE_BURST;
+  node_config.Init.Direction                   = DMA_MEMORY_TO_PERIPH;
+  node_config.Init.SrcInc                      = DMA_SINC_INCREMENTED;
+  node_config.Init.DestInc                     = DMA_DINC_FIXED;
+  node_config.Init.SrcDataWidth                = DMA_SRC_DATAWIDTH_WORD;
+  node_config.Init.DestDataWidth               = DMA_DEST_DATAWIDTH_WORD;
+  node_config.Init.Priority                    = hhash->hdmain->InitLinkedList.Priority;
+  node_config.Init.SrcBurstLength              = 1U;
+  node_config.Init.DestBurstLength             = 1U;
+  node_config.Init.TransferAllocatedPort       = DMA_SRC_ALLOCATED_PORT0 | DMA_DEST_ALLOCATED_PORT0;
+  node_config.Init.TransferEventMode           = DMA_TCEM_LAST_LL_ITEM_TRANSFER;
+  node_config.Init.Mode                        = DMA_NORMAL;
+  node_config.DataHandlingConfig.DataExchange  = DMA_EXCHANGE_NONE;
+  node_config.DataHandlingConfig.DataAlignment = DMA_DATA_RIGHTALIGN_ZEROPADDED;
+  node_config.TriggerConfig.TriggerPolarity    = DMA_TRIG_POLARITY_RISING;
+  node_config.TriggerConfig.TriggerMode        = DMA_TRIGM_BLOCK_TRANSFER;
+  node_config.TriggerConfig.TriggerSelection   = trigger;
+  node_config.SrcAddress                       = (uint32_t)pConfig->pCipher;
+  node_config.DstAddress                       = (uint32_t)&hhash->Instance->DIN;
+  node_config.DataSize                         = pConfig->pFragments[0U].Size;
+#if defined (__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U)
+  node_config.SrcSecure                        = DMA_CHANNEL_SRC_SEC;
+  node_config.DestSecure                       = DMA_CHANNEL_DEST_SEC;
+#endif /* (__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U) */
+
+  /* Build the chunks queue, the first node is the template of the other chunks */
+  if ((HAL_DMAEx_List_ResetQ(pConfig->pQList) != HAL_OK) ||
+      (HAL_DMAEx_List_BuildNode(&node_config, &pConfig->pNodes[0U]) != HAL_OK) ||
+      (HAL_DMAEx_List_InsertNode_Tail(pConfig->pQList, &pConfig->pNodes[0U]) != HAL_OK))
+  {
+    return HAL_ERROR;
+  }
+
+  for (index = 1U; index < chunk_nbr; index++)
+  {
+    (void)HAL_DMAEx_List_CloneNode(&pConfig->pNodes[0U], &pConfig->pNodes[index],
+                                   (uint32_t)pConfig->pFragments[chunk_nbr + index].pBuffer,
+                                   (uint32_t)&hhash->Instance->DIN, pConfig->pFragments[chunk_nbr + index].Size);
+
+    if (HAL_DMAEx_List_InsertNode_Tail(pConfig->pQList, &pConfig->pNodes[index]) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  if (HAL_DMAEx_List_LinkQ(hhash->hdmain, pConfig->pQList) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hhash);
+
+  /* Change the HASH state */
+  hhash->State = HAL_HASH_STATE_BUSY;
+
+  /* Reset HashInCount and Initialize Size, pHashInBuffPtr and pHashOutBuffPtr parameters */
+  hhash->pHashInBuffPtr = pConfig->pCipher;
+  hhash->pHashOutBuffPtr = pOutBuffer;
+  hhash->pHashKeyBuffPtr = hhash->Init.pKey;
+  hhash->HashInCount = 0U;
+  hhash->Size = pConfig->Size;
+
+  /* Check if key size is larger than block size of the algorithm, accordingly set LKEY and the other setting */
+  if (hhash->Init.KeySize > (((hhash->Init.Algorithm == HASH_ALGOSELECTION_SHA1) ||
+                              (hhash->Init.Algorithm == HASH_ALGOSELECTION_SHA224) ||
+                              (hhash->Init.Algorithm == HASH_ALGOSELECTION_SHA256)) ? BLOCK_64B : BLOCK_128B))
+  {
+    MODIFY_REG(hhash->Instance->CR, HASH_CR_LKEY | HASH_CR_MODE | HASH_CR_INIT,
+               HASH_ALGOMODE_HMAC | HASH_LONGKEY | HASH_CR_INIT);
+  }
+  else
+  {
+    MODIFY_REG(hhash->Instance->CR, HASH_CR_LKEY | HASH_CR_MODE | HASH_CR_INIT,
+               HASH_ALGOMODE_HMAC | HASH_CR_INIT);
+  }
+
+  /* Set the phase */
+  hhash->Phase = HAL_HASH_PHASE_HMAC_STEP_1;
+
+  /* Configure the number of valid bits in last word of the Key */
+  MODIFY_REG(hhash->Instance->STR, HASH_STR_NBLW, 8U * ((hhash->Init.KeySize) % 4U));
+
+  /* Write Key */
+  HASH_WriteData(hhash, hhash->Init.pKey, hhash->Init.KeySize);
+
+  /* Start the Key padding then the Digest calculation */
+  SET_BIT(hhash->Instance->STR, HASH_STR_DCAL);
+
+  /* Wait for DCIS flag to be set */
+  count = HASH_TIMEOUTVALUE;
+  do
+  {
+    count--;
+    if (count == 0U)
+    {
+      /* Change state */
+      hhash->ErrorCode |= HAL_HASH_ERROR_TIMEOUT;
+      hhash->State = HAL_HASH_STATE_READY;
+      hhash->Phase = HAL_HASH_PHASE_READY;
+      __HAL_UNLOCK(hhash);
+      return HAL_ERROR;
+    }
+  } while (HAL_IS_BIT_CLR(hhash->Instance->SR, HASH_FLAG_BUSY));
+
+  /* The ciphertext is a whole number of words */
+  hhash->Phase = HAL_HASH_PHASE_HMAC_STEP_2;
+  MODIFY_REG(hhash->Instance->STR, HASH_STR_NBLW, 0U);
+
+  /* Set the HASH DMA transfer complete callback */
+  hhash->hdmain->XferCpltCallback = HASH_DMAXferCplt;
+  /* Set the DMA error callback */
+  hhash->hdmain->XferErrorCallback = HASH_DMAError;
+
+  /* The HMAC channel waits for the first encrypted chunk */
+  status = HAL_DMAEx_List_Start_IT(hhash->hdmain);
+  if (status == HAL_OK)
+  {
+    /* Enable DMA requests */
+    SET_BIT(hhash->Instance->CR, HASH_CR_DMAE);
+
+    status = HAL_CRYP_EncryptSG(pConfig->hcryp, pConfig->pFragments, &pConfig->pFragments[chunk_nbr], chunk_nbr);
+    if (status != HAL_OK)
+    {
+      (void)HAL_DMA_Abort(hhash->hdmain);
+      CLEAR_BIT(hhash->Instance->CR, HASH_CR_DMAE);
+    }
+  }
+
+  if (status != HAL_OK)
+  {
+    /* DMA error code field */
+    hhash->ErrorCode |= HAL_HASH_ERROR_DMA;
+    hhash->State = HAL_HASH_STATE_READY;
+    hhash->Phase = HAL_HASH_PHASE_READY;
+
+    /* Process Unlocked */
+    __HAL_UNLOCK(hhash);
+  }
+
+  /* Return function status */
+  return status;
+}
+#endif /* AES && HAL_CRYP_MODULE_ENABLED */
 
 /**
   * @}
@@ -2416,6 +3204,14 @@ static void HASH_DMAXferCplt(DMA_HandleTypeDef *hdma)
       /* Process UnLock */
       __HAL_UNLOCK(hhash);
 
+#if defined(USE_HAL_REQUEST) && (USE_HAL_REQUEST == 1U)
+      /* Asynchronous request : complete it instead of the callback */
+      if (HASH_RequestComplete(hhash, HAL_OK) != 0U)
+      {
+        return;
+      }
+
+#endif /* USE_HAL_REQUEST */
       /* Call digest complete call back */
 #if (USE_HAL_HASH_REGISTER_CALLBACKS == 1)
       hhash->DgstCpltCallback(hhash);
@@ -2479,6 +3275,14 @@ static void HASH_DMAXferCplt(DMA_HandleTypeDef *hdma)
         /* Process UnLock */
         __HAL_UNLOCK(hhash);
 
+#if defined(USE_HAL_REQUEST) && (USE_HAL_REQUEST == 1U)
+        /* Asynchronous request : complete it instead of the callback */
+        if (HASH_RequestComplete(hhash, HAL_OK) != 0U)
+        {
+          return;
+        }
+
+#endif /* USE_HAL_REQUEST */
         /* Call digest complete call back */
 #if (USE_HAL_HASH_REGISTER_CALLBACKS == 1)
         hhash->DgstCpltCallback(hhash);
@@ -2511,6 +3315,14 @@ static void HASH_DMAError(DMA_HandleTypeDef *hdma)
   present in HAL_HASH_ErrorCallback() */
   hhash->State = HAL_HASH_STATE_READY;
 
+#if defined(USE_HAL_REQUEST) && (USE_HAL_REQUEST == 1U)
+  /* Asynchronous request : complete it instead of the callback */
+  if (HASH_RequestComplete(hhash, HAL_ERROR) != 0U)
+  {
+    return;
+  }
+
+#endif /* USE_HAL_REQUEST */
 #if (USE_HAL_HASH_REGISTER_CALLBACKS == 1)
   hhash->ErrorCallback(hhash);
 #else
@@ -2518,6 +3330,30 @@ static void HASH_DMAError(DMA_HandleTypeDef *hdma)
 #endif /* USE_HAL_HASH_REGISTER_CALLBACKS */
 }
 
+#if defined(USE_HAL_REQUEST) && (USE_HAL_REQUEST == 1U)
+/**
+  * @brief  Complete the ongoing asynchronous request.
+  * @param  hhash HASH handle.
+  * @param  Status completion status of the request
+  * @retval 1 if a request was ongoing, 0 otherwise
+  */
+static uint32_t HASH_RequestComplete(HASH_HandleTypeDef *hhash, HAL_StatusTypeDef Status)
+{
+  HAL_RequestTypeDef *preq = hhash->pRequest;
+
+  if (preq == NULL)
+  {
+    return 0U;
+  }
+
+  /* The next request of the chain may be started on this HASH */
+  hhash->pRequest = NULL;
+  HAL_Request_Complete(preq, Status);
+
+  return 1U;
+}
+#endif /* USE_HAL_REQUEST */
+
 /**
   * @brief  Feed the input buffer to the HASH peripheral in polling.
   * @param  hhash HASH handle.
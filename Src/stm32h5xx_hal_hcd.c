@@ -2056,6 +2056,8 @@ static void HCD_HC_OUT_BulkDb(HCD_HandleTypeDef *hhcd, uint8_t ch_num, uint8_t p
 static uint16_t HAL_HCD_GetFreePMA(HCD_HandleTypeDef *hhcd, uint16_t mps);
 static HAL_StatusTypeDef  HAL_HCD_PMAFree(HCD_HandleTypeDef *hhcd, uint32_t pma_base, uint16_t mps);
 static void inline HCD_HC_IN_ISO(HCD_HandleTypeDef *hhcd, uint8_t ch_num, uint8_t phy_chnum, uint32_t regvalue);
+static void HCD_URBQueue_Process(HCD_HandleTypeDef *hhcd, uint8_t ch_num);
+static void HCD_URBQueue_Next(HCD_HandleTypeDef *hhcd, uint8_t ch_num, HCD_URBQueueTypeDef *pQueue);
 /**
   * @}
   */
@@ -2144,6 +2146,12 @@ HAL_StatusTypeDef HAL_HCD_Init(HCD_HandleTypeDef *hhcd)
   /* Init PMA Address */
   (void)HAL_HCD_PMAReset(hhcd);
 
+  /* No URB queue attached */
+  for (uint8_t i = 0U; i < 16U; i++)
+  {
+    hhcd->pURBQueue[i] = NULL;
+  }
+
   hhcd->State = HAL_HCD_STATE_READY;
 
   return HAL_OK;
@@ -2575,6 +2583,16 @@ __weak void HAL_HCD_ResumeCallback(HCD_HandleTypeDef *hhcd)
 [..] This subsection provides a set of functions allowing to manage the USB Host Data
 Transfer
 
+[..] A host channel can pipeline several URBs instead of polling HAL_HCD_HC_GetURBState()
+     between single requests:
+     (+) Attach a user ring of URBs and a completion callback to the initialized
+         channel with HAL_HCD_HC_URBQueue_Start().
+     (+) Submit URBs with HAL_HCD_HC_URBQueue_Submit(); the next URB is started from
+         the channel interrupt as soon as the previous one is done, stalled or failed,
+         and the completion callback is called for each of them.
+     (+) NAKed OUT transactions and transaction errors are retried by the driver.
+     (+) Detach the ring with HAL_HCD_HC_URBQueue_Stop().
+
 @endverbatim
   * @{
   */
@@ -2718,6 +2736,122 @@ HAL_StatusTypeDef HAL_HCD_HC_SubmitRequest(HCD_HandleTypeDef *hhcd, uint8_t ch_n
 
   return USB_HC_StartXfer(hhcd->Instance, &hhcd->hc[ch_num & 0xFU]);
 }
+
+/**
+  * @brief  Attach an URB queue to a host channel.
+  * @param  hhcd HCD handle
+  * @param  ch_num Channel number, initialized with HAL_HCD_HC_Init().
+  *         This parameter can be a value from 1 to 15
+  * @param  pQueue queue structure, provided by the user
+  * @param  pURBs array of Size URB descriptors, provided by the user
+  * @param  Size number of URBs that can be submitted at a time
+  * @param  pURBCpltCallback callback called from the channel interrupt at the end of each URB
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_HCD_HC_URBQueue_Start(HCD_HandleTypeDef *hhcd, uint8_t ch_num, HCD_URBQueueTypeDef *pQueue,
+                                            HCD_URBTypeDef *pURBs, uint32_t Size,
+                                            void (* pURBCpltCallback)(HCD_HandleTypeDef *hhcd, uint8_t ch_num,
+                                                                      HCD_URBTypeDef *pURB))
+{
+  if ((pQueue == NULL) || (pURBs == NULL) || (Size == 0U) || (pURBCpltCallback == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hhcd->pURBQueue[ch_num & 0xFU] != NULL)
+  {
+    return HAL_BUSY;
+  }
+
+  pQueue->pURBs = pURBs;
+  pQueue->Size = Size;
+  pQueue->Head = 0U;
+  pQueue->Tail = 0U;
+  pQueue->Busy = 0U;
+  pQueue->pURBCpltCallback = pURBCpltCallback;
+
+  hhcd->pURBQueue[ch_num & 0xFU] = pQueue;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Submit an URB on the queue of a host channel.
+  * @note   The direction and endpoint type are the ones given to HAL_HCD_HC_Init().
+  *         The URB is started at once when the channel is idle.
+  * @param  hhcd HCD handle
+  * @param  ch_num Channel number.
+  *         This parameter can be a value from 1 to 15
+  * @param  pbuff pointer to URB data
+  * @param  length Length of URB data
+  * @param  pContext user context returned with the URB
+  * @retval HAL status, HAL_BUSY when all the URBs of the ring are in use
+  */
+HAL_StatusTypeDef HAL_HCD_HC_URBQueue_Submit(HCD_HandleTypeDef *hhcd, uint8_t ch_num, uint8_t *pbuff,
+                                             uint16_t length, void *pContext)
+{
+  HCD_URBQueueTypeDef *p_queue = hhcd->pURBQueue[ch_num & 0xFU];
+  HCD_URBTypeDef *p_urb;
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t primask_bit;
+
+  if (p_queue == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Enter critical section: the channel interrupt updates the queue */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  if ((p_queue->Head - p_queue->Tail) >= p_queue->Size)
+  {
+    status = HAL_BUSY;
+  }
+  else
+  {
+    p_urb = &p_queue->pURBs[p_queue->Head % p_queue->Size];
+    p_urb->pBuffer = pbuff;
+    p_urb->Length = length;
+    p_urb->XferCount = 0U;
+    p_urb->URBState = URB_IDLE;
+    p_urb->pContext = pContext;
+    p_queue->Head++;
+
+    if (p_queue->Busy == 0U)
+    {
+      HCD_URBQueue_Next(hhcd, ch_num, p_queue);
+    }
+  }
+
+  /* Exit critical section: restore previous priority mask */
+  __set_PRIMASK(primask_bit);
+
+  return status;
+}
+
+/**
+  * @brief  Detach the URB queue of a host channel.
+  * @note   An URB already started is not aborted, use HAL_HCD_HC_Halt() for that.
+  * @param  hhcd HCD handle
+  * @param  ch_num Channel number.
+  *         This parameter can be a value from 1 to 15
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_HCD_HC_URBQueue_Stop(HCD_HandleTypeDef *hhcd, uint8_t ch_num)
+{
+  uint32_t primask_bit;
+
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  hhcd->pURBQueue[ch_num & 0xFU] = NULL;
+
+  __set_PRIMASK(primask_bit);
+
+  return HAL_OK;
+}
+
 /**
   * @brief  Handle HCD interrupt request.
   * @param  hhcd HCD handle
@@ -2761,6 +2895,9 @@ void HAL_HCD_IRQHandler(HCD_HandleTypeDef *hhcd)
       HCD_HC_IN_IRQHandler(hhcd, phy_chnum);
     }
 
+    /* Complete or retry the URB of a queued channel */
+    HCD_URBQueue_Process(hhcd, HAL_HCD_GetLogical_Channel(hhcd, phy_chnum, ch_dir));
+
     return;
   }
 
@@ -4166,6 +4303,80 @@ static void HCD_HC_OUT_IRQHandler(HCD_HandleTypeDef *hhcd, uint8_t chnum)
   }
 }
 
+/**
+  * @brief  Complete or retry the ongoing URB of a channel queue.
+  * @param  hhcd  HCD handle
+  * @param  ch_num Channel number
+  * @retval none
+  */
+static void HCD_URBQueue_Process(HCD_HandleTypeDef *hhcd, uint8_t ch_num)
+{
+  HCD_URBQueueTypeDef *p_queue = hhcd->pURBQueue[ch_num & 0xFU];
+  HCD_HCTypeDef *hc = &hhcd->hc[ch_num & 0xFU];
+  HCD_URBTypeDef *p_urb;
+  uint32_t xfer_count;
+
+  if ((p_queue == NULL) || (p_queue->Busy == 0U))
+  {
+    return;
+  }
+
+  if ((hc->urb_state == URB_DONE) || (hc->urb_state == URB_STALL) || (hc->urb_state == URB_ERROR))
+  {
+    p_urb = &p_queue->pURBs[p_queue->Tail % p_queue->Size];
+    p_urb->XferCount = (uint16_t)hc->xfer_count;
+    p_urb->URBState = hc->urb_state;
+
+    /* Release the URB before the callback, which may submit a new one */
+    p_queue->Tail++;
+    p_queue->Busy = 0U;
+
+    p_queue->pURBCpltCallback(hhcd, ch_num, p_urb);
+
+    if ((hhcd->pURBQueue[ch_num & 0xFU] == p_queue) && (p_queue->Busy == 0U))
+    {
+      HCD_URBQueue_Next(hhcd, ch_num, p_queue);
+    }
+  }
+  else if ((hc->urb_state == URB_NOTREADY) && (hc->ep_type != EP_TYPE_INTR) && (hc->doublebuffer == 0U) &&
+           ((hc->ep_is_in == 0U) || (hc->state == HC_XACTERR)))
+  {
+    /* Resend the remaining data, as an upper stack would do on URB_NOTREADY */
+    xfer_count = hc->xfer_count;
+    (void)HAL_HCD_HC_SubmitRequest(hhcd, ch_num, hc->ep_is_in, hc->ep_type, 1U,
+                                   hc->xfer_buff, (uint16_t)hc->xfer_len, 0U);
+    hc->xfer_count = xfer_count;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+}
+
+/**
+  * @brief  Start the next submitted URB of a channel queue.
+  * @param  hhcd  HCD handle
+  * @param  ch_num Channel number
+  * @param  pQueue channel queue
+  * @retval none
+  */
+static void HCD_URBQueue_Next(HCD_HandleTypeDef *hhcd, uint8_t ch_num, HCD_URBQueueTypeDef *pQueue)
+{
+  const HCD_URBTypeDef *p_urb;
+  const HCD_HCTypeDef *hc = &hhcd->hc[ch_num & 0xFU];
+
+  if (pQueue->Tail == pQueue->Head)
+  {
+    return;
+  }
+
+  p_urb = &pQueue->pURBs[pQueue->Tail % pQueue->Size];
+  pQueue->Busy = 1U;
+
+  (void)HAL_HCD_HC_SubmitRequest(hhcd, ch_num, hc->ep_is_in, hc->ep_type, 1U,
+                                 p_urb->pBuffer, p_urb->Length, 0U);
+}
+
 
 /**
   * @brief  Handle Host Port interrupt requests.
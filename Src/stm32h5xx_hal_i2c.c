@@ -56,6 +56,10 @@
 
     (#) To check if target device is ready for communication, use the function HAL_I2C_IsDeviceReady()
 
+    (#) To check a list of target devices without blocking (e.g bus scan at boot), use the function
+        HAL_I2C_Probe_IT(): each address is sent in turn from the I2C interrupt, and
+        HAL_I2C_ProbeCpltCallback() is executed once, with the result of each device in the probe structure
+
     (#) For I2C IO and IO MEM operations, three operation modes are available within this driver :
 
     *** Polling mode IO operation ***
@@ -453,6 +457,8 @@ static HAL_StatusTypeDef I2C_Mem_ISR_IT(struct __I2C_HandleTypeDef *hi2c, uint32
                                         uint32_t ITSources);
 static HAL_StatusTypeDef I2C_Slave_ISR_IT(struct __I2C_HandleTypeDef *hi2c, uint32_t ITFlags,
                                           uint32_t ITSources);
+static HAL_StatusTypeDef I2C_Probe_ISR(struct __I2C_HandleTypeDef *hi2c, uint32_t ITFlags,
+                                       uint32_t ITSources);
 #if defined(HAL_DMA_MODULE_ENABLED)
 static HAL_StatusTypeDef I2C_Master_ISR_DMA(struct __I2C_HandleTypeDef *hi2c, uint32_t ITFlags,
                                             uint32_t ITSources);
@@ -490,6 +496,13 @@ static void I2C_TransferConfig(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uin
 
 /* Private function to Convert Specific options */
 static void I2C_ConvertOtherXferOptions(I2C_HandleTypeDef *hi2c);
+
+#if defined(USE_HAL_OS_HOOKS) && (USE_HAL_OS_HOOKS == 1U)
+/* Private functions for blocking transfers waiting on the OS hooks */
+static HAL_StatusTypeDef I2C_OsMasterTransfer(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData,
+                                              uint16_t Size, uint32_t Timeout, uint32_t Receive);
+static uint32_t I2C_OsSignal(I2C_HandleTypeDef *hi2c);
+#endif /* USE_HAL_OS_HOOKS */
 /**
   * @}
   */
@@ -640,9 +653,15 @@ HAL_StatusTypeDef HAL_I2C_Init(I2C_HandleTypeDef *hi2c)
   __HAL_I2C_ENABLE(hi2c);
 
   hi2c->ErrorCode = HAL_I2C_ERROR_NONE;
+#if defined(USE_HAL_OS_HOOKS) && (USE_HAL_OS_HOOKS == 1U)
+  hi2c->OsWaiting = 0U;
+#endif /* USE_HAL_OS_HOOKS */
   hi2c->State = HAL_I2C_STATE_READY;
   hi2c->PreviousState = I2C_STATE_NONE;
   hi2c->Mode = HAL_I2C_MODE_NONE;
+  hi2c->JobISR = NULL;
+  hi2c->pProbe = NULL;
+  hi2c->pRegFile = NULL;
 
   return HAL_OK;
 }
@@ -1082,6 +1101,7 @@ HAL_StatusTypeDef HAL_I2C_UnRegisterAddrCallback(I2C_HandleTypeDef *hi2c)
         (++) HAL_I2C_EnableListen_IT()
         (++) HAL_I2C_DisableListen_IT()
         (++) HAL_I2C_Master_Abort_IT()
+        (++) HAL_I2C_Probe_IT()
 
     (#) No-Blocking mode functions with DMA are :
         (++) HAL_I2C_Master_Transmit_DMA()
@@ -1106,6 +1126,7 @@ HAL_StatusTypeDef HAL_I2C_UnRegisterAddrCallback(I2C_HandleTypeDef *hi2c)
         (++) HAL_I2C_ListenCpltCallback()
         (++) HAL_I2C_ErrorCallback()
         (++) HAL_I2C_AbortCpltCallback()
+        (++) HAL_I2C_ProbeCpltCallback()
 
 @endverbatim
   * @{
@@ -1127,6 +1148,14 @@ HAL_StatusTypeDef HAL_I2C_Master_Transmit(I2C_HandleTypeDef *hi2c, uint16_t DevA
 {
   uint32_t tickstart;
 
+#if defined(USE_HAL_OS_HOOKS) && (USE_HAL_OS_HOOKS == 1U)
+  /* Called from a thread: wait for the end of an interrupt transfer */
+  if ((Timeout != 0U) && (HAL_OS_IsBlockingAllowed() != 0U))
+  {
+    return I2C_OsMasterTransfer(hi2c, DevAddress, pData, Size, Timeout, 0U);
+  }
+
+#endif /* USE_HAL_OS_HOOKS */
   if (hi2c->State == HAL_I2C_STATE_READY)
   {
     /* Process Locked */
@@ -1246,6 +1275,14 @@ HAL_StatusTypeDef HAL_I2C_Master_Receive(I2C_HandleTypeDef *hi2c, uint16_t DevAd
 {
   uint32_t tickstart;
 
+#if defined(USE_HAL_OS_HOOKS) && (USE_HAL_OS_HOOKS == 1U)
+  /* Called from a thread: wait for the end of an interrupt transfer */
+  if ((Timeout != 0U) && (HAL_OS_IsBlockingAllowed() != 0U))
+  {
+    return I2C_OsMasterTransfer(hi2c, DevAddress, pData, Size, Timeout, 1U);
+  }
+
+#endif /* USE_HAL_OS_HOOKS */
   if (hi2c->State == HAL_I2C_STATE_READY)
   {
     /* Process Locked */
@@ -4886,6 +4923,70 @@ HAL_StatusTypeDef HAL_I2C_Master_Abort_IT(I2C_HandleTypeDef *hi2c, uint16_t DevA
   }
 }
 
+/**
+  * @brief  Check if a list of target devices are ready for communication in non-blocking mode with Interrupt.
+  * @note   The addresses are sent one after the other from the I2C interrupt, each device being tried up to
+  *         pProbe->Trials times until it acknowledges its address. HAL_I2C_ProbeCpltCallback() is executed
+  *         once the last device is probed, pProbe->pReady and pProbe->ReadyNbr giving the result.
+  * @param  hi2c Pointer to a I2C_HandleTypeDef structure that contains
+  *                the configuration information for the specified I2C.
+  * @param  pProbe Pointer to the probe structure, to be kept valid until the end of the probe.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_I2C_Probe_IT(I2C_HandleTypeDef *hi2c, I2C_ProbeTypeDef *pProbe)
+{
+  if ((pProbe == NULL) || (pProbe->pDevAddress == NULL) || (pProbe->pReady == NULL) || (pProbe->DevNbr == 0U) ||
+      (pProbe->Trials == 0U))
+  {
+    hi2c->ErrorCode = HAL_I2C_ERROR_INVALID_PARAM;
+    return HAL_ERROR;
+  }
+
+  if (hi2c->State == HAL_I2C_STATE_READY)
+  {
+    if (__HAL_I2C_GET_FLAG(hi2c, I2C_FLAG_BUSY) == SET)
+    {
+      return HAL_BUSY;
+    }
+
+    /* Process Locked */
+    __HAL_LOCK(hi2c);
+
+    hi2c->State         = HAL_I2C_STATE_BUSY;
+    hi2c->Mode          = HAL_I2C_MODE_MASTER;
+    hi2c->ErrorCode     = HAL_I2C_ERROR_NONE;
+    hi2c->PreviousState = I2C_STATE_NONE;
+    hi2c->XferOptions   = I2C_NO_OPTION_FRAME;
+    hi2c->XferCount     = 0U;
+    hi2c->XferISR       = I2C_Probe_ISR;
+
+    pProbe->ReadyNbr  = 0U;
+    pProbe->Index     = 0U;
+    pProbe->Trial     = 0U;
+    pProbe->pReady[0] = 1U;
+    hi2c->pProbe      = pProbe;
+
+    /* Send the first address, with AUTOEND mode the stop is automatically generated */
+    I2C_TransferConfig(hi2c, pProbe->pDevAddress[0], 0U, I2C_AUTOEND_MODE, I2C_GENERATE_START_WRITE);
+
+    /* Process Unlocked */
+    __HAL_UNLOCK(hi2c);
+
+    /* Note : The I2C interrupts must be enabled after unlocking current process
+              to avoid the risk of I2C interrupt handle execution before current
+              process unlock */
+
+    /* Enable ERR, TC, STOP, NACK and TXI interrupts, TC and TXI are not raised by an address only transfer */
+    I2C_Enable_IRQ(hi2c, I2C_XFER_TX_IT);
+
+    return HAL_OK;
+  }
+  else
+  {
+    return HAL_BUSY;
+  }
+}
+
 /**
   * @}
   */
@@ -4906,11 +5007,15 @@ void HAL_I2C_EV_IRQHandler(I2C_HandleTypeDef *hi2c) /* Derogation MISRAC2012-Rul
   uint32_t itflags   = READ_REG(hi2c->Instance->ISR);
   uint32_t itsources = READ_REG(hi2c->Instance->CR1);
 
+  HAL_TRACE_ENTER(HAL_TRACE_ID_I2C_EV_IRQ, hi2c);
+
   /* I2C events treatment -------------------------------------*/
   if (hi2c->XferISR != NULL)
   {
     hi2c->XferISR(hi2c, itflags, itsources);
   }
+
+  HAL_TRACE_EXIT(HAL_TRACE_ID_I2C_EV_IRQ, hi2c);
 }
 
 /**
@@ -4925,6 +5030,8 @@ void HAL_I2C_ER_IRQHandler(I2C_HandleTypeDef *hi2c)
   uint32_t itsources = READ_REG(hi2c->Instance->CR1);
   uint32_t tmperror;
 
+  HAL_TRACE_ENTER(HAL_TRACE_ID_I2C_ER_IRQ, hi2c);
+
   /* I2C Bus error interrupt occurred ------------------------------------*/
   if ((I2C_CHECK_FLAG(itflags, I2C_FLAG_BERR) != RESET) && \
       (I2C_CHECK_IT_SOURCE(itsources, I2C_IT_ERRI) != RESET))
@@ -4963,6 +5070,8 @@ void HAL_I2C_ER_IRQHandler(I2C_HandleTypeDef *hi2c)
   {
     I2C_ITError(hi2c, tmperror);
   }
+
+  HAL_TRACE_EXIT(HAL_TRACE_ID_I2C_ER_IRQ, hi2c);
 }
 
 /**
@@ -5128,6 +5237,22 @@ __weak void HAL_I2C_AbortCpltCallback(I2C_HandleTypeDef *hi2c)
    */
 }
 
+/**
+  * @brief  Device probe completed callback.
+  * @param  hi2c Pointer to a I2C_HandleTypeDef structure that contains
+  *                the configuration information for the specified I2C.
+  * @retval None
+  */
+__weak void HAL_I2C_ProbeCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hi2c);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_I2C_ProbeCpltCallback could be implemented in the user file
+   */
+}
+
 /**
   * @}
   */
@@ -5622,6 +5747,86 @@ static HAL_StatusTypeDef I2C_Slave_ISR_IT(struct __I2C_HandleTypeDef *hi2c, uint
   return HAL_OK;
 }
 
+/**
+  * @brief  Interrupt Sub-Routine which handle the device probe.
+  * @param  hi2c Pointer to a I2C_HandleTypeDef structure that contains
+  *                the configuration information for the specified I2C.
+  * @param  ITFlags Interrupt flags to handle.
+  * @param  ITSources Interrupt sources enabled.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef I2C_Probe_ISR(struct __I2C_HandleTypeDef *hi2c, uint32_t ITFlags,
+                                       uint32_t ITSources)
+{
+  I2C_ProbeTypeDef *pprobe = hi2c->pProbe;
+
+  /* Process Locked */
+  __HAL_LOCK(hi2c);
+
+  if ((I2C_CHECK_FLAG(ITFlags, I2C_FLAG_AF) != RESET) && \
+      (I2C_CHECK_IT_SOURCE(ITSources, I2C_IT_NACKI) != RESET))
+  {
+    /* The device does not acknowledge its address, the stop follows */
+    __HAL_I2C_CLEAR_FLAG(hi2c, I2C_FLAG_AF);
+
+    pprobe->pReady[pprobe->Index] = 0U;
+  }
+
+  if ((I2C_CHECK_FLAG(ITFlags, I2C_FLAG_STOPF) != RESET) && \
+      (I2C_CHECK_IT_SOURCE(ITSources, I2C_IT_STOPI) != RESET))
+  {
+    /* Clear STOP Flag */
+    __HAL_I2C_CLEAR_FLAG(hi2c, I2C_FLAG_STOPF);
+
+    if (pprobe->pReady[pprobe->Index] != 0U)
+    {
+      pprobe->ReadyNbr++;
+      pprobe->Index++;
+      pprobe->Trial = 0U;
+    }
+    else
+    {
+      pprobe->Trial++;
+      if (pprobe->Trial >= pprobe->Trials)
+      {
+        pprobe->Index++;
+        pprobe->Trial = 0U;
+      }
+    }
+
+    if (pprobe->Index < pprobe->DevNbr)
+    {
+      /* Send the next address */
+      pprobe->pReady[pprobe->Index] = 1U;
+      I2C_TransferConfig(hi2c, pprobe->pDevAddress[pprobe->Index], 0U, I2C_AUTOEND_MODE,
+                         I2C_GENERATE_START_WRITE);
+    }
+    else
+    {
+      /* Disable all interrupts */
+      I2C_Disable_IRQ(hi2c, I2C_XFER_TX_IT);
+
+      hi2c->XferISR = NULL;
+      hi2c->pProbe  = NULL;
+      hi2c->State   = HAL_I2C_STATE_READY;
+      hi2c->Mode    = HAL_I2C_MODE_NONE;
+
+      /* Process Unlocked */
+      __HAL_UNLOCK(hi2c);
+
+      /* A new probe or transfer can be started from the callback */
+      HAL_I2C_ProbeCpltCallback(hi2c);
+
+      return HAL_OK;
+    }
+  }
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hi2c);
+
+  return HAL_OK;
+}
+
 #if defined(HAL_DMA_MODULE_ENABLED)
 /**
   * @brief  Interrupt Sub-Routine which handle the Interrupt Flags Master Mode with DMA.
@@ -6466,12 +6671,20 @@ static void I2C_ITMasterCplt(I2C_HandleTypeDef *hi2c, uint32_t ITFlags)
       /* Process Unlocked */
       __HAL_UNLOCK(hi2c);
 
-      /* Call the corresponding callback to inform upper layer of End of Transfer */
+      /* Job list ongoing : chain the next job */
+      if (hi2c->JobISR != NULL)
+      {
+        hi2c->JobISR(hi2c);
+      }
+      else
+      {
+        /* Call the corresponding callback to inform upper layer of End of Transfer */
 #if (USE_HAL_I2C_REGISTER_CALLBACKS == 1)
-      hi2c->MemTxCpltCallback(hi2c);
+        hi2c->MemTxCpltCallback(hi2c);
 #else
-      HAL_I2C_MemTxCpltCallback(hi2c);
+        HAL_I2C_MemTxCpltCallback(hi2c);
 #endif /* USE_HAL_I2C_REGISTER_CALLBACKS */
+      }
     }
     else
     {
@@ -6480,6 +6693,14 @@ static void I2C_ITMasterCplt(I2C_HandleTypeDef *hi2c, uint32_t ITFlags)
       /* Process Unlocked */
       __HAL_UNLOCK(hi2c);
 
+#if defined(USE_HAL_OS_HOOKS) && (USE_HAL_OS_HOOKS == 1U)
+      /* Blocking transfer : wake up the waiting thread instead of the callback */
+      if (I2C_OsSignal(hi2c) != 0U)
+      {
+        return;
+      }
+
+#endif /* USE_HAL_OS_HOOKS */
       /* Call the corresponding callback to inform upper layer of End of Transfer */
 #if (USE_HAL_I2C_REGISTER_CALLBACKS == 1)
       hi2c->MasterTxCpltCallback(hi2c);
@@ -6501,12 +6722,20 @@ static void I2C_ITMasterCplt(I2C_HandleTypeDef *hi2c, uint32_t ITFlags)
       /* Process Unlocked */
       __HAL_UNLOCK(hi2c);
 
-      /* Call the corresponding callback to inform upper layer of End of Transfer */
+      /* Job list ongoing : chain the next job */
+      if (hi2c->JobISR != NULL)
+      {
+        hi2c->JobISR(hi2c);
+      }
+      else
+      {
+        /* Call the corresponding callback to inform upper layer of End of Transfer */
 #if (USE_HAL_I2C_REGISTER_CALLBACKS == 1)
-      hi2c->MemRxCpltCallback(hi2c);
+        hi2c->MemRxCpltCallback(hi2c);
 #else
-      HAL_I2C_MemRxCpltCallback(hi2c);
+        HAL_I2C_MemRxCpltCallback(hi2c);
 #endif /* USE_HAL_I2C_REGISTER_CALLBACKS */
+      }
     }
     else
     {
@@ -6515,6 +6744,14 @@ static void I2C_ITMasterCplt(I2C_HandleTypeDef *hi2c, uint32_t ITFlags)
       /* Process Unlocked */
       __HAL_UNLOCK(hi2c);
 
+#if defined(USE_HAL_OS_HOOKS) && (USE_HAL_OS_HOOKS == 1U)
+      /* Blocking transfer : wake up the waiting thread instead of the callback */
+      if (I2C_OsSignal(hi2c) != 0U)
+      {
+        return;
+      }
+
+#endif /* USE_HAL_OS_HOOKS */
       /* Call the corresponding callback to inform upper layer of End of Transfer */
 #if (USE_HAL_I2C_REGISTER_CALLBACKS == 1)
       hi2c->MasterRxCpltCallback(hi2c);
@@ -6830,7 +7067,12 @@ static void I2C_ITError(I2C_HandleTypeDef *hi2c, uint32_t ErrorCode)
 
     /* keep HAL_I2C_STATE_LISTEN if set */
     hi2c->State         = HAL_I2C_STATE_LISTEN;
-    hi2c->XferISR       = I2C_Slave_ISR_IT;
+
+    /* Slave register file mode keeps its own handler */
+    if (hi2c->pRegFile == NULL)
+    {
+      hi2c->XferISR     = I2C_Slave_ISR_IT;
+    }
   }
   else
   {
@@ -6941,6 +7183,12 @@ static void I2C_ITError(I2C_HandleTypeDef *hi2c, uint32_t ErrorCode)
   */
 static void I2C_TreatErrorCallback(I2C_HandleTypeDef *hi2c)
 {
+  /* Stop the job list, if any, JobIndex keeps the failing job */
+  hi2c->JobISR = NULL;
+
+  /* Stop the device probe, if any, its Index keeps the failing device */
+  hi2c->pProbe = NULL;
+
   if (hi2c->State == HAL_I2C_STATE_ABORT)
   {
     hi2c->State = HAL_I2C_STATE_READY;
@@ -6963,6 +7211,14 @@ static void I2C_TreatErrorCallback(I2C_HandleTypeDef *hi2c)
     /* Process Unlocked */
     __HAL_UNLOCK(hi2c);
 
+#if defined(USE_HAL_OS_HOOKS) && (USE_HAL_OS_HOOKS == 1U)
+    /* Blocking transfer : wake up the waiting thread instead of the callback */
+    if (I2C_OsSignal(hi2c) != 0U)
+    {
+      return;
+    }
+
+#endif /* USE_HAL_OS_HOOKS */
     /* Call the corresponding callback to inform upper layer of End of Transfer */
 #if (USE_HAL_I2C_REGISTER_CALLBACKS == 1)
     hi2c->ErrorCallback(hi2c);
@@ -7810,6 +8066,95 @@ static void I2C_ConvertOtherXferOptions(I2C_HandleTypeDef *hi2c)
   }
 }
 
+#if defined(USE_HAL_OS_HOOKS) && (USE_HAL_OS_HOOKS == 1U)
+/**
+  * @brief  Master blocking transfer done in interrupt mode, the thread waiting with HAL_OS_Wait().
+  * @param  hi2c Pointer to a I2C_HandleTypeDef structure that contains
+  *                the configuration information for the specified I2C.
+  * @param  DevAddress Target device address
+  * @param  pData Pointer to data buffer
+  * @param  Size Amount of data to be sent or received
+  * @param  Timeout Timeout duration
+  * @param  Receive 0 for a transmission, 1 for a reception
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef I2C_OsMasterTransfer(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData,
+                                              uint16_t Size, uint32_t Timeout, uint32_t Receive)
+{
+  HAL_StatusTypeDef status;
+  uint32_t primask_bit;
+  uint32_t waiting;
+
+  hi2c->OsWaiting = 1U;
+
+  if (Receive == 0U)
+  {
+    status = HAL_I2C_Master_Transmit_IT(hi2c, DevAddress, pData, Size);
+  }
+  else
+  {
+    status = HAL_I2C_Master_Receive_IT(hi2c, DevAddress, pData, Size);
+  }
+
+  if (status != HAL_OK)
+  {
+    hi2c->OsWaiting = 0U;
+    return status;
+  }
+
+  if (HAL_OS_Wait(hi2c, Timeout) != HAL_OK)
+  {
+    /* Withdraw the waiting request unless the transfer has just ended */
+    primask_bit = __get_PRIMASK();
+    __disable_irq();
+    waiting = hi2c->OsWaiting;
+    hi2c->OsWaiting = 0U;
+    if (waiting != 0U)
+    {
+      /* Stop the transfer as the polling functions do on timeout */
+      I2C_Disable_IRQ(hi2c, I2C_XFER_TX_IT | I2C_XFER_RX_IT);
+      hi2c->Instance->CR2 |= I2C_CR2_STOP;
+      I2C_Flush_TXDR(hi2c);
+      hi2c->XferISR   = NULL;
+      hi2c->ErrorCode |= HAL_I2C_ERROR_TIMEOUT;
+      hi2c->State     = HAL_I2C_STATE_READY;
+      hi2c->Mode      = HAL_I2C_MODE_NONE;
+      __HAL_UNLOCK(hi2c);
+    }
+    __set_PRIMASK(primask_bit);
+
+    if (waiting != 0U)
+    {
+      return HAL_ERROR;
+    }
+
+    /* Consume the signal given meanwhile */
+    (void)HAL_OS_Wait(hi2c, 0U);
+  }
+
+  return (hi2c->ErrorCode == HAL_I2C_ERROR_NONE) ? HAL_OK : HAL_ERROR;
+}
+
+/**
+  * @brief  Wake up the thread waiting for the end of a blocking transfer.
+  * @param  hi2c Pointer to a I2C_HandleTypeDef structure that contains
+  *                the configuration information for the specified I2C.
+  * @retval 1 if a thread was waiting, 0 otherwise
+  */
+static uint32_t I2C_OsSignal(I2C_HandleTypeDef *hi2c)
+{
+  if (hi2c->OsWaiting == 0U)
+  {
+    return 0U;
+  }
+
+  hi2c->OsWaiting = 0U;
+  HAL_OS_Signal(hi2c);
+
+  return 1U;
+}
+#endif /* USE_HAL_OS_HOOKS */
+
 /**
   * @}
   */
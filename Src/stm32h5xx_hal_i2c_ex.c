@@ -65,6 +65,23 @@
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
+/** @addtogroup I2CEx_Private_Functions
+  * @{
+  */
+static HAL_StatusTypeDef I2CEx_JobStart(I2C_HandleTypeDef *hi2c);
+static void I2CEx_JobISR(I2C_HandleTypeDef *hi2c);
+#if defined(HAL_DMA_MODULE_ENABLED)
+static HAL_StatusTypeDef I2CEx_RegFileISR(struct __I2C_HandleTypeDef *hi2c, uint32_t ITFlags,
+                                          uint32_t ITSources);
+static void I2CEx_RegFileEnd(I2C_HandleTypeDef *hi2c);
+static void I2CEx_RegFileDMARxCplt(DMA_HandleTypeDef *hdma);
+static void I2CEx_RegFileDMATxCplt(DMA_HandleTypeDef *hdma);
+static void I2CEx_RegFileDMAError(DMA_HandleTypeDef *hdma);
+#endif /* HAL_DMA_MODULE_ENABLED */
+/**
+  * @}
+  */
+
 /* Private functions ---------------------------------------------------------*/
 
 /** @defgroup I2CEx_Exported_Functions I2C Extended Exported Functions
@@ -345,6 +362,556 @@ HAL_StatusTypeDef HAL_I2CEx_ConfigFastModePlus(I2C_HandleTypeDef *hi2c, uint32_t
 /**
   * @}
   */
+
+/** @defgroup I2CEx_Exported_Functions_Group4 Job List Functions
+  * @brief    Job List Functions
+  *
+@verbatim
+ ===============================================================================
+                      ##### Job List Functions #####
+ ===============================================================================
+    [..] This section provides functions allowing to:
+      (+) Execute a list of register block accesses back-to-back with HAL_I2CEx_JobList_IT().
+          Each job is a memory write or read, started from the end of transfer interrupt of
+          the previous one. DMA mode is used when the handle is linked to a DMA channel for
+          the job direction, interrupt mode otherwise.
+      (+) HAL_I2CEx_JobListCpltCallback() is executed once, at the end of the last job.
+      (+) On error, the list is stopped, hi2c->JobIndex gives the failing job and
+          HAL_I2C_ErrorCallback() is executed.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Execute a list of register block writes and reads in non-blocking mode.
+  * @param  hi2c Pointer to a I2C_HandleTypeDef structure that contains
+  *                the configuration information for the specified I2Cx peripheral.
+  * @param  pJobs Pointer to the job array, to be kept valid until the end of the list.
+  * @param  JobNbr Number of jobs in the array.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_I2CEx_JobList_IT(I2C_HandleTypeDef *hi2c, I2C_JobTypeDef *pJobs, uint32_t JobNbr)
+{
+  HAL_StatusTypeDef status;
+  uint32_t index;
+
+  if (hi2c->State != HAL_I2C_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  if ((pJobs == NULL) || (JobNbr == 0U))
+  {
+    hi2c->ErrorCode = HAL_I2C_ERROR_INVALID_PARAM;
+    return HAL_ERROR;
+  }
+
+  for (index = 0U; index < JobNbr; index++)
+  {
+    assert_param(IS_I2C_MEMADD_SIZE(pJobs[index].MemAddSize));
+    assert_param(IS_I2C_JOB_DIRECTION(pJobs[index].Direction));
+
+    if ((pJobs[index].pData == NULL) || (pJobs[index].Size == 0U))
+    {
+      hi2c->ErrorCode = HAL_I2C_ERROR_INVALID_PARAM;
+      return HAL_ERROR;
+    }
+  }
+
+  hi2c->pJobs    = pJobs;
+  hi2c->JobNbr   = JobNbr;
+  hi2c->JobIndex = 0U;
+  hi2c->JobISR   = I2CEx_JobISR;
+
+  status = I2CEx_JobStart(hi2c);
+  if (status != HAL_OK)
+  {
+    hi2c->JobISR = NULL;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Job list completed callback.
+  * @param  hi2c Pointer to a I2C_HandleTypeDef structure that contains
+  *                the configuration information for the specified I2C.
+  * @retval None
+  */
+__weak void HAL_I2CEx_JobListCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hi2c);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_I2CEx_JobListCpltCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @}
+  */
+
+#if defined(HAL_DMA_MODULE_ENABLED)
+/** @defgroup I2CEx_Exported_Functions_Group5 Slave Register File Functions
+  * @brief    Slave Register File Functions
+  *
+@verbatim
+ ===============================================================================
+                 ##### Slave Register File Functions #####
+ ===============================================================================
+    [..] This section provides functions allowing to:
+      (+) Expose a memory buffer as a slave register space with HAL_I2CEx_RegFile_Start_DMA().
+          The first byte of a write transfer sets the register pointer, the following bytes
+          are written by DMA from this address. A read transfer, started directly or after a
+          repeated start, is served by DMA from the register pointer.
+          Reading does not move the register pointer, so that a host polling a register block
+          always reads the same block.
+      (+) Only the address match, the register pointer byte and the end of transfer are
+          handled by interrupt, data bytes need no CPU, e.g. at 1 MHz after
+          HAL_I2CEx_ConfigFastModePlus().
+      (+) Host writes beyond the register file are not acknowledged, host reads beyond the
+          register file return 0xFF.
+      (+) HAL_I2CEx_RegFileWriteCallback() is executed at the end of each write transfer with
+          the updated register range.
+      (+) Stop the register file mode with HAL_I2CEx_RegFile_Stop().
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Start the slave register file mode, data transfers handled by DMA.
+  * @note   hdmatx and hdmarx must be linked to the handle, with DMA channels in normal mode.
+  * @param  hi2c Pointer to a I2C_HandleTypeDef structure that contains
+  *                the configuration information for the specified I2C.
+  * @param  pRegs Pointer to the register file, to be kept valid until HAL_I2CEx_RegFile_Stop().
+  * @param  Size Size of the register file in bytes, 256 bytes at most for a one byte pointer.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_I2CEx_RegFile_Start_DMA(I2C_HandleTypeDef *hi2c, uint8_t *pRegs, uint16_t Size)
+{
+  if (hi2c->State != HAL_I2C_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  if ((pRegs == NULL) || (Size == 0U) || (Size > 256U))
+  {
+    hi2c->ErrorCode = HAL_I2C_ERROR_INVALID_PARAM;
+    return HAL_ERROR;
+  }
+
+  if ((hi2c->hdmatx == NULL) || (hi2c->hdmarx == NULL))
+  {
+    hi2c->ErrorCode = HAL_I2C_ERROR_DMA_PARAM;
+    return HAL_ERROR;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hi2c);
+
+  hi2c->pRegFile    = pRegs;
+  hi2c->RegFileSize = Size;
+  hi2c->RegPointer  = 0U;
+
+  /* Set the DMA callbacks */
+  hi2c->hdmarx->XferCpltCallback     = I2CEx_RegFileDMARxCplt;
+  hi2c->hdmarx->XferErrorCallback    = I2CEx_RegFileDMAError;
+  hi2c->hdmarx->XferHalfCpltCallback = NULL;
+  hi2c->hdmarx->XferAbortCallback    = NULL;
+  hi2c->hdmatx->XferCpltCallback     = I2CEx_RegFileDMATxCplt;
+  hi2c->hdmatx->XferErrorCallback    = I2CEx_RegFileDMAError;
+  hi2c->hdmatx->XferHalfCpltCallback = NULL;
+  hi2c->hdmatx->XferAbortCallback    = NULL;
+
+  hi2c->State       = HAL_I2C_STATE_LISTEN;
+  hi2c->Mode        = HAL_I2C_MODE_SLAVE;
+  hi2c->ErrorCode   = HAL_I2C_ERROR_NONE;
+  hi2c->XferOptions = I2C_NO_OPTION_FRAME;
+  hi2c->XferISR     = I2CEx_RegFileISR;
+
+  /* Enable Address Acknowledge */
+  hi2c->Instance->CR2 &= ~I2C_CR2_NACK;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hi2c);
+
+  /* Note : The I2C interrupts must be enabled after unlocking current process
+            to avoid the risk of I2C interrupt handle execution before current
+            process unlock */
+  __HAL_I2C_ENABLE_IT(hi2c, I2C_IT_ADDRI | I2C_IT_STOPI | I2C_IT_NACKI | I2C_IT_ERRI);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the slave register file mode.
+  * @param  hi2c Pointer to a I2C_HandleTypeDef structure that contains
+  *                the configuration information for the specified I2C.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_I2CEx_RegFile_Stop(I2C_HandleTypeDef *hi2c)
+{
+  if (hi2c->pRegFile == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hi2c);
+
+  __HAL_I2C_DISABLE_IT(hi2c, I2C_IT_ADDRI | I2C_IT_STOPI | I2C_IT_NACKI | I2C_IT_ERRI);
+
+  /* Stop the ongoing transfer, if any */
+  I2CEx_RegFileEnd(hi2c);
+
+  hi2c->pRegFile = NULL;
+  hi2c->XferISR  = NULL;
+  hi2c->State    = HAL_I2C_STATE_READY;
+  hi2c->Mode     = HAL_I2C_MODE_NONE;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hi2c);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Slave register file written callback.
+  * @param  hi2c Pointer to a I2C_HandleTypeDef structure that contains
+  *                the configuration information for the specified I2C.
+  * @param  Offset Offset of the first register written by the host.
+  * @param  Length Number of registers written by the host.
+  * @retval None
+  */
+__weak void HAL_I2CEx_RegFileWriteCallback(I2C_HandleTypeDef *hi2c, uint16_t Offset, uint16_t Length)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hi2c);
+  UNUSED(Offset);
+  UNUSED(Length);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_I2CEx_RegFileWriteCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @}
+  */
+#endif /* HAL_DMA_MODULE_ENABLED */
+
+/**
+  * @}
+  */
+
+/** @addtogroup I2CEx_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Start the job pointed by hi2c->JobIndex.
+  * @param  hi2c Pointer to a I2C_HandleTypeDef structure that contains
+  *                the configuration information for the specified I2C.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef I2CEx_JobStart(I2C_HandleTypeDef *hi2c)
+{
+  const I2C_JobTypeDef *pjob = &hi2c->pJobs[hi2c->JobIndex];
+  HAL_StatusTypeDef status;
+
+  if (pjob->Direction == I2C_JOB_READ)
+  {
+#if defined(HAL_DMA_MODULE_ENABLED)
+    if (hi2c->hdmarx != NULL)
+    {
+      status = HAL_I2C_Mem_Read_DMA(hi2c, pjob->DevAddress, pjob->MemAddress, pjob->MemAddSize, pjob->pData,
+                                    pjob->Size);
+    }
+    else
+#endif /* HAL_DMA_MODULE_ENABLED */
+    {
+      status = HAL_I2C_Mem_Read_IT(hi2c, pjob->DevAddress, pjob->MemAddress, pjob->MemAddSize, pjob->pData,
+                                   pjob->Size);
+    }
+  }
+  else
+  {
+#if defined(HAL_DMA_MODULE_ENABLED)
+    if (hi2c->hdmatx != NULL)
+    {
+      status = HAL_I2C_Mem_Write_DMA(hi2c, pjob->DevAddress, pjob->MemAddress, pjob->MemAddSize, pjob->pData,
+                                     pjob->Size);
+    }
+    else
+#endif /* HAL_DMA_MODULE_ENABLED */
+    {
+      status = HAL_I2C_Mem_Write_IT(hi2c, pjob->DevAddress, pjob->MemAddress, pjob->MemAddSize, pjob->pData,
+                                    pjob->Size);
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Job list handler, called at the end of each successful job.
+  * @param  hi2c Pointer to a I2C_HandleTypeDef structure that contains
+  *                the configuration information for the specified I2C.
+  * @retval None
+  */
+static void I2CEx_JobISR(I2C_HandleTypeDef *hi2c)
+{
+  hi2c->JobIndex++;
+
+  if (hi2c->JobIndex >= hi2c->JobNbr)
+  {
+    /* End of the job list, a new list can be started from the callback */
+    hi2c->JobISR = NULL;
+
+    HAL_I2CEx_JobListCpltCallback(hi2c);
+  }
+  else if (I2CEx_JobStart(hi2c) != HAL_OK)
+  {
+    /* Next job cannot be started, stop the list on it */
+    hi2c->JobISR = NULL;
+
+#if (USE_HAL_I2C_REGISTER_CALLBACKS == 1)
+    hi2c->ErrorCallback(hi2c);
+#else
+    HAL_I2C_ErrorCallback(hi2c);
+#endif /* USE_HAL_I2C_REGISTER_CALLBACKS */
+  }
+  else
+  {
+    /* Next job started */
+  }
+}
+
+#if defined(HAL_DMA_MODULE_ENABLED)
+/**
+  * @brief  Interrupt Sub-Routine which handles the slave register file mode.
+  * @param  hi2c Pointer to a I2C_HandleTypeDef structure that contains
+  *                the configuration information for the specified I2C.
+  * @param  ITFlags Interrupt flags to handle.
+  * @param  ITSources Interrupt sources enabled.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef I2CEx_RegFileISR(struct __I2C_HandleTypeDef *hi2c, uint32_t ITFlags,
+                                          uint32_t ITSources)
+{
+  uint16_t pointer;
+
+  /* Process locked */
+  __HAL_LOCK(hi2c);
+
+  if ((I2C_CHECK_FLAG(ITFlags, I2C_FLAG_ADDR) != RESET) && \
+      (I2C_CHECK_IT_SOURCE(ITSources, I2C_IT_ADDRI) != RESET))
+  {
+    /* End of the previous write transfer in case of repeated start */
+    I2CEx_RegFileEnd(hi2c);
+
+    if (I2C_GET_DIR(hi2c) == I2C_DIRECTION_RECEIVE)
+    {
+      /* Host read : flush TXDR then serve the register file from the register pointer */
+      __HAL_I2C_CLEAR_FLAG(hi2c, I2C_FLAG_TXE);
+
+      pointer = hi2c->RegPointer;
+      hi2c->pBuffPtr = &hi2c->pRegFile[pointer];
+      hi2c->XferSize = (uint16_t)(hi2c->RegFileSize - pointer);
+
+      if (HAL_DMA_Start_IT(hi2c->hdmatx, (uint32_t)hi2c->pBuffPtr, (uint32_t)&hi2c->Instance->TXDR,
+                           hi2c->XferSize) == HAL_OK)
+      {
+        hi2c->Instance->CR1 |= I2C_CR1_TXDMAEN;
+      }
+      else
+      {
+        /* Answer 0xFF bytes */
+        __HAL_I2C_ENABLE_IT(hi2c, I2C_IT_TXI);
+      }
+    }
+    else
+    {
+      /* Host write : the first byte is the register pointer */
+      __HAL_I2C_ENABLE_IT(hi2c, I2C_IT_RXI);
+    }
+
+    /* Keep the end of transfer interrupts, they may have been disabled on error */
+    __HAL_I2C_ENABLE_IT(hi2c, I2C_IT_STOPI | I2C_IT_NACKI | I2C_IT_ERRI);
+
+    /* Clear ADDR flag, release the clock stretching */
+    __HAL_I2C_CLEAR_FLAG(hi2c, I2C_FLAG_ADDR);
+  }
+  else if ((I2C_CHECK_FLAG(ITFlags, I2C_FLAG_STOPF) != RESET) && \
+           (I2C_CHECK_IT_SOURCE(ITSources, I2C_IT_STOPI) != RESET))
+  {
+    __HAL_I2C_CLEAR_FLAG(hi2c, I2C_FLAG_STOPF | I2C_FLAG_AF);
+
+    I2CEx_RegFileEnd(hi2c);
+
+    /* Flush the byte prefetched for an unread register */
+    __HAL_I2C_CLEAR_FLAG(hi2c, I2C_FLAG_TXE);
+  }
+  else if ((I2C_CHECK_FLAG(ITFlags, I2C_FLAG_AF) != RESET) && \
+           (I2C_CHECK_IT_SOURCE(ITSources, I2C_IT_NACKI) != RESET))
+  {
+    /* Normal end of a host read */
+    __HAL_I2C_CLEAR_FLAG(hi2c, I2C_FLAG_AF);
+  }
+  else if ((I2C_CHECK_FLAG(ITFlags, I2C_FLAG_RXNE) != RESET) && \
+           (I2C_CHECK_IT_SOURCE(ITSources, I2C_IT_RXI) != RESET))
+  {
+    __HAL_I2C_DISABLE_IT(hi2c, I2C_IT_RXI);
+
+    pointer = (uint16_t)(hi2c->Instance->RXDR);
+    if (pointer >= hi2c->RegFileSize)
+    {
+      pointer = 0U;
+    }
+    hi2c->RegPointer = pointer;
+    hi2c->pBuffPtr = &hi2c->pRegFile[pointer];
+    hi2c->XferSize = (uint16_t)(hi2c->RegFileSize - pointer);
+
+    if (HAL_DMA_Start_IT(hi2c->hdmarx, (uint32_t)&hi2c->Instance->RXDR, (uint32_t)hi2c->pBuffPtr,
+                         hi2c->XferSize) == HAL_OK)
+    {
+      hi2c->Instance->CR1 |= I2C_CR1_RXDMAEN;
+    }
+    else
+    {
+      /* Do not acknowledge data bytes */
+      hi2c->Instance->CR2 |= I2C_CR2_NACK;
+    }
+  }
+  else if ((I2C_CHECK_FLAG(ITFlags, I2C_FLAG_TXIS) != RESET) && \
+           (I2C_CHECK_IT_SOURCE(ITSources, I2C_IT_TXI) != RESET))
+  {
+    /* Host reads beyond the register file */
+    hi2c->Instance->TXDR = 0xFFU;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hi2c);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  End the ongoing register file transfer, if any, and report written registers.
+  * @param  hi2c Pointer to a I2C_HandleTypeDef structure that contains
+  *                the configuration information for the specified I2C.
+  * @retval None
+  */
+static void I2CEx_RegFileEnd(I2C_HandleTypeDef *hi2c)
+{
+  uint16_t offset;
+  uint16_t length;
+
+  __HAL_I2C_DISABLE_IT(hi2c, I2C_IT_RXI | I2C_IT_TXI);
+
+  if ((hi2c->Instance->CR1 & I2C_CR1_RXDMAEN) == I2C_CR1_RXDMAEN)
+  {
+    hi2c->Instance->CR1 &= ~I2C_CR1_RXDMAEN;
+
+    if (HAL_DMA_GetState(hi2c->hdmarx) == HAL_DMA_STATE_BUSY)
+    {
+      length = (uint16_t)(hi2c->XferSize - __HAL_DMA_GET_COUNTER(hi2c->hdmarx));
+      (void)HAL_DMA_Abort(hi2c->hdmarx);
+    }
+    else
+    {
+      length = hi2c->XferSize;
+    }
+
+    if (length != 0U)
+    {
+      /* Register pointer auto-increment */
+      offset = hi2c->RegPointer;
+      hi2c->RegPointer = (uint16_t)((offset + length) % hi2c->RegFileSize);
+
+      /* Process Unlocked */
+      __HAL_UNLOCK(hi2c);
+
+      HAL_I2CEx_RegFileWriteCallback(hi2c, offset, length);
+
+      /* Process Locked */
+      __HAL_LOCK(hi2c);
+    }
+  }
+  else if ((hi2c->Instance->CR1 & I2C_CR1_TXDMAEN) == I2C_CR1_TXDMAEN)
+  {
+    hi2c->Instance->CR1 &= ~I2C_CR1_TXDMAEN;
+
+    if (HAL_DMA_GetState(hi2c->hdmatx) == HAL_DMA_STATE_BUSY)
+    {
+      (void)HAL_DMA_Abort(hi2c->hdmatx);
+    }
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+}
+
+/**
+  * @brief  DMA register file reception complete, the host reached the end of the register file.
+  * @param  hdma DMA handle
+  * @retval None
+  */
+static void I2CEx_RegFileDMARxCplt(DMA_HandleTypeDef *hdma)
+{
+  /* Derogation MISRAC2012-Rule-11.5 */
+  I2C_HandleTypeDef *hi2c = (I2C_HandleTypeDef *)(((DMA_HandleTypeDef *)hdma)->Parent);
+
+  /* Do not acknowledge further bytes, cleared by hardware at STOP or ADDR */
+  hi2c->Instance->CR2 |= I2C_CR2_NACK;
+}
+
+/**
+  * @brief  DMA register file transmission complete, the host reached the end of the register file.
+  * @param  hdma DMA handle
+  * @retval None
+  */
+static void I2CEx_RegFileDMATxCplt(DMA_HandleTypeDef *hdma)
+{
+  /* Derogation MISRAC2012-Rule-11.5 */
+  I2C_HandleTypeDef *hi2c = (I2C_HandleTypeDef *)(((DMA_HandleTypeDef *)hdma)->Parent);
+
+  /* Next bytes, if any, are answered 0xFF by interrupt */
+  hi2c->Instance->CR1 &= ~I2C_CR1_TXDMAEN;
+  __HAL_I2C_ENABLE_IT(hi2c, I2C_IT_TXI);
+}
+
+/**
+  * @brief  DMA register file transfer error.
+  * @param  hdma DMA handle
+  * @retval None
+  */
+static void I2CEx_RegFileDMAError(DMA_HandleTypeDef *hdma)
+{
+  /* Derogation MISRAC2012-Rule-11.5 */
+  I2C_HandleTypeDef *hi2c = (I2C_HandleTypeDef *)(((DMA_HandleTypeDef *)hdma)->Parent);
+
+  /* Drop the transfer, the register file mode keeps listening */
+  hi2c->Instance->CR1 &= ~(I2C_CR1_TXDMAEN | I2C_CR1_RXDMAEN);
+  hi2c->Instance->CR2 |= I2C_CR2_NACK;
+  hi2c->ErrorCode |= HAL_I2C_ERROR_DMA;
+
+#if (USE_HAL_I2C_REGISTER_CALLBACKS == 1)
+  hi2c->ErrorCallback(hi2c);
+#else
+  HAL_I2C_ErrorCallback(hi2c);
+#endif /* USE_HAL_I2C_REGISTER_CALLBACKS */
+}
+#endif /* HAL_DMA_MODULE_ENABLED */
+
 /**
   * @}
   */
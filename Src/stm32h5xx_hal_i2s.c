@@ -95,6 +95,9 @@
          add his own code by customization of function pointer HAL_I2S_RxCpltCallback
      (+) In case of transfer Error, HAL_I2S_ErrorCallback() function is executed and user can
          add his own code by customization of function pointer HAL_I2S_ErrorCallback
+     (+) Exchange two circular buffers endlessly in full-duplex mode using
+         HAL_I2SEx_TransmitReceiveStream_DMA(): HAL_I2SEx_TxRxHalfCpltCallback and
+         HAL_I2SEx_TxRxCpltCallback are executed at each half and end of the buffers
      (+) Pause the DMA Transfer using HAL_I2S_DMAPause()
      (+) Resume the DMA Transfer using HAL_I2S_DMAResume()
      (+) Stop the DMA Transfer using HAL_I2S_DMAStop()
@@ -775,6 +778,7 @@ HAL_StatusTypeDef HAL_I2S_UnRegisterCallback(I2S_HandleTypeDef *hi2s, HAL_I2S_Ca
         (++) HAL_I2S_Transmit_DMA()
         (++) HAL_I2S_Receive_DMA()
         (++) HAL_I2SEx_TransmitReceive_DMA()
+        (++) HAL_I2SEx_TransmitReceiveStream_DMA()
 
     (#) A set of Transfer Complete Callbacks are provided in non Blocking mode:
         (++) HAL_I2S_TxCpltCallback()
@@ -1848,6 +1852,205 @@ HAL_StatusTypeDef HAL_I2SEx_TransmitReceive_DMA(I2S_HandleTypeDef *hi2s, const u
   return errorcode;
 }
 
+/**
+  * @brief  Full-Duplex Transmit/Receive streaming of two circular buffers using circular DMA queues
+  * @param  hi2s pointer to a I2S_HandleTypeDef structure that contains
+  *         the configuration information for I2S module
+  * @param  pConfig pointer to a I2S_StreamConfTypeDef structure that contains the streaming configuration.
+  * @note   The Tx and Rx DMA channels must be initialized with HAL_DMAEx_List_Init() in DMA_LINKEDLIST_CIRCULAR
+  *         mode. Their queues are built by this function from the user queues and nodes, and linked to the
+  *         DMA channels.
+  * @note   Only the Rx channel generates interrupts: HAL_I2SEx_TxRxHalfCpltCallback() is called when the
+  *         first half of the buffers has been exchanged and HAL_I2SEx_TxRxCpltCallback() when the second half
+  *         has been exchanged. The exchanged half can then be processed and refilled while the other half is
+  *         transferred.
+  * @note   Use HAL_I2S_DMAStop() to stop the streaming.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_I2SEx_TransmitReceiveStream_DMA(I2S_HandleTypeDef *hi2s, const I2S_StreamConfTypeDef *pConfig)
+{
+  HAL_StatusTypeDef errorcode;
+  DMA_NodeConfTypeDef node_conf;
+
+  if ((pConfig == NULL) || (pConfig->pTxQueue == NULL) || (pConfig->pTxNode == NULL)
+      || (pConfig->pRxQueue == NULL) || (pConfig->pRxNode == NULL)
+      || (pConfig->pTxData == NULL) || (pConfig->pRxData == NULL) || (pConfig->Size == 0U))
+  {
+    return  HAL_ERROR;
+  }
+
+  if (hi2s->State != HAL_I2S_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  /* Check the DMA channels circular linked-list mode */
+  if ((hi2s->hdmatx == NULL) || (hi2s->hdmatx->Mode != DMA_LINKEDLIST_CIRCULAR)
+      || (hi2s->hdmarx == NULL) || (hi2s->hdmarx->Mode != DMA_LINKEDLIST_CIRCULAR))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hi2s);
+
+  hi2s->pTxBuffPtr  = pConfig->pTxData;
+  hi2s->pRxBuffPtr  = pConfig->pRxData;
+  hi2s->TxXferSize  = pConfig->Size;
+  hi2s->RxXferSize  = pConfig->Size;
+
+  if ((hi2s->Init.DataFormat == I2S_DATAFORMAT_16B) || (hi2s->Init.DataFormat == I2S_DATAFORMAT_16B_EXTENDED))
+  {
+    hi2s->TxXferCount = (uint16_t)(pConfig->Size * 2U);
+    node_conf.Init.SrcDataWidth  = DMA_SRC_DATAWIDTH_HALFWORD;
+    node_conf.Init.DestDataWidth = DMA_DEST_DATAWIDTH_HALFWORD;
+  }
+  else
+  {
+    hi2s->TxXferCount = (uint16_t)(pConfig->Size * 4U);
+    node_conf.Init.SrcDataWidth  = DMA_SRC_DATAWIDTH_WORD;
+    node_conf.Init.DestDataWidth = DMA_DEST_DATAWIDTH_WORD;
+  }
+  hi2s->RxXferCount = hi2s->TxXferCount;
+
+  /* Prepare the Rx node: one block per buffer, half and full block events */
+  node_conf.NodeType                            = DMA_GPDMA_LINEAR_NODE;
+  node_conf.Init.Request                        = pConfig->RxRequest;
+  node_conf.Init.BlkHWRequest                   = DMA_BREQ_SINGLE_BURST;
+  node_conf.Init.Direction                      = DMA_PERIPH_TO_MEMORY;
+  node_conf.Init.SrcInc                         = DMA_SINC_FIXED;
+  node_conf.Init.DestInc                        = DMA_DINC_INCREMENTED;
+  node_conf.Init.Priority                       = hi2s->hdmarx->InitLinkedList.Priority;
+  node_conf.Init.SrcBurstLength                 = 1U;
+  node_conf.Init.DestBurstLength                = 1U;
+  node_conf.Init.TransferAllocatedPort          = DMA_SRC_ALLOCATED_PORT0 | DMA_DEST_ALLOCATED_PORT0;
+  node_conf.Init.TransferEventMode              = DMA_TCEM_BLOCK_TRANSFER;
+  node_conf.Init.Mode                           = DMA_NORMAL;
+  node_conf.DataHandlingConfig.DataExchange     = DMA_EXCHANGE_NONE;
+  node_conf.DataHandlingConfig.DataAlignment    = DMA_DATA_RIGHTALIGN_ZEROPADDED;
+  node_conf.TriggerConfig.TriggerPolarity       = DMA_TRIG_POLARITY_MASKED;
+  node_conf.TriggerConfig.TriggerMode           = 0U;
+  node_conf.TriggerConfig.TriggerSelection      = 0U;
+  node_conf.SrcAddress                          = (uint32_t)&hi2s->Instance->RXDR;
+  node_conf.DstAddress                          = (uint32_t)pConfig->pRxData;
+  node_conf.DataSize                            = hi2s->RxXferCount;
+#if defined (__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U)
+  node_conf.SrcSecure                           = DMA_CHANNEL_SRC_SEC;
+  node_conf.DestSecure                          = DMA_CHANNEL_DEST_SEC;
+#endif /* (__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U) */
+
+  /* Build the circular Rx queue */
+  errorcode = HAL_DMAEx_List_ResetQ(pConfig->pRxQueue);
+
+  if (errorcode == HAL_OK)
+  {
+    errorcode = HAL_DMAEx_List_BuildNode(&node_conf, pConfig->pRxNode);
+  }
+  if (errorcode == HAL_OK)
+  {
+    errorcode = HAL_DMAEx_List_InsertNode_Tail(pConfig->pRxQueue, pConfig->pRxNode);
+  }
+  if (errorcode == HAL_OK)
+  {
+    errorcode = HAL_DMAEx_List_SetCircularMode(pConfig->pRxQueue);
+  }
+  if (errorcode == HAL_OK)
+  {
+    errorcode = HAL_DMAEx_List_LinkQ(hi2s->hdmarx, pConfig->pRxQueue);
+  }
+
+  /* Prepare the Tx node: the Rx channel reports the buffer progress, the Tx channel generates no
+     transfer event */
+  node_conf.Init.Request                        = pConfig->TxRequest;
+  node_conf.Init.Direction                      = DMA_MEMORY_TO_PERIPH;
+  node_conf.Init.SrcInc                         = DMA_SINC_INCREMENTED;
+  node_conf.Init.DestInc                        = DMA_DINC_FIXED;
+  node_conf.Init.Priority                       = hi2s->hdmatx->InitLinkedList.Priority;
+  node_conf.Init.TransferEventMode              = DMA_TCEM_LAST_LL_ITEM_TRANSFER;
+  node_conf.SrcAddress                          = (uint32_t)pConfig->pTxData;
+  node_conf.DstAddress                          = (uint32_t)&hi2s->Instance->TXDR;
+  node_conf.DataSize                            = hi2s->TxXferCount;
+
+  /* Build the circular Tx queue */
+  if (errorcode == HAL_OK)
+  {
+    errorcode = HAL_DMAEx_List_ResetQ(pConfig->pTxQueue);
+  }
+  if (errorcode == HAL_OK)
+  {
+    errorcode = HAL_DMAEx_List_BuildNode(&node_conf, pConfig->pTxNode);
+  }
+  if (errorcode == HAL_OK)
+  {
+    errorcode = HAL_DMAEx_List_InsertNode_Tail(pConfig->pTxQueue, pConfig->pTxNode);
+  }
+  if (errorcode == HAL_OK)
+  {
+    errorcode = HAL_DMAEx_List_SetCircularMode(pConfig->pTxQueue);
+  }
+  if (errorcode == HAL_OK)
+  {
+    errorcode = HAL_DMAEx_List_LinkQ(hi2s->hdmatx, pConfig->pTxQueue);
+  }
+
+  if (errorcode != HAL_OK)
+  {
+    __HAL_UNLOCK(hi2s);
+    return HAL_ERROR;
+  }
+
+  hi2s->ErrorCode   = HAL_I2S_ERROR_NONE;
+  hi2s->State       = HAL_I2S_STATE_BUSY_TX_RX;
+
+  /* Reset the Tx/Rx DMA bits */
+  CLEAR_BIT(hi2s->Instance->CFG1, SPI_CFG1_TXDMAEN | SPI_CFG1_RXDMAEN);
+
+  /* Set the DMA callbacks: the Rx channel drives the half and full buffer callbacks */
+  hi2s->hdmarx->XferHalfCpltCallback = I2SEx_DMATxRxHalfCplt;
+  hi2s->hdmarx->XferCpltCallback     = I2SEx_DMATxRxCplt;
+  hi2s->hdmarx->XferErrorCallback    = I2S_DMAError;
+  hi2s->hdmatx->XferHalfCpltCallback = NULL;
+  hi2s->hdmatx->XferCpltCallback     = NULL;
+  hi2s->hdmatx->XferErrorCallback    = I2S_DMAError;
+
+  /* Enable the Tx then Rx DMA channels */
+  errorcode = HAL_DMAEx_List_Start_IT(hi2s->hdmatx);
+  if (errorcode == HAL_OK)
+  {
+    errorcode = HAL_DMAEx_List_Start_IT(hi2s->hdmarx);
+    if (errorcode != HAL_OK)
+    {
+      (void)HAL_DMA_Abort(hi2s->hdmatx);
+    }
+  }
+
+  if (errorcode != HAL_OK)
+  {
+    /* Update I2S error code */
+    SET_BIT(hi2s->ErrorCode, HAL_I2S_ERROR_DMA);
+    hi2s->State = HAL_I2S_STATE_READY;
+
+    __HAL_UNLOCK(hi2s);
+    return HAL_ERROR;
+  }
+
+  /* Enable Tx and Rx DMA Requests */
+  SET_BIT(hi2s->Instance->CFG1, SPI_CFG1_TXDMAEN | SPI_CFG1_RXDMAEN);
+
+  /* Check if the I2S is already enabled */
+  if (HAL_IS_BIT_CLR(hi2s->Instance->CR1, SPI_CR1_SPE))
+  {
+    /* Enable I2S peripheral */
+    __HAL_I2S_ENABLE(hi2s);
+  }
+
+  /* Start the transfer */
+  SET_BIT(hi2s->Instance->CR1, SPI_CR1_CSTART);
+
+  __HAL_UNLOCK(hi2s);
+  return HAL_OK;
+}
+
 /**
   * @brief  Pauses the audio DMA Stream/Channel playing from the Media.
   * @param  hi2s pointer to a I2S_HandleTypeDef structure that contains
@@ -2512,8 +2715,8 @@ static void I2SEx_DMATxRxCplt(DMA_HandleTypeDef *hdma)
 {
   I2S_HandleTypeDef *hi2s = (I2S_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
 
-  /* if DMA is configured in DMA_NORMAL Mode */
-  if (hdma->Init.Mode == DMA_NORMAL)
+  /* if DMA is configured in DMA_NORMAL Mode, a circular linked-list streaming keeps going */
+  if ((hdma->Init.Mode == DMA_NORMAL) && (hdma->Mode != DMA_LINKEDLIST_CIRCULAR))
   {
     /* Disable Tx DMA Request */
     CLEAR_BIT(hi2s->Instance->CFG1, SPI_CFG1_TXDMAEN);
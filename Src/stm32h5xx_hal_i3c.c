@@ -137,6 +137,11 @@
     (#) To send a message header {S + 0x7E + W + STOP}, use the function HAL_I3C_Ctrl_GenerateArbitration().
 
     (#) To send a target reset pattern or HDR exit pattern, use the function HAL_I3C_Ctrl_GeneratePattern().
+        The I3C peripheral handles SDR transfers only: HDR-DDR, HDR-TSP and HDR-BT framing are not supported
+        and no ENTHDRx CCC must be sent. The HDR exit pattern allows the controller to bring back to SDR mode
+        targets left in HDR mode by another controller. The SDR throughput is maximized by the SCL push-pull
+        timing computed with I3C_CtrlTimingComputation() at 12.5 MHz, and by chaining the private transfers
+        of a frame with HAL_I3C_Ctrl_MultipleTransfer_DMA().
 
     (#) To insert a target reset pattern before the STOP of a transmitted frame containing a RSTACT CCC command,
         the application must enable the reset pattern configuration using HAL_I3C_Ctrl_SetConfigResetPattern()
@@ -370,6 +375,11 @@
 #define I3C_BROADCAST_RSTDAA          (0x00000006U)
 #define I3C_BROADCAST_ENTDAA          (0x00000007U)
 
+/* Private define for the device table */
+#define I3C_DIRECT_SETDASA            (0x00000087U)
+#define I3C_DEVICETABLE_ADDR_FIRST    (0x08U)
+#define I3C_DEVICETABLE_ADDR_LAST     (0x77U)
+
 /* Private define to split ENTDAA payload */
 #define I3C_DCR_IN_PAYLOAD_SHIFT       56
 #define I3C_PID_IN_PAYLOAD_MASK        0xFFFFFFFFFFFFU
@@ -574,6 +584,13 @@ static HAL_StatusTypeDef I3C_Ctrl_IsDevice_Ready(I3C_HandleTypeDef *hi3c,
                                                  uint32_t           trials,
                                                  uint32_t           timeout);
 static void I3C_TreatErrorCallback(I3C_HandleTypeDef *hi3c);
+static void I3C_IBIStream_Capture(I3C_HandleTypeDef *hi3c);
+static void I3C_IBIStream_Advance(I3C_HandleTypeDef *hi3c);
+static void I3C_IBIStream_ReadCplt(I3C_HandleTypeDef *hi3c);
+static HAL_StatusTypeDef I3C_Ctrl_DeviceTable_SendCCC(I3C_HandleTypeDef *hi3c, uint8_t targetAddr, uint8_t ccc,
+                                                      uint8_t data, uint32_t option, uint32_t timeout);
+static uint8_t I3C_DeviceTable_NextAddr(const I3C_DeviceTableEntryTypeDef *pTable, uint32_t nbEntry,
+                                        uint8_t *pNextAddr);
 /**
   * @}
   */
@@ -736,6 +753,9 @@ HAL_StatusTypeDef HAL_I3C_Init(I3C_HandleTypeDef *hi3c)
 
     hi3c->ErrorCode = HAL_I3C_ERROR_NONE;
 
+    /* No IBI stream attached */
+    hi3c->pIBIStream = NULL;
+
     /* Update I3C state */
     hi3c->State = HAL_I3C_STATE_READY;
     hi3c->PreviousState = HAL_I3C_STATE_READY;
@@ -1608,6 +1628,12 @@ void HAL_I3C_ER_IRQHandler(I3C_HandleTypeDef *hi3c)
     /* Errors treatment */
     I3C_ErrorTreatment(hi3c);
   }
+
+  /* Complete a failed IBI stream follow-up read and start the next one */
+  if (hi3c->pIBIStream != NULL)
+  {
+    I3C_IBIStream_Advance(hi3c);
+  }
 }
 
 /**
@@ -1632,6 +1658,12 @@ void HAL_I3C_EV_IRQHandler(I3C_HandleTypeDef *hi3c) /* Derogation MISRAC2012-Rul
   {
     hi3c->XferISR(hi3c, it_masks);
   }
+
+  /* Start the IBI stream follow-up reads once the bus is released */
+  if (hi3c->pIBIStream != NULL)
+  {
+    I3C_IBIStream_Advance(hi3c);
+  }
 }
 /**
   * @}
@@ -1671,6 +1703,10 @@ void HAL_I3C_EV_IRQHandler(I3C_HandleTypeDef *hi3c) /* Derogation MISRAC2012-Rul
          (+) Call the function HAL_I3C_AddDescToFrame() to prepare the full transfer usecase in a Controller transfer
              descriptor which contained different buffer pointers and their associated size through I3C_XferTypeDef.
              This function must be called before initiate any communication transfer.
+         (+) Call the function HAL_I3C_Ctrl_BuildFrame() once to prepare a periodic transfer usecase in a persistent
+             I3C_FrameTypeDef, then HAL_I3C_Ctrl_LoadFrame() before each Controller transfer instead of
+             HAL_I3C_AddDescToFrame(). The control words are not rebuilt, only the buffer pointers are restored.
+             The data to transmit must be written by the application in the TxBuf of the frame, in descriptor order.
          (+) Call the function HAL_I3C_Ctrl_SetConfigResetPattern() to configure the insertion of the reset pattern
              at the end of a Frame.
          (+) Call the function HAL_I3C_Ctrl_GetConfigResetPattern() to get the current reset pattern configuration
@@ -2255,6 +2291,107 @@ HAL_StatusTypeDef HAL_I3C_AddDescToFrame(I3C_HandleTypeDef         *hi3c,
   return status;
 }
 
+/**
+  * @brief  Build a persistent frame from Private or CCC descriptors, to be reissued with HAL_I3C_Ctrl_LoadFrame().
+  * @note   The descriptors and the buffers of pXferData must stay valid as long as the frame is used.
+  * @param  hi3c          : [IN]  Pointer to an I3C_HandleTypeDef structure that contains the configuration information
+  *                               for the specified I3C.
+  * @param  pCCCDesc      : [IN]  Pointer to an I3C_CCCTypeDef structure that contains the CCC descriptor information.
+  * @param  pPrivateDesc  : [IN]  Pointer to an I3C_PrivateTypeDef structure that contains the transfer descriptor.
+  * @param  pXferData     : [IN/OUT] Pointer to an I3C_XferTypeDef structure that contains required transmission buffers
+  *                                  (control buffer, data buffer and status buffer).
+  * @param  nbFrame       : [IN]  The number of CCC commands or the number of device to treat.
+  * @param  option        : [IN]  Value indicates the transfer option. It can be one value of @ref I3C_OPTION_DEFINITION
+  * @param  pFrame        : [OUT] Pointer to an I3C_FrameTypeDef structure receiving the frame.
+  * @retval HAL Status    :       Value from HAL_StatusTypeDef enumeration.
+  */
+HAL_StatusTypeDef HAL_I3C_Ctrl_BuildFrame(I3C_HandleTypeDef         *hi3c,
+                                          const I3C_CCCTypeDef      *pCCCDesc,
+                                          const I3C_PrivateTypeDef  *pPrivateDesc,
+                                          I3C_XferTypeDef           *pXferData,
+                                          uint8_t                   nbFrame,
+                                          uint32_t                  option,
+                                          I3C_FrameTypeDef          *pFrame)
+{
+  HAL_StatusTypeDef status;
+
+  /* check on the handle */
+  if ((hi3c == NULL) || (pFrame == NULL))
+  {
+    status = HAL_ERROR;
+  }
+  else
+  {
+    status = HAL_I3C_AddDescToFrame(hi3c, pCCCDesc, pPrivateDesc, pXferData, nbFrame, option);
+
+    if (status == HAL_OK)
+    {
+      /* Keep the prepared frame parameters */
+      pFrame->pCCCDesc         = pCCCDesc;
+      pFrame->pPrivateDesc     = pPrivateDesc;
+      pFrame->pXferData        = pXferData;
+      pFrame->Buffers          = *pXferData;
+      pFrame->ControlXferCount = hi3c->ControlXferCount;
+      pFrame->TxXferCount      = hi3c->TxXferCount;
+      pFrame->RxXferCount      = hi3c->RxXferCount;
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Load a frame built by HAL_I3C_Ctrl_BuildFrame() before a Controller transfer.
+  * @note   This function replaces HAL_I3C_AddDescToFrame() for a frame issued repeatedly. It restores the
+  *         transfer buffers pointers, moved by the previous transfer, without rebuilding the control words.
+  * @param  hi3c          : [IN]  Pointer to an I3C_HandleTypeDef structure that contains the configuration information
+  *                               for the specified I3C.
+  * @param  pFrame        : [IN]  Pointer to an I3C_FrameTypeDef structure that contains the frame.
+  * @retval HAL Status    :       Value from HAL_StatusTypeDef enumeration.
+  */
+HAL_StatusTypeDef HAL_I3C_Ctrl_LoadFrame(I3C_HandleTypeDef *hi3c, const I3C_FrameTypeDef *pFrame)
+{
+  HAL_I3C_StateTypeDef handle_state;
+  HAL_StatusTypeDef status = HAL_OK;
+
+  /* check on the handle */
+  if (hi3c == NULL)
+  {
+    status = HAL_ERROR;
+  }
+  /* Check on user parameters */
+  else if ((pFrame == NULL) || (pFrame->pXferData == NULL))
+  {
+    hi3c->ErrorCode = HAL_I3C_ERROR_INVALID_PARAM;
+    status = HAL_ERROR;
+  }
+  else
+  {
+    /* Get I3C handle state */
+    handle_state = hi3c->State;
+
+    /* check on the State */
+    if ((handle_state == HAL_I3C_STATE_READY) || (handle_state == HAL_I3C_STATE_LISTEN))
+    {
+      /* Restore the buffers and set handle transfer parameters */
+      *pFrame->pXferData     = pFrame->Buffers;
+      hi3c->ErrorCode        = HAL_I3C_ERROR_NONE;
+      hi3c->pCCCDesc         = pFrame->pCCCDesc;
+      hi3c->pPrivateDesc     = pFrame->pPrivateDesc;
+      hi3c->pXferData        = pFrame->pXferData;
+      hi3c->ControlXferCount = pFrame->ControlXferCount;
+      hi3c->TxXferCount      = pFrame->TxXferCount;
+      hi3c->RxXferCount      = pFrame->RxXferCount;
+    }
+    else
+    {
+      status = HAL_BUSY;
+    }
+  }
+
+  return status;
+}
+
 /**
   * @brief Set the configuration of the inserted reset pattern at the end of a Frame.
   * @note  When the transfer descriptor contains multiple frames with RESTART option, the reset pattern at the end of
@@ -2737,6 +2874,15 @@ HAL_StatusTypeDef HAL_I3C_GetConfigFifo(I3C_HandleTypeDef *hi3c, I3C_FifoConfTyp
              arbitration in polling mode
          (+) Call the function HAL_I3C_Ctrl_GenerateArbitration to send arbitration
             (message header {S + 0x7E + W + STOP}) in polling mode
+         (+) Call the function HAL_I3C_Ctrl_IBIStream_Start() to queue the received IBIs into a ring, each
+             followed by a private read of the target in interrupt mode. The application retrieves the complete
+             entries with HAL_I3C_Ctrl_IBIStream_Get(), and HAL_I3C_Ctrl_IBIStream_Stop() detaches the stream.
+            (++) The notifications must be activated with HAL_I3C_ActivateNotification(), IBI event included.
+            (++) While the stream is attached, the IBIs are no more reported to HAL_I3C_NotifyCallback().
+            (++) An application transfer returns HAL_BUSY while a follow-up read is ongoing.
+         (+) Call the function HAL_I3C_Ctrl_DeviceTable_Assign() to assign the dynamic addresses from a device table
+             kept by the application across resets. The targets with a static address get their cached dynamic
+             address with SETDASA, the others get it back during ENTDAA from their PID.
 
          (+) Those functions are called only when mode is Controller.
 
@@ -5593,6 +5739,318 @@ HAL_StatusTypeDef HAL_I3C_Ctrl_GenerateArbitration(I3C_HandleTypeDef *hi3c, uint
   return status;
 }
 
+/**
+  * @brief  Controller attach an IBI stream.
+  * @note   The pTargets, TargetCount, pEntries, pDataPool, EntryCount, DataSlotSize and pEntryCallback fields
+  *         of the stream must be set before calling this function.
+  * @param  hi3c       : [IN]  Pointer to an I3C_HandleTypeDef structure that contains the configuration information
+  *                            for the specified I3C.
+  * @param  pStream    : [IN]  Pointer to an I3C_IBIStreamTypeDef structure.
+  * @retval HAL Status :       Value from HAL_StatusTypeDef enumeration.
+  */
+HAL_StatusTypeDef HAL_I3C_Ctrl_IBIStream_Start(I3C_HandleTypeDef *hi3c, I3C_IBIStreamTypeDef *pStream)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  /* check on the handle */
+  if (hi3c == NULL)
+  {
+    status = HAL_ERROR;
+  }
+  /* Check on user parameters */
+  else if ((pStream == NULL) || (pStream->pEntries == NULL) || (pStream->EntryCount == 0U) ||
+           ((pStream->TargetCount != 0U) && ((pStream->pTargets == NULL) || (pStream->pDataPool == NULL))))
+  {
+    hi3c->ErrorCode = HAL_I3C_ERROR_INVALID_PARAM;
+    status = HAL_ERROR;
+  }
+  /* check on the Mode */
+  else if (hi3c->Mode != HAL_I3C_MODE_CONTROLLER)
+  {
+    hi3c->ErrorCode = HAL_I3C_ERROR_NOT_ALLOWED;
+    status = HAL_ERROR;
+  }
+  else
+  {
+    pStream->Head          = 0U;
+    pStream->ReadIndex     = 0U;
+    pStream->Tail          = 0U;
+    pStream->ReadActive    = 0U;
+    pStream->OverflowCount = 0U;
+
+    hi3c->pIBIStream = pStream;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Controller detach the IBI stream.
+  * @note   A follow-up read ongoing is completed but not reported.
+  * @param  hi3c       : [IN]  Pointer to an I3C_HandleTypeDef structure that contains the configuration information
+  *                            for the specified I3C.
+  * @retval HAL Status :       Value from HAL_StatusTypeDef enumeration.
+  */
+HAL_StatusTypeDef HAL_I3C_Ctrl_IBIStream_Stop(I3C_HandleTypeDef *hi3c)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  /* check on the handle */
+  if (hi3c == NULL)
+  {
+    status = HAL_ERROR;
+  }
+  else
+  {
+    hi3c->pIBIStream = NULL;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Controller retrieve the oldest complete entry of the IBI stream.
+  * @param  hi3c       : [IN]  Pointer to an I3C_HandleTypeDef structure that contains the configuration information
+  *                            for the specified I3C.
+  * @param  pEntry     : [OUT] Pointer to an I3C_IBIStreamEntryTypeDef structure receiving the entry.
+  * @param  pData      : [OUT] Pointer to a buffer of DataSlotSize bytes receiving the follow-up read data, or NULL.
+  * @retval HAL Status :       Value from HAL_StatusTypeDef enumeration, HAL_ERROR when no entry is complete.
+  */
+HAL_StatusTypeDef HAL_I3C_Ctrl_IBIStream_Get(I3C_HandleTypeDef *hi3c, I3C_IBIStreamEntryTypeDef *pEntry,
+                                             uint8_t *pData)
+{
+  I3C_IBIStreamTypeDef *p_stream;
+  const uint8_t *p_slot;
+  uint32_t slot;
+  uint32_t index;
+  HAL_StatusTypeDef status = HAL_OK;
+
+  /* check on the handle */
+  if ((hi3c == NULL) || (pEntry == NULL))
+  {
+    status = HAL_ERROR;
+  }
+  else if (hi3c->pIBIStream == NULL)
+  {
+    hi3c->ErrorCode = HAL_I3C_ERROR_NOT_ALLOWED;
+    status = HAL_ERROR;
+  }
+  else
+  {
+    p_stream = hi3c->pIBIStream;
+
+    if (p_stream->Tail == p_stream->ReadIndex)
+    {
+      status = HAL_ERROR;
+    }
+    else
+    {
+      slot = p_stream->Tail % p_stream->EntryCount;
+      *pEntry = p_stream->pEntries[slot];
+
+      if ((pData != NULL) && (pEntry->DataSize != 0U))
+      {
+        p_slot = &p_stream->pDataPool[slot * p_stream->DataSlotSize];
+        for (index = 0U; index < pEntry->DataSize; index++)
+        {
+          pData[index] = p_slot[index];
+        }
+      }
+
+      /* Release the entry */
+      p_stream->Tail++;
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Controller assign the dynamic addresses of the targets from a cached device table in polling mode.
+  * @note   The targets of the table having a static address and a dynamic address are first assigned with a
+  *         direct SETDASA CCC, they do not take part in the following ENTDAA procedure. The other targets are
+  *         identified by their PID during ENTDAA and receive back the dynamic address cached in the table, an
+  *         unknown target gets a free entry and a new dynamic address.
+  * @note   The table is owned by the application and can be kept across resets (backup SRAM, Flash) so the
+  *         targets keep the same dynamic addresses from one bring-up to the next.
+  * @note   A target which still has its dynamic address does not acknowledge SETDASA nor take part in ENTDAA,
+  *         use @ref I3C_RSTDAA_THEN_ENTDAA when the targets are not reset along with the controller.
+  * @param  hi3c       : [IN]     Pointer to an I3C_HandleTypeDef structure that contains the configuration
+  *                               information for the specified I3C.
+  * @param  pTable     : [IN/OUT] Pointer to an array of I3C_DeviceTableEntryTypeDef structures.
+  * @param  nbEntry    : [IN]     Number of entries of pTable.
+  * @param  dynOption  : [IN]     Parameter indicates the Dynamic address assignment option.
+  *                               It can be one value of @ref I3C_DYNAMIC_ADDRESS_OPTION_DEFINITION.
+  * @param  timeout    : [IN]     Timeout duration in millisecond of each procedure.
+  * @retval HAL Status :          Value from HAL_StatusTypeDef enumeration, HAL_ERROR with the error code
+  *                               HAL_I3C_ERROR_DYNAMIC_ADDR when a target could not be recorded in the table.
+  */
+HAL_StatusTypeDef HAL_I3C_Ctrl_DeviceTable_Assign(I3C_HandleTypeDef           *hi3c,
+                                                  I3C_DeviceTableEntryTypeDef *pTable,
+                                                  uint32_t                     nbEntry,
+                                                  uint32_t                     dynOption,
+                                                  uint32_t                     timeout)
+{
+  I3C_DeviceTableEntryTypeDef *p_entry;
+  I3C_DeviceConfTypeDef dev_conf;
+  uint64_t payload;
+  uint32_t index;
+  uint32_t bcr;
+  uint32_t table_full = 0U;
+  uint8_t next_addr = I3C_DEVICETABLE_ADDR_FIRST;
+  uint8_t dyn_addr;
+  HAL_StatusTypeDef status = HAL_OK;
+
+  /* check on parameters */
+  assert_param(IS_I3C_ENTDAA_OPTION(dynOption));
+
+  /* check on the handle */
+  if (hi3c == NULL)
+  {
+    status = HAL_ERROR;
+  }
+  /* Check on user parameters */
+  else if ((pTable == NULL) || (nbEntry == 0U))
+  {
+    hi3c->ErrorCode = HAL_I3C_ERROR_INVALID_PARAM;
+    status = HAL_ERROR;
+  }
+  /* check on the Mode */
+  else if (hi3c->Mode != HAL_I3C_MODE_CONTROLLER)
+  {
+    hi3c->ErrorCode = HAL_I3C_ERROR_NOT_ALLOWED;
+    status = HAL_ERROR;
+  }
+  /* check on the State */
+  else if ((hi3c->State != HAL_I3C_STATE_READY) && (hi3c->State != HAL_I3C_STATE_LISTEN))
+  {
+    status = HAL_BUSY;
+  }
+  else
+  {
+    for (index = 0U; index < nbEntry; index++)
+    {
+      pTable[index].Present = 0U;
+    }
+
+    /* Reset all the dynamic addresses before the assignment */
+    if (dynOption == I3C_RSTDAA_THEN_ENTDAA)
+    {
+      status = I3C_Ctrl_DeviceTable_SendCCC(hi3c, 0U, (uint8_t)I3C_BROADCAST_RSTDAA, 0U,
+                                            I3C_BROADCAST_WITHOUT_DEFBYTE_STOP, timeout);
+    }
+
+    /* Fast path: assign the cached dynamic address of the targets having a static address */
+    for (index = 0U; (index < nbEntry) && (status == HAL_OK); index++)
+    {
+      p_entry = &pTable[index];
+
+      if ((p_entry->StaticAddr != 0U) && (p_entry->DynamicAddr != 0U))
+      {
+        status = I3C_Ctrl_DeviceTable_SendCCC(hi3c, p_entry->StaticAddr, (uint8_t)I3C_DIRECT_SETDASA,
+                                              (uint8_t)(p_entry->DynamicAddr << 1U),
+                                              I3C_DIRECT_WITHOUT_DEFBYTE_STOP, timeout);
+
+        if (status == HAL_OK)
+        {
+          p_entry->Present = 1U;
+        }
+        /* A missing target is left to the ENTDAA procedure */
+        else if ((hi3c->ErrorCode & HAL_I3C_ERROR_ADDRESS_NACK) == HAL_I3C_ERROR_ADDRESS_NACK)
+        {
+          status = HAL_OK;
+        }
+        else
+        {
+          /* Keep the error status */
+        }
+      }
+    }
+
+    /* Assign the remaining targets with ENTDAA, the known PIDs get back their cached dynamic address */
+    if (status == HAL_OK)
+    {
+      do
+      {
+        status = HAL_I3C_Ctrl_DynAddrAssign(hi3c, &payload, I3C_ONLY_ENTDAA, timeout);
+
+        if (status == HAL_BUSY)
+        {
+          p_entry = NULL;
+
+          for (index = 0U; (index < nbEntry) && (p_entry == NULL); index++)
+          {
+            if ((pTable[index].Payload & I3C_PID_IN_PAYLOAD_MASK) == (payload & I3C_PID_IN_PAYLOAD_MASK))
+            {
+              p_entry = &pTable[index];
+            }
+          }
+
+          for (index = 0U; (index < nbEntry) && (p_entry == NULL); index++)
+          {
+            if ((pTable[index].Payload == 0U) && (pTable[index].StaticAddr == 0U) &&
+                (pTable[index].DynamicAddr == 0U))
+            {
+              p_entry = &pTable[index];
+            }
+          }
+
+          if ((p_entry != NULL) && (p_entry->DynamicAddr != 0U))
+          {
+            dyn_addr = p_entry->DynamicAddr;
+          }
+          else
+          {
+            dyn_addr = I3C_DeviceTable_NextAddr(pTable, nbEntry, &next_addr);
+          }
+
+          if ((p_entry != NULL) && (dyn_addr != 0U))
+          {
+            p_entry->Payload     = payload;
+            p_entry->DynamicAddr = dyn_addr;
+            p_entry->Present     = 1U;
+          }
+          else
+          {
+            /* The target is answered anyway to let the procedure complete */
+            table_full = 1U;
+          }
+
+          (void)HAL_I3C_Ctrl_SetDynAddr(hi3c, dyn_addr);
+        }
+      } while (status == HAL_BUSY);
+    }
+
+    /* Configure the DEVRx registers of the present targets */
+    for (index = 0U; (index < nbEntry) && (status == HAL_OK); index++)
+    {
+      p_entry = &pTable[index];
+
+      if ((p_entry->Present != 0U) && (p_entry->DeviceIndex != 0U))
+      {
+        bcr = __HAL_I3C_GET_BCR(p_entry->Payload);
+
+        dev_conf.DeviceIndex       = p_entry->DeviceIndex;
+        dev_conf.TargetDynamicAddr = p_entry->DynamicAddr;
+        dev_conf.IBIAck            = __HAL_I3C_GET_IBI_CAPABLE(bcr);
+        dev_conf.IBIPayload        = __HAL_I3C_GET_IBI_PAYLOAD(bcr);
+        dev_conf.CtrlRoleReqAck    = DISABLE;
+        dev_conf.CtrlStopTransfer  = DISABLE;
+
+        status = HAL_I3C_Ctrl_ConfigBusDevices(hi3c, &dev_conf, 1U);
+      }
+    }
+
+    if ((status == HAL_OK) && (table_full != 0U))
+    {
+      hi3c->ErrorCode = HAL_I3C_ERROR_DYNAMIC_ADDR;
+      status = HAL_ERROR;
+    }
+  }
+
+  return status;
+}
+
 /**
   * @}
   */
@@ -7529,13 +7987,21 @@ static HAL_StatusTypeDef I3C_Ctrl_Event_ISR(struct __I3C_HandleTypeDef *hi3c, ui
     /* Clear IBI request flag */
     LL_I3C_ClearFlag_IBI(hi3c->Instance);
 
+    if (hi3c->pIBIStream != NULL)
+    {
+      /* Queue the IBI into the stream, its follow-up read is started once the bus is released */
+      I3C_IBIStream_Capture(hi3c);
+    }
+    else
+    {
 #if (USE_HAL_I3C_REGISTER_CALLBACKS == 1U)
-    /* Call registered callback */
-    hi3c->NotifyCallback(hi3c, EVENT_ID_IBI);
+      /* Call registered callback */
+      hi3c->NotifyCallback(hi3c, EVENT_ID_IBI);
 #else
-    /* Asynchronous IBI event Callback */
-    HAL_I3C_NotifyCallback(hi3c, EVENT_ID_IBI);
+      /* Asynchronous IBI event Callback */
+      HAL_I3C_NotifyCallback(hi3c, EVENT_ID_IBI);
 #endif /* USE_HAL_I3C_REGISTER_CALLBACKS == 1U */
+    }
   }
 
   /* I3C controller controller-role request event management ---------------------------------------------------------*/
@@ -8192,12 +8658,20 @@ static HAL_StatusTypeDef I3C_Ctrl_Rx_ISR(struct __I3C_HandleTypeDef *hi3c, uint3
 
         hi3c->ErrorCode = HAL_I3C_ERROR_NONE;
 
-        /* Call the receive complete callback */
+        if ((hi3c->pIBIStream != NULL) && (hi3c->pXferData == &hi3c->pIBIStream->Xfer))
+        {
+          /* Follow-up read of an IBI stream entry completed */
+          I3C_IBIStream_ReadCplt(hi3c);
+        }
+        else
+        {
+          /* Call the receive complete callback */
 #if (USE_HAL_I3C_REGISTER_CALLBACKS == 1U)
-        hi3c->CtrlRxCpltCallback(hi3c);
+          hi3c->CtrlRxCpltCallback(hi3c);
 #else
-        HAL_I3C_CtrlRxCpltCallback(hi3c);
+          HAL_I3C_CtrlRxCpltCallback(hi3c);
 #endif /* USE_HAL_I3C_REGISTER_CALLBACKS == 1U */
+        }
       }
       else
       {
@@ -8334,13 +8808,21 @@ static HAL_StatusTypeDef I3C_Ctrl_Tx_Listen_Event_ISR(struct __I3C_HandleTypeDef
     /* Clear IBI request flag */
     LL_I3C_ClearFlag_IBI(hi3c->Instance);
 
+    if (hi3c->pIBIStream != NULL)
+    {
+      /* Queue the IBI into the stream, its follow-up read is started once the bus is released */
+      I3C_IBIStream_Capture(hi3c);
+    }
+    else
+    {
 #if (USE_HAL_I3C_REGISTER_CALLBACKS == 1U)
-    /* Call registered callback */
-    hi3c->NotifyCallback(hi3c, EVENT_ID_IBI);
+      /* Call registered callback */
+      hi3c->NotifyCallback(hi3c, EVENT_ID_IBI);
 #else
-    /* Asynchronous IBI event Callback */
-    HAL_I3C_NotifyCallback(hi3c, EVENT_ID_IBI);
+      /* Asynchronous IBI event Callback */
+      HAL_I3C_NotifyCallback(hi3c, EVENT_ID_IBI);
 #endif /* USE_HAL_I3C_REGISTER_CALLBACKS == 1U */
+    }
   }
 
   /* I3C controller controller-role request event management ---------------------------------------------------------*/
@@ -8404,13 +8886,21 @@ static HAL_StatusTypeDef I3C_Ctrl_Rx_Listen_Event_ISR(struct __I3C_HandleTypeDef
     /* Clear IBI request flag */
     LL_I3C_ClearFlag_IBI(hi3c->Instance);
 
+    if (hi3c->pIBIStream != NULL)
+    {
+      /* Queue the IBI into the stream, its follow-up read is started once the bus is released */
+      I3C_IBIStream_Capture(hi3c);
+    }
+    else
+    {
 #if (USE_HAL_I3C_REGISTER_CALLBACKS == 1U)
-    /* Call registered callback */
-    hi3c->NotifyCallback(hi3c, EVENT_ID_IBI);
+      /* Call registered callback */
+      hi3c->NotifyCallback(hi3c, EVENT_ID_IBI);
 #else
-    /* Asynchronous IBI event Callback */
-    HAL_I3C_NotifyCallback(hi3c, EVENT_ID_IBI);
+      /* Asynchronous IBI event Callback */
+      HAL_I3C_NotifyCallback(hi3c, EVENT_ID_IBI);
 #endif /* USE_HAL_I3C_REGISTER_CALLBACKS == 1U */
+    }
   }
 
   /* I3C controller controller-role request event management ---------------------------------------------------------*/
@@ -8475,13 +8965,21 @@ static HAL_StatusTypeDef I3C_Ctrl_Multiple_Xfer_Listen_Event_ISR(struct __I3C_Ha
     /* Clear IBI request flag */
     LL_I3C_ClearFlag_IBI(hi3c->Instance);
 
+    if (hi3c->pIBIStream != NULL)
+    {
+      /* Queue the IBI into the stream, its follow-up read is started once the bus is released */
+      I3C_IBIStream_Capture(hi3c);
+    }
+    else
+    {
 #if (USE_HAL_I3C_REGISTER_CALLBACKS == 1U)
-    /* Call registered callback */
-    hi3c->NotifyCallback(hi3c, EVENT_ID_IBI);
+      /* Call registered callback */
+      hi3c->NotifyCallback(hi3c, EVENT_ID_IBI);
 #else
-    /* Asynchronous IBI event Callback */
-    HAL_I3C_NotifyCallback(hi3c, EVENT_ID_IBI);
+      /* Asynchronous IBI event Callback */
+      HAL_I3C_NotifyCallback(hi3c, EVENT_ID_IBI);
 #endif /* USE_HAL_I3C_REGISTER_CALLBACKS == 1U */
+    }
   }
 
   /* I3C controller controller-role request event management ---------------------------------------------------------*/
@@ -10158,6 +10656,233 @@ static void I3C_ErrorTreatment(I3C_HandleTypeDef *hi3c)
   }
 }
 
+/**
+  * @brief  I3C queue the received IBI into the IBI stream.
+  * @param  hi3c : [IN] Pointer to an I3C_HandleTypeDef structure that contains
+  *                     the configuration information for the specified I3C.
+  * @retval None
+  */
+static void I3C_IBIStream_Capture(I3C_HandleTypeDef *hi3c)
+{
+  I3C_IBIStreamTypeDef *p_stream = hi3c->pIBIStream;
+  I3C_IBIStreamEntryTypeDef *p_entry;
+  uint32_t index;
+
+  if ((p_stream->Head - p_stream->Tail) >= p_stream->EntryCount)
+  {
+    /* Ring full, the IBI is dropped */
+    p_stream->OverflowCount++;
+  }
+  else
+  {
+    p_entry = &p_stream->pEntries[p_stream->Head % p_stream->EntryCount];
+
+    p_entry->TargetAddr  = LL_I3C_GetIBITargetAddr(hi3c->Instance);
+    p_entry->PayloadSize = LL_I3C_GetNbIBIAddData(hi3c->Instance);
+    p_entry->Payload     = LL_I3C_GetIBIPayload(hi3c->Instance);
+    p_entry->DataSize    = 0U;
+    p_entry->ErrorCode   = HAL_I3C_ERROR_NONE;
+
+    /* Retrieve the follow-up read size of the target */
+    for (index = 0U; index < p_stream->TargetCount; index++)
+    {
+      if (p_stream->pTargets[index].TargetAddr == p_entry->TargetAddr)
+      {
+        p_entry->DataSize = (p_stream->pTargets[index].ReadSize > p_stream->DataSlotSize) ?
+                            p_stream->DataSlotSize : p_stream->pTargets[index].ReadSize;
+        break;
+      }
+    }
+
+    p_stream->Head++;
+  }
+}
+
+/**
+  * @brief  I3C complete the IBI stream entries and start the next follow-up read when the bus is released.
+  * @param  hi3c : [IN] Pointer to an I3C_HandleTypeDef structure that contains
+  *                     the configuration information for the specified I3C.
+  * @retval None
+  */
+static void I3C_IBIStream_Advance(I3C_HandleTypeDef *hi3c)
+{
+  I3C_IBIStreamTypeDef *p_stream = hi3c->pIBIStream;
+  I3C_IBIStreamEntryTypeDef *p_entry;
+  uint32_t slot;
+  uint32_t completed = 0U;
+
+  /* A follow-up read terminated without completion has failed */
+  if ((p_stream->ReadActive == 1U) &&
+      ((hi3c->State == HAL_I3C_STATE_LISTEN) || (hi3c->State == HAL_I3C_STATE_READY)))
+  {
+    p_entry = &p_stream->pEntries[p_stream->ReadIndex % p_stream->EntryCount];
+    p_entry->DataSize  = 0U;
+    p_entry->ErrorCode = hi3c->ErrorCode;
+    p_stream->ReadActive = 0U;
+    p_stream->ReadIndex++;
+    completed = 1U;
+  }
+
+  while ((p_stream->ReadActive == 0U) && (p_stream->ReadIndex != p_stream->Head))
+  {
+    slot = p_stream->ReadIndex % p_stream->EntryCount;
+    p_entry = &p_stream->pEntries[slot];
+
+    if (p_entry->DataSize == 0U)
+    {
+      /* No follow-up read for this target */
+      p_stream->ReadIndex++;
+      completed = 1U;
+    }
+    else if (hi3c->State != HAL_I3C_STATE_LISTEN)
+    {
+      /* Bus used by the application, retry at its completion */
+      break;
+    }
+    else
+    {
+      p_stream->PrivateDesc.TargetAddr     = (uint8_t)p_entry->TargetAddr;
+      p_stream->PrivateDesc.TxBuf.pBuffer  = NULL;
+      p_stream->PrivateDesc.TxBuf.Size     = 0U;
+      p_stream->PrivateDesc.RxBuf.pBuffer  = &p_stream->pDataPool[slot * p_stream->DataSlotSize];
+      p_stream->PrivateDesc.RxBuf.Size     = p_entry->DataSize;
+      p_stream->PrivateDesc.Direction      = HAL_I3C_DIRECTION_READ;
+
+      p_stream->Xfer.CtrlBuf.pBuffer   = &p_stream->ControlWord;
+      p_stream->Xfer.CtrlBuf.Size      = 1U;
+      p_stream->Xfer.StatusBuf.pBuffer = NULL;
+      p_stream->Xfer.StatusBuf.Size    = 0U;
+      p_stream->Xfer.TxBuf.pBuffer     = NULL;
+      p_stream->Xfer.TxBuf.Size        = 0U;
+      p_stream->Xfer.RxBuf             = p_stream->PrivateDesc.RxBuf;
+
+      if ((HAL_I3C_AddDescToFrame(hi3c, NULL, &p_stream->PrivateDesc, &p_stream->Xfer, 1U,
+                                  I3C_PRIVATE_WITH_ARB_STOP) == HAL_OK) &&
+          (HAL_I3C_Ctrl_Receive_IT(hi3c, &p_stream->Xfer) == HAL_OK))
+      {
+        p_stream->ReadActive = 1U;
+      }
+      else
+      {
+        p_entry->DataSize  = 0U;
+        p_entry->ErrorCode = hi3c->ErrorCode;
+        p_stream->ReadIndex++;
+        completed = 1U;
+      }
+    }
+  }
+
+  if ((completed == 1U) && (p_stream->pEntryCallback != NULL))
+  {
+    p_stream->pEntryCallback(hi3c);
+  }
+}
+
+/**
+  * @brief  I3C complete the IBI stream entry of the follow-up read.
+  * @param  hi3c : [IN] Pointer to an I3C_HandleTypeDef structure that contains
+  *                     the configuration information for the specified I3C.
+  * @retval None
+  */
+static void I3C_IBIStream_ReadCplt(I3C_HandleTypeDef *hi3c)
+{
+  I3C_IBIStreamTypeDef *p_stream = hi3c->pIBIStream;
+
+  p_stream->ReadActive = 0U;
+  p_stream->ReadIndex++;
+
+  if (p_stream->pEntryCallback != NULL)
+  {
+    p_stream->pEntryCallback(hi3c);
+  }
+}
+
+/**
+  * @brief  Send a broadcast or a direct write CCC command of the device table in polling mode.
+  * @param  hi3c       : [IN] Pointer to an I3C_HandleTypeDef structure that contains the configuration
+  *                           information for the specified I3C.
+  * @param  targetAddr : [IN] Target address of a direct CCC, ignored for a broadcast CCC.
+  * @param  ccc        : [IN] CCC value code.
+  * @param  data       : [IN] Data byte of a direct CCC, no data is sent for a broadcast CCC.
+  * @param  option     : [IN] I3C_BROADCAST_WITHOUT_DEFBYTE_STOP or I3C_DIRECT_WITHOUT_DEFBYTE_STOP.
+  * @param  timeout    : [IN] Timeout duration in millisecond.
+  * @retval HAL Status :      Value from HAL_StatusTypeDef enumeration.
+  */
+static HAL_StatusTypeDef I3C_Ctrl_DeviceTable_SendCCC(I3C_HandleTypeDef *hi3c, uint8_t targetAddr, uint8_t ccc,
+                                                      uint8_t data, uint32_t option, uint32_t timeout)
+{
+  I3C_CCCTypeDef ccc_desc;
+  I3C_XferTypeDef xfer;
+  uint32_t control_buffer[2];
+  /* Word sized to support the Tx FIFO word treatment */
+  uint8_t tx_buffer[4];
+  uint8_t ccc_data = data;
+  HAL_StatusTypeDef status;
+
+  ccc_desc.TargetAddr     = targetAddr;
+  ccc_desc.CCC            = ccc;
+  ccc_desc.CCCBuf.pBuffer = &ccc_data;
+  ccc_desc.CCCBuf.Size    = (option == I3C_DIRECT_WITHOUT_DEFBYTE_STOP) ? 1U : 0U;
+  ccc_desc.Direction      = HAL_I3C_DIRECTION_WRITE;
+
+  xfer.CtrlBuf.pBuffer   = control_buffer;
+  xfer.CtrlBuf.Size      = 2U;
+  xfer.StatusBuf.pBuffer = NULL;
+  xfer.StatusBuf.Size    = 0U;
+  xfer.TxBuf.pBuffer     = tx_buffer;
+  xfer.TxBuf.Size        = 4U;
+  xfer.RxBuf.pBuffer     = NULL;
+  xfer.RxBuf.Size        = 0U;
+
+  status = HAL_I3C_AddDescToFrame(hi3c, &ccc_desc, NULL, &xfer, 1U, option);
+
+  if (status == HAL_OK)
+  {
+    status = HAL_I3C_Ctrl_TransmitCCC(hi3c, &xfer, timeout);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Allocate a new dynamic address, free in the device table and outside the reserved addresses.
+  * @param  pTable     : [IN]     Pointer to an array of I3C_DeviceTableEntryTypeDef structures.
+  * @param  nbEntry    : [IN]     Number of entries of pTable.
+  * @param  pNextAddr  : [IN/OUT] First address to check, updated past the allocated address.
+  * @retval The allocated dynamic address, 0 when no address is left.
+  */
+static uint8_t I3C_DeviceTable_NextAddr(const I3C_DeviceTableEntryTypeDef *pTable, uint32_t nbEntry,
+                                        uint8_t *pNextAddr)
+{
+  uint8_t addr;
+  uint8_t found = 0U;
+  uint32_t used;
+  uint32_t index;
+
+  for (addr = *pNextAddr; (addr <= I3C_DEVICETABLE_ADDR_LAST) && (found == 0U); addr++)
+  {
+    /* Skip the addresses at one bit of the broadcast address 0x7E */
+    used = ((addr == 0x3EU) || (addr == 0x5EU) || (addr == 0x6EU) || (addr == 0x76U)) ? 1U : 0U;
+
+    for (index = 0U; (index < nbEntry) && (used == 0U); index++)
+    {
+      if ((pTable[index].DynamicAddr == addr) || (pTable[index].StaticAddr == addr))
+      {
+        used = 1U;
+      }
+    }
+
+    if (used == 0U)
+    {
+      found = addr;
+    }
+  }
+
+  *pNextAddr = addr;
+
+  return found;
+}
+
 /**
   * @brief  I3C Error callback treatment.
   * @param  hi3c : [IN] Pointer to an I3C_HandleTypeDef structure that contains the configuration
@@ -9,6 +9,7 @@
   *           + Invalidate functions
   *           + Monitoring management
   *           + Memory address remap management
+  *           + Hit rate profiling
   ******************************************************************************
   * @attention
   *
@@ -73,7 +74,15 @@
 
     (#) Enable and disable up to four regions to remap input address from external
         memories to the internal Code region for execution with
-        HAL_ICACHE_EnableRemapRegion() and HAL_ICACHE_DisableRemapRegion()
+        HAL_ICACHE_EnableRemapRegion() and HAL_ICACHE_DisableRemapRegion().
+        HAL_ICACHE_SuggestRemapRegion() computes the smallest region covering a code
+        area of an external memory, and a free region number.
+
+    (#) Profile the hit rate per code phase with HAL_ICACHE_Profile_Init(), then
+        HAL_ICACHE_Profile_Enter() and HAL_ICACHE_Profile_Exit() called as trace hooks
+        around each phase, and HAL_ICACHE_Profile_GetHitRate().
+        HAL_ICACHE_CompareAssociativity() runs a workload in 1-way and 2-ways modes and
+        leaves the cache enabled in the mode with the best hit rate.
 
   @endverbatim
   */
@@ -139,6 +148,9 @@
 
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
+static uint32_t ICACHE_HitRate(uint32_t Hits, uint32_t Misses);
+static HAL_StatusTypeDef ICACHE_RunWorkload(uint32_t AssociativityMode, void (*pWorkload)(void),
+                                            uint32_t *pHitRate);
 
 /* Exported functions --------------------------------------------------------*/
 
@@ -636,12 +648,300 @@ HAL_StatusTypeDef  HAL_ICACHE_DisableRemapRegion(uint32_t Region)
   return status;
 }
 
+/**
+  * @brief  Compute the smallest remapped region covering a code area of an external memory.
+  * @note   The region is not enabled: HAL_ICACHE_EnableRemapRegion() is called with
+  *         the result, the Instruction Cache being disabled.
+  * @param  ExternalAddress  Start address of the code in the external memory
+  * @param  CodeSize         Size of the code in bytes
+  * @param  BaseAddress      Address of the region in the Code region, aligned on the region size
+  * @param  pRegion          Pointer to the first free region number
+  * @param  pRegionConfig    Pointer to the region configuration
+  * @retval HAL status (HAL_OK/HAL_ERROR)
+  */
+HAL_StatusTypeDef HAL_ICACHE_SuggestRemapRegion(uint32_t ExternalAddress, uint32_t CodeSize, uint32_t BaseAddress,
+                                                uint32_t *pRegion, ICACHE_RegionConfigTypeDef *pRegionConfig)
+{
+  uint32_t size_code;
+  uint32_t size_bytes = 0U;
+  uint32_t region;
+
+  if ((pRegion == NULL) || (pRegionConfig == NULL) || (CodeSize == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Smallest region holding the code, the region size being also its alignment */
+  for (size_code = ICACHE_REGIONSIZE_2MB; size_code <= ICACHE_REGIONSIZE_128MB; size_code++)
+  {
+    size_bytes = 0x100000UL << size_code;
+    if ((ExternalAddress / size_bytes) == ((ExternalAddress + CodeSize - 1U) / size_bytes))
+    {
+      break;
+    }
+  }
+
+  if ((size_code > ICACHE_REGIONSIZE_128MB) || ((BaseAddress & (size_bytes - 1U)) != 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* First region not enabled */
+  for (region = ICACHE_REGION_0; region <= ICACHE_REGION_3; region++)
+  {
+    if (((*(&(ICACHE->CRR0) + (1U * region))) & ICACHE_CRRx_REN) == 0U)
+    {
+      break;
+    }
+  }
+
+  if (region > ICACHE_REGION_3)
+  {
+    return HAL_ERROR;
+  }
+
+  *pRegion = region;
+  pRegionConfig->BaseAddress     = BaseAddress;
+  pRegionConfig->RemapAddress    = ExternalAddress & ~(size_bytes - 1U);
+  pRegionConfig->Size            = size_code;
+  pRegionConfig->TrafficRoute    = ICACHE_MASTER2_PORT;
+  pRegionConfig->OutputBurstType = ICACHE_OUTPUT_BURST_WRAP;
+
+  return HAL_OK;
+}
+
 
 /**
   * @}
   */
 #endif /*  ICACHE_CRRx_REN */
 
+/** @defgroup ICACHE_Exported_Functions_Group4 Profiling functions
+  * @brief    Profiling functions
+  *
+  @verbatim
+  ==============================================================================
+                        ##### Profiling functions #####
+  ==============================================================================
+  [..]
+    This section provides functions allowing to measure the Instruction Cache
+    hit rate per code phase and to select the associativity mode from it.
+    [..]
+    The Hit and Miss monitors are reset when entering a phase: they must not be
+    used by the application while profiling.
+  @endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initialize the Instruction Cache profiling.
+  * @param  pProfile  Pointer to the profiling structure
+  * @param  pPhases   Pointer to the user array of phase statistics
+  * @param  NbPhases  Number of phases of the array
+  * @retval HAL status (HAL_OK/HAL_ERROR)
+  */
+HAL_StatusTypeDef HAL_ICACHE_Profile_Init(ICACHE_ProfileTypeDef *pProfile, ICACHE_ProfilePhaseTypeDef *pPhases,
+                                          uint32_t NbPhases)
+{
+  uint32_t phase;
+
+  if ((pProfile == NULL) || (pPhases == NULL) || (NbPhases == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  for (phase = 0U; phase < NbPhases; phase++)
+  {
+    pPhases[phase].Hits = 0U;
+    pPhases[phase].Misses = 0U;
+    pPhases[phase].Runs = 0U;
+  }
+
+  pProfile->pPhases = pPhases;
+  pProfile->NbPhases = NbPhases;
+  pProfile->CurrentPhase = NbPhases;
+
+  return HAL_ICACHE_Monitor_Start(ICACHE_MONITOR_HIT_MISS);
+}
+
+/**
+  * @brief  Start the profiling of a phase.
+  * @note   To be called as trace hook at the phase start. The phases are not nested.
+  * @param  pProfile  Pointer to the profiling structure
+  * @param  Phase     Phase index, lower than the number of phases
+  * @retval HAL status (HAL_OK/HAL_ERROR/HAL_BUSY)
+  */
+HAL_StatusTypeDef HAL_ICACHE_Profile_Enter(ICACHE_ProfileTypeDef *pProfile, uint32_t Phase)
+{
+  if ((pProfile == NULL) || (Phase >= pProfile->NbPhases))
+  {
+    return HAL_ERROR;
+  }
+
+  if (pProfile->CurrentPhase != pProfile->NbPhases)
+  {
+    return HAL_BUSY;
+  }
+
+  pProfile->CurrentPhase = Phase;
+
+  return HAL_ICACHE_Monitor_Reset(ICACHE_MONITOR_HIT_MISS);
+}
+
+/**
+  * @brief  End the profiling of the current phase and accumulate its statistics.
+  * @note   To be called as trace hook at the phase end.
+  * @param  pProfile  Pointer to the profiling structure
+  * @retval HAL status (HAL_OK/HAL_ERROR)
+  */
+HAL_StatusTypeDef HAL_ICACHE_Profile_Exit(ICACHE_ProfileTypeDef *pProfile)
+{
+  uint32_t hits = ICACHE->HMONR;
+  uint32_t misses = ICACHE->MMONR;
+  ICACHE_ProfilePhaseTypeDef *p_phase;
+
+  if ((pProfile == NULL) || (pProfile->CurrentPhase == pProfile->NbPhases))
+  {
+    return HAL_ERROR;
+  }
+
+  p_phase = &pProfile->pPhases[pProfile->CurrentPhase];
+
+  /* Saturated accumulation, as the monitors */
+  p_phase->Hits = ((0xFFFFFFFFU - p_phase->Hits) < hits) ? 0xFFFFFFFFU : (p_phase->Hits + hits);
+  p_phase->Misses = ((0xFFFFFFFFU - p_phase->Misses) < misses) ? 0xFFFFFFFFU : (p_phase->Misses + misses);
+  p_phase->Runs++;
+
+  pProfile->CurrentPhase = pProfile->NbPhases;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Get the hit rate of a phase.
+  * @param  pProfile  Pointer to the profiling structure
+  * @param  Phase     Phase index, lower than the number of phases
+  * @retval Hit rate in per mille, 0 if the phase was not run
+  */
+uint32_t HAL_ICACHE_Profile_GetHitRate(const ICACHE_ProfileTypeDef *pProfile, uint32_t Phase)
+{
+  if ((pProfile == NULL) || (Phase >= pProfile->NbPhases))
+  {
+    return 0U;
+  }
+
+  return ICACHE_HitRate(pProfile->pPhases[Phase].Hits, pProfile->pPhases[Phase].Misses);
+}
+
+/**
+  * @brief  Compare the hit rate of a workload in 1-way and 2-ways modes.
+  * @note   The workload is run once in each mode, from an invalidated cache. The cache
+  *         is left enabled in the mode with the best hit rate, 2-ways on equality.
+  * @note   The Hit and Miss monitors are used.
+  * @param  pWorkload  Pointer to the workload function, representative of the application
+  * @param  pResult    Pointer to the comparison result
+  * @retval HAL status (HAL_OK/HAL_ERROR/HAL_TIMEOUT)
+  */
+HAL_StatusTypeDef HAL_ICACHE_CompareAssociativity(void (*pWorkload)(void),
+                                                  ICACHE_AssociativityResultTypeDef *pResult)
+{
+  HAL_StatusTypeDef status;
+
+  if ((pWorkload == NULL) || (pResult == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  status = ICACHE_RunWorkload(ICACHE_1WAY, pWorkload, &pResult->HitRate1Way);
+
+  if (status == HAL_OK)
+  {
+    status = ICACHE_RunWorkload(ICACHE_2WAYS, pWorkload, &pResult->HitRate2Ways);
+  }
+
+  if (status == HAL_OK)
+  {
+    pResult->BestMode = (pResult->HitRate1Way > pResult->HitRate2Ways) ? ICACHE_1WAY : ICACHE_2WAYS;
+
+    if (pResult->BestMode == ICACHE_1WAY)
+    {
+      status = ICACHE_RunWorkload(ICACHE_1WAY, NULL, NULL);
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/* Private functions ---------------------------------------------------------*/
+/** @defgroup ICACHE_Private_Functions ICACHE Private Functions
+  * @{
+  */
+
+/**
+  * @brief  Compute a hit rate.
+  * @param  Hits    Number of hits
+  * @param  Misses  Number of misses
+  * @retval Hit rate in per mille, 0 without any access
+  */
+static uint32_t ICACHE_HitRate(uint32_t Hits, uint32_t Misses)
+{
+  uint64_t accesses = (uint64_t)Hits + Misses;
+
+  return (accesses == 0U) ? 0U : (uint32_t)(((uint64_t)Hits * 1000U) / accesses);
+}
+
+/**
+  * @brief  Enable the Instruction Cache in a mode and measure the hit rate of a workload.
+  * @param  AssociativityMode  Associativity mode, a value of @ref ICACHE_WaysSelection
+  * @param  pWorkload  Pointer to the workload function, NULL to only set the mode
+  * @param  pHitRate   Pointer to the hit rate in per mille, not used without workload
+  * @retval HAL status (HAL_OK/HAL_ERROR/HAL_TIMEOUT)
+  */
+static HAL_StatusTypeDef ICACHE_RunWorkload(uint32_t AssociativityMode, void (*pWorkload)(void),
+                                            uint32_t *pHitRate)
+{
+  HAL_StatusTypeDef status;
+
+  /* The disable launches the invalidation, the mode is set once it is complete */
+  status = HAL_ICACHE_Disable();
+
+  if (status == HAL_OK)
+  {
+    status = HAL_ICACHE_WaitForInvalidateComplete();
+  }
+
+  if (status == HAL_OK)
+  {
+    status = HAL_ICACHE_ConfigAssociativityMode(AssociativityMode);
+  }
+
+  if (status == HAL_OK)
+  {
+    (void)HAL_ICACHE_Enable();
+
+    if (pWorkload != NULL)
+    {
+      (void)HAL_ICACHE_Monitor_Reset(ICACHE_MONITOR_HIT_MISS);
+      (void)HAL_ICACHE_Monitor_Start(ICACHE_MONITOR_HIT_MISS);
+
+      pWorkload();
+
+      (void)HAL_ICACHE_Monitor_Stop(ICACHE_MONITOR_HIT_MISS);
+      *pHitRate = ICACHE_HitRate(ICACHE->HMONR, ICACHE->MMONR);
+    }
+  }
+
+  return status;
+}
+
 /**
   * @}
   */
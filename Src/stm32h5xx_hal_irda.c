@@ -157,6 +157,10 @@
     (+) MspInitCallback           : IRDA MspInit.
     (+) MspDeInitCallback         : IRDA MspDeInit.
 
+    [..]
+    For specific callback RxEventCallback, use dedicated registration/reset functions:
+    respectively HAL_IRDA_RegisterRxEventCallback() , HAL_IRDA_UnRegisterRxEventCallback().
+
     [..]
     By default, after the HAL_IRDA_Init() and when the state is HAL_IRDA_STATE_RESET
     all callbacks are set to the corresponding weak functions:
@@ -259,6 +263,8 @@ static void IRDA_DMATxAbortCallback(DMA_HandleTypeDef *hdma);
 static void IRDA_DMARxAbortCallback(DMA_HandleTypeDef *hdma);
 static void IRDA_DMATxOnlyAbortCallback(DMA_HandleTypeDef *hdma);
 static void IRDA_DMARxOnlyAbortCallback(DMA_HandleTypeDef *hdma);
+static uint16_t IRDA_DMAReceivePosition(const IRDA_HandleTypeDef *hirda);
+static void IRDA_DMAReceiveIdle(IRDA_HandleTypeDef *hirda);
 #endif /* HAL_DMA_MODULE_ENABLED */
 static void IRDA_Transmit_IT(IRDA_HandleTypeDef *hirda);
 static void IRDA_EndTransmit_IT(IRDA_HandleTypeDef *hirda);
@@ -381,6 +387,8 @@ HAL_StatusTypeDef HAL_IRDA_Init(IRDA_HandleTypeDef *hirda)
   /* set the UART/USART in IRDA mode */
   hirda->Instance->CR3 |= USART_CR3_IREN;
 
+  hirda->ReceptionType = HAL_IRDA_RECEPTION_STANDARD;
+
   /* Enable the Peripheral */
   __HAL_IRDA_ENABLE(hirda);
 
@@ -695,6 +703,64 @@ HAL_StatusTypeDef HAL_IRDA_UnRegisterCallback(IRDA_HandleTypeDef *hirda, HAL_IRD
 
   return status;
 }
+
+/**
+  * @brief  Register a User IRDA Rx Event Callback
+  *         To be used instead of the weak predefined callback
+  * @param  hirda Pointer to a IRDA_HandleTypeDef structure that contains
+  *               the configuration information for the specified IRDA module.
+  * @param  pCallback pointer to the Rx Event Callback function
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_IRDA_RegisterRxEventCallback(IRDA_HandleTypeDef *hirda, pIRDA_RxEventCallbackTypeDef pCallback)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if (pCallback == NULL)
+  {
+    hirda->ErrorCode |= HAL_IRDA_ERROR_INVALID_CALLBACK;
+
+    return HAL_ERROR;
+  }
+
+  if (hirda->RxState == HAL_IRDA_STATE_READY)
+  {
+    hirda->RxEventCallback = pCallback;
+  }
+  else
+  {
+    hirda->ErrorCode |= HAL_IRDA_ERROR_INVALID_CALLBACK;
+
+    status =  HAL_ERROR;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  UnRegister the IRDA Rx Event Callback
+  *         IRDA Rx Event Callback is redirected to the weak HAL_IRDA_RxEventCallback() predefined callback
+  * @param  hirda Pointer to a IRDA_HandleTypeDef structure that contains
+  *               the configuration information for the specified IRDA module.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_IRDA_UnRegisterRxEventCallback(IRDA_HandleTypeDef *hirda)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if (hirda->RxState == HAL_IRDA_STATE_READY)
+  {
+    hirda->RxEventCallback = HAL_IRDA_RxEventCallback; /* Legacy weak IRDA Rx Event Callback  */
+  }
+  else
+  {
+    hirda->ErrorCode |= HAL_IRDA_ERROR_INVALID_CALLBACK;
+
+    status =  HAL_ERROR;
+  }
+
+  return status;
+}
 #endif /* USE_HAL_IRDA_REGISTER_CALLBACKS */
 
 /**
@@ -744,6 +810,7 @@ HAL_StatusTypeDef HAL_IRDA_UnRegisterCallback(IRDA_HandleTypeDef *hirda, HAL_IRD
     (#) Non Blocking mode functions with DMA are :
         (++) HAL_IRDA_Transmit_DMA()
         (++) HAL_IRDA_Receive_DMA()
+        (++) HAL_IRDA_ReceiveToIdle_DMA()
         (++) HAL_IRDA_DMAPause()
         (++) HAL_IRDA_DMAResume()
         (++) HAL_IRDA_DMAStop()
@@ -755,6 +822,11 @@ HAL_StatusTypeDef HAL_IRDA_UnRegisterCallback(IRDA_HandleTypeDef *hirda, HAL_IRD
         (++) HAL_IRDA_RxCpltCallback()
         (++) HAL_IRDA_ErrorCallback()
 
+    (#) Reception till IDLE event, HAL_IRDA_ReceiveToIdle_DMA(), reports through HAL_IRDA_RxEventCallback()
+        the position reached in the reception buffer at each IDLE line event (end of a frame) and
+        at half and full buffer DMA events. With a DMA channel in circular linked-list mode, variable-length
+        frames are received continuously without re-arming the reception.
+
     (#) Non-Blocking mode transfers could be aborted using Abort API's :
         (++) HAL_IRDA_Abort()
         (++) HAL_IRDA_AbortTransmit()
@@ -1037,6 +1109,7 @@ HAL_StatusTypeDef HAL_IRDA_Receive_IT(IRDA_HandleTypeDef *hirda, uint8_t *pData,
 
     hirda->pRxBuffPtr = pData;
     hirda->RxXferSize = Size;
+    hirda->ReceptionType = HAL_IRDA_RECEPTION_STANDARD;
     hirda->RxXferCount = Size;
 
     /* Computation of the mask to apply to the RDR register
@@ -1221,6 +1294,7 @@ HAL_StatusTypeDef HAL_IRDA_Receive_DMA(IRDA_HandleTypeDef *hirda, uint8_t *pData
 
     hirda->pRxBuffPtr = pData;
     hirda->RxXferSize = Size;
+    hirda->ReceptionType = HAL_IRDA_RECEPTION_STANDARD;
 
     hirda->ErrorCode = HAL_IRDA_ERROR_NONE;
     hirda->RxState = HAL_IRDA_STATE_BUSY_RX;
@@ -1314,6 +1388,38 @@ HAL_StatusTypeDef HAL_IRDA_Receive_DMA(IRDA_HandleTypeDef *hirda, uint8_t *pData
   }
 }
 
+/**
+  * @brief Receive data in DMA mode till either the expected number of data is received or an IDLE event occurs.
+  * @note  HAL_IRDA_RxEventCallback() is executed on IDLE event, on DMA half transfer and on DMA transfer
+  *        complete, with the position reached in the reception buffer.
+  * @note  When the Rx DMA channel is in circular linked-list mode, the reception never ends:
+  *        frames are delimited by the positions reported at each IDLE event and the buffer wraps around.
+  * @note  When UART parity is not enabled (PCE = 0), and Word Length is configured to 9 bits (M1-M0 = 01),
+  *        the received data is handled as a set of u16. In this case, Size must reflect the number
+  *        of u16 available through pData.
+  * @param hirda Pointer to a IRDA_HandleTypeDef structure that contains
+  *               the configuration information for the specified IRDA module.
+  * @param pData Pointer to data buffer (u8 or u16 data elements).
+  * @param Size Amount of data elements (u8 or u16) to be received.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_IRDA_ReceiveToIdle_DMA(IRDA_HandleTypeDef *hirda, uint8_t *pData, uint16_t Size)
+{
+  HAL_StatusTypeDef status;
+
+  status = HAL_IRDA_Receive_DMA(hirda, pData, Size);
+
+  if (status == HAL_OK)
+  {
+    hirda->ReceptionType = HAL_IRDA_RECEPTION_TOIDLE;
+
+    /* Start from a clean IDLE state, then enable the IDLE interrupt */
+    __HAL_IRDA_CLEAR_IDLEFLAG(hirda);
+    SET_BIT(hirda->Instance->CR1, USART_CR1_IDLEIE);
+  }
+
+  return status;
+}
 
 /**
   * @brief Pause the DMA Transfer.
@@ -1477,8 +1583,8 @@ HAL_StatusTypeDef HAL_IRDA_DMAStop(IRDA_HandleTypeDef *hirda)
   */
 HAL_StatusTypeDef HAL_IRDA_Abort(IRDA_HandleTypeDef *hirda)
 {
-  /* Disable TXEIE, TCIE, RXNE, PE and ERR (Frame error, noise error, overrun error) interrupts */
-  CLEAR_BIT(hirda->Instance->CR1, (USART_CR1_RXNEIE_RXFNEIE | USART_CR1_PEIE | \
+  /* Disable TXEIE, TCIE, RXNE, PE, IDLE and ERR (Frame error, noise error, overrun error) interrupts */
+  CLEAR_BIT(hirda->Instance->CR1, (USART_CR1_RXNEIE_RXFNEIE | USART_CR1_PEIE | USART_CR1_IDLEIE | \
                                    USART_CR1_TXEIE_TXFNFIE | USART_CR1_TCIE));
   CLEAR_BIT(hirda->Instance->CR3, USART_CR3_EIE);
 
@@ -1620,8 +1726,8 @@ HAL_StatusTypeDef HAL_IRDA_AbortTransmit(IRDA_HandleTypeDef *hirda)
   */
 HAL_StatusTypeDef HAL_IRDA_AbortReceive(IRDA_HandleTypeDef *hirda)
 {
-  /* Disable RXNE, PE and ERR (Frame error, noise error, overrun error) interrupts */
-  CLEAR_BIT(hirda->Instance->CR1, (USART_CR1_RXNEIE_RXFNEIE | USART_CR1_PEIE));
+  /* Disable RXNE, PE, IDLE and ERR (Frame error, noise error, overrun error) interrupts */
+  CLEAR_BIT(hirda->Instance->CR1, (USART_CR1_RXNEIE_RXFNEIE | USART_CR1_PEIE | USART_CR1_IDLEIE));
   CLEAR_BIT(hirda->Instance->CR3, USART_CR3_EIE);
 
 #if defined(HAL_DMA_MODULE_ENABLED)
@@ -1682,8 +1788,8 @@ HAL_StatusTypeDef HAL_IRDA_Abort_IT(IRDA_HandleTypeDef *hirda)
 {
   uint32_t abortcplt = 1U;
 
-  /* Disable TXEIE, TCIE, RXNE, PE and ERR (Frame error, noise error, overrun error) interrupts */
-  CLEAR_BIT(hirda->Instance->CR1, (USART_CR1_RXNEIE_RXFNEIE | USART_CR1_PEIE | \
+  /* Disable TXEIE, TCIE, RXNE, PE, IDLE and ERR (Frame error, noise error, overrun error) interrupts */
+  CLEAR_BIT(hirda->Instance->CR1, (USART_CR1_RXNEIE_RXFNEIE | USART_CR1_PEIE | USART_CR1_IDLEIE | \
                                    USART_CR1_TXEIE_TXFNFIE | USART_CR1_TCIE));
   CLEAR_BIT(hirda->Instance->CR3, USART_CR3_EIE);
 
@@ -1895,8 +2001,8 @@ HAL_StatusTypeDef HAL_IRDA_AbortTransmit_IT(IRDA_HandleTypeDef *hirda)
   */
 HAL_StatusTypeDef HAL_IRDA_AbortReceive_IT(IRDA_HandleTypeDef *hirda)
 {
-  /* Disable RXNE, PE and ERR (Frame error, noise error, overrun error) interrupts */
-  CLEAR_BIT(hirda->Instance->CR1, (USART_CR1_RXNEIE_RXFNEIE | USART_CR1_PEIE));
+  /* Disable RXNE, PE, IDLE and ERR (Frame error, noise error, overrun error) interrupts */
+  CLEAR_BIT(hirda->Instance->CR1, (USART_CR1_RXNEIE_RXFNEIE | USART_CR1_PEIE | USART_CR1_IDLEIE));
   CLEAR_BIT(hirda->Instance->CR3, USART_CR3_EIE);
 
 #if defined(HAL_DMA_MODULE_ENABLED)
@@ -2111,6 +2217,18 @@ void HAL_IRDA_IRQHandler(IRDA_HandleTypeDef *hirda)
 
   } /* End if some error occurs */
 
+#if defined(HAL_DMA_MODULE_ENABLED)
+  /* IRDA reception till IDLE event ------------------------------------------*/
+  if ((hirda->ReceptionType == HAL_IRDA_RECEPTION_TOIDLE)
+      && ((isrflags & USART_ISR_IDLE) != 0U)
+      && ((cr1its & USART_CR1_IDLEIE) != 0U))
+  {
+    __HAL_IRDA_CLEAR_IDLEFLAG(hirda);
+    IRDA_DMAReceiveIdle(hirda);
+    return;
+  }
+
+#endif /* HAL_DMA_MODULE_ENABLED */
   /* IRDA in mode Transmitter ------------------------------------------------*/
   if (((isrflags & USART_ISR_TXE_TXFNF) != 0U) && ((cr1its & USART_CR1_TXEIE_TXFNFIE) != 0U))
   {
@@ -2255,6 +2373,24 @@ __weak void HAL_IRDA_AbortReceiveCpltCallback(IRDA_HandleTypeDef *hirda)
    */
 }
 
+/**
+  * @brief  Reception Event Callback (Rx event notification called after use of advanced reception service).
+  * @param  hirda Pointer to a IRDA_HandleTypeDef structure that contains
+  *               the configuration information for the specified IRDA module.
+  * @param  Pos Position reached in the reception buffer (number of data elements received since its start)
+  * @retval None
+  */
+__weak void HAL_IRDA_RxEventCallback(IRDA_HandleTypeDef *hirda, uint16_t Pos)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hirda);
+  UNUSED(Pos);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_IRDA_RxEventCallback can be implemented in the user file.
+   */
+}
+
 /**
   * @}
   */
@@ -2335,6 +2471,7 @@ void IRDA_InitCallbacksToDefault(IRDA_HandleTypeDef *hirda)
   hirda->AbortCpltCallback         = HAL_IRDA_AbortCpltCallback;         /* Legacy weak AbortCpltCallback         */
   hirda->AbortTransmitCpltCallback = HAL_IRDA_AbortTransmitCpltCallback; /* Legacy weak AbortTransmitCpltCallback */
   hirda->AbortReceiveCpltCallback  = HAL_IRDA_AbortReceiveCpltCallback;  /* Legacy weak AbortReceiveCpltCallback  */
+  hirda->RxEventCallback           = HAL_IRDA_RxEventCallback;           /* Legacy weak RxEventCallback           */
 
 }
 #endif /* USE_HAL_IRDA_REGISTER_CALLBACKS */
@@ -2550,12 +2687,13 @@ static void IRDA_EndTxTransfer(IRDA_HandleTypeDef *hirda)
   */
 static void IRDA_EndRxTransfer(IRDA_HandleTypeDef *hirda)
 {
-  /* Disable RXNE, PE and ERR (Frame error, noise error, overrun error) interrupts */
-  CLEAR_BIT(hirda->Instance->CR1, (USART_CR1_RXNEIE_RXFNEIE | USART_CR1_PEIE));
+  /* Disable RXNE, PE, IDLE and ERR (Frame error, noise error, overrun error) interrupts */
+  CLEAR_BIT(hirda->Instance->CR1, (USART_CR1_RXNEIE_RXFNEIE | USART_CR1_PEIE | USART_CR1_IDLEIE));
   CLEAR_BIT(hirda->Instance->CR3, USART_CR3_EIE);
 
   /* At end of Rx process, restore hirda->RxState to Ready */
   hirda->RxState = HAL_IRDA_STATE_READY;
+  hirda->ReceptionType = HAL_IRDA_RECEPTION_STANDARD;
 }
 
 
@@ -2640,15 +2778,35 @@ static void IRDA_DMAReceiveCplt(DMA_HandleTypeDef *hdma)
 
     /* At end of Rx process, restore hirda->RxState to Ready */
     hirda->RxState = HAL_IRDA_STATE_READY;
+
+    /* If Reception till IDLE event has been selected, Disable IDLE Interrupt */
+    if (hirda->ReceptionType == HAL_IRDA_RECEPTION_TOIDLE)
+    {
+      CLEAR_BIT(hirda->Instance->CR1, USART_CR1_IDLEIE);
+    }
   }
 
+  if (hirda->ReceptionType == HAL_IRDA_RECEPTION_TOIDLE)
+  {
+    /* Buffer end reached: in circular mode the DMA counter is already reloaded */
+#if (USE_HAL_IRDA_REGISTER_CALLBACKS == 1)
+    /* Call registered Rx Event callback */
+    hirda->RxEventCallback(hirda, hirda->RxXferSize);
+#else
+    /* Call legacy weak Rx Event callback */
+    HAL_IRDA_RxEventCallback(hirda, hirda->RxXferSize);
+#endif /* USE_HAL_IRDA_REGISTER_CALLBACKS */
+  }
+  else
+  {
 #if (USE_HAL_IRDA_REGISTER_CALLBACKS == 1)
-  /* Call registered Rx complete callback */
-  hirda->RxCpltCallback(hirda);
+    /* Call registered Rx complete callback */
+    hirda->RxCpltCallback(hirda);
 #else
-  /* Call legacy weak Rx complete callback */
-  HAL_IRDA_RxCpltCallback(hirda);
+    /* Call legacy weak Rx complete callback */
+    HAL_IRDA_RxCpltCallback(hirda);
 #endif /* USE_HAL_IRDA_REGISTER_CALLBACKS */
+  }
 }
 
 /**
@@ -2661,13 +2819,90 @@ static void IRDA_DMAReceiveHalfCplt(DMA_HandleTypeDef *hdma)
 {
   IRDA_HandleTypeDef *hirda = (IRDA_HandleTypeDef *)(hdma->Parent);
 
+  if (hirda->ReceptionType == HAL_IRDA_RECEPTION_TOIDLE)
+  {
 #if (USE_HAL_IRDA_REGISTER_CALLBACKS == 1)
-  /*Call registered Rx Half complete callback*/
-  hirda->RxHalfCpltCallback(hirda);
+    /* Call registered Rx Event callback */
+    hirda->RxEventCallback(hirda, IRDA_DMAReceivePosition(hirda));
 #else
-  /* Call legacy weak Rx Half complete callback */
-  HAL_IRDA_RxHalfCpltCallback(hirda);
+    /* Call legacy weak Rx Event callback */
+    HAL_IRDA_RxEventCallback(hirda, IRDA_DMAReceivePosition(hirda));
+#endif /* USE_HAL_IRDA_REGISTER_CALLBACKS */
+  }
+  else
+  {
+#if (USE_HAL_IRDA_REGISTER_CALLBACKS == 1)
+    /*Call registered Rx Half complete callback*/
+    hirda->RxHalfCpltCallback(hirda);
+#else
+    /* Call legacy weak Rx Half complete callback */
+    HAL_IRDA_RxHalfCpltCallback(hirda);
 #endif /* USE_HAL_IRDA_REGISTER_CALLBACK */
+  }
+}
+
+/**
+  * @brief  Return the position reached by the DMA in the IRDA reception buffer.
+  * @param  hirda Pointer to a IRDA_HandleTypeDef structure that contains
+  *               the configuration information for the specified IRDA module.
+  * @retval Number of data elements (u8 or u16) received since the start of the buffer
+  */
+static uint16_t IRDA_DMAReceivePosition(const IRDA_HandleTypeDef *hirda)
+{
+  uint32_t remaining = __HAL_DMA_GET_COUNTER(hirda->hdmarx);
+
+  /* The DMA counts bytes, data elements are u16 in 9 bits/No Parity mode */
+  if ((hirda->Init.WordLength == IRDA_WORDLENGTH_9B) && (hirda->Init.Parity == IRDA_PARITY_NONE))
+  {
+    remaining /= 2U;
+  }
+
+  return (uint16_t)(hirda->RxXferSize - (uint16_t)remaining);
+}
+
+/**
+  * @brief  Handle an IDLE line event during a reception till IDLE event.
+  * @param  hirda Pointer to a IRDA_HandleTypeDef structure that contains
+  *               the configuration information for the specified IRDA module.
+  * @retval None
+  */
+static void IRDA_DMAReceiveIdle(IRDA_HandleTypeDef *hirda)
+{
+  uint16_t pos = IRDA_DMAReceivePosition(hirda);
+
+  if ((pos == 0U) || (pos == hirda->RxXferSize))
+  {
+    /* Frame ended exactly at the buffer end: already reported by the DMA complete callback */
+    return;
+  }
+
+  /* In Normal mode, end DMA xfer and HAL IRDA Rx process */
+  if (hirda->hdmarx->Mode != DMA_LINKEDLIST_CIRCULAR)
+  {
+    hirda->RxXferCount = (uint16_t)(hirda->RxXferSize - pos);
+
+    /* Disable PE, IDLE and ERR (Frame error, noise error, overrun error) interrupts */
+    CLEAR_BIT(hirda->Instance->CR1, (USART_CR1_PEIE | USART_CR1_IDLEIE));
+    CLEAR_BIT(hirda->Instance->CR3, USART_CR3_EIE);
+
+    /* Disable the DMA transfer for the receiver request by resetting the DMAR bit
+       in the IRDA CR3 register */
+    CLEAR_BIT(hirda->Instance->CR3, USART_CR3_DMAR);
+
+    /* At end of Rx process, restore hirda->RxState to Ready */
+    hirda->RxState = HAL_IRDA_STATE_READY;
+
+    /* Last bytes received, so no need as the abort is immediate */
+    (void)HAL_DMA_Abort(hirda->hdmarx);
+  }
+
+#if (USE_HAL_IRDA_REGISTER_CALLBACKS == 1)
+  /* Call registered Rx Event callback */
+  hirda->RxEventCallback(hirda, pos);
+#else
+  /* Call legacy weak Rx Event callback */
+  HAL_IRDA_RxEventCallback(hirda, pos);
+#endif /* USE_HAL_IRDA_REGISTER_CALLBACKS */
 }
 
 /**
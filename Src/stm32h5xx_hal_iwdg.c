@@ -99,6 +99,13 @@
         intervals during normal operation to prevent an MCU reset, using
         HAL_IWDG_Refresh() function.
 
+    (#) To supervise several tasks, fill an IWDG_SupervisorTypeDef structure with
+        the deadline of each task and call HAL_IWDG_Supervisor_Start(). Each task
+        calls HAL_IWDG_Supervisor_CheckIn() when it makes progress, a lock-free
+        bit set. HAL_IWDG_Supervisor_Process(), called periodically instead of
+        HAL_IWDG_Refresh(), refreshes the IWDG only while all the tasks check in
+        within their deadline.
+
      *** IWDG HAL driver macros list ***
      ====================================
      [..]
@@ -492,6 +499,122 @@ __weak void HAL_IWDG_EarlyWakeupCallback(IWDG_HandleTypeDef *hiwdg)
 }
 
 
+/**
+  * @}
+  */
+
+/** @addtogroup IWDG_Exported_Functions_Group3
+  *  @brief   Task supervision functions
+  *
+@verbatim
+ ===============================================================================
+                      ##### Task supervision functions #####
+ ===============================================================================
+ [..]  This section provides functions allowing to:
+      (+) Start the task supervisor.
+      (+) Check a task in.
+      (+) Refresh the IWDG when all the tasks are alive.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Start the IWDG task supervisor.
+  * @note   The deadlines start from the call of this function.
+  * @param  pSupervisor  pointer to a IWDG_SupervisorTypeDef structure with the
+  *                      number of tasks and their deadlines.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_IWDG_Supervisor_Start(IWDG_SupervisorTypeDef *pSupervisor)
+{
+  uint32_t tickstart;
+  uint32_t task;
+
+  if ((pSupervisor == NULL) || (pSupervisor->TaskNb == 0U) || (pSupervisor->TaskNb > IWDG_SUPERVISOR_MAX_TASKS))
+  {
+    return HAL_ERROR;
+  }
+
+  tickstart = HAL_GetTick();
+  for (task = 0U; task < pSupervisor->TaskNb; task++)
+  {
+    pSupervisor->LastCheckIn[task] = tickstart;
+  }
+  pSupervisor->CheckInMask = 0U;
+  pSupervisor->FaultMask = 0U;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Report the progress of a supervised task.
+  * @note   This function is lock-free and can be called from any task or
+  *         interrupt context, it only sets the task bit atomically.
+  * @param  pSupervisor  pointer to a IWDG_SupervisorTypeDef structure.
+  * @param  TaskId  task index, from 0 to TaskNb - 1.
+  * @retval None
+  */
+void HAL_IWDG_Supervisor_CheckIn(IWDG_SupervisorTypeDef *pSupervisor, uint32_t TaskId)
+{
+  /* Check the parameters */
+  assert_param(TaskId < pSupervisor->TaskNb);
+
+  ATOMIC_SET_BIT(pSupervisor->CheckInMask, (1UL << TaskId));
+}
+
+/**
+  * @brief  Supervise the tasks and refresh the IWDG when all of them are alive.
+  * @note   This function must be called from a single context at a period
+  *         shorter than the IWDG timeout (and within the window when the
+  *         window option is used), e.g. from a periodic timer.
+  * @note   A task missing its deadline is latched in FaultMask: the IWDG is not
+  *         refreshed any more and the device is reset at the IWDG timeout, the
+  *         early wakeup interrupt being available to log the faulty tasks.
+  * @param  hiwdg  pointer to a IWDG_HandleTypeDef structure that contains
+  *                the configuration information for the specified IWDG module.
+  * @param  pSupervisor  pointer to a IWDG_SupervisorTypeDef structure.
+  * @retval HAL status, HAL_ERROR when a task missed its deadline.
+  */
+HAL_StatusTypeDef HAL_IWDG_Supervisor_Process(IWDG_HandleTypeDef *hiwdg, IWDG_SupervisorTypeDef *pSupervisor)
+{
+  uint32_t tickcurrent = HAL_GetTick();
+  uint32_t checkin;
+  uint32_t task;
+
+  /* Fetch and clear the check-ins without masking the interrupts */
+  do
+  {
+    checkin = __LDREXW(&pSupervisor->CheckInMask);
+  } while (__STREXW(0U, &pSupervisor->CheckInMask) != 0U);
+
+  for (task = 0U; task < pSupervisor->TaskNb; task++)
+  {
+    if ((checkin & (1UL << task)) != 0U)
+    {
+      pSupervisor->LastCheckIn[task] = tickcurrent;
+    }
+    else if ((tickcurrent - pSupervisor->LastCheckIn[task]) > pSupervisor->Deadline[task])
+    {
+      pSupervisor->FaultMask |= (1UL << task);
+    }
+    else
+    {
+      /* Task within its deadline */
+    }
+  }
+
+  if (pSupervisor->FaultMask != 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Reload IWDG counter with value defined in the reload register */
+  __HAL_IWDG_RELOAD_COUNTER(hiwdg);
+
+  return HAL_OK;
+}
+
 /**
   * @}
   */
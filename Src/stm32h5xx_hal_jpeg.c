@@ -141,6 +141,48 @@
 
       (#) To control JPEG state you can use the following function: HAL_JPEG_GetState()
 
+     *** JPEG streaming decode pipeline ***
+     =============================================
+     [..]
+       When the DMA2D module is enabled (and not in command list mode), a compressed stream
+       can be decoded straight to an RGB frame buffer while it is still being received:
+      (+) Fill a JPEG_PipelineTypeDef with the input ring, the MCU chunks (at least two,
+          ChunkSize multiple of the MCU size, 768 bytes fits all subsamplings), the initialized
+          DMA2D handle, the frame buffer and the completion callback, then call
+          HAL_JPEG_Pipeline_Init().
+      (+) Write the first compressed bytes with HAL_JPEG_Pipeline_WriteInput() and call
+          HAL_JPEG_Pipeline_Start(). Keep writing as data arrives and call
+          HAL_JPEG_Pipeline_EndOfInput() after the last byte.
+      (+) The codec decodes with DMA into one chunk while the DMA2D converts the previous
+          ones from YCbCr to the frame buffer color mode. Input and output are paused and
+          resumed automatically when the ring runs dry or all chunks wait for conversion.
+      (+) The pipeline CpltCallback is called with HAL_OK when the last MCU is in the frame
+          buffer, or with HAL_ERROR (unsupported image, DMA2D error): in that case call
+          HAL_JPEG_Pipeline_Abort().
+      (+) While attached, the pipeline consumes the InfoReady, GetData and DataReady events
+          and takes over the DMA2D transfer callbacks: call HAL_JPEG_Pipeline_DeInit() to
+          go back to the user callbacks.
+      (+) Only YCbCr images are supported. The frame buffer pitch must cover the image width
+          rounded up to the MCU width, and the image height is rounded up to the MCU height.
+
+     *** JPEG linear frame encode source ***
+     =============================================
+     [..]
+       With the same DMA2D condition, a linear RGB frame (camera or frame buffer) can be
+       encoded without a prior full frame MCU reordering pass:
+      (+) Configure the encoding with HAL_JPEG_ConfigEncoding() (YCbCr or gray-scale).
+      (+) Fill a JPEG_EncodeSourceTypeDef with the initialized DMA2D handle, the source frame
+          address, pitch and color mode, a strip buffer of one MCU row of ARGB8888 pixels and
+          two MCU row buffers, then call HAL_JPEG_EncodeSource_Init().
+      (+) Call HAL_JPEG_EncodeSource_Start() with the output buffer. The DMA2D fetches and
+          converts each MCU row strip to ARGB8888, the strip is reordered into MCUs and the
+          codec encodes one MCU row while the next one is prepared.
+      (+) The output data and the end of encoding are reported by HAL_JPEG_DataReadyCallback()
+          and HAL_JPEG_EncodeCpltCallback() as for HAL_JPEG_Encode_DMA(), a strip fetch error
+          by HAL_JPEG_ErrorCallback() with HAL_JPEG_ERROR_DMA.
+      (+) The DMA2D has no YCbCr output: the RGB to YCbCr step stays on the CPU, fused with the
+          MCU reordering of each strip held in internal memory.
+
      *** JPEG HAL driver macros list ***
      =============================================
      [..]
@@ -438,6 +480,15 @@ static const uint8_t JPEG_ZIGZAG_ORDER[JPEG_QUANT_TABLE_SIZE] =
   58,  59,  52,  45,  38,  31,  39,  46,
   53,  60,  61,  54,  47,  55,  62,  63
 };
+#if defined(HAL_DMA2D_MODULE_ENABLED) && (USE_DMA2D_COMMAND_LIST_MODE == 0U)
+
+/* The DMA2D handle has no parent field: this is the JPEG handle owning the DMA2D conversion
+   of the running pipeline (single JPEG instance on this device) */
+static JPEG_HandleTypeDef *JPEG_PipelineHandle = NULL;
+
+/* JPEG handle owning the DMA2D strip fetch of the running encode source */
+static JPEG_HandleTypeDef *JPEG_EncodeSourceHandle = NULL;
+#endif /* HAL_DMA2D_MODULE_ENABLED && USE_DMA2D_COMMAND_LIST_MODE == 0U */
 /**
   * @}
   */
@@ -480,6 +531,28 @@ static void JPEG_DMAInCpltCallback(DMA_HandleTypeDef *hdma);
 static void JPEG_DMAErrorCallback(DMA_HandleTypeDef *hdma);
 static void JPEG_DMAOutAbortCallback(DMA_HandleTypeDef *hdma)  ;
 
+static void JPEG_InfoReadyEvent(JPEG_HandleTypeDef *hjpeg);
+static void JPEG_GetDataEvent(JPEG_HandleTypeDef *hjpeg, uint32_t NbDecodedData);
+static void JPEG_DataReadyEvent(JPEG_HandleTypeDef *hjpeg, uint8_t *pDataOut, uint32_t OutDataLength);
+#if defined(HAL_DMA2D_MODULE_ENABLED) && (USE_DMA2D_COMMAND_LIST_MODE == 0U)
+static uint32_t JPEG_Pipeline_NextInput(const JPEG_PipelineTypeDef *pPipeline, uint8_t **pInput);
+static void JPEG_Pipeline_InfoReady(JPEG_HandleTypeDef *hjpeg);
+static void JPEG_Pipeline_GetData(JPEG_HandleTypeDef *hjpeg, uint32_t NbDecodedData);
+static void JPEG_Pipeline_DataReady(JPEG_HandleTypeDef *hjpeg);
+static void JPEG_Pipeline_Convert(JPEG_HandleTypeDef *hjpeg);
+static void JPEG_Pipeline_Error(JPEG_HandleTypeDef *hjpeg);
+static void JPEG_Pipeline_DMA2DCpltCallback(DMA2D_HandleTypeDef *hdma2d);
+static void JPEG_Pipeline_DMA2DErrorCallback(DMA2D_HandleTypeDef *hdma2d);
+static uint32_t JPEG_EncodeSource_Lines(const JPEG_HandleTypeDef *hjpeg, uint32_t Row);
+static void JPEG_EncodeSource_Fetch(JPEG_HandleTypeDef *hjpeg);
+static void JPEG_EncodeSource_Convert(const JPEG_HandleTypeDef *hjpeg, uint32_t Lines);
+static void JPEG_EncodeSource_Service(JPEG_HandleTypeDef *hjpeg);
+static void JPEG_EncodeSource_GetData(JPEG_HandleTypeDef *hjpeg, uint32_t NbDecodedData);
+static void JPEG_EncodeSource_Error(JPEG_HandleTypeDef *hjpeg);
+static void JPEG_EncodeSource_DMA2DCpltCallback(DMA2D_HandleTypeDef *hdma2d);
+static void JPEG_EncodeSource_DMA2DErrorCallback(DMA2D_HandleTypeDef *hdma2d);
+#endif /* HAL_DMA2D_MODULE_ENABLED && USE_DMA2D_COMMAND_LIST_MODE == 0U */
+
 /**
   * @}
   */
@@ -626,6 +699,12 @@ HAL_StatusTypeDef HAL_JPEG_Init(JPEG_HandleTypeDef *hjpeg)
   /* Clear the context fields */
   hjpeg->Context = 0;
 
+#if defined(HAL_DMA2D_MODULE_ENABLED) && (USE_DMA2D_COMMAND_LIST_MODE == 0U)
+  /* No streaming pipeline nor encode source attached */
+  hjpeg->pPipeline = NULL;
+  hjpeg->pEncodeSource = NULL;
+#endif /* HAL_DMA2D_MODULE_ENABLED && USE_DMA2D_COMMAND_LIST_MODE == 0U */
+
   /* Return function status */
   return HAL_OK;
 }
@@ -1532,6 +1611,16 @@ HAL_StatusTypeDef  HAL_JPEG_SetUserQuantTables(JPEG_HandleTypeDef *hjpeg, uint8_
       (+) HAL_JPEG_ConfigInputBuffer()  : Config Encoding/Decoding Input Buffer
       (+) HAL_JPEG_ConfigOutputBuffer() : Config Encoding/Decoding Output Buffer
       (+) HAL_JPEG_Abort()              : Aborts the JPEG Encoding/Decoding
+      (+) HAL_JPEG_Pipeline_Init()       : Attach a streaming decode pipeline (DMA2D module enabled)
+      (+) HAL_JPEG_Pipeline_WriteInput() : Write compressed data to the pipeline input ring
+      (+) HAL_JPEG_Pipeline_EndOfInput() : Signal the end of the compressed stream
+      (+) HAL_JPEG_Pipeline_Start()      : Start the streaming decode to the frame buffer
+      (+) HAL_JPEG_Pipeline_Abort()      : Abort the streaming decode
+      (+) HAL_JPEG_Pipeline_DeInit()     : Detach the streaming decode pipeline
+      (+) HAL_JPEG_EncodeSource_Init()   : Attach a linear frame encode source (DMA2D module enabled)
+      (+) HAL_JPEG_EncodeSource_Start()  : Start the encoding of the linear frame
+      (+) HAL_JPEG_EncodeSource_Abort()  : Abort the encoding of the linear frame
+      (+) HAL_JPEG_EncodeSource_DeInit() : Detach the linear frame encode source
 
 @endverbatim
   * @{
@@ -2302,1093 +2391,2009 @@ HAL_StatusTypeDef HAL_JPEG_Abort(JPEG_HandleTypeDef *hjpeg)
 }
 
 
+#if defined(HAL_DMA2D_MODULE_ENABLED) && (USE_DMA2D_COMMAND_LIST_MODE == 0U)
 /**
-  * @}
-  */
-
-/** @defgroup JPEG_Exported_Functions_Group4 JPEG Decode/Encode callback functions
-  *  @brief   JPEG process callback functions.
-  *
-@verbatim
-  ==============================================================================
-              #####  JPEG Decode and Encode callback functions  #####
-  ==============================================================================
-    [..]  This section provides callback functions:
-      (+) HAL_JPEG_InfoReadyCallback()  : Decoding JPEG Info ready callback
-      (+) HAL_JPEG_EncodeCpltCallback() : Encoding complete callback.
-      (+) HAL_JPEG_DecodeCpltCallback() : Decoding complete callback.
-      (+) HAL_JPEG_ErrorCallback()      : JPEG error callback.
-      (+) HAL_JPEG_GetDataCallback()    : Get New Data chunk callback.
-      (+) HAL_JPEG_DataReadyCallback()  : Decoded/Encoded Data ready  callback.
-
-@endverbatim
-  * @{
-  */
-
-/**
-  * @brief  Decoding JPEG Info ready callback.
+  * @brief  Attach a streaming decode pipeline to the JPEG handle.
+  * @note   The pipeline decodes a JPEG stream written chunk by chunk in the input ring
+  *         and converts each decoded MCU chunk to RGB with the DMA2D straight into the
+  *         frame buffer while the codec fills the next chunk. Only DMA decoding of
+  *         YCbCr images is supported.
+  * @note   Once attached, the pipeline consumes the InfoReady, GetData and DataReady
+  *         events: the corresponding user callbacks are no longer called.
   * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
   *         the configuration information for JPEG module
-  * @param  pInfo pointer to a JPEG_ConfTypeDef structure that contains
-  *         The JPEG decoded header information
-  * @retval None
+  * @param  pPipeline pointer to a user JPEG_PipelineTypeDef structure, its configuration
+  *         fields (ring, chunks, DMA2D handle, frame buffer, callback) must be set
+  * @retval HAL status
   */
-__weak void HAL_JPEG_InfoReadyCallback(JPEG_HandleTypeDef *hjpeg, JPEG_ConfTypeDef *pInfo)
+HAL_StatusTypeDef HAL_JPEG_Pipeline_Init(JPEG_HandleTypeDef *hjpeg, JPEG_PipelineTypeDef *pPipeline)
 {
-  /* Prevent unused argument(s) compilation warning */
-  UNUSED(hjpeg);
-  UNUSED(pInfo);
+  /* Check the pipeline configuration */
+  if ((pPipeline == NULL) || (pPipeline->pInRing == NULL) || (pPipeline->pOutChunks == NULL) ||
+      (pPipeline->hdma2d == NULL))
+  {
+    return HAL_ERROR;
+  }
+  if (((pPipeline->InRingSize % 4UL) != 0UL) || (pPipeline->InChunkSize < 4UL) ||
+      ((pPipeline->InChunkSize % 4UL) != 0UL) || (pPipeline->InChunkSize > pPipeline->InRingSize) ||
+      (pPipeline->ChunkCount < 2UL) || (pPipeline->ChunkSize == 0UL) || ((pPipeline->ChunkSize % 4UL) != 0UL))
+  {
+    return HAL_ERROR;
+  }
 
-  /* NOTE : This function Should not be modified, when the callback is needed,
-            the HAL_JPEG_HeaderParsingCpltCallback could be implemented in the user file
-   */
+  if (pPipeline->OutputColorMode == DMA2D_OUTPUT_ARGB8888)
+  {
+    pPipeline->BytesPerPixel = 4UL;
+  }
+  else if (pPipeline->OutputColorMode == DMA2D_OUTPUT_RGB565)
+  {
+    pPipeline->BytesPerPixel = 2UL;
+  }
+  else
+  {
+    return HAL_ERROR;
+  }
+
+  if ((hjpeg->State != HAL_JPEG_STATE_READY) || (hjpeg->pEncodeSource != NULL))
+  {
+    return HAL_BUSY;
+  }
+
+  pPipeline->InHead       = 0UL;
+  pPipeline->InTail       = 0UL;
+  pPipeline->InEnd        = 0UL;
+  pPipeline->InPaused     = 0UL;
+  pPipeline->FillIndex    = 0UL;
+  pPipeline->ConvertIndex = 0UL;
+  pPipeline->OutPaused    = 0UL;
+  pPipeline->Converting   = 0UL;
+  pPipeline->TotalMcus    = 0UL;
+  pPipeline->McuIndex     = 0UL;
+  pPipeline->ChunkMcu     = 0UL;
+  pPipeline->SegmentMcus  = 0UL;
+
+  hjpeg->pPipeline = pPipeline;
+
+  return HAL_OK;
 }
 
 /**
-  * @brief  Encoding complete callback.
+  * @brief  Write compressed data to the input ring of the pipeline.
+  * @note   May be called before HAL_JPEG_Pipeline_Start() to prefill the ring and at any
+  *         time while decoding: a codec input paused for lack of data is resumed.
   * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
   *         the configuration information for JPEG module
-  * @retval None
+  * @param  pData pointer to the compressed data
+  * @param  Size number of bytes to write
+  * @param  pWritten receives the number of bytes actually written, less than Size
+  *         when the ring is full
+  * @retval HAL status
   */
-__weak void HAL_JPEG_EncodeCpltCallback(JPEG_HandleTypeDef *hjpeg)
+HAL_StatusTypeDef HAL_JPEG_Pipeline_WriteInput(JPEG_HandleTypeDef *hjpeg, const uint8_t *pData, uint32_t Size,
+                                               uint32_t *pWritten)
 {
-  /* Prevent unused argument(s) compilation warning */
-  UNUSED(hjpeg);
+  JPEG_PipelineTypeDef *pipe = hjpeg->pPipeline;
+  uint8_t *pInput;
+  uint32_t length;
+  uint32_t count;
+  uint32_t offset;
+  uint32_t primask_bit;
 
-  /* NOTE : This function Should not be modified, when the callback is needed,
-            the HAL_JPEG_EncodeCpltCallback could be implemented in the user file
-   */
+  if ((pipe == NULL) || (pData == NULL) || (pWritten == NULL) || (pipe->InEnd != 0UL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Only the writer moves InHead: the free space can only grow while copying */
+  count = pipe->InRingSize - (pipe->InHead - pipe->InTail);
+  if (count > Size)
+  {
+    count = Size;
+  }
+  for (length = 0UL; length < count; length++)
+  {
+    offset = (pipe->InHead + length) % pipe->InRingSize;
+    pipe->pInRing[offset] = pData[length];
+  }
+  pipe->InHead += count;
+  *pWritten = count;
+
+  /* Feed the codec again if it starved */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+  if (pipe->InPaused != 0UL)
+  {
+    length = JPEG_Pipeline_NextInput(pipe, &pInput);
+    if (length != 0UL)
+    {
+      pipe->InPaused = 0UL;
+      HAL_JPEG_ConfigInputBuffer(hjpeg, pInput, length);
+      (void)HAL_JPEG_Resume(hjpeg, JPEG_PAUSE_RESUME_INPUT);
+    }
+  }
+  __set_PRIMASK(primask_bit);
+
+  return HAL_OK;
 }
 
 /**
-  * @brief  Decoding complete callback.
+  * @brief  Signal that the whole compressed stream has been written to the input ring.
+  * @note   The last bytes of the stream, not multiple of 4, are only handed to the
+  *         codec once the end of input is signaled.
   * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
   *         the configuration information for JPEG module
-  * @retval None
+  * @retval HAL status
   */
-__weak void HAL_JPEG_DecodeCpltCallback(JPEG_HandleTypeDef *hjpeg)
+HAL_StatusTypeDef HAL_JPEG_Pipeline_EndOfInput(JPEG_HandleTypeDef *hjpeg)
 {
-  /* Prevent unused argument(s) compilation warning */
-  UNUSED(hjpeg);
+  JPEG_PipelineTypeDef *pipe = hjpeg->pPipeline;
+  uint8_t *pInput;
+  uint32_t length;
+  uint32_t primask_bit;
 
-  /* NOTE : This function Should not be modified, when the callback is needed,
-            the HAL_JPEG_EncodeCpltCallback could be implemented in the user file
-   */
+  if (pipe == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+  pipe->InEnd = 1UL;
+  if (pipe->InPaused != 0UL)
+  {
+    length = JPEG_Pipeline_NextInput(pipe, &pInput);
+    if (length != 0UL)
+    {
+      pipe->InPaused = 0UL;
+      HAL_JPEG_ConfigInputBuffer(hjpeg, pInput, length);
+      (void)HAL_JPEG_Resume(hjpeg, JPEG_PAUSE_RESUME_INPUT);
+    }
+  }
+  __set_PRIMASK(primask_bit);
+
+  return HAL_OK;
 }
 
 /**
-  * @brief  JPEG error callback.
+  * @brief  Start the streaming decode of the attached pipeline.
+  * @note   At least 4 bytes of compressed data must have been written to the input ring.
+  *         The DMA2D transfer callbacks are taken over until the pipeline completes.
   * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
   *         the configuration information for JPEG module
-  * @retval None
+  * @retval HAL status
   */
-__weak void HAL_JPEG_ErrorCallback(JPEG_HandleTypeDef *hjpeg)
+HAL_StatusTypeDef HAL_JPEG_Pipeline_Start(JPEG_HandleTypeDef *hjpeg)
 {
-  /* Prevent unused argument(s) compilation warning */
-  UNUSED(hjpeg);
+  JPEG_PipelineTypeDef *pipe = hjpeg->pPipeline;
+  uint8_t *pInput;
+  uint32_t length;
 
-  /* NOTE : This function Should not be modified, when the callback is needed,
-            the HAL_JPEG_ErrorCallback could be implemented in the user file
-   */
+  if (pipe == NULL)
+  {
+    return HAL_ERROR;
+  }
+  if (JPEG_PipelineHandle != NULL)
+  {
+    return HAL_BUSY;
+  }
+
+  length = JPEG_Pipeline_NextInput(pipe, &pInput);
+  if (length < 4UL)
+  {
+    return HAL_ERROR;
+  }
+
+  pipe->hdma2d->XferCpltCallback  = JPEG_Pipeline_DMA2DCpltCallback;
+  pipe->hdma2d->XferErrorCallback = JPEG_Pipeline_DMA2DErrorCallback;
+  JPEG_PipelineHandle = hjpeg;
+
+  if (HAL_JPEG_Decode_DMA(hjpeg, pInput, length, pipe->pOutChunks, pipe->ChunkSize) != HAL_OK)
+  {
+    JPEG_PipelineHandle = NULL;
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
 }
 
 /**
-  * @brief  Get New Data chunk callback.
+  * @brief  Abort the streaming decode of the attached pipeline.
+  * @note   The codec and the DMA2D conversion are stopped, the pipeline
+  *         completion callback is not called.
   * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
   *         the configuration information for JPEG module
-  * @param  NbDecodedData Number of consumed data in the previous chunk in bytes
-  * @retval None
+  * @retval HAL status
   */
-__weak void HAL_JPEG_GetDataCallback(JPEG_HandleTypeDef *hjpeg, uint32_t NbDecodedData)
+HAL_StatusTypeDef HAL_JPEG_Pipeline_Abort(JPEG_HandleTypeDef *hjpeg)
 {
-  /* Prevent unused argument(s) compilation warning */
-  UNUSED(hjpeg);
-  UNUSED(NbDecodedData);
+  JPEG_PipelineTypeDef *pipe = hjpeg->pPipeline;
+  HAL_StatusTypeDef status;
 
-  /* NOTE : This function Should not be modified, when the callback is needed,
-            the HAL_JPEG_GetDataCallback could be implemented in the user file
-   */
+  if (pipe == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  JPEG_PipelineHandle = NULL;
+  status = HAL_JPEG_Abort(hjpeg);
+  if (pipe->Converting != 0UL)
+  {
+    if (HAL_DMA2D_Abort(pipe->hdma2d) != HAL_OK)
+    {
+      status = HAL_ERROR;
+    }
+    pipe->Converting = 0UL;
+  }
+  pipe->InPaused = 0UL;
+  pipe->OutPaused = 0UL;
+
+  return status;
 }
 
 /**
-  * @brief  Decoded/Encoded Data ready  callback.
+  * @brief  Detach the streaming decode pipeline from the JPEG handle.
   * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
   *         the configuration information for JPEG module
-  * @param  pDataOut pointer to the output data buffer
-  * @param  OutDataLength number in bytes of data available in the specified output buffer
-  * @retval None
+  * @retval HAL status
   */
-__weak void HAL_JPEG_DataReadyCallback(JPEG_HandleTypeDef *hjpeg, uint8_t *pDataOut, uint32_t OutDataLength)
+HAL_StatusTypeDef HAL_JPEG_Pipeline_DeInit(JPEG_HandleTypeDef *hjpeg)
 {
-  /* Prevent unused argument(s) compilation warning */
-  UNUSED(hjpeg);
-  UNUSED(pDataOut);
-  UNUSED(OutDataLength);
-
-  /* NOTE : This function Should not be modified, when the callback is needed,
-            the HAL_JPEG_DataReadyCallback could be implemented in the user file
-   */
-}
-
-/**
-  * @}
-  */
-
+  if ((hjpeg->State == HAL_JPEG_STATE_BUSY_DECODING) || (JPEG_PipelineHandle == hjpeg))
+  {
+    return HAL_BUSY;
+  }
 
-/** @defgroup JPEG_Exported_Functions_Group5 JPEG IRQ handler management
-  *  @brief   JPEG IRQ handler.
-  *
-@verbatim
-  ==============================================================================
-                ##### JPEG IRQ handler management #####
-  ==============================================================================
-    [..]  This section provides JPEG IRQ handler function.
-      (+) HAL_JPEG_IRQHandler()  : handles JPEG interrupt request
+  hjpeg->pPipeline = NULL;
 
-@endverbatim
-  * @{
-  */
+  return HAL_OK;
+}
 
 /**
-  * @brief  This function handles JPEG interrupt request.
+  * @brief  Attach a linear frame encode source to the JPEG handle.
+  * @note   The encode source feeds HAL_JPEG_Encode_DMA() with MCU ordered data built on
+  *         the fly from a linear RGB frame: the DMA2D fetches each MCU row strip of the
+  *         frame converted to ARGB8888 while the previous strip is reordered into YCbCr
+  *         (or gray-scale) MCUs and consumed by the codec.
+  * @note   Once attached, the encode source consumes the GetData events: the
+  *         corresponding user callback is no longer called.
   * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
   *         the configuration information for JPEG module
-  * @retval None
+  * @param  pSource pointer to a user JPEG_EncodeSourceTypeDef structure, its configuration
+  *         fields (DMA2D handle, frame, color mode, strip and MCU row buffers) must be set
+  * @retval HAL status
   */
-void HAL_JPEG_IRQHandler(JPEG_HandleTypeDef *hjpeg)
+HAL_StatusTypeDef HAL_JPEG_EncodeSource_Init(JPEG_HandleTypeDef *hjpeg, JPEG_EncodeSourceTypeDef *pSource)
 {
-  switch (hjpeg->State)
+  /* Check the encode source configuration */
+  if ((pSource == NULL) || (pSource->hdma2d == NULL) || (pSource->pStrip == NULL) || (pSource->pMcuRows == NULL))
   {
-    case HAL_JPEG_STATE_BUSY_ENCODING:
-    case HAL_JPEG_STATE_BUSY_DECODING:
-      /* continue JPEG data encoding/Decoding*/
-      /* JPEG data processing : In/Out FIFO transfer*/
-      if ((hjpeg->Context & JPEG_CONTEXT_METHOD_MASK) == JPEG_CONTEXT_IT)
-      {
-        (void) JPEG_Process(hjpeg);
-      }
-      else if ((hjpeg->Context & JPEG_CONTEXT_METHOD_MASK) == JPEG_CONTEXT_DMA)
-      {
-        JPEG_DMA_ContinueProcess(hjpeg);
-      }
-      else
-      {
-        /* Nothing to do */
-      }
-      break;
+    return HAL_ERROR;
+  }
 
-    default:
-      break;
+  if (pSource->InputColorMode == DMA2D_INPUT_ARGB8888)
+  {
+    pSource->BytesPerPixel = 4UL;
+  }
+  else if (pSource->InputColorMode == DMA2D_INPUT_RGB888)
+  {
+    pSource->BytesPerPixel = 3UL;
+  }
+  else if ((pSource->InputColorMode == DMA2D_INPUT_RGB565) || (pSource->InputColorMode == DMA2D_INPUT_ARGB1555) ||
+           (pSource->InputColorMode == DMA2D_INPUT_ARGB4444))
+  {
+    pSource->BytesPerPixel = 2UL;
+  }
+  else
+  {
+    return HAL_ERROR;
   }
-}
 
-/**
-  * @}
-  */
+  if ((hjpeg->State != HAL_JPEG_STATE_READY) || (hjpeg->pPipeline != NULL))
+  {
+    return HAL_BUSY;
+  }
 
-/** @defgroup JPEG_Exported_Functions_Group6 Peripheral State functions
-  *  @brief   Peripheral State functions.
-  *
-@verbatim
-  ==============================================================================
-                    ##### Peripheral State and Error functions #####
-  ==============================================================================
-    [..]  This section provides JPEG State and Errors function.
-      (+) HAL_JPEG_GetState()  : permits to get in run-time the JPEG state.
-      (+) HAL_JPEG_GetError()  : Returns the JPEG error code if any.
+  hjpeg->pEncodeSource = pSource;
 
-@endverbatim
-  * @{
-  */
+  return HAL_OK;
+}
 
 /**
-  * @brief  Returns the JPEG state.
+  * @brief  Start the JPEG encoding of the linear frame of the attached encode source.
+  * @note   HAL_JPEG_ConfigEncoding() must have been called: the image size, color space
+  *         and chroma subsampling select the MCU geometry. CMYK is not supported.
+  *         The first MCU row is prepared before returning, the DMA2D transfer callbacks
+  *         are taken over until the last MCU row is handed to the codec.
   * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
   *         the configuration information for JPEG module
-  * @retval JPEG state
+  * @param  pDataOut Pointer to the jpeg output data buffer
+  * @param  OutDataLength size in bytes of the Output buffer
+  * @retval HAL status
   */
-HAL_JPEG_STATETypeDef HAL_JPEG_GetState(const JPEG_HandleTypeDef *hjpeg)
+HAL_StatusTypeDef HAL_JPEG_EncodeSource_Start(JPEG_HandleTypeDef *hjpeg, uint8_t *pDataOut, uint32_t OutDataLength)
 {
-  return hjpeg->State;
-}
+  JPEG_EncodeSourceTypeDef *src = hjpeg->pEncodeSource;
+  DMA2D_HandleTypeDef *hdma2d;
+  uint32_t width;
 
-/**
-  * @brief  Return the JPEG error code
-  * @param  hjpeg  pointer to a JPEG_HandleTypeDef structure that contains
-  *              the configuration information for the specified JPEG.
-  * @retval JPEG Error Code
-  */
-uint32_t HAL_JPEG_GetError(const JPEG_HandleTypeDef *hjpeg)
-{
-  return hjpeg->ErrorCode;
-}
+  if ((src == NULL) || ((hjpeg->Context & JPEG_CONTEXT_CONF_ENCODING) == 0UL))
+  {
+    return HAL_ERROR;
+  }
+  if (JPEG_EncodeSourceHandle != NULL)
+  {
+    return HAL_BUSY;
+  }
+  hdma2d = src->hdma2d;
 
-/**
-  * @}
-  */
+  /* MCU geometry of the configured encoding */
+  if (hjpeg->Conf.ColorSpace == JPEG_GRAYSCALE_COLORSPACE)
+  {
+    src->McuWidth  = 8UL;
+    src->McuHeight = 8UL;
+    src->McuSize   = 64UL;
+  }
+  else if (hjpeg->Conf.ColorSpace != JPEG_YCBCR_COLORSPACE)
+  {
+    return HAL_ERROR;
+  }
+  else if (hjpeg->Conf.ChromaSubsampling == JPEG_420_SUBSAMPLING)
+  {
+    src->McuWidth  = 16UL;
+    src->McuHeight = 16UL;
+    src->McuSize   = 384UL;
+  }
+  else if (hjpeg->Conf.ChromaSubsampling == JPEG_422_SUBSAMPLING)
+  {
+    src->McuWidth  = 16UL;
+    src->McuHeight = 8UL;
+    src->McuSize   = 256UL;
+  }
+  else /* JPEG_444_SUBSAMPLING */
+  {
+    src->McuWidth  = 8UL;
+    src->McuHeight = 8UL;
+    src->McuSize   = 192UL;
+  }
 
-/**
-  * @}
-  */
+  src->McusPerRow = (hjpeg->Conf.ImageWidth + src->McuWidth - 1UL) / src->McuWidth;
+  src->Rows       = (hjpeg->Conf.ImageHeight + src->McuHeight - 1UL) / src->McuHeight;
+  src->RowSize    = src->McusPerRow * src->McuSize;
+  width           = src->McusPerRow * src->McuWidth;
+  if ((src->Rows == 0UL) || (src->FramePitch < width))
+  {
+    return HAL_ERROR;
+  }
 
+  src->FetchRow     = 0UL;
+  src->RowsReady    = 0UL;
+  src->RowsConsumed = 0UL;
+  src->StripPending = 0UL;
+  src->Fetching     = 0UL;
+  src->Converting   = 0UL;
+  src->InPaused     = 0UL;
 
-/** @addtogroup JPEG_Private_Functions
-  * @{
-  */
+  /* Strip fetch: source frame window of one MCU row to contiguous ARGB8888 */
+  hdma2d->Init.Mode           = DMA2D_M2M_PFC;
+  hdma2d->Init.ColorMode      = DMA2D_OUTPUT_ARGB8888;
+  hdma2d->Init.OutputOffset   = 0UL;
+  hdma2d->Init.LineOffsetMode = DMA2D_LOM_PIXELS;
 
-/**
-  * @brief  Generates Huffman sizes/Codes Table from Bits/vals Table
-  * @param  Bits pointer to bits table
-  * @param  Huffsize pointer to sizes table
-  * @param  Huffcode pointer to codes table
-  * @param  LastK pointer to last Coeff (table dimension)
-  * @retval HAL status
-  */
-static HAL_StatusTypeDef JPEG_Bits_To_SizeCodes(const uint8_t *Bits, uint8_t *Huffsize, uint32_t *Huffcode,
-                                                uint32_t *LastK)
-{
-  uint32_t i;
-  uint32_t j;
-  uint32_t k;
-  uint32_t code;
-  uint32_t si;
+  hdma2d->LayerCfg[DMA2D_FOREGROUND_LAYER].InputOffset       = src->FramePitch - width;
+  hdma2d->LayerCfg[DMA2D_FOREGROUND_LAYER].InputColorMode    = src->InputColorMode;
+  hdma2d->LayerCfg[DMA2D_FOREGROUND_LAYER].AlphaMode         = DMA2D_NO_MODIF_ALPHA;
+  hdma2d->LayerCfg[DMA2D_FOREGROUND_LAYER].InputAlpha        = 0xFFUL;
+  hdma2d->LayerCfg[DMA2D_FOREGROUND_LAYER].AlphaInverted     = DMA2D_REGULAR_ALPHA;
+  hdma2d->LayerCfg[DMA2D_FOREGROUND_LAYER].RedBlueSwap       = DMA2D_RB_REGULAR;
+  hdma2d->LayerCfg[DMA2D_FOREGROUND_LAYER].ChromaSubSampling = DMA2D_NO_CSS;
 
-  /* Figure C.1: Generation of table of Huffman code sizes */
-  j = 0;
-  for (k = 0; k < 16UL; k++)
+  if ((HAL_DMA2D_Init(hdma2d) != HAL_OK) || (HAL_DMA2D_ConfigLayer(hdma2d, DMA2D_FOREGROUND_LAYER) != HAL_OK))
   {
-    i = (uint32_t)Bits[k];
-    if ((j + i) > 256UL)
-    {
-      /* check for table overflow */
-      return HAL_ERROR;
-    }
-    while (i != 0UL)
-    {
-      Huffsize[j] = (uint8_t) k + 1U;
-      j++;
-      i--;
-    }
+    return HAL_ERROR;
   }
-  Huffsize[j] = 0;
-  *LastK = j;
 
-  /* Figure C.2: Generation of table of Huffman codes */
-  code = 0;
-  si = Huffsize[0];
-  j = 0;
-  while (Huffsize[j] != 0U)
+  /* Prepare the first MCU row before starting the codec */
+  if (HAL_DMA2D_Start(hdma2d, src->FrameAddress, (uint32_t)src->pStrip, width,
+                      JPEG_EncodeSource_Lines(hjpeg, 0UL)) != HAL_OK)
   {
-    while (((uint32_t) Huffsize[j]) == si)
-    {
-      Huffcode[j] = code;
-      j++;
-      code++;
-    }
-    /* code must fit in "size" bits (si), no code is allowed to be all ones*/
-    if (si > 31UL)
-    {
-      return HAL_ERROR;
-    }
-    if (((uint32_t) code) >= (((uint32_t) 1) << si))
-    {
-      return HAL_ERROR;
-    }
-    code <<= 1;
-    si++;
+    return HAL_ERROR;
   }
-  /* Return function status */
-  return HAL_OK;
-}
+  if (HAL_DMA2D_PollForTransfer(hdma2d, JPEG_TIMEOUT_VALUE) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+  JPEG_EncodeSource_Convert(hjpeg, JPEG_EncodeSource_Lines(hjpeg, 0UL));
+  src->RowsReady = 1UL;
+  src->FetchRow  = 1UL;
 
-/**
-  * @brief  Transform a Bits/Vals AC Huffman table to sizes/Codes huffman Table
-  *         that can programmed to the JPEG encoder registers
-  * @param  AC_BitsValsTable pointer to AC huffman bits/vals table
-  * @param  AC_SizeCodesTable pointer to AC huffman Sizes/Codes table
-  * @retval HAL status
-  */
-static HAL_StatusTypeDef JPEG_ACHuff_BitsVals_To_SizeCodes(JPEG_ACHuffTableTypeDef *AC_BitsValsTable,
-                                                           JPEG_AC_HuffCodeTableTypeDef *AC_SizeCodesTable)
-{
-  HAL_StatusTypeDef error;
-  uint8_t huffsize[257];
-  uint32_t huffcode[257];
-  uint32_t k;
-  uint32_t i;
-  uint32_t lsb;
-  uint32_t msb;
-  uint32_t lastK;
+  hdma2d->XferCpltCallback  = JPEG_EncodeSource_DMA2DCpltCallback;
+  hdma2d->XferErrorCallback = JPEG_EncodeSource_DMA2DErrorCallback;
+  JPEG_EncodeSourceHandle = hjpeg;
 
-  error = JPEG_Bits_To_SizeCodes(AC_BitsValsTable->Bits, huffsize, huffcode, &lastK);
-  if (error != HAL_OK)
+  if (HAL_JPEG_Encode_DMA(hjpeg, src->pMcuRows, src->RowSize, pDataOut, OutDataLength) != HAL_OK)
   {
-    return  error;
+    JPEG_EncodeSourceHandle = NULL;
+    return HAL_ERROR;
   }
 
-  /* Figure C.3: Ordering procedure for encoding procedure code tables */
-  k = 0;
-
-  while (k < lastK)
+  /* Fetch the next strip while the codec encodes the first MCU row */
+  if (src->Rows > 1UL)
   {
-    i = AC_BitsValsTable->HuffVal[k];
-    if (i == 0UL)
-    {
-      i = JPEG_AC_HUFF_TABLE_SIZE - 2UL; /*i = 0x00 EOB code*/
-    }
-    else if (i == 0xF0UL) /* i = 0xF0 ZRL code*/
-    {
-      i = JPEG_AC_HUFF_TABLE_SIZE - 1UL;
-    }
-    else
-    {
-      msb = (i & 0xF0UL) >> 4;
-      lsb = (i & 0x0FUL);
-      i = (msb * 10UL) + lsb - 1UL;
-    }
-    if (i >= JPEG_AC_HUFF_TABLE_SIZE)
-    {
-      return HAL_ERROR; /* Huffman Table overflow error*/
-    }
-    else
-    {
-      AC_SizeCodesTable->HuffmanCode[i] = huffcode[k];
-      AC_SizeCodesTable->CodeLength[i] = huffsize[k] - 1U;
-      k++;
-    }
+    JPEG_EncodeSource_Fetch(hjpeg);
   }
 
-  /* Return function status */
   return HAL_OK;
 }
 
 /**
-  * @brief  Transform a Bits/Vals DC Huffman table to sizes/Codes huffman Table
-  *         that can programmed to the JPEG encoder registers
-  * @param  DC_BitsValsTable pointer to DC huffman bits/vals table
-  * @param  DC_SizeCodesTable pointer to DC huffman Sizes/Codes table
+  * @brief  Abort the JPEG encoding of the attached encode source.
+  * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
+  *         the configuration information for JPEG module
   * @retval HAL status
   */
-static HAL_StatusTypeDef JPEG_DCHuff_BitsVals_To_SizeCodes(JPEG_DCHuffTableTypeDef *DC_BitsValsTable,
-                                                           JPEG_DC_HuffCodeTableTypeDef *DC_SizeCodesTable)
+HAL_StatusTypeDef HAL_JPEG_EncodeSource_Abort(JPEG_HandleTypeDef *hjpeg)
 {
-  HAL_StatusTypeDef error;
+  JPEG_EncodeSourceTypeDef *src = hjpeg->pEncodeSource;
+  HAL_StatusTypeDef status;
 
-  uint32_t k;
-  uint32_t i;
-  uint32_t lastK;
-  uint8_t huffsize[257];
-  uint32_t huffcode[257];
-  error = JPEG_Bits_To_SizeCodes(DC_BitsValsTable->Bits, huffsize, huffcode, &lastK);
-  if (error != HAL_OK)
+  if (src == NULL)
   {
-    return  error;
+    return HAL_ERROR;
   }
-  /* Figure C.3: ordering procedure for encoding procedure code tables */
-  k = 0;
 
-  while (k < lastK)
+  JPEG_EncodeSourceHandle = NULL;
+  status = HAL_JPEG_Abort(hjpeg);
+  if (src->Fetching != 0UL)
   {
-    i = DC_BitsValsTable->HuffVal[k];
-    if (i >= JPEG_DC_HUFF_TABLE_SIZE)
-    {
-      return HAL_ERROR; /* Huffman Table overflow error*/
-    }
-    else
+    if (HAL_DMA2D_Abort(src->hdma2d) != HAL_OK)
     {
-      DC_SizeCodesTable->HuffmanCode[i] = huffcode[k];
-      DC_SizeCodesTable->CodeLength[i] = huffsize[k] - 1U;
-      k++;
+      status = HAL_ERROR;
     }
+    src->Fetching = 0UL;
   }
+  src->StripPending = 0UL;
+  src->InPaused = 0UL;
 
-  /* Return function status */
-  return HAL_OK;
+  return status;
 }
 
 /**
-  * @brief  Set the JPEG register with an DC huffman table at the given DC table address
+  * @brief  Detach the linear frame encode source from the JPEG handle.
   * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
   *         the configuration information for JPEG module
-  * @param  HuffTableDC pointer to DC huffman table
-  * @param  DCTableAddress Encoder DC huffman table address it could be HUFFENC_DC0 or HUFFENC_DC1.
   * @retval HAL status
   */
-static HAL_StatusTypeDef JPEG_Set_HuffDC_Mem(const JPEG_HandleTypeDef *hjpeg, JPEG_DCHuffTableTypeDef *HuffTableDC,
-                                             const __IO uint32_t *DCTableAddress)
+HAL_StatusTypeDef HAL_JPEG_EncodeSource_DeInit(JPEG_HandleTypeDef *hjpeg)
 {
-  HAL_StatusTypeDef error;
-  JPEG_DC_HuffCodeTableTypeDef dcSizeCodesTable;
-  uint32_t i;
-  uint32_t lsb;
-  uint32_t msb;
-  __IO uint32_t *address;
-  __IO uint32_t *addressDef;
-
-  if (DCTableAddress == (hjpeg->Instance->HUFFENC_DC0))
-  {
-    address = (hjpeg->Instance->HUFFENC_DC0 + (JPEG_DC_HUFF_TABLE_SIZE / 2UL));
-  }
-  else if (DCTableAddress == (hjpeg->Instance->HUFFENC_DC1))
-  {
-    address = (hjpeg->Instance->HUFFENC_DC1 + (JPEG_DC_HUFF_TABLE_SIZE / 2UL));
-  }
-  else
+  if ((hjpeg->State == HAL_JPEG_STATE_BUSY_ENCODING) || (JPEG_EncodeSourceHandle == hjpeg))
   {
-    return HAL_ERROR;
+    return HAL_BUSY;
   }
 
-  if (HuffTableDC != NULL)
-  {
-    error = JPEG_DCHuff_BitsVals_To_SizeCodes(HuffTableDC, &dcSizeCodesTable);
-    if (error != HAL_OK)
-    {
-      return  error;
-    }
-    addressDef = address;
-    *addressDef = 0x0FFF0FFF;
-    addressDef++;
-    *addressDef = 0x0FFF0FFF;
-
-    i = JPEG_DC_HUFF_TABLE_SIZE;
-    while (i > 1UL)
-    {
-      i--;
-      address --;
-      msb = ((uint32_t)(((uint32_t)dcSizeCodesTable.CodeLength[i] & 0xFU) << 8)) |
-            ((uint32_t)dcSizeCodesTable.HuffmanCode[i] & 0xFFUL);
-      i--;
-      lsb = ((uint32_t)(((uint32_t)dcSizeCodesTable.CodeLength[i] & 0xFU) << 8)) |
-            ((uint32_t)dcSizeCodesTable.HuffmanCode[i] & 0xFFUL);
-
-      *address = lsb | (msb << 16);
-    }
-  }
+  hjpeg->pEncodeSource = NULL;
 
-  /* Return function status */
   return HAL_OK;
 }
+#endif /* HAL_DMA2D_MODULE_ENABLED && USE_DMA2D_COMMAND_LIST_MODE == 0U */
 
 /**
-  * @brief  Set the JPEG register with an AC huffman table at the given AC table address
-  * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
-  *         the configuration information for JPEG module
-  * @param  HuffTableAC pointer to AC huffman table
-  * @param  ACTableAddress Encoder AC huffman table address it could be HUFFENC_AC0 or HUFFENC_AC1.
-  * @retval HAL status
+  * @}
   */
-static HAL_StatusTypeDef JPEG_Set_HuffAC_Mem(const JPEG_HandleTypeDef *hjpeg, JPEG_ACHuffTableTypeDef *HuffTableAC,
-                                             const __IO uint32_t *ACTableAddress)
-{
-  HAL_StatusTypeDef error;
-  JPEG_AC_HuffCodeTableTypeDef acSizeCodesTable;
-  uint32_t i;
-  uint32_t lsb;
+
+/** @defgroup JPEG_Exported_Functions_Group4 JPEG Decode/Encode callback functions
+  *  @brief   JPEG process callback functions.
+  *
+@verbatim
+  ==============================================================================
+              #####  JPEG Decode and Encode callback functions  #####
+  ==============================================================================
+    [..]  This section provides callback functions:
+      (+) HAL_JPEG_InfoReadyCallback()  : Decoding JPEG Info ready callback
+      (+) HAL_JPEG_EncodeCpltCallback() : Encoding complete callback.
+      (+) HAL_JPEG_DecodeCpltCallback() : Decoding complete callback.
+      (+) HAL_JPEG_ErrorCallback()      : JPEG error callback.
+      (+) HAL_JPEG_GetDataCallback()    : Get New Data chunk callback.
+      (+) HAL_JPEG_DataReadyCallback()  : Decoded/Encoded Data ready  callback.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Decoding JPEG Info ready callback.
+  * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
+  *         the configuration information for JPEG module
+  * @param  pInfo pointer to a JPEG_ConfTypeDef structure that contains
+  *         The JPEG decoded header information
+  * @retval None
+  */
+__weak void HAL_JPEG_InfoReadyCallback(JPEG_HandleTypeDef *hjpeg, JPEG_ConfTypeDef *pInfo)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hjpeg);
+  UNUSED(pInfo);
+
+  /* NOTE : This function Should not be modified, when the callback is needed,
+            the HAL_JPEG_HeaderParsingCpltCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Encoding complete callback.
+  * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
+  *         the configuration information for JPEG module
+  * @retval None
+  */
+__weak void HAL_JPEG_EncodeCpltCallback(JPEG_HandleTypeDef *hjpeg)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hjpeg);
+
+  /* NOTE : This function Should not be modified, when the callback is needed,
+            the HAL_JPEG_EncodeCpltCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Decoding complete callback.
+  * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
+  *         the configuration information for JPEG module
+  * @retval None
+  */
+__weak void HAL_JPEG_DecodeCpltCallback(JPEG_HandleTypeDef *hjpeg)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hjpeg);
+
+  /* NOTE : This function Should not be modified, when the callback is needed,
+            the HAL_JPEG_EncodeCpltCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  JPEG error callback.
+  * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
+  *         the configuration information for JPEG module
+  * @retval None
+  */
+__weak void HAL_JPEG_ErrorCallback(JPEG_HandleTypeDef *hjpeg)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hjpeg);
+
+  /* NOTE : This function Should not be modified, when the callback is needed,
+            the HAL_JPEG_ErrorCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Get New Data chunk callback.
+  * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
+  *         the configuration information for JPEG module
+  * @param  NbDecodedData Number of consumed data in the previous chunk in bytes
+  * @retval None
+  */
+__weak void HAL_JPEG_GetDataCallback(JPEG_HandleTypeDef *hjpeg, uint32_t NbDecodedData)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hjpeg);
+  UNUSED(NbDecodedData);
+
+  /* NOTE : This function Should not be modified, when the callback is needed,
+            the HAL_JPEG_GetDataCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Decoded/Encoded Data ready  callback.
+  * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
+  *         the configuration information for JPEG module
+  * @param  pDataOut pointer to the output data buffer
+  * @param  OutDataLength number in bytes of data available in the specified output buffer
+  * @retval None
+  */
+__weak void HAL_JPEG_DataReadyCallback(JPEG_HandleTypeDef *hjpeg, uint8_t *pDataOut, uint32_t OutDataLength)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hjpeg);
+  UNUSED(pDataOut);
+  UNUSED(OutDataLength);
+
+  /* NOTE : This function Should not be modified, when the callback is needed,
+            the HAL_JPEG_DataReadyCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @}
+  */
+
+
+/** @defgroup JPEG_Exported_Functions_Group5 JPEG IRQ handler management
+  *  @brief   JPEG IRQ handler.
+  *
+@verbatim
+  ==============================================================================
+                ##### JPEG IRQ handler management #####
+  ==============================================================================
+    [..]  This section provides JPEG IRQ handler function.
+      (+) HAL_JPEG_IRQHandler()  : handles JPEG interrupt request
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  This function handles JPEG interrupt request.
+  * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
+  *         the configuration information for JPEG module
+  * @retval None
+  */
+void HAL_JPEG_IRQHandler(JPEG_HandleTypeDef *hjpeg)
+{
+  switch (hjpeg->State)
+  {
+    case HAL_JPEG_STATE_BUSY_ENCODING:
+    case HAL_JPEG_STATE_BUSY_DECODING:
+      /* continue JPEG data encoding/Decoding*/
+      /* JPEG data processing : In/Out FIFO transfer*/
+      if ((hjpeg->Context & JPEG_CONTEXT_METHOD_MASK) == JPEG_CONTEXT_IT)
+      {
+        (void) JPEG_Process(hjpeg);
+      }
+      else if ((hjpeg->Context & JPEG_CONTEXT_METHOD_MASK) == JPEG_CONTEXT_DMA)
+      {
+        JPEG_DMA_ContinueProcess(hjpeg);
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+      break;
+
+    default:
+      break;
+  }
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup JPEG_Exported_Functions_Group6 Peripheral State functions
+  *  @brief   Peripheral State functions.
+  *
+@verbatim
+  ==============================================================================
+                    ##### Peripheral State and Error functions #####
+  ==============================================================================
+    [..]  This section provides JPEG State and Errors function.
+      (+) HAL_JPEG_GetState()  : permits to get in run-time the JPEG state.
+      (+) HAL_JPEG_GetError()  : Returns the JPEG error code if any.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Returns the JPEG state.
+  * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
+  *         the configuration information for JPEG module
+  * @retval JPEG state
+  */
+HAL_JPEG_STATETypeDef HAL_JPEG_GetState(const JPEG_HandleTypeDef *hjpeg)
+{
+  return hjpeg->State;
+}
+
+/**
+  * @brief  Return the JPEG error code
+  * @param  hjpeg  pointer to a JPEG_HandleTypeDef structure that contains
+  *              the configuration information for the specified JPEG.
+  * @retval JPEG Error Code
+  */
+uint32_t HAL_JPEG_GetError(const JPEG_HandleTypeDef *hjpeg)
+{
+  return hjpeg->ErrorCode;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+
+/** @addtogroup JPEG_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Generates Huffman sizes/Codes Table from Bits/vals Table
+  * @param  Bits pointer to bits table
+  * @param  Huffsize pointer to sizes table
+  * @param  Huffcode pointer to codes table
+  * @param  LastK pointer to last Coeff (table dimension)
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef JPEG_Bits_To_SizeCodes(const uint8_t *Bits, uint8_t *Huffsize, uint32_t *Huffcode,
+                                                uint32_t *LastK)
+{
+  uint32_t i;
+  uint32_t j;
+  uint32_t k;
+  uint32_t code;
+  uint32_t si;
+
+  /* Figure C.1: Generation of table of Huffman code sizes */
+  j = 0;
+  for (k = 0; k < 16UL; k++)
+  {
+    i = (uint32_t)Bits[k];
+    if ((j + i) > 256UL)
+    {
+      /* check for table overflow */
+      return HAL_ERROR;
+    }
+    while (i != 0UL)
+    {
+      Huffsize[j] = (uint8_t) k + 1U;
+      j++;
+      i--;
+    }
+  }
+  Huffsize[j] = 0;
+  *LastK = j;
+
+  /* Figure C.2: Generation of table of Huffman codes */
+  code = 0;
+  si = Huffsize[0];
+  j = 0;
+  while (Huffsize[j] != 0U)
+  {
+    while (((uint32_t) Huffsize[j]) == si)
+    {
+      Huffcode[j] = code;
+      j++;
+      code++;
+    }
+    /* code must fit in "size" bits (si), no code is allowed to be all ones*/
+    if (si > 31UL)
+    {
+      return HAL_ERROR;
+    }
+    if (((uint32_t) code) >= (((uint32_t) 1) << si))
+    {
+      return HAL_ERROR;
+    }
+    code <<= 1;
+    si++;
+  }
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Transform a Bits/Vals AC Huffman table to sizes/Codes huffman Table
+  *         that can programmed to the JPEG encoder registers
+  * @param  AC_BitsValsTable pointer to AC huffman bits/vals table
+  * @param  AC_SizeCodesTable pointer to AC huffman Sizes/Codes table
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef JPEG_ACHuff_BitsVals_To_SizeCodes(JPEG_ACHuffTableTypeDef *AC_BitsValsTable,
+                                                           JPEG_AC_HuffCodeTableTypeDef *AC_SizeCodesTable)
+{
+  HAL_StatusTypeDef error;
+  uint8_t huffsize[257];
+  uint32_t huffcode[257];
+  uint32_t k;
+  uint32_t i;
+  uint32_t lsb;
+  uint32_t msb;
+  uint32_t lastK;
+
+  error = JPEG_Bits_To_SizeCodes(AC_BitsValsTable->Bits, huffsize, huffcode, &lastK);
+  if (error != HAL_OK)
+  {
+    return  error;
+  }
+
+  /* Figure C.3: Ordering procedure for encoding procedure code tables */
+  k = 0;
+
+  while (k < lastK)
+  {
+    i = AC_BitsValsTable->HuffVal[k];
+    if (i == 0UL)
+    {
+      i = JPEG_AC_HUFF_TABLE_SIZE - 2UL; /*i = 0x00 EOB code*/
+    }
+    else if (i == 0xF0UL) /* i = 0xF0 ZRL code*/
+    {
+      i = JPEG_AC_HUFF_TABLE_SIZE - 1UL;
+    }
+    else
+    {
+      msb = (i & 0xF0UL) >> 4;
+      lsb = (i & 0x0FUL);
+      i = (msb * 10UL) + lsb - 1UL;
+    }
+    if (i >= JPEG_AC_HUFF_TABLE_SIZE)
+    {
+      return HAL_ERROR; /* Huffman Table overflow error*/
+    }
+    else
+    {
+      AC_SizeCodesTable->HuffmanCode[i] = huffcode[k];
+      AC_SizeCodesTable->CodeLength[i] = huffsize[k] - 1U;
+      k++;
+    }
+  }
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Transform a Bits/Vals DC Huffman table to sizes/Codes huffman Table
+  *         that can programmed to the JPEG encoder registers
+  * @param  DC_BitsValsTable pointer to DC huffman bits/vals table
+  * @param  DC_SizeCodesTable pointer to DC huffman Sizes/Codes table
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef JPEG_DCHuff_BitsVals_To_SizeCodes(JPEG_DCHuffTableTypeDef *DC_BitsValsTable,
+                                                           JPEG_DC_HuffCodeTableTypeDef *DC_SizeCodesTable)
+{
+  HAL_StatusTypeDef error;
+
+  uint32_t k;
+  uint32_t i;
+  uint32_t lastK;
+  uint8_t huffsize[257];
+  uint32_t huffcode[257];
+  error = JPEG_Bits_To_SizeCodes(DC_BitsValsTable->Bits, huffsize, huffcode, &lastK);
+  if (error != HAL_OK)
+  {
+    return  error;
+  }
+  /* Figure C.3: ordering procedure for encoding procedure code tables */
+  k = 0;
+
+  while (k < lastK)
+  {
+    i = DC_BitsValsTable->HuffVal[k];
+    if (i >= JPEG_DC_HUFF_TABLE_SIZE)
+    {
+      return HAL_ERROR; /* Huffman Table overflow error*/
+    }
+    else
+    {
+      DC_SizeCodesTable->HuffmanCode[i] = huffcode[k];
+      DC_SizeCodesTable->CodeLength[i] = huffsize[k] - 1U;
+      k++;
+    }
+  }
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Set the JPEG register with an DC huffman table at the given DC table address
+  * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
+  *         the configuration information for JPEG module
+  * @param  HuffTableDC pointer to DC huffman table
+  * @param  DCTableAddress Encoder DC huffman table address it could be HUFFENC_DC0 or HUFFENC_DC1.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef JPEG_Set_HuffDC_Mem(const JPEG_HandleTypeDef *hjpeg, JPEG_DCHuffTableTypeDef *HuffTableDC,
+                                             const __IO uint32_t *DCTableAddress)
+{
+  HAL_StatusTypeDef error;
+  JPEG_DC_HuffCodeTableTypeDef dcSizeCodesTable;
+  uint32_t i;
+  uint32_t lsb;
+  uint32_t msb;
+  __IO uint32_t *address;
+  __IO uint32_t *addressDef;
+
+  if (DCTableAddress == (hjpeg->Instance->HUFFENC_DC0))
+  {
+    address = (hjpeg->Instance->HUFFENC_DC0 + (JPEG_DC_HUFF_TABLE_SIZE / 2UL));
+  }
+  else if (DCTableAddress == (hjpeg->Instance->HUFFENC_DC1))
+  {
+    address = (hjpeg->Instance->HUFFENC_DC1 + (JPEG_DC_HUFF_TABLE_SIZE / 2UL));
+  }
+  else
+  {
+    return HAL_ERROR;
+  }
+
+  if (HuffTableDC != NULL)
+  {
+    error = JPEG_DCHuff_BitsVals_To_SizeCodes(HuffTableDC, &dcSizeCodesTable);
+    if (error != HAL_OK)
+    {
+      return  error;
+    }
+    addressDef = address;
+    *addressDef = 0x0FFF0FFF;
+    addressDef++;
+    *addressDef = 0x0FFF0FFF;
+
+    i = JPEG_DC_HUFF_TABLE_SIZE;
+    while (i > 1UL)
+    {
+      i--;
+      address --;
+      msb = ((uint32_t)(((uint32_t)dcSizeCodesTable.CodeLength[i] & 0xFU) << 8)) |
+            ((uint32_t)dcSizeCodesTable.HuffmanCode[i] & 0xFFUL);
+      i--;
+      lsb = ((uint32_t)(((uint32_t)dcSizeCodesTable.CodeLength[i] & 0xFU) << 8)) |
+            ((uint32_t)dcSizeCodesTable.HuffmanCode[i] & 0xFFUL);
+
+      *address = lsb | (msb << 16);
+    }
+  }
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Set the JPEG register with an AC huffman table at the given AC table address
+  * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
+  *         the configuration information for JPEG module
+  * @param  HuffTableAC pointer to AC huffman table
+  * @param  ACTableAddress Encoder AC huffman table address it could be HUFFENC_AC0 or HUFFENC_AC1.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef JPEG_Set_HuffAC_Mem(const JPEG_HandleTypeDef *hjpeg, JPEG_ACHuffTableTypeDef *HuffTableAC,
+                                             const __IO uint32_t *ACTableAddress)
+{
+  HAL_StatusTypeDef error;
+  JPEG_AC_HuffCodeTableTypeDef acSizeCodesTable;
+  uint32_t i;
+  uint32_t lsb;
   uint32_t msb;
   __IO uint32_t *address;
-  __IO uint32_t *addressDef;
+  __IO uint32_t *addressDef;
+
+  if (ACTableAddress == (hjpeg->Instance->HUFFENC_AC0))
+  {
+    address = (hjpeg->Instance->HUFFENC_AC0 + (JPEG_AC_HUFF_TABLE_SIZE / 2UL));
+  }
+  else if (ACTableAddress == (hjpeg->Instance->HUFFENC_AC1))
+  {
+    address = (hjpeg->Instance->HUFFENC_AC1 + (JPEG_AC_HUFF_TABLE_SIZE / 2UL));
+  }
+  else
+  {
+    return HAL_ERROR;
+  }
+
+  if (HuffTableAC != NULL)
+  {
+    error = JPEG_ACHuff_BitsVals_To_SizeCodes(HuffTableAC, &acSizeCodesTable);
+    if (error != HAL_OK)
+    {
+      return  error;
+    }
+    /* Default values settings: 162:167 FFFh , 168:175 FD0h_FD7h */
+    /* Locations 162:175 of each AC table contain information used internally by the core */
+
+    addressDef = address;
+    for (i = 0; i < 3UL; i++)
+    {
+      *addressDef = 0x0FFF0FFF;
+      addressDef++;
+    }
+    *addressDef = 0x0FD10FD0;
+    addressDef++;
+    *addressDef = 0x0FD30FD2;
+    addressDef++;
+    *addressDef = 0x0FD50FD4;
+    addressDef++;
+    *addressDef = 0x0FD70FD6;
+    /* end of Locations 162:175  */
+
+
+    i = JPEG_AC_HUFF_TABLE_SIZE;
+    while (i > 1UL)
+    {
+      i--;
+      address--;
+      msb = ((uint32_t)(((uint32_t)acSizeCodesTable.CodeLength[i] & 0xFU) << 8)) |
+            ((uint32_t)acSizeCodesTable.HuffmanCode[i] & 0xFFUL);
+      i--;
+      lsb = ((uint32_t)(((uint32_t)acSizeCodesTable.CodeLength[i] & 0xFU) << 8)) |
+            ((uint32_t)acSizeCodesTable.HuffmanCode[i] & 0xFFUL);
+
+      *address = lsb | (msb << 16);
+    }
+  }
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Configure the JPEG encoder register huffman tables to used during
+  *         the encdoing operation
+  * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
+  *         the configuration information for JPEG module
+  * @retval None
+  */
+static HAL_StatusTypeDef JPEG_Set_HuffEnc_Mem(JPEG_HandleTypeDef *hjpeg)
+{
+  HAL_StatusTypeDef error;
+
+  JPEG_Set_Huff_DHTMem(hjpeg);
+  error = JPEG_Set_HuffAC_Mem(hjpeg, (JPEG_ACHuffTableTypeDef *)(uint32_t)&JPEG_ACLUM_HuffTable,
+                              (hjpeg->Instance->HUFFENC_AC0));
+  if (error != HAL_OK)
+  {
+    return  error;
+  }
+
+  error = JPEG_Set_HuffAC_Mem(hjpeg, (JPEG_ACHuffTableTypeDef *)(uint32_t)&JPEG_ACCHROM_HuffTable,
+                              (hjpeg->Instance->HUFFENC_AC1));
+  if (error != HAL_OK)
+  {
+    return  error;
+  }
+
+  error = JPEG_Set_HuffDC_Mem(hjpeg, (JPEG_DCHuffTableTypeDef *)(uint32_t)&JPEG_DCLUM_HuffTable,
+                              hjpeg->Instance->HUFFENC_DC0);
+  if (error != HAL_OK)
+  {
+    return  error;
+  }
+
+  error = JPEG_Set_HuffDC_Mem(hjpeg, (JPEG_DCHuffTableTypeDef *)(uint32_t)&JPEG_DCCHROM_HuffTable,
+                              hjpeg->Instance->HUFFENC_DC1);
+  if (error != HAL_OK)
+  {
+    return  error;
+  }
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Configure the JPEG register huffman tables to be included in the JPEG
+  *         file header (used for encoding only)
+  * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
+  *         the configuration information for JPEG module
+  * @retval None
+  */
+static void JPEG_Set_Huff_DHTMem(const JPEG_HandleTypeDef *hjpeg)
+{
+  const JPEG_ACHuffTableTypeDef *HuffTableAC0 = (JPEG_ACHuffTableTypeDef *)(uint32_t)&JPEG_ACLUM_HuffTable;
+  const JPEG_ACHuffTableTypeDef *HuffTableAC1 = (JPEG_ACHuffTableTypeDef *)(uint32_t)&JPEG_ACCHROM_HuffTable;
+  const JPEG_DCHuffTableTypeDef *HuffTableDC0 = (JPEG_DCHuffTableTypeDef *)(uint32_t)&JPEG_DCLUM_HuffTable;
+  const JPEG_DCHuffTableTypeDef *HuffTableDC1 = (JPEG_DCHuffTableTypeDef *)(uint32_t)&JPEG_DCCHROM_HuffTable;
+  uint32_t value;
+  uint32_t index;
+  __IO uint32_t *address;
+
+  /* DC0 Huffman Table : BITS*/
+  /* DC0 BITS is a 16 Bytes table i.e 4x32bits words from DHTMEM base address to DHTMEM + 3*/
+  address = (hjpeg->Instance->DHTMEM + 3);
+  index = 16;
+  while (index > 3UL)
+  {
+
+    *address = (((uint32_t)HuffTableDC0->Bits[index - 1UL] & 0xFFUL) << 24) |
+               (((uint32_t)HuffTableDC0->Bits[index - 2UL] & 0xFFUL) << 16) |
+               (((uint32_t)HuffTableDC0->Bits[index - 3UL] & 0xFFUL) << 8) |
+               ((uint32_t)HuffTableDC0->Bits[index - 4UL] & 0xFFUL);
+    address--;
+    index -= 4UL;
+
+  }
+  /* DC0 Huffman Table : Val*/
+  /* DC0 VALS is a 12 Bytes table i.e 3x32bits words from DHTMEM base address +4 to DHTMEM + 6 */
+  address = (hjpeg->Instance->DHTMEM + 6);
+  index = 12;
+  while (index > 3UL)
+  {
+    *address = (((uint32_t)HuffTableDC0->HuffVal[index - 1UL] & 0xFFUL) << 24) |
+               (((uint32_t)HuffTableDC0->HuffVal[index - 2UL] & 0xFFUL) << 16) |
+               (((uint32_t)HuffTableDC0->HuffVal[index - 3UL] & 0xFFUL) << 8) |
+               ((uint32_t)HuffTableDC0->HuffVal[index - 4UL] & 0xFFUL);
+    address--;
+    index -= 4UL;
+  }
+
+  /* AC0 Huffman Table : BITS*/
+  /* AC0 BITS is a 16 Bytes table i.e 4x32bits words from DHTMEM base address + 7 to DHTMEM + 10*/
+  address = (hjpeg->Instance->DHTMEM + 10UL);
+  index = 16;
+  while (index > 3UL)
+  {
+
+    *address = (((uint32_t)HuffTableAC0->Bits[index - 1UL] & 0xFFUL) << 24) |
+               (((uint32_t)HuffTableAC0->Bits[index - 2UL] & 0xFFUL) << 16) |
+               (((uint32_t)HuffTableAC0->Bits[index - 3UL] & 0xFFUL) << 8) |
+               ((uint32_t)HuffTableAC0->Bits[index - 4UL] & 0xFFUL);
+    address--;
+    index -= 4UL;
+
+  }
+  /* AC0 Huffman Table : Val*/
+  /* AC0 VALS is a 162 Bytes table i.e 41x32bits words from DHTMEM base address + 11 to DHTMEM + 51 */
+  /* only Byte 0 and Byte 1 of the last word (@ DHTMEM + 51) belong to AC0 VALS table */
+  address = (hjpeg->Instance->DHTMEM + 51);
+  value = *address & 0xFFFF0000U;
+  value = value | (((uint32_t)HuffTableAC0->HuffVal[161] & 0xFFUL) << 8) |
+          ((uint32_t)HuffTableAC0->HuffVal[160] & 0xFFUL);
+  *address = value;
+
+  /*continue setting 160 AC0 huffman values */
+  address--; /* address = hjpeg->Instance->DHTMEM + 50*/
+  index = JPEG_AC_HUFF_TABLE_SIZE - 2UL;
+  while (index > 3UL)
+  {
+    *address = (((uint32_t)HuffTableAC0->HuffVal[index - 1UL] & 0xFFUL) << 24) |
+               (((uint32_t)HuffTableAC0->HuffVal[index - 2UL] & 0xFFUL) << 16) |
+               (((uint32_t)HuffTableAC0->HuffVal[index - 3UL] & 0xFFUL) << 8) |
+               ((uint32_t)HuffTableAC0->HuffVal[index - 4UL] & 0xFFUL);
+    address--;
+    index -= 4UL;
+  }
+
+  /* DC1 Huffman Table : BITS*/
+  /* DC1 BITS is a 16 Bytes table i.e 4x32bits words from DHTMEM + 51 base address to DHTMEM + 55*/
+  /* only Byte 2 and Byte 3 of the first word (@ DHTMEM + 51) belong to DC1 Bits table */
+  address = (hjpeg->Instance->DHTMEM + 51);
+  value = *address & 0x0000FFFFU;
+  value = value | (((uint32_t)HuffTableDC1->Bits[1] & 0xFFUL) << 24) |
+          (((uint32_t)HuffTableDC1->Bits[0] & 0xFFUL) << 16);
+  *address = value;
+
+  /* only Byte 0 and Byte 1 of the last word (@ DHTMEM + 55) belong to DC1 Bits table */
+  address = (hjpeg->Instance->DHTMEM + 55);
+  value = *address & 0xFFFF0000U;
+  value = value | (((uint32_t)HuffTableDC1->Bits[15] & 0xFFUL) << 8) |
+          ((uint32_t)HuffTableDC1->Bits[14] & 0xFFUL);
+  *address = value;
+
+  /*continue setting 12 DC1 huffman Bits from DHTMEM + 54 down to DHTMEM + 52*/
+  address--;
+  index = 12;
+  while (index > 3UL)
+  {
+
+    *address = (((uint32_t)HuffTableDC1->Bits[index + 1UL] & 0xFFUL) << 24) |
+               (((uint32_t)HuffTableDC1->Bits[index] & 0xFFUL) << 16) |
+               (((uint32_t)HuffTableDC1->Bits[index - 1UL] & 0xFFUL) << 8) |
+               ((uint32_t)HuffTableDC1->Bits[index - 2UL] & 0xFFUL);
+    address--;
+    index -= 4UL;
+
+  }
+  /* DC1 Huffman Table : Val*/
+  /* DC1 VALS is a 12 Bytes table i.e 3x32bits words from DHTMEM base address +55 to DHTMEM + 58 */
+  /* only Byte 2 and Byte 3 of the first word (@ DHTMEM + 55) belong to DC1 Val table */
+  address = (hjpeg->Instance->DHTMEM + 55);
+  value = *address & 0x0000FFFFUL;
+  value = value | (((uint32_t)HuffTableDC1->HuffVal[1] & 0xFFUL) << 24) |
+          (((uint32_t)HuffTableDC1->HuffVal[0] & 0xFFUL) << 16);
+  *address = value;
+
+  /* only Byte 0 and Byte 1 of the last word (@ DHTMEM + 58) belong to DC1 Val table */
+  address = (hjpeg->Instance->DHTMEM + 58);
+  value = *address & 0xFFFF0000UL;
+  value = value | (((uint32_t)HuffTableDC1->HuffVal[11] & 0xFFUL) << 8) |
+          ((uint32_t)HuffTableDC1->HuffVal[10] & 0xFFUL);
+  *address = value;
+
+  /*continue setting 8 DC1 huffman val from DHTMEM + 57 down to DHTMEM + 56*/
+  address--;
+  index = 8;
+  while (index > 3UL)
+  {
+    *address = (((uint32_t)HuffTableDC1->HuffVal[index + 1UL] & 0xFFUL) << 24) |
+               (((uint32_t)HuffTableDC1->HuffVal[index] & 0xFFUL) << 16) |
+               (((uint32_t)HuffTableDC1->HuffVal[index - 1UL] & 0xFFUL) << 8) |
+               ((uint32_t)HuffTableDC1->HuffVal[index - 2UL] & 0xFFUL);
+    address--;
+    index -= 4UL;
+  }
+
+  /* AC1 Huffman Table : BITS*/
+  /* AC1 BITS is a 16 Bytes table i.e 4x32bits words from DHTMEM base address + 58 to DHTMEM + 62*/
+  /* only Byte 2 and Byte 3 of the first word (@ DHTMEM + 58) belong to AC1 Bits table */
+  address = (hjpeg->Instance->DHTMEM + 58);
+  value = *address & 0x0000FFFFU;
+  value = value | (((uint32_t)HuffTableAC1->Bits[1] & 0xFFUL) << 24) |
+          (((uint32_t)HuffTableAC1->Bits[0] & 0xFFUL) << 16);
+  *address = value;
+
+  /* only Byte 0 and Byte 1 of the last word (@ DHTMEM + 62) belong to Bits Val table */
+  address = (hjpeg->Instance->DHTMEM + 62);
+  value = *address & 0xFFFF0000U;
+  value = value | (((uint32_t)HuffTableAC1->Bits[15] & 0xFFUL) << 8) | ((uint32_t)HuffTableAC1->Bits[14] & 0xFFUL);
+  *address = value;
+
+  /*continue setting 12 AC1 huffman Bits from DHTMEM + 61 down to DHTMEM + 59*/
+  address--;
+  index = 12;
+  while (index > 3UL)
+  {
+
+    *address = (((uint32_t)HuffTableAC1->Bits[index + 1UL] & 0xFFUL) << 24) |
+               (((uint32_t)HuffTableAC1->Bits[index] & 0xFFUL) << 16) |
+               (((uint32_t)HuffTableAC1->Bits[index - 1UL] & 0xFFUL) << 8) |
+               ((uint32_t)HuffTableAC1->Bits[index - 2UL] & 0xFFUL);
+    address--;
+    index -= 4UL;
+
+  }
+  /* AC1 Huffman Table : Val*/
+  /* AC1 VALS is a 162 Bytes table i.e 41x32bits words from DHTMEM base address + 62 to DHTMEM + 102 */
+  /* only Byte 2 and Byte 3 of the first word (@ DHTMEM + 62) belong to AC1 VALS table */
+  address = (hjpeg->Instance->DHTMEM + 62);
+  value = *address & 0x0000FFFFUL;
+  value = value | (((uint32_t)HuffTableAC1->HuffVal[1] & 0xFFUL) << 24) |
+          (((uint32_t)HuffTableAC1->HuffVal[0] & 0xFFUL) << 16);
+  *address = value;
+
+  /*continue setting 160 AC1 huffman values from DHTMEM + 63 to DHTMEM+102 */
+  address = (hjpeg->Instance->DHTMEM + 102);
+  index = JPEG_AC_HUFF_TABLE_SIZE - 2UL;
+  while (index > 3UL)
+  {
+    *address = (((uint32_t)HuffTableAC1->HuffVal[index + 1UL] & 0xFFUL) << 24) |
+               (((uint32_t)HuffTableAC1->HuffVal[index] & 0xFFUL) << 16) |
+               (((uint32_t)HuffTableAC1->HuffVal[index - 1UL] & 0xFFUL) << 8) |
+               ((uint32_t)HuffTableAC1->HuffVal[index - 2UL] & 0xFFUL);
+    address--;
+    index -= 4UL;
+  }
+
+}
+
+/**
+  * @brief  Configure the JPEG registers with a given quantization table
+  * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
+  *         the configuration information for JPEG module
+  * @param  QTable pointer to an array of 64 bytes giving the quantization table
+  * @param  QTableAddress destination quantization address in the JPEG peripheral
+  *         it could be QMEM0, QMEM1, QMEM2 or QMEM3
+  * @retval 0 if no error, 1 if error
+  */
+static uint32_t JPEG_Set_Quantization_Mem(const JPEG_HandleTypeDef *hjpeg, const uint8_t *QTable,
+                                          __IO uint32_t *QTableAddress)
+{
+  uint32_t i;
+  uint32_t j;
+  uint32_t quantRow;
+  uint32_t quantVal;
+  uint32_t ScaleFactor;
+  __IO uint32_t *tableAddress;
 
-  if (ACTableAddress == (hjpeg->Instance->HUFFENC_AC0))
+  tableAddress = QTableAddress;
+
+  if ((hjpeg->Conf.ImageQuality >= 50UL) && (hjpeg->Conf.ImageQuality <= 100UL))
   {
-    address = (hjpeg->Instance->HUFFENC_AC0 + (JPEG_AC_HUFF_TABLE_SIZE / 2UL));
+    ScaleFactor = JPEG_HIGH_QUALITY_REFERENCE - (hjpeg->Conf.ImageQuality * 2UL);
   }
-  else if (ACTableAddress == (hjpeg->Instance->HUFFENC_AC1))
+  else if (hjpeg->Conf.ImageQuality > 0UL)
   {
-    address = (hjpeg->Instance->HUFFENC_AC1 + (JPEG_AC_HUFF_TABLE_SIZE / 2UL));
+    ScaleFactor = JPEG_LOW_QUALITY_REFERENCE / ((uint32_t) hjpeg->Conf.ImageQuality);
   }
   else
   {
-    return HAL_ERROR;
+    return 1UL;
   }
 
-  if (HuffTableAC != NULL)
+  /*Quantization_table = (Standard_quanization_table * ScaleFactor + 50) / 100*/
+  i = 0;
+  while (i < (JPEG_QUANT_TABLE_SIZE - 3UL))
   {
-    error = JPEG_ACHuff_BitsVals_To_SizeCodes(HuffTableAC, &acSizeCodesTable);
-    if (error != HAL_OK)
+    quantRow = 0;
+    for (j = 0; j < 4UL; j++)
     {
-      return  error;
-    }
-    /* Default values settings: 162:167 FFFh , 168:175 FD0h_FD7h */
-    /* Locations 162:175 of each AC table contain information used internally by the core */
+      /* Note that the quantization coefficients must be specified in the table in zigzag order */
+      quantVal = ((((uint32_t) QTable[JPEG_ZIGZAG_ORDER[i + j]]) * ScaleFactor) + 50UL) / 100UL;
 
-    addressDef = address;
-    for (i = 0; i < 3UL; i++)
-    {
-      *addressDef = 0x0FFF0FFF;
-      addressDef++;
+      if (quantVal == 0UL)
+      {
+        quantVal = 1UL;
+      }
+      else if (quantVal > 255UL)
+      {
+        quantVal = JPEG_QUANTVAL_MAX;
+      }
+      else
+      {
+        /* Nothing to do, keep same value of quantVal */
+      }
+
+      quantRow |= ((quantVal & 0xFFUL) << (8UL * j));
     }
-    *addressDef = 0x0FD10FD0;
-    addressDef++;
-    *addressDef = 0x0FD30FD2;
-    addressDef++;
-    *addressDef = 0x0FD50FD4;
-    addressDef++;
-    *addressDef = 0x0FD70FD6;
-    /* end of Locations 162:175  */
 
+    i += 4UL;
+    *tableAddress = quantRow;
+    tableAddress ++;
+  }
 
-    i = JPEG_AC_HUFF_TABLE_SIZE;
-    while (i > 1UL)
-    {
-      i--;
-      address--;
-      msb = ((uint32_t)(((uint32_t)acSizeCodesTable.CodeLength[i] & 0xFU) << 8)) |
-            ((uint32_t)acSizeCodesTable.HuffmanCode[i] & 0xFFUL);
-      i--;
-      lsb = ((uint32_t)(((uint32_t)acSizeCodesTable.CodeLength[i] & 0xFU) << 8)) |
-            ((uint32_t)acSizeCodesTable.HuffmanCode[i] & 0xFFUL);
+  /* Return function status */
+  return 0UL;
+}
 
-      *address = lsb | (msb << 16);
-    }
+/**
+  * @brief  Configure the JPEG registers for YCbCr color space
+  * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
+  *         the configuration information for JPEG module
+  * @retval None
+  */
+static void JPEG_SetColorYCBCR(JPEG_HandleTypeDef *hjpeg)
+{
+  uint32_t ySamplingH;
+  uint32_t ySamplingV;
+  uint32_t yblockNb;
+
+  /*Set Number of color components to 3*/
+  hjpeg->Instance->CONFR1 &=  ~JPEG_CONFR1_NF;
+  hjpeg->Instance->CONFR1 |=  JPEG_CONFR1_NF_1;
+
+  /* compute MCU block size and Y, Cb ,Cr sampling factors*/
+  if (hjpeg->Conf.ChromaSubsampling == JPEG_420_SUBSAMPLING)
+  {
+    ySamplingH  = JPEG_CONFR4_HSF_1;   /* Hs = 2*/
+    ySamplingV  = JPEG_CONFR4_VSF_1;   /* Vs = 2*/
+
+    yblockNb  = 0x30; /* 4 blocks of 8x8*/
+  }
+  else if (hjpeg->Conf.ChromaSubsampling == JPEG_422_SUBSAMPLING)
+  {
+    ySamplingH  = JPEG_CONFR4_HSF_1;   /* Hs = 2*/
+    ySamplingV  = JPEG_CONFR4_VSF_0;   /* Vs = 1*/
+
+    yblockNb  = 0x10; /* 2 blocks of 8x8*/
+  }
+  else /*JPEG_444_SUBSAMPLING and default*/
+  {
+    ySamplingH  = JPEG_CONFR4_HSF_0;   /* Hs = 1*/
+    ySamplingV  = JPEG_CONFR4_VSF_0;   /* Vs = 1*/
+
+    yblockNb  = 0; /* 1 block of 8x8*/
   }
 
-  /* Return function status */
-  return HAL_OK;
+  hjpeg->Instance->CONFR1 &= ~(JPEG_CONFR1_NF | JPEG_CONFR1_NS);
+  hjpeg->Instance->CONFR1 |= (JPEG_CONFR1_NF_1 | JPEG_CONFR1_NS_1);
+
+  /*Reset CONFR4 register*/
+  hjpeg->Instance->CONFR4 =  0;
+  /*Set Horizental and Vertical  sampling factor , number of blocks,
+   Quantization table and Huffman AC/DC tables for component 0*/
+  hjpeg->Instance->CONFR4 |= (ySamplingH | ySamplingV | (yblockNb & JPEG_CONFR4_NB));
+
+  /*Reset CONFR5 register*/
+  hjpeg->Instance->CONFR5 =  0;
+  /*Set Horizental and Vertical  sampling factor , number of blocks,
+    Quantization table and Huffman AC/DC tables for component 1*/
+  hjpeg->Instance->CONFR5 |= (JPEG_CONFR5_HSF_0 | JPEG_CONFR5_VSF_0 | JPEG_CONFR5_QT_0 | JPEG_CONFR5_HA |
+                              JPEG_CONFR5_HD);
+
+  /*Reset CONFR6 register*/
+  hjpeg->Instance->CONFR6 =  0;
+  /*Set Horizental and Vertical  sampling factor and number of blocks for component 2*/
+  /* In YCBCR , by default, both chrominance components (component 1 and component 2)
+     use the same Quantization table (table 1) */
+  /* In YCBCR , both chrominance components (component 1 and component 2) use the same Huffman tables (table 1) */
+  hjpeg->Instance->CONFR6 |= (JPEG_CONFR6_HSF_0 | JPEG_CONFR6_VSF_0 | JPEG_CONFR6_QT_0 | JPEG_CONFR6_HA |
+                              JPEG_CONFR6_HD);
+
 }
 
 /**
-  * @brief  Configure the JPEG encoder register huffman tables to used during
-  *         the encdoing operation
+  * @brief  Configure the JPEG registers for GrayScale color space
   * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
   *         the configuration information for JPEG module
   * @retval None
   */
-static HAL_StatusTypeDef JPEG_Set_HuffEnc_Mem(JPEG_HandleTypeDef *hjpeg)
+static void JPEG_SetColorGrayScale(JPEG_HandleTypeDef *hjpeg)
 {
-  HAL_StatusTypeDef error;
+  /*Set Number of color components to 1*/
+  hjpeg->Instance->CONFR1 &= ~(JPEG_CONFR1_NF | JPEG_CONFR1_NS);
+
+  /*in GrayScale use 1 single Quantization table (Table 0)*/
+  /*in GrayScale use only one couple of AC/DC huffman table (table 0)*/
+
+  /*Reset CONFR4 register*/
+  hjpeg->Instance->CONFR4 =  0;
+  /*Set Horizental and Vertical  sampling factor , number of blocks,
+    Quantization table and Huffman AC/DC tables for component 0*/
+  hjpeg->Instance->CONFR4 |=  JPEG_CONFR4_HSF_0 | JPEG_CONFR4_VSF_0 ;
+}
+
+/**
+  * @brief  Configure the JPEG registers for CMYK color space
+  * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
+  *         the configuration information for JPEG module
+  * @retval None
+  */
+static void JPEG_SetColorCMYK(JPEG_HandleTypeDef *hjpeg)
+{
+  uint32_t ySamplingH;
+  uint32_t ySamplingV;
+  uint32_t yblockNb;
+
+  /*Set Number of color components to 4*/
+  hjpeg->Instance->CONFR1 |= (JPEG_CONFR1_NF | JPEG_CONFR1_NS);
+
+  /* compute MCU block size and Y, Cb ,Cr sampling factors*/
+  if (hjpeg->Conf.ChromaSubsampling == JPEG_420_SUBSAMPLING)
+  {
+    ySamplingH  = JPEG_CONFR4_HSF_1;   /* Hs = 2*/
+    ySamplingV  = JPEG_CONFR4_VSF_1;   /* Vs = 2*/
+
+    yblockNb  = 0x30; /* 4 blocks of 8x8*/
+  }
+  else if (hjpeg->Conf.ChromaSubsampling == JPEG_422_SUBSAMPLING)
+  {
+    ySamplingH  = JPEG_CONFR4_HSF_1;   /* Hs = 2*/
+    ySamplingV  = JPEG_CONFR4_VSF_0;   /* Vs = 1*/
+
+    yblockNb  = 0x10; /* 2 blocks of 8x8*/
+  }
+  else /*JPEG_444_SUBSAMPLING and default*/
+  {
+    ySamplingH  = JPEG_CONFR4_HSF_0;   /* Hs = 1*/
+    ySamplingV  = JPEG_CONFR4_VSF_0;   /* Vs = 1*/
+
+    yblockNb  = 0; /* 1 block of 8x8*/
+  }
+
+  /*Reset CONFR4 register*/
+  hjpeg->Instance->CONFR4 =  0;
+  /*Set Horizental and Vertical  sampling factor , number of blocks,
+    Quantization table and Huffman AC/DC tables for component 0*/
+  hjpeg->Instance->CONFR4 |= (ySamplingH | ySamplingV | (yblockNb & JPEG_CONFR4_NB));
+
+  /*Reset CONFR5 register*/
+  hjpeg->Instance->CONFR5 =  0;
+  /*Set Horizental and Vertical  sampling factor , number of blocks,
+    Quantization table and Huffman AC/DC tables for component 1*/
+  hjpeg->Instance->CONFR5 |= (JPEG_CONFR5_HSF_0 | JPEG_CONFR5_VSF_0);
+
+  /*Reset CONFR6 register*/
+  hjpeg->Instance->CONFR6 =  0;
+  /*Set Horizental and Vertical  sampling factor , number of blocks,
+    Quantization table and Huffman AC/DC tables for component 2*/
+  hjpeg->Instance->CONFR6 |= (JPEG_CONFR6_HSF_0 | JPEG_CONFR6_VSF_0);
+
+  /*Reset CONFR7 register*/
+  hjpeg->Instance->CONFR7 =  0;
+  /*Set Horizental and Vertical  sampling factor , number of blocks,
+    Quantization table and Huffman AC/DC tables for component 3*/
+  hjpeg->Instance->CONFR7 |= (JPEG_CONFR7_HSF_0 | JPEG_CONFR7_VSF_0);
+}
+
+/**
+  * @brief  Init the JPEG encoding/decoding process in case of Polling or Interrupt and DMA
+  * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
+  *         the configuration information for JPEG module
+  * @retval None
+  */
+static void JPEG_Init_Process(JPEG_HandleTypeDef *hjpeg)
+{
+  /*Reset pause*/
+  hjpeg->Context &= (~(JPEG_CONTEXT_PAUSE_INPUT | JPEG_CONTEXT_PAUSE_OUTPUT));
+
+  if ((hjpeg->Context & JPEG_CONTEXT_OPERATION_MASK) == JPEG_CONTEXT_DECODE)
+  {
+    /*Set JPEG Codec to Decoding mode */
+    hjpeg->Instance->CONFR1 |= JPEG_CONFR1_DE;
+  }
+  else /* JPEG_CONTEXT_ENCODE */
+  {
+    /*Set JPEG Codec to Encoding mode */
+    hjpeg->Instance->CONFR1 &= ~JPEG_CONFR1_DE;
+  }
+
+  /*Stop JPEG processing */
+  hjpeg->Instance->CONFR0 &=  ~JPEG_CONFR0_START;
+
+  /* Disable All Interrupts */
+  __HAL_JPEG_DISABLE_IT(hjpeg, JPEG_INTERRUPT_MASK);
+
+  /* Disable All DMA requests */
+  JPEG_DISABLE_DMA(hjpeg, JPEG_DMA_MASK);
+  /* Flush input and output FIFOs*/
+  hjpeg->Instance->CR |= JPEG_CR_IFF;
+  hjpeg->Instance->CR |= JPEG_CR_OFF;
+
+  /* Clear all flags */
+  __HAL_JPEG_CLEAR_FLAG(hjpeg, JPEG_FLAG_ALL);
+
+  /*Start Encoding/Decoding*/
+  hjpeg->Instance->CONFR0 |=  JPEG_CONFR0_START;
 
-  JPEG_Set_Huff_DHTMem(hjpeg);
-  error = JPEG_Set_HuffAC_Mem(hjpeg, (JPEG_ACHuffTableTypeDef *)(uint32_t)&JPEG_ACLUM_HuffTable,
-                              (hjpeg->Instance->HUFFENC_AC0));
-  if (error != HAL_OK)
+  if ((hjpeg->Context & JPEG_CONTEXT_METHOD_MASK) == JPEG_CONTEXT_IT)
   {
-    return  error;
+    /*Enable IN/OUT, end of Conversation, and end of header parsing interruptions*/
+    __HAL_JPEG_ENABLE_IT(hjpeg, JPEG_IT_IFT | JPEG_IT_IFNF | JPEG_IT_OFT | JPEG_IT_OFNE | JPEG_IT_EOC | JPEG_IT_HPD);
   }
-
-  error = JPEG_Set_HuffAC_Mem(hjpeg, (JPEG_ACHuffTableTypeDef *)(uint32_t)&JPEG_ACCHROM_HuffTable,
-                              (hjpeg->Instance->HUFFENC_AC1));
-  if (error != HAL_OK)
+  else if ((hjpeg->Context & JPEG_CONTEXT_METHOD_MASK) == JPEG_CONTEXT_DMA)
   {
-    return  error;
-  }
+    /*Enable End Of Conversation, and End Of Header parsing interruptions*/
+    __HAL_JPEG_ENABLE_IT(hjpeg, JPEG_IT_EOC | JPEG_IT_HPD);
 
-  error = JPEG_Set_HuffDC_Mem(hjpeg, (JPEG_DCHuffTableTypeDef *)(uint32_t)&JPEG_DCLUM_HuffTable,
-                              hjpeg->Instance->HUFFENC_DC0);
-  if (error != HAL_OK)
-  {
-    return  error;
   }
-
-  error = JPEG_Set_HuffDC_Mem(hjpeg, (JPEG_DCHuffTableTypeDef *)(uint32_t)&JPEG_DCCHROM_HuffTable,
-                              hjpeg->Instance->HUFFENC_DC1);
-  if (error != HAL_OK)
+  else
   {
-    return  error;
+    /* Nothing to do */
   }
-  /* Return function status */
-  return HAL_OK;
 }
 
 /**
-  * @brief  Configure the JPEG register huffman tables to be included in the JPEG
-  *         file header (used for encoding only)
+  * @brief  JPEG encoding/decoding process in case of Polling or Interrupt
   * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
   *         the configuration information for JPEG module
-  * @retval None
+  * @retval JPEG_PROCESS_DONE if the process has ends else JPEG_PROCESS_ONGOING
   */
-static void JPEG_Set_Huff_DHTMem(const JPEG_HandleTypeDef *hjpeg)
+static uint32_t JPEG_Process(JPEG_HandleTypeDef *hjpeg)
 {
-  const JPEG_ACHuffTableTypeDef *HuffTableAC0 = (JPEG_ACHuffTableTypeDef *)(uint32_t)&JPEG_ACLUM_HuffTable;
-  const JPEG_ACHuffTableTypeDef *HuffTableAC1 = (JPEG_ACHuffTableTypeDef *)(uint32_t)&JPEG_ACCHROM_HuffTable;
-  const JPEG_DCHuffTableTypeDef *HuffTableDC0 = (JPEG_DCHuffTableTypeDef *)(uint32_t)&JPEG_DCLUM_HuffTable;
-  const JPEG_DCHuffTableTypeDef *HuffTableDC1 = (JPEG_DCHuffTableTypeDef *)(uint32_t)&JPEG_DCCHROM_HuffTable;
-  uint32_t value;
-  uint32_t index;
-  __IO uint32_t *address;
+  uint32_t tmpContext;
+  uint32_t itflag = hjpeg->Instance->SR;
 
-  /* DC0 Huffman Table : BITS*/
-  /* DC0 BITS is a 16 Bytes table i.e 4x32bits words from DHTMEM base address to DHTMEM + 3*/
-  address = (hjpeg->Instance->DHTMEM + 3);
-  index = 16;
-  while (index > 3UL)
+  /*End of header processing flag */
+  if ((hjpeg->Context & JPEG_CONTEXT_OPERATION_MASK) == JPEG_CONTEXT_DECODE)
   {
+    if ((itflag & JPEG_FLAG_HPDF) != 0UL)
+    {
+      /*Call Header parsing complete callback */
+      (void) HAL_JPEG_GetInfo(hjpeg, &hjpeg->Conf);
+      /* Reset the ImageQuality */
+      hjpeg->Conf.ImageQuality = 0;
+      /* Note : the image quality is only available at the end of the decoding operation */
+      /* at the current stage the calculated image quality is not correct so reset it */
 
-    *address = (((uint32_t)HuffTableDC0->Bits[index - 1UL] & 0xFFUL) << 24) |
-               (((uint32_t)HuffTableDC0->Bits[index - 2UL] & 0xFFUL) << 16) |
-               (((uint32_t)HuffTableDC0->Bits[index - 3UL] & 0xFFUL) << 8) |
-               ((uint32_t)HuffTableDC0->Bits[index - 4UL] & 0xFFUL);
-    address--;
-    index -= 4UL;
+      /*Call Info Ready callback */
+      JPEG_InfoReadyEvent(hjpeg);
 
-  }
-  /* DC0 Huffman Table : Val*/
-  /* DC0 VALS is a 12 Bytes table i.e 3x32bits words from DHTMEM base address +4 to DHTMEM + 6 */
-  address = (hjpeg->Instance->DHTMEM + 6);
-  index = 12;
-  while (index > 3UL)
-  {
-    *address = (((uint32_t)HuffTableDC0->HuffVal[index - 1UL] & 0xFFUL) << 24) |
-               (((uint32_t)HuffTableDC0->HuffVal[index - 2UL] & 0xFFUL) << 16) |
-               (((uint32_t)HuffTableDC0->HuffVal[index - 3UL] & 0xFFUL) << 8) |
-               ((uint32_t)HuffTableDC0->HuffVal[index - 4UL] & 0xFFUL);
-    address--;
-    index -= 4UL;
+      __HAL_JPEG_DISABLE_IT(hjpeg, JPEG_IT_HPD);
+
+      /* Clear header processing done flag */
+      __HAL_JPEG_CLEAR_FLAG(hjpeg, JPEG_FLAG_HPDF);
+    }
   }
 
-  /* AC0 Huffman Table : BITS*/
-  /* AC0 BITS is a 16 Bytes table i.e 4x32bits words from DHTMEM base address + 7 to DHTMEM + 10*/
-  address = (hjpeg->Instance->DHTMEM + 10UL);
-  index = 16;
-  while (index > 3UL)
+  /*Input FIFO status handling*/
+  if ((hjpeg->Context &  JPEG_CONTEXT_PAUSE_INPUT) == 0UL)
   {
-
-    *address = (((uint32_t)HuffTableAC0->Bits[index - 1UL] & 0xFFUL) << 24) |
-               (((uint32_t)HuffTableAC0->Bits[index - 2UL] & 0xFFUL) << 16) |
-               (((uint32_t)HuffTableAC0->Bits[index - 3UL] & 0xFFUL) << 8) |
-               ((uint32_t)HuffTableAC0->Bits[index - 4UL] & 0xFFUL);
-    address--;
-    index -= 4UL;
-
+    if ((itflag & JPEG_FLAG_IFTF) != 0UL)
+    {
+      /*Input FIFO threshold flag */
+      /*JPEG_FIFO_TH_SIZE words can be written in */
+      JPEG_ReadInputData(hjpeg, JPEG_FIFO_TH_SIZE);
+    }
+    else if ((itflag & JPEG_FLAG_IFNFF) != 0UL)
+    {
+      /*Input FIFO Not Full flag */
+      /*32-bit value can be written in */
+      JPEG_ReadInputData(hjpeg, 1);
+    }
+    else
+    {
+      /* Nothing to do */
+    }
   }
-  /* AC0 Huffman Table : Val*/
-  /* AC0 VALS is a 162 Bytes table i.e 41x32bits words from DHTMEM base address + 11 to DHTMEM + 51 */
-  /* only Byte 0 and Byte 1 of the last word (@ DHTMEM + 51) belong to AC0 VALS table */
-  address = (hjpeg->Instance->DHTMEM + 51);
-  value = *address & 0xFFFF0000U;
-  value = value | (((uint32_t)HuffTableAC0->HuffVal[161] & 0xFFUL) << 8) |
-          ((uint32_t)HuffTableAC0->HuffVal[160] & 0xFFUL);
-  *address = value;
 
-  /*continue setting 160 AC0 huffman values */
-  address--; /* address = hjpeg->Instance->DHTMEM + 50*/
-  index = JPEG_AC_HUFF_TABLE_SIZE - 2UL;
-  while (index > 3UL)
+  /*Output FIFO flag handling*/
+  if ((hjpeg->Context &  JPEG_CONTEXT_PAUSE_OUTPUT) == 0UL)
   {
-    *address = (((uint32_t)HuffTableAC0->HuffVal[index - 1UL] & 0xFFUL) << 24) |
-               (((uint32_t)HuffTableAC0->HuffVal[index - 2UL] & 0xFFUL) << 16) |
-               (((uint32_t)HuffTableAC0->HuffVal[index - 3UL] & 0xFFUL) << 8) |
-               ((uint32_t)HuffTableAC0->HuffVal[index - 4UL] & 0xFFUL);
-    address--;
-    index -= 4UL;
+    if ((itflag & JPEG_FLAG_OFTF) != 0UL)
+    {
+      /*Output FIFO threshold flag */
+      /*JPEG_FIFO_TH_SIZE words can be read out */
+      JPEG_StoreOutputData(hjpeg, JPEG_FIFO_TH_SIZE);
+    }
+    else if ((itflag & JPEG_FLAG_OFNEF) != 0UL)
+    {
+      /*Output FIFO Not Empty flag */
+      /*32-bit value can be read out */
+      JPEG_StoreOutputData(hjpeg, 1);
+    }
+    else
+    {
+      /* Nothing to do */
+    }
   }
 
-  /* DC1 Huffman Table : BITS*/
-  /* DC1 BITS is a 16 Bytes table i.e 4x32bits words from DHTMEM + 51 base address to DHTMEM + 55*/
-  /* only Byte 2 and Byte 3 of the first word (@ DHTMEM + 51) belong to DC1 Bits table */
-  address = (hjpeg->Instance->DHTMEM + 51);
-  value = *address & 0x0000FFFFU;
-  value = value | (((uint32_t)HuffTableDC1->Bits[1] & 0xFFUL) << 24) |
-          (((uint32_t)HuffTableDC1->Bits[0] & 0xFFUL) << 16);
-  *address = value;
-
-  /* only Byte 0 and Byte 1 of the last word (@ DHTMEM + 55) belong to DC1 Bits table */
-  address = (hjpeg->Instance->DHTMEM + 55);
-  value = *address & 0xFFFF0000U;
-  value = value | (((uint32_t)HuffTableDC1->Bits[15] & 0xFFUL) << 8) |
-          ((uint32_t)HuffTableDC1->Bits[14] & 0xFFUL);
-  *address = value;
-
-  /*continue setting 12 DC1 huffman Bits from DHTMEM + 54 down to DHTMEM + 52*/
-  address--;
-  index = 12;
-  while (index > 3UL)
+  /*End of Conversion handling :i.e EOC flag is high and OFTF low and OFNEF low*/
+  if ((itflag & (JPEG_FLAG_EOCF | JPEG_FLAG_OFTF | JPEG_FLAG_OFNEF)) == JPEG_FLAG_EOCF)
   {
+    /*Stop Encoding/Decoding*/
+    hjpeg->Instance->CONFR0 &=  ~JPEG_CONFR0_START;
 
-    *address = (((uint32_t)HuffTableDC1->Bits[index + 1UL] & 0xFFUL) << 24) |
-               (((uint32_t)HuffTableDC1->Bits[index] & 0xFFUL) << 16) |
-               (((uint32_t)HuffTableDC1->Bits[index - 1UL] & 0xFFUL) << 8) |
-               ((uint32_t)HuffTableDC1->Bits[index - 2UL] & 0xFFUL);
-    address--;
-    index -= 4UL;
-
-  }
-  /* DC1 Huffman Table : Val*/
-  /* DC1 VALS is a 12 Bytes table i.e 3x32bits words from DHTMEM base address +55 to DHTMEM + 58 */
-  /* only Byte 2 and Byte 3 of the first word (@ DHTMEM + 55) belong to DC1 Val table */
-  address = (hjpeg->Instance->DHTMEM + 55);
-  value = *address & 0x0000FFFFUL;
-  value = value | (((uint32_t)HuffTableDC1->HuffVal[1] & 0xFFUL) << 24) |
-          (((uint32_t)HuffTableDC1->HuffVal[0] & 0xFFUL) << 16);
-  *address = value;
+    if ((hjpeg->Context & JPEG_CONTEXT_METHOD_MASK) == JPEG_CONTEXT_IT)
+    {
+      /* Disable All Interrupts */
+      __HAL_JPEG_DISABLE_IT(hjpeg, JPEG_INTERRUPT_MASK);
+    }
 
-  /* only Byte 0 and Byte 1 of the last word (@ DHTMEM + 58) belong to DC1 Val table */
-  address = (hjpeg->Instance->DHTMEM + 58);
-  value = *address & 0xFFFF0000UL;
-  value = value | (((uint32_t)HuffTableDC1->HuffVal[11] & 0xFFUL) << 8) |
-          ((uint32_t)HuffTableDC1->HuffVal[10] & 0xFFUL);
-  *address = value;
+    /* Clear all flags */
+    __HAL_JPEG_CLEAR_FLAG(hjpeg, JPEG_FLAG_ALL);
 
-  /*continue setting 8 DC1 huffman val from DHTMEM + 57 down to DHTMEM + 56*/
-  address--;
-  index = 8;
-  while (index > 3UL)
-  {
-    *address = (((uint32_t)HuffTableDC1->HuffVal[index + 1UL] & 0xFFUL) << 24) |
-               (((uint32_t)HuffTableDC1->HuffVal[index] & 0xFFUL) << 16) |
-               (((uint32_t)HuffTableDC1->HuffVal[index - 1UL] & 0xFFUL) << 8) |
-               ((uint32_t)HuffTableDC1->HuffVal[index - 2UL] & 0xFFUL);
-    address--;
-    index -= 4UL;
-  }
+    /*Call End of conversion callback */
+    if (hjpeg->JpegOutCount > 0UL)
+    {
+      /*Output Buffer is not empty, call DecodedDataReadyCallback*/
+      JPEG_DataReadyEvent(hjpeg, hjpeg->pJpegOutBuffPtr, hjpeg->JpegOutCount);
 
-  /* AC1 Huffman Table : BITS*/
-  /* AC1 BITS is a 16 Bytes table i.e 4x32bits words from DHTMEM base address + 58 to DHTMEM + 62*/
-  /* only Byte 2 and Byte 3 of the first word (@ DHTMEM + 58) belong to AC1 Bits table */
-  address = (hjpeg->Instance->DHTMEM + 58);
-  value = *address & 0x0000FFFFU;
-  value = value | (((uint32_t)HuffTableAC1->Bits[1] & 0xFFUL) << 24) |
-          (((uint32_t)HuffTableAC1->Bits[0] & 0xFFUL) << 16);
-  *address = value;
+      hjpeg->JpegOutCount = 0;
+    }
 
-  /* only Byte 0 and Byte 1 of the last word (@ DHTMEM + 62) belong to Bits Val table */
-  address = (hjpeg->Instance->DHTMEM + 62);
-  value = *address & 0xFFFF0000U;
-  value = value | (((uint32_t)HuffTableAC1->Bits[15] & 0xFFUL) << 8) | ((uint32_t)HuffTableAC1->Bits[14] & 0xFFUL);
-  *address = value;
+    /*Reset Context Operation*/
+    tmpContext = hjpeg->Context;
+    /*Clear all context fields execpt JPEG_CONTEXT_CONF_ENCODING and JPEG_CONTEXT_CUSTOM_TABLES*/
+    hjpeg->Context &= (JPEG_CONTEXT_CONF_ENCODING | JPEG_CONTEXT_CUSTOM_TABLES);
 
-  /*continue setting 12 AC1 huffman Bits from DHTMEM + 61 down to DHTMEM + 59*/
-  address--;
-  index = 12;
-  while (index > 3UL)
-  {
+    /* Process Unlocked */
+    __HAL_UNLOCK(hjpeg);
 
-    *address = (((uint32_t)HuffTableAC1->Bits[index + 1UL] & 0xFFUL) << 24) |
-               (((uint32_t)HuffTableAC1->Bits[index] & 0xFFUL) << 16) |
-               (((uint32_t)HuffTableAC1->Bits[index - 1UL] & 0xFFUL) << 8) |
-               ((uint32_t)HuffTableAC1->Bits[index - 2UL] & 0xFFUL);
-    address--;
-    index -= 4UL;
+    /* Change the JPEG state */
+    hjpeg->State = HAL_JPEG_STATE_READY;
 
-  }
-  /* AC1 Huffman Table : Val*/
-  /* AC1 VALS is a 162 Bytes table i.e 41x32bits words from DHTMEM base address + 62 to DHTMEM + 102 */
-  /* only Byte 2 and Byte 3 of the first word (@ DHTMEM + 62) belong to AC1 VALS table */
-  address = (hjpeg->Instance->DHTMEM + 62);
-  value = *address & 0x0000FFFFUL;
-  value = value | (((uint32_t)HuffTableAC1->HuffVal[1] & 0xFFUL) << 24) |
-          (((uint32_t)HuffTableAC1->HuffVal[0] & 0xFFUL) << 16);
-  *address = value;
+    /*Call End of Encoding/Decoding callback */
+    if ((tmpContext & JPEG_CONTEXT_OPERATION_MASK) == JPEG_CONTEXT_DECODE)
+    {
+#if (USE_HAL_JPEG_REGISTER_CALLBACKS == 1)
+      hjpeg->DecodeCpltCallback(hjpeg);
+#else
+      HAL_JPEG_DecodeCpltCallback(hjpeg);
+#endif /*USE_HAL_JPEG_REGISTER_CALLBACKS*/
+    }
+    else /* JPEG_CONTEXT_ENCODE */
+    {
+#if (USE_HAL_JPEG_REGISTER_CALLBACKS == 1)
+      hjpeg->EncodeCpltCallback(hjpeg);
+#else
+      HAL_JPEG_EncodeCpltCallback(hjpeg);
+#endif /*USE_HAL_JPEG_REGISTER_CALLBACKS*/
+    }
 
-  /*continue setting 160 AC1 huffman values from DHTMEM + 63 to DHTMEM+102 */
-  address = (hjpeg->Instance->DHTMEM + 102);
-  index = JPEG_AC_HUFF_TABLE_SIZE - 2UL;
-  while (index > 3UL)
-  {
-    *address = (((uint32_t)HuffTableAC1->HuffVal[index + 1UL] & 0xFFUL) << 24) |
-               (((uint32_t)HuffTableAC1->HuffVal[index] & 0xFFUL) << 16) |
-               (((uint32_t)HuffTableAC1->HuffVal[index - 1UL] & 0xFFUL) << 8) |
-               ((uint32_t)HuffTableAC1->HuffVal[index - 2UL] & 0xFFUL);
-    address--;
-    index -= 4UL;
+    return JPEG_PROCESS_DONE;
   }
 
+  return JPEG_PROCESS_ONGOING;
 }
 
 /**
-  * @brief  Configure the JPEG registers with a given quantization table
+  * @brief  Store some output data from the JPEG peripheral to the output buffer.
+  *         This function is used when the JPEG peripheral has new data to output
+  *         in case of Polling or Interrupt process
   * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
   *         the configuration information for JPEG module
-  * @param  QTable pointer to an array of 64 bytes giving the quantization table
-  * @param  QTableAddress destination quantization address in the JPEG peripheral
-  *         it could be QMEM0, QMEM1, QMEM2 or QMEM3
-  * @retval 0 if no error, 1 if error
+  * @param  nbOutputWords Number of output words (of 32 bits) ready from the JPEG peripheral
+  * @retval None
   */
-static uint32_t JPEG_Set_Quantization_Mem(const JPEG_HandleTypeDef *hjpeg, const uint8_t *QTable,
-                                          __IO uint32_t *QTableAddress)
+static void JPEG_StoreOutputData(JPEG_HandleTypeDef *hjpeg, uint32_t nbOutputWords)
 {
-  uint32_t i;
-  uint32_t j;
-  uint32_t quantRow;
-  uint32_t quantVal;
-  uint32_t ScaleFactor;
-  __IO uint32_t *tableAddress;
-
-  tableAddress = QTableAddress;
+  uint32_t index;
+  uint32_t nb_words;
+  uint32_t nb_bytes;
+  uint32_t dataword;
 
-  if ((hjpeg->Conf.ImageQuality >= 50UL) && (hjpeg->Conf.ImageQuality <= 100UL))
-  {
-    ScaleFactor = JPEG_HIGH_QUALITY_REFERENCE - (hjpeg->Conf.ImageQuality * 2UL);
-  }
-  else if (hjpeg->Conf.ImageQuality > 0UL)
-  {
-    ScaleFactor = JPEG_LOW_QUALITY_REFERENCE / ((uint32_t) hjpeg->Conf.ImageQuality);
-  }
-  else
+  if (hjpeg->OutDataLength >= (hjpeg->JpegOutCount + (nbOutputWords * 4UL)))
   {
-    return 1UL;
+    for (index = 0; index < nbOutputWords; index++)
+    {
+      /*Transfer 32 bits from the JPEG output FIFO*/
+      dataword = hjpeg->Instance->DOR;
+      hjpeg->pJpegOutBuffPtr[hjpeg->JpegOutCount] = (uint8_t)(dataword & 0x000000FFUL);
+      hjpeg->pJpegOutBuffPtr[hjpeg->JpegOutCount + 1UL] = (uint8_t)((dataword & 0x0000FF00UL) >> 8);
+      hjpeg->pJpegOutBuffPtr[hjpeg->JpegOutCount + 2UL] = (uint8_t)((dataword & 0x00FF0000UL) >> 16);
+      hjpeg->pJpegOutBuffPtr[hjpeg->JpegOutCount + 3UL] = (uint8_t)((dataword & 0xFF000000UL) >> 24);
+      hjpeg->JpegOutCount += 4UL;
+    }
+    if (hjpeg->OutDataLength == hjpeg->JpegOutCount)
+    {
+      /*Output Buffer is full, call DecodedDataReadyCallback*/
+      JPEG_DataReadyEvent(hjpeg, hjpeg->pJpegOutBuffPtr, hjpeg->JpegOutCount);
+      hjpeg->JpegOutCount = 0;
+    }
   }
-
-  /*Quantization_table = (Standard_quanization_table * ScaleFactor + 50) / 100*/
-  i = 0;
-  while (i < (JPEG_QUANT_TABLE_SIZE - 3UL))
+  else if (hjpeg->OutDataLength > hjpeg->JpegOutCount)
   {
-    quantRow = 0;
-    for (j = 0; j < 4UL; j++)
+    nb_words = (hjpeg->OutDataLength - hjpeg->JpegOutCount) / 4UL;
+    for (index = 0; index < nb_words; index++)
     {
-      /* Note that the quantization coefficients must be specified in the table in zigzag order */
-      quantVal = ((((uint32_t) QTable[JPEG_ZIGZAG_ORDER[i + j]]) * ScaleFactor) + 50UL) / 100UL;
-
-      if (quantVal == 0UL)
-      {
-        quantVal = 1UL;
-      }
-      else if (quantVal > 255UL)
+      /*Transfer 32 bits from the JPEG output FIFO*/
+      dataword = hjpeg->Instance->DOR;
+      hjpeg->pJpegOutBuffPtr[hjpeg->JpegOutCount] = (uint8_t)(dataword & 0x000000FFUL);
+      hjpeg->pJpegOutBuffPtr[hjpeg->JpegOutCount + 1UL] = (uint8_t)((dataword & 0x0000FF00UL) >> 8);
+      hjpeg->pJpegOutBuffPtr[hjpeg->JpegOutCount + 2UL] = (uint8_t)((dataword & 0x00FF0000UL) >> 16);
+      hjpeg->pJpegOutBuffPtr[hjpeg->JpegOutCount + 3UL] = (uint8_t)((dataword & 0xFF000000UL) >> 24);
+      hjpeg->JpegOutCount += 4UL;
+    }
+    if (hjpeg->OutDataLength == hjpeg->JpegOutCount)
+    {
+      /*Output Buffer is full, call DecodedDataReadyCallback*/
+      JPEG_DataReadyEvent(hjpeg, hjpeg->pJpegOutBuffPtr, hjpeg->JpegOutCount);
+      hjpeg->JpegOutCount = 0;
+    }
+    else
+    {
+      nb_bytes = hjpeg->OutDataLength - hjpeg->JpegOutCount;
+      dataword = hjpeg->Instance->DOR;
+      for (index = 0; index < nb_bytes; index++)
       {
-        quantVal = JPEG_QUANTVAL_MAX;
+        hjpeg->pJpegOutBuffPtr[hjpeg->JpegOutCount] = (uint8_t)((dataword >> (8UL * (index & 0x3UL))) & 0xFFUL);
+        hjpeg->JpegOutCount++;
       }
-      else
+      /*Output Buffer is full, call DecodedDataReadyCallback*/
+      JPEG_DataReadyEvent(hjpeg, hjpeg->pJpegOutBuffPtr, hjpeg->JpegOutCount);
+
+      hjpeg->JpegOutCount = 0;
+
+      nb_bytes = 4UL - nb_bytes;
+      for (index = nb_bytes; index < 4UL; index++)
       {
-        /* Nothing to do, keep same value of quantVal */
+        hjpeg->pJpegOutBuffPtr[hjpeg->JpegOutCount] = (uint8_t)((dataword >> (8UL * index)) & 0xFFUL);
+        hjpeg->JpegOutCount++;
       }
-
-      quantRow |= ((quantVal & 0xFFUL) << (8UL * j));
     }
-
-    i += 4UL;
-    *tableAddress = quantRow;
-    tableAddress ++;
   }
-
-  /* Return function status */
-  return 0UL;
+  else
+  {
+    /* Nothing to do */
+  }
 }
 
 /**
-  * @brief  Configure the JPEG registers for YCbCr color space
+  * @brief  Read some input Data from the input buffer.
+  *         This function is used when the JPEG peripheral needs new data
+  *         in case of Polling or Interrupt process
   * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
   *         the configuration information for JPEG module
+  * @param  nbRequestWords Number of input words (of 32 bits) that the JPE peripheral request
   * @retval None
   */
-static void JPEG_SetColorYCBCR(JPEG_HandleTypeDef *hjpeg)
+static void JPEG_ReadInputData(JPEG_HandleTypeDef *hjpeg, uint32_t nbRequestWords)
 {
-  uint32_t ySamplingH;
-  uint32_t ySamplingV;
-  uint32_t yblockNb;
-
-  /*Set Number of color components to 3*/
-  hjpeg->Instance->CONFR1 &=  ~JPEG_CONFR1_NF;
-  hjpeg->Instance->CONFR1 |=  JPEG_CONFR1_NF_1;
+  uint32_t nb_bytes = 0;
+  uint32_t nb_words;
+  uint32_t index;
+  uint32_t dataword;
+  uint32_t input_count;
 
-  /* compute MCU block size and Y, Cb ,Cr sampling factors*/
-  if (hjpeg->Conf.ChromaSubsampling == JPEG_420_SUBSAMPLING)
+  if ((hjpeg->InDataLength == 0UL) || (nbRequestWords == 0UL))
   {
-    ySamplingH  = JPEG_CONFR4_HSF_1;   /* Hs = 2*/
-    ySamplingV  = JPEG_CONFR4_VSF_1;   /* Vs = 2*/
-
-    yblockNb  = 0x30; /* 4 blocks of 8x8*/
+    /* No more Input data : nothing to do*/
+    (void) HAL_JPEG_Pause(hjpeg, JPEG_PAUSE_RESUME_INPUT);
   }
-  else if (hjpeg->Conf.ChromaSubsampling == JPEG_422_SUBSAMPLING)
+  else if (hjpeg->InDataLength > hjpeg->JpegInCount)
   {
-    ySamplingH  = JPEG_CONFR4_HSF_1;   /* Hs = 2*/
-    ySamplingV  = JPEG_CONFR4_VSF_0;   /* Vs = 1*/
-
-    yblockNb  = 0x10; /* 2 blocks of 8x8*/
+    nb_bytes = hjpeg->InDataLength - hjpeg->JpegInCount;
   }
-  else /*JPEG_444_SUBSAMPLING and default*/
+  else if (hjpeg->InDataLength == hjpeg->JpegInCount)
   {
-    ySamplingH  = JPEG_CONFR4_HSF_0;   /* Hs = 1*/
-    ySamplingV  = JPEG_CONFR4_VSF_0;   /* Vs = 1*/
+    /*Call HAL_JPEG_GetDataCallback to get new data */
+    JPEG_GetDataEvent(hjpeg, hjpeg->JpegInCount);
 
-    yblockNb  = 0; /* 1 block of 8x8*/
+    if (hjpeg->InDataLength > 4UL)
+    {
+      hjpeg->InDataLength = ((hjpeg->InDataLength + 3UL) / 4UL) * 4UL;
+    }
+    hjpeg->JpegInCount = 0;
+    nb_bytes = hjpeg->InDataLength;
   }
+  else
+  {
+    /* Nothing to do */
+  }
+  if (((hjpeg->Context &  JPEG_CONTEXT_PAUSE_INPUT) == 0UL) && (nb_bytes > 0UL))
+  {
+    nb_words = nb_bytes / 4UL;
+    if (nb_words >= nbRequestWords)
+    {
+      for (index = 0; index < nbRequestWords; index++)
+      {
+        input_count = hjpeg->JpegInCount;
+        hjpeg->Instance->DIR = (((uint32_t)(hjpeg->pJpegInBuffPtr[input_count])) | \
+                                (((uint32_t)(hjpeg->pJpegInBuffPtr[input_count + 1UL])) << 8) | \
+                                (((uint32_t)(hjpeg->pJpegInBuffPtr[input_count + 2UL])) << 16) | \
+                                (((uint32_t)(hjpeg->pJpegInBuffPtr[input_count + 3UL])) << 24));
 
-  hjpeg->Instance->CONFR1 &= ~(JPEG_CONFR1_NF | JPEG_CONFR1_NS);
-  hjpeg->Instance->CONFR1 |= (JPEG_CONFR1_NF_1 | JPEG_CONFR1_NS_1);
-
-  /*Reset CONFR4 register*/
-  hjpeg->Instance->CONFR4 =  0;
-  /*Set Horizental and Vertical  sampling factor , number of blocks,
-   Quantization table and Huffman AC/DC tables for component 0*/
-  hjpeg->Instance->CONFR4 |= (ySamplingH | ySamplingV | (yblockNb & JPEG_CONFR4_NB));
-
-  /*Reset CONFR5 register*/
-  hjpeg->Instance->CONFR5 =  0;
-  /*Set Horizental and Vertical  sampling factor , number of blocks,
-    Quantization table and Huffman AC/DC tables for component 1*/
-  hjpeg->Instance->CONFR5 |= (JPEG_CONFR5_HSF_0 | JPEG_CONFR5_VSF_0 | JPEG_CONFR5_QT_0 | JPEG_CONFR5_HA |
-                              JPEG_CONFR5_HD);
-
-  /*Reset CONFR6 register*/
-  hjpeg->Instance->CONFR6 =  0;
-  /*Set Horizental and Vertical  sampling factor and number of blocks for component 2*/
-  /* In YCBCR , by default, both chrominance components (component 1 and component 2)
-     use the same Quantization table (table 1) */
-  /* In YCBCR , both chrominance components (component 1 and component 2) use the same Huffman tables (table 1) */
-  hjpeg->Instance->CONFR6 |= (JPEG_CONFR6_HSF_0 | JPEG_CONFR6_VSF_0 | JPEG_CONFR6_QT_0 | JPEG_CONFR6_HA |
-                              JPEG_CONFR6_HD);
+        hjpeg->JpegInCount += 4UL;
+      }
+    }
+    else /*nb_words < nbRequestWords*/
+    {
+      if (nb_words > 0UL)
+      {
+        for (index = 0; index < nb_words; index++)
+        {
+          input_count = hjpeg->JpegInCount;
+          hjpeg->Instance->DIR = (((uint32_t)(hjpeg->pJpegInBuffPtr[input_count])) | \
+                                  (((uint32_t)(hjpeg->pJpegInBuffPtr[input_count + 1UL])) << 8) | \
+                                  (((uint32_t)(hjpeg->pJpegInBuffPtr[input_count + 2UL])) << 16) | \
+                                  (((uint32_t)(hjpeg->pJpegInBuffPtr[input_count + 3UL])) << 24));
 
+          hjpeg->JpegInCount += 4UL;
+        }
+      }
+      else
+      {
+        /* end of file*/
+        dataword = 0;
+        for (index = 0; index < nb_bytes; index++)
+        {
+          dataword |= (uint32_t)hjpeg->pJpegInBuffPtr[hjpeg->JpegInCount] << (8UL * (index & 0x03UL));
+          hjpeg->JpegInCount++;
+        }
+        hjpeg->Instance->DIR = dataword;
+      }
+    }
+  }
 }
 
 /**
-  * @brief  Configure the JPEG registers for GrayScale color space
+  * @brief  Start the JPEG DMA process (encoding/decoding)
+  * @note   The DMA interrupt must have a higher priority than the JPEG 
+  *         interrupt to prevent the JPEG interrupt from preempting the DMA interrupt
+  *         before the DMA state is updated to ready.
   * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
   *         the configuration information for JPEG module
-  * @retval None
+  * @retval JPEG_PROCESS_DONE if process ends else JPEG_PROCESS_ONGOING
   */
-static void JPEG_SetColorGrayScale(JPEG_HandleTypeDef *hjpeg)
+static HAL_StatusTypeDef JPEG_DMA_StartProcess(JPEG_HandleTypeDef *hjpeg)
 {
-  /*Set Number of color components to 1*/
-  hjpeg->Instance->CONFR1 &= ~(JPEG_CONFR1_NF | JPEG_CONFR1_NS);
-
-  /*in GrayScale use 1 single Quantization table (Table 0)*/
-  /*in GrayScale use only one couple of AC/DC huffman table (table 0)*/
+  if ((hjpeg->InDataLength < 4UL) || (hjpeg->OutDataLength < 4UL))
+  {
+    return HAL_ERROR;
+  }
+  /* Reset Ending DMA internal context flag*/
+  hjpeg->Context &= ~JPEG_CONTEXT_ENDING_DMA;
 
-  /*Reset CONFR4 register*/
-  hjpeg->Instance->CONFR4 =  0;
-  /*Set Horizental and Vertical  sampling factor , number of blocks,
-    Quantization table and Huffman AC/DC tables for component 0*/
-  hjpeg->Instance->CONFR4 |=  JPEG_CONFR4_HSF_0 | JPEG_CONFR4_VSF_0 ;
-}
+  /* Disable DMA In/Out Request*/
+  JPEG_DISABLE_DMA(hjpeg, JPEG_DMA_ODMA | JPEG_DMA_IDMA);
 
-/**
-  * @brief  Configure the JPEG registers for CMYK color space
-  * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
-  *         the configuration information for JPEG module
-  * @retval None
-  */
-static void JPEG_SetColorCMYK(JPEG_HandleTypeDef *hjpeg)
-{
-  uint32_t ySamplingH;
-  uint32_t ySamplingV;
-  uint32_t yblockNb;
+  /* Set the JPEG DMA In transfer complete callback */
+  hjpeg->hdmain->XferCpltCallback = JPEG_DMAInCpltCallback;
+  /* Set the DMA In error callback */
+  hjpeg->hdmain->XferErrorCallback = JPEG_DMAErrorCallback;
 
-  /*Set Number of color components to 4*/
-  hjpeg->Instance->CONFR1 |= (JPEG_CONFR1_NF | JPEG_CONFR1_NS);
+  /* Set the JPEG DMA Out transfer complete callback */
+  hjpeg->hdmaout->XferCpltCallback = JPEG_DMAOutCpltCallback;
+  /* Set the DMA Out error callback */
+  hjpeg->hdmaout->XferErrorCallback = JPEG_DMAErrorCallback;
+  /* Set the DMA Out Abort callback */
+  hjpeg->hdmaout->XferAbortCallback = JPEG_DMAOutAbortCallback;
 
-  /* compute MCU block size and Y, Cb ,Cr sampling factors*/
-  if (hjpeg->Conf.ChromaSubsampling == JPEG_420_SUBSAMPLING)
-  {
-    ySamplingH  = JPEG_CONFR4_HSF_1;   /* Hs = 2*/
-    ySamplingV  = JPEG_CONFR4_VSF_1;   /* Vs = 2*/
+  /*DMA transfer size must be a multiple of 4 bytes i.e multiple of 32bits words*/
+  hjpeg->InDataLength = hjpeg->InDataLength - (hjpeg->InDataLength % 4UL);
 
-    yblockNb  = 0x30; /* 4 blocks of 8x8*/
-  }
-  else if (hjpeg->Conf.ChromaSubsampling == JPEG_422_SUBSAMPLING)
-  {
-    ySamplingH  = JPEG_CONFR4_HSF_1;   /* Hs = 2*/
-    ySamplingV  = JPEG_CONFR4_VSF_0;   /* Vs = 1*/
+  /*DMA transfer size must be a multiple of 4 bytes i.e multiple of 32bits words*/
+  hjpeg->OutDataLength = hjpeg->OutDataLength - (hjpeg->OutDataLength % 4UL);
 
-    yblockNb  = 0x10; /* 2 blocks of 8x8*/
-  }
-  else /*JPEG_444_SUBSAMPLING and default*/
+  if ((hjpeg->hdmain->Mode & DMA_LINKEDLIST) == DMA_LINKEDLIST)
   {
-    ySamplingH  = JPEG_CONFR4_HSF_0;   /* Hs = 1*/
-    ySamplingV  = JPEG_CONFR4_VSF_0;   /* Vs = 1*/
-
-    yblockNb  = 0; /* 1 block of 8x8*/
-  }
+    if (hjpeg->hdmain->LinkedListQueue != NULL)
+    {
+      /* Set DMA data size */
+      hjpeg->hdmain->LinkedListQueue->Head->LinkRegisters[NODE_CBR1_DEFAULT_OFFSET] = hjpeg->InDataLength;
 
-  /*Reset CONFR4 register*/
-  hjpeg->Instance->CONFR4 =  0;
-  /*Set Horizental and Vertical  sampling factor , number of blocks,
-    Quantization table and Huffman AC/DC tables for component 0*/
-  hjpeg->Instance->CONFR4 |= (ySamplingH | ySamplingV | (yblockNb & JPEG_CONFR4_NB));
+      /* Set DMA source address */
+      hjpeg->hdmain->LinkedListQueue->Head->LinkRegisters[NODE_CSAR_DEFAULT_OFFSET] = (uint32_t)hjpeg->pJpegInBuffPtr;
 
-  /*Reset CONFR5 register*/
-  hjpeg->Instance->CONFR5 =  0;
-  /*Set Horizental and Vertical  sampling factor , number of blocks,
-    Quantization table and Huffman AC/DC tables for component 1*/
-  hjpeg->Instance->CONFR5 |= (JPEG_CONFR5_HSF_0 | JPEG_CONFR5_VSF_0);
+      /* Set DMA destination address */
+      hjpeg->hdmain->LinkedListQueue->Head->LinkRegisters[NODE_CDAR_DEFAULT_OFFSET] = (uint32_t)&hjpeg->Instance->DIR;
 
-  /*Reset CONFR6 register*/
-  hjpeg->Instance->CONFR6 =  0;
-  /*Set Horizental and Vertical  sampling factor , number of blocks,
-    Quantization table and Huffman AC/DC tables for component 2*/
-  hjpeg->Instance->CONFR6 |= (JPEG_CONFR6_HSF_0 | JPEG_CONFR6_VSF_0);
+      if (HAL_DMAEx_List_Start_IT(hjpeg->hdmain) != HAL_OK)
+      {
+        return HAL_ERROR;
+      }
+    }
+    else
+    {
+      /* Set the JPEG State to ready */
+      hjpeg->State = HAL_JPEG_STATE_READY;
 
-  /*Reset CONFR7 register*/
-  hjpeg->Instance->CONFR7 =  0;
-  /*Set Horizental and Vertical  sampling factor , number of blocks,
-    Quantization table and Huffman AC/DC tables for component 3*/
-  hjpeg->Instance->CONFR7 |= (JPEG_CONFR7_HSF_0 | JPEG_CONFR7_VSF_0);
-}
+      /* Update JPEG error code */
+      hjpeg->ErrorCode |= HAL_JPEG_ERROR_DMA;
 
-/**
-  * @brief  Init the JPEG encoding/decoding process in case of Polling or Interrupt and DMA
-  * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
-  *         the configuration information for JPEG module
-  * @retval None
-  */
-static void JPEG_Init_Process(JPEG_HandleTypeDef *hjpeg)
-{
-  /*Reset pause*/
-  hjpeg->Context &= (~(JPEG_CONTEXT_PAUSE_INPUT | JPEG_CONTEXT_PAUSE_OUTPUT));
+      /* Process Unlocked */
+      __HAL_UNLOCK(hjpeg);
 
-  if ((hjpeg->Context & JPEG_CONTEXT_OPERATION_MASK) == JPEG_CONTEXT_DECODE)
-  {
-    /*Set JPEG Codec to Decoding mode */
-    hjpeg->Instance->CONFR1 |= JPEG_CONFR1_DE;
+      return HAL_ERROR;
+    }
   }
-  else /* JPEG_CONTEXT_ENCODE */
+  else
   {
-    /*Set JPEG Codec to Encoding mode */
-    hjpeg->Instance->CONFR1 &= ~JPEG_CONFR1_DE;
+    /* Start DMA FIFO In transfer */
+    if (HAL_DMA_Start_IT(hjpeg->hdmain, (uint32_t)hjpeg->pJpegInBuffPtr, (uint32_t)&hjpeg->Instance->DIR,
+                         hjpeg->InDataLength)  != HAL_OK)
+    {
+      hjpeg->ErrorCode |= HAL_JPEG_ERROR_DMA;
+      return HAL_ERROR;
+    }
   }
 
-  /*Stop JPEG processing */
-  hjpeg->Instance->CONFR0 &=  ~JPEG_CONFR0_START;
+  if ((hjpeg->hdmaout->Mode & DMA_LINKEDLIST) == DMA_LINKEDLIST)
+  {
+    if (hjpeg->hdmaout->LinkedListQueue != NULL)
+    {
+      /* Set DMA data size */
+      hjpeg->hdmaout->LinkedListQueue->Head->LinkRegisters[NODE_CBR1_DEFAULT_OFFSET] = hjpeg->OutDataLength;
 
-  /* Disable All Interrupts */
-  __HAL_JPEG_DISABLE_IT(hjpeg, JPEG_INTERRUPT_MASK);
+      /* Set DMA source address */
+      hjpeg->hdmaout->LinkedListQueue->Head->LinkRegisters[NODE_CSAR_DEFAULT_OFFSET] = (uint32_t)&hjpeg->Instance->DOR;
 
-  /* Disable All DMA requests */
-  JPEG_DISABLE_DMA(hjpeg, JPEG_DMA_MASK);
-  /* Flush input and output FIFOs*/
-  hjpeg->Instance->CR |= JPEG_CR_IFF;
-  hjpeg->Instance->CR |= JPEG_CR_OFF;
+      /* Set DMA destination address */
+      hjpeg->hdmaout->LinkedListQueue->Head->LinkRegisters[NODE_CDAR_DEFAULT_OFFSET] = (uint32_t)hjpeg->pJpegOutBuffPtr;
 
-  /* Clear all flags */
-  __HAL_JPEG_CLEAR_FLAG(hjpeg, JPEG_FLAG_ALL);
+      if (HAL_DMAEx_List_Start_IT(hjpeg->hdmaout) != HAL_OK)
+      {
+        return HAL_ERROR;
+      }
+    }
+    else
+    {
+      /* Set the JPEG State to ready */
+      hjpeg->State = HAL_JPEG_STATE_READY;
 
-  /*Start Encoding/Decoding*/
-  hjpeg->Instance->CONFR0 |=  JPEG_CONFR0_START;
+      /* Update JPEG error code */
+      hjpeg->ErrorCode |= HAL_JPEG_ERROR_DMA;
 
-  if ((hjpeg->Context & JPEG_CONTEXT_METHOD_MASK) == JPEG_CONTEXT_IT)
-  {
-    /*Enable IN/OUT, end of Conversation, and end of header parsing interruptions*/
-    __HAL_JPEG_ENABLE_IT(hjpeg, JPEG_IT_IFT | JPEG_IT_IFNF | JPEG_IT_OFT | JPEG_IT_OFNE | JPEG_IT_EOC | JPEG_IT_HPD);
-  }
-  else if ((hjpeg->Context & JPEG_CONTEXT_METHOD_MASK) == JPEG_CONTEXT_DMA)
-  {
-    /*Enable End Of Conversation, and End Of Header parsing interruptions*/
-    __HAL_JPEG_ENABLE_IT(hjpeg, JPEG_IT_EOC | JPEG_IT_HPD);
+      /* Process Unlocked */
+      __HAL_UNLOCK(hjpeg);
 
+      return HAL_ERROR;
+    }
   }
   else
   {
-    /* Nothing to do */
+    /* Start DMA FIFO Out transfer */
+    if (HAL_DMA_Start_IT(hjpeg->hdmaout, (uint32_t)&hjpeg->Instance->DOR, (uint32_t)hjpeg->pJpegOutBuffPtr,
+                         hjpeg->OutDataLength)  != HAL_OK)
+    {
+      hjpeg->ErrorCode |= HAL_JPEG_ERROR_DMA;
+      return HAL_ERROR;
+    }
   }
+
+  /* Enable JPEG In/Out DMA requests*/
+  JPEG_ENABLE_DMA(hjpeg, JPEG_DMA_IDMA | JPEG_DMA_ODMA);
+
+  return HAL_OK;
 }
 
 /**
-  * @brief  JPEG encoding/decoding process in case of Polling or Interrupt
+  * @brief  Continue the current JPEG DMA process (encoding/decoding)
   * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
   *         the configuration information for JPEG module
-  * @retval JPEG_PROCESS_DONE if the process has ends else JPEG_PROCESS_ONGOING
+  * @retval JPEG_PROCESS_DONE if process ends else JPEG_PROCESS_ONGOING
   */
-static uint32_t JPEG_Process(JPEG_HandleTypeDef *hjpeg)
+static void JPEG_DMA_ContinueProcess(JPEG_HandleTypeDef *hjpeg)
 {
-  uint32_t tmpContext;
   uint32_t itflag = hjpeg->Instance->SR;
 
-  /*End of header processing flag */
+  /*End of header processing flag rises*/
   if ((hjpeg->Context & JPEG_CONTEXT_OPERATION_MASK) == JPEG_CONTEXT_DECODE)
   {
     if ((itflag & JPEG_FLAG_HPDF) != 0UL)
     {
       /*Call Header parsing complete callback */
       (void) HAL_JPEG_GetInfo(hjpeg, &hjpeg->Conf);
+
       /* Reset the ImageQuality */
       hjpeg->Conf.ImageQuality = 0;
       /* Note : the image quality is only available at the end of the decoding operation */
       /* at the current stage the calculated image quality is not correct so reset it */
 
       /*Call Info Ready callback */
-#if (USE_HAL_JPEG_REGISTER_CALLBACKS == 1)
-      hjpeg->InfoReadyCallback(hjpeg, &hjpeg->Conf);
-#else
-      HAL_JPEG_InfoReadyCallback(hjpeg, &hjpeg->Conf);
-#endif /* USE_HAL_JPEG_REGISTER_CALLBACKS */
+      JPEG_InfoReadyEvent(hjpeg);
 
       __HAL_JPEG_DISABLE_IT(hjpeg, JPEG_IT_HPD);
 
@@ -3397,77 +4402,73 @@ static uint32_t JPEG_Process(JPEG_HandleTypeDef *hjpeg)
     }
   }
 
-  /*Input FIFO status handling*/
-  if ((hjpeg->Context &  JPEG_CONTEXT_PAUSE_INPUT) == 0UL)
+  /*End of Conversion handling*/
+  if ((itflag & JPEG_FLAG_EOCF) != 0UL)
   {
-    if ((itflag & JPEG_FLAG_IFTF) != 0UL)
-    {
-      /*Input FIFO threshold flag */
-      /*JPEG_FIFO_TH_SIZE words can be written in */
-      JPEG_ReadInputData(hjpeg, JPEG_FIFO_TH_SIZE);
-    }
-    else if ((itflag & JPEG_FLAG_IFNFF) != 0UL)
-    {
-      /*Input FIFO Not Full flag */
-      /*32-bit value can be written in */
-      JPEG_ReadInputData(hjpeg, 1);
-    }
-    else
-    {
-      /* Nothing to do */
-    }
-  }
+    /*Disable JPEG In/Out DMA Requests*/
+    JPEG_DISABLE_DMA(hjpeg, JPEG_DMA_ODMA | JPEG_DMA_IDMA);
+
+    hjpeg->Context |= JPEG_CONTEXT_ENDING_DMA;
 
-  /*Output FIFO flag handling*/
-  if ((hjpeg->Context &  JPEG_CONTEXT_PAUSE_OUTPUT) == 0UL)
-  {
-    if ((itflag & JPEG_FLAG_OFTF) != 0UL)
+    /*Stop Encoding/Decoding*/
+    hjpeg->Instance->CONFR0 &=  ~JPEG_CONFR0_START;
+
+    __HAL_JPEG_DISABLE_IT(hjpeg, JPEG_INTERRUPT_MASK);
+
+    /* Clear all flags */
+    __HAL_JPEG_CLEAR_FLAG(hjpeg, JPEG_FLAG_ALL);
+
+    if (hjpeg->hdmain->State == HAL_DMA_STATE_BUSY)
     {
-      /*Output FIFO threshold flag */
-      /*JPEG_FIFO_TH_SIZE words can be read out */
-      JPEG_StoreOutputData(hjpeg, JPEG_FIFO_TH_SIZE);
+      /* Stop the DMA In Xfer*/
+      (void) HAL_DMA_Abort_IT(hjpeg->hdmain);
     }
-    else if ((itflag & JPEG_FLAG_OFNEF) != 0UL)
+
+    if (hjpeg->hdmaout->State == HAL_DMA_STATE_BUSY)
     {
-      /*Output FIFO Not Empty flag */
-      /*32-bit value can be read out */
-      JPEG_StoreOutputData(hjpeg, 1);
+      /* Stop the DMA out Xfer*/
+      (void) HAL_DMA_Abort_IT(hjpeg->hdmaout);
     }
     else
     {
-      /* Nothing to do */
+      JPEG_DMA_EndProcess(hjpeg);
     }
   }
+}
 
-  /*End of Conversion handling :i.e EOC flag is high and OFTF low and OFNEF low*/
-  if ((itflag & (JPEG_FLAG_EOCF | JPEG_FLAG_OFTF | JPEG_FLAG_OFNEF)) == JPEG_FLAG_EOCF)
-  {
-    /*Stop Encoding/Decoding*/
-    hjpeg->Instance->CONFR0 &=  ~JPEG_CONFR0_START;
+/**
+  * @brief  Finalize the current JPEG DMA process (encoding/decoding)
+  * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
+  *         the configuration information for JPEG module
+  * @retval JPEG_PROCESS_DONE
+  */
+static void JPEG_DMA_EndProcess(JPEG_HandleTypeDef *hjpeg)
+{
+  uint32_t tmpContext;
+  hjpeg->JpegOutCount = hjpeg->OutDataLength - JPEG_GET_DMA_REMAIN_DATA(hjpeg->hdmaout);
 
-    if ((hjpeg->Context & JPEG_CONTEXT_METHOD_MASK) == JPEG_CONTEXT_IT)
-    {
-      /* Disable All Interrupts */
-      __HAL_JPEG_DISABLE_IT(hjpeg, JPEG_INTERRUPT_MASK);
-    }
+  /*if Output Buffer is full, call HAL_JPEG_DataReadyCallback*/
+  if (hjpeg->JpegOutCount == hjpeg->OutDataLength)
+  {
+    JPEG_DataReadyEvent(hjpeg, hjpeg->pJpegOutBuffPtr, hjpeg->JpegOutCount);
 
-    /* Clear all flags */
-    __HAL_JPEG_CLEAR_FLAG(hjpeg, JPEG_FLAG_ALL);
+    hjpeg->JpegOutCount = 0;
+  }
 
-    /*Call End of conversion callback */
+  /*Check if remaining data in the output FIFO*/
+  if (__HAL_JPEG_GET_FLAG(hjpeg, JPEG_FLAG_OFNEF) == 0UL)
+  {
     if (hjpeg->JpegOutCount > 0UL)
     {
       /*Output Buffer is not empty, call DecodedDataReadyCallback*/
-#if (USE_HAL_JPEG_REGISTER_CALLBACKS == 1)
-      hjpeg->DataReadyCallback(hjpeg, hjpeg->pJpegOutBuffPtr, hjpeg->JpegOutCount);
-#else
-      HAL_JPEG_DataReadyCallback(hjpeg, hjpeg->pJpegOutBuffPtr, hjpeg->JpegOutCount);
-#endif /* USE_HAL_JPEG_REGISTER_CALLBACKS */
+      JPEG_DataReadyEvent(hjpeg, hjpeg->pJpegOutBuffPtr, hjpeg->JpegOutCount);
 
       hjpeg->JpegOutCount = 0;
     }
 
-    /*Reset Context Operation*/
+    /*Stop Encoding/Decoding*/
+    hjpeg->Instance->CONFR0 &=  ~JPEG_CONFR0_START;
+
     tmpContext = hjpeg->Context;
     /*Clear all context fields execpt JPEG_CONTEXT_CONF_ENCODING and JPEG_CONTEXT_CUSTOM_TABLES*/
     hjpeg->Context &= (JPEG_CONTEXT_CONF_ENCODING | JPEG_CONTEXT_CUSTOM_TABLES);
@@ -3485,7 +4486,7 @@ static uint32_t JPEG_Process(JPEG_HandleTypeDef *hjpeg)
       hjpeg->DecodeCpltCallback(hjpeg);
 #else
       HAL_JPEG_DecodeCpltCallback(hjpeg);
-#endif /*USE_HAL_JPEG_REGISTER_CALLBACKS*/
+#endif /* USE_HAL_JPEG_REGISTER_CALLBACKS */
     }
     else /* JPEG_CONTEXT_ENCODE */
     {
@@ -3493,781 +4494,1023 @@ static uint32_t JPEG_Process(JPEG_HandleTypeDef *hjpeg)
       hjpeg->EncodeCpltCallback(hjpeg);
 #else
       HAL_JPEG_EncodeCpltCallback(hjpeg);
-#endif /*USE_HAL_JPEG_REGISTER_CALLBACKS*/
+#endif /* USE_HAL_JPEG_REGISTER_CALLBACKS */
     }
-
-    return JPEG_PROCESS_DONE;
+  }
+  else if ((hjpeg->Context &  JPEG_CONTEXT_PAUSE_OUTPUT) == 0UL)
+  {
+    JPEG_DMA_PollResidualData(hjpeg);
+  }
+  else
+  {
+    /* Nothing to do */
   }
 
-  return JPEG_PROCESS_ONGOING;
 }
 
 /**
-  * @brief  Store some output data from the JPEG peripheral to the output buffer.
-  *         This function is used when the JPEG peripheral has new data to output
-  *         in case of Polling or Interrupt process
+  * @brief  Poll residual output data when DMA process (encoding/decoding)
   * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
   *         the configuration information for JPEG module
-  * @param  nbOutputWords Number of output words (of 32 bits) ready from the JPEG peripheral
-  * @retval None
+  * @retval None.
   */
-static void JPEG_StoreOutputData(JPEG_HandleTypeDef *hjpeg, uint32_t nbOutputWords)
+static void JPEG_DMA_PollResidualData(JPEG_HandleTypeDef *hjpeg)
 {
-  uint32_t index;
-  uint32_t nb_words;
-  uint32_t nb_bytes;
-  uint32_t dataword;
+  uint32_t tmpContext;
+  uint32_t count;
+  uint32_t dataOut;
 
-  if (hjpeg->OutDataLength >= (hjpeg->JpegOutCount + (nbOutputWords * 4UL)))
+  for (count = JPEG_FIFO_SIZE; count > 0UL; count--)
   {
-    for (index = 0; index < nbOutputWords; index++)
-    {
-      /*Transfer 32 bits from the JPEG output FIFO*/
-      dataword = hjpeg->Instance->DOR;
-      hjpeg->pJpegOutBuffPtr[hjpeg->JpegOutCount] = (uint8_t)(dataword & 0x000000FFUL);
-      hjpeg->pJpegOutBuffPtr[hjpeg->JpegOutCount + 1UL] = (uint8_t)((dataword & 0x0000FF00UL) >> 8);
-      hjpeg->pJpegOutBuffPtr[hjpeg->JpegOutCount + 2UL] = (uint8_t)((dataword & 0x00FF0000UL) >> 16);
-      hjpeg->pJpegOutBuffPtr[hjpeg->JpegOutCount + 3UL] = (uint8_t)((dataword & 0xFF000000UL) >> 24);
-      hjpeg->JpegOutCount += 4UL;
-    }
-    if (hjpeg->OutDataLength == hjpeg->JpegOutCount)
+    if ((hjpeg->Context &  JPEG_CONTEXT_PAUSE_OUTPUT) == 0UL)
     {
-      /*Output Buffer is full, call DecodedDataReadyCallback*/
-#if (USE_HAL_JPEG_REGISTER_CALLBACKS == 1)
-      hjpeg->DataReadyCallback(hjpeg, hjpeg->pJpegOutBuffPtr, hjpeg->JpegOutCount);
-#else
-      HAL_JPEG_DataReadyCallback(hjpeg, hjpeg->pJpegOutBuffPtr, hjpeg->JpegOutCount);
-#endif /*USE_HAL_JPEG_REGISTER_CALLBACKS*/
-      hjpeg->JpegOutCount = 0;
+      if (__HAL_JPEG_GET_FLAG(hjpeg, JPEG_FLAG_OFNEF) != 0UL)
+      {
+        dataOut = hjpeg->Instance->DOR;
+        hjpeg->pJpegOutBuffPtr[hjpeg->JpegOutCount] = (uint8_t)(dataOut & 0x000000FFUL);
+        hjpeg->pJpegOutBuffPtr[hjpeg->JpegOutCount + 1UL] = (uint8_t)((dataOut & 0x0000FF00UL) >> 8);
+        hjpeg->pJpegOutBuffPtr[hjpeg->JpegOutCount + 2UL] = (uint8_t)((dataOut & 0x00FF0000UL) >> 16);
+        hjpeg->pJpegOutBuffPtr[hjpeg->JpegOutCount + 3UL] = (uint8_t)((dataOut & 0xFF000000UL) >> 24);
+        hjpeg->JpegOutCount += 4UL;
+
+        if (hjpeg->JpegOutCount == hjpeg->OutDataLength)
+        {
+          /*Output Buffer is full, call HAL_JPEG_DataReadyCallback*/
+          JPEG_DataReadyEvent(hjpeg, hjpeg->pJpegOutBuffPtr, hjpeg->JpegOutCount);
+
+          hjpeg->JpegOutCount = 0;
+        }
+
+      }
     }
   }
-  else if (hjpeg->OutDataLength > hjpeg->JpegOutCount)
+
+  tmpContext = hjpeg->Context;
+
+  if ((__HAL_JPEG_GET_FLAG(hjpeg, JPEG_FLAG_OFNEF) == 0UL) || ((tmpContext & JPEG_CONTEXT_PAUSE_OUTPUT) == 0UL))
   {
-    nb_words = (hjpeg->OutDataLength - hjpeg->JpegOutCount) / 4UL;
-    for (index = 0; index < nb_words; index++)
+    /*Stop Encoding/Decoding*/
+    hjpeg->Instance->CONFR0 &=  ~JPEG_CONFR0_START;
+
+    if (hjpeg->JpegOutCount > 0UL)
     {
-      /*Transfer 32 bits from the JPEG output FIFO*/
-      dataword = hjpeg->Instance->DOR;
-      hjpeg->pJpegOutBuffPtr[hjpeg->JpegOutCount] = (uint8_t)(dataword & 0x000000FFUL);
-      hjpeg->pJpegOutBuffPtr[hjpeg->JpegOutCount + 1UL] = (uint8_t)((dataword & 0x0000FF00UL) >> 8);
-      hjpeg->pJpegOutBuffPtr[hjpeg->JpegOutCount + 2UL] = (uint8_t)((dataword & 0x00FF0000UL) >> 16);
-      hjpeg->pJpegOutBuffPtr[hjpeg->JpegOutCount + 3UL] = (uint8_t)((dataword & 0xFF000000UL) >> 24);
-      hjpeg->JpegOutCount += 4UL;
+      /*Output Buffer is not empty, call DecodedDataReadyCallback*/
+      JPEG_DataReadyEvent(hjpeg, hjpeg->pJpegOutBuffPtr, hjpeg->JpegOutCount);
+
+      hjpeg->JpegOutCount = 0;
     }
-    if (hjpeg->OutDataLength == hjpeg->JpegOutCount)
+
+    tmpContext = hjpeg->Context;
+    /*Clear all context fields execpt JPEG_CONTEXT_CONF_ENCODING and JPEG_CONTEXT_CUSTOM_TABLES*/
+    hjpeg->Context &= (JPEG_CONTEXT_CONF_ENCODING | JPEG_CONTEXT_CUSTOM_TABLES);
+
+    /* Process Unlocked */
+    __HAL_UNLOCK(hjpeg);
+
+    /* Change the JPEG state */
+    hjpeg->State = HAL_JPEG_STATE_READY;
+
+    /*Call End of Encoding/Decoding callback */
+    if ((tmpContext & JPEG_CONTEXT_OPERATION_MASK) == JPEG_CONTEXT_DECODE)
     {
-      /*Output Buffer is full, call DecodedDataReadyCallback*/
 #if (USE_HAL_JPEG_REGISTER_CALLBACKS == 1)
-      hjpeg->DataReadyCallback(hjpeg, hjpeg->pJpegOutBuffPtr, hjpeg->JpegOutCount);
+      hjpeg->DecodeCpltCallback(hjpeg);
 #else
-      HAL_JPEG_DataReadyCallback(hjpeg, hjpeg->pJpegOutBuffPtr, hjpeg->JpegOutCount);
+      HAL_JPEG_DecodeCpltCallback(hjpeg);
 #endif /* USE_HAL_JPEG_REGISTER_CALLBACKS */
-      hjpeg->JpegOutCount = 0;
     }
-    else
+    else /* JPEG_CONTEXT_ENCODE */
     {
-      nb_bytes = hjpeg->OutDataLength - hjpeg->JpegOutCount;
-      dataword = hjpeg->Instance->DOR;
-      for (index = 0; index < nb_bytes; index++)
-      {
-        hjpeg->pJpegOutBuffPtr[hjpeg->JpegOutCount] = (uint8_t)((dataword >> (8UL * (index & 0x3UL))) & 0xFFUL);
-        hjpeg->JpegOutCount++;
-      }
-      /*Output Buffer is full, call DecodedDataReadyCallback*/
 #if (USE_HAL_JPEG_REGISTER_CALLBACKS == 1)
-      hjpeg->DataReadyCallback(hjpeg, hjpeg->pJpegOutBuffPtr, hjpeg->JpegOutCount);
+      hjpeg->EncodeCpltCallback(hjpeg);
 #else
-      HAL_JPEG_DataReadyCallback(hjpeg, hjpeg->pJpegOutBuffPtr, hjpeg->JpegOutCount);
+      HAL_JPEG_EncodeCpltCallback(hjpeg);
 #endif /* USE_HAL_JPEG_REGISTER_CALLBACKS */
-
-      hjpeg->JpegOutCount = 0;
-
-      nb_bytes = 4UL - nb_bytes;
-      for (index = nb_bytes; index < 4UL; index++)
-      {
-        hjpeg->pJpegOutBuffPtr[hjpeg->JpegOutCount] = (uint8_t)((dataword >> (8UL * index)) & 0xFFUL);
-        hjpeg->JpegOutCount++;
-      }
     }
   }
-  else
-  {
-    /* Nothing to do */
-  }
 }
 
 /**
-  * @brief  Read some input Data from the input buffer.
-  *         This function is used when the JPEG peripheral needs new data
-  *         in case of Polling or Interrupt process
-  * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
-  *         the configuration information for JPEG module
-  * @param  nbRequestWords Number of input words (of 32 bits) that the JPE peripheral request
+  * @brief  DMA input transfer complete callback
+  * @param  hdma pointer to a DMA_HandleTypeDef structure.
   * @retval None
   */
-static void JPEG_ReadInputData(JPEG_HandleTypeDef *hjpeg, uint32_t nbRequestWords)
+static void JPEG_DMAInCpltCallback(DMA_HandleTypeDef *hdma)
 {
-  uint32_t nb_bytes = 0;
-  uint32_t nb_words;
-  uint32_t index;
-  uint32_t dataword;
-  uint32_t input_count;
+  JPEG_HandleTypeDef *hjpeg = (JPEG_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
 
-  if ((hjpeg->InDataLength == 0UL) || (nbRequestWords == 0UL))
-  {
-    /* No more Input data : nothing to do*/
-    (void) HAL_JPEG_Pause(hjpeg, JPEG_PAUSE_RESUME_INPUT);
-  }
-  else if (hjpeg->InDataLength > hjpeg->JpegInCount)
-  {
-    nb_bytes = hjpeg->InDataLength - hjpeg->JpegInCount;
-  }
-  else if (hjpeg->InDataLength == hjpeg->JpegInCount)
-  {
-    /*Call HAL_JPEG_GetDataCallback to get new data */
-#if (USE_HAL_JPEG_REGISTER_CALLBACKS == 1)
-    hjpeg->GetDataCallback(hjpeg, hjpeg->JpegInCount);
-#else
-    HAL_JPEG_GetDataCallback(hjpeg, hjpeg->JpegInCount);
-#endif /*USE_HAL_JPEG_REGISTER_CALLBACKS*/
+  /* Disable The JPEG IT so the DMA Input Callback can not be interrupted by the JPEG EOC IT or JPEG HPD IT */
+  __HAL_JPEG_DISABLE_IT(hjpeg, JPEG_INTERRUPT_MASK);
 
-    if (hjpeg->InDataLength > 4UL)
-    {
-      hjpeg->InDataLength = ((hjpeg->InDataLength + 3UL) / 4UL) * 4UL;
-    }
-    hjpeg->JpegInCount = 0;
-    nb_bytes = hjpeg->InDataLength;
-  }
-  else
-  {
-    /* Nothing to do */
-  }
-  if (((hjpeg->Context &  JPEG_CONTEXT_PAUSE_INPUT) == 0UL) && (nb_bytes > 0UL))
-  {
-    nb_words = nb_bytes / 4UL;
-    if (nb_words >= nbRequestWords)
-    {
-      for (index = 0; index < nbRequestWords; index++)
-      {
-        input_count = hjpeg->JpegInCount;
-        hjpeg->Instance->DIR = (((uint32_t)(hjpeg->pJpegInBuffPtr[input_count])) | \
-                                (((uint32_t)(hjpeg->pJpegInBuffPtr[input_count + 1UL])) << 8) | \
-                                (((uint32_t)(hjpeg->pJpegInBuffPtr[input_count + 2UL])) << 16) | \
-                                (((uint32_t)(hjpeg->pJpegInBuffPtr[input_count + 3UL])) << 24));
+  if ((hjpeg->Context & (JPEG_CONTEXT_METHOD_MASK | JPEG_CONTEXT_ENDING_DMA)) ==
+      JPEG_CONTEXT_DMA) /* Check if context method is DMA and we are not in ending DMA stage */
+  {
+    JPEG_DISABLE_DMA(hjpeg, JPEG_DMA_IDMA);
 
-        hjpeg->JpegInCount += 4UL;
-      }
+    hjpeg->JpegInCount = hjpeg->InDataLength - JPEG_GET_DMA_REMAIN_DATA(hdma);
+
+    /*Call HAL_JPEG_GetDataCallback to get new data */
+    JPEG_GetDataEvent(hjpeg, hjpeg->JpegInCount);
+
+    if (hjpeg->InDataLength >= 4UL)
+    {
+      /*JPEG Input DMA transfer data number must be multiple of 32 bits word
+        as the destination is a 32 bits (4 bytes) register */
+      hjpeg->InDataLength = ((hjpeg->InDataLength + 3UL) / 4UL) * 4UL;
     }
-    else /*nb_words < nbRequestWords*/
+    else
     {
-      if (nb_words > 0UL)
-      {
-        for (index = 0; index < nb_words; index++)
-        {
-          input_count = hjpeg->JpegInCount;
-          hjpeg->Instance->DIR = (((uint32_t)(hjpeg->pJpegInBuffPtr[input_count])) | \
-                                  (((uint32_t)(hjpeg->pJpegInBuffPtr[input_count + 1UL])) << 8) | \
-                                  (((uint32_t)(hjpeg->pJpegInBuffPtr[input_count + 2UL])) << 16) | \
-                                  (((uint32_t)(hjpeg->pJpegInBuffPtr[input_count + 3UL])) << 24));
+      /* Nothing to do */
+    }
 
-          hjpeg->JpegInCount += 4UL;
-        }
-      }
-      else
+    if (((hjpeg->Context &  JPEG_CONTEXT_PAUSE_INPUT) == 0UL) && (hjpeg->InDataLength > 0UL))
+    {
+      /* Start DMA FIFO In transfer */
+      if (HAL_DMA_Start_IT(hjpeg->hdmain, (uint32_t)hjpeg->pJpegInBuffPtr, (uint32_t)&hjpeg->Instance->DIR,
+                           hjpeg->InDataLength) != HAL_OK)
       {
-        /* end of file*/
-        dataword = 0;
-        for (index = 0; index < nb_bytes; index++)
-        {
-          dataword |= (uint32_t)hjpeg->pJpegInBuffPtr[hjpeg->JpegInCount] << (8UL * (index & 0x03UL));
-          hjpeg->JpegInCount++;
-        }
-        hjpeg->Instance->DIR = dataword;
+        hjpeg->ErrorCode |= HAL_JPEG_ERROR_DMA;
+        hjpeg->State = HAL_JPEG_STATE_ERROR;
+#if (USE_HAL_JPEG_REGISTER_CALLBACKS == 1)
+        hjpeg->ErrorCallback(hjpeg);
+#else
+        HAL_JPEG_ErrorCallback(hjpeg);
+#endif /* USE_HAL_JPEG_REGISTER_CALLBACKS */
+        return;
       }
+      JPEG_ENABLE_DMA(hjpeg, JPEG_DMA_IDMA);
     }
+
+    /* JPEG Conversion still on going : Enable the JPEG IT */
+    __HAL_JPEG_ENABLE_IT(hjpeg, JPEG_IT_EOC | JPEG_IT_HPD);
   }
 }
 
 /**
-  * @brief  Start the JPEG DMA process (encoding/decoding)
-  * @note   The DMA interrupt must have a higher priority than the JPEG 
-  *         interrupt to prevent the JPEG interrupt from preempting the DMA interrupt
-  *         before the DMA state is updated to ready.
-  * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
-  *         the configuration information for JPEG module
-  * @retval JPEG_PROCESS_DONE if process ends else JPEG_PROCESS_ONGOING
+  * @brief  DMA output transfer complete callback
+  * @param  hdma pointer to a DMA_HandleTypeDef structure.
+  * @retval None
   */
-static HAL_StatusTypeDef JPEG_DMA_StartProcess(JPEG_HandleTypeDef *hjpeg)
+static void JPEG_DMAOutCpltCallback(DMA_HandleTypeDef *hdma)
 {
-  if ((hjpeg->InDataLength < 4UL) || (hjpeg->OutDataLength < 4UL))
-  {
-    return HAL_ERROR;
-  }
-  /* Reset Ending DMA internal context flag*/
-  hjpeg->Context &= ~JPEG_CONTEXT_ENDING_DMA;
-
-  /* Disable DMA In/Out Request*/
-  JPEG_DISABLE_DMA(hjpeg, JPEG_DMA_ODMA | JPEG_DMA_IDMA);
-
-  /* Set the JPEG DMA In transfer complete callback */
-  hjpeg->hdmain->XferCpltCallback = JPEG_DMAInCpltCallback;
-  /* Set the DMA In error callback */
-  hjpeg->hdmain->XferErrorCallback = JPEG_DMAErrorCallback;
-
-  /* Set the JPEG DMA Out transfer complete callback */
-  hjpeg->hdmaout->XferCpltCallback = JPEG_DMAOutCpltCallback;
-  /* Set the DMA Out error callback */
-  hjpeg->hdmaout->XferErrorCallback = JPEG_DMAErrorCallback;
-  /* Set the DMA Out Abort callback */
-  hjpeg->hdmaout->XferAbortCallback = JPEG_DMAOutAbortCallback;
-
-  /*DMA transfer size must be a multiple of 4 bytes i.e multiple of 32bits words*/
-  hjpeg->InDataLength = hjpeg->InDataLength - (hjpeg->InDataLength % 4UL);
+  JPEG_HandleTypeDef *hjpeg = (JPEG_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
 
-  /*DMA transfer size must be a multiple of 4 bytes i.e multiple of 32bits words*/
-  hjpeg->OutDataLength = hjpeg->OutDataLength - (hjpeg->OutDataLength % 4UL);
+  /* Disable The JPEG IT so the DMA Output Callback can not be interrupted by the JPEG EOC IT or JPEG HPD IT */
+  __HAL_JPEG_DISABLE_IT(hjpeg, JPEG_INTERRUPT_MASK);
 
-  if ((hjpeg->hdmain->Mode & DMA_LINKEDLIST) == DMA_LINKEDLIST)
+  if ((hjpeg->Context & (JPEG_CONTEXT_METHOD_MASK | JPEG_CONTEXT_ENDING_DMA)) ==
+      JPEG_CONTEXT_DMA) /* Check if context method is DMA and we are not in ending DMA stage */
   {
-    if (hjpeg->hdmain->LinkedListQueue != NULL)
+    if (__HAL_JPEG_GET_FLAG(hjpeg, JPEG_FLAG_EOCF) == 0UL)
     {
-      /* Set DMA data size */
-      hjpeg->hdmain->LinkedListQueue->Head->LinkRegisters[NODE_CBR1_DEFAULT_OFFSET] = hjpeg->InDataLength;
-
-      /* Set DMA source address */
-      hjpeg->hdmain->LinkedListQueue->Head->LinkRegisters[NODE_CSAR_DEFAULT_OFFSET] = (uint32_t)hjpeg->pJpegInBuffPtr;
+      JPEG_DISABLE_DMA(hjpeg, JPEG_DMA_ODMA);
+      hjpeg->JpegOutCount = hjpeg->OutDataLength - JPEG_GET_DMA_REMAIN_DATA(hdma);
 
-      /* Set DMA destination address */
-      hjpeg->hdmain->LinkedListQueue->Head->LinkRegisters[NODE_CDAR_DEFAULT_OFFSET] = (uint32_t)&hjpeg->Instance->DIR;
+      /*Output Buffer is full, call HAL_JPEG_DataReadyCallback*/
+      JPEG_DataReadyEvent(hjpeg, hjpeg->pJpegOutBuffPtr, hjpeg->JpegOutCount);
 
-      if (HAL_DMAEx_List_Start_IT(hjpeg->hdmain) != HAL_OK)
+      if ((hjpeg->Context &  JPEG_CONTEXT_PAUSE_OUTPUT) == 0UL)
       {
-        return HAL_ERROR;
+        /* Start DMA FIFO Out transfer */
+        if (HAL_DMA_Start_IT(hjpeg->hdmaout, (uint32_t)&hjpeg->Instance->DOR, (uint32_t)hjpeg->pJpegOutBuffPtr,
+                             hjpeg->OutDataLength) != HAL_OK)
+        {
+          hjpeg->ErrorCode |= HAL_JPEG_ERROR_DMA;
+          hjpeg->State = HAL_JPEG_STATE_ERROR;
+#if (USE_HAL_JPEG_REGISTER_CALLBACKS == 1)
+          hjpeg->ErrorCallback(hjpeg);
+#else
+          HAL_JPEG_ErrorCallback(hjpeg);
+#endif /* USE_HAL_JPEG_REGISTER_CALLBACKS */
+          return;
+        }
+        JPEG_ENABLE_DMA(hjpeg, JPEG_DMA_ODMA);
       }
     }
-    else
-    {
-      /* Set the JPEG State to ready */
-      hjpeg->State = HAL_JPEG_STATE_READY;
 
-      /* Update JPEG error code */
-      hjpeg->ErrorCode |= HAL_JPEG_ERROR_DMA;
+    /* JPEG Conversion still on going : Enable the JPEG IT */
+    __HAL_JPEG_ENABLE_IT(hjpeg, JPEG_IT_EOC | JPEG_IT_HPD);
+  }
+}
 
-      /* Process Unlocked */
-      __HAL_UNLOCK(hjpeg);
 
-      return HAL_ERROR;
-    }
-  }
-  else
-  {
-    /* Start DMA FIFO In transfer */
-    if (HAL_DMA_Start_IT(hjpeg->hdmain, (uint32_t)hjpeg->pJpegInBuffPtr, (uint32_t)&hjpeg->Instance->DIR,
-                         hjpeg->InDataLength)  != HAL_OK)
-    {
-      hjpeg->ErrorCode |= HAL_JPEG_ERROR_DMA;
-      return HAL_ERROR;
-    }
-  }
+/**
+  * @brief  DMA Transfer error callback
+  * @param  hdma pointer to a DMA_HandleTypeDef structure.
+  * @retval None
+  */
+static void JPEG_DMAErrorCallback(DMA_HandleTypeDef *hdma)
+{
+  JPEG_HandleTypeDef *hjpeg = (JPEG_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
 
-  if ((hjpeg->hdmaout->Mode & DMA_LINKEDLIST) == DMA_LINKEDLIST)
+  if (HAL_DMA_GetError(hdma) != HAL_DMA_ERROR_NONE)
   {
-    if (hjpeg->hdmaout->LinkedListQueue != NULL)
-    {
-      /* Set DMA data size */
-      hjpeg->hdmaout->LinkedListQueue->Head->LinkRegisters[NODE_CBR1_DEFAULT_OFFSET] = hjpeg->OutDataLength;
-
-      /* Set DMA source address */
-      hjpeg->hdmaout->LinkedListQueue->Head->LinkRegisters[NODE_CSAR_DEFAULT_OFFSET] = (uint32_t)&hjpeg->Instance->DOR;
+    /*Stop Encoding/Decoding*/
+    hjpeg->Instance->CONFR0 &=  ~JPEG_CONFR0_START;
 
-      /* Set DMA destination address */
-      hjpeg->hdmaout->LinkedListQueue->Head->LinkRegisters[NODE_CDAR_DEFAULT_OFFSET] = (uint32_t)hjpeg->pJpegOutBuffPtr;
+    /* Disable All Interrupts */
+    __HAL_JPEG_DISABLE_IT(hjpeg, JPEG_INTERRUPT_MASK);
 
-      if (HAL_DMAEx_List_Start_IT(hjpeg->hdmaout) != HAL_OK)
-      {
-        return HAL_ERROR;
-      }
-    }
-    else
-    {
-      /* Set the JPEG State to ready */
-      hjpeg->State = HAL_JPEG_STATE_READY;
+    /* Disable All DMA requests */
+    JPEG_DISABLE_DMA(hjpeg, JPEG_DMA_MASK);
 
-      /* Update JPEG error code */
-      hjpeg->ErrorCode |= HAL_JPEG_ERROR_DMA;
+    hjpeg->State = HAL_JPEG_STATE_READY;
+    hjpeg->ErrorCode |= HAL_JPEG_ERROR_DMA;
+#if (USE_HAL_JPEG_REGISTER_CALLBACKS == 1)
+    hjpeg->ErrorCallback(hjpeg);
+#else
+    HAL_JPEG_ErrorCallback(hjpeg);
+#endif /* USE_HAL_JPEG_REGISTER_CALLBACKS */
+  }
+}
 
-      /* Process Unlocked */
-      __HAL_UNLOCK(hjpeg);
+/**
+  * @brief  DMA output Abort callback
+  * @param  hdma pointer to a DMA_HandleTypeDef structure.
+  * @retval None
+  */
+static void JPEG_DMAOutAbortCallback(DMA_HandleTypeDef *hdma)
+{
+  JPEG_HandleTypeDef *hjpeg = (JPEG_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
 
-      return HAL_ERROR;
-    }
+  if ((hjpeg->Context & JPEG_CONTEXT_ENDING_DMA) != 0UL)
+  {
+    JPEG_DMA_EndProcess(hjpeg);
   }
-  else
+}
+
+
+/**
+  * @brief  Calculate the decoded image quality (from 1 to 100)
+  * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
+  *         the configuration information for JPEG module
+  * @retval JPEG image quality from 1 to 100.
+  */
+static uint32_t JPEG_GetQuality(const JPEG_HandleTypeDef *hjpeg)
+{
+  uint32_t quality = 0;
+  uint32_t quantRow;
+  uint32_t quantVal;
+  uint32_t scale;
+  uint32_t i;
+  uint32_t j;
+  const __IO uint32_t *tableAddress = hjpeg->Instance->QMEM0;
+
+  i = 0;
+  while (i < (JPEG_QUANT_TABLE_SIZE - 3UL))
   {
-    /* Start DMA FIFO Out transfer */
-    if (HAL_DMA_Start_IT(hjpeg->hdmaout, (uint32_t)&hjpeg->Instance->DOR, (uint32_t)hjpeg->pJpegOutBuffPtr,
-                         hjpeg->OutDataLength)  != HAL_OK)
+    quantRow = *tableAddress;
+    for (j = 0; j < 4UL; j++)
     {
-      hjpeg->ErrorCode |= HAL_JPEG_ERROR_DMA;
-      return HAL_ERROR;
+      quantVal = (quantRow >> (8UL * j)) & 0xFFUL;
+      if (quantVal == 1UL)
+      {
+        /* if Quantization value = 1 then quality is 100%*/
+        quality += 100UL;
+      }
+      else
+      {
+        /* Note that the quantization coefficients must be specified in the table in zigzag order */
+        scale = (quantVal * 100UL) / ((uint32_t) hjpeg->QuantTable0[JPEG_ZIGZAG_ORDER[i + j]]);
+
+        if (scale <= 100UL)
+        {
+          quality += (200UL - scale) / 2UL;
+        }
+        else
+        {
+          quality += 5000UL / scale;
+        }
+      }
     }
-  }
 
-  /* Enable JPEG In/Out DMA requests*/
-  JPEG_ENABLE_DMA(hjpeg, JPEG_DMA_IDMA | JPEG_DMA_ODMA);
+    i += 4UL;
+    tableAddress ++;
+  }
 
-  return HAL_OK;
+  return (quality / 64UL);
 }
 
 /**
-  * @brief  Continue the current JPEG DMA process (encoding/decoding)
+  * @brief  Route the decoding info ready event to the attached pipeline or to the user callback
   * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
   *         the configuration information for JPEG module
-  * @retval JPEG_PROCESS_DONE if process ends else JPEG_PROCESS_ONGOING
+  * @retval None
   */
-static void JPEG_DMA_ContinueProcess(JPEG_HandleTypeDef *hjpeg)
+static void JPEG_InfoReadyEvent(JPEG_HandleTypeDef *hjpeg)
 {
-  uint32_t itflag = hjpeg->Instance->SR;
-
-  /*End of header processing flag rises*/
-  if ((hjpeg->Context & JPEG_CONTEXT_OPERATION_MASK) == JPEG_CONTEXT_DECODE)
+#if defined(HAL_DMA2D_MODULE_ENABLED) && (USE_DMA2D_COMMAND_LIST_MODE == 0U)
+  if (hjpeg->pPipeline != NULL)
+  {
+    JPEG_Pipeline_InfoReady(hjpeg);
+  }
+  else
+#endif /* HAL_DMA2D_MODULE_ENABLED && USE_DMA2D_COMMAND_LIST_MODE == 0U */
   {
-    if ((itflag & JPEG_FLAG_HPDF) != 0UL)
-    {
-      /*Call Header parsing complete callback */
-      (void) HAL_JPEG_GetInfo(hjpeg, &hjpeg->Conf);
-
-      /* Reset the ImageQuality */
-      hjpeg->Conf.ImageQuality = 0;
-      /* Note : the image quality is only available at the end of the decoding operation */
-      /* at the current stage the calculated image quality is not correct so reset it */
-
-      /*Call Info Ready callback */
 #if (USE_HAL_JPEG_REGISTER_CALLBACKS == 1)
-      hjpeg->InfoReadyCallback(hjpeg, &hjpeg->Conf);
+    hjpeg->InfoReadyCallback(hjpeg, &hjpeg->Conf);
 #else
-      HAL_JPEG_InfoReadyCallback(hjpeg, &hjpeg->Conf);
+    HAL_JPEG_InfoReadyCallback(hjpeg, &hjpeg->Conf);
 #endif /* USE_HAL_JPEG_REGISTER_CALLBACKS */
-
-      __HAL_JPEG_DISABLE_IT(hjpeg, JPEG_IT_HPD);
-
-      /* Clear header processing done flag */
-      __HAL_JPEG_CLEAR_FLAG(hjpeg, JPEG_FLAG_HPDF);
-    }
   }
+}
 
-  /*End of Conversion handling*/
-  if ((itflag & JPEG_FLAG_EOCF) != 0UL)
+/**
+  * @brief  Route the get data event to the attached pipeline or to the user callback
+  * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
+  *         the configuration information for JPEG module
+  * @param  NbDecodedData Number of consummed data in the previous chunk in bytes
+  * @retval None
+  */
+static void JPEG_GetDataEvent(JPEG_HandleTypeDef *hjpeg, uint32_t NbDecodedData)
+{
+#if defined(HAL_DMA2D_MODULE_ENABLED) && (USE_DMA2D_COMMAND_LIST_MODE == 0U)
+  if (hjpeg->pEncodeSource != NULL)
   {
-    /*Disable JPEG In/Out DMA Requests*/
-    JPEG_DISABLE_DMA(hjpeg, JPEG_DMA_ODMA | JPEG_DMA_IDMA);
-
-    hjpeg->Context |= JPEG_CONTEXT_ENDING_DMA;
-
-    /*Stop Encoding/Decoding*/
-    hjpeg->Instance->CONFR0 &=  ~JPEG_CONFR0_START;
-
-    __HAL_JPEG_DISABLE_IT(hjpeg, JPEG_INTERRUPT_MASK);
-
-    /* Clear all flags */
-    __HAL_JPEG_CLEAR_FLAG(hjpeg, JPEG_FLAG_ALL);
-
-    if (hjpeg->hdmain->State == HAL_DMA_STATE_BUSY)
-    {
-      /* Stop the DMA In Xfer*/
-      (void) HAL_DMA_Abort_IT(hjpeg->hdmain);
-    }
-
-    if (hjpeg->hdmaout->State == HAL_DMA_STATE_BUSY)
-    {
-      /* Stop the DMA out Xfer*/
-      (void) HAL_DMA_Abort_IT(hjpeg->hdmaout);
-    }
-    else
-    {
-      JPEG_DMA_EndProcess(hjpeg);
-    }
+    JPEG_EncodeSource_GetData(hjpeg, NbDecodedData);
+  }
+  else if (hjpeg->pPipeline != NULL)
+  {
+    JPEG_Pipeline_GetData(hjpeg, NbDecodedData);
+  }
+  else
+#endif /* HAL_DMA2D_MODULE_ENABLED && USE_DMA2D_COMMAND_LIST_MODE == 0U */
+  {
+#if (USE_HAL_JPEG_REGISTER_CALLBACKS == 1)
+    hjpeg->GetDataCallback(hjpeg, NbDecodedData);
+#else
+    HAL_JPEG_GetDataCallback(hjpeg, NbDecodedData);
+#endif /* USE_HAL_JPEG_REGISTER_CALLBACKS */
   }
 }
 
 /**
-  * @brief  Finalize the current JPEG DMA process (encoding/decoding)
+  * @brief  Route the data ready event to the attached pipeline or to the user callback
   * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
   *         the configuration information for JPEG module
-  * @retval JPEG_PROCESS_DONE
+  * @param  pDataOut pointer to the output data buffer
+  * @param  OutDataLength length of output buffer in bytes
+  * @retval None
   */
-static void JPEG_DMA_EndProcess(JPEG_HandleTypeDef *hjpeg)
+static void JPEG_DataReadyEvent(JPEG_HandleTypeDef *hjpeg, uint8_t *pDataOut, uint32_t OutDataLength)
 {
-  uint32_t tmpContext;
-  hjpeg->JpegOutCount = hjpeg->OutDataLength - JPEG_GET_DMA_REMAIN_DATA(hjpeg->hdmaout);
-
-  /*if Output Buffer is full, call HAL_JPEG_DataReadyCallback*/
-  if (hjpeg->JpegOutCount == hjpeg->OutDataLength)
+#if defined(HAL_DMA2D_MODULE_ENABLED) && (USE_DMA2D_COMMAND_LIST_MODE == 0U)
+  if (hjpeg->pPipeline != NULL)
+  {
+    /* Chunks are consecutive and converted by MCU count, the length is not needed */
+    JPEG_Pipeline_DataReady(hjpeg);
+  }
+  else
+#endif /* HAL_DMA2D_MODULE_ENABLED && USE_DMA2D_COMMAND_LIST_MODE == 0U */
   {
 #if (USE_HAL_JPEG_REGISTER_CALLBACKS == 1)
-    hjpeg->DataReadyCallback(hjpeg, hjpeg->pJpegOutBuffPtr, hjpeg->JpegOutCount);
+    hjpeg->DataReadyCallback(hjpeg, pDataOut, OutDataLength);
 #else
-    HAL_JPEG_DataReadyCallback(hjpeg, hjpeg->pJpegOutBuffPtr, hjpeg->JpegOutCount);
+    HAL_JPEG_DataReadyCallback(hjpeg, pDataOut, OutDataLength);
 #endif /* USE_HAL_JPEG_REGISTER_CALLBACKS */
+  }
+}
 
-    hjpeg->JpegOutCount = 0;
+#if defined(HAL_DMA2D_MODULE_ENABLED) && (USE_DMA2D_COMMAND_LIST_MODE == 0U)
+/**
+  * @brief  Get the next contiguous span of the pipeline input ring to hand to the codec
+  * @param  pPipeline pointer to the streaming decode pipeline
+  * @param  pInput receives the start of the span
+  * @retval Span length in bytes, multiple of 4, 0 when no data is available
+  */
+static uint32_t JPEG_Pipeline_NextInput(const JPEG_PipelineTypeDef *pPipeline, uint8_t **pInput)
+{
+  uint32_t available = pPipeline->InHead - pPipeline->InTail;
+  uint32_t offset = pPipeline->InTail % pPipeline->InRingSize;
+  uint32_t length = available;
+
+  if (length > (pPipeline->InRingSize - offset))
+  {
+    length = pPipeline->InRingSize - offset;
+  }
+  if (length > pPipeline->InChunkSize)
+  {
+    length = pPipeline->InChunkSize;
   }
 
-  /*Check if remaining data in the output FIFO*/
-  if (__HAL_JPEG_GET_FLAG(hjpeg, JPEG_FLAG_OFNEF) == 0UL)
+  if ((pPipeline->InEnd != 0UL) && (length == available))
   {
-    if (hjpeg->JpegOutCount > 0UL)
-    {
-      /*Output Buffer is not empty, call DecodedDataReadyCallback*/
-#if (USE_HAL_JPEG_REGISTER_CALLBACKS == 1)
-      hjpeg->DataReadyCallback(hjpeg, hjpeg->pJpegOutBuffPtr, hjpeg->JpegOutCount);
-#else
-      HAL_JPEG_DataReadyCallback(hjpeg, hjpeg->pJpegOutBuffPtr, hjpeg->JpegOutCount);
-#endif /* USE_HAL_JPEG_REGISTER_CALLBACKS */
+    /* Tail of the stream: the codec reads whole words, the word padding stays inside the ring
+       as the offset and the ring size are both multiple of 4 */
+    length = ((length + 3UL) / 4UL) * 4UL;
+  }
+  else
+  {
+    length -= (length % 4UL);
+  }
 
-      hjpeg->JpegOutCount = 0;
-    }
+  *pInput = &pPipeline->pInRing[offset];
 
-    /*Stop Encoding/Decoding*/
-    hjpeg->Instance->CONFR0 &=  ~JPEG_CONFR0_START;
+  return length;
+}
 
-    tmpContext = hjpeg->Context;
-    /*Clear all context fields execpt JPEG_CONTEXT_CONF_ENCODING and JPEG_CONTEXT_CUSTOM_TABLES*/
-    hjpeg->Context &= (JPEG_CONTEXT_CONF_ENCODING | JPEG_CONTEXT_CUSTOM_TABLES);
+/**
+  * @brief  Configure the DMA2D conversion from the decoded image information
+  * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
+  *         the configuration information for JPEG module
+  * @retval None
+  */
+static void JPEG_Pipeline_InfoReady(JPEG_HandleTypeDef *hjpeg)
+{
+  JPEG_PipelineTypeDef *pipe = hjpeg->pPipeline;
+  DMA2D_HandleTypeDef *hdma2d = pipe->hdma2d;
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t css = DMA2D_NO_CSS;
+  uint32_t rows;
 
-    /* Process Unlocked */
-    __HAL_UNLOCK(hjpeg);
+  /* The DMA2D only converts YCbCr MCUs */
+  if (hjpeg->Conf.ColorSpace != JPEG_YCBCR_COLORSPACE)
+  {
+    status = HAL_ERROR;
+  }
+  else if (hjpeg->Conf.ChromaSubsampling == JPEG_420_SUBSAMPLING)
+  {
+    pipe->McuWidth  = 16UL;
+    pipe->McuHeight = 16UL;
+    pipe->McuSize   = 384UL;
+    css = DMA2D_CSS_420;
+  }
+  else if (hjpeg->Conf.ChromaSubsampling == JPEG_422_SUBSAMPLING)
+  {
+    pipe->McuWidth  = 16UL;
+    pipe->McuHeight = 8UL;
+    pipe->McuSize   = 256UL;
+    css = DMA2D_CSS_422;
+  }
+  else /* JPEG_444_SUBSAMPLING */
+  {
+    pipe->McuWidth  = 8UL;
+    pipe->McuHeight = 8UL;
+    pipe->McuSize   = 192UL;
+  }
 
-    /* Change the JPEG state */
-    hjpeg->State = HAL_JPEG_STATE_READY;
+  if (status == HAL_OK)
+  {
+    pipe->McusPerRow = (hjpeg->Conf.ImageWidth + pipe->McuWidth - 1UL) / pipe->McuWidth;
+    rows = (hjpeg->Conf.ImageHeight + pipe->McuHeight - 1UL) / pipe->McuHeight;
+    pipe->TotalMcus = pipe->McusPerRow * rows;
 
-    /*Call End of Encoding/Decoding callback */
-    if ((tmpContext & JPEG_CONTEXT_OPERATION_MASK) == JPEG_CONTEXT_DECODE)
+    /* A chunk must hold whole MCUs and the frame buffer lines whole MCU rows */
+    if (((pipe->ChunkSize % pipe->McuSize) != 0UL) || (pipe->FramePitch < (pipe->McusPerRow * pipe->McuWidth)))
     {
-#if (USE_HAL_JPEG_REGISTER_CALLBACKS == 1)
-      hjpeg->DecodeCpltCallback(hjpeg);
-#else
-      HAL_JPEG_DecodeCpltCallback(hjpeg);
-#endif /* USE_HAL_JPEG_REGISTER_CALLBACKS */
+      status = HAL_ERROR;
     }
-    else /* JPEG_CONTEXT_ENCODE */
+  }
+
+  if (status == HAL_OK)
+  {
+    hdma2d->Init.Mode           = DMA2D_M2M_PFC;
+    hdma2d->Init.ColorMode      = pipe->OutputColorMode;
+    hdma2d->Init.OutputOffset   = 0UL;
+    hdma2d->Init.LineOffsetMode = DMA2D_LOM_PIXELS;
+
+    hdma2d->LayerCfg[DMA2D_FOREGROUND_LAYER].InputOffset       = 0UL;
+    hdma2d->LayerCfg[DMA2D_FOREGROUND_LAYER].InputColorMode    = DMA2D_INPUT_YCBCR;
+    hdma2d->LayerCfg[DMA2D_FOREGROUND_LAYER].AlphaMode         = DMA2D_NO_MODIF_ALPHA;
+    hdma2d->LayerCfg[DMA2D_FOREGROUND_LAYER].InputAlpha        = 0xFFUL;
+    hdma2d->LayerCfg[DMA2D_FOREGROUND_LAYER].AlphaInverted     = DMA2D_REGULAR_ALPHA;
+    hdma2d->LayerCfg[DMA2D_FOREGROUND_LAYER].RedBlueSwap       = DMA2D_RB_REGULAR;
+    hdma2d->LayerCfg[DMA2D_FOREGROUND_LAYER].ChromaSubSampling = css;
+
+    if ((HAL_DMA2D_Init(hdma2d) != HAL_OK) || (HAL_DMA2D_ConfigLayer(hdma2d, DMA2D_FOREGROUND_LAYER) != HAL_OK))
     {
-#if (USE_HAL_JPEG_REGISTER_CALLBACKS == 1)
-      hjpeg->EncodeCpltCallback(hjpeg);
-#else
-      HAL_JPEG_EncodeCpltCallback(hjpeg);
-#endif /* USE_HAL_JPEG_REGISTER_CALLBACKS */
+      status = HAL_ERROR;
     }
   }
-  else if ((hjpeg->Context &  JPEG_CONTEXT_PAUSE_OUTPUT) == 0UL)
+
+  if (status != HAL_OK)
   {
-    JPEG_DMA_PollResidualData(hjpeg);
+    JPEG_Pipeline_Error(hjpeg);
+  }
+}
+
+/**
+  * @brief  Release the compressed bytes consumed by the codec and hand it the next input span
+  * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
+  *         the configuration information for JPEG module
+  * @param  NbDecodedData Number of consummed data in the previous chunk in bytes
+  * @retval None
+  */
+static void JPEG_Pipeline_GetData(JPEG_HandleTypeDef *hjpeg, uint32_t NbDecodedData)
+{
+  JPEG_PipelineTypeDef *pipe = hjpeg->pPipeline;
+  uint8_t *pInput;
+  uint32_t length;
+
+  /* The word padding of the stream tail is not part of the ring data */
+  if (NbDecodedData > (pipe->InHead - pipe->InTail))
+  {
+    pipe->InTail = pipe->InHead;
   }
   else
   {
-    /* Nothing to do */
+    pipe->InTail += NbDecodedData;
   }
 
+  length = JPEG_Pipeline_NextInput(pipe, &pInput);
+  HAL_JPEG_ConfigInputBuffer(hjpeg, pInput, length);
+  if (length == 0UL)
+  {
+    /* Starved: resumed by HAL_JPEG_Pipeline_WriteInput() or HAL_JPEG_Pipeline_EndOfInput() */
+    pipe->InPaused = 1UL;
+    (void)HAL_JPEG_Pause(hjpeg, JPEG_PAUSE_RESUME_INPUT);
+  }
 }
 
 /**
-  * @brief  Poll residual output data when DMA process (encoding/decoding)
+  * @brief  Queue the filled MCU chunk for conversion and hand the codec the next free chunk
   * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
   *         the configuration information for JPEG module
-  * @retval None.
+  * @retval None
   */
-static void JPEG_DMA_PollResidualData(JPEG_HandleTypeDef *hjpeg)
+static void JPEG_Pipeline_DataReady(JPEG_HandleTypeDef *hjpeg)
 {
-  uint32_t tmpContext;
-  uint32_t count;
-  uint32_t dataOut;
-
-  for (count = JPEG_FIFO_SIZE; count > 0UL; count--)
-  {
-    if ((hjpeg->Context &  JPEG_CONTEXT_PAUSE_OUTPUT) == 0UL)
-    {
-      if (__HAL_JPEG_GET_FLAG(hjpeg, JPEG_FLAG_OFNEF) != 0UL)
-      {
-        dataOut = hjpeg->Instance->DOR;
-        hjpeg->pJpegOutBuffPtr[hjpeg->JpegOutCount] = (uint8_t)(dataOut & 0x000000FFUL);
-        hjpeg->pJpegOutBuffPtr[hjpeg->JpegOutCount + 1UL] = (uint8_t)((dataOut & 0x0000FF00UL) >> 8);
-        hjpeg->pJpegOutBuffPtr[hjpeg->JpegOutCount + 2UL] = (uint8_t)((dataOut & 0x00FF0000UL) >> 16);
-        hjpeg->pJpegOutBuffPtr[hjpeg->JpegOutCount + 3UL] = (uint8_t)((dataOut & 0xFF000000UL) >> 24);
-        hjpeg->JpegOutCount += 4UL;
+  JPEG_PipelineTypeDef *pipe = hjpeg->pPipeline;
+  uint32_t primask_bit;
 
-        if (hjpeg->JpegOutCount == hjpeg->OutDataLength)
-        {
-          /*Output Buffer is full, call HAL_JPEG_DataReadyCallback*/
-#if (USE_HAL_JPEG_REGISTER_CALLBACKS == 1)
-          hjpeg->DataReadyCallback(hjpeg, hjpeg->pJpegOutBuffPtr, hjpeg->JpegOutCount);
-#else
-          HAL_JPEG_DataReadyCallback(hjpeg, hjpeg->pJpegOutBuffPtr, hjpeg->JpegOutCount);
-#endif /* USE_HAL_JPEG_REGISTER_CALLBACKS */
+  /* The DMA2D completion may run at another priority */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
 
-          hjpeg->JpegOutCount = 0;
-        }
+  pipe->FillIndex++;
 
-      }
-    }
+  if ((pipe->FillIndex - pipe->ConvertIndex) < pipe->ChunkCount)
+  {
+    HAL_JPEG_ConfigOutputBuffer(hjpeg,
+                                &pipe->pOutChunks[(pipe->FillIndex % pipe->ChunkCount) * pipe->ChunkSize],
+                                pipe->ChunkSize);
+  }
+  else
+  {
+    /* All chunks wait for the DMA2D: resumed once the oldest one is converted */
+    pipe->OutPaused = 1UL;
+    (void)HAL_JPEG_Pause(hjpeg, JPEG_PAUSE_RESUME_OUTPUT);
   }
 
-  tmpContext = hjpeg->Context;
+  JPEG_Pipeline_Convert(hjpeg);
 
-  if ((__HAL_JPEG_GET_FLAG(hjpeg, JPEG_FLAG_OFNEF) == 0UL) || ((tmpContext & JPEG_CONTEXT_PAUSE_OUTPUT) == 0UL))
-  {
-    /*Stop Encoding/Decoding*/
-    hjpeg->Instance->CONFR0 &=  ~JPEG_CONFR0_START;
+  __set_PRIMASK(primask_bit);
+}
 
-    if (hjpeg->JpegOutCount > 0UL)
+/**
+  * @brief  Start the DMA2D conversion of the next segment of the oldest filled MCU chunk.
+  * @note   A segment is either whole MCU rows, converted as one rectangle, or the MCUs
+  *         of the chunk up to the end of the current MCU row. Called with interrupts masked.
+  * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
+  *         the configuration information for JPEG module
+  * @retval None
+  */
+static void JPEG_Pipeline_Convert(JPEG_HandleTypeDef *hjpeg)
+{
+  JPEG_PipelineTypeDef *pipe = hjpeg->pPipeline;
+  uint32_t count;
+  uint32_t column;
+  uint32_t row;
+  uint32_t width;
+  uint32_t height;
+  uint32_t source;
+  uint32_t destination;
+
+  if ((JPEG_PipelineHandle == hjpeg) && (pipe->Converting == 0UL) && (pipe->ConvertIndex != pipe->FillIndex) &&
+      (pipe->McuIndex < pipe->TotalMcus))
+  {
+    count = (pipe->ChunkSize / pipe->McuSize) - pipe->ChunkMcu;
+    if (count > (pipe->TotalMcus - pipe->McuIndex))
     {
-      /*Output Buffer is not empty, call DecodedDataReadyCallback*/
-#if (USE_HAL_JPEG_REGISTER_CALLBACKS == 1)
-      hjpeg->DataReadyCallback(hjpeg, hjpeg->pJpegOutBuffPtr, hjpeg->JpegOutCount);
-#else
-      HAL_JPEG_DataReadyCallback(hjpeg, hjpeg->pJpegOutBuffPtr, hjpeg->JpegOutCount);
-#endif /* USE_HAL_JPEG_REGISTER_CALLBACKS */
-
-      hjpeg->JpegOutCount = 0;
+      count = pipe->TotalMcus - pipe->McuIndex;
     }
 
-    tmpContext = hjpeg->Context;
-    /*Clear all context fields execpt JPEG_CONTEXT_CONF_ENCODING and JPEG_CONTEXT_CUSTOM_TABLES*/
-    hjpeg->Context &= (JPEG_CONTEXT_CONF_ENCODING | JPEG_CONTEXT_CUSTOM_TABLES);
-
-    /* Process Unlocked */
-    __HAL_UNLOCK(hjpeg);
-
-    /* Change the JPEG state */
-    hjpeg->State = HAL_JPEG_STATE_READY;
+    column = pipe->McuIndex % pipe->McusPerRow;
+    row    = pipe->McuIndex / pipe->McusPerRow;
 
-    /*Call End of Encoding/Decoding callback */
-    if ((tmpContext & JPEG_CONTEXT_OPERATION_MASK) == JPEG_CONTEXT_DECODE)
+    if ((column == 0UL) && (count >= pipe->McusPerRow))
     {
-#if (USE_HAL_JPEG_REGISTER_CALLBACKS == 1)
-      hjpeg->DecodeCpltCallback(hjpeg);
-#else
-      HAL_JPEG_DecodeCpltCallback(hjpeg);
-#endif /* USE_HAL_JPEG_REGISTER_CALLBACKS */
+      count -= (count % pipe->McusPerRow);
+      width  = pipe->McusPerRow * pipe->McuWidth;
+      height = (count / pipe->McusPerRow) * pipe->McuHeight;
     }
-    else /* JPEG_CONTEXT_ENCODE */
+    else
     {
-#if (USE_HAL_JPEG_REGISTER_CALLBACKS == 1)
-      hjpeg->EncodeCpltCallback(hjpeg);
-#else
-      HAL_JPEG_EncodeCpltCallback(hjpeg);
-#endif /* USE_HAL_JPEG_REGISTER_CALLBACKS */
+      if (count > (pipe->McusPerRow - column))
+      {
+        count = pipe->McusPerRow - column;
+      }
+      width  = count * pipe->McuWidth;
+      height = pipe->McuHeight;
+    }
+
+    source = (uint32_t)&pipe->pOutChunks[((pipe->ConvertIndex % pipe->ChunkCount) * pipe->ChunkSize) +
+                                         (pipe->ChunkMcu * pipe->McuSize)];
+    destination = pipe->FrameAddress +
+                  ((((row * pipe->McuHeight) * pipe->FramePitch) + (column * pipe->McuWidth)) * pipe->BytesPerPixel);
+
+    /* Only the output line offset changes from one segment to the other */
+    pipe->hdma2d->Init.OutputOffset = pipe->FramePitch - width;
+    MODIFY_REG(pipe->hdma2d->Instance->OOR, DMA2D_OOR_LO, pipe->hdma2d->Init.OutputOffset);
+
+    pipe->SegmentMcus = count;
+    pipe->Converting = 1UL;
+    if (HAL_DMA2D_Start_IT(pipe->hdma2d, source, destination, width, height) != HAL_OK)
+    {
+      pipe->Converting = 0UL;
+      JPEG_Pipeline_Error(hjpeg);
     }
   }
 }
 
 /**
-  * @brief  DMA input transfer complete callback
-  * @param  hdma pointer to a DMA_HandleTypeDef structure.
+  * @brief  Stop the pipeline on error and report it through the pipeline completion callback.
+  * @note   The codec is left paused, the application calls HAL_JPEG_Pipeline_Abort().
+  * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
+  *         the configuration information for JPEG module
   * @retval None
   */
-static void JPEG_DMAInCpltCallback(DMA_HandleTypeDef *hdma)
+static void JPEG_Pipeline_Error(JPEG_HandleTypeDef *hjpeg)
 {
-  JPEG_HandleTypeDef *hjpeg = (JPEG_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+  JPEG_PipelineTypeDef *pipe = hjpeg->pPipeline;
 
-  /* Disable The JPEG IT so the DMA Input Callback can not be interrupted by the JPEG EOC IT or JPEG HPD IT */
-  __HAL_JPEG_DISABLE_IT(hjpeg, JPEG_INTERRUPT_MASK);
+  (void)HAL_JPEG_Pause(hjpeg, JPEG_PAUSE_RESUME_INPUT_OUTPUT);
+  pipe->InPaused = 0UL;
+  pipe->OutPaused = 0UL;
 
-  if ((hjpeg->Context & (JPEG_CONTEXT_METHOD_MASK | JPEG_CONTEXT_ENDING_DMA)) ==
-      JPEG_CONTEXT_DMA) /* Check if context method is DMA and we are not in ending DMA stage */
+  /* Ignore the DMA2D events from now on */
+  JPEG_PipelineHandle = NULL;
+
+  if (pipe->CpltCallback != NULL)
   {
-    JPEG_DISABLE_DMA(hjpeg, JPEG_DMA_IDMA);
+    pipe->CpltCallback(hjpeg, HAL_ERROR);
+  }
+}
 
-    hjpeg->JpegInCount = hjpeg->InDataLength - JPEG_GET_DMA_REMAIN_DATA(hdma);
+/**
+  * @brief  DMA2D segment conversion complete callback of the pipeline
+  * @param  hdma2d pointer to a DMA2D_HandleTypeDef structure
+  * @retval None
+  */
+static void JPEG_Pipeline_DMA2DCpltCallback(DMA2D_HandleTypeDef *hdma2d)
+{
+  JPEG_HandleTypeDef *hjpeg = JPEG_PipelineHandle;
+  JPEG_PipelineTypeDef *pipe;
+  uint32_t done = 0UL;
+  uint32_t primask_bit;
 
-    /*Call HAL_JPEG_GetDataCallback to get new data */
-#if (USE_HAL_JPEG_REGISTER_CALLBACKS == 1)
-    hjpeg->GetDataCallback(hjpeg, hjpeg->JpegInCount);
-#else
-    HAL_JPEG_GetDataCallback(hjpeg, hjpeg->JpegInCount);
-#endif /* USE_HAL_JPEG_REGISTER_CALLBACKS */
+  UNUSED(hdma2d);
 
-    if (hjpeg->InDataLength >= 4UL)
+  if (hjpeg != NULL)
+  {
+    pipe = hjpeg->pPipeline;
+
+    /* The codec output events may run at another priority */
+    primask_bit = __get_PRIMASK();
+    __disable_irq();
+
+    pipe->Converting = 0UL;
+    pipe->McuIndex += pipe->SegmentMcus;
+    pipe->ChunkMcu += pipe->SegmentMcus;
+
+    if ((pipe->ChunkMcu == (pipe->ChunkSize / pipe->McuSize)) || (pipe->McuIndex == pipe->TotalMcus))
     {
-      /*JPEG Input DMA transfer data number must be multiple of 32 bits word
-        as the destination is a 32 bits (4 bytes) register */
-      hjpeg->InDataLength = ((hjpeg->InDataLength + 3UL) / 4UL) * 4UL;
+      /* Chunk converted: hand it back to the codec if it waits for one */
+      pipe->ChunkMcu = 0UL;
+      pipe->ConvertIndex++;
+      if ((pipe->OutPaused != 0UL) && (pipe->McuIndex < pipe->TotalMcus))
+      {
+        pipe->OutPaused = 0UL;
+        HAL_JPEG_ConfigOutputBuffer(hjpeg,
+                                    &pipe->pOutChunks[(pipe->FillIndex % pipe->ChunkCount) * pipe->ChunkSize],
+                                    pipe->ChunkSize);
+        (void)HAL_JPEG_Resume(hjpeg, JPEG_PAUSE_RESUME_OUTPUT);
+      }
+    }
+
+    if (pipe->McuIndex == pipe->TotalMcus)
+    {
+      JPEG_PipelineHandle = NULL;
+      done = 1UL;
     }
     else
     {
-      /* Nothing to do */
+      JPEG_Pipeline_Convert(hjpeg);
     }
 
-    if (((hjpeg->Context &  JPEG_CONTEXT_PAUSE_INPUT) == 0UL) && (hjpeg->InDataLength > 0UL))
+    __set_PRIMASK(primask_bit);
+
+    if ((done != 0UL) && (pipe->CpltCallback != NULL))
     {
-      /* Start DMA FIFO In transfer */
-      if (HAL_DMA_Start_IT(hjpeg->hdmain, (uint32_t)hjpeg->pJpegInBuffPtr, (uint32_t)&hjpeg->Instance->DIR,
-                           hjpeg->InDataLength) != HAL_OK)
-      {
-        hjpeg->ErrorCode |= HAL_JPEG_ERROR_DMA;
-        hjpeg->State = HAL_JPEG_STATE_ERROR;
-#if (USE_HAL_JPEG_REGISTER_CALLBACKS == 1)
-        hjpeg->ErrorCallback(hjpeg);
-#else
-        HAL_JPEG_ErrorCallback(hjpeg);
-#endif /* USE_HAL_JPEG_REGISTER_CALLBACKS */
-        return;
-      }
-      JPEG_ENABLE_DMA(hjpeg, JPEG_DMA_IDMA);
+      pipe->CpltCallback(hjpeg, HAL_OK);
     }
-
-    /* JPEG Conversion still on going : Enable the JPEG IT */
-    __HAL_JPEG_ENABLE_IT(hjpeg, JPEG_IT_EOC | JPEG_IT_HPD);
   }
 }
 
 /**
-  * @brief  DMA output transfer complete callback
-  * @param  hdma pointer to a DMA_HandleTypeDef structure.
+  * @brief  DMA2D transfer error callback of the pipeline
+  * @param  hdma2d pointer to a DMA2D_HandleTypeDef structure
   * @retval None
   */
-static void JPEG_DMAOutCpltCallback(DMA_HandleTypeDef *hdma)
+static void JPEG_Pipeline_DMA2DErrorCallback(DMA2D_HandleTypeDef *hdma2d)
 {
-  JPEG_HandleTypeDef *hjpeg = (JPEG_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+  JPEG_HandleTypeDef *hjpeg = JPEG_PipelineHandle;
 
-  /* Disable The JPEG IT so the DMA Output Callback can not be interrupted by the JPEG EOC IT or JPEG HPD IT */
-  __HAL_JPEG_DISABLE_IT(hjpeg, JPEG_INTERRUPT_MASK);
+  UNUSED(hdma2d);
 
-  if ((hjpeg->Context & (JPEG_CONTEXT_METHOD_MASK | JPEG_CONTEXT_ENDING_DMA)) ==
-      JPEG_CONTEXT_DMA) /* Check if context method is DMA and we are not in ending DMA stage */
+  if (hjpeg != NULL)
   {
-    if (__HAL_JPEG_GET_FLAG(hjpeg, JPEG_FLAG_EOCF) == 0UL)
-    {
-      JPEG_DISABLE_DMA(hjpeg, JPEG_DMA_ODMA);
-      hjpeg->JpegOutCount = hjpeg->OutDataLength - JPEG_GET_DMA_REMAIN_DATA(hdma);
+    hjpeg->pPipeline->Converting = 0UL;
+    JPEG_Pipeline_Error(hjpeg);
+  }
+}
 
-      /*Output Buffer is full, call HAL_JPEG_DataReadyCallback*/
-#if (USE_HAL_JPEG_REGISTER_CALLBACKS == 1)
-      hjpeg->DataReadyCallback(hjpeg, hjpeg->pJpegOutBuffPtr, hjpeg->JpegOutCount);
-#else
-      HAL_JPEG_DataReadyCallback(hjpeg, hjpeg->pJpegOutBuffPtr, hjpeg->JpegOutCount);
-#endif /* USE_HAL_JPEG_REGISTER_CALLBACKS */
+/**
+  * @brief  Number of source frame lines fetched for an MCU row
+  * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
+  *         the configuration information for JPEG module
+  * @param  Row MCU row index
+  * @retval Number of lines, the last MCU row may be cut by the image height
+  */
+static uint32_t JPEG_EncodeSource_Lines(const JPEG_HandleTypeDef *hjpeg, uint32_t Row)
+{
+  const JPEG_EncodeSourceTypeDef *src = hjpeg->pEncodeSource;
+  uint32_t lines = hjpeg->Conf.ImageHeight - (Row * src->McuHeight);
 
-      if ((hjpeg->Context &  JPEG_CONTEXT_PAUSE_OUTPUT) == 0UL)
+  if (lines > src->McuHeight)
+  {
+    lines = src->McuHeight;
+  }
+
+  return lines;
+}
+
+/**
+  * @brief  Start the DMA2D fetch of the next MCU row strip of the source frame
+  * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
+  *         the configuration information for JPEG module
+  * @retval None
+  */
+static void JPEG_EncodeSource_Fetch(JPEG_HandleTypeDef *hjpeg)
+{
+  JPEG_EncodeSourceTypeDef *src = hjpeg->pEncodeSource;
+  uint32_t address;
+
+  address = src->FrameAddress + (((src->FetchRow * src->McuHeight) * src->FramePitch) * src->BytesPerPixel);
+
+  src->Fetching = 1UL;
+  if (HAL_DMA2D_Start_IT(src->hdma2d, address, (uint32_t)src->pStrip, src->McusPerRow * src->McuWidth,
+                         JPEG_EncodeSource_Lines(hjpeg, src->FetchRow)) != HAL_OK)
+  {
+    src->Fetching = 0UL;
+    JPEG_EncodeSource_Error(hjpeg);
+  }
+}
+
+/**
+  * @brief  Reorder the fetched ARGB8888 strip into the next free MCU row buffer.
+  * @note   JFIF integer conversion. Chrominance is averaged over the subsampled pixels and
+  *         the last fetched line is replicated down to the MCU height.
+  * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
+  *         the configuration information for JPEG module
+  * @param  Lines Number of valid lines in the strip
+  * @retval None
+  */
+static void JPEG_EncodeSource_Convert(const JPEG_HandleTypeDef *hjpeg, uint32_t Lines)
+{
+  const JPEG_EncodeSourceTypeDef *src = hjpeg->pEncodeSource;
+  uint8_t *pMcu = &src->pMcuRows[(src->RowsReady % 2UL) * src->RowSize];
+  const uint32_t *pLine;
+  uint32_t stripWidth = src->McusPerRow * src->McuWidth;
+  uint32_t hShift = (src->McuWidth / 8UL) - 1UL;
+  uint32_t vShift = (src->McuHeight / 8UL) - 1UL;
+  uint32_t mcu;
+  uint32_t bx;
+  uint32_t by;
+  uint32_t x;
+  uint32_t y;
+  uint32_t dx;
+  uint32_t dy;
+  uint32_t line;
+  uint32_t pixel;
+  uint32_t red;
+  uint32_t green;
+  uint32_t blue;
+
+  for (mcu = 0UL; mcu < src->McusPerRow; mcu++)
+  {
+    /* Luminance blocks, left to right then top to bottom */
+    for (by = 0UL; by < src->McuHeight; by += 8UL)
+    {
+      for (bx = 0UL; bx < src->McuWidth; bx += 8UL)
       {
-        /* Start DMA FIFO Out transfer */
-        if (HAL_DMA_Start_IT(hjpeg->hdmaout, (uint32_t)&hjpeg->Instance->DOR, (uint32_t)hjpeg->pJpegOutBuffPtr,
-                             hjpeg->OutDataLength) != HAL_OK)
+        for (y = 0UL; y < 8UL; y++)
         {
-          hjpeg->ErrorCode |= HAL_JPEG_ERROR_DMA;
-          hjpeg->State = HAL_JPEG_STATE_ERROR;
-#if (USE_HAL_JPEG_REGISTER_CALLBACKS == 1)
-          hjpeg->ErrorCallback(hjpeg);
-#else
-          HAL_JPEG_ErrorCallback(hjpeg);
-#endif /* USE_HAL_JPEG_REGISTER_CALLBACKS */
-          return;
+          line = ((by + y) < Lines) ? (by + y) : (Lines - 1UL);
+          pLine = &src->pStrip[(line * stripWidth) + (mcu * src->McuWidth) + bx];
+          for (x = 0UL; x < 8UL; x++)
+          {
+            pixel = pLine[x];
+            red   = (pixel >> 16) & 0xFFUL;
+            green = (pixel >> 8) & 0xFFUL;
+            blue  = pixel & 0xFFUL;
+            *pMcu = (uint8_t)(((77UL * red) + (150UL * green) + (29UL * blue) + 128UL) >> 8);
+            pMcu++;
+          }
         }
-        JPEG_ENABLE_DMA(hjpeg, JPEG_DMA_ODMA);
       }
     }
 
-    /* JPEG Conversion still on going : Enable the JPEG IT */
-    __HAL_JPEG_ENABLE_IT(hjpeg, JPEG_IT_EOC | JPEG_IT_HPD);
+    if (hjpeg->Conf.ColorSpace == JPEG_YCBCR_COLORSPACE)
+    {
+      /* Cb then Cr block, one pass over the pixels */
+      for (y = 0UL; y < 8UL; y++)
+      {
+        for (x = 0UL; x < 8UL; x++)
+        {
+          red = 0UL;
+          green = 0UL;
+          blue = 0UL;
+          for (dy = 0UL; dy <= vShift; dy++)
+          {
+            line = ((y << vShift) + dy);
+            line = (line < Lines) ? line : (Lines - 1UL);
+            pLine = &src->pStrip[(line * stripWidth) + (mcu * src->McuWidth) + (x << hShift)];
+            for (dx = 0UL; dx <= hShift; dx++)
+            {
+              pixel = pLine[dx];
+              red   += (pixel >> 16) & 0xFFUL;
+              green += (pixel >> 8) & 0xFFUL;
+              blue  += pixel & 0xFFUL;
+            }
+          }
+          red   >>= (hShift + vShift);
+          green >>= (hShift + vShift);
+          blue  >>= (hShift + vShift);
+
+          /* Offset forms of Cb = 128 - 0.169R - 0.331G + 0.5B and Cr = 128 + 0.5R - 0.419G - 0.081B */
+          pMcu[(y * 8UL) + x]        = (uint8_t)((32895UL + (128UL * blue) - (43UL * red) - (85UL * green)) >> 8);
+          pMcu[64UL + (y * 8UL) + x] = (uint8_t)((32895UL + (128UL * red) - (107UL * green) - (21UL * blue)) >> 8);
+        }
+      }
+      pMcu = &pMcu[128];
+    }
   }
 }
 
-
 /**
-  * @brief  DMA Transfer error callback
-  * @param  hdma pointer to a DMA_HandleTypeDef structure.
+  * @brief  Convert the pending strip if an MCU row buffer is free, then fetch the next strip.
+  * @note   The conversion runs with interrupts enabled, only its claim and its
+  *         publication to the codec are done with interrupts masked.
+  * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
+  *         the configuration information for JPEG module
   * @retval None
   */
-static void JPEG_DMAErrorCallback(DMA_HandleTypeDef *hdma)
+static void JPEG_EncodeSource_Service(JPEG_HandleTypeDef *hjpeg)
 {
-  JPEG_HandleTypeDef *hjpeg = (JPEG_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+  JPEG_EncodeSourceTypeDef *src = hjpeg->pEncodeSource;
+  uint32_t claimed = 0UL;
+  uint32_t primask_bit;
 
-  if (HAL_DMA_GetError(hdma) != HAL_DMA_ERROR_NONE)
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+  if ((src->StripPending != 0UL) && (src->Converting == 0UL) && ((src->RowsReady - src->RowsConsumed) < 2UL))
   {
-    /*Stop Encoding/Decoding*/
-    hjpeg->Instance->CONFR0 &=  ~JPEG_CONFR0_START;
-
-    /* Disable All Interrupts */
-    __HAL_JPEG_DISABLE_IT(hjpeg, JPEG_INTERRUPT_MASK);
+    src->StripPending = 0UL;
+    src->Converting = 1UL;
+    claimed = 1UL;
+  }
+  __set_PRIMASK(primask_bit);
 
-    /* Disable All DMA requests */
-    JPEG_DISABLE_DMA(hjpeg, JPEG_DMA_MASK);
+  if (claimed != 0UL)
+  {
+    JPEG_EncodeSource_Convert(hjpeg, JPEG_EncodeSource_Lines(hjpeg, src->FetchRow));
 
-    hjpeg->State = HAL_JPEG_STATE_READY;
-    hjpeg->ErrorCode |= HAL_JPEG_ERROR_DMA;
-#if (USE_HAL_JPEG_REGISTER_CALLBACKS == 1)
-    hjpeg->ErrorCallback(hjpeg);
-#else
-    HAL_JPEG_ErrorCallback(hjpeg);
-#endif /* USE_HAL_JPEG_REGISTER_CALLBACKS */
+    primask_bit = __get_PRIMASK();
+    __disable_irq();
+    src->RowsReady++;
+    src->FetchRow++;
+    src->Converting = 0UL;
+    if (src->InPaused != 0UL)
+    {
+      /* The codec starved: hand it the row just converted */
+      src->InPaused = 0UL;
+      HAL_JPEG_ConfigInputBuffer(hjpeg, &src->pMcuRows[(src->RowsConsumed % 2UL) * src->RowSize], src->RowSize);
+      (void)HAL_JPEG_Resume(hjpeg, JPEG_PAUSE_RESUME_INPUT);
+    }
+    if ((src->FetchRow < src->Rows) && (JPEG_EncodeSourceHandle == hjpeg))
+    {
+      JPEG_EncodeSource_Fetch(hjpeg);
+    }
+    __set_PRIMASK(primask_bit);
   }
 }
 
 /**
-  * @brief  DMA output Abort callback
-  * @param  hdma pointer to a DMA_HandleTypeDef structure.
+  * @brief  Release the MCU row consumed by the codec and hand it the next one
+  * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
+  *         the configuration information for JPEG module
+  * @param  NbDecodedData Number of consummed data in bytes, always a whole MCU row
   * @retval None
   */
-static void JPEG_DMAOutAbortCallback(DMA_HandleTypeDef *hdma)
+static void JPEG_EncodeSource_GetData(JPEG_HandleTypeDef *hjpeg, uint32_t NbDecodedData)
 {
-  JPEG_HandleTypeDef *hjpeg = (JPEG_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+  JPEG_EncodeSourceTypeDef *src = hjpeg->pEncodeSource;
+  uint32_t primask_bit;
 
-  if ((hjpeg->Context & JPEG_CONTEXT_ENDING_DMA) != 0UL)
+  UNUSED(NbDecodedData);
+
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+  src->RowsConsumed++;
+  if (src->RowsReady != src->RowsConsumed)
   {
-    JPEG_DMA_EndProcess(hjpeg);
+    HAL_JPEG_ConfigInputBuffer(hjpeg, &src->pMcuRows[(src->RowsConsumed % 2UL) * src->RowSize], src->RowSize);
   }
-}
+  else if (src->RowsConsumed >= src->Rows)
+  {
+    /* Whole frame handed to the codec: the encoding completes on its own */
+    HAL_JPEG_ConfigInputBuffer(hjpeg, src->pMcuRows, 0UL);
+    JPEG_EncodeSourceHandle = NULL;
+  }
+  else
+  {
+    /* Resumed once the next strip is converted */
+    HAL_JPEG_ConfigInputBuffer(hjpeg, src->pMcuRows, 0UL);
+    src->InPaused = 1UL;
+    (void)HAL_JPEG_Pause(hjpeg, JPEG_PAUSE_RESUME_INPUT);
+  }
+  __set_PRIMASK(primask_bit);
 
+  /* A row buffer was freed */
+  JPEG_EncodeSource_Service(hjpeg);
+}
 
 /**
-  * @brief  Calculate the decoded image quality (from 1 to 100)
+  * @brief  Stop the encoding on a strip fetch error
   * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
   *         the configuration information for JPEG module
-  * @retval JPEG image quality from 1 to 100.
+  * @retval None
   */
-static uint32_t JPEG_GetQuality(const JPEG_HandleTypeDef *hjpeg)
+static void JPEG_EncodeSource_Error(JPEG_HandleTypeDef *hjpeg)
 {
-  uint32_t quality = 0;
-  uint32_t quantRow;
-  uint32_t quantVal;
-  uint32_t scale;
-  uint32_t i;
-  uint32_t j;
-  const __IO uint32_t *tableAddress = hjpeg->Instance->QMEM0;
+  JPEG_EncodeSourceHandle = NULL;
 
-  i = 0;
-  while (i < (JPEG_QUANT_TABLE_SIZE - 3UL))
-  {
-    quantRow = *tableAddress;
-    for (j = 0; j < 4UL; j++)
-    {
-      quantVal = (quantRow >> (8UL * j)) & 0xFFUL;
-      if (quantVal == 1UL)
-      {
-        /* if Quantization value = 1 then quality is 100%*/
-        quality += 100UL;
-      }
-      else
-      {
-        /* Note that the quantization coefficients must be specified in the table in zigzag order */
-        scale = (quantVal * 100UL) / ((uint32_t) hjpeg->QuantTable0[JPEG_ZIGZAG_ORDER[i + j]]);
+  /*Stop Encoding*/
+  hjpeg->Instance->CONFR0 &=  ~JPEG_CONFR0_START;
 
-        if (scale <= 100UL)
-        {
-          quality += (200UL - scale) / 2UL;
-        }
-        else
-        {
-          quality += 5000UL / scale;
-        }
-      }
-    }
+  /* Disable All Interrupts */
+  __HAL_JPEG_DISABLE_IT(hjpeg, JPEG_INTERRUPT_MASK);
 
-    i += 4UL;
-    tableAddress ++;
+  /* Disable All DMA requests */
+  JPEG_DISABLE_DMA(hjpeg, JPEG_DMA_MASK);
+
+  hjpeg->State = HAL_JPEG_STATE_READY;
+  hjpeg->ErrorCode |= HAL_JPEG_ERROR_DMA;
+#if (USE_HAL_JPEG_REGISTER_CALLBACKS == 1)
+  hjpeg->ErrorCallback(hjpeg);
+#else
+  HAL_JPEG_ErrorCallback(hjpeg);
+#endif /* USE_HAL_JPEG_REGISTER_CALLBACKS */
+}
+
+/**
+  * @brief  DMA2D strip fetch complete callback of the encode source
+  * @param  hdma2d pointer to a DMA2D_HandleTypeDef structure
+  * @retval None
+  */
+static void JPEG_EncodeSource_DMA2DCpltCallback(DMA2D_HandleTypeDef *hdma2d)
+{
+  JPEG_HandleTypeDef *hjpeg = JPEG_EncodeSourceHandle;
+
+  UNUSED(hdma2d);
+
+  if (hjpeg != NULL)
+  {
+    hjpeg->pEncodeSource->Fetching = 0UL;
+    hjpeg->pEncodeSource->StripPending = 1UL;
+    JPEG_EncodeSource_Service(hjpeg);
   }
+}
 
-  return (quality / 64UL);
+/**
+  * @brief  DMA2D strip fetch error callback of the encode source
+  * @param  hdma2d pointer to a DMA2D_HandleTypeDef structure
+  * @retval None
+  */
+static void JPEG_EncodeSource_DMA2DErrorCallback(DMA2D_HandleTypeDef *hdma2d)
+{
+  JPEG_HandleTypeDef *hjpeg = JPEG_EncodeSourceHandle;
+
+  UNUSED(hdma2d);
+
+  if (hjpeg != NULL)
+  {
+    hjpeg->pEncodeSource->Fetching = 0UL;
+    JPEG_EncodeSource_Error(hjpeg);
+  }
 }
+#endif /* HAL_DMA2D_MODULE_ENABLED && USE_DMA2D_COMMAND_LIST_MODE == 0U */
 /**
   * @}
   */
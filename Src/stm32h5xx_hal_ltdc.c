@@ -65,6 +65,12 @@
          functions: HAL_LTDC_SetPixelFormat(), HAL_LTDC_SetAlpha(), HAL_LTDC_SetWindowSize(),
          HAL_LTDC_SetWindowPosition() and HAL_LTDC_SetAddress().
 
+     (#) Optionally, attach a swap chain of 2 or 3 frame buffers to a layer using HAL_LTDC_SwapChain_Init().
+         Render into a frame buffer obtained with HAL_LTDC_SwapChain_Acquire() then queue it with
+         HAL_LTDC_SwapChain_Present(): the address is reloaded at the next vertical blanking and the
+         previous frame buffer is returned through HAL_LTDC_BufferReleaseCallback(). The functions never
+         wait for the display: they return HAL_BUSY when no frame buffer is free or one is already queued.
+
      (#) Variant functions with _NoReload suffix allows to set the LTDC configuration/settings without immediate reload.
          This is useful in case when the program requires to modify serval LTDC settings (on one or both layers)
          then applying(reload) these settings in one shot by calling the function HAL_LTDC_Reload().
@@ -115,6 +121,9 @@
       (+) MspInitCallback     : LTDC MspInit.
       (+) MspDeInitCallback   : LTDC MspDeInit.
     [..]
+    The Buffer Release callback is registered with HAL_LTDC_RegisterBufferReleaseCallback()
+    and reset with HAL_LTDC_UnRegisterBufferReleaseCallback().
+    [..]
     This function takes as parameters the HAL peripheral handle, the callback ID
     and a pointer to the user callback function.
 
@@ -189,6 +198,7 @@
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
 static void LTDC_SetConfig(LTDC_HandleTypeDef *hltdc, LTDC_LayerCfgTypeDef *pLayerCfg, uint32_t LayerIdx);
+static void LTDC_SwapChain_Flip(LTDC_HandleTypeDef *hltdc);
 /* Private functions ---------------------------------------------------------*/
 
 /** @defgroup LTDC_Exported_Functions LTDC Exported Functions
@@ -252,6 +262,7 @@ HAL_StatusTypeDef HAL_LTDC_Init(LTDC_HandleTypeDef *hltdc)
     hltdc->LineEventCallback   = HAL_LTDC_LineEventCallback;    /* Legacy weak LineEventCallback    */
     hltdc->ReloadEventCallback = HAL_LTDC_ReloadEventCallback;  /* Legacy weak ReloadEventCallback  */
     hltdc->ErrorCallback       = HAL_LTDC_ErrorCallback;        /* Legacy weak ErrorCallback        */
+    hltdc->BufferReleaseCallback = HAL_LTDC_BufferReleaseCallback; /* Legacy weak BufferReleaseCallback */
 
     if (hltdc->MspInitCallback == NULL)
     {
@@ -309,6 +320,9 @@ HAL_StatusTypeDef HAL_LTDC_Init(LTDC_HandleTypeDef *hltdc)
   /* Initialize the error code */
   hltdc->ErrorCode = HAL_LTDC_ERROR_NONE;
 
+  /* No swap chain attached */
+  hltdc->pSwapChain = NULL;
+
   /* Initialize the LTDC state*/
   hltdc->State = HAL_LTDC_STATE_READY;
 
@@ -599,6 +613,79 @@ HAL_StatusTypeDef HAL_LTDC_UnRegisterCallback(LTDC_HandleTypeDef *hltdc, HAL_LTD
 
   return status;
 }
+
+/**
+  * @brief  Register the LTDC Buffer Release Callback
+  *         To be used instead of the weak HAL_LTDC_BufferReleaseCallback() predefined callback
+  * @param  hltdc      pointer to a LTDC_HandleTypeDef structure that contains
+  *                    the configuration information for the LTDC.
+  * @param  pCallback  pointer to the Buffer Release Callback function
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_LTDC_RegisterBufferReleaseCallback(LTDC_HandleTypeDef *hltdc,
+                                                         pLTDC_BufferReleaseCallbackTypeDef pCallback)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if (pCallback == NULL)
+  {
+    /* Update the error code */
+    hltdc->ErrorCode |= HAL_LTDC_ERROR_INVALID_CALLBACK;
+
+    return HAL_ERROR;
+  }
+  /* Process locked */
+  __HAL_LOCK(hltdc);
+
+  if (hltdc->State == HAL_LTDC_STATE_READY)
+  {
+    hltdc->BufferReleaseCallback = pCallback;
+  }
+  else
+  {
+    /* Update the error code */
+    hltdc->ErrorCode |= HAL_LTDC_ERROR_INVALID_CALLBACK;
+    /* Return error status */
+    status =  HAL_ERROR;
+  }
+
+  /* Release Lock */
+  __HAL_UNLOCK(hltdc);
+
+  return status;
+}
+
+/**
+  * @brief  UnRegister the LTDC Buffer Release Callback
+  *         LTDC Buffer Release Callback is redirected to the weak HAL_LTDC_BufferReleaseCallback() predefined callback
+  * @param  hltdc      pointer to a LTDC_HandleTypeDef structure that contains
+  *                    the configuration information for the LTDC.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_LTDC_UnRegisterBufferReleaseCallback(LTDC_HandleTypeDef *hltdc)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  /* Process locked */
+  __HAL_LOCK(hltdc);
+
+  if (hltdc->State == HAL_LTDC_STATE_READY)
+  {
+    hltdc->BufferReleaseCallback = HAL_LTDC_BufferReleaseCallback; /* Legacy weak BufferReleaseCallback */
+  }
+  else
+  {
+    /* Update the error code */
+    hltdc->ErrorCode |= HAL_LTDC_ERROR_INVALID_CALLBACK;
+    /* Return error status */
+    status =  HAL_ERROR;
+  }
+
+  /* Release Lock */
+  __HAL_UNLOCK(hltdc);
+
+  return status;
+}
 #endif /* USE_HAL_LTDC_REGISTER_CALLBACKS */
 
 /**
@@ -725,6 +812,9 @@ void HAL_LTDC_IRQHandler(LTDC_HandleTypeDef *hltdc)
     /* Process unlocked */
     __HAL_UNLOCK(hltdc);
 
+    /* Swap chain: the queued frame buffer is now displayed */
+    LTDC_SwapChain_Flip(hltdc);
+
     /* Reload interrupt Callback */
 #if (USE_HAL_LTDC_REGISTER_CALLBACKS == 1)
     /*Call registered reload Event callback */
@@ -784,6 +874,24 @@ __weak void HAL_LTDC_ReloadEventCallback(LTDC_HandleTypeDef *hltdc)
    */
 }
 
+/**
+  * @brief  Buffer Release callback, called when a swap chain frame buffer can be rendered again.
+  * @param  hltdc    pointer to a LTDC_HandleTypeDef structure that contains
+  *                  the configuration information for the LTDC.
+  * @param  Address  address of the released frame buffer.
+  * @retval None
+  */
+__weak void HAL_LTDC_BufferReleaseCallback(LTDC_HandleTypeDef *hltdc, uint32_t Address)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hltdc);
+  UNUSED(Address);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_LTDC_BufferReleaseCallback could be implemented in the user file
+   */
+}
+
 /**
   * @}
   */
@@ -807,6 +915,7 @@ __weak void HAL_LTDC_ReloadEventCallback(LTDC_HandleTypeDef *hltdc)
       (+) Update pixel format on the fly.
       (+) Update transparency on the fly.
       (+) Update address on the fly.
+      (+) Swap double or triple buffered frame buffers at vertical blanking.
 
 @endverbatim
   * @{
@@ -2064,6 +2173,188 @@ HAL_StatusTypeDef HAL_LTDC_DisableCLUT_NoReload(LTDC_HandleTypeDef *hltdc, uint3
   return HAL_OK;
 }
 
+
+/**
+  * @brief  Attach a swap chain of 2 or 3 frame buffers to an LTDC layer.
+  * @note   The first frame buffer is displayed at once, the other ones are available for rendering.
+  * @param  hltdc        pointer to a LTDC_HandleTypeDef structure that contains
+  *                      the configuration information for the LTDC.
+  * @param  pSwapChain   pointer to a LTDC_SwapChainTypeDef structure, kept by the driver.
+  * @param  pAddresses   array of BufferCount frame buffer addresses.
+  * @param  BufferCount  number of frame buffers, 2 or 3.
+  * @param  LayerIdx     LTDC Layer index.
+  *                      This parameter can be one of the following values:
+  *                      LTDC_LAYER_1 (0) or LTDC_LAYER_2 (1).
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_LTDC_SwapChain_Init(LTDC_HandleTypeDef *hltdc, LTDC_SwapChainTypeDef *pSwapChain,
+                                          const uint32_t *pAddresses, uint32_t BufferCount, uint32_t LayerIdx)
+{
+  uint32_t index;
+
+  /* Check the parameters */
+  assert_param(IS_LTDC_LAYER(LayerIdx));
+
+  if ((pSwapChain == NULL) || (pAddresses == NULL) || (BufferCount < 2U) ||
+      (BufferCount > LTDC_SWAPCHAIN_MAX_BUFFERS))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hltdc->pSwapChain != NULL)
+  {
+    return HAL_BUSY;
+  }
+
+  for (index = 0U; index < BufferCount; index++)
+  {
+    pSwapChain->BufferAddress[index] = pAddresses[index];
+  }
+  pSwapChain->BufferCount = BufferCount;
+  pSwapChain->LayerIdx    = LayerIdx;
+  pSwapChain->Front       = 0U;
+  pSwapChain->Pending     = LTDC_SWAPCHAIN_NONE;
+  pSwapChain->FreeMask    = ((1UL << BufferCount) - 1U) & ~1UL;
+
+  /* Display the first frame buffer */
+  if (HAL_LTDC_SetAddress(hltdc, pSwapChain->BufferAddress[0], LayerIdx) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  hltdc->pSwapChain = pSwapChain;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Get a frame buffer of the swap chain to render the next frame into.
+  * @note   This function never waits: HAL_BUSY is returned when every back buffer is displayed
+  *         or queued, the application may retry on HAL_LTDC_BufferReleaseCallback().
+  * @param  hltdc     pointer to a LTDC_HandleTypeDef structure that contains
+  *                   the configuration information for the LTDC.
+  * @param  pAddress  address of the frame buffer to render into.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_LTDC_SwapChain_Acquire(LTDC_HandleTypeDef *hltdc, uint32_t *pAddress)
+{
+  LTDC_SwapChainTypeDef *p_chain = hltdc->pSwapChain;
+  HAL_StatusTypeDef status = HAL_BUSY;
+  uint32_t primask_bit;
+  uint32_t index;
+
+  if ((p_chain == NULL) || (pAddress == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Enter critical section: the free mask is updated by the reload interrupt */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  for (index = 0U; (index < p_chain->BufferCount) && (status != HAL_OK); index++)
+  {
+    if ((p_chain->FreeMask & (1UL << index)) != 0U)
+    {
+      p_chain->FreeMask &= ~(1UL << index);
+      *pAddress = p_chain->BufferAddress[index];
+      status = HAL_OK;
+    }
+  }
+
+  /* Exit critical section */
+  __set_PRIMASK(primask_bit);
+
+  return status;
+}
+
+/**
+  * @brief  Queue a rendered frame buffer for display at the next vertical blanking.
+  * @note   The frame buffer address is reloaded during the vertical blanking so the displayed frame
+  *         never tears. The previously displayed frame buffer is released at that time.
+  * @note   This function never waits: HAL_BUSY is returned while the previous frame buffer is still
+  *         queued, the application may retry on HAL_LTDC_BufferReleaseCallback(). With triple buffering
+  *         the application meanwhile renders into the third frame buffer.
+  * @param  hltdc    pointer to a LTDC_HandleTypeDef structure that contains
+  *                  the configuration information for the LTDC.
+  * @param  Address  address of a frame buffer returned by HAL_LTDC_SwapChain_Acquire().
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_LTDC_SwapChain_Present(LTDC_HandleTypeDef *hltdc, uint32_t Address)
+{
+  LTDC_SwapChainTypeDef *p_chain = hltdc->pSwapChain;
+  uint32_t primask_bit;
+  uint32_t index = 0U;
+
+  if (p_chain == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  while ((index < p_chain->BufferCount) && (p_chain->BufferAddress[index] != Address))
+  {
+    index++;
+  }
+
+  /* Enter critical section: the swap chain is updated by the reload interrupt */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  /* The frame buffer must be owned by the application */
+  if ((index == p_chain->BufferCount) || ((p_chain->FreeMask & (1UL << index)) != 0U) ||
+      (index == p_chain->Front) || (index == p_chain->Pending))
+  {
+    /* Exit critical section */
+    __set_PRIMASK(primask_bit);
+
+    return HAL_ERROR;
+  }
+
+  /* Complete a flip whose reload interrupt is not yet serviced */
+  LTDC_SwapChain_Flip(hltdc);
+
+  if (p_chain->Pending != LTDC_SWAPCHAIN_NONE)
+  {
+    /* Exit critical section */
+    __set_PRIMASK(primask_bit);
+
+    return HAL_BUSY;
+  }
+  p_chain->Pending = index;
+
+  /* Update the layer address and reload it during the next vertical blanking */
+  hltdc->LayerCfg[p_chain->LayerIdx].FBStartAdress = Address;
+  LTDC_LAYER(hltdc, p_chain->LayerIdx)->CFBAR = Address;
+  __HAL_LTDC_CLEAR_FLAG(hltdc, LTDC_FLAG_RR);
+  __HAL_LTDC_ENABLE_IT(hltdc, LTDC_IT_RR);
+  hltdc->Instance->SRCR = LTDC_RELOAD_VERTICAL_BLANKING;
+
+  /* Exit critical section */
+  __set_PRIMASK(primask_bit);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Detach the swap chain of the handle.
+  * @note   The displayed frame buffer is kept; a frame buffer queued for display may still be
+  *         reloaded at the next vertical blanking.
+  * @param  hltdc  pointer to a LTDC_HandleTypeDef structure that contains
+  *                the configuration information for the LTDC.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_LTDC_SwapChain_DeInit(LTDC_HandleTypeDef *hltdc)
+{
+  if (hltdc->pSwapChain == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  hltdc->pSwapChain = NULL;
+
+  return HAL_OK;
+}
+
 /**
   * @}
   */
@@ -2197,6 +2488,34 @@ static void LTDC_SetConfig(LTDC_HandleTypeDef *hltdc, LTDC_LayerCfgTypeDef *pLay
   LTDC_LAYER(hltdc, LayerIdx)->CR |= (uint32_t)LTDC_LxCR_LEN;
 }
 
+/**
+  * @brief  Promote the queued frame buffer of the swap chain once it has been reloaded.
+  * @param  hltdc  pointer to a LTDC_HandleTypeDef structure that contains
+  *                the configuration information for the LTDC.
+  * @retval None
+  */
+static void LTDC_SwapChain_Flip(LTDC_HandleTypeDef *hltdc)
+{
+  LTDC_SwapChainTypeDef *p_chain = hltdc->pSwapChain;
+  uint32_t released;
+
+  /* The VBR bit is cleared by hardware once the shadow registers are reloaded */
+  if ((p_chain != NULL) && (p_chain->Pending != LTDC_SWAPCHAIN_NONE) &&
+      ((hltdc->Instance->SRCR & LTDC_SRCR_VBR) == 0U))
+  {
+    released = p_chain->Front;
+    p_chain->Front = p_chain->Pending;
+    p_chain->Pending = LTDC_SWAPCHAIN_NONE;
+    p_chain->FreeMask |= (1UL << released);
+
+#if (USE_HAL_LTDC_REGISTER_CALLBACKS == 1)
+    hltdc->BufferReleaseCallback(hltdc, p_chain->BufferAddress[released]);
+#else
+    HAL_LTDC_BufferReleaseCallback(hltdc, p_chain->BufferAddress[released]);
+#endif /* USE_HAL_LTDC_REGISTER_CALLBACKS */
+  }
+}
+
 /**
   * @}
   */
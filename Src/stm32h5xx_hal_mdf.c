@@ -82,6 +82,8 @@
                  saturation or DMA error occurs.
                  Use HAL_MDF_GetErrorCode() to get the corresponding error.
       (#) Use HAL_MDF_GenerateTrgo() to generate pulse on TRGO signal.
+      (#) In DMA mode, use HAL_MDF_GetAcqSampleCount() in the DMA callbacks to tag each completed
+          half buffer with the number of samples acquired since the start (or the trigger).
       (#) During acquisition, use HAL_MDF_SetDelay() and HAL_MDF_GetDelay() to respectively
           set and get the delay on data source.
       (#) During acquisition, use HAL_MDF_SetGain() and HAL_MDF_GetGain() to respectively
@@ -92,6 +94,19 @@
           to respectively set and get the filter offset error compensation.
       (#) Stop acquisition using HAL_MDF_AcqStop(), HAL_MDF_AcqStop_IT() or HAL_MDF_AcqStop_DMA().
 
+    *** Multi-filter DMA acquisition ***
+    ====================================
+    [..]
+      (#) Consecutive MDF filters can be read by the single DMA channel of the first one:
+          link its DMA handle, on a 2D addressing channel, to a queue of one GPDMA 2D node
+          with the transfer complete event at repeated block level.
+      (#) Start the filters in MDF_MODE_SYNC_CONT acquisition mode using
+          HAL_MDF_AcqStart_MultiDMA(): on each sample of the first filter the DMA reads one
+          sample of every filter, so that the buffer holds frames of interleaved samples.
+      (#) HAL_MDF_AcqHalfCpltCallback() and HAL_MDF_AcqCpltCallback() are called for the first
+          filter only, the error callbacks for each filter.
+      (#) Stop acquisition using HAL_MDF_AcqStop_MultiDMA().
+
     *** Clock absence detection ***
     ===============================
     [..]
@@ -240,6 +255,7 @@
   * @{
   */
 #define MDF_INSTANCE_NUMBER 7U /* 6 instances for MDF1 and 1 instance for ADF1 */
+#define MDF_MULTI_DMA_MAX_FRAMES 2048U /* Maximum block repeat count of a GPDMA 2D node */
 /**
   * @}
   */
@@ -1561,6 +1577,11 @@ HAL_StatusTypeDef HAL_MDF_AcqStart_DMA(MDF_HandleTypeDef *hmdf, const MDF_Filter
                                      MDF_DFLTIER_SDDETIE;
         }
 
+        /* Reset the sample counter of the DMA blocks */
+        hmdf->AcqBlockSamples = (pDmaConfig->MsbOnly == ENABLE) ? (pDmaConfig->DataLength / 2U) :
+                                (pDmaConfig->DataLength / 4U);
+        hmdf->AcqSampleCount  = 0U;
+
         /* Enable MDF DMA requests */
         hmdf->Instance->DFLTCR = MDF_DFLTCR_DMAEN;
 
@@ -1683,6 +1704,211 @@ HAL_StatusTypeDef HAL_MDF_AcqStop_DMA(MDF_HandleTypeDef *hmdf)
   return status;
 }
 
+/**
+  * @brief  This function allows to start acquisition of consecutive filters with one DMA.
+  * @note   The DMA handle of the first filter must be a 2D addressing channel linked to a
+  *         queue of one GPDMA 2D node built with the DMA parameters of HAL_MDF_AcqStart_DMA(),
+  *         32-bit data width and the transfer complete event at repeated block level
+  *         (DMA_TCEM_REPEATED_BLOCK_TRANSFER), the half transfer event then occurring at half
+  *         of the buffer. The sizes, addresses and offsets of the node are set by this function.
+  * @note   On each DMA request of the first filter, one block reads the data register of every
+  *         filter, in increasing filter order, so that the buffer is made of frames of NbFilters
+  *         32-bit samples. The filters must share the same configuration and are started
+  *         together by the trigger of MDF_MODE_SYNC_CONT acquisition mode.
+  * @param  phmdf Array of NbFilters MDF handles of consecutive filters, from the lowest one.
+  * @param  NbFilters Number of filters, from 2 to 6.
+  * @param  pFilterConfig Filter configuration parameters, common to all filters.
+  * @param  pDmaConfig DMA configuration parameters. DataLength is the size in bytes of the
+  *                    whole buffer, a multiple of 8 x NbFilters. MsbOnly must be disabled.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_MDF_AcqStart_MultiDMA(MDF_HandleTypeDef *const phmdf[], uint32_t NbFilters,
+                                            const MDF_FilterConfigTypeDef *pFilterConfig,
+                                            const MDF_DmaConfigTypeDef *pDmaConfig)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  MDF_HandleTypeDef *hmdf;
+  DMA_NodeTypeDef *pnode;
+  uint32_t stride = 0U;
+  uint32_t frames = 0U;
+  uint32_t cbr1;
+  uint32_t index;
+
+  /* Check parameters */
+  if ((phmdf == NULL) || (NbFilters < 2U) || (NbFilters > 6U) || (pFilterConfig == NULL) ||
+      (pDmaConfig == NULL))
+  {
+    status = HAL_ERROR;
+  }
+  else if ((pFilterConfig->AcquisitionMode != MDF_MODE_SYNC_CONT) || (pDmaConfig->MsbOnly != DISABLE) ||
+           ((pDmaConfig->DataLength % (8U * NbFilters)) != 0U))
+  {
+    status = HAL_ERROR;
+  }
+  else
+  {
+    frames = pDmaConfig->DataLength / (4U * NbFilters);
+    if ((frames == 0U) || (frames > MDF_MULTI_DMA_MAX_FRAMES))
+    {
+      status = HAL_ERROR;
+    }
+  }
+
+  /* Check the filters: consecutive, idle and with the main filter order allowed */
+  for (index = 0U; (status == HAL_OK) && (index < NbFilters); index++)
+  {
+    hmdf = phmdf[index];
+    if ((hmdf == NULL) || (!IS_MDF_INSTANCE(hmdf->Instance)) || (hmdf->State != HAL_MDF_STATE_READY) ||
+        ((hmdf->Instance->DFLTCR & MDF_DFLTCR_DFLTACTIVE) != 0U))
+    {
+      status = HAL_ERROR;
+    }
+    else if (((hmdf->Instance->OLDCR & MDF_OLDCR_OLDACTIVE) != 0U) && (pFilterConfig->CicMode >= MDF_ONE_FILTER_SINC4))
+    {
+      status = HAL_ERROR;
+    }
+    else if (index == 1U)
+    {
+      stride = (uint32_t) &hmdf->Instance->DFLTDR - (uint32_t) &phmdf[0]->Instance->DFLTDR;
+    }
+    else if ((index > 1U) &&
+             (((uint32_t) &hmdf->Instance->DFLTDR - (uint32_t) &phmdf[0]->Instance->DFLTDR) != (index * stride)))
+    {
+      status = HAL_ERROR;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+  }
+  if ((status == HAL_OK) && ((stride < 4U) || ((stride - 4U) > (DMA_CTR3_SAO >> DMA_CTR3_SAO_Pos)) ||
+                             ((((NbFilters - 1U) * stride) + 4U) > (DMA_CBR2_BRSAO >> DMA_CBR2_BRSAO_Pos))))
+  {
+    status = HAL_ERROR;
+  }
+
+  /* Check the DMA queue of the first filter: one 2D addressing node */
+  hmdf = (status == HAL_OK) ? phmdf[0] : NULL;
+  if ((hmdf != NULL) && ((hmdf->hdma == NULL) || ((hmdf->hdma->Mode & DMA_LINKEDLIST) != DMA_LINKEDLIST) ||
+                         (hmdf->hdma->LinkedListQueue == NULL) || (hmdf->hdma->LinkedListQueue->Head == NULL) ||
+                         (hmdf->hdma->LinkedListQueue->NodeNumber != 1U) ||
+                         ((hmdf->hdma->LinkedListQueue->Head->NodeInfo & DMA_CHANNEL_TYPE_2D_ADDR) !=
+                          DMA_CHANNEL_TYPE_2D_ADDR)))
+  {
+    status = HAL_ERROR;
+  }
+
+  if (status == HAL_OK)
+  {
+    assert_param(IS_MDF_CIC_MODE(pFilterConfig->CicMode));
+
+    /* Start the other filters without DMA request, they wait for the trigger */
+    for (index = 1U; index < NbFilters; index++)
+    {
+      if (pFilterConfig->ReshapeFilter.Activation == ENABLE)
+      {
+        /* Enable reshape filter overrun interrupt */
+        phmdf[index]->Instance->DFLTIER |= MDF_DFLTIER_RFOVRIE;
+      }
+
+      /* Enable saturation interrupt */
+      phmdf[index]->Instance->DFLTIER |= MDF_DFLTIER_SATIE;
+
+      /* Configure filter and start acquisition */
+      phmdf[index]->Instance->DFLTCR = 0U;
+      MDF_AcqStart(phmdf[index], pFilterConfig);
+    }
+
+    if (pFilterConfig->ReshapeFilter.Activation == ENABLE)
+    {
+      /* Enable reshape filter overrun interrupt */
+      hmdf->Instance->DFLTIER |= MDF_DFLTIER_RFOVRIE;
+    }
+
+    /* Enable saturation interrupt */
+    hmdf->Instance->DFLTIER |= MDF_DFLTIER_SATIE;
+
+    /* Reset the sample counter of the DMA blocks, in samples per filter */
+    hmdf->AcqBlockSamples = frames;
+    hmdf->AcqSampleCount  = 0U;
+
+    /* Enable MDF DMA requests */
+    hmdf->Instance->DFLTCR = MDF_DFLTCR_DMAEN;
+
+    /* One block of NbFilters samples per request, repeated for the frames of the buffer.
+       After each sample the source jumps to the data register of the next filter,
+       after each block it steps back to the data register of the first filter. */
+    pnode = hmdf->hdma->LinkedListQueue->Head;
+    cbr1 = (4U * NbFilters) | ((frames - 1U) << DMA_CBR1_BRC_Pos) | DMA_CBR1_BRSDEC;
+    pnode->LinkRegisters[NODE_CBR1_DEFAULT_OFFSET] = cbr1;
+    pnode->LinkRegisters[NODE_CSAR_DEFAULT_OFFSET] = (uint32_t) &hmdf->Instance->DFLTDR;
+    pnode->LinkRegisters[NODE_CDAR_DEFAULT_OFFSET] = pDmaConfig->Address;
+    pnode->LinkRegisters[NODE_CTR2_DEFAULT_OFFSET] |= DMA_CTR2_BREQ;
+    pnode->LinkRegisters[NODE_CTR3_DEFAULT_OFFSET] = (stride - 4U) << DMA_CTR3_SAO_Pos;
+    pnode->LinkRegisters[NODE_CBR2_DEFAULT_OFFSET] = (((NbFilters - 1U) * stride) + 4U) << DMA_CBR2_BRSAO_Pos;
+
+    /* Start DMA transfer */
+    hmdf->hdma->XferCpltCallback     = MDF_DmaXferCpltCallback;
+    hmdf->hdma->XferHalfCpltCallback = MDF_DmaXferHalfCpltCallback;
+    hmdf->hdma->XferErrorCallback    = MDF_DmaErrorCallback;
+    if (HAL_DMAEx_List_Start_IT(hmdf->hdma) != HAL_OK)
+    {
+      /* Release the other filters */
+      for (index = 1U; index < NbFilters; index++)
+      {
+        (void) HAL_MDF_AcqStop(phmdf[index]);
+        phmdf[index]->Instance->DFLTIER &= ~(MDF_DFLTIER_SATIE | MDF_DFLTIER_RFOVRIE);
+      }
+
+      /* Update state */
+      hmdf->State = HAL_MDF_STATE_ERROR;
+      status = HAL_ERROR;
+    }
+    else
+    {
+      /* Configure first filter and start acquisition */
+      MDF_AcqStart(hmdf, pFilterConfig);
+    }
+  }
+
+  /* Return function status */
+  return status;
+}
+
+/**
+  * @brief  This function allows to stop acquisition of filters started with one DMA.
+  * @param  phmdf Array of NbFilters MDF handles given to HAL_MDF_AcqStart_MultiDMA().
+  * @param  NbFilters Number of filters.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_MDF_AcqStop_MultiDMA(MDF_HandleTypeDef *const phmdf[], uint32_t NbFilters)
+{
+  HAL_StatusTypeDef status;
+  uint32_t index;
+
+  if ((phmdf == NULL) || (NbFilters < 2U) || (NbFilters > 6U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Stop the DMA and the first filter */
+  status = HAL_MDF_AcqStop_DMA(phmdf[0]);
+
+  /* Stop the other filters */
+  for (index = 1U; index < NbFilters; index++)
+  {
+    if (HAL_MDF_AcqStop(phmdf[index]) != HAL_OK)
+    {
+      status = HAL_ERROR;
+    }
+    phmdf[index]->Instance->DFLTIER &= ~(MDF_DFLTIER_SATIE | MDF_DFLTIER_RFOVRIE);
+    phmdf[index]->Instance->DFLTISR |= (MDF_DFLTISR_SATF | MDF_DFLTISR_RFOVRF);
+  }
+
+  /* Return function status */
+  return status;
+}
+
 /**
   * @brief  This function allows to generate pulse on TRGO signal.
   * @param  hmdf MDF handle.
@@ -1724,6 +1950,21 @@ HAL_StatusTypeDef HAL_MDF_GenerateTrgo(const MDF_HandleTypeDef *hmdf)
   return status;
 }
 
+/**
+  * @brief  This function allows to get the sample counter of a DMA acquisition.
+  * @note   The counter is reset by HAL_MDF_AcqStart_DMA() and incremented by the half and
+  *         complete DMA events before HAL_MDF_AcqHalfCpltCallback() and HAL_MDF_AcqCpltCallback()
+  *         are called, so that in these callbacks it gives the index following the last sample
+  *         of the completed half. With a synchronous acquisition mode, sample 0 is the first
+  *         sample after the trigger.
+  * @param  hmdf MDF handle.
+  * @retval Number of samples transferred by the completed DMA half buffers.
+  */
+uint32_t HAL_MDF_GetAcqSampleCount(const MDF_HandleTypeDef *hmdf)
+{
+  return hmdf->AcqSampleCount;
+}
+
 /**
   * @brief  This function allows to set delay to apply on data source in number of samples.
   * @param  hmdf MDF handle.
@@ -3521,6 +3762,9 @@ static void MDF_DmaXferCpltCallback(DMA_HandleTypeDef *hdma)
 {
   MDF_HandleTypeDef *hmdf = (MDF_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
 
+  /* Second half of the DMA buffer completed */
+  hmdf->AcqSampleCount += hmdf->AcqBlockSamples - (hmdf->AcqBlockSamples / 2U);
+
   /* Check if DMA in circular mode */
   if (hdma->Mode != DMA_LINKEDLIST_CIRCULAR)
   {
@@ -3543,6 +3787,9 @@ static void MDF_DmaXferHalfCpltCallback(DMA_HandleTypeDef *hdma)
 {
   MDF_HandleTypeDef *hmdf = (MDF_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
 
+  /* First half of the DMA buffer completed */
+  hmdf->AcqSampleCount += hmdf->AcqBlockSamples / 2U;
+
 #if (USE_HAL_MDF_REGISTER_CALLBACKS == 1)
   hmdf->AcqHalfCpltCallback(hmdf);
 #else /* USE_HAL_MDF_REGISTER_CALLBACKS */
@@ -1312,6 +1312,7 @@ HAL_StatusTypeDef HAL_MMC_ReadBlocks_DMA(MMC_HandleTypeDef *hmmc, uint8_t *pData
     hmmc->ErrorCode |= HAL_MMC_ERROR_PARAM;
     return HAL_ERROR;
   }
+  assert_param(IS_HAL_MEM_REACHABLE(HAL_MEM_MASTER_SDMMC, pData, NumberOfBlocks * MMC_BLOCKSIZE));
 
   if (hmmc->State == HAL_MMC_STATE_READY)
   {
@@ -1427,6 +1428,7 @@ HAL_StatusTypeDef HAL_MMC_WriteBlocks_DMA(MMC_HandleTypeDef *hmmc, const uint8_t
     hmmc->ErrorCode |= HAL_MMC_ERROR_PARAM;
     return HAL_ERROR;
   }
+  assert_param(IS_HAL_MEM_REACHABLE(HAL_MEM_MASTER_SDMMC, pData, NumberOfBlocks * MMC_BLOCKSIZE));
 
   if (hmmc->State == HAL_MMC_STATE_READY)
   {
@@ -1664,8 +1666,10 @@ void HAL_MMC_IRQHandler(MMC_HandleTypeDef *hmmc)
       hmmc->Instance->DCTRL = 0;
       hmmc->Instance->IDMACTRL = SDMMC_DISABLE_IDMA ;
 
-      /* Stop Transfer for Write Multi blocks or Read Multi blocks */
-      if (((context & MMC_CONTEXT_READ_MULTIPLE_BLOCK) != 0U) || ((context & MMC_CONTEXT_WRITE_MULTIPLE_BLOCK) != 0U))
+      /* Stop Transfer for Write Multi blocks or Read Multi blocks,                */
+      /* not needed when the block count has been predefined with CMD23           */
+      if ((((context & MMC_CONTEXT_READ_MULTIPLE_BLOCK) != 0U) || ((context & MMC_CONTEXT_WRITE_MULTIPLE_BLOCK) != 0U))
+          && ((context & MMC_CONTEXT_BLOCK_COUNT) == 0U))
       {
         errorstate = SDMMC_CmdStopTransfer(hmmc->Instance);
         if (errorstate != HAL_MMC_ERROR_NONE)
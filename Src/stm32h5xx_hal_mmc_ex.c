@@ -29,6 +29,14 @@
    (+) Start Read and Write for multibuffer mode using HAL_MMCEx_ReadBlocksDMAMultiBuffer() and
        HAL_MMCEx_WriteBlocksDMAMultiBuffer() functions.
 
+   (+) Read and Write blocks from or to fragmented buffers without intermediate copy using
+       HAL_MMCEx_ReadBlocksIOVec_DMA() and HAL_MMCEx_WriteBlocksIOVec_DMA() functions.
+
+   (+) Enable the device cache with HAL_MMCEx_ConfigCache() and flush it with HAL_MMCEx_FlushCache().
+
+   (+) Group several individual writes in a single packed write command using
+       HAL_MMCEx_PackedWriteBlocks_DMA() function.
+
   @endverbatim
   ******************************************************************************
   */
@@ -50,9 +58,29 @@
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
+/** @defgroup MMCEx_Private_Defines MMCEx Private Defines
+  * @{
+  */
+#define MMCEX_EXT_CSD_FLUSH_CACHE_INDEX     32U          /*!< FLUSH_CACHE field of the Extended CSD            */
+#define MMCEX_EXT_CSD_CACHE_CTRL_INDEX      33U          /*!< CACHE_CTRL field of the Extended CSD             */
+#define MMCEX_PACKED_CMD_VERSION            0x01U        /*!< Packed command header version                    */
+#define MMCEX_PACKED_CMD_WRITE              0x02U        /*!< Packed command header write operation            */
+#define MMCEX_PACKED_CMD_BLOCK_COUNT        0x40000000U  /*!< PACKED bit of the CMD23 argument                 */
+/**
+  * @}
+  */
+
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
+/** @defgroup MMCEx_Private_Functions MMCEx Private Functions
+  * @{
+  */
+static uint32_t MMCEx_SwitchExtCSD(MMC_HandleTypeDef *hmmc, uint32_t Index, uint32_t Value, uint32_t Timeout);
+/**
+  * @}
+  */
+
 /* Private functions ---------------------------------------------------------*/
 /* Exported functions --------------------------------------------------------*/
 /** @addtogroup MMCEx_Exported_Functions
@@ -432,6 +460,500 @@ HAL_StatusTypeDef HAL_MMCEx_DMALinkedList_WriteBlocks(MMC_HandleTypeDef *hmmc,
   * @}
   */
 
+/** @addtogroup MMCEx_Exported_Functions_Group2
+  *  @brief   Scatter-gather functions
+  *
+@verbatim
+ ===============================================================================
+                   ##### Scatter-gather functions #####
+ ===============================================================================
+    [..]
+    This subsection provides a set of functions allowing to read or write blocks directly
+    from or to a set of fragmented buffers described by a MMC_DMAIOVecTypeDef vector, without
+    intermediate copy into a contiguous buffer:
+      (+) One IDMA linked list node is built per vector entry in a user provided array of
+          nodes, which must stay untouched until the end of the transfer.
+      (+) Each buffer must be word aligned and its size a multiple of 32 bytes, the total
+          size of the vector being a multiple of the block size.
+      (+) HAL_MMCEx_Read_DMALnkLstBufCpltCallback() / HAL_MMCEx_Write_DMALnkLstBufCpltCallback()
+          are called at the end of each buffer and HAL_MMC_RxCpltCallback() / HAL_MMC_TxCpltCallback()
+          at the end of the transfer.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Reads block(s) from a specified address in a card into a scatter-gather buffer vector.
+  * @param  hmmc: MMC handle
+  * @param  pLinkedList: Pointer to the linkedlist built over the vector
+  * @param  pNodes: Pointer to an array of at least IOVecCount nodes
+  * @param  pIOVec: Pointer to the buffer vector
+  * @param  IOVecCount: Number of entries of the buffer vector
+  * @param  BlockAdd: Block Address from where data is to be read
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_MMCEx_ReadBlocksIOVec_DMA(MMC_HandleTypeDef *hmmc, MMC_DMALinkedListTypeDef *pLinkedList,
+                                                MMC_DMALinkNodeTypeDef *pNodes, const MMC_DMAIOVecTypeDef *pIOVec,
+                                                uint32_t IOVecCount, uint32_t BlockAdd)
+{
+  uint32_t length;
+  uint32_t errorstate;
+
+  if (hmmc->State != HAL_MMC_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  errorstate = SDMMC_DMALinkedList_BuildIOVec(pLinkedList, pNodes, pIOVec, IOVecCount, &length);
+  if ((errorstate != SDMMC_ERROR_NONE) || ((length % MMC_BLOCKSIZE) != 0U))
+  {
+    hmmc->ErrorCode |= HAL_MMC_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  return HAL_MMCEx_DMALinkedList_ReadBlocks(hmmc, pLinkedList, BlockAdd, length / MMC_BLOCKSIZE);
+}
+
+/**
+  * @brief  Write block(s) to a specified address in a card from a scatter-gather buffer vector.
+  * @param  hmmc: MMC handle
+  * @param  pLinkedList: Pointer to the linkedlist built over the vector
+  * @param  pNodes: Pointer to an array of at least IOVecCount nodes
+  * @param  pIOVec: Pointer to the buffer vector
+  * @param  IOVecCount: Number of entries of the buffer vector
+  * @param  BlockAdd: Block Address where data will be written
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_MMCEx_WriteBlocksIOVec_DMA(MMC_HandleTypeDef *hmmc, MMC_DMALinkedListTypeDef *pLinkedList,
+                                                 MMC_DMALinkNodeTypeDef *pNodes, const MMC_DMAIOVecTypeDef *pIOVec,
+                                                 uint32_t IOVecCount, uint32_t BlockAdd)
+{
+  uint32_t length;
+  uint32_t errorstate;
+
+  if (hmmc->State != HAL_MMC_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  errorstate = SDMMC_DMALinkedList_BuildIOVec(pLinkedList, pNodes, pIOVec, IOVecCount, &length);
+  if ((errorstate != SDMMC_ERROR_NONE) || ((length % MMC_BLOCKSIZE) != 0U))
+  {
+    hmmc->ErrorCode |= HAL_MMC_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  return HAL_MMCEx_DMALinkedList_WriteBlocks(hmmc, pLinkedList, BlockAdd, length / MMC_BLOCKSIZE);
+}
+
+/**
+  * @}
+  */
+
+/** @addtogroup MMCEx_Exported_Functions_Group3
+  *  @brief   Cache and packed commands functions
+  *
+@verbatim
+ ===============================================================================
+              ##### Cache and packed commands functions #####
+ ===============================================================================
+    [..]
+    This subsection provides a set of functions allowing to use the eMMC 4.5 and later
+    performance features:
+      (+) HAL_MMCEx_GetCacheSize() returns the size of the device volatile cache, and
+          HAL_MMCEx_ConfigCache() turns it on or off. When the cache is on, written data may be
+          kept in the cache: HAL_MMCEx_FlushCache() must be called before a power loss, a
+          partition switch or a sleep to guarantee that the data are stored in the device.
+      (+) HAL_MMCEx_GetMaxPackedWrites() returns the maximum number of individual writes a
+          packed command can contain, and HAL_MMCEx_PackedWriteBlocks_DMA() sends several
+          individual writes to random addresses in a single multiple block write command (CMD23
+          with PACKED bit and CMD25). The header block and the data buffers are chained in an
+          IDMA linked list, HAL_MMC_TxCpltCallback() is called at the end of the packed command.
+      (+) The device command queue (CMDQ) is not used: the SDMMC peripheral has no command queue
+          engine and the tasks would be serialized by the driver anyway.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Get the size of the device volatile cache.
+  * @param  hmmc: MMC handle
+  * @param  pCacheSize: Pointer to the cache size in kilobytes (0 when the device has no cache)
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_MMCEx_GetCacheSize(const MMC_HandleTypeDef *hmmc, uint32_t *pCacheSize)
+{
+  if (pCacheSize == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Field CACHE_SIZE [252:249] of the Extended CSD register */
+  *pCacheSize = (hmmc->Ext_CSD[62] >> 8U) | ((hmmc->Ext_CSD[63] & 0x000000FFU) << 24U);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Turn the device volatile cache on or off.
+  * @note   When turning the cache off, the device flushes the cache before the command completes.
+  * @param  hmmc: MMC handle
+  * @param  State: New state of the cache (ENABLE or DISABLE)
+  * @param  Timeout: Timeout duration of the command busy signal in ms
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_MMCEx_ConfigCache(MMC_HandleTypeDef *hmmc, FunctionalState State, uint32_t Timeout)
+{
+  uint32_t errorstate;
+  uint32_t cache_size;
+
+  assert_param(IS_FUNCTIONAL_STATE(State));
+
+  if (hmmc->State == HAL_MMC_STATE_READY)
+  {
+    (void)HAL_MMCEx_GetCacheSize(hmmc, &cache_size);
+    if (cache_size == 0U)
+    {
+      hmmc->ErrorCode |= HAL_MMC_ERROR_UNSUPPORTED_FEATURE;
+      return HAL_ERROR;
+    }
+
+    hmmc->State = HAL_MMC_STATE_BUSY;
+
+    /* Index : 33 - Value : State */
+    errorstate = MMCEx_SwitchExtCSD(hmmc, MMCEX_EXT_CSD_CACHE_CTRL_INDEX, (State == ENABLE) ? 1U : 0U, Timeout);
+    if (errorstate == HAL_MMC_ERROR_NONE)
+    {
+      /* Keep the Extended CSD copy up to date: CACHE_CTRL is bits [15:8] of word 8 */
+      MODIFY_REG(hmmc->Ext_CSD[MMCEX_EXT_CSD_CACHE_CTRL_INDEX / 4U], 0x0000FF00U,
+                 ((State == ENABLE) ? 0x00000100U : 0U));
+    }
+
+    hmmc->State = HAL_MMC_STATE_READY;
+
+    if (errorstate != HAL_MMC_ERROR_NONE)
+    {
+      /* Clear all the static flags */
+      __HAL_MMC_CLEAR_FLAG(hmmc, SDMMC_STATIC_FLAGS);
+      hmmc->ErrorCode |= errorstate;
+      return (errorstate == HAL_MMC_ERROR_TIMEOUT) ? HAL_TIMEOUT : HAL_ERROR;
+    }
+
+    return HAL_OK;
+  }
+  else
+  {
+    return HAL_BUSY;
+  }
+}
+
+/**
+  * @brief  Flush the device volatile cache to the non-volatile storage.
+  * @note   This function does nothing when the cache is off.
+  * @param  hmmc: MMC handle
+  * @param  Timeout: Timeout duration of the cache flush in ms
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_MMCEx_FlushCache(MMC_HandleTypeDef *hmmc, uint32_t Timeout)
+{
+  uint32_t errorstate;
+
+  if (hmmc->State == HAL_MMC_STATE_READY)
+  {
+    /* Field CACHE_CTRL [33] of the Extended CSD register */
+    if ((hmmc->Ext_CSD[MMCEX_EXT_CSD_CACHE_CTRL_INDEX / 4U] & 0x00000100U) == 0U)
+    {
+      return HAL_OK;
+    }
+
+    hmmc->State = HAL_MMC_STATE_BUSY;
+
+    /* Index : 32 - Value : 0x01 */
+    errorstate = MMCEx_SwitchExtCSD(hmmc, MMCEX_EXT_CSD_FLUSH_CACHE_INDEX, 1U, Timeout);
+
+    hmmc->State = HAL_MMC_STATE_READY;
+
+    if (errorstate != HAL_MMC_ERROR_NONE)
+    {
+      /* Clear all the static flags */
+      __HAL_MMC_CLEAR_FLAG(hmmc, SDMMC_STATIC_FLAGS);
+      hmmc->ErrorCode |= errorstate;
+      return (errorstate == HAL_MMC_ERROR_TIMEOUT) ? HAL_TIMEOUT : HAL_ERROR;
+    }
+
+    return HAL_OK;
+  }
+  else
+  {
+    return HAL_BUSY;
+  }
+}
+
+/**
+  * @brief  Get the maximum number of individual writes of a packed write command.
+  * @param  hmmc: MMC handle
+  * @param  pMaxPackedWrites: Pointer to the maximum number of individual writes
+  *         (0 when the device does not support packed commands)
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_MMCEx_GetMaxPackedWrites(const MMC_HandleTypeDef *hmmc, uint32_t *pMaxPackedWrites)
+{
+  if (pMaxPackedWrites == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Field MAX_PACKED_WRITES [500] of the Extended CSD register */
+  *pMaxPackedWrites = (hmmc->Ext_CSD[125] & 0x000000FFU);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Write several individual block areas of the card in a single packed write command.
+  * @note   The header and the linked list are built in pPacked, which must stay untouched with
+  *         the entries data until HAL_MMC_TxCpltCallback() is called.
+  * @note   Each individual write must fit in one IDMA buffer (up to 255 blocks).
+  * @param  hmmc: MMC handle
+  * @param  pPacked: Pointer to the packed write context
+  * @param  pEntries: Pointer to the individual writes
+  * @param  EntryCount: Number of individual writes, up to the value returned by
+  *         HAL_MMCEx_GetMaxPackedWrites()
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_MMCEx_PackedWriteBlocks_DMA(MMC_HandleTypeDef *hmmc, MMC_PackedWriteTypeDef *pPacked,
+                                                  const MMC_PackedWriteEntryTypeDef *pEntries, uint32_t EntryCount)
+{
+  SDMMC_DataInitTypeDef config;
+  MMC_DMALinkNodeConfTypeDef node_conf;
+  uint32_t errorstate;
+  uint32_t max_packed;
+  uint32_t total_blocks = 1U;
+  uint32_t add;
+  uint32_t first_add = 0U;
+  uint32_t count;
+
+  if ((pPacked == NULL) || (pPacked->pNodes == NULL) || (pEntries == NULL) || (EntryCount == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hmmc->State == HAL_MMC_STATE_READY)
+  {
+    (void)HAL_MMCEx_GetMaxPackedWrites(hmmc, &max_packed);
+
+    /* Packed commands are not managed with 4kB native sectors (field DATA SECTOR SIZE of extended CSD) */
+    if ((max_packed == 0U) ||
+        (((hmmc->Ext_CSD[(MMC_EXT_CSD_DATA_SEC_SIZE_INDEX / 4)] >> MMC_EXT_CSD_DATA_SEC_SIZE_POS) & 0x000000FFU) != 0x0U))
+    {
+      hmmc->ErrorCode |= HAL_MMC_ERROR_UNSUPPORTED_FEATURE;
+      return HAL_ERROR;
+    }
+
+    if (EntryCount > max_packed)
+    {
+      hmmc->ErrorCode |= HAL_MMC_ERROR_PARAM;
+      return HAL_ERROR;
+    }
+
+    /* Build the header block: version, operation and number of entries, then the CMD23 and
+       CMD25 arguments of each individual write */
+    for (count = 0U; count < (MMC_BLOCKSIZE / 4U); count++)
+    {
+      pPacked->Header[count] = 0U;
+    }
+    pPacked->Header[0] = MMCEX_PACKED_CMD_VERSION | (MMCEX_PACKED_CMD_WRITE << 8U) | (EntryCount << 16U);
+
+    pPacked->LinkedList.pHeadNode    = NULL;
+    pPacked->LinkedList.pTailNode    = NULL;
+    pPacked->LinkedList.NodesCounter = 0U;
+
+    node_conf.BufferAddress = (uint32_t)pPacked->Header;
+    node_conf.BufferSize    = MMC_BLOCKSIZE;
+    (void)SDMMC_DMALinkedList_BuildNode(&pPacked->pNodes[0], &node_conf);
+    (void)SDMMC_DMALinkedList_InsertNode(&pPacked->LinkedList, NULL, &pPacked->pNodes[0]);
+
+    for (count = 0U; count < EntryCount; count++)
+    {
+      add = pEntries[count].BlockAdd;
+
+      if ((pEntries[count].pData == NULL) || (pEntries[count].NumberOfBlocks == 0U) ||
+          (((pEntries[count].NumberOfBlocks * MMC_BLOCKSIZE) & ~SDMMC_IDMABSIZE_IDMABNDT) != 0U) ||
+          (((uint32_t)pEntries[count].pData & 0x3U) != 0U))
+      {
+        hmmc->ErrorCode |= HAL_MMC_ERROR_PARAM;
+        return HAL_ERROR;
+      }
+
+      if ((add + pEntries[count].NumberOfBlocks) > (hmmc->MmcCard.LogBlockNbr))
+      {
+        hmmc->ErrorCode |= HAL_MMC_ERROR_ADDR_OUT_OF_RANGE;
+        return HAL_ERROR;
+      }
+
+      if ((hmmc->MmcCard.CardType) != MMC_HIGH_CAPACITY_CARD)
+      {
+        add *= MMC_BLOCKSIZE;
+      }
+      if (count == 0U)
+      {
+        first_add = add;
+      }
+
+      pPacked->Header[2U * (count + 1U)]        = pEntries[count].NumberOfBlocks;
+      pPacked->Header[(2U * (count + 1U)) + 1U] = add;
+
+      node_conf.BufferAddress = (uint32_t)pEntries[count].pData;
+      node_conf.BufferSize    = pEntries[count].NumberOfBlocks * MMC_BLOCKSIZE;
+      (void)SDMMC_DMALinkedList_BuildNode(&pPacked->pNodes[count + 1U], &node_conf);
+      if (SDMMC_DMALinkedList_InsertNode(&pPacked->LinkedList, pPacked->LinkedList.pTailNode,
+                                         &pPacked->pNodes[count + 1U]) != SDMMC_ERROR_NONE)
+      {
+        hmmc->ErrorCode |= HAL_MMC_ERROR_PARAM;
+        return HAL_ERROR;
+      }
+
+      total_blocks += pEntries[count].NumberOfBlocks;
+    }
+
+    hmmc->ErrorCode = HAL_MMC_ERROR_NONE;
+    hmmc->State = HAL_MMC_STATE_BUSY;
+
+    /* Set the block count of the packed command: header block and all individual writes */
+    errorstate = SDMMC_CmdBlockCount(hmmc->Instance, MMCEX_PACKED_CMD_BLOCK_COUNT | total_blocks);
+    if (errorstate != HAL_MMC_ERROR_NONE)
+    {
+      /* Clear all the static flags */
+      __HAL_MMC_CLEAR_FLAG(hmmc, SDMMC_STATIC_FLAGS);
+      hmmc->State = HAL_MMC_STATE_READY;
+      hmmc->ErrorCode |= errorstate;
+      return HAL_ERROR;
+    }
+
+    hmmc->Instance->IDMABASER = (uint32_t) pPacked->LinkedList.pHeadNode->IDMABASER;
+    hmmc->Instance->IDMABSIZE = (uint32_t) pPacked->LinkedList.pHeadNode->IDMABSIZE;
+
+    hmmc->Instance->IDMABAR = (uint32_t)  pPacked->LinkedList.pHeadNode;
+    hmmc->Instance->IDMALAR = (uint32_t)  SDMMC_IDMALAR_ABR | SDMMC_IDMALAR_ULS | SDMMC_IDMALAR_ULA |
+                              sizeof(SDMMC_DMALinkNodeTypeDef) ; /* Initial configuration */
+
+    /* Initialize data control register */
+    hmmc->Instance->DCTRL = 0;
+
+    /* Configure the MMC DPSM (Data Path State Machine) */
+    config.DataTimeOut   = SDMMC_DATATIMEOUT;
+    config.DataLength    = MMC_BLOCKSIZE * total_blocks;
+    config.DataBlockSize = SDMMC_DATABLOCK_SIZE_512B;
+    config.TransferDir   = SDMMC_TRANSFER_DIR_TO_CARD;
+    config.TransferMode  = SDMMC_TRANSFER_MODE_BLOCK;
+    config.DPSM          = SDMMC_DPSM_DISABLE;
+    (void)SDMMC_ConfigData(hmmc->Instance, &config);
+
+    __SDMMC_CMDTRANS_ENABLE(hmmc->Instance);
+
+    hmmc->Instance->IDMACTRL = SDMMC_ENABLE_IDMA_DOUBLE_BUFF0;
+
+    /* Write Blocks in DMA mode, the card ends the transfer after the predefined block count */
+    hmmc->Context = (MMC_CONTEXT_WRITE_MULTIPLE_BLOCK | MMC_CONTEXT_DMA | MMC_CONTEXT_BLOCK_COUNT);
+
+    /* Write Multi Block command with the address of the first individual write */
+    errorstate = SDMMC_CmdWriteMultiBlock(hmmc->Instance, first_add);
+    if (errorstate != HAL_MMC_ERROR_NONE)
+    {
+      hmmc->State = HAL_MMC_STATE_READY;
+      hmmc->ErrorCode |= errorstate;
+      return HAL_ERROR;
+    }
+
+    __HAL_MMC_ENABLE_IT(hmmc, (SDMMC_IT_DCRCFAIL | SDMMC_IT_DTIMEOUT | SDMMC_IT_TXUNDERR | SDMMC_IT_DATAEND |
+                               SDMMC_FLAG_IDMATE | SDMMC_FLAG_IDMABTC));
+
+    return HAL_OK;
+  }
+  else
+  {
+    return HAL_BUSY;
+  }
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/* Private functions ---------------------------------------------------------*/
+/** @addtogroup MMCEx_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Write a byte field of the Extended CSD register with the SWITCH command (CMD6).
+  * @param  hmmc: MMC handle
+  * @param  Index: Index of the field in the Extended CSD register
+  * @param  Value: Value to write
+  * @param  Timeout: Timeout duration of the command busy signal in ms
+  * @retval MMC error state
+  */
+static uint32_t MMCEx_SwitchExtCSD(MMC_HandleTypeDef *hmmc, uint32_t Index, uint32_t Value, uint32_t Timeout)
+{
+  uint32_t errorstate;
+  uint32_t response = 0U;
+  uint32_t count;
+  uint32_t tickstart = HAL_GetTick();
+
+  /* Access : write byte - Index - Value */
+  errorstate = SDMMC_CmdSwitch(hmmc->Instance, (0x03000000U | (Index << 16U) | (Value << 8U)));
+  if (errorstate != HAL_MMC_ERROR_NONE)
+  {
+    return errorstate;
+  }
+
+  /* Wait that the device is ready by checking the D0 line */
+  while (__HAL_MMC_GET_FLAG(hmmc, SDMMC_FLAG_BUSYD0) != RESET)
+  {
+    if ((HAL_GetTick() - tickstart) >= Timeout)
+    {
+      return HAL_MMC_ERROR_TIMEOUT;
+    }
+  }
+
+  /* Clear the flag corresponding to end D0 bus line */
+  __HAL_MMC_CLEAR_FLAG(hmmc, SDMMC_FLAG_BUSYD0END);
+
+  /* While card is not ready for data and trial number for sending CMD13 is not exceeded */
+  count = SDMMC_MAX_TRIAL;
+  do
+  {
+    errorstate = SDMMC_CmdSendStatus(hmmc->Instance, (uint32_t)(((uint32_t)hmmc->MmcCard.RelCardAdd) << 16U));
+    if (errorstate != HAL_MMC_ERROR_NONE)
+    {
+      return errorstate;
+    }
+
+    /* Get command response */
+    response = SDMMC_GetResponse(hmmc->Instance, SDMMC_RESP1);
+    count--;
+  } while (((response & 0x100U) == 0U) && (count != 0U));
+
+  if (count == 0U)
+  {
+    return SDMMC_ERROR_TIMEOUT;
+  }
+
+  /* Check the bit SWITCH_ERROR of the device status */
+  if ((response & 0x80U) != 0U)
+  {
+    return SDMMC_ERROR_GENERAL_UNKNOWN_ERR;
+  }
+
+  return HAL_MMC_ERROR_NONE;
+}
+
 /**
   * @}
   */
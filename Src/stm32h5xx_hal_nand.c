@@ -51,6 +51,14 @@
 
       (+) Read the NAND flash status operation using the function HAL_NAND_Read_Status().
 
+      (+) Access NAND flash memory pages by DMA using the functions HAL_NAND_Read_Page_8b_DMA()
+          and HAL_NAND_Write_Page_8b_DMA(), after linking the DMA handle to hnand->hdma.
+          The FMC ECC of each page can be computed in-line and returned with the data.
+          HAL_NAND_ReadCpltCallback(), HAL_NAND_WriteCpltCallback() and
+          HAL_NAND_ErrorCallback() are executed at the end of the transfer.
+          Set CacheReadEnable in the NAND_DeviceConfigTypeDef structure to stream
+          multi-page reads with the read cache sequential command.
+
       (+) You can also control the NAND device by calling the control APIs HAL_NAND_ECC_Enable()/
           HAL_NAND_ECC_Disable() to respectively enable/disable the ECC code correction
           feature or the function HAL_NAND_GetECC() to get the ECC correction code.
@@ -73,6 +81,10 @@
       it allows to register following callbacks:
         (+) MspInitCallback    : NAND MspInit.
         (+) MspDeInitCallback  : NAND MspDeInit.
+        (+) ItCallback         : NAND IT.
+        (+) ReadCpltCallback   : NAND DMA Read Complete.
+        (+) WriteCpltCallback  : NAND DMA Write Complete.
+        (+) ErrorCallback      : NAND DMA Error.
       This function takes as parameters the HAL peripheral handle, the Callback ID
       and a pointer to the user callback function.
 
@@ -80,6 +92,10 @@
       weak (overridden) function. It allows to reset following callbacks:
         (+) MspInitCallback    : NAND MspInit.
         (+) MspDeInitCallback  : NAND MspDeInit.
+        (+) ItCallback         : NAND IT.
+        (+) ReadCpltCallback   : NAND DMA Read Complete.
+        (+) WriteCpltCallback  : NAND DMA Write Complete.
+        (+) ErrorCallback      : NAND DMA Error.
       This function) takes as parameters the HAL peripheral handle and the Callback ID.
 
       By default, after the HAL_NAND_Init and if the state is HAL_NAND_STATE_RESET
@@ -127,6 +143,23 @@
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
+/** @addtogroup NAND_Private_Functions NAND Private Functions
+  * @{
+  */
+static void NAND_SendAddress(const NAND_HandleTypeDef *hnand, uint32_t nandaddress);
+static HAL_StatusTypeDef NAND_WaitReady(const NAND_HandleTypeDef *hnand);
+static HAL_StatusTypeDef NAND_ReadPageCommand(const NAND_HandleTypeDef *hnand, uint32_t nandaddress);
+static HAL_StatusTypeDef NAND_ReadCacheCommand(const NAND_HandleTypeDef *hnand, uint8_t Command);
+static void NAND_WritePageCommand(const NAND_HandleTypeDef *hnand, uint32_t nandaddress);
+static HAL_StatusTypeDef NAND_PageDMA(NAND_HandleTypeDef *hnand, uint32_t SrcAddress, uint32_t DstAddress);
+static void NAND_DMAAbort(NAND_HandleTypeDef *hnand);
+static void NAND_DMAReadCplt(DMA_HandleTypeDef *hdma);
+static void NAND_DMAWriteCplt(DMA_HandleTypeDef *hdma);
+static void NAND_DMAError(DMA_HandleTypeDef *hdma);
+/**
+  * @}
+  */
+
 /* Exported functions ---------------------------------------------------------*/
 
 /** @defgroup NAND_Exported_Functions NAND Exported Functions
@@ -176,6 +209,9 @@ HAL_StatusTypeDef  HAL_NAND_Init(NAND_HandleTypeDef *hnand, FMC_NAND_PCC_TimingT
       hnand->MspInitCallback = HAL_NAND_MspInit;
     }
     hnand->ItCallback = HAL_NAND_ITCallback;
+    hnand->ReadCpltCallback = HAL_NAND_ReadCpltCallback;
+    hnand->WriteCpltCallback = HAL_NAND_WriteCpltCallback;
+    hnand->ErrorCallback = HAL_NAND_ErrorCallback;
 
     /* Init the low level hardware */
     hnand->MspInitCallback(hnand);
@@ -353,6 +389,54 @@ __weak void HAL_NAND_ITCallback(NAND_HandleTypeDef *hnand)
    */
 }
 
+/**
+  * @brief  NAND DMA page(s) read complete callback
+  * @param  hnand pointer to a NAND_HandleTypeDef structure that contains
+  *                the configuration information for NAND module.
+  * @retval None
+  */
+__weak void HAL_NAND_ReadCpltCallback(NAND_HandleTypeDef *hnand)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hnand);
+
+  /* NOTE : This function Should not be modified, when the callback is needed,
+            the HAL_NAND_ReadCpltCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  NAND DMA page(s) write complete callback
+  * @param  hnand pointer to a NAND_HandleTypeDef structure that contains
+  *                the configuration information for NAND module.
+  * @retval None
+  */
+__weak void HAL_NAND_WriteCpltCallback(NAND_HandleTypeDef *hnand)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hnand);
+
+  /* NOTE : This function Should not be modified, when the callback is needed,
+            the HAL_NAND_WriteCpltCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  NAND DMA transfer error callback
+  * @param  hnand pointer to a NAND_HandleTypeDef structure that contains
+  *                the configuration information for NAND module.
+  * @retval None
+  */
+__weak void HAL_NAND_ErrorCallback(NAND_HandleTypeDef *hnand)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hnand);
+
+  /* NOTE : This function Should not be modified, when the callback is needed,
+            the HAL_NAND_ErrorCallback could be implemented in the user file
+   */
+}
+
 /**
   * @}
   */
@@ -504,6 +588,7 @@ HAL_StatusTypeDef  HAL_NAND_ConfigDevice(NAND_HandleTypeDef *hnand, const NAND_D
   hnand->Config.PlaneSize          = pDeviceConfig->PlaneSize;
   hnand->Config.PlaneNbr           = pDeviceConfig->PlaneNbr;
   hnand->Config.ExtraCommandEnable = pDeviceConfig->ExtraCommandEnable;
+  hnand->Config.CacheReadEnable = pDeviceConfig->CacheReadEnable;
 
   return HAL_OK;
 }
@@ -1951,6 +2036,180 @@ HAL_StatusTypeDef HAL_NAND_Write_SpareArea_16b(NAND_HandleTypeDef *hnand, const
   return HAL_OK;
 }
 
+/**
+  * @brief  Read Page(s) from NAND memory block (8-bits addressing) using DMA transfer
+  * @note   When pECC is not NULL, the FMC ECC is computed in-line on each page and
+  *         stored in pECC, one value per page. In that case the FMC ECC page size
+  *         (Init.ECCPageSize) must match the device page size.
+  * @note   When Config.CacheReadEnable is ENABLE, the pages are streamed with the
+  *         read cache sequential command: the next page is read from the array
+  *         while the current one is transferred by the DMA.
+  * @note   The DMA must be configured in normal memory to memory mode with the
+  *         source address not incremented. HAL_NAND_ReadCpltCallback() is
+  *         executed when the last page is transferred.
+  * @param  hnand pointer to a NAND_HandleTypeDef structure that contains
+  *                the configuration information for NAND module.
+  * @param  pAddress  pointer to NAND address structure
+  * @param  pBuffer  pointer to destination read buffer
+  * @param  NumPageToRead  number of pages to read from block
+  * @param  pECC  pointer to the ECC values array, can be NULL
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_NAND_Read_Page_8b_DMA(NAND_HandleTypeDef *hnand, const NAND_AddressTypeDef *pAddress,
+                                            uint8_t *pBuffer, uint32_t NumPageToRead, uint32_t *pECC)
+{
+  HAL_StatusTypeDef status;
+  uint32_t nandaddress;
+
+  if ((hnand->hdma == NULL) || (pBuffer == NULL) || (NumPageToRead == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the NAND controller state */
+  if (hnand->State == HAL_NAND_STATE_BUSY)
+  {
+    return HAL_BUSY;
+  }
+  else if (hnand->State == HAL_NAND_STATE_READY)
+  {
+    /* NAND raw address calculation */
+    nandaddress = ARRAY_ADDRESS(pAddress, hnand);
+
+    if ((nandaddress + NumPageToRead) > ((hnand->Config.BlockSize) * (hnand->Config.BlockNbr)))
+    {
+      return HAL_ERROR;
+    }
+
+    /* Process Locked */
+    __HAL_LOCK(hnand);
+
+    /* Update the NAND controller state */
+    hnand->State = HAL_NAND_STATE_BUSY;
+
+    /* Save the transfer context */
+    hnand->pXferBuffer = pBuffer;
+    hnand->XferAddress = nandaddress;
+    hnand->XferPageCount = NumPageToRead;
+    hnand->XferPageIdx = 0U;
+    hnand->pXferECC = pECC;
+
+    /* Configure DMA user callbacks */
+    hnand->hdma->XferCpltCallback = NAND_DMAReadCplt;
+    hnand->hdma->XferErrorCallback = NAND_DMAError;
+
+    /* Send read page command sequence */
+    status = NAND_ReadPageCommand(hnand, nandaddress);
+
+    if ((status == HAL_OK) && (hnand->Config.CacheReadEnable == ENABLE) && (NumPageToRead > 1U))
+    {
+      /* Start the read cache sequence, the next page is loaded while the first one is read */
+      status = NAND_ReadCacheCommand(hnand, NAND_CMD_READ_CACHE_SEQ);
+    }
+
+    if (status == HAL_OK)
+    {
+      /* Transfer the first page */
+      status = NAND_PageDMA(hnand, NAND_DEVICE, (uint32_t)pBuffer);
+    }
+
+    if (status != HAL_OK)
+    {
+      /* Update the NAND controller state */
+      hnand->State = HAL_NAND_STATE_ERROR;
+    }
+
+    /* Process unlocked */
+    __HAL_UNLOCK(hnand);
+  }
+  else
+  {
+    return HAL_ERROR;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Write Page(s) to NAND memory block (8-bits addressing) using DMA transfer
+  * @note   When pECC is not NULL, the FMC ECC is computed in-line on each page and
+  *         stored in pECC, one value per page. In that case the FMC ECC page size
+  *         (Init.ECCPageSize) must match the device page size.
+  * @note   The DMA must be configured in normal memory to memory mode with the
+  *         destination address not incremented. HAL_NAND_WriteCpltCallback() is
+  *         executed when the last page is programmed.
+  * @param  hnand pointer to a NAND_HandleTypeDef structure that contains
+  *                the configuration information for NAND module.
+  * @param  pAddress  pointer to NAND address structure
+  * @param  pBuffer  pointer to source buffer to write
+  * @param  NumPageToWrite   number of pages to write to block
+  * @param  pECC  pointer to the ECC values array, can be NULL
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_NAND_Write_Page_8b_DMA(NAND_HandleTypeDef *hnand, const NAND_AddressTypeDef *pAddress,
+                                             const uint8_t *pBuffer, uint32_t NumPageToWrite, uint32_t *pECC)
+{
+  HAL_StatusTypeDef status;
+  uint32_t nandaddress;
+
+  if ((hnand->hdma == NULL) || (pBuffer == NULL) || (NumPageToWrite == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the NAND controller state */
+  if (hnand->State == HAL_NAND_STATE_BUSY)
+  {
+    return HAL_BUSY;
+  }
+  else if (hnand->State == HAL_NAND_STATE_READY)
+  {
+    /* NAND raw address calculation */
+    nandaddress = ARRAY_ADDRESS(pAddress, hnand);
+
+    if ((nandaddress + NumPageToWrite) > ((hnand->Config.BlockSize) * (hnand->Config.BlockNbr)))
+    {
+      return HAL_ERROR;
+    }
+
+    /* Process Locked */
+    __HAL_LOCK(hnand);
+
+    /* Update the NAND controller state */
+    hnand->State = HAL_NAND_STATE_BUSY;
+
+    /* Save the transfer context */
+    hnand->pXferBuffer = pBuffer;
+    hnand->XferAddress = nandaddress;
+    hnand->XferPageCount = NumPageToWrite;
+    hnand->XferPageIdx = 0U;
+    hnand->pXferECC = pECC;
+
+    /* Configure DMA user callbacks */
+    hnand->hdma->XferCpltCallback = NAND_DMAWriteCplt;
+    hnand->hdma->XferErrorCallback = NAND_DMAError;
+
+    /* Send write page command sequence and transfer the first page */
+    NAND_WritePageCommand(hnand, nandaddress);
+    status = NAND_PageDMA(hnand, (uint32_t)pBuffer, NAND_DEVICE);
+
+    if (status != HAL_OK)
+    {
+      /* Update the NAND controller state */
+      hnand->State = HAL_NAND_STATE_ERROR;
+    }
+
+    /* Process unlocked */
+    __HAL_UNLOCK(hnand);
+  }
+  else
+  {
+    return HAL_ERROR;
+  }
+
+  return status;
+}
+
 /**
   * @brief  NAND memory Block erase
   * @param  hnand pointer to a NAND_HandleTypeDef structure that contains
@@ -2052,6 +2311,9 @@ uint32_t HAL_NAND_Address_Inc(const NAND_HandleTypeDef *hnand, NAND_AddressTypeD
   *          @arg @ref HAL_NAND_MSP_INIT_CB_ID       NAND MspInit callback ID
   *          @arg @ref HAL_NAND_MSP_DEINIT_CB_ID     NAND MspDeInit callback ID
   *          @arg @ref HAL_NAND_IT_CB_ID             NAND IT callback ID
+  *          @arg @ref HAL_NAND_READ_CPLT_CB_ID      NAND DMA Read Complete callback ID
+  *          @arg @ref HAL_NAND_WRITE_CPLT_CB_ID     NAND DMA Write Complete callback ID
+  *          @arg @ref HAL_NAND_ERROR_CB_ID          NAND DMA Error callback ID
   * @param pCallback : pointer to the Callback function
   * @retval status
   */
@@ -2078,6 +2340,15 @@ HAL_StatusTypeDef HAL_NAND_RegisterCallback(NAND_HandleTypeDef *hnand, HAL_NAND_
       case HAL_NAND_IT_CB_ID :
         hnand->ItCallback = pCallback;
         break;
+      case HAL_NAND_READ_CPLT_CB_ID :
+        hnand->ReadCpltCallback = pCallback;
+        break;
+      case HAL_NAND_WRITE_CPLT_CB_ID :
+        hnand->WriteCpltCallback = pCallback;
+        break;
+      case HAL_NAND_ERROR_CB_ID :
+        hnand->ErrorCallback = pCallback;
+        break;
       default :
         /* update return status */
         status =  HAL_ERROR;
@@ -2118,6 +2389,9 @@ HAL_StatusTypeDef HAL_NAND_RegisterCallback(NAND_HandleTypeDef *hnand, HAL_NAND_
   *          @arg @ref HAL_NAND_MSP_INIT_CB_ID       NAND MspInit callback ID
   *          @arg @ref HAL_NAND_MSP_DEINIT_CB_ID     NAND MspDeInit callback ID
   *          @arg @ref HAL_NAND_IT_CB_ID             NAND IT callback ID
+  *          @arg @ref HAL_NAND_READ_CPLT_CB_ID      NAND DMA Read Complete callback ID
+  *          @arg @ref HAL_NAND_WRITE_CPLT_CB_ID     NAND DMA Write Complete callback ID
+  *          @arg @ref HAL_NAND_ERROR_CB_ID          NAND DMA Error callback ID
   * @retval status
   */
 HAL_StatusTypeDef HAL_NAND_UnRegisterCallback(NAND_HandleTypeDef *hnand, HAL_NAND_CallbackIDTypeDef CallbackId)
@@ -2137,6 +2411,15 @@ HAL_StatusTypeDef HAL_NAND_UnRegisterCallback(NAND_HandleTypeDef *hnand, HAL_NAN
       case HAL_NAND_IT_CB_ID :
         hnand->ItCallback = HAL_NAND_ITCallback;
         break;
+      case HAL_NAND_READ_CPLT_CB_ID :
+        hnand->ReadCpltCallback = HAL_NAND_ReadCpltCallback;
+        break;
+      case HAL_NAND_WRITE_CPLT_CB_ID :
+        hnand->WriteCpltCallback = HAL_NAND_WriteCpltCallback;
+        break;
+      case HAL_NAND_ERROR_CB_ID :
+        hnand->ErrorCallback = HAL_NAND_ErrorCallback;
+        break;
       default :
         /* update return status */
         status =  HAL_ERROR;
@@ -2360,6 +2643,336 @@ uint32_t HAL_NAND_Read_Status(const NAND_HandleTypeDef *hnand)
   * @}
   */
 
+/**
+  * @}
+  */
+
+/** @addtogroup NAND_Private_Functions NAND Private Functions
+  * @{
+  */
+
+/**
+  * @brief  Send the page address cycles to the NAND memory (8-bits addressing)
+  * @param  hnand pointer to a NAND_HandleTypeDef structure that contains
+  *                the configuration information for NAND module.
+  * @param  nandaddress  NAND raw address of the page
+  * @retval None
+  */
+static void NAND_SendAddress(const NAND_HandleTypeDef *hnand, uint32_t nandaddress)
+{
+  uint32_t deviceaddress = NAND_DEVICE;
+
+  /* Cards with page size > 512 bytes have two column address cycles */
+  if ((hnand->Config.PageSize) > 512U)
+  {
+    *(__IO uint8_t *)((uint32_t)(deviceaddress | ADDR_AREA)) = 0x00U;
+    __DSB();
+  }
+  *(__IO uint8_t *)((uint32_t)(deviceaddress | ADDR_AREA)) = 0x00U;
+  __DSB();
+  *(__IO uint8_t *)((uint32_t)(deviceaddress | ADDR_AREA)) = ADDR_1ST_CYCLE(nandaddress);
+  __DSB();
+  *(__IO uint8_t *)((uint32_t)(deviceaddress | ADDR_AREA)) = ADDR_2ND_CYCLE(nandaddress);
+  __DSB();
+  if (((hnand->Config.BlockSize) * (hnand->Config.BlockNbr)) > 65535U)
+  {
+    *(__IO uint8_t *)((uint32_t)(deviceaddress | ADDR_AREA)) = ADDR_3RD_CYCLE(nandaddress);
+    __DSB();
+  }
+}
+
+/**
+  * @brief  Read the NAND memory status until it is ready
+  * @param  hnand pointer to a NAND_HandleTypeDef structure that contains
+  *                the configuration information for NAND module.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef NAND_WaitReady(const NAND_HandleTypeDef *hnand)
+{
+  uint32_t tickstart;
+  uint32_t status;
+
+  /* Get tick */
+  tickstart = HAL_GetTick();
+
+  /* Read status until NAND is ready */
+  do
+  {
+    status = HAL_NAND_Read_Status(hnand);
+
+    if (status == NAND_ERROR)
+    {
+      return HAL_ERROR;
+    }
+
+    if ((HAL_GetTick() - tickstart) > NAND_WRITE_TIMEOUT)
+    {
+      /* Perform a new read status to check if NAND is now ready */
+      if (HAL_NAND_Read_Status(hnand) == NAND_READY)
+      {
+        break;
+      }
+      else
+      {
+        return HAL_TIMEOUT;
+      }
+    }
+  } while (status != NAND_READY);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Send the read page command sequence (8-bits addressing)
+  * @param  hnand pointer to a NAND_HandleTypeDef structure that contains
+  *                the configuration information for NAND module.
+  * @param  nandaddress  NAND raw address of the page
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef NAND_ReadPageCommand(const NAND_HandleTypeDef *hnand, uint32_t nandaddress)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t deviceaddress = NAND_DEVICE;
+
+  *(__IO uint8_t *)((uint32_t)(deviceaddress | CMD_AREA)) = NAND_CMD_AREA_A;
+  __DSB();
+
+  NAND_SendAddress(hnand, nandaddress);
+
+  *(__IO uint8_t *)((uint32_t)(deviceaddress | CMD_AREA)) = NAND_CMD_AREA_TRUE1;
+  __DSB();
+
+  if (hnand->Config.ExtraCommandEnable == ENABLE)
+  {
+    status = NAND_WaitReady(hnand);
+
+    /* Go back to read mode */
+    *(__IO uint8_t *)((uint32_t)(deviceaddress | CMD_AREA)) = ((uint8_t)0x00);
+    __DSB();
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Send a read cache command and wait for the page to be available
+  * @param  hnand pointer to a NAND_HandleTypeDef structure that contains
+  *                the configuration information for NAND module.
+  * @param  Command  NAND_CMD_READ_CACHE_SEQ or NAND_CMD_READ_CACHE_END
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef NAND_ReadCacheCommand(const NAND_HandleTypeDef *hnand, uint8_t Command)
+{
+  HAL_StatusTypeDef status;
+  uint32_t deviceaddress = NAND_DEVICE;
+
+  /* Wait for the previous array read to complete */
+  status = NAND_WaitReady(hnand);
+
+  if (status == HAL_OK)
+  {
+    *(__IO uint8_t *)((uint32_t)(deviceaddress | CMD_AREA)) = Command;
+    __DSB();
+
+    /* Wait for the page to be copied to the cache register */
+    status = NAND_WaitReady(hnand);
+
+    /* Go back to read mode */
+    *(__IO uint8_t *)((uint32_t)(deviceaddress | CMD_AREA)) = ((uint8_t)0x00);
+    __DSB();
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Send the write page command sequence (8-bits addressing)
+  * @param  hnand pointer to a NAND_HandleTypeDef structure that contains
+  *                the configuration information for NAND module.
+  * @param  nandaddress  NAND raw address of the page
+  * @retval None
+  */
+static void NAND_WritePageCommand(const NAND_HandleTypeDef *hnand, uint32_t nandaddress)
+{
+  uint32_t deviceaddress = NAND_DEVICE;
+
+  *(__IO uint8_t *)((uint32_t)(deviceaddress | CMD_AREA)) = NAND_CMD_AREA_A;
+  __DSB();
+  *(__IO uint8_t *)((uint32_t)(deviceaddress | CMD_AREA)) = NAND_CMD_WRITE0;
+  __DSB();
+
+  NAND_SendAddress(hnand, nandaddress);
+}
+
+/**
+  * @brief  Restart the ECC computation and start the DMA transfer of one page
+  * @param  hnand pointer to a NAND_HandleTypeDef structure that contains
+  *                the configuration information for NAND module.
+  * @param  SrcAddress  DMA source address
+  * @param  DstAddress  DMA destination address
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef NAND_PageDMA(NAND_HandleTypeDef *hnand, uint32_t SrcAddress, uint32_t DstAddress)
+{
+  if (hnand->pXferECC != NULL)
+  {
+    /* Reset the ECC computation for the new page */
+    (void)FMC_NAND_ECC_Disable(hnand->Instance, hnand->Init.NandBank);
+    (void)FMC_NAND_ECC_Enable(hnand->Instance, hnand->Init.NandBank);
+  }
+
+  return HAL_DMA_Start_IT(hnand->hdma, SrcAddress, DstAddress, hnand->Config.PageSize);
+}
+
+/**
+  * @brief  End the DMA page(s) transfer on error.
+  * @param  hnand pointer to a NAND_HandleTypeDef structure that contains
+  *                the configuration information for NAND module.
+  * @retval None
+  */
+static void NAND_DMAAbort(NAND_HandleTypeDef *hnand)
+{
+  /* Update the NAND controller state */
+  hnand->State = HAL_NAND_STATE_ERROR;
+
+#if (USE_HAL_NAND_REGISTER_CALLBACKS == 1)
+  hnand->ErrorCallback(hnand);
+#else
+  HAL_NAND_ErrorCallback(hnand);
+#endif /* USE_HAL_NAND_REGISTER_CALLBACKS */
+}
+
+/**
+  * @brief  DMA NAND page read complete callback.
+  * @param  hdma : DMA handle
+  * @retval None
+  */
+static void NAND_DMAReadCplt(DMA_HandleTypeDef *hdma)
+{
+  /* Derogation MISRAC2012-Rule-11.5 */
+  NAND_HandleTypeDef *hnand = (NAND_HandleTypeDef *)(hdma->Parent);
+  HAL_StatusTypeDef status = HAL_OK;
+  uint8_t command;
+
+  if (hnand->pXferECC != NULL)
+  {
+    /* Get the ECC computed in-line on the page data */
+    status = FMC_NAND_GetECC(hnand->Instance, &hnand->pXferECC[hnand->XferPageIdx], hnand->Init.NandBank,
+                             NAND_WRITE_TIMEOUT);
+  }
+
+  if (status == HAL_OK)
+  {
+    hnand->XferPageIdx++;
+
+    if (hnand->XferPageIdx < hnand->XferPageCount)
+    {
+      if (hnand->Config.CacheReadEnable == ENABLE)
+      {
+        /* The last page is output with the read cache end command */
+        command = (hnand->XferPageIdx == (hnand->XferPageCount - 1U)) ? NAND_CMD_READ_CACHE_END :
+                  NAND_CMD_READ_CACHE_SEQ;
+        status = NAND_ReadCacheCommand(hnand, command);
+      }
+      else
+      {
+        status = NAND_ReadPageCommand(hnand, hnand->XferAddress + hnand->XferPageIdx);
+      }
+
+      if (status == HAL_OK)
+      {
+        status = NAND_PageDMA(hnand, NAND_DEVICE,
+                              (uint32_t)&hnand->pXferBuffer[hnand->XferPageIdx * hnand->Config.PageSize]);
+      }
+    }
+    else
+    {
+      /* Update the NAND controller state */
+      hnand->State = HAL_NAND_STATE_READY;
+
+#if (USE_HAL_NAND_REGISTER_CALLBACKS == 1)
+      hnand->ReadCpltCallback(hnand);
+#else
+      HAL_NAND_ReadCpltCallback(hnand);
+#endif /* USE_HAL_NAND_REGISTER_CALLBACKS */
+    }
+  }
+
+  if (status != HAL_OK)
+  {
+    NAND_DMAAbort(hnand);
+  }
+}
+
+/**
+  * @brief  DMA NAND page write complete callback.
+  * @param  hdma : DMA handle
+  * @retval None
+  */
+static void NAND_DMAWriteCplt(DMA_HandleTypeDef *hdma)
+{
+  /* Derogation MISRAC2012-Rule-11.5 */
+  NAND_HandleTypeDef *hnand = (NAND_HandleTypeDef *)(hdma->Parent);
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if (hnand->pXferECC != NULL)
+  {
+    /* Get the ECC computed in-line on the page data, the FIFO is empty once it is available */
+    status = FMC_NAND_GetECC(hnand->Instance, &hnand->pXferECC[hnand->XferPageIdx], hnand->Init.NandBank,
+                             NAND_WRITE_TIMEOUT);
+  }
+
+  if (status == HAL_OK)
+  {
+    /* Program the page */
+    *(__IO uint8_t *)((uint32_t)(NAND_DEVICE | CMD_AREA)) = NAND_CMD_WRITE_TRUE1;
+    __DSB();
+
+    status = NAND_WaitReady(hnand);
+  }
+
+  if (status == HAL_OK)
+  {
+    hnand->XferPageIdx++;
+
+    if (hnand->XferPageIdx < hnand->XferPageCount)
+    {
+      NAND_WritePageCommand(hnand, hnand->XferAddress + hnand->XferPageIdx);
+      status = NAND_PageDMA(hnand, (uint32_t)&hnand->pXferBuffer[hnand->XferPageIdx * hnand->Config.PageSize],
+                            NAND_DEVICE);
+    }
+    else
+    {
+      /* Update the NAND controller state */
+      hnand->State = HAL_NAND_STATE_READY;
+
+#if (USE_HAL_NAND_REGISTER_CALLBACKS == 1)
+      hnand->WriteCpltCallback(hnand);
+#else
+      HAL_NAND_WriteCpltCallback(hnand);
+#endif /* USE_HAL_NAND_REGISTER_CALLBACKS */
+    }
+  }
+
+  if (status != HAL_OK)
+  {
+    NAND_DMAAbort(hnand);
+  }
+}
+
+/**
+  * @brief  DMA NAND error callback.
+  * @param  hdma : DMA handle
+  * @retval None
+  */
+static void NAND_DMAError(DMA_HandleTypeDef *hdma)
+{
+  /* Derogation MISRAC2012-Rule-11.5 */
+  NAND_HandleTypeDef *hnand = (NAND_HandleTypeDef *)(hdma->Parent);
+
+  NAND_DMAAbort(hnand);
+}
+
 /**
   * @}
   */
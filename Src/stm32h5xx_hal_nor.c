@@ -36,6 +36,12 @@
       (+) Access NOR flash memory by read/write data unit operations using the functions
           HAL_NOR_Read(), HAL_NOR_Program().
 
+      (+) Program large NOR flash memory areas in the background using the function
+          HAL_NOR_ProgramBuffer_DMA(), after linking the DMA handle to hnor->hdma.
+          Each write buffer chunk is loaded by DMA, HAL_NOR_ReadyIRQHandler() must be
+          called on the NOR Ready/Busy rising edge to start the next one.
+          HAL_NOR_ProgramCpltCallback() or HAL_NOR_ErrorCallback() is executed at the end.
+
       (+) Perform NOR flash erase block/chip operations using the functions
           HAL_NOR_Erase_Block() and HAL_NOR_Erase_Chip().
 
@@ -70,6 +76,8 @@
       it allows to register following callbacks:
         (+) MspInitCallback    : NOR MspInit.
         (+) MspDeInitCallback  : NOR MspDeInit.
+        (+) ProgramCpltCallback : NOR Program Complete.
+        (+) ErrorCallback      : NOR Error.
       This function takes as parameters the HAL peripheral handle, the Callback ID
       and a pointer to the user callback function.
 
@@ -77,6 +85,8 @@
       weak (overridden) function. It allows to reset following callbacks:
         (+) MspInitCallback    : NOR MspInit.
         (+) MspDeInitCallback  : NOR MspDeInit.
+        (+) ProgramCpltCallback : NOR Program Complete.
+        (+) ErrorCallback      : NOR Error.
       This function) takes as parameters the HAL peripheral handle and the Callback ID.
 
       By default, after the HAL_NOR_Init and if the state is HAL_NOR_STATE_RESET
@@ -195,6 +205,20 @@
   * @}
   */
 
+/* Private function prototypes -----------------------------------------------*/
+/** @addtogroup NOR_Private_Functions NOR Private Functions
+  * @{
+  */
+static uint32_t NOR_GetDeviceAddress(const NOR_HandleTypeDef *hnor);
+static HAL_StatusTypeDef NOR_ProgramBufferStart(NOR_HandleTypeDef *hnor);
+static HAL_NOR_StatusTypeDef NOR_CheckStatus(const NOR_HandleTypeDef *hnor, uint32_t Address);
+static void NOR_ProgramError(NOR_HandleTypeDef *hnor);
+static void NOR_DMAProgramCplt(DMA_HandleTypeDef *hdma);
+static void NOR_DMAError(DMA_HandleTypeDef *hdma);
+/**
+  * @}
+  */
+
 /* Private functions ---------------------------------------------------------*/
 /* Exported functions --------------------------------------------------------*/
 /** @defgroup NOR_Exported_Functions NOR Exported Functions
@@ -252,6 +276,8 @@ HAL_StatusTypeDef HAL_NOR_Init(NOR_HandleTypeDef *hnor, FMC_NORSRAM_TimingTypeDe
     {
       hnor->MspInitCallback = HAL_NOR_MspInit;
     }
+    hnor->ProgramCpltCallback = HAL_NOR_ProgramCpltCallback;
+    hnor->ErrorCallback = HAL_NOR_ErrorCallback;
 
     /* Init the low level hardware */
     hnor->MspInitCallback(hnor);
@@ -401,6 +427,38 @@ __weak void HAL_NOR_MspWait(NOR_HandleTypeDef *hnor, uint32_t Timeout)
    */
 }
 
+/**
+  * @brief  NOR background buffered programming complete callback
+  * @param  hnor pointer to a NOR_HandleTypeDef structure that contains
+  *                the configuration information for NOR module.
+  * @retval None
+  */
+__weak void HAL_NOR_ProgramCpltCallback(NOR_HandleTypeDef *hnor)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hnor);
+
+  /* NOTE : This function Should not be modified, when the callback is needed,
+            the HAL_NOR_ProgramCpltCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  NOR background buffered programming error callback
+  * @param  hnor pointer to a NOR_HandleTypeDef structure that contains
+  *                the configuration information for NOR module.
+  * @retval None
+  */
+__weak void HAL_NOR_ErrorCallback(NOR_HandleTypeDef *hnor)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hnor);
+
+  /* NOTE : This function Should not be modified, when the callback is needed,
+            the HAL_NOR_ErrorCallback could be implemented in the user file
+   */
+}
+
 /**
   * @}
   */
@@ -961,6 +1019,137 @@ HAL_StatusTypeDef HAL_NOR_ProgramBuffer(NOR_HandleTypeDef *hnor, uint32_t uwAddr
 
 }
 
+/**
+  * @brief  Writes a half-word buffer to the NOR memory in the background.
+  * @note   The buffer is split in write buffer chunks (see WriteBufferSize in the
+  *         NOR handle) aligned on the device write buffer pages. The data of each
+  *         chunk is loaded by the DMA, then the device programs it while the CPU
+  *         is free. HAL_NOR_ReadyIRQHandler() must be called on the NOR
+  *         Ready/Busy rising edge (e.g. from the GPIO EXTI callback) to start the
+  *         next chunk. HAL_NOR_ProgramCpltCallback() is executed when the whole
+  *         buffer is programmed.
+  * @note   The DMA must be configured in normal memory to memory mode with half-word
+  *         source and destination data widths, both addresses being incremented.
+  * @param  hnor pointer to the NOR handle
+  * @param  uwAddress NOR memory internal start write address
+  * @param  pData pointer to source data buffer.
+  * @param  uwBufferSize Size of the buffer to write in half-words
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_NOR_ProgramBuffer_DMA(NOR_HandleTypeDef *hnor, uint32_t uwAddress, const uint16_t *pData,
+                                            uint32_t uwBufferSize)
+{
+  HAL_StatusTypeDef status;
+
+  if ((hnor->hdma == NULL) || (pData == NULL) || (uwBufferSize == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  if ((hnor->CommandSet != NOR_AMD_FUJITSU_COMMAND_SET) && (hnor->CommandSet != NOR_INTEL_SHARP_EXT_COMMAND_SET))
+  {
+    /* Primary command set not supported by the driver */
+    return HAL_ERROR;
+  }
+
+  /* Check the NOR controller state */
+  if (hnor->State == HAL_NOR_STATE_BUSY)
+  {
+    return HAL_BUSY;
+  }
+  else if (hnor->State == HAL_NOR_STATE_READY)
+  {
+    /* Process Locked */
+    __HAL_LOCK(hnor);
+
+    /* Update the NOR controller state */
+    hnor->State = HAL_NOR_STATE_BUSY;
+
+    /* Save the transfer context */
+    hnor->pXferData = pData;
+    hnor->XferAddress = NOR_GetDeviceAddress(hnor) + uwAddress;
+    hnor->XferCount = uwBufferSize;
+
+    /* Configure DMA user callbacks */
+    hnor->hdma->XferCpltCallback = NOR_DMAProgramCplt;
+    hnor->hdma->XferErrorCallback = NOR_DMAError;
+
+    /* Load the first chunk */
+    status = NOR_ProgramBufferStart(hnor);
+
+    if (status != HAL_OK)
+    {
+      /* Update the NOR controller state */
+      hnor->State = HAL_NOR_STATE_ERROR;
+    }
+
+    /* Process unlocked */
+    __HAL_UNLOCK(hnor);
+  }
+  else
+  {
+    return HAL_ERROR;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Handles the NOR Ready/Busy event of the background buffered programming.
+  * @note   This function checks the device status without waiting, it can also be
+  *         called periodically when the Ready/Busy signal is not connected.
+  * @param  hnor pointer to the NOR handle
+  * @retval None
+  */
+void HAL_NOR_ReadyIRQHandler(NOR_HandleTypeDef *hnor)
+{
+  HAL_NOR_StatusTypeDef status;
+
+  if ((hnor->State == HAL_NOR_STATE_BUSY) && (hnor->XferProgramming != 0U))
+  {
+    status = NOR_CheckStatus(hnor, hnor->XferAddress);
+
+    if (status == HAL_NOR_STATUS_SUCCESS)
+    {
+      hnor->XferProgramming = 0U;
+
+      /* Move to the next chunk */
+      hnor->pXferData = &hnor->pXferData[hnor->XferChunkSize];
+      hnor->XferAddress += (2U * hnor->XferChunkSize);
+      hnor->XferCount -= hnor->XferChunkSize;
+
+      if (hnor->XferCount != 0U)
+      {
+        if (NOR_ProgramBufferStart(hnor) != HAL_OK)
+        {
+          NOR_ProgramError(hnor);
+        }
+      }
+      else
+      {
+        /* Update the NOR controller state */
+        hnor->State = HAL_NOR_STATE_READY;
+
+#if (USE_HAL_NOR_REGISTER_CALLBACKS == 1)
+        hnor->ProgramCpltCallback(hnor);
+#else
+        HAL_NOR_ProgramCpltCallback(hnor);
+#endif /* USE_HAL_NOR_REGISTER_CALLBACKS */
+      }
+    }
+    else if (status == HAL_NOR_STATUS_ERROR)
+    {
+      hnor->XferProgramming = 0U;
+
+      NOR_ProgramError(hnor);
+    }
+    else
+    {
+      /* Chunk programming still ongoing */
+    }
+  }
+}
+
 /**
   * @brief  Erase the specified block of the NOR memory
   * @param  hnor pointer to a NOR_HandleTypeDef structure that contains
@@ -1205,6 +1394,8 @@ HAL_StatusTypeDef HAL_NOR_Read_CFI(NOR_HandleTypeDef *hnor, NOR_CFITypeDef *pNOR
   *        This parameter can be one of the following values:
   *          @arg @ref HAL_NOR_MSP_INIT_CB_ID       NOR MspInit callback ID
   *          @arg @ref HAL_NOR_MSP_DEINIT_CB_ID     NOR MspDeInit callback ID
+  *          @arg @ref HAL_NOR_PROGRAM_CPLT_CB_ID   NOR Program Complete callback ID
+  *          @arg @ref HAL_NOR_ERROR_CB_ID          NOR Error callback ID
   * @param pCallback : pointer to the Callback function
   * @retval status
   */
@@ -1230,6 +1421,12 @@ HAL_StatusTypeDef HAL_NOR_RegisterCallback(NOR_HandleTypeDef *hnor, HAL_NOR_Call
       case HAL_NOR_MSP_DEINIT_CB_ID :
         hnor->MspDeInitCallback = pCallback;
         break;
+      case HAL_NOR_PROGRAM_CPLT_CB_ID :
+        hnor->ProgramCpltCallback = pCallback;
+        break;
+      case HAL_NOR_ERROR_CB_ID :
+        hnor->ErrorCallback = pCallback;
+        break;
       default :
         /* update return status */
         status =  HAL_ERROR;
@@ -1253,6 +1450,8 @@ HAL_StatusTypeDef HAL_NOR_RegisterCallback(NOR_HandleTypeDef *hnor, HAL_NOR_Call
   *        This parameter can be one of the following values:
   *          @arg @ref HAL_NOR_MSP_INIT_CB_ID       NOR MspInit callback ID
   *          @arg @ref HAL_NOR_MSP_DEINIT_CB_ID     NOR MspDeInit callback ID
+  *          @arg @ref HAL_NOR_PROGRAM_CPLT_CB_ID   NOR Program Complete callback ID
+  *          @arg @ref HAL_NOR_ERROR_CB_ID          NOR Error callback ID
   * @retval status
   */
 HAL_StatusTypeDef HAL_NOR_UnRegisterCallback(NOR_HandleTypeDef *hnor, HAL_NOR_CallbackIDTypeDef CallbackId)
@@ -1271,6 +1470,12 @@ HAL_StatusTypeDef HAL_NOR_UnRegisterCallback(NOR_HandleTypeDef *hnor, HAL_NOR_Ca
       case HAL_NOR_MSP_DEINIT_CB_ID :
         hnor->MspDeInitCallback = HAL_NOR_MspDeInit;
         break;
+      case HAL_NOR_PROGRAM_CPLT_CB_ID :
+        hnor->ProgramCpltCallback = HAL_NOR_ProgramCpltCallback;
+        break;
+      case HAL_NOR_ERROR_CB_ID :
+        hnor->ErrorCallback = HAL_NOR_ErrorCallback;
+        break;
       default :
         /* update return status */
         status =  HAL_ERROR;
@@ -1514,6 +1719,200 @@ HAL_NOR_StatusTypeDef HAL_NOR_GetStatus(NOR_HandleTypeDef *hnor, uint32_t Addres
   * @}
   */
 
+/**
+  * @}
+  */
+
+/** @addtogroup NOR_Private_Functions NOR Private Functions
+  * @{
+  */
+
+/**
+  * @brief  Get the NOR device address of the bank.
+  * @param  hnor pointer to the NOR handle
+  * @retval NOR device address
+  */
+static uint32_t NOR_GetDeviceAddress(const NOR_HandleTypeDef *hnor)
+{
+  uint32_t deviceaddress;
+
+  /* Select the NOR device address */
+  if (hnor->Init.NSBank == FMC_NORSRAM_BANK1)
+  {
+    deviceaddress = NOR_MEMORY_ADRESS1;
+  }
+  else if (hnor->Init.NSBank == FMC_NORSRAM_BANK2)
+  {
+    deviceaddress = NOR_MEMORY_ADRESS2;
+  }
+  else if (hnor->Init.NSBank == FMC_NORSRAM_BANK3)
+  {
+    deviceaddress = NOR_MEMORY_ADRESS3;
+  }
+  else /* FMC_NORSRAM_BANK4 */
+  {
+    deviceaddress = NOR_MEMORY_ADRESS4;
+  }
+
+  return deviceaddress;
+}
+
+/**
+  * @brief  Issue the write buffer load command and start the DMA load of the next chunk.
+  * @param  hnor pointer to the NOR handle
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef NOR_ProgramBufferStart(NOR_HandleTypeDef *hnor)
+{
+  uint32_t deviceaddress = NOR_GetDeviceAddress(hnor);
+  uint32_t buffersize = (hnor->WriteBufferSize != 0U) ? hnor->WriteBufferSize : NOR_WRITE_BUFFER_SIZE;
+
+  /* The chunk must not cross a write buffer page */
+  hnor->XferChunkSize = buffersize - ((hnor->XferAddress / 2U) & (buffersize - 1U));
+  if (hnor->XferChunkSize > hnor->XferCount)
+  {
+    hnor->XferChunkSize = hnor->XferCount;
+  }
+
+  if (hnor->CommandSet == NOR_AMD_FUJITSU_COMMAND_SET)
+  {
+    /* Issue unlock command sequence */
+    NOR_WRITE(NOR_ADDR_SHIFT(deviceaddress, NOR_MEMORY_16B, NOR_CMD_ADDRESS_FIRST), NOR_CMD_DATA_FIRST);
+    NOR_WRITE(NOR_ADDR_SHIFT(deviceaddress, NOR_MEMORY_16B, NOR_CMD_ADDRESS_SECOND), NOR_CMD_DATA_SECOND);
+
+    /* Write Buffer Load Command */
+    NOR_WRITE(hnor->XferAddress, NOR_CMD_DATA_BUFFER_AND_PROG);
+    NOR_WRITE(hnor->XferAddress, (uint16_t)(hnor->XferChunkSize - 1U));
+  }
+  else /* => hnor->CommandSet == NOR_INTEL_SHARP_EXT_COMMAND_SET */
+  {
+    /* Write Buffer Load Command */
+    NOR_WRITE(hnor->XferAddress, NOR_CMD_BUFFERED_PROGRAM);
+    NOR_WRITE(hnor->XferAddress, (uint16_t)(hnor->XferChunkSize - 1U));
+  }
+
+  /* Load Data into NOR Buffer */
+  return HAL_DMA_Start_IT(hnor->hdma, (uint32_t)hnor->pXferData, hnor->XferAddress, (2U * hnor->XferChunkSize));
+}
+
+/**
+  * @brief  Returns the NOR operation status without waiting.
+  * @param  hnor pointer to the NOR handle
+  * @param  Address Device address
+  * @retval NOR_Status The returned value can be: HAL_NOR_STATUS_SUCCESS, HAL_NOR_STATUS_ONGOING
+  *         or HAL_NOR_STATUS_ERROR
+  */
+static HAL_NOR_StatusTypeDef NOR_CheckStatus(const NOR_HandleTypeDef *hnor, uint32_t Address)
+{
+  HAL_NOR_StatusTypeDef status = HAL_NOR_STATUS_ONGOING;
+  uint16_t tmpsr1;
+  uint16_t tmpsr2;
+
+  if (hnor->CommandSet == NOR_AMD_FUJITSU_COMMAND_SET)
+  {
+    /* Read NOR status register (DQ6 and DQ5) */
+    tmpsr1 = *(__IO uint16_t *)Address;
+    tmpsr2 = *(__IO uint16_t *)Address;
+
+    /* If DQ6 did not toggle between the two reads then the operation is complete */
+    if ((tmpsr1 & NOR_MASK_STATUS_DQ6) == (tmpsr2 & NOR_MASK_STATUS_DQ6))
+    {
+      status = HAL_NOR_STATUS_SUCCESS;
+    }
+    else if ((tmpsr2 & NOR_MASK_STATUS_DQ5) == NOR_MASK_STATUS_DQ5)
+    {
+      tmpsr1 = *(__IO uint16_t *)Address;
+      tmpsr2 = *(__IO uint16_t *)Address;
+
+      /* DQ6 still toggling after DQ5 is set means the operation failed */
+      if ((tmpsr1 & NOR_MASK_STATUS_DQ6) == (tmpsr2 & NOR_MASK_STATUS_DQ6))
+      {
+        status = HAL_NOR_STATUS_SUCCESS;
+      }
+      else
+      {
+        status = HAL_NOR_STATUS_ERROR;
+      }
+    }
+    else
+    {
+      /* Operation ongoing */
+    }
+  }
+  else
+  {
+    NOR_WRITE(Address, NOR_CMD_READ_STATUS_REG);
+    tmpsr1 = *(__IO uint16_t *)(Address);
+
+    if ((tmpsr1 & NOR_MASK_STATUS_DQ7) != 0U)
+    {
+      if ((tmpsr1 & (NOR_MASK_STATUS_DQ5 | NOR_MASK_STATUS_DQ4)) != 0U)
+      {
+        status = HAL_NOR_STATUS_ERROR;
+      }
+      else
+      {
+        status = HAL_NOR_STATUS_SUCCESS;
+      }
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  End the background buffered programming on error.
+  * @param  hnor pointer to the NOR handle
+  * @retval None
+  */
+static void NOR_ProgramError(NOR_HandleTypeDef *hnor)
+{
+  /* Update the NOR controller state */
+  hnor->State = HAL_NOR_STATE_ERROR;
+
+#if (USE_HAL_NOR_REGISTER_CALLBACKS == 1)
+  hnor->ErrorCallback(hnor);
+#else
+  HAL_NOR_ErrorCallback(hnor);
+#endif /* USE_HAL_NOR_REGISTER_CALLBACKS */
+}
+
+/**
+  * @brief  DMA NOR write buffer load complete callback.
+  * @param  hdma : DMA handle
+  * @retval None
+  */
+static void NOR_DMAProgramCplt(DMA_HandleTypeDef *hdma)
+{
+  /* Derogation MISRAC2012-Rule-11.5 */
+  NOR_HandleTypeDef *hnor = (NOR_HandleTypeDef *)(hdma->Parent);
+
+  /* The Ready/Busy event now ends the chunk programming */
+  hnor->XferProgramming = 1U;
+
+  if (hnor->CommandSet == NOR_AMD_FUJITSU_COMMAND_SET)
+  {
+    NOR_WRITE(hnor->XferAddress, NOR_CMD_DATA_BUFFER_AND_PROG_CONFIRM);
+  }
+  else /* => hnor->CommandSet == NOR_INTEL_SHARP_EXT_COMMAND_SET */
+  {
+    NOR_WRITE(hnor->XferAddress, NOR_CMD_CONFIRM);
+  }
+}
+
+/**
+  * @brief  DMA NOR error callback.
+  * @param  hdma : DMA handle
+  * @retval None
+  */
+static void NOR_DMAError(DMA_HandleTypeDef *hdma)
+{
+  /* Derogation MISRAC2012-Rule-11.5 */
+  NOR_HandleTypeDef *hnor = (NOR_HandleTypeDef *)(hdma->Parent);
+
+  NOR_ProgramError(hnor);
+}
+
 /**
   * @}
   */
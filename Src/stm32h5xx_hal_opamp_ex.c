@@ -7,6 +7,7 @@
   *          functionalities of the operational amplifier(s) peripheral:
   *           + Extended Initialization and de-initialization functions
   *           + Extended Peripheral Control functions
+  *           + PGA auto-ranging functions
   *
   @verbatim
   **********************************************************************************************************************
@@ -43,6 +44,15 @@
 /* Private macro -----------------------------------------------------------------------------------------------------*/
 /* Private variables -------------------------------------------------------------------------------------------------*/
 /* Private function prototypes ---------------------------------------------------------------------------------------*/
+#if defined(HAL_ADC_MODULE_ENABLED)
+/** @addtogroup OPAMPEx_Private_Functions
+  * @{
+  */
+static HAL_StatusTypeDef OPAMPEx_AutoRangeConfigWindow(const OPAMPEx_AutoRangeTypeDef *pRange);
+/**
+  * @}
+  */
+#endif /* HAL_ADC_MODULE_ENABLED */
 /* Exported functions ------------------------------------------------------------------------------------------------*/
 
 /** @defgroup OPAMPEx_Exported_Functions OPAMP Extended Exported Functions
@@ -101,9 +111,244 @@ HAL_StatusTypeDef HAL_OPAMPEx_Unlock(OPAMP_HandleTypeDef *hopamp)
   * @}
   */
 
+#if defined(HAL_ADC_MODULE_ENABLED)
+/** @defgroup OPAMPEx_Exported_Functions_Group2 PGA auto-ranging functions
+  *  @brief    PGA auto-ranging functions
+  *
+@verbatim
+ =======================================================================================================================
+                                        ##### PGA auto-ranging functions #####
+ =======================================================================================================================
+    [..]
+      (+) Start and stop the PGA gain auto-ranging driven by an ADC analog watchdog.
+      (+) Switch the PGA gain from the ADC analog watchdog callback.
+      (+) Convert the ADC samples to the maximum gain scale.
+
+    [..] The gain is switched on the fly, without stopping the OPAMP: the conversions made while the
+         OPAMP output settles are discarded by HAL_OPAMPEx_AutoRange_Convert().
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Start the PGA gain auto-ranging.
+  * @note   The OPAMP must be started in PGA mode and the ADC must not be converting: the analog watchdog of
+  *         pRange->AWDConfig is configured in interrupt mode on the OPAMP output channel.
+  * @note   HAL_OPAMPEx_AutoRange_Process() must then be called from the ADC analog watchdog callback
+  *         (e.g. HAL_ADC_LevelOutOfWindowCallback()) with the last conversion data.
+  * @param  hopamp: OPAMP handle
+  * @param  pRange: auto-ranging structure, the initial gain is hopamp->Init.PgaGain
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_OPAMPEx_AutoRange_Start(OPAMP_HandleTypeDef *hopamp, OPAMPEx_AutoRangeTypeDef *pRange)
+{
+  HAL_StatusTypeDef status;
+
+  /* Check the OPAMP handle and auto-ranging structure allocation */
+  if ((hopamp == NULL) || (pRange == NULL) || (pRange->hadc == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_OPAMP_ALL_INSTANCE(hopamp->Instance));
+  assert_param(IS_OPAMP_PGA_GAIN(pRange->MinGain));
+  assert_param(IS_OPAMP_PGA_GAIN(pRange->MaxGain));
+
+  /* The OPAMP must run in PGA mode and the ranging window must be wider than a gain step */
+  if ((hopamp->State != HAL_OPAMP_STATE_BUSY) || (hopamp->Init.Mode != OPAMP_PGA_MODE)
+      || (pRange->MinGain > pRange->MaxGain)
+      || ((pRange->AWDConfig.LowThreshold * 2UL) >= pRange->AWDConfig.HighThreshold))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Start from the configured gain, within the ranging limits */
+  if (hopamp->Init.PgaGain < pRange->MinGain)
+  {
+    pRange->Gain = pRange->MinGain;
+  }
+  else if (hopamp->Init.PgaGain > pRange->MaxGain)
+  {
+    pRange->Gain = pRange->MaxGain;
+  }
+  else
+  {
+    pRange->Gain = hopamp->Init.PgaGain;
+  }
+  MODIFY_REG(hopamp->Instance->CSR, OPAMP_CSR_PGGAIN_0 | OPAMP_CSR_PGGAIN_1, pRange->Gain);
+  hopamp->Init.PgaGain = pRange->Gain;
+
+  pRange->SettlingCount = pRange->SettlingConversions;
+  pRange->SwitchCount = 0UL;
+
+  /* Enable the analog watchdog interrupt */
+  pRange->AWDConfig.ITMode = ENABLE;
+  status = OPAMPEx_AutoRangeConfigWindow(pRange);
+
+  return status;
+}
+
+/**
+  * @brief  Stop the PGA gain auto-ranging.
+  * @note   The ADC analog watchdog interrupt is disabled, the OPAMP keeps its current gain.
+  * @param  hopamp: OPAMP handle
+  * @param  pRange: auto-ranging structure
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_OPAMPEx_AutoRange_Stop(OPAMP_HandleTypeDef *hopamp, OPAMPEx_AutoRangeTypeDef *pRange)
+{
+  /* Check the OPAMP handle and auto-ranging structure allocation */
+  if ((hopamp == NULL) || (pRange == NULL) || (pRange->hadc == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  if (pRange->AWDConfig.WatchdogNumber == ADC_ANALOGWATCHDOG_1)
+  {
+    __HAL_ADC_DISABLE_IT(pRange->hadc, ADC_IT_AWD1);
+  }
+  else if (pRange->AWDConfig.WatchdogNumber == ADC_ANALOGWATCHDOG_2)
+  {
+    __HAL_ADC_DISABLE_IT(pRange->hadc, ADC_IT_AWD2);
+  }
+  else
+  {
+    __HAL_ADC_DISABLE_IT(pRange->hadc, ADC_IT_AWD3);
+  }
+  pRange->AWDConfig.ITMode = DISABLE;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Switch the PGA gain after an ADC analog watchdog event.
+  * @note   The gain is halved when AdcValue is above the high threshold and doubled when it is below the low
+  *         threshold. The analog watchdog window is widened at the ranging limits so that no further event
+  *         is triggered there.
+  * @param  hopamp: OPAMP handle
+  * @param  pRange: auto-ranging structure
+  * @param  AdcValue: ADC conversion data that triggered the analog watchdog
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_OPAMPEx_AutoRange_Process(OPAMP_HandleTypeDef *hopamp, OPAMPEx_AutoRangeTypeDef *pRange,
+                                                uint32_t AdcValue)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t gain;
+
+  /* Check the OPAMP handle and auto-ranging structure allocation */
+  if ((hopamp == NULL) || (pRange == NULL) || (pRange->hadc == NULL))
+  {
+    return HAL_ERROR;
+  }
+  if (hopamp->State != HAL_OPAMP_STATE_BUSY)
+  {
+    return HAL_ERROR;
+  }
+
+  gain = pRange->Gain;
+  if ((AdcValue > pRange->AWDConfig.HighThreshold) && (gain > pRange->MinGain))
+  {
+    /* Halve the gain */
+    gain -= OPAMP_CSR_PGGAIN_0;
+  }
+  else if ((AdcValue < pRange->AWDConfig.LowThreshold) && (gain < pRange->MaxGain))
+  {
+    /* Double the gain */
+    gain += OPAMP_CSR_PGGAIN_0;
+  }
+  else
+  {
+    /* Nothing to do, in range or at a ranging limit */
+  }
+
+  if (gain != pRange->Gain)
+  {
+    /* Switch the gain on the fly, the OPAMP remains enabled */
+    MODIFY_REG(hopamp->Instance->CSR, OPAMP_CSR_PGGAIN_0 | OPAMP_CSR_PGGAIN_1, gain);
+    hopamp->Init.PgaGain = gain;
+
+    pRange->Gain = gain;
+    pRange->SettlingCount = pRange->SettlingConversions;
+    pRange->SwitchCount++;
+
+    status = OPAMPEx_AutoRangeConfigWindow(pRange);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Convert an ADC conversion data to the maximum gain scale.
+  * @note   The result is AdcValue multiplied by MaxGain / Gain: the dynamic range is extended by
+  *         log2(MaxGain / MinGain) bits over the ADC resolution.
+  * @param  pRange: auto-ranging structure
+  * @param  AdcValue: ADC conversion data of the OPAMP output
+  * @param  pValue: pointer to the converted value
+  * @retval HAL status, HAL_BUSY if the conversion is discarded while the OPAMP output settles
+  */
+HAL_StatusTypeDef HAL_OPAMPEx_AutoRange_Convert(OPAMPEx_AutoRangeTypeDef *pRange, uint32_t AdcValue,
+                                                uint32_t *pValue)
+{
+  /* Check the auto-ranging structure allocation */
+  if ((pRange == NULL) || (pValue == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  if (pRange->SettlingCount != 0UL)
+  {
+    pRange->SettlingCount--;
+    return HAL_BUSY;
+  }
+
+  *pValue = AdcValue << ((pRange->MaxGain - pRange->Gain) >> OPAMP_CSR_PGGAIN_Pos);
+
+  return HAL_OK;
+}
+
+/**
+  * @}
+  */
+#endif /* HAL_ADC_MODULE_ENABLED */
+
+/**
+  * @}
+  */
+
+#if defined(HAL_ADC_MODULE_ENABLED)
+/** @addtogroup OPAMPEx_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Configure the ADC analog watchdog window for the current PGA gain.
+  * @note   The low threshold is disabled at the maximum gain and the high threshold at the minimum gain.
+  * @param  pRange: auto-ranging structure
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef OPAMPEx_AutoRangeConfigWindow(const OPAMPEx_AutoRangeTypeDef *pRange)
+{
+  ADC_AnalogWDGConfTypeDef awdconfig = pRange->AWDConfig;
+
+  if (pRange->Gain == pRange->MaxGain)
+  {
+    awdconfig.LowThreshold = 0UL;
+  }
+  if (pRange->Gain == pRange->MinGain)
+  {
+    awdconfig.HighThreshold = __LL_ADC_DIGITAL_SCALE(ADC_GET_RESOLUTION(pRange->hadc));
+  }
+
+  return HAL_ADC_AnalogWDGConfig(pRange->hadc, &awdconfig);
+}
+
 /**
   * @}
   */
+#endif /* HAL_ADC_MODULE_ENABLED */
 
 /**
   * @}
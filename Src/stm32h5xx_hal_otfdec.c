@@ -57,6 +57,30 @@
         having made sure the OctoSPI is configured in memory-mapped mode or data can
         be enciphered by calling HAL_OTFDEC_Cipher() API.
 
+    [..]
+    *** Encrypted execute-in-place ***
+    =============================================
+    [..]
+    (#) Configure the OctoSPI in memory-mapped mode.
+
+    (#) Fill an OTFDEC_XIPSlotTypeDef structure per firmware slot, each slot using its own OTFDEC
+        region when possible, and an OTFDEC_XIPTypeDef structure with the slots, the code address
+        they are executed from and the ICACHE output burst type supported by the memory.
+        Then call HAL_OTFDEC_XIP_Init().
+
+    (#) HAL_OTFDEC_XIP_Activate() makes a slot executable: the region key and configuration are
+        loaded only when the region does not hold this slot yet, then the ICACHE remaps the code
+        address to the slot and is enabled. Switching between slots using different regions only
+        changes the remapping.
+
+    (#) HAL_OTFDEC_XIP_Benchmark() measures the read throughput of an area, cache invalidated, then
+        from the cache. Comparing an encrypted slot to a plain copy gives the deciphering cost,
+        the checksums giving the same value when the slot is correctly deciphered.
+
+    [..]
+    (@) HAL_OTFDEC_XIP_Activate() must be executed from the internal memory, the slots being
+        unavailable during the switch.
+
     [..]
     (@) Warning: the OTFDEC en/deciphering is based on a different endianness compared
         to the AES-CTR as implemented in the AES peripheral. E.g., if the OTFEC
@@ -150,6 +174,9 @@
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
+#if defined(HAL_ICACHE_MODULE_ENABLED) && defined(ICACHE_CRRx_REN)
+static HAL_StatusTypeDef OTFDEC_XIP_LoadRegion(OTFDEC_XIPTypeDef *pXIP, uint32_t Slot);
+#endif /* HAL_ICACHE_MODULE_ENABLED && ICACHE_CRRx_REN */
 /* Private functions ---------------------------------------------------------*/
 
 /* Exported functions --------------------------------------------------------*/
@@ -1134,9 +1161,255 @@ HAL_StatusTypeDef HAL_OTFDEC_RegionGetConfig(OTFDEC_HandleTypeDef *hotfdec, uint
   * @}
   */
 
+#if defined(HAL_ICACHE_MODULE_ENABLED) && defined(ICACHE_CRRx_REN)
+/** @defgroup OTFDEC_Exported_Functions_Group5 Encrypted execute-in-place functions
+  *  @brief   Encrypted execute-in-place functions.
+  *
+@verbatim
+  ==============================================================================
+                 ##### Encrypted execute-in-place functions #####
+  ==============================================================================
+    [..]
+    This subsection permits to execute encrypted firmware slots from the external memory
+    through the ICACHE.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initialize the encrypted execute-in-place state, no slot being active or loaded.
+  * @param  pXIP pointer to an OTFDEC_XIPTypeDef structure with the user fields set
+  * @retval HAL state
+  */
+HAL_StatusTypeDef HAL_OTFDEC_XIP_Init(OTFDEC_XIPTypeDef *pXIP)
+{
+  uint32_t i;
+
+  if ((pXIP == NULL) || (pXIP->hotfdec == NULL) || (pXIP->pSlots == NULL) || (pXIP->NbSlots == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  pXIP->ActiveSlot  = OTFDEC_XIP_NO_SLOT;
+  pXIP->CacheRegion = 0U;
+  pXIP->NbKeyLoads  = 0U;
+
+  for (i = 0U; i < 4U; i++)
+  {
+    pXIP->RegionSlot[i] = OTFDEC_XIP_NO_SLOT;
+  }
+
+  /* Status is okay */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Make a firmware slot executable at the execution address.
+  * @note   The OTFDEC region key and configuration are loaded only when the region holds another slot.
+  *         The ICACHE is disabled, which invalidates it, remapped to the slot and enabled.
+  * @note   This function must be executed from the internal memory.
+  * @param  pXIP pointer to an OTFDEC_XIPTypeDef structure initialized by HAL_OTFDEC_XIP_Init()
+  * @param  Slot index of the slot in the slots table
+  * @retval HAL state
+  */
+HAL_StatusTypeDef HAL_OTFDEC_XIP_Activate(OTFDEC_XIPTypeDef *pXIP, uint32_t Slot)
+{
+  const OTFDEC_XIPSlotTypeDef *slot;
+  ICACHE_RegionConfigTypeDef cache_config;
+  uint32_t cache_region;
+  HAL_StatusTypeDef status;
+
+  if ((pXIP == NULL) || (Slot >= pXIP->NbSlots))
+  {
+    return HAL_ERROR;
+  }
+
+  slot = &pXIP->pSlots[Slot];
+
+  /* Check the parameters */
+  assert_param(IS_OTFDEC_REGIONINDEX(slot->RegionIndex));
+
+  if (slot->pKey == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Reload the region only when it does not hold the slot key */
+  if ((pXIP->RegionSlot[slot->RegionIndex] != Slot) ||
+      (HAL_OTFDEC_RegionGetKeyCRC(pXIP->hotfdec, slot->RegionIndex) != HAL_OTFDEC_KeyCRCComputation(slot->pKey)))
+  {
+    status = OTFDEC_XIP_LoadRegion(pXIP, Slot);
+  }
+  else
+  {
+    status = HAL_OTFDEC_RegionEnable(pXIP->hotfdec, slot->RegionIndex);
+  }
+
+  /* Remapping to the slot, the code address window being the slot start */
+  if (status == HAL_OK)
+  {
+    status = HAL_ICACHE_Disable();
+  }
+
+  if ((status == HAL_OK) && (pXIP->ActiveSlot != OTFDEC_XIP_NO_SLOT))
+  {
+    status = HAL_ICACHE_DisableRemapRegion(pXIP->CacheRegion);
+    pXIP->ActiveSlot = OTFDEC_XIP_NO_SLOT;
+  }
+
+  if (status == HAL_OK)
+  {
+    status = HAL_ICACHE_SuggestRemapRegion(slot->Config.StartAddress,
+                                           slot->Config.EndAddress - slot->Config.StartAddress + 1U,
+                                           pXIP->ExecAddress, &cache_region, &cache_config);
+  }
+
+  if ((status == HAL_OK) && (cache_config.RemapAddress != slot->Config.StartAddress))
+  {
+    /* Slot start not aligned on the remap region size */
+    status = HAL_ERROR;
+  }
+
+  if (status == HAL_OK)
+  {
+    cache_config.OutputBurstType = pXIP->OutputBurstType;
+    status = HAL_ICACHE_EnableRemapRegion(cache_region, &cache_config);
+  }
+
+  if (status == HAL_OK)
+  {
+    pXIP->CacheRegion = cache_region;
+    pXIP->ActiveSlot  = Slot;
+  }
+
+  /* Caching of the internal memory is kept whatever the remapping result */
+  if (HAL_ICACHE_Enable() != HAL_OK)
+  {
+    status = HAL_ERROR;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Measure the read throughput of a memory area.
+  * @note   The area is read once after the ICACHE invalidation, then a second time. The second read
+  *         is from the cache when the area fits in it. Encrypted areas are read with the
+  *         OTFDEC_REG_MODE_INSTRUCTION_OR_DATA_ACCESSES mode only.
+  * @param  Address start address of the area, word aligned
+  * @param  Size size of the area in bytes
+  * @param  pResult pointer to the measurement result
+  * @retval HAL state
+  */
+HAL_StatusTypeDef HAL_OTFDEC_XIP_Benchmark(uint32_t Address, uint32_t Size, OTFDEC_XIPBenchmarkTypeDef *pResult)
+{
+  const __IO uint32_t *p_word = (const __IO uint32_t *)Address;
+  uint32_t nb_words = Size / 4U;
+  uint32_t checksum = 0U;
+  uint32_t start;
+  uint32_t i;
+
+  if ((pResult == NULL) || (nb_words == 0U) || ((Address & 3U) != 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  HAL_CycleCounter_Enable();
+
+  if (HAL_ICACHE_IsEnabled() != 0U)
+  {
+    if (HAL_ICACHE_Invalidate() != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  /* Read from the memory */
+  start = HAL_CycleCounter_Get();
+  for (i = 0U; i < nb_words; i++)
+  {
+    checksum += p_word[i];
+  }
+  pResult->ColdCycles = HAL_CycleCounter_Get() - start;
+
+  pResult->Checksum = checksum;
+
+  /* Read a second time */
+  start = HAL_CycleCounter_Get();
+  for (i = 0U; i < nb_words; i++)
+  {
+    checksum += p_word[i];
+  }
+  pResult->WarmCycles = HAL_CycleCounter_Get() - start;
+
+  pResult->ColdThroughput = (pResult->ColdCycles == 0U) ? 0U :
+                            (uint32_t)((((uint64_t)nb_words * 4U) * SystemCoreClock) /
+                                       ((uint64_t)pResult->ColdCycles * 1024U));
+
+  /* Status is okay */
+  return HAL_OK;
+}
+
+/**
+  * @}
+  */
+#endif /* HAL_ICACHE_MODULE_ENABLED && ICACHE_CRRx_REN */
+
+/**
+  * @}
+  */
+
+#if defined(HAL_ICACHE_MODULE_ENABLED) && defined(ICACHE_CRRx_REN)
+/** @defgroup OTFDEC_Private_Functions OTFDEC Private Functions
+  * @{
+  */
+
+/**
+  * @brief  Load the key and configuration of a slot in its OTFDEC region.
+  * @param  pXIP pointer to an OTFDEC_XIPTypeDef structure
+  * @param  Slot index of the slot in the slots table
+  * @retval HAL state
+  */
+static HAL_StatusTypeDef OTFDEC_XIP_LoadRegion(OTFDEC_XIPTypeDef *pXIP, uint32_t Slot)
+{
+  const OTFDEC_XIPSlotTypeDef *slot = &pXIP->pSlots[Slot];
+  HAL_StatusTypeDef status;
+
+  /* The region is configured disabled, the slot using it being no longer active */
+  status = HAL_OTFDEC_RegionDisable(pXIP->hotfdec, slot->RegionIndex);
+  pXIP->RegionSlot[slot->RegionIndex] = OTFDEC_XIP_NO_SLOT;
+
+  if (status == HAL_OK)
+  {
+    status = HAL_OTFDEC_RegionSetMode(pXIP->hotfdec, slot->RegionIndex, slot->Mode);
+  }
+
+  if (status == HAL_OK)
+  {
+    status = HAL_OTFDEC_RegionSetKey(pXIP->hotfdec, slot->RegionIndex, slot->pKey);
+  }
+
+  if (status == HAL_OK)
+  {
+    /* Region enabled at the end of the configuration */
+    status = HAL_OTFDEC_RegionConfig(pXIP->hotfdec, slot->RegionIndex, &slot->Config,
+                                     OTFDEC_REG_CONFIGR_LOCK_DISABLE);
+  }
+
+  if (status == HAL_OK)
+  {
+    pXIP->RegionSlot[slot->RegionIndex] = Slot;
+    pXIP->NbKeyLoads++;
+  }
+
+  return status;
+}
+
 /**
   * @}
   */
+#endif /* HAL_ICACHE_MODULE_ENABLED && ICACHE_CRRx_REN */
 
 #endif /* OTFDEC1 */
 
@@ -51,6 +51,17 @@
      (#)Enable PCD transmission and reception:
          (##) HAL_PCD_Start();
 
+     (#)Transfer buffers aligned on USB_BUFFER_ALIGNMENT bytes are copied to and from
+        the packet memory by word bursts, and should be preferred by class drivers.
+
+     (#)To stream a bulk endpoint without stalls between transfers, attach a ring of
+        buffers with HAL_PCD_EP_StreamStart() after the endpoint is opened:
+         (##) HAL_PCD_EP_StreamQueue() queues a buffer to transmit or to receive into.
+         (##) The next queued buffer is started from the transfer complete interrupt,
+              before the Data IN/OUT stage callback is called.
+         (##) HAL_PCD_EP_StreamGet() retrieves the transferred buffers in order.
+         (##) HAL_PCD_EP_StreamStop() detaches the ring.
+
      (#)NOTE: For applications not using double buffer mode, define the symbol
                'USE_USB_DOUBLE_BUFFER' as 0 to reduce the driver's memory footprint.
 
@@ -99,6 +110,11 @@ static HAL_StatusTypeDef PCD_EP_OutSetupPacket_int(PCD_HandleTypeDef *hpcd, uint
 
 #if defined (USB_DRD_FS)
 static HAL_StatusTypeDef PCD_EP_ISR_Handler(PCD_HandleTypeDef *hpcd);
+static void PCD_EP_XferCplt(PCD_HandleTypeDef *hpcd, PCD_EPTypeDef const *ep);
+#if (USE_HAL_PCD_STATISTICS == 1U)
+static void PCD_EP_StatsPacket(PCD_HandleTypeDef *hpcd, PCD_EPTypeDef const *ep, uint32_t count);
+#endif /* USE_HAL_PCD_STATISTICS */
+static void PCD_EP_StreamNext(PCD_HandleTypeDef *hpcd, uint8_t ep_addr, PCD_EPStreamTypeDef *pStream);
 #if (USE_USB_DOUBLE_BUFFER == 1U)
 static HAL_StatusTypeDef HAL_PCD_EP_DB_Transmit(PCD_HandleTypeDef *hpcd, PCD_EPTypeDef *ep, uint16_t wEPVal);
 static uint16_t HAL_PCD_EP_DB_Receive(PCD_HandleTypeDef *hpcd, PCD_EPTypeDef *ep, uint16_t wEPVal);
@@ -239,6 +255,16 @@ HAL_StatusTypeDef HAL_PCD_Init(PCD_HandleTypeDef *hpcd)
     hpcd->OUT_ep[i].xfer_len = 0U;
   }
 
+#if defined (USB_DRD_FS)
+  for (i = 0U; i < 8U; i++)
+  {
+    hpcd->pINStream[i] = NULL;
+    hpcd->pOUTStream[i] = NULL;
+  }
+
+  hpcd->PMAFreeAddr = (uint16_t)PMA_START_ADDR;
+#endif /* defined (USB_DRD_FS) */
+
   /* Init Device */
   if (USB_DevInit(hpcd->Instance, hpcd->Init) != HAL_OK)
   {
@@ -1465,13 +1491,30 @@ void HAL_PCD_IRQHandler(PCD_HandleTypeDef *hpcd)
 void HAL_PCD_IRQHandler(PCD_HandleTypeDef *hpcd)
 {
   uint32_t wIstr = USB_ReadInterrupts(hpcd->Instance);
+#if (USE_HAL_PCD_STATISTICS == 1U)
+  uint32_t isr_timestamp;
+  uint32_t cycles;
+#endif /* USE_HAL_PCD_STATISTICS */
 
   if ((wIstr & USB_ISTR_CTR) == USB_ISTR_CTR)
   {
+#if (USE_HAL_PCD_STATISTICS == 1U)
+    isr_timestamp = DWT->CYCCNT;
+#endif /* USE_HAL_PCD_STATISTICS */
+
     /* servicing of the endpoint correct transfer interrupt */
     /* clear of the CTR flag into the sub */
     (void)PCD_EP_ISR_Handler(hpcd);
 
+#if (USE_HAL_PCD_STATISTICS == 1U)
+    /* Update the maximum endpoint interrupt service duration */
+    cycles = DWT->CYCCNT - isr_timestamp;
+    if (cycles > hpcd->Stats.EPISRCyclesMax)
+    {
+      hpcd->Stats.EPISRCyclesMax = cycles;
+    }
+#endif /* USE_HAL_PCD_STATISTICS */
+
     return;
   }
 
@@ -1494,6 +1537,10 @@ void HAL_PCD_IRQHandler(PCD_HandleTypeDef *hpcd)
   {
     __HAL_PCD_CLEAR_FLAG(hpcd, USB_ISTR_PMAOVR);
 
+#if (USE_HAL_PCD_STATISTICS == 1U)
+    hpcd->Stats.PMAOverrunCount++;
+#endif /* USE_HAL_PCD_STATISTICS */
+
     return;
   }
 
@@ -1501,6 +1548,10 @@ void HAL_PCD_IRQHandler(PCD_HandleTypeDef *hpcd)
   {
     __HAL_PCD_CLEAR_FLAG(hpcd, USB_ISTR_ERR);
 
+#if (USE_HAL_PCD_STATISTICS == 1U)
+    hpcd->Stats.ErrorCount++;
+#endif /* USE_HAL_PCD_STATISTICS */
+
     return;
   }
 
@@ -1600,6 +1651,10 @@ void HAL_PCD_IRQHandler(PCD_HandleTypeDef *hpcd)
     /* clear ESOF flag in ISTR */
     __HAL_PCD_CLEAR_FLAG(hpcd, USB_ISTR_ESOF);
 
+#if (USE_HAL_PCD_STATISTICS == 1U)
+    hpcd->Stats.MissedSOFCount++;
+#endif /* USE_HAL_PCD_STATISTICS */
+
     return;
   }
 }
@@ -2028,6 +2083,194 @@ HAL_StatusTypeDef HAL_PCD_EP_Transmit(PCD_HandleTypeDef *hpcd, uint8_t ep_addr,
   return HAL_OK;
 }
 
+#if defined (USB_DRD_FS)
+/**
+  * @brief  Attach a ring of buffers to an opened bulk endpoint.
+  * @note   Buffers queued with HAL_PCD_EP_StreamQueue() are transferred back to back:
+  *         the next one is started from the transfer complete interrupt, before the
+  *         Data IN/OUT stage callback is called.
+  * @param  hpcd PCD handle
+  * @param  ep_addr endpoint address
+  * @param  pStream stream structure, provided by the user
+  * @param  pBuffers array of BufferCount buffer descriptors, provided by the user
+  * @param  BufferCount number of buffers that can be queued at a time
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_PCD_EP_StreamStart(PCD_HandleTypeDef *hpcd, uint8_t ep_addr, PCD_EPStreamTypeDef *pStream,
+                                         PCD_EPStreamBufferTypeDef *pBuffers, uint32_t BufferCount)
+{
+  PCD_EPStreamTypeDef **pp_stream;
+
+  if ((pStream == NULL) || (pBuffers == NULL) || (BufferCount == 0U) || ((ep_addr & EP_ADDR_MSK) >= 8U))
+  {
+    return HAL_ERROR;
+  }
+
+  if ((ep_addr & 0x80U) == 0x80U)
+  {
+    pp_stream = &hpcd->pINStream[ep_addr & EP_ADDR_MSK];
+  }
+  else
+  {
+    pp_stream = &hpcd->pOUTStream[ep_addr & EP_ADDR_MSK];
+  }
+
+  if (*pp_stream != NULL)
+  {
+    return HAL_BUSY;
+  }
+
+  pStream->pBuffers = pBuffers;
+  pStream->BufferCount = BufferCount;
+  pStream->Head = 0U;
+  pStream->Done = 0U;
+  pStream->Tail = 0U;
+  pStream->Busy = 0U;
+
+  *pp_stream = pStream;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Queue a buffer on an endpoint stream.
+  * @note   The transfer is started at once when the endpoint is idle.
+  * @param  hpcd PCD handle
+  * @param  ep_addr endpoint address
+  * @param  pBuf pointer to the buffer to transmit or to receive into
+  * @param  len amount of data to transmit, or size of the reception buffer
+  * @retval HAL status, HAL_BUSY when all buffers of the ring are in use
+  */
+HAL_StatusTypeDef HAL_PCD_EP_StreamQueue(PCD_HandleTypeDef *hpcd, uint8_t ep_addr, uint8_t *pBuf, uint32_t len)
+{
+  PCD_EPStreamTypeDef *p_stream;
+  PCD_EPStreamBufferTypeDef *p_buffer;
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t primask_bit;
+
+  if ((ep_addr & EP_ADDR_MSK) >= 8U)
+  {
+    return HAL_ERROR;
+  }
+
+  if ((ep_addr & 0x80U) == 0x80U)
+  {
+    p_stream = hpcd->pINStream[ep_addr & EP_ADDR_MSK];
+  }
+  else
+  {
+    p_stream = hpcd->pOUTStream[ep_addr & EP_ADDR_MSK];
+  }
+
+  if (p_stream == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Enter critical section: the transfer complete interrupt updates the stream */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  if ((p_stream->Head - p_stream->Tail) >= p_stream->BufferCount)
+  {
+    status = HAL_BUSY;
+  }
+  else
+  {
+    p_buffer = &p_stream->pBuffers[p_stream->Head % p_stream->BufferCount];
+    p_buffer->pBuffer = pBuf;
+    p_buffer->Length = len;
+    p_buffer->XferCount = 0U;
+    p_stream->Head++;
+
+    if (p_stream->Busy == 0U)
+    {
+      PCD_EP_StreamNext(hpcd, ep_addr, p_stream);
+    }
+  }
+
+  /* Exit critical section: restore previous priority mask */
+  __set_PRIMASK(primask_bit);
+
+  return status;
+}
+
+/**
+  * @brief  Retrieve the oldest transferred buffer of an endpoint stream.
+  * @param  hpcd PCD handle
+  * @param  ep_addr endpoint address
+  * @param  ppBuf pointer filled with the buffer address
+  * @param  pLen pointer filled with the number of bytes transferred
+  * @retval HAL status, HAL_ERROR when no transfer is completed
+  */
+HAL_StatusTypeDef HAL_PCD_EP_StreamGet(PCD_HandleTypeDef *hpcd, uint8_t ep_addr, uint8_t **ppBuf, uint32_t *pLen)
+{
+  PCD_EPStreamTypeDef *p_stream;
+  const PCD_EPStreamBufferTypeDef *p_buffer;
+
+  if ((ppBuf == NULL) || (pLen == NULL) || ((ep_addr & EP_ADDR_MSK) >= 8U))
+  {
+    return HAL_ERROR;
+  }
+
+  if ((ep_addr & 0x80U) == 0x80U)
+  {
+    p_stream = hpcd->pINStream[ep_addr & EP_ADDR_MSK];
+  }
+  else
+  {
+    p_stream = hpcd->pOUTStream[ep_addr & EP_ADDR_MSK];
+  }
+
+  if ((p_stream == NULL) || (p_stream->Tail == p_stream->Done))
+  {
+    return HAL_ERROR;
+  }
+
+  p_buffer = &p_stream->pBuffers[p_stream->Tail % p_stream->BufferCount];
+  *ppBuf = p_buffer->pBuffer;
+  *pLen = p_buffer->XferCount;
+
+  /* Release the buffer descriptor */
+  p_stream->Tail++;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Detach the ring of buffers from an endpoint.
+  * @note   A transfer already started is not aborted, use HAL_PCD_EP_Abort() for that.
+  * @param  hpcd PCD handle
+  * @param  ep_addr endpoint address
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_PCD_EP_StreamStop(PCD_HandleTypeDef *hpcd, uint8_t ep_addr)
+{
+  uint32_t primask_bit;
+
+  if ((ep_addr & EP_ADDR_MSK) >= 8U)
+  {
+    return HAL_ERROR;
+  }
+
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  if ((ep_addr & 0x80U) == 0x80U)
+  {
+    hpcd->pINStream[ep_addr & EP_ADDR_MSK] = NULL;
+  }
+  else
+  {
+    hpcd->pOUTStream[ep_addr & EP_ADDR_MSK] = NULL;
+  }
+
+  __set_PRIMASK(primask_bit);
+
+  return HAL_OK;
+}
+#endif /* defined (USB_DRD_FS) */
+
 /**
   * @brief  Set a STALL condition over an endpoint
   * @param  hpcd PCD handle
@@ -2656,8 +2899,15 @@ static HAL_StatusTypeDef PCD_EP_ISR_Handler(PCD_HandleTypeDef *hpcd)
         /* multi-packet on the NON control OUT endpoint */
         ep->xfer_count += count;
 
+#if (USE_HAL_PCD_STATISTICS == 1U)
+        PCD_EP_StatsPacket(hpcd, ep, count);
+#endif /* USE_HAL_PCD_STATISTICS */
+
         if ((ep->xfer_len == 0U) || (count < ep->maxpacket))
         {
+          /* End of transfer: statistics and endpoint stream */
+          PCD_EP_XferCplt(hpcd, ep);
+
           /* RX COMPLETE */
 #if (USE_HAL_PCD_REGISTER_CALLBACKS == 1U)
           hpcd->DataOutStageCallback(hpcd, ep->num);
@@ -2681,6 +2931,11 @@ static HAL_StatusTypeDef PCD_EP_ISR_Handler(PCD_HandleTypeDef *hpcd)
 
         if (ep->type == EP_TYPE_ISOC)
         {
+#if (USE_HAL_PCD_STATISTICS == 1U)
+          PCD_EP_StatsPacket(hpcd, ep, ep->xfer_len);
+          hpcd->INStats[ep->num].XferCount++;
+#endif /* USE_HAL_PCD_STATISTICS */
+
           ep->xfer_len = 0U;
 
 #if (USE_USB_DOUBLE_BUFFER == 1U)
@@ -2712,6 +2967,10 @@ static HAL_StatusTypeDef PCD_EP_ISR_Handler(PCD_HandleTypeDef *hpcd)
             /* Multi-packet on the NON control IN endpoint */
             TxPctSize = (uint16_t)PCD_GET_EP_TX_CNT(hpcd->Instance, ep->num);
 
+#if (USE_HAL_PCD_STATISTICS == 1U)
+            PCD_EP_StatsPacket(hpcd, ep, TxPctSize);
+#endif /* USE_HAL_PCD_STATISTICS */
+
             if (ep->xfer_len > TxPctSize)
             {
               ep->xfer_len -= TxPctSize;
@@ -2724,6 +2983,9 @@ static HAL_StatusTypeDef PCD_EP_ISR_Handler(PCD_HandleTypeDef *hpcd)
             /* Zero Length Packet? */
             if (ep->xfer_len == 0U)
             {
+              /* End of transfer: statistics and endpoint stream */
+              PCD_EP_XferCplt(hpcd, ep);
+
               /* TX COMPLETE */
 #if (USE_HAL_PCD_REGISTER_CALLBACKS == 1U)
               hpcd->DataInStageCallback(hpcd, ep->num);
@@ -2856,6 +3118,10 @@ static HAL_StatusTypeDef HAL_PCD_EP_DB_Transmit(PCD_HandleTypeDef *hpcd,
     /* multi-packet on the NON control IN endpoint */
     TxPctSize = (uint16_t)PCD_GET_EP_DBUF0_CNT(hpcd->Instance, ep->num);
 
+#if (USE_HAL_PCD_STATISTICS == 1U)
+    PCD_EP_StatsPacket(hpcd, ep, TxPctSize);
+#endif /* USE_HAL_PCD_STATISTICS */
+
     if (ep->xfer_len > TxPctSize)
     {
       ep->xfer_len -= TxPctSize;
@@ -2877,6 +3143,9 @@ static HAL_StatusTypeDef HAL_PCD_EP_DB_Transmit(PCD_HandleTypeDef *hpcd,
         PCD_SET_EP_TX_STATUS(hpcd->Instance, ep->num, USB_EP_TX_NAK);
       }
 
+      /* End of transfer: statistics and endpoint stream */
+      PCD_EP_XferCplt(hpcd, ep);
+
       /* TX COMPLETE */
 #if (USE_HAL_PCD_REGISTER_CALLBACKS == 1U)
       hpcd->DataInStageCallback(hpcd, ep->num);
@@ -2937,6 +3206,10 @@ static HAL_StatusTypeDef HAL_PCD_EP_DB_Transmit(PCD_HandleTypeDef *hpcd,
     /* multi-packet on the NON control IN endpoint */
     TxPctSize = (uint16_t)PCD_GET_EP_DBUF1_CNT(hpcd->Instance, ep->num);
 
+#if (USE_HAL_PCD_STATISTICS == 1U)
+    PCD_EP_StatsPacket(hpcd, ep, TxPctSize);
+#endif /* USE_HAL_PCD_STATISTICS */
+
     if (ep->xfer_len >= TxPctSize)
     {
       ep->xfer_len -= TxPctSize;
@@ -2958,6 +3231,9 @@ static HAL_StatusTypeDef HAL_PCD_EP_DB_Transmit(PCD_HandleTypeDef *hpcd,
         PCD_SET_EP_TX_STATUS(hpcd->Instance, ep->num, USB_EP_TX_NAK);
       }
 
+      /* End of transfer: statistics and endpoint stream */
+      PCD_EP_XferCplt(hpcd, ep);
+
       /* TX COMPLETE */
 #if (USE_HAL_PCD_REGISTER_CALLBACKS == 1U)
       hpcd->DataInStageCallback(hpcd, ep->num);
@@ -3020,6 +3296,113 @@ static HAL_StatusTypeDef HAL_PCD_EP_DB_Transmit(PCD_HandleTypeDef *hpcd,
   return HAL_OK;
 }
 #endif /* (USE_USB_DOUBLE_BUFFER == 1U) */
+
+/**
+  * @brief  End of transfer processing of a non control endpoint: update the
+  *         statistics, record the end of the ongoing transfer of the endpoint
+  *         stream and start the next queued buffer.
+  * @param  hpcd PCD handle
+  * @param  ep endpoint whose transfer is completed
+  * @retval None
+  */
+static void PCD_EP_XferCplt(PCD_HandleTypeDef *hpcd, PCD_EPTypeDef const *ep)
+{
+  PCD_EPStreamTypeDef *p_stream;
+  PCD_EPStreamBufferTypeDef *p_buffer;
+  uint8_t ep_addr;
+
+  if (ep->num >= 8U)
+  {
+    return;
+  }
+
+#if (USE_HAL_PCD_STATISTICS == 1U)
+  if (ep->is_in == 1U)
+  {
+    hpcd->INStats[ep->num].XferCount++;
+  }
+  else
+  {
+    hpcd->OUTStats[ep->num].XferCount++;
+  }
+#endif /* USE_HAL_PCD_STATISTICS */
+
+  if (ep->is_in == 1U)
+  {
+    p_stream = hpcd->pINStream[ep->num];
+    ep_addr = ep->num | 0x80U;
+  }
+  else
+  {
+    p_stream = hpcd->pOUTStream[ep->num];
+    ep_addr = ep->num;
+  }
+
+  if ((p_stream == NULL) || (p_stream->Busy == 0U))
+  {
+    return;
+  }
+
+  p_buffer = &p_stream->pBuffers[p_stream->Done % p_stream->BufferCount];
+  p_buffer->XferCount = (ep->is_in == 1U) ? p_buffer->Length : ep->xfer_count;
+
+  p_stream->Done++;
+  p_stream->Busy = 0U;
+
+  PCD_EP_StreamNext(hpcd, ep_addr, p_stream);
+}
+
+#if (USE_HAL_PCD_STATISTICS == 1U)
+/**
+  * @brief  Count a packet transferred on a non control endpoint.
+  * @param  hpcd PCD handle
+  * @param  ep endpoint
+  * @param  count packet size in bytes
+  * @retval None
+  */
+static void PCD_EP_StatsPacket(PCD_HandleTypeDef *hpcd, PCD_EPTypeDef const *ep, uint32_t count)
+{
+  PCD_EPStatsTypeDef *p_stats;
+
+  if (ep->num >= 8U)
+  {
+    return;
+  }
+
+  p_stats = (ep->is_in == 1U) ? &hpcd->INStats[ep->num] : &hpcd->OUTStats[ep->num];
+  p_stats->PacketCount++;
+  p_stats->XferBytes += count;
+}
+#endif /* USE_HAL_PCD_STATISTICS */
+
+/**
+  * @brief  Start the transfer of the next queued buffer of an endpoint stream.
+  * @param  hpcd PCD handle
+  * @param  ep_addr endpoint address
+  * @param  pStream endpoint stream
+  * @retval None
+  */
+static void PCD_EP_StreamNext(PCD_HandleTypeDef *hpcd, uint8_t ep_addr, PCD_EPStreamTypeDef *pStream)
+{
+  const PCD_EPStreamBufferTypeDef *p_buffer;
+
+  if (pStream->Done == pStream->Head)
+  {
+    return;
+  }
+
+  p_buffer = &pStream->pBuffers[pStream->Done % pStream->BufferCount];
+  pStream->Busy = 1U;
+
+  if ((ep_addr & 0x80U) == 0x80U)
+  {
+    (void)HAL_PCD_EP_Transmit(hpcd, ep_addr, p_buffer->pBuffer, p_buffer->Length);
+  }
+  else
+  {
+    (void)HAL_PCD_EP_Receive(hpcd, ep_addr, p_buffer->pBuffer, p_buffer->Length);
+  }
+}
 #endif /* defined (USB_DRD_FS) */
 
 /**
@@ -55,6 +55,24 @@
  ===============================================================================
     [..]  This section provides functions allowing to:
       (+) Update FIFO configuration
+      (+) Allocate the packet memory (PMA) of the endpoints (USB DRD FS):
+          (++) HAL_PCDEx_PMAlloc() assigns the next free PMA slots of an endpoint,
+               two of them for a double buffered endpoint, instead of computing
+               the addresses given to HAL_PCDEx_PMAConfig().
+          (++) Double buffered bulk endpoints allocated this way keep one buffer
+               transferring on the bus while the other one is copied, which
+               combines with HAL_PCD_EP_StreamStart() for bulk streaming.
+          (++) HAL_PCDEx_PMAReset() releases all the slots, typically from the
+               USB reset callback before the endpoints are allocated again.
+      (+) Get the endpoint statistics when USE_HAL_PCD_STATISTICS is set in
+          stm32h5xx_hal_conf.h (USB DRD FS):
+          (++) HAL_PCDEx_ResetStats() clears the statistics and enables the DWT
+               cycle counter.
+          (++) HAL_PCDEx_GetEPStats() gets the transfers, packets and bytes of an endpoint.
+          (++) HAL_PCDEx_GetStats() gets the bus error, PMA overrun and missed SOF counts
+               and the maximum endpoint interrupt service duration.
+          (++) The device never interrupts on NAK handshakes nor on incomplete
+               isochronous transfers, they are not counted.
 
 @endverbatim
   * @{
@@ -415,6 +433,174 @@ HAL_StatusTypeDef  HAL_PCDEx_PMAConfig(PCD_HandleTypeDef *hpcd, uint16_t ep_addr
   return HAL_OK;
 }
 
+/**
+  * @brief  Allocate PMA for EP from the next free packet memory address
+  * @param  hpcd  Device instance
+  * @param  ep_addr endpoint address
+  * @param  ep_kind endpoint Kind
+  *                  PCD_SNG_BUF: Single Buffer used
+  *                  PCD_DBL_BUF: Double Buffer used
+  * @param  mps endpoint max packet size, in bytes
+  * @note   Each buffer is rounded up to the 32-bit PMA access size, and OUT
+  *         buffers larger than 62 bytes to the 32-byte reception block size.
+  * @retval HAL status, HAL_ERROR when the PMA is exhausted
+  */
+HAL_StatusTypeDef  HAL_PCDEx_PMAlloc(PCD_HandleTypeDef *hpcd, uint16_t ep_addr,
+                                     uint16_t ep_kind, uint16_t mps)
+{
+  uint32_t size;
+  uint32_t addr0;
+  uint32_t addr1;
+  uint32_t end;
+
+  /* Size of one buffer in PMA */
+  size = ((uint32_t)mps + 3U) & ~0x3U;
+
+  if (((0x80U & ep_addr) == 0U) && (size > 62U))
+  {
+    size = (size + 31U) & ~0x1FU;
+  }
+
+  if ((size == 0U) || ((ep_kind != PCD_SNG_BUF) && (ep_kind != PCD_DBL_BUF)))
+  {
+    return HAL_ERROR;
+  }
+
+#if (USE_USB_DOUBLE_BUFFER != 1U)
+  if (ep_kind == PCD_DBL_BUF)
+  {
+    return HAL_ERROR;
+  }
+#endif /* (USE_USB_DOUBLE_BUFFER != 1U) */
+
+  addr0 = hpcd->PMAFreeAddr;
+  addr1 = addr0 + size;
+  end = (ep_kind == PCD_DBL_BUF) ? (addr1 + size) : addr1;
+
+  if (end > PMA_END_ADDR)
+  {
+    return HAL_ERROR;
+  }
+
+  hpcd->PMAFreeAddr = (uint16_t)end;
+
+  if (ep_kind == PCD_DBL_BUF)
+  {
+    return HAL_PCDEx_PMAConfig(hpcd, ep_addr, PCD_DBL_BUF, addr0 | (addr1 << 16));
+  }
+
+  return HAL_PCDEx_PMAConfig(hpcd, ep_addr, PCD_SNG_BUF, addr0);
+}
+
+/**
+  * @brief  Release all the PMA allocated by HAL_PCDEx_PMAlloc
+  * @param  hpcd  Device instance
+  * @retval HAL status
+  */
+HAL_StatusTypeDef  HAL_PCDEx_PMAReset(PCD_HandleTypeDef *hpcd)
+{
+  hpcd->PMAFreeAddr = (uint16_t)PMA_START_ADDR;
+
+  return HAL_OK;
+}
+
+#if (USE_HAL_PCD_STATISTICS == 1U)
+/**
+  * @brief  Get the statistics of an endpoint
+  * @param  hpcd  Device instance
+  * @param  ep_addr endpoint address
+  * @param  pStats pointer to the structure to be filled
+  * @retval HAL status
+  */
+HAL_StatusTypeDef  HAL_PCDEx_GetEPStats(PCD_HandleTypeDef const *hpcd, uint8_t ep_addr, PCD_EPStatsTypeDef *pStats)
+{
+  uint32_t primask_bit;
+
+  if (pStats == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Get a consistent copy of the statistics updated under interrupt */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  if ((0x80U & ep_addr) == 0x80U)
+  {
+    *pStats = hpcd->INStats[ep_addr & EP_ADDR_MSK];
+  }
+  else
+  {
+    *pStats = hpcd->OUTStats[ep_addr & EP_ADDR_MSK];
+  }
+
+  __set_PRIMASK(primask_bit);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Get the device statistics
+  * @param  hpcd  Device instance
+  * @param  pStats pointer to the structure to be filled
+  * @retval HAL status
+  */
+HAL_StatusTypeDef  HAL_PCDEx_GetStats(PCD_HandleTypeDef const *hpcd, PCD_StatsTypeDef *pStats)
+{
+  uint32_t primask_bit;
+
+  if (pStats == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  *pStats = hpcd->Stats;
+
+  __set_PRIMASK(primask_bit);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Reset the device and endpoints statistics
+  * @param  hpcd  Device instance
+  * @retval HAL status
+  */
+HAL_StatusTypeDef  HAL_PCDEx_ResetStats(PCD_HandleTypeDef *hpcd)
+{
+  uint32_t primask_bit;
+  uint8_t i;
+
+  /* Enable the DWT cycle counter used for time measurement */
+  HAL_CycleCounter_Enable();
+
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  for (i = 0U; i < 8U; i++)
+  {
+    hpcd->INStats[i].XferCount = 0U;
+    hpcd->INStats[i].XferBytes = 0U;
+    hpcd->INStats[i].PacketCount = 0U;
+    hpcd->OUTStats[i].XferCount = 0U;
+    hpcd->OUTStats[i].XferBytes = 0U;
+    hpcd->OUTStats[i].PacketCount = 0U;
+  }
+
+  hpcd->Stats.PMAOverrunCount = 0U;
+  hpcd->Stats.ErrorCount = 0U;
+  hpcd->Stats.MissedSOFCount = 0U;
+  hpcd->Stats.EPISRCyclesMax = 0U;
+
+  __set_PRIMASK(primask_bit);
+
+  return HAL_OK;
+}
+#endif /* USE_HAL_PCD_STATISTICS */
+
 /**
   * @brief  Activate BatteryCharging feature.
   * @param  hpcd PCD handle
@@ -70,6 +70,10 @@
       (++) HAL_PKA_RSACRTExp().
       (++) HAL_PKA_RSACRTExp_IT().
       (++) HAL_PKA_RSACRTExp_GetResult() to retrieve the result of the operation.
+      (++) HAL_PKA_RSACRTExp_Submit_IT() to queue an exponentiation in interrupt mode. The request is started
+           as soon as the PKA is free and the following ones are chained from the PKA interrupt. The result
+           is copied to pRes, Status is updated and the CpltCallback of the request is called on completion.
+           The request must stay valid until then.
 
       (+) ECC Point Check using:
       (++) HAL_PKA_PointCheck().
@@ -85,6 +89,16 @@
       (++) HAL_PKA_ECDSAVerif().
       (++) HAL_PKA_ECDSAVerif_IT().
       (++) HAL_PKA_ECDSAVerif_IsValidSignature() to retrieve the result of the operation.
+      (++) HAL_PKA_ECDSAVerif_LoadCurve() to load the curve parameters once in PKA RAM, then
+           HAL_PKA_ECDSAVerifCtx() or HAL_PKA_ECDSAVerifCtx_IT() only write the public key, the
+           signature and the hash of each verification. The loaded curve is kept as long as only
+           ECDSA verifications on this curve are run. The public key stays loaded as well: it is
+           only written when its address differs from the one of the previous verification, so
+           verifications against a few fixed keys are best grouped by key. A loaded key must not
+           be modified in place.
+      (++) HAL_PKA_ECDSAVerifBatch_IT() to chain several verifications on the loaded curve in
+           interrupt mode, HAL_PKA_OperationCpltCallback() is called at the end of the batch and
+           the result of each verification is stored in its ValidSignature field.
 
       (+) ECC Scalar Multiplication using:
       (++) HAL_PKA_ECCMul().
@@ -168,6 +182,15 @@
       (++) HAL_PKA_MontgomeryParam().
       (++) HAL_PKA_MontgomeryParam_IT().
       (++) HAL_PKA_MontgomeryParam_GetResult() to retrieve the result of the operation.
+      (+) A cache of Montgomery parameters can be managed by the driver for a fixed set of moduli
+          (e.g. RSA verification with a few CA keys):
+      (++) HAL_PKA_MontgomeryCache_Config() to provide the cache entries and their buffers.
+      (++) HAL_PKA_MontgomeryCache_Get() to get the Montgomery parameter of a modulus, computed
+           only when the modulus is not cached yet.
+      (++) HAL_PKA_ModExpFastModeCached() to run a fast mode modular exponentiation using the cache.
+      (++) HAL_PKA_MontgomeryCache_Invalidate() to drop one cached modulus or the whole cache.
+      (++) Cached moduli are referenced, not copied: they must remain available and unchanged
+           until they are invalidated.
 
     *** Polling mode operation ***
     ===================================
@@ -313,7 +336,11 @@ void PKA_ModExpProtectMode_Set(PKA_HandleTypeDef *hpka, PKA_ModExpProtectModeInT
 void PKA_ECCMulEx_Set(PKA_HandleTypeDef *hpka, PKA_ECCMulExInTypeDef *in);
 void PKA_ECDSASign_Set(PKA_HandleTypeDef *hpka, PKA_ECDSASignInTypeDef *in);
 void PKA_ECDSAVerif_Set(PKA_HandleTypeDef *hpka, PKA_ECDSAVerifInTypeDef *in);
+void PKA_ECDSAVerifCurve_Set(PKA_HandleTypeDef *hpka, const PKA_ECDSAVerifCurveTypeDef *curve);
+void PKA_ECDSAVerifOperand_Set(PKA_HandleTypeDef *hpka, const PKA_ECDSAVerifOperandTypeDef *in);
 void PKA_RSACRTExp_Set(PKA_HandleTypeDef *hpka, PKA_RSACRTExpInTypeDef *in);
+HAL_StatusTypeDef PKA_RSACRTQueue_Start(PKA_HandleTypeDef *hpka);
+void PKA_RSACRTQueue_Complete(PKA_HandleTypeDef *hpka);
 void PKA_PointCheck_Set(PKA_HandleTypeDef *hpka, PKA_PointCheckInTypeDef *in);
 void PKA_ECCMul_Set(PKA_HandleTypeDef *hpka, PKA_ECCMulInTypeDef *in);
 void PKA_ModRed_Set(PKA_HandleTypeDef *hpka, PKA_ModRedInTypeDef *in);
@@ -327,6 +354,9 @@ void PKA_ECCCompleteAddition_Set(PKA_HandleTypeDef *hpka, PKA_ECCCompleteAdditio
 HAL_StatusTypeDef PKA_WaitOnFlagUntilTimeout(PKA_HandleTypeDef *hpka, uint32_t Flag, FlagStatus Status,
                                              uint32_t Tickstart, uint32_t Timeout);
 uint32_t PKA_Result_GetSize(const PKA_HandleTypeDef *hpka, uint32_t Startindex, uint32_t Maxsize);
+uint32_t PKA_MontgomeryCache_Key(const uint8_t *pMod, uint32_t modSize);
+PKA_MontgomeryCacheEntryTypeDef *PKA_MontgomeryCache_Lookup(const PKA_HandleTypeDef *hpka, const uint8_t *pMod,
+                                                            uint32_t modSize, uint32_t key);
 #if (defined(RNG_HTSR0_RPERRX) || defined(RNG_HTSR1_ADERRX))
 HAL_StatusTypeDef PKA_RNG_ResilientRecoverSeedError(void);
 #endif /* RNG_HTSR0_RPERRX || RNG_HTSR1_ADERRX */
@@ -446,6 +476,21 @@ HAL_StatusTypeDef HAL_PKA_Init(PKA_HandleTypeDef *hpka)
     /* Initialize the error code */
     hpka->ErrorCode = HAL_PKA_ERROR_NONE;
 
+    /* No curve parameters loaded and no batch ongoing */
+    hpka->pECDSAVerifCurve = NULL;
+    hpka->pECDSAVerifPubKeyX = NULL;
+    hpka->pECDSAVerifPubKeyY = NULL;
+    hpka->pECDSAVerifBatch = NULL;
+
+    /* No RSA CRT exponentiation queued */
+    hpka->pRSACRTQueueHead = NULL;
+    hpka->pRSACRTQueueTail = NULL;
+    hpka->RSACRTQueueActive = 0U;
+
+    /* No Montgomery parameter cache */
+    hpka->pMontgomeryCache = NULL;
+    hpka->MontgomeryCacheSize = 0U;
+
     /* Set the state to ready */
     hpka->State = HAL_PKA_STATE_READY;
   }
@@ -844,6 +889,7 @@ HAL_StatusTypeDef HAL_PKA_UnRegisterCallback(PKA_HandleTypeDef *hpka, HAL_PKA_Ca
 
         (++) HAL_PKA_RSACRTExp_IT();
         (++) HAL_PKA_RSACRTExp_GetResult();
+        (++) HAL_PKA_RSACRTExp_Submit_IT();
 
         (++) HAL_PKA_PointCheck_IT();
         (++) HAL_PKA_PointCheck_IsOnCurve();
@@ -1094,6 +1140,107 @@ uint32_t HAL_PKA_ECDSAVerif_IsValidSignature(PKA_HandleTypeDef const *const hpka
   return (hpka->Instance->RAM[PKA_ECDSA_VERIF_OUT_RESULT] == 0xD60DU) ? 1UL : 0UL;
 }
 
+/**
+  * @brief  Load the curve parameters of the next ECDSA verifications in PKA RAM.
+  * @param  hpka PKA handle
+  * @param  curve Curve parameters, must remain available as long as the curve is used
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_PKA_ECDSAVerif_LoadCurve(PKA_HandleTypeDef *hpka, const PKA_ECDSAVerifCurveTypeDef *curve)
+{
+  if ((curve == NULL) || (hpka->State != HAL_PKA_STATE_READY))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Set curve parameters in PKA RAM */
+  PKA_ECDSAVerifCurve_Set(hpka, curve);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Verify the validity of a signature on the loaded curve in blocking mode.
+  * @param  hpka PKA handle
+  * @param  in Public key, signature and hash
+  * @param  Timeout Timeout duration
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_PKA_ECDSAVerifCtx(PKA_HandleTypeDef *hpka, const PKA_ECDSAVerifOperandTypeDef *in,
+                                        uint32_t Timeout)
+{
+  if ((in == NULL) || (hpka->pECDSAVerifCurve == NULL) || (hpka->State != HAL_PKA_STATE_READY))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Set per-verification input parameters in PKA RAM */
+  PKA_ECDSAVerifOperand_Set(hpka, in);
+
+  /* Start the operation */
+  return PKA_Process(hpka, PKA_MODE_ECDSA_VERIFICATION, Timeout);
+}
+
+/**
+  * @brief  Verify the validity of a signature on the loaded curve in non-blocking mode with Interrupt.
+  * @param  hpka PKA handle
+  * @param  in Public key, signature and hash
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_PKA_ECDSAVerifCtx_IT(PKA_HandleTypeDef *hpka, const PKA_ECDSAVerifOperandTypeDef *in)
+{
+  if ((in == NULL) || (hpka->pECDSAVerifCurve == NULL) || (hpka->State != HAL_PKA_STATE_READY))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Set per-verification input parameters in PKA RAM */
+  PKA_ECDSAVerifOperand_Set(hpka, in);
+
+  /* Start the operation */
+  return PKA_Process_IT(hpka, PKA_MODE_ECDSA_VERIFICATION);
+}
+
+/**
+  * @brief  Verify the validity of several signatures on the loaded curve in non-blocking mode with Interrupt.
+  * @note   The verifications are chained by HAL_PKA_IRQHandler(), HAL_PKA_OperationCpltCallback()
+  *         is called once all of them are processed. The batch is stopped on error.
+  * @param  hpka PKA handle
+  * @param  in Array of public keys, signatures and hashes, the results are stored in ValidSignature
+  * @param  Nbr Number of verifications
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_PKA_ECDSAVerifBatch_IT(PKA_HandleTypeDef *hpka, PKA_ECDSAVerifOperandTypeDef *in,
+                                             uint32_t Nbr)
+{
+  HAL_StatusTypeDef err;
+  uint32_t index;
+
+  if ((in == NULL) || (Nbr == 0U) || (hpka->pECDSAVerifCurve == NULL) || (hpka->State != HAL_PKA_STATE_READY))
+  {
+    return HAL_ERROR;
+  }
+
+  for (index = 0U; index < Nbr; index++)
+  {
+    in[index].ValidSignature = 0U;
+  }
+  hpka->pECDSAVerifBatch = in;
+  hpka->ECDSAVerifBatchNbr = Nbr;
+  hpka->ECDSAVerifBatchIndex = 0U;
+
+  /* Set the input parameters of the first verification in PKA RAM */
+  PKA_ECDSAVerifOperand_Set(hpka, &in[0]);
+
+  /* Start the operation */
+  err = PKA_Process_IT(hpka, PKA_MODE_ECDSA_VERIFICATION);
+  if (err != HAL_OK)
+  {
+    hpka->pECDSAVerifBatch = NULL;
+  }
+  return err;
+}
+
 /**
   * @brief  RSA CRT exponentiation in blocking mode.
   * @param  hpka PKA handle
@@ -1125,6 +1272,51 @@ HAL_StatusTypeDef HAL_PKA_RSACRTExp_IT(PKA_HandleTypeDef *hpka, PKA_RSACRTExpInT
   return PKA_Process_IT(hpka, PKA_MODE_RSA_CRT_EXP);
 }
 
+/**
+  * @brief  Queue an RSA CRT exponentiation in non-blocking mode with Interrupt.
+  * @note   The request is started immediately if the PKA is free, otherwise at the end of the ongoing
+  *         operation. Once complete, the result is copied to pReq->pRes, pReq->Status is set and
+  *         pReq->CpltCallback is called from the PKA interrupt, before the next request is started.
+  * @note   HAL_PKA_OperationCpltCallback() is not called for the queued requests.
+  * @note   Requests queued during a blocking mode operation are started by the next call to this function.
+  * @param  hpka PKA handle
+  * @param  pReq Request to queue, must stay valid until its completion
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_PKA_RSACRTExp_Submit_IT(PKA_HandleTypeDef *hpka, PKA_RSACRTExpRequestTypeDef *pReq)
+{
+  uint32_t primask_bit;
+
+  if ((pReq == NULL) || (pReq->pIn == NULL) || (pReq->pRes == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  pReq->Status = HAL_BUSY;
+  pReq->pNext = NULL;
+
+  /* The queue is also updated from the PKA interrupt */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  if (hpka->pRSACRTQueueHead == NULL)
+  {
+    hpka->pRSACRTQueueHead = pReq;
+  }
+  else
+  {
+    hpka->pRSACRTQueueTail->pNext = pReq;
+  }
+  hpka->pRSACRTQueueTail = pReq;
+
+  /* Start the request now if the PKA is free, otherwise at the end of the ongoing operation */
+  (void)PKA_RSACRTQueue_Start(hpka);
+
+  __set_PRIMASK(primask_bit);
+
+  return HAL_OK;
+}
+
 /**
   * @brief  Retrieve operation result.
   * @param  hpka PKA handle
@@ -1760,6 +1952,161 @@ void HAL_PKA_MontgomeryParam_GetResult(PKA_HandleTypeDef *hpka, uint32_t *pRes)
   PKA_Memcpy_u32_to_u32(pRes, &hpka->Instance->RAM[PKA_MONTGOMERY_PARAM_OUT_PARAMETER], size);
 }
 
+/**
+  * @brief  Configure the Montgomery parameter cache.
+  * @param  hpka PKA handle
+  * @param  pEntries Cache entries, the pMontgomeryParam and bufferSize fields must be set
+  * @param  Nbr Number of cache entries, 0 to disable the cache
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_PKA_MontgomeryCache_Config(PKA_HandleTypeDef *hpka, PKA_MontgomeryCacheEntryTypeDef *pEntries,
+                                                 uint32_t Nbr)
+{
+  uint32_t index;
+
+  if ((Nbr != 0U) && (pEntries == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  for (index = 0U; index < Nbr; index++)
+  {
+    if ((pEntries[index].pMontgomeryParam == NULL) || (pEntries[index].bufferSize == 0U))
+    {
+      return HAL_ERROR;
+    }
+    pEntries[index].valid = 0U;
+  }
+
+  hpka->pMontgomeryCache = (Nbr != 0U) ? pEntries : NULL;
+  hpka->MontgomeryCacheSize = Nbr;
+  hpka->MontgomeryCacheNext = 0U;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Invalidate a cached Montgomery parameter.
+  * @param  hpka PKA handle
+  * @param  pMod Pointer to the modulus to invalidate, NULL to invalidate the whole cache
+  * @param  modSize Number of element in pMod array
+  * @retval None
+  */
+void HAL_PKA_MontgomeryCache_Invalidate(PKA_HandleTypeDef *hpka, const uint8_t *pMod, uint32_t modSize)
+{
+  PKA_MontgomeryCacheEntryTypeDef *entry;
+  uint32_t index;
+
+  if (pMod == NULL)
+  {
+    for (index = 0U; index < hpka->MontgomeryCacheSize; index++)
+    {
+      hpka->pMontgomeryCache[index].valid = 0U;
+    }
+  }
+  else
+  {
+    entry = PKA_MontgomeryCache_Lookup(hpka, pMod, modSize, PKA_MontgomeryCache_Key(pMod, modSize));
+    if (entry != NULL)
+    {
+      entry->valid = 0U;
+    }
+  }
+}
+
+/**
+  * @brief  Get the Montgomery parameter of a modulus from the cache, computing it in blocking mode
+  *         if the modulus is not cached yet.
+  * @param  hpka PKA handle
+  * @param  pMod Pointer to the modulus (Array of modSize elements)
+  * @param  modSize Number of element in pMod array
+  * @param  ppMontgomeryParam Pointer filled with the address of the cached Montgomery parameter
+  * @param  Timeout Timeout duration of the Montgomery parameter computation
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_PKA_MontgomeryCache_Get(PKA_HandleTypeDef *hpka, const uint8_t *pMod, uint32_t modSize,
+                                              const uint32_t **ppMontgomeryParam, uint32_t Timeout)
+{
+  PKA_MontgomeryCacheEntryTypeDef *entry;
+  PKA_MontgomeryParamInTypeDef in;
+  uint32_t key;
+  uint32_t start;
+
+  if ((pMod == NULL) || (modSize == 0U) || (ppMontgomeryParam == NULL) || (hpka->pMontgomeryCache == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  key = PKA_MontgomeryCache_Key(pMod, modSize);
+  entry = PKA_MontgomeryCache_Lookup(hpka, pMod, modSize, key);
+
+  if (entry == NULL)
+  {
+    /* Select the next entry large enough for this modulus, in round robin */
+    start = hpka->MontgomeryCacheNext;
+    do
+    {
+      if (hpka->pMontgomeryCache[hpka->MontgomeryCacheNext].bufferSize >= ((modSize + 3UL) / 4UL))
+      {
+        entry = &hpka->pMontgomeryCache[hpka->MontgomeryCacheNext];
+      }
+      hpka->MontgomeryCacheNext = (hpka->MontgomeryCacheNext + 1U) % hpka->MontgomeryCacheSize;
+    } while ((entry == NULL) && (hpka->MontgomeryCacheNext != start));
+
+    if (entry == NULL)
+    {
+      return HAL_ERROR;
+    }
+
+    /* Compute the Montgomery parameter */
+    entry->valid = 0U;
+    in.size = modSize;
+    in.pOp1 = pMod;
+    if (HAL_PKA_MontgomeryParam(hpka, &in, Timeout) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+    HAL_PKA_MontgomeryParam_GetResult(hpka, entry->pMontgomeryParam);
+
+    entry->pMod    = pMod;
+    entry->modSize = modSize;
+    entry->key     = key;
+    entry->valid   = 1U;
+  }
+
+  *ppMontgomeryParam = entry->pMontgomeryParam;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Modular exponentiation in fast mode in blocking mode, the Montgomery parameter
+  *         being taken from the cache.
+  * @param  hpka PKA handle
+  * @param  in Input information
+  * @param  Timeout Timeout duration
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_PKA_ModExpFastModeCached(PKA_HandleTypeDef *hpka, PKA_ModExpInTypeDef *in, uint32_t Timeout)
+{
+  PKA_ModExpFastModeInTypeDef in_fast;
+  const uint32_t *p_montgomery_param;
+
+  if (HAL_PKA_MontgomeryCache_Get(hpka, in->pMod, in->OpSize, &p_montgomery_param, Timeout) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  in_fast.expSize          = in->expSize;
+  in_fast.OpSize           = in->OpSize;
+  in_fast.pExp             = in->pExp;
+  in_fast.pOp1             = in->pOp1;
+  in_fast.pMod             = in->pMod;
+  in_fast.pMontgomeryParam = p_montgomery_param;
+
+  return HAL_PKA_ModExpFastMode(hpka, &in_fast, Timeout);
+}
+
 /**
   * @brief  Abort any ongoing operation.
   * @param  hpka PKA handle
@@ -1780,6 +2127,19 @@ HAL_StatusTypeDef HAL_PKA_Abort(PKA_HandleTypeDef *hpka)
   /* Reset the error code */
   hpka->ErrorCode = HAL_PKA_ERROR_NONE;
 
+  /* PKA RAM content is lost, stop any verification batch */
+  hpka->pECDSAVerifCurve = NULL;
+  hpka->pECDSAVerifBatch = NULL;
+
+  /* Flush the RSA CRT exponentiation queue */
+  while (hpka->pRSACRTQueueHead != NULL)
+  {
+    hpka->pRSACRTQueueHead->Status = HAL_ERROR;
+    hpka->pRSACRTQueueHead = hpka->pRSACRTQueueHead->pNext;
+  }
+  hpka->pRSACRTQueueTail = NULL;
+  hpka->RSACRTQueueActive = 0U;
+
   /* Reset the state */
   hpka->State = HAL_PKA_STATE_READY;
 
@@ -1801,6 +2161,9 @@ void HAL_PKA_RAMReset(PKA_HandleTypeDef *hpka)
     /* Clear the content */
     hpka->Instance->RAM[index] = 0UL;
   }
+
+  /* No curve parameters loaded anymore */
+  hpka->pECDSAVerifCurve = NULL;
 }
 
 /**
@@ -1889,6 +2252,9 @@ void HAL_PKA_IRQHandler(PKA_HandleTypeDef *hpka)
   /* Trigger the error callback if an error is present */
   if (hpka->ErrorCode != HAL_PKA_ERROR_NONE)
   {
+    /* Stop the verification batch */
+    hpka->pECDSAVerifBatch = NULL;
+
 #if (USE_HAL_PKA_REGISTER_CALLBACKS == 1)
     hpka->ErrorCallback(hpka);
 #else
@@ -1905,11 +2271,37 @@ void HAL_PKA_IRQHandler(PKA_HandleTypeDef *hpka)
     /* Set the state to ready */
     hpka->State = HAL_PKA_STATE_READY;
 
+    /* Complete the queued RSA CRT exponentiation and chain the next one */
+    if (hpka->RSACRTQueueActive != 0U)
+    {
+      PKA_RSACRTQueue_Complete(hpka);
+      return;
+    }
+
+    /* Chain the next verification of the batch */
+    if (hpka->pECDSAVerifBatch != NULL)
+    {
+      hpka->pECDSAVerifBatch[hpka->ECDSAVerifBatchIndex].ValidSignature = HAL_PKA_ECDSAVerif_IsValidSignature(hpka);
+      hpka->ECDSAVerifBatchIndex++;
+      if (hpka->ECDSAVerifBatchIndex < hpka->ECDSAVerifBatchNbr)
+      {
+        PKA_ECDSAVerifOperand_Set(hpka, &hpka->pECDSAVerifBatch[hpka->ECDSAVerifBatchIndex]);
+        if (PKA_Process_IT(hpka, PKA_MODE_ECDSA_VERIFICATION) == HAL_OK)
+        {
+          return;
+        }
+      }
+      hpka->pECDSAVerifBatch = NULL;
+    }
+
 #if (USE_HAL_PKA_REGISTER_CALLBACKS == 1)
     hpka->OperationCpltCallback(hpka);
 #else
     HAL_PKA_OperationCpltCallback(hpka);
 #endif /* USE_HAL_PKA_REGISTER_CALLBACKS */
+
+    /* Start the RSA CRT exponentiations queued during the operation */
+    (void)PKA_RSACRTQueue_Start(hpka);
   }
 }
 
@@ -2281,6 +2673,66 @@ void PKA_Memcpy_u32_to_u32(__IO uint32_t dst[], __IO const uint32_t src[], size_
   }
 }
 
+/**
+  * @brief  Compute the cache key of a modulus (FNV-1a hash).
+  * @param  pMod Pointer to the modulus
+  * @param  modSize Number of element in pMod array
+  * @retval Cache key
+  */
+uint32_t PKA_MontgomeryCache_Key(const uint8_t *pMod, uint32_t modSize)
+{
+  uint32_t key = 0x811C9DC5UL;
+  uint32_t index;
+
+  for (index = 0U; index < modSize; index++)
+  {
+    key = (key ^ (uint32_t)pMod[index]) * 0x01000193UL;
+  }
+  return key;
+}
+
+/**
+  * @brief  Look for a modulus in the Montgomery parameter cache.
+  * @note   The modulus content is compared with the cached one when the keys match.
+  * @param  hpka PKA handle
+  * @param  pMod Pointer to the modulus
+  * @param  modSize Number of element in pMod array
+  * @param  key Cache key of the modulus
+  * @retval Cache entry, NULL if the modulus is not cached
+  */
+PKA_MontgomeryCacheEntryTypeDef *PKA_MontgomeryCache_Lookup(const PKA_HandleTypeDef *hpka, const uint8_t *pMod,
+                                                            uint32_t modSize, uint32_t key)
+{
+  PKA_MontgomeryCacheEntryTypeDef *entry;
+  uint32_t index;
+  uint32_t count;
+
+  for (index = 0U; index < hpka->MontgomeryCacheSize; index++)
+  {
+    entry = &hpka->pMontgomeryCache[index];
+    if ((entry->valid != 0U) && (entry->key == key) && (entry->modSize == modSize))
+    {
+      count = 0U;
+      if (entry->pMod != pMod)
+      {
+        while ((count < modSize) && (entry->pMod[count] == pMod[count]))
+        {
+          count++;
+        }
+      }
+      else
+      {
+        count = modSize;
+      }
+      if (count == modSize)
+      {
+        return entry;
+      }
+    }
+  }
+  return NULL;
+}
+
 /**
   * @brief  Generic function to start a PKA operation in blocking mode.
   * @param  hpka PKA handle
@@ -2304,6 +2756,12 @@ HAL_StatusTypeDef PKA_Process(PKA_HandleTypeDef *hpka, uint32_t mode, uint32_t T
     /* Init tickstart for timeout management*/
     tickstart = HAL_GetTick();
 
+    /* Any other operation overwrites the loaded ECDSA verification curve */
+    if (mode != PKA_MODE_ECDSA_VERIFICATION)
+    {
+      hpka->pECDSAVerifCurve = NULL;
+    }
+
     /* Set the mode and deactivate the interrupts */
     MODIFY_REG(hpka->Instance->CR, PKA_CR_MODE | PKA_CR_PROCENDIE | PKA_CR_RAMERRIE | PKA_CR_ADDRERRIE | PKA_CR_OPERRIE,
                mode << PKA_CR_MODE_Pos);
@@ -2363,6 +2821,12 @@ HAL_StatusTypeDef PKA_Process_IT(PKA_HandleTypeDef *hpka, uint32_t mode)
     /* Clear any pending error */
     hpka->ErrorCode = HAL_PKA_ERROR_NONE;
 
+    /* Any other operation overwrites the loaded ECDSA verification curve */
+    if (mode != PKA_MODE_ECDSA_VERIFICATION)
+    {
+      hpka->pECDSAVerifCurve = NULL;
+    }
+
     /* Set the mode and activate interrupts */
     MODIFY_REG(hpka->Instance->CR, PKA_CR_MODE | PKA_CR_PROCENDIE | PKA_CR_RAMERRIE | PKA_CR_ADDRERRIE | PKA_CR_OPERRIE,
                (mode << PKA_CR_MODE_Pos) | PKA_CR_PROCENDIE | PKA_CR_RAMERRIE | PKA_CR_ADDRERRIE | PKA_CR_OPERRIE);
@@ -2526,6 +2990,9 @@ void PKA_ECDSASign_Set(PKA_HandleTypeDef *hpka, PKA_ECDSASignInTypeDef *in)
   */
 void PKA_ECDSAVerif_Set(PKA_HandleTypeDef *hpka, PKA_ECDSAVerifInTypeDef *in)
 {
+  /* The loaded curve parameters are overwritten */
+  hpka->pECDSAVerifCurve = NULL;
+
   /* Get the prime order n length */
   hpka->Instance->RAM[PKA_ECDSA_VERIF_IN_ORDER_NB_BITS] = PKA_GetOptBitSize_u8(in->primeOrderSize, *(in->primeOrder));
 
@@ -2578,6 +3045,92 @@ void PKA_ECDSAVerif_Set(PKA_HandleTypeDef *hpka, PKA_ECDSAVerifInTypeDef *in)
   __PKA_RAM_PARAM_END(hpka->Instance->RAM, PKA_ECDSA_VERIF_IN_ORDER_N + ((in->primeOrderSize + 3UL) / 4UL));
 }
 
+/**
+  * @brief  Set ECDSA verification curve parameters.
+  * @param  hpka PKA handle
+  * @param  curve Curve parameters
+  */
+void PKA_ECDSAVerifCurve_Set(PKA_HandleTypeDef *hpka, const PKA_ECDSAVerifCurveTypeDef *curve)
+{
+  /* Get the prime order n length */
+  hpka->Instance->RAM[PKA_ECDSA_VERIF_IN_ORDER_NB_BITS] = PKA_GetOptBitSize_u8(curve->primeOrderSize,
+                                                                              *(curve->primeOrder));
+
+  /* Get the modulus p length */
+  hpka->Instance->RAM[PKA_ECDSA_VERIF_IN_MOD_NB_BITS] = PKA_GetOptBitSize_u8(curve->modulusSize, *(curve->modulus));
+
+  /* Get the coefficient a sign */
+  hpka->Instance->RAM[PKA_ECDSA_VERIF_IN_A_COEFF_SIGN] = curve->coefSign;
+
+  /* Move the input parameters coefficient |a| to PKA RAM */
+  PKA_Memcpy_u8_to_u32(&hpka->Instance->RAM[PKA_ECDSA_VERIF_IN_A_COEFF], curve->coef, curve->modulusSize);
+  __PKA_RAM_PARAM_END(hpka->Instance->RAM, PKA_ECDSA_VERIF_IN_A_COEFF + ((curve->modulusSize + 3UL) / 4UL));
+
+  /* Move the input parameters modulus value p to PKA RAM */
+  PKA_Memcpy_u8_to_u32(&hpka->Instance->RAM[PKA_ECDSA_VERIF_IN_MOD_GF], curve->modulus, curve->modulusSize);
+  __PKA_RAM_PARAM_END(hpka->Instance->RAM, PKA_ECDSA_VERIF_IN_MOD_GF + ((curve->modulusSize + 3UL) / 4UL));
+
+  /* Move the input parameters base point G coordinate x to PKA RAM */
+  PKA_Memcpy_u8_to_u32(&hpka->Instance->RAM[PKA_ECDSA_VERIF_IN_INITIAL_POINT_X], curve->basePointX,
+                       curve->modulusSize);
+  __PKA_RAM_PARAM_END(hpka->Instance->RAM, PKA_ECDSA_VERIF_IN_INITIAL_POINT_X + ((curve->modulusSize + 3UL) / 4UL));
+
+  /* Move the input parameters base point G coordinate y to PKA RAM */
+  PKA_Memcpy_u8_to_u32(&hpka->Instance->RAM[PKA_ECDSA_VERIF_IN_INITIAL_POINT_Y], curve->basePointY,
+                       curve->modulusSize);
+  __PKA_RAM_PARAM_END(hpka->Instance->RAM, PKA_ECDSA_VERIF_IN_INITIAL_POINT_Y + ((curve->modulusSize + 3UL) / 4UL));
+
+  /* Move the input parameters curve prime order n to PKA RAM */
+  PKA_Memcpy_u8_to_u32(&hpka->Instance->RAM[PKA_ECDSA_VERIF_IN_ORDER_N], curve->primeOrder, curve->primeOrderSize);
+  __PKA_RAM_PARAM_END(hpka->Instance->RAM, PKA_ECDSA_VERIF_IN_ORDER_N + ((curve->primeOrderSize + 3UL) / 4UL));
+
+  /* Keep track of the loaded curve, no public key loaded yet */
+  hpka->pECDSAVerifCurve = curve;
+  hpka->pECDSAVerifPubKeyX = NULL;
+  hpka->pECDSAVerifPubKeyY = NULL;
+}
+
+/**
+  * @brief  Set ECDSA verification per-operation parameters, the curve being already loaded.
+  * @param  hpka PKA handle
+  * @param  in Public key, signature and hash
+  */
+void PKA_ECDSAVerifOperand_Set(PKA_HandleTypeDef *hpka, const PKA_ECDSAVerifOperandTypeDef *in)
+{
+  uint32_t modulussize = hpka->pECDSAVerifCurve->modulusSize;
+  uint32_t primeordersize = hpka->pECDSAVerifCurve->primeOrderSize;
+
+  /* The public key of the previous verification is still in PKA RAM */
+  if ((in->pPubKeyCurvePtX != hpka->pECDSAVerifPubKeyX) || (in->pPubKeyCurvePtY != hpka->pECDSAVerifPubKeyY))
+  {
+    /* Move the input parameters public-key curve point Q coordinate xQ to PKA RAM */
+    PKA_Memcpy_u8_to_u32(&hpka->Instance->RAM[PKA_ECDSA_VERIF_IN_PUBLIC_KEY_POINT_X], in->pPubKeyCurvePtX,
+                         modulussize);
+    __PKA_RAM_PARAM_END(hpka->Instance->RAM, PKA_ECDSA_VERIF_IN_PUBLIC_KEY_POINT_X + ((modulussize + 3UL) / 4UL));
+
+    /* Move the input parameters public-key curve point Q coordinate yQ to PKA RAM */
+    PKA_Memcpy_u8_to_u32(&hpka->Instance->RAM[PKA_ECDSA_VERIF_IN_PUBLIC_KEY_POINT_Y], in->pPubKeyCurvePtY,
+                         modulussize);
+    __PKA_RAM_PARAM_END(hpka->Instance->RAM, PKA_ECDSA_VERIF_IN_PUBLIC_KEY_POINT_Y + ((modulussize + 3UL) / 4UL));
+
+    /* Keep track of the loaded public key */
+    hpka->pECDSAVerifPubKeyX = in->pPubKeyCurvePtX;
+    hpka->pECDSAVerifPubKeyY = in->pPubKeyCurvePtY;
+  }
+
+  /* Move the input parameters signature part r to PKA RAM */
+  PKA_Memcpy_u8_to_u32(&hpka->Instance->RAM[PKA_ECDSA_VERIF_IN_SIGNATURE_R], in->RSign, primeordersize);
+  __PKA_RAM_PARAM_END(hpka->Instance->RAM, PKA_ECDSA_VERIF_IN_SIGNATURE_R + ((primeordersize + 3UL) / 4UL));
+
+  /* Move the input parameters signature part s to PKA RAM */
+  PKA_Memcpy_u8_to_u32(&hpka->Instance->RAM[PKA_ECDSA_VERIF_IN_SIGNATURE_S], in->SSign, primeordersize);
+  __PKA_RAM_PARAM_END(hpka->Instance->RAM, PKA_ECDSA_VERIF_IN_SIGNATURE_S + ((primeordersize + 3UL) / 4UL));
+
+  /* Move the input parameters hash of message z to PKA RAM */
+  PKA_Memcpy_u8_to_u32(&hpka->Instance->RAM[PKA_ECDSA_VERIF_IN_HASH_E], in->hash, primeordersize);
+  __PKA_RAM_PARAM_END(hpka->Instance->RAM, PKA_ECDSA_VERIF_IN_HASH_E + ((primeordersize + 3UL) / 4UL));
+}
+
 /**
   * @brief  Set input parameters.
   * @param  hpka PKA handle
@@ -2613,6 +3166,68 @@ void PKA_RSACRTExp_Set(PKA_HandleTypeDef *hpka, PKA_RSACRTExpInTypeDef *in)
   __PKA_RAM_PARAM_END(hpka->Instance->RAM, PKA_RSA_CRT_EXP_IN_EXPONENT_BASE + (in->size / 4UL));
 }
 
+/**
+  * @brief  Start the RSA CRT exponentiation at the head of the queue.
+  * @param  hpka PKA handle
+  * @retval HAL status, HAL_BUSY if the queue is empty, already processed or if the PKA is not free
+  */
+HAL_StatusTypeDef PKA_RSACRTQueue_Start(PKA_HandleTypeDef *hpka)
+{
+  HAL_StatusTypeDef err;
+
+  if ((hpka->RSACRTQueueActive != 0U) || (hpka->pRSACRTQueueHead == NULL) || (hpka->State != HAL_PKA_STATE_READY))
+  {
+    return HAL_BUSY;
+  }
+
+  /* Set input parameter in PKA RAM */
+  PKA_RSACRTExp_Set(hpka, hpka->pRSACRTQueueHead->pIn);
+
+  /* Start the operation */
+  err = PKA_Process_IT(hpka, PKA_MODE_RSA_CRT_EXP);
+  if (err == HAL_OK)
+  {
+    hpka->RSACRTQueueActive = 1U;
+  }
+  return err;
+}
+
+/**
+  * @brief  Complete the RSA CRT exponentiation at the head of the queue and start the next one.
+  * @param  hpka PKA handle
+  */
+void PKA_RSACRTQueue_Complete(PKA_HandleTypeDef *hpka)
+{
+  PKA_RSACRTExpRequestTypeDef *p_req = hpka->pRSACRTQueueHead;
+
+  /* Remove the request from the queue */
+  hpka->RSACRTQueueActive = 0U;
+  hpka->pRSACRTQueueHead = p_req->pNext;
+  if (hpka->pRSACRTQueueHead == NULL)
+  {
+    hpka->pRSACRTQueueTail = NULL;
+  }
+
+  /* Retrieve the result before the next operation overwrites the PKA RAM */
+  if (hpka->ErrorCode == HAL_PKA_ERROR_NONE)
+  {
+    HAL_PKA_RSACRTExp_GetResult(hpka, p_req->pRes);
+    p_req->Status = HAL_OK;
+  }
+  else
+  {
+    p_req->Status = HAL_ERROR;
+  }
+
+  if (p_req->CpltCallback != NULL)
+  {
+    p_req->CpltCallback(p_req);
+  }
+
+  /* Chain the next request, unless another operation was started from the callback */
+  (void)PKA_RSACRTQueue_Start(hpka);
+}
+
 /**
   * @brief  Set input parameters.
   * @param  hpka PKA handle
@@ -53,6 +53,19 @@
              This one allows to output some Look-Up Table Outputs and
              indicates that the peripheral is ready to start (handle state = @ref HAL_PLAY_STATE_READY).
 
+    (#) Alternatively, describe the whole logic function with a HAL_PLAY_NetlistTypeDef and compile it once
+        with HAL_PLAY_CompileNetlist(), which checks all the parameters. HAL_PLAY_LoadCompiled() then writes
+        the register values without any check, only the registers which differ from the compiled values
+        being written. The handle state is @ref HAL_PLAY_STATE_READY.
+
+    (#) Ready-made logic functions offload the GPIO or timer event processing from the interrupt handlers:
+        debounce, quadrature decoder, pulse stretch and event coincidence (@ref HAL_PLAY_FunctionTypeDef).
+        Bind a function to its input sources, lookup tables and outputs with a HAL_PLAY_FunctionConfTypeDef,
+        then call HAL_PLAY_SetFunction() (or HAL_PLAY_BuildFunction() followed by HAL_PLAY_CompileNetlist()).
+        Only the resources of the function are written, so several functions can share the PLAY. The lookup
+        table output of the function result is returned to configure the edge trigger interrupts: the
+        callbacks are only called for filtered events.
+
     (#) After ending the configuration, start the PLAY with HAL_PLAY_Start() to:
           - Lock the PLAYx configuration registers to prevent any accidental write access.
             The kernel clock becomes operational: LUT registered outputs, filters, software triggers and edge triggers
@@ -67,6 +80,11 @@
 
         Disconnect all peripherals connected to PLAY outputs before updating the configuration to avoid glitches.
 
+    (#) To switch the logic function while the PLAY is started, call HAL_PLAY_Reconfigure() with a compiled
+        configuration. The configuration is unlocked, the differing registers are written and the configuration is
+        locked again with the interrupts masked: the LUT registered outputs, filters, software triggers and edge
+        triggers restart from their reset state. The lookup table output interrupts stay enabled.
+
     (#) At the end of the PLAY processor User application, call the function HAL_PLAY_DeInit() to restore the default
         configuration which calls HAL_PLAY_MspDeInit().
 
@@ -206,6 +224,15 @@
 #define PLAY_IN_MUX_VALUE_POS  (0U)                                /*!< Input multiplexer value field position */
 #define PLAY_IN_MUX_VALUE_MASK (0xFUL << PLAY_IN_MUX_VALUE_POS)    /*!< Input multiplexer value field mask     */
 
+/**
+  * @brief Truth table values of the ready-made logic functions (@ref HAL_PLAY_FunctionTypeDef)
+  */
+#define PLAY_TRUTH_TABLE_COPY      (0xAAAAU) /*!< IN0                                           */
+#define PLAY_TRUTH_TABLE_AND       (0x8888U) /*!< IN0 & IN1                                     */
+#define PLAY_TRUTH_TABLE_LATCH     (0xBABAU) /*!< IN0 | (IN2 & !IN1): set by IN0, reset by IN1  */
+#define PLAY_TRUTH_TABLE_QUAD_STEP (0x6FF6U) /*!< (IN0 ^ IN1) | (IN2 ^ IN3)                     */
+#define PLAY_TRUTH_TABLE_QUAD_DIR  (0x6F60U) /*!< IN2 ? (IN0 ^ IN1) : IN3                       */
+
 /**
   * @brief PLAY Interrupt Definition
   */
@@ -229,6 +256,30 @@
   * @{
   */
 
+/**
+  * @brief Get the input multiplexer of an input source.
+  * @param  source Input source (@ref HAL_PLAY_IN_SourceTypeDef).
+  * @retval Input multiplexer number.
+  */
+#define PLAY_GET_IN_MUX(source) \
+  ((((uint32_t)(source) & PLAY_IN_MUX_MASK) >> HAL_PLAY_IN_MUX_POS) & (LL_PLAY_IN_MAX - 1U))
+
+/**
+  * @brief Get the lookup table input source selecting the registered output of a lookup table.
+  * @param  lut Lookup table number.
+  * @retval Input source (@ref HAL_PLAY_LUT_InputSourceTypeDef).
+  */
+#define PLAY_LUT_INPUT_REGISTERED(lut) \
+  ((HAL_PLAY_LUT_InputSourceTypeDef)((uint32_t)HAL_PLAY_LUT_INPUT_LUT0_OUT_REGISTERED + (lut)))
+
+/**
+  * @brief Get the lookup table input source selecting the direct output of a lookup table.
+  * @param  lut Lookup table number.
+  * @retval Input source (@ref HAL_PLAY_LUT_InputSourceTypeDef).
+  */
+#define PLAY_LUT_INPUT_DIRECT(lut) \
+  ((HAL_PLAY_LUT_InputSourceTypeDef)((uint32_t)HAL_PLAY_LUT_INPUT_LUT0_OUT_DIRECT + (lut)))
+
 /**
   * @brief Retrieve the bit status in a given register.
   * @param  reg The register to check.
@@ -1114,6 +1165,10 @@
 static HAL_StatusTypeDef PLAY_LUT_SetEdgeTrigger(const HAL_PLAY_HandleTypeDef *hplay,
                                                  const HAL_PLAY_EdgeTriggerConfTypeDef *p_config,
                                                  uint32_t timeout_ms);
+static void PLAY_LoadCompiled(PLAY_TypeDef *p_playx, const HAL_PLAY_CompiledConfTypeDef *p_compiled);
+static void PLAY_SetFunctionLUT(HAL_PLAY_LUT_ConfTypeDef *p_lut, uint32_t lut, uint32_t truth_table,
+                                HAL_PLAY_LUT_InputSourceTypeDef in0, HAL_PLAY_LUT_InputSourceTypeDef in1,
+                                HAL_PLAY_LUT_InputSourceTypeDef in2, HAL_PLAY_LUT_InputSourceTypeDef in3);
 
 /**
   * @}
@@ -2113,6 +2168,345 @@ uint32_t HAL_PLAY_OUTPUT_GetSource(const HAL_PLAY_HandleTypeDef *hplay, HAL_PLAY
   return LL_PLAY_OUTPUT_GetSource(PLAY_GET_INSTANCE(hplay), (uint32_t)output_mux);
 }
 
+/**
+  * @brief  Check a netlist and compile it in register values.
+  * @param  hplay      Pointer to a @ref HAL_PLAY_HandleTypeDef.
+  * @param  p_netlist  Pointer to a @ref HAL_PLAY_NetlistTypeDef.
+  * @param  p_compiled Pointer to the @ref HAL_PLAY_CompiledConfTypeDef to be filled.
+  * @note   The parameters are checked whatever USE_FULL_ASSERT, the compiled configuration being
+  *         loaded without any check. The PLAY registers are not accessed.
+  * @retval HAL_OK     Operation completed successfully.
+  * @retval HAL_ERROR  Invalid parameter.
+  */
+HAL_StatusTypeDef HAL_PLAY_CompileNetlist(const HAL_PLAY_HandleTypeDef *hplay, const HAL_PLAY_NetlistTypeDef *p_netlist,
+                                          HAL_PLAY_CompiledConfTypeDef *p_compiled)
+{
+  const PLAY_TypeDef *p_playx;
+
+  /* Check the parameters */
+  if ((hplay == NULL) || (p_netlist == NULL) || (p_compiled == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  p_playx = PLAY_GET_INSTANCE(hplay);
+
+  if ((p_netlist->input_nbr > LL_PLAY_IN_MAX) || (p_netlist->lut_nbr > LL_PLAY_LUT_MAX)
+      || (p_netlist->output_nbr > LL_PLAY_OUT_MAX)
+      || ((p_netlist->p_input == NULL) && (p_netlist->input_nbr != 0U))
+      || ((p_netlist->p_lut == NULL) && (p_netlist->lut_nbr != 0U))
+      || ((p_netlist->p_output == NULL) && (p_netlist->output_nbr != 0U)))
+  {
+    return HAL_ERROR;
+  }
+
+  p_compiled->in_mask = 0U;
+  p_compiled->lut_mask = 0U;
+  p_compiled->out_mask = 0U;
+
+  /* Input multiplexers */
+  for (uint32_t idx = 0; idx < p_netlist->input_nbr; idx++)
+  {
+    const HAL_PLAY_IN_ConfTypeDef *p_in = &p_netlist->p_input[idx];
+
+    if (!(IS_PLAY_MIN_PULSE_WIDTH(p_in->min_pulse_width)) || !(IS_PLAY_EDGE_DETECTION_MODE(p_in->mode))
+        || !(IS_PLAY_IN_SOURCE(p_playx, p_in->source)))
+    {
+      return HAL_ERROR;
+    }
+
+    uint32_t premuxsel_value = ((uint32_t)p_in->source & PLAY_IN_MUX_VALUE_MASK) >> PLAY_IN_MUX_VALUE_POS;
+    uint32_t input_mux = (((uint32_t)p_in->source & PLAY_IN_MUX_MASK) >> HAL_PLAY_IN_MUX_POS) & (LL_PLAY_IN_MAX - 1U);
+
+    p_compiled->filtcfg[input_mux] = (p_in->min_pulse_width << PLAY_FILTxCFG_WIDTH_Pos) | (uint32_t)p_in->mode
+                                     | (premuxsel_value << PLAY_FILTxCFG_PREMUXSEL_Pos);
+    p_compiled->in_mask |= (1UL << input_mux);
+  }
+
+  /* Lookup tables */
+  for (uint32_t idx = 0; idx < p_netlist->lut_nbr; idx++)
+  {
+    const HAL_PLAY_LUT_ConfTypeDef *p_lut = &p_netlist->p_lut[idx];
+
+    if (!(IS_PLAY_LUT(p_playx, p_lut->lut)) || !(IS_PLAY_LUT_TRUTH_TABLE_VALUE(p_lut->truth_table))
+        || !(IS_PLAY_LUT_INPUT_SOURCE(p_playx, p_lut->lut, p_lut->input_source[LL_PLAY_LUT_INPUT0]))
+        || !(IS_PLAY_LUT_INPUT_SOURCE(p_playx, p_lut->lut, p_lut->input_source[LL_PLAY_LUT_INPUT1]))
+        || !(IS_PLAY_LUT_INPUT_SOURCE(p_playx, p_lut->lut, p_lut->input_source[LL_PLAY_LUT_INPUT2]))
+        || !(IS_PLAY_LUT_INPUT_SOURCE(p_playx, p_lut->lut, p_lut->input_source[LL_PLAY_LUT_INPUT3]))
+        || !(IS_PLAY_LUT_CLOCK_GATE_SOURCE(p_playx, p_lut->clk_gate_source)))
+    {
+      return HAL_ERROR;
+    }
+
+    uint32_t lut = (uint32_t)p_lut->lut & (LL_PLAY_LUT_MAX - 1U);
+
+    p_compiled->lecfg1[lut] = p_lut->truth_table << PLAY_LExCFG1_LUT_Pos;
+    p_compiled->lecfg2[lut] = ((uint32_t)p_lut->input_source[LL_PLAY_LUT_INPUT0] << PLAY_LExCFG2_IN0_SEL_Pos)
+                              | ((uint32_t)p_lut->input_source[LL_PLAY_LUT_INPUT1] << PLAY_LExCFG2_IN1_SEL_Pos)
+                              | ((uint32_t)p_lut->input_source[LL_PLAY_LUT_INPUT2] << PLAY_LExCFG2_IN2_SEL_Pos)
+                              | ((uint32_t)p_lut->input_source[LL_PLAY_LUT_INPUT3] << PLAY_LExCFG2_IN3_SEL_Pos)
+                              | ((uint32_t)p_lut->clk_gate_source << PLAY_LExCFG2_CK_SEL_Pos);
+    p_compiled->lut_mask |= (1UL << lut);
+  }
+
+  /* Output multiplexers */
+  for (uint32_t idx = 0; idx < p_netlist->output_nbr; idx++)
+  {
+    const HAL_PLAY_OUT_ConfTypeDef *p_out = &p_netlist->p_output[idx];
+
+    if (!(IS_PLAY_OUT(p_out->output_mux)) || !(IS_PLAY_OUT_SOURCE(p_playx, p_out->lut_output)))
+    {
+      return HAL_ERROR;
+    }
+
+    uint32_t output_mux = (uint32_t)p_out->output_mux & (LL_PLAY_OUT_MAX - 1U);
+
+    p_compiled->outcfg[output_mux] = (POSITION_VAL(p_out->lut_output)) << PLAY_OUTxCFG_SEL_Pos;
+    p_compiled->out_mask |= (1UL << output_mux);
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Load a compiled configuration in the PLAY peripheral.
+  * @param  hplay      Pointer to a @ref HAL_PLAY_HandleTypeDef.
+  * @param  p_compiled Pointer to a @ref HAL_PLAY_CompiledConfTypeDef built by HAL_PLAY_CompileNetlist().
+  * @note   Only the registers which differ from the compiled values are written.
+  * @retval HAL_OK     Operation completed successfully.
+  * @retval HAL_ERROR  Invalid parameter or wrong state.
+  */
+HAL_StatusTypeDef HAL_PLAY_LoadCompiled(HAL_PLAY_HandleTypeDef *hplay, const HAL_PLAY_CompiledConfTypeDef *p_compiled)
+{
+  PLAY_TypeDef *p_playx;
+  HAL_PLAY_StateTypeDef tmp_state;
+
+  /* Check the parameters */
+  if (hplay == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  if (p_compiled == NULL)
+  {
+    hplay->ErrorCode |= HAL_PLAY_ERROR_INVALID_PARAM;
+
+    return HAL_ERROR;
+  }
+
+  p_playx = PLAY_GET_INSTANCE(hplay);
+
+  /* Check the peripheral state */
+  tmp_state = hplay->State;
+  if ((tmp_state != HAL_PLAY_STATE_INIT) && (tmp_state != HAL_PLAY_STATE_READY))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Unlock the configuration if not already done */
+  if (LL_PLAY_IsLocked(p_playx) != 0U)
+  {
+    LL_PLAY_Unlock(p_playx);
+  }
+
+  PLAY_LoadCompiled(p_playx, p_compiled);
+
+  hplay->State = HAL_PLAY_STATE_READY;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Build the netlist of a ready-made logic function.
+  * @param  p_config   Pointer to a @ref HAL_PLAY_FunctionConfTypeDef.
+  * @param  p_function Pointer to the @ref HAL_PLAY_FunctionNetlistTypeDef to be filled.
+  * @note   The netlist is then compiled with HAL_PLAY_CompileNetlist(), which checks the input sources.
+  *         Several functions using different inputs, lookup tables and outputs can be loaded in the same
+  *         PLAY, HAL_PLAY_LoadCompiled() writing only the registers set by each netlist.
+  * @retval HAL_OK     Operation completed successfully.
+  * @retval HAL_ERROR  Invalid parameter.
+  */
+HAL_StatusTypeDef HAL_PLAY_BuildFunction(const HAL_PLAY_FunctionConfTypeDef *p_config,
+                                         HAL_PLAY_FunctionNetlistTypeDef *p_function)
+{
+  uint32_t lut;
+  uint32_t lut_nbr;
+  uint32_t mux_a;
+  uint32_t mux_b = 0U;
+  uint32_t use_source_b;
+  HAL_PLAY_LUT_InputSourceTypeDef filter_a;
+  HAL_PLAY_LUT_InputSourceTypeDef filter_b;
+
+  /* Check the parameters */
+  if ((p_config == NULL) || (p_function == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  switch (p_config->function)
+  {
+    case HAL_PLAY_FUNCTION_DEBOUNCE:
+      lut_nbr = 1U;
+      use_source_b = 0U;
+      break;
+    case HAL_PLAY_FUNCTION_QUADRATURE:
+      lut_nbr = 4U;
+      use_source_b = 1U;
+      break;
+    case HAL_PLAY_FUNCTION_PULSE_STRETCH:
+      lut_nbr = 1U;
+      use_source_b = (p_config->source_b != HAL_PLAY_IN_SOURCE_INVALID) ? 1U : 0U;
+      break;
+    case HAL_PLAY_FUNCTION_COINCIDENCE:
+      lut_nbr = 1U;
+      use_source_b = 1U;
+      break;
+    default:
+      return HAL_ERROR;
+  }
+
+  lut = (uint32_t)p_config->first_lut;
+
+  /* The quadrature direction reads the direct output of the step lookup table, only possible in the same
+     group of four lookup tables */
+  if ((lut > (LL_PLAY_LUT_MAX - lut_nbr)) || (!(IS_PLAY_MIN_PULSE_WIDTH(p_config->min_pulse_width)))
+      || ((p_config->function == HAL_PLAY_FUNCTION_QUADRATURE) && ((lut % 4U) != 0U))
+      || (p_config->source_a == HAL_PLAY_IN_SOURCE_INVALID)
+      || ((use_source_b != 0U) && (p_config->source_b == HAL_PLAY_IN_SOURCE_INVALID))
+      || ((p_config->function == HAL_PLAY_FUNCTION_PULSE_STRETCH) && (use_source_b == 0U)
+          && !(IS_PLAY_SWTRIGGER(p_config->sw_trigger)))
+      || !(IS_FUNCTIONAL_STATE(p_config->output_state)))
+  {
+    return HAL_ERROR;
+  }
+
+  mux_a = PLAY_GET_IN_MUX(p_config->source_a);
+  if (use_source_b != 0U)
+  {
+    mux_b = PLAY_GET_IN_MUX(p_config->source_b);
+    if (mux_b == mux_a)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  if ((p_config->output_state == ENABLE) && (p_config->function == HAL_PLAY_FUNCTION_QUADRATURE)
+      && (p_config->output == p_config->output_dir))
+  {
+    return HAL_ERROR;
+  }
+
+  filter_a = (HAL_PLAY_LUT_InputSourceTypeDef)((uint32_t)HAL_PLAY_LUT_INPUT_FILTER0 + mux_a);
+  filter_b = (HAL_PLAY_LUT_InputSourceTypeDef)((uint32_t)HAL_PLAY_LUT_INPUT_FILTER0 + mux_b);
+
+  /* Input multiplexers: level signals, glitches removed by the filter */
+  p_function->input[0].min_pulse_width = p_config->min_pulse_width;
+  p_function->input[0].mode = HAL_PLAY_EDGE_DETECTION_BYPASSED;
+  p_function->input[0].source = p_config->source_a;
+  p_function->input[1].min_pulse_width = p_config->min_pulse_width;
+  p_function->input[1].mode = HAL_PLAY_EDGE_DETECTION_BYPASSED;
+  p_function->input[1].source = p_config->source_b;
+
+  p_function->lut_output = HAL_PLAY_LUT0_OUT_REGISTERED << lut;
+  p_function->lut_output_dir = 0U;
+
+  /* Lookup tables */
+  switch (p_config->function)
+  {
+    case HAL_PLAY_FUNCTION_DEBOUNCE:
+      PLAY_SetFunctionLUT(&p_function->lut[0], lut, PLAY_TRUTH_TABLE_COPY, filter_a, HAL_PLAY_LUT_INPUT_DEFAULT,
+                          HAL_PLAY_LUT_INPUT_DEFAULT, HAL_PLAY_LUT_INPUT_DEFAULT);
+      break;
+
+    case HAL_PLAY_FUNCTION_QUADRATURE:
+      /* Previous state of A and B */
+      PLAY_SetFunctionLUT(&p_function->lut[0], lut, PLAY_TRUTH_TABLE_COPY, filter_a, HAL_PLAY_LUT_INPUT_DEFAULT,
+                          HAL_PLAY_LUT_INPUT_DEFAULT, HAL_PLAY_LUT_INPUT_DEFAULT);
+      PLAY_SetFunctionLUT(&p_function->lut[1], lut + 1U, PLAY_TRUTH_TABLE_COPY, filter_b, HAL_PLAY_LUT_INPUT_DEFAULT,
+                          HAL_PLAY_LUT_INPUT_DEFAULT, HAL_PLAY_LUT_INPUT_DEFAULT);
+      /* Step: A or B differs from its previous state */
+      PLAY_SetFunctionLUT(&p_function->lut[2], lut + 2U, PLAY_TRUTH_TABLE_QUAD_STEP, filter_a,
+                          PLAY_LUT_INPUT_REGISTERED(lut), filter_b, PLAY_LUT_INPUT_REGISTERED(lut + 1U));
+      /* Direction: previous A xor B, sampled on each step */
+      PLAY_SetFunctionLUT(&p_function->lut[3], lut + 3U, PLAY_TRUTH_TABLE_QUAD_DIR, PLAY_LUT_INPUT_REGISTERED(lut),
+                          filter_b, PLAY_LUT_INPUT_DIRECT(lut + 2U), PLAY_LUT_INPUT_REGISTERED(lut + 3U));
+
+      p_function->lut_output = HAL_PLAY_LUT0_OUT_DIRECT << (lut + 2U);
+      p_function->lut_output_dir = HAL_PLAY_LUT0_OUT_REGISTERED << (lut + 3U);
+      break;
+
+    case HAL_PLAY_FUNCTION_PULSE_STRETCH:
+      /* Set by A, cleared by B or by the software trigger */
+      if (use_source_b == 0U)
+      {
+        filter_b = (HAL_PLAY_LUT_InputSourceTypeDef)((uint32_t)HAL_PLAY_LUT_INPUT_SWTRIG0
+                                                     + POSITION_VAL(p_config->sw_trigger));
+      }
+      PLAY_SetFunctionLUT(&p_function->lut[0], lut, PLAY_TRUTH_TABLE_LATCH, filter_a, filter_b,
+                          PLAY_LUT_INPUT_REGISTERED(lut), HAL_PLAY_LUT_INPUT_DEFAULT);
+      break;
+
+    default: /* HAL_PLAY_FUNCTION_COINCIDENCE */
+      PLAY_SetFunctionLUT(&p_function->lut[0], lut, PLAY_TRUTH_TABLE_AND, filter_a, filter_b,
+                          HAL_PLAY_LUT_INPUT_DEFAULT, HAL_PLAY_LUT_INPUT_DEFAULT);
+      break;
+  }
+
+  /* Output multiplexers */
+  p_function->output[0].output_mux = p_config->output;
+  p_function->output[0].lut_output = p_function->lut_output;
+  p_function->output[1].output_mux = p_config->output_dir;
+  p_function->output[1].lut_output = p_function->lut_output_dir;
+
+  p_function->netlist.p_input = p_function->input;
+  p_function->netlist.input_nbr = (use_source_b != 0U) ? 2U : 1U;
+  p_function->netlist.p_lut = p_function->lut;
+  p_function->netlist.lut_nbr = lut_nbr;
+  p_function->netlist.p_output = p_function->output;
+  if (p_config->output_state == ENABLE)
+  {
+    p_function->netlist.output_nbr = (p_config->function == HAL_PLAY_FUNCTION_QUADRATURE) ? 2U : 1U;
+  }
+  else
+  {
+    p_function->netlist.output_nbr = 0U;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Build, compile and load a ready-made logic function in the PLAY peripheral.
+  * @param  hplay      Pointer to a @ref HAL_PLAY_HandleTypeDef.
+  * @param  p_config   Pointer to a @ref HAL_PLAY_FunctionConfTypeDef.
+  * @param  p_function Pointer to the @ref HAL_PLAY_FunctionNetlistTypeDef to be filled, giving the lookup table
+  *                    outputs to be used with HAL_PLAY_Start() or HAL_PLAY_LUT_SetEdgeTrigger_IT().
+  * @note   Only the inputs, lookup tables and outputs of the function are written, the other ones are kept.
+  * @retval HAL_OK     Operation completed successfully.
+  * @retval HAL_ERROR  Invalid parameter or wrong state.
+  */
+HAL_StatusTypeDef HAL_PLAY_SetFunction(HAL_PLAY_HandleTypeDef *hplay, const HAL_PLAY_FunctionConfTypeDef *p_config,
+                                       HAL_PLAY_FunctionNetlistTypeDef *p_function)
+{
+  HAL_PLAY_CompiledConfTypeDef compiled;
+
+  /* Check the parameters */
+  if (hplay == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  if ((HAL_PLAY_BuildFunction(p_config, p_function) != HAL_OK)
+      || (HAL_PLAY_CompileNetlist(hplay, &p_function->netlist, &compiled) != HAL_OK))
+  {
+    hplay->ErrorCode |= HAL_PLAY_ERROR_INVALID_PARAM;
+
+    return HAL_ERROR;
+  }
+
+  return HAL_PLAY_LoadCompiled(hplay, &compiled);
+}
+
 /**
   * @}
   */
@@ -2215,6 +2609,57 @@ HAL_StatusTypeDef HAL_PLAY_Stop(HAL_PLAY_HandleTypeDef *hplay)
   return HAL_OK;
 }
 
+/**
+  * @brief  Switch the logic function of the started PLAY peripheral.
+  * @param  hplay      Pointer to a @ref HAL_PLAY_HandleTypeDef.
+  * @param  p_compiled Pointer to a @ref HAL_PLAY_CompiledConfTypeDef built by HAL_PLAY_CompileNetlist().
+  * @note   The configuration is unlocked only for the writes of the differing registers, with the
+  *         interrupts masked. The kernel clock features restart from their reset state and the lookup
+  *         table output interrupts stay enabled.
+  * @retval HAL_OK     Operation completed successfully.
+  * @retval HAL_ERROR  Invalid parameter or wrong state.
+  */
+HAL_StatusTypeDef HAL_PLAY_Reconfigure(HAL_PLAY_HandleTypeDef *hplay, const HAL_PLAY_CompiledConfTypeDef *p_compiled)
+{
+  PLAY_TypeDef *p_playx;
+  uint32_t primask_bit;
+
+  /* Check the parameters */
+  if (hplay == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  if (p_compiled == NULL)
+  {
+    hplay->ErrorCode |= HAL_PLAY_ERROR_INVALID_PARAM;
+
+    return HAL_ERROR;
+  }
+
+  p_playx = PLAY_GET_INSTANCE(hplay);
+
+  /* Check the peripheral state */
+  if (hplay->State != HAL_PLAY_STATE_BUSY)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Keep the unlocked window as short as possible */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  LL_PLAY_Unlock(p_playx);
+
+  PLAY_LoadCompiled(p_playx, p_compiled);
+
+  LL_PLAY_Lock(p_playx);
+
+  __set_PRIMASK(primask_bit);
+
+  return HAL_OK;
+}
+
 /**
   * @}
   */
@@ -3726,6 +4171,76 @@ static HAL_StatusTypeDef PLAY_LUT_SetEdgeTrigger(const HAL_PLAY_HandleTypeDef *h
   return HAL_OK;
 }
 
+/**
+  * @brief  Write the registers which differ from a compiled configuration.
+  * @param  p_playx    PLAY instance, configuration unlocked.
+  * @param  p_compiled Pointer to a @ref HAL_PLAY_CompiledConfTypeDef.
+  */
+static void PLAY_LoadCompiled(PLAY_TypeDef *p_playx, const HAL_PLAY_CompiledConfTypeDef *p_compiled)
+{
+  for (uint32_t idx = 0; idx < LL_PLAY_IN_MAX; idx++)
+  {
+    if (((p_compiled->in_mask & (1UL << idx)) != 0U)
+        && (READ_BIT(p_playx->FILTCFG[idx], (PLAY_FILTxCFG_WIDTH | PLAY_FILTxCFG_EDGEDET | PLAY_FILTxCFG_PREMUXSEL))
+            != p_compiled->filtcfg[idx]))
+    {
+      MODIFY_REG(p_playx->FILTCFG[idx], (PLAY_FILTxCFG_WIDTH | PLAY_FILTxCFG_EDGEDET | PLAY_FILTxCFG_PREMUXSEL),
+                 p_compiled->filtcfg[idx]);
+    }
+  }
+
+  for (uint32_t idx = 0; idx < LL_PLAY_LUT_MAX; idx++)
+  {
+    if ((p_compiled->lut_mask & (1UL << idx)) != 0U)
+    {
+      if (READ_BIT(p_playx->LECFG1[idx], PLAY_LExCFG1_LUT) != p_compiled->lecfg1[idx])
+      {
+        MODIFY_REG(p_playx->LECFG1[idx], PLAY_LExCFG1_LUT, p_compiled->lecfg1[idx]);
+      }
+
+      if (READ_BIT(p_playx->LECFG2[idx], (PLAY_LExCFG2_IN0_SEL | PLAY_LExCFG2_IN1_SEL | PLAY_LExCFG2_IN2_SEL
+                                          | PLAY_LExCFG2_IN3_SEL | PLAY_LExCFG2_CK_SEL)) != p_compiled->lecfg2[idx])
+      {
+        MODIFY_REG(p_playx->LECFG2[idx], (PLAY_LExCFG2_IN0_SEL | PLAY_LExCFG2_IN1_SEL | PLAY_LExCFG2_IN2_SEL
+                                          | PLAY_LExCFG2_IN3_SEL | PLAY_LExCFG2_CK_SEL), p_compiled->lecfg2[idx]);
+      }
+    }
+  }
+
+  for (uint32_t idx = 0; idx < LL_PLAY_OUT_MAX; idx++)
+  {
+    if (((p_compiled->out_mask & (1UL << idx)) != 0U)
+        && (READ_BIT(p_playx->OUTCFG[idx], PLAY_OUTxCFG_SEL) != p_compiled->outcfg[idx]))
+    {
+      MODIFY_REG(p_playx->OUTCFG[idx], PLAY_OUTxCFG_SEL, p_compiled->outcfg[idx]);
+    }
+  }
+}
+
+/**
+  * @brief  Fill a lookup table configuration of a ready-made logic function.
+  * @param  p_lut       Pointer to the @ref HAL_PLAY_LUT_ConfTypeDef to be filled.
+  * @param  lut         Lookup table number.
+  * @param  truth_table Truth table value.
+  * @param  in0         Source of the lookup table input 0.
+  * @param  in1         Source of the lookup table input 1.
+  * @param  in2         Source of the lookup table input 2.
+  * @param  in3         Source of the lookup table input 3.
+  */
+static void PLAY_SetFunctionLUT(HAL_PLAY_LUT_ConfTypeDef *p_lut, uint32_t lut, uint32_t truth_table,
+                                HAL_PLAY_LUT_InputSourceTypeDef in0, HAL_PLAY_LUT_InputSourceTypeDef in1,
+                                HAL_PLAY_LUT_InputSourceTypeDef in2, HAL_PLAY_LUT_InputSourceTypeDef in3)
+{
+  p_lut->lut = (HAL_PLAY_LUTTypeDef)lut;
+  p_lut->truth_table = truth_table;
+  p_lut->input_source[LL_PLAY_LUT_INPUT0] = in0;
+  p_lut->input_source[LL_PLAY_LUT_INPUT1] = in1;
+  p_lut->input_source[LL_PLAY_LUT_INPUT2] = in2;
+  p_lut->input_source[LL_PLAY_LUT_INPUT3] = in3;
+  /* Registered outputs updated on each kernel clock */
+  p_lut->clk_gate_source = HAL_PLAY_LUT_CLK_GATE_ON;
+}
+
 /**
   * @}
   */
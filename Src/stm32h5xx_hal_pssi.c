@@ -78,6 +78,21 @@
       (+) End of abort process, @ref HAL_PSSI_AbortCpltCallback() is executed and user can
            add his own code by customization of function pointer @ref HAL_PSSI_AbortCpltCallback()
 
+    *** Streaming mode IO operation ***
+    ===================================
+    [..]
+      (+) Link the DMA channel to a circular linked-list queue of one node.
+      (+) Start a continuous transfer of a double buffer using @ref HAL_PSSI_Transmit_Stream_DMA()
+          or @ref HAL_PSSI_Receive_Stream_DMA()
+      (+) Each time half of the buffer is done, @ref HAL_PSSI_TxHalfCpltCallback() /
+          @ref HAL_PSSI_RxHalfCpltCallback() (first half) or @ref HAL_PSSI_TxCpltCallback() /
+          @ref HAL_PSSI_RxCpltCallback() (second half) is executed while the transfer goes on
+          with the other half.
+      (+) Give each half back with @ref HAL_PSSI_Stream_Release() once refilled or processed.
+          A half not released in time is counted in StreamOverflowCount and flagged with
+          HAL_PSSI_ERROR_STREAM_OVERFLOW.
+      (+) Stop the stream using @ref HAL_PSSI_Stop_Stream_DMA()
+
      *** PSSI HAL driver macros list ***
      ==================================
      [..]
@@ -100,6 +115,8 @@
        (+) RxCpltCallback       : callback for reception end of transfer.
        (+) ErrorCallback        : callback for error detection.
        (+) AbortCpltCallback    : callback for abort completion process.
+       (+) TxHalfCpltCallback   : callback for stream transmission half transfer.
+       (+) RxHalfCpltCallback   : callback for stream reception half transfer.
        (+) MspInitCallback      : callback for Msp Init.
        (+) MspDeInitCallback    : callback for Msp DeInit.
      This function takes as parameters the HAL peripheral handle, the Callback ID
@@ -115,6 +132,8 @@
        (+) RxCpltCallback       : callback for reception end of transfer.
        (+) ErrorCallback        : callback for error detection.
        (+) AbortCpltCallback    : callback for abort completion process.
+       (+) TxHalfCpltCallback   : callback for stream transmission half transfer.
+       (+) RxHalfCpltCallback   : callback for stream reception half transfer.
        (+) MspInitCallback      : callback for Msp Init.
        (+) MspDeInitCallback    : callback for Msp DeInit.
 
@@ -182,6 +201,11 @@ void PSSI_DMATransmitCplt(DMA_HandleTypeDef *hdma);
 void PSSI_DMAReceiveCplt(DMA_HandleTypeDef *hdma);
 void PSSI_DMAError(DMA_HandleTypeDef *hdma);
 void PSSI_DMAAbort(DMA_HandleTypeDef *hdma);
+static HAL_StatusTypeDef PSSI_Stream_Start(PSSI_HandleTypeDef *hpssi, DMA_HandleTypeDef *hdma, uint32_t *pData,
+                                           uint32_t Size, HAL_PSSI_StateTypeDef State, uint32_t Config);
+static void PSSI_Stream_Event(PSSI_HandleTypeDef *hpssi, uint32_t Half);
+static void PSSI_DMAStreamHalfCplt(DMA_HandleTypeDef *hdma);
+static void PSSI_DMAStreamCplt(DMA_HandleTypeDef *hdma);
 #endif /*HAL_DMA_MODULE_ENABLED*/
 
 /* Private functions to handle IT transfer */
@@ -269,6 +293,8 @@ HAL_StatusTypeDef HAL_PSSI_Init(PSSI_HandleTypeDef *hpssi)
     hpssi->RxCpltCallback = HAL_PSSI_RxCpltCallback; /* Legacy weak RxCpltCallback */
     hpssi->ErrorCallback        = HAL_PSSI_ErrorCallback;        /* Legacy weak ErrorCallback        */
     hpssi->AbortCpltCallback    = HAL_PSSI_AbortCpltCallback;    /* Legacy weak AbortCpltCallback    */
+    hpssi->TxHalfCpltCallback   = HAL_PSSI_TxHalfCpltCallback;   /* Legacy weak TxHalfCpltCallback   */
+    hpssi->RxHalfCpltCallback   = HAL_PSSI_RxHalfCpltCallback;   /* Legacy weak RxHalfCpltCallback   */
 
     if (hpssi->MspInitCallback == NULL)
     {
@@ -392,6 +418,8 @@ __weak void HAL_PSSI_MspDeInit(PSSI_HandleTypeDef *hpssi)
   *          @arg @ref HAL_PSSI_RX_COMPLETE_CB_ID  Rx Transfer completed callback ID
   *          @arg @ref HAL_PSSI_ERROR_CB_ID Error callback ID
   *          @arg @ref HAL_PSSI_ABORT_CB_ID Abort callback ID
+  *          @arg @ref HAL_PSSI_TX_HALF_COMPLETE_CB_ID Stream Tx half completed callback ID
+  *          @arg @ref HAL_PSSI_RX_HALF_COMPLETE_CB_ID Stream Rx half completed callback ID
   *          @arg @ref HAL_PSSI_MSPINIT_CB_ID MspInit callback ID
   *          @arg @ref HAL_PSSI_MSPDEINIT_CB_ID MspDeInit callback ID
   * @param  pCallback pointer to the Callback function
@@ -430,6 +458,14 @@ HAL_StatusTypeDef HAL_PSSI_RegisterCallback(PSSI_HandleTypeDef *hpssi, HAL_PSSI_
         hpssi->AbortCpltCallback = pCallback;
         break;
 
+      case HAL_PSSI_TX_HALF_COMPLETE_CB_ID :
+        hpssi->TxHalfCpltCallback = pCallback;
+        break;
+
+      case HAL_PSSI_RX_HALF_COMPLETE_CB_ID :
+        hpssi->RxHalfCpltCallback = pCallback;
+        break;
+
       case HAL_PSSI_MSPINIT_CB_ID :
         hpssi->MspInitCallback = pCallback;
         break;
@@ -494,6 +530,8 @@ HAL_StatusTypeDef HAL_PSSI_RegisterCallback(PSSI_HandleTypeDef *hpssi, HAL_PSSI_
   *          @arg @ref HAL_PSSI_RX_COMPLETE_CB_ID  Rx Transfer completed callback ID
   *          @arg @ref HAL_PSSI_ERROR_CB_ID Error callback ID
   *          @arg @ref HAL_PSSI_ABORT_CB_ID Abort callback ID
+  *          @arg @ref HAL_PSSI_TX_HALF_COMPLETE_CB_ID Stream Tx half completed callback ID
+  *          @arg @ref HAL_PSSI_RX_HALF_COMPLETE_CB_ID Stream Rx half completed callback ID
   *          @arg @ref HAL_PSSI_MSPINIT_CB_ID MspInit callback ID
   *          @arg @ref HAL_PSSI_MSPDEINIT_CB_ID MspDeInit callback ID
   * @retval HAL status
@@ -522,6 +560,14 @@ HAL_StatusTypeDef HAL_PSSI_UnRegisterCallback(PSSI_HandleTypeDef *hpssi, HAL_PSS
         hpssi->AbortCpltCallback = HAL_PSSI_AbortCpltCallback;       /* Legacy weak AbortCpltCallback  */
         break;
 
+      case HAL_PSSI_TX_HALF_COMPLETE_CB_ID :
+        hpssi->TxHalfCpltCallback = HAL_PSSI_TxHalfCpltCallback;     /* Legacy weak TxHalfCpltCallback */
+        break;
+
+      case HAL_PSSI_RX_HALF_COMPLETE_CB_ID :
+        hpssi->RxHalfCpltCallback = HAL_PSSI_RxHalfCpltCallback;     /* Legacy weak RxHalfCpltCallback */
+        break;
+
       case HAL_PSSI_MSPINIT_CB_ID :
         hpssi->MspInitCallback = HAL_PSSI_MspInit;                   /* Legacy weak MspInit            */
         break;
@@ -606,9 +652,17 @@ HAL_StatusTypeDef HAL_PSSI_UnRegisterCallback(PSSI_HandleTypeDef *hpssi, HAL_PSS
         (++) HAL_PSSI_Transmit_DMA()
         (++) HAL_PSSI_Receive_DMA()
 
+    (#) Continuous streaming functions with circular DMA are :
+        (++) HAL_PSSI_Transmit_Stream_DMA()
+        (++) HAL_PSSI_Receive_Stream_DMA()
+        (++) HAL_PSSI_Stream_Release()
+        (++) HAL_PSSI_Stop_Stream_DMA()
+
     (#) A set of Transfer Complete Callbacks are provided in non Blocking mode:
         (++) HAL_PSSI_TxCpltCallback()
         (++) HAL_PSSI_RxCpltCallback()
+        (++) HAL_PSSI_TxHalfCpltCallback()
+        (++) HAL_PSSI_RxHalfCpltCallback()
         (++) HAL_PSSI_ErrorCallback()
         (++) HAL_PSSI_AbortCpltCallback()
 
@@ -1313,6 +1367,176 @@ HAL_StatusTypeDef HAL_PSSI_Abort_DMA(PSSI_HandleTypeDef *hpssi)
 
   return HAL_OK;
 }
+
+/**
+  * @brief  Transmit continuously a circular buffer in non-blocking mode with DMA.
+  * @note   The DMA channel must be in linked-list mode with a circular queue of one node.
+  *         HAL_PSSI_TxHalfCpltCallback() and HAL_PSSI_TxCpltCallback() are called each time
+  *         the first and the second half of the buffer have been sent: that half is then
+  *         owned by the application, which refills it and gives it back with
+  *         HAL_PSSI_Stream_Release().
+  * @note   A half still owned when the DMA starts sending it again is counted in
+  *         StreamOverflowCount and flagged with HAL_PSSI_ERROR_STREAM_OVERFLOW.
+  * @param  hpssi Pointer to a PSSI_HandleTypeDef structure that contains
+  *                the configuration information for the specified PSSI.
+  * @param  pData Pointer to the circular buffer
+  * @param  Size Size of the circular buffer (in bytes), multiple of 8
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_PSSI_Transmit_Stream_DMA(PSSI_HandleTypeDef *hpssi, uint32_t *pData, uint32_t Size)
+{
+  if (hpssi->State == HAL_PSSI_STATE_READY)
+  {
+    if (hpssi->hdmatx == NULL)
+    {
+      /* Update PSSI error code */
+      hpssi->ErrorCode |= HAL_PSSI_ERROR_DMA;
+
+      return HAL_ERROR;
+    }
+
+    /* Configure BusWidth */
+    if (hpssi->hdmatx->Init.DestDataWidth == DMA_DEST_DATAWIDTH_BYTE)
+    {
+      return PSSI_Stream_Start(hpssi, hpssi->hdmatx, pData, Size, HAL_PSSI_STATE_BUSY_TX,
+                               PSSI_CR_OUTEN_OUTPUT |
+                               ((hpssi->Init.ClockPolarity == HAL_PSSI_RISING_EDGE) ? 0U : PSSI_CR_CKPOL));
+    }
+    else
+    {
+      return PSSI_Stream_Start(hpssi, hpssi->hdmatx, pData, Size, HAL_PSSI_STATE_BUSY_TX,
+                               hpssi->Init.BusWidth | PSSI_CR_OUTEN_OUTPUT |
+                               ((hpssi->Init.ClockPolarity == HAL_PSSI_RISING_EDGE) ? 0U : PSSI_CR_CKPOL));
+    }
+  }
+  else
+  {
+    return HAL_BUSY;
+  }
+}
+
+/**
+  * @brief  Receive continuously into a circular buffer in non-blocking mode with DMA.
+  * @note   The DMA channel must be in linked-list mode with a circular queue of one node.
+  *         HAL_PSSI_RxHalfCpltCallback() and HAL_PSSI_RxCpltCallback() are called each time
+  *         the first and the second half of the buffer have been filled: that half is then
+  *         owned by the application, which processes it while the other half is received
+  *         and gives it back with HAL_PSSI_Stream_Release().
+  * @note   A half still owned when the DMA starts filling it again is counted in
+  *         StreamOverflowCount and flagged with HAL_PSSI_ERROR_STREAM_OVERFLOW.
+  * @param  hpssi Pointer to a PSSI_HandleTypeDef structure that contains
+  *                the configuration information for the specified PSSI.
+  * @param  pData Pointer to the circular buffer
+  * @param  Size Size of the circular buffer (in bytes), multiple of 8
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_PSSI_Receive_Stream_DMA(PSSI_HandleTypeDef *hpssi, uint32_t *pData, uint32_t Size)
+{
+  if (hpssi->State == HAL_PSSI_STATE_READY)
+  {
+    if (hpssi->hdmarx == NULL)
+    {
+      /* Update PSSI error code */
+      hpssi->ErrorCode |= HAL_PSSI_ERROR_DMA;
+
+      return HAL_ERROR;
+    }
+
+    /* Configure BusWidth */
+    if (hpssi->hdmarx->Init.SrcDataWidth == DMA_SRC_DATAWIDTH_BYTE)
+    {
+      return PSSI_Stream_Start(hpssi, hpssi->hdmarx, pData, Size, HAL_PSSI_STATE_BUSY_RX,
+                               ((hpssi->Init.ClockPolarity == HAL_PSSI_RISING_EDGE) ? PSSI_CR_CKPOL : 0U));
+    }
+    else
+    {
+      return PSSI_Stream_Start(hpssi, hpssi->hdmarx, pData, Size, HAL_PSSI_STATE_BUSY_RX,
+                               hpssi->Init.BusWidth |
+                               ((hpssi->Init.ClockPolarity == HAL_PSSI_RISING_EDGE) ? PSSI_CR_CKPOL : 0U));
+    }
+  }
+  else
+  {
+    return HAL_BUSY;
+  }
+}
+
+/**
+  * @brief  Give a stream half back to the DMA once processed or refilled.
+  * @note   This function can be called from thread or interrupt context.
+  * @param  hpssi Pointer to a PSSI_HandleTypeDef structure that contains
+  *                the configuration information for the specified PSSI.
+  * @param  Half Half of the stream buffer.
+  *         This parameter can be a value of @ref PSSI_STREAM_HALF
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_PSSI_Stream_Release(PSSI_HandleTypeDef *hpssi, uint32_t Half)
+{
+  uint32_t primask_bit;
+
+  if (Half > HAL_PSSI_STREAM_SECOND_HALF)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Enter critical section: StreamHalfMask is also updated by the DMA interrupt */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  hpssi->StreamHalfMask &= ~(1UL << Half);
+
+  /* Exit critical section */
+  __set_PRIMASK(primask_bit);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop a stream started with HAL_PSSI_Transmit_Stream_DMA() or HAL_PSSI_Receive_Stream_DMA().
+  * @param  hpssi Pointer to a PSSI_HandleTypeDef structure that contains
+  *                the configuration information for the specified PSSI.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_PSSI_Stop_Stream_DMA(PSSI_HandleTypeDef *hpssi)
+{
+  DMA_HandleTypeDef *hdma;
+
+  if (hpssi->State == HAL_PSSI_STATE_BUSY_TX)
+  {
+    hdma = hpssi->hdmatx;
+  }
+  else if (hpssi->State == HAL_PSSI_STATE_BUSY_RX)
+  {
+    hdma = hpssi->hdmarx;
+  }
+  else
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hpssi);
+
+  /* Disable Interrupts */
+  HAL_PSSI_DISABLE_IT(hpssi, PSSI_FLAG_OVR_RIS);
+
+  /* Disable DMA Request */
+  hpssi->Instance->CR &= ~PSSI_CR_DMAEN;
+
+  /* Abort the DMA channel */
+  (void)HAL_DMA_Abort(hdma);
+
+  /* Disable the selected PSSI peripheral */
+  HAL_PSSI_DISABLE(hpssi);
+
+  hpssi->StreamHalfMask = 0U;
+  hpssi->State = HAL_PSSI_STATE_READY;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hpssi);
+
+  return HAL_OK;
+}
 #endif /*HAL_DMA_MODULE_ENABLED*/
 
 /**
@@ -1501,6 +1725,38 @@ __weak void HAL_PSSI_AbortCpltCallback(PSSI_HandleTypeDef *hpssi)
    */
 }
 
+/**
+  * @brief  Stream Tx half transfer complete callback.
+  * @param  hpssi Pointer to a PSSI_HandleTypeDef structure that contains
+  *                the configuration information for the specified PSSI.
+  * @retval None
+  */
+__weak void HAL_PSSI_TxHalfCpltCallback(PSSI_HandleTypeDef *hpssi)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hpssi);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_PSSI_TxHalfCpltCallback can be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Stream Rx half transfer complete callback.
+  * @param  hpssi Pointer to a PSSI_HandleTypeDef structure that contains
+  *                the configuration information for the specified PSSI.
+  * @retval None
+  */
+__weak void HAL_PSSI_RxHalfCpltCallback(PSSI_HandleTypeDef *hpssi)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hpssi);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_PSSI_RxHalfCpltCallback can be implemented in the user file
+   */
+}
+
 /**
   * @}
   */
@@ -1851,6 +2107,190 @@ void PSSI_DMAError(DMA_HandleTypeDef *hdma)
 #endif /* USE_HAL_PSSI_REGISTER_CALLBACKS */
   }
 }
+/**
+  * @brief  Start a circular DMA stream.
+  * @param  hpssi Pointer to a PSSI_HandleTypeDef structure that contains
+  *                the configuration information for the specified PSSI.
+  * @param  hdma DMA handle of the stream direction
+  * @param  pData Pointer to the circular buffer
+  * @param  Size Size of the circular buffer (in bytes)
+  * @param  State HAL_PSSI_STATE_BUSY_TX or HAL_PSSI_STATE_BUSY_RX
+  * @param  Config Bus width, output enable and clock polarity CR configuration
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef PSSI_Stream_Start(PSSI_HandleTypeDef *hpssi, DMA_HandleTypeDef *hdma, uint32_t *pData,
+                                           uint32_t Size, HAL_PSSI_StateTypeDef State, uint32_t Config)
+{
+  DMA_NodeTypeDef *pnode;
+
+  /* Each half is made of whole 32-bit words and the buffer fits in one node */
+  if ((pData == NULL) || (Size == 0U) || ((Size % 8U) != 0U) || (Size >= PSSI_MAX_NBYTE_SIZE))
+  {
+    return HAL_ERROR;
+  }
+
+  /* The stream runs on a circular linked-list queue */
+  if (((hdma->Mode & DMA_LINKEDLIST) != DMA_LINKEDLIST) || (hdma->LinkedListQueue == NULL) ||
+      (hdma->LinkedListQueue->Head == NULL) || (hdma->LinkedListQueue->FirstCircularNode == NULL))
+  {
+    /* Update PSSI error code */
+    hpssi->ErrorCode |= HAL_PSSI_ERROR_DMA;
+
+    return HAL_ERROR;
+  }
+
+  /* Disable the selected PSSI peripheral */
+  HAL_PSSI_DISABLE(hpssi);
+
+  /* Process Locked */
+  __HAL_LOCK(hpssi);
+
+  hpssi->State       = State;
+  hpssi->ErrorCode   = HAL_PSSI_ERROR_NONE;
+
+  /* Prepare transfer parameters */
+  hpssi->pBuffPtr    = pData;
+  hpssi->XferSize    = Size;
+  hpssi->XferCount   = 0U;
+  hpssi->StreamHalfMask      = 0U;
+  hpssi->StreamOverflowCount = 0U;
+
+  MODIFY_REG(hpssi->Instance->CR, PSSI_CR_DMAEN | PSSI_CR_OUTEN | PSSI_CR_CKPOL,
+             PSSI_CR_DMA_ENABLE | Config);
+
+  /* Set the PSSI DMA stream callbacks */
+  hdma->XferHalfCpltCallback = PSSI_DMAStreamHalfCplt;
+  hdma->XferCpltCallback = PSSI_DMAStreamCplt;
+
+  /* Set the DMA error callback */
+  hdma->XferErrorCallback = PSSI_DMAError;
+
+  /* Set the unused DMA callbacks to NULL */
+  hdma->XferAbortCallback = NULL;
+
+  /* Set Source , Destination , Length for DMA Xfer */
+  pnode = hdma->LinkedListQueue->Head;
+  pnode->LinkRegisters[NODE_CBR1_DEFAULT_OFFSET] = Size;
+  if (State == HAL_PSSI_STATE_BUSY_TX)
+  {
+    pnode->LinkRegisters[NODE_CSAR_DEFAULT_OFFSET] = (uint32_t)pData;
+    pnode->LinkRegisters[NODE_CDAR_DEFAULT_OFFSET] = (uint32_t)&hpssi->Instance->DR;
+  }
+  else
+  {
+    pnode->LinkRegisters[NODE_CSAR_DEFAULT_OFFSET] = (uint32_t)&hpssi->Instance->DR;
+    pnode->LinkRegisters[NODE_CDAR_DEFAULT_OFFSET] = (uint32_t)pData;
+  }
+
+  if (HAL_DMAEx_List_Start_IT(hdma) != HAL_OK)
+  {
+    /* Update PSSI state */
+    hpssi->State     = HAL_PSSI_STATE_READY;
+
+    /* Update PSSI error code */
+    hpssi->ErrorCode |= HAL_PSSI_ERROR_DMA;
+
+    /* Process Unlocked */
+    __HAL_UNLOCK(hpssi);
+
+    return HAL_ERROR;
+  }
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hpssi);
+
+  /* Note : The PSSI interrupts must be enabled after unlocking current process
+            to avoid the risk of PSSI interrupt handle execution before current
+            process unlock */
+  /* Enable ERR  interrupt */
+  HAL_PSSI_ENABLE_IT(hpssi, PSSI_FLAG_OVR_RIS);
+
+  /* Enable the selected PSSI peripheral */
+  HAL_PSSI_ENABLE(hpssi);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Hand a completed stream half over to the application.
+  * @param  hpssi PSSI handle.
+  * @param  Half Half of the stream buffer completed by the DMA.
+  * @retval None
+  */
+static void PSSI_Stream_Event(PSSI_HandleTypeDef *hpssi, uint32_t Half)
+{
+  uint32_t next = Half ^ 1U;
+
+  hpssi->StreamHalfMask |= (1UL << Half);
+
+  /* The DMA goes on with the other half: it must have been released */
+  if ((hpssi->StreamHalfMask & (1UL << next)) != 0U)
+  {
+    hpssi->StreamHalfMask &= ~(1UL << next);
+    hpssi->StreamOverflowCount++;
+    hpssi->ErrorCode |= HAL_PSSI_ERROR_STREAM_OVERFLOW;
+  }
+}
+
+/**
+  * @brief  DMA PSSI stream half transfer complete callback.
+  * @param  hdma DMA handle
+  * @retval None
+  */
+static void PSSI_DMAStreamHalfCplt(DMA_HandleTypeDef *hdma)
+{
+  /* Derogation MISRAC2012-Rule-11.5 */
+  PSSI_HandleTypeDef *hpssi = (PSSI_HandleTypeDef *)(((DMA_HandleTypeDef *)hdma)->Parent);
+
+  PSSI_Stream_Event(hpssi, HAL_PSSI_STREAM_FIRST_HALF);
+
+  if (hpssi->State == HAL_PSSI_STATE_BUSY_TX)
+  {
+#if (USE_HAL_PSSI_REGISTER_CALLBACKS == 1)
+    hpssi->TxHalfCpltCallback(hpssi);
+#else
+    HAL_PSSI_TxHalfCpltCallback(hpssi);
+#endif /* USE_HAL_PSSI_REGISTER_CALLBACKS */
+  }
+  else
+  {
+#if (USE_HAL_PSSI_REGISTER_CALLBACKS == 1)
+    hpssi->RxHalfCpltCallback(hpssi);
+#else
+    HAL_PSSI_RxHalfCpltCallback(hpssi);
+#endif /* USE_HAL_PSSI_REGISTER_CALLBACKS */
+  }
+}
+
+/**
+  * @brief  DMA PSSI stream transfer complete callback, the DMA wraps to the first half.
+  * @param  hdma DMA handle
+  * @retval None
+  */
+static void PSSI_DMAStreamCplt(DMA_HandleTypeDef *hdma)
+{
+  /* Derogation MISRAC2012-Rule-11.5 */
+  PSSI_HandleTypeDef *hpssi = (PSSI_HandleTypeDef *)(((DMA_HandleTypeDef *)hdma)->Parent);
+
+  PSSI_Stream_Event(hpssi, HAL_PSSI_STREAM_SECOND_HALF);
+
+  if (hpssi->State == HAL_PSSI_STATE_BUSY_TX)
+  {
+#if (USE_HAL_PSSI_REGISTER_CALLBACKS == 1)
+    hpssi->TxCpltCallback(hpssi);
+#else
+    HAL_PSSI_TxCpltCallback(hpssi);
+#endif /* USE_HAL_PSSI_REGISTER_CALLBACKS */
+  }
+  else
+  {
+#if (USE_HAL_PSSI_REGISTER_CALLBACKS == 1)
+    hpssi->RxCpltCallback(hpssi);
+#else
+    HAL_PSSI_RxCpltCallback(hpssi);
+#endif /* USE_HAL_PSSI_REGISTER_CALLBACKS */
+  }
+}
 #endif /*HAL_DMA_MODULE_ENABLED*/
 
 
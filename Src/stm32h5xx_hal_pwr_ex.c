@@ -10,6 +10,7 @@
   *           + Wakeup Pins configuration Functions
   *           + Memories Retention Functions
   *           + IO and JTAG Retention Functions
+  *           + Low-Power Manager Functions
   ******************************************************************************
   * @attention
   *
@@ -66,6 +67,22 @@
 /* Wake-Up Pins PWR Pin Pull shift offsets */
 #define PWR_WAKEUP_PINS_PULL_SHIFT_OFFSET (2U)
 
+/**
+  * @}
+  */
+
+/** @defgroup PWREx_PM_Defines PWREx Low-Power Manager defines
+  * @{
+  */
+#if defined(RCC_CR_PLL3ON)
+#define PWR_PM_PLL_MASK        (RCC_CR_PLL1ON | RCC_CR_PLL2ON | RCC_CR_PLL3ON)
+#else
+#define PWR_PM_PLL_MASK        (RCC_CR_PLL1ON | RCC_CR_PLL2ON)
+#endif /* RCC_CR_PLL3ON */
+#define PWR_PM_OSC_MASK        (RCC_CR_HSION | RCC_CR_CSION | RCC_CR_HSEON | RCC_CR_HSI48ON)
+/* Oscillator and PLL ready wait after wake-up, the tick being stopped: about 20 ms at 64 MHz */
+#define PWR_PM_READY_LOOPS     (0x40000U)
+
 /**
   * @}
   */
@@ -76,7 +93,12 @@
 
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
+/* Low-power manager registered by HAL_PWREx_PM_Init() */
+static PWREx_PMTypeDef *pPWREx_PM = NULL;
+
 /* Private function prototypes -----------------------------------------------*/
+static HAL_StatusTypeDef PWREx_PM_RestoreClocks(uint32_t Oscillators);
+
 /* Exported functions --------------------------------------------------------*/
 
 /** @defgroup PWREx_Exported_Functions PWR Extended Exported Functions
@@ -899,12 +921,272 @@ void HAL_PWREx_DisableStandbyJTAGIORetention(void)
 /**
   * @}
   */
-#endif /* defined (HAL_PWR_MODULE_ENABLED) */
+
+/** @defgroup PWREx_Exported_Functions_Group6 Low-Power Manager Functions
+  * @brief    Low-Power Manager functions
+  *
+@verbatim
+ ===============================================================================
+                     ##### Low-Power Manager Functions #####
+ ===============================================================================
+    [..]
+      The low-power manager enters the deepest low-power mode allowed by the ongoing
+      activities when the application is idle:
+      (+) Fill the pRunProfile and WakeUpClock fields of a PWREx_PMTypeDef structure and
+          call HAL_PWREx_PM_Init(). The run profile is built with HAL_RCCEx_InitProfile().
+      (+) Call HAL_PWREx_PM_Lock(PWR_PM_MODE_STOP) when an activity starts that needs its
+          clocks (e.g. from a driver transfer start function) and HAL_PWREx_PM_Unlock() when
+          it ends (e.g. from its completion callback). Use PWR_PM_MODE_SLEEP for activities
+          that need the CPU running. The locks can be taken from interrupt context.
+      (+) Call HAL_PWREx_PM_Idle() from the idle loop: the Stop mode is entered when no
+          lock is taken, the Sleep mode when only Stop locks are taken.
+      [..]
+      At wake-up from Stop mode, the oscillators and PLLs that were on are restarted, then
+      the run profile is applied with HAL_RCCEx_SwitchProfile(), all before the interrupts
+      are unmasked: the wake-up interrupt handler runs at the full frequency. The HSI wake-up
+      clock gives the fastest clocks restart.
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initialize and register the low-power manager.
+  * @param  pPM Pointer to a PWREx_PMTypeDef structure that contains the wake-up configuration,
+  *         kept by the manager.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_PWREx_PM_Init(PWREx_PMTypeDef *pPM)
+{
+  if (pPM == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameter */
+  assert_param(IS_RCC_STOP_WAKEUPCLOCK(pPM->WakeUpClock));
+
+  pPM->StopLocks       = 0U;
+  pPM->SleepLocks      = 0U;
+  pPM->NbSleep         = 0U;
+  pPM->NbStop          = 0U;
+  pPM->NbRestoreErrors = 0U;
+
+  HAL_RCCEx_WakeUpStopCLKConfig(pPM->WakeUpClock);
+
+  pPWREx_PM = pPM;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Forbid a low-power mode and the deeper ones during an activity.
+  * @param  Mode Low-power mode not allowed, a value of @ref PWREx_PM_Mode
+  *         (PWR_PM_MODE_SLEEP or PWR_PM_MODE_STOP).
+  * @retval None
+  */
+void HAL_PWREx_PM_Lock(uint32_t Mode)
+{
+  uint32_t primask_bit;
+
+  if (pPWREx_PM == NULL)
+  {
+    return;
+  }
+
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  if (Mode == PWR_PM_MODE_SLEEP)
+  {
+    pPWREx_PM->SleepLocks++;
+  }
+  else if (Mode == PWR_PM_MODE_STOP)
+  {
+    pPWREx_PM->StopLocks++;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  __set_PRIMASK(primask_bit);
+}
+
+/**
+  * @brief  Release a lock taken by HAL_PWREx_PM_Lock() at the end of an activity.
+  * @param  Mode Low-power mode given to HAL_PWREx_PM_Lock(), a value of @ref PWREx_PM_Mode
+  * @retval None
+  */
+void HAL_PWREx_PM_Unlock(uint32_t Mode)
+{
+  uint32_t primask_bit;
+
+  if (pPWREx_PM == NULL)
+  {
+    return;
+  }
+
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  if ((Mode == PWR_PM_MODE_SLEEP) && (pPWREx_PM->SleepLocks != 0U))
+  {
+    pPWREx_PM->SleepLocks--;
+  }
+  else if ((Mode == PWR_PM_MODE_STOP) && (pPWREx_PM->StopLocks != 0U))
+  {
+    pPWREx_PM->StopLocks--;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  __set_PRIMASK(primask_bit);
+}
+
+/**
+  * @brief  Get the deepest low-power mode allowed by the ongoing activities.
+  * @retval Low-power mode, a value of @ref PWREx_PM_Mode
+  */
+uint32_t HAL_PWREx_PM_GetAllowedMode(void)
+{
+  uint32_t mode;
+
+  if (pPWREx_PM == NULL)
+  {
+    mode = PWR_PM_MODE_RUN;
+  }
+  else if (pPWREx_PM->SleepLocks != 0U)
+  {
+    mode = PWR_PM_MODE_RUN;
+  }
+  else if (pPWREx_PM->StopLocks != 0U)
+  {
+    mode = PWR_PM_MODE_SLEEP;
+  }
+  else
+  {
+    mode = PWR_PM_MODE_STOP;
+  }
+
+  return mode;
+}
+
+/**
+  * @brief  Enter the deepest allowed low-power mode until the next interrupt.
+  * @note   The interrupts are masked from the mode selection to the clocks restoration so
+  *         that a lock taken by an interrupt handler is never missed, the pending interrupt
+  *         being served when the function returns.
+  * @retval Low-power mode entered, a value of @ref PWREx_PM_Mode
+  */
+uint32_t HAL_PWREx_PM_Idle(void)
+{
+  uint32_t primask_bit;
+  uint32_t mode;
+  uint32_t oscillators;
+
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  mode = HAL_PWREx_PM_GetAllowedMode();
+
+  if (mode == PWR_PM_MODE_STOP)
+  {
+    /* Cleared by the hardware at Stop mode entry */
+    oscillators = READ_BIT(RCC->CR, (PWR_PM_OSC_MASK | PWR_PM_PLL_MASK));
+
+    HAL_SuspendTick();
+
+    HAL_PWR_EnterSTOPMode(PWR_LOWPOWERREGULATOR_ON, PWR_STOPENTRY_WFI);
+
+    pPWREx_PM->NbStop++;
+
+    if (PWREx_PM_RestoreClocks(oscillators) != HAL_OK)
+    {
+      pPWREx_PM->NbRestoreErrors++;
+    }
+
+    HAL_ResumeTick();
+  }
+  else if (mode == PWR_PM_MODE_SLEEP)
+  {
+    HAL_PWR_EnterSLEEPMode(PWR_MAINREGULATOR_ON, PWR_SLEEPENTRY_WFI);
+
+    pPWREx_PM->NbSleep++;
+  }
+  else
+  {
+    /* An activity needs the CPU */
+  }
+
+  __set_PRIMASK(primask_bit);
+
+  return mode;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/** @defgroup PWREx_Private_Functions PWREx Private Functions
+  * @{
+  */
+
+/**
+  * @brief  Restart the oscillators and PLLs stopped by the Stop mode and apply the run profile.
+  * @param  Oscillators RCC_CR oscillators and PLLs enable bits before the Stop mode entry.
+  * @note   The ready flags are polled with a loop count, the tick being suspended.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef PWREx_PM_RestoreClocks(uint32_t Oscillators)
+{
+  uint32_t ready = (Oscillators & (PWR_PM_OSC_MASK | PWR_PM_PLL_MASK)) << 1U;
+  uint32_t loops;
+
+  /* Sources first, each ready flag being next to its enable bit */
+  SET_BIT(RCC->CR, (Oscillators & PWR_PM_OSC_MASK));
+  loops = PWR_PM_READY_LOOPS;
+  while ((READ_BIT(RCC->CR, (ready & (PWR_PM_OSC_MASK << 1U))) != (ready & (PWR_PM_OSC_MASK << 1U))) &&
+         (loops != 0U))
+  {
+    loops--;
+  }
+
+  /* Then the PLLs, their configuration being kept in Stop mode */
+  SET_BIT(RCC->CR, (Oscillators & PWR_PM_PLL_MASK));
+  while ((READ_BIT(RCC->CR, ready) != ready) && (loops != 0U))
+  {
+    loops--;
+  }
+
+  if (loops == 0U)
+  {
+    SystemCoreClockUpdate();
+    (void)HAL_InitTick(uwTickPrio);
+    return HAL_ERROR;
+  }
+
+  if (pPWREx_PM->pRunProfile != NULL)
+  {
+    return HAL_RCCEx_SwitchProfile(pPWREx_PM->pRunProfile);
+  }
+
+  /* Still running from the wake-up clock */
+  SystemCoreClockUpdate();
+  return HAL_InitTick(uwTickPrio);
+}
 
 /**
   * @}
   */
 
+#endif /* defined (HAL_PWR_MODULE_ENABLED) */
+
 /**
   * @}
   */
@@ -106,6 +106,13 @@
           (+) SRAM2 write protected pages are erased when performing an erase
               through RAMCFG.
 
+          (+) Call HAL_RAMCFG_Erase_Start() on several SRAMs to erase them in
+              parallel while the CPU goes on with the initialization, the erase
+              also initializing the ECC of SRAM2 and SRAM3. Then call
+              HAL_RAMCFG_Erase_Process() from the application loop, or
+              HAL_RAMCFG_Erase_WaitAll() once the SRAMs are needed.
+              HAL_RAMCFG_EraseCpltCallback() is called for each completed erase.
+
      *** RAMCFG HAL driver macros list ***
      =====================================
      [..]
@@ -266,6 +273,7 @@ HAL_StatusTypeDef HAL_RAMCFG_DeInit(RAMCFG_HandleTypeDef *hramcfg)
   /* Clean callbacks */
   hramcfg->DetectSingleErrorCallback = NULL;
   hramcfg->DetectDoubleErrorCallback = NULL;
+  hramcfg->EraseCpltCallback         = NULL;
 #else
   HAL_RAMCFG_MspDeInit(hramcfg);
 #endif /* USE_HAL_RAMCFG_REGISTER_CALLBACKS */
@@ -722,6 +730,10 @@ HAL_StatusTypeDef HAL_RAMCFG_EnableWriteProtection(RAMCFG_HandleTypeDef *hramcfg
     [..]
       The HAL_RAMCFG_Erase() function allows a hardware mass erase for the given
       SRAM. The erase value for all SRAMs is 0.
+    [..]
+      The HAL_RAMCFG_Erase_Start() function launches the erase and returns, the
+      completion being checked by HAL_RAMCFG_Erase_Process() or waited for
+      several SRAMs by HAL_RAMCFG_Erase_WaitAll().
 
 @endverbatim
   * @{
@@ -785,6 +797,150 @@ HAL_StatusTypeDef HAL_RAMCFG_Erase(RAMCFG_HandleTypeDef *hramcfg)
   return HAL_OK;
 }
 
+/**
+  * @brief  Launch a Mass Erase for the given SRAM without waiting for its end.
+  * @note   The RAMCFG stays in busy state until the end of the erase is seen by
+  *         HAL_RAMCFG_Erase_Process() or HAL_RAMCFG_Erase_WaitAll().
+  * @param  hramcfg       : Pointer to a RAMCFG_HandleTypeDef structure that
+  *                         contains the configuration information for the
+  *                         specified RAMCFG instance.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_RAMCFG_Erase_Start(RAMCFG_HandleTypeDef *hramcfg)
+{
+  /* Check the parameters */
+  assert_param(IS_RAMCFG_ALL_INSTANCE(hramcfg->Instance));
+
+  /* Check RAMCFG state */
+  if (hramcfg->State != HAL_RAMCFG_STATE_READY)
+  {
+    /* Update the error code and return error status */
+    hramcfg->ErrorCode = HAL_RAMCFG_ERROR_BUSY;
+    return HAL_ERROR;
+  }
+
+  /* Update RAMCFG peripheral state */
+  hramcfg->State = HAL_RAMCFG_STATE_BUSY;
+
+  /* Unlock the RAMCFG erase bit */
+  WRITE_REG(hramcfg->Instance->ERKEYR, RAMCFG_ERASE_KEY1);
+  WRITE_REG(hramcfg->Instance->ERKEYR, RAMCFG_ERASE_KEY2);
+
+  /* Start the SRAM erase operation */
+  hramcfg->Instance->CR |= RAMCFG_CR_SRAMER;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Check the end of an erase launched by HAL_RAMCFG_Erase_Start().
+  * @note   HAL_RAMCFG_EraseCpltCallback() is called when the end of the erase
+  *         is seen.
+  * @param  hramcfg       : Pointer to a RAMCFG_HandleTypeDef structure that
+  *                         contains the configuration information for the
+  *                         specified RAMCFG instance.
+  * @retval HAL status: HAL_BUSY while the erase is ongoing, HAL_OK otherwise.
+  */
+HAL_StatusTypeDef HAL_RAMCFG_Erase_Process(RAMCFG_HandleTypeDef *hramcfg)
+{
+  /* Check the parameters */
+  assert_param(IS_RAMCFG_ALL_INSTANCE(hramcfg->Instance));
+
+  /* No erase ongoing */
+  if (hramcfg->State != HAL_RAMCFG_STATE_BUSY)
+  {
+    return HAL_OK;
+  }
+
+  if (__HAL_RAMCFG_GET_FLAG(hramcfg, RAMCFG_FLAG_SRAMBUSY) != 0U)
+  {
+    return HAL_BUSY;
+  }
+
+  /* Update the RAMCFG state */
+  hramcfg->State = HAL_RAMCFG_STATE_READY;
+
+#if (USE_HAL_RAMCFG_REGISTER_CALLBACKS == 1)
+  /* Check if a valid erase complete callback is registered */
+  if (hramcfg->EraseCpltCallback != NULL)
+  {
+    /* Erase complete callback */
+    hramcfg->EraseCpltCallback(hramcfg);
+  }
+#else
+  HAL_RAMCFG_EraseCpltCallback(hramcfg);
+#endif /* USE_HAL_RAMCFG_REGISTER_CALLBACKS */
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Wait for the end of the erases launched by HAL_RAMCFG_Erase_Start().
+  * @param  hramcfg       : Table of pointers to RAMCFG_HandleTypeDef structures.
+  * @param  NbInstances   : Number of RAMCFG handles in the table.
+  * @param  Timeout       : Timeout duration in ms for all the erases.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_RAMCFG_Erase_WaitAll(RAMCFG_HandleTypeDef *const hramcfg[], uint32_t NbInstances,
+                                           uint32_t Timeout)
+{
+  uint32_t tickstart = HAL_GetTick();
+  uint32_t ongoing;
+  uint32_t i;
+
+  if (hramcfg == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  do
+  {
+    ongoing = 0U;
+
+    for (i = 0U; i < NbInstances; i++)
+    {
+      if (HAL_RAMCFG_Erase_Process(hramcfg[i]) == HAL_BUSY)
+      {
+        ongoing++;
+      }
+    }
+
+    if ((ongoing != 0U) && ((HAL_GetTick() - tickstart) > Timeout))
+    {
+      for (i = 0U; i < NbInstances; i++)
+      {
+        if (hramcfg[i]->State == HAL_RAMCFG_STATE_BUSY)
+        {
+          /* Update the RAMCFG error code */
+          hramcfg[i]->ErrorCode = HAL_RAMCFG_ERROR_TIMEOUT;
+
+          /* Update the RAMCFG state */
+          hramcfg[i]->State = HAL_RAMCFG_STATE_ERROR;
+        }
+      }
+      return HAL_ERROR;
+    }
+  } while (ongoing != 0U);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  RAMCFG erase complete callback.
+  * @param  hramcfg : Pointer to a RAMCFG_HandleTypeDef structure that contains
+  *                   the configuration information for the specified RAMCFG.
+  * @retval None.
+  */
+__weak void HAL_RAMCFG_EraseCpltCallback(RAMCFG_HandleTypeDef *hramcfg)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hramcfg);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_RAMCFG_EraseCpltCallback can be implemented in the user
+            file.                                                             */
+}
+
 /**
   * @}
   */
@@ -935,6 +1091,11 @@ HAL_StatusTypeDef HAL_RAMCFG_RegisterCallback(RAMCFG_HandleTypeDef *hramcfg,
         hramcfg->DetectDoubleErrorCallback = pCallback;
         break;
 
+      case  HAL_RAMCFG_ERASE_CPLT_CB_ID:
+        /* Register erase complete callback */
+        hramcfg->EraseCpltCallback = pCallback;
+        break;
+
       case HAL_RAMCFG_MSPINIT_CB_ID :
         /* Register msp init callback */
         hramcfg->MspInitCallback = pCallback;
@@ -1014,6 +1175,11 @@ HAL_StatusTypeDef HAL_RAMCFG_UnRegisterCallback(RAMCFG_HandleTypeDef *hramcfg, H
         hramcfg->DetectDoubleErrorCallback = NULL;
         break;
 
+      case  HAL_RAMCFG_ERASE_CPLT_CB_ID:
+        /* UnRegister erase complete callback */
+        hramcfg->EraseCpltCallback = NULL;
+        break;
+
       case HAL_RAMCFG_MSPINIT_CB_ID :
         /* UnRegister msp init callback */
         hramcfg->MspInitCallback = NULL;
@@ -1028,6 +1194,7 @@ HAL_StatusTypeDef HAL_RAMCFG_UnRegisterCallback(RAMCFG_HandleTypeDef *hramcfg, H
         /* UnRegister all available callbacks */
         hramcfg->DetectSingleErrorCallback = NULL;
         hramcfg->DetectDoubleErrorCallback = NULL;
+        hramcfg->EraseCpltCallback         = NULL;
         hramcfg->MspDeInitCallback         = NULL;
         hramcfg->MspInitCallback           = NULL;
         break;
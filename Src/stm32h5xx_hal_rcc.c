@@ -260,6 +260,11 @@ HAL_StatusTypeDef HAL_RCC_DeInit(void)
 {
   uint32_t tickstart;
 
+#if defined(USE_HAL_RCC_FREQ_CACHE) && (USE_HAL_RCC_FREQ_CACHE == 1U)
+  /* The cached peripheral clock frequencies may change */
+  HAL_RCCEx_InvalidateFreqCache();
+#endif /* USE_HAL_RCC_FREQ_CACHE */
+
   /* Increasing the CPU frequency */
   if (FLASH_LATENCY_DEFAULT  > __HAL_FLASH_GET_LATENCY())
   {
@@ -471,6 +476,11 @@ HAL_StatusTypeDef HAL_RCC_OscConfig(const RCC_OscInitTypeDef  *pOscInitStruct)
     return HAL_ERROR;
   }
 
+#if defined(USE_HAL_RCC_FREQ_CACHE) && (USE_HAL_RCC_FREQ_CACHE == 1U)
+  /* The cached peripheral clock frequencies may change */
+  HAL_RCCEx_InvalidateFreqCache();
+#endif /* USE_HAL_RCC_FREQ_CACHE */
+
   /* Check the parameters */
   assert_param(IS_RCC_OSCILLATORTYPE(pOscInitStruct->OscillatorType));
   temp_sysclksrc = __HAL_RCC_GET_SYSCLK_SOURCE();
@@ -1040,6 +1050,11 @@ HAL_StatusTypeDef HAL_RCC_ClockConfig(const RCC_ClkInitTypeDef  *pClkInitStruct,
     return HAL_ERROR;
   }
 
+#if defined(USE_HAL_RCC_FREQ_CACHE) && (USE_HAL_RCC_FREQ_CACHE == 1U)
+  /* The cached peripheral clock frequencies may change */
+  HAL_RCCEx_InvalidateFreqCache();
+#endif /* USE_HAL_RCC_FREQ_CACHE */
+
   /* Check the parameters */
   assert_param(IS_RCC_CLOCKTYPE(pClkInitStruct->ClockType));
   assert_param(IS_FLASH_LATENCY(FLatency));
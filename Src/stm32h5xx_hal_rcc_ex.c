@@ -8,6 +8,7 @@
   *           + Extended Peripheral Control functions
   *           + Extended Clock management functions
   *           + Extended Clock Recovery System Control functions
+  *           + Extended Clock Profile functions
   *
   ******************************************************************************
   * @attention
@@ -37,6 +38,15 @@
 #ifdef HAL_RCC_MODULE_ENABLED
 
 /* Private typedef -----------------------------------------------------------*/
+#if defined(USE_HAL_RCC_FREQ_CACHE) && (USE_HAL_RCC_FREQ_CACHE == 1U)
+/* Cached peripheral clock frequency */
+typedef struct
+{
+  uint64_t PeriphClk;
+  uint32_t Frequency;
+} RCCEx_FreqCacheEntryTypeDef;
+#endif /* USE_HAL_RCC_FREQ_CACHE */
+
 /* Private defines -----------------------------------------------------------*/
 /** @defgroup RCCEx_Private_Constants RCCEx Private Constants
   * @{
@@ -46,6 +56,15 @@
 #if defined(RCC_CR_PLL3ON)
 #define PLL3_TIMEOUT_VALUE     ((uint32_t)2U)          /* 2 ms (minimum Tick + 1) */
 #endif /* RCC_CR_PLL3ON */
+#define RCCEx_CLOCKSWITCH_TIMEOUT_VALUE ((uint32_t)5000U) /* 5 s */
+
+#define RCCEx_PROFILE_CFGR2_MASK      (RCC_CFGR2_HPRE | RCC_CFGR2_PPRE1 | RCC_CFGR2_PPRE2 | RCC_CFGR2_PPRE3)
+#define RCCEx_PROFILE_LATENCY_NB      6U          /* Number of Flash wait states used by the profiles */
+#define RCCEx_PROGRAM_DELAY_0_FREQ    84000000U   /* Maximum HCLK frequency for the programming delay 0 */
+#define RCCEx_PROGRAM_DELAY_1_FREQ    168000000U  /* Maximum HCLK frequency for the programming delay 1 */
+#if defined(USE_HAL_RCC_FREQ_CACHE) && (USE_HAL_RCC_FREQ_CACHE == 1U)
+#define RCCEx_FREQ_CACHE_SIZE         8U          /* Number of cached peripheral clock frequencies */
+#endif /* USE_HAL_RCC_FREQ_CACHE */
 
 /**
   * @}
@@ -53,11 +72,44 @@
 
 /* Private macros ------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
+/* Maximum HCLK frequency in MHz for each number of Flash wait states, per voltage scaling
+   (from range 3 to range 0), 0 when the number of wait states is not used in the range */
+static const uint8_t RCCEx_LatencyMaxFreq[4][RCCEx_PROFILE_LATENCY_NB] =
+{
+  { 20U,  40U,  60U,  80U, 100U,   0U},
+  { 30U,  60U,  90U, 120U, 150U,   0U},
+  { 34U,  68U, 102U, 136U, 170U, 200U},
+  { 42U,  84U, 126U, 168U, 210U, 250U}
+};
+
+#if defined(USE_HAL_RCC_FREQ_CACHE) && (USE_HAL_RCC_FREQ_CACHE == 1U)
+/* Peripheral clock frequencies, valid while the clock registers match the snapshot */
+static RCCEx_FreqCacheEntryTypeDef RCCEx_FreqCache[RCCEx_FREQ_CACHE_SIZE];
+static uint32_t RCCEx_FreqCacheNb;
+static uint32_t RCCEx_FreqCacheNext;
+static __IO uint32_t RCCEx_FreqCacheGeneration;
+static uint32_t RCCEx_FreqCacheCR;
+static uint32_t RCCEx_FreqCacheCFGR1;
+static uint32_t RCCEx_FreqCacheCFGR2;
+#endif /* USE_HAL_RCC_FREQ_CACHE */
+
+#if defined(CRS)
+/* CRS monitor statistics, updated by HAL_RCCEx_CRS_IRQHandler() while the monitor runs */
+static RCC_CRSMonitorStatsTypeDef RCCEx_CRSStats;
+static uint32_t RCCEx_CRSTolerancePpm;
+static uint32_t RCCEx_CRSMonitorEnabled;
+#endif /* CRS */
+
 /* Private function prototypes -----------------------------------------------*/
 /** @defgroup RCCEx_Private_Functions RCCEx Private Functions
   * @{
   */
 static HAL_StatusTypeDef RCCEx_PLLSource_Enable(uint32_t PllSource);
+#if defined(CRS)
+static void RCCEx_CRSMonitorUpdate(uint32_t itflags);
+#endif /* CRS */
+static uint32_t RCCEx_GetSysClockSourceFreq(uint32_t SYSCLKSource);
+static uint32_t RCCEx_GetPeriphCLKFreq(uint64_t PeriphClk);
 static HAL_StatusTypeDef RCCEx_PLL2_Config(const RCC_PLL2InitTypeDef *Pll2);
 #if defined(RCC_CR_PLL3ON)
 static HAL_StatusTypeDef RCCEx_PLL3_Config(const RCC_PLL3InitTypeDef *Pll3);
@@ -171,6 +223,11 @@ HAL_StatusTypeDef HAL_RCCEx_PeriphCLKConfig(const RCC_PeriphCLKInitTypeDef  *pPe
   HAL_StatusTypeDef ret = HAL_OK;      /* Intermediate status */
   HAL_StatusTypeDef status = HAL_OK;   /* Final status */
 
+#if defined(USE_HAL_RCC_FREQ_CACHE) && (USE_HAL_RCC_FREQ_CACHE == 1U)
+  /* The cached peripheral clock frequencies may change */
+  HAL_RCCEx_InvalidateFreqCache();
+#endif /* USE_HAL_RCC_FREQ_CACHE */
+
   /* Check the parameters */
   assert_param(IS_RCC_PERIPHCLOCK(pPeriphClkInit->PeriphClockSelection));
 
@@ -3758,8 +3815,100 @@ void HAL_RCCEx_GetPLL3ClockFreq(PLL3_ClocksTypeDef *pPLL3_Clocks)
   *  (***)   : For stm32h503xx family line only.
   *  (****)  : For stm32h5exxx and stm32h5fxxx family lines only.
   *  (*****) : Not available for stm32h5exxx and stm32h5fxxx family lines.
+  *
+  * @note   With USE_HAL_RCC_FREQ_CACHE set, the last frequencies are cached until a RCC
+  *         configuration function is called or the oscillators, the system clock source or the
+  *         bus prescalers change (e.g. at wake-up from Stop mode). HAL_RCCEx_InvalidateFreqCache()
+  *         must be called after a kernel clock selection or PLL change done with the macros.
   */
 uint32_t HAL_RCCEx_GetPeriphCLKFreq(uint64_t PeriphClk)
+{
+#if defined(USE_HAL_RCC_FREQ_CACHE) && (USE_HAL_RCC_FREQ_CACHE == 1U)
+  uint32_t frequency;
+  uint32_t generation;
+  uint32_t index;
+  uint32_t primask_bit;
+
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  /* Drop the cache when the clocks changed behind the RCC configuration functions */
+  if ((RCCEx_FreqCacheCR != READ_REG(RCC->CR)) || (RCCEx_FreqCacheCFGR1 != READ_REG(RCC->CFGR1)) ||
+      (RCCEx_FreqCacheCFGR2 != READ_REG(RCC->CFGR2)))
+  {
+    RCCEx_FreqCacheNb = 0U;
+    RCCEx_FreqCacheCR = READ_REG(RCC->CR);
+    RCCEx_FreqCacheCFGR1 = READ_REG(RCC->CFGR1);
+    RCCEx_FreqCacheCFGR2 = READ_REG(RCC->CFGR2);
+    RCCEx_FreqCacheGeneration++;
+  }
+
+  for (index = 0U; index < RCCEx_FreqCacheNb; index++)
+  {
+    if (RCCEx_FreqCache[index].PeriphClk == PeriphClk)
+    {
+      frequency = RCCEx_FreqCache[index].Frequency;
+      __set_PRIMASK(primask_bit);
+      return frequency;
+    }
+  }
+
+  generation = RCCEx_FreqCacheGeneration;
+  __set_PRIMASK(primask_bit);
+
+  /* Computed with the interrupts enabled */
+  frequency = RCCEx_GetPeriphCLKFreq(PeriphClk);
+
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  /* Not stored when the cache was invalidated meanwhile */
+  if (generation == RCCEx_FreqCacheGeneration)
+  {
+    RCCEx_FreqCache[RCCEx_FreqCacheNext].PeriphClk = PeriphClk;
+    RCCEx_FreqCache[RCCEx_FreqCacheNext].Frequency = frequency;
+    RCCEx_FreqCacheNext = (RCCEx_FreqCacheNext + 1U) % RCCEx_FREQ_CACHE_SIZE;
+    if (RCCEx_FreqCacheNb < RCCEx_FREQ_CACHE_SIZE)
+    {
+      RCCEx_FreqCacheNb++;
+    }
+  }
+
+  __set_PRIMASK(primask_bit);
+
+  return frequency;
+#else
+  return RCCEx_GetPeriphCLKFreq(PeriphClk);
+#endif /* USE_HAL_RCC_FREQ_CACHE */
+}
+
+/**
+  * @brief  Invalidate the cached peripheral clock frequencies.
+  * @note   Called by the RCC configuration functions, nothing is done when
+  *         USE_HAL_RCC_FREQ_CACHE is not set.
+  * @retval None
+  */
+void HAL_RCCEx_InvalidateFreqCache(void)
+{
+#if defined(USE_HAL_RCC_FREQ_CACHE) && (USE_HAL_RCC_FREQ_CACHE == 1U)
+  uint32_t primask_bit;
+
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  RCCEx_FreqCacheNb = 0U;
+  RCCEx_FreqCacheGeneration++;
+
+  __set_PRIMASK(primask_bit);
+#endif /* USE_HAL_RCC_FREQ_CACHE */
+}
+
+/**
+  * @brief  Compute the peripheral clock frequency from the RCC registers.
+  * @param  PeriphClk Peripheral clock identifier, a value of @ref RCCEx_Periph_Clock_Selection
+  * @retval Frequency in Hz
+  */
+static uint32_t RCCEx_GetPeriphCLKFreq(uint64_t PeriphClk)
 {
   PLL1_ClocksTypeDef pll1_clocks;
   PLL2_ClocksTypeDef pll2_clocks;
@@ -6309,7 +6458,7 @@ uint32_t HAL_RCCEx_GetPeriphCLKFreq(uint64_t PeriphClk)
  ===============================================================================
     [..]
     This subsection provides a set of functions allowing to control the
-    activation or deactivation of PLL2, PLL3, LSE CSS,
+    activation or deactivation of PLL2, PLL3 (and their fractional tuning), LSE CSS,
     Low speed clock output and clock after wake-up from STOP mode.
 @endverbatim
   * @{
@@ -6327,6 +6476,11 @@ HAL_StatusTypeDef HAL_RCCEx_EnablePLL2(RCC_PLL2InitTypeDef  *pPLL2Init)
   uint32_t tickstart;
   HAL_StatusTypeDef status = HAL_OK;
 
+#if defined(USE_HAL_RCC_FREQ_CACHE) && (USE_HAL_RCC_FREQ_CACHE == 1U)
+  /* The cached peripheral clock frequencies may change */
+  HAL_RCCEx_InvalidateFreqCache();
+#endif /* USE_HAL_RCC_FREQ_CACHE */
+
   /* check for PLL2 Parameters used to output PLL2CLK */
   assert_param(IS_RCC_PLL2_SOURCE(pPLL2Init->PLL2Source));
   assert_param(IS_RCC_PLL2_DIVM_VALUE(pPLL2Init->PLL2M));
@@ -6415,6 +6569,11 @@ HAL_StatusTypeDef HAL_RCCEx_DisablePLL2(void)
   uint32_t tickstart;
   HAL_StatusTypeDef status = HAL_OK;
 
+#if defined(USE_HAL_RCC_FREQ_CACHE) && (USE_HAL_RCC_FREQ_CACHE == 1U)
+  /* The cached peripheral clock frequencies may change */
+  HAL_RCCEx_InvalidateFreqCache();
+#endif /* USE_HAL_RCC_FREQ_CACHE */
+
   /* Disable the PLL2 */
   __HAL_RCC_PLL2_DISABLE();
 
@@ -6438,6 +6597,36 @@ HAL_StatusTypeDef HAL_RCCEx_DisablePLL2(void)
   return status;
 }
 
+/**
+  * @brief  Update on the fly the fractional part of the PLL2 multiplication factor.
+  * @note   The PLL2 stays locked, its output frequencies move smoothly to the new value: small FRACN
+  *         steps allow to track an asynchronous audio sample rate without software resampling.
+  * @param  PLL2FRACN  Fractional part of the multiplication factor, between 0 and 8191.
+  * @retval HAL status, HAL_ERROR if the PLL2 is not enabled
+  */
+HAL_StatusTypeDef HAL_RCCEx_SetPLL2FRACN(uint32_t PLL2FRACN)
+{
+  /* Check the parameters */
+  assert_param(IS_RCC_PLL2_FRACN_VALUE(PLL2FRACN));
+
+  if (READ_BIT(RCC->CR, RCC_CR_PLL2RDY) == 0U)
+  {
+    return HAL_ERROR;
+  }
+
+#if defined(USE_HAL_RCC_FREQ_CACHE) && (USE_HAL_RCC_FREQ_CACHE == 1U)
+  /* The cached peripheral clock frequencies may change */
+  HAL_RCCEx_InvalidateFreqCache();
+#endif /* USE_HAL_RCC_FREQ_CACHE */
+
+  /* The new FRACN value is taken into account on the PLL2FRACEN rising edge */
+  __HAL_RCC_PLL2_FRACN_DISABLE();
+  __HAL_RCC_PLL2_FRACN_CONFIG(PLL2FRACN);
+  __HAL_RCC_PLL2_FRACN_ENABLE();
+
+  return HAL_OK;
+}
+
 #if defined(RCC_CR_PLL3ON)
 /**
   * @brief  Initialize and Enable the PLL3  according to the specified
@@ -6451,6 +6640,11 @@ HAL_StatusTypeDef HAL_RCCEx_EnablePLL3(RCC_PLL3InitTypeDef  *pPLL3Init)
   uint32_t tickstart;
   HAL_StatusTypeDef status = HAL_OK;
 
+#if defined(USE_HAL_RCC_FREQ_CACHE) && (USE_HAL_RCC_FREQ_CACHE == 1U)
+  /* The cached peripheral clock frequencies may change */
+  HAL_RCCEx_InvalidateFreqCache();
+#endif /* USE_HAL_RCC_FREQ_CACHE */
+
   /* check for PLL3 Parameters used to output PLL3CLK */
   assert_param(IS_RCC_PLL3_SOURCE(pPLL3Init->PLL3Source));
   assert_param(IS_RCC_PLL3_DIVM_VALUE(pPLL3Init->PLL3M));
@@ -6540,6 +6734,11 @@ HAL_StatusTypeDef HAL_RCCEx_DisablePLL3(void)
   uint32_t tickstart;
   HAL_StatusTypeDef status = HAL_OK;
 
+#if defined(USE_HAL_RCC_FREQ_CACHE) && (USE_HAL_RCC_FREQ_CACHE == 1U)
+  /* The cached peripheral clock frequencies may change */
+  HAL_RCCEx_InvalidateFreqCache();
+#endif /* USE_HAL_RCC_FREQ_CACHE */
+
   /* Disable the PLL3 */
   __HAL_RCC_PLL3_DISABLE();
 
@@ -6562,6 +6761,36 @@ HAL_StatusTypeDef HAL_RCCEx_DisablePLL3(void)
 
   return status;
 }
+
+/**
+  * @brief  Update on the fly the fractional part of the PLL3 multiplication factor.
+  * @note   The PLL3 stays locked, its output frequencies move smoothly to the new value: small FRACN
+  *         steps allow to track an asynchronous audio sample rate without software resampling.
+  * @param  PLL3FRACN  Fractional part of the multiplication factor, between 0 and 8191.
+  * @retval HAL status, HAL_ERROR if the PLL3 is not enabled
+  */
+HAL_StatusTypeDef HAL_RCCEx_SetPLL3FRACN(uint32_t PLL3FRACN)
+{
+  /* Check the parameters */
+  assert_param(IS_RCC_PLL3_FRACN_VALUE(PLL3FRACN));
+
+  if (READ_BIT(RCC->CR, RCC_CR_PLL3RDY) == 0U)
+  {
+    return HAL_ERROR;
+  }
+
+#if defined(USE_HAL_RCC_FREQ_CACHE) && (USE_HAL_RCC_FREQ_CACHE == 1U)
+  /* The cached peripheral clock frequencies may change */
+  HAL_RCCEx_InvalidateFreqCache();
+#endif /* USE_HAL_RCC_FREQ_CACHE */
+
+  /* The new FRACN value is taken into account on the PLL3FRACEN rising edge */
+  __HAL_RCC_PLL3_FRACN_DISABLE();
+  __HAL_RCC_PLL3_FRACN_CONFIG(PLL3FRACN);
+  __HAL_RCC_PLL3_FRACN_ENABLE();
+
+  return HAL_OK;
+}
 #endif /* RCC_CR_PLL3ON */
 
 /**
@@ -6764,6 +6993,15 @@ void HAL_RCCEx_DisableLSCO(void)
       (#) To force a SYNC EVENT, user can use the function HAL_RCCEx_CRSSoftwareSynchronizationGenerate().
           This function can be called before calling HAL_RCCEx_CRSConfig (for instance in Systick handler)
 
+      (#) To keep HSI48 trimmed in the background, e.g. as USB clock without HSE crystal:
+              (++) Call function HAL_RCCEx_CRSStartMonitor() with the synchronization configuration and
+                   the frequency error tolerance (RCC_CRS_USB_TOLERANCE_PPM for USB full-speed)
+              (++) Enable CRS_IRQn (thanks to NVIC functions)
+              (++) HAL_RCCEx_CRS_IRQHandler() then gathers the frequency error statistics at each SYNC
+                   event and calls HAL_RCCEx_CRS_ToleranceCallback() when the error exceeds the tolerance
+              (++) Read the statistics with HAL_RCCEx_CRSGetMonitorStats()
+              (++) Stop the monitor with HAL_RCCEx_CRSStopMonitor(), the automatic trimming goes on
+
 @endverbatim
   * @{
   */
@@ -6954,6 +7192,11 @@ void HAL_RCCEx_CRS_IRQHandler(void)
     /* Clear CRS SYNC event OK flag */
     WRITE_REG(CRS->ICR, CRS_ICR_SYNCOKC);
 
+    if (RCCEx_CRSMonitorEnabled != 0U)
+    {
+      RCCEx_CRSMonitorUpdate(itflags);
+    }
+
     /* user callback */
     HAL_RCCEx_CRS_SyncOkCallback();
   }
@@ -6963,6 +7206,11 @@ void HAL_RCCEx_CRS_IRQHandler(void)
     /* Clear CRS SYNCWARN flag */
     WRITE_REG(CRS->ICR, CRS_ICR_SYNCWARNC);
 
+    if (RCCEx_CRSMonitorEnabled != 0U)
+    {
+      RCCEx_CRSMonitorUpdate(itflags);
+    }
+
     /* user callback */
     HAL_RCCEx_CRS_SyncWarnCallback();
   }
@@ -6996,6 +7244,11 @@ void HAL_RCCEx_CRS_IRQHandler(void)
       /* Clear CRS Error flags */
       WRITE_REG(CRS->ICR, CRS_ICR_ERRC);
 
+      if (RCCEx_CRSMonitorEnabled != 0U)
+      {
+        RCCEx_CRSMonitorUpdate(itflags);
+      }
+
       /* user error callback */
       HAL_RCCEx_CRS_ErrorCallback(crserror);
     }
@@ -7054,12 +7307,318 @@ __weak void HAL_RCCEx_CRS_ErrorCallback(uint32_t Error)
    */
 }
 
+/**
+  * @brief  Start the CRS monitor: HSI48 is kept trimmed on the SYNC signal and the
+  *         frequency error statistics are gathered by HAL_RCCEx_CRS_IRQHandler().
+  * @note   The CRS is configured by HAL_RCCEx_CRSConfig() and its SYNCOK, SYNCWARN
+  *         and error interrupts are enabled: CRS_IRQn must be enabled in the NVIC.
+  *         There is one interrupt per SYNC event (every 1 ms with the USB SOF), the
+  *         SYNC prescaler may be used to lower this rate.
+  * @param  pInit Pointer on RCC_CRSInitTypeDef structure
+  * @param  TolerancePpm Frequency error tolerance in ppm of the target frequency, above
+  *         which HAL_RCCEx_CRS_ToleranceCallback() is called. RCC_CRS_USB_TOLERANCE_PPM
+  *         can be used when HSI48 clocks the USB.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_RCCEx_CRSStartMonitor(const RCC_CRSInitTypeDef *pInit, uint32_t TolerancePpm)
+{
+  if (pInit == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_RCC_CRS_TOLERANCE(TolerancePpm));
+
+  /* Configure the CRS, automatic trimming and frequency error counter are enabled */
+  HAL_RCCEx_CRSConfig(pInit);
+
+  RCCEx_CRSStats.SyncCount = 0U;
+  RCCEx_CRSStats.SyncWarnCount = 0U;
+  RCCEx_CRSStats.SyncErrorCount = 0U;
+  RCCEx_CRSStats.SyncMissCount = 0U;
+  RCCEx_CRSStats.TrimOverflowCount = 0U;
+  RCCEx_CRSStats.OutOfToleranceCount = 0U;
+  RCCEx_CRSStats.LastErrorPpm = 0U;
+  RCCEx_CRSStats.LastErrorDirection = RCC_CRS_FREQERRORDIR_UP;
+  RCCEx_CRSStats.MaxErrorPpm = 0U;
+  RCCEx_CRSStats.HSI48CalibrationValue = pInit->HSI48CalibrationValue;
+  RCCEx_CRSTolerancePpm = TolerancePpm;
+  RCCEx_CRSMonitorEnabled = 1U;
+
+  __HAL_RCC_CRS_ENABLE_IT(RCC_CRS_IT_SYNCOK | RCC_CRS_IT_SYNCWARN | RCC_CRS_IT_ERR);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the CRS monitor.
+  * @note   The CRS interrupts are disabled, the automatic trimming of HSI48 goes on.
+  * @retval None
+  */
+void HAL_RCCEx_CRSStopMonitor(void)
+{
+  __HAL_RCC_CRS_DISABLE_IT(RCC_CRS_IT_SYNCOK | RCC_CRS_IT_SYNCWARN | RCC_CRS_IT_ERR);
+
+  RCCEx_CRSMonitorEnabled = 0U;
+}
+
+/**
+  * @brief  Get the CRS monitor statistics.
+  * @note   The CRS interrupts are masked during the copy to get a coherent snapshot.
+  * @param  pStats Pointer on RCC_CRSMonitorStatsTypeDef structure
+  * @retval None
+  */
+void HAL_RCCEx_CRSGetMonitorStats(RCC_CRSMonitorStatsTypeDef *pStats)
+{
+  uint32_t itsources;
+
+  /* Check the parameter */
+  assert_param(pStats != (void *)NULL);
+
+  itsources = READ_BIT(CRS->CR, RCC_CRS_IT_SYNCOK | RCC_CRS_IT_SYNCWARN | RCC_CRS_IT_ERR);
+  __HAL_RCC_CRS_DISABLE_IT(itsources);
+
+  *pStats = RCCEx_CRSStats;
+
+  __HAL_RCC_CRS_ENABLE_IT(itsources);
+}
+
+/**
+  * @brief  RCCEx Clock Recovery System frequency error out of tolerance callback.
+  * @note   Called by the CRS monitor from HAL_RCCEx_CRS_IRQHandler().
+  * @param  ErrorPpm Measured frequency error in ppm of the target frequency
+  * @retval none
+  */
+__weak void HAL_RCCEx_CRS_ToleranceCallback(uint32_t ErrorPpm)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(ErrorPpm);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the @ref HAL_RCCEx_CRS_ToleranceCallback should be implemented in the user file
+   */
+}
+
 /**
   * @}
   */
 
 #endif /* CRS */
 
+/** @defgroup RCCEx_Exported_Functions_Group4 Extended Clock Profile functions
+  *  @brief  Extended Clock Profile functions
+  *
+@verbatim
+ ===============================================================================
+                ##### Extended Clock Profile functions  #####
+ ===============================================================================
+    [..]
+    This subsection provides a set of functions allowing to switch the system
+    clock between precomputed configurations, for dynamic frequency scaling:
+
+    (+) HAL_RCCEx_InitProfile() validates a bus clocks configuration at a given
+        voltage scaling and precomputes the Flash wait states, the programming
+        delay, the prescalers and the resulting frequencies. The system clock
+        source and PLL1 if used must be configured with HAL_RCC_OscConfig()
+        beforehand and stay configured.
+
+    (+) HAL_RCCEx_SwitchProfile() applies a profile in the safe order: voltage
+        scaling and wait states are raised before the frequency increases and
+        lowered after it decreases, the prescalers being kept at the larger of
+        the current and target values during the system clock source switch.
+        No oscillator or PLL is started or stopped: e.g. PLL1 keeps running while
+        the HSI is selected, for an immediate switch back.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Precompute a clock profile from a bus clocks configuration.
+  * @param  pProfile Pointer to a RCC_ClockProfileTypeDef structure receiving the profile.
+  * @param  pClkInitStruct Pointer to a RCC_ClkInitTypeDef structure that contains the system
+  *         clock source and the AHB and APB prescalers, the ClockType field being ignored.
+  * @param  VoltageScaling Regulator voltage scaling of the profile,
+  *         a value of @ref PWREx_Regulator_Voltage_Scale
+  * @note   The Flash wait states are the minimum allowed by the frequency and the voltage scaling.
+  * @retval HAL status, HAL_ERROR when the source is not ready or the frequency exceeds the
+  *         maximum of the voltage scaling.
+  */
+HAL_StatusTypeDef HAL_RCCEx_InitProfile(RCC_ClockProfileTypeDef *pProfile, const RCC_ClkInitTypeDef *pClkInitStruct,
+                                        uint32_t VoltageScaling)
+{
+  uint32_t sysclk;
+  uint32_t hclk;
+  uint32_t latency = 0U;
+  uint32_t range;
+
+  if ((pProfile == NULL) || (pClkInitStruct == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_RCC_SYSCLKSOURCE(pClkInitStruct->SYSCLKSource));
+  assert_param(IS_RCC_HCLK(pClkInitStruct->AHBCLKDivider));
+  assert_param(IS_RCC_PCLK(pClkInitStruct->APB1CLKDivider));
+  assert_param(IS_RCC_PCLK(pClkInitStruct->APB2CLKDivider));
+  assert_param(IS_RCC_PCLK(pClkInitStruct->APB3CLKDivider));
+  assert_param(IS_PWR_VOLTAGE_SCALING_RANGE(VoltageScaling));
+
+  sysclk = RCCEx_GetSysClockSourceFreq(pClkInitStruct->SYSCLKSource);
+  if (sysclk == 0U)
+  {
+    return HAL_ERROR;
+  }
+  hclk = sysclk >> AHBPrescTable[(pClkInitStruct->AHBCLKDivider & RCC_CFGR2_HPRE) >> RCC_CFGR2_HPRE_Pos];
+
+  /* Minimum wait states at the voltage scaling */
+  range = VoltageScaling >> PWR_VOSCR_VOS_Pos;
+  while ((latency < RCCEx_PROFILE_LATENCY_NB) && (hclk > ((uint32_t)RCCEx_LatencyMaxFreq[range][latency] * 1000000U)))
+  {
+    latency++;
+  }
+  if (latency == RCCEx_PROFILE_LATENCY_NB)
+  {
+    return HAL_ERROR;
+  }
+
+  pProfile->SYSCLKSource    = pClkInitStruct->SYSCLKSource;
+  pProfile->CFGR2           = pClkInitStruct->AHBCLKDivider | pClkInitStruct->APB1CLKDivider |
+                              (pClkInitStruct->APB2CLKDivider << 4) | (pClkInitStruct->APB3CLKDivider << 8);
+  pProfile->FlashLatency    = latency;
+  pProfile->VoltageScaling  = VoltageScaling;
+  pProfile->SYSCLKFrequency = sysclk;
+  pProfile->HCLKFrequency   = hclk;
+
+  if (hclk <= RCCEx_PROGRAM_DELAY_0_FREQ)
+  {
+    pProfile->ProgramDelay = 0U;
+  }
+  else if (hclk <= RCCEx_PROGRAM_DELAY_1_FREQ)
+  {
+    pProfile->ProgramDelay = FLASH_ACR_WRHIGHFREQ_0;
+  }
+  else
+  {
+    pProfile->ProgramDelay = FLASH_ACR_WRHIGHFREQ_1;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Switch the system clocks to a profile precomputed by HAL_RCCEx_InitProfile().
+  * @param  pProfile Pointer to a RCC_ClockProfileTypeDef structure that contains the profile.
+  * @note   The source of the profile must still be ready, it is not started by the switch.
+  * @note   The SystemCoreClock variable is updated and the time base is reconfigured.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_RCCEx_SwitchProfile(const RCC_ClockProfileTypeDef *pProfile)
+{
+  uint32_t tickstart;
+  uint32_t cfgr2;
+  uint32_t interim = 0U;
+  uint32_t latency;
+  uint32_t field;
+  const uint32_t fields[4] = {RCC_CFGR2_HPRE, RCC_CFGR2_PPRE1, RCC_CFGR2_PPRE2, RCC_CFGR2_PPRE3};
+
+  if (pProfile == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+#if defined(USE_HAL_RCC_FREQ_CACHE) && (USE_HAL_RCC_FREQ_CACHE == 1U)
+  /* The cached peripheral clock frequencies may change */
+  HAL_RCCEx_InvalidateFreqCache();
+#endif /* USE_HAL_RCC_FREQ_CACHE */
+
+  /* The source is not started by the switch */
+  if (RCCEx_GetSysClockSourceFreq(pProfile->SYSCLKSource) == 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Raise the voltage scaling before the frequency increase */
+  if (pProfile->VoltageScaling > READ_BIT(PWR->VOSCR, PWR_VOSCR_VOS))
+  {
+    if (HAL_PWREx_ControlVoltageScaling(pProfile->VoltageScaling) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  /* Increase the wait states before the frequency increase */
+  latency = READ_BIT(FLASH->ACR, FLASH_ACR_LATENCY);
+  if (pProfile->FlashLatency > latency)
+  {
+    MODIFY_REG(FLASH->ACR, (FLASH_ACR_LATENCY | FLASH_ACR_WRHIGHFREQ),
+               (pProfile->FlashLatency | pProfile->ProgramDelay));
+    if (READ_BIT(FLASH->ACR, FLASH_ACR_LATENCY) != pProfile->FlashLatency)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  if (__HAL_RCC_GET_SYSCLK_SOURCE() != (pProfile->SYSCLKSource << RCC_CFGR1_SWS_Pos))
+  {
+    /* Keep the larger prescalers during the source switch */
+    cfgr2 = READ_REG(RCC->CFGR2);
+    for (field = 0U; field < 4U; field++)
+    {
+      interim |= (((cfgr2 & fields[field]) > (pProfile->CFGR2 & fields[field])) ?
+                  (cfgr2 & fields[field]) : (pProfile->CFGR2 & fields[field]));
+    }
+    MODIFY_REG(RCC->CFGR2, RCCEx_PROFILE_CFGR2_MASK, interim);
+
+    MODIFY_REG(RCC->CFGR1, RCC_CFGR1_SW, pProfile->SYSCLKSource);
+
+    /* Get Start Tick*/
+    tickstart = HAL_GetTick();
+
+    while (__HAL_RCC_GET_SYSCLK_SOURCE() != (pProfile->SYSCLKSource << RCC_CFGR1_SWS_Pos))
+    {
+      if ((HAL_GetTick() - tickstart) > RCCEx_CLOCKSWITCH_TIMEOUT_VALUE)
+      {
+        return HAL_TIMEOUT;
+      }
+    }
+  }
+
+  MODIFY_REG(RCC->CFGR2, RCCEx_PROFILE_CFGR2_MASK, pProfile->CFGR2);
+
+  /* Decrease the wait states after the frequency decrease */
+  if (pProfile->FlashLatency < latency)
+  {
+    MODIFY_REG(FLASH->ACR, (FLASH_ACR_LATENCY | FLASH_ACR_WRHIGHFREQ),
+               (pProfile->FlashLatency | pProfile->ProgramDelay));
+    if (READ_BIT(FLASH->ACR, FLASH_ACR_LATENCY) != pProfile->FlashLatency)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  /* Lower the voltage scaling after the frequency decrease */
+  if (pProfile->VoltageScaling < READ_BIT(PWR->VOSCR, PWR_VOSCR_VOS))
+  {
+    if (HAL_PWREx_ControlVoltageScaling(pProfile->VoltageScaling) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  /* Precomputed frequency, no register decoding */
+  SystemCoreClock = pProfile->HCLKFrequency;
+
+  /* Configure the source of time base considering new system clocks settings*/
+  return HAL_InitTick(uwTickPrio);
+}
+
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -7068,6 +7627,60 @@ __weak void HAL_RCCEx_CRS_ErrorCallback(uint32_t Error)
   * @{
   */
 
+#if defined(CRS)
+/**
+  * @brief  Update the CRS monitor statistics on a CRS interrupt.
+  * @note   The frequency error is latched in FECAP at each SYNC event, it is
+  *         counted in HSI48 periods over a SYNC period of RELOAD + 1 periods.
+  * @param  itflags CRS_ISR value read by HAL_RCCEx_CRS_IRQHandler()
+  * @retval None
+  */
+static void RCCEx_CRSMonitorUpdate(uint32_t itflags)
+{
+  uint32_t reload;
+  uint32_t errorppm;
+
+  if ((itflags & RCC_CRS_FLAG_SYNCERR) != 0U)
+  {
+    RCCEx_CRSStats.SyncErrorCount++;
+  }
+  if ((itflags & RCC_CRS_FLAG_SYNCMISS) != 0U)
+  {
+    RCCEx_CRSStats.SyncMissCount++;
+  }
+  if ((itflags & RCC_CRS_FLAG_TRIMOVF) != 0U)
+  {
+    RCCEx_CRSStats.TrimOverflowCount++;
+  }
+
+  if ((itflags & (RCC_CRS_FLAG_SYNCOK | RCC_CRS_FLAG_SYNCWARN)) != 0U)
+  {
+    reload = READ_BIT(CRS->CFGR, CRS_CFGR_RELOAD) >> CRS_CFGR_RELOAD_Pos;
+    errorppm = (uint32_t)((((uint64_t)(itflags & CRS_ISR_FECAP) >> CRS_ISR_FECAP_Pos) * 1000000U) /
+                          ((uint64_t)reload + 1U));
+
+    RCCEx_CRSStats.SyncCount++;
+    if ((itflags & RCC_CRS_FLAG_SYNCWARN) != 0U)
+    {
+      RCCEx_CRSStats.SyncWarnCount++;
+    }
+    RCCEx_CRSStats.LastErrorPpm = errorppm;
+    RCCEx_CRSStats.LastErrorDirection = itflags & CRS_ISR_FEDIR;
+    RCCEx_CRSStats.HSI48CalibrationValue = READ_BIT(CRS->CR, CRS_CR_TRIM) >> CRS_CR_TRIM_Pos;
+    if (errorppm > RCCEx_CRSStats.MaxErrorPpm)
+    {
+      RCCEx_CRSStats.MaxErrorPpm = errorppm;
+    }
+
+    if (errorppm > RCCEx_CRSTolerancePpm)
+    {
+      RCCEx_CRSStats.OutOfToleranceCount++;
+      HAL_RCCEx_CRS_ToleranceCallback(errorppm);
+    }
+  }
+}
+#endif /* CRS */
+
 /**
   * @brief  Enable PLLx source clock and check ready flag
   * @param  PllSource contains the selected PLLx source clock (HSE, HSI or CSI)
@@ -7317,6 +7930,49 @@ static HAL_StatusTypeDef RCCEx_PLL3_Config(const RCC_PLL3InitTypeDef *pll3)
 }
 #endif /* RCC_CR_PLL3ON */
 
+/**
+  * @brief  Get the frequency of a system clock source.
+  * @param  SYSCLKSource System clock source, a value of @ref RCC_System_Clock_Source
+  * @retval Frequency in Hz, 0 when the source is not ready
+  */
+static uint32_t RCCEx_GetSysClockSourceFreq(uint32_t SYSCLKSource)
+{
+  PLL1_ClocksTypeDef pll1_clocks;
+  uint32_t frequency = 0U;
+
+  if (SYSCLKSource == RCC_SYSCLKSOURCE_PLLCLK)
+  {
+    if (__HAL_RCC_GET_FLAG(RCC_FLAG_PLL1RDY) != 0U)
+    {
+      HAL_RCCEx_GetPLL1ClockFreq(&pll1_clocks);
+      frequency = pll1_clocks.PLL1_P_Frequency;
+    }
+  }
+  else if (SYSCLKSource == RCC_SYSCLKSOURCE_HSE)
+  {
+    if (__HAL_RCC_GET_FLAG(RCC_FLAG_HSERDY) != 0U)
+    {
+      frequency = HSE_VALUE;
+    }
+  }
+  else if (SYSCLKSource == RCC_SYSCLKSOURCE_CSI)
+  {
+    if (__HAL_RCC_GET_FLAG(RCC_FLAG_CSIRDY) != 0U)
+    {
+      frequency = CSI_VALUE;
+    }
+  }
+  else
+  {
+    if (__HAL_RCC_GET_FLAG(RCC_FLAG_HSIRDY) != 0U)
+    {
+      frequency = (uint32_t)(HSI_VALUE >> (__HAL_RCC_GET_HSI_DIVIDER() >> RCC_CR_HSIDIV_Pos));
+    }
+  }
+
+  return frequency;
+}
+
 /**
   * @}
   */
@@ -33,6 +33,9 @@
       (#) Wait until the 32 bit Random Number Generator contains a valid
           random data using (polling/interrupt) mode.
       (#) Get the 32 bit random number using HAL_RNG_GenerateRandomNumber() function.
+      (#) Alternatively, keep a buffered random pool refilled in background by the
+          RNG interrupt using HAL_RNGEx_StartPool(), and read random bytes from it
+          without waiting using HAL_RNGEx_GetBytes() (see RNGEx driver).
 
     ##### Callback registration #####
     ==================================
@@ -269,6 +272,12 @@ HAL_StatusTypeDef HAL_RNG_Init(RNG_HandleTypeDef *hrng)
   /* Initialise the error code */
   hrng->ErrorCode = HAL_RNG_ERROR_NONE;
 
+  /* Random pool not running */
+  hrng->pPool = NULL;
+  hrng->PoolSize = 0U;
+  hrng->PoolHead = 0U;
+  hrng->PoolTail = 0U;
+
   /* Return function status */
   return HAL_OK;
 }
@@ -340,6 +349,9 @@ HAL_StatusTypeDef HAL_RNG_DeInit(RNG_HandleTypeDef *hrng)
   /* Initialise the error code */
   hrng->ErrorCode = HAL_RNG_ERROR_NONE;
 
+  /* Random pool not running */
+  hrng->pPool = NULL;
+
   /* Release Lock */
   __HAL_UNLOCK(hrng);
 
@@ -839,6 +851,28 @@ void HAL_RNG_IRQHandler(RNG_HandleTypeDef *hrng)
   /* Check RNG data ready interrupt occurred */
   if ((itflag & RNG_IT_DRDY) == RNG_IT_DRDY)
   {
+    /* Random pool running: store the word and keep the IT until the pool is full */
+    if (hrng->pPool != NULL)
+    {
+      uint32_t head = hrng->PoolHead;
+      uint32_t next = ((head + 1U) == hrng->PoolSize) ? 0U : (head + 1U);
+
+      if (next != hrng->PoolTail)
+      {
+        /* Get the 32bit Random number (DRDY flag automatically cleared) */
+        hrng->pPool[head] = hrng->Instance->DR;
+        hrng->PoolHead = next;
+        next = ((next + 1U) == hrng->PoolSize) ? 0U : (next + 1U);
+      }
+
+      if (next == hrng->PoolTail)
+      {
+        /* Pool full: stop refill, it is resumed by HAL_RNGEx_GetBytes() */
+        __HAL_RNG_DISABLE_IT(hrng);
+      }
+      return;
+    }
+
     /* Generate random number once, so disable the IT */
     __HAL_RNG_DISABLE_IT(hrng);
 
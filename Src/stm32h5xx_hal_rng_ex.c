@@ -7,6 +7,7 @@
   *          functionalities of the Random Number Generator (RNG) peripheral:
   *           + Lock configuration functions
   *           + Reset the RNG
+  *           + Buffered random pool functions
   *
   ******************************************************************************
   * @attention
@@ -424,6 +425,216 @@ HAL_StatusTypeDef   HAL_RNGEx_SetHealthFactorConfig(RNG_HandleTypeDef *hrng, uin
   * @}
   */
 
+/** @defgroup RNGEx_Exported_Functions_Group3 Buffered random pool functions
+  *  @brief   Buffered random pool functions
+  *
+@verbatim
+ ===============================================================================
+          ##### Buffered random pool functions #####
+ ===============================================================================
+    [..]  This section provides functions allowing to:
+      (+) Start a random pool refilled in background by the RNG interrupt
+          using HAL_RNGEx_StartPool(). The pool buffer is provided by the user
+          and holds up to (Size - 1) random words.
+      (+) Read random bytes from the pool without waiting for the RNG using
+          HAL_RNGEx_GetBytes(). HAL_BUSY is returned when the pool does not
+          yet hold enough random data, in which case nothing is consumed.
+      (+) Get the number of random bytes currently available using
+          HAL_RNGEx_GetPoolLevel().
+      (+) Stop the random pool using HAL_RNGEx_StopPool().
+    [..]
+      (@) The RNG interrupt must be enabled at NVIC level and HAL_RNG_IRQHandler()
+          called from RNG_IRQHandler(). While the pool is running, random words are
+          stored in the pool and HAL_RNG_ReadyDataCallback() is not called.
+      (@) Clock and seed errors are reported through HAL_RNG_ErrorCallback() as in
+          interrupt mode. After a seed error, HAL_RNGEx_GetBytes() returns HAL_ERROR
+          until the pool is stopped, the error recovered with HAL_RNGEx_RecoverSeedError()
+          and the pool restarted.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Start the buffered random pool, refilled in background by the RNG interrupt.
+  * @param  hrng pointer to a RNG_HandleTypeDef structure that contains
+  *          the configuration information for RNG.
+  * @param  pPool pointer to the pool buffer. Its content is only valid while the pool runs.
+  * @param  Size pool buffer size in words (at least 2, the pool holds Size - 1 words).
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_RNGEx_StartPool(RNG_HandleTypeDef *hrng, uint32_t *pPool, uint32_t Size)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  /* Check the RNG handle allocation */
+  if (hrng == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  if ((pPool == NULL) || (Size < 2U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hrng);
+
+  if (hrng->State == HAL_RNG_STATE_READY)
+  {
+    /* Change RNG peripheral state */
+    hrng->State = HAL_RNG_STATE_BUSY;
+
+    /* Initialize the pool as empty */
+    hrng->PoolSize = Size;
+    hrng->PoolHead = 0U;
+    hrng->PoolTail = 0U;
+    hrng->pPool = pPool;
+
+    /* Enable the RNG Interrupts: Data Ready, Clock error, Seed error */
+    __HAL_RNG_ENABLE_IT(hrng);
+  }
+  else
+  {
+    hrng->ErrorCode = HAL_RNG_ERROR_BUSY;
+    status = HAL_ERROR;
+  }
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hrng);
+
+  return status;
+}
+
+/**
+  * @brief  Stop the buffered random pool.
+  * @note   Random data still held in the pool is discarded.
+  * @param  hrng pointer to a RNG_HandleTypeDef structure that contains
+  *          the configuration information for RNG.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_RNGEx_StopPool(RNG_HandleTypeDef *hrng)
+{
+  /* Check the RNG handle allocation */
+  if (hrng == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  if (hrng->pPool == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Disable the RNG Interrupts */
+  __HAL_RNG_DISABLE_IT(hrng);
+
+  hrng->pPool = NULL;
+  hrng->PoolHead = 0U;
+  hrng->PoolTail = 0U;
+
+  /* Keep error state so that the seed error can be recovered */
+  if (hrng->State == HAL_RNG_STATE_BUSY)
+  {
+    hrng->State = HAL_RNG_STATE_READY;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Get the number of random bytes currently available in the pool.
+  * @param  hrng pointer to a RNG_HandleTypeDef structure that contains
+  *          the configuration information for RNG.
+  * @retval Number of available bytes (0 when the pool is not running)
+  */
+uint32_t HAL_RNGEx_GetPoolLevel(const RNG_HandleTypeDef *hrng)
+{
+  uint32_t head;
+  uint32_t tail;
+
+  if (hrng->pPool == NULL)
+  {
+    return 0U;
+  }
+
+  head = hrng->PoolHead;
+  tail = hrng->PoolTail;
+
+  return (((head >= tail) ? (head - tail) : ((hrng->PoolSize - tail) + head)) * 4U);
+}
+
+/**
+  * @brief  Read random bytes from the buffered random pool without waiting.
+  * @note   Random words are consumed as a whole: when Len is not a multiple of 4,
+  *         the remaining bytes of the last word are discarded.
+  * @param  hrng pointer to a RNG_HandleTypeDef structure that contains
+  *          the configuration information for RNG.
+  * @param  pBuf pointer to the destination buffer.
+  * @param  Len number of random bytes to read.
+  * @retval HAL_OK    random bytes copied.
+  * @retval HAL_BUSY  pool does not hold enough random data yet, nothing consumed.
+  * @retval HAL_ERROR pool not running or RNG in error (ErrorCode gives the reason).
+  */
+HAL_StatusTypeDef HAL_RNGEx_GetBytes(RNG_HandleTypeDef *hrng, uint8_t *pBuf, uint32_t Len)
+{
+  uint32_t tail;
+  uint32_t word;
+  uint32_t index = 0U;
+  uint32_t nbytes;
+  uint32_t primask_bit;
+
+  /* Check the RNG handle allocation */
+  if (hrng == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  if ((hrng->pPool == NULL) || (pBuf == NULL) || (hrng->State == HAL_RNG_STATE_ERROR))
+  {
+    return HAL_ERROR;
+  }
+
+  if (HAL_RNGEx_GetPoolLevel(hrng) < Len)
+  {
+    return HAL_BUSY;
+  }
+
+  /* Only the consumer moves the tail, the IRQ handler only moves the head */
+  tail = hrng->PoolTail;
+  while (index < Len)
+  {
+    word = hrng->pPool[tail];
+    hrng->pPool[tail] = 0U;
+    tail = ((tail + 1U) == hrng->PoolSize) ? 0U : (tail + 1U);
+
+    nbytes = ((Len - index) < 4U) ? (Len - index) : 4U;
+    while (nbytes != 0U)
+    {
+      pBuf[index] = (uint8_t)word;
+      word >>= 8U;
+      index++;
+      nbytes--;
+    }
+  }
+
+  /* Publish the new tail and resume refill, IT enable bit is also cleared by the IRQ handler */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+  hrng->PoolTail = tail;
+  if (hrng->State != HAL_RNG_STATE_ERROR)
+  {
+    __HAL_RNG_ENABLE_IT(hrng);
+  }
+  __set_PRIMASK(primask_bit);
+
+  return HAL_OK;
+}
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -289,6 +289,7 @@ HAL_StatusTypeDef HAL_RTC_Init(RTC_HandleTypeDef *hrtc)
     {
       /* Allocate lock resource and initialize it */
       hrtc->Lock = HAL_UNLOCKED;
+      hrtc->pTimerWheel = NULL;
 
       /* Legacy weak AlarmAEventCallback */
       hrtc->AlarmAEventCallback           = HAL_RTC_AlarmAEventCallback;
@@ -360,6 +361,7 @@ HAL_StatusTypeDef HAL_RTC_Init(RTC_HandleTypeDef *hrtc)
     {
       /* Allocate lock resource and initialize it */
       hrtc->Lock = HAL_UNLOCKED;
+      hrtc->pTimerWheel = NULL;
 
       /* Initialize RTC MSP */
       HAL_RTC_MspInit(hrtc);
@@ -527,6 +529,9 @@ HAL_StatusTypeDef HAL_RTC_DeInit(RTC_HandleTypeDef *hrtc)
     HAL_RTC_MspDeInit(hrtc);
 #endif /* (USE_HAL_RTC_REGISTER_CALLBACKS) */
 
+    /* Release the software timer wheel */
+    hrtc->pTimerWheel = NULL;
+
     /* Change RTC state */
     hrtc->State = HAL_RTC_STATE_RESET;
   }
@@ -1964,12 +1969,20 @@ void HAL_RTC_AlarmIRQHandler(RTC_HandleTypeDef *hrtc)
     /* Clear the AlarmA interrupt pending bit */
     WRITE_REG(RTC->SCR, RTC_SCR_CALRAF);
 
+    if (hrtc->pTimerWheel != NULL)
+    {
+      /* Alarm A is owned by the software timer wheel */
+      RTCEx_TimerWheelProcess(hrtc);
+    }
+    else
+    {
 #if (USE_HAL_RTC_REGISTER_CALLBACKS == 1)
-    /* Call Compare Match registered Callback */
-    hrtc->AlarmAEventCallback(hrtc);
+      /* Call Compare Match registered Callback */
+      hrtc->AlarmAEventCallback(hrtc);
 #else
-    HAL_RTC_AlarmAEventCallback(hrtc);
+      HAL_RTC_AlarmAEventCallback(hrtc);
 #endif /* USE_HAL_RTC_REGISTER_CALLBACKS */
+    }
   }
 
   if ((tmp & RTC_SMISR_ALRBMF) != 0U)
@@ -2008,12 +2021,20 @@ void HAL_RTC_AlarmIRQHandler(RTC_HandleTypeDef *hrtc)
     /* Clear the AlarmA interrupt pending bit */
     WRITE_REG(RTC->SCR, RTC_SCR_CALRAF);
 
+    if (hrtc->pTimerWheel != NULL)
+    {
+      /* Alarm A is owned by the software timer wheel */
+      RTCEx_TimerWheelProcess(hrtc);
+    }
+    else
+    {
 #if (USE_HAL_RTC_REGISTER_CALLBACKS == 1)
-    /* Call Compare Match registered Callback */
-    hrtc->AlarmAEventCallback(hrtc);
+      /* Call Compare Match registered Callback */
+      hrtc->AlarmAEventCallback(hrtc);
 #else
-    HAL_RTC_AlarmAEventCallback(hrtc);
+      HAL_RTC_AlarmAEventCallback(hrtc);
 #endif /* USE_HAL_RTC_REGISTER_CALLBACKS */
+    }
   }
 
   if ((tmp & RTC_MISR_ALRBMF) != 0U)
@@ -93,6 +93,22 @@
     (+) Enable the RTC SSRU interruption mode using HAL_RTCEx_SetSSRU_IT() function.
         In this case, when the SSR rolls under 0, an SSRU interruption is triggered.
         Disable the RTC SSRU interruption mode using HAL_RTCEx_DeactivateSSRU() function.
+    (+) In binary modes, use HAL_RTCEx_StartBinaryCounter() then HAL_RTCEx_GetBinaryCounter()
+        to read a 64-bit free running counter at ck_apre frequency, the 32-bit SSR
+        being extended by the SSRU interruption. It provides cheap timestamps
+        without any BCD conversion.
+
+  *** Software timer wheel ***
+  ================================================
+  [..]
+    (+) In binary modes, start a software timer wheel on Alarm A using
+        HAL_RTCEx_TimerWheelStart(). The wheel tick is the binary counter period
+        (ck_apre) shifted left by the wheel TickShift.
+    (+) Start and stop any number of one-shot or periodic timers using
+        HAL_RTCEx_TimerStart() and HAL_RTCEx_TimerStop(). The timer callbacks are
+        executed from HAL_RTC_AlarmIRQHandler(), Alarm A being programmed on the
+        nearest expiry only.
+    (+) Release Alarm A using HAL_RTCEx_TimerWheelStop().
 
   *** TimeStamp configuration ***
   ===============================
@@ -188,10 +204,21 @@
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
 #define TAMP_ALL RTC_TAMPER_ALL
+#define RTC_TIMERWHEEL_NO_ALARM 0xFFFFFFFFFFFFFFFFULL
 
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
+/** @addtogroup RTCEx_Private_Functions
+  * @{
+  */
+static void RTCEx_TimerWheelInsert(RTCEx_TimerWheelTypeDef *pWheel, RTCEx_TimerTypeDef *pTimer);
+static void RTCEx_TimerWheelRemove(RTCEx_TimerWheelTypeDef *pWheel, RTCEx_TimerTypeDef *pTimer);
+static void RTCEx_TimerWheelSetAlarm(RTC_HandleTypeDef *hrtc, uint64_t Tick);
+/**
+  * @}
+  */
+
 /* Exported functions --------------------------------------------------------*/
 
 /** @addtogroup RTCEx_Exported_Functions
@@ -869,6 +896,8 @@ HAL_StatusTypeDef HAL_RTCEx_PollForWakeUpTimerEvent(const RTC_HandleTypeDef *hrt
       (+) Disable the RTC reference clock detection.
       (+) Enable the Bypass Shadow feature.
       (+) Disable the Bypass Shadow feature.
+      (+) Start and read the 64-bit binary counter.
+      (+) Start and stop the software timer wheel and its timers.
 
 @endverbatim
   * @{
@@ -1417,6 +1446,9 @@ void HAL_RTCEx_SSRUIRQHandler(RTC_HandleTypeDef *hrtc)
     /* Immediately clear SSR underflow flag */
     WRITE_REG(RTC->SCR, RTC_SCR_CSSRUF);
 
+    /* Extend the binary counter */
+    hrtc->SSRUCount++;
+
     /* SSRU callback */
 #if (USE_HAL_RTC_REGISTER_CALLBACKS == 1)
     /* Call SSRUEvent registered Callback */
@@ -1446,6 +1478,264 @@ __weak void HAL_RTCEx_SSRUEventCallback(RTC_HandleTypeDef *hrtc)
    */
 }
 
+/**
+  * @brief  Start the 64-bit binary counter.
+  * @note   The counter is built from the RTC_SSR free running down-counter,
+  *         extended by software with the number of SSR underflows. The SSRU
+  *         interrupt is enabled by this function and HAL_RTCEx_SSRUIRQHandler()
+  *         must be called from the RTC interrupt handler.
+  * @note   The counter runs at ck_apre frequency (RTCCLK / (PREDIV_A + 1)). It
+  *         is only monotonic as long as RTC_SSR is not reloaded, by a time
+  *         setting or a binary alarm with BinaryAutoClr.
+  * @param  hrtc RTC handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_RTCEx_StartBinaryCounter(RTC_HandleTypeDef *hrtc)
+{
+  /* The free running 32-bit SSR is only available in binary modes */
+  if (__HAL_RTC_GET_BINARY_MODE(hrtc) == RTC_BINARY_NONE)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hrtc);
+
+  /* Change RTC state */
+  hrtc->State = HAL_RTC_STATE_BUSY;
+
+  /* Restart the underflow count from a cleared flag */
+  __HAL_RTC_SSRU_DISABLE_IT(hrtc, RTC_IT_SSRU);
+  WRITE_REG(RTC->SCR, RTC_SCR_CSSRUF);
+  hrtc->SSRUCount = 0U;
+  __HAL_RTC_SSRU_ENABLE_IT(hrtc, RTC_IT_SSRU);
+
+  /* Change RTC state */
+  hrtc->State = HAL_RTC_STATE_READY;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hrtc);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Get the 64-bit binary counter.
+  * @note   The SSR and the software underflow count are read coherently without
+  *         masking interrupts: the read is retried if an SSR underflow is
+  *         serviced meanwhile, and an underflow not serviced yet (call from a
+  *         higher priority context) is accounted for.
+  * @param  hrtc RTC handle
+  * @retval Number of ck_apre periods elapsed since HAL_RTCEx_StartBinaryCounter()
+  *         reference (SSR value at start included)
+  */
+uint64_t HAL_RTCEx_GetBinaryCounter(const RTC_HandleTypeDef *hrtc)
+{
+  uint32_t high;
+  uint32_t ssr;
+  uint32_t pending;
+
+  do
+  {
+    high = hrtc->SSRUCount;
+    ssr = READ_REG(RTC->SSR);
+
+    /* An underflow is pending only if SSR restarted from its top value */
+    pending = ((READ_BIT(RTC->SR, RTC_SR_SSRUF) != 0U) && ((ssr & 0x80000000U) != 0U)) ? 1U : 0U;
+  } while (high != hrtc->SSRUCount);
+
+  /* Unlock the calendar shadow registers frozen by the SSR read in RTC_BINARY_MIX mode */
+  (void)READ_REG(RTC->DR);
+
+  return ((uint64_t)(high + pending) << 32U) | (uint64_t)(0xFFFFFFFFU - ssr);
+}
+
+/**
+  * @brief  Start the software timer wheel on Alarm A.
+  * @note   The wheel is driven by the 64-bit binary counter, started by this
+  *         function if the SSRU interrupt is not enabled yet. Alarm A is then
+  *         owned by the wheel: HAL_RTC_AlarmIRQHandler() processes the expired
+  *         timers instead of calling HAL_RTC_AlarmAEventCallback().
+  * @note   The timers are hashed on RTC_TIMERWHEEL_SLOTS slots by expiry tick,
+  *         with a bit field of the non empty slots: a timer is inserted in a
+  *         constant time and the next alarm is found with a single bit scan.
+  *         A timer expiring more than RTC_TIMERWHEEL_SLOTS ticks ahead costs
+  *         one alarm wakeup per wheel rotation.
+  * @note   In RTC_BINARY_MIX mode, the alarm only compares the SSR bits below
+  *         the calendar second, so spurious wakeups may occur: they are
+  *         filtered by the wheel processing.
+  * @param  hrtc RTC handle
+  * @param  pWheel Pointer to the timer wheel, TickShift must be set.
+  *         It must stay valid until HAL_RTCEx_TimerWheelStop() is called.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_RTCEx_TimerWheelStart(RTC_HandleTypeDef *hrtc, RTCEx_TimerWheelTypeDef *pWheel)
+{
+  uint32_t slot;
+
+  if ((pWheel == NULL) || (__HAL_RTC_GET_BINARY_MODE(hrtc) == RTC_BINARY_NONE))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_RTC_TIMERWHEEL_TICKSHIFT(pWheel->TickShift));
+
+  /* The wheel tick is derived from the 64-bit binary counter */
+  if (READ_BIT(RTC->CR, RTC_CR_SSRUIE) == 0U)
+  {
+    if (HAL_RTCEx_StartBinaryCounter(hrtc) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hrtc);
+
+  /* Change RTC state */
+  hrtc->State = HAL_RTC_STATE_BUSY;
+
+  /* Release Alarm A, no timer is running */
+  CLEAR_BIT(RTC->CR, RTC_CR_ALRAE | RTC_CR_ALRAIE);
+  WRITE_REG(RTC->SCR, RTC_SCR_CALRAF);
+
+  for (slot = 0U; slot < RTC_TIMERWHEEL_SLOTS; slot++)
+  {
+    pWheel->pSlot[slot] = NULL;
+  }
+  pWheel->SlotMask = 0U;
+  pWheel->CurrentTick = HAL_RTCEx_GetBinaryCounter(hrtc) >> pWheel->TickShift;
+  pWheel->AlarmTick = RTC_TIMERWHEEL_NO_ALARM;
+
+  hrtc->pTimerWheel = pWheel;
+
+  /* Change RTC state */
+  hrtc->State = HAL_RTC_STATE_READY;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hrtc);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the software timer wheel and release Alarm A.
+  * @note   The running timers are dropped without their callback being executed.
+  * @param  hrtc RTC handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_RTCEx_TimerWheelStop(RTC_HandleTypeDef *hrtc)
+{
+  /* Process Locked */
+  __HAL_LOCK(hrtc);
+
+  /* Change RTC state */
+  hrtc->State = HAL_RTC_STATE_BUSY;
+
+  CLEAR_BIT(RTC->CR, RTC_CR_ALRAE | RTC_CR_ALRAIE);
+  WRITE_REG(RTC->SCR, RTC_SCR_CALRAF);
+
+  hrtc->pTimerWheel = NULL;
+
+  /* Change RTC state */
+  hrtc->State = HAL_RTC_STATE_READY;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hrtc);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Start or restart a software timer.
+  * @note   This function does not take the RTC lock: it may be called from a
+  *         timer callback. The wheel is protected by masking the Alarm A
+  *         interrupt only.
+  * @param  hrtc RTC handle
+  * @param  pTimer Pointer to the timer, Callback must be set.
+  *         It must stay valid while the timer is running.
+  * @param  Delay First expiry delay in wheel ticks, 0 is handled as 1
+  * @param  Period Reload period in wheel ticks, 0 for a one-shot timer
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_RTCEx_TimerStart(RTC_HandleTypeDef *hrtc, RTCEx_TimerTypeDef *pTimer, uint32_t Delay,
+                                       uint32_t Period)
+{
+  RTCEx_TimerWheelTypeDef *pwheel = hrtc->pTimerWheel;
+  uint32_t itstate;
+
+  if ((pwheel == NULL) || (pTimer == NULL) || (pTimer->Callback == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Mask the wheel processing */
+  itstate = READ_BIT(RTC->CR, RTC_CR_ALRAIE);
+  CLEAR_BIT(RTC->CR, RTC_CR_ALRAIE);
+
+  if (pTimer->Active != 0U)
+  {
+    RTCEx_TimerWheelRemove(pwheel, pTimer);
+  }
+
+  pTimer->Period = Period;
+  pTimer->Expiry = (HAL_RTCEx_GetBinaryCounter(hrtc) >> pwheel->TickShift) + ((Delay != 0U) ? Delay : 1U);
+  RTCEx_TimerWheelInsert(pwheel, pTimer);
+
+  if (pTimer->Expiry < pwheel->AlarmTick)
+  {
+    /* Alarm A interrupt is enabled there */
+    RTCEx_TimerWheelSetAlarm(hrtc, pTimer->Expiry);
+  }
+  else if (itstate != 0U)
+  {
+    SET_BIT(RTC->CR, RTC_CR_ALRAIE);
+  }
+  else
+  {
+    /* Alarm A interrupt stays masked */
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop a software timer.
+  * @note   This function does not take the RTC lock: it may be called from a
+  *         timer callback. The programmed alarm is kept, it results at worst in
+  *         a spurious wakeup.
+  * @param  hrtc RTC handle
+  * @param  pTimer Pointer to the timer
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_RTCEx_TimerStop(RTC_HandleTypeDef *hrtc, RTCEx_TimerTypeDef *pTimer)
+{
+  RTCEx_TimerWheelTypeDef *pwheel = hrtc->pTimerWheel;
+  uint32_t itstate;
+
+  if ((pwheel == NULL) || (pTimer == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Mask the wheel processing */
+  itstate = READ_BIT(RTC->CR, RTC_CR_ALRAIE);
+  CLEAR_BIT(RTC->CR, RTC_CR_ALRAIE);
+
+  if (pTimer->Active != 0U)
+  {
+    RTCEx_TimerWheelRemove(pwheel, pTimer);
+  }
+
+  if (itstate != 0U)
+  {
+    SET_BIT(RTC->CR, RTC_CR_ALRAIE);
+  }
+
+  return HAL_OK;
+}
+
 /**
   * @}
   */
@@ -3131,6 +3421,208 @@ void HAL_RTCEx_DisableRemapRtcOut2(RTC_HandleTypeDef *hrtc)
 }
 #endif /* defined (RTC_OR_OUT2_RMP) */
 
+/**
+  * @}
+  */
+
+/** @addtogroup RTCEx_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Process the expired timers of the software timer wheel.
+  * @note   Called from HAL_RTC_AlarmIRQHandler() when Alarm A is owned by the
+  *         wheel. Only the slots of the elapsed ticks are visited, then Alarm A
+  *         is programmed on the next non empty slot.
+  * @param  hrtc RTC handle
+  * @retval None
+  */
+void RTCEx_TimerWheelProcess(RTC_HandleTypeDef *hrtc)
+{
+  RTCEx_TimerWheelTypeDef *pwheel = hrtc->pTimerWheel;
+  RTCEx_TimerTypeDef *pexpired = NULL;
+  RTCEx_TimerTypeDef **pptimer;
+  RTCEx_TimerTypeDef *ptimer;
+  uint64_t now = HAL_RTCEx_GetBinaryCounter(hrtc) >> pwheel->TickShift;
+  uint64_t count;
+  uint32_t slot;
+  uint32_t mask;
+
+  /* Unlink the expired timers of the elapsed ticks, a full rotation at most */
+  count = (now > pwheel->CurrentTick) ? (now - pwheel->CurrentTick) : 0U;
+  if (count > RTC_TIMERWHEEL_SLOTS)
+  {
+    count = RTC_TIMERWHEEL_SLOTS;
+  }
+  while (count != 0U)
+  {
+    slot = (uint32_t)(pwheel->CurrentTick + count) & (RTC_TIMERWHEEL_SLOTS - 1U);
+    pptimer = &pwheel->pSlot[slot];
+    while (*pptimer != NULL)
+    {
+      ptimer = *pptimer;
+      if (ptimer->Expiry <= now)
+      {
+        *pptimer = ptimer->pNext;
+        ptimer->pNext = pexpired;
+        pexpired = ptimer;
+      }
+      else
+      {
+        pptimer = &ptimer->pNext;
+      }
+    }
+    if (pwheel->pSlot[slot] == NULL)
+    {
+      pwheel->SlotMask &= ~(1UL << slot);
+    }
+    count--;
+  }
+  pwheel->CurrentTick = now;
+  pwheel->AlarmTick = RTC_TIMERWHEEL_NO_ALARM;
+
+  /* Reload the periodic timers before the callbacks, which may stop or restart them */
+  while (pexpired != NULL)
+  {
+    ptimer = pexpired;
+    pexpired = ptimer->pNext;
+    if (ptimer->Period != 0U)
+    {
+      ptimer->Expiry += ptimer->Period;
+      if (ptimer->Expiry <= now)
+      {
+        /* Overrun: skip the missed periods */
+        ptimer->Expiry = now + 1U;
+      }
+      RTCEx_TimerWheelInsert(pwheel, ptimer);
+    }
+    else
+    {
+      ptimer->Active = 0U;
+    }
+    ptimer->Callback(ptimer);
+  }
+
+  mask = pwheel->SlotMask;
+  if (mask == 0U)
+  {
+    /* No timer is running */
+    CLEAR_BIT(RTC->CR, RTC_CR_ALRAE | RTC_CR_ALRAIE);
+  }
+  else
+  {
+    /* Rotate the slot bit field so that bit 0 is the slot of the next tick */
+    slot = (uint32_t)(now + 1U) & (RTC_TIMERWHEEL_SLOTS - 1U);
+    if (slot != 0U)
+    {
+      mask = (mask >> slot) | (mask << (RTC_TIMERWHEEL_SLOTS - slot));
+    }
+    RTCEx_TimerWheelSetAlarm(hrtc, now + 1U + POSITION_VAL(mask));
+  }
+}
+
+/**
+  * @brief  Insert a timer in the slot of its expiry tick.
+  * @param  pWheel Pointer to the timer wheel
+  * @param  pTimer Pointer to the timer
+  * @retval None
+  */
+static void RTCEx_TimerWheelInsert(RTCEx_TimerWheelTypeDef *pWheel, RTCEx_TimerTypeDef *pTimer)
+{
+  uint32_t slot = (uint32_t)pTimer->Expiry & (RTC_TIMERWHEEL_SLOTS - 1U);
+
+  pTimer->pNext = pWheel->pSlot[slot];
+  pWheel->pSlot[slot] = pTimer;
+  pWheel->SlotMask |= (1UL << slot);
+  pTimer->Active = 1U;
+}
+
+/**
+  * @brief  Remove a timer from the slot of its expiry tick.
+  * @param  pWheel Pointer to the timer wheel
+  * @param  pTimer Pointer to the timer
+  * @retval None
+  */
+static void RTCEx_TimerWheelRemove(RTCEx_TimerWheelTypeDef *pWheel, RTCEx_TimerTypeDef *pTimer)
+{
+  uint32_t slot = (uint32_t)pTimer->Expiry & (RTC_TIMERWHEEL_SLOTS - 1U);
+  RTCEx_TimerTypeDef **pptimer = &pWheel->pSlot[slot];
+
+  while (*pptimer != NULL)
+  {
+    if (*pptimer == pTimer)
+    {
+      *pptimer = pTimer->pNext;
+      break;
+    }
+    pptimer = &(*pptimer)->pNext;
+  }
+
+  if (pWheel->pSlot[slot] == NULL)
+  {
+    pWheel->SlotMask &= ~(1UL << slot);
+  }
+  pTimer->Active = 0U;
+}
+
+/**
+  * @brief  Program Alarm A on a wheel tick.
+  * @note   The alarm is compared with the SSR, i.e. the inverted low 32 bits of
+  *         the binary counter. If the tick is already reached once programmed,
+  *         the alarm is moved to the next counter periods so that it is never
+  *         missed.
+  * @param  hrtc RTC handle
+  * @param  Tick Wheel tick
+  * @retval None
+  */
+static void RTCEx_TimerWheelSetAlarm(RTC_HandleTypeDef *hrtc, uint64_t Tick)
+{
+  RTCEx_TimerWheelTypeDef *pwheel = hrtc->pTimerWheel;
+  uint64_t target = Tick << pwheel->TickShift;
+  uint64_t now;
+  uint32_t ssmask;
+  uint32_t missed;
+
+  pwheel->AlarmTick = Tick;
+
+  if (__HAL_RTC_GET_BINARY_MODE(hrtc) == RTC_BINARY_ONLY)
+  {
+    ssmask = RTC_ALARMSUBSECONDBINMASK_NONE;
+  }
+  else
+  {
+    /* Only the SSR bits below the calendar second can be compared */
+    ssmask = (8U + (READ_BIT(RTC->ICSR, RTC_ICSR_BCDU) >> RTC_ICSR_BCDU_Pos)) << RTC_ALRMASSR_MASKSS_Pos;
+  }
+
+  do
+  {
+    /* Disable the Alarm A interrupt */
+    CLEAR_BIT(RTC->CR, RTC_CR_ALRAE | RTC_CR_ALRAIE);
+
+    /* Clear flag alarm A */
+    WRITE_REG(RTC->SCR, RTC_SCR_CALRAF);
+
+    if (ssmask != RTC_ALARMSUBSECONDBINMASK_NONE)
+    {
+      WRITE_REG(RTC->ALRMAR, RTC_ALARMMASK_ALL);
+    }
+    WRITE_REG(RTC->ALRMASSR, ssmask);
+    WRITE_REG(RTC->ALRABINR, 0xFFFFFFFFU - (uint32_t)target);
+
+    /* Configure the Alarm interrupt */
+    SET_BIT(RTC->CR, RTC_CR_ALRAE | RTC_CR_ALRAIE);
+
+    now = HAL_RTCEx_GetBinaryCounter(hrtc);
+    missed = (now >= target) ? 1U : 0U;
+    if (missed != 0U)
+    {
+      /* Too late, the wheel processing catches up with the elapsed ticks */
+      target = now + 2U;
+    }
+  } while (missed != 0U);
+}
+
 /**
   * @}
   */
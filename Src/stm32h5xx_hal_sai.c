@@ -124,6 +124,29 @@
       (+) Resume the DMA Transfer using HAL_SAI_DMAResume()
       (+) Stop the DMA Transfer using HAL_SAI_DMAStop()
 
+    *** TDM deinterleaving stream IO operation ***
+    ==============================================
+    [..]
+      (+) Link the Rx DMA handle, on a 2D addressing channel, to a circular queue of two GPDMA
+          2D nodes with the transfer complete event at repeated block level.
+      (+) Receive continuously each active slot into its own channel buffer using
+          HAL_SAI_Receive_TdmStream_DMA() with a user SAI_TdmStreamTypeDef structure.
+      (+) HAL_SAI_RxHalfCpltCallback() and HAL_SAI_RxCpltCallback() are executed when the
+          channel buffers of the first and of the second half are complete; their addresses
+          are given by HAL_SAI_TdmStream_GetChannel().
+      (+) Stop the stream using HAL_SAI_DMAStop()
+
+    *** SAI and MDF synchronized capture ***
+    ========================================
+    [..]
+      (+) Start the MDF filters using HAL_MDF_AcqStart_DMA() in MDF_MODE_SYNC_CONT acquisition
+          mode with MDF_FILTER_TRIG_TRGO trigger source: they wait for the TRGO pulse.
+      (+) Start the master SAI reception using HAL_SAI_MDF_SyncReceive_DMA() or
+          HAL_SAI_MDF_SyncReceive_TdmStream_DMA(): the SAI is enabled and the TRGO pulse
+          generated with the interrupts masked.
+      (+) In the DMA callbacks, HAL_SAI_GetFrameCount() and HAL_MDF_GetAcqSampleCount() give
+          the position of each completed block from this common start.
+
     *** SAI HAL driver additional function list ***
     ===============================================
     [..]
@@ -264,6 +287,12 @@ static HAL_StatusTypeDef SAI_InitI2S(SAI_HandleTypeDef *hsai, uint32_t protocol,
 static HAL_StatusTypeDef SAI_InitPCM(SAI_HandleTypeDef *hsai, uint32_t protocol, uint32_t datasize, uint32_t nbslot);
 
 static HAL_StatusTypeDef SAI_Disable(SAI_HandleTypeDef *hsai);
+static uint32_t SAI_GetActiveSlots(const SAI_HandleTypeDef *hsai);
+static HAL_StatusTypeDef SAI_ReceiveDMA_Arm(SAI_HandleTypeDef *hsai, uint8_t *pData, uint16_t Size);
+static HAL_StatusTypeDef SAI_TdmStream_Arm(SAI_HandleTypeDef *hsai, SAI_TdmStreamTypeDef *pStream);
+#if defined(HAL_MDF_MODULE_ENABLED) && defined(MDF1)
+static HAL_StatusTypeDef SAI_MDF_SyncEnable(SAI_HandleTypeDef *hsai, const MDF_HandleTypeDef *hmdf);
+#endif /* HAL_MDF_MODULE_ENABLED && MDF1 */
 static void SAI_Transmit_IT8Bit(SAI_HandleTypeDef *hsai);
 static void SAI_Transmit_IT16Bit(SAI_HandleTypeDef *hsai);
 static void SAI_Transmit_IT32Bit(SAI_HandleTypeDef *hsai);
@@ -275,6 +304,7 @@ static void SAI_DMATxCplt(DMA_HandleTypeDef *hdma);
 static void SAI_DMATxHalfCplt(DMA_HandleTypeDef *hdma);
 static void SAI_DMARxCplt(DMA_HandleTypeDef *hdma);
 static void SAI_DMARxHalfCplt(DMA_HandleTypeDef *hdma);
+static void SAI_DMATdmCplt(DMA_HandleTypeDef *hdma);
 static void SAI_DMAError(DMA_HandleTypeDef *hdma);
 static void SAI_DMAAbort(DMA_HandleTypeDef *hdma);
 /**
@@ -645,6 +675,9 @@ HAL_StatusTypeDef HAL_SAI_Init(SAI_HandleTypeDef *hsai)
   /* Initialize the error code */
   hsai->ErrorCode = HAL_SAI_ERROR_NONE;
 
+  /* No TDM stream running */
+  hsai->pTdmStream = NULL;
+
   /* Initialize the SAI state */
   hsai->State = HAL_SAI_STATE_READY;
 
@@ -966,6 +999,9 @@ HAL_StatusTypeDef HAL_SAI_UnRegisterCallback(SAI_HandleTypeDef        *hsai,
     (+) Non Blocking mode functions with DMA are :
       (++) HAL_SAI_Transmit_DMA()
       (++) HAL_SAI_Receive_DMA()
+      (++) HAL_SAI_Receive_TdmStream_DMA()
+      (++) HAL_SAI_MDF_SyncReceive_DMA()
+      (++) HAL_SAI_MDF_SyncReceive_TdmStream_DMA()
 
     (+) A set of Transfer Complete Callbacks are provided in non Blocking mode:
       (++) HAL_SAI_TxCpltCallback()
@@ -1422,6 +1458,9 @@ HAL_StatusTypeDef HAL_SAI_DMAStop(SAI_HandleTypeDef *hsai)
   /* Flush the fifo */
   SET_BIT(hsai->Instance->CR2, SAI_xCR2_FFLUSH);
 
+  /* Detach the TDM stream, if any */
+  hsai->pTdmStream = NULL;
+
   /* Set hsai state to ready */
   hsai->State = HAL_SAI_STATE_READY;
 
@@ -1492,6 +1531,9 @@ HAL_StatusTypeDef HAL_SAI_Abort(SAI_HandleTypeDef *hsai)
   /* Flush the fifo */
   SET_BIT(hsai->Instance->CR2, SAI_xCR2_FFLUSH);
 
+  /* Detach the TDM stream, if any */
+  hsai->pTdmStream = NULL;
+
   /* Set hsai state to ready */
   hsai->State = HAL_SAI_STATE_READY;
 
@@ -1633,14 +1675,15 @@ HAL_StatusTypeDef HAL_SAI_Transmit_DMA(SAI_HandleTypeDef *hsai, uint8_t *pData,
 }
 
 /**
-  * @brief  Receive an amount of data in non-blocking mode with DMA.
+  * @brief  Prepare a DMA reception, all but the SAI enable.
+  * @note   On HAL_OK the handle is left locked, the caller enables the SAI and unlocks it.
   * @param  hsai pointer to a SAI_HandleTypeDef structure that contains
   *              the configuration information for SAI module.
   * @param  pData Pointer to data buffer
   * @param  Size Amount of data to be received
   * @retval HAL status
   */
-HAL_StatusTypeDef HAL_SAI_Receive_DMA(SAI_HandleTypeDef *hsai, uint8_t *pData, uint16_t Size)
+static HAL_StatusTypeDef SAI_ReceiveDMA_Arm(SAI_HandleTypeDef *hsai, uint8_t *pData, uint16_t Size)
 {
   HAL_StatusTypeDef status;
 
@@ -1652,6 +1695,7 @@ HAL_StatusTypeDef HAL_SAI_Receive_DMA(SAI_HandleTypeDef *hsai, uint8_t *pData, u
   if (hsai->State == HAL_SAI_STATE_READY)
   {
     uint32_t dmaSrcSize;
+    uint32_t nbslots = SAI_GetActiveSlots(hsai);
 
     /* Process Locked */
     __HAL_LOCK(hsai);
@@ -1662,6 +1706,10 @@ HAL_StatusTypeDef HAL_SAI_Receive_DMA(SAI_HandleTypeDef *hsai, uint8_t *pData, u
     hsai->ErrorCode = HAL_SAI_ERROR_NONE;
     hsai->State = HAL_SAI_STATE_BUSY_RX;
 
+    /* Frames of the buffer, one sample per active slot */
+    hsai->XferBlockFrames = (nbslots != 0U) ? ((uint32_t)Size / nbslots) : (uint32_t)Size;
+    hsai->XferFrameCount  = 0U;
+
     /* Set the SAI Rx DMA Half transfer complete callback */
     hsai->hdmarx->XferHalfCpltCallback = SAI_DMARxHalfCplt;
 
@@ -1728,6 +1776,29 @@ HAL_StatusTypeDef HAL_SAI_Receive_DMA(SAI_HandleTypeDef *hsai, uint8_t *pData, u
     /* Enable SAI Rx DMA Request */
     hsai->Instance->CR1 |= SAI_xCR1_DMAEN;
 
+    /* The SAI is enabled and the handle unlocked by the caller */
+    return HAL_OK;
+  }
+  else
+  {
+    return HAL_BUSY;
+  }
+}
+
+/**
+  * @brief  Receive an amount of data in non-blocking mode with DMA.
+  * @param  hsai pointer to a SAI_HandleTypeDef structure that contains
+  *              the configuration information for SAI module.
+  * @param  pData Pointer to data buffer
+  * @param  Size Amount of data to be received
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SAI_Receive_DMA(SAI_HandleTypeDef *hsai, uint8_t *pData, uint16_t Size)
+{
+  HAL_StatusTypeDef status = SAI_ReceiveDMA_Arm(hsai, pData, Size);
+
+  if (status == HAL_OK)
+  {
     /* Check if the SAI is already enabled */
     if ((hsai->Instance->CR1 & SAI_xCR1_SAIEN) == 0U)
     {
@@ -1737,13 +1808,294 @@ HAL_StatusTypeDef HAL_SAI_Receive_DMA(SAI_HandleTypeDef *hsai, uint8_t *pData, u
 
     /* Process Unlocked */
     __HAL_UNLOCK(hsai);
+  }
 
-    return HAL_OK;
+  return status;
+}
+
+/**
+  * @brief  Prepare a TDM deinterleaving stream, all but the SAI enable.
+  * @note   On HAL_OK the handle is left locked, the caller enables the SAI and unlocks it.
+  * @param  hsai pointer to a SAI_HandleTypeDef structure that contains
+  *              the configuration information for SAI module.
+  * @param  pStream pointer to a SAI_TdmStreamTypeDef structure.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef SAI_TdmStream_Arm(SAI_HandleTypeDef *hsai, SAI_TdmStreamTypeDef *pStream)
+{
+  DMA_NodeTypeDef *pnode[2];
+  uint32_t cllr_offset;
+  uint32_t nbchannels;
+  uint32_t samplesize;
+  uint32_t channelsize;
+  uint32_t cbr1;
+  uint32_t index;
+
+  if ((pStream == NULL) || (pStream->pData == NULL) || (pStream->FrameCount == 0U) ||
+      (pStream->FrameCount > SAI_TDM_STREAM_MAX_FRAMES))
+  {
+    return  HAL_ERROR;
   }
-  else
+
+  if (hsai->State != HAL_SAI_STATE_READY)
   {
     return HAL_BUSY;
   }
+
+  /* The queue must be a circular list of two 2D addressing nodes */
+  if ((hsai->hdmarx == NULL) || (hsai->hdmarx->Mode != DMA_LINKEDLIST_CIRCULAR) ||
+      (hsai->hdmarx->LinkedListQueue == NULL) || (hsai->hdmarx->LinkedListQueue->Head == NULL) ||
+      (hsai->hdmarx->LinkedListQueue->NodeNumber != 2U))
+  {
+    return  HAL_ERROR;
+  }
+
+  pnode[0] = hsai->hdmarx->LinkedListQueue->Head;
+  if ((pnode[0]->NodeInfo & DMA_CHANNEL_TYPE_2D_ADDR) != DMA_CHANNEL_TYPE_2D_ADDR)
+  {
+    return  HAL_ERROR;
+  }
+  cllr_offset = (pnode[0]->NodeInfo & NODE_CLLR_IDX) >> NODE_CLLR_IDX_POS;
+  pnode[1] = (DMA_NodeTypeDef *)(((uint32_t)pnode[0] & DMA_CLBAR_LBA) +
+                                 (pnode[0]->LinkRegisters[cllr_offset] & DMA_CLLR_LA));
+
+  /* One channel per active slot */
+  nbchannels = SAI_GetActiveSlots(hsai);
+
+  /* Size of one sample in bytes, as the DMA source block size of HAL_SAI_Receive_DMA() */
+  if ((hsai->Init.DataSize == SAI_DATASIZE_8) && (hsai->Init.CompandingMode == SAI_NOCOMPANDING))
+  {
+    samplesize = 1U;
+  }
+  else if (hsai->Init.DataSize <= SAI_DATASIZE_16)
+  {
+    samplesize = 2U;
+  }
+  else
+  {
+    samplesize = 4U;
+  }
+
+  /* The block offset from the last channel back to the first one is limited to 16 bits */
+  channelsize = pStream->FrameCount * samplesize;
+  if ((nbchannels == 0U) || (((nbchannels - 1U) * channelsize) > 0xFFFFU))
+  {
+    return  HAL_ERROR;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hsai);
+
+  pStream->NbChannels = nbchannels;
+  pStream->SampleSize = samplesize;
+  pStream->NextHalf   = 0U;
+  hsai->pTdmStream    = pStream;
+
+  hsai->pBuffPtr = pStream->pData;
+  hsai->ErrorCode = HAL_SAI_ERROR_NONE;
+  hsai->State = HAL_SAI_STATE_BUSY_RX;
+
+  /* Each node holds FrameCount frames */
+  hsai->XferBlockFrames = 2U * pStream->FrameCount;
+  hsai->XferFrameCount  = 0U;
+
+  /* One block per TDM frame, repeated for the FrameCount frames of a half.
+     After each sample the destination jumps to the same frame of the next channel,
+     after each frame it steps back to the next sample of the first channel. */
+  cbr1 = (nbchannels * samplesize) | ((pStream->FrameCount - 1U) << DMA_CBR1_BRC_Pos);
+  if (nbchannels > 1U)
+  {
+    cbr1 |= DMA_CBR1_BRDDEC;
+  }
+
+  for (index = 0U; index < 2U; index++)
+  {
+    pnode[index]->LinkRegisters[NODE_CBR1_DEFAULT_OFFSET] = cbr1;
+    pnode[index]->LinkRegisters[NODE_CSAR_DEFAULT_OFFSET] = (uint32_t)&hsai->Instance->DR;
+    pnode[index]->LinkRegisters[NODE_CDAR_DEFAULT_OFFSET] = (uint32_t)pStream->pData +
+                                                            (index * nbchannels * channelsize);
+    pnode[index]->LinkRegisters[NODE_CTR3_DEFAULT_OFFSET] = (channelsize - samplesize) << DMA_CTR3_DAO_Pos;
+    pnode[index]->LinkRegisters[NODE_CBR2_DEFAULT_OFFSET] = ((nbchannels - 1U) * channelsize) << DMA_CBR2_BRDAO_Pos;
+  }
+
+  /* One transfer complete event per node, no half transfer event */
+  hsai->hdmarx->XferHalfCpltCallback = NULL;
+
+  /* Set the SAI Rx DMA transfer complete callback */
+  hsai->hdmarx->XferCpltCallback = SAI_DMATdmCplt;
+
+  /* Set the DMA error callback */
+  hsai->hdmarx->XferErrorCallback = SAI_DMAError;
+
+  /* Set the DMA Rx abort callback */
+  hsai->hdmarx->XferAbortCallback = NULL;
+
+  if (HAL_DMAEx_List_Start_IT(hsai->hdmarx) != HAL_OK)
+  {
+    hsai->pTdmStream = NULL;
+    hsai->State = HAL_SAI_STATE_READY;
+    __HAL_UNLOCK(hsai);
+    return  HAL_ERROR;
+  }
+
+  /* Enable the interrupts for error handling */
+  __HAL_SAI_ENABLE_IT(hsai, SAI_InterruptFlag(hsai, SAI_MODE_DMA));
+
+  /* Enable SAI Rx DMA Request */
+  hsai->Instance->CR1 |= SAI_xCR1_DMAEN;
+
+  /* The SAI is enabled and the handle unlocked by the caller */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Receive continuously the active TDM slots, each slot into its own channel buffer.
+  * @note   The samples are deinterleaved by the DMA with 2D addressing: hdmarx must be a
+  *         2D addressing channel linked to a circular queue of two GPDMA 2D nodes, both
+  *         built with the Rx DMA parameters, a burst length of one beat and the transfer
+  *         complete event at repeated block level (DMA_TCEM_REPEATED_BLOCK_TRANSFER).
+  *         The sizes, addresses and offsets of the two nodes are set by this function.
+  * @note   Each node fills one half: HAL_SAI_RxHalfCpltCallback() is called when the
+  *         channel buffers of the first half are complete and HAL_SAI_RxCpltCallback()
+  *         when those of the second half are, while the DMA goes on with the other half.
+  * @note   pStream->pData holds 2 x NbChannels x FrameCount samples, NbChannels being the
+  *         number of SlotInit.SlotActive slots; the sample size follows Init.DataSize as
+  *         in HAL_SAI_Receive_DMA(). The stream is stopped with HAL_SAI_DMAStop().
+  * @param  hsai pointer to a SAI_HandleTypeDef structure that contains
+  *              the configuration information for SAI module.
+  * @param  pStream pointer to a SAI_TdmStreamTypeDef structure that must remain
+  *                 valid until the stream is stopped.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SAI_Receive_TdmStream_DMA(SAI_HandleTypeDef *hsai, SAI_TdmStreamTypeDef *pStream)
+{
+  HAL_StatusTypeDef status = SAI_TdmStream_Arm(hsai, pStream);
+
+  if (status == HAL_OK)
+  {
+    /* Check if the SAI is already enabled */
+    if ((hsai->Instance->CR1 & SAI_xCR1_SAIEN) == 0U)
+    {
+      /* Enable SAI peripheral */
+      __HAL_SAI_ENABLE(hsai);
+    }
+
+    /* Process Unlocked */
+    __HAL_UNLOCK(hsai);
+  }
+
+  return status;
+}
+
+#if defined(HAL_MDF_MODULE_ENABLED) && defined(MDF1)
+/**
+  * @brief  Receive an amount of data with DMA, started on the same trigger as MDF filters.
+  * @note   The MDF filters must have been started with HAL_MDF_AcqStart_DMA() in
+  *         MDF_MODE_SYNC_CONT acquisition mode with MDF_FILTER_TRIG_TRGO as trigger source,
+  *         so that they wait for the TRGO pulse generated here right after the SAI enable.
+  * @note   The SAI must be master: a slave SAI starts on the next frame synchronization of
+  *         its master. HAL_SAI_GetFrameCount() and HAL_MDF_GetAcqSampleCount() then count
+  *         from the same instant, within the time between the two register writes.
+  * @param  hsai pointer to a SAI_HandleTypeDef structure that contains
+  *              the configuration information for SAI module.
+  * @param  pData Pointer to data buffer
+  * @param  Size Amount of data to be received
+  * @param  hmdf MDF handle generating the TRGO pulse.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SAI_MDF_SyncReceive_DMA(SAI_HandleTypeDef *hsai, uint8_t *pData, uint16_t Size,
+                                              const MDF_HandleTypeDef *hmdf)
+{
+  HAL_StatusTypeDef status;
+
+  if ((hmdf == NULL) || ((hsai->Instance->CR1 & SAI_xCR1_SAIEN) != 0U))
+  {
+    return  HAL_ERROR;
+  }
+
+  status = SAI_ReceiveDMA_Arm(hsai, pData, Size);
+
+  if (status == HAL_OK)
+  {
+    status = SAI_MDF_SyncEnable(hsai, hmdf);
+
+    /* Process Unlocked */
+    __HAL_UNLOCK(hsai);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Receive a TDM deinterleaving stream, started on the same trigger as MDF filters.
+  * @note   Same conditions as HAL_SAI_MDF_SyncReceive_DMA(), the stream being configured
+  *         as with HAL_SAI_Receive_TdmStream_DMA().
+  * @param  hsai pointer to a SAI_HandleTypeDef structure that contains
+  *              the configuration information for SAI module.
+  * @param  pStream pointer to a SAI_TdmStreamTypeDef structure that must remain
+  *                 valid until the stream is stopped.
+  * @param  hmdf MDF handle generating the TRGO pulse.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SAI_MDF_SyncReceive_TdmStream_DMA(SAI_HandleTypeDef *hsai, SAI_TdmStreamTypeDef *pStream,
+                                                        const MDF_HandleTypeDef *hmdf)
+{
+  HAL_StatusTypeDef status;
+
+  if ((hmdf == NULL) || ((hsai->Instance->CR1 & SAI_xCR1_SAIEN) != 0U))
+  {
+    return  HAL_ERROR;
+  }
+
+  status = SAI_TdmStream_Arm(hsai, pStream);
+
+  if (status == HAL_OK)
+  {
+    status = SAI_MDF_SyncEnable(hsai, hmdf);
+
+    /* Process Unlocked */
+    __HAL_UNLOCK(hsai);
+  }
+
+  return status;
+}
+#endif /* HAL_MDF_MODULE_ENABLED && MDF1 */
+
+/**
+  * @brief  Get the number of frames received by the completed DMA blocks.
+  * @note   The counter is reset by the reception start functions and incremented before
+  *         HAL_SAI_RxHalfCpltCallback() and HAL_SAI_RxCpltCallback() are called, so that
+  *         in these callbacks it gives the index following the last frame of the completed
+  *         block, to be correlated with HAL_MDF_GetAcqSampleCount().
+  * @param  hsai pointer to a SAI_HandleTypeDef structure that contains
+  *              the configuration information for SAI module.
+  * @retval Number of frames.
+  */
+uint32_t HAL_SAI_GetFrameCount(const SAI_HandleTypeDef *hsai)
+{
+  return hsai->XferFrameCount;
+}
+
+/**
+  * @brief  Get the buffer of one channel of a running TDM stream.
+  * @param  hsai pointer to a SAI_HandleTypeDef structure that contains
+  *              the configuration information for SAI module.
+  * @param  Half Half of the stream, 0 (first) or 1 (second).
+  * @param  Channel Index of the channel, the active slots being numbered
+  *                 from the lowest one.
+  * @retval Address of the FrameCount samples of the channel, NULL if no stream
+  *         is running or the parameters are out of range.
+  */
+uint8_t *HAL_SAI_TdmStream_GetChannel(const SAI_HandleTypeDef *hsai, uint32_t Half, uint32_t Channel)
+{
+  const SAI_TdmStreamTypeDef *pstream = hsai->pTdmStream;
+
+  if ((pstream == NULL) || (Half > 1U) || (Channel >= pstream->NbChannels))
+  {
+    return NULL;
+  }
+
+  return &pstream->pData[((Half * pstream->NbChannels) + Channel) * pstream->FrameCount * pstream->SampleSize];
 }
 
 /**
@@ -1834,6 +2186,8 @@ HAL_StatusTypeDef HAL_SAI_DisableRxMuteMode(SAI_HandleTypeDef *hsai)
   */
 void HAL_SAI_IRQHandler(SAI_HandleTypeDef *hsai)
 {
+  HAL_TRACE_ENTER(HAL_TRACE_ID_SAI_IRQ, hsai);
+
   if (hsai->State != HAL_SAI_STATE_RESET)
   {
     uint32_t itflags = hsai->Instance->SR;
@@ -2099,6 +2453,8 @@ void HAL_SAI_IRQHandler(SAI_HandleTypeDef *hsai)
       /* Nothing to do */
     }
   }
+
+  HAL_TRACE_EXIT(HAL_TRACE_ID_SAI_IRQ, hsai);
 }
 
 /**
@@ -2511,6 +2867,61 @@ static HAL_StatusTypeDef SAI_Disable(SAI_HandleTypeDef *hsai)
   return status;
 }
 
+/**
+  * @brief  Get the number of active slots.
+  * @param  hsai pointer to a SAI_HandleTypeDef structure that contains
+  *              the configuration information for SAI module.
+  * @retval Number of SlotInit.SlotActive slots.
+  */
+static uint32_t SAI_GetActiveSlots(const SAI_HandleTypeDef *hsai)
+{
+  uint32_t slots = hsai->SlotInit.SlotActive & SAI_SLOTACTIVE_ALL;
+  uint32_t nbslots = 0U;
+
+  while (slots != 0U)
+  {
+    nbslots += (slots & 1U);
+    slots = slots >> 1U;
+  }
+
+  return nbslots;
+}
+
+#if defined(HAL_MDF_MODULE_ENABLED) && defined(MDF1)
+/**
+  * @brief  Enable the SAI and generate the MDF TRGO pulse back to back.
+  * @param  hsai pointer to a SAI_HandleTypeDef structure that contains
+  *              the configuration information for SAI module.
+  * @param  hmdf MDF handle generating the TRGO pulse.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef SAI_MDF_SyncEnable(SAI_HandleTypeDef *hsai, const MDF_HandleTypeDef *hmdf)
+{
+  HAL_StatusTypeDef status;
+  uint32_t primask_bit;
+
+  /* No interrupt between the SAI start and the trigger of the filters */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  /* Enable SAI peripheral */
+  __HAL_SAI_ENABLE(hsai);
+
+  /* Start the filters waiting for TRGO */
+  status = HAL_MDF_GenerateTrgo(hmdf);
+
+  __set_PRIMASK(primask_bit);
+
+  if (status != HAL_OK)
+  {
+    /* The filters are not started, the SAI is left running */
+    hsai->ErrorCode |= HAL_SAI_ERROR_SYNC;
+  }
+
+  return status;
+}
+#endif /* HAL_MDF_MODULE_ENABLED && MDF1 */
+
 /**
   * @brief  Tx Handler for Transmit in Interrupt mode 8-Bit transfer.
   * @param  hsai pointer to a SAI_HandleTypeDef structure that contains
@@ -2775,6 +3186,9 @@ static void SAI_DMARxCplt(DMA_HandleTypeDef *hdma)
 {
   SAI_HandleTypeDef *hsai = (SAI_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
 
+  /* Second half of the buffer received */
+  hsai->XferFrameCount += hsai->XferBlockFrames - (hsai->XferBlockFrames / 2U);
+
   /* Check if DMA in circular mode*/
   if (hdma->Mode != DMA_LINKEDLIST_CIRCULAR)
   {
@@ -2805,6 +3219,9 @@ static void SAI_DMARxHalfCplt(DMA_HandleTypeDef *hdma)
 {
   SAI_HandleTypeDef *hsai = (SAI_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
 
+  /* First half of the buffer received */
+  hsai->XferFrameCount += hsai->XferBlockFrames / 2U;
+
 #if (USE_HAL_SAI_REGISTER_CALLBACKS == 1)
   hsai->RxHalfCpltCallback(hsai);
 #else
@@ -2812,6 +3229,40 @@ static void SAI_DMARxHalfCplt(DMA_HandleTypeDef *hdma)
 #endif /* USE_HAL_SAI_REGISTER_CALLBACKS */
 }
 
+/**
+  * @brief  DMA SAI TDM stream node complete callback
+  * @param  hdma pointer to a DMA_HandleTypeDef structure that contains
+  *              the configuration information for the specified DMA module.
+  * @retval None
+  */
+static void SAI_DMATdmCplt(DMA_HandleTypeDef *hdma)
+{
+  SAI_HandleTypeDef *hsai = (SAI_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+  SAI_TdmStreamTypeDef *pstream = hsai->pTdmStream;
+  uint32_t half = pstream->NextHalf;
+
+  /* The DMA goes on with the node of the other half */
+  pstream->NextHalf = half ^ 1U;
+  hsai->XferFrameCount += pstream->FrameCount;
+
+  if (half == 0U)
+  {
+#if (USE_HAL_SAI_REGISTER_CALLBACKS == 1)
+    hsai->RxHalfCpltCallback(hsai);
+#else
+    HAL_SAI_RxHalfCpltCallback(hsai);
+#endif /* USE_HAL_SAI_REGISTER_CALLBACKS */
+  }
+  else
+  {
+#if (USE_HAL_SAI_REGISTER_CALLBACKS == 1)
+    hsai->RxCpltCallback(hsai);
+#else
+    HAL_SAI_RxCpltCallback(hsai);
+#endif /* USE_HAL_SAI_REGISTER_CALLBACKS */
+  }
+}
+
 /**
   * @brief  DMA SAI communication error callback.
   * @param  hdma pointer to a DMA_HandleTypeDef structure that contains
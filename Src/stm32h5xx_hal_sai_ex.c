@@ -6,6 +6,7 @@
   *          This file provides firmware functions to manage the following
   *          functionality of the SAI Peripheral Controller:
   *           + Modify PDM microphone delays.
+  *           + Track an audio source clock with the PLL fractional multiplier.
   *
   ******************************************************************************
   * @attention
@@ -44,6 +45,8 @@
 #define SAI_PDM_DELAY_MASK          0x77UL
 #define SAI_PDM_DELAY_OFFSET        8U
 #define SAI_PDM_RIGHT_DELAY_OFFSET  4U
+#define SAI_CLOCKTRACK_FRACN_MAX    8191U
+#define SAI_CLOCKTRACK_INTEGRAL_MAX 0x00FFFFFF
 /**
   * @}
   */
@@ -113,6 +116,199 @@ HAL_StatusTypeDef HAL_SAIEx_ConfigPdmMicDelay(const SAI_HandleTypeDef *hsai,
   return status;
 }
 
+/**
+  * @}
+  */
+
+/** @defgroup SAIEx_Exported_Functions_Group2 Clock tracking functions
+  * @brief    SAIEx clock tracking functions
+  *
+@verbatim
+ ===============================================================================
+                 ##### Clock tracking functions #####
+ ===============================================================================
+    [..]  This section provides functions allowing to lock the SAI sample rate on an
+          asynchronous audio source or sink (USB, network), without software resampling:
+      (+) Initialize a SAIEx_ClockTrackTypeDef controller with HAL_SAIEx_ClockTrack_Init(),
+          the audio PLL being already running with its fractional multiplier enabled.
+      (+) Periodically (e.g. in HAL_SAI_TxHalfCpltCallback() or at each received packet),
+          compute the buffer fill level, for instance from HAL_SAIEx_GetDMAPosition() and
+          the application write position, and give it to HAL_SAIEx_ClockTrack_Update().
+          A fill level above the target speeds the SAI clock up, below slows it down.
+      (+) The FRACN value is updated on the fly with HAL_RCCEx_SetPLL2FRACN() or
+          HAL_RCCEx_SetPLL3FRACN(): the PLL does not relock and the SAI clock has no glitch.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Get the current position of the SAI DMA in the transfer buffer.
+  * @note   Meaningful for a transfer started by HAL_SAI_Transmit_DMA() or HAL_SAI_Receive_DMA()
+  *         on a circular DMA channel.
+  * @param  hsai SAI handle.
+  * @retval Index of the next data transferred by the DMA, 0 if no DMA transfer is ongoing.
+  */
+uint32_t HAL_SAIEx_GetDMAPosition(const SAI_HandleTypeDef *hsai)
+{
+  const DMA_HandleTypeDef *hdma;
+  uint32_t remaining;
+
+  if (hsai->State == HAL_SAI_STATE_BUSY_TX)
+  {
+    hdma = hsai->hdmatx;
+  }
+  else if (hsai->State == HAL_SAI_STATE_BUSY_RX)
+  {
+    hdma = hsai->hdmarx;
+  }
+  else
+  {
+    return 0U;
+  }
+
+  if (hdma == NULL)
+  {
+    return 0U;
+  }
+
+  /* Remaining bytes of the block converted into remaining data according SAI data size */
+  remaining = __HAL_DMA_GET_COUNTER(hdma);
+  if ((hsai->Init.DataSize == SAI_DATASIZE_8) && (hsai->Init.CompandingMode == SAI_NOCOMPANDING))
+  {
+    /* Nothing to do */
+  }
+  else if (hsai->Init.DataSize <= SAI_DATASIZE_16)
+  {
+    remaining /= 2U;
+  }
+  else
+  {
+    remaining /= 4U;
+  }
+
+  return (remaining < hsai->XferSize) ? ((uint32_t)hsai->XferSize - remaining) : 0U;
+}
+
+/**
+  * @brief  Initialize a SAI clock tracking controller and apply the nominal FRACN value.
+  * @param  pTrack Clock tracking controller, PLL, NominalFracN, MaxDeviation, TargetLevel, Kp and Ki
+  *         being set by the user.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SAIEx_ClockTrack_Init(SAIEx_ClockTrackTypeDef *pTrack)
+{
+  if (pTrack == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_SAIEX_CLOCKTRACK_PLL(pTrack->PLL));
+
+  if (pTrack->NominalFracN > SAI_CLOCKTRACK_FRACN_MAX)
+  {
+    return HAL_ERROR;
+  }
+
+  pTrack->Integral = 0;
+  pTrack->FracN    = pTrack->NominalFracN;
+
+#if defined(RCC_CR_PLL3ON)
+  if (pTrack->PLL == SAIEX_CLOCKTRACK_PLL3)
+  {
+    return HAL_RCCEx_SetPLL3FRACN(pTrack->FracN);
+  }
+#endif /* RCC_CR_PLL3ON */
+
+  return HAL_RCCEx_SetPLL2FRACN(pTrack->FracN);
+}
+
+/**
+  * @brief  Run one step of the SAI clock tracking controller.
+  * @param  pTrack Clock tracking controller initialized by HAL_SAIEx_ClockTrack_Init().
+  * @param  FillLevel Current fill level of the audio buffer, in samples.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SAIEx_ClockTrack_Update(SAIEx_ClockTrackTypeDef *pTrack, uint32_t FillLevel)
+{
+  int32_t error;
+  int32_t correction;
+  int32_t fracn;
+  int32_t fracn_min;
+  int32_t fracn_max;
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if (pTrack == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Fill level error, accumulated with anti wind-up clamping */
+  error = (int32_t)FillLevel - (int32_t)pTrack->TargetLevel;
+  pTrack->Integral += error;
+  if (pTrack->Integral > SAI_CLOCKTRACK_INTEGRAL_MAX)
+  {
+    pTrack->Integral = SAI_CLOCKTRACK_INTEGRAL_MAX;
+  }
+  else if (pTrack->Integral < -SAI_CLOCKTRACK_INTEGRAL_MAX)
+  {
+    pTrack->Integral = -SAI_CLOCKTRACK_INTEGRAL_MAX;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  /* Proportional-integral correction, gains in 1/256 FRACN step */
+  correction = ((pTrack->Kp * error) + (pTrack->Ki * pTrack->Integral)) / 256;
+
+  /* Clamp the FRACN value to the allowed deviation and to the register range */
+  fracn_min = (int32_t)pTrack->NominalFracN - (int32_t)pTrack->MaxDeviation;
+  fracn_max = (int32_t)pTrack->NominalFracN + (int32_t)pTrack->MaxDeviation;
+  if (fracn_min < 0)
+  {
+    fracn_min = 0;
+  }
+  if (fracn_max > (int32_t)SAI_CLOCKTRACK_FRACN_MAX)
+  {
+    fracn_max = (int32_t)SAI_CLOCKTRACK_FRACN_MAX;
+  }
+
+  fracn = (int32_t)pTrack->NominalFracN + correction;
+  if (fracn < fracn_min)
+  {
+    fracn = fracn_min;
+  }
+  else if (fracn > fracn_max)
+  {
+    fracn = fracn_max;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  /* Update the PLL only when the FRACN value changes */
+  if ((uint32_t)fracn != pTrack->FracN)
+  {
+    pTrack->FracN = (uint32_t)fracn;
+
+#if defined(RCC_CR_PLL3ON)
+    if (pTrack->PLL == SAIEX_CLOCKTRACK_PLL3)
+    {
+      status = HAL_RCCEx_SetPLL3FRACN(pTrack->FracN);
+    }
+    else
+#endif /* RCC_CR_PLL3ON */
+    {
+      status = HAL_RCCEx_SetPLL2FRACN(pTrack->FracN);
+    }
+  }
+
+  return status;
+}
+
 /**
   * @}
   */
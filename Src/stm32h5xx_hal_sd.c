@@ -614,6 +614,7 @@ HAL_StatusTypeDef HAL_SD_DeInit(SD_HandleTypeDef *hsd)
 #endif /* USE_HAL_SD_REGISTER_CALLBACKS */
 
   hsd->ErrorCode = HAL_SD_ERROR_NONE;
+  hsd->pRequestQueue = NULL;
   hsd->State = HAL_SD_STATE_RESET;
 
   return HAL_OK;
@@ -1256,6 +1257,7 @@ HAL_StatusTypeDef HAL_SD_ReadBlocks_DMA(SD_HandleTypeDef *hsd, uint8_t *pData, u
     hsd->ErrorCode |= HAL_SD_ERROR_PARAM;
     return HAL_ERROR;
   }
+  assert_param(IS_HAL_MEM_REACHABLE(HAL_MEM_MASTER_SDMMC, pData, NumberOfBlocks * BLOCKSIZE));
 
   if (hsd->State == HAL_SD_STATE_READY)
   {
@@ -1275,6 +1277,11 @@ HAL_StatusTypeDef HAL_SD_ReadBlocks_DMA(SD_HandleTypeDef *hsd, uint8_t *pData, u
     hsd->pRxBuffPtr = pData;
     hsd->RxXferSize = BLOCKSIZE * NumberOfBlocks;
 
+#if defined(USE_HAL_DCACHE_DMA_COHERENCY) && (USE_HAL_DCACHE_DMA_COHERENCY == 1U)
+    /* Start removing the cache lines of the buffer while the data path is configured */
+    (void)HAL_DCACHE_DMA_PrepareRx(pData, hsd->RxXferSize);
+#endif /* USE_HAL_DCACHE_DMA_COHERENCY */
+
     if (hsd->SdCard.CardType != CARD_SDHC_SDXC)
     {
       add *= BLOCKSIZE;
@@ -1289,6 +1296,16 @@ HAL_StatusTypeDef HAL_SD_ReadBlocks_DMA(SD_HandleTypeDef *hsd, uint8_t *pData, u
     config.DPSM          = SDMMC_DPSM_DISABLE;
     (void)SDMMC_ConfigData(hsd->Instance, &config);
 
+#if defined(USE_HAL_DCACHE_DMA_COHERENCY) && (USE_HAL_DCACHE_DMA_COHERENCY == 1U)
+    /* The cache maintenance started above must end before the IDMA accesses the buffer */
+    if (HAL_DCACHE_DMA_WaitPrepared() != HAL_OK)
+    {
+      hsd->ErrorCode |= HAL_SD_ERROR_DMA;
+      hsd->State = HAL_SD_STATE_READY;
+      return HAL_ERROR;
+    }
+#endif /* USE_HAL_DCACHE_DMA_COHERENCY */
+
     __SDMMC_CMDTRANS_ENABLE(hsd->Instance);
     hsd->Instance->IDMABASER = (uint32_t) pData ;
     hsd->Instance->IDMACTRL  = SDMMC_ENABLE_IDMA_SINGLE_BUFF;
@@ -1354,6 +1371,7 @@ HAL_StatusTypeDef HAL_SD_WriteBlocks_DMA(SD_HandleTypeDef *hsd, const uint8_t *p
     hsd->ErrorCode |= HAL_SD_ERROR_PARAM;
     return HAL_ERROR;
   }
+  assert_param(IS_HAL_MEM_REACHABLE(HAL_MEM_MASTER_SDMMC, pData, NumberOfBlocks * BLOCKSIZE));
 
   if (hsd->State == HAL_SD_STATE_READY)
   {
@@ -1373,6 +1391,11 @@ HAL_StatusTypeDef HAL_SD_WriteBlocks_DMA(SD_HandleTypeDef *hsd, const uint8_t *p
     hsd->pTxBuffPtr = pData;
     hsd->TxXferSize = BLOCKSIZE * NumberOfBlocks;
 
+#if defined(USE_HAL_DCACHE_DMA_COHERENCY) && (USE_HAL_DCACHE_DMA_COHERENCY == 1U)
+    /* Start writing back the cache lines of the buffer while the data path is configured */
+    (void)HAL_DCACHE_DMA_PrepareTx(pData, hsd->TxXferSize);
+#endif /* USE_HAL_DCACHE_DMA_COHERENCY */
+
     if (hsd->SdCard.CardType != CARD_SDHC_SDXC)
     {
       add *= BLOCKSIZE;
@@ -1387,6 +1410,16 @@ HAL_StatusTypeDef HAL_SD_WriteBlocks_DMA(SD_HandleTypeDef *hsd, const uint8_t *p
     config.DPSM          = SDMMC_DPSM_DISABLE;
     (void)SDMMC_ConfigData(hsd->Instance, &config);
 
+#if defined(USE_HAL_DCACHE_DMA_COHERENCY) && (USE_HAL_DCACHE_DMA_COHERENCY == 1U)
+    /* The cache maintenance started above must end before the IDMA accesses the buffer */
+    if (HAL_DCACHE_DMA_WaitPrepared() != HAL_OK)
+    {
+      hsd->ErrorCode |= HAL_SD_ERROR_DMA;
+      hsd->State = HAL_SD_STATE_READY;
+      return HAL_ERROR;
+    }
+#endif /* USE_HAL_DCACHE_DMA_COHERENCY */
+
     __SDMMC_CMDTRANS_ENABLE(hsd->Instance);
 
     hsd->Instance->IDMABASER = (uint32_t) pData ;
@@ -1605,8 +1638,18 @@ void HAL_SD_IRQHandler(SD_HandleTypeDef *hsd)
       hsd->Instance->DCTRL = 0;
       hsd->Instance->IDMACTRL = SDMMC_DISABLE_IDMA;
 
-      /* Stop Transfer for Write Multi blocks or Read Multi blocks */
-      if (((context & SD_CONTEXT_READ_MULTIPLE_BLOCK) != 0U) || ((context & SD_CONTEXT_WRITE_MULTIPLE_BLOCK) != 0U))
+#if defined(USE_HAL_DCACHE_DMA_COHERENCY) && (USE_HAL_DCACHE_DMA_COHERENCY == 1U)
+      if (((context & SD_CONTEXT_READ_SINGLE_BLOCK) != 0U) || ((context & SD_CONTEXT_READ_MULTIPLE_BLOCK) != 0U))
+      {
+        /* Drop the cache lines loaded while the IDMA wrote the buffer */
+        (void)HAL_DCACHE_DMA_CompleteRx(hsd->pRxBuffPtr, hsd->RxXferSize);
+      }
+#endif /* USE_HAL_DCACHE_DMA_COHERENCY */
+
+      /* Stop Transfer for Write Multi blocks or Read Multi blocks,                */
+      /* not needed when the block count has been predefined with CMD23           */
+      if ((((context & SD_CONTEXT_READ_MULTIPLE_BLOCK) != 0U) || ((context & SD_CONTEXT_WRITE_MULTIPLE_BLOCK) != 0U))
+          && ((context & SD_CONTEXT_BLOCK_COUNT) == 0U))
       {
         errorstate = SDMMC_CmdStopTransfer(hsd->Instance);
         if (errorstate != HAL_SD_ERROR_NONE)
@@ -1622,21 +1665,29 @@ void HAL_SD_IRQHandler(SD_HandleTypeDef *hsd)
 
       hsd->State = HAL_SD_STATE_READY;
       hsd->Context = SD_CONTEXT_NONE;
-      if (((context & SD_CONTEXT_WRITE_SINGLE_BLOCK) != 0U) || ((context & SD_CONTEXT_WRITE_MULTIPLE_BLOCK) != 0U))
+      if (hsd->pRequestQueue != NULL)
       {
+        /* Complete the queued request and issue the next one */
+        HAL_SDEx_RequestQueue_IRQHandler(hsd);
+      }
+      else
+      {
+        if (((context & SD_CONTEXT_WRITE_SINGLE_BLOCK) != 0U) || ((context & SD_CONTEXT_WRITE_MULTIPLE_BLOCK) != 0U))
+        {
 #if defined (USE_HAL_SD_REGISTER_CALLBACKS) && (USE_HAL_SD_REGISTER_CALLBACKS == 1U)
-        hsd->TxCpltCallback(hsd);
+          hsd->TxCpltCallback(hsd);
 #else
-        HAL_SD_TxCpltCallback(hsd);
+          HAL_SD_TxCpltCallback(hsd);
 #endif /* USE_HAL_SD_REGISTER_CALLBACKS */
-      }
-      if (((context & SD_CONTEXT_READ_SINGLE_BLOCK) != 0U) || ((context & SD_CONTEXT_READ_MULTIPLE_BLOCK) != 0U))
-      {
+        }
+        if (((context & SD_CONTEXT_READ_SINGLE_BLOCK) != 0U) || ((context & SD_CONTEXT_READ_MULTIPLE_BLOCK) != 0U))
+        {
 #if defined (USE_HAL_SD_REGISTER_CALLBACKS) && (USE_HAL_SD_REGISTER_CALLBACKS == 1U)
-        hsd->RxCpltCallback(hsd);
+          hsd->RxCpltCallback(hsd);
 #else
-        HAL_SD_RxCpltCallback(hsd);
+          HAL_SD_RxCpltCallback(hsd);
 #endif /* USE_HAL_SD_REGISTER_CALLBACKS */
+        }
       }
     }
     else
@@ -1706,11 +1757,19 @@ void HAL_SD_IRQHandler(SD_HandleTypeDef *hsd)
 
         /* Set the SD state to ready to be able to start again the process */
         hsd->State = HAL_SD_STATE_READY;
+        if (hsd->pRequestQueue != NULL)
+        {
+          /* Complete the queued request in error and issue the next one */
+          HAL_SDEx_RequestQueue_IRQHandler(hsd);
+        }
+        else
+        {
 #if defined (USE_HAL_SD_REGISTER_CALLBACKS) && (USE_HAL_SD_REGISTER_CALLBACKS == 1U)
-        hsd->ErrorCallback(hsd);
+          hsd->ErrorCallback(hsd);
 #else
-        HAL_SD_ErrorCallback(hsd);
+          HAL_SD_ErrorCallback(hsd);
 #endif /* USE_HAL_SD_REGISTER_CALLBACKS */
+        }
       }
     }
     else
@@ -1740,6 +1799,13 @@ void HAL_SD_IRQHandler(SD_HandleTypeDef *hsd)
 #endif /* USE_HAL_SD_REGISTER_CALLBACKS */
     }
   }
+
+  else if ((__HAL_SD_GET_FLAG(hsd, SDMMC_FLAG_BUSYD0END) != RESET) && (hsd->pRequestQueue != NULL) &&
+           ((hsd->Instance->MASK & SDMMC_IT_BUSYD0END) != 0U))
+  {
+    /* End of card programming of the queued request */
+    HAL_SDEx_RequestQueue_IRQHandler(hsd);
+  }
   else
   {
     /* Nothing to do */
@@ -27,6 +27,15 @@
    (+) Configure Buffer0 and Buffer1 start address and Buffer size using HAL_SDEx_ConfigDMAMultiBuffer() function.
    (+) Start Read and Write for multibuffer mode using HAL_SDEx_ReadBlocksDMAMultiBuffer()
        and HAL_SDEx_WriteBlocksDMAMultiBuffer() functions.
+   (+) Write a sequential area in pre-erased multiple block transfers without stop transmission
+       command using HAL_SDEx_WriteSession_Start() and HAL_SDEx_WriteSession_WriteBlocks().
+   (+) Read and Write blocks from or to fragmented buffers without intermediate copy using
+       HAL_SDEx_ReadBlocksIOVec_DMA() and HAL_SDEx_WriteBlocksIOVec_DMA() functions.
+   (+) Queue read, write and erase requests processed in sequence from the SD interrupt
+       using HAL_SDEx_RequestQueue_Init() and HAL_SDEx_RequestQueue_Submit() functions.
+   (+) Tune the sampling point of the UHS-I SDR104 and SDR50 modes with the delay block using
+       HAL_SDEx_ConfigSpeedBusOperationTuned() or HAL_SDEx_ExecuteTuning(), and restore a
+       previous tuning result with HAL_SDEx_ApplyTuning().
 
   @endverbatim
   ******************************************************************************
@@ -49,9 +58,57 @@
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
+#if defined (DLYB_SDMMC1) || defined (DLYB_SDMMC2)
+/** @defgroup SDEx_Private_Defines SDEx Private Defines
+  * @{
+  */
+#define SDEX_TUNING_BLOCK_SIZE      64U           /*!< Size of the 4-bit bus tuning block                 */
+#define SDEX_TUNING_TRIALS          4U            /*!< Number of tuning blocks read per sampling phase    */
+#define SDEX_TUNING_DATATIMEOUT     0x00010000U   /*!< Tuning block data timeout in card clock cycles     */
+/**
+  * @}
+  */
+#endif /* DLYB_SDMMC1 || DLYB_SDMMC2 */
+
 /* Private macro -------------------------------------------------------------*/
+#if defined (DLYB_SDMMC1) && defined (DLYB_SDMMC2)
+#define SDEX_GET_DLYB_INSTANCE(SDMMC_INSTANCE) (((SDMMC_INSTANCE) == SDMMC1)?  \
+                                                DLYB_SDMMC1 : DLYB_SDMMC2 )
+#elif defined (DLYB_SDMMC1)
+#define SDEX_GET_DLYB_INSTANCE(SDMMC_INSTANCE) ( DLYB_SDMMC1 )
+#endif /* (DLYB_SDMMC1) && defined (DLYB_SDMMC2) */
+
 /* Private variables ---------------------------------------------------------*/
+#if defined (DLYB_SDMMC1) || defined (DLYB_SDMMC2)
+/** @defgroup SDEx_Private_Variables SDEx Private Variables
+  * @{
+  */
+/* Tuning block pattern sent by the card on a 4-bit bus (CMD19) */
+static const uint8_t SDEx_TuningBlock4Bit[SDEX_TUNING_BLOCK_SIZE] =
+{
+  0xFFU, 0x0FU, 0xFFU, 0x00U, 0xFFU, 0xCCU, 0xC3U, 0xCCU, 0xC3U, 0x3CU, 0xCCU, 0xFFU, 0xFEU, 0xFFU, 0xFEU, 0xEFU,
+  0xFFU, 0xDFU, 0xFFU, 0xDDU, 0xFFU, 0xFBU, 0xFFU, 0xFBU, 0xBFU, 0xFFU, 0x7FU, 0xFFU, 0x77U, 0xF7U, 0xBDU, 0xEFU,
+  0xFFU, 0xF0U, 0xFFU, 0xF0U, 0x0FU, 0xFCU, 0xCCU, 0x3CU, 0xCCU, 0x33U, 0xCCU, 0xCFU, 0xFFU, 0xEFU, 0xFFU, 0xEEU,
+  0xFFU, 0xFDU, 0xFFU, 0xFDU, 0xDFU, 0xFFU, 0xBFU, 0xFFU, 0xBBU, 0xFFU, 0xF7U, 0xFFU, 0xF7U, 0x7FU, 0x7BU, 0xDEU
+};
+/**
+  * @}
+  */
+#endif /* DLYB_SDMMC1 || DLYB_SDMMC2 */
+
 /* Private function prototypes -----------------------------------------------*/
+/** @defgroup SDEx_Private_Functions SDEx Private Functions
+  * @{
+  */
+static void SDEx_RequestQueue_Complete(SD_HandleTypeDef *hsd, uint32_t ErrorCode);
+static void SDEx_RequestQueue_Dispatch(SD_HandleTypeDef *hsd);
+#if defined (DLYB_SDMMC1) || defined (DLYB_SDMMC2)
+static uint32_t SDEx_ReadTuningBlock(SD_HandleTypeDef *hsd);
+#endif /* DLYB_SDMMC1 || DLYB_SDMMC2 */
+/**
+  * @}
+  */
+
 /* Private functions ---------------------------------------------------------*/
 /* Exported functions --------------------------------------------------------*/
 /** @addtogroup SDEx_Exported_Functions
@@ -374,10 +431,911 @@ HAL_StatusTypeDef HAL_SDEx_DMALinkedList_WriteBlocks(SD_HandleTypeDef *hsd,
   }
 }
 
+/**
+  * @}
+  */
+
+/** @addtogroup SDEx_Exported_Functions_Group2
+  *  @brief   Write session functions
+  *
+@verbatim
+ ===============================================================================
+                   ##### Write session functions #####
+ ===============================================================================
+    [..]
+    This subsection provides a set of functions allowing to write a sequential area of the card
+    in several transfers, each transfer being a single pre-erased multiple block write of one or
+    several chained linked list buffers:
+      (+) Open a write session on an area with HAL_SDEx_WriteSession_Start().
+      (+) Write the next blocks of the area with HAL_SDEx_WriteSession_WriteBlocks(). The blocks are
+          pre-erased (ACMD23) and their count is predefined (CMD23), so that the card ends the
+          transfer by itself without stop transmission command (CMD12).
+      (+) HAL_SDEx_Write_DMALnkLstBufCpltCallback() is called at the end of each linked list buffer
+          and HAL_SD_TxCpltCallback() at the end of each transfer.
+      (+) The card must support the CMD23 command (SD memory cards version 3.0 and later).
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Open a sequential write session on an area of the card.
+  * @param  hsd: SD handle
+  * @param  pSession: Pointer to the write session
+  * @param  BlockAdd: First block address of the area
+  * @param  NumberOfBlocks: Number of blocks of the area
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SDEx_WriteSession_Start(const SD_HandleTypeDef *hsd, SD_WriteSessionTypeDef *pSession,
+                                              uint32_t BlockAdd, uint32_t NumberOfBlocks)
+{
+  if ((pSession == NULL) || (NumberOfBlocks == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  if ((BlockAdd + NumberOfBlocks) > (hsd->SdCard.LogBlockNbr))
+  {
+    return HAL_ERROR;
+  }
+
+  pSession->NextBlockAdd    = BlockAdd;
+  pSession->RemainingBlocks = NumberOfBlocks;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Write the next blocks of a write session. The transferred data are stored in the linked list nodes
+  *         buffers, the linked list should be prepared before calling this function.
+  * @note   The blocks are pre-erased with ACMD23 and the transfer length is predefined with CMD23: no stop
+  *         transmission command is sent at the end of the transfer.
+  * @param  hsd: SD handle
+  * @param  pSession: Pointer to the write session
+  * @param  pLinkedList: Pointer to the linked list of the buffers to write
+  * @param  NumberOfBlocks: Number of blocks to write, total size of the linked list buffers
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SDEx_WriteSession_WriteBlocks(SD_HandleTypeDef *hsd, SD_WriteSessionTypeDef *pSession,
+                                                    const SD_DMALinkedListTypeDef *pLinkedList,
+                                                    uint32_t NumberOfBlocks)
+{
+  SDMMC_DataInitTypeDef config;
+  uint32_t errorstate;
+  uint32_t DmaBase0_reg;
+  uint32_t DmaBase1_reg;
+  uint32_t add;
+
+  if ((pSession == NULL) || (pLinkedList == NULL) || (pLinkedList->pHeadNode == NULL) || (NumberOfBlocks == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hsd->State == HAL_SD_STATE_READY)
+  {
+    if (NumberOfBlocks > pSession->RemainingBlocks)
+    {
+      hsd->ErrorCode |= HAL_SD_ERROR_ADDR_OUT_OF_RANGE;
+      return HAL_ERROR;
+    }
+
+    add = pSession->NextBlockAdd;
+
+    hsd->Instance->IDMABASER = (uint32_t) pLinkedList->pHeadNode->IDMABASER;
+    hsd->Instance->IDMABSIZE = (uint32_t) pLinkedList->pHeadNode->IDMABSIZE;
+
+    hsd->Instance->IDMABAR = (uint32_t)  pLinkedList->pHeadNode;
+    hsd->Instance->IDMALAR = (uint32_t)  SDMMC_IDMALAR_ABR | SDMMC_IDMALAR_ULS | SDMMC_IDMALAR_ULA |
+                             sizeof(SDMMC_DMALinkNodeTypeDef) ; /* Initial configuration */
+
+    DmaBase0_reg = hsd->Instance->IDMABASER;
+    DmaBase1_reg = hsd->Instance->IDMABAR;
+
+    if ((hsd->Instance->IDMABSIZE == 0U) || (DmaBase0_reg == 0U) || (DmaBase1_reg == 0U))
+    {
+      hsd->ErrorCode = HAL_SD_ERROR_ADDR_OUT_OF_RANGE;
+      return HAL_ERROR;
+    }
+
+    /* Initialize data control register */
+    hsd->Instance->DCTRL = 0;
+
+    hsd->ErrorCode = HAL_SD_ERROR_NONE;
+
+    hsd->State = HAL_SD_STATE_BUSY;
+
+    /* Pre-erase the blocks to write: application command followed by ACMD23 */
+    errorstate = SDMMC_CmdAppCommand(hsd->Instance, (uint32_t)(hsd->SdCard.RelCardAdd << 16U));
+    if (errorstate == HAL_SD_ERROR_NONE)
+    {
+      errorstate = SDMMC_CmdSetWrBlkEraseCount(hsd->Instance, NumberOfBlocks);
+    }
+
+    /* Predefine the number of blocks of the multiple block write with CMD23 */
+    if (errorstate == HAL_SD_ERROR_NONE)
+    {
+      errorstate = SDMMC_CmdBlockCount(hsd->Instance, NumberOfBlocks);
+    }
+
+    if (errorstate != HAL_SD_ERROR_NONE)
+    {
+      hsd->State = HAL_SD_STATE_READY;
+      hsd->ErrorCode |= errorstate;
+      return HAL_ERROR;
+    }
+
+    if (hsd->SdCard.CardType != CARD_SDHC_SDXC)
+    {
+      add *= 512U;
+    }
+
+    /* Configure the SD DPSM (Data Path State Machine) */
+    config.DataTimeOut   = SDMMC_DATATIMEOUT;
+    config.DataLength    = BLOCKSIZE * NumberOfBlocks;
+    config.DataBlockSize = SDMMC_DATABLOCK_SIZE_512B;
+    config.TransferDir   = SDMMC_TRANSFER_DIR_TO_CARD;
+    config.TransferMode  = SDMMC_TRANSFER_MODE_BLOCK;
+    config.DPSM          = SDMMC_DPSM_DISABLE;
+    (void)SDMMC_ConfigData(hsd->Instance, &config);
+
+    __SDMMC_CMDTRANS_ENABLE(hsd->Instance);
+
+    hsd->Instance->IDMACTRL = SDMMC_ENABLE_IDMA_DOUBLE_BUFF0;
+
+    /* Write Blocks in DMA mode, the card ends the transfer by itself */
+    hsd->Context = (SD_CONTEXT_WRITE_MULTIPLE_BLOCK | SD_CONTEXT_DMA | SD_CONTEXT_BLOCK_COUNT);
+
+    /* Write Multi Block command */
+    errorstate = SDMMC_CmdWriteMultiBlock(hsd->Instance, add);
+    if (errorstate != HAL_SD_ERROR_NONE)
+    {
+      hsd->State = HAL_SD_STATE_READY;
+      hsd->ErrorCode |= errorstate;
+      return HAL_ERROR;
+    }
+
+    /* Move the session to the next blocks */
+    pSession->NextBlockAdd    += NumberOfBlocks;
+    pSession->RemainingBlocks -= NumberOfBlocks;
+
+    __HAL_SD_ENABLE_IT(hsd, (SDMMC_IT_DCRCFAIL | SDMMC_IT_DTIMEOUT | SDMMC_IT_TXUNDERR | SDMMC_IT_DATAEND |
+                             SDMMC_IT_IDMABTC));
+
+    return HAL_OK;
+  }
+  else
+  {
+    return HAL_BUSY;
+  }
+}
+
+/**
+  * @}
+  */
+
+/** @addtogroup SDEx_Exported_Functions_Group3
+  *  @brief   Scatter-gather functions
+  *
+@verbatim
+ ===============================================================================
+                   ##### Scatter-gather functions #####
+ ===============================================================================
+    [..]
+    This subsection provides a set of functions allowing to read or write blocks directly
+    from or to a set of fragmented buffers described by a SD_DMAIOVecTypeDef vector, without
+    intermediate copy into a contiguous buffer:
+      (+) One IDMA linked list node is built per vector entry in a user provided array of
+          nodes, which must stay untouched until the end of the transfer.
+      (+) Each buffer must be word aligned and its size a multiple of 32 bytes, the total
+          size of the vector being a multiple of the block size.
+      (+) HAL_SDEx_Read_DMALnkLstBufCpltCallback() / HAL_SDEx_Write_DMALnkLstBufCpltCallback()
+          are called at the end of each buffer and HAL_SD_RxCpltCallback() / HAL_SD_TxCpltCallback()
+          at the end of the transfer.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Reads block(s) from a specified address in a card into a scatter-gather buffer vector.
+  * @param  hsd: SD handle
+  * @param  pLinkedList: Pointer to the linkedlist built over the vector
+  * @param  pNodes: Pointer to an array of at least IOVecCount nodes
+  * @param  pIOVec: Pointer to the buffer vector
+  * @param  IOVecCount: Number of entries of the buffer vector
+  * @param  BlockAdd: Block Address from where data is to be read
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SDEx_ReadBlocksIOVec_DMA(SD_HandleTypeDef *hsd, SD_DMALinkedListTypeDef *pLinkedList,
+                                               SD_DMALinkNodeTypeDef *pNodes, const SD_DMAIOVecTypeDef *pIOVec,
+                                               uint32_t IOVecCount, uint32_t BlockAdd)
+{
+  uint32_t length;
+  uint32_t errorstate;
+
+  if (hsd->State != HAL_SD_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  errorstate = SDMMC_DMALinkedList_BuildIOVec(pLinkedList, pNodes, pIOVec, IOVecCount, &length);
+  if ((errorstate != SDMMC_ERROR_NONE) || ((length % BLOCKSIZE) != 0U))
+  {
+    hsd->ErrorCode |= HAL_SD_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  return HAL_SDEx_DMALinkedList_ReadBlocks(hsd, pLinkedList, BlockAdd, length / BLOCKSIZE);
+}
+
+/**
+  * @brief  Write block(s) to a specified address in a card from a scatter-gather buffer vector.
+  * @param  hsd: SD handle
+  * @param  pLinkedList: Pointer to the linkedlist built over the vector
+  * @param  pNodes: Pointer to an array of at least IOVecCount nodes
+  * @param  pIOVec: Pointer to the buffer vector
+  * @param  IOVecCount: Number of entries of the buffer vector
+  * @param  BlockAdd: Block Address where data will be written
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SDEx_WriteBlocksIOVec_DMA(SD_HandleTypeDef *hsd, SD_DMALinkedListTypeDef *pLinkedList,
+                                                SD_DMALinkNodeTypeDef *pNodes, const SD_DMAIOVecTypeDef *pIOVec,
+                                                uint32_t IOVecCount, uint32_t BlockAdd)
+{
+  uint32_t length;
+  uint32_t errorstate;
+
+  if (hsd->State != HAL_SD_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  errorstate = SDMMC_DMALinkedList_BuildIOVec(pLinkedList, pNodes, pIOVec, IOVecCount, &length);
+  if ((errorstate != SDMMC_ERROR_NONE) || ((length % BLOCKSIZE) != 0U))
+  {
+    hsd->ErrorCode |= HAL_SD_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  return HAL_SDEx_DMALinkedList_WriteBlocks(hsd, pLinkedList, BlockAdd, length / BLOCKSIZE);
+}
+
+/**
+  * @}
+  */
+
+/** @addtogroup SDEx_Exported_Functions_Group4
+  *  @brief   Request queue functions
+  *
+@verbatim
+ ===============================================================================
+                   ##### Request queue functions #####
+ ===============================================================================
+    [..]
+    This subsection provides a set of functions allowing to submit several read, write and
+    erase requests without waiting for the end of the previous one:
+      (+) Attach a user provided SD_RequestQueueTypeDef to the handle with
+          HAL_SDEx_RequestQueue_Init(). While a queue is attached, the card must only be
+          accessed through HAL_SDEx_RequestQueue_Submit().
+      (+) Fill a user provided SD_RequestTypeDef and submit it with
+          HAL_SDEx_RequestQueue_Submit(). The request must stay untouched until it is completed.
+      (+) Requests are processed in submission order from HAL_SD_IRQHandler(): the next request
+          is issued as soon as the previous transfer ends or, for write and erase requests, as
+          soon as the busy signal following the command response ends (card leaves the
+          programming state).
+      (+) At completion, the request Status and ErrorCode fields are updated and its
+          pCompleteCallback is called from interrupt context. HAL_SD_TxCpltCallback(),
+          HAL_SD_RxCpltCallback() and HAL_SD_ErrorCallback() are not called for queued requests.
+      (+) Detach the queue with HAL_SDEx_RequestQueue_DeInit() once all requests are completed.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Attach a request queue to the SD handle.
+  * @param  hsd: SD handle
+  * @param  pQueue: Pointer to the request queue
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SDEx_RequestQueue_Init(SD_HandleTypeDef *hsd, SD_RequestQueueTypeDef *pQueue)
+{
+  if (pQueue == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  if ((hsd->State != HAL_SD_STATE_READY) || (hsd->pRequestQueue != NULL))
+  {
+    return HAL_BUSY;
+  }
+
+  pQueue->pHead   = NULL;
+  pQueue->pTail   = NULL;
+  pQueue->Running = 0U;
+
+  hsd->pRequestQueue = pQueue;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Detach the request queue from the SD handle.
+  * @param  hsd: SD handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SDEx_RequestQueue_DeInit(SD_HandleTypeDef *hsd)
+{
+  if (hsd->pRequestQueue == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  if ((hsd->pRequestQueue->Running != 0U) || (hsd->pRequestQueue->pHead != NULL))
+  {
+    return HAL_BUSY;
+  }
+
+  hsd->pRequestQueue = NULL;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Submit a request to the SD request queue.
+  * @note   The request is issued immediately when the queue is idle, otherwise it is issued
+  *         from the SD interrupt at the end of the previous requests.
+  * @param  hsd: SD handle
+  * @param  pRequest: Pointer to the request
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SDEx_RequestQueue_Submit(SD_HandleTypeDef *hsd, SD_RequestTypeDef *pRequest)
+{
+  SD_RequestQueueTypeDef *queue = hsd->pRequestQueue;
+  uint32_t primask_bit;
+  uint32_t dispatch = 0U;
+
+  if ((queue == NULL) || (pRequest == NULL) || (pRequest->NumberOfBlocks == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  if ((pRequest->Operation != SD_REQUEST_READ) && (pRequest->Operation != SD_REQUEST_WRITE) &&
+      (pRequest->Operation != SD_REQUEST_ERASE))
+  {
+    return HAL_ERROR;
+  }
+
+  if ((pRequest->Operation != SD_REQUEST_ERASE) && (pRequest->pData == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  pRequest->Status    = SD_REQUEST_STATUS_PENDING;
+  pRequest->ErrorCode = HAL_SD_ERROR_NONE;
+  pRequest->pNext     = NULL;
+
+  /* Enter critical section: the queue is also processed from the SD interrupt */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  if (queue->pTail == NULL)
+  {
+    queue->pHead = pRequest;
+  }
+  else
+  {
+    queue->pTail->pNext = pRequest;
+  }
+  queue->pTail = pRequest;
+
+  if (queue->Running == 0U)
+  {
+    queue->Running = 1U;
+    dispatch = 1U;
+  }
+
+  /* Exit critical section */
+  __set_PRIMASK(primask_bit);
+
+  if (dispatch != 0U)
+  {
+    SDEx_RequestQueue_Dispatch(hsd);
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Process the end of the current queued request.
+  * @note   This function is called by HAL_SD_IRQHandler() at the end of a transfer or of the
+  *         card programming when a request queue is attached. It should not be called by the
+  *         user application.
+  * @param  hsd: SD handle
+  * @retval None
+  */
+void HAL_SDEx_RequestQueue_IRQHandler(SD_HandleTypeDef *hsd)
+{
+  const SD_RequestQueueTypeDef *queue = hsd->pRequestQueue;
+  uint32_t errorcode = hsd->ErrorCode;
+
+  if ((queue == NULL) || (queue->Running == 0U) || (queue->pHead == NULL))
+  {
+    return;
+  }
+
+  if (hsd->State == HAL_SD_STATE_PROGRAMMING)
+  {
+    /* End of the card programming */
+    __HAL_SD_DISABLE_IT(hsd, SDMMC_IT_BUSYD0END);
+    __HAL_SD_CLEAR_FLAG(hsd, SDMMC_FLAG_BUSYD0END);
+    hsd->State = HAL_SD_STATE_READY;
+  }
+  else if ((errorcode == HAL_SD_ERROR_NONE) && (queue->pHead->Operation != SD_REQUEST_READ) &&
+           (__HAL_SD_GET_FLAG(hsd, SDMMC_FLAG_BUSYD0) != RESET))
+  {
+    /* Card still programming: issue the next request at the end of the busy signal */
+    hsd->State = HAL_SD_STATE_PROGRAMMING;
+    __HAL_SD_ENABLE_IT(hsd, SDMMC_IT_BUSYD0END);
+    return;
+  }
+  else
+  {
+    __HAL_SD_CLEAR_FLAG(hsd, SDMMC_FLAG_BUSYD0END);
+  }
+
+  SDEx_RequestQueue_Complete(hsd, errorcode);
+  SDEx_RequestQueue_Dispatch(hsd);
+}
+
+/**
+  * @}
+  */
+
+#if defined (DLYB_SDMMC1) || defined (DLYB_SDMMC2)
+/** @addtogroup SDEx_Exported_Functions_Group5
+  *  @brief   Sampling point tuning functions
+  *
+@verbatim
+ ===============================================================================
+                ##### Sampling point tuning functions #####
+ ===============================================================================
+    [..]
+    This subsection provides a set of functions allowing to select the sampling point of the
+    receive clock in the SDR104 and SDR50 modes, where the tuned feedback clock is delayed by
+    the delay block (DLYB):
+      (+) HAL_SDEx_ExecuteTuning() sweeps the delay block output clock phases over one clock
+          period, reads tuning blocks (CMD19) for each phase and selects the middle of the wider
+          window of phases receiving the tuning pattern without error. It must be called once the
+          card is switched to SDR104 or SDR50 mode and the SDMMC clock set to its final frequency.
+      (+) The result is returned in a SD_TuningTypeDef structure that the application can keep,
+          to restore it with HAL_SDEx_ApplyTuning() without tuning again (e.g after a low power
+          mode) as long as the clock frequency and the temperature do not change significantly.
+      (+) HAL_SDEx_ConfigSpeedBusOperationTuned() switches the card to the requested UHS-I mode,
+          sets the SDMMC clock divider, executes the tuning and, when no sampling phase is valid,
+          falls back to the high speed mode with its own clock divider.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Execute the sampling point tuning of the SDR104 and SDR50 modes.
+  * @param  hsd: SD handle
+  * @param  pTuning: Pointer to the tuning result (Units, PhaseSel and PhaseMask fields)
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SDEx_ExecuteTuning(SD_HandleTypeDef *hsd, SD_TuningTypeDef *pTuning)
+{
+  DLYB_TypeDef *dlyb;
+  LL_DLYB_CfgTypeDef dlyb_cfg;
+  uint32_t phase_count;
+  uint32_t phase;
+  uint32_t trial;
+  uint32_t mask = 0U;
+  uint32_t start = 0U;
+  uint32_t length = 0U;
+  uint32_t best_start = 0U;
+  uint32_t best_length = 0U;
+
+  if (pTuning == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  if (hsd->State != HAL_SD_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  hsd->ErrorCode = HAL_SD_ERROR_NONE;
+  hsd->State = HAL_SD_STATE_BUSY;
+
+  /* Measure the number of unit delays of one phase on the tuned feedback clock */
+  dlyb = SDEX_GET_DLYB_INSTANCE(hsd->Instance);
+  LL_DLYB_Enable(dlyb);
+  if (LL_DLYB_GetClockPeriod(dlyb, &dlyb_cfg) != (uint32_t)SUCCESS)
+  {
+    hsd->ErrorCode |= HAL_SD_ERROR_GENERAL_UNKNOWN_ERR;
+    hsd->State = HAL_SD_STATE_READY;
+    return HAL_ERROR;
+  }
+  phase_count = dlyb_cfg.PhaseSel + 1U;
+
+  /* Sweep the output clock phases over one clock period */
+  for (phase = 0U; phase < phase_count; phase++)
+  {
+    dlyb_cfg.PhaseSel = phase;
+    LL_DLYB_SetDelay(dlyb, &dlyb_cfg);
+
+    trial = 0U;
+    while ((trial < SDEX_TUNING_TRIALS) && (SDEx_ReadTuningBlock(hsd) == HAL_SD_ERROR_NONE))
+    {
+      trial++;
+    }
+
+    if (trial == SDEX_TUNING_TRIALS)
+    {
+      mask |= (1UL << phase);
+    }
+  }
+
+  /* Look for the wider window of passing phases */
+  for (phase = 0U; phase < phase_count; phase++)
+  {
+    if ((mask & (1UL << phase)) != 0U)
+    {
+      if (length == 0U)
+      {
+        start = phase;
+      }
+      length++;
+      if (length > best_length)
+      {
+        best_start  = start;
+        best_length = length;
+      }
+    }
+    else
+    {
+      length = 0U;
+    }
+  }
+
+  pTuning->PhaseMask = mask;
+
+  if (best_length == 0U)
+  {
+    hsd->ErrorCode |= HAL_SD_ERROR_DATA_CRC_FAIL;
+    hsd->State = HAL_SD_STATE_READY;
+    return HAL_ERROR;
+  }
+
+  /* Sample in the middle of the window */
+  pTuning->Units    = dlyb_cfg.Units;
+  pTuning->PhaseSel = best_start + (best_length / 2U);
+
+  dlyb_cfg.PhaseSel = pTuning->PhaseSel;
+  LL_DLYB_SetDelay(dlyb, &dlyb_cfg);
+
+  hsd->State = HAL_SD_STATE_READY;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Restore a previous sampling point tuning result in the delay block.
+  * @param  hsd: SD handle
+  * @param  pTuning: Pointer to the tuning result returned by HAL_SDEx_ExecuteTuning()
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SDEx_ApplyTuning(SD_HandleTypeDef *hsd, const SD_TuningTypeDef *pTuning)
+{
+  DLYB_TypeDef *dlyb;
+  LL_DLYB_CfgTypeDef dlyb_cfg;
+
+  if ((pTuning == NULL) || (pTuning->Units >= DLYB_MAX_UNIT) || (pTuning->PhaseSel > DLYB_MAX_SELECT))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hsd->State != HAL_SD_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  dlyb_cfg.Units    = pTuning->Units;
+  dlyb_cfg.PhaseSel = pTuning->PhaseSel;
+
+  dlyb = SDEX_GET_DLYB_INSTANCE(hsd->Instance);
+  LL_DLYB_Enable(dlyb);
+  LL_DLYB_SetDelay(dlyb, &dlyb_cfg);
+
+  return HAL_OK;
+}
+
+#if (USE_SD_TRANSCEIVER != 0U)
+/**
+  * @brief  Switch the card to an UHS-I tuned speed mode and execute the sampling point tuning,
+  *         falling back to the high speed mode when the tuning fails.
+  * @param  hsd: SD handle
+  * @param  SpeedMode: Requested speed mode
+  *          This parameter can be one of the following values:
+  *            @arg SDMMC_SPEED_MODE_ULTRA_SDR104: UHS-I SDR104 mode
+  *            @arg SDMMC_SPEED_MODE_ULTRA_SDR50: UHS-I SDR50 mode
+  * @param  pTuning: Pointer to the tuning structure (ClockDiv and FallbackClockDiv fields as input,
+  *         SpeedMode and tuning result fields as output)
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SDEx_ConfigSpeedBusOperationTuned(SD_HandleTypeDef *hsd, uint32_t SpeedMode,
+                                                        SD_TuningTypeDef *pTuning)
+{
+  HAL_StatusTypeDef status;
+
+  if ((pTuning == NULL) || ((SpeedMode != SDMMC_SPEED_MODE_ULTRA_SDR104) && (SpeedMode != SDMMC_SPEED_MODE_ULTRA_SDR50)))
+  {
+    return HAL_ERROR;
+  }
+
+  assert_param(IS_SDMMC_CLKDIV(pTuning->ClockDiv));
+  assert_param(IS_SDMMC_CLKDIV(pTuning->FallbackClockDiv));
+
+  status = HAL_SD_ConfigSpeedBusOperation(hsd, SpeedMode);
+  if (status != HAL_OK)
+  {
+    return status;
+  }
+
+  /* Tune the sampling point at the final clock frequency */
+  MODIFY_REG(hsd->Instance->CLKCR, SDMMC_CLKCR_CLKDIV, pTuning->ClockDiv);
+  if (((hsd->Instance->CLKCR & SDMMC_CLKCR_SELCLKRX) == SDMMC_CLKCR_SELCLKRX_1) &&
+      (HAL_SDEx_ExecuteTuning(hsd, pTuning) == HAL_OK))
+  {
+    pTuning->SpeedMode = SpeedMode;
+    return HAL_OK;
+  }
+
+  /* No valid sampling point: fall back to the high speed mode on the internal receive clock */
+  LL_DLYB_Disable(SDEX_GET_DLYB_INSTANCE(hsd->Instance));
+  MODIFY_REG(hsd->Instance->CLKCR, (SDMMC_CLKCR_SELCLKRX | SDMMC_CLKCR_BUSSPEED | SDMMC_CLKCR_CLKDIV),
+             pTuning->FallbackClockDiv);
+  hsd->ErrorCode = HAL_SD_ERROR_NONE;
+
+  status = HAL_SD_ConfigSpeedBusOperation(hsd, SDMMC_SPEED_MODE_HIGH);
+  if (status == HAL_OK)
+  {
+    pTuning->SpeedMode = SDMMC_SPEED_MODE_HIGH;
+  }
+
+  return status;
+}
+#endif /* USE_SD_TRANSCEIVER */
 
 /**
   * @}
   */
+#endif /* DLYB_SDMMC1 || DLYB_SDMMC2 */
+
+/**
+  * @}
+  */
+
+/* Private functions ---------------------------------------------------------*/
+/** @addtogroup SDEx_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Remove the head request from the queue and notify its completion.
+  * @param  hsd: SD handle
+  * @param  ErrorCode: SD error code of the request
+  * @retval None
+  */
+static void SDEx_RequestQueue_Complete(SD_HandleTypeDef *hsd, uint32_t ErrorCode)
+{
+  SD_RequestQueueTypeDef *queue = hsd->pRequestQueue;
+  SD_RequestTypeDef *request;
+  uint32_t primask_bit;
+
+  /* Enter critical section */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  request = queue->pHead;
+  queue->pHead = request->pNext;
+  if (queue->pHead == NULL)
+  {
+    queue->pTail = NULL;
+  }
+
+  /* Exit critical section */
+  __set_PRIMASK(primask_bit);
+
+  request->pNext     = NULL;
+  request->ErrorCode = ErrorCode;
+  request->Status    = (ErrorCode == HAL_SD_ERROR_NONE) ? SD_REQUEST_STATUS_DONE : SD_REQUEST_STATUS_ERROR;
+
+  if (request->pCompleteCallback != NULL)
+  {
+    request->pCompleteCallback(hsd, request);
+  }
+}
+
+/**
+  * @brief  Issue the queued requests until one of them is pending on the SD interrupt.
+  * @param  hsd: SD handle
+  * @retval None
+  */
+static void SDEx_RequestQueue_Dispatch(SD_HandleTypeDef *hsd)
+{
+  SD_RequestQueueTypeDef *queue = hsd->pRequestQueue;
+  SD_RequestTypeDef *request;
+  HAL_StatusTypeDef status;
+  uint32_t errorcode;
+  uint32_t primask_bit;
+
+  for (;;)
+  {
+    /* Enter critical section: release the queue when it is empty */
+    primask_bit = __get_PRIMASK();
+    __disable_irq();
+
+    request = queue->pHead;
+    if (request == NULL)
+    {
+      queue->Running = 0U;
+    }
+
+    /* Exit critical section */
+    __set_PRIMASK(primask_bit);
+
+    if (request == NULL)
+    {
+      return;
+    }
+
+    request->Status = SD_REQUEST_STATUS_ACTIVE;
+
+    if (request->Operation == SD_REQUEST_READ)
+    {
+      status = HAL_SD_ReadBlocks_DMA(hsd, request->pData, request->BlockAdd, request->NumberOfBlocks);
+    }
+    else if (request->Operation == SD_REQUEST_WRITE)
+    {
+      status = HAL_SD_WriteBlocks_DMA(hsd, request->pData, request->BlockAdd, request->NumberOfBlocks);
+    }
+    else
+    {
+      status = HAL_SD_Erase(hsd, request->BlockAdd, request->BlockAdd + request->NumberOfBlocks - 1U);
+      if ((status == HAL_OK) && (__HAL_SD_GET_FLAG(hsd, SDMMC_FLAG_BUSYD0) != RESET))
+      {
+        /* Issue the next request at the end of the erase busy signal */
+        hsd->State = HAL_SD_STATE_PROGRAMMING;
+        __HAL_SD_ENABLE_IT(hsd, SDMMC_IT_BUSYD0END);
+        return;
+      }
+      __HAL_SD_CLEAR_FLAG(hsd, SDMMC_FLAG_BUSYD0END);
+    }
+
+    if (status == HAL_OK)
+    {
+      if (request->Operation != SD_REQUEST_ERASE)
+      {
+        /* Transfer on going, completed from the SD interrupt */
+        return;
+      }
+      errorcode = HAL_SD_ERROR_NONE;
+    }
+    else
+    {
+      errorcode = (hsd->ErrorCode != HAL_SD_ERROR_NONE) ? hsd->ErrorCode : HAL_SD_ERROR_BUSY;
+    }
+
+    /* Request completed at issue time, process the next one */
+    SDEx_RequestQueue_Complete(hsd, errorcode);
+  }
+}
+
+#if defined (DLYB_SDMMC1) || defined (DLYB_SDMMC2)
+/**
+  * @brief  Read a tuning block (CMD19) and check its pattern.
+  * @param  hsd: SD handle
+  * @retval SD Card error state
+  */
+static uint32_t SDEx_ReadTuningBlock(SD_HandleTypeDef *hsd)
+{
+  SDMMC_DataInitTypeDef config;
+  uint32_t tuning_block[SDEX_TUNING_BLOCK_SIZE / 4U] = {0};
+  uint32_t errorstate;
+  uint32_t count;
+  uint32_t index = 0U;
+  uint32_t tickstart = HAL_GetTick();
+
+  /* Initialize the Data control register */
+  hsd->Instance->DCTRL = 0;
+
+  /* Configure the SD DPSM (Data Path State Machine) */
+  config.DataTimeOut   = SDEX_TUNING_DATATIMEOUT;
+  config.DataLength    = SDEX_TUNING_BLOCK_SIZE;
+  config.DataBlockSize = SDMMC_DATABLOCK_SIZE_64B;
+  config.TransferDir   = SDMMC_TRANSFER_DIR_TO_SDMMC;
+  config.TransferMode  = SDMMC_TRANSFER_MODE_BLOCK;
+  config.DPSM          = SDMMC_DPSM_ENABLE;
+  (void)SDMMC_ConfigData(hsd->Instance, &config);
+
+  errorstate = SDMMC_CmdSendTuningBlock(hsd->Instance);
+  if (errorstate == HAL_SD_ERROR_NONE)
+  {
+    while (!__HAL_SD_GET_FLAG(hsd, SDMMC_FLAG_RXOVERR | SDMMC_FLAG_DCRCFAIL | SDMMC_FLAG_DTIMEOUT | SDMMC_FLAG_DATAEND))
+    {
+      if ((__HAL_SD_GET_FLAG(hsd, SDMMC_FLAG_RXFIFOHF)) && (index < (SDEX_TUNING_BLOCK_SIZE / 4U)))
+      {
+        for (count = 0U; count < 8U; count++)
+        {
+          tuning_block[index] = SDMMC_ReadFIFO(hsd->Instance);
+          index++;
+        }
+      }
+
+      if ((HAL_GetTick() - tickstart) >= SDMMC_CMDTIMEOUT)
+      {
+        errorstate = HAL_SD_ERROR_TIMEOUT;
+        break;
+      }
+    }
+  }
+
+  if (errorstate == HAL_SD_ERROR_NONE)
+  {
+    if (__HAL_SD_GET_FLAG(hsd, SDMMC_FLAG_DTIMEOUT))
+    {
+      errorstate = HAL_SD_ERROR_DATA_TIMEOUT;
+    }
+    else if (__HAL_SD_GET_FLAG(hsd, SDMMC_FLAG_DCRCFAIL))
+    {
+      errorstate = HAL_SD_ERROR_DATA_CRC_FAIL;
+    }
+    else if (__HAL_SD_GET_FLAG(hsd, SDMMC_FLAG_RXOVERR))
+    {
+      errorstate = HAL_SD_ERROR_RX_OVERRUN;
+    }
+    else
+    {
+      /* Get the data remaining in the FIFO */
+      while ((__HAL_SD_GET_FLAG(hsd, SDMMC_FLAG_RXFIFOE) == 0U) && (index < (SDEX_TUNING_BLOCK_SIZE / 4U)))
+      {
+        tuning_block[index] = SDMMC_ReadFIFO(hsd->Instance);
+        index++;
+      }
+
+      /* Check the received tuning pattern */
+      for (count = 0U; count < SDEX_TUNING_BLOCK_SIZE; count++)
+      {
+        if (((uint8_t *)tuning_block)[count] != SDEx_TuningBlock4Bit[count])
+        {
+          errorstate = HAL_SD_ERROR_DATA_CRC_FAIL;
+          break;
+        }
+      }
+    }
+  }
+
+  if (errorstate != HAL_SD_ERROR_NONE)
+  {
+    /* Abort the data path to start the next tuning block from a clean state */
+    __SDMMC_CMDTRANS_DISABLE(hsd->Instance);
+    hsd->Instance->DCTRL |= SDMMC_DCTRL_FIFORST;
+    hsd->Instance->CMD |= SDMMC_CMD_CMDSTOP;
+    (void)SDMMC_CmdStopTransfer(hsd->Instance);
+    hsd->Instance->CMD &= ~(SDMMC_CMD_CMDSTOP);
+  }
+
+  /* Clear all the static flags */
+  __HAL_SD_CLEAR_FLAG(hsd, SDMMC_STATIC_FLAGS);
+
+  return errorstate;
+}
+#endif /* DLYB_SDMMC1 || DLYB_SDMMC2 */
 
 /**
   * @}
@@ -65,6 +65,11 @@
        device. The command to be sent must be configured with the FMC_SDRAM_CommandTypeDef
        structure.
 
+   (#) The SDRAM timings and refresh rate can be computed from the device datasheet
+       parameters filled in a SDRAM_DeviceParamTypeDef structure using the function
+       HAL_SDRAM_ComputeTiming(). Buffers accessed concurrently can be placed in
+       different SDRAM internal banks using the function HAL_SDRAM_AllocRegion().
+
    (#) You can continuously monitor the SDRAM device HAL state by calling the function
        HAL_SDRAM_GetState()
 
@@ -129,6 +134,20 @@
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
+/** @defgroup SDRAM_Private_Constants SDRAM Private Constants
+  * @{
+  */
+#define SDRAM_DEVICE_ADDRESS1       (0xC0000000U)  /* SDRAM Bank1 start address                     */
+#define SDRAM_DEVICE_ADDRESS2       (0xD0000000U)  /* SDRAM Bank2 start address                     */
+#define SDRAM_REGION_ALIGNMENT      (32U)          /* SDRAM region alignment in bytes               */
+#define SDRAM_TIMING_MAX            (16U)          /* Maximum SDRAM timing in SDRAM clock cycles    */
+#define SDRAM_REFRESH_MARGIN        (20U)          /* Refresh rate safety margin in SDRAM clock cycles */
+#define SDRAM_REFRESH_RATE_MIN      (41U)          /* Minimum refresh rate value                    */
+#define SDRAM_REFRESH_RATE_MAX      (8191U)        /* Maximum refresh rate value                    */
+/**
+  * @}
+  */
+
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
@@ -138,6 +157,7 @@
 static void SDRAM_DMACplt(DMA_HandleTypeDef *hdma);
 static void SDRAM_DMACpltProt(DMA_HandleTypeDef *hdma);
 static void SDRAM_DMAError(DMA_HandleTypeDef *hdma);
+static uint32_t SDRAM_NsToCycles(uint32_t Time, uint32_t SDClock);
 /**
   * @}
   */
@@ -201,6 +221,12 @@ HAL_StatusTypeDef HAL_SDRAM_Init(SDRAM_HandleTypeDef *hsdram, FMC_SDRAM_TimingTy
   /* Initialize the SDRAM controller state */
   hsdram->State = HAL_SDRAM_STATE_BUSY;
 
+  /* Release the allocated regions */
+  for (uint32_t bank = 0U; bank < 4U; bank++)
+  {
+    hsdram->RegionOffset[bank] = 0U;
+  }
+
   /* Initialize SDRAM control Interface */
   (void)FMC_SDRAM_Init(hsdram->Instance, &(hsdram->Init));
 
@@ -1308,6 +1334,153 @@ uint32_t HAL_SDRAM_GetModeStatus(SDRAM_HandleTypeDef *hsdram)
   return (FMC_SDRAM_GetModeStatus(hsdram->Instance, hsdram->Init.SDBank));
 }
 
+/**
+  * @brief  Computes the SDRAM timings and refresh rate from the device datasheet parameters.
+  * @note   The SDRAM clock is derived from the current HCLK frequency and the
+  *         SDClockPeriod field of the handle Init structure, so this function
+  *         can be called before HAL_SDRAM_Init(). The timings are rounded up to
+  *         the next SDRAM clock cycle and the write recovery time is extended to
+  *         meet the tRAS and tRC constraints.
+  * @note   The refresh rate must be programmed with HAL_SDRAM_ProgramRefreshRate()
+  *         once the device initialization sequence is done.
+  * @param  hsdram pointer to a SDRAM_HandleTypeDef structure that contains
+  *                the configuration information for SDRAM module.
+  * @param  pParam pointer to the SDRAM device datasheet parameters
+  * @param  pTiming pointer to the SDRAM timing structure to fill
+  * @param  pRefreshRate pointer to the computed refresh rate value
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SDRAM_ComputeTiming(const SDRAM_HandleTypeDef *hsdram, const SDRAM_DeviceParamTypeDef *pParam,
+                                          FMC_SDRAM_TimingTypeDef *pTiming, uint32_t *pRefreshRate)
+{
+  uint32_t sdclk;
+  uint32_t refreshrate;
+  uint32_t rascycles;
+  uint32_t rccycles;
+  uint32_t writerecovery;
+
+  if ((pParam == NULL) || (pTiming == NULL) || (pRefreshRate == NULL) || (pParam->RowNbr == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hsdram->Init.SDClockPeriod == FMC_SDRAM_CLOCK_PERIOD_2)
+  {
+    sdclk = HAL_RCC_GetHCLKFreq() / 2U;
+  }
+  else if (hsdram->Init.SDClockPeriod == FMC_SDRAM_CLOCK_PERIOD_3)
+  {
+    sdclk = HAL_RCC_GetHCLKFreq() / 3U;
+  }
+  else
+  {
+    /* SDRAM clock disabled */
+    return HAL_ERROR;
+  }
+
+  pTiming->LoadToActiveDelay    = (pParam->LoadToActiveDelay != 0U) ? pParam->LoadToActiveDelay : 1U;
+  pTiming->ExitSelfRefreshDelay = SDRAM_NsToCycles(pParam->ExitSelfRefreshDelay, sdclk);
+  pTiming->SelfRefreshTime      = SDRAM_NsToCycles(pParam->SelfRefreshTime, sdclk);
+  pTiming->RowCycleDelay        = SDRAM_NsToCycles(pParam->RowCycleDelay, sdclk);
+  pTiming->RPDelay              = SDRAM_NsToCycles(pParam->RPDelay, sdclk);
+  pTiming->RCDDelay             = SDRAM_NsToCycles(pParam->RCDDelay, sdclk);
+
+  /* The write recovery time must satisfy TWR >= TRAS - TRCD and TWR >= TRC - TRCD - TRP */
+  writerecovery = SDRAM_NsToCycles(pParam->WriteRecoveryTime, sdclk);
+  rascycles = pTiming->SelfRefreshTime;
+  rccycles = pTiming->RowCycleDelay;
+  if ((rascycles > pTiming->RCDDelay) && ((rascycles - pTiming->RCDDelay) > writerecovery))
+  {
+    writerecovery = rascycles - pTiming->RCDDelay;
+  }
+  if ((rccycles > (pTiming->RCDDelay + pTiming->RPDelay))
+      && ((rccycles - pTiming->RCDDelay - pTiming->RPDelay) > writerecovery))
+  {
+    writerecovery = rccycles - pTiming->RCDDelay - pTiming->RPDelay;
+  }
+  pTiming->WriteRecoveryTime = writerecovery;
+
+  if ((pTiming->LoadToActiveDelay > SDRAM_TIMING_MAX) || (pTiming->ExitSelfRefreshDelay > SDRAM_TIMING_MAX)
+      || (pTiming->SelfRefreshTime > SDRAM_TIMING_MAX) || (pTiming->RowCycleDelay > SDRAM_TIMING_MAX)
+      || (pTiming->WriteRecoveryTime > SDRAM_TIMING_MAX) || (pTiming->RPDelay > SDRAM_TIMING_MAX)
+      || (pTiming->RCDDelay > SDRAM_TIMING_MAX))
+  {
+    /* The SDRAM clock is too fast for this device */
+    return HAL_ERROR;
+  }
+
+  /* Refresh rate = (refresh period / number of rows) x SDRAM clock frequency - margin */
+  refreshrate = (uint32_t)(((uint64_t)pParam->RefreshPeriod * sdclk) / ((uint64_t)1000U * pParam->RowNbr));
+  if (refreshrate < (SDRAM_REFRESH_RATE_MIN + SDRAM_REFRESH_MARGIN))
+  {
+    /* The SDRAM clock is too slow to refresh this device */
+    return HAL_ERROR;
+  }
+  refreshrate -= SDRAM_REFRESH_MARGIN;
+  if (refreshrate > SDRAM_REFRESH_RATE_MAX)
+  {
+    refreshrate = SDRAM_REFRESH_RATE_MAX;
+  }
+  *pRefreshRate = refreshrate;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Allocates a memory region in a SDRAM internal bank.
+  * @note   The FMC maps each SDRAM internal bank on a contiguous address range,
+  *         placing buffers accessed concurrently (e.g. frame buffers and DMA2D
+  *         scratch) in different internal banks keeps one row open per bank and
+  *         avoids the precharge/activate penalty of row switches.
+  * @note   The regions are allocated from the start of the internal bank, aligned
+  *         on 32 bytes. All the regions are released by HAL_SDRAM_Init().
+  * @param  hsdram pointer to a SDRAM_HandleTypeDef structure that contains
+  *                the configuration information for SDRAM module.
+  * @param  InternalBank SDRAM internal bank index, from 0 to 1 or 3 depending on
+  *         the InternalBankNumber field of the handle Init structure
+  * @param  Size Region size in bytes
+  * @param  pAddress pointer to the region start address
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SDRAM_AllocRegion(SDRAM_HandleTypeDef *hsdram, uint32_t InternalBank, uint32_t Size,
+                                        uint32_t *pAddress)
+{
+  uint32_t banksize;
+  uint32_t banknbr;
+  uint32_t deviceaddress;
+  uint32_t offset;
+
+  if ((pAddress == NULL) || (Size == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Internal bank size = 2^(column bits + row bits) x data width in bytes */
+  banksize = 1UL << ((8U + hsdram->Init.ColumnBitsNumber) + (11U + (hsdram->Init.RowBitsNumber >> 2U))
+                     + (hsdram->Init.MemoryDataWidth >> 4U));
+  banknbr = (hsdram->Init.InternalBankNumber == FMC_SDRAM_INTERN_BANKS_NUM_4) ? 4U : 2U;
+
+  if (InternalBank >= banknbr)
+  {
+    return HAL_ERROR;
+  }
+
+  offset = hsdram->RegionOffset[InternalBank];
+  if (Size > (banksize - offset))
+  {
+    return HAL_ERROR;
+  }
+
+  deviceaddress = (hsdram->Init.SDBank == FMC_SDRAM_BANK1) ? SDRAM_DEVICE_ADDRESS1 : SDRAM_DEVICE_ADDRESS2;
+  *pAddress = deviceaddress + (InternalBank * banksize) + offset;
+
+  /* Keep the next region aligned */
+  offset += (Size + (SDRAM_REGION_ALIGNMENT - 1U)) & ~(SDRAM_REGION_ALIGNMENT - 1U);
+  hsdram->RegionOffset[InternalBank] = (offset < banksize) ? offset : banksize;
+
+  return HAL_OK;
+}
+
 /**
   * @}
   */
@@ -1418,6 +1591,21 @@ static void SDRAM_DMAError(DMA_HandleTypeDef *hdma)
 #endif /* USE_HAL_SDRAM_REGISTER_CALLBACKS */
 }
 
+/**
+  * @brief  Convert a SDRAM datasheet timing to SDRAM clock cycles.
+  * @param  Time Timing value in ns
+  * @param  SDClock SDRAM clock frequency in Hz
+  * @retval Number of SDRAM clock cycles, rounded up, at least 1
+  */
+static uint32_t SDRAM_NsToCycles(uint32_t Time, uint32_t SDClock)
+{
+  uint32_t cycles;
+
+  cycles = (uint32_t)((((uint64_t)Time * SDClock) + 999999999U) / 1000000000U);
+
+  return (cycles != 0U) ? cycles : 1U;
+}
+
 /**
   * @}
   */
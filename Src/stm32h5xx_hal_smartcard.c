@@ -372,6 +372,10 @@ HAL_StatusTypeDef HAL_SMARTCARD_Init(SMARTCARD_HandleTypeDef *hsmartcard)
   /* Set the SMARTCARD transmission completion indication */
   SMARTCARD_TRANSMISSION_COMPLETION_SETTING(hsmartcard);
 
+  /* No T=1 block exchange attached */
+  hsmartcard->pT1 = NULL;
+  hsmartcard->T1ISR = NULL;
+
   if (hsmartcard->AdvancedInit.AdvFeatureInit != SMARTCARD_ADVFEATURE_NO_INIT)
   {
     SMARTCARD_AdvFeatureConfig(hsmartcard);
@@ -1423,6 +1427,9 @@ HAL_StatusTypeDef HAL_SMARTCARD_Abort(SMARTCARD_HandleTypeDef *hsmartcard)
              USART_CR1_EOBIE));
   CLEAR_BIT(hsmartcard->Instance->CR3, (USART_CR3_EIE | USART_CR3_RXFTIE | USART_CR3_TXFTIE));
 
+  /* Stop any T=1 block exchange */
+  hsmartcard->T1ISR = NULL;
+
 #if defined(HAL_DMA_MODULE_ENABLED)
   /* Disable the SMARTCARD DMA Tx request if enabled */
   if (HAL_IS_BIT_SET(hsmartcard->Instance->CR3, USART_CR3_DMAT))
@@ -1661,6 +1668,9 @@ HAL_StatusTypeDef HAL_SMARTCARD_Abort_IT(SMARTCARD_HandleTypeDef *hsmartcard)
              USART_CR1_EOBIE));
   CLEAR_BIT(hsmartcard->Instance->CR3, (USART_CR3_EIE | USART_CR3_RXFTIE | USART_CR3_TXFTIE));
 
+  /* Stop any T=1 block exchange */
+  hsmartcard->T1ISR = NULL;
+
 #if defined(HAL_DMA_MODULE_ENABLED)
   /* If DMA Tx and/or DMA Rx Handles are associated to SMARTCARD Handle,
      DMA Abort complete callbacks should be initialised before any call
@@ -2779,6 +2789,9 @@ static void SMARTCARD_EndTxTransfer(SMARTCARD_HandleTypeDef *hsmartcard)
 
   /* At end of Tx process, restore hsmartcard->gState to Ready */
   hsmartcard->gState = HAL_SMARTCARD_STATE_READY;
+
+  /* Any T=1 block exchange is ended by the error */
+  hsmartcard->T1ISR = NULL;
 }
 
 
@@ -2796,6 +2809,9 @@ static void SMARTCARD_EndRxTransfer(SMARTCARD_HandleTypeDef *hsmartcard)
 
   /* At end of Rx process, restore hsmartcard->RxState to Ready */
   hsmartcard->RxState = HAL_SMARTCARD_STATE_READY;
+
+  /* Any T=1 block exchange is ended by the error */
+  hsmartcard->T1ISR = NULL;
 }
 
 
@@ -2845,13 +2861,21 @@ static void SMARTCARD_DMAReceiveCplt(DMA_HandleTypeDef *hdma)
   /* At end of Rx process, restore hsmartcard->RxState to Ready */
   hsmartcard->RxState = HAL_SMARTCARD_STATE_READY;
 
+  if (hsmartcard->T1ISR != NULL)
+  {
+    /* Block part received, hand over to the T=1 engine */
+    hsmartcard->T1ISR(hsmartcard);
+  }
+  else
+  {
 #if (USE_HAL_SMARTCARD_REGISTER_CALLBACKS == 1)
-  /* Call registered Rx complete callback */
-  hsmartcard->RxCpltCallback(hsmartcard);
+    /* Call registered Rx complete callback */
+    hsmartcard->RxCpltCallback(hsmartcard);
 #else
-  /* Call legacy weak Rx complete callback */
-  HAL_SMARTCARD_RxCpltCallback(hsmartcard);
+    /* Call legacy weak Rx complete callback */
+    HAL_SMARTCARD_RxCpltCallback(hsmartcard);
 #endif /* USE_HAL_SMARTCARD_REGISTER_CALLBACK */
+  }
 }
 
 /**
@@ -3186,13 +3210,21 @@ static void SMARTCARD_EndTransmit_IT(SMARTCARD_HandleTypeDef *hsmartcard)
   /* Clear TxISR function pointer */
   hsmartcard->TxISR = NULL;
 
+  if (hsmartcard->T1ISR != NULL)
+  {
+    /* Block sent, hand over to the T=1 engine */
+    hsmartcard->T1ISR(hsmartcard);
+  }
+  else
+  {
 #if (USE_HAL_SMARTCARD_REGISTER_CALLBACKS == 1)
-  /* Call registered Tx complete callback */
-  hsmartcard->TxCpltCallback(hsmartcard);
+    /* Call registered Tx complete callback */
+    hsmartcard->TxCpltCallback(hsmartcard);
 #else
-  /* Call legacy weak Tx complete callback */
-  HAL_SMARTCARD_TxCpltCallback(hsmartcard);
+    /* Call legacy weak Tx complete callback */
+    HAL_SMARTCARD_TxCpltCallback(hsmartcard);
 #endif /* USE_HAL_SMARTCARD_REGISTER_CALLBACK */
+  }
 }
 
 /**
@@ -63,6 +63,26 @@
 
 /* UART TX FIFO depth */
 #define TX_FIFO_DEPTH 8U
+
+/* T=1 protocol control byte coding */
+#define SMARTCARDEX_T1_PCB_R_BLOCK      0x80U
+#define SMARTCARDEX_T1_PCB_S_BLOCK      0xC0U
+#define SMARTCARDEX_T1_PCB_MORE         0x20U
+#define SMARTCARDEX_T1_PCB_NS_POS       6U
+#define SMARTCARDEX_T1_PCB_NR_POS       4U
+#define SMARTCARDEX_T1_R_EDC_ERROR      0x01U
+#define SMARTCARDEX_T1_R_OTHER_ERROR    0x02U
+#define SMARTCARDEX_T1_S_IFS_REQUEST    0xC1U
+#define SMARTCARDEX_T1_S_WTX_REQUEST    0xC3U
+#define SMARTCARDEX_T1_S_RESPONSE       0x20U
+
+/* T=1 retransmissions of a block before giving up */
+#define SMARTCARDEX_T1_RETRY_MAX        3U
+
+/* T=1 block exchange steps */
+#define SMARTCARDEX_T1_STEP_TX          0U
+#define SMARTCARDEX_T1_STEP_PROLOGUE    1U
+#define SMARTCARDEX_T1_STEP_BODY        2U
 /**
   * @}
   */
@@ -71,6 +91,18 @@
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
 static void SMARTCARDEx_SetNbDataToProcess(SMARTCARD_HandleTypeDef *hsmartcard);
+#if defined(HAL_DMA_MODULE_ENABLED)
+static uint32_t SMARTCARDEx_T1_ComputeEDC(const SMARTCARD_T1HandleTypeDef *pT1, const uint8_t *pBlock,
+                                          uint32_t Size, uint8_t *pEdc);
+static HAL_StatusTypeDef SMARTCARDEx_T1_SendBlock(SMARTCARD_HandleTypeDef *hsmartcard, SMARTCARD_T1HandleTypeDef *pT1,
+                                                  uint8_t Pcb, const uint8_t *pInf, uint32_t Size);
+static HAL_StatusTypeDef SMARTCARDEx_T1_SendChunk(SMARTCARD_HandleTypeDef *hsmartcard, SMARTCARD_T1HandleTypeDef *pT1);
+static HAL_StatusTypeDef SMARTCARDEx_T1_Retry(SMARTCARD_HandleTypeDef *hsmartcard, SMARTCARD_T1HandleTypeDef *pT1,
+                                              uint8_t Pcb);
+static HAL_StatusTypeDef SMARTCARDEx_T1_ProcessBlock(SMARTCARD_HandleTypeDef *hsmartcard,
+                                                     SMARTCARD_T1HandleTypeDef *pT1, uint32_t *pDone);
+static void SMARTCARDEx_T1_ISR(SMARTCARD_HandleTypeDef *hsmartcard);
+#endif /* HAL_DMA_MODULE_ENABLED */
 
 /* Exported functions --------------------------------------------------------*/
 /** @defgroup SMARTCARDEx_Exported_Functions  SMARTCARD Extended Exported Functions
@@ -197,6 +229,12 @@ HAL_StatusTypeDef HAL_SMARTCARDEx_DisableReceiverTimeOut(SMARTCARD_HandleTypeDef
         (++) HAL_SMARTCARDEx_RxFifoFullCallback()
         (++) HAL_SMARTCARDEx_TxFifoEmptyCallback()
 
+    (#) T=1 block protocol engine, blocks moved by DMA:
+        (++) HAL_SMARTCARDEx_T1_Init() attaches a T=1 context filled from the card ATR
+        (++) HAL_SMARTCARDEx_T1_Transceive_DMA() sends a command and collects its response,
+             handling EDC, chaining, retransmission, WTX and IFS requests from interrupts
+        (++) HAL_SMARTCARDEx_T1_TransceiveCpltCallback() signals the end of the exchange
+
 @endverbatim
   * @{
   */
@@ -233,6 +271,113 @@ __weak void HAL_SMARTCARDEx_TxFifoEmptyCallback(SMARTCARD_HandleTypeDef *hsmartc
    */
 }
 
+#if defined(HAL_DMA_MODULE_ENABLED)
+/**
+  * @brief  Attach a T=1 block protocol context to the SMARTCARD handle.
+  * @param  hsmartcard Pointer to a SMARTCARD_HandleTypeDef structure that contains
+  *                    the configuration information for the specified SMARTCARD module.
+  * @param  pT1 Pointer to the T=1 context, Init field filled from the card ATR.
+  * @note   Send sequence numbers are reset, so this function is called again after each card reset.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SMARTCARDEx_T1_Init(SMARTCARD_HandleTypeDef *hsmartcard, SMARTCARD_T1HandleTypeDef *pT1)
+{
+  if ((pT1 == NULL) || (pT1->Init.IFSC == 0U) || (pT1->Init.IFSC > SMARTCARD_T1_INF_MAX))
+  {
+    return HAL_ERROR;
+  }
+
+  assert_param(IS_SMARTCARD_T1_EDC(pT1->Init.EDC));
+  assert_param(IS_SMARTCARD_TIMEOUT_VALUE(pT1->Init.BWT));
+  assert_param(IS_SMARTCARD_TIMEOUT_VALUE(pT1->Init.CWT));
+
+  if ((hsmartcard->gState != HAL_SMARTCARD_STATE_READY) || (hsmartcard->RxState != HAL_SMARTCARD_STATE_READY))
+  {
+    return HAL_BUSY;
+  }
+
+  pT1->SeqTx = 0U;
+  pT1->SeqRx = 0U;
+  hsmartcard->T1ISR = NULL;
+  hsmartcard->pT1 = pT1;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Exchange a command and its response with the card using the T=1 block protocol.
+  * @param  hsmartcard Pointer to a SMARTCARD_HandleTypeDef structure that contains
+  *                    the configuration information for the specified SMARTCARD module.
+  * @param  pTxData Pointer to the command (APDU).
+  * @param  TxSize Command size, chained over several I-blocks when larger than IFSC.
+  * @param  pRxData Pointer to the response buffer.
+  * @param  RxSize Response buffer size.
+  * @note   Blocks are moved by DMA, both SMARTCARD DMA handles must be linked and use normal mode.
+  *         R-blocks, chaining, WTX and IFS requests are answered from the SMARTCARD interrupts.
+  * @note   The receiver timeout is loaded with BWT before each card response and with CWT once the
+  *         block prologue is received: a card going silent ends the exchange with HAL_SMARTCARD_ERROR_RTO.
+  * @note   HAL_SMARTCARDEx_T1_TransceiveCpltCallback() is called once the whole response is received,
+  *         its length is available in the RxLength field of the T=1 context.
+  *         Protocol failures after retransmissions are reported with HAL_SMARTCARD_ERROR_PROTOCOL.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SMARTCARDEx_T1_Transceive_DMA(SMARTCARD_HandleTypeDef *hsmartcard, const uint8_t *pTxData,
+                                                    uint16_t TxSize, uint8_t *pRxData, uint16_t RxSize)
+{
+  SMARTCARD_T1HandleTypeDef *pt1 = hsmartcard->pT1;
+
+  if ((pt1 == NULL) || (pTxData == NULL) || (TxSize == 0U) || (pRxData == NULL) ||
+      (hsmartcard->hdmatx == NULL) || (hsmartcard->hdmarx == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  if ((hsmartcard->T1ISR != NULL) || (hsmartcard->gState != HAL_SMARTCARD_STATE_READY) ||
+      (hsmartcard->RxState != HAL_SMARTCARD_STATE_READY))
+  {
+    return HAL_BUSY;
+  }
+
+  pt1->pTxData = pTxData;
+  pt1->TxSize = TxSize;
+  pt1->TxOffset = 0U;
+  pt1->pRxData = pRxData;
+  pt1->RxSize = RxSize;
+  pt1->RxLength = 0U;
+  pt1->Retry = 0U;
+  pt1->WaitTime = pt1->Init.BWT;
+
+  /* The receiver timeout implements BWT and CWT */
+  SET_BIT(hsmartcard->Instance->CR2, USART_CR2_RTOEN);
+
+  hsmartcard->T1ISR = SMARTCARDEx_T1_ISR;
+
+  if (SMARTCARDEx_T1_SendChunk(hsmartcard, pt1) != HAL_OK)
+  {
+    hsmartcard->T1ISR = NULL;
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  SMARTCARD T=1 exchange complete callback.
+  * @param  hsmartcard Pointer to a SMARTCARD_HandleTypeDef structure that contains
+  *                    the configuration information for the specified SMARTCARD module.
+  * @retval None
+  */
+__weak void HAL_SMARTCARDEx_T1_TransceiveCpltCallback(SMARTCARD_HandleTypeDef *hsmartcard)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hsmartcard);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_SMARTCARDEx_T1_TransceiveCpltCallback can be implemented in the user file.
+   */
+}
+#endif /* HAL_DMA_MODULE_ENABLED */
+
 /**
   * @}
   */
@@ -479,6 +624,295 @@ static void SMARTCARDEx_SetNbDataToProcess(SMARTCARD_HandleTypeDef *hsmartcard)
   }
 }
 
+#if defined(HAL_DMA_MODULE_ENABLED)
+/**
+  * @brief  Compute the epilogue of a T=1 block.
+  * @param  pT1 Pointer to the T=1 context.
+  * @param  pBlock Pointer to the block, prologue included.
+  * @param  Size Number of bytes covered by the error detection code.
+  * @param  pEdc Pointer to the epilogue to fill.
+  * @retval Epilogue length in bytes
+  */
+static uint32_t SMARTCARDEx_T1_ComputeEDC(const SMARTCARD_T1HandleTypeDef *pT1, const uint8_t *pBlock,
+                                          uint32_t Size, uint8_t *pEdc)
+{
+  uint32_t i;
+  uint32_t bit;
+  uint32_t crc;
+  uint8_t lrc;
+
+  if (pT1->Init.EDC == SMARTCARD_T1_EDC_CRC)
+  {
+    /* ISO 13239 CRC-16, reflected polynomial, sent least significant byte first */
+    crc = 0xFFFFU;
+    for (i = 0U; i < Size; i++)
+    {
+      crc ^= pBlock[i];
+      for (bit = 0U; bit < 8U; bit++)
+      {
+        crc = ((crc & 1U) != 0U) ? ((crc >> 1U) ^ 0x8408U) : (crc >> 1U);
+      }
+    }
+    crc = ~crc;
+    pEdc[0] = (uint8_t)(crc & 0xFFU);
+    pEdc[1] = (uint8_t)((crc >> 8U) & 0xFFU);
+    return 2U;
+  }
+
+  lrc = 0U;
+  for (i = 0U; i < Size; i++)
+  {
+    lrc ^= pBlock[i];
+  }
+  pEdc[0] = lrc;
+  return 1U;
+}
+
+/**
+  * @brief  Build a T=1 block in the context Tx buffer and send it.
+  * @param  hsmartcard Pointer to a SMARTCARD_HandleTypeDef structure that contains
+  *                    the configuration information for the specified SMARTCARD module.
+  * @param  pT1 Pointer to the T=1 context.
+  * @param  Pcb Protocol control byte.
+  * @param  pInf Pointer to the information field.
+  * @param  Size Information field size.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef SMARTCARDEx_T1_SendBlock(SMARTCARD_HandleTypeDef *hsmartcard, SMARTCARD_T1HandleTypeDef *pT1,
+                                                  uint8_t Pcb, const uint8_t *pInf, uint32_t Size)
+{
+  uint32_t i;
+  uint32_t edclen;
+
+  pT1->TxBlock[0] = pT1->Init.NAD;
+  pT1->TxBlock[1] = Pcb;
+  pT1->TxBlock[2] = (uint8_t)Size;
+  for (i = 0U; i < Size; i++)
+  {
+    pT1->TxBlock[3U + i] = pInf[i];
+  }
+  edclen = SMARTCARDEx_T1_ComputeEDC(pT1, pT1->TxBlock, 3U + Size, &pT1->TxBlock[3U + Size]);
+  pT1->TxBlockSize = (uint16_t)(3U + Size + edclen);
+
+  pT1->Step = SMARTCARDEX_T1_STEP_TX;
+  return HAL_SMARTCARD_Transmit_DMA(hsmartcard, pT1->TxBlock, pT1->TxBlockSize);
+}
+
+/**
+  * @brief  Send the next I-block of the command.
+  * @param  hsmartcard Pointer to a SMARTCARD_HandleTypeDef structure that contains
+  *                    the configuration information for the specified SMARTCARD module.
+  * @param  pT1 Pointer to the T=1 context.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef SMARTCARDEx_T1_SendChunk(SMARTCARD_HandleTypeDef *hsmartcard, SMARTCARD_T1HandleTypeDef *pT1)
+{
+  uint32_t chunk = (uint32_t)pT1->TxSize - pT1->TxOffset;
+  uint8_t pcb = (uint8_t)((uint32_t)pT1->SeqTx << SMARTCARDEX_T1_PCB_NS_POS);
+
+  if (chunk > pT1->Init.IFSC)
+  {
+    chunk = pT1->Init.IFSC;
+    pcb = (uint8_t)(pcb | SMARTCARDEX_T1_PCB_MORE);
+  }
+  pT1->TxChunk = (uint16_t)chunk;
+
+  return SMARTCARDEx_T1_SendBlock(hsmartcard, pT1, pcb, &pT1->pTxData[pT1->TxOffset], chunk);
+}
+
+/**
+  * @brief  Retransmit the last block, or give up once the retries are exhausted.
+  * @param  hsmartcard Pointer to a SMARTCARD_HandleTypeDef structure that contains
+  *                    the configuration information for the specified SMARTCARD module.
+  * @param  pT1 Pointer to the T=1 context.
+  * @param  Pcb Protocol control byte of the R-block to send, 0 to repeat the last block.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef SMARTCARDEx_T1_Retry(SMARTCARD_HandleTypeDef *hsmartcard, SMARTCARD_T1HandleTypeDef *pT1,
+                                              uint8_t Pcb)
+{
+  pT1->Retry++;
+  if (pT1->Retry > SMARTCARDEX_T1_RETRY_MAX)
+  {
+    hsmartcard->ErrorCode |= HAL_SMARTCARD_ERROR_PROTOCOL;
+    return HAL_ERROR;
+  }
+
+  if (Pcb != 0U)
+  {
+    return SMARTCARDEx_T1_SendBlock(hsmartcard, pT1, Pcb, NULL, 0U);
+  }
+
+  pT1->Step = SMARTCARDEX_T1_STEP_TX;
+  return HAL_SMARTCARD_Transmit_DMA(hsmartcard, pT1->TxBlock, pT1->TxBlockSize);
+}
+
+/**
+  * @brief  Process a complete T=1 block received from the card.
+  * @param  hsmartcard Pointer to a SMARTCARD_HandleTypeDef structure that contains
+  *                    the configuration information for the specified SMARTCARD module.
+  * @param  pT1 Pointer to the T=1 context.
+  * @param  pDone Set to 1 when the response is complete.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef SMARTCARDEx_T1_ProcessBlock(SMARTCARD_HandleTypeDef *hsmartcard,
+                                                     SMARTCARD_T1HandleTypeDef *pT1, uint32_t *pDone)
+{
+  const uint8_t *pblock = pT1->RxBlock;
+  uint8_t pcb = pblock[1];
+  uint32_t len = pblock[2];
+  uint8_t edc[2];
+  uint8_t rpcb = (uint8_t)(SMARTCARDEX_T1_PCB_R_BLOCK | ((uint32_t)pT1->SeqRx << SMARTCARDEX_T1_PCB_NR_POS));
+  uint32_t edclen;
+  uint32_t i;
+  uint32_t wait;
+
+  edclen = SMARTCARDEx_T1_ComputeEDC(pT1, pblock, 3U + len, edc);
+  if ((pblock[3U + len] != edc[0]) || ((edclen == 2U) && (pblock[4U + len] != edc[1])))
+  {
+    /* EDC error: ask for the block again */
+    return SMARTCARDEx_T1_Retry(hsmartcard, pT1, (uint8_t)(rpcb | SMARTCARDEX_T1_R_EDC_ERROR));
+  }
+
+  if ((pcb & SMARTCARDEX_T1_PCB_R_BLOCK) == 0U)
+  {
+    /* I-block: the card answer also acknowledges the last command block */
+    if (((pcb >> SMARTCARDEX_T1_PCB_NS_POS) & 1U) != pT1->SeqRx)
+    {
+      return SMARTCARDEx_T1_Retry(hsmartcard, pT1, (uint8_t)(rpcb | SMARTCARDEX_T1_R_OTHER_ERROR));
+    }
+    if (pT1->TxChunk != 0U)
+    {
+      pT1->TxOffset += pT1->TxChunk;
+      pT1->TxChunk = 0U;
+      pT1->SeqTx ^= 1U;
+    }
+    if (((uint32_t)pT1->RxLength + len) > pT1->RxSize)
+    {
+      hsmartcard->ErrorCode |= HAL_SMARTCARD_ERROR_PROTOCOL;
+      return HAL_ERROR;
+    }
+    for (i = 0U; i < len; i++)
+    {
+      pT1->pRxData[pT1->RxLength + i] = pblock[3U + i];
+    }
+    pT1->RxLength += (uint16_t)len;
+    pT1->SeqRx ^= 1U;
+    pT1->Retry = 0U;
+
+    if ((pcb & SMARTCARDEX_T1_PCB_MORE) != 0U)
+    {
+      /* Chained response: acknowledge with N(R) set to the next expected block */
+      rpcb = (uint8_t)(SMARTCARDEX_T1_PCB_R_BLOCK | ((uint32_t)pT1->SeqRx << SMARTCARDEX_T1_PCB_NR_POS));
+      return SMARTCARDEx_T1_SendBlock(hsmartcard, pT1, rpcb, NULL, 0U);
+    }
+    *pDone = 1U;
+    return HAL_OK;
+  }
+
+  if ((pcb & SMARTCARDEX_T1_PCB_S_BLOCK) == SMARTCARDEX_T1_PCB_R_BLOCK)
+  {
+    /* R-block: a chained command block is acknowledged when N(R) moves past its N(S) */
+    if ((pT1->TxChunk != 0U) && (((pcb >> SMARTCARDEX_T1_PCB_NR_POS) & 1U) != pT1->SeqTx) &&
+        (((uint32_t)pT1->TxOffset + pT1->TxChunk) < pT1->TxSize))
+    {
+      pT1->TxOffset += pT1->TxChunk;
+      pT1->SeqTx ^= 1U;
+      pT1->Retry = 0U;
+      return SMARTCARDEx_T1_SendChunk(hsmartcard, pT1);
+    }
+    return SMARTCARDEx_T1_Retry(hsmartcard, pT1, 0U);
+  }
+
+  /* S-block requests */
+  if ((pcb == SMARTCARDEX_T1_S_WTX_REQUEST) && (len == 1U))
+  {
+    /* Next response is allowed a multiple of BWT */
+    wait = pT1->Init.BWT * pblock[3];
+    pT1->WaitTime = (wait > 0xFFFFFFU) ? 0xFFFFFFU : wait;
+    return SMARTCARDEx_T1_SendBlock(hsmartcard, pT1, (uint8_t)(pcb | SMARTCARDEX_T1_S_RESPONSE), &pblock[3], 1U);
+  }
+  if ((pcb == SMARTCARDEX_T1_S_IFS_REQUEST) && (len == 1U) && (pblock[3] != 0U) &&
+      (pblock[3] <= SMARTCARD_T1_INF_MAX))
+  {
+    pT1->Init.IFSC = pblock[3];
+    return SMARTCARDEx_T1_SendBlock(hsmartcard, pT1, (uint8_t)(pcb | SMARTCARDEX_T1_S_RESPONSE), &pblock[3], 1U);
+  }
+
+  hsmartcard->ErrorCode |= HAL_SMARTCARD_ERROR_PROTOCOL;
+  return HAL_ERROR;
+}
+
+/**
+  * @brief  T=1 engine, called at the end of each block DMA transfer.
+  * @param  hsmartcard Pointer to a SMARTCARD_HandleTypeDef structure that contains
+  *                    the configuration information for the specified SMARTCARD module.
+  * @retval None
+  */
+static void SMARTCARDEx_T1_ISR(SMARTCARD_HandleTypeDef *hsmartcard)
+{
+  SMARTCARD_T1HandleTypeDef *pt1 = hsmartcard->pT1;
+  HAL_StatusTypeDef status;
+  uint32_t done = 0U;
+  uint32_t len;
+
+  switch (pt1->Step)
+  {
+    case SMARTCARDEX_T1_STEP_TX:
+      /* Block sent: the card must start its answer within the block waiting time */
+      MODIFY_REG(hsmartcard->Instance->RTOR, USART_RTOR_RTO, pt1->WaitTime);
+      pt1->WaitTime = pt1->Init.BWT;
+      SET_BIT(hsmartcard->Instance->CR1, USART_CR1_RTOIE);
+      pt1->Step = SMARTCARDEX_T1_STEP_PROLOGUE;
+      status = HAL_SMARTCARD_Receive_DMA(hsmartcard, pt1->RxBlock, 3U);
+      break;
+
+    case SMARTCARDEX_T1_STEP_PROLOGUE:
+      /* Prologue received: the rest of the block is bound by the character waiting time */
+      len = pt1->RxBlock[2];
+      if (len > SMARTCARD_T1_INF_MAX)
+      {
+        hsmartcard->ErrorCode |= HAL_SMARTCARD_ERROR_PROTOCOL;
+        status = HAL_ERROR;
+      }
+      else
+      {
+        MODIFY_REG(hsmartcard->Instance->RTOR, USART_RTOR_RTO, pt1->Init.CWT);
+        len += (pt1->Init.EDC == SMARTCARD_T1_EDC_CRC) ? 2U : 1U;
+        pt1->Step = SMARTCARDEX_T1_STEP_BODY;
+        status = HAL_SMARTCARD_Receive_DMA(hsmartcard, &pt1->RxBlock[3], (uint16_t)len);
+      }
+      break;
+
+    default:
+      CLEAR_BIT(hsmartcard->Instance->CR1, USART_CR1_RTOIE);
+      status = SMARTCARDEx_T1_ProcessBlock(hsmartcard, pt1, &done);
+      break;
+  }
+
+  if ((status != HAL_OK) || (done != 0U))
+  {
+    hsmartcard->T1ISR = NULL;
+    CLEAR_BIT(hsmartcard->Instance->CR1, USART_CR1_RTOIE);
+
+    if (status != HAL_OK)
+    {
+#if (USE_HAL_SMARTCARD_REGISTER_CALLBACKS == 1)
+      /* Call registered user error callback */
+      hsmartcard->ErrorCallback(hsmartcard);
+#else
+      /* Call legacy weak user error callback */
+      HAL_SMARTCARD_ErrorCallback(hsmartcard);
+#endif /* USE_HAL_SMARTCARD_REGISTER_CALLBACK */
+    }
+    else
+    {
+      HAL_SMARTCARDEx_T1_TransceiveCpltCallback(hsmartcard);
+    }
+  }
+}
+#endif /* HAL_DMA_MODULE_ENABLED */
+
 /**
   * @}
   */
@@ -392,6 +392,7 @@ HAL_StatusTypeDef HAL_SMBUS_Init(SMBUS_HandleTypeDef *hsmbus)
   hsmbus->ErrorCode = HAL_SMBUS_ERROR_NONE;
   hsmbus->PreviousState = HAL_SMBUS_STATE_READY;
   hsmbus->State = HAL_SMBUS_STATE_READY;
+  hsmbus->CmdISR = NULL;
 
   return HAL_OK;
 }
@@ -1862,6 +1863,9 @@ static HAL_StatusTypeDef SMBUS_Master_ISR(SMBUS_HandleTypeDef *hsmbus, uint32_t
     /* Flush TX register */
     SMBUS_Flush_TXDR(hsmbus);
 
+    /* Stop the command list, if any, CmdIndex keeps the failing command */
+    hsmbus->CmdISR = NULL;
+
     /* Process Unlocked */
     __HAL_UNLOCK(hsmbus);
 
@@ -1902,12 +1906,20 @@ static HAL_StatusTypeDef SMBUS_Master_ISR(SMBUS_HandleTypeDef *hsmbus, uint32_t
       /* Re-enable the selected SMBUS peripheral */
       __HAL_SMBUS_ENABLE(hsmbus);
 
-      /* Call the corresponding callback to inform upper layer of End of Transfer */
+      /* Command list ongoing : chain the next transfer */
+      if (hsmbus->CmdISR != NULL)
+      {
+        hsmbus->CmdISR(hsmbus);
+      }
+      else
+      {
+        /* Call the corresponding callback to inform upper layer of End of Transfer */
 #if (USE_HAL_SMBUS_REGISTER_CALLBACKS == 1)
-      hsmbus->MasterTxCpltCallback(hsmbus);
+        hsmbus->MasterTxCpltCallback(hsmbus);
 #else
-      HAL_SMBUS_MasterTxCpltCallback(hsmbus);
+        HAL_SMBUS_MasterTxCpltCallback(hsmbus);
 #endif /* USE_HAL_SMBUS_REGISTER_CALLBACKS */
+      }
     }
     else if (hsmbus->State == HAL_SMBUS_STATE_MASTER_BUSY_RX)
     {
@@ -1942,12 +1954,20 @@ static HAL_StatusTypeDef SMBUS_Master_ISR(SMBUS_HandleTypeDef *hsmbus, uint32_t
       /* Process Unlocked */
       __HAL_UNLOCK(hsmbus);
 
-      /* Call the corresponding callback to inform upper layer of End of Transfer */
+      /* Command list ongoing : chain the next transfer */
+      if (hsmbus->CmdISR != NULL)
+      {
+        hsmbus->CmdISR(hsmbus);
+      }
+      else
+      {
+        /* Call the corresponding callback to inform upper layer of End of Transfer */
 #if (USE_HAL_SMBUS_REGISTER_CALLBACKS == 1)
-      hsmbus->MasterRxCpltCallback(hsmbus);
+        hsmbus->MasterRxCpltCallback(hsmbus);
 #else
-      HAL_SMBUS_MasterRxCpltCallback(hsmbus);
+        HAL_SMBUS_MasterRxCpltCallback(hsmbus);
 #endif /* USE_HAL_SMBUS_REGISTER_CALLBACKS */
+      }
     }
     else
     {
@@ -2021,12 +2041,20 @@ static HAL_StatusTypeDef SMBUS_Master_ISR(SMBUS_HandleTypeDef *hsmbus, uint32_t
           /* Process Unlocked */
           __HAL_UNLOCK(hsmbus);
 
-          /* Call the corresponding callback to inform upper layer of End of Transfer */
+          /* Command list ongoing : chain the next transfer */
+          if (hsmbus->CmdISR != NULL)
+          {
+            hsmbus->CmdISR(hsmbus);
+          }
+          else
+          {
+            /* Call the corresponding callback to inform upper layer of End of Transfer */
 #if (USE_HAL_SMBUS_REGISTER_CALLBACKS == 1)
-          hsmbus->MasterTxCpltCallback(hsmbus);
+            hsmbus->MasterTxCpltCallback(hsmbus);
 #else
-          HAL_SMBUS_MasterTxCpltCallback(hsmbus);
+            HAL_SMBUS_MasterTxCpltCallback(hsmbus);
 #endif /* USE_HAL_SMBUS_REGISTER_CALLBACKS */
+          }
         }
         else if (hsmbus->State == HAL_SMBUS_STATE_MASTER_BUSY_RX)
         {
@@ -2037,12 +2065,20 @@ static HAL_StatusTypeDef SMBUS_Master_ISR(SMBUS_HandleTypeDef *hsmbus, uint32_t
           /* Process Unlocked */
           __HAL_UNLOCK(hsmbus);
 
-          /* Call the corresponding callback to inform upper layer of End of Transfer */
+          /* Command list ongoing : chain the next transfer */
+          if (hsmbus->CmdISR != NULL)
+          {
+            hsmbus->CmdISR(hsmbus);
+          }
+          else
+          {
+            /* Call the corresponding callback to inform upper layer of End of Transfer */
 #if (USE_HAL_SMBUS_REGISTER_CALLBACKS == 1)
-          hsmbus->MasterRxCpltCallback(hsmbus);
+            hsmbus->MasterRxCpltCallback(hsmbus);
 #else
-          HAL_SMBUS_MasterRxCpltCallback(hsmbus);
+            HAL_SMBUS_MasterRxCpltCallback(hsmbus);
 #endif /* USE_HAL_SMBUS_REGISTER_CALLBACKS */
+          }
         }
         else
         {
@@ -2082,12 +2118,20 @@ static HAL_StatusTypeDef SMBUS_Master_ISR(SMBUS_HandleTypeDef *hsmbus, uint32_t
           /* Process Unlocked */
           __HAL_UNLOCK(hsmbus);
 
-          /* Call the corresponding callback to inform upper layer of End of Transfer */
+          /* Command list ongoing : chain the next transfer */
+          if (hsmbus->CmdISR != NULL)
+          {
+            hsmbus->CmdISR(hsmbus);
+          }
+          else
+          {
+            /* Call the corresponding callback to inform upper layer of End of Transfer */
 #if (USE_HAL_SMBUS_REGISTER_CALLBACKS == 1)
-          hsmbus->MasterTxCpltCallback(hsmbus);
+            hsmbus->MasterTxCpltCallback(hsmbus);
 #else
-          HAL_SMBUS_MasterTxCpltCallback(hsmbus);
+            HAL_SMBUS_MasterTxCpltCallback(hsmbus);
 #endif /* USE_HAL_SMBUS_REGISTER_CALLBACKS */
+          }
         }
         else if (hsmbus->State == HAL_SMBUS_STATE_MASTER_BUSY_RX)
         {
@@ -2098,12 +2142,20 @@ static HAL_StatusTypeDef SMBUS_Master_ISR(SMBUS_HandleTypeDef *hsmbus, uint32_t
           /* Process Unlocked */
           __HAL_UNLOCK(hsmbus);
 
-          /* Call the corresponding callback to inform upper layer of End of Transfer */
+          /* Command list ongoing : chain the next transfer */
+          if (hsmbus->CmdISR != NULL)
+          {
+            hsmbus->CmdISR(hsmbus);
+          }
+          else
+          {
+            /* Call the corresponding callback to inform upper layer of End of Transfer */
 #if (USE_HAL_SMBUS_REGISTER_CALLBACKS == 1)
-          hsmbus->MasterRxCpltCallback(hsmbus);
+            hsmbus->MasterRxCpltCallback(hsmbus);
 #else
-          HAL_SMBUS_MasterRxCpltCallback(hsmbus);
+            HAL_SMBUS_MasterRxCpltCallback(hsmbus);
 #endif /* USE_HAL_SMBUS_REGISTER_CALLBACKS */
+          }
         }
         else
         {
@@ -2608,6 +2660,9 @@ static void SMBUS_ITErrorHandler(SMBUS_HandleTypeDef *hsmbus)
       }
     }
 
+    /* Stop the command list, if any, CmdIndex keeps the failing command */
+    hsmbus->CmdISR = NULL;
+
     /* Call the Error callback to inform upper layer */
 #if (USE_HAL_SMBUS_REGISTER_CALLBACKS == 1)
     hsmbus->ErrorCallback(hsmbus);
@@ -8,6 +8,7 @@
   *           + Extended features functions
   *           + WakeUp Mode Functions
   *           + FastModePlus Functions
+  *           + Command List Functions
   *
   ******************************************************************************
   * @attention
@@ -29,6 +30,7 @@
        devices contains the following additional features
 
        (+) Disable or enable wakeup from Stop mode(s)
+       (+) Chain a list of read commands (e.g. PMBus telemetry) with a single callback
 
                      ##### How to use this driver #####
   ==============================================================================
@@ -37,6 +39,8 @@
           (++) HAL_SMBUSEx_DisableWakeUp()
     (#) Configure the enable or disable of fast mode plus driving capability using the functions :
           (++) HAL_SMBUSEx_ConfigFastModePlus()
+    (#) Poll a table of read commands across devices using the function :
+          (++) HAL_SMBUSEx_CommandList_IT()
   @endverbatim
   */
 
@@ -59,6 +63,15 @@
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
+/** @addtogroup SMBUSEx_Private_Functions
+  * @{
+  */
+static HAL_StatusTypeDef SMBUSEx_CommandStart(SMBUS_HandleTypeDef *hsmbus);
+static void SMBUSEx_CommandISR(SMBUS_HandleTypeDef *hsmbus);
+/**
+  * @}
+  */
+
 /* Private functions ---------------------------------------------------------*/
 
 /** @defgroup SMBUSEx_Exported_Functions SMBUS Extended Exported Functions
@@ -227,6 +240,176 @@ HAL_StatusTypeDef HAL_SMBUSEx_ConfigFastModePlus(SMBUS_HandleTypeDef *hsmbus, ui
   * @}
   */
 
+/** @defgroup SMBUSEx_Exported_Functions_Group4 Command List Functions
+  * @brief    Command List Functions
+  *
+@verbatim
+ ===============================================================================
+                      ##### Command List Functions #####
+ ===============================================================================
+    [..] This section provides functions allowing to:
+      (+) Execute a table of read commands back-to-back with HAL_SMBUSEx_CommandList_IT(),
+          typically a PMBus telemetry poll (READ_VOUT, READ_IOUT, ...) across several devices.
+          Each command is a command code write followed by a repeated start data read,
+          started from the end of transfer interrupt of the previous one.
+      (+) When Packet Error Check is enabled, the PEC byte is checked by hardware and
+          stored after the data bytes, a mismatch is reported as HAL_SMBUS_ERROR_PECERR.
+      (+) HAL_SMBUSEx_CommandListCpltCallback() is executed once, at the end of the last command.
+      (+) On error, the list is stopped, hsmbus->CmdIndex gives the failing command and
+          HAL_SMBUS_ErrorCallback() is executed.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Execute a list of read commands in master/host mode in non-blocking mode.
+  * @param  hsmbus Pointer to a SMBUS_HandleTypeDef structure that contains
+  *                the configuration information for the specified SMBUSx peripheral.
+  * @param  pCmds Pointer to the command array, to be kept valid until the end of the list.
+  * @param  CmdNbr Number of commands in the array.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SMBUSEx_CommandList_IT(SMBUS_HandleTypeDef *hsmbus, SMBUS_CommandTypeDef *pCmds,
+                                             uint32_t CmdNbr)
+{
+  HAL_StatusTypeDef status;
+  uint32_t index;
+
+  if (hsmbus->State != HAL_SMBUS_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  if ((pCmds == NULL) || (CmdNbr == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  for (index = 0U; index < CmdNbr; index++)
+  {
+    if ((pCmds[index].pData == NULL) || (pCmds[index].Size == 0U)))
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  hsmbus->pCmds    = pCmds;
+  hsmbus->CmdNbr   = CmdNbr;
+  hsmbus->CmdIndex = 0U;
+  hsmbus->CmdStep  = 0U;
+  hsmbus->CmdISR   = SMBUSEx_CommandISR;
+
+  status = SMBUSEx_CommandStart(hsmbus);
+  if (status != HAL_OK)
+  {
+    hsmbus->CmdISR = NULL;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Command list completed callback.
+  * @param  hsmbus Pointer to a SMBUS_HandleTypeDef structure that contains
+  *                the configuration information for the specified SMBUS.
+  * @retval None
+  */
+__weak void HAL_SMBUSEx_CommandListCpltCallback(SMBUS_HandleTypeDef *hsmbus)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hsmbus);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_SMBUSEx_CommandListCpltCallback() could be implemented in the user file
+   */
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/** @addtogroup SMBUSEx_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Start the current step of the command pointed by hsmbus->CmdIndex.
+  * @param  hsmbus Pointer to a SMBUS_HandleTypeDef structure that contains
+  *                the configuration information for the specified SMBUS.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef SMBUSEx_CommandStart(SMBUS_HandleTypeDef *hsmbus)
+{
+  SMBUS_CommandTypeDef *pcmd = &hsmbus->pCmds[hsmbus->CmdIndex];
+  HAL_StatusTypeDef status;
+
+  if (hsmbus->CmdStep == 0U)
+  {
+    /* Command code write, no stop to permit the repeated start of the read */
+    status = HAL_SMBUS_Master_Transmit_IT(hsmbus, pcmd->DevAddress, &pcmd->Command, 1U, SMBUS_FIRST_FRAME);
+  }
+  else if (hsmbus->Init.PacketErrorCheckMode == SMBUS_PEC_ENABLE)
+  {
+    /* Data read followed by the PEC byte, checked by hardware over the whole transaction */
+    status = HAL_SMBUS_Master_Receive_IT(hsmbus, pcmd->DevAddress, pcmd->pData, (uint16_t)(pcmd->Size + 1U),
+                                         SMBUS_LAST_FRAME_WITH_PEC);
+  }
+  else
+  {
+    status = HAL_SMBUS_Master_Receive_IT(hsmbus, pcmd->DevAddress, pcmd->pData, pcmd->Size,
+                                         SMBUS_LAST_FRAME_NO_PEC);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Command list handler, called at the end of each successful transfer.
+  * @param  hsmbus Pointer to a SMBUS_HandleTypeDef structure that contains
+  *                the configuration information for the specified SMBUS.
+  * @retval None
+  */
+static void SMBUSEx_CommandISR(SMBUS_HandleTypeDef *hsmbus)
+{
+  if (hsmbus->CmdStep == 0U)
+  {
+    hsmbus->CmdStep = 1U;
+  }
+  else
+  {
+    hsmbus->CmdStep = 0U;
+    hsmbus->CmdIndex++;
+  }
+
+  if (hsmbus->CmdIndex >= hsmbus->CmdNbr)
+  {
+    /* End of the command list, a new list can be started from the callback */
+    hsmbus->CmdISR = NULL;
+
+    HAL_SMBUSEx_CommandListCpltCallback(hsmbus);
+  }
+  else if (SMBUSEx_CommandStart(hsmbus) != HAL_OK)
+  {
+    /* Next transfer cannot be started, stop the list on it */
+    hsmbus->CmdISR = NULL;
+
+#if (USE_HAL_SMBUS_REGISTER_CALLBACKS == 1)
+    hsmbus->ErrorCallback(hsmbus);
+#else
+    HAL_SMBUS_ErrorCallback(hsmbus);
+#endif /* USE_HAL_SMBUS_REGISTER_CALLBACKS */
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+}
+
 /**
   * @}
   */
@@ -39,6 +39,8 @@
           (##) NVIC configuration if you need to use interrupt process or DMA process
               (+++) Configure the SPIx interrupt priority
               (+++) Enable the NVIC SPI IRQ handle
+              (+++) Call HAL_SPI_IRQHandler(), or HAL_SPI_FastIRQHandler() for high rate
+                    interrupt process, from the SPIx interrupt handler
           (##) DMA Configuration if you need to use DMA process
               (+++) Declare a DMA_HandleTypeDef handle structure for the transmit or receive Stream/Channel
               (+++) Enable the DMAx clock
@@ -54,6 +56,10 @@
       (#) Initialize the SPI registers by calling the HAL_SPI_Init() API:
           (++) This API configures also the low level Hardware GPIO, CLOCK, CORTEX...etc)
               by calling the customized HAL_SPI_MspInit() API.
+
+      (#) In a polling or interrupt only application, USE_HAL_SPI_DMA set to 0 in the HAL
+          configuration removes the DMA transfer functions and the hdmatx/hdmarx handle fields,
+          while the HAL DMA module remains available for other drivers.
      [..]
        Callback registration:
 
@@ -161,7 +167,7 @@
 /** @defgroup SPI_Private_Functions SPI Private Functions
   * @{
   */
-#if defined(HAL_DMA_MODULE_ENABLED)
+#if defined(HAL_SPI_DMA_ENABLED)
 static void SPI_DMATransmitCplt(DMA_HandleTypeDef *hdma);
 static void SPI_DMAReceiveCplt(DMA_HandleTypeDef *hdma);
 static void SPI_DMATransmitReceiveCplt(DMA_HandleTypeDef *hdma);
@@ -172,7 +178,7 @@ static void SPI_DMAError(DMA_HandleTypeDef *hdma);
 static void SPI_DMAAbortOnError(DMA_HandleTypeDef *hdma);
 static void SPI_DMATxAbortCallback(DMA_HandleTypeDef *hdma);
 static void SPI_DMARxAbortCallback(DMA_HandleTypeDef *hdma);
-#endif /* HAL_DMA_MODULE_ENABLED */
+#endif /* HAL_SPI_DMA_ENABLED */
 static HAL_StatusTypeDef SPI_WaitOnFlagUntilTimeout(const SPI_HandleTypeDef *hspi, uint32_t Flag,
                                                     FlagStatus FlagStatus, uint32_t Timeout, uint32_t Tickstart);
 static void SPI_TxISR_8BIT(SPI_HandleTypeDef *hspi);
@@ -184,6 +190,11 @@ static void SPI_RxISR_32BIT(SPI_HandleTypeDef *hspi);
 static void SPI_AbortTransfer(SPI_HandleTypeDef *hspi);
 static void SPI_CloseTransfer(SPI_HandleTypeDef *hspi);
 static uint32_t SPI_GetPacketSize(const SPI_HandleTypeDef *hspi);
+#if defined(USE_HAL_OS_HOOKS) && (USE_HAL_OS_HOOKS == 1U)
+static HAL_StatusTypeDef SPI_OsTransfer(SPI_HandleTypeDef *hspi, const uint8_t *pTxData, uint8_t *pRxData,
+                                        uint16_t Size, uint32_t Timeout);
+static uint32_t SPI_OsSignal(SPI_HandleTypeDef *hspi);
+#endif /* USE_HAL_OS_HOOKS */
 
 
 /**
@@ -491,6 +502,9 @@ HAL_StatusTypeDef HAL_SPI_Init(SPI_HandleTypeDef *hspi)
   }
 
   hspi->ErrorCode = HAL_SPI_ERROR_NONE;
+#if defined(USE_HAL_OS_HOOKS) && (USE_HAL_OS_HOOKS == 1U)
+  hspi->OsWaiting = 0UL;
+#endif /* USE_HAL_OS_HOOKS */
   hspi->State     = HAL_SPI_STATE_READY;
 
   return HAL_OK;
@@ -858,6 +872,14 @@ HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, const uint8_t *pData
     assert_param(IS_SPI_TRANSFER_SIZE(Size));
   }
 
+#if defined(USE_HAL_OS_HOOKS) && (USE_HAL_OS_HOOKS == 1U)
+  /* Called from a thread: wait for the end of an interrupt transfer */
+  if ((Timeout != 0U) && (HAL_OS_IsBlockingAllowed() != 0U))
+  {
+    return SPI_OsTransfer(hspi, pData, NULL, Size, Timeout);
+  }
+
+#endif /* USE_HAL_OS_HOOKS */
   /* Init tickstart for timeout management*/
   tickstart = HAL_GetTick();
 
@@ -1094,6 +1116,14 @@ HAL_StatusTypeDef HAL_SPI_Receive(SPI_HandleTypeDef *hspi, uint8_t *pData, uint1
     assert_param(IS_SPI_TRANSFER_SIZE(Size));
   }
 
+#if defined(USE_HAL_OS_HOOKS) && (USE_HAL_OS_HOOKS == 1U)
+  /* Called from a thread: wait for the end of an interrupt transfer */
+  if ((Timeout != 0U) && (HAL_OS_IsBlockingAllowed() != 0U))
+  {
+    return SPI_OsTransfer(hspi, NULL, pData, Size, Timeout);
+  }
+
+#endif /* USE_HAL_OS_HOOKS */
   /* Init tickstart for timeout management*/
   tickstart = HAL_GetTick();
 
@@ -1343,6 +1373,8 @@ HAL_StatusTypeDef HAL_SPI_Receive(SPI_HandleTypeDef *hspi, uint8_t *pData, uint1
 
 /**
   * @brief  Transmit and Receive an amount of data in blocking mode.
+  * @note   For 8-bit data, the FIFO is accessed by 32-bit (resp. 16-bit) words packing four (resp. two)
+  *         data when the FIFO threshold is above 3 (resp. 1) data.
   * @param  hspi   : pointer to a SPI_HandleTypeDef structure that contains
   *                  the configuration information for SPI module.
   * @param  pTxData: pointer to transmission data buffer
@@ -1380,6 +1412,14 @@ HAL_StatusTypeDef HAL_SPI_TransmitReceive(SPI_HandleTypeDef *hspi, const uint8_t
     assert_param(IS_SPI_TRANSFER_SIZE(Size));
   }
 
+#if defined(USE_HAL_OS_HOOKS) && (USE_HAL_OS_HOOKS == 1U)
+  /* Called from a thread: wait for the end of an interrupt transfer */
+  if ((Timeout != 0U) && (HAL_OS_IsBlockingAllowed() != 0U))
+  {
+    return SPI_OsTransfer(hspi, pTxData, pRxData, Size, Timeout);
+  }
+
+#endif /* USE_HAL_OS_HOOKS */
   /* Init tickstart for timeout management*/
   tickstart = HAL_GetTick();
 
@@ -1594,9 +1634,31 @@ HAL_StatusTypeDef HAL_SPI_TransmitReceive(SPI_HandleTypeDef *hspi, const uint8_t
       if ((__HAL_SPI_GET_FLAG(hspi, SPI_FLAG_TXP)) && (initial_TxXferCount > 0UL) &&
           (initial_RxXferCount  < (initial_TxXferCount + fifo_length)))
       {
-        *((__IO uint8_t *)&hspi->Instance->TXDR) = *((const uint8_t *)hspi->pTxBuffPtr);
-        hspi->pTxBuffPtr += sizeof(uint8_t);
-        hspi->TxXferCount--;
+        /* Pack the data in 32-bit or 16-bit accesses when the FIFO has room for them */
+        if ((initial_TxXferCount > 3UL) && (hspi->Init.FifoThreshold > SPI_FIFO_THRESHOLD_03DATA) &&
+            ((initial_RxXferCount + 3UL) < (initial_TxXferCount + fifo_length)))
+        {
+          *((__IO uint32_t *)&hspi->Instance->TXDR) = *((const uint32_t *)hspi->pTxBuffPtr);
+          hspi->pTxBuffPtr += sizeof(uint32_t);
+          hspi->TxXferCount -= (uint16_t)4UL;
+        }
+        else if ((initial_TxXferCount > 1UL) && (hspi->Init.FifoThreshold > SPI_FIFO_THRESHOLD_01DATA) &&
+                 ((initial_RxXferCount + 1UL) < (initial_TxXferCount + fifo_length)))
+        {
+#if defined (__GNUC__)
+          *ptxdr_16bits = *((const uint16_t *)hspi->pTxBuffPtr);
+#else
+          *((__IO uint16_t *)&hspi->Instance->TXDR) = *((const uint16_t *)hspi->pTxBuffPtr);
+#endif /* __GNUC__ */
+          hspi->pTxBuffPtr += sizeof(uint16_t);
+          hspi->TxXferCount -= (uint16_t)2UL;
+        }
+        else
+        {
+          *((__IO uint8_t *)&hspi->Instance->TXDR) = *((const uint8_t *)hspi->pTxBuffPtr);
+          hspi->pTxBuffPtr += sizeof(uint8_t);
+          hspi->TxXferCount--;
+        }
         initial_TxXferCount = hspi->TxXferCount;
       }
 
@@ -1605,25 +1667,38 @@ HAL_StatusTypeDef HAL_SPI_TransmitReceive(SPI_HandleTypeDef *hspi, const uint8_t
 
       if (initial_RxXferCount > 0UL)
       {
-        /* Check the RXP flag */
+        /* Check the RXP flag, a whole packet of FIFO threshold data is available */
         if (__HAL_SPI_GET_FLAG(hspi, SPI_FLAG_RXP))
         {
-          *((uint8_t *)hspi->pRxBuffPtr) = *((__IO uint8_t *)&hspi->Instance->RXDR);
-          hspi->pRxBuffPtr += sizeof(uint8_t);
-          hspi->RxXferCount--;
+          if ((initial_RxXferCount > 3UL) && (hspi->Init.FifoThreshold > SPI_FIFO_THRESHOLD_03DATA))
+          {
+            *((uint32_t *)hspi->pRxBuffPtr) = *((__IO uint32_t *)&hspi->Instance->RXDR);
+            hspi->pRxBuffPtr += sizeof(uint32_t);
+            hspi->RxXferCount -= (uint16_t)4UL;
+          }
+          else if ((initial_RxXferCount > 1UL) && (hspi->Init.FifoThreshold > SPI_FIFO_THRESHOLD_01DATA))
+          {
+#if defined (__GNUC__)
+            *((uint16_t *)hspi->pRxBuffPtr) = *prxdr_16bits;
+#else
+            *((uint16_t *)hspi->pRxBuffPtr) = *((__IO uint16_t *)&hspi->Instance->RXDR);
+#endif /* __GNUC__ */
+            hspi->pRxBuffPtr += sizeof(uint16_t);
+            hspi->RxXferCount -= (uint16_t)2UL;
+          }
+          else
+          {
+            *((uint8_t *)hspi->pRxBuffPtr) = *((__IO uint8_t *)&hspi->Instance->RXDR);
+            hspi->pRxBuffPtr += sizeof(uint8_t);
+            hspi->RxXferCount--;
+          }
           initial_RxXferCount = hspi->RxXferCount;
         }
         /* Check RXWNE flag if RXP cannot be reached */
         else if ((initial_RxXferCount < init_max_data_in_fifo) && ((temp_sr_reg & SPI_SR_RXWNE_Msk) != 0UL))
         {
-          *((uint8_t *)hspi->pRxBuffPtr) = *((__IO uint8_t *)&hspi->Instance->RXDR);
-          hspi->pRxBuffPtr += sizeof(uint8_t);
-          *((uint8_t *)hspi->pRxBuffPtr) = *((__IO uint8_t *)&hspi->Instance->RXDR);
-          hspi->pRxBuffPtr += sizeof(uint8_t);
-          *((uint8_t *)hspi->pRxBuffPtr) = *((__IO uint8_t *)&hspi->Instance->RXDR);
-          hspi->pRxBuffPtr += sizeof(uint8_t);
-          *((uint8_t *)hspi->pRxBuffPtr) = *((__IO uint8_t *)&hspi->Instance->RXDR);
-          hspi->pRxBuffPtr += sizeof(uint8_t);
+          *((uint32_t *)hspi->pRxBuffPtr) = *((__IO uint32_t *)&hspi->Instance->RXDR);
+          hspi->pRxBuffPtr += sizeof(uint32_t);
           hspi->RxXferCount -= (uint16_t)4UL;
           initial_RxXferCount = hspi->RxXferCount;
         }
@@ -1874,6 +1949,8 @@ HAL_StatusTypeDef HAL_SPI_Receive_IT(SPI_HandleTypeDef *hspi, uint8_t *pData, ui
 
 /**
   * @brief  Transmit and Receive an amount of data in non-blocking mode with Interrupt.
+  * @note   For 8-bit data, the FIFO is accessed by 32-bit (resp. 16-bit) words packing four (resp. two)
+  *         data when the FIFO threshold is above 3 (resp. 1) data.
   * @param  hspi   : pointer to a SPI_HandleTypeDef structure that contains
   *                  the configuration information for SPI module.
   * @param  pTxData: pointer to transmission data buffer
@@ -1975,12 +2052,10 @@ HAL_StatusTypeDef HAL_SPI_TransmitReceive_IT(SPI_HandleTypeDef *hspi, const uint
       hspi->TxXferCount--;
       tmp_TxXferCount = hspi->TxXferCount;
     }
-    /* Transmit data in 8 Bit mode */
+    /* Transmit a packet of data in 8 Bit mode */
     else
     {
-      *((__IO uint8_t *)&hspi->Instance->TXDR) = *((const uint8_t *)hspi->pTxBuffPtr);
-      hspi->pTxBuffPtr += sizeof(uint8_t);
-      hspi->TxXferCount--;
+      SPI_TxISR_8BIT(hspi);
       tmp_TxXferCount = hspi->TxXferCount;
     }
   }
@@ -2003,7 +2078,7 @@ HAL_StatusTypeDef HAL_SPI_TransmitReceive_IT(SPI_HandleTypeDef *hspi, const uint
 
 
 
-#if defined(HAL_DMA_MODULE_ENABLED)
+#if defined(HAL_SPI_DMA_ENABLED)
 /**
   * @brief  Transmit an amount of data in non-blocking mode with DMA.
   * @param  hspi : pointer to a SPI_HandleTypeDef structure that contains
@@ -2128,6 +2203,15 @@ HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, const uint8_t *p
     hspi->TxXferCount = Size * 4U;
   }
 
+#if defined(USE_HAL_DCACHE_DMA_COHERENCY) && (USE_HAL_DCACHE_DMA_COHERENCY == 1U)
+  /* Write back the cache lines of the buffer read by the DMA */
+  if ((HAL_DCACHE_DMA_PrepareTx(hspi->pTxBuffPtr, hspi->TxXferCount) != HAL_OK) ||
+      (HAL_DCACHE_DMA_WaitPrepared() != HAL_OK))
+  {
+    status = HAL_ERROR;
+  }
+  else
+#endif /* USE_HAL_DCACHE_DMA_COHERENCY */
   /* Enable the Tx DMA Stream/Channel */
   if ((hspi->hdmatx->Mode & DMA_LINKEDLIST) == DMA_LINKEDLIST)
   {
@@ -2325,6 +2409,15 @@ HAL_StatusTypeDef HAL_SPI_Receive_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, u
     hspi->RxXferCount = Size * 4U;
   }
 
+#if defined(USE_HAL_DCACHE_DMA_COHERENCY) && (USE_HAL_DCACHE_DMA_COHERENCY == 1U)
+  /* Remove the cache lines of the buffer written by the DMA */
+  if ((HAL_DCACHE_DMA_PrepareRx(hspi->pRxBuffPtr, hspi->RxXferCount) != HAL_OK) ||
+      (HAL_DCACHE_DMA_WaitPrepared() != HAL_OK))
+  {
+    status = HAL_ERROR;
+  }
+  else
+#endif /* USE_HAL_DCACHE_DMA_COHERENCY */
   /* Enable the Rx DMA Stream/Channel  */
   if ((hspi->hdmarx->Mode & DMA_LINKEDLIST) == DMA_LINKEDLIST)
   {
@@ -2530,6 +2623,16 @@ HAL_StatusTypeDef HAL_SPI_TransmitReceive_DMA(SPI_HandleTypeDef *hspi, const uin
   {
     hspi->RxXferCount = Size * 4U;
   }
+
+#if defined(USE_HAL_DCACHE_DMA_COHERENCY) && (USE_HAL_DCACHE_DMA_COHERENCY == 1U)
+  /* Remove the cache lines of the buffer written by the DMA */
+  if ((HAL_DCACHE_DMA_PrepareRx(hspi->pRxBuffPtr, hspi->RxXferCount) != HAL_OK) ||
+      (HAL_DCACHE_DMA_WaitPrepared() != HAL_OK))
+  {
+    status = HAL_ERROR;
+  }
+  else
+#endif /* USE_HAL_DCACHE_DMA_COHERENCY */
   /* Enable the Rx DMA Stream/Channel  */
   if ((hspi->hdmarx->Mode & DMA_LINKEDLIST) == DMA_LINKEDLIST)
   {
@@ -2595,6 +2698,15 @@ HAL_StatusTypeDef HAL_SPI_TransmitReceive_DMA(SPI_HandleTypeDef *hspi, const uin
     hspi->TxXferCount = Size * 4U;
   }
 
+#if defined(USE_HAL_DCACHE_DMA_COHERENCY) && (USE_HAL_DCACHE_DMA_COHERENCY == 1U)
+  /* Write back the cache lines of the buffer read by the DMA */
+  if ((HAL_DCACHE_DMA_PrepareTx(hspi->pTxBuffPtr, hspi->TxXferCount) != HAL_OK) ||
+      (HAL_DCACHE_DMA_WaitPrepared() != HAL_OK))
+  {
+    status = HAL_ERROR;
+  }
+  else
+#endif /* USE_HAL_DCACHE_DMA_COHERENCY */
   /* Enable the Tx DMA Stream/Channel  */
   if ((hspi->hdmatx->Mode & DMA_LINKEDLIST) == DMA_LINKEDLIST)
   {
@@ -2667,7 +2779,7 @@ HAL_StatusTypeDef HAL_SPI_TransmitReceive_DMA(SPI_HandleTypeDef *hspi, const uin
 
   return HAL_OK;
 }
-#endif /* HAL_DMA_MODULE_ENABLED */
+#endif /* HAL_SPI_DMA_ENABLED */
 
 /**
   * @brief  Abort ongoing transfer (blocking mode).
@@ -2738,7 +2850,7 @@ HAL_StatusTypeDef HAL_SPI_Abort(SPI_HandleTypeDef *hspi)
     } while (__HAL_SPI_GET_FLAG(hspi, SPI_FLAG_SUSP));
   }
 
-#if defined(HAL_DMA_MODULE_ENABLED)
+#if defined(HAL_SPI_DMA_ENABLED)
   /* Disable the SPI DMA Tx request if enabled */
   if (HAL_IS_BIT_SET(hspi->Instance->CFG1, SPI_CFG1_TXDMAEN))
   {
@@ -2776,7 +2888,7 @@ HAL_StatusTypeDef HAL_SPI_Abort(SPI_HandleTypeDef *hspi)
       }
     }
   }
-#endif /* HAL_DMA_MODULE_ENABLED */
+#endif /* HAL_SPI_DMA_ENABLED */
 
   /* Proceed with abort procedure */
   SPI_AbortTransfer(hspi);
@@ -2821,10 +2933,10 @@ HAL_StatusTypeDef HAL_SPI_Abort_IT(SPI_HandleTypeDef *hspi)
 {
   HAL_StatusTypeDef errorcode;
   __IO uint32_t count;
-#if defined(HAL_DMA_MODULE_ENABLED)
+#if defined(HAL_SPI_DMA_ENABLED)
   uint32_t dma_tx_abort_done = 1UL;
   uint32_t dma_rx_abort_done = 1UL;
-#endif /* HAL_DMA_MODULE_ENABLED */
+#endif /* HAL_SPI_DMA_ENABLED */
 
   /* Set hspi->state to aborting to avoid any interaction */
   hspi->State = HAL_SPI_STATE_ABORT;
@@ -2873,7 +2985,7 @@ HAL_StatusTypeDef HAL_SPI_Abort_IT(SPI_HandleTypeDef *hspi)
     } while (__HAL_SPI_GET_FLAG(hspi, SPI_FLAG_SUSP));
   }
 
-#if defined(HAL_DMA_MODULE_ENABLED)
+#if defined(HAL_SPI_DMA_ENABLED)
   /* If DMA Tx and/or DMA Rx Handles are associated to SPI Handle, DMA Abort complete callbacks should be initialized
      before any call to DMA Abort functions */
 
@@ -2939,7 +3051,7 @@ HAL_StatusTypeDef HAL_SPI_Abort_IT(SPI_HandleTypeDef *hspi)
   /* If no running DMA transfer, finish cleanup and call callbacks */
   if ((dma_tx_abort_done == 1UL) && (dma_rx_abort_done == 1UL))
   {
-#endif /* HAL_DMA_MODULE_ENABLED */
+#endif /* HAL_SPI_DMA_ENABLED */
     /* Proceed with abort procedure */
     SPI_AbortTransfer(hspi);
 
@@ -2964,14 +3076,14 @@ HAL_StatusTypeDef HAL_SPI_Abort_IT(SPI_HandleTypeDef *hspi)
 #else
     HAL_SPI_AbortCpltCallback(hspi);
 #endif /* USE_HAL_SPI_REGISTER_CALLBACKS */
-#if defined(HAL_DMA_MODULE_ENABLED)
+#if defined(HAL_SPI_DMA_ENABLED)
   }
-#endif /* HAL_DMA_MODULE_ENABLED */
+#endif /* HAL_SPI_DMA_ENABLED */
 
   return errorcode;
 }
 
-#if defined(HAL_DMA_MODULE_ENABLED)
+#if defined(HAL_SPI_DMA_ENABLED)
 /**
   * @brief  Pause the DMA Transfer.
   *         This API is not supported, it is maintained for backward compatibility.
@@ -3016,7 +3128,7 @@ HAL_StatusTypeDef HAL_SPI_DMAStop(SPI_HandleTypeDef *hspi)
 
   return HAL_ERROR;
 }
-#endif /* HAL_DMA_MODULE_ENABLED */
+#endif /* HAL_SPI_DMA_ENABLED */
 
 /**
   * @brief  Handle SPI interrupt request.
@@ -3037,6 +3149,8 @@ void HAL_SPI_IRQHandler(SPI_HandleTypeDef *hspi)
   __IO uint16_t *prxdr_16bits = (__IO uint16_t *)(&(hspi->Instance->RXDR));
 #endif /* __GNUC__ */
 
+  HAL_TRACE_ENTER(HAL_TRACE_ID_SPI_IRQ, hspi);
+
   /* SPI in SUSPEND mode  ----------------------------------------------------*/
   if (HAL_IS_BIT_SET(itflag, SPI_FLAG_SUSP) && HAL_IS_BIT_SET(itsource, SPI_FLAG_EOT))
   {
@@ -3049,6 +3163,7 @@ void HAL_SPI_IRQHandler(SPI_HandleTypeDef *hspi)
 #else
     HAL_SPI_SuspendCallback(hspi);
 #endif /* USE_HAL_SPI_REGISTER_CALLBACKS */
+    HAL_TRACE_EXIT(HAL_TRACE_ID_SPI_IRQ, hspi);
     return;
   }
 
@@ -3079,6 +3194,7 @@ void HAL_SPI_IRQHandler(SPI_HandleTypeDef *hspi)
 
   if (handled != 0UL)
   {
+    HAL_TRACE_EXIT(HAL_TRACE_ID_SPI_IRQ, hspi);
     return;
   }
 
@@ -3130,6 +3246,26 @@ void HAL_SPI_IRQHandler(SPI_HandleTypeDef *hspi)
     SPI_CloseTransfer(hspi);
 
     hspi->State = HAL_SPI_STATE_READY;
+
+#if defined(HAL_SPI_DMA_ENABLED)
+    /* Transaction queue ongoing : completion and errors are reported by the queue handler */
+    if (hspi->TransactionISR != NULL)
+    {
+      hspi->TransactionISR(hspi);
+      HAL_TRACE_EXIT(HAL_TRACE_ID_SPI_IRQ, hspi);
+      return;
+    }
+
+#endif /* HAL_SPI_DMA_ENABLED */
+#if defined(USE_HAL_OS_HOOKS) && (USE_HAL_OS_HOOKS == 1U)
+    /* Blocking transfer : wake up the waiting thread instead of the callbacks */
+    if (SPI_OsSignal(hspi) != 0U)
+    {
+      HAL_TRACE_EXIT(HAL_TRACE_ID_SPI_IRQ, hspi);
+      return;
+    }
+
+#endif /* USE_HAL_OS_HOOKS */
     if (hspi->ErrorCode != HAL_SPI_ERROR_NONE)
     {
 #if (USE_HAL_SPI_REGISTER_CALLBACKS == 1UL)
@@ -3137,6 +3273,7 @@ void HAL_SPI_IRQHandler(SPI_HandleTypeDef *hspi)
 #else
       HAL_SPI_ErrorCallback(hspi);
 #endif /* USE_HAL_SPI_REGISTER_CALLBACKS */
+      HAL_TRACE_EXIT(HAL_TRACE_ID_SPI_IRQ, hspi);
       return;
     }
 
@@ -3174,6 +3311,7 @@ void HAL_SPI_IRQHandler(SPI_HandleTypeDef *hspi)
       /* End of the appropriate call */
     }
 
+    HAL_TRACE_EXIT(HAL_TRACE_ID_SPI_IRQ, hspi);
     return;
   }
 
@@ -3217,7 +3355,7 @@ void HAL_SPI_IRQHandler(SPI_HandleTypeDef *hspi)
       __HAL_SPI_DISABLE_IT(hspi, (SPI_IT_EOT | SPI_IT_RXP | SPI_IT_TXP | SPI_IT_MODF |
                                   SPI_IT_OVR | SPI_IT_FRE | SPI_IT_UDR));
 
-#if defined(HAL_DMA_MODULE_ENABLED)
+#if defined(HAL_SPI_DMA_ENABLED)
       /* Disable the SPI DMA requests if enabled */
       if (HAL_IS_BIT_SET(cfg1, SPI_CFG1_TXDMAEN | SPI_CFG1_RXDMAEN))
       {
@@ -3249,22 +3387,77 @@ void HAL_SPI_IRQHandler(SPI_HandleTypeDef *hspi)
       }
       else
       {
-#endif /* HAL_DMA_MODULE_ENABLED */
+#endif /* HAL_SPI_DMA_ENABLED */
         /* Restore hspi->State to Ready */
         hspi->State = HAL_SPI_STATE_READY;
 
+#if defined(USE_HAL_OS_HOOKS) && (USE_HAL_OS_HOOKS == 1U)
+        /* Blocking transfer : wake up the waiting thread instead of the error callback */
+        if (SPI_OsSignal(hspi) != 0U)
+        {
+          HAL_TRACE_EXIT(HAL_TRACE_ID_SPI_IRQ, hspi);
+          return;
+        }
+
+#endif /* USE_HAL_OS_HOOKS */
         /* Call user error callback */
 #if (USE_HAL_SPI_REGISTER_CALLBACKS == 1UL)
         hspi->ErrorCallback(hspi);
 #else
         HAL_SPI_ErrorCallback(hspi);
 #endif /* USE_HAL_SPI_REGISTER_CALLBACKS */
-#if defined(HAL_DMA_MODULE_ENABLED)
+#if defined(HAL_SPI_DMA_ENABLED)
+      }
+#endif /* HAL_SPI_DMA_ENABLED */
+    }
+    HAL_TRACE_EXIT(HAL_TRACE_ID_SPI_IRQ, hspi);
+    return;
+  }
+
+  HAL_TRACE_EXIT(HAL_TRACE_ID_SPI_IRQ, hspi);
+}
+
+/**
+  * @brief  Handle SPI interrupt request, with a direct dispatch of the data packet events.
+  * @note   When the only active events are RXP, TXP or DXP, they are dispatched to the Rx and
+  *         Tx ISR without checking the other flags. Any other event is handled by
+  *         HAL_SPI_IRQHandler().
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for the specified SPI module.
+  * @retval None
+  */
+void HAL_SPI_FastIRQHandler(SPI_HandleTypeDef *hspi)
+{
+  uint32_t itflag  = hspi->Instance->SR;
+  uint32_t trigger = hspi->Instance->IER & itflag;
+
+  if ((trigger != 0UL) && ((trigger & ~(SPI_FLAG_DXP | SPI_FLAG_RXP | SPI_FLAG_TXP)) == 0UL) &&
+      HAL_IS_BIT_CLR(itflag, SPI_FLAG_SUSP))
+  {
+    HAL_TRACE_ENTER(HAL_TRACE_ID_SPI_IRQ, hspi);
+
+    if (HAL_IS_BIT_SET(trigger, SPI_FLAG_DXP))
+    {
+      hspi->TxISR(hspi);
+      hspi->RxISR(hspi);
+    }
+    else
+    {
+      if (HAL_IS_BIT_SET(trigger, SPI_FLAG_RXP))
+      {
+        hspi->RxISR(hspi);
+      }
+      if (HAL_IS_BIT_SET(trigger, SPI_FLAG_TXP))
+      {
+        hspi->TxISR(hspi);
       }
-#endif /* HAL_DMA_MODULE_ENABLED */
     }
+
+    HAL_TRACE_EXIT(HAL_TRACE_ID_SPI_IRQ, hspi);
     return;
   }
+
+  HAL_SPI_IRQHandler(hspi);
 }
 
 /**
@@ -3468,7 +3661,7 @@ uint32_t HAL_SPI_GetError(const SPI_HandleTypeDef *hspi)
   * @{
   */
 
-#if defined(HAL_DMA_MODULE_ENABLED)
+#if defined(HAL_SPI_DMA_ENABLED)
 /**
   * @brief DMA SPI transmit process complete callback.
   * @param  hdma: pointer to a DMA_HandleTypeDef structure that contains
@@ -3509,6 +3702,11 @@ static void SPI_DMAReceiveCplt(DMA_HandleTypeDef *hdma)
 
   if (hspi->State != HAL_SPI_STATE_ABORT)
   {
+#if defined(USE_HAL_DCACHE_DMA_COHERENCY) && (USE_HAL_DCACHE_DMA_COHERENCY == 1U)
+    /* Drop the cache lines loaded while the DMA wrote the buffer */
+    (void)HAL_DCACHE_DMA_CompleteRx(hspi->pRxBuffPtr, hspi->RxXferCount);
+#endif /* USE_HAL_DCACHE_DMA_COHERENCY */
+
     if (hspi->hdmarx->Mode == DMA_LINKEDLIST_CIRCULAR)
     {
 #if (USE_HAL_SPI_REGISTER_CALLBACKS == 1UL)
@@ -3537,6 +3735,11 @@ static void SPI_DMATransmitReceiveCplt(DMA_HandleTypeDef *hdma)
 
   if (hspi->State != HAL_SPI_STATE_ABORT)
   {
+#if defined(USE_HAL_DCACHE_DMA_COHERENCY) && (USE_HAL_DCACHE_DMA_COHERENCY == 1U)
+    /* Drop the cache lines loaded while the DMA wrote the buffer */
+    (void)HAL_DCACHE_DMA_CompleteRx(hspi->pRxBuffPtr, hspi->RxXferCount);
+#endif /* USE_HAL_DCACHE_DMA_COHERENCY */
+
     if ((hspi->hdmarx->Mode == DMA_LINKEDLIST_CIRCULAR) &&
         (hspi->hdmatx->Mode == DMA_LINKEDLIST_CIRCULAR))
     {
@@ -3626,6 +3829,14 @@ static void SPI_DMAError(DMA_HandleTypeDef *hdma)
 
     SET_BIT(hspi->ErrorCode, HAL_SPI_ERROR_DMA);
     hspi->State = HAL_SPI_STATE_READY;
+
+    /* Transaction queue ongoing : error is reported by the queue handler */
+    if (hspi->TransactionISR != NULL)
+    {
+      hspi->TransactionISR(hspi);
+      return;
+    }
+
 #if (USE_HAL_SPI_REGISTER_CALLBACKS == 1UL)
     hspi->ErrorCallback(hspi);
 #else
@@ -3649,6 +3860,13 @@ static void SPI_DMAAbortOnError(DMA_HandleTypeDef *hdma)
   /* Restore hspi->State to Ready */
   hspi->State = HAL_SPI_STATE_READY;
 
+  /* Transaction queue ongoing : error is reported by the queue handler */
+  if (hspi->TransactionISR != NULL)
+  {
+    hspi->TransactionISR(hspi);
+    return;
+  }
+
 #if (USE_HAL_SPI_REGISTER_CALLBACKS == 1UL)
   hspi->ErrorCallback(hspi);
 #else
@@ -3729,7 +3947,7 @@ static void SPI_DMARxAbortCallback(DMA_HandleTypeDef *hdma)
   HAL_SPI_AbortCpltCallback(hspi);
 #endif /* USE_HAL_SPI_REGISTER_CALLBACKS */
 }
-#endif /* HAL_DMA_MODULE_ENABLED */
+#endif /* HAL_SPI_DMA_ENABLED */
 
 /**
   * @brief  Manage the receive 8-bit in Interrupt context.
@@ -3739,10 +3957,40 @@ static void SPI_DMARxAbortCallback(DMA_HandleTypeDef *hdma)
   */
 static void SPI_RxISR_8BIT(SPI_HandleTypeDef *hspi)
 {
-  /* Receive data in 8 Bit mode */
-  *((uint8_t *)hspi->pRxBuffPtr) = (*(__IO uint8_t *)&hspi->Instance->RXDR);
-  hspi->pRxBuffPtr += sizeof(uint8_t);
-  hspi->RxXferCount--;
+  /* RXP is set when a packet of FIFO threshold data is available */
+  uint32_t count = (hspi->Init.FifoThreshold >> 5U) + 1UL;
+#if defined (__GNUC__)
+  __IO uint16_t *prxdr_16bits = (__IO uint16_t *)(&(hspi->Instance->RXDR));
+#endif /* __GNUC__ */
+
+  if (count > hspi->RxXferCount)
+  {
+    count = hspi->RxXferCount;
+  }
+  hspi->RxXferCount -= (uint16_t)count;
+
+  /* Receive the packet in 8 Bit mode, with 32-bit and 16-bit packed accesses */
+  while (count > 3UL)
+  {
+    *((uint32_t *)hspi->pRxBuffPtr) = (*(__IO uint32_t *)&hspi->Instance->RXDR);
+    hspi->pRxBuffPtr += sizeof(uint32_t);
+    count -= 4UL;
+  }
+  if (count > 1UL)
+  {
+#if defined (__GNUC__)
+    *((uint16_t *)hspi->pRxBuffPtr) = *prxdr_16bits;
+#else
+    *((uint16_t *)hspi->pRxBuffPtr) = (*(__IO uint16_t *)&hspi->Instance->RXDR);
+#endif /* __GNUC__ */
+    hspi->pRxBuffPtr += sizeof(uint16_t);
+    count -= 2UL;
+  }
+  if (count > 0UL)
+  {
+    *((uint8_t *)hspi->pRxBuffPtr) = (*(__IO uint8_t *)&hspi->Instance->RXDR);
+    hspi->pRxBuffPtr += sizeof(uint8_t);
+  }
 
   /* Disable IT if no more data excepted */
   if (hspi->RxXferCount == 0UL)
@@ -3811,10 +4059,40 @@ static void SPI_RxISR_32BIT(SPI_HandleTypeDef *hspi)
   */
 static void SPI_TxISR_8BIT(SPI_HandleTypeDef *hspi)
 {
-  /* Transmit data in 8 Bit mode */
-  *(__IO uint8_t *)&hspi->Instance->TXDR = *((const uint8_t *)hspi->pTxBuffPtr);
-  hspi->pTxBuffPtr += sizeof(uint8_t);
-  hspi->TxXferCount--;
+  /* TXP is set when the FIFO has room for a packet of FIFO threshold data */
+  uint32_t count = (hspi->Init.FifoThreshold >> 5U) + 1UL;
+#if defined (__GNUC__)
+  __IO uint16_t *ptxdr_16bits = (__IO uint16_t *)(&(hspi->Instance->TXDR));
+#endif /* __GNUC__ */
+
+  if (count > hspi->TxXferCount)
+  {
+    count = hspi->TxXferCount;
+  }
+  hspi->TxXferCount -= (uint16_t)count;
+
+  /* Transmit the packet in 8 Bit mode, with 32-bit and 16-bit packed accesses */
+  while (count > 3UL)
+  {
+    *((__IO uint32_t *)&hspi->Instance->TXDR) = *((const uint32_t *)hspi->pTxBuffPtr);
+    hspi->pTxBuffPtr += sizeof(uint32_t);
+    count -= 4UL;
+  }
+  if (count > 1UL)
+  {
+#if defined (__GNUC__)
+    *ptxdr_16bits = *((const uint16_t *)hspi->pTxBuffPtr);
+#else
+    *((__IO uint16_t *)&hspi->Instance->TXDR) = *((const uint16_t *)hspi->pTxBuffPtr);
+#endif /* __GNUC__ */
+    hspi->pTxBuffPtr += sizeof(uint16_t);
+    count -= 2UL;
+  }
+  if (count > 0UL)
+  {
+    *(__IO uint8_t *)&hspi->Instance->TXDR = *((const uint8_t *)hspi->pTxBuffPtr);
+    hspi->pTxBuffPtr += sizeof(uint8_t);
+  }
 
   /* Disable IT if no more data excepted */
   if (hspi->TxXferCount == 0UL)
@@ -4026,6 +4304,88 @@ static uint32_t SPI_GetPacketSize(const SPI_HandleTypeDef *hspi)
   return data_size * fifo_threashold;
 }
 
+#if defined(USE_HAL_OS_HOOKS) && (USE_HAL_OS_HOOKS == 1U)
+/**
+  * @brief  Blocking transfer done in interrupt mode, the thread waiting with HAL_OS_Wait().
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @param  pTxData: pointer to transmission data buffer, NULL for a reception
+  * @param  pRxData: pointer to reception data buffer, NULL for a transmission
+  * @param  Size : amount of data to be sent and received
+  * @param  Timeout: Timeout duration
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef SPI_OsTransfer(SPI_HandleTypeDef *hspi, const uint8_t *pTxData, uint8_t *pRxData,
+                                        uint16_t Size, uint32_t Timeout)
+{
+  HAL_StatusTypeDef status;
+  uint32_t primask_bit;
+  uint32_t waiting;
+
+  hspi->OsWaiting = 1UL;
+
+  if (pRxData == NULL)
+  {
+    status = HAL_SPI_Transmit_IT(hspi, pTxData, Size);
+  }
+  else if (pTxData == NULL)
+  {
+    status = HAL_SPI_Receive_IT(hspi, pRxData, Size);
+  }
+  else
+  {
+    status = HAL_SPI_TransmitReceive_IT(hspi, pTxData, pRxData, Size);
+  }
+
+  if (status != HAL_OK)
+  {
+    hspi->OsWaiting = 0UL;
+    return status;
+  }
+
+  if (HAL_OS_Wait(hspi, Timeout) != HAL_OK)
+  {
+    /* Withdraw the waiting request unless the transfer has just ended */
+    primask_bit = __get_PRIMASK();
+    __disable_irq();
+    waiting = hspi->OsWaiting;
+    hspi->OsWaiting = 0UL;
+    __set_PRIMASK(primask_bit);
+
+    if (waiting != 0UL)
+    {
+      (void)HAL_SPI_Abort(hspi);
+      SET_BIT(hspi->ErrorCode, HAL_SPI_ERROR_TIMEOUT);
+      return HAL_TIMEOUT;
+    }
+
+    /* Consume the signal given meanwhile */
+    (void)HAL_OS_Wait(hspi, 0UL);
+  }
+
+  return (hspi->ErrorCode == HAL_SPI_ERROR_NONE) ? HAL_OK : HAL_ERROR;
+}
+
+/**
+  * @brief  Wake up the thread waiting for the end of a blocking transfer.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @retval 1 if a thread was waiting, 0 otherwise
+  */
+static uint32_t SPI_OsSignal(SPI_HandleTypeDef *hspi)
+{
+  if (hspi->OsWaiting == 0UL)
+  {
+    return 0UL;
+  }
+
+  hspi->OsWaiting = 0UL;
+  HAL_OS_Signal(hspi);
+
+  return 1UL;
+}
+#endif /* USE_HAL_OS_HOOKS */
+
 /**
   * @}
   */
@@ -39,6 +39,23 @@
 /* Private macros ------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
+/** @defgroup SPIEx_Private_Functions SPIEx Private Functions
+  * @{
+  */
+static void SPIEx_MailboxRxISR(SPI_HandleTypeDef *hspi);
+static void SPIEx_MailboxTxISR(SPI_HandleTypeDef *hspi);
+#if defined(HAL_SPI_DMA_ENABLED)
+static HAL_StatusTypeDef SPIEx_TransactionStart(SPI_HandleTypeDef *hspi);
+static void SPIEx_TransactionISR(SPI_HandleTypeDef *hspi);
+static void SPIEx_DMAStreamCplt(DMA_HandleTypeDef *hdma);
+#if defined(USE_HAL_REQUEST) && (USE_HAL_REQUEST == 1U)
+static void SPIEx_RequestISR(SPI_HandleTypeDef *hspi);
+#endif /* USE_HAL_REQUEST */
+#endif /* HAL_SPI_DMA_ENABLED */
+/**
+  * @}
+  */
+
 /* Exported functions --------------------------------------------------------*/
 
 /** @defgroup SPIEx_Exported_Functions SPIEx Exported Functions
@@ -61,6 +78,50 @@
         (++) HAL_SPIEx_EnableLockConfiguration()
         (++) HAL_SPIEx_ConfigureUnderrun()
 
+    (#) Slave mailbox:
+        (++) HAL_SPIEx_MailboxStart() makes a slave answer register reads in the frames following
+             the command byte, from a table of preloaded responses (SPI_MailboxTypeDef) indexed by
+             the command. The SPI runs endless (TSIZE = 0) in full duplex with 8-bit frames and a
+             FIFO threshold of one frame.
+        (++) On each command byte, the response slot is loaded in the Tx FIFO directly from the
+             RXP interrupt, the TXP interrupt completes the slots larger than the FIFO, then the
+             CommandCallback of the mailbox is called. No DMA channel is restarted per command.
+        (++) While no response is loaded, the underrun pattern is sent (SPI_UNDERRUN_BEHAV_REGISTER_PATTERN).
+             The master has to leave a gap after the command byte longer than the interrupt latency,
+             frames clocked earlier carry the pattern.
+        (++) On overrun or mode fault, the mailbox is stopped and HAL_SPI_ErrorCallback() is called.
+             HAL_SPIEx_MailboxStop() stops it, a Stop/Start sequence also resynchronizes the
+             command framing with the master.
+
+    (#) Transaction queue:
+        (++) HAL_SPIEx_TransactionQueue_DMA() executes a linked list of SPI_TransactionTypeDef
+             descriptors back-to-back in DMA mode, from the SPI end of transfer interrupt.
+             For each transaction the chip select GPIO is driven low, the clock polarity and
+             phase of the addressed device are applied, and the transaction XferCpltCallback
+             is called once the chip select has been released.
+        (++) On error, the queue is stopped, hspi->pTransaction points to the failing
+             transaction and HAL_SPI_ErrorCallback() is called.
+        (++) HAL_SPIEx_AbortTransactionQueue() aborts the ongoing transaction queue.
+
+    (#) Rx stream:
+        (++) HAL_SPIEx_StreamStart() starts an endless reception (TSIZE = 0) ping-ponging between
+             two buffers. The Rx DMA channel has to be configured in circular linked-list mode with
+             a single node queue and the transfer complete event generated at the end of each
+             linked-list item (DMA_TCEM_EACH_LL_ITEM_TRANSFER). A second node, provided by the
+             application, is built from the first one for the second buffer.
+        (++) HAL_SPI_RxCpltCallback() is called each time a buffer is full,
+             HAL_SPIEx_StreamGetCpltBuffer() returns it and HAL_SPIEx_StreamSetNextBuffer() may
+             replace it by a new buffer for the next round.
+        (++) HAL_SPIEx_StreamStop() stops the reception and restores the single node queue.
+
+    (#) Asynchronous request (USE_HAL_REQUEST set to 1):
+        (++) HAL_SPIEx_Request_Start() is the Start function of a HAL_RequestTypeDef running a
+             DMA transfer of Size frames: pSrc only for a transmission, pDst only for a
+             reception, both for a full duplex transfer.
+        (++) The request is completed from the SPI end of transfer interrupt, HAL_SPI_TxCpltCallback(),
+             HAL_SPI_RxCpltCallback(), HAL_SPI_TxRxCpltCallback() and HAL_SPI_ErrorCallback() are
+             not called for it.
+
 @endverbatim
   * @{
   */
@@ -302,10 +363,633 @@ HAL_StatusTypeDef HAL_SPIEx_DisableDelayReadDataSampling(SPI_HandleTypeDef *hspi
 }
 #endif /* SPI_CFG1_DRDS */
 
+/**
+  * @brief  Start the slave mailbox.
+  * @note   Each byte received while no response is pending is a command: the slot of the
+  *         command is loaded in the Tx FIFO for the SlotSize following frames. pMailbox must
+  *         stay valid until HAL_SPIEx_MailboxStop() is called.
+  * @note   The SPI has to be configured in slave full duplex mode, with 8-bit frames and
+  *         SPI_FIFO_THRESHOLD_01DATA. The underrun behaviour is set to
+  *         SPI_UNDERRUN_BEHAV_REGISTER_PATTERN.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @param  pMailbox: pointer to the mailbox description
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SPIEx_MailboxStart(SPI_HandleTypeDef *hspi, SPI_MailboxTypeDef *pMailbox)
+{
+  /* Check the parameters */
+  if ((pMailbox == NULL) || (pMailbox->pSlots == NULL) || (pMailbox->SlotSize == 0UL) ||
+      (pMailbox->SlotNbr == 0UL) || (pMailbox->SlotNbr > 256UL))
+  {
+    return HAL_ERROR;
+  }
+
+  if ((hspi->Init.Mode != SPI_MODE_SLAVE) || (hspi->Init.Direction != SPI_DIRECTION_2LINES) ||
+      (hspi->Init.DataSize != SPI_DATASIZE_8BIT) || (hspi->Init.FifoThreshold != SPI_FIFO_THRESHOLD_01DATA))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hspi->State != HAL_SPI_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  /* Lock the process */
+  __HAL_LOCK(hspi);
+
+  /* Set the transaction information */
+  hspi->State       = HAL_SPI_STATE_BUSY_TX_RX;
+  hspi->ErrorCode   = HAL_SPI_ERROR_NONE;
+  hspi->pTxBuffPtr  = NULL;
+  hspi->TxXferSize  = 0U;
+  hspi->TxXferCount = 0U;
+  hspi->pRxBuffPtr  = NULL;
+  hspi->RxXferSize  = 0U;
+  hspi->RxXferCount = 0U;
+  hspi->RxISR       = SPIEx_MailboxRxISR;
+  hspi->TxISR       = SPIEx_MailboxTxISR;
+
+  pMailbox->pTxPtr  = NULL;
+  pMailbox->TxCount = 0UL;
+  pMailbox->RxCount = 0UL;
+  hspi->pMailbox    = pMailbox;
+
+  /* Send the pattern while no response is loaded, the SPI is disabled in READY state */
+  MODIFY_REG(hspi->Instance->CFG1, SPI_CFG1_UDRCFG, SPI_UNDERRUN_BEHAV_REGISTER_PATTERN);
+  WRITE_REG(hspi->Instance->UDRDR, pMailbox->UnderrunPattern);
+
+  /* Configure communication direction : 2Lines */
+  SPI_2LINES(hspi);
+
+  /* Endless transfer */
+  MODIFY_REG(hspi->Instance->CR2, SPI_CR2_TSIZE, 0UL);
+
+  /* Enable SPI peripheral */
+  __HAL_SPI_ENABLE(hspi);
+
+  /* Unlock the process */
+  __HAL_UNLOCK(hspi);
+
+  /* Enable RXP, OVR, FRE and MODF interrupts, TXP is only enabled while a response is loaded */
+  __HAL_SPI_ENABLE_IT(hspi, (SPI_IT_RXP | SPI_IT_OVR | SPI_IT_FRE | SPI_IT_MODF));
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the slave mailbox.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SPIEx_MailboxStop(SPI_HandleTypeDef *hspi)
+{
+  HAL_StatusTypeDef errorcode;
+
+  if (hspi->pMailbox == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Disable the interrupts and the SPI, the Tx FIFO is flushed */
+  errorcode = HAL_SPI_Abort(hspi);
+
+  hspi->pMailbox = NULL;
+
+  return errorcode;
+}
+
+#if defined(HAL_SPI_DMA_ENABLED)
+/**
+  * @brief  Execute a list of SPI transactions back-to-back in DMA mode.
+  * @note   Transactions are linked through their pNext field. Each of them is started from the
+  *         end of transfer interrupt of the previous one, so no application handshake is needed
+  *         between transfers on a shared bus.
+  * @note   A transaction with pRxData set to NULL is transmit only, a transaction with pTxData
+  *         set to NULL is receive only, as allowed by the configured SPI direction.
+  * @note   The descriptors and their buffers must be kept valid until the last transaction
+  *         complete callback or the error callback.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @param  pTransaction: pointer to the first transaction of the list.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SPIEx_TransactionQueue_DMA(SPI_HandleTypeDef *hspi, SPI_TransactionTypeDef *pTransaction)
+{
+  const SPI_TransactionTypeDef *ptransaction = pTransaction;
+  HAL_StatusTypeDef errorcode;
+
+  /* Check the master mode, chip select is only driven by the master */
+  assert_param(IS_SPI_MODE(hspi->Init.Mode));
+
+  if (hspi->State != HAL_SPI_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  if (pTransaction == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check all the descriptors before starting the first transfer */
+  while (ptransaction != NULL)
+  {
+    assert_param(IS_SPI_CPOL(ptransaction->CLKPolarity));
+    assert_param(IS_SPI_CPHA(ptransaction->CLKPhase));
+
+    if (((ptransaction->pTxData == NULL) && (ptransaction->pRxData == NULL)) || (ptransaction->Size == 0U))
+    {
+      return HAL_ERROR;
+    }
+    ptransaction = ptransaction->pNext;
+  }
+
+  hspi->pTransaction   = pTransaction;
+  hspi->TransactionISR = SPIEx_TransactionISR;
+
+  errorcode = SPIEx_TransactionStart(hspi);
+  if (errorcode != HAL_OK)
+  {
+    hspi->TransactionISR = NULL;
+    hspi->pTransaction   = NULL;
+  }
+
+  return errorcode;
+}
+
+/**
+  * @brief  Abort the ongoing transaction queue (blocking mode).
+  * @note   The chip select of the ongoing transaction is released, the transaction complete
+  *         callback is not called.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SPIEx_AbortTransactionQueue(SPI_HandleTypeDef *hspi)
+{
+  HAL_StatusTypeDef errorcode;
+
+  if (hspi->TransactionISR == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  hspi->TransactionISR = NULL;
+
+  errorcode = HAL_SPI_Abort(hspi);
+
+  if (hspi->pTransaction->CSPort != NULL)
+  {
+    HAL_GPIO_WritePin(hspi->pTransaction->CSPort, hspi->pTransaction->CSPin, GPIO_PIN_SET);
+  }
+  hspi->pTransaction = NULL;
+
+  return errorcode;
+}
+
+/**
+  * @brief  Start an endless reception in DMA mode, alternating between two buffers.
+  * @note   The Rx DMA channel must be in circular linked-list mode, its queue must contain a single
+  *         node generating the transfer complete event at the end of each linked-list item.
+  * @note   pNode is linked after the queue node to describe pBuffer1. It must be kept valid until
+  *         HAL_SPIEx_StreamStop().
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @param  pNode: pointer to the DMA node used for the second buffer.
+  * @param  pBuffer0: pointer to the first reception buffer.
+  * @param  pBuffer1: pointer to the second reception buffer.
+  * @param  Size: amount of data to be received in each buffer.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SPIEx_StreamStart(SPI_HandleTypeDef *hspi, DMA_NodeTypeDef *pNode, uint8_t *pBuffer0,
+                                        uint8_t *pBuffer1, uint16_t Size)
+{
+  DMA_QListTypeDef *pqueue;
+  DMA_NodeConfTypeDef node_config;
+  HAL_StatusTypeDef errorcode;
+  uint32_t nb_bytes = Size;
+
+  if (hspi->State != HAL_SPI_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  if ((pNode == NULL) || (pBuffer0 == NULL) || (pBuffer1 == NULL) || (Size == 0UL))
+  {
+    return HAL_ERROR;
+  }
+
+  if ((hspi->hdmarx == NULL) || (hspi->hdmarx->Mode != DMA_LINKEDLIST_CIRCULAR) ||
+      (hspi->hdmarx->LinkedListQueue == NULL) || (hspi->hdmarx->LinkedListQueue->NodeNumber != 1U))
+  {
+    return HAL_ERROR;
+  }
+
+  pqueue = hspi->hdmarx->LinkedListQueue;
+
+  /* Each buffer completion must be notified */
+  if ((pqueue->Head->LinkRegisters[NODE_CTR2_DEFAULT_OFFSET] & DMA_CTR2_TCEM) != DMA_TCEM_EACH_LL_ITEM_TRANSFER)
+  {
+    return HAL_ERROR;
+  }
+
+  if (hspi->Init.DataSize > SPI_DATASIZE_16BIT)
+  {
+    nb_bytes = (uint32_t)Size * 4U;
+  }
+  else if (hspi->Init.DataSize > SPI_DATASIZE_8BIT)
+  {
+    nb_bytes = (uint32_t)Size * 2U;
+  }
+  else
+  {
+    /* One byte per data */
+  }
+
+  /* Build the second buffer node from the queue node and link it in the circular queue */
+  errorcode = HAL_DMAEx_List_GetNodeConfig(&node_config, pqueue->Head);
+  if (errorcode == HAL_OK)
+  {
+    node_config.SrcAddress = (uint32_t)&hspi->Instance->RXDR;
+    node_config.DstAddress = (uint32_t)pBuffer1;
+    node_config.DataSize   = nb_bytes;
+    errorcode = HAL_DMAEx_List_BuildNode(&node_config, pNode);
+  }
+  if (errorcode == HAL_OK)
+  {
+    errorcode = HAL_DMAEx_List_InsertNode_Tail(pqueue, pNode);
+  }
+  if (errorcode != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  hspi->pStreamNode   = pNode;
+  hspi->StreamBuffIdx = 0UL;
+
+  /* The queue first node is programmed by the standard circular reception */
+  errorcode = HAL_SPI_Receive_DMA(hspi, pBuffer0, Size);
+  if (errorcode == HAL_OK)
+  {
+    /* Track the buffer switches on each linked-list item completion */
+    hspi->hdmarx->XferCpltCallback = SPIEx_DMAStreamCplt;
+  }
+  else
+  {
+    (void)HAL_DMAEx_List_RemoveNode_Tail(pqueue);
+    (void)HAL_DMAEx_List_SetCircularMode(pqueue);
+    hspi->pStreamNode = NULL;
+  }
+
+  return errorcode;
+}
+
+/**
+  * @brief  Stop the reception started by HAL_SPIEx_StreamStart() (blocking mode).
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SPIEx_StreamStop(SPI_HandleTypeDef *hspi)
+{
+  HAL_StatusTypeDef errorcode;
+
+  if (hspi->pStreamNode == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  errorcode = HAL_SPI_Abort(hspi);
+
+  /* Restore the single node circular queue */
+  (void)HAL_DMAEx_List_RemoveNode_Tail(hspi->hdmarx->LinkedListQueue);
+  (void)HAL_DMAEx_List_SetCircularMode(hspi->hdmarx->LinkedListQueue);
+  hspi->pStreamNode = NULL;
+
+  return errorcode;
+}
+
+/**
+  * @brief  Return the last filled Rx stream buffer.
+  * @note   This function is expected to be called from HAL_SPI_RxCpltCallback().
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @retval Pointer to the filled buffer, NULL if no Rx stream is ongoing
+  */
+uint8_t *HAL_SPIEx_StreamGetCpltBuffer(const SPI_HandleTypeDef *hspi)
+{
+  const DMA_NodeTypeDef *pnode;
+
+  if (hspi->pStreamNode == NULL)
+  {
+    return NULL;
+  }
+
+  pnode = (hspi->StreamBuffIdx == 0UL) ? hspi->pStreamNode : hspi->hdmarx->LinkedListQueue->Head;
+
+  return (uint8_t *)pnode->LinkRegisters[NODE_CDAR_DEFAULT_OFFSET];
+}
+
+/**
+  * @brief  Replace the last filled Rx stream buffer by a new one for the next round.
+  * @note   This function must be called before the buffer currently filled is complete, typically
+  *         from HAL_SPI_RxCpltCallback(). The new buffer must have the stream buffer size.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @param  pBuffer: pointer to the new buffer.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SPIEx_StreamSetNextBuffer(SPI_HandleTypeDef *hspi, uint8_t *pBuffer)
+{
+  DMA_NodeTypeDef *pnode;
+
+  if ((hspi->pStreamNode == NULL) || (pBuffer == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  pnode = (hspi->StreamBuffIdx == 0UL) ? hspi->pStreamNode : hspi->hdmarx->LinkedListQueue->Head;
+  pnode->LinkRegisters[NODE_CDAR_DEFAULT_OFFSET] = (uint32_t)pBuffer;
+
+  return HAL_OK;
+}
+
+#if defined(USE_HAL_REQUEST) && (USE_HAL_REQUEST == 1U)
+/**
+  * @brief  Start the DMA transfer of an asynchronous request.
+  * @note   Set as the Start function of the request, called by HAL_Request_Submit().
+  * @param  pReq: pointer to the request, its Handle is the SPI handle.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SPIEx_Request_Start(HAL_RequestTypeDef *pReq)
+{
+  SPI_HandleTypeDef *hspi = (SPI_HandleTypeDef *)pReq->Handle;
+  HAL_StatusTypeDef errorcode;
+
+  if (((pReq->pSrc == NULL) && (pReq->pDst == NULL)) || (pReq->Size == 0U) || (pReq->Size > 0xFFFFU))
+  {
+    return HAL_ERROR;
+  }
+
+  /* The end of transfer hook is shared with the transaction queue */
+  if (hspi->TransactionISR != NULL)
+  {
+    return HAL_BUSY;
+  }
+
+  hspi->pRequest       = pReq;
+  hspi->TransactionISR = SPIEx_RequestISR;
+
+  if (pReq->pDst == NULL)
+  {
+    errorcode = HAL_SPI_Transmit_DMA(hspi, pReq->pSrc, (uint16_t)pReq->Size);
+  }
+  else if (pReq->pSrc == NULL)
+  {
+    errorcode = HAL_SPI_Receive_DMA(hspi, pReq->pDst, (uint16_t)pReq->Size);
+  }
+  else
+  {
+    errorcode = HAL_SPI_TransmitReceive_DMA(hspi, pReq->pSrc, pReq->pDst, (uint16_t)pReq->Size);
+  }
+
+  if (errorcode != HAL_OK)
+  {
+    hspi->TransactionISR = NULL;
+    hspi->pRequest       = NULL;
+  }
+
+  return errorcode;
+}
+#endif /* USE_HAL_REQUEST */
+#endif /* HAL_SPI_DMA_ENABLED */
+
+/**
+  * @}
+  */
+
 /**
   * @}
   */
 
+/** @addtogroup SPIEx_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Rx handler of the slave mailbox.
+  * @note   The first byte received while no response is pending is a command, the
+  *         following SlotSize bytes are clocked with its response and discarded.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @retval None
+  */
+static void SPIEx_MailboxRxISR(SPI_HandleTypeDef *hspi)
+{
+  SPI_MailboxTypeDef *pmailbox = hspi->pMailbox;
+  uint32_t command = *((__IO uint8_t *)&hspi->Instance->RXDR);
+
+  if (pmailbox->RxCount != 0UL)
+  {
+    pmailbox->RxCount--;
+  }
+  else
+  {
+    pmailbox->RxCount = pmailbox->SlotSize;
+
+    if (command < pmailbox->SlotNbr)
+    {
+      /* Load the response as far as the Tx FIFO allows, TXP loads the remainder */
+      pmailbox->pTxPtr  = &pmailbox->pSlots[command * pmailbox->SlotSize];
+      pmailbox->TxCount = pmailbox->SlotSize;
+      SPIEx_MailboxTxISR(hspi);
+
+      if (pmailbox->TxCount != 0UL)
+      {
+        __HAL_SPI_ENABLE_IT(hspi, SPI_IT_TXP);
+      }
+    }
+
+    if (pmailbox->CommandCallback != NULL)
+    {
+      pmailbox->CommandCallback(hspi, command);
+    }
+  }
+}
+
+/**
+  * @brief  Tx handler of the slave mailbox.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @retval None
+  */
+static void SPIEx_MailboxTxISR(SPI_HandleTypeDef *hspi)
+{
+  SPI_MailboxTypeDef *pmailbox = hspi->pMailbox;
+
+  while ((pmailbox->TxCount != 0UL) && (__HAL_SPI_GET_FLAG(hspi, SPI_FLAG_TXP)))
+  {
+    *((__IO uint8_t *)&hspi->Instance->TXDR) = *pmailbox->pTxPtr;
+    pmailbox->pTxPtr++;
+    pmailbox->TxCount--;
+  }
+
+  if (pmailbox->TxCount == 0UL)
+  {
+    __HAL_SPI_DISABLE_IT(hspi, SPI_IT_TXP);
+  }
+}
+
+#if defined(HAL_SPI_DMA_ENABLED)
+
+/**
+  * @brief  Start the transfer described by hspi->pTransaction.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef SPIEx_TransactionStart(SPI_HandleTypeDef *hspi)
+{
+  const SPI_TransactionTypeDef *ptransaction = hspi->pTransaction;
+  HAL_StatusTypeDef errorcode;
+
+  /* Apply the clock mode of the addressed device, SPI is disabled between transfers */
+  if (READ_BIT(hspi->Instance->CFG2, SPI_CFG2_CPOL | SPI_CFG2_CPHA) !=
+      (ptransaction->CLKPolarity | ptransaction->CLKPhase))
+  {
+    MODIFY_REG(hspi->Instance->CFG2, SPI_CFG2_CPOL | SPI_CFG2_CPHA,
+               ptransaction->CLKPolarity | ptransaction->CLKPhase);
+  }
+
+  if (ptransaction->CSPort != NULL)
+  {
+    HAL_GPIO_WritePin(ptransaction->CSPort, ptransaction->CSPin, GPIO_PIN_RESET);
+  }
+
+  if (ptransaction->pRxData == NULL)
+  {
+    errorcode = HAL_SPI_Transmit_DMA(hspi, ptransaction->pTxData, ptransaction->Size);
+  }
+  else if (ptransaction->pTxData == NULL)
+  {
+    errorcode = HAL_SPI_Receive_DMA(hspi, ptransaction->pRxData, ptransaction->Size);
+  }
+  else
+  {
+    errorcode = HAL_SPI_TransmitReceive_DMA(hspi, ptransaction->pTxData, ptransaction->pRxData,
+                                            ptransaction->Size);
+  }
+
+  if ((errorcode != HAL_OK) && (ptransaction->CSPort != NULL))
+  {
+    HAL_GPIO_WritePin(ptransaction->CSPort, ptransaction->CSPin, GPIO_PIN_SET);
+  }
+
+  return errorcode;
+}
+
+/**
+  * @brief  Transaction queue handler, called at end of each transfer or on error.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @retval None
+  */
+static void SPIEx_TransactionISR(SPI_HandleTypeDef *hspi)
+{
+  SPI_TransactionTypeDef *ptransaction = hspi->pTransaction;
+  SPI_TransactionTypeDef *pnext = ptransaction->pNext;
+
+  /* Release the chip select of the ended transaction */
+  if (ptransaction->CSPort != NULL)
+  {
+    HAL_GPIO_WritePin(ptransaction->CSPort, ptransaction->CSPin, GPIO_PIN_SET);
+  }
+
+  if (hspi->ErrorCode == HAL_SPI_ERROR_NONE)
+  {
+    if (pnext == NULL)
+    {
+      /* End of the transaction queue, a new queue can be started from the last callback */
+      hspi->TransactionISR = NULL;
+      hspi->pTransaction   = NULL;
+    }
+
+    if (ptransaction->XferCpltCallback != NULL)
+    {
+      ptransaction->XferCpltCallback(hspi, ptransaction);
+    }
+
+    if (pnext == NULL)
+    {
+      return;
+    }
+
+    hspi->pTransaction = pnext;
+    if (SPIEx_TransactionStart(hspi) == HAL_OK)
+    {
+      return;
+    }
+
+    /* Start failure is reported as a queue error */
+    SET_BIT(hspi->ErrorCode, HAL_SPI_ERROR_DMA);
+  }
+
+  /* Stop the queue on the failing transaction */
+  hspi->TransactionISR = NULL;
+
+#if (USE_HAL_SPI_REGISTER_CALLBACKS == 1UL)
+  hspi->ErrorCallback(hspi);
+#else
+  HAL_SPI_ErrorCallback(hspi);
+#endif /* USE_HAL_SPI_REGISTER_CALLBACKS */
+}
+
+#if defined(USE_HAL_REQUEST) && (USE_HAL_REQUEST == 1U)
+/**
+  * @brief  Asynchronous request handler, called at end of transfer or on error.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @retval None
+  */
+static void SPIEx_RequestISR(SPI_HandleTypeDef *hspi)
+{
+  HAL_RequestTypeDef *preq = hspi->pRequest;
+
+  /* The next request of the chain may be started on this SPI */
+  hspi->TransactionISR = NULL;
+  hspi->pRequest       = NULL;
+
+  HAL_Request_Complete(preq, (hspi->ErrorCode == HAL_SPI_ERROR_NONE) ? HAL_OK : HAL_ERROR);
+}
+
+#endif /* USE_HAL_REQUEST */
+/**
+  * @brief  DMA SPI Rx stream buffer complete callback.
+  * @param  hdma: pointer to a DMA_HandleTypeDef structure that contains
+  *               the configuration information for the specified DMA module.
+  * @retval None
+  */
+static void SPIEx_DMAStreamCplt(DMA_HandleTypeDef *hdma)
+{
+  SPI_HandleTypeDef *hspi = (SPI_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+
+  /* The channel has moved to the other buffer */
+  hspi->StreamBuffIdx ^= 1UL;
+
+  if (hspi->State != HAL_SPI_STATE_ABORT)
+  {
+#if (USE_HAL_SPI_REGISTER_CALLBACKS == 1UL)
+    hspi->RxCpltCallback(hspi);
+#else
+    HAL_SPI_RxCpltCallback(hspi);
+#endif /* USE_HAL_SPI_REGISTER_CALLBACKS */
+  }
+}
+#endif /* HAL_SPI_DMA_ENABLED */
+
 /**
   * @}
   */
@@ -62,6 +62,9 @@
        following APIs:
        (++) HAL_SRAM_Read()/HAL_SRAM_Write() for polling read/write access
        (++) HAL_SRAM_Read_DMA()/HAL_SRAM_Write_DMA() for DMA read/write transfer
+       (++) HAL_SRAM_Copy2D_DMA() for DMA copy of a 2D area such as a frame buffer window
+       The DMA bursts can be sized according to the FMC write FIFO and memory bus width
+       using the function HAL_SRAM_ConfigDMABurst().
 
    (#) You can also control the SRAM device by calling the control APIs HAL_SRAM_WriteOperation_Enable()/
        HAL_SRAM_WriteOperation_Disable() to respectively enable/disable the SRAM write operation
@@ -130,6 +133,17 @@
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
+/** @defgroup SRAM_Private_Constants SRAM Private Constants
+  * @{
+  */
+#define SRAM_WRITE_FIFO_SIZE        (64U)     /* FMC write FIFO size in bytes                 */
+#define SRAM_BURST_ACCESS_NBR       (4U)      /* Memory accesses per burst without write FIFO */
+#define SRAM_DMA_BLOCK_SIZE_MAX     (65535U)  /* DMA block size and block offset maximum      */
+#define SRAM_DMA_REPEAT_COUNT_MAX   (2048U)   /* DMA repeated block count maximum             */
+/**
+  * @}
+  */
+
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
@@ -139,6 +153,7 @@
 static void SRAM_DMACplt(DMA_HandleTypeDef *hdma);
 static void SRAM_DMACpltProt(DMA_HandleTypeDef *hdma);
 static void SRAM_DMAError(DMA_HandleTypeDef *hdma);
+static void SRAM_DMACplt2D(DMA_HandleTypeDef *hdma);
 /**
   * @}
   */
@@ -858,6 +873,82 @@ HAL_StatusTypeDef HAL_SRAM_Write_DMA(SRAM_HandleTypeDef *hsram, uint32_t *pAddre
   return status;
 }
 
+/**
+  * @brief  Copies a 2D area (e.g. a frame buffer window) using DMA repeated block transfer.
+  * @note   Each of the Height lines of Width bytes is read at SrcPitch bytes from
+  *         the previous one and written at DstPitch bytes from the previous one.
+  *         Either area can be in the SRAM memory.
+  * @note   The DMA channel must support 2D addressing and be configured in normal
+  *         mode, Width must be a multiple of the DMA source and destination data
+  *         widths.
+  * @param  hsram pointer to a SRAM_HandleTypeDef structure that contains
+  *                the configuration information for SRAM module.
+  * @param  pSrcAddress Pointer to the first byte of the source area
+  * @param  pDstAddress Pointer to the first byte of the destination area
+  * @param  Width Line size in bytes, from 1 to 65535
+  * @param  Height Number of lines, from 1 to 2048
+  * @param  SrcPitch Distance in bytes between two source lines, from Width to Width + 65535
+  * @param  DstPitch Distance in bytes between two destination lines, from Width to Width + 65535
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SRAM_Copy2D_DMA(SRAM_HandleTypeDef *hsram, const uint32_t *pSrcAddress, uint32_t *pDstAddress,
+                                      uint32_t Width, uint32_t Height, uint32_t SrcPitch, uint32_t DstPitch)
+{
+  HAL_StatusTypeDef status;
+  DMA_RepeatBlockConfTypeDef repeatblock;
+
+  if ((Width == 0U) || (Width > SRAM_DMA_BLOCK_SIZE_MAX) || (Height == 0U) || (Height > SRAM_DMA_REPEAT_COUNT_MAX)
+      || (SrcPitch < Width) || ((SrcPitch - Width) > SRAM_DMA_BLOCK_SIZE_MAX)
+      || (DstPitch < Width) || ((DstPitch - Width) > SRAM_DMA_BLOCK_SIZE_MAX))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the SRAM controller state */
+  if (hsram->State == HAL_SRAM_STATE_READY)
+  {
+    /* Process Locked */
+    __HAL_LOCK(hsram);
+
+    /* Update the SRAM controller state */
+    hsram->State = HAL_SRAM_STATE_BUSY;
+
+    /* Configure DMA user callbacks */
+    hsram->hdma->XferCpltCallback = SRAM_DMACplt2D;
+    hsram->hdma->XferErrorCallback = SRAM_DMAError;
+
+    /* Jump to the next line at the end of each block */
+    repeatblock.RepeatCount = Height;
+    repeatblock.SrcAddrOffset = 0;
+    repeatblock.DestAddrOffset = 0;
+    repeatblock.BlkSrcAddrOffset = (int32_t)(SrcPitch - Width);
+    repeatblock.BlkDestAddrOffset = (int32_t)(DstPitch - Width);
+
+    status = HAL_DMAEx_ConfigRepeatBlock(hsram->hdma, &repeatblock);
+
+    if (status == HAL_OK)
+    {
+      /* Enable the DMA Stream */
+      status = HAL_DMA_Start_IT(hsram->hdma, (uint32_t)pSrcAddress, (uint32_t)pDstAddress, Width);
+    }
+
+    if (status != HAL_OK)
+    {
+      /* Change SRAM state */
+      hsram->State = HAL_SRAM_STATE_READY;
+    }
+
+    /* Process unlocked */
+    __HAL_UNLOCK(hsram);
+  }
+  else
+  {
+    status = HAL_ERROR;
+  }
+
+  return status;
+}
+
 #if (USE_HAL_SRAM_REGISTER_CALLBACKS == 1)
 /**
   * @brief  Register a User SRAM Callback
@@ -1113,6 +1204,64 @@ HAL_StatusTypeDef HAL_SRAM_WriteOperation_Disable(SRAM_HandleTypeDef *hsram)
   return HAL_OK;
 }
 
+/**
+  * @brief  Configures the SRAM DMA bursts according to the FMC write FIFO and memory bus width.
+  * @note   The DMA channel is re-initialized with word data widths. When the FMC
+  *         write FIFO is enabled, each burst fills the whole FIFO, otherwise it
+  *         groups four memory accesses.
+  * @note   This function applies to DMA channels configured in normal mode, it
+  *         must be called when no SRAM DMA transfer is ongoing.
+  * @param  hsram pointer to a SRAM_HandleTypeDef structure that contains
+  *                the configuration information for SRAM module.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SRAM_ConfigDMABurst(SRAM_HandleTypeDef *hsram)
+{
+  HAL_StatusTypeDef status;
+  HAL_SRAM_StateTypeDef state = hsram->State;
+  uint32_t burstsize;
+
+  if ((hsram->hdma == NULL) || ((hsram->hdma->Mode & DMA_LINKEDLIST) == DMA_LINKEDLIST))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the SRAM controller state */
+  if ((state == HAL_SRAM_STATE_READY) || (state == HAL_SRAM_STATE_PROTECTED))
+  {
+    /* Process Locked */
+    __HAL_LOCK(hsram);
+
+    if (hsram->Init.WriteFifo == FMC_WRITE_FIFO_ENABLE)
+    {
+      /* One burst fills the write FIFO */
+      burstsize = SRAM_WRITE_FIFO_SIZE;
+    }
+    else
+    {
+      /* One burst groups several memory accesses */
+      burstsize = SRAM_BURST_ACCESS_NBR * (1UL << (hsram->Init.MemoryDataWidth >> 4U));
+    }
+
+    /* Set the burst length in words */
+    hsram->hdma->Init.SrcDataWidth = DMA_SRC_DATAWIDTH_WORD;
+    hsram->hdma->Init.DestDataWidth = DMA_DEST_DATAWIDTH_WORD;
+    hsram->hdma->Init.SrcBurstLength = (burstsize > 4U) ? (burstsize / 4U) : 1U;
+    hsram->hdma->Init.DestBurstLength = hsram->hdma->Init.SrcBurstLength;
+
+    status = HAL_DMA_Init(hsram->hdma);
+
+    /* Process unlocked */
+    __HAL_UNLOCK(hsram);
+  }
+  else
+  {
+    status = HAL_ERROR;
+  }
+
+  return status;
+}
+
 /**
   * @}
   */
@@ -1224,6 +1373,22 @@ static void SRAM_DMAError(DMA_HandleTypeDef *hdma)
 #endif /* USE_HAL_SRAM_REGISTER_CALLBACKS */
 }
 
+/**
+  * @brief  DMA SRAM 2D copy complete callback.
+  * @param  hdma : DMA handle
+  * @retval None
+  */
+static void SRAM_DMACplt2D(DMA_HandleTypeDef *hdma)
+{
+  DMA_RepeatBlockConfTypeDef repeatblock = {0};
+
+  /* Restore the single block transfer for the next linear transfers */
+  repeatblock.RepeatCount = 1U;
+  (void)HAL_DMAEx_ConfigRepeatBlock(hdma, &repeatblock);
+
+  SRAM_DMACplt(hdma);
+}
+
 /**
   * @}
   */
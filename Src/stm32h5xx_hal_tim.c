@@ -298,6 +298,10 @@ HAL_StatusTypeDef HAL_TIM_Base_Init(TIM_HandleTypeDef *htim)
     /* Allocate lock resource and initialize it */
     htim->Lock = HAL_UNLOCKED;
 
+    /* No DMA stream running */
+    htim->pPWMStream = NULL;
+    htim->pICStream  = NULL;
+
 #if (USE_HAL_TIM_REGISTER_CALLBACKS == 1)
     /* Reset interrupt callbacks to legacy weak callbacks */
     TIM_ResetCallback(htim);
@@ -682,6 +686,10 @@ HAL_StatusTypeDef HAL_TIM_OC_Init(TIM_HandleTypeDef *htim)
     /* Allocate lock resource and initialize it */
     htim->Lock = HAL_UNLOCKED;
 
+    /* No DMA stream running */
+    htim->pPWMStream = NULL;
+    htim->pICStream  = NULL;
+
 #if (USE_HAL_TIM_REGISTER_CALLBACKS == 1)
     /* Reset interrupt callbacks to legacy weak callbacks */
     TIM_ResetCallback(htim);
@@ -1351,6 +1359,10 @@ HAL_StatusTypeDef HAL_TIM_PWM_Init(TIM_HandleTypeDef *htim)
     /* Allocate lock resource and initialize it */
     htim->Lock = HAL_UNLOCKED;
 
+    /* No DMA stream running */
+    htim->pPWMStream = NULL;
+    htim->pICStream  = NULL;
+
 #if (USE_HAL_TIM_REGISTER_CALLBACKS == 1)
     /* Reset interrupt callbacks to legacy weak callbacks */
     TIM_ResetCallback(htim);
@@ -2019,6 +2031,10 @@ HAL_StatusTypeDef HAL_TIM_IC_Init(TIM_HandleTypeDef *htim)
     /* Allocate lock resource and initialize it */
     htim->Lock = HAL_UNLOCKED;
 
+    /* No DMA stream running */
+    htim->pPWMStream = NULL;
+    htim->pICStream  = NULL;
+
 #if (USE_HAL_TIM_REGISTER_CALLBACKS == 1)
     /* Reset interrupt callbacks to legacy weak callbacks */
     TIM_ResetCallback(htim);
@@ -2669,6 +2685,10 @@ HAL_StatusTypeDef HAL_TIM_OnePulse_Init(TIM_HandleTypeDef *htim, uint32_t OnePul
     /* Allocate lock resource and initialize it */
     htim->Lock = HAL_UNLOCKED;
 
+    /* No DMA stream running */
+    htim->pPWMStream = NULL;
+    htim->pICStream  = NULL;
+
 #if (USE_HAL_TIM_REGISTER_CALLBACKS == 1)
     /* Reset interrupt callbacks to legacy weak callbacks */
     TIM_ResetCallback(htim);
@@ -3072,6 +3092,10 @@ HAL_StatusTypeDef HAL_TIM_Encoder_Init(TIM_HandleTypeDef *htim, const TIM_Encode
     /* Allocate lock resource and initialize it */
     htim->Lock = HAL_UNLOCKED;
 
+    /* No DMA stream running */
+    htim->pPWMStream = NULL;
+    htim->pICStream  = NULL;
+
 #if (USE_HAL_TIM_REGISTER_CALLBACKS == 1)
     /* Reset interrupt callbacks to legacy weak callbacks */
     TIM_ResetCallback(htim);
@@ -3848,6 +3872,8 @@ void HAL_TIM_IRQHandler(TIM_HandleTypeDef *htim)
   uint32_t itsource = htim->Instance->DIER;
   uint32_t itflag   = htim->Instance->SR;
 
+  HAL_TRACE_ENTER(HAL_TRACE_ID_TIM_IRQ, htim);
+
   /* Capture compare 1 event */
   if ((itflag & (TIM_FLAG_CC1)) == (TIM_FLAG_CC1))
   {
@@ -3977,6 +4003,11 @@ void HAL_TIM_IRQHandler(TIM_HandleTypeDef *htim)
     if ((itsource & (TIM_IT_UPDATE)) == (TIM_IT_UPDATE))
     {
       __HAL_TIM_CLEAR_FLAG(htim, TIM_FLAG_UPDATE);
+      if (htim->pICStream != NULL)
+      {
+        /* Mark the counter overflow in the input capture stream */
+        TIMEx_ICStreamOverflow(htim);
+      }
 #if (USE_HAL_TIM_REGISTER_CALLBACKS == 1)
       htim->PeriodElapsedCallback(htim);
 #else
@@ -4089,6 +4120,8 @@ void HAL_TIM_IRQHandler(TIM_HandleTypeDef *htim)
 #endif /* USE_HAL_TIM_REGISTER_CALLBACKS */
     }
   }
+
+  HAL_TRACE_EXIT(HAL_TRACE_ID_TIM_IRQ, htim);
 }
 
 /**
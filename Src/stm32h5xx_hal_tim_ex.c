@@ -41,6 +41,10 @@
         positioning purposes
     (#) In case of Pulse on compare, configure pulse length and delay
     (#) Encoder index configuration
+    (#) PWM sequence streaming with DMA burst
+    (#) Input capture streaming with 64-bit timestamps
+    (#) Encoder speed estimation
+    (#) Synchronized timer groups
 
             ##### How to use this driver #####
   ==============================================================================
@@ -80,6 +84,8 @@
            (++) Complementary One-pulse mode output : HAL_TIMEx_OnePulseN_Start(), HAL_TIMEx_OnePulseN_Start_IT()
            (++) Hall Sensor output : HAL_TIMEx_HallSensor_Start(), HAL_TIMEx_HallSensor_Start_DMA(),
                 HAL_TIMEx_HallSensor_Start_IT().
+           (++) PWM sequence streaming : HAL_TIMEx_PWMStream_Start(), see the Extended DMA streaming
+                functions section.
 
   @endverbatim
   ******************************************************************************
@@ -118,6 +124,11 @@
 static void TIM_DMADelayPulseNCplt(DMA_HandleTypeDef *hdma);
 static void TIM_DMAErrorCCxN(DMA_HandleTypeDef *hdma);
 static void TIM_CCxNChannelCmd(TIM_TypeDef *TIMx, uint32_t Channel, uint32_t ChannelNState);
+static void TIMEx_PWMStreamUpdate(TIM_HandleTypeDef *htim, uint32_t Half);
+static void TIMEx_DMAPWMStreamCplt(DMA_HandleTypeDef *hdma);
+static void TIMEx_DMAPWMStreamHalfCplt(DMA_HandleTypeDef *hdma);
+static uint32_t TIMEx_ICStreamPosition(const TIM_HandleTypeDef *htim);
+static uint32_t TIMEx_CounterDelta(uint32_t Current, uint32_t Previous, uint32_t AutoReload);
 
 /* Exported functions --------------------------------------------------------*/
 /** @defgroup TIMEx_Exported_Functions TIM Extended Exported Functions
@@ -179,6 +190,10 @@ HAL_StatusTypeDef HAL_TIMEx_HallSensor_Init(TIM_HandleTypeDef *htim, const TIM_H
     /* Allocate lock resource and initialize it */
     htim->Lock = HAL_UNLOCKED;
 
+    /* No DMA stream running */
+    htim->pPWMStream = NULL;
+    htim->pICStream  = NULL;
+
 #if (USE_HAL_TIM_REGISTER_CALLBACKS == 1)
     /* Reset interrupt callbacks to legacy week callbacks */
     TIM_ResetCallback(htim);
@@ -3361,53 +3376,1098 @@ HAL_TIM_ChannelStateTypeDef HAL_TIMEx_GetChannelNState(const TIM_HandleTypeDef *
   * @}
   */
 
+/** @defgroup TIMEx_Exported_Functions_Group8 Extended DMA streaming functions
+  * @brief    Extended DMA streaming functions
+  *
+@verbatim
+  ==============================================================================
+                    ##### Extended DMA streaming functions #####
+  ==============================================================================
+  [..]
+    This section provides functions allowing to:
+      (+) Stream a PWM sequence on up to 4 channels with a DMA burst at each update event
+      (+) Stream input captures in a DMA ring and read them as 64-bit timestamps
+      (+) Estimate the speed of an encoder with the edges timestamps of a time base (M/T method)
+
+  [..] PWM sequence streaming
+    (#) Configure the timer with HAL_TIM_PWM_Init() and the channels with HAL_TIM_PWM_ConfigChannel(),
+        the period giving the frame rate (e.g. the bit period of a DShot or WS2812 protocol).
+    (#) Link to the update DMA handle (TIM_DMA_ID_UPDATE) a DMA channel in linked-list circular mode,
+        with a queue of a single node transferring words, incrementing the source and not the destination.
+    (#) Fill a TIM_PWMStreamTypeDef structure and both halves of its buffer, each frame holding the
+        compare values of the NbChannels consecutive channels from FirstChannel, then call
+        HAL_TIMEx_PWMStream_Start(). At each update event, the DMA burst loads the next frame in the
+        preloaded compare registers.
+    (#) When a half of the buffer has been played, pRefill of the structure points to it and
+        HAL_TIM_PeriodElapsedHalfCpltCallback() (first half) or HAL_TIM_PeriodElapsedCallback()
+        (second half) is called. Write the next HalfFrames frames at pRefill, or idle frames at the
+        end of a sequence, then call HAL_TIMEx_PWMStream_Refilled().
+    (#) A half not refilled before the end of the other half is played again and counted in Underruns.
+    (#) Stop the stream with HAL_TIMEx_PWMStream_Stop().
+
+  [..] Input capture streaming
+    (#) Configure the timer with HAL_TIM_IC_Init() and the channel with HAL_TIM_IC_ConfigChannel(),
+        then enable the timer interrupt in the NVIC and call HAL_TIM_IRQHandler() from the TIM IRQ handler.
+    (#) Link to the capture DMA handle of the channel (TIM_DMA_ID_CC1 to TIM_DMA_ID_CC4) a DMA channel
+        in linked-list circular mode, with a queue of a single node transferring words, incrementing the
+        destination and not the source.
+    (#) Set pBuffer, Size and Channel of a TIM_ICStreamTypeDef structure and call
+        HAL_TIMEx_ICStream_Start(). The counter is restarted from 0 and each update event (counter
+        overflow) is recorded with the number of captures received before it.
+    (#) Call HAL_TIMEx_ICStream_Read() to get the new captures as 64-bit timestamps in counter clock
+        periods: raw value + overflows x (auto-reload + 1).
+    (#) Use HAL_TIMEx_ICStream_DecodePeriods() to get the periods between consecutive timestamps (rising
+        edges capture), or HAL_TIMEx_ICStream_DecodePWM() to get the periods and pulses from alternated
+        edges (both edges capture, first timestamp on a rising edge).
+    (#) Stop the stream with HAL_TIMEx_ICStream_Stop().
+    (@) The ring must hold all the captures of a counter period and HAL_TIMEx_ICStream_Read() must be
+        called before Size captures and TIM_ICSTREAM_MARKS counter overflows, otherwise the overflows
+        are counted in MarkOverruns. A capture taken between an overflow and its interrupt is placed after
+        the overflow when its raw value is lower than the previous one.
+
+  [..] Encoder speed estimation
+    (#) Configure the encoder timer with HAL_TIM_Encoder_Init(), optionally with the index reset
+        (HAL_TIMEx_ConfigEncoderIndex(), auto-reload set to the counts per revolution - 1), and output the
+        encoder clock on TRGO with HAL_TIMEx_MasterConfigSynchronization() (TIM_TRGO_ENCODER_CLK).
+    (#) Configure a free running time base (preferably a 32-bit timer) with HAL_TIM_IC_Init(), its trigger
+        input on the encoder timer TRGO (ITRx) and a channel in input capture on TRC
+        (TIM_ICSELECTION_TRC). At each encoder edge, the channel captures the time base counter.
+    (#) Link to the capture DMA handle of the time base channel a DMA channel in linked-list circular mode
+        with a queue of a single word node, incrementing neither the source nor the destination.
+        At each captured edge, the DMA copies the encoder counter in EdgeCount.
+    (#) Set htimCapture, Channel, Scale and Timeout of a TIM_EncoderSpeedTypeDef structure and call
+        HAL_TIMEx_EncoderSpeed_Start() with the encoder handle.
+    (#) Call HAL_TIMEx_EncoderSpeed_Update() from the control loop: Speed is the encoder counts between
+        the last edges of two consecutive calls divided by their exact time (M/T method), giving a high
+        resolution at high speed. Without edge since the previous call, the speed is bounded by the time
+        elapsed since the last edge and set to 0 after Timeout, giving a low latency at low speed.
+    (#) Stop with HAL_TIMEx_EncoderSpeed_Stop().
+    (@) The time base period must be longer than Timeout and the encoder counter must not move by more
+        than half its range between two updates. The capture prescaler (ICPrescaler) can be used to
+        lower the DMA requests rate at high speed.
+
+@endverbatim
+  * @{
+  */
+
 /**
-  * @}
+  * @brief  Start streaming a PWM sequence with a DMA burst of the channels compare values.
+  * @param  htim TIM handle
+  * @param  pStream PWM stream structure, with a buffer of two halves filled with the first frames
+  * @retval HAL status
   */
+HAL_StatusTypeDef HAL_TIMEx_PWMStream_Start(TIM_HandleTypeDef *htim, TIM_PWMStreamTypeDef *pStream)
+{
+  DMA_HandleTypeDef *hdma = htim->hdma[TIM_DMA_ID_UPDATE];
+  uint32_t first_index;
+  uint32_t channel;
+  uint32_t length;
+  uint32_t tmpsmcr;
+  uint32_t i;
 
-/* Private functions ---------------------------------------------------------*/
-/** @defgroup TIMEx_Private_Functions TIM Extended Private Functions
-  * @{
+  /* Check the parameters */
+  assert_param(IS_TIM_DMABURST_INSTANCE(htim->Instance));
+
+  if ((pStream == NULL) || (pStream->pBuffer == NULL) || (pStream->HalfFrames == 0U) ||
+      (pStream->NbChannels == 0U) || ((pStream->FirstChannel & 0x3U) != 0U) ||
+      (((pStream->FirstChannel >> 2U) + pStream->NbChannels) > 4U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* The two halves are played continuously by a circular linked-list queue */
+  if ((hdma == NULL) || (hdma->Mode != DMA_LINKEDLIST_CIRCULAR))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Size of the buffer in bytes */
+  length = 2U * pStream->HalfFrames * pStream->NbChannels * 4U;
+  if (length > DMA_CBR1_BNDT)
+  {
+    return HAL_ERROR;
+  }
+
+  if (htim->DMABurstState != HAL_DMA_BURST_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  first_index = pStream->FirstChannel >> 2U;
+  for (i = 0U; i < pStream->NbChannels; i++)
+  {
+    channel = (first_index + i) << 2U;
+    assert_param(IS_TIM_CCX_INSTANCE(htim->Instance, channel));
+    if (TIM_CHANNEL_STATE_GET(htim, channel) != HAL_TIM_CHANNEL_STATE_READY)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  /* Set the DMA burst and channels state */
+  htim->DMABurstState = HAL_DMA_BURST_STATE_BUSY;
+  for (i = 0U; i < pStream->NbChannels; i++)
+  {
+    TIM_CHANNEL_STATE_SET(htim, ((first_index + i) << 2U), HAL_TIM_CHANNEL_STATE_BUSY);
+  }
+
+  pStream->pRefill       = NULL;
+  pStream->HalfIndex     = 0U;
+  pStream->Underruns     = 0U;
+  pStream->RefillPending = 0U;
+  htim->pPWMStream       = pStream;
+
+  /* Set the DMA stream callbacks */
+  hdma->XferCpltCallback     = TIMEx_DMAPWMStreamCplt;
+  hdma->XferHalfCpltCallback = TIMEx_DMAPWMStreamHalfCplt;
+
+  /* Set the DMA error callback */
+  hdma->XferErrorCallback = TIM_DMAError;
+
+  /* Enable the DMA channel */
+  if (TIM_DMA_Start_IT(hdma, (uint32_t)pStream->pBuffer, (uint32_t)&htim->Instance->DMAR, length) != HAL_OK)
+  {
+    for (i = 0U; i < pStream->NbChannels; i++)
+    {
+      TIM_CHANNEL_STATE_SET(htim, ((first_index + i) << 2U), HAL_TIM_CHANNEL_STATE_READY);
+    }
+    htim->DMABurstState = HAL_DMA_BURST_STATE_READY;
+    htim->pPWMStream    = NULL;
+
+    /* Return error status */
+    return HAL_ERROR;
+  }
+
+  /* Burst of the NbChannels compare registers from CCRx on each update event */
+  htim->Instance->DCR = ((TIM_DMABASE_CCR1 + first_index) |
+                         ((pStream->NbChannels - 1U) << TIM_DCR_DBL_Pos) | TIM_DCR_DBSS_0);
+
+  /* Enable the TIM Update DMA request */
+  __HAL_TIM_ENABLE_DMA(htim, TIM_DMA_UPDATE);
+
+  /* Enable the Capture compare channels */
+  for (i = 0U; i < pStream->NbChannels; i++)
+  {
+    TIM_CCxChannelCmd(htim->Instance, ((first_index + i) << 2U), TIM_CCx_ENABLE);
+  }
+
+  if (IS_TIM_BREAK_INSTANCE(htim->Instance) != RESET)
+  {
+    /* Enable the main output */
+    __HAL_TIM_MOE_ENABLE(htim);
+  }
+
+  /* Enable the Peripheral, except in trigger mode where enable is automatically done with trigger */
+  if (IS_TIM_SLAVE_INSTANCE(htim->Instance))
+  {
+    tmpsmcr = htim->Instance->SMCR & TIM_SMCR_SMS;
+    if (!IS_TIM_SLAVEMODE_TRIGGER_ENABLED(tmpsmcr))
+    {
+      __HAL_TIM_ENABLE(htim);
+    }
+  }
+  else
+  {
+    __HAL_TIM_ENABLE(htim);
+  }
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the PWM sequence streaming.
+  * @param  htim TIM handle
+  * @retval HAL status
   */
+HAL_StatusTypeDef HAL_TIMEx_PWMStream_Stop(TIM_HandleTypeDef *htim)
+{
+  const TIM_PWMStreamTypeDef *pstream = htim->pPWMStream;
+  uint32_t first_index;
+  uint32_t i;
+
+  if (pstream == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Disable the TIM Update DMA request */
+  __HAL_TIM_DISABLE_DMA(htim, TIM_DMA_UPDATE);
+
+  /* Abort the DMA transfer */
+  (void)HAL_DMA_Abort(htim->hdma[TIM_DMA_ID_UPDATE]);
+
+  /* Disable the Capture compare channels */
+  first_index = pstream->FirstChannel >> 2U;
+  for (i = 0U; i < pstream->NbChannels; i++)
+  {
+    TIM_CCxChannelCmd(htim->Instance, ((first_index + i) << 2U), TIM_CCx_DISABLE);
+    TIM_CHANNEL_STATE_SET(htim, ((first_index + i) << 2U), HAL_TIM_CHANNEL_STATE_READY);
+  }
+
+  if (IS_TIM_BREAK_INSTANCE(htim->Instance) != RESET)
+  {
+    /* Disable the Main Output */
+    __HAL_TIM_MOE_DISABLE(htim);
+  }
+
+  /* Disable the Peripheral */
+  __HAL_TIM_DISABLE(htim);
+
+  htim->DMABurstState = HAL_DMA_BURST_STATE_READY;
+  htim->pPWMStream    = NULL;
+
+  /* Return function status */
+  return HAL_OK;
+}
 
 /**
-  * @brief  TIM DMA Commutation callback.
-  * @param  hdma pointer to DMA handle.
-  * @retval None
+  * @brief  Notify that the released half buffer of the PWM stream has been refilled.
+  * @param  htim TIM handle
+  * @retval HAL status
   */
-void TIMEx_DMACommutationCplt(DMA_HandleTypeDef *hdma)
+HAL_StatusTypeDef HAL_TIMEx_PWMStream_Refilled(TIM_HandleTypeDef *htim)
 {
-  TIM_HandleTypeDef *htim = (TIM_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+  if (htim->pPWMStream == NULL)
+  {
+    return HAL_ERROR;
+  }
 
-  /* Change the htim state */
-  htim->State = HAL_TIM_STATE_READY;
+  htim->pPWMStream->RefillPending = 0U;
 
-#if (USE_HAL_TIM_REGISTER_CALLBACKS == 1)
-  htim->CommutationCallback(htim);
-#else
-  HAL_TIMEx_CommutCallback(htim);
-#endif /* USE_HAL_TIM_REGISTER_CALLBACKS */
+  return HAL_OK;
 }
 
 /**
-  * @brief  TIM DMA Commutation half complete callback.
-  * @param  hdma pointer to DMA handle.
-  * @retval None
+  * @brief  Start streaming the input captures of a channel in a DMA ring.
+  * @param  htim TIM handle
+  * @param  pStream Input capture stream structure, with pBuffer, Size and Channel set
+  * @retval HAL status
   */
-void TIMEx_DMACommutationHalfCplt(DMA_HandleTypeDef *hdma)
+HAL_StatusTypeDef HAL_TIMEx_ICStream_Start(TIM_HandleTypeDef *htim, TIM_ICStreamTypeDef *pStream)
 {
-  TIM_HandleTypeDef *htim = (TIM_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+  DMA_HandleTypeDef *hdma;
+  uint32_t tmpsmcr;
 
-  /* Change the htim state */
-  htim->State = HAL_TIM_STATE_READY;
+  if ((pStream == NULL) || (pStream->pBuffer == NULL) || (pStream->Size == 0U) ||
+      ((pStream->Size * 4U) > DMA_CBR1_BNDT) || (pStream->Channel > TIM_CHANNEL_4) ||
+      ((pStream->Channel & 0x3U) != 0U))
+  {
+    return HAL_ERROR;
+  }
 
-#if (USE_HAL_TIM_REGISTER_CALLBACKS == 1)
-  htim->CommutationHalfCpltCallback(htim);
-#else
-  HAL_TIMEx_CommutHalfCpltCallback(htim);
-#endif /* USE_HAL_TIM_REGISTER_CALLBACKS */
+  /* Check the parameters */
+  assert_param(IS_TIM_CCX_INSTANCE(htim->Instance, pStream->Channel));
+  assert_param(IS_TIM_DMA_CC_INSTANCE(htim->Instance));
+
+  /* The ring is written continuously by a circular linked-list queue */
+  hdma = htim->hdma[TIM_DMA_ID_CC1 + (pStream->Channel >> 2U)];
+  if ((hdma == NULL) || (hdma->Mode != DMA_LINKEDLIST_CIRCULAR))
+  {
+    return HAL_ERROR;
+  }
+
+  if ((htim->pICStream != NULL) ||
+      (TIM_CHANNEL_STATE_GET(htim, pStream->Channel) != HAL_TIM_CHANNEL_STATE_READY))
+  {
+    return HAL_BUSY;
+  }
+
+  /* Set the TIM channel state */
+  TIM_CHANNEL_STATE_SET(htim, pStream->Channel, HAL_TIM_CHANNEL_STATE_BUSY);
+
+  pStream->ReadIndex    = 0U;
+  pStream->ReadCount    = 0U;
+  pStream->LastCapture  = 0U;
+  pStream->Epoch        = 0U;
+  pStream->WriteIndex   = 0U;
+  pStream->WriteCount   = 0U;
+  pStream->MarkUsed     = 0U;
+  pStream->MarkWr       = 0U;
+  pStream->MarkRd       = 0U;
+  pStream->MarkOverruns = 0U;
+
+  /* No transfer callback, the ring is read by HAL_TIMEx_ICStream_Read() */
+  hdma->XferCpltCallback     = NULL;
+  hdma->XferHalfCpltCallback = NULL;
+
+  /* Set the DMA error callback */
+  hdma->XferErrorCallback = TIM_DMAError;
+
+  /* Enable the DMA channel, CCR1 to CCR4 being consecutive registers */
+  if (TIM_DMA_Start_IT(hdma, ((uint32_t)&htim->Instance->CCR1) + pStream->Channel, (uint32_t)pStream->pBuffer,
+                       pStream->Size * 4U) != HAL_OK)
+  {
+    TIM_CHANNEL_STATE_SET(htim, pStream->Channel, HAL_TIM_CHANNEL_STATE_READY);
+
+    /* Return error status */
+    return HAL_ERROR;
+  }
+
+  htim->pICStream = pStream;
+
+  /* Timestamps start with the counter */
+  __HAL_TIM_SET_COUNTER(htim, 0U);
+  __HAL_TIM_CLEAR_IT(htim, TIM_IT_UPDATE);
+
+  /* Enable the TIM Update interrupt and the Capture compare DMA request */
+  __HAL_TIM_ENABLE_IT(htim, TIM_IT_UPDATE);
+  __HAL_TIM_ENABLE_DMA(htim, (TIM_DMA_CC1 << (pStream->Channel >> 2U)));
+
+  /* Enable the Input Capture channel */
+  TIM_CCxChannelCmd(htim->Instance, pStream->Channel, TIM_CCx_ENABLE);
+
+  /* Enable the Peripheral, except in trigger mode where enable is automatically done with trigger */
+  if (IS_TIM_SLAVE_INSTANCE(htim->Instance))
+  {
+    tmpsmcr = htim->Instance->SMCR & TIM_SMCR_SMS;
+    if (!IS_TIM_SLAVEMODE_TRIGGER_ENABLED(tmpsmcr))
+    {
+      __HAL_TIM_ENABLE(htim);
+    }
+  }
+  else
+  {
+    __HAL_TIM_ENABLE(htim);
+  }
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the input capture streaming.
+  * @param  htim TIM handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_TIMEx_ICStream_Stop(TIM_HandleTypeDef *htim)
+{
+  const TIM_ICStreamTypeDef *pstream = htim->pICStream;
+
+  if (pstream == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Disable the Capture compare DMA request and the TIM Update interrupt */
+  __HAL_TIM_DISABLE_DMA(htim, (TIM_DMA_CC1 << (pstream->Channel >> 2U)));
+  __HAL_TIM_DISABLE_IT(htim, TIM_IT_UPDATE);
+
+  /* Abort the DMA transfer */
+  (void)HAL_DMA_Abort(htim->hdma[TIM_DMA_ID_CC1 + (pstream->Channel >> 2U)]);
+
+  /* Disable the Input Capture channel */
+  TIM_CCxChannelCmd(htim->Instance, pstream->Channel, TIM_CCx_DISABLE);
+
+  /* Disable the Peripheral */
+  __HAL_TIM_DISABLE(htim);
+
+  /* Set the TIM channel state */
+  TIM_CHANNEL_STATE_SET(htim, pstream->Channel, HAL_TIM_CHANNEL_STATE_READY);
+  htim->pICStream = NULL;
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Read the new captures of the input capture stream as 64-bit timestamps.
+  * @param  htim TIM handle
+  * @param  pTimestamps Timestamps buffer, in counter clock periods since the stream start
+  * @param  MaxCount Size of the timestamps buffer
+  * @param  pCount Number of timestamps read
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_TIMEx_ICStream_Read(TIM_HandleTypeDef *htim, uint64_t *pTimestamps, uint32_t MaxCount,
+                                          uint32_t *pCount)
+{
+  TIM_ICStreamTypeDef *pstream = htim->pICStream;
+  uint64_t period;
+  uint32_t available;
+  uint32_t capture;
+  uint32_t mark;
+  uint32_t count = 0U;
+
+  if ((pstream == NULL) || (pTimestamps == NULL) || (pCount == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  period = (uint64_t)__HAL_TIM_GET_AUTORELOAD(htim) + 1U;
+  available = (TIMEx_ICStreamPosition(htim) + pstream->Size - pstream->ReadIndex) % pstream->Size;
+  if (available > MaxCount)
+  {
+    available = MaxCount;
+  }
+
+  while (count < available)
+  {
+    capture = pstream->pBuffer[pstream->ReadIndex];
+
+    /* Account the counter overflows that occurred before this capture */
+    while (pstream->MarkRd != pstream->MarkWr)
+    {
+      mark = pstream->MarkRd % TIM_ICSTREAM_MARKS;
+
+      if ((int32_t)(pstream->ReadCount - pstream->MarkCount[mark]) >= 0)
+      {
+        /* Capture received after the overflow interrupt */
+        pstream->Epoch += pstream->MarkWraps[mark] - pstream->MarkUsed;
+        pstream->MarkUsed = 0U;
+        pstream->MarkRd++;
+      }
+      else
+      {
+        if ((capture < pstream->LastCapture) && (pstream->MarkUsed < pstream->MarkWraps[mark]))
+        {
+          /* Capture taken between the overflow and its interrupt */
+          pstream->Epoch++;
+          pstream->MarkUsed++;
+        }
+        break;
+      }
+    }
+
+    pTimestamps[count] = ((uint64_t)pstream->Epoch * period) + capture;
+    pstream->LastCapture = capture;
+    pstream->ReadCount++;
+    pstream->ReadIndex++;
+    if (pstream->ReadIndex == pstream->Size)
+    {
+      pstream->ReadIndex = 0U;
+    }
+    count++;
+  }
+
+  *pCount = count;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Compute the periods between consecutive timestamps of an input capture stream.
+  * @param  pTimestamps Timestamps read by HAL_TIMEx_ICStream_Read()
+  * @param  Count Number of timestamps
+  * @param  pPeriods Periods buffer of at least Count - 1 elements, saturated to 0xFFFFFFFF
+  * @retval Number of periods computed
+  */
+uint32_t HAL_TIMEx_ICStream_DecodePeriods(const uint64_t *pTimestamps, uint32_t Count, uint32_t *pPeriods)
+{
+  uint64_t delta;
+  uint32_t i;
+
+  if ((pTimestamps == NULL) || (pPeriods == NULL) || (Count < 2U))
+  {
+    return 0U;
+  }
+
+  for (i = 0U; i < (Count - 1U); i++)
+  {
+    delta = pTimestamps[i + 1U] - pTimestamps[i];
+    pPeriods[i] = (delta > 0xFFFFFFFFU) ? 0xFFFFFFFFU : (uint32_t)delta;
+  }
+
+  return Count - 1U;
 }
 
+/**
+  * @brief  Compute the periods and pulses from the alternated edges timestamps of an input capture stream.
+  * @param  pTimestamps Timestamps read by HAL_TIMEx_ICStream_Read(), the first one on a rising edge
+  * @param  Count Number of timestamps
+  * @param  pPeriods Periods buffer of at least (Count - 1) / 2 elements, saturated to 0xFFFFFFFF
+  * @param  pPulses Pulses (high level duration) buffer of at least (Count - 1) / 2 elements
+  * @retval Number of periods and pulses computed
+  */
+uint32_t HAL_TIMEx_ICStream_DecodePWM(const uint64_t *pTimestamps, uint32_t Count, uint32_t *pPeriods,
+                                      uint32_t *pPulses)
+{
+  uint64_t delta;
+  uint32_t i;
+  uint32_t n = 0U;
+
+  if ((pTimestamps == NULL) || (pPeriods == NULL) || (pPulses == NULL))
+  {
+    return 0U;
+  }
+
+  for (i = 0U; (i + 2U) < Count; i += 2U)
+  {
+    delta = pTimestamps[i + 2U] - pTimestamps[i];
+    pPeriods[n] = (delta > 0xFFFFFFFFU) ? 0xFFFFFFFFU : (uint32_t)delta;
+    delta = pTimestamps[i + 1U] - pTimestamps[i];
+    pPulses[n] = (delta > 0xFFFFFFFFU) ? 0xFFFFFFFFU : (uint32_t)delta;
+    n++;
+  }
+
+  return n;
+}
+
+/**
+  * @brief  Start the encoder speed estimation.
+  * @param  htim Encoder TIM handle
+  * @param  pSpeed Encoder speed structure, with htimCapture, Channel, Scale and Timeout set
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_TIMEx_EncoderSpeed_Start(TIM_HandleTypeDef *htim, TIM_EncoderSpeedTypeDef *pSpeed)
+{
+  TIM_HandleTypeDef *htimcapture;
+  DMA_HandleTypeDef *hdma;
+
+  if ((pSpeed == NULL) || (pSpeed->htimCapture == NULL) || (pSpeed->Scale == 0U) ||
+      (pSpeed->Channel > TIM_CHANNEL_4) || ((pSpeed->Channel & 0x3U) != 0U))
+  {
+    return HAL_ERROR;
+  }
+  htimcapture = pSpeed->htimCapture;
+
+  /* Check the parameters */
+  assert_param(IS_TIM_ENCODER_INTERFACE_INSTANCE(htim->Instance));
+  assert_param(IS_TIM_CCX_INSTANCE(htimcapture->Instance, pSpeed->Channel));
+  assert_param(IS_TIM_DMA_CC_INSTANCE(htimcapture->Instance));
+
+  /* The encoder counter is copied at each edge by a circular linked-list queue */
+  hdma = htimcapture->hdma[TIM_DMA_ID_CC1 + (pSpeed->Channel >> 2U)];
+  if ((hdma == NULL) || (hdma->Mode != DMA_LINKEDLIST_CIRCULAR))
+  {
+    return HAL_ERROR;
+  }
+
+  if (TIM_CHANNEL_STATE_GET(htimcapture, pSpeed->Channel) != HAL_TIM_CHANNEL_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  /* Start the encoder interface */
+  if (HAL_TIM_Encoder_Start(htim, TIM_CHANNEL_ALL) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Set the time base channel state */
+  TIM_CHANNEL_STATE_SET(htimcapture, pSpeed->Channel, HAL_TIM_CHANNEL_STATE_BUSY);
+
+  pSpeed->Speed     = 0;
+  pSpeed->Position  = 0;
+  pSpeed->LastCount = __HAL_TIM_GET_COUNTER(htim);
+  pSpeed->LastStamp = __HAL_TIM_GET_COUNTER(htimcapture);
+  pSpeed->EdgeCount = pSpeed->LastCount;
+
+  /* No transfer callback, the copy is read by HAL_TIMEx_EncoderSpeed_Update() */
+  hdma->XferCpltCallback     = NULL;
+  hdma->XferHalfCpltCallback = NULL;
+
+  /* Set the DMA error callback */
+  hdma->XferErrorCallback = TIM_DMAError;
+
+  /* Enable the DMA channel */
+  if (TIM_DMA_Start_IT(hdma, (uint32_t)&htim->Instance->CNT, (uint32_t)&pSpeed->EdgeCount, 4U) != HAL_OK)
+  {
+    TIM_CHANNEL_STATE_SET(htimcapture, pSpeed->Channel, HAL_TIM_CHANNEL_STATE_READY);
+    (void)HAL_TIM_Encoder_Stop(htim, TIM_CHANNEL_ALL);
+
+    /* Return error status */
+    return HAL_ERROR;
+  }
+
+  /* Enable the time base Capture compare DMA request and Input Capture channel */
+  __HAL_TIM_ENABLE_DMA(htimcapture, (TIM_DMA_CC1 << (pSpeed->Channel >> 2U)));
+  TIM_CCxChannelCmd(htimcapture->Instance, pSpeed->Channel, TIM_CCx_ENABLE);
+
+  /* Enable the time base */
+  __HAL_TIM_ENABLE(htimcapture);
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the encoder speed estimation.
+  * @param  htim Encoder TIM handle
+  * @param  pSpeed Encoder speed structure
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_TIMEx_EncoderSpeed_Stop(TIM_HandleTypeDef *htim, TIM_EncoderSpeedTypeDef *pSpeed)
+{
+  TIM_HandleTypeDef *htimcapture;
+
+  if ((pSpeed == NULL) || (pSpeed->htimCapture == NULL))
+  {
+    return HAL_ERROR;
+  }
+  htimcapture = pSpeed->htimCapture;
+
+  /* Disable the time base Capture compare DMA request */
+  __HAL_TIM_DISABLE_DMA(htimcapture, (TIM_DMA_CC1 << (pSpeed->Channel >> 2U)));
+
+  /* Abort the DMA transfer */
+  (void)HAL_DMA_Abort(htimcapture->hdma[TIM_DMA_ID_CC1 + (pSpeed->Channel >> 2U)]);
+
+  /* Disable the time base Input Capture channel and the time base */
+  TIM_CCxChannelCmd(htimcapture->Instance, pSpeed->Channel, TIM_CCx_DISABLE);
+  __HAL_TIM_DISABLE(htimcapture);
+
+  /* Set the time base channel state */
+  TIM_CHANNEL_STATE_SET(htimcapture, pSpeed->Channel, HAL_TIM_CHANNEL_STATE_READY);
+
+  /* Stop the encoder interface */
+  return HAL_TIM_Encoder_Stop(htim, TIM_CHANNEL_ALL);
+}
+
+/**
+  * @brief  Update the encoder speed and position estimation.
+  * @note   To be called periodically, typically from the control loop.
+  * @param  htim Encoder TIM handle
+  * @param  pSpeed Encoder speed structure
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_TIMEx_EncoderSpeed_Update(const TIM_HandleTypeDef *htim, TIM_EncoderSpeedTypeDef *pSpeed)
+{
+  const __IO uint32_t *pcapture;
+  uint32_t capture_arr;
+  uint32_t encoder_arr;
+  uint32_t stamp;
+  uint32_t count;
+  uint32_t elapsed;
+  int32_t delta;
+  int64_t bound;
+
+  if ((pSpeed == NULL) || (pSpeed->htimCapture == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* CCR1 to CCR4 being consecutive registers */
+  pcapture = (const __IO uint32_t *)(((uint32_t)&pSpeed->htimCapture->Instance->CCR1) + pSpeed->Channel);
+  capture_arr = __HAL_TIM_GET_AUTORELOAD(pSpeed->htimCapture);
+
+  /* Time and encoder counter of the last edge, read again if an edge occurred meanwhile */
+  do
+  {
+    stamp = *pcapture;
+    count = pSpeed->EdgeCount;
+  } while (stamp != *pcapture);
+
+  /* Moves of more than half the encoder range are backward moves */
+  encoder_arr = __HAL_TIM_GET_AUTORELOAD(htim);
+  elapsed = TIMEx_CounterDelta(count, pSpeed->LastCount, encoder_arr);
+  if ((encoder_arr != 0xFFFFFFFFU) && (elapsed > (encoder_arr / 2U)))
+  {
+    elapsed -= encoder_arr + 1U;
+  }
+  delta = (int32_t)elapsed;
+
+  if (delta != 0)
+  {
+    /* M/T method: counts between the last edges divided by their exact time */
+    elapsed = TIMEx_CounterDelta(stamp, pSpeed->LastStamp, capture_arr);
+    if (elapsed != 0U)
+    {
+      pSpeed->Speed = (int32_t)(((int64_t)delta * (int64_t)pSpeed->Scale) / (int64_t)elapsed);
+    }
+    pSpeed->Position += delta;
+    pSpeed->LastCount = count;
+    pSpeed->LastStamp = stamp;
+  }
+  else
+  {
+    /* No edge: the speed is lower than one count over the time elapsed since the last edge */
+    elapsed = TIMEx_CounterDelta(__HAL_TIM_GET_COUNTER(pSpeed->htimCapture), pSpeed->LastStamp, capture_arr);
+    if (elapsed >= pSpeed->Timeout)
+    {
+      pSpeed->Speed = 0;
+    }
+    else if (elapsed != 0U)
+    {
+      bound = (int64_t)(pSpeed->Scale / elapsed);
+      if ((int64_t)pSpeed->Speed > bound)
+      {
+        pSpeed->Speed = (int32_t)bound;
+      }
+      else if ((int64_t)pSpeed->Speed < -bound)
+      {
+        pSpeed->Speed = (int32_t)(-bound);
+      }
+      else
+      {
+        /* Speed below the bound */
+      }
+    }
+    else
+    {
+      /* Speed kept */
+    }
+  }
+
+  return HAL_OK;
+}
+/**
+  * @}
+  */
+
+/** @defgroup TIMEx_Exported_Functions_Group9 Extended timer group functions
+  * @brief    Extended timer group functions
+  *
+@verbatim
+  ==============================================================================
+                    ##### Extended timer group functions #####
+  ==============================================================================
+  [..]
+    This section provides functions allowing to start and stop several timers in phase:
+    (#) Initialize each member timer and configure its channels (e.g. HAL_TIM_PWM_Init() and
+        HAL_TIM_PWM_ConfigChannel()), without starting them.
+    (#) Describe the group in a TIM_GroupTypeDef structure: the first member is the master, each other
+        member gives its channels to enable and its trigger input (ITRx) connected to the master TRGO.
+    (#) Call HAL_TIMEx_Group_Config() once: the master outputs its counter enable on TRGO with the
+        master/slave mode delay, the other members are set in gated slave mode on it.
+        The master TRGO2 remains available (e.g. as ADC trigger).
+    (#) HAL_TIMEx_Group_Start() resets the counters, enables the channels of all the members, then
+        enables the master counter: all the counters start on the same clock cycle.
+    (#) HAL_TIMEx_Group_Stop() disables the master counter, stopping all the counters on the same clock
+        cycle, then disables the channels of all the members.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Configure the master/slave links of a timer group.
+  * @param  pGroup Timer group, the master first
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_TIMEx_Group_Config(const TIM_GroupTypeDef *pGroup)
+{
+  TIM_SlaveConfigTypeDef sSlaveConfig = {0};
+  TIM_HandleTypeDef *hmaster;
+  uint32_t i;
+
+  if ((pGroup == NULL) || (pGroup->pMembers == NULL) || (pGroup->NbMembers == 0U))
+  {
+    return HAL_ERROR;
+  }
+  hmaster = pGroup->pMembers[0].htim;
+
+  /* Check the parameters */
+  assert_param(IS_TIM_MASTER_INSTANCE(hmaster->Instance));
+
+  if (hmaster->State != HAL_TIM_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  /* Counter enable as trigger output, delayed to be synchronized with the slaves */
+  MODIFY_REG(hmaster->Instance->CR2, TIM_CR2_MMS, TIM_TRGO_ENABLE);
+  SET_BIT(hmaster->Instance->SMCR, TIM_SMCR_MSM);
+
+  /* The slaves count while the master counter is enabled */
+  sSlaveConfig.SlaveMode        = TIM_SLAVEMODE_GATED;
+  sSlaveConfig.TriggerPolarity  = TIM_TRIGGERPOLARITY_NONINVERTED;
+  sSlaveConfig.TriggerPrescaler = TIM_TRIGGERPRESCALER_DIV1;
+  sSlaveConfig.TriggerFilter    = 0U;
+
+  for (i = 1U; i < pGroup->NbMembers; i++)
+  {
+    sSlaveConfig.InputTrigger = pGroup->pMembers[i].Trigger;
+    if (HAL_TIM_SlaveConfigSynchro(pGroup->pMembers[i].htim, &sSlaveConfig) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Start all the timers of a group on the same clock cycle.
+  * @param  pGroup Timer group configured by HAL_TIMEx_Group_Config()
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_TIMEx_Group_Start(const TIM_GroupTypeDef *pGroup)
+{
+  TIM_HandleTypeDef *htim;
+  uint32_t channel;
+  uint32_t i;
+
+  if ((pGroup == NULL) || (pGroup->pMembers == NULL) || (pGroup->NbMembers == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the channels state of all the members */
+  for (i = 0U; i < pGroup->NbMembers; i++)
+  {
+    htim = pGroup->pMembers[i].htim;
+    for (channel = TIM_CHANNEL_1; channel <= TIM_CHANNEL_4; channel += 4U)
+    {
+      if (((pGroup->pMembers[i].Channels & (TIM_GROUP_CHANNEL_1 << (channel >> 2U))) != 0U) &&
+          (TIM_CHANNEL_STATE_GET(htim, channel) != HAL_TIM_CHANNEL_STATE_READY))
+      {
+        return HAL_ERROR;
+      }
+    }
+  }
+
+  for (i = 0U; i < pGroup->NbMembers; i++)
+  {
+    htim = pGroup->pMembers[i].htim;
+
+    /* Start in phase */
+    __HAL_TIM_SET_COUNTER(htim, 0U);
+
+    /* Enable the Capture compare channels */
+    for (channel = TIM_CHANNEL_1; channel <= TIM_CHANNEL_4; channel += 4U)
+    {
+      if ((pGroup->pMembers[i].Channels & (TIM_GROUP_CHANNEL_1 << (channel >> 2U))) != 0U)
+      {
+        assert_param(IS_TIM_CCX_INSTANCE(htim->Instance, channel));
+        TIM_CHANNEL_STATE_SET(htim, channel, HAL_TIM_CHANNEL_STATE_BUSY);
+        TIM_CCxChannelCmd(htim->Instance, channel, TIM_CCx_ENABLE);
+      }
+    }
+
+    if (IS_TIM_BREAK_INSTANCE(htim->Instance) != RESET)
+    {
+      /* Enable the main output */
+      __HAL_TIM_MOE_ENABLE(htim);
+    }
+
+    if (i != 0U)
+    {
+      /* The slave counter waits for the master counter enable */
+      __HAL_TIM_ENABLE(htim);
+    }
+  }
+
+  /* Start the master, and all the slaves with it */
+  __HAL_TIM_ENABLE(pGroup->pMembers[0].htim);
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop all the timers of a group on the same clock cycle.
+  * @param  pGroup Timer group started by HAL_TIMEx_Group_Start()
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_TIMEx_Group_Stop(const TIM_GroupTypeDef *pGroup)
+{
+  TIM_HandleTypeDef *htim;
+  uint32_t channel;
+  uint32_t i;
+
+  if ((pGroup == NULL) || (pGroup->pMembers == NULL) || (pGroup->NbMembers == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Stop the master, and all the slaves with it, whatever the channels state */
+  CLEAR_BIT(pGroup->pMembers[0].htim->Instance->CR1, TIM_CR1_CEN);
+
+  for (i = 0U; i < pGroup->NbMembers; i++)
+  {
+    htim = pGroup->pMembers[i].htim;
+
+    /* Disable the Capture compare channels */
+    for (channel = TIM_CHANNEL_1; channel <= TIM_CHANNEL_4; channel += 4U)
+    {
+      if ((pGroup->pMembers[i].Channels & (TIM_GROUP_CHANNEL_1 << (channel >> 2U))) != 0U)
+      {
+        TIM_CCxChannelCmd(htim->Instance, channel, TIM_CCx_DISABLE);
+        TIM_CHANNEL_STATE_SET(htim, channel, HAL_TIM_CHANNEL_STATE_READY);
+      }
+    }
+
+    if (IS_TIM_BREAK_INSTANCE(htim->Instance) != RESET)
+    {
+      /* Disable the Main Output */
+      __HAL_TIM_MOE_DISABLE(htim);
+    }
+
+    /* Disable the Peripheral */
+    __HAL_TIM_DISABLE(htim);
+  }
+
+  /* Return function status */
+  return HAL_OK;
+}
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/* Private functions ---------------------------------------------------------*/
+/** @defgroup TIMEx_Private_Functions TIM Extended Private Functions
+  * @{
+  */
+
+/**
+  * @brief  TIM DMA Commutation callback.
+  * @param  hdma pointer to DMA handle.
+  * @retval None
+  */
+void TIMEx_DMACommutationCplt(DMA_HandleTypeDef *hdma)
+{
+  TIM_HandleTypeDef *htim = (TIM_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+
+  /* Change the htim state */
+  htim->State = HAL_TIM_STATE_READY;
+
+#if (USE_HAL_TIM_REGISTER_CALLBACKS == 1)
+  htim->CommutationCallback(htim);
+#else
+  HAL_TIMEx_CommutCallback(htim);
+#endif /* USE_HAL_TIM_REGISTER_CALLBACKS */
+}
+
+/**
+  * @brief  TIM DMA Commutation half complete callback.
+  * @param  hdma pointer to DMA handle.
+  * @retval None
+  */
+void TIMEx_DMACommutationHalfCplt(DMA_HandleTypeDef *hdma)
+{
+  TIM_HandleTypeDef *htim = (TIM_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+
+  /* Change the htim state */
+  htim->State = HAL_TIM_STATE_READY;
+
+#if (USE_HAL_TIM_REGISTER_CALLBACKS == 1)
+  htim->CommutationHalfCpltCallback(htim);
+#else
+  HAL_TIMEx_CommutHalfCpltCallback(htim);
+#endif /* USE_HAL_TIM_REGISTER_CALLBACKS */
+}
+
+
+/**
+  * @brief  Record a counter overflow of the input capture stream.
+  * @note   Called by HAL_TIM_IRQHandler() on the update event.
+  * @param  htim TIM handle
+  * @retval None
+  */
+void TIMEx_ICStreamOverflow(TIM_HandleTypeDef *htim)
+{
+  TIM_ICStreamTypeDef *pstream = htim->pICStream;
+  uint32_t position = TIMEx_ICStreamPosition(htim);
+  uint32_t last = (pstream->MarkWr - 1U) % TIM_ICSTREAM_MARKS;
+
+  pstream->WriteCount += (position + pstream->Size - pstream->WriteIndex) % pstream->Size;
+  pstream->WriteIndex = position;
+
+  if ((pstream->MarkWr != pstream->MarkRd) && (pstream->MarkCount[last] == pstream->WriteCount))
+  {
+    /* No capture since the previous overflow */
+    pstream->MarkWraps[last]++;
+  }
+  else if ((pstream->MarkWr - pstream->MarkRd) < TIM_ICSTREAM_MARKS)
+  {
+    pstream->MarkCount[pstream->MarkWr % TIM_ICSTREAM_MARKS] = pstream->WriteCount;
+    pstream->MarkWraps[pstream->MarkWr % TIM_ICSTREAM_MARKS] = 1U;
+    pstream->MarkWr++;
+  }
+  else
+  {
+    /* Queue full: the overflow is merged in the last mark */
+    pstream->MarkWraps[last]++;
+    pstream->MarkOverruns++;
+  }
+}
+
+/**
+  * @brief  Compute the difference of two counter values, modulo the counter period.
+  * @param  Current Current counter value
+  * @param  Previous Previous counter value
+  * @param  AutoReload Counter auto-reload value
+  * @retval Difference from 0 to AutoReload
+  */
+static uint32_t TIMEx_CounterDelta(uint32_t Current, uint32_t Previous, uint32_t AutoReload)
+{
+  uint32_t delta = Current - Previous;
+
+  if ((AutoReload != 0xFFFFFFFFU) && (Current < Previous))
+  {
+    /* Counter wrap */
+    delta += AutoReload + 1U;
+  }
+
+  return delta;
+}
+
+/**
+  * @brief  Get the position of the DMA in the input capture ring.
+  * @param  htim TIM handle
+  * @retval Index of the next capture to be written
+  */
+static uint32_t TIMEx_ICStreamPosition(const TIM_HandleTypeDef *htim)
+{
+  const TIM_ICStreamTypeDef *pstream = htim->pICStream;
+  uint32_t position;
+
+  position = pstream->Size -
+             (__HAL_DMA_GET_COUNTER(htim->hdma[TIM_DMA_ID_CC1 + (pstream->Channel >> 2U)]) / 4U);
+
+  return (position == pstream->Size) ? 0U : position;
+}
+
+/**
+  * @brief  Release the half buffer just played by the PWM stream.
+  * @param  htim TIM handle
+  * @param  Half Half buffer played, 0 or 1
+  * @retval None
+  */
+static void TIMEx_PWMStreamUpdate(TIM_HandleTypeDef *htim, uint32_t Half)
+{
+  TIM_PWMStreamTypeDef *pstream = htim->pPWMStream;
+
+  /* The other half was not refilled before being played */
+  if (pstream->RefillPending != 0U)
+  {
+    pstream->Underruns++;
+  }
+
+  pstream->pRefill = &pstream->pBuffer[Half * pstream->HalfFrames * pstream->NbChannels];
+  pstream->HalfIndex++;
+  pstream->RefillPending = 1U;
+}
+
+/**
+  * @brief  TIM DMA PWM stream complete callback.
+  * @param  hdma pointer to DMA handle.
+  * @retval None
+  */
+static void TIMEx_DMAPWMStreamCplt(DMA_HandleTypeDef *hdma)
+{
+  TIM_HandleTypeDef *htim = (TIM_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+
+  TIMEx_PWMStreamUpdate(htim, 1U);
+
+#if (USE_HAL_TIM_REGISTER_CALLBACKS == 1)
+  htim->PeriodElapsedCallback(htim);
+#else
+  HAL_TIM_PeriodElapsedCallback(htim);
+#endif /* USE_HAL_TIM_REGISTER_CALLBACKS */
+}
+
+/**
+  * @brief  TIM DMA PWM stream half complete callback.
+  * @param  hdma pointer to DMA handle.
+  * @retval None
+  */
+static void TIMEx_DMAPWMStreamHalfCplt(DMA_HandleTypeDef *hdma)
+{
+  TIM_HandleTypeDef *htim = (TIM_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+
+  TIMEx_PWMStreamUpdate(htim, 0U);
+
+#if (USE_HAL_TIM_REGISTER_CALLBACKS == 1)
+  htim->PeriodElapsedHalfCpltCallback(htim);
+#else
+  HAL_TIM_PeriodElapsedHalfCpltCallback(htim);
+#endif /* USE_HAL_TIM_REGISTER_CALLBACKS */
+}
 
 /**
   * @brief  TIM DMA Delay Pulse complete callback (complementary channel).
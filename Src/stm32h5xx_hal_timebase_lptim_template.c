@@ -0,0 +1,301 @@
+/**
+  ******************************************************************************
+  * @file    stm32h5xx_hal_timebase_lptim_template.c
+  * @author  MCD Application Team
+  * @brief   HAL tickless time base based on the hardware LPTIM.
+  *
+  *          This file overrides the native HAL time base functions (defined as weak)
+  *          to use a free running LPTIM1 clocked by the LSE as time base:
+  *           + No periodic tick interrupt: the time is read from the LPTIM1 counter,
+  *             extended to 64 bits by the counter overflow interrupt (every 2 s)
+  *           + HAL_GetTickUs64() gives the time in microseconds, HAL_GetTick() in
+  *             milliseconds
+  *           + HAL_Delay() programs a one-shot compare and sleeps until it matches
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2023 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+ @verbatim
+  ==============================================================================
+                        ##### How to use this driver #####
+  ==============================================================================
+    [..]
+    This file must be copied to the application folder and modified as follows:
+    (#) Rename it to 'stm32h5xx_hal_timebase_lptim.c'
+    (#) Add this file to your project. LPTIM1 is accessed at register level,
+        the LPTIM HAL driver is not needed.
+
+    [..]
+    (@) The time resolution is one LSE period (30.5 us) and the time keeps counting
+        in Sleep and Stop modes, HAL_SuspendTick() and HAL_ResumeTick() do nothing.
+    (@) HAL_InitTick() called again by HAL_RCC_ClockConfig() only updates the interrupt
+        priority: the counter is not restarted and the time is kept.
+    (@) HAL_SetTickFreq() has no effect on the time base resolution.
+
+  @endverbatim
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32h5xx_hal.h"
+
+/** @addtogroup STM32H5xx_HAL_Driver
+  * @{
+  */
+
+/** @defgroup HAL_TimeBase_LPTIM_Template  HAL TimeBase LPTIM Template
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define TIMEBASE_LPTIM_FREQ        LSE_VALUE  /* LPTIM1 counter clock */
+#define TIMEBASE_LPTIM_PERIOD      0x10000U   /* Full 16-bit counter range */
+#define TIMEBASE_LPTIM_SYNC_TICKS  4U         /* Ticks for a compare update to be taken into account */
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static __IO uint32_t uwTimeBaseOverflows; /* High part of the 64-bit counter */
+
+/* Private function prototypes -----------------------------------------------*/
+void LPTIM1_IRQHandler(void);
+static uint32_t TimeBase_ReadCounter(void);
+static uint64_t TimeBase_GetTicks(void);
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  This function configures the LPTIM1 as a free running time base source.
+  *         The counter overflow and compare interrupts are set with a dedicated
+  *         Tick interrupt priority.
+  * @note   This function is called  automatically at the beginning of program after
+  *         reset by HAL_Init() or at any time when clock is configured, by HAL_RCC_ClockConfig().
+  * @param  TickPriority Tick interrupt priority.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_InitTick(uint32_t TickPriority)
+{
+  RCC_OscInitTypeDef  RCC_OscInitStruct = {0};
+  HAL_StatusTypeDef   status = HAL_OK;
+
+  if (TickPriority >= (1UL << __NVIC_PRIO_BITS))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Already running: keep the time, only update the priority */
+  if ((LPTIM1->CR & LPTIM_CR_ENABLE) == 0U)
+  {
+    /* Enable the LSE */
+    HAL_PWR_EnableBkUpAccess();
+    RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_LSE;
+    RCC_OscInitStruct.PLL.PLLState   = RCC_PLL_NONE;
+    RCC_OscInitStruct.LSEState       = RCC_LSE_ON;
+    status = HAL_RCC_OscConfig(&RCC_OscInitStruct);
+
+    if (status == HAL_OK)
+    {
+      /* Clock LPTIM1 with the LSE, also in low power modes */
+      __HAL_RCC_LPTIM1_CONFIG(RCC_LPTIM1CLKSOURCE_LSE);
+      __HAL_RCC_LPTIM1_CLK_ENABLE();
+      __HAL_RCC_LPTIM1_CLK_SLEEP_ENABLE();
+
+      /* Internal clock, no prescaler, no trigger */
+      LPTIM1->CFGR = 0U;
+      LPTIM1->CR   = LPTIM_CR_ENABLE;
+
+      /* Overflow and compare interrupts */
+      LPTIM1->DIER = LPTIM_DIER_ARRMIE | LPTIM_DIER_CC1IE;
+      while ((LPTIM1->ISR & LPTIM_ISR_DIEROK) == 0U)
+      {
+      }
+      LPTIM1->ICR = LPTIM_ICR_DIEROKCF;
+
+      LPTIM1->ARR = TIMEBASE_LPTIM_PERIOD - 1U;
+      while ((LPTIM1->ISR & LPTIM_ISR_ARROK) == 0U)
+      {
+      }
+      LPTIM1->ICR = LPTIM_ICR_ARROKCF;
+
+      /* No compare programmed: match together with the overflow */
+      LPTIM1->CCR1 = TIMEBASE_LPTIM_PERIOD - 1U;
+      while ((LPTIM1->ISR & LPTIM_ISR_CMP1OK) == 0U)
+      {
+      }
+      LPTIM1->ICR = LPTIM_ICR_CMP1OKCF;
+
+      uwTimeBaseOverflows = 0U;
+
+      /* Start the counter in continuous mode */
+      LPTIM1->CR |= LPTIM_CR_CNTSTRT;
+    }
+  }
+
+  if (status == HAL_OK)
+  {
+    HAL_NVIC_SetPriority(LPTIM1_IRQn, TickPriority, 0U);
+    HAL_NVIC_EnableIRQ(LPTIM1_IRQn);
+    uwTickPrio = TickPriority;
+  }
+
+  /* Return function status */
+  return status;
+}
+
+/**
+  * @brief  Provide the time in microseconds since the time base start.
+  * @retval 64-bit time in microseconds
+  */
+uint64_t HAL_GetTickUs64(void)
+{
+  uint64_t ticks = TimeBase_GetTicks();
+
+  /* Split the conversion to avoid the 64-bit overflow of the product */
+  return ((ticks / TIMEBASE_LPTIM_FREQ) * 1000000U) +
+         (((ticks % TIMEBASE_LPTIM_FREQ) * 1000000U) / TIMEBASE_LPTIM_FREQ);
+}
+
+/**
+  * @brief  Provide a tick value in millisecond.
+  * @retval tick value
+  */
+uint32_t HAL_GetTick(void)
+{
+  return (uint32_t)(HAL_GetTickUs64() / 1000U);
+}
+
+/**
+  * @brief  Sleep for the given delay, woken up by a one-shot compare.
+  * @param  Delay specifies the delay time length, in milliseconds.
+  * @retval None
+  */
+void HAL_Delay(uint32_t Delay)
+{
+  uint64_t target = TimeBase_GetTicks() + ((((uint64_t)Delay * TIMEBASE_LPTIM_FREQ) + 999U) / 1000U);
+  uint64_t now = TimeBase_GetTicks();
+
+  while (now < target)
+  {
+    /* Program the compare once the target is within the counter range */
+    if ((target - now) < TIMEBASE_LPTIM_PERIOD)
+    {
+      if ((target - now) <= TIMEBASE_LPTIM_SYNC_TICKS)
+      {
+        /* Too close to be programmed */
+        now = TimeBase_GetTicks();
+        continue;
+      }
+
+      if (LPTIM1->CCR1 != ((uint32_t)target % TIMEBASE_LPTIM_PERIOD))
+      {
+        LPTIM1->CCR1 = (uint32_t)target % TIMEBASE_LPTIM_PERIOD;
+        while ((LPTIM1->ISR & LPTIM_ISR_CMP1OK) == 0U)
+        {
+        }
+        LPTIM1->ICR = LPTIM_ICR_CMP1OKCF;
+      }
+    }
+
+    /* Woken up by the compare, the overflow or any other interrupt */
+    __WFI();
+
+    now = TimeBase_GetTicks();
+  }
+}
+
+/**
+  * @brief  Suspend Tick increment.
+  * @note   The time base has no tick to suspend and keeps counting in low power modes.
+  * @retval None
+  */
+void HAL_SuspendTick(void)
+{
+}
+
+/**
+  * @brief  Resume Tick increment.
+  * @note   The time base has no tick to resume.
+  * @retval None
+  */
+void HAL_ResumeTick(void)
+{
+}
+
+/**
+  * @brief  Read the LPTIM1 counter, clocked asynchronously.
+  * @retval Counter value
+  */
+static uint32_t TimeBase_ReadCounter(void)
+{
+  uint32_t cnt;
+
+  /* Two consecutive identical reads give a reliable value */
+  do
+  {
+    cnt = LPTIM1->CNT;
+  } while (cnt != LPTIM1->CNT);
+
+  return cnt;
+}
+
+/**
+  * @brief  Read the 64-bit counter, the overflows being counted by the interrupt.
+  * @retval Counter value in LPTIM1 clock periods
+  */
+static uint64_t TimeBase_GetTicks(void)
+{
+  uint32_t primask_bit;
+  uint32_t high;
+  uint32_t cnt;
+
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  cnt  = TimeBase_ReadCounter();
+  high = uwTimeBaseOverflows;
+
+  /* Overflow not yet counted by the interrupt: the counter is read again after it */
+  if ((LPTIM1->ISR & LPTIM_ISR_ARRM) != 0U)
+  {
+    cnt = TimeBase_ReadCounter();
+    high++;
+  }
+
+  __set_PRIMASK(primask_bit);
+
+  return ((uint64_t)high * TIMEBASE_LPTIM_PERIOD) + cnt;
+}
+
+/**
+  * @brief  This function handles LPTIM1 interrupt request.
+  * @retval None
+  */
+void LPTIM1_IRQHandler(void)
+{
+  if ((LPTIM1->ISR & LPTIM_ISR_ARRM) != 0U)
+  {
+    LPTIM1->ICR = LPTIM_ICR_ARRMCF;
+    uwTimeBaseOverflows++;
+  }
+
+  /* The compare only wakes up HAL_Delay() */
+  if ((LPTIM1->ISR & LPTIM_ISR_CC1IF) != 0U)
+  {
+    LPTIM1->ICR = LPTIM_ICR_CC1CF;
+  }
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
@@ -78,6 +78,9 @@
     (@) These API's (HAL_UART_Init(), HAL_HalfDuplex_Init(), HAL_LIN_Init(), HAL_MultiProcessor_Init(),
         also configure the low level Hardware GPIO, CLOCK, CORTEX...etc) by
         calling the customized HAL_UART_MspInit() API.
+    (@) In a polling or interrupt only application, USE_HAL_UART_DMA set to 0 in the HAL
+        configuration removes the DMA transfer functions and the hdmatx/hdmarx handle fields,
+        while the HAL DMA module remains available for other drivers.
 
     ##### Callback registration #####
     ==================================
@@ -128,6 +131,8 @@
     [..]
     For specific callback RxEventCallback, use dedicated registration/reset functions:
     respectively HAL_UART_RegisterRxEventCallback() , HAL_UART_UnRegisterRxEventCallback().
+    For specific callback RxFrameCallback, use HAL_UART_RegisterRxFrameCallback() and
+    HAL_UART_UnRegisterRxFrameCallback().
 
     [..]
     By default, after the HAL_UART_Init() and when the state is HAL_UART_STATE_RESET
@@ -198,7 +203,7 @@
   * @{
   */
 static void UART_EndRxTransfer(UART_HandleTypeDef *huart);
-#if defined(HAL_DMA_MODULE_ENABLED)
+#if defined(HAL_UART_DMA_ENABLED)
 static void UART_EndTxTransfer(UART_HandleTypeDef *huart);
 static void UART_DMATransmitCplt(DMA_HandleTypeDef *hdma);
 static void UART_DMAReceiveCplt(DMA_HandleTypeDef *hdma);
@@ -210,7 +215,11 @@ static void UART_DMATxAbortCallback(DMA_HandleTypeDef *hdma);
 static void UART_DMARxAbortCallback(DMA_HandleTypeDef *hdma);
 static void UART_DMATxOnlyAbortCallback(DMA_HandleTypeDef *hdma);
 static void UART_DMARxOnlyAbortCallback(DMA_HandleTypeDef *hdma);
-#endif /* HAL_DMA_MODULE_ENABLED */
+static void UART_RxStreamUpdate(UART_HandleTypeDef *huart, uint16_t Pos);
+static void UART_RxFrameUpdate(UART_HandleTypeDef *huart);
+static HAL_StatusTypeDef UART_TxQueueRestart(UART_HandleTypeDef *huart);
+static void UART_TxQueueFlush(UART_HandleTypeDef *huart);
+#endif /* HAL_UART_DMA_ENABLED */
 static void UART_TxISR_8BIT(UART_HandleTypeDef *huart);
 static void UART_TxISR_16BIT(UART_HandleTypeDef *huart);
 static void UART_TxISR_8BIT_FIFOEN(UART_HandleTypeDef *huart);
@@ -1009,6 +1018,62 @@ HAL_StatusTypeDef HAL_UART_UnRegisterRxEventCallback(UART_HandleTypeDef *huart)
   return status;
 }
 
+/**
+  * @brief  Register a User UART Rx Frame Callback
+  *         To be used instead of the weak predefined callback
+  * @param  huart     Uart handle
+  * @param  pCallback Pointer to the Rx Frame Callback function
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UART_RegisterRxFrameCallback(UART_HandleTypeDef *huart, pUART_RxFrameCallbackTypeDef pCallback)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if (pCallback == NULL)
+  {
+    huart->ErrorCode |= HAL_UART_ERROR_INVALID_CALLBACK;
+
+    return HAL_ERROR;
+  }
+
+  if (huart->RxState == HAL_UART_STATE_READY)
+  {
+    huart->RxFrameCallback = pCallback;
+  }
+  else
+  {
+    huart->ErrorCode |= HAL_UART_ERROR_INVALID_CALLBACK;
+
+    status =  HAL_ERROR;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  UnRegister the UART Rx Frame Callback
+  *         UART Rx Frame Callback is redirected to the weak HAL_UARTEx_RxFrameCallback() predefined callback
+  * @param  huart     Uart handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UART_UnRegisterRxFrameCallback(UART_HandleTypeDef *huart)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if (huart->RxState == HAL_UART_STATE_READY)
+  {
+    huart->RxFrameCallback = HAL_UARTEx_RxFrameCallback; /* Legacy weak UART Rx Frame Callback  */
+  }
+  else
+  {
+    huart->ErrorCode |= HAL_UART_ERROR_INVALID_CALLBACK;
+
+    status =  HAL_ERROR;
+  }
+
+  return status;
+}
+
 #endif /* USE_HAL_UART_REGISTER_CALLBACKS */
 
 /**
@@ -1047,6 +1112,10 @@ HAL_StatusTypeDef HAL_UART_UnRegisterRxEventCallback(UART_HandleTypeDef *huart)
         (++) HAL_UART_Transmit_IT()
         (++) HAL_UART_Receive_IT()
         (++) HAL_UART_IRQHandler()
+        (++) HAL_UART_FastIRQHandler(), to be used instead of HAL_UART_IRQHandler() for
+             high rate interrupt mode links: the data register events without error are
+             dispatched directly to the Rx or Tx ISR, the other events being handled by
+             HAL_UART_IRQHandler()
 
     (#) Non-Blocking mode API's with DMA are :
         (++) HAL_UART_Transmit_DMA()
@@ -1439,7 +1508,7 @@ HAL_StatusTypeDef HAL_UART_Receive_IT(UART_HandleTypeDef *huart, uint8_t *pData,
   }
 }
 
-#if defined(HAL_DMA_MODULE_ENABLED)
+#if defined(HAL_UART_DMA_ENABLED)
 /**
   * @brief Send an amount of data in DMA mode.
   * @note   When UART parity is not enabled (PCE = 0), and Word Length is configured to 9 bits (M1-M0 = 01),
@@ -1501,6 +1570,9 @@ HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef *huart, const uint8_t
       {
         if ((huart->hdmatx->LinkedListQueue != NULL) && (huart->hdmatx->LinkedListQueue->Head != NULL))
         {
+          /* Drop nodes left linked by an aborted queued transmission */
+          UART_TxQueueFlush(huart);
+
           /* Set DMA data size */
           huart->hdmatx->LinkedListQueue->Head->LinkRegisters[NODE_CBR1_DEFAULT_OFFSET] = nbByte;
 
@@ -1775,7 +1847,7 @@ HAL_StatusTypeDef HAL_UART_DMAStop(UART_HandleTypeDef *huart)
 
   return HAL_OK;
 }
-#endif /* HAL_DMA_MODULE_ENABLED */
+#endif /* HAL_UART_DMA_ENABLED */
 
 /**
   * @brief  Abort ongoing transfers (blocking mode).
@@ -1802,7 +1874,7 @@ HAL_StatusTypeDef HAL_UART_Abort(UART_HandleTypeDef *huart)
     ATOMIC_CLEAR_BIT(huart->Instance->CR1, (USART_CR1_IDLEIE));
   }
 
-#if defined(HAL_DMA_MODULE_ENABLED)
+#if defined(HAL_UART_DMA_ENABLED)
   /* Abort the UART DMA Tx channel if enabled */
   if (HAL_IS_BIT_SET(huart->Instance->CR3, USART_CR3_DMAT))
   {
@@ -1858,7 +1930,7 @@ HAL_StatusTypeDef HAL_UART_Abort(UART_HandleTypeDef *huart)
       }
     }
   }
-#endif /* HAL_DMA_MODULE_ENABLED */
+#endif /* HAL_UART_DMA_ENABLED */
 
   /* Clear the Error flags in the ICR register */
   __HAL_UART_CLEAR_FLAG(huart, UART_CLEAR_OREF | UART_CLEAR_NEF | UART_CLEAR_PEF | UART_CLEAR_FEF);
@@ -1900,7 +1972,7 @@ HAL_StatusTypeDef HAL_UART_AbortTransmit(UART_HandleTypeDef *huart)
   ATOMIC_CLEAR_BIT(huart->Instance->CR1, (USART_CR1_TCIE | USART_CR1_TXEIE_TXFNFIE));
   ATOMIC_CLEAR_BIT(huart->Instance->CR3, USART_CR3_TXFTIE);
 
-#if defined(HAL_DMA_MODULE_ENABLED)
+#if defined(HAL_UART_DMA_ENABLED)
   /* Abort the UART DMA Tx channel if enabled */
   if (HAL_IS_BIT_SET(huart->Instance->CR3, USART_CR3_DMAT))
   {
@@ -1928,7 +2000,7 @@ HAL_StatusTypeDef HAL_UART_AbortTransmit(UART_HandleTypeDef *huart)
       }
     }
   }
-#endif /* HAL_DMA_MODULE_ENABLED */
+#endif /* HAL_UART_DMA_ENABLED */
 
   /* Flush the whole TX FIFO (if needed) */
   if (huart->FifoMode == UART_FIFOMODE_ENABLE)
@@ -1966,7 +2038,7 @@ HAL_StatusTypeDef HAL_UART_AbortReceive(UART_HandleTypeDef *huart)
     ATOMIC_CLEAR_BIT(huart->Instance->CR1, (USART_CR1_IDLEIE));
   }
 
-#if defined(HAL_DMA_MODULE_ENABLED)
+#if defined(HAL_UART_DMA_ENABLED)
   /* Abort the UART DMA Rx channel if enabled */
   if (HAL_IS_BIT_SET(huart->Instance->CR3, USART_CR3_DMAR))
   {
@@ -1994,7 +2066,7 @@ HAL_StatusTypeDef HAL_UART_AbortReceive(UART_HandleTypeDef *huart)
       }
     }
   }
-#endif /* HAL_DMA_MODULE_ENABLED */
+#endif /* HAL_UART_DMA_ENABLED */
 
   /* Clear the Error flags in the ICR register */
   __HAL_UART_CLEAR_FLAG(huart, UART_CLEAR_OREF | UART_CLEAR_NEF | UART_CLEAR_PEF | UART_CLEAR_FEF);
@@ -2038,7 +2110,7 @@ HAL_StatusTypeDef HAL_UART_Abort_IT(UART_HandleTypeDef *huart)
     ATOMIC_CLEAR_BIT(huart->Instance->CR1, (USART_CR1_IDLEIE));
   }
 
-#if defined(HAL_DMA_MODULE_ENABLED)
+#if defined(HAL_UART_DMA_ENABLED)
   /* If DMA Tx and/or DMA Rx Handles are associated to UART Handle, DMA Abort complete callbacks should be initialised
      before any call to DMA Abort functions */
   /* DMA Tx Handle is valid */
@@ -2122,7 +2194,7 @@ HAL_StatusTypeDef HAL_UART_Abort_IT(UART_HandleTypeDef *huart)
       }
     }
   }
-#endif /* HAL_DMA_MODULE_ENABLED */
+#endif /* HAL_UART_DMA_ENABLED */
 
   /* if no DMA abort complete callback execution is required => call user Abort Complete callback */
   if (abortcplt == 1U)
@@ -2184,7 +2256,7 @@ HAL_StatusTypeDef HAL_UART_AbortTransmit_IT(UART_HandleTypeDef *huart)
   ATOMIC_CLEAR_BIT(huart->Instance->CR1, (USART_CR1_TCIE | USART_CR1_TXEIE_TXFNFIE));
   ATOMIC_CLEAR_BIT(huart->Instance->CR3, USART_CR3_TXFTIE);
 
-#if defined(HAL_DMA_MODULE_ENABLED)
+#if defined(HAL_UART_DMA_ENABLED)
   /* Abort the UART DMA Tx channel if enabled */
   if (HAL_IS_BIT_SET(huart->Instance->CR3, USART_CR3_DMAT))
   {
@@ -2227,7 +2299,7 @@ HAL_StatusTypeDef HAL_UART_AbortTransmit_IT(UART_HandleTypeDef *huart)
     }
   }
   else
-#endif /* HAL_DMA_MODULE_ENABLED */
+#endif /* HAL_UART_DMA_ENABLED */
   {
     /* Clear TxISR function pointers */
     huart->TxISR = NULL;
@@ -2280,7 +2352,7 @@ HAL_StatusTypeDef HAL_UART_AbortReceive_IT(UART_HandleTypeDef *huart)
     ATOMIC_CLEAR_BIT(huart->Instance->CR1, (USART_CR1_IDLEIE));
   }
 
-#if defined(HAL_DMA_MODULE_ENABLED)
+#if defined(HAL_UART_DMA_ENABLED)
   /* Abort the UART DMA Rx channel if enabled */
   if (HAL_IS_BIT_SET(huart->Instance->CR3, USART_CR3_DMAR))
   {
@@ -2329,7 +2401,7 @@ HAL_StatusTypeDef HAL_UART_AbortReceive_IT(UART_HandleTypeDef *huart)
     }
   }
   else
-#endif /* HAL_DMA_MODULE_ENABLED */
+#endif /* HAL_UART_DMA_ENABLED */
   {
     /* Clear RxISR function pointer */
     huart->pRxBuffPtr = NULL;
@@ -2368,6 +2440,24 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
   uint32_t errorflags;
   uint32_t errorcode;
 
+  HAL_TRACE_ENTER(HAL_TRACE_ID_UART_IRQ, huart);
+
+#if defined(HAL_UART_DMA_ENABLED)
+  /* Rx stream framing : character match or receiver timeout event ending a frame ---*/
+  if ((huart->pRxStream != NULL) && (huart->pRxStream->FrameDelimiter != 0U)
+      && ((((isrflags & USART_ISR_CMF) != 0U) && ((cr1its & USART_CR1_CMIE) != 0U))
+          || (((isrflags & USART_ISR_RTOF) != 0U) && ((cr1its & USART_CR1_RTOIE) != 0U))))
+  {
+    __HAL_UART_CLEAR_FLAG(huart, (UART_CLEAR_CMF | UART_CLEAR_RTOF));
+
+    UART_RxFrameUpdate(huart);
+
+    /* Other pending events are handled at the next interrupt entry */
+    HAL_TRACE_EXIT(HAL_TRACE_ID_UART_IRQ, huart);
+    return;
+  }
+
+#endif /* HAL_UART_DMA_ENABLED */
   /* If no error occurs */
   errorflags = (isrflags & (uint32_t)(USART_ISR_PE | USART_ISR_FE | USART_ISR_ORE | USART_ISR_NE | USART_ISR_RTOF));
   if (errorflags == 0U)
@@ -2381,6 +2471,7 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
       {
         huart->RxISR(huart);
       }
+      HAL_TRACE_EXIT(HAL_TRACE_ID_UART_IRQ, huart);
       return;
     }
   }
@@ -2460,7 +2551,7 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
            Disable Rx Interrupts, and disable Rx DMA request, if ongoing */
         UART_EndRxTransfer(huart);
 
-#if defined(HAL_DMA_MODULE_ENABLED)
+#if defined(HAL_UART_DMA_ENABLED)
         /* Abort the UART DMA Rx channel if enabled */
         if (HAL_IS_BIT_SET(huart->Instance->CR3, USART_CR3_DMAR))
         {
@@ -2497,7 +2588,7 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
           }
         }
         else
-#endif /* HAL_DMA_MODULE_ENABLED */
+#endif /* HAL_UART_DMA_ENABLED */
         {
           /* Call user error callback */
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
@@ -2523,6 +2614,7 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
         huart->ErrorCode = HAL_UART_ERROR_NONE;
       }
     }
+    HAL_TRACE_EXIT(HAL_TRACE_ID_UART_IRQ, huart);
     return;
 
   } /* End if some error occurs */
@@ -2535,7 +2627,7 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
   {
     __HAL_UART_CLEAR_FLAG(huart, UART_CLEAR_IDLEF);
 
-#if defined(HAL_DMA_MODULE_ENABLED)
+#if defined(HAL_UART_DMA_ENABLED)
     /* Check if DMA mode is enabled in UART */
     if (HAL_IS_BIT_SET(huart->Instance->CR3, USART_CR3_DMAR))
     {
@@ -2577,6 +2669,9 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
            In this case, Rx Event type is Idle Event */
         huart->RxEventType = HAL_UART_RXEVENT_IDLE;
 
+        /* Publish received data to the Rx stream ring, if any */
+        UART_RxStreamUpdate(huart, (huart->RxXferSize - huart->RxXferCount));
+
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
         /*Call registered Rx Event callback*/
         huart->RxEventCallback(huart, (huart->RxXferSize - huart->RxXferCount));
@@ -2597,6 +2692,9 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
                In this case, Rx Event type is Idle Event */
             huart->RxEventType = HAL_UART_RXEVENT_IDLE;
 
+            /* Publish received data to the Rx stream ring, if any */
+            UART_RxStreamUpdate(huart, huart->RxXferSize);
+
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
             /*Call registered Rx Event callback*/
             huart->RxEventCallback(huart, huart->RxXferSize);
@@ -2607,11 +2705,12 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
           }
         }
       }
+      HAL_TRACE_EXIT(HAL_TRACE_ID_UART_IRQ, huart);
       return;
     }
     else
     {
-#endif /* HAL_DMA_MODULE_ENABLED */
+#endif /* HAL_UART_DMA_ENABLED */
       /* DMA mode not enabled */
       /* Check received length : If all expected data are received, do nothing.
          Otherwise, if at least one data has already been received, IDLE event is to be notified to user */
@@ -2646,10 +2745,11 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
         HAL_UARTEx_RxEventCallback(huart, nb_rx_data);
 #endif /* (USE_HAL_UART_REGISTER_CALLBACKS) */
       }
+      HAL_TRACE_EXIT(HAL_TRACE_ID_UART_IRQ, huart);
       return;
-#if defined(HAL_DMA_MODULE_ENABLED)
+#if defined(HAL_UART_DMA_ENABLED)
     }
-#endif /* HAL_DMA_MODULE_ENABLED */
+#endif /* HAL_UART_DMA_ENABLED */
   }
 
   /* UART wakeup from Stop mode interrupt occurred ---------------------------*/
@@ -2667,6 +2767,7 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
     /* Call legacy weak Wakeup Callback */
     HAL_UARTEx_WakeupCallback(huart);
 #endif /* USE_HAL_UART_REGISTER_CALLBACKS */
+    HAL_TRACE_EXIT(HAL_TRACE_ID_UART_IRQ, huart);
     return;
   }
 
@@ -2679,6 +2780,7 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
     {
       huart->TxISR(huart);
     }
+    HAL_TRACE_EXIT(HAL_TRACE_ID_UART_IRQ, huart);
     return;
   }
 
@@ -2686,6 +2788,7 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
   if (((isrflags & USART_ISR_TC) != 0U) && ((cr1its & USART_CR1_TCIE) != 0U))
   {
     UART_EndTransmit_IT(huart);
+    HAL_TRACE_EXIT(HAL_TRACE_ID_UART_IRQ, huart);
     return;
   }
 
@@ -2699,6 +2802,7 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
     /* Call legacy weak Tx Fifo Empty Callback */
     HAL_UARTEx_TxFifoEmptyCallback(huart);
 #endif /* USE_HAL_UART_REGISTER_CALLBACKS */
+    HAL_TRACE_EXIT(HAL_TRACE_ID_UART_IRQ, huart);
     return;
   }
 
@@ -2712,8 +2816,63 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
     /* Call legacy weak Rx Fifo Full Callback */
     HAL_UARTEx_RxFifoFullCallback(huart);
 #endif /* USE_HAL_UART_REGISTER_CALLBACKS */
+    HAL_TRACE_EXIT(HAL_TRACE_ID_UART_IRQ, huart);
     return;
   }
+
+  HAL_TRACE_EXIT(HAL_TRACE_ID_UART_IRQ, huart);
+}
+
+/**
+  * @brief Handle UART interrupt request, with a direct dispatch of the data register events.
+  * @note  The receive (RXNE/RXFT) and transmit (TXE/TXFT) events are dispatched to the Rx and
+  *        Tx ISR without checking the other flags when no error is pending. Any other event is
+  *        handled by HAL_UART_IRQHandler(), the events left pending being handled at the next
+  *        interrupt entry.
+  * @param huart UART handle.
+  * @retval None
+  */
+void HAL_UART_FastIRQHandler(UART_HandleTypeDef *huart)
+{
+  uint32_t isrflags = READ_REG(huart->Instance->ISR);
+  uint32_t cr1its   = READ_REG(huart->Instance->CR1);
+  uint32_t cr3its   = READ_REG(huart->Instance->CR3);
+  uint32_t events;
+
+  if ((isrflags & (USART_ISR_PE | USART_ISR_FE | USART_ISR_ORE | USART_ISR_NE | USART_ISR_RTOF)) == 0U)
+  {
+    /* The RXNE/TXE interrupt enable bits have the position of their flag in CR1 */
+    events = cr1its & (USART_CR1_RXNEIE_RXFNEIE | USART_CR1_TXEIE_TXFNFIE);
+    if ((cr3its & USART_CR3_RXFTIE) != 0U)
+    {
+      events |= USART_ISR_RXNE_RXFNE;
+    }
+    if ((cr3its & USART_CR3_TXFTIE) != 0U)
+    {
+      events |= USART_ISR_TXE_TXFNF;
+    }
+    events &= isrflags;
+
+    /* UART in mode Receiver ---------------------------------------------------*/
+    if (((events & USART_ISR_RXNE_RXFNE) != 0U) && (huart->RxISR != NULL))
+    {
+      HAL_TRACE_ENTER(HAL_TRACE_ID_UART_IRQ, huart);
+      huart->RxISR(huart);
+      HAL_TRACE_EXIT(HAL_TRACE_ID_UART_IRQ, huart);
+      return;
+    }
+
+    /* UART in mode Transmitter ------------------------------------------------*/
+    if (((events & USART_ISR_TXE_TXFNF) != 0U) && (huart->TxISR != NULL))
+    {
+      HAL_TRACE_ENTER(HAL_TRACE_ID_UART_IRQ, huart);
+      huart->TxISR(huart);
+      HAL_TRACE_EXIT(HAL_TRACE_ID_UART_IRQ, huart);
+      return;
+    }
+  }
+
+  HAL_UART_IRQHandler(huart);
 }
 
 /**
@@ -3177,6 +3336,7 @@ void UART_InitCallbacksToDefault(UART_HandleTypeDef *huart)
   huart->RxFifoFullCallback        = HAL_UARTEx_RxFifoFullCallback;      /* Legacy weak RxFifoFullCallback        */
   huart->TxFifoEmptyCallback       = HAL_UARTEx_TxFifoEmptyCallback;     /* Legacy weak TxFifoEmptyCallback       */
   huart->RxEventCallback           = HAL_UARTEx_RxEventCallback;         /* Legacy weak RxEventCallback           */
+  huart->RxFrameCallback           = HAL_UARTEx_RxFrameCallback;         /* Legacy weak RxFrameCallback           */
 
 }
 #endif /* USE_HAL_UART_REGISTER_CALLBACKS */
@@ -3383,14 +3543,14 @@ void UART_AdvFeatureConfig(UART_HandleTypeDef *huart)
     MODIFY_REG(huart->Instance->CR3, USART_CR3_OVRDIS, huart->AdvancedInit.OverrunDisable);
   }
 
-#if defined(HAL_DMA_MODULE_ENABLED)
+#if defined(HAL_UART_DMA_ENABLED)
   /* if required, configure DMA disabling on reception error */
   if (HAL_IS_BIT_SET(huart->AdvancedInit.AdvFeatureInit, UART_ADVFEATURE_DMADISABLEONERROR_INIT))
   {
     assert_param(IS_UART_ADVFEATURE_DMAONRXERROR(huart->AdvancedInit.DMADisableonRxError));
     MODIFY_REG(huart->Instance->CR3, USART_CR3_DDRE, huart->AdvancedInit.DMADisableonRxError);
   }
-#endif /* HAL_DMA_MODULE_ENABLED */
+#endif /* HAL_UART_DMA_ENABLED */
 
   /* if required, configure auto Baud rate detection scheme */
   if (HAL_IS_BIT_SET(huart->AdvancedInit.AdvFeatureInit, UART_ADVFEATURE_AUTOBAUDRATE_INIT))
@@ -3617,7 +3777,7 @@ HAL_StatusTypeDef UART_Start_Receive_IT(UART_HandleTypeDef *huart, uint8_t *pDat
   return HAL_OK;
 }
 
-#if defined(HAL_DMA_MODULE_ENABLED)
+#if defined(HAL_UART_DMA_ENABLED)
 /**
   * @brief  Start Receive operation in DMA mode.
   * @note   This function could be called by all HAL UART API providing reception in DMA mode.
@@ -3734,7 +3894,7 @@ static void UART_EndTxTransfer(UART_HandleTypeDef *huart)
   /* At end of Tx process, restore huart->gState to Ready */
   huart->gState = HAL_UART_STATE_READY;
 }
-#endif /* HAL_DMA_MODULE_ENABLED */
+#endif /* HAL_UART_DMA_ENABLED */
 
 
 /**
@@ -3754,6 +3914,14 @@ static void UART_EndRxTransfer(UART_HandleTypeDef *huart)
     ATOMIC_CLEAR_BIT(huart->Instance->CR1, USART_CR1_IDLEIE);
   }
 
+#if defined(HAL_UART_DMA_ENABLED)
+  /* In case of Rx stream framing, disable also the frame delimiter interrupt sources */
+  if ((huart->pRxStream != NULL) && (huart->pRxStream->FrameDelimiter != 0U))
+  {
+    ATOMIC_CLEAR_BIT(huart->Instance->CR1, (USART_CR1_CMIE | USART_CR1_RTOIE));
+  }
+
+#endif /* HAL_UART_DMA_ENABLED */
   /* At end of Rx process, restore huart->RxState to Ready */
   huart->RxState = HAL_UART_STATE_READY;
   huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
@@ -3763,7 +3931,7 @@ static void UART_EndRxTransfer(UART_HandleTypeDef *huart)
 }
 
 
-#if defined(HAL_DMA_MODULE_ENABLED)
+#if defined(HAL_UART_DMA_ENABLED)
 /**
   * @brief DMA UART transmit process complete callback.
   * @param hdma DMA handle.
@@ -3776,6 +3944,18 @@ static void UART_DMATransmitCplt(DMA_HandleTypeDef *hdma)
   /* Check if DMA in circular mode */
   if (hdma->Mode != DMA_LINKEDLIST_CIRCULAR)
   {
+    /* Restart the channel on queued messages linked after it fetched the last node */
+    if (huart->pTxQueueRestart != NULL)
+    {
+      if (UART_TxQueueRestart(huart) == HAL_OK)
+      {
+        return;
+      }
+    }
+
+    /* End of queued transmission : give the template node back to the Tx DMA channel */
+    UART_TxQueueFlush(huart);
+
     huart->TxXferCount = 0U;
 
 #if !defined(USART_DMAREQUESTS_SW_WA)
@@ -3800,6 +3980,49 @@ static void UART_DMATransmitCplt(DMA_HandleTypeDef *hdma)
   }
 }
 
+/**
+  * @brief  Restart the Tx DMA channel on the queued node it has not fetched.
+  * @note   The queue head is only used by HAL_DMAEx_List_Start_IT() to program the channel link register,
+  *         it is temporarily pointed on the node to restart from.
+  * @param  huart UART handle.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef UART_TxQueueRestart(UART_HandleTypeDef *huart)
+{
+  DMA_QListTypeDef *pqueue = huart->hdmatx->LinkedListQueue;
+  DMA_NodeTypeDef *phead = pqueue->Head;
+  HAL_StatusTypeDef status;
+
+  pqueue->Head = huart->pTxQueueRestart;
+  huart->pTxQueueRestart = NULL;
+
+  status = HAL_DMAEx_List_Start_IT(huart->hdmatx);
+
+  pqueue->Head = phead;
+
+  return status;
+}
+
+/**
+  * @brief  Unlink the nodes appended by HAL_UARTEx_TransmitQueue_DMA() from the Tx DMA queue.
+  * @note   Only the first node of the queue, configured by the application, is kept.
+  * @param  huart UART handle.
+  * @retval None
+  */
+static void UART_TxQueueFlush(UART_HandleTypeDef *huart)
+{
+  if (huart->TxQueueNbr != 0U)
+  {
+    while (huart->hdmatx->LinkedListQueue->NodeNumber > 1U)
+    {
+      (void)HAL_DMAEx_List_RemoveNode_Tail(huart->hdmatx->LinkedListQueue);
+    }
+
+    huart->TxQueueNbr = 0U;
+    huart->pTxQueueRestart = NULL;
+  }
+}
+
 /**
   * @brief DMA UART transmit process half complete callback.
   * @param hdma DMA handle.
@@ -3832,9 +4055,10 @@ static void UART_DMAReceiveCplt(DMA_HandleTypeDef *hdma)
   {
     huart->RxXferCount = 0U;
 
-    /* Disable PE and ERR (Frame error, noise error, overrun error) interrupts */
+    /* Disable PE and ERR (Frame error, noise error, overrun error) interrupts, and the RX FIFO
+       threshold interrupt used as wake-up source by HAL_UARTEx_ReceiveInStopMode_DMA() */
     ATOMIC_CLEAR_BIT(huart->Instance->CR1, USART_CR1_PEIE);
-    ATOMIC_CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE);
+    ATOMIC_CLEAR_BIT(huart->Instance->CR3, (USART_CR3_EIE | USART_CR3_RXFTIE));
 
 #if !defined(USART_DMAREQUESTS_SW_WA)
     /* Disable the DMA transfer for the receiver request by resetting the DMAR bit
@@ -3872,6 +4096,9 @@ static void UART_DMAReceiveCplt(DMA_HandleTypeDef *hdma)
       huart->RxXferCount = nb_remaining_rx_data;
     }
 
+    /* Publish received data to the Rx stream ring, if any */
+    UART_RxStreamUpdate(huart, (huart->RxXferSize - huart->RxXferCount));
+
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     /*Call registered Rx Event callback*/
     huart->RxEventCallback(huart, (huart->RxXferSize - huart->RxXferCount));
@@ -3920,6 +4147,9 @@ static void UART_DMARxHalfCplt(DMA_HandleTypeDef *hdma)
       huart->RxXferCount = nb_remaining_rx_data;
     }
 
+    /* Publish received data to the Rx stream ring, if any */
+    UART_RxStreamUpdate(huart, (huart->RxXferSize - huart->RxXferCount));
+
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     /*Call registered Rx Event callback*/
     huart->RxEventCallback(huart, (huart->RxXferSize - huart->RxXferCount));
@@ -3941,6 +4171,85 @@ static void UART_DMARxHalfCplt(DMA_HandleTypeDef *hdma)
   }
 }
 
+/**
+  * @brief  Publish the data received by DMA to the Rx stream ring, if a Rx stream is ongoing.
+  * @note   Called from interrupt context on each HT, TC or IDLE event. As the DMA is in circular mode and
+  *         events are raised at least every half buffer, the progress since the previous event is always
+  *         lower than the buffer size.
+  * @param  huart UART handle.
+  * @param  Pos   Current DMA write position in the stream ring (0 to Size).
+  * @retval None
+  */
+static void UART_RxStreamUpdate(UART_HandleTypeDef *huart, uint16_t Pos)
+{
+  UART_RxStreamTypeDef *pstream = huart->pRxStream;
+  uint32_t newpos;
+  uint32_t nb_rx_data;
+
+  if (pstream != NULL)
+  {
+    newpos = ((uint32_t)Pos < pstream->Size) ? (uint32_t)Pos : 0U;
+    nb_rx_data = ((newpos + pstream->Size) - pstream->LastPos) % pstream->Size;
+    pstream->LastPos = (uint16_t)newpos;
+
+    if (nb_rx_data != 0U)
+    {
+      /* Make sure data written by DMA are visible before publishing the new write count */
+      __DMB();
+      pstream->WriteCount += nb_rx_data;
+
+      /* Check if not yet consumed data have been overwritten */
+      if ((pstream->WriteCount - pstream->ReadCount) > pstream->Size)
+      {
+        pstream->OverrunCount++;
+      }
+    }
+  }
+}
+
+/**
+  * @brief  Notify the frame ended by a character match or receiver timeout event in the Rx stream ring.
+  * @note   Called from interrupt context. The frame ends at the DMA write position read when the event is
+  *         serviced, the data of the frame are published to the ring before the callback execution.
+  *         A frame longer than the ring has been partly overwritten : it is dropped and counted as an overrun.
+  * @param  huart UART handle.
+  * @retval None
+  */
+static void UART_RxFrameUpdate(UART_HandleTypeDef *huart)
+{
+  UART_RxStreamTypeDef *pstream = huart->pRxStream;
+  uint16_t nb_remaining_rx_data = (uint16_t) __HAL_DMA_GET_COUNTER(huart->hdmarx);
+  uint32_t nb_frame_data;
+  uint16_t offset;
+
+  /* Publish the data received up to the frame delimiter */
+  UART_RxStreamUpdate(huart, (huart->RxXferSize - nb_remaining_rx_data));
+
+  nb_frame_data = pstream->WriteCount - pstream->FrameStart;
+  if (nb_frame_data == 0U)
+  {
+    /* Delimiter event with no new data (e.g. receiver timeout following a character match) */
+    return;
+  }
+
+  offset = (uint16_t)(pstream->FrameStart % pstream->Size);
+  pstream->FrameStart = pstream->WriteCount;
+
+  if (nb_frame_data > pstream->Size)
+  {
+    pstream->OverrunCount++;
+    return;
+  }
+
+#if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
+  /*Call registered Rx Frame callback*/
+  huart->RxFrameCallback(huart, offset, (uint16_t)nb_frame_data);
+#else
+  /*Call legacy weak Rx Frame callback*/
+  HAL_UARTEx_RxFrameCallback(huart, offset, (uint16_t)nb_frame_data);
+#endif /* (USE_HAL_UART_REGISTER_CALLBACKS) */
+}
+
 /**
   * @brief DMA UART communication error callback.
   * @param hdma DMA handle.
@@ -4158,7 +4467,7 @@ static void UART_DMARxOnlyAbortCallback(DMA_HandleTypeDef *hdma)
   HAL_UART_AbortReceiveCpltCallback(huart);
 #endif /* USE_HAL_UART_REGISTER_CALLBACKS */
 }
-#endif /* HAL_DMA_MODULE_ENABLED */
+#endif /* HAL_UART_DMA_ENABLED */
 
 /**
   * @brief TX interrupt handler for 7 or 8 bits data word length .
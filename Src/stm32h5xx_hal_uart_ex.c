@@ -260,6 +260,8 @@ HAL_StatusTypeDef HAL_RS485Ex_Init(UART_HandleTypeDef *huart, uint32_t Polarity,
     (#) TX/RX Fifos Callbacks:
         (++) HAL_UARTEx_RxFifoFullCallback()
         (++) HAL_UARTEx_TxFifoEmptyCallback()
+    (#) Rx stream frame Callback:
+        (++) HAL_UARTEx_RxFrameCallback()
 @endverbatim
   * @{
   */
@@ -309,6 +311,28 @@ __weak void HAL_UARTEx_TxFifoEmptyCallback(UART_HandleTypeDef *huart)
    */
 }
 
+/**
+  * @brief  UART Rx stream frame callback.
+  * @note   Called from interrupt context when a frame delimiter event has been detected
+  *         on a reception started with HAL_UARTEx_StreamStartFraming().
+  * @param  huart  UART handle.
+  * @param  Offset Offset of the first byte of the frame in the Rx stream ring buffer.
+  * @param  Length Length of the frame in bytes. The frame wraps to the start of the ring buffer
+  *                when (Offset + Length) is greater than the ring size.
+  * @retval None
+  */
+__weak void HAL_UARTEx_RxFrameCallback(UART_HandleTypeDef *huart, uint16_t Offset, uint16_t Length)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(huart);
+  UNUSED(Offset);
+  UNUSED(Length);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_UARTEx_RxFrameCallback can be implemented in the user file.
+   */
+}
+
 /**
   * @}
   */
@@ -367,6 +391,47 @@ __weak void HAL_UARTEx_TxFifoEmptyCallback(UART_HandleTypeDef *huart)
     (#) Non-Blocking mode API with DMA:
         (++) HAL_UARTEx_ReceiveToIdle_DMA()
 
+    (#) Reception with DMA while the MCU is in Stop mode (low-power sensor links):
+        (++) The DMA is not clocked in Stop mode : the received data are kept in the Rx FIFO and
+             HAL_UARTEx_ReceiveInStopMode_DMA() selects the Rx FIFO threshold event as wake-up source, instead
+             of one wake-up per received data.
+        (++) The kernel clock of the UART must remain available in Stop mode (LSE, or HSI/CSI with the
+             wake-up capability), and the FIFO mode must be enabled (HAL_UARTEx_EnableFifoMode()).
+        (++) On each wake-up, the DMA empties the Rx FIFO in SRAM as soon as the system clock is restored,
+             and the application can enter Stop mode again.
+        (++) HAL_UART_RxCpltCallback() is executed once the whole frame has been received.
+        (++) HAL_UARTEx_DisableStopMode() disables the UART in Stop mode once the reception is over.
+
+    (#) Queued transmission with DMA linked-list (Tx queue):
+        (++) HAL_UARTEx_TransmitQueue_DMA() starts a transmission when the UART is ready, or appends the
+             message at the tail of the Tx DMA queue while the transfer is running, so that back-to-back
+             messages are sent without waiting for the Tx complete callback.
+        (++) The Tx DMA channel has to be configured in linear linked-list mode (DMA_LINKEDLIST_NORMAL),
+             with the transfer complete event generated at the end of the last linked-list item
+             (DMA_TCEM_LAST_LL_ITEM_TRANSFER). Its queue first node is used as template for appended nodes.
+        (++) HAL_UART_TxCpltCallback() is executed once, when all queued messages have been sent.
+
+    (#) Continuous reception in a DMA circular ring (Rx stream):
+        (++) HAL_UARTEx_StreamStart() starts the reception in the user ring buffer. The Rx DMA channel
+             has to be configured in circular linked-list mode (DMA_LINKEDLIST_CIRCULAR).
+        (++) Written data are published on each HT, TC and IDLE event, from interrupt context.
+             The HAL_UARTEx_RxEventCallback() user callback is still executed on each of these events.
+        (++) HAL_UARTEx_StreamGetAvailable(), HAL_UARTEx_StreamPeek(), HAL_UARTEx_StreamConsume() and
+             HAL_UARTEx_StreamRead() allow a single consumer to process received data without
+             disabling interrupts.
+        (++) HAL_UARTEx_StreamGetOverrun() returns the number of detected ring overruns.
+        (++) HAL_UARTEx_StreamStop() stops the reception.
+
+    (#) Frame delimitation in the Rx stream ring (character match and/or receiver timeout):
+        (++) HAL_UARTEx_StreamStartFraming() starts a Rx stream and enables the selected delimiter
+             events of UART_RxFrameConfTypeDef : UART_RXFRAME_CHARMATCH for line based protocols
+             (e.g. '\n'), UART_RXFRAME_RTO for silence based protocols (e.g. Modbus RTU).
+        (++) On each delimiter event, HAL_UARTEx_RxFrameCallback() (or the callback registered with
+             HAL_UART_RegisterRxFrameCallback()) provides the offset and length of the complete frame
+             in the ring, received data being never scanned by the CPU.
+        (++) The frame is then read with HAL_UARTEx_StreamRead() or accessed in place, then released
+             with HAL_UARTEx_StreamConsume().
+
 @endverbatim
   * @{
   */
@@ -887,7 +952,7 @@ HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_IT(UART_HandleTypeDef *huart, uint8_t
   }
 }
 
-#if defined(HAL_DMA_MODULE_ENABLED)
+#if defined(HAL_UART_DMA_ENABLED)
 /**
   * @brief Receive an amount of data in DMA mode till either the expected number
   *        of data is received or an IDLE event occurs.
@@ -921,6 +986,9 @@ HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_
     huart->ReceptionType = HAL_UART_RECEPTION_TOIDLE;
     huart->RxEventType = HAL_UART_RXEVENT_TC;
 
+    /* No Rx stream ring attached to this reception */
+    huart->pRxStream = NULL;
+
     status =  UART_Start_Receive_DMA(huart, pData, Size);
 
     /* Check Rx process has been successfully started */
@@ -948,7 +1016,540 @@ HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_
     return HAL_BUSY;
   }
 }
-#endif /* HAL_DMA_MODULE_ENABLED */
+
+/**
+  * @brief Receive an amount of data in DMA mode, the MCU being allowed to enter Stop mode in between.
+  * @note  The DMA is not clocked in Stop mode : received data are buffered in the Rx FIFO, and the
+  *        Rx FIFO threshold interrupt wakes the MCU up. The DMA then transfers the FIFO content to the
+  *        reception buffer, and the MCU can enter Stop mode again. Only one wake-up occurs per Threshold
+  *        data instead of one per data with the UART_WAKEUP_ON_READDATA_NONEMPTY wake-up source.
+  * @note  The threshold must leave enough free FIFO locations to cover the Stop mode exit time at the
+  *        used baud rate, otherwise an overrun error occurs.
+  * @note  The FIFO mode must be enabled and no transmission must be ongoing (the UART is disabled while
+  *        the threshold is programmed). UART Stop mode is enabled and remains enabled at the end of the
+  *        reception (see HAL_UARTEx_DisableStopMode()).
+  * @note  HAL_UART_RxCpltCallback() is executed when Size data have been received.
+  * @note  When UART parity is not enabled (PCE = 0), and Word Length is configured to 9 bits (M1-M0 = 01),
+  *        the received data is handled as a set of u16. In this case, Size must indicate the number
+  *        of u16 available through pData.
+  * @param huart     UART handle.
+  * @param pData     Pointer to data buffer (u8 or u16 data elements).
+  * @param Size      Amount of data elements (u8 or u16) to be received.
+  * @param Threshold Rx FIFO threshold waking the MCU up.
+  *                  This parameter can be one of the following values:
+  *                    @arg @ref UART_RXFIFO_THRESHOLD_1_8
+  *                    @arg @ref UART_RXFIFO_THRESHOLD_1_4
+  *                    @arg @ref UART_RXFIFO_THRESHOLD_1_2
+  *                    @arg @ref UART_RXFIFO_THRESHOLD_3_4
+  *                    @arg @ref UART_RXFIFO_THRESHOLD_7_8
+  *                    @arg @ref UART_RXFIFO_THRESHOLD_8_8
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UARTEx_ReceiveInStopMode_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size,
+                                                   uint32_t Threshold)
+{
+  HAL_StatusTypeDef status;
+
+  /* Check the parameters */
+  assert_param(IS_UART_WAKEUP_FROMSTOP_INSTANCE(huart->Instance));
+  assert_param(IS_UART_FIFO_INSTANCE(huart->Instance));
+  assert_param(IS_UART_RXFIFO_THRESHOLD(Threshold));
+
+  /* Check that no Rx or Tx process is ongoing */
+  if ((huart->RxState != HAL_UART_STATE_READY) || (huart->gState != HAL_UART_STATE_READY))
+  {
+    return HAL_BUSY;
+  }
+
+  if ((pData == NULL) || (Size == 0U) || (huart->FifoMode != UART_FIFOMODE_ENABLE))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Program the wake-up threshold */
+  status = HAL_UARTEx_SetRxFifoThreshold(huart, Threshold);
+
+  if (status == HAL_OK)
+  {
+    /* Set Reception type to Standard reception */
+    huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+
+    status = UART_Start_Receive_DMA(huart, pData, Size);
+  }
+
+  if (status == HAL_OK)
+  {
+    /* Keep the UART running in Stop mode and wake the MCU up on the Rx FIFO threshold */
+    ATOMIC_SET_BIT(huart->Instance->CR1, USART_CR1_UESM);
+    ATOMIC_SET_BIT(huart->Instance->CR3, USART_CR3_RXFTIE);
+  }
+
+  return status;
+}
+
+/**
+  * @brief Send a message in DMA mode, appending it to the ongoing queued transmission if any.
+  * @note  When the UART is ready, the message is sent from the Tx DMA queue first node, as done by
+  *        HAL_UART_Transmit_DMA(), and pNode is not used.
+  *        When a queued transmission is ongoing, the message is described in pNode which is linked
+  *        at the tail of the Tx DMA queue.
+  * @note  pNode and pData must be kept unchanged until HAL_UART_TxCpltCallback() is executed.
+  * @note  Once the DMA channel has completed the queue, messages are no longer appended and
+  *        HAL_BUSY is returned until the end of transmission.
+  * @note  When UART parity is not enabled (PCE = 0), and Word Length is configured to 9 bits (M1-M0 = 01),
+  *        the sent data is handled as a set of u16. In this case, Size must indicate the number
+  *        of u16 provided through pData.
+  * @param huart UART handle.
+  * @param pNode Pointer to the DMA node used to append the message.
+  * @param pData Pointer to data buffer (u8 or u16 data elements).
+  * @param Size  Amount of data elements (u8 or u16) to be sent.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UARTEx_TransmitQueue_DMA(UART_HandleTypeDef *huart, DMA_NodeTypeDef *pNode,
+                                               const uint8_t *pData, uint16_t Size)
+{
+  DMA_NodeConfTypeDef node_config;
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t nbByte = Size;
+  uint32_t primask_bit;
+
+  if ((pData == NULL) || (Size == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  if ((huart->hdmatx == NULL) || (huart->hdmatx->Mode != DMA_LINKEDLIST_NORMAL) ||
+      (huart->hdmatx->LinkedListQueue == NULL) || (huart->hdmatx->LinkedListQueue->Head == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* In case of 9bits/No Parity transfer, pData buffer provided as input parameter
+     should be aligned on a u16 frontier, so nbByte should be equal to Size * 2 */
+  if ((huart->Init.WordLength == UART_WORDLENGTH_9B) && (huart->Init.Parity == UART_PARITY_NONE))
+  {
+    nbByte = (uint32_t)Size * 2U;
+  }
+
+  /* Queue update must not be interleaved with the Tx DMA transfer complete processing */
+  primask_bit = __get_PRIMASK();
+  __set_PRIMASK(1);
+
+  if (huart->gState == HAL_UART_STATE_READY)
+  {
+    status = HAL_UART_Transmit_DMA(huart, pData, Size);
+    if (status == HAL_OK)
+    {
+      huart->TxQueueNbr = 1U;
+      huart->pTxQueueRestart = NULL;
+    }
+  }
+  else if ((huart->gState == HAL_UART_STATE_BUSY_TX) && (huart->TxQueueNbr != 0U))
+  {
+    if (pNode == NULL)
+    {
+      status = HAL_ERROR;
+    }
+    else
+    {
+      /* Build the new node from the queue first node configuration */
+      status = HAL_DMAEx_List_GetNodeConfig(&node_config, huart->hdmatx->LinkedListQueue->Head);
+      if (status == HAL_OK)
+      {
+        node_config.SrcAddress = (uint32_t)pData;
+        node_config.DstAddress = (uint32_t)&huart->Instance->TDR;
+        node_config.DataSize   = nbByte;
+        status = HAL_DMAEx_List_BuildNode(&node_config, pNode);
+      }
+
+      if (status == HAL_OK)
+      {
+        status = HAL_DMAEx_List_InsertNode_Tail(huart->hdmatx->LinkedListQueue, pNode);
+      }
+
+      if (status == HAL_OK)
+      {
+        /* Make sure the new link is written before checking the channel link register :
+           a null link means the channel already fetched the previous tail node and will stop after it */
+        __DSB();
+        if ((huart->pTxQueueRestart == NULL) && (huart->hdmatx->Instance->CLLR == 0U))
+        {
+          huart->pTxQueueRestart = pNode;
+        }
+
+        huart->TxQueueNbr++;
+      }
+    }
+  }
+  else
+  {
+    status = HAL_BUSY;
+  }
+
+  __set_PRIMASK(primask_bit);
+
+  return status;
+}
+
+/**
+  * @brief Start a continuous reception in a DMA circular ring buffer (Rx stream).
+  * @note  The Rx DMA channel must be configured in circular linked-list mode (DMA_LINKEDLIST_CIRCULAR).
+  *        The reception is never ended by HT, TC or IDLE events : each of them publishes the data received
+  *        so far in the ring, then calls the Rx Event callback.
+  * @note  Only 8-bit data elements are supported (9-bit word length without parity is rejected).
+  * @note  Overrun of unread data is detected at event granularity : the consumer should keep the amount of
+  *        unread data below half of the ring size.
+  * @param huart   UART handle.
+  * @param pStream Pointer to the Rx stream ring structure, to be kept valid until HAL_UARTEx_StreamStop().
+  * @param pBuffer Pointer to the ring buffer.
+  * @param Size    Size of the ring buffer in bytes.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UARTEx_StreamStart(UART_HandleTypeDef *huart, UART_RxStreamTypeDef *pStream, uint8_t *pBuffer,
+                                         uint16_t Size)
+{
+  HAL_StatusTypeDef status;
+
+  /* Check that a Rx process is not already ongoing */
+  if (huart->RxState == HAL_UART_STATE_READY)
+  {
+    if ((pStream == NULL) || (pBuffer == NULL) || (Size < 2U))
+    {
+      return HAL_ERROR;
+    }
+
+    /* The ring is only meaningful on top of a circular DMA channel */
+    if ((huart->hdmarx == NULL) || (huart->hdmarx->Mode != DMA_LINKEDLIST_CIRCULAR))
+    {
+      return HAL_ERROR;
+    }
+
+    /* 16-bit data elements are not supported by the stream ring */
+    if ((huart->Init.WordLength == UART_WORDLENGTH_9B) && (huart->Init.Parity == UART_PARITY_NONE))
+    {
+      return HAL_ERROR;
+    }
+
+    pStream->pBuffer      = pBuffer;
+    pStream->Size         = Size;
+    pStream->LastPos      = 0U;
+    pStream->WriteCount   = 0U;
+    pStream->ReadCount    = 0U;
+    pStream->OverrunCount = 0U;
+    pStream->FrameDelimiter = 0U;
+    pStream->FrameStart   = 0U;
+
+    /* Set Reception type to reception till IDLE Event*/
+    huart->ReceptionType = HAL_UART_RECEPTION_TOIDLE;
+    huart->RxEventType = HAL_UART_RXEVENT_TC;
+    huart->pRxStream = pStream;
+
+    status =  UART_Start_Receive_DMA(huart, pBuffer, Size);
+
+    /* Check Rx process has been successfully started */
+    if (status == HAL_OK)
+    {
+      if (huart->ReceptionType == HAL_UART_RECEPTION_TOIDLE)
+      {
+        __HAL_UART_CLEAR_FLAG(huart, UART_CLEAR_IDLEF);
+        ATOMIC_SET_BIT(huart->Instance->CR1, USART_CR1_IDLEIE);
+      }
+      else
+      {
+        /* Reception has already been aborted on a pending error (see HAL_UARTEx_ReceiveToIdle_DMA()) */
+        status = HAL_ERROR;
+      }
+    }
+
+    if (status != HAL_OK)
+    {
+      huart->pRxStream = NULL;
+    }
+
+    return status;
+  }
+  else
+  {
+    return HAL_BUSY;
+  }
+}
+
+/**
+  * @brief Start a continuous reception in a DMA circular ring buffer, delimited in frames by the
+  *        character match and/or receiver timeout events.
+  * @note  The Rx stream is started as with HAL_UARTEx_StreamStart(), with the same DMA requirements.
+  *        On each delimiter event, the data received since the previous frame are published in the ring
+  *        and notified as a frame through HAL_UARTEx_RxFrameCallback().
+  * @note  The match character is configured with the UART disabled : no transmission must be ongoing.
+  * @note  The receiver timeout is not available on LPUART instances.
+  * @param huart   UART handle.
+  * @param pStream Pointer to the Rx stream ring structure, to be kept valid until HAL_UARTEx_StreamStop().
+  * @param pBuffer Pointer to the ring buffer.
+  * @param Size    Size of the ring buffer in bytes.
+  * @param pConfig Pointer to the frame delimiter configuration.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UARTEx_StreamStartFraming(UART_HandleTypeDef *huart, UART_RxStreamTypeDef *pStream,
+                                                uint8_t *pBuffer, uint16_t Size,
+                                                const UART_RxFrameConfTypeDef *pConfig)
+{
+  HAL_StatusTypeDef status;
+  uint32_t its = 0U;
+
+  if (pConfig == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_UART_RXFRAME_DELIMITER(pConfig->Delimiter));
+
+  if ((huart->RxState != HAL_UART_STATE_READY) || (huart->gState != HAL_UART_STATE_READY))
+  {
+    return HAL_BUSY;
+  }
+
+  if ((pConfig->Delimiter & UART_RXFRAME_RTO) != 0U)
+  {
+    if (IS_LPUART_INSTANCE(huart->Instance))
+    {
+      return HAL_ERROR;
+    }
+    assert_param(IS_UART_RECEIVER_TIMEOUT_VALUE(pConfig->ReceiverTimeout));
+
+    HAL_UART_ReceiverTimeout_Config(huart, pConfig->ReceiverTimeout);
+    SET_BIT(huart->Instance->CR2, USART_CR2_RTOEN);
+    its |= USART_CR1_RTOIE;
+  }
+
+  if ((pConfig->Delimiter & UART_RXFRAME_CHARMATCH) != 0U)
+  {
+    /* The match character can only be written with the UART disabled */
+    __HAL_UART_DISABLE(huart);
+    MODIFY_REG(huart->Instance->CR2, (USART_CR2_ADDM7 | USART_CR2_ADD),
+               (UART_ADDRESS_DETECT_7B | ((uint32_t)pConfig->MatchChar << UART_CR2_ADDRESS_LSB_POS)));
+    __HAL_UART_ENABLE(huart);
+    its |= USART_CR1_CMIE;
+  }
+
+  status = HAL_UARTEx_StreamStart(huart, pStream, pBuffer, Size);
+
+  if (status == HAL_OK)
+  {
+    pStream->FrameDelimiter = pConfig->Delimiter;
+
+    __HAL_UART_CLEAR_FLAG(huart, (UART_CLEAR_CMF | UART_CLEAR_RTOF));
+    ATOMIC_SET_BIT(huart->Instance->CR1, its);
+  }
+  else if ((pConfig->Delimiter & UART_RXFRAME_RTO) != 0U)
+  {
+    CLEAR_BIT(huart->Instance->CR2, USART_CR2_RTOEN);
+  }
+  else
+  {
+    /* Nothing to restore */
+  }
+
+  return status;
+}
+
+/**
+  * @brief Stop the continuous reception started by HAL_UARTEx_StreamStart().
+  * @note  Data not yet consumed remain available until the next HAL_UARTEx_StreamStart() call.
+  * @param huart UART handle.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UARTEx_StreamStop(UART_HandleTypeDef *huart)
+{
+  HAL_StatusTypeDef status;
+
+  if (huart->pRxStream == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Disable the frame delimiter events, if any */
+  if (huart->pRxStream->FrameDelimiter != 0U)
+  {
+    ATOMIC_CLEAR_BIT(huart->Instance->CR1, (USART_CR1_CMIE | USART_CR1_RTOIE));
+    if ((huart->pRxStream->FrameDelimiter & UART_RXFRAME_RTO) != 0U)
+    {
+      CLEAR_BIT(huart->Instance->CR2, USART_CR2_RTOEN);
+    }
+    huart->pRxStream->FrameDelimiter = 0U;
+  }
+
+  status = HAL_UART_AbortReceive(huart);
+
+  huart->pRxStream = NULL;
+
+  return status;
+}
+
+/**
+  * @brief Return the number of received bytes not yet consumed in the Rx stream ring.
+  * @note  When an overrun has occurred, the returned value is clamped to the ring size.
+  * @param huart UART handle.
+  * @retval Number of available bytes
+  */
+uint16_t HAL_UARTEx_StreamGetAvailable(const UART_HandleTypeDef *huart)
+{
+  const UART_RxStreamTypeDef *pstream = huart->pRxStream;
+  uint32_t nb_data;
+
+  if (pstream == NULL)
+  {
+    return 0U;
+  }
+
+  nb_data = pstream->WriteCount - pstream->ReadCount;
+
+  return (nb_data > pstream->Size) ? pstream->Size : (uint16_t)nb_data;
+}
+
+/**
+  * @brief Copy received bytes from the Rx stream ring without consuming them.
+  * @param huart UART handle.
+  * @param pData Pointer to the destination buffer.
+  * @param Size  Number of bytes to copy.
+  * @retval HAL status : HAL_ERROR if less than Size bytes are available or if an overrun
+  *         has been detected (HAL_UARTEx_StreamConsume() or HAL_UARTEx_StreamRead() resynchronize the ring).
+  */
+HAL_StatusTypeDef HAL_UARTEx_StreamPeek(const UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size)
+{
+  const UART_RxStreamTypeDef *pstream = huart->pRxStream;
+  uint32_t rdcount;
+  uint32_t nb_data;
+  uint32_t index;
+  uint32_t count;
+
+  if ((pstream == NULL) || (pData == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  rdcount = pstream->ReadCount;
+  nb_data = pstream->WriteCount - rdcount;
+  if ((nb_data > pstream->Size) || (Size > nb_data))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Read the published write count before the ring content */
+  __DMB();
+
+  index = rdcount % pstream->Size;
+  for (count = 0U; count < Size; count++)
+  {
+    pData[count] = pstream->pBuffer[index];
+    index++;
+    if (index == pstream->Size)
+    {
+      index = 0U;
+    }
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief Release bytes from the Rx stream ring.
+  * @note  If an overrun has been detected, the whole ring content is dropped and HAL_ERROR is returned.
+  * @param huart UART handle.
+  * @param Size  Number of bytes to release.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UARTEx_StreamConsume(UART_HandleTypeDef *huart, uint16_t Size)
+{
+  UART_RxStreamTypeDef *pstream = huart->pRxStream;
+  uint32_t wrcount;
+  uint32_t nb_data;
+
+  if (pstream == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  wrcount = pstream->WriteCount;
+  nb_data = wrcount - pstream->ReadCount;
+  if (nb_data > pstream->Size)
+  {
+    /* Unread data have been overwritten : resynchronize on the write position */
+    pstream->ReadCount = wrcount;
+    return HAL_ERROR;
+  }
+
+  if (Size > nb_data)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Complete ring content reads before releasing the room to the producer */
+  __DMB();
+  pstream->ReadCount += Size;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief Read and consume up to Size bytes from the Rx stream ring.
+  * @param huart    UART handle.
+  * @param pData    Pointer to the destination buffer.
+  * @param Size     Maximum number of bytes to read.
+  * @param pReadLen Pointer to the number of bytes actually read.
+  * @retval HAL status : HAL_ERROR if an overrun has been detected, in which case the ring content
+  *         is dropped and no data is read.
+  */
+HAL_StatusTypeDef HAL_UARTEx_StreamRead(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size, uint16_t *pReadLen)
+{
+  uint16_t nb_data;
+
+  if ((huart->pRxStream == NULL) || (pData == NULL) || (pReadLen == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  *pReadLen = 0U;
+
+  if ((huart->pRxStream->WriteCount - huart->pRxStream->ReadCount) > huart->pRxStream->Size)
+  {
+    return HAL_UARTEx_StreamConsume(huart, 0U);
+  }
+
+  nb_data = HAL_UARTEx_StreamGetAvailable(huart);
+  if (nb_data > Size)
+  {
+    nb_data = Size;
+  }
+
+  if (nb_data != 0U)
+  {
+    if (HAL_UARTEx_StreamPeek(huart, pData, nb_data) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+
+    if (HAL_UARTEx_StreamConsume(huart, nb_data) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  *pReadLen = nb_data;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief Return the number of overruns detected on the Rx stream ring since HAL_UARTEx_StreamStart().
+  * @param huart UART handle.
+  * @retval Number of detected overruns
+  */
+uint32_t HAL_UARTEx_StreamGetOverrun(const UART_HandleTypeDef *huart)
+{
+  return (huart->pRxStream != NULL) ? huart->pRxStream->OverrunCount : 0U;
+}
+#endif /* HAL_UART_DMA_ENABLED */
 
 /**
   * @brief Provide Rx Event type that has lead to RxEvent callback execution.
@@ -0,0 +1,1185 @@
+/**
+  ******************************************************************************
+  * @file    stm32h5xx_hal_ucpd.c
+  * @author  MCD Application Team
+  * @brief   UCPD HAL module driver.
+  *          This file provides firmware functions to manage the USB Power
+  *          Delivery PHY of the UCPD peripheral:
+  *           + Initialization and de-initialization functions
+  *           + IO operation functions
+  *           + Peripheral Control functions
+  *           + Peripheral State and Error functions
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2023 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  @verbatim
+  ==============================================================================
+                        ##### How to use this driver #####
+  ==============================================================================
+    [..]
+      The UCPD HAL driver handles the Power Delivery message layer of the PHY:
+      BMC coding, 4b5b coding and CRC generation/check are done by the UCPD
+      hardware, messages are moved by DMA and the driver only acts at message
+      boundaries. The Type-C attach detection (CC resistors, CC voltage
+      monitoring) is left to the LL UCPD functions.
+
+      (#) Initialize the UCPD low level resources by implementing the HAL_UCPD_MspInit():
+          (++) Enable the UCPD interface clock using __HAL_RCC_UCPD1_CLK_ENABLE()
+          (++) Configure the CC1 and CC2 pins in analog mode
+          (++) Configure two GPDMA channels, one for UCPD1_TX requests (memory to
+               peripheral) and one for UCPD1_RX requests (peripheral to memory),
+               both with byte data width and in normal mode, and link them to the
+               handle using __HAL_LINKDMA() with hdmatx and hdmarx
+          (++) Configure the UCPD1 interrupt priority using HAL_NVIC_SetPriority(),
+               enable it using HAL_NVIC_EnableIRQ() and call HAL_UCPD_IRQHandler()
+               from UCPD1_IRQHandler()
+
+      (#) Fill the Init structure (clock dividers, CC line, detected ordered sets,
+          GoodCRC parameters) and call HAL_UCPD_Init().
+
+      (#) Call HAL_UCPD_Receive_DMA() with a buffer large enough for the largest
+          expected message (30 bytes for non-extended messages). The reception
+          stays enabled: for each valid message
+          (++) a GoodCRC is sent back by the driver, when AutoGoodCRC is enabled,
+               before any callback is executed
+          (++) HAL_UCPD_RxCpltCallback() is executed with the payload size in
+               RxXferCount and the ordered set in RxOrderSet. The buffer is
+               re-armed when the callback returns, so the callback must copy
+               the message and return quickly
+          (++) messages received with a CRC or coding error are dropped without
+               GoodCRC and reported through HAL_UCPD_ErrorCallback()
+
+      (#) Call HAL_UCPD_Transmit_DMA() to send a message (header and data objects)
+          on a given ordered set. HAL_UCPD_TxCpltCallback() is executed when
+          the message has been sent. A message discarded because of an incoming
+          one or aborted is reported through HAL_UCPD_ErrorCallback(): the PD
+          protocol layer keeps the retry policy.
+
+      (#) Call HAL_UCPD_SendHardReset() to send a Hard Reset, any ongoing
+          transmission is aborted. HAL_UCPD_HardResetSentCallback() is executed
+          once it has been sent. A received Hard Reset aborts the ongoing
+          transmission and is reported through HAL_UCPD_HardResetReceivedCallback().
+
+      (#) Call HAL_UCPD_SetRoles() after a Power Role Swap or a Data Role Swap to
+          update the roles advertised in the GoodCRC header.
+
+    [..]
+      (@) The GoodCRC must start within tTransmit (195 us) after the end of the
+          received message. It is sent from the UCPD interrupt, the UCPD1 IRQ
+          must therefore have a priority higher than any long interrupt routine.
+
+    *** Callback registration ***
+    =============================================
+    [..]
+      The compilation define USE_HAL_UCPD_REGISTER_CALLBACKS when set to 1
+      allows the user to configure dynamically the driver callbacks.
+      Use Function HAL_UCPD_RegisterCallback() to register a user callback,
+      it allows to register following callbacks:
+        (+) TxCpltCallback            : Tx Complete Callback.
+        (+) RxCpltCallback            : Rx Complete Callback.
+        (+) HardResetReceivedCallback : Hard Reset received Callback.
+        (+) HardResetSentCallback     : Hard Reset sent Callback.
+        (+) ErrorCallback             : Error Callback.
+        (+) MspInitCallback           : UCPD MspInit.
+        (+) MspDeInitCallback         : UCPD MspDeInit.
+      Use function HAL_UCPD_UnRegisterCallback() to reset a callback to the default
+      weak function.
+
+      By default, after the HAL_UCPD_Init() and when the state is HAL_UCPD_STATE_RESET,
+      all callbacks are set to the corresponding weak functions. Exception done for
+      MspInit and MspDeInit functions that are reset to the legacy weak functions in
+      HAL_UCPD_Init()/HAL_UCPD_DeInit() only when these callbacks are null.
+
+      Callbacks can be registered/unregistered in HAL_UCPD_STATE_READY state only.
+      Exception done MspInit/MspDeInit that can be registered/unregistered in
+      HAL_UCPD_STATE_READY or HAL_UCPD_STATE_RESET state.
+
+      When the compilation define USE_HAL_UCPD_REGISTER_CALLBACKS is set to 0 or
+      not defined, the callback registration feature is not available and all
+      callbacks are set to the corresponding weak functions.
+
+  @endverbatim
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32h5xx_hal.h"
+
+/** @addtogroup STM32H5xx_HAL_Driver
+  * @{
+  */
+
+#if defined(UCPD1)
+#ifdef HAL_UCPD_MODULE_ENABLED
+
+/** @defgroup UCPD UCPD
+  * @brief UCPD HAL module driver
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/** @defgroup UCPD_Private_Constants UCPD Private Constants
+  * @{
+  */
+#define UCPD_HEADER_MSGTYPE_MSK      (0x001FU)  /*!< Message header Message Type field         */
+#define UCPD_HEADER_DATAROLE_POS     (5U)       /*!< Message header Port Data Role position    */
+#define UCPD_HEADER_SPECREV_POS      (6U)       /*!< Message header Specification Revision position */
+#define UCPD_HEADER_POWERROLE_POS    (8U)       /*!< Message header Port Power Role position   */
+#define UCPD_HEADER_MSGID_MSK        (0x0E00U)  /*!< Message header MessageID field            */
+#define UCPD_HEADER_NDO_EXT_MSK      (0xF000U)  /*!< Message header Data Objects and Extended fields */
+#define UCPD_MSGTYPE_GOODCRC         (0x0001U)  /*!< GoodCRC control message type              */
+
+#define UCPD_IT_TX                   (UCPD_IT_TXMSGSENT | UCPD_IT_TXMSGDISC | UCPD_IT_TXMSGABT | UCPD_IT_TXUND)
+#define UCPD_IT_HARDRESET_TX         (UCPD_IT_HRSTSENT | UCPD_IT_HRSTDISC)
+#define UCPD_IT_RX                   (UCPD_IT_RXORDDET | UCPD_IT_RXHRSTDET | UCPD_IT_RXOVR | UCPD_IT_RXMSGEND)
+/**
+  * @}
+  */
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+/** @addtogroup UCPD_Private_Functions
+  * @{
+  */
+static void UCPD_StartTransmit(UCPD_HandleTypeDef *hucpd, uint32_t TxOrderSet, const uint8_t *pData, uint16_t Size);
+static void UCPD_AbortTransmit(UCPD_HandleTypeDef *hucpd);
+static void UCPD_StartReceive(UCPD_HandleTypeDef *hucpd);
+static void UCPD_SendGoodCRC(UCPD_HandleTypeDef *hucpd, uint32_t RxOrderSet);
+static void UCPD_DMAError(DMA_HandleTypeDef *hdma);
+/**
+  * @}
+  */
+
+/* Exported functions --------------------------------------------------------*/
+/** @defgroup UCPD_Exported_Functions UCPD Exported Functions
+  * @{
+  */
+
+/** @defgroup UCPD_Exported_Functions_Group1 Initialization and de-initialization functions
+  *  @brief    Initialization and Configuration functions
+  *
+@verbatim
+ ===============================================================================
+            ##### Initialization and de-initialization functions #####
+ ===============================================================================
+    [..]  This section provides functions allowing to:
+      (+) Initialize the UCPD PHY and the associated handle
+      (+) DeInitialize the UCPD PHY
+      (+) Initialize the UCPD MSP (MCU Specific Package)
+      (+) De-Initialize the UCPD MSP
+      (+) Register and unregister the UCPD callbacks
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initialize the UCPD PHY according to the specified parameters
+  *         in the UCPD_InitTypeDef and initialize the associated handle.
+  * @note   The Tx and Rx DMA requests are enabled, the PHY receiver is enabled
+  *         by HAL_UCPD_Receive_DMA().
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UCPD_Init(UCPD_HandleTypeDef *hucpd)
+{
+  /* Check the UCPD handle allocation */
+  if (hucpd == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_UCPD_ALL_INSTANCE(hucpd->Instance));
+  assert_param(IS_UCPD_PRESCALER(hucpd->Init.Prescaler));
+  assert_param(IS_UCPD_TRANSWIN(hucpd->Init.TransWin));
+  assert_param(IS_UCPD_IFRGAP(hucpd->Init.IfrGap));
+  assert_param(IS_UCPD_HBITCLOCKDIV(hucpd->Init.HbitClockDiv));
+  assert_param(IS_UCPD_CCPIN(hucpd->Init.CCPin));
+  assert_param(IS_UCPD_RXORDERSET(hucpd->Init.RxOrderSet));
+  assert_param(IS_FUNCTIONAL_STATE(hucpd->Init.AutoGoodCRC));
+  assert_param(IS_UCPD_POWERROLE(hucpd->Init.PowerRole));
+  assert_param(IS_UCPD_DATAROLE(hucpd->Init.DataRole));
+  assert_param(IS_UCPD_SPECREVISION(hucpd->Init.SpecRevision));
+
+  if (hucpd->gState == HAL_UCPD_STATE_RESET)
+  {
+    /* Allocate lock resource and initialize it */
+    hucpd->Lock = HAL_UNLOCKED;
+
+#if (USE_HAL_UCPD_REGISTER_CALLBACKS == 1)
+    /* Reset callbacks to legacy weak functions */
+    hucpd->TxCpltCallback            = HAL_UCPD_TxCpltCallback;
+    hucpd->RxCpltCallback            = HAL_UCPD_RxCpltCallback;
+    hucpd->HardResetReceivedCallback = HAL_UCPD_HardResetReceivedCallback;
+    hucpd->HardResetSentCallback     = HAL_UCPD_HardResetSentCallback;
+    hucpd->ErrorCallback             = HAL_UCPD_ErrorCallback;
+
+    if (hucpd->MspInitCallback == NULL)
+    {
+      hucpd->MspInitCallback = HAL_UCPD_MspInit;
+    }
+
+    /* Init the low level hardware */
+    hucpd->MspInitCallback(hucpd);
+#else
+    /* Init the low level hardware : GPIO, CLOCK, DMA, NVIC */
+    HAL_UCPD_MspInit(hucpd);
+#endif /* USE_HAL_UCPD_REGISTER_CALLBACKS */
+  }
+
+  /* CFG1 can only be written while the peripheral is disabled */
+  LL_UCPD_Disable(hucpd->Instance);
+
+  MODIFY_REG(hucpd->Instance->CFG1,
+             UCPD_CFG1_PSC_UCPDCLK | UCPD_CFG1_TRANSWIN | UCPD_CFG1_IFRGAP | UCPD_CFG1_HBITCLKDIV |
+             UCPD_CFG1_RXORDSETEN | UCPD_CFG1_TXDMAEN | UCPD_CFG1_RXDMAEN,
+             hucpd->Init.Prescaler | (hucpd->Init.TransWin << UCPD_CFG1_TRANSWIN_Pos) |
+             (hucpd->Init.IfrGap << UCPD_CFG1_IFRGAP_Pos) | (hucpd->Init.HbitClockDiv << UCPD_CFG1_HBITCLKDIV_Pos) |
+             hucpd->Init.RxOrderSet | UCPD_CFG1_TXDMAEN | UCPD_CFG1_RXDMAEN);
+
+  LL_UCPD_Enable(hucpd->Instance);
+
+  /* Select the CC line, normal Tx and Rx modes */
+  LL_UCPD_SetCCPin(hucpd->Instance, hucpd->Init.CCPin);
+  LL_UCPD_SetRxMode(hucpd->Instance, LL_UCPD_RXMODE_NORMAL);
+  LL_UCPD_SetTxMode(hucpd->Instance, LL_UCPD_TXMODE_NORMAL);
+
+  hucpd->pRxBuffPtr = NULL;
+  hucpd->RxXferSize = 0U;
+  hucpd->RxXferCount = 0U;
+  hucpd->RxOrderSet = LL_UCPD_RXORDSET_SOP;
+
+  hucpd->ErrorCode = HAL_UCPD_ERROR_NONE;
+  hucpd->gState = HAL_UCPD_STATE_READY;
+  hucpd->RxState = HAL_UCPD_STATE_READY;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  DeInitialize the UCPD PHY.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UCPD_DeInit(UCPD_HandleTypeDef *hucpd)
+{
+  /* Check the UCPD handle allocation */
+  if (hucpd == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_UCPD_ALL_INSTANCE(hucpd->Instance));
+
+  /* Stop the ongoing transfers */
+  (void)HAL_UCPD_AbortReceive(hucpd);
+  UCPD_AbortTransmit(hucpd);
+  __HAL_UCPD_DISABLE_IT(hucpd, UCPD_IT_HARDRESET_TX);
+
+  LL_UCPD_Disable(hucpd->Instance);
+  CLEAR_BIT(hucpd->Instance->CFG1, UCPD_CFG1_TXDMAEN | UCPD_CFG1_RXDMAEN);
+
+#if (USE_HAL_UCPD_REGISTER_CALLBACKS == 1)
+  if (hucpd->MspDeInitCallback == NULL)
+  {
+    hucpd->MspDeInitCallback = HAL_UCPD_MspDeInit;
+  }
+
+  /* DeInit the low level hardware */
+  hucpd->MspDeInitCallback(hucpd);
+#else
+  /* DeInit the low level hardware: GPIO, CLOCK, DMA, NVIC */
+  HAL_UCPD_MspDeInit(hucpd);
+#endif /* USE_HAL_UCPD_REGISTER_CALLBACKS */
+
+  hucpd->pRxBuffPtr = NULL;
+  hucpd->ErrorCode = HAL_UCPD_ERROR_NONE;
+  hucpd->gState = HAL_UCPD_STATE_RESET;
+  hucpd->RxState = HAL_UCPD_STATE_RESET;
+
+  __HAL_UNLOCK(hucpd);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Initialize the UCPD MSP.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @retval None
+  */
+__weak void HAL_UCPD_MspInit(UCPD_HandleTypeDef *hucpd)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hucpd);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_UCPD_MspInit can be implemented in the user file
+   */
+}
+
+/**
+  * @brief  DeInitialize the UCPD MSP.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @retval None
+  */
+__weak void HAL_UCPD_MspDeInit(UCPD_HandleTypeDef *hucpd)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hucpd);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_UCPD_MspDeInit can be implemented in the user file
+   */
+}
+
+#if (USE_HAL_UCPD_REGISTER_CALLBACKS == 1)
+/**
+  * @brief  Register a User UCPD Callback.
+  *         To be used instead of the weak predefined callback.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @param  CallbackID ID of the callback to be registered
+  *         This parameter can be one of the following values:
+  *           @arg @ref HAL_UCPD_TX_COMPLETE_CB_ID Tx Complete Callback ID
+  *           @arg @ref HAL_UCPD_RX_COMPLETE_CB_ID Rx Complete Callback ID
+  *           @arg @ref HAL_UCPD_HARDRESET_RX_CB_ID Hard Reset received Callback ID
+  *           @arg @ref HAL_UCPD_HARDRESET_TX_CB_ID Hard Reset sent Callback ID
+  *           @arg @ref HAL_UCPD_ERROR_CB_ID Error Callback ID
+  *           @arg @ref HAL_UCPD_MSPINIT_CB_ID MspInit Callback ID
+  *           @arg @ref HAL_UCPD_MSPDEINIT_CB_ID MspDeInit Callback ID
+  * @param  pCallback pointer to the Callback function
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UCPD_RegisterCallback(UCPD_HandleTypeDef *hucpd, HAL_UCPD_CallbackIDTypeDef CallbackID,
+                                            pUCPD_CallbackTypeDef pCallback)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if (pCallback == NULL)
+  {
+    hucpd->ErrorCode |= HAL_UCPD_ERROR_INVALID_CALLBACK;
+    return HAL_ERROR;
+  }
+
+  if (hucpd->gState == HAL_UCPD_STATE_READY)
+  {
+    switch (CallbackID)
+    {
+      case HAL_UCPD_TX_COMPLETE_CB_ID :
+        hucpd->TxCpltCallback = pCallback;
+        break;
+
+      case HAL_UCPD_RX_COMPLETE_CB_ID :
+        hucpd->RxCpltCallback = pCallback;
+        break;
+
+      case HAL_UCPD_HARDRESET_RX_CB_ID :
+        hucpd->HardResetReceivedCallback = pCallback;
+        break;
+
+      case HAL_UCPD_HARDRESET_TX_CB_ID :
+        hucpd->HardResetSentCallback = pCallback;
+        break;
+
+      case HAL_UCPD_ERROR_CB_ID :
+        hucpd->ErrorCallback = pCallback;
+        break;
+
+      case HAL_UCPD_MSPINIT_CB_ID :
+        hucpd->MspInitCallback = pCallback;
+        break;
+
+      case HAL_UCPD_MSPDEINIT_CB_ID :
+        hucpd->MspDeInitCallback = pCallback;
+        break;
+
+      default :
+        hucpd->ErrorCode |= HAL_UCPD_ERROR_INVALID_CALLBACK;
+        status = HAL_ERROR;
+        break;
+    }
+  }
+  else if (hucpd->gState == HAL_UCPD_STATE_RESET)
+  {
+    switch (CallbackID)
+    {
+      case HAL_UCPD_MSPINIT_CB_ID :
+        hucpd->MspInitCallback = pCallback;
+        break;
+
+      case HAL_UCPD_MSPDEINIT_CB_ID :
+        hucpd->MspDeInitCallback = pCallback;
+        break;
+
+      default :
+        hucpd->ErrorCode |= HAL_UCPD_ERROR_INVALID_CALLBACK;
+        status = HAL_ERROR;
+        break;
+    }
+  }
+  else
+  {
+    hucpd->ErrorCode |= HAL_UCPD_ERROR_INVALID_CALLBACK;
+    status = HAL_ERROR;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Unregister a UCPD Callback.
+  *         UCPD callback is redirected to the weak predefined callback.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @param  CallbackID ID of the callback to be unregistered
+  *         This parameter can be one of the following values:
+  *           @arg @ref HAL_UCPD_TX_COMPLETE_CB_ID Tx Complete Callback ID
+  *           @arg @ref HAL_UCPD_RX_COMPLETE_CB_ID Rx Complete Callback ID
+  *           @arg @ref HAL_UCPD_HARDRESET_RX_CB_ID Hard Reset received Callback ID
+  *           @arg @ref HAL_UCPD_HARDRESET_TX_CB_ID Hard Reset sent Callback ID
+  *           @arg @ref HAL_UCPD_ERROR_CB_ID Error Callback ID
+  *           @arg @ref HAL_UCPD_MSPINIT_CB_ID MspInit Callback ID
+  *           @arg @ref HAL_UCPD_MSPDEINIT_CB_ID MspDeInit Callback ID
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UCPD_UnRegisterCallback(UCPD_HandleTypeDef *hucpd, HAL_UCPD_CallbackIDTypeDef CallbackID)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if (hucpd->gState == HAL_UCPD_STATE_READY)
+  {
+    switch (CallbackID)
+    {
+      case HAL_UCPD_TX_COMPLETE_CB_ID :
+        hucpd->TxCpltCallback = HAL_UCPD_TxCpltCallback;
+        break;
+
+      case HAL_UCPD_RX_COMPLETE_CB_ID :
+        hucpd->RxCpltCallback = HAL_UCPD_RxCpltCallback;
+        break;
+
+      case HAL_UCPD_HARDRESET_RX_CB_ID :
+        hucpd->HardResetReceivedCallback = HAL_UCPD_HardResetReceivedCallback;
+        break;
+
+      case HAL_UCPD_HARDRESET_TX_CB_ID :
+        hucpd->HardResetSentCallback = HAL_UCPD_HardResetSentCallback;
+        break;
+
+      case HAL_UCPD_ERROR_CB_ID :
+        hucpd->ErrorCallback = HAL_UCPD_ErrorCallback;
+        break;
+
+      case HAL_UCPD_MSPINIT_CB_ID :
+        hucpd->MspInitCallback = HAL_UCPD_MspInit;
+        break;
+
+      case HAL_UCPD_MSPDEINIT_CB_ID :
+        hucpd->MspDeInitCallback = HAL_UCPD_MspDeInit;
+        break;
+
+      default :
+        hucpd->ErrorCode |= HAL_UCPD_ERROR_INVALID_CALLBACK;
+        status = HAL_ERROR;
+        break;
+    }
+  }
+  else if (hucpd->gState == HAL_UCPD_STATE_RESET)
+  {
+    switch (CallbackID)
+    {
+      case HAL_UCPD_MSPINIT_CB_ID :
+        hucpd->MspInitCallback = HAL_UCPD_MspInit;
+        break;
+
+      case HAL_UCPD_MSPDEINIT_CB_ID :
+        hucpd->MspDeInitCallback = HAL_UCPD_MspDeInit;
+        break;
+
+      default :
+        hucpd->ErrorCode |= HAL_UCPD_ERROR_INVALID_CALLBACK;
+        status = HAL_ERROR;
+        break;
+    }
+  }
+  else
+  {
+    hucpd->ErrorCode |= HAL_UCPD_ERROR_INVALID_CALLBACK;
+    status = HAL_ERROR;
+  }
+
+  return status;
+}
+#endif /* USE_HAL_UCPD_REGISTER_CALLBACKS */
+
+/**
+  * @}
+  */
+
+/** @defgroup UCPD_Exported_Functions_Group2 IO operation functions
+  *  @brief   UCPD Transmit and Receive functions
+  *
+@verbatim
+ ===============================================================================
+                      ##### IO operation functions #####
+ ===============================================================================
+    [..]  This section provides functions allowing to:
+      (+) Transmit a Power Delivery message in DMA mode
+      (+) Receive Power Delivery messages in DMA mode, with automatic GoodCRC
+      (+) Send a Hard Reset
+      (+) Handle the UCPD interrupts and the associated callbacks
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Send a Power Delivery message in DMA mode.
+  * @note   The buffer holds the message header followed by the data objects,
+  *         the CRC is appended by the UCPD. pData must stay valid until
+  *         HAL_UCPD_TxCpltCallback() or HAL_UCPD_ErrorCallback() is executed.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @param  TxOrderSet ordered set of the message.
+  *         This parameter can be a value of @ref UCPD_Tx_OrderSet
+  * @param  pData pointer to the message.
+  * @param  Size message size in bytes, header included.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UCPD_Transmit_DMA(UCPD_HandleTypeDef *hucpd, uint32_t TxOrderSet, const uint8_t *pData,
+                                        uint16_t Size)
+{
+  assert_param(IS_UCPD_TXORDERSET(TxOrderSet));
+
+  if ((pData == NULL) || (!IS_UCPD_TXPAYLOADSIZE(Size)) || (hucpd->hdmatx == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hucpd->gState != HAL_UCPD_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  __HAL_LOCK(hucpd);
+
+  hucpd->ErrorCode = HAL_UCPD_ERROR_NONE;
+  hucpd->gState = HAL_UCPD_STATE_BUSY_TX;
+
+  UCPD_StartTransmit(hucpd, TxOrderSet, pData, Size);
+
+  __HAL_UNLOCK(hucpd);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Enable the reception of Power Delivery messages in DMA mode.
+  * @note   The reception stays enabled until HAL_UCPD_AbortReceive() is called:
+  *         each message is written at the beginning of pData.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @param  pData pointer to the reception buffer.
+  * @param  Size size of the reception buffer in bytes.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UCPD_Receive_DMA(UCPD_HandleTypeDef *hucpd, uint8_t *pData, uint16_t Size)
+{
+  if ((pData == NULL) || (Size < 2U) || (hucpd->hdmarx == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* The GoodCRC is sent through the Tx DMA channel */
+  if ((hucpd->Init.AutoGoodCRC == ENABLE) && (hucpd->hdmatx == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hucpd->RxState != HAL_UCPD_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  __HAL_LOCK(hucpd);
+
+  hucpd->pRxBuffPtr = pData;
+  hucpd->RxXferSize = Size;
+  hucpd->RxXferCount = 0U;
+  hucpd->RxState = HAL_UCPD_STATE_BUSY_RX;
+
+  hucpd->hdmarx->XferCpltCallback = NULL;
+  hucpd->hdmarx->XferHalfCpltCallback = NULL;
+  hucpd->hdmarx->XferErrorCallback = UCPD_DMAError;
+  hucpd->hdmarx->XferAbortCallback = NULL;
+
+  UCPD_StartReceive(hucpd);
+
+  /* Clear the pending Rx events then enable the receiver */
+  __HAL_UCPD_CLEAR_FLAG(hucpd, UCPD_FLAG_RXORDDET | UCPD_FLAG_RXHRSTDET | UCPD_FLAG_RXOVR | UCPD_FLAG_RXMSGEND);
+  __HAL_UCPD_ENABLE_IT(hucpd, UCPD_IT_RX);
+  LL_UCPD_RxEnable(hucpd->Instance);
+
+  __HAL_UNLOCK(hucpd);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Disable the reception of Power Delivery messages.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UCPD_AbortReceive(UCPD_HandleTypeDef *hucpd)
+{
+  LL_UCPD_RxDisable(hucpd->Instance);
+  __HAL_UCPD_DISABLE_IT(hucpd, UCPD_IT_RX);
+  __HAL_UCPD_CLEAR_FLAG(hucpd, UCPD_FLAG_RXORDDET | UCPD_FLAG_RXHRSTDET | UCPD_FLAG_RXOVR | UCPD_FLAG_RXMSGEND);
+
+  if ((hucpd->hdmarx != NULL) && (hucpd->hdmarx->State == HAL_DMA_STATE_BUSY))
+  {
+    (void)HAL_DMA_Abort(hucpd->hdmarx);
+  }
+
+  if (hucpd->RxState == HAL_UCPD_STATE_BUSY_RX)
+  {
+    hucpd->RxState = HAL_UCPD_STATE_READY;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Send a Hard Reset.
+  * @note   Any ongoing message transmission is aborted without callback.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UCPD_SendHardReset(UCPD_HandleTypeDef *hucpd)
+{
+  if (hucpd->gState == HAL_UCPD_STATE_RESET)
+  {
+    return HAL_ERROR;
+  }
+
+  if (hucpd->gState == HAL_UCPD_STATE_BUSY_HARDRESET)
+  {
+    return HAL_BUSY;
+  }
+
+  __HAL_LOCK(hucpd);
+
+  UCPD_AbortTransmit(hucpd);
+
+  hucpd->ErrorCode = HAL_UCPD_ERROR_NONE;
+  hucpd->gState = HAL_UCPD_STATE_BUSY_HARDRESET;
+
+  __HAL_UCPD_CLEAR_FLAG(hucpd, UCPD_FLAG_HRSTSENT | UCPD_FLAG_HRSTDISC);
+  __HAL_UCPD_ENABLE_IT(hucpd, UCPD_IT_HARDRESET_TX);
+  LL_UCPD_SendHardReset(hucpd->Instance);
+
+  __HAL_UNLOCK(hucpd);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Handle the UCPD interrupt request.
+  * @note   The Tx events are handled before the Rx events, so that a message
+  *         discarded by an incoming one releases the Tx path before the GoodCRC
+  *         of the incoming message is sent.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @retval None
+  */
+void HAL_UCPD_IRQHandler(UCPD_HandleTypeDef *hucpd)
+{
+  uint32_t srflags = READ_REG(hucpd->Instance->SR);
+  uint32_t flags = srflags & READ_REG(hucpd->Instance->IMR);
+  HAL_UCPD_StateTypeDef txstate;
+
+  /* Hard Reset received: the ongoing transmission is dropped by the PHY */
+  if ((flags & UCPD_FLAG_RXHRSTDET) != 0U)
+  {
+    __HAL_UCPD_CLEAR_FLAG(hucpd, UCPD_FLAG_RXHRSTDET);
+
+    if (hucpd->gState != HAL_UCPD_STATE_BUSY_HARDRESET)
+    {
+      UCPD_AbortTransmit(hucpd);
+      hucpd->gState = HAL_UCPD_STATE_READY;
+    }
+    UCPD_StartReceive(hucpd);
+
+#if (USE_HAL_UCPD_REGISTER_CALLBACKS == 1)
+    hucpd->HardResetReceivedCallback(hucpd);
+#else
+    HAL_UCPD_HardResetReceivedCallback(hucpd);
+#endif /* USE_HAL_UCPD_REGISTER_CALLBACKS */
+    return;
+  }
+
+  /* Tx message events */
+  if ((flags & UCPD_FLAG_TXMSGSENT) != 0U)
+  {
+    __HAL_UCPD_CLEAR_FLAG(hucpd, UCPD_FLAG_TXMSGSENT);
+    __HAL_UCPD_DISABLE_IT(hucpd, UCPD_IT_TX);
+
+    txstate = hucpd->gState;
+    hucpd->gState = HAL_UCPD_STATE_READY;
+
+    /* The GoodCRC sent by the driver is not reported */
+    if (txstate == HAL_UCPD_STATE_BUSY_TX)
+    {
+#if (USE_HAL_UCPD_REGISTER_CALLBACKS == 1)
+      hucpd->TxCpltCallback(hucpd);
+#else
+      HAL_UCPD_TxCpltCallback(hucpd);
+#endif /* USE_HAL_UCPD_REGISTER_CALLBACKS */
+    }
+  }
+  else if ((flags & (UCPD_FLAG_TXMSGDISC | UCPD_FLAG_TXMSGABT | UCPD_FLAG_TXUND)) != 0U)
+  {
+    if ((flags & UCPD_FLAG_TXMSGDISC) != 0U)
+    {
+      hucpd->ErrorCode |= HAL_UCPD_ERROR_TX_DISCARDED;
+    }
+    if ((flags & UCPD_FLAG_TXMSGABT) != 0U)
+    {
+      hucpd->ErrorCode |= HAL_UCPD_ERROR_TX_ABORTED;
+    }
+    if ((flags & UCPD_FLAG_TXUND) != 0U)
+    {
+      hucpd->ErrorCode |= HAL_UCPD_ERROR_TX_UNDERRUN;
+    }
+
+    UCPD_AbortTransmit(hucpd);
+    hucpd->gState = HAL_UCPD_STATE_READY;
+
+#if (USE_HAL_UCPD_REGISTER_CALLBACKS == 1)
+    hucpd->ErrorCallback(hucpd);
+#else
+    HAL_UCPD_ErrorCallback(hucpd);
+#endif /* USE_HAL_UCPD_REGISTER_CALLBACKS */
+  }
+  else
+  {
+    /* No Tx message event */
+  }
+
+  /* Hard Reset transmission events */
+  if ((flags & (UCPD_FLAG_HRSTSENT | UCPD_FLAG_HRSTDISC)) != 0U)
+  {
+    __HAL_UCPD_CLEAR_FLAG(hucpd, UCPD_FLAG_HRSTSENT | UCPD_FLAG_HRSTDISC);
+    __HAL_UCPD_DISABLE_IT(hucpd, UCPD_IT_HARDRESET_TX);
+    hucpd->gState = HAL_UCPD_STATE_READY;
+
+    if ((flags & UCPD_FLAG_HRSTSENT) != 0U)
+    {
+#if (USE_HAL_UCPD_REGISTER_CALLBACKS == 1)
+      hucpd->HardResetSentCallback(hucpd);
+#else
+      HAL_UCPD_HardResetSentCallback(hucpd);
+#endif /* USE_HAL_UCPD_REGISTER_CALLBACKS */
+    }
+    else
+    {
+      hucpd->ErrorCode |= HAL_UCPD_ERROR_HARDRESET_DISCARDED;
+#if (USE_HAL_UCPD_REGISTER_CALLBACKS == 1)
+      hucpd->ErrorCallback(hucpd);
+#else
+      HAL_UCPD_ErrorCallback(hucpd);
+#endif /* USE_HAL_UCPD_REGISTER_CALLBACKS */
+    }
+  }
+
+  /* Start of a received message */
+  if ((flags & UCPD_FLAG_RXORDDET) != 0U)
+  {
+    __HAL_UCPD_CLEAR_FLAG(hucpd, UCPD_FLAG_RXORDDET);
+    hucpd->RxOrderSet = LL_UCPD_ReadRxOrderSet(hucpd->Instance);
+  }
+
+  /* Rx overrun: the message is ended with RXERR set */
+  if ((flags & UCPD_FLAG_RXOVR) != 0U)
+  {
+    __HAL_UCPD_CLEAR_FLAG(hucpd, UCPD_FLAG_RXOVR);
+    hucpd->ErrorCode |= HAL_UCPD_ERROR_RX_OVERRUN;
+  }
+
+  /* End of a received message */
+  if ((flags & UCPD_FLAG_RXMSGEND) != 0U)
+  {
+    /* Also clears RXERR */
+    __HAL_UCPD_CLEAR_FLAG(hucpd, UCPD_FLAG_RXMSGEND);
+
+    if ((srflags & UCPD_FLAG_RXERR) == 0U)
+    {
+      hucpd->RxXferCount = (uint16_t)LL_UCPD_ReadRxPaySize(hucpd->Instance);
+      hucpd->RxOrderSet = LL_UCPD_ReadRxOrderSet(hucpd->Instance);
+
+      /* Acknowledge first, tTransmit runs from the end of the message */
+      if ((hucpd->Init.AutoGoodCRC == ENABLE) && (hucpd->RxXferCount >= 2U))
+      {
+        UCPD_SendGoodCRC(hucpd, hucpd->RxOrderSet);
+      }
+
+#if (USE_HAL_UCPD_REGISTER_CALLBACKS == 1)
+      hucpd->RxCpltCallback(hucpd);
+#else
+      HAL_UCPD_RxCpltCallback(hucpd);
+#endif /* USE_HAL_UCPD_REGISTER_CALLBACKS */
+    }
+    else
+    {
+      /* Corrupted message: dropped without GoodCRC */
+      hucpd->ErrorCode |= HAL_UCPD_ERROR_RX;
+#if (USE_HAL_UCPD_REGISTER_CALLBACKS == 1)
+      hucpd->ErrorCallback(hucpd);
+#else
+      HAL_UCPD_ErrorCallback(hucpd);
+#endif /* USE_HAL_UCPD_REGISTER_CALLBACKS */
+    }
+
+    /* Re-arm the reception, unless aborted from a callback */
+    if (hucpd->RxState == HAL_UCPD_STATE_BUSY_RX)
+    {
+      UCPD_StartReceive(hucpd);
+    }
+  }
+}
+
+/**
+  * @brief  Tx message sent callback.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @retval None
+  */
+__weak void HAL_UCPD_TxCpltCallback(UCPD_HandleTypeDef *hucpd)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hucpd);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_UCPD_TxCpltCallback can be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Rx message received callback.
+  * @note   The message is available in the reception buffer, its size in
+  *         RxXferCount and its ordered set in RxOrderSet.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @retval None
+  */
+__weak void HAL_UCPD_RxCpltCallback(UCPD_HandleTypeDef *hucpd)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hucpd);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_UCPD_RxCpltCallback can be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Hard Reset received callback.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @retval None
+  */
+__weak void HAL_UCPD_HardResetReceivedCallback(UCPD_HandleTypeDef *hucpd)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hucpd);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_UCPD_HardResetReceivedCallback can be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Hard Reset sent callback.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @retval None
+  */
+__weak void HAL_UCPD_HardResetSentCallback(UCPD_HandleTypeDef *hucpd)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hucpd);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_UCPD_HardResetSentCallback can be implemented in the user file
+   */
+}
+
+/**
+  * @brief  UCPD error callback.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @retval None
+  */
+__weak void HAL_UCPD_ErrorCallback(UCPD_HandleTypeDef *hucpd)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hucpd);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_UCPD_ErrorCallback can be implemented in the user file
+   */
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup UCPD_Exported_Functions_Group3 Peripheral Control functions
+  *  @brief   UCPD control functions
+  *
+@verbatim
+ ===============================================================================
+                      ##### Peripheral Control functions #####
+ ===============================================================================
+    [..]  This section provides a function allowing to update the port roles
+          advertised in the GoodCRC header after a role swap.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Update the port roles advertised in the GoodCRC header.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @param  PowerRole port power role.
+  *         This parameter can be a value of @ref UCPD_Power_Role
+  * @param  DataRole port data role.
+  *         This parameter can be a value of @ref UCPD_Data_Role
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UCPD_SetRoles(UCPD_HandleTypeDef *hucpd, uint32_t PowerRole, uint32_t DataRole)
+{
+  assert_param(IS_UCPD_POWERROLE(PowerRole));
+  assert_param(IS_UCPD_DATAROLE(DataRole));
+
+  hucpd->Init.PowerRole = PowerRole;
+  hucpd->Init.DataRole = DataRole;
+
+  return HAL_OK;
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup UCPD_Exported_Functions_Group4 Peripheral State and Error functions
+  *  @brief   UCPD State and Error functions
+  *
+@verbatim
+ ===============================================================================
+                ##### Peripheral State and Error functions #####
+ ===============================================================================
+    [..]  This section provides functions allowing to return the Tx state
+          and the error code of the UCPD handle.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Return the UCPD Tx state.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @retval HAL state
+  */
+HAL_UCPD_StateTypeDef HAL_UCPD_GetState(const UCPD_HandleTypeDef *hucpd)
+{
+  return hucpd->gState;
+}
+
+/**
+  * @brief  Return the UCPD error code.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @retval UCPD Error Code
+  */
+uint32_t HAL_UCPD_GetError(const UCPD_HandleTypeDef *hucpd)
+{
+  return hucpd->ErrorCode;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/** @defgroup UCPD_Private_Functions UCPD Private Functions
+  * @{
+  */
+
+/**
+  * @brief  Load a message in the Tx DMA channel and request its transmission.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @param  TxOrderSet ordered set of the message.
+  * @param  pData pointer to the message.
+  * @param  Size message size in bytes.
+  * @retval None
+  */
+static void UCPD_StartTransmit(UCPD_HandleTypeDef *hucpd, uint32_t TxOrderSet, const uint8_t *pData, uint16_t Size)
+{
+  LL_UCPD_WriteTxOrderSet(hucpd->Instance, TxOrderSet);
+  LL_UCPD_WriteTxPaySize(hucpd->Instance, Size);
+
+  hucpd->hdmatx->XferCpltCallback = NULL;
+  hucpd->hdmatx->XferHalfCpltCallback = NULL;
+  hucpd->hdmatx->XferErrorCallback = UCPD_DMAError;
+  hucpd->hdmatx->XferAbortCallback = NULL;
+
+  /* The message end is signaled by TXMSGSENT, not by the DMA */
+  if (HAL_DMA_Start_IT(hucpd->hdmatx, (uint32_t)pData, (uint32_t)&hucpd->Instance->TXDR, Size) != HAL_OK)
+  {
+    hucpd->ErrorCode |= HAL_UCPD_ERROR_DMA;
+    hucpd->gState = HAL_UCPD_STATE_READY;
+    return;
+  }
+
+  __HAL_UCPD_CLEAR_FLAG(hucpd, UCPD_FLAG_TXMSGSENT | UCPD_FLAG_TXMSGDISC | UCPD_FLAG_TXMSGABT | UCPD_FLAG_TXUND);
+  __HAL_UCPD_ENABLE_IT(hucpd, UCPD_IT_TX);
+  LL_UCPD_SendMessage(hucpd->Instance);
+}
+
+/**
+  * @brief  Stop the Tx DMA channel and drop the pending Tx message events.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @retval None
+  */
+static void UCPD_AbortTransmit(UCPD_HandleTypeDef *hucpd)
+{
+  __HAL_UCPD_DISABLE_IT(hucpd, UCPD_IT_TX);
+
+  if ((hucpd->hdmatx != NULL) && (hucpd->hdmatx->State == HAL_DMA_STATE_BUSY))
+  {
+    (void)HAL_DMA_Abort(hucpd->hdmatx);
+  }
+
+  __HAL_UCPD_CLEAR_FLAG(hucpd, UCPD_FLAG_TXMSGSENT | UCPD_FLAG_TXMSGDISC | UCPD_FLAG_TXMSGABT | UCPD_FLAG_TXUND);
+}
+
+/**
+  * @brief  Restart the Rx DMA channel at the beginning of the reception buffer.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @retval None
+  */
+static void UCPD_StartReceive(UCPD_HandleTypeDef *hucpd)
+{
+  if (hucpd->hdmarx->State == HAL_DMA_STATE_BUSY)
+  {
+    (void)HAL_DMA_Abort(hucpd->hdmarx);
+  }
+
+  if (HAL_DMA_Start_IT(hucpd->hdmarx, (uint32_t)&hucpd->Instance->RXDR, (uint32_t)hucpd->pRxBuffPtr,
+                       hucpd->RxXferSize) != HAL_OK)
+  {
+    hucpd->ErrorCode |= HAL_UCPD_ERROR_DMA;
+  }
+}
+
+/**
+  * @brief  Send the GoodCRC of the message held in the reception buffer.
+  * @note   No GoodCRC is sent for a received GoodCRC, nor for the ordered sets
+  *         other than SOP, SOP' and SOP''.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @param  RxOrderSet ordered set of the received message.
+  * @retval None
+  */
+static void UCPD_SendGoodCRC(UCPD_HandleTypeDef *hucpd, uint32_t RxOrderSet)
+{
+  uint32_t header = (uint32_t)hucpd->pRxBuffPtr[0] | ((uint32_t)hucpd->pRxBuffPtr[1] << 8U);
+  uint32_t goodcrc;
+  uint32_t txorderset;
+
+  if (((header & UCPD_HEADER_MSGTYPE_MSK) == UCPD_MSGTYPE_GOODCRC) && ((header & UCPD_HEADER_NDO_EXT_MSK) == 0U))
+  {
+    return;
+  }
+
+  goodcrc = UCPD_MSGTYPE_GOODCRC | (header & UCPD_HEADER_MSGID_MSK) |
+            (hucpd->Init.SpecRevision << UCPD_HEADER_SPECREV_POS);
+
+  switch (RxOrderSet)
+  {
+    case LL_UCPD_RXORDSET_SOP :
+      txorderset = UCPD_TXORDERSET_SOP;
+      goodcrc |= (hucpd->Init.DataRole << UCPD_HEADER_DATAROLE_POS) |
+                 (hucpd->Init.PowerRole << UCPD_HEADER_POWERROLE_POS);
+      break;
+
+    /* Cable Plug field left to 0: message sent by a port */
+    case LL_UCPD_RXORDSET_SOP1 :
+      txorderset = UCPD_TXORDERSET_SOP1;
+      break;
+
+    case LL_UCPD_RXORDSET_SOP2 :
+      txorderset = UCPD_TXORDERSET_SOP2;
+      break;
+
+    default :
+      txorderset = 0U;
+      break;
+  }
+
+  if (txorderset == 0U)
+  {
+    return;
+  }
+
+  if (hucpd->gState != HAL_UCPD_STATE_READY)
+  {
+    /* The partner retries the message after tReceive */
+    hucpd->ErrorCode |= HAL_UCPD_ERROR_GOODCRC;
+    return;
+  }
+
+  hucpd->GoodCRCBuffer[0] = (uint8_t)goodcrc;
+  hucpd->GoodCRCBuffer[1] = (uint8_t)(goodcrc >> 8U);
+  hucpd->gState = HAL_UCPD_STATE_BUSY_GOODCRC;
+
+  UCPD_StartTransmit(hucpd, txorderset, hucpd->GoodCRCBuffer, 2U);
+}
+
+/**
+  * @brief  DMA UCPD communication error callback.
+  * @param  hdma pointer to a DMA_HandleTypeDef structure.
+  * @retval None
+  */
+static void UCPD_DMAError(DMA_HandleTypeDef *hdma)
+{
+  UCPD_HandleTypeDef *hucpd = (UCPD_HandleTypeDef *)(hdma->Parent);
+
+  hucpd->ErrorCode |= HAL_UCPD_ERROR_DMA;
+
+#if (USE_HAL_UCPD_REGISTER_CALLBACKS == 1)
+  hucpd->ErrorCallback(hucpd);
+#else
+  HAL_UCPD_ErrorCallback(hucpd);
+#endif /* USE_HAL_UCPD_REGISTER_CALLBACKS */
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#endif /* HAL_UCPD_MODULE_ENABLED */
+#endif /* UCPD1 */
+
+/**
+  * @}
+  */
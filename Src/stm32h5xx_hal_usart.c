@@ -2426,6 +2426,8 @@ void HAL_USART_IRQHandler(USART_HandleTypeDef *husart)
   uint32_t errorflags;
   uint32_t errorcode;
 
+  HAL_TRACE_ENTER(HAL_TRACE_ID_USART_IRQ, husart);
+
   /* If no error occurs */
   errorflags = (isrflags & (uint32_t)(USART_ISR_PE | USART_ISR_FE | USART_ISR_ORE | USART_ISR_NE | USART_ISR_RTOF |
                                       USART_ISR_UDR));
@@ -2440,6 +2442,7 @@ void HAL_USART_IRQHandler(USART_HandleTypeDef *husart)
       {
         husart->RxISR(husart);
       }
+      HAL_TRACE_EXIT(HAL_TRACE_ID_USART_IRQ, husart);
       return;
     }
   }
@@ -2498,6 +2501,7 @@ void HAL_USART_IRQHandler(USART_HandleTypeDef *husart)
       if (husart->State == HAL_USART_STATE_BUSY_RX)
       {
         __HAL_USART_CLEAR_UDRFLAG(husart);
+        HAL_TRACE_EXIT(HAL_TRACE_ID_USART_IRQ, husart);
         return;
       }
       else
@@ -2605,6 +2609,7 @@ void HAL_USART_IRQHandler(USART_HandleTypeDef *husart)
         husart->ErrorCode = HAL_USART_ERROR_NONE;
       }
     }
+    HAL_TRACE_EXIT(HAL_TRACE_ID_USART_IRQ, husart);
     return;
 
   } /* End if some error occurs */
@@ -2619,6 +2624,7 @@ void HAL_USART_IRQHandler(USART_HandleTypeDef *husart)
     {
       husart->TxISR(husart);
     }
+    HAL_TRACE_EXIT(HAL_TRACE_ID_USART_IRQ, husart);
     return;
   }
 
@@ -2626,6 +2632,7 @@ void HAL_USART_IRQHandler(USART_HandleTypeDef *husart)
   if (((isrflags & USART_ISR_TC) != 0U) && ((cr1its & USART_CR1_TCIE) != 0U))
   {
     USART_EndTransmit_IT(husart);
+    HAL_TRACE_EXIT(HAL_TRACE_ID_USART_IRQ, husart);
     return;
   }
 
@@ -2639,6 +2646,7 @@ void HAL_USART_IRQHandler(USART_HandleTypeDef *husart)
     /* Call legacy weak Tx Fifo Empty Callback */
     HAL_USARTEx_TxFifoEmptyCallback(husart);
 #endif /* USE_HAL_USART_REGISTER_CALLBACKS */
+    HAL_TRACE_EXIT(HAL_TRACE_ID_USART_IRQ, husart);
     return;
   }
 
@@ -2652,8 +2660,11 @@ void HAL_USART_IRQHandler(USART_HandleTypeDef *husart)
     /* Call legacy weak Rx Fifo Full Callback */
     HAL_USARTEx_RxFifoFullCallback(husart);
 #endif /* USE_HAL_USART_REGISTER_CALLBACKS */
+    HAL_TRACE_EXIT(HAL_TRACE_ID_USART_IRQ, husart);
     return;
   }
+
+  HAL_TRACE_EXIT(HAL_TRACE_ID_USART_IRQ, husart);
 }
 
 /**
@@ -35,6 +35,16 @@
         -@- When USART operates in Slave mode, Slave mode must be enabled prior
             starting RX/TX transfers.
 
+    (#) Continuous synchronous (SPI master like) full-duplex streaming with DMA:
+        (+) Initialize the Tx and Rx DMA channels with HAL_DMAEx_List_Init() in
+            DMA_LINKEDLIST_CIRCULAR mode and link them to the USART handle.
+        (+) Use HAL_USARTEx_StreamStart_DMA() to exchange 2 blocks alternately
+            and endlessly, the FIFO mode being enabled so that the DMA latency
+            does not stretch the clock between data.
+        (+) Refill/process the first block in HAL_USART_RxHalfCpltCallback()
+            and the second block in HAL_USART_TxRxCpltCallback().
+        (+) Use HAL_USART_DMAStop() to stop the streaming.
+
   @endverbatim
   ******************************************************************************
   */
@@ -74,6 +84,10 @@
   * @{
   */
 static void USARTEx_SetNbDataToProcess(USART_HandleTypeDef *husart);
+#if defined(HAL_DMA_MODULE_ENABLED)
+static void USARTEx_DMAStreamCplt(DMA_HandleTypeDef *hdma);
+static void USARTEx_DMAStreamError(DMA_HandleTypeDef *hdma);
+#endif /* HAL_DMA_MODULE_ENABLED */
 /**
   * @}
   */
@@ -97,6 +111,9 @@ static void USARTEx_SetNbDataToProcess(USART_HandleTypeDef *husart);
         (+) HAL_USARTEx_RxFifoFullCallback()
         (+) HAL_USARTEx_TxFifoEmptyCallback()
 
+    (#) Continuous full-duplex streaming on circular DMA queues:
+        (+) HAL_USARTEx_StreamStart_DMA()
+
 @endverbatim
   * @{
   */
@@ -131,6 +148,246 @@ __weak void HAL_USARTEx_TxFifoEmptyCallback(USART_HandleTypeDef *husart)
    */
 }
 
+#if defined(HAL_DMA_MODULE_ENABLED)
+/**
+  * @brief  Start a continuous full-duplex transfer of 2 blocks, exchanged alternately by circular DMA queues.
+  * @note   The Tx and Rx DMA channels must be initialized with HAL_DMAEx_List_Init() in DMA_LINKEDLIST_CIRCULAR
+  *         mode. Their queues are built by this function from the user queues and nodes, and linked to the
+  *         DMA channels.
+  * @note   The USART DMA requests follow the TXFNF and RXFNE flags whatever the FIFO thresholds. The FIFO mode
+  *         is enabled by this function, so that up to 8 data are buffered in each direction and the DMA
+  *         service latency does not insert idle clock periods between data at high bit rates.
+  * @note   Only the Rx channel generates interrupts, once per block: HAL_USART_RxHalfCpltCallback() is called
+  *         when the first block has been exchanged and HAL_USART_TxRxCpltCallback() when the second block has
+  *         been exchanged. The exchanged block can then be processed and refilled while the other block is
+  *         transferred.
+  * @note   When USART parity is not enabled (PCE = 0), and Word Length is configured to 9 bits (M1-M0 = 01),
+  *         the blocks hold u16 data elements.
+  * @note   Use HAL_USART_DMAStop() to stop the streaming.
+  * @param  husart USART handle.
+  * @param  pConfig pointer to a USART_StreamConfTypeDef structure that contains the streaming configuration.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_USARTEx_StreamStart_DMA(USART_HandleTypeDef *husart, const USART_StreamConfTypeDef *pConfig)
+{
+  HAL_StatusTypeDef status;
+  DMA_NodeConfTypeDef node_conf;
+  uint32_t data_size = 1U;
+
+  if ((pConfig == NULL) || (pConfig->pTxQueue == NULL) || (pConfig->pTxNodes == NULL)
+      || (pConfig->pRxQueue == NULL) || (pConfig->pRxNodes == NULL)
+      || (pConfig->pTxBuffer[0U] == NULL) || (pConfig->pTxBuffer[1U] == NULL)
+      || (pConfig->pRxBuffer[0U] == NULL) || (pConfig->pRxBuffer[1U] == NULL) || (pConfig->BlockLength == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  if (husart->State != HAL_USART_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  /* Check the DMA channels circular linked-list mode */
+  if ((husart->hdmatx == NULL) || (husart->hdmatx->Mode != DMA_LINKEDLIST_CIRCULAR)
+      || (husart->hdmarx == NULL) || (husart->hdmarx->Mode != DMA_LINKEDLIST_CIRCULAR))
+  {
+    return HAL_ERROR;
+  }
+
+  /* In case of 9bits/No Parity transfer, the blocks hold u16 data elements */
+  if ((husart->Init.WordLength == USART_WORDLENGTH_9B) && (husart->Init.Parity == USART_PARITY_NONE))
+  {
+    data_size = 2U;
+  }
+
+  /* Buffer the data in the FIFOs to absorb the DMA service latency */
+  if (husart->FifoMode == USART_FIFOMODE_DISABLE)
+  {
+    if (HAL_USARTEx_EnableFifoMode(husart) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(husart);
+
+  /* Prepare the Rx node of the first block */
+  node_conf.NodeType                            = DMA_GPDMA_LINEAR_NODE;
+  node_conf.Init.Request                        = pConfig->RxRequest;
+  node_conf.Init.BlkHWRequest                   = DMA_BREQ_SINGLE_BURST;
+  node_conf.Init.Direction                      = DMA_PERIPH_TO_MEMORY;
+  node_conf.Init.SrcInc                         = DMA_SINC_FIXED;
+  node_conf.Init.DestInc                        = DMA_DINC_INCREMENTED;
+  node_conf.Init.SrcDataWidth                   = (data_size == 2U) ? DMA_SRC_DATAWIDTH_HALFWORD :
+                                                  DMA_SRC_DATAWIDTH_BYTE;
+  node_conf.Init.DestDataWidth                  = (data_size == 2U) ? DMA_DEST_DATAWIDTH_HALFWORD :
+                                                  DMA_DEST_DATAWIDTH_BYTE;
+  node_conf.Init.Priority                       = husart->hdmarx->InitLinkedList.Priority;
+  node_conf.Init.SrcBurstLength                 = 1U;
+  node_conf.Init.DestBurstLength                = 1U;
+  node_conf.Init.TransferAllocatedPort          = DMA_SRC_ALLOCATED_PORT0 | DMA_DEST_ALLOCATED_PORT0;
+  node_conf.Init.TransferEventMode              = DMA_TCEM_EACH_LL_ITEM_TRANSFER;
+  node_conf.Init.Mode                           = DMA_NORMAL;
+  node_conf.DataHandlingConfig.DataExchange     = DMA_EXCHANGE_NONE;
+  node_conf.DataHandlingConfig.DataAlignment    = DMA_DATA_RIGHTALIGN_ZEROPADDED;
+  node_conf.TriggerConfig.TriggerPolarity       = DMA_TRIG_POLARITY_MASKED;
+  node_conf.TriggerConfig.TriggerMode           = 0U;
+  node_conf.TriggerConfig.TriggerSelection      = 0U;
+  node_conf.SrcAddress                          = (uint32_t)&husart->Instance->RDR;
+  node_conf.DstAddress                          = (uint32_t)pConfig->pRxBuffer[0U];
+  node_conf.DataSize                            = (uint32_t)pConfig->BlockLength * data_size;
+#if defined (__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U)
+  node_conf.SrcSecure                           = DMA_CHANNEL_SRC_SEC;
+  node_conf.DestSecure                          = DMA_CHANNEL_DEST_SEC;
+#endif /* (__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U) */
+
+  /* Build the circular Rx queue: one node per block */
+  status = HAL_DMAEx_List_ResetQ(pConfig->pRxQueue);
+
+  if (status == HAL_OK)
+  {
+    status = HAL_DMAEx_List_BuildNode(&node_conf, &pConfig->pRxNodes[0U]);
+  }
+  if (status == HAL_OK)
+  {
+    status = HAL_DMAEx_List_InsertNode_Tail(pConfig->pRxQueue, &pConfig->pRxNodes[0U]);
+  }
+  if (status == HAL_OK)
+  {
+    node_conf.DstAddress = (uint32_t)pConfig->pRxBuffer[1U];
+    status = HAL_DMAEx_List_BuildNode(&node_conf, &pConfig->pRxNodes[1U]);
+  }
+  if (status == HAL_OK)
+  {
+    status = HAL_DMAEx_List_InsertNode_Tail(pConfig->pRxQueue, &pConfig->pRxNodes[1U]);
+  }
+  if (status == HAL_OK)
+  {
+    status = HAL_DMAEx_List_SetCircularMode(pConfig->pRxQueue);
+  }
+  if (status == HAL_OK)
+  {
+    status = HAL_DMAEx_List_LinkQ(husart->hdmarx, pConfig->pRxQueue);
+  }
+
+  /* Prepare the Tx node of the first block: the Rx channel reports the block completion, the Tx channel
+     generates no transfer event */
+  node_conf.Init.Request                        = pConfig->TxRequest;
+  node_conf.Init.Direction                      = DMA_MEMORY_TO_PERIPH;
+  node_conf.Init.SrcInc                         = DMA_SINC_INCREMENTED;
+  node_conf.Init.DestInc                        = DMA_DINC_FIXED;
+  node_conf.Init.Priority                       = husart->hdmatx->InitLinkedList.Priority;
+  node_conf.Init.TransferEventMode              = DMA_TCEM_LAST_LL_ITEM_TRANSFER;
+  node_conf.SrcAddress                          = (uint32_t)pConfig->pTxBuffer[0U];
+  node_conf.DstAddress                          = (uint32_t)&husart->Instance->TDR;
+
+  /* Build the circular Tx queue: one node per block */
+  if (status == HAL_OK)
+  {
+    status = HAL_DMAEx_List_ResetQ(pConfig->pTxQueue);
+  }
+  if (status == HAL_OK)
+  {
+    status = HAL_DMAEx_List_BuildNode(&node_conf, &pConfig->pTxNodes[0U]);
+  }
+  if (status == HAL_OK)
+  {
+    status = HAL_DMAEx_List_InsertNode_Tail(pConfig->pTxQueue, &pConfig->pTxNodes[0U]);
+  }
+  if (status == HAL_OK)
+  {
+    node_conf.SrcAddress = (uint32_t)pConfig->pTxBuffer[1U];
+    status = HAL_DMAEx_List_BuildNode(&node_conf, &pConfig->pTxNodes[1U]);
+  }
+  if (status == HAL_OK)
+  {
+    status = HAL_DMAEx_List_InsertNode_Tail(pConfig->pTxQueue, &pConfig->pTxNodes[1U]);
+  }
+  if (status == HAL_OK)
+  {
+    status = HAL_DMAEx_List_SetCircularMode(pConfig->pTxQueue);
+  }
+  if (status == HAL_OK)
+  {
+    status = HAL_DMAEx_List_LinkQ(husart->hdmatx, pConfig->pTxQueue);
+  }
+
+  if (status != HAL_OK)
+  {
+    /* Process Unlocked */
+    __HAL_UNLOCK(husart);
+
+    return HAL_ERROR;
+  }
+
+  husart->pRxBuffPtr = pConfig->pRxBuffer[0U];
+  husart->RxXferSize = pConfig->BlockLength;
+  husart->pTxBuffPtr = pConfig->pTxBuffer[0U];
+  husart->TxXferSize = pConfig->BlockLength;
+
+  husart->ErrorCode = HAL_USART_ERROR_NONE;
+  husart->State = HAL_USART_STATE_BUSY_TX_RX;
+
+  /* First block to complete */
+  husart->StreamBlock = 0U;
+
+  /* Set the DMA callbacks: each Rx node completion is a block, the half transfer events are not used */
+  husart->hdmarx->XferHalfCpltCallback = NULL;
+  husart->hdmarx->XferCpltCallback = USARTEx_DMAStreamCplt;
+  husart->hdmarx->XferErrorCallback = USARTEx_DMAStreamError;
+  husart->hdmatx->XferHalfCpltCallback = NULL;
+  husart->hdmatx->XferCpltCallback = NULL;
+  husart->hdmatx->XferErrorCallback = USARTEx_DMAStreamError;
+
+  /* Enable the USART receive then transmit DMA channels */
+  status = HAL_DMAEx_List_Start_IT(husart->hdmarx);
+  if (status == HAL_OK)
+  {
+    status = HAL_DMAEx_List_Start_IT(husart->hdmatx);
+    if (status != HAL_OK)
+    {
+      (void)HAL_DMA_Abort(husart->hdmarx);
+    }
+  }
+
+  if (status != HAL_OK)
+  {
+    /* Set error code to DMA */
+    husart->ErrorCode = HAL_USART_ERROR_DMA;
+
+    /* Process Unlocked */
+    __HAL_UNLOCK(husart);
+
+    /* Restore husart->State to ready */
+    husart->State = HAL_USART_STATE_READY;
+
+    return HAL_ERROR;
+  }
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(husart);
+
+  if (husart->Init.Parity != USART_PARITY_NONE)
+  {
+    /* Enable the USART Parity Error Interrupt */
+    SET_BIT(husart->Instance->CR1, USART_CR1_PEIE);
+  }
+
+  /* Enable the USART Error Interrupt: (Frame error, noise error, overrun error) */
+  SET_BIT(husart->Instance->CR3, USART_CR3_EIE);
+
+  /* Clear the TC flag in the ICR register */
+  __HAL_USART_CLEAR_FLAG(husart, USART_CLEAR_TCF);
+
+  /* Enable the DMA transfer for the receiver request, then for the transmit request which starts the clock */
+  SET_BIT(husart->Instance->CR3, USART_CR3_DMAR);
+  SET_BIT(husart->Instance->CR3, USART_CR3_DMAT);
+
+  return HAL_OK;
+}
+#endif /* HAL_DMA_MODULE_ENABLED */
+
 /**
   * @}
   */
@@ -525,6 +782,62 @@ static void USARTEx_SetNbDataToProcess(USART_HandleTypeDef *husart)
                                 (uint16_t)denominator[rx_fifo_threshold];
   }
 }
+
+#if defined(HAL_DMA_MODULE_ENABLED)
+/**
+  * @brief  DMA Rx node transfer complete callback of the USART streaming.
+  * @param  hdma DMA handle.
+  * @retval None
+  */
+static void USARTEx_DMAStreamCplt(DMA_HandleTypeDef *hdma)
+{
+  USART_HandleTypeDef *husart = (USART_HandleTypeDef *)(hdma->Parent);
+
+  if (husart->StreamBlock == 0U)
+  {
+    husart->StreamBlock = 1U;
+    /* First block exchanged */
+#if (USE_HAL_USART_REGISTER_CALLBACKS == 1)
+    husart->RxHalfCpltCallback(husart);
+#else
+    HAL_USART_RxHalfCpltCallback(husart);
+#endif /* USE_HAL_USART_REGISTER_CALLBACKS */
+  }
+  else
+  {
+    husart->StreamBlock = 0U;
+    /* Second block exchanged */
+#if (USE_HAL_USART_REGISTER_CALLBACKS == 1)
+    husart->TxRxCpltCallback(husart);
+#else
+    HAL_USART_TxRxCpltCallback(husart);
+#endif /* USE_HAL_USART_REGISTER_CALLBACKS */
+  }
+}
+
+/**
+  * @brief  DMA error callback of the USART streaming.
+  * @note   The streaming is stopped on both directions before the user error callback is called.
+  * @param  hdma DMA handle.
+  * @retval None
+  */
+static void USARTEx_DMAStreamError(DMA_HandleTypeDef *hdma)
+{
+  USART_HandleTypeDef *husart = (USART_HandleTypeDef *)(hdma->Parent);
+
+  (void)HAL_USART_DMAStop(husart);
+
+  husart->ErrorCode |= HAL_USART_ERROR_DMA;
+
+#if (USE_HAL_USART_REGISTER_CALLBACKS == 1)
+  /* Call registered Error Callback */
+  husart->ErrorCallback(husart);
+#else
+  /* Call legacy weak Error Callback */
+  HAL_USART_ErrorCallback(husart);
+#endif /* USE_HAL_USART_REGISTER_CALLBACKS */
+}
+#endif /* HAL_DMA_MODULE_ENABLED */
 /**
   * @}
   */
@@ -9,6 +9,7 @@
               + Hyperbus configuration
               + Indirect functional mode management
               + Memory-mapped functional mode management
+              + Managed execute-in-place program and erase operations
               + Auto-polling functional mode management
               + Interrupts and flags management
               + DMA channel configuration for indirect functional mode
@@ -135,6 +136,60 @@
      the address range. HAL_XSPI_TimeOutCallback() will be called when the timeout expires.
      HAL_XSPI_IsMemoryMapped() can be used to verify whether memory-mapped mode is configured or not.
 
+    *** Managed execute-in-place mode ***
+    =====================================
+    [..]
+     Once the memory-mapped mode is configured, a program or an erase of the external flash can be
+     performed without losing the memory-mapped configuration using the HAL_XSPI_XIP_Execute() function :
+     (+) The memory-mapped read configuration is saved in a XSPI_XIPContextTypeDef structure, filled
+         beforehand with the memory-mapped configuration to restore (timeout and prefetch settings)
+         and, if any, the DCACHE handle caching the memory-mapped region.
+     (+) The memory-mapped mode is left, the write enable, program or erase commands are sent in
+         indirect mode, and the end of the operation is awaited in auto-polling mode within the
+         given timeout.
+     (+) The DCACHE lines of the modified range are invalidated and the ICACHE, if enabled, is
+         invalidated, before the memory-mapped mode is restored, even if the operation failed.
+    [..]
+     HAL_XSPI_XIP_Suspend() and HAL_XSPI_XIP_Resume() can also be used directly to perform a custom
+     indirect sequence while the memory-mapped mode is suspended.
+    [..]
+     The external memory is not accessible while the memory-mapped mode is suspended: these functions,
+     and any interrupt handler allowed to run during the operation, must be executed from internal memory.
+
+    *** Transaction queue ***
+    =========================
+    [..]
+     A list of programs or erases of the external memory can be executed in the background using the
+     HAL_XSPI_TransactionQueue_Start() function, the DMA channel for transmit being linked to the handle :
+     (+) The XSPI_TransactionQueueTypeDef structure gives the write enable command, the command used for
+         each transaction (e.g page program), the status register read command and the match
+         configuration of the end of operation (with automatic stop). The write enable and status
+         commands are skipped when their instruction mode is HAL_XSPI_INSTRUCTION_NONE (e.g PSRAM).
+     (+) Each XSPI_TransactionTypeDef entry gives the address, the data and the number of data of a
+         transaction, no data meaning a command without data phase (e.g sector erase).
+     (+) The steps of each transaction are chained from the XSPI interrupt without call to the
+         indirect mode callbacks, and pCompleteCallback of the queue is called at the end of the
+         last transaction or on the first error, with the number of completed transactions in Index.
+     (+) HAL_XSPI_Abort_IT() stops the queue, pCompleteCallback being called at the end of the abort.
+
+    *** NOR flash block device ***
+    ==============================
+    [..]
+     A NOR flash memory can be used as a block device (e.g by a littlefs filesystem) through a
+     XSPI_BlockDevTypeDef structure giving the read, write enable, page program, sector erase and status
+     commands, the page and sector sizes, and the application buffers. HAL_XSPI_BlockDev_Init() resets it.
+     (+) When pXIPContext is set, the memory is read from the memory-mapped region and the programs and
+         erases are done with HAL_XSPI_XIP_Execute(), else the memory is accessed in indirect mode.
+     (+) HAL_XSPI_BlockDev_Read() serves the reads from a cache of CacheNbr sectors, the least recently
+         used one being replaced on a miss.
+     (+) HAL_XSPI_BlockDev_Program() coalesces the data in the page buffer, which is written with a
+         single page program once its end is reached, when another page is programmed, or by
+         HAL_XSPI_BlockDev_Sync().
+     (+) HAL_XSPI_BlockDev_ReserveErase() reserves a free sector, erased later by
+         HAL_XSPI_BlockDev_Process() when the memory is idle. In indirect mode the erase runs without
+         waiting, HAL_XSPI_BlockDev_Process() checking its end on the next calls. A later
+         HAL_XSPI_BlockDev_Erase() of an already erased sector returns at once.
+
     *** Errors management and abort functionality ***
     =================================================
     [..]
@@ -176,6 +231,9 @@
      (+) The delay line length can be Configure to one period of the Input clock with HAL_XSPI_DLYB_GetClockPeriod().
      (+) The phase of the output clock can be programmed directly with HAL_XSPI_DLYB_SetConfig().
      (+) The phase of the output clock can be got with HAL_XSPI_DLYB_GetConfig().
+     (+) The phase of the output clock can be calibrated with HAL_XSPI_DLYB_Calibrate(), which reads
+         a known pattern from the memory on each phase over one clock period and programs the middle
+         of the wider window of passing phases. It can be called again to follow temperature drifts.
     [..]
 
     *** Callback registration ***
@@ -278,6 +336,16 @@
 #define XSPI_CFG_STATE_MASK  0x00000004U
 #define XSPI_BUSY_STATE_MASK 0x00000008U
 
+#define XSPI_QUEUE_STEP_WRITE_ENABLE 0x00000000U   /*!< Write enable command of the queued transaction */
+#define XSPI_QUEUE_STEP_OPERATION    0x00000001U   /*!< Command and data of the queued transaction     */
+#define XSPI_QUEUE_STEP_POLLING      0x00000002U   /*!< Status polling of the queued transaction       */
+
+#define XSPI_BLOCKDEV_NO_ADDRESS     0xFFFFFFFFU   /*!< No page coalesced or sector cached             */
+#define XSPI_BLOCKDEV_ERASE_FREE     0x00000000U   /*!< Erase reservation slot unused                  */
+#define XSPI_BLOCKDEV_ERASE_PENDING  0x00000001U   /*!< Sector waiting for its background erase        */
+#define XSPI_BLOCKDEV_ERASE_ONGOING  0x00000002U   /*!< Background erase of the sector in progress     */
+#define XSPI_BLOCKDEV_ERASE_DONE     0x00000003U   /*!< Sector erased, not programmed since            */
+
 #if defined(OCTOSPIM)
 #define OCTOSPI_NB_INSTANCE   2U
 #define OCTOSPI_IOM_NB_PORTS  2U
@@ -300,6 +368,24 @@ static void              XSPI_DMAAbortCplt(DMA_HandleTypeDef *hdma);
 static HAL_StatusTypeDef XSPI_WaitFlagStateUntilTimeout(XSPI_HandleTypeDef *hxspi, uint32_t Flag, FlagStatus State,
                                                         uint32_t Tickstart, uint32_t Timeout);
 static HAL_StatusTypeDef XSPI_ConfigCmd(XSPI_HandleTypeDef *hxspi, const XSPI_RegularCmdTypeDef *pCmd);
+static HAL_StatusTypeDef XSPI_TransactionQueue_Issue(XSPI_HandleTypeDef *hxspi);
+static void              XSPI_TransactionQueue_Next(XSPI_HandleTypeDef *hxspi);
+static void              XSPI_TransactionQueue_Complete(XSPI_HandleTypeDef *hxspi, uint32_t ErrorCode);
+static HAL_StatusTypeDef XSPI_BlockDev_Operation(XSPI_HandleTypeDef *hxspi, XSPI_BlockDevTypeDef *pDev,
+                                                 const XSPI_RegularCmdTypeDef *pCmd, const uint8_t *pData,
+                                                 uint32_t Wait);
+static HAL_StatusTypeDef XSPI_BlockDev_PollErase(XSPI_HandleTypeDef *hxspi, const XSPI_BlockDevTypeDef *pDev,
+                                                 uint32_t *pDone);
+static HAL_StatusTypeDef XSPI_BlockDev_WaitErase(XSPI_HandleTypeDef *hxspi, XSPI_BlockDevTypeDef *pDev);
+static HAL_StatusTypeDef XSPI_BlockDev_Release(XSPI_HandleTypeDef *hxspi, XSPI_BlockDevTypeDef *pDev,
+                                               uint32_t Address, uint32_t *pErased);
+static void              XSPI_BlockDev_Discard(XSPI_BlockDevTypeDef *pDev, uint32_t Address);
+static HAL_StatusTypeDef XSPI_BlockDev_Flush(XSPI_HandleTypeDef *hxspi, XSPI_BlockDevTypeDef *pDev);
+static HAL_StatusTypeDef XSPI_BlockDev_ReadMemory(XSPI_HandleTypeDef *hxspi, XSPI_BlockDevTypeDef *pDev,
+                                                  uint32_t Address, uint8_t *pData, uint32_t Size);
+static uint32_t          XSPI_BlockDev_CacheFind(const XSPI_BlockDevTypeDef *pDev, uint32_t Address);
+static HAL_StatusTypeDef XSPI_BlockDev_CacheLoad(XSPI_HandleTypeDef *hxspi, XSPI_BlockDevTypeDef *pDev,
+                                                 uint32_t Address, const uint8_t **ppSector);
 #if defined(OCTOSPIM)
 static void XSPIM_GetConfig(uint8_t instance_nb, XSPIM_CfgTypeDef *pCfg);
 #endif /* OCTOSPIM */
@@ -379,6 +465,7 @@ HAL_StatusTypeDef HAL_XSPI_Init(XSPI_HandleTypeDef *hxspi)
 #endif /* XSPI_DCR1_EXTENDMEM */
     /* Initialize error code */
     hxspi->ErrorCode = HAL_XSPI_ERROR_NONE;
+    hxspi->pTransactionQueue = NULL;
 
     /* Check if the state is the reset state */
     if (hxspi->State == HAL_XSPI_STATE_RESET)
@@ -684,7 +771,20 @@ void HAL_XSPI_IRQHandler(XSPI_HandleTypeDef *hxspi)
 
       hxspi->State = HAL_XSPI_STATE_READY;
 
-      if (currentstate == HAL_XSPI_STATE_BUSY_TX)
+      if (hxspi->pTransactionQueue != NULL)
+      {
+        if (currentstate == HAL_XSPI_STATE_ABORT)
+        {
+          /* Queued transaction aborted by the user or due to an error */
+          XSPI_TransactionQueue_Complete(hxspi, hxspi->ErrorCode);
+        }
+        else
+        {
+          /* Step of the queued transaction complete */
+          XSPI_TransactionQueue_Next(hxspi);
+        }
+      }
+      else if (currentstate == HAL_XSPI_STATE_BUSY_TX)
       {
         /* TX complete callback */
 #if defined (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U)
@@ -746,12 +846,20 @@ void HAL_XSPI_IRQHandler(XSPI_HandleTypeDef *hxspi)
       hxspi->State = HAL_XSPI_STATE_READY;
     }
 
-    /* Status match callback */
+    if (hxspi->pTransactionQueue != NULL)
+    {
+      /* End of the queued transaction */
+      XSPI_TransactionQueue_Next(hxspi);
+    }
+    else
+    {
+      /* Status match callback */
 #if defined (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U)
-    hxspi->StatusMatchCallback(hxspi);
+      hxspi->StatusMatchCallback(hxspi);
 #else
-    HAL_XSPI_StatusMatchCallback(hxspi);
+      HAL_XSPI_StatusMatchCallback(hxspi);
 #endif /* (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U) */
+    }
   }
   /* XSPI transfer error interrupt occurred -------------------------------*/
   else if (((flag & HAL_XSPI_FLAG_TE) != 0U) && ((itsource & HAL_XSPI_IT_TE) != 0U))
@@ -803,12 +911,20 @@ void HAL_XSPI_IRQHandler(XSPI_HandleTypeDef *hxspi)
     {
       hxspi->State = HAL_XSPI_STATE_READY;
 
-      /* Error callback */
+      if (hxspi->pTransactionQueue != NULL)
+      {
+        /* Queued transaction failed */
+        XSPI_TransactionQueue_Complete(hxspi, hxspi->ErrorCode);
+      }
+      else
+      {
+        /* Error callback */
 #if defined (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U)
-      hxspi->ErrorCallback(hxspi);
+        hxspi->ErrorCallback(hxspi);
 #else
-      HAL_XSPI_ErrorCallback(hxspi);
+        HAL_XSPI_ErrorCallback(hxspi);
 #endif /* (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U) */
+      }
     }
   }
   /* XSPI timeout interrupt occurred --------------------------------------*/
@@ -1543,6 +1659,11 @@ HAL_StatusTypeDef HAL_XSPI_Transmit_DMA(XSPI_HandleTypeDef *hxspi, const uint8_t
         hxspi->XferSize = hxspi->XferCount;
         hxspi->pBuffPtr = (uint8_t *)pData;
 
+#if defined(USE_HAL_DCACHE_DMA_COHERENCY) && (USE_HAL_DCACHE_DMA_COHERENCY == 1U)
+        /* Start writing back the cache lines of the buffer while the transfer is configured */
+        (void)HAL_DCACHE_DMA_PrepareTx(pData, hxspi->XferSize);
+#endif /* USE_HAL_DCACHE_DMA_COHERENCY */
+
         /* Configure CR register with functional mode as indirect write */
         MODIFY_REG(hxspi->Instance->CR, XSPI_CR_FMODE, XSPI_FUNCTIONAL_MODE_INDIRECT_WRITE);
 
@@ -1564,6 +1685,14 @@ HAL_StatusTypeDef HAL_XSPI_Transmit_DMA(XSPI_HandleTypeDef *hxspi, const uint8_t
         /* Clear the DMA abort callback */
         hxspi->hdmatx->XferAbortCallback = NULL;
 
+#if defined(USE_HAL_DCACHE_DMA_COHERENCY) && (USE_HAL_DCACHE_DMA_COHERENCY == 1U)
+        /* The cache maintenance must end before the DMA accesses the buffer */
+        if (HAL_DCACHE_DMA_WaitPrepared() != HAL_OK)
+        {
+          status = HAL_ERROR;
+        }
+        else
+#endif /* USE_HAL_DCACHE_DMA_COHERENCY */
         /* Enable the transmit DMA Channel */
         if ((hxspi->hdmatx->Mode & DMA_LINKEDLIST) == DMA_LINKEDLIST)
         {
@@ -1729,6 +1858,11 @@ HAL_StatusTypeDef HAL_XSPI_Receive_DMA(XSPI_HandleTypeDef *hxspi, uint8_t *pData
         hxspi->XferSize  = hxspi->XferCount;
         hxspi->pBuffPtr  = pData;
 
+#if defined(USE_HAL_DCACHE_DMA_COHERENCY) && (USE_HAL_DCACHE_DMA_COHERENCY == 1U)
+        /* Start removing the cache lines of the buffer while the transfer is configured */
+        (void)HAL_DCACHE_DMA_PrepareRx(pData, hxspi->XferSize);
+#endif /* USE_HAL_DCACHE_DMA_COHERENCY */
+
         /* Configure CR register with functional mode as indirect read */
         MODIFY_REG(hxspi->Instance->CR, XSPI_CR_FMODE, XSPI_FUNCTIONAL_MODE_INDIRECT_READ);
 
@@ -1750,6 +1884,14 @@ HAL_StatusTypeDef HAL_XSPI_Receive_DMA(XSPI_HandleTypeDef *hxspi, uint8_t *pData
         /* Clear the DMA abort callback */
         hxspi->hdmarx->XferAbortCallback = NULL;
 
+#if defined(USE_HAL_DCACHE_DMA_COHERENCY) && (USE_HAL_DCACHE_DMA_COHERENCY == 1U)
+        /* The cache maintenance must end before the DMA accesses the buffer */
+        if (HAL_DCACHE_DMA_WaitPrepared() != HAL_OK)
+        {
+          status = HAL_ERROR;
+        }
+        else
+#endif /* USE_HAL_DCACHE_DMA_COHERENCY */
         /* Enable the receive DMA Channel */
         if ((hxspi->hdmarx->Mode & DMA_LINKEDLIST) == DMA_LINKEDLIST)
         {
@@ -2076,1197 +2218,2513 @@ uint32_t HAL_XSPI_IsMemoryMapped(XSPI_HandleTypeDef *hxspi)
 }
 
 /**
-  * @brief  Transfer Error callback.
-  * @param  hxspi : XSPI handle
-  * @retval None
+  * @brief  Suspend the Memory Mapped mode to perform indirect or auto-polling accesses.
+  * @param  hxspi    : XSPI handle
+  * @param  pContext : Pointer to the execute-in-place context saving the memory-mapped read configuration
+  * @note   The external memory must not be accessed until HAL_XSPI_XIP_Resume() is called.
+  * @retval HAL status
   */
-__weak void HAL_XSPI_ErrorCallback(XSPI_HandleTypeDef *hxspi)
+HAL_StatusTypeDef HAL_XSPI_XIP_Suspend(XSPI_HandleTypeDef *hxspi, XSPI_XIPContextTypeDef *pContext)
 {
-  /* Prevent unused argument(s) compilation warning */
-  UNUSED(hxspi);
+  HAL_StatusTypeDef status;
 
-  /* NOTE : This function should not be modified, when the callback is needed,
-            the HAL_XSPI_ErrorCallback could be implemented in the user file
-   */
-}
+  if (pContext == NULL)
+  {
+    return HAL_ERROR;
+  }
 
-/**
-  * @brief  Abort completed callback.
-  * @param  hxspi : XSPI handle
-  * @retval None
-  */
-__weak void HAL_XSPI_AbortCpltCallback(XSPI_HandleTypeDef *hxspi)
-{
-  /* Prevent unused argument(s) compilation warning */
-  UNUSED(hxspi);
+  /* Check the state */
+  if (hxspi->State == HAL_XSPI_STATE_BUSY_MEM_MAPPED)
+  {
+    /* Save the memory-mapped read configuration, overwritten by the indirect commands */
+    pContext->MemorySelect = READ_BIT(hxspi->Instance->CR, XSPI_CR_MSEL);
+    pContext->ReadCCR      = READ_REG(hxspi->Instance->CCR);
+    pContext->ReadTCR      = READ_REG(hxspi->Instance->TCR);
+    pContext->ReadIR       = READ_REG(hxspi->Instance->IR);
+    pContext->ReadABR      = READ_REG(hxspi->Instance->ABR);
 
-  /* NOTE: This function should not be modified, when the callback is needed,
-           the HAL_XSPI_AbortCpltCallback could be implemented in the user file
-   */
-}
+    /* Disable the timeout interrupt, only relevant in memory-mapped mode */
+    HAL_XSPI_DISABLE_IT(hxspi, HAL_XSPI_IT_TO);
 
-/**
-  * @brief  FIFO Threshold callback.
-  * @param  hxspi : XSPI handle
-  * @retval None
-  */
-__weak void HAL_XSPI_FifoThresholdCallback(XSPI_HandleTypeDef *hxspi)
-{
-  /* Prevent unused argument(s) compilation warning */
-  UNUSED(hxspi);
+    /* Release the chip select, flush the prefetch and return to the indirect mode */
+    status = HAL_XSPI_Abort(hxspi);
 
-  /* NOTE : This function should not be modified, when the callback is needed,
-            the HAL_XSPI_FIFOThresholdCallback could be implemented in the user file
-   */
+    if (status == HAL_OK)
+    {
+      pContext->Suspended = 1U;
+    }
+  }
+  else
+  {
+    status = HAL_ERROR;
+    hxspi->ErrorCode = HAL_XSPI_ERROR_INVALID_SEQUENCE;
+  }
+
+  return status;
 }
 
 /**
-  * @brief  Command completed callback.
-  * @param  hxspi : XSPI handle
-  * @retval None
+  * @brief  Restore the Memory Mapped mode suspended by HAL_XSPI_XIP_Suspend().
+  * @param  hxspi    : XSPI handle
+  * @param  pContext : Pointer to the execute-in-place context filled by HAL_XSPI_XIP_Suspend()
+  * @retval HAL status
   */
-__weak void HAL_XSPI_CmdCpltCallback(XSPI_HandleTypeDef *hxspi)
+HAL_StatusTypeDef HAL_XSPI_XIP_Resume(XSPI_HandleTypeDef *hxspi, XSPI_XIPContextTypeDef *pContext)
 {
-  /* Prevent unused argument(s) compilation warning */
-  UNUSED(hxspi);
+  HAL_StatusTypeDef status;
+  uint32_t tickstart = HAL_GetTick();
 
-  /* NOTE: This function should not be modified, when the callback is needed,
-           the HAL_XSPI_CmdCpltCallback could be implemented in the user file
-   */
-}
+  if (pContext == NULL)
+  {
+    return HAL_ERROR;
+  }
 
-/**
-  * @brief  Rx Transfer completed callback.
-  * @param  hxspi : XSPI handle
-  * @retval None
-  */
-__weak void HAL_XSPI_RxCpltCallback(XSPI_HandleTypeDef *hxspi)
-{
-  /* Prevent unused argument(s) compilation warning */
-  UNUSED(hxspi);
+  /* Check the state */
+  if ((pContext->Suspended == 1U) && (hxspi->State == HAL_XSPI_STATE_READY))
+  {
+    /* Wait till busy flag is reset */
+    status = XSPI_WaitFlagStateUntilTimeout(hxspi, HAL_XSPI_FLAG_BUSY, RESET, tickstart, hxspi->Timeout);
 
-  /* NOTE: This function should not be modified, when the callback is needed,
-           the HAL_XSPI_RxCpltCallback could be implemented in the user file
-   */
-}
+    if (status == HAL_OK)
+    {
+      /* Restore the memory-mapped read configuration, the write configuration is left untouched */
+      MODIFY_REG(hxspi->Instance->CR, XSPI_CR_MSEL, pContext->MemorySelect);
+      WRITE_REG(hxspi->Instance->CCR, pContext->ReadCCR);
+      WRITE_REG(hxspi->Instance->TCR, pContext->ReadTCR);
+      WRITE_REG(hxspi->Instance->IR,  pContext->ReadIR);
+      WRITE_REG(hxspi->Instance->ABR, pContext->ReadABR);
 
-/**
-  * @brief  Tx Transfer completed callback.
-  * @param  hxspi : XSPI handle
-  * @retval None
-  */
-__weak void HAL_XSPI_TxCpltCallback(XSPI_HandleTypeDef *hxspi)
-{
-  /* Prevent unused argument(s) compilation warning */
-  UNUSED(hxspi);
+      hxspi->State = HAL_XSPI_STATE_CMD_CFG;
 
-  /* NOTE: This function should not be modified, when the callback is needed,
-           the HAL_XSPI_TxCpltCallback could be implemented in the user file
-   */
-}
+      /* Re-enable the memory-mapped mode with its timeout and prefetch settings */
+      status = HAL_XSPI_MemoryMapped(hxspi, &(pContext->MemoryMappedCfg));
 
-/**
-  * @brief  Rx Half Transfer completed callback.
-  * @param  hxspi : XSPI handle
-  * @retval None
-  */
-__weak void HAL_XSPI_RxHalfCpltCallback(XSPI_HandleTypeDef *hxspi)
-{
-  /* Prevent unused argument(s) compilation warning */
-  UNUSED(hxspi);
+      if (status == HAL_OK)
+      {
+        pContext->Suspended = 0U;
+      }
+    }
+  }
+  else
+  {
+    status = HAL_ERROR;
+    hxspi->ErrorCode = HAL_XSPI_ERROR_INVALID_SEQUENCE;
+  }
 
-  /* NOTE: This function should not be modified, when the callback is needed,
-           the HAL_XSPI_RxHalfCpltCallback could be implemented in the user file
-   */
+  return status;
 }
 
 /**
-  * @brief  Tx Half Transfer completed callback.
-  * @param  hxspi : XSPI handle
-  * @retval None
+  * @brief  Perform a program or erase operation of the external memory used in Memory Mapped mode.
+  * @param  hxspi      : XSPI handle
+  * @param  pContext   : Pointer to the execute-in-place context
+  * @param  pOperation : Pointer to structure that contains the program or erase operation information
+  * @param  Timeout    : Timeout duration of the end of operation polling
+  * @note   The memory-mapped mode is suspended during the operation and always restored before
+  *         returning, the caches being invalidated on the modified range.
+  * @retval HAL status
   */
-__weak void HAL_XSPI_TxHalfCpltCallback(XSPI_HandleTypeDef *hxspi)
+HAL_StatusTypeDef HAL_XSPI_XIP_Execute(XSPI_HandleTypeDef *hxspi, XSPI_XIPContextTypeDef *pContext,
+                                       const XSPI_XIPOperationTypeDef *pOperation, uint32_t Timeout)
 {
-  /* Prevent unused argument(s) compilation warning */
-  UNUSED(hxspi);
+  HAL_StatusTypeDef status;
+  HAL_StatusTypeDef resume_status;
+  uint32_t error_code;
 
-  /* NOTE: This function should not be modified, when the callback is needed,
-           the HAL_XSPI_TxHalfCpltCallback could be implemented in the user file
-   */
+  if ((pOperation == NULL) || (pOperation->pOperationCmd == NULL) || (pOperation->pStatusCmd == NULL) ||
+      (pOperation->pStatusPolling == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Leave the memory-mapped mode */
+  status = HAL_XSPI_XIP_Suspend(hxspi, pContext);
+  if (status != HAL_OK)
+  {
+    return status;
+  }
+
+  /* Enable the write operations of the memory */
+  if (pOperation->pWriteEnableCmd != NULL)
+  {
+    status = HAL_XSPI_Command(hxspi, pOperation->pWriteEnableCmd, hxspi->Timeout);
+  }
+
+  /* Start the program or erase operation */
+  if (status == HAL_OK)
+  {
+    status = HAL_XSPI_Command(hxspi, pOperation->pOperationCmd, hxspi->Timeout);
+
+    if ((status == HAL_OK) && (pOperation->pOperationCmd->DataMode != HAL_XSPI_DATA_NONE))
+    {
+      status = HAL_XSPI_Transmit(hxspi, pOperation->pData, hxspi->Timeout);
+    }
+  }
+
+  /* Wait for the end of the operation */
+  if (status == HAL_OK)
+  {
+    status = HAL_XSPI_Command(hxspi, pOperation->pStatusCmd, hxspi->Timeout);
+
+    if (status == HAL_OK)
+    {
+      status = HAL_XSPI_AutoPolling(hxspi, pOperation->pStatusPolling, Timeout);
+    }
+  }
+
+  if (status != HAL_OK)
+  {
+    /* Stop the pending indirect or auto-polling transfer, keeping the error code of the failure */
+    error_code = hxspi->ErrorCode;
+    (void)HAL_XSPI_Abort(hxspi);
+    hxspi->ErrorCode |= error_code;
+  }
+
+  /* Invalidate the cached content of the modified range, even partially modified */
+#if defined(HAL_DCACHE_MODULE_ENABLED)
+  if ((pContext->hdcache != NULL) && (pOperation->Size != 0U))
+  {
+    (void)HAL_DCACHE_InvalidateByAddr(pContext->hdcache, (const uint32_t *)pOperation->MappedAddress,
+                                      pOperation->Size);
+  }
+#endif /* HAL_DCACHE_MODULE_ENABLED */
+#if defined(HAL_ICACHE_MODULE_ENABLED)
+  if (READ_BIT(ICACHE->CR, ICACHE_CR_EN) != 0U)
+  {
+    (void)HAL_ICACHE_Invalidate();
+  }
+#endif /* HAL_ICACHE_MODULE_ENABLED */
+
+  /* Restore the memory-mapped mode */
+  resume_status = HAL_XSPI_XIP_Resume(hxspi, pContext);
+  if (status == HAL_OK)
+  {
+    status = resume_status;
+  }
+
+  return status;
 }
 
 /**
-  * @brief  Status Match callback.
-  * @param  hxspi : XSPI handle
-  * @retval None
+  * @brief  Start the execution of a list of queued transactions in interrupt and DMA mode.
+  * @param  hxspi            : XSPI handle
+  * @param  pQueue           : Pointer to the transaction queue, with its commands and completion callback
+  * @param  pTransactions    : Pointer to the array of transactions, kept unchanged until the end of the queue
+  * @param  TransactionCount : Number of transactions
+  * @note   For each transaction, the write enable command, the command with its data sent by DMA and
+  *         the status polling until the end of the operation are chained from the XSPI interrupt.
+  *         pQueue->pCompleteCallback is called at the end of the last transaction or on the first error.
+  * @note   This function is used only in regular mode with a DMA channel linked for transmit.
+  * @retval HAL status
   */
-__weak void HAL_XSPI_StatusMatchCallback(XSPI_HandleTypeDef *hxspi)
+HAL_StatusTypeDef HAL_XSPI_TransactionQueue_Start(XSPI_HandleTypeDef *hxspi, XSPI_TransactionQueueTypeDef *pQueue,
+                                                  const XSPI_TransactionTypeDef *pTransactions,
+                                                  uint32_t TransactionCount)
 {
-  /* Prevent unused argument(s) compilation warning */
-  UNUSED(hxspi);
+  HAL_StatusTypeDef status;
+  uint32_t error_code;
 
-  /* NOTE : This function should not be modified, when the callback is needed,
-            the HAL_XSPI_StatusMatchCallback could be implemented in the user file
-   */
+  if ((pQueue == NULL) || (pTransactions == NULL) || (TransactionCount == 0U) ||
+      ((pQueue->StatusCmd.InstructionMode != HAL_XSPI_INSTRUCTION_NONE) &&
+       (pQueue->StatusPolling.AutomaticStop != HAL_XSPI_AUTOMATIC_STOP_ENABLE)))
+  {
+    hxspi->ErrorCode = HAL_XSPI_ERROR_INVALID_PARAM;
+    return HAL_ERROR;
+  }
+
+  /* Check the state */
+  if ((hxspi->State == HAL_XSPI_STATE_READY) && (hxspi->pTransactionQueue == NULL) &&
+      (hxspi->Init.MemoryType != HAL_XSPI_MEMTYPE_HYPERBUS))
+  {
+    pQueue->pTransactions    = pTransactions;
+    pQueue->TransactionCount = TransactionCount;
+    pQueue->Index            = 0U;
+    pQueue->Step             = XSPI_QUEUE_STEP_WRITE_ENABLE;
+    pQueue->ErrorCode        = HAL_XSPI_ERROR_NONE;
+
+    hxspi->pTransactionQueue = pQueue;
+
+    /* Issue the first step, the next ones are issued from the XSPI interrupt */
+    status = XSPI_TransactionQueue_Issue(hxspi);
+
+    if (status != HAL_OK)
+    {
+      error_code = hxspi->ErrorCode;
+      (void)HAL_XSPI_Abort(hxspi);
+
+      hxspi->ErrorCode = error_code;
+      hxspi->pTransactionQueue = NULL;
+    }
+  }
+  else
+  {
+    status = HAL_ERROR;
+    hxspi->ErrorCode = HAL_XSPI_ERROR_INVALID_SEQUENCE;
+  }
+
+  return status;
 }
 
 /**
-  * @brief  Timeout callback.
+  * @brief  Initialize a NOR flash block device on top of the XSPI handle.
   * @param  hxspi : XSPI handle
-  * @retval None
+  * @param  pDev  : Pointer to the block device, with its commands, geometry and buffers filled
+  * @note   When pDev->pXIPContext is not NULL, the memory-mapped mode must already be configured:
+  *         the reads are done from the memory-mapped region and the programs and erases with
+  *         HAL_XSPI_XIP_Execute(). Otherwise the memory is accessed in indirect mode.
+  * @retval HAL status
   */
-__weak void HAL_XSPI_TimeOutCallback(XSPI_HandleTypeDef *hxspi)
+HAL_StatusTypeDef HAL_XSPI_BlockDev_Init(XSPI_HandleTypeDef *hxspi, XSPI_BlockDevTypeDef *pDev)
 {
-  /* Prevent unused argument(s) compilation warning */
-  UNUSED(hxspi);
+  uint32_t index;
 
-  /* NOTE : This function should not be modified, when the callback is needed,
-            the HAL_XSPI_TimeOutCallback could be implemented in the user file
-   */
+  if ((pDev == NULL) || (pDev->PageSize == 0U) || (pDev->SectorSize < pDev->PageSize) ||
+      ((pDev->SectorSize % pDev->PageSize) != 0U) || (pDev->pPageBuffer == NULL) ||
+      (pDev->CacheNbr > XSPI_BLOCKDEV_CACHE_NBR_MAX) || ((pDev->CacheNbr != 0U) && (pDev->pCacheBuffer == NULL)) ||
+      (pDev->StatusCmd.DataLength == 0U) || (pDev->StatusCmd.DataLength > 4U) ||
+      (pDev->StatusPolling.AutomaticStop != HAL_XSPI_AUTOMATIC_STOP_ENABLE))
+  {
+    hxspi->ErrorCode = HAL_XSPI_ERROR_INVALID_PARAM;
+    return HAL_ERROR;
+  }
+
+  /* The access mode of the block device must match the current mode of the memory */
+  if ((pDev->pXIPContext != NULL) != (HAL_XSPI_IsMemoryMapped(hxspi) != 0U))
+  {
+    hxspi->ErrorCode = HAL_XSPI_ERROR_INVALID_SEQUENCE;
+    return HAL_ERROR;
+  }
+
+  pDev->PageAddress = XSPI_BLOCKDEV_NO_ADDRESS;
+  pDev->CacheStamp  = 0U;
+
+  for (index = 0U; index < XSPI_BLOCKDEV_CACHE_NBR_MAX; index++)
+  {
+    pDev->aCacheAddress[index] = XSPI_BLOCKDEV_NO_ADDRESS;
+    pDev->aCacheStamp[index]   = 0U;
+  }
+
+  for (index = 0U; index < XSPI_BLOCKDEV_ERASE_NBR_MAX; index++)
+  {
+    pDev->aEraseAddress[index] = XSPI_BLOCKDEV_NO_ADDRESS;
+    pDev->aEraseState[index]   = XSPI_BLOCKDEV_ERASE_FREE;
+  }
+
+  return HAL_OK;
 }
 
-#if defined (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U)
 /**
-  * @brief  Register a User XSPI Callback
-  *         To be used to override the weak predefined callback
-  * @param hxspi : XSPI handle
-  * @param CallbackID : ID of the callback to be registered
-  *        This parameter can be one of the following values:
-  *          @arg @ref HAL_XSPI_ERROR_CB_ID          XSPI Error Callback ID
-  *          @arg @ref HAL_XSPI_ABORT_CB_ID          XSPI Abort Callback ID
-  *          @arg @ref HAL_XSPI_FIFO_THRESHOLD_CB_ID XSPI FIFO Threshold Callback ID
-  *          @arg @ref HAL_XSPI_CMD_CPLT_CB_ID       XSPI Command Complete Callback ID
-  *          @arg @ref HAL_XSPI_RX_CPLT_CB_ID        XSPI Rx Complete Callback ID
-  *          @arg @ref HAL_XSPI_TX_CPLT_CB_ID        XSPI Tx Complete Callback ID
-  *          @arg @ref HAL_XSPI_RX_HALF_CPLT_CB_ID   XSPI Rx Half Complete Callback ID
-  *          @arg @ref HAL_XSPI_TX_HALF_CPLT_CB_ID   XSPI Tx Half Complete Callback ID
-  *          @arg @ref HAL_XSPI_STATUS_MATCH_CB_ID   XSPI Status Match Callback ID
-  *          @arg @ref HAL_XSPI_TIMEOUT_CB_ID        XSPI Timeout Callback ID
-  *          @arg @ref HAL_XSPI_MSP_INIT_CB_ID       XSPI MspInit callback ID
-  *          @arg @ref HAL_XSPI_MSP_DEINIT_CB_ID     XSPI MspDeInit callback ID
-  * @param pCallback : pointer to the Callback function
-  * @retval status
+  * @brief  Read data from a NOR flash block device.
+  * @param  hxspi   : XSPI handle
+  * @param  pDev    : Pointer to the block device
+  * @param  Address : Address of the data in the memory
+  * @param  pData   : Pointer to the data buffer
+  * @param  Size    : Number of bytes to read
+  * @note   The sectors read are loaded in the sector cache, the least recently used one being replaced.
+  *         The data programmed but not yet written to the memory are returned.
+  * @retval HAL status
   */
-HAL_StatusTypeDef HAL_XSPI_RegisterCallback(XSPI_HandleTypeDef *hxspi, HAL_XSPI_CallbackIDTypeDef CallbackID,
-                                            pXSPI_CallbackTypeDef pCallback)
+HAL_StatusTypeDef HAL_XSPI_BlockDev_Read(XSPI_HandleTypeDef *hxspi, XSPI_BlockDevTypeDef *pDev, uint32_t Address,
+                                         uint8_t *pData, uint32_t Size)
 {
   HAL_StatusTypeDef status = HAL_OK;
-
-  if (pCallback == NULL)
+  const uint8_t *p_sector;
+  uint8_t *p_data = pData;
+  uint32_t address = Address;
+  uint32_t size = Size;
+  uint32_t offset;
+  uint32_t chunk;
+  uint32_t index;
+
+  if ((pDev == NULL) || (pData == NULL) || (Size == 0U))
   {
-    /* Update the error code */
-    hxspi->ErrorCode |= HAL_XSPI_ERROR_INVALID_CALLBACK;
+    hxspi->ErrorCode = HAL_XSPI_ERROR_INVALID_PARAM;
     return HAL_ERROR;
   }
 
-  if (hxspi->State == HAL_XSPI_STATE_READY)
+  while ((size != 0U) && (status == HAL_OK))
   {
-    switch (CallbackID)
+    offset = address % pDev->SectorSize;
+    chunk  = ((pDev->SectorSize - offset) < size) ? (pDev->SectorSize - offset) : size;
+
+    if (pDev->CacheNbr != 0U)
     {
-      case  HAL_XSPI_ERROR_CB_ID :
-        hxspi->ErrorCallback = pCallback;
-        break;
-      case HAL_XSPI_ABORT_CB_ID :
-        hxspi->AbortCpltCallback = pCallback;
-        break;
-      case HAL_XSPI_FIFO_THRESHOLD_CB_ID :
-        hxspi->FifoThresholdCallback = pCallback;
-        break;
-      case HAL_XSPI_CMD_CPLT_CB_ID :
-        hxspi->CmdCpltCallback = pCallback;
-        break;
-      case HAL_XSPI_RX_CPLT_CB_ID :
-        hxspi->RxCpltCallback = pCallback;
-        break;
-      case HAL_XSPI_TX_CPLT_CB_ID :
-        hxspi->TxCpltCallback = pCallback;
-        break;
-      case HAL_XSPI_RX_HALF_CPLT_CB_ID :
-        hxspi->RxHalfCpltCallback = pCallback;
-        break;
-      case HAL_XSPI_TX_HALF_CPLT_CB_ID :
-        hxspi->TxHalfCpltCallback = pCallback;
-        break;
-      case HAL_XSPI_STATUS_MATCH_CB_ID :
-        hxspi->StatusMatchCallback = pCallback;
-        break;
-      case HAL_XSPI_TIMEOUT_CB_ID :
-        hxspi->TimeOutCallback = pCallback;
-        break;
-      case HAL_XSPI_MSP_INIT_CB_ID :
-        hxspi->MspInitCallback = pCallback;
-        break;
-      case HAL_XSPI_MSP_DEINIT_CB_ID :
-        hxspi->MspDeInitCallback = pCallback;
-        break;
-      default :
-        /* Update the error code */
-        hxspi->ErrorCode |= HAL_XSPI_ERROR_INVALID_CALLBACK;
-        /* update return status */
-        status =  HAL_ERROR;
-        break;
+      status = XSPI_BlockDev_CacheLoad(hxspi, pDev, address - offset, &p_sector);
+
+      if (status == HAL_OK)
+      {
+        for (index = 0U; index < chunk; index++)
+        {
+          p_data[index] = p_sector[offset + index];
+        }
+      }
     }
-  }
-  else if (hxspi->State == HAL_XSPI_STATE_RESET)
-  {
-    switch (CallbackID)
+    else
     {
-      case HAL_XSPI_MSP_INIT_CB_ID :
-        hxspi->MspInitCallback = pCallback;
-        break;
-      case HAL_XSPI_MSP_DEINIT_CB_ID :
-        hxspi->MspDeInitCallback = pCallback;
-        break;
-      default :
-        /* Update the error code */
-        hxspi->ErrorCode |= HAL_XSPI_ERROR_INVALID_CALLBACK;
-        /* update return status */
-        status =  HAL_ERROR;
-        break;
+      status = XSPI_BlockDev_ReadMemory(hxspi, pDev, address, p_data, chunk);
     }
-  }
-  else
-  {
-    /* Update the error code */
-    hxspi->ErrorCode |= HAL_XSPI_ERROR_INVALID_CALLBACK;
-    /* update return status */
-    status =  HAL_ERROR;
+
+    address += chunk;
+    p_data  += chunk;
+    size    -= chunk;
   }
 
   return status;
 }
 
 /**
-  * @brief  Unregister a User XSPI Callback
-  *         XSPI Callback is redirected to the weak predefined callback
-  * @param hxspi : XSPI handle
-  * @param CallbackID : ID of the callback to be unregistered
-  *        This parameter can be one of the following values:
-  *          @arg @ref HAL_XSPI_ERROR_CB_ID          XSPI Error Callback ID
-  *          @arg @ref HAL_XSPI_ABORT_CB_ID          XSPI Abort Callback ID
-  *          @arg @ref HAL_XSPI_FIFO_THRESHOLD_CB_ID XSPI FIFO Threshold Callback ID
-  *          @arg @ref HAL_XSPI_CMD_CPLT_CB_ID       XSPI Command Complete Callback ID
-  *          @arg @ref HAL_XSPI_RX_CPLT_CB_ID        XSPI Rx Complete Callback ID
-  *          @arg @ref HAL_XSPI_TX_CPLT_CB_ID        XSPI Tx Complete Callback ID
-  *          @arg @ref HAL_XSPI_RX_HALF_CPLT_CB_ID   XSPI Rx Half Complete Callback ID
-  *          @arg @ref HAL_XSPI_TX_HALF_CPLT_CB_ID   XSPI Tx Half Complete Callback ID
-  *          @arg @ref HAL_XSPI_STATUS_MATCH_CB_ID   XSPI Status Match Callback ID
-  *          @arg @ref HAL_XSPI_TIMEOUT_CB_ID        XSPI Timeout Callback ID
-  *          @arg @ref HAL_XSPI_MSP_INIT_CB_ID       XSPI MspInit callback ID
-  *          @arg @ref HAL_XSPI_MSP_DEINIT_CB_ID     XSPI MspDeInit callback ID
-  * @retval status
+  * @brief  Program data to a NOR flash block device.
+  * @param  hxspi   : XSPI handle
+  * @param  pDev    : Pointer to the block device
+  * @param  Address : Address of the data in the memory, in an erased area
+  * @param  pData   : Pointer to the data buffer
+  * @param  Size    : Number of bytes to program
+  * @note   The data are coalesced in the page buffer, which is written to the memory with a single
+  *         page program once the end of the page is reached, when another page is programmed, or
+  *         by HAL_XSPI_BlockDev_Sync().
+  * @retval HAL status
   */
-HAL_StatusTypeDef HAL_XSPI_UnRegisterCallback(XSPI_HandleTypeDef *hxspi, HAL_XSPI_CallbackIDTypeDef CallbackID)
+HAL_StatusTypeDef HAL_XSPI_BlockDev_Program(XSPI_HandleTypeDef *hxspi, XSPI_BlockDevTypeDef *pDev,
+                                            uint32_t Address, const uint8_t *pData, uint32_t Size)
 {
   HAL_StatusTypeDef status = HAL_OK;
+  const uint8_t *p_data = pData;
+  uint32_t address = Address;
+  uint32_t size = Size;
+  uint32_t page;
+  uint32_t offset;
+  uint32_t chunk;
+  uint32_t slot;
+  uint32_t erased;
+  uint32_t index;
+
+  if ((pDev == NULL) || (pData == NULL) || (Size == 0U))
+  {
+    hxspi->ErrorCode = HAL_XSPI_ERROR_INVALID_PARAM;
+    return HAL_ERROR;
+  }
 
-  if (hxspi->State == HAL_XSPI_STATE_READY)
+  while ((size != 0U) && (status == HAL_OK))
   {
-    switch (CallbackID)
+    offset = address % pDev->PageSize;
+    page   = address - offset;
+    chunk  = ((pDev->PageSize - offset) < size) ? (pDev->PageSize - offset) : size;
+
+    if (pDev->PageAddress != page)
     {
-      case  HAL_XSPI_ERROR_CB_ID :
-        hxspi->ErrorCallback = HAL_XSPI_ErrorCallback;
-        break;
-      case HAL_XSPI_ABORT_CB_ID :
-        hxspi->AbortCpltCallback = HAL_XSPI_AbortCpltCallback;
-        break;
-      case HAL_XSPI_FIFO_THRESHOLD_CB_ID :
-        hxspi->FifoThresholdCallback = HAL_XSPI_FifoThresholdCallback;
-        break;
-      case HAL_XSPI_CMD_CPLT_CB_ID :
-        hxspi->CmdCpltCallback = HAL_XSPI_CmdCpltCallback;
-        break;
-      case HAL_XSPI_RX_CPLT_CB_ID :
-        hxspi->RxCpltCallback = HAL_XSPI_RxCpltCallback;
-        break;
-      case HAL_XSPI_TX_CPLT_CB_ID :
-        hxspi->TxCpltCallback = HAL_XSPI_TxCpltCallback;
-        break;
-      case HAL_XSPI_RX_HALF_CPLT_CB_ID :
-        hxspi->RxHalfCpltCallback = HAL_XSPI_RxHalfCpltCallback;
-        break;
-      case HAL_XSPI_TX_HALF_CPLT_CB_ID :
-        hxspi->TxHalfCpltCallback = HAL_XSPI_TxHalfCpltCallback;
-        break;
-      case HAL_XSPI_STATUS_MATCH_CB_ID :
-        hxspi->StatusMatchCallback = HAL_XSPI_StatusMatchCallback;
-        break;
-      case HAL_XSPI_TIMEOUT_CB_ID :
-        hxspi->TimeOutCallback = HAL_XSPI_TimeOutCallback;
-        break;
-      case HAL_XSPI_MSP_INIT_CB_ID :
-        hxspi->MspInitCallback = HAL_XSPI_MspInit;
-        break;
-      case HAL_XSPI_MSP_DEINIT_CB_ID :
-        hxspi->MspDeInitCallback = HAL_XSPI_MspDeInit;
-        break;
-      default :
-        /* Update the error code */
-        hxspi->ErrorCode |= HAL_XSPI_ERROR_INVALID_CALLBACK;
-        /* update return status */
-        status =  HAL_ERROR;
-        break;
+      /* Write the previous page, then start coalescing this one */
+      status = XSPI_BlockDev_Flush(hxspi, pDev);
+
+      if (status == HAL_OK)
+      {
+        /* The sector is being programmed, it must not be erased in the background */
+        status = XSPI_BlockDev_Release(hxspi, pDev, page - (page % pDev->SectorSize), &erased);
+      }
+
+      if (status == HAL_OK)
+      {
+        pDev->PageAddress = page;
+
+        for (index = 0U; index < pDev->PageSize; index++)
+        {
+          pDev->pPageBuffer[index] = 0xFFU;
+        }
+      }
     }
-  }
-  else if (hxspi->State == HAL_XSPI_STATE_RESET)
-  {
-    switch (CallbackID)
+
+    if (status == HAL_OK)
     {
-      case HAL_XSPI_MSP_INIT_CB_ID :
-        hxspi->MspInitCallback = HAL_XSPI_MspInit;
-        break;
-      case HAL_XSPI_MSP_DEINIT_CB_ID :
-        hxspi->MspDeInitCallback = HAL_XSPI_MspDeInit;
-        break;
-      default :
-        /* Update the error code */
-        hxspi->ErrorCode |= HAL_XSPI_ERROR_INVALID_CALLBACK;
-        /* update return status */
-        status =  HAL_ERROR;
-        break;
+      /* Programming only clears bits */
+      for (index = 0U; index < chunk; index++)
+      {
+        pDev->pPageBuffer[offset + index] &= p_data[index];
+      }
+
+      slot = XSPI_BlockDev_CacheFind(pDev, address - (address % pDev->SectorSize));
+      if (slot < pDev->CacheNbr)
+      {
+        offset = (slot * pDev->SectorSize) + (address % pDev->SectorSize);
+
+        for (index = 0U; index < chunk; index++)
+        {
+          pDev->pCacheBuffer[offset + index] &= p_data[index];
+        }
+      }
+
+      /* The page is complete when the data reach its end */
+      if (((address + chunk) % pDev->PageSize) == 0U)
+      {
+        status = XSPI_BlockDev_Flush(hxspi, pDev);
+      }
     }
+
+    address += chunk;
+    p_data  += chunk;
+    size    -= chunk;
   }
-  else
+
+  return status;
+}
+
+/**
+  * @brief  Erase a sector of a NOR flash block device.
+  * @param  hxspi   : XSPI handle
+  * @param  pDev    : Pointer to the block device
+  * @param  Address : Address of the sector in the memory, aligned on the sector size
+  * @note   The erase is skipped when the sector has already been erased in the background after
+  *         a call to HAL_XSPI_BlockDev_ReserveErase().
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_XSPI_BlockDev_Erase(XSPI_HandleTypeDef *hxspi, XSPI_BlockDevTypeDef *pDev, uint32_t Address)
+{
+  HAL_StatusTypeDef status;
+  XSPI_RegularCmdTypeDef cmd;
+  uint32_t erased;
+
+  if ((pDev == NULL) || ((Address % pDev->SectorSize) != 0U))
   {
-    /* Update the error code */
-    hxspi->ErrorCode |= HAL_XSPI_ERROR_INVALID_CALLBACK;
-    /* update return status */
-    status =  HAL_ERROR;
+    hxspi->ErrorCode = HAL_XSPI_ERROR_INVALID_PARAM;
+    return HAL_ERROR;
+  }
+
+  XSPI_BlockDev_Discard(pDev, Address);
+
+  status = XSPI_BlockDev_Release(hxspi, pDev, Address, &erased);
+
+  if ((status == HAL_OK) && (erased == 0U))
+  {
+    cmd = pDev->EraseCmd;
+    cmd.Address = Address;
+
+    status = XSPI_BlockDev_Operation(hxspi, pDev, &cmd, NULL, 1U);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Write the coalesced page and wait for the end of the background erase of a NOR flash block device.
+  * @param  hxspi : XSPI handle
+  * @param  pDev  : Pointer to the block device
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_XSPI_BlockDev_Sync(XSPI_HandleTypeDef *hxspi, XSPI_BlockDevTypeDef *pDev)
+{
+  HAL_StatusTypeDef status;
+
+  if (pDev == NULL)
+  {
+    hxspi->ErrorCode = HAL_XSPI_ERROR_INVALID_PARAM;
+    return HAL_ERROR;
+  }
+
+  status = XSPI_BlockDev_Flush(hxspi, pDev);
+
+  if (status == HAL_OK)
+  {
+    status = XSPI_BlockDev_WaitErase(hxspi, pDev);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Reserve a free sector of a NOR flash block device for a background erase.
+  * @param  hxspi   : XSPI handle
+  * @param  pDev    : Pointer to the block device
+  * @param  Address : Address of the sector in the memory, aligned on the sector size
+  * @note   The sector is erased by HAL_XSPI_BlockDev_Process(), its content must no longer be needed.
+  *         A later HAL_XSPI_BlockDev_Erase() of the sector then returns without accessing the memory.
+  *         Programming the sector cancels the reservation.
+  * @retval HAL status, HAL_BUSY when XSPI_BLOCKDEV_ERASE_NBR_MAX sectors are already reserved
+  */
+HAL_StatusTypeDef HAL_XSPI_BlockDev_ReserveErase(XSPI_HandleTypeDef *hxspi, XSPI_BlockDevTypeDef *pDev,
+                                                 uint32_t Address)
+{
+  uint32_t index;
+  uint32_t slot = XSPI_BLOCKDEV_ERASE_NBR_MAX;
+
+  if ((pDev == NULL) || ((Address % pDev->SectorSize) != 0U))
+  {
+    hxspi->ErrorCode = HAL_XSPI_ERROR_INVALID_PARAM;
+    return HAL_ERROR;
+  }
+
+  for (index = 0U; index < XSPI_BLOCKDEV_ERASE_NBR_MAX; index++)
+  {
+    if (pDev->aEraseState[index] == XSPI_BLOCKDEV_ERASE_FREE)
+    {
+      slot = (slot == XSPI_BLOCKDEV_ERASE_NBR_MAX) ? index : slot;
+    }
+    else if (pDev->aEraseAddress[index] == Address)
+    {
+      /* Already reserved */
+      return HAL_OK;
+    }
+    else
+    {
+      /* Sector reserved for another address */
+    }
+  }
+
+  if (slot == XSPI_BLOCKDEV_ERASE_NBR_MAX)
+  {
+    return HAL_BUSY;
+  }
+
+  pDev->aEraseAddress[slot] = Address;
+  pDev->aEraseState[slot]   = XSPI_BLOCKDEV_ERASE_PENDING;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Advance the background erase of the reserved sectors of a NOR flash block device.
+  * @param  hxspi : XSPI handle
+  * @param  pDev  : Pointer to the block device
+  * @note   To be called when the memory is idle. In indirect mode this function never waits for the
+  *         memory: it checks the end of the running erase or starts the erase of the next reserved
+  *         sector, the other block device functions waiting for the end of a running erase. In
+  *         memory-mapped mode the erase of the next reserved sector is done by HAL_XSPI_XIP_Execute().
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_XSPI_BlockDev_Process(XSPI_HandleTypeDef *hxspi, XSPI_BlockDevTypeDef *pDev)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  XSPI_RegularCmdTypeDef cmd;
+  uint32_t index;
+  uint32_t ongoing = XSPI_BLOCKDEV_ERASE_NBR_MAX;
+  uint32_t pending = XSPI_BLOCKDEV_ERASE_NBR_MAX;
+  uint32_t done;
+
+  if (pDev == NULL)
+  {
+    hxspi->ErrorCode = HAL_XSPI_ERROR_INVALID_PARAM;
+    return HAL_ERROR;
+  }
+
+  for (index = 0U; index < XSPI_BLOCKDEV_ERASE_NBR_MAX; index++)
+  {
+    if (pDev->aEraseState[index] == XSPI_BLOCKDEV_ERASE_ONGOING)
+    {
+      ongoing = index;
+    }
+    else if ((pDev->aEraseState[index] == XSPI_BLOCKDEV_ERASE_PENDING) && (pending == XSPI_BLOCKDEV_ERASE_NBR_MAX))
+    {
+      pending = index;
+    }
+    else
+    {
+      /* Nothing to do for this sector */
+    }
+  }
+
+  if (ongoing != XSPI_BLOCKDEV_ERASE_NBR_MAX)
+  {
+    /* Check the end of the running erase */
+    status = XSPI_BlockDev_PollErase(hxspi, pDev, &done);
+
+    if (status != HAL_OK)
+    {
+      pDev->aEraseState[ongoing] = XSPI_BLOCKDEV_ERASE_FREE;
+    }
+    else if (done != 0U)
+    {
+      pDev->aEraseState[ongoing] = XSPI_BLOCKDEV_ERASE_DONE;
+    }
+    else
+    {
+      /* Erase still running */
+    }
+  }
+  else if (pending != XSPI_BLOCKDEV_ERASE_NBR_MAX)
+  {
+    XSPI_BlockDev_Discard(pDev, pDev->aEraseAddress[pending]);
+
+    cmd = pDev->EraseCmd;
+    cmd.Address = pDev->aEraseAddress[pending];
+
+    if (pDev->pXIPContext != NULL)
+    {
+      status = XSPI_BlockDev_Operation(hxspi, pDev, &cmd, NULL, 1U);
+      pDev->aEraseState[pending] = XSPI_BLOCKDEV_ERASE_DONE;
+    }
+    else
+    {
+      status = XSPI_BlockDev_Operation(hxspi, pDev, &cmd, NULL, 0U);
+      pDev->aEraseState[pending] = XSPI_BLOCKDEV_ERASE_ONGOING;
+    }
+
+    if (status != HAL_OK)
+    {
+      pDev->aEraseState[pending] = XSPI_BLOCKDEV_ERASE_FREE;
+    }
+  }
+  else
+  {
+    /* No reserved sector to erase */
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Transfer Error callback.
+  * @param  hxspi : XSPI handle
+  * @retval None
+  */
+__weak void HAL_XSPI_ErrorCallback(XSPI_HandleTypeDef *hxspi)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hxspi);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_XSPI_ErrorCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Abort completed callback.
+  * @param  hxspi : XSPI handle
+  * @retval None
+  */
+__weak void HAL_XSPI_AbortCpltCallback(XSPI_HandleTypeDef *hxspi)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hxspi);
+
+  /* NOTE: This function should not be modified, when the callback is needed,
+           the HAL_XSPI_AbortCpltCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  FIFO Threshold callback.
+  * @param  hxspi : XSPI handle
+  * @retval None
+  */
+__weak void HAL_XSPI_FifoThresholdCallback(XSPI_HandleTypeDef *hxspi)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hxspi);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_XSPI_FIFOThresholdCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Command completed callback.
+  * @param  hxspi : XSPI handle
+  * @retval None
+  */
+__weak void HAL_XSPI_CmdCpltCallback(XSPI_HandleTypeDef *hxspi)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hxspi);
+
+  /* NOTE: This function should not be modified, when the callback is needed,
+           the HAL_XSPI_CmdCpltCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Rx Transfer completed callback.
+  * @param  hxspi : XSPI handle
+  * @retval None
+  */
+__weak void HAL_XSPI_RxCpltCallback(XSPI_HandleTypeDef *hxspi)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hxspi);
+
+  /* NOTE: This function should not be modified, when the callback is needed,
+           the HAL_XSPI_RxCpltCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Tx Transfer completed callback.
+  * @param  hxspi : XSPI handle
+  * @retval None
+  */
+__weak void HAL_XSPI_TxCpltCallback(XSPI_HandleTypeDef *hxspi)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hxspi);
+
+  /* NOTE: This function should not be modified, when the callback is needed,
+           the HAL_XSPI_TxCpltCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Rx Half Transfer completed callback.
+  * @param  hxspi : XSPI handle
+  * @retval None
+  */
+__weak void HAL_XSPI_RxHalfCpltCallback(XSPI_HandleTypeDef *hxspi)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hxspi);
+
+  /* NOTE: This function should not be modified, when the callback is needed,
+           the HAL_XSPI_RxHalfCpltCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Tx Half Transfer completed callback.
+  * @param  hxspi : XSPI handle
+  * @retval None
+  */
+__weak void HAL_XSPI_TxHalfCpltCallback(XSPI_HandleTypeDef *hxspi)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hxspi);
+
+  /* NOTE: This function should not be modified, when the callback is needed,
+           the HAL_XSPI_TxHalfCpltCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Status Match callback.
+  * @param  hxspi : XSPI handle
+  * @retval None
+  */
+__weak void HAL_XSPI_StatusMatchCallback(XSPI_HandleTypeDef *hxspi)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hxspi);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_XSPI_StatusMatchCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Timeout callback.
+  * @param  hxspi : XSPI handle
+  * @retval None
+  */
+__weak void HAL_XSPI_TimeOutCallback(XSPI_HandleTypeDef *hxspi)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hxspi);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_XSPI_TimeOutCallback could be implemented in the user file
+   */
+}
+
+#if defined (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U)
+/**
+  * @brief  Register a User XSPI Callback
+  *         To be used to override the weak predefined callback
+  * @param hxspi : XSPI handle
+  * @param CallbackID : ID of the callback to be registered
+  *        This parameter can be one of the following values:
+  *          @arg @ref HAL_XSPI_ERROR_CB_ID          XSPI Error Callback ID
+  *          @arg @ref HAL_XSPI_ABORT_CB_ID          XSPI Abort Callback ID
+  *          @arg @ref HAL_XSPI_FIFO_THRESHOLD_CB_ID XSPI FIFO Threshold Callback ID
+  *          @arg @ref HAL_XSPI_CMD_CPLT_CB_ID       XSPI Command Complete Callback ID
+  *          @arg @ref HAL_XSPI_RX_CPLT_CB_ID        XSPI Rx Complete Callback ID
+  *          @arg @ref HAL_XSPI_TX_CPLT_CB_ID        XSPI Tx Complete Callback ID
+  *          @arg @ref HAL_XSPI_RX_HALF_CPLT_CB_ID   XSPI Rx Half Complete Callback ID
+  *          @arg @ref HAL_XSPI_TX_HALF_CPLT_CB_ID   XSPI Tx Half Complete Callback ID
+  *          @arg @ref HAL_XSPI_STATUS_MATCH_CB_ID   XSPI Status Match Callback ID
+  *          @arg @ref HAL_XSPI_TIMEOUT_CB_ID        XSPI Timeout Callback ID
+  *          @arg @ref HAL_XSPI_MSP_INIT_CB_ID       XSPI MspInit callback ID
+  *          @arg @ref HAL_XSPI_MSP_DEINIT_CB_ID     XSPI MspDeInit callback ID
+  * @param pCallback : pointer to the Callback function
+  * @retval status
+  */
+HAL_StatusTypeDef HAL_XSPI_RegisterCallback(XSPI_HandleTypeDef *hxspi, HAL_XSPI_CallbackIDTypeDef CallbackID,
+                                            pXSPI_CallbackTypeDef pCallback)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if (pCallback == NULL)
+  {
+    /* Update the error code */
+    hxspi->ErrorCode |= HAL_XSPI_ERROR_INVALID_CALLBACK;
+    return HAL_ERROR;
+  }
+
+  if (hxspi->State == HAL_XSPI_STATE_READY)
+  {
+    switch (CallbackID)
+    {
+      case  HAL_XSPI_ERROR_CB_ID :
+        hxspi->ErrorCallback = pCallback;
+        break;
+      case HAL_XSPI_ABORT_CB_ID :
+        hxspi->AbortCpltCallback = pCallback;
+        break;
+      case HAL_XSPI_FIFO_THRESHOLD_CB_ID :
+        hxspi->FifoThresholdCallback = pCallback;
+        break;
+      case HAL_XSPI_CMD_CPLT_CB_ID :
+        hxspi->CmdCpltCallback = pCallback;
+        break;
+      case HAL_XSPI_RX_CPLT_CB_ID :
+        hxspi->RxCpltCallback = pCallback;
+        break;
+      case HAL_XSPI_TX_CPLT_CB_ID :
+        hxspi->TxCpltCallback = pCallback;
+        break;
+      case HAL_XSPI_RX_HALF_CPLT_CB_ID :
+        hxspi->RxHalfCpltCallback = pCallback;
+        break;
+      case HAL_XSPI_TX_HALF_CPLT_CB_ID :
+        hxspi->TxHalfCpltCallback = pCallback;
+        break;
+      case HAL_XSPI_STATUS_MATCH_CB_ID :
+        hxspi->StatusMatchCallback = pCallback;
+        break;
+      case HAL_XSPI_TIMEOUT_CB_ID :
+        hxspi->TimeOutCallback = pCallback;
+        break;
+      case HAL_XSPI_MSP_INIT_CB_ID :
+        hxspi->MspInitCallback = pCallback;
+        break;
+      case HAL_XSPI_MSP_DEINIT_CB_ID :
+        hxspi->MspDeInitCallback = pCallback;
+        break;
+      default :
+        /* Update the error code */
+        hxspi->ErrorCode |= HAL_XSPI_ERROR_INVALID_CALLBACK;
+        /* update return status */
+        status =  HAL_ERROR;
+        break;
+    }
+  }
+  else if (hxspi->State == HAL_XSPI_STATE_RESET)
+  {
+    switch (CallbackID)
+    {
+      case HAL_XSPI_MSP_INIT_CB_ID :
+        hxspi->MspInitCallback = pCallback;
+        break;
+      case HAL_XSPI_MSP_DEINIT_CB_ID :
+        hxspi->MspDeInitCallback = pCallback;
+        break;
+      default :
+        /* Update the error code */
+        hxspi->ErrorCode |= HAL_XSPI_ERROR_INVALID_CALLBACK;
+        /* update return status */
+        status =  HAL_ERROR;
+        break;
+    }
+  }
+  else
+  {
+    /* Update the error code */
+    hxspi->ErrorCode |= HAL_XSPI_ERROR_INVALID_CALLBACK;
+    /* update return status */
+    status =  HAL_ERROR;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Unregister a User XSPI Callback
+  *         XSPI Callback is redirected to the weak predefined callback
+  * @param hxspi : XSPI handle
+  * @param CallbackID : ID of the callback to be unregistered
+  *        This parameter can be one of the following values:
+  *          @arg @ref HAL_XSPI_ERROR_CB_ID          XSPI Error Callback ID
+  *          @arg @ref HAL_XSPI_ABORT_CB_ID          XSPI Abort Callback ID
+  *          @arg @ref HAL_XSPI_FIFO_THRESHOLD_CB_ID XSPI FIFO Threshold Callback ID
+  *          @arg @ref HAL_XSPI_CMD_CPLT_CB_ID       XSPI Command Complete Callback ID
+  *          @arg @ref HAL_XSPI_RX_CPLT_CB_ID        XSPI Rx Complete Callback ID
+  *          @arg @ref HAL_XSPI_TX_CPLT_CB_ID        XSPI Tx Complete Callback ID
+  *          @arg @ref HAL_XSPI_RX_HALF_CPLT_CB_ID   XSPI Rx Half Complete Callback ID
+  *          @arg @ref HAL_XSPI_TX_HALF_CPLT_CB_ID   XSPI Tx Half Complete Callback ID
+  *          @arg @ref HAL_XSPI_STATUS_MATCH_CB_ID   XSPI Status Match Callback ID
+  *          @arg @ref HAL_XSPI_TIMEOUT_CB_ID        XSPI Timeout Callback ID
+  *          @arg @ref HAL_XSPI_MSP_INIT_CB_ID       XSPI MspInit callback ID
+  *          @arg @ref HAL_XSPI_MSP_DEINIT_CB_ID     XSPI MspDeInit callback ID
+  * @retval status
+  */
+HAL_StatusTypeDef HAL_XSPI_UnRegisterCallback(XSPI_HandleTypeDef *hxspi, HAL_XSPI_CallbackIDTypeDef CallbackID)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if (hxspi->State == HAL_XSPI_STATE_READY)
+  {
+    switch (CallbackID)
+    {
+      case  HAL_XSPI_ERROR_CB_ID :
+        hxspi->ErrorCallback = HAL_XSPI_ErrorCallback;
+        break;
+      case HAL_XSPI_ABORT_CB_ID :
+        hxspi->AbortCpltCallback = HAL_XSPI_AbortCpltCallback;
+        break;
+      case HAL_XSPI_FIFO_THRESHOLD_CB_ID :
+        hxspi->FifoThresholdCallback = HAL_XSPI_FifoThresholdCallback;
+        break;
+      case HAL_XSPI_CMD_CPLT_CB_ID :
+        hxspi->CmdCpltCallback = HAL_XSPI_CmdCpltCallback;
+        break;
+      case HAL_XSPI_RX_CPLT_CB_ID :
+        hxspi->RxCpltCallback = HAL_XSPI_RxCpltCallback;
+        break;
+      case HAL_XSPI_TX_CPLT_CB_ID :
+        hxspi->TxCpltCallback = HAL_XSPI_TxCpltCallback;
+        break;
+      case HAL_XSPI_RX_HALF_CPLT_CB_ID :
+        hxspi->RxHalfCpltCallback = HAL_XSPI_RxHalfCpltCallback;
+        break;
+      case HAL_XSPI_TX_HALF_CPLT_CB_ID :
+        hxspi->TxHalfCpltCallback = HAL_XSPI_TxHalfCpltCallback;
+        break;
+      case HAL_XSPI_STATUS_MATCH_CB_ID :
+        hxspi->StatusMatchCallback = HAL_XSPI_StatusMatchCallback;
+        break;
+      case HAL_XSPI_TIMEOUT_CB_ID :
+        hxspi->TimeOutCallback = HAL_XSPI_TimeOutCallback;
+        break;
+      case HAL_XSPI_MSP_INIT_CB_ID :
+        hxspi->MspInitCallback = HAL_XSPI_MspInit;
+        break;
+      case HAL_XSPI_MSP_DEINIT_CB_ID :
+        hxspi->MspDeInitCallback = HAL_XSPI_MspDeInit;
+        break;
+      default :
+        /* Update the error code */
+        hxspi->ErrorCode |= HAL_XSPI_ERROR_INVALID_CALLBACK;
+        /* update return status */
+        status =  HAL_ERROR;
+        break;
+    }
+  }
+  else if (hxspi->State == HAL_XSPI_STATE_RESET)
+  {
+    switch (CallbackID)
+    {
+      case HAL_XSPI_MSP_INIT_CB_ID :
+        hxspi->MspInitCallback = HAL_XSPI_MspInit;
+        break;
+      case HAL_XSPI_MSP_DEINIT_CB_ID :
+        hxspi->MspDeInitCallback = HAL_XSPI_MspDeInit;
+        break;
+      default :
+        /* Update the error code */
+        hxspi->ErrorCode |= HAL_XSPI_ERROR_INVALID_CALLBACK;
+        /* update return status */
+        status =  HAL_ERROR;
+        break;
+    }
+  }
+  else
+  {
+    /* Update the error code */
+    hxspi->ErrorCode |= HAL_XSPI_ERROR_INVALID_CALLBACK;
+    /* update return status */
+    status =  HAL_ERROR;
+  }
+
+  return status;
+}
+#endif /* (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U) */
+
+/**
+  * @}
+  */
+
+/** @defgroup XSPI_Exported_Functions_Group3 Peripheral Control and State functions
+  *  @brief   XSPI control and State functions
+  *
+@verbatim
+ ===============================================================================
+                  ##### Peripheral Control and State functions #####
+ ===============================================================================
+    [..]
+    This subsection provides a set of functions allowing to :
+      (+) Check in run-time the state of the driver.
+      (+) Check the error code set during last operation.
+      (+) Abort any operation.
+      (+) Manage the Fifo threshold.
+      (+) Configure the timeout duration used in the driver.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Abort the current operation, return to the indirect mode.
+  * @param  hxspi : XSPI handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_XSPI_Abort(XSPI_HandleTypeDef *hxspi)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t tickstart = HAL_GetTick();
+
+  /* Check if the state is not in reset state */
+  if (hxspi->State != HAL_XSPI_STATE_RESET)
+  {
+    /* Check if the DMA is enabled */
+    if ((hxspi->Instance->CR & XSPI_CR_DMAEN) != 0U)
+    {
+      /* Disable the DMA transfer on the XSPI side */
+      CLEAR_BIT(hxspi->Instance->CR, XSPI_CR_DMAEN);
+
+      /* Disable the DMA transmit on the DMA side */
+      status = HAL_DMA_Abort(hxspi->hdmatx);
+      if (status != HAL_OK)
+      {
+        hxspi->ErrorCode = HAL_XSPI_ERROR_DMA;
+      }
+
+      /* Disable the DMA receive on the DMA side */
+      status = HAL_DMA_Abort(hxspi->hdmarx);
+      if (status != HAL_OK)
+      {
+        hxspi->ErrorCode = HAL_XSPI_ERROR_DMA;
+      }
+    }
+
+    if (HAL_XSPI_GET_FLAG(hxspi, HAL_XSPI_FLAG_BUSY) != RESET)
+    {
+      /* Perform an abort of the XSPI */
+      SET_BIT(hxspi->Instance->CR, XSPI_CR_ABORT);
+
+      /* Wait until the transfer complete flag is set to go back in idle state */
+      status = XSPI_WaitFlagStateUntilTimeout(hxspi, HAL_XSPI_FLAG_TC, SET, tickstart, hxspi->Timeout);
+
+      if (status == HAL_OK)
+      {
+        /* Clear transfer complete flag */
+        HAL_XSPI_CLEAR_FLAG(hxspi, HAL_XSPI_FLAG_TC);
+
+        /* Wait until the busy flag is reset to go back in idle state */
+        status = XSPI_WaitFlagStateUntilTimeout(hxspi, HAL_XSPI_FLAG_BUSY, RESET, tickstart, hxspi->Timeout);
+
+        if (status == HAL_OK)
+        {
+          /* Return to indirect mode */
+          CLEAR_BIT(hxspi->Instance->CR, XSPI_CR_FMODE);
+
+          hxspi->State = HAL_XSPI_STATE_READY;
+        }
+      }
+    }
+    else
+    {
+      /* Return to indirect mode */
+      CLEAR_BIT(hxspi->Instance->CR, XSPI_CR_FMODE);
+
+      hxspi->State = HAL_XSPI_STATE_READY;
+    }
+  }
+  else
+  {
+    status = HAL_ERROR;
+    hxspi->ErrorCode = HAL_XSPI_ERROR_INVALID_SEQUENCE;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Abort the current operation, return to the indirect mode. (non-blocking function)
+  * @param  hxspi : XSPI handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_XSPI_Abort_IT(XSPI_HandleTypeDef *hxspi)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  /* Check if the state is not in reset state */
+  if (hxspi->State != HAL_XSPI_STATE_RESET)
+  {
+    /* Disable all interrupts */
+    HAL_XSPI_DISABLE_IT(hxspi, (HAL_XSPI_IT_TO | HAL_XSPI_IT_SM | HAL_XSPI_IT_FT | HAL_XSPI_IT_TC | HAL_XSPI_IT_TE));
+
+    hxspi->State = HAL_XSPI_STATE_ABORT;
+
+    /* Check if the DMA is enabled */
+    if ((hxspi->Instance->CR & XSPI_CR_DMAEN) != 0U)
+    {
+      /* Disable the DMA transfer on the XSPI side */
+      CLEAR_BIT(hxspi->Instance->CR, XSPI_CR_DMAEN);
+
+      /* Disable the DMA transmit on the DMA side */
+      hxspi->hdmatx->XferAbortCallback = XSPI_DMAAbortCplt;
+      if (HAL_DMA_Abort_IT(hxspi->hdmatx) != HAL_OK)
+      {
+        hxspi->State = HAL_XSPI_STATE_READY;
+
+        /* Abort callback */
+#if defined (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U)
+        hxspi->AbortCpltCallback(hxspi);
+#else
+        HAL_XSPI_AbortCpltCallback(hxspi);
+#endif /* (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U) */
+      }
+
+      /* Disable the DMA receive on the DMA side */
+      hxspi->hdmarx->XferAbortCallback = XSPI_DMAAbortCplt;
+      if (HAL_DMA_Abort_IT(hxspi->hdmarx) != HAL_OK)
+      {
+        hxspi->State = HAL_XSPI_STATE_READY;
+
+        /* Abort callback */
+#if defined (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U)
+        hxspi->AbortCpltCallback(hxspi);
+#else
+        HAL_XSPI_AbortCpltCallback(hxspi);
+#endif /* (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U) */
+      }
+    }
+    else
+    {
+      if (HAL_XSPI_GET_FLAG(hxspi, HAL_XSPI_FLAG_BUSY) != RESET)
+      {
+        /* Clear transfer complete flag */
+        HAL_XSPI_CLEAR_FLAG(hxspi, HAL_XSPI_FLAG_TC);
+
+        /* Enable the transfer complete interrupts */
+        HAL_XSPI_ENABLE_IT(hxspi, HAL_XSPI_IT_TC);
+
+        /* Perform an abort of the XSPI */
+        SET_BIT(hxspi->Instance->CR, XSPI_CR_ABORT);
+
+        /* Return to indirect mode */
+        CLEAR_BIT(hxspi->Instance->CR, XSPI_CR_FMODE);
+      }
+      else
+      {
+        /* Return to indirect mode */
+        CLEAR_BIT(hxspi->Instance->CR, XSPI_CR_FMODE);
+
+        hxspi->State = HAL_XSPI_STATE_READY;
+
+        /* Abort callback */
+#if defined (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U)
+        hxspi->AbortCpltCallback(hxspi);
+#else
+        HAL_XSPI_AbortCpltCallback(hxspi);
+#endif /* (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U) */
+      }
+    }
+  }
+  else
+  {
+    status = HAL_ERROR;
+    hxspi->ErrorCode = HAL_XSPI_ERROR_INVALID_SEQUENCE;
+  }
+
+  return status;
+}
+
+/** @brief  Set XSPI Fifo threshold.
+  * @param  hxspi     : XSPI handle.
+  * @param  Threshold : Threshold of the Fifo.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_XSPI_SetFifoThreshold(XSPI_HandleTypeDef *hxspi, uint32_t Threshold)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  assert_param(IS_XSPI_FIFO_THRESHOLD_BYTE(Threshold));
+
+  /* Check the state */
+  if ((hxspi->State & XSPI_BUSY_STATE_MASK) == 0U)
+  {
+    /* Synchronize initialization structure with the new fifo threshold value */
+    hxspi->Init.FifoThresholdByte = Threshold;
+
+    /* Configure new fifo threshold */
+    MODIFY_REG(hxspi->Instance->CR, XSPI_CR_FTHRES, ((hxspi->Init.FifoThresholdByte - 1U) << XSPI_CR_FTHRES_Pos));
+
+  }
+  else
+  {
+    status = HAL_ERROR;
+    hxspi->ErrorCode = HAL_XSPI_ERROR_INVALID_SEQUENCE;
+  }
+
+  return status;
+}
+
+/** @brief  Get XSPI Fifo threshold.
+  * @param  hxspi : XSPI handle.
+  * @retval Fifo threshold
+  */
+uint32_t HAL_XSPI_GetFifoThreshold(const XSPI_HandleTypeDef *hxspi)
+{
+  return ((READ_BIT(hxspi->Instance->CR, XSPI_CR_FTHRES) >> XSPI_CR_FTHRES_Pos) + 1U);
+}
+
+/** @brief  Set XSPI Memory Type.
+  * @param  hxspi     : XSPI handle.
+  * @param  Type : Memory Type.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_XSPI_SetMemoryType(XSPI_HandleTypeDef *hxspi, uint32_t Type)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  assert_param(IS_XSPI_MEMORY_TYPE(Type));
+
+  /* Check the state */
+  if ((hxspi->State & XSPI_BUSY_STATE_MASK) == 0U)
+  {
+    /* Synchronize initialization structure with the new memory type value */
+    hxspi->Init.MemoryType = Type;
+
+    /* Configure new memory type */
+    MODIFY_REG(hxspi->Instance->DCR1, XSPI_DCR1_MTYP, hxspi->Init.MemoryType);
+  }
+  else
+  {
+    status = HAL_ERROR;
+    hxspi->ErrorCode = HAL_XSPI_ERROR_INVALID_SEQUENCE;
+  }
+
+  return status;
+}
+
+/** @brief  Set XSPI Device Size.
+  * @param  hxspi     : XSPI handle.
+  * @param  Size : Device Size.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_XSPI_SetDeviceSize(XSPI_HandleTypeDef *hxspi, uint32_t Size)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  assert_param(IS_XSPI_MEMORY_SIZE(Size));
+
+  /* Check the state */
+  if ((hxspi->State & XSPI_BUSY_STATE_MASK) == 0U)
+  {
+    /* Synchronize initialization structure with the new device size value */
+    hxspi->Init.MemorySize = Size;
+
+    /* Configure new device size */
+    MODIFY_REG(hxspi->Instance->DCR1, XSPI_DCR1_DEVSIZE,
+               (hxspi->Init.MemorySize << XSPI_DCR1_DEVSIZE_Pos));
+  }
+  else
+  {
+    status = HAL_ERROR;
+    hxspi->ErrorCode = HAL_XSPI_ERROR_INVALID_SEQUENCE;
+  }
+
+  return status;
+}
+
+/** @brief  Set XSPI Clock prescaler.
+  * @param  hxspi     : XSPI handle.
+  * @param  Prescaler : Clock prescaler.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_XSPI_SetClockPrescaler(XSPI_HandleTypeDef *hxspi, uint32_t Prescaler)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  assert_param(IS_XSPI_CLK_PRESCALER(Prescaler));
+
+  /* Check the state */
+  if ((hxspi->State & XSPI_BUSY_STATE_MASK) == 0U)
+  {
+    /* Synchronize initialization structure with the new clock prescaler value */
+    hxspi->Init.ClockPrescaler = Prescaler;
+
+    /* Configure clock prescaler */
+    MODIFY_REG(hxspi->Instance->DCR2, XSPI_DCR2_PRESCALER,
+               ((hxspi->Init.ClockPrescaler) << XSPI_DCR2_PRESCALER_Pos));
+  }
+  else
+  {
+    status = HAL_ERROR;
+    hxspi->ErrorCode = HAL_XSPI_ERROR_INVALID_SEQUENCE;
+  }
+
+  return status;
+}
+
+/** @brief Set XSPI timeout.
+  * @param  hxspi   : XSPI handle.
+  * @param  Timeout : Timeout for the memory access.
+  * @retval HAL state
+  */
+HAL_StatusTypeDef HAL_XSPI_SetTimeout(XSPI_HandleTypeDef *hxspi, uint32_t Timeout)
+{
+  hxspi->Timeout = Timeout;
+  return HAL_OK;
+}
+
+/**
+  * @brief  Return the XSPI error code.
+  * @param  hxspi : XSPI handle
+  * @retval XSPI Error Code
+  */
+uint32_t HAL_XSPI_GetError(const XSPI_HandleTypeDef *hxspi)
+{
+  return hxspi->ErrorCode;
+}
+
+/**
+  * @brief  Return the XSPI handle state.
+  * @param  hxspi : XSPI handle
+  * @retval HAL state
+  */
+uint32_t HAL_XSPI_GetState(const XSPI_HandleTypeDef *hxspi)
+{
+  /* Return XSPI handle state */
+  return hxspi->State;
+}
+
+/**
+  * @}
+  */
+
+#if defined(OCTOSPIM)
+/** @defgroup XSPI_Exported_Functions_Group4 IO Manager configuration function
+  *  @brief   XSPI IO Manager configuration function
+  *
+@verbatim
+ ===============================================================================
+                  ##### IO Manager configuration function #####
+ ===============================================================================
+    [..]
+    This subsection provides a set of functions allowing to :
+      (+) Configure the IO manager.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Configure the XSPI IO manager.
+  * @param  hxspi   : XSPI handle
+  * @param  pCfg     : Pointer to Configuration of the IO Manager for the instance
+  * @param  Timeout : Timeout duration
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_XSPIM_Config(XSPI_HandleTypeDef *hxspi, const XSPIM_CfgTypeDef *pCfg, uint32_t Timeout)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint8_t index;
+  uint8_t xspi_enabled = 0U;
+
+  XSPIM_CfgTypeDef IOM_cfg[OCTOSPI_NB_INSTANCE] = {0};
+
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(Timeout);
+
+  /* Check the parameters of the XSPI IO Manager configuration structure */
+  assert_param(IS_XSPIM_NCS_OVR(pCfg->nCSOverride));
+  assert_param(IS_XSPIM_IO_PORT(pCfg->IOPort));
+  assert_param(IS_XSPIM_REQ2ACKTIME(pCfg->Req2AckTime));
+
+  /**************** Get current configuration of the instances ****************/
+  for (index = 0U; index < OCTOSPI_NB_INSTANCE; index++)
+  {
+    XSPIM_GetConfig(index + 1U, &(IOM_cfg[index]));
+  }
+
+  /********** Disable both XSPI to configure XSPI IO Manager *****************/
+  if ((OCTOSPI1->CR & XSPI_CR_EN) != 0U)
+  {
+    CLEAR_BIT(OCTOSPI1->CR, XSPI_CR_EN);
+    xspi_enabled |= 0x1U;
+  }
+  if ((OCTOSPI2->CR & XSPI_CR_EN) != 0U)
+  {
+    CLEAR_BIT(OCTOSPI2->CR, XSPI_CR_EN);
+    xspi_enabled |= 0x2U;
+  }
+
+  /***************** Store Port assignment ***********************************/
+  if (hxspi->Instance == OCTOSPI1)
+  {
+    IOM_cfg[0].IOPort = pCfg->IOPort ;
+  }
+  else if (hxspi->Instance == OCTOSPI2)
+  {
+    IOM_cfg[1].IOPort = pCfg->IOPort ;
+  }
+  else
+  {
+    hxspi->ErrorCode |= HAL_XSPI_ERROR_INVALID_PARAM;
+    return HAL_ERROR;
+  }
+
+  /******************** Store CSSEL_OVR settings before configuration ********/
+  uint32_t reg = OCTOSPIM->CR;
+  uint32_t ovr_xspi1;
+  uint32_t ovr_xspi2;
+  if ((reg & OCTOSPIM_CR_CSSEL_OVR_EN) == OCTOSPIM_CR_CSSEL_OVR_EN)
+  {
+    if ((reg & OCTOSPIM_CR_CSSEL_OVR_O1) == OCTOSPIM_CR_CSSEL_OVR_O1)
+    {
+      ovr_xspi1 = HAL_XSPI_CSSEL_OVR_NCS2;
+    }
+    else
+    {
+      ovr_xspi1 = HAL_XSPI_CSSEL_OVR_NCS1;
+    }
+    if ((reg & OCTOSPIM_CR_CSSEL_OVR_O2) == OCTOSPIM_CR_CSSEL_OVR_O2)
+    {
+      ovr_xspi2 = HAL_XSPI_CSSEL_OVR_NCS2;
+    }
+    else
+    {
+      ovr_xspi2 = HAL_XSPI_CSSEL_OVR_NCS1;
+    }
+  }
+  else
+  {
+    ovr_xspi1 = HAL_XSPI_CSSEL_OVR_DISABLED;
+    ovr_xspi2 = HAL_XSPI_CSSEL_OVR_DISABLED;
+  }
+
+  /***************** Reset of previous configuration *************************/
+  CLEAR_REG(OCTOSPIM->CR);
+
+  /******************** Activation of new configuration **********************/
+  MODIFY_REG(OCTOSPIM->CR, OCTOSPIM_CR_REQ2ACK_TIME, ((pCfg->Req2AckTime - 1U) << OCTOSPIM_CR_REQ2ACK_TIME_Pos));
+
+  /******************** CSSEL_OVR management *********************************/
+  if (hxspi->Instance == OCTOSPI1)
+  {
+    ovr_xspi1 = pCfg->nCSOverride;
+  }
+  else if (hxspi->Instance == OCTOSPI2)
+  {
+    ovr_xspi2 = pCfg->nCSOverride;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  uint32_t ovr_en = 0U;
+  if ((ovr_xspi1 != HAL_XSPI_CSSEL_OVR_DISABLED) || (ovr_xspi2 != HAL_XSPI_CSSEL_OVR_DISABLED))
+  {
+    ovr_en = OCTOSPIM_CR_CSSEL_OVR_EN;
+  }
+  else
+  {
+    ovr_xspi1 = HAL_XSPI_CSSEL_OVR_NCS1;
+    ovr_xspi2 = HAL_XSPI_CSSEL_OVR_NCS1;
+  }
+
+  reg &= ~(OCTOSPIM_CR_CSSEL_OVR_EN | OCTOSPIM_CR_CSSEL_OVR_O1 | OCTOSPIM_CR_CSSEL_OVR_O2);
+  if (ovr_en == OCTOSPIM_CR_CSSEL_OVR_EN)
+  {
+    reg |= OCTOSPIM_CR_CSSEL_OVR_EN;
+  }
+  if (ovr_xspi1 == HAL_XSPI_CSSEL_OVR_NCS2)
+  {
+    reg |= OCTOSPIM_CR_CSSEL_OVR_O1;
+  }
+  if (ovr_xspi2 == HAL_XSPI_CSSEL_OVR_NCS2)
+  {
+    reg |= OCTOSPIM_CR_CSSEL_OVR_O2;
+  }
+
+  MODIFY_REG(OCTOSPIM->CR, (OCTOSPIM_CR_CSSEL_OVR_EN | OCTOSPIM_CR_CSSEL_OVR_O1 | OCTOSPIM_CR_CSSEL_OVR_O2),
+             (reg & (OCTOSPIM_CR_CSSEL_OVR_EN | OCTOSPIM_CR_CSSEL_OVR_O1 | OCTOSPIM_CR_CSSEL_OVR_O2)));
+
+  /******************** Management of MUXEN and MODE *************************/
+  for (index = 0U; index < (OCTOSPI_NB_INSTANCE - 1U); index++)
+  {
+    if (IOM_cfg[index].IOPort == IOM_cfg[index + 1U].IOPort)
+    {
+      /*Mux*/
+      SET_BIT(OCTOSPIM->CR, OCTOSPIM_CR_MUXEN);
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    if (IOM_cfg[0].IOPort == HAL_XSPIM_IOPORT_2)
+    {
+      /*Mode*/
+      SET_BIT(OCTOSPIM->CR, OCTOSPIM_CR_MODE);
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+  }
+
+  /******* Re-enable both XSPI after configure XSPI IO Manager ***************/
+  if ((xspi_enabled & 0x1U) != 0U)
+  {
+    SET_BIT(OCTOSPI1->CR, XSPI_CR_EN);
+  }
+  if ((xspi_enabled & 0x2U) != 0U)
+  {
+    SET_BIT(OCTOSPI2->CR, XSPI_CR_EN);
   }
 
   return status;
 }
-#endif /* (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U) */
 
 /**
   * @}
   */
 
-/** @defgroup XSPI_Exported_Functions_Group3 Peripheral Control and State functions
-  *  @brief   XSPI control and State functions
+#endif /* OCTOSPIM */
+/** @defgroup XSPI_Exported_Functions_Group5 Delay Block function
+  *  @brief   Delay block function
   *
 @verbatim
  ===============================================================================
-                  ##### Peripheral Control and State functions #####
+                  ##### Delay Block function #####
  ===============================================================================
     [..]
     This subsection provides a set of functions allowing to :
-      (+) Check in run-time the state of the driver.
-      (+) Check the error code set during last operation.
-      (+) Abort any operation.
-      (+) Manage the Fifo threshold.
-      (+) Configure the timeout duration used in the driver.
+      (+) Configure the delay block.
+      (+) Calibrate the delay block phase on a known memory pattern.
 
 @endverbatim
   * @{
   */
 
 /**
-  * @brief  Abort the current operation, return to the indirect mode.
-  * @param  hxspi : XSPI handle
-  * @retval HAL status
+  * @brief  Set the Delay Block configuration.
+  * @param  hxspi   : XSPI handle.
+  * @param  pdlyb_cfg: Pointer to DLYB configuration structure.
+  * @retval HAL status.
   */
-HAL_StatusTypeDef HAL_XSPI_Abort(XSPI_HandleTypeDef *hxspi)
+HAL_StatusTypeDef HAL_XSPI_DLYB_SetConfig(XSPI_HandleTypeDef *hxspi, const HAL_XSPI_DLYB_CfgTypeDef  *pdlyb_cfg)
 {
-  HAL_StatusTypeDef status = HAL_OK;
-  uint32_t tickstart = HAL_GetTick();
-
-  /* Check if the state is not in reset state */
-  if (hxspi->State != HAL_XSPI_STATE_RESET)
-  {
-    /* Check if the DMA is enabled */
-    if ((hxspi->Instance->CR & XSPI_CR_DMAEN) != 0U)
-    {
-      /* Disable the DMA transfer on the XSPI side */
-      CLEAR_BIT(hxspi->Instance->CR, XSPI_CR_DMAEN);
-
-      /* Disable the DMA transmit on the DMA side */
-      status = HAL_DMA_Abort(hxspi->hdmatx);
-      if (status != HAL_OK)
-      {
-        hxspi->ErrorCode = HAL_XSPI_ERROR_DMA;
-      }
-
-      /* Disable the DMA receive on the DMA side */
-      status = HAL_DMA_Abort(hxspi->hdmarx);
-      if (status != HAL_OK)
-      {
-        hxspi->ErrorCode = HAL_XSPI_ERROR_DMA;
-      }
-    }
-
-    if (HAL_XSPI_GET_FLAG(hxspi, HAL_XSPI_FLAG_BUSY) != RESET)
-    {
-      /* Perform an abort of the XSPI */
-      SET_BIT(hxspi->Instance->CR, XSPI_CR_ABORT);
-
-      /* Wait until the transfer complete flag is set to go back in idle state */
-      status = XSPI_WaitFlagStateUntilTimeout(hxspi, HAL_XSPI_FLAG_TC, SET, tickstart, hxspi->Timeout);
+  HAL_StatusTypeDef status = HAL_ERROR;
 
-      if (status == HAL_OK)
-      {
-        /* Clear transfer complete flag */
-        HAL_XSPI_CLEAR_FLAG(hxspi, HAL_XSPI_FLAG_TC);
+  /* Enable XSPI Free Running Clock (mandatory) */
+  SET_BIT(hxspi->Instance->DCR1, XSPI_DCR1_FRCK);
 
-        /* Wait until the busy flag is reset to go back in idle state */
-        status = XSPI_WaitFlagStateUntilTimeout(hxspi, HAL_XSPI_FLAG_BUSY, RESET, tickstart, hxspi->Timeout);
+  /* Update XSPI state */
+  hxspi->State = HAL_XSPI_STATE_BUSY_CMD;
 
-        if (status == HAL_OK)
-        {
-          /* Return to indirect mode */
-          CLEAR_BIT(hxspi->Instance->CR, XSPI_CR_FMODE);
+  if (hxspi->Instance == OCTOSPI1)
+  {
+    /* Enable the DelayBlock */
+    LL_DLYB_Enable(DLYB_OCTOSPI1);
 
-          hxspi->State = HAL_XSPI_STATE_READY;
-        }
-      }
-    }
-    else
-    {
-      /* Return to indirect mode */
-      CLEAR_BIT(hxspi->Instance->CR, XSPI_CR_FMODE);
+    /* Set the Delay Block configuration */
+    LL_DLYB_SetDelay(DLYB_OCTOSPI1, pdlyb_cfg);
+    status = HAL_OK;
+  }
+#if defined(OCTOSPI2)
+  else if (hxspi->Instance == OCTOSPI2)
+  {
+    /* Enable the DelayBlock */
+    LL_DLYB_Enable(DLYB_OCTOSPI2);
 
-      hxspi->State = HAL_XSPI_STATE_READY;
-    }
+    /* Set the Delay Block configuration */
+    LL_DLYB_SetDelay(DLYB_OCTOSPI2, pdlyb_cfg);
+    status = HAL_OK;
   }
+#endif /* OCTOSPI2 */
   else
   {
-    status = HAL_ERROR;
-    hxspi->ErrorCode = HAL_XSPI_ERROR_INVALID_SEQUENCE;
+    hxspi->ErrorCode |= HAL_XSPI_ERROR_INVALID_PARAM;
   }
 
+  /* Abort the current XSPI operation if exist */
+  (void)HAL_XSPI_Abort(hxspi);
+
+  /* Disable Free Running Clock */
+  CLEAR_BIT(hxspi->Instance->DCR1, XSPI_DCR1_FRCK);
+
   return status;
 }
 
 /**
-  * @brief  Abort the current operation, return to the indirect mode. (non-blocking function)
-  * @param  hxspi : XSPI handle
-  * @retval HAL status
+  * @brief  Get the Delay Block configuration.
+  * @param  hxspi   : XSPI handle.
+  * @param  pdlyb_cfg: Pointer to DLYB configuration structure.
+  * @retval HAL status.
   */
-HAL_StatusTypeDef HAL_XSPI_Abort_IT(XSPI_HandleTypeDef *hxspi)
+HAL_StatusTypeDef HAL_XSPI_DLYB_GetConfig(XSPI_HandleTypeDef *hxspi, HAL_XSPI_DLYB_CfgTypeDef *pdlyb_cfg)
 {
-  HAL_StatusTypeDef status = HAL_OK;
+  HAL_StatusTypeDef status = HAL_ERROR;
 
-  /* Check if the state is not in reset state */
-  if (hxspi->State != HAL_XSPI_STATE_RESET)
+  if (hxspi->Instance == OCTOSPI1)
   {
-    /* Disable all interrupts */
-    HAL_XSPI_DISABLE_IT(hxspi, (HAL_XSPI_IT_TO | HAL_XSPI_IT_SM | HAL_XSPI_IT_FT | HAL_XSPI_IT_TC | HAL_XSPI_IT_TE));
-
-    hxspi->State = HAL_XSPI_STATE_ABORT;
-
-    /* Check if the DMA is enabled */
-    if ((hxspi->Instance->CR & XSPI_CR_DMAEN) != 0U)
-    {
-      /* Disable the DMA transfer on the XSPI side */
-      CLEAR_BIT(hxspi->Instance->CR, XSPI_CR_DMAEN);
-
-      /* Disable the DMA transmit on the DMA side */
-      hxspi->hdmatx->XferAbortCallback = XSPI_DMAAbortCplt;
-      if (HAL_DMA_Abort_IT(hxspi->hdmatx) != HAL_OK)
-      {
-        hxspi->State = HAL_XSPI_STATE_READY;
-
-        /* Abort callback */
-#if defined (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U)
-        hxspi->AbortCpltCallback(hxspi);
-#else
-        HAL_XSPI_AbortCpltCallback(hxspi);
-#endif /* (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U) */
-      }
-
-      /* Disable the DMA receive on the DMA side */
-      hxspi->hdmarx->XferAbortCallback = XSPI_DMAAbortCplt;
-      if (HAL_DMA_Abort_IT(hxspi->hdmarx) != HAL_OK)
-      {
-        hxspi->State = HAL_XSPI_STATE_READY;
-
-        /* Abort callback */
-#if defined (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U)
-        hxspi->AbortCpltCallback(hxspi);
-#else
-        HAL_XSPI_AbortCpltCallback(hxspi);
-#endif /* (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U) */
-      }
-    }
-    else
-    {
-      if (HAL_XSPI_GET_FLAG(hxspi, HAL_XSPI_FLAG_BUSY) != RESET)
-      {
-        /* Clear transfer complete flag */
-        HAL_XSPI_CLEAR_FLAG(hxspi, HAL_XSPI_FLAG_TC);
-
-        /* Enable the transfer complete interrupts */
-        HAL_XSPI_ENABLE_IT(hxspi, HAL_XSPI_IT_TC);
-
-        /* Perform an abort of the XSPI */
-        SET_BIT(hxspi->Instance->CR, XSPI_CR_ABORT);
-
-        /* Return to indirect mode */
-        CLEAR_BIT(hxspi->Instance->CR, XSPI_CR_FMODE);
-      }
-      else
-      {
-        /* Return to indirect mode */
-        CLEAR_BIT(hxspi->Instance->CR, XSPI_CR_FMODE);
-
-        hxspi->State = HAL_XSPI_STATE_READY;
-
-        /* Abort callback */
-#if defined (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U)
-        hxspi->AbortCpltCallback(hxspi);
-#else
-        HAL_XSPI_AbortCpltCallback(hxspi);
-#endif /* (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U) */
-      }
-    }
+    LL_DLYB_GetDelay(DLYB_OCTOSPI1, pdlyb_cfg);
+    status = HAL_OK;
+  }
+#if defined(OCTOSPI2)
+  else if (hxspi->Instance == OCTOSPI2)
+  {
+    LL_DLYB_GetDelay(DLYB_OCTOSPI2, pdlyb_cfg);
+    status = HAL_OK;
   }
+#endif /* OCTOSPI2 */
   else
   {
-    status = HAL_ERROR;
-    hxspi->ErrorCode = HAL_XSPI_ERROR_INVALID_SEQUENCE;
+    hxspi->ErrorCode |= HAL_XSPI_ERROR_INVALID_PARAM;
   }
 
   return status;
 }
 
-/** @brief  Set XSPI Fifo threshold.
-  * @param  hxspi     : XSPI handle.
-  * @param  Threshold : Threshold of the Fifo.
-  * @retval HAL status
+/**
+  * @brief  Get the Delay line length value.
+  * @param  hxspi   : XSPI handle.
+  * @param  pdlyb_cfg: Pointer to DLYB configuration structure.
+  * @retval HAL status.
   */
-HAL_StatusTypeDef HAL_XSPI_SetFifoThreshold(XSPI_HandleTypeDef *hxspi, uint32_t Threshold)
+HAL_StatusTypeDef HAL_XSPI_DLYB_GetClockPeriod(XSPI_HandleTypeDef *hxspi, HAL_XSPI_DLYB_CfgTypeDef *pdlyb_cfg)
 {
-  HAL_StatusTypeDef status = HAL_OK;
+  HAL_StatusTypeDef status = HAL_ERROR;
 
-  assert_param(IS_XSPI_FIFO_THRESHOLD_BYTE(Threshold));
+  /* Enable XSPI Free Running Clock (mandatory) */
+  SET_BIT(hxspi->Instance->DCR1, XSPI_DCR1_FRCK);
 
-  /* Check the state */
-  if ((hxspi->State & XSPI_BUSY_STATE_MASK) == 0U)
+  /* Update XSPI state */
+  hxspi->State = HAL_XSPI_STATE_BUSY_CMD;
+
+  if (hxspi->Instance == OCTOSPI1)
   {
-    /* Synchronize initialization structure with the new fifo threshold value */
-    hxspi->Init.FifoThresholdByte = Threshold;
+    /* Enable the DelayBlock */
+    LL_DLYB_Enable(DLYB_OCTOSPI1);
 
-    /* Configure new fifo threshold */
-    MODIFY_REG(hxspi->Instance->CR, XSPI_CR_FTHRES, ((hxspi->Init.FifoThresholdByte - 1U) << XSPI_CR_FTHRES_Pos));
+    /* try to detect Period */
+    if (LL_DLYB_GetClockPeriod(DLYB_OCTOSPI1, pdlyb_cfg) == (uint32_t)SUCCESS)
+    {
+      status = HAL_OK;
+    }
 
+    /* Disable the DelayBlock */
+    LL_DLYB_Disable(DLYB_OCTOSPI1);
+  }
+#if defined(OCTOSPI2)
+  else if (hxspi->Instance == OCTOSPI2)
+  {
+    /* Enable the DelayBlock */
+    LL_DLYB_Enable(DLYB_OCTOSPI2);
+
+    /* try to detect Period */
+    if (LL_DLYB_GetClockPeriod(DLYB_OCTOSPI2, pdlyb_cfg) == (uint32_t)SUCCESS)
+    {
+      status = HAL_OK;
+    }
+
+    /* Disable the DelayBlock */
+    LL_DLYB_Disable(DLYB_OCTOSPI2);
   }
+#endif /* OCTOSPI2 */
   else
   {
-    status = HAL_ERROR;
-    hxspi->ErrorCode = HAL_XSPI_ERROR_INVALID_SEQUENCE;
+    hxspi->ErrorCode |= HAL_XSPI_ERROR_INVALID_PARAM;
   }
 
-  return status;
-}
+  /* Abort the current XSPI operation if exist */
+  (void)HAL_XSPI_Abort(hxspi);
 
-/** @brief  Get XSPI Fifo threshold.
-  * @param  hxspi : XSPI handle.
-  * @retval Fifo threshold
-  */
-uint32_t HAL_XSPI_GetFifoThreshold(const XSPI_HandleTypeDef *hxspi)
-{
-  return ((READ_BIT(hxspi->Instance->CR, XSPI_CR_FTHRES) >> XSPI_CR_FTHRES_Pos) + 1U);
+  /* Disable Free Running Clock */
+  CLEAR_BIT(hxspi->Instance->DCR1, XSPI_DCR1_FRCK);
+
+  return status;
 }
 
-/** @brief  Set XSPI Memory Type.
+/**
+  * @brief  Calibrate the Delay Block output clock phase on a known pattern.
   * @param  hxspi     : XSPI handle.
-  * @param  Type : Memory Type.
-  * @retval HAL status
+  * @param  pCalib    : Pointer to the calibration structure (read command and pattern).
+  * @param  pdlyb_cfg : Pointer to DLYB configuration structure receiving the calibrated configuration.
+  * @note   The read command is sent on each output clock phase over one period, the calibrated phase
+  *         is the middle of the wider window of consecutive phases reading the pattern without error.
+  *         The initial configuration is restored when no phase passes.
+  * @retval HAL status.
   */
-HAL_StatusTypeDef HAL_XSPI_SetMemoryType(XSPI_HandleTypeDef *hxspi, uint32_t Type)
+HAL_StatusTypeDef HAL_XSPI_DLYB_Calibrate(XSPI_HandleTypeDef *hxspi, XSPI_DLYB_CalibrationTypeDef *pCalib,
+                                          HAL_XSPI_DLYB_CfgTypeDef *pdlyb_cfg)
 {
-  HAL_StatusTypeDef status = HAL_OK;
-
-  assert_param(IS_XSPI_MEMORY_TYPE(Type));
+  HAL_StatusTypeDef status;
+  HAL_XSPI_DLYB_CfgTypeDef initial_cfg;
+  HAL_XSPI_DLYB_CfgTypeDef dlyb_cfg;
+  uint32_t phase_count;
+  uint32_t phase;
+  uint32_t trials;
+  uint32_t trial;
+  uint32_t index;
+  uint32_t mask = 0U;
+  uint32_t start = 0U;
+  uint32_t length = 0U;
+  uint32_t best_start = 0U;
+  uint32_t best_length = 0U;
+
+  if ((pCalib == NULL) || (pCalib->pReadCmd == NULL) || (pCalib->pPattern == NULL) ||
+      (pCalib->pBuffer == NULL) || (pdlyb_cfg == NULL) || (pCalib->pReadCmd->DataMode == HAL_XSPI_DATA_NONE))
+  {
+    hxspi->ErrorCode |= HAL_XSPI_ERROR_INVALID_PARAM;
+    return HAL_ERROR;
+  }
 
   /* Check the state */
-  if ((hxspi->State & XSPI_BUSY_STATE_MASK) == 0U)
+  if (hxspi->State != HAL_XSPI_STATE_READY)
   {
-    /* Synchronize initialization structure with the new memory type value */
-    hxspi->Init.MemoryType = Type;
+    hxspi->ErrorCode = HAL_XSPI_ERROR_INVALID_SEQUENCE;
+    return HAL_ERROR;
+  }
 
-    /* Configure new memory type */
-    MODIFY_REG(hxspi->Instance->DCR1, XSPI_DCR1_MTYP, hxspi->Init.MemoryType);
+  /* Save the current configuration and measure the number of phases over one clock period */
+  status = HAL_XSPI_DLYB_GetConfig(hxspi, &initial_cfg);
+  if (status == HAL_OK)
+  {
+    status = HAL_XSPI_DLYB_GetClockPeriod(hxspi, &dlyb_cfg);
   }
-  else
+  if (status != HAL_OK)
   {
-    status = HAL_ERROR;
-    hxspi->ErrorCode = HAL_XSPI_ERROR_INVALID_SEQUENCE;
+    return status;
   }
+  phase_count = dlyb_cfg.PhaseSel + 1U;
+  trials = (pCalib->Trials == 0U) ? 1U : pCalib->Trials;
 
-  return status;
-}
+  /* Sweep the output clock phases */
+  for (phase = 0U; phase < phase_count; phase++)
+  {
+    dlyb_cfg.PhaseSel = phase;
+    (void)HAL_XSPI_DLYB_SetConfig(hxspi, &dlyb_cfg);
 
-/** @brief  Set XSPI Device Size.
-  * @param  hxspi     : XSPI handle.
-  * @param  Size : Device Size.
-  * @retval HAL status
-  */
-HAL_StatusTypeDef HAL_XSPI_SetDeviceSize(XSPI_HandleTypeDef *hxspi, uint32_t Size)
-{
-  HAL_StatusTypeDef status = HAL_OK;
+    trial = 0U;
+    status = HAL_OK;
+    while ((trial < trials) && (status == HAL_OK))
+    {
+      status = HAL_XSPI_Command(hxspi, pCalib->pReadCmd, hxspi->Timeout);
+      if (status == HAL_OK)
+      {
+        status = HAL_XSPI_Receive(hxspi, pCalib->pBuffer, hxspi->Timeout);
+      }
 
-  assert_param(IS_XSPI_MEMORY_SIZE(Size));
+      if (status == HAL_OK)
+      {
+        /* Compare the pattern received */
+        for (index = 0U; index < pCalib->pReadCmd->DataLength; index++)
+        {
+          if (pCalib->pBuffer[index] != pCalib->pPattern[index])
+          {
+            status = HAL_ERROR;
+            break;
+          }
+        }
+        trial++;
+      }
+      else
+      {
+        /* Return to the idle state before the next phase */
+        (void)HAL_XSPI_Abort(hxspi);
+      }
+    }
 
-  /* Check the state */
-  if ((hxspi->State & XSPI_BUSY_STATE_MASK) == 0U)
-  {
-    /* Synchronize initialization structure with the new device size value */
-    hxspi->Init.MemorySize = Size;
+    if (status == HAL_OK)
+    {
+      mask |= (1UL << phase);
+    }
+  }
 
-    /* Configure new device size */
-    MODIFY_REG(hxspi->Instance->DCR1, XSPI_DCR1_DEVSIZE,
-               (hxspi->Init.MemorySize << XSPI_DCR1_DEVSIZE_Pos));
+  /* Look for the wider window of passing phases */
+  for (phase = 0U; phase < phase_count; phase++)
+  {
+    if ((mask & (1UL << phase)) != 0U)
+    {
+      if (length == 0U)
+      {
+        start = phase;
+      }
+      length++;
+      if (length > best_length)
+      {
+        best_start  = start;
+        best_length = length;
+      }
+    }
+    else
+    {
+      length = 0U;
+    }
   }
-  else
+
+  pCalib->PhaseMask = mask;
+  hxspi->ErrorCode = HAL_XSPI_ERROR_NONE;
+
+  if (best_length == 0U)
   {
-    status = HAL_ERROR;
-    hxspi->ErrorCode = HAL_XSPI_ERROR_INVALID_SEQUENCE;
+    /* No valid phase, restore the initial configuration */
+    (void)HAL_XSPI_DLYB_SetConfig(hxspi, &initial_cfg);
+    hxspi->ErrorCode = HAL_XSPI_ERROR_TRANSFER;
+    return HAL_ERROR;
   }
 
+  /* Program the middle of the window */
+  dlyb_cfg.PhaseSel = best_start + (best_length / 2U);
+  status = HAL_XSPI_DLYB_SetConfig(hxspi, &dlyb_cfg);
+
+  pdlyb_cfg->Units    = dlyb_cfg.Units;
+  pdlyb_cfg->PhaseSel = dlyb_cfg.PhaseSel;
+
   return status;
 }
-
-/** @brief  Set XSPI Clock prescaler.
-  * @param  hxspi     : XSPI handle.
-  * @param  Prescaler : Clock prescaler.
-  * @retval HAL status
+/**
+  * @}
   */
-HAL_StatusTypeDef HAL_XSPI_SetClockPrescaler(XSPI_HandleTypeDef *hxspi, uint32_t Prescaler)
+/**
+  @cond 0
+  */
+/**
+  * @brief  DMA XSPI process complete callback.
+  * @param  hdma : DMA handle
+  * @retval None
+  */
+static void XSPI_DMACplt(DMA_HandleTypeDef *hdma)
 {
-  HAL_StatusTypeDef status = HAL_OK;
-  assert_param(IS_XSPI_CLK_PRESCALER(Prescaler));
+  XSPI_HandleTypeDef *hxspi = (XSPI_HandleTypeDef *)(hdma->Parent);
+  hxspi->XferCount = 0;
 
-  /* Check the state */
-  if ((hxspi->State & XSPI_BUSY_STATE_MASK) == 0U)
-  {
-    /* Synchronize initialization structure with the new clock prescaler value */
-    hxspi->Init.ClockPrescaler = Prescaler;
+  /* Disable the DMA transfer on the XSPI side */
+  CLEAR_BIT(hxspi->Instance->CR, XSPI_CR_DMAEN);
 
-    /* Configure clock prescaler */
-    MODIFY_REG(hxspi->Instance->DCR2, XSPI_DCR2_PRESCALER,
-               ((hxspi->Init.ClockPrescaler) << XSPI_DCR2_PRESCALER_Pos));
-  }
-  else
+#if defined(USE_HAL_DCACHE_DMA_COHERENCY) && (USE_HAL_DCACHE_DMA_COHERENCY == 1U)
+  if (hxspi->State == HAL_XSPI_STATE_BUSY_RX)
   {
-    status = HAL_ERROR;
-    hxspi->ErrorCode = HAL_XSPI_ERROR_INVALID_SEQUENCE;
+    /* Drop the cache lines loaded while the DMA wrote the buffer */
+    (void)HAL_DCACHE_DMA_CompleteRx(hxspi->pBuffPtr, hxspi->XferSize);
   }
+#endif /* USE_HAL_DCACHE_DMA_COHERENCY */
 
-  return status;
-}
-
-/** @brief Set XSPI timeout.
-  * @param  hxspi   : XSPI handle.
-  * @param  Timeout : Timeout for the memory access.
-  * @retval HAL state
-  */
-HAL_StatusTypeDef HAL_XSPI_SetTimeout(XSPI_HandleTypeDef *hxspi, uint32_t Timeout)
-{
-  hxspi->Timeout = Timeout;
-  return HAL_OK;
+  /* Enable the XSPI transfer complete Interrupt */
+  HAL_XSPI_ENABLE_IT(hxspi, HAL_XSPI_IT_TC);
 }
 
 /**
-  * @brief  Return the XSPI error code.
-  * @param  hxspi : XSPI handle
-  * @retval XSPI Error Code
+  * @brief  DMA XSPI process half complete callback.
+  * @param  hdma : DMA handle
+  * @retval None
   */
-uint32_t HAL_XSPI_GetError(const XSPI_HandleTypeDef *hxspi)
+static void XSPI_DMAHalfCplt(DMA_HandleTypeDef *hdma)
 {
-  return hxspi->ErrorCode;
+  XSPI_HandleTypeDef *hxspi = (XSPI_HandleTypeDef *)(hdma->Parent);
+  hxspi->XferCount = (hxspi->XferCount >> 1);
+
+  if (hxspi->State == HAL_XSPI_STATE_BUSY_RX)
+  {
+#if defined (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U)
+    hxspi->RxHalfCpltCallback(hxspi);
+#else
+    HAL_XSPI_RxHalfCpltCallback(hxspi);
+#endif /* (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U) */
+  }
+  else
+  {
+#if defined (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U)
+    hxspi->TxHalfCpltCallback(hxspi);
+#else
+    HAL_XSPI_TxHalfCpltCallback(hxspi);
+#endif /* (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U) */
+  }
 }
 
 /**
-  * @brief  Return the XSPI handle state.
-  * @param  hxspi : XSPI handle
-  * @retval HAL state
+  * @brief  DMA XSPI communication error callback.
+  * @param  hdma : DMA handle
+  * @retval None
   */
-uint32_t HAL_XSPI_GetState(const XSPI_HandleTypeDef *hxspi)
+static void XSPI_DMAError(DMA_HandleTypeDef *hdma)
 {
-  /* Return XSPI handle state */
-  return hxspi->State;
-}
+  XSPI_HandleTypeDef *hxspi = (XSPI_HandleTypeDef *)(hdma->Parent);
+  hxspi->XferCount = 0;
+  hxspi->ErrorCode = HAL_XSPI_ERROR_DMA;
 
-/**
-  * @}
-  */
+  /* Disable the DMA transfer on the XSPI side */
+  CLEAR_BIT(hxspi->Instance->CR, XSPI_CR_DMAEN);
 
-#if defined(OCTOSPIM)
-/** @defgroup XSPI_Exported_Functions_Group4 IO Manager configuration function
-  *  @brief   XSPI IO Manager configuration function
-  *
-@verbatim
- ===============================================================================
-                  ##### IO Manager configuration function #####
- ===============================================================================
-    [..]
-    This subsection provides a set of functions allowing to :
-      (+) Configure the IO manager.
+  /* Abort the XSPI */
+  if (HAL_XSPI_Abort_IT(hxspi) != HAL_OK)
+  {
+    /* Disable the interrupts */
+    HAL_XSPI_DISABLE_IT(hxspi, HAL_XSPI_IT_TC | HAL_XSPI_IT_FT | HAL_XSPI_IT_TE);
 
-@endverbatim
-  * @{
-  */
+    hxspi->State = HAL_XSPI_STATE_READY;
+
+    /* Error callback */
+#if defined (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U)
+    hxspi->ErrorCallback(hxspi);
+#else
+    HAL_XSPI_ErrorCallback(hxspi);
+#endif /* (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U) */
+  }
+}
 
 /**
-  * @brief  Configure the XSPI IO manager.
-  * @param  hxspi   : XSPI handle
-  * @param  pCfg     : Pointer to Configuration of the IO Manager for the instance
-  * @param  Timeout : Timeout duration
-  * @retval HAL status
+  * @brief  DMA XSPI abort complete callback.
+  * @param  hdma : DMA handle
+  * @retval None
   */
-HAL_StatusTypeDef HAL_XSPIM_Config(XSPI_HandleTypeDef *hxspi, const XSPIM_CfgTypeDef *pCfg, uint32_t Timeout)
+static void XSPI_DMAAbortCplt(DMA_HandleTypeDef *hdma)
 {
-  HAL_StatusTypeDef status = HAL_OK;
-  uint8_t index;
-  uint8_t xspi_enabled = 0U;
-
-  XSPIM_CfgTypeDef IOM_cfg[OCTOSPI_NB_INSTANCE] = {0};
-
-  /* Prevent unused argument(s) compilation warning */
-  UNUSED(Timeout);
-
-  /* Check the parameters of the XSPI IO Manager configuration structure */
-  assert_param(IS_XSPIM_NCS_OVR(pCfg->nCSOverride));
-  assert_param(IS_XSPIM_IO_PORT(pCfg->IOPort));
-  assert_param(IS_XSPIM_REQ2ACKTIME(pCfg->Req2AckTime));
+  XSPI_HandleTypeDef *hxspi = (XSPI_HandleTypeDef *)(hdma->Parent);
+  hxspi->XferCount = 0;
 
-  /**************** Get current configuration of the instances ****************/
-  for (index = 0U; index < OCTOSPI_NB_INSTANCE; index++)
+  /* Check the state */
+  if (hxspi->State == HAL_XSPI_STATE_ABORT)
   {
-    XSPIM_GetConfig(index + 1U, &(IOM_cfg[index]));
-  }
+    /* DMA abort called by XSPI abort */
+    if (HAL_XSPI_GET_FLAG(hxspi, HAL_XSPI_FLAG_BUSY) != RESET)
+    {
+      /* Clear transfer complete flag */
+      HAL_XSPI_CLEAR_FLAG(hxspi, HAL_XSPI_FLAG_TC);
 
-  /********** Disable both XSPI to configure XSPI IO Manager *****************/
-  if ((OCTOSPI1->CR & XSPI_CR_EN) != 0U)
-  {
-    CLEAR_BIT(OCTOSPI1->CR, XSPI_CR_EN);
-    xspi_enabled |= 0x1U;
-  }
-  if ((OCTOSPI2->CR & XSPI_CR_EN) != 0U)
-  {
-    CLEAR_BIT(OCTOSPI2->CR, XSPI_CR_EN);
-    xspi_enabled |= 0x2U;
-  }
+      /* Enable the transfer complete interrupts */
+      HAL_XSPI_ENABLE_IT(hxspi, HAL_XSPI_IT_TC);
 
-  /***************** Store Port assignment ***********************************/
-  if (hxspi->Instance == OCTOSPI1)
-  {
-    IOM_cfg[0].IOPort = pCfg->IOPort ;
-  }
-  else if (hxspi->Instance == OCTOSPI2)
-  {
-    IOM_cfg[1].IOPort = pCfg->IOPort ;
+      /* Perform an abort of the XSPI */
+      SET_BIT(hxspi->Instance->CR, XSPI_CR_ABORT);
+    }
+    else
+    {
+      hxspi->State = HAL_XSPI_STATE_READY;
+
+      if (hxspi->pTransactionQueue != NULL)
+      {
+        /* Queued transaction aborted */
+        XSPI_TransactionQueue_Complete(hxspi, hxspi->ErrorCode);
+      }
+      else
+      {
+        /* Abort callback */
+#if defined (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U)
+        hxspi->AbortCpltCallback(hxspi);
+#else
+        HAL_XSPI_AbortCpltCallback(hxspi);
+#endif /* (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U) */
+      }
+    }
   }
   else
   {
-    hxspi->ErrorCode |= HAL_XSPI_ERROR_INVALID_PARAM;
-    return HAL_ERROR;
-  }
+    /* DMA abort called due to a transfer error interrupt */
+    hxspi->State = HAL_XSPI_STATE_READY;
 
-  /******************** Store CSSEL_OVR settings before configuration ********/
-  uint32_t reg = OCTOSPIM->CR;
-  uint32_t ovr_xspi1;
-  uint32_t ovr_xspi2;
-  if ((reg & OCTOSPIM_CR_CSSEL_OVR_EN) == OCTOSPIM_CR_CSSEL_OVR_EN)
-  {
-    if ((reg & OCTOSPIM_CR_CSSEL_OVR_O1) == OCTOSPIM_CR_CSSEL_OVR_O1)
+    if (hxspi->pTransactionQueue != NULL)
     {
-      ovr_xspi1 = HAL_XSPI_CSSEL_OVR_NCS2;
+      /* Queued transaction failed */
+      XSPI_TransactionQueue_Complete(hxspi, hxspi->ErrorCode);
     }
     else
     {
-      ovr_xspi1 = HAL_XSPI_CSSEL_OVR_NCS1;
+      /* Error callback */
+#if defined (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U)
+      hxspi->ErrorCallback(hxspi);
+#else
+      HAL_XSPI_ErrorCallback(hxspi);
+#endif /* defined (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U) */
     }
-    if ((reg & OCTOSPIM_CR_CSSEL_OVR_O2) == OCTOSPIM_CR_CSSEL_OVR_O2)
+  }
+}
+
+/**
+  * @brief  Issue the current step of the queued transactions, skipping the steps without command.
+  * @param  hxspi : XSPI handle
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef XSPI_TransactionQueue_Issue(XSPI_HandleTypeDef *hxspi)
+{
+  XSPI_TransactionQueueTypeDef *p_queue = hxspi->pTransactionQueue;
+  const XSPI_TransactionTypeDef *p_transaction;
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t issued = 0U;
+
+  while ((issued == 0U) && (p_queue->Index < p_queue->TransactionCount))
+  {
+    p_transaction = &(p_queue->pTransactions[p_queue->Index]);
+
+    if (p_queue->Step == XSPI_QUEUE_STEP_WRITE_ENABLE)
     {
-      ovr_xspi2 = HAL_XSPI_CSSEL_OVR_NCS2;
+      if (p_queue->WriteEnableCmd.InstructionMode != HAL_XSPI_INSTRUCTION_NONE)
+      {
+        status = HAL_XSPI_Command_IT(hxspi, &(p_queue->WriteEnableCmd));
+        issued = 1U;
+      }
+      else
+      {
+        p_queue->Step = XSPI_QUEUE_STEP_OPERATION;
+      }
+    }
+    else if (p_queue->Step == XSPI_QUEUE_STEP_OPERATION)
+    {
+      p_queue->CurrentCmd         = p_queue->OperationCmd;
+      p_queue->CurrentCmd.Address = p_transaction->Address;
+
+      if (p_transaction->DataLength == 0U)
+      {
+        /* Command without data phase, e.g sector erase */
+        p_queue->CurrentCmd.DataMode = HAL_XSPI_DATA_NONE;
+        status = HAL_XSPI_Command_IT(hxspi, &(p_queue->CurrentCmd));
+      }
+      else
+      {
+        /* The command is only configured, the transfer starts with the DMA */
+        p_queue->CurrentCmd.DataLength = p_transaction->DataLength;
+        status = HAL_XSPI_Command(hxspi, &(p_queue->CurrentCmd), hxspi->Timeout);
+
+        if (status == HAL_OK)
+        {
+          status = HAL_XSPI_Transmit_DMA(hxspi, p_transaction->pData);
+        }
+      }
+      issued = 1U;
     }
     else
     {
-      ovr_xspi2 = HAL_XSPI_CSSEL_OVR_NCS1;
+      if (p_queue->StatusCmd.InstructionMode != HAL_XSPI_INSTRUCTION_NONE)
+      {
+        status = HAL_XSPI_Command(hxspi, &(p_queue->StatusCmd), hxspi->Timeout);
+
+        if (status == HAL_OK)
+        {
+          status = HAL_XSPI_AutoPolling_IT(hxspi, &(p_queue->StatusPolling));
+        }
+        issued = 1U;
+      }
+      else
+      {
+        p_queue->Index++;
+        p_queue->Step = XSPI_QUEUE_STEP_WRITE_ENABLE;
+      }
     }
   }
-  else
-  {
-    ovr_xspi1 = HAL_XSPI_CSSEL_OVR_DISABLED;
-    ovr_xspi2 = HAL_XSPI_CSSEL_OVR_DISABLED;
-  }
-
-  /***************** Reset of previous configuration *************************/
-  CLEAR_REG(OCTOSPIM->CR);
 
-  /******************** Activation of new configuration **********************/
-  MODIFY_REG(OCTOSPIM->CR, OCTOSPIM_CR_REQ2ACK_TIME, ((pCfg->Req2AckTime - 1U) << OCTOSPIM_CR_REQ2ACK_TIME_Pos));
+  return status;
+}
 
-  /******************** CSSEL_OVR management *********************************/
-  if (hxspi->Instance == OCTOSPI1)
-  {
-    ovr_xspi1 = pCfg->nCSOverride;
-  }
-  else if (hxspi->Instance == OCTOSPI2)
-  {
-    ovr_xspi2 = pCfg->nCSOverride;
-  }
-  else
-  {
-    /* Nothing to do */
-  }
+/**
+  * @brief  Move the queued transactions to their next step, from the XSPI interrupt.
+  * @param  hxspi : XSPI handle
+  * @retval None
+  */
+static void XSPI_TransactionQueue_Next(XSPI_HandleTypeDef *hxspi)
+{
+  XSPI_TransactionQueueTypeDef *p_queue = hxspi->pTransactionQueue;
+  uint32_t error_code;
 
-  uint32_t ovr_en = 0U;
-  if ((ovr_xspi1 != HAL_XSPI_CSSEL_OVR_DISABLED) || (ovr_xspi2 != HAL_XSPI_CSSEL_OVR_DISABLED))
+  /* The step in progress is complete */
+  if (p_queue->Step == XSPI_QUEUE_STEP_POLLING)
   {
-    ovr_en = OCTOSPIM_CR_CSSEL_OVR_EN;
+    p_queue->Index++;
+    p_queue->Step = XSPI_QUEUE_STEP_WRITE_ENABLE;
   }
   else
   {
-    ovr_xspi1 = HAL_XSPI_CSSEL_OVR_NCS1;
-    ovr_xspi2 = HAL_XSPI_CSSEL_OVR_NCS1;
+    p_queue->Step++;
   }
 
-  reg &= ~(OCTOSPIM_CR_CSSEL_OVR_EN | OCTOSPIM_CR_CSSEL_OVR_O1 | OCTOSPIM_CR_CSSEL_OVR_O2);
-  if (ovr_en == OCTOSPIM_CR_CSSEL_OVR_EN)
-  {
-    reg |= OCTOSPIM_CR_CSSEL_OVR_EN;
-  }
-  if (ovr_xspi1 == HAL_XSPI_CSSEL_OVR_NCS2)
-  {
-    reg |= OCTOSPIM_CR_CSSEL_OVR_O1;
-  }
-  if (ovr_xspi2 == HAL_XSPI_CSSEL_OVR_NCS2)
+  if (XSPI_TransactionQueue_Issue(hxspi) != HAL_OK)
   {
-    reg |= OCTOSPIM_CR_CSSEL_OVR_O2;
-  }
+    /* Return to the idle state, keeping the error code of the failure */
+    error_code = hxspi->ErrorCode;
+    (void)HAL_XSPI_Abort(hxspi);
 
-  MODIFY_REG(OCTOSPIM->CR, (OCTOSPIM_CR_CSSEL_OVR_EN | OCTOSPIM_CR_CSSEL_OVR_O1 | OCTOSPIM_CR_CSSEL_OVR_O2),
-             (reg & (OCTOSPIM_CR_CSSEL_OVR_EN | OCTOSPIM_CR_CSSEL_OVR_O1 | OCTOSPIM_CR_CSSEL_OVR_O2)));
-
-  /******************** Management of MUXEN and MODE *************************/
-  for (index = 0U; index < (OCTOSPI_NB_INSTANCE - 1U); index++)
-  {
-    if (IOM_cfg[index].IOPort == IOM_cfg[index + 1U].IOPort)
-    {
-      /*Mux*/
-      SET_BIT(OCTOSPIM->CR, OCTOSPIM_CR_MUXEN);
-    }
-    else
-    {
-      /* Nothing to do */
-    }
-    if (IOM_cfg[0].IOPort == HAL_XSPIM_IOPORT_2)
-    {
-      /*Mode*/
-      SET_BIT(OCTOSPIM->CR, OCTOSPIM_CR_MODE);
-    }
-    else
-    {
-      /* Nothing to do */
-    }
+    XSPI_TransactionQueue_Complete(hxspi, error_code);
   }
-
-  /******* Re-enable both XSPI after configure XSPI IO Manager ***************/
-  if ((xspi_enabled & 0x1U) != 0U)
+  else if (p_queue->Index == p_queue->TransactionCount)
   {
-    SET_BIT(OCTOSPI1->CR, XSPI_CR_EN);
+    XSPI_TransactionQueue_Complete(hxspi, HAL_XSPI_ERROR_NONE);
   }
-  if ((xspi_enabled & 0x2U) != 0U)
+  else
   {
-    SET_BIT(OCTOSPI2->CR, XSPI_CR_EN);
+    /* Next step in progress */
   }
-
-  return status;
 }
 
 /**
-  * @}
+  * @brief  Detach the transaction queue from the handle and notify its completion.
+  * @param  hxspi     : XSPI handle
+  * @param  ErrorCode : Error code of the queue, HAL_XSPI_ERROR_NONE if all the transactions are complete
+  * @retval None
   */
+static void XSPI_TransactionQueue_Complete(XSPI_HandleTypeDef *hxspi, uint32_t ErrorCode)
+{
+  XSPI_TransactionQueueTypeDef *p_queue = hxspi->pTransactionQueue;
 
-#endif /* OCTOSPIM */
-/** @defgroup XSPI_Exported_Functions_Group5 Delay Block function
-  *  @brief   Delay block function
-  *
-@verbatim
- ===============================================================================
-                  ##### Delay Block function #####
- ===============================================================================
-    [..]
-    This subsection provides a set of functions allowing to :
-      (+) Configure the delay block.
+  hxspi->pTransactionQueue = NULL;
+  p_queue->ErrorCode = ErrorCode;
 
-@endverbatim
-  * @{
-  */
+  if (p_queue->pCompleteCallback != NULL)
+  {
+    p_queue->pCompleteCallback(hxspi, p_queue);
+  }
+}
 
 /**
-  * @brief  Set the Delay Block configuration.
-  * @param  hxspi   : XSPI handle.
-  * @param  pdlyb_cfg: Pointer to DLYB configuration structure.
-  * @retval HAL status.
+  * @brief  Send a program or an erase command to the memory of a block device.
+  * @param  hxspi : XSPI handle
+  * @param  pDev  : Pointer to the block device
+  * @param  pCmd  : Program or erase command, with its address and data length
+  * @param  pData : Data programmed, NULL for an erase
+  * @param  Wait  : 0 to return once the command is sent (indirect mode only), else wait for its end
+  * @retval HAL status
   */
-HAL_StatusTypeDef HAL_XSPI_DLYB_SetConfig(XSPI_HandleTypeDef *hxspi, const HAL_XSPI_DLYB_CfgTypeDef  *pdlyb_cfg)
+static HAL_StatusTypeDef XSPI_BlockDev_Operation(XSPI_HandleTypeDef *hxspi, XSPI_BlockDevTypeDef *pDev,
+                                                 const XSPI_RegularCmdTypeDef *pCmd, const uint8_t *pData,
+                                                 uint32_t Wait)
 {
-  HAL_StatusTypeDef status = HAL_ERROR;
-
-  /* Enable XSPI Free Running Clock (mandatory) */
-  SET_BIT(hxspi->Instance->DCR1, XSPI_DCR1_FRCK);
-
-  /* Update XSPI state */
-  hxspi->State = HAL_XSPI_STATE_BUSY_CMD;
-
-  if (hxspi->Instance == OCTOSPI1)
-  {
-    /* Enable the DelayBlock */
-    LL_DLYB_Enable(DLYB_OCTOSPI1);
+  HAL_StatusTypeDef status;
+  XSPI_XIPOperationTypeDef operation;
+  uint32_t error_code;
 
-    /* Set the Delay Block configuration */
-    LL_DLYB_SetDelay(DLYB_OCTOSPI1, pdlyb_cfg);
-    status = HAL_OK;
-  }
-#if defined(OCTOSPI2)
-  else if (hxspi->Instance == OCTOSPI2)
+  if (pDev->pXIPContext != NULL)
   {
-    /* Enable the DelayBlock */
-    LL_DLYB_Enable(DLYB_OCTOSPI2);
-
-    /* Set the Delay Block configuration */
-    LL_DLYB_SetDelay(DLYB_OCTOSPI2, pdlyb_cfg);
-    status = HAL_OK;
+    operation.pWriteEnableCmd = (pDev->WriteEnableCmd.InstructionMode != HAL_XSPI_INSTRUCTION_NONE) ?
+                                &pDev->WriteEnableCmd : NULL;
+    operation.pOperationCmd   = pCmd;
+    operation.pData           = pData;
+    operation.pStatusCmd      = &pDev->StatusCmd;
+    operation.pStatusPolling  = &pDev->StatusPolling;
+    operation.MappedAddress   = pDev->MappedBase + pCmd->Address;
+    operation.Size            = (pData != NULL) ? pCmd->DataLength : pDev->SectorSize;
+
+    status = HAL_XSPI_XIP_Execute(hxspi, pDev->pXIPContext, &operation, pDev->Timeout);
   }
-#endif /* OCTOSPI2 */
   else
   {
-    hxspi->ErrorCode |= HAL_XSPI_ERROR_INVALID_PARAM;
-  }
+    /* The memory is busy until the end of a background erase */
+    status = XSPI_BlockDev_WaitErase(hxspi, pDev);
+
+    if ((status == HAL_OK) && (pDev->WriteEnableCmd.InstructionMode != HAL_XSPI_INSTRUCTION_NONE))
+    {
+      status = HAL_XSPI_Command(hxspi, &pDev->WriteEnableCmd, hxspi->Timeout);
+    }
+
+    if (status == HAL_OK)
+    {
+      status = HAL_XSPI_Command(hxspi, pCmd, hxspi->Timeout);
+
+      if ((status == HAL_OK) && (pData != NULL))
+      {
+        status = HAL_XSPI_Transmit(hxspi, pData, hxspi->Timeout);
+      }
+    }
 
-  /* Abort the current XSPI operation if exist */
-  (void)HAL_XSPI_Abort(hxspi);
+    if ((status == HAL_OK) && (Wait != 0U))
+    {
+      status = HAL_XSPI_Command(hxspi, &pDev->StatusCmd, hxspi->Timeout);
 
-  /* Disable Free Running Clock */
-  CLEAR_BIT(hxspi->Instance->DCR1, XSPI_DCR1_FRCK);
+      if (status == HAL_OK)
+      {
+        status = HAL_XSPI_AutoPolling(hxspi, &pDev->StatusPolling, pDev->Timeout);
+      }
+    }
+
+    if (status != HAL_OK)
+    {
+      /* Stop the pending indirect or auto-polling transfer, keeping the error code of the failure */
+      error_code = hxspi->ErrorCode;
+      (void)HAL_XSPI_Abort(hxspi);
+      hxspi->ErrorCode |= error_code;
+    }
+  }
 
   return status;
 }
 
 /**
-  * @brief  Get the Delay Block configuration.
-  * @param  hxspi   : XSPI handle.
-  * @param  pdlyb_cfg: Pointer to DLYB configuration structure.
-  * @retval HAL status.
+  * @brief  Read the status register once to check the end of the background erase of a block device.
+  * @param  hxspi : XSPI handle
+  * @param  pDev  : Pointer to the block device
+  * @param  pDone : Set to 1 when the status register matches the end of operation, else to 0
+  * @retval HAL status
   */
-HAL_StatusTypeDef HAL_XSPI_DLYB_GetConfig(XSPI_HandleTypeDef *hxspi, HAL_XSPI_DLYB_CfgTypeDef *pdlyb_cfg)
+static HAL_StatusTypeDef XSPI_BlockDev_PollErase(XSPI_HandleTypeDef *hxspi, const XSPI_BlockDevTypeDef *pDev,
+                                                 uint32_t *pDone)
 {
-  HAL_StatusTypeDef status = HAL_ERROR;
+  HAL_StatusTypeDef status;
+  uint8_t status_reg[4] = {0U, 0U, 0U, 0U};
+  uint32_t value;
+  uint32_t error_code;
 
-  if (hxspi->Instance == OCTOSPI1)
-  {
-    LL_DLYB_GetDelay(DLYB_OCTOSPI1, pdlyb_cfg);
-    status = HAL_OK;
-  }
-#if defined(OCTOSPI2)
-  else if (hxspi->Instance == OCTOSPI2)
+  status = HAL_XSPI_Command(hxspi, &pDev->StatusCmd, hxspi->Timeout);
+
+  if (status == HAL_OK)
   {
-    LL_DLYB_GetDelay(DLYB_OCTOSPI2, pdlyb_cfg);
-    status = HAL_OK;
+    status = HAL_XSPI_Receive(hxspi, status_reg, hxspi->Timeout);
   }
-#endif /* OCTOSPI2 */
-  else
+
+  if (status != HAL_OK)
   {
-    hxspi->ErrorCode |= HAL_XSPI_ERROR_INVALID_PARAM;
+    error_code = hxspi->ErrorCode;
+    (void)HAL_XSPI_Abort(hxspi);
+    hxspi->ErrorCode |= error_code;
   }
 
+  /* The first status byte received is compared with the least significant byte of the match value */
+  value = (uint32_t)status_reg[0] | ((uint32_t)status_reg[1] << 8U) | ((uint32_t)status_reg[2] << 16U) |
+          ((uint32_t)status_reg[3] << 24U);
+  *pDone = ((value & pDev->StatusPolling.MatchMask) == pDev->StatusPolling.MatchValue) ? 1U : 0U;
+
   return status;
 }
 
 /**
-  * @brief  Get the Delay line length value.
-  * @param  hxspi   : XSPI handle.
-  * @param  pdlyb_cfg: Pointer to DLYB configuration structure.
-  * @retval HAL status.
+  * @brief  Wait for the end of the background erase of a block device, if any.
+  * @param  hxspi : XSPI handle
+  * @param  pDev  : Pointer to the block device
+  * @retval HAL status
   */
-HAL_StatusTypeDef HAL_XSPI_DLYB_GetClockPeriod(XSPI_HandleTypeDef *hxspi, HAL_XSPI_DLYB_CfgTypeDef *pdlyb_cfg)
+static HAL_StatusTypeDef XSPI_BlockDev_WaitErase(XSPI_HandleTypeDef *hxspi, XSPI_BlockDevTypeDef *pDev)
 {
-  HAL_StatusTypeDef status = HAL_ERROR;
-
-  /* Enable XSPI Free Running Clock (mandatory) */
-  SET_BIT(hxspi->Instance->DCR1, XSPI_DCR1_FRCK);
-
-  /* Update XSPI state */
-  hxspi->State = HAL_XSPI_STATE_BUSY_CMD;
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t error_code;
+  uint32_t index;
 
-  if (hxspi->Instance == OCTOSPI1)
+  for (index = 0U; index < XSPI_BLOCKDEV_ERASE_NBR_MAX; index++)
   {
-    /* Enable the DelayBlock */
-    LL_DLYB_Enable(DLYB_OCTOSPI1);
-
-    /* try to detect Period */
-    if (LL_DLYB_GetClockPeriod(DLYB_OCTOSPI1, pdlyb_cfg) == (uint32_t)SUCCESS)
+    if (pDev->aEraseState[index] == XSPI_BLOCKDEV_ERASE_ONGOING)
     {
-      status = HAL_OK;
-    }
+      status = HAL_XSPI_Command(hxspi, &pDev->StatusCmd, hxspi->Timeout);
 
-    /* Disable the DelayBlock */
-    LL_DLYB_Disable(DLYB_OCTOSPI1);
-  }
-#if defined(OCTOSPI2)
-  else if (hxspi->Instance == OCTOSPI2)
-  {
-    /* Enable the DelayBlock */
-    LL_DLYB_Enable(DLYB_OCTOSPI2);
+      if (status == HAL_OK)
+      {
+        status = HAL_XSPI_AutoPolling(hxspi, &pDev->StatusPolling, pDev->Timeout);
+      }
 
-    /* try to detect Period */
-    if (LL_DLYB_GetClockPeriod(DLYB_OCTOSPI2, pdlyb_cfg) == (uint32_t)SUCCESS)
-    {
-      status = HAL_OK;
-    }
+      if (status == HAL_OK)
+      {
+        pDev->aEraseState[index] = XSPI_BLOCKDEV_ERASE_DONE;
+      }
+      else
+      {
+        error_code = hxspi->ErrorCode;
+        (void)HAL_XSPI_Abort(hxspi);
+        hxspi->ErrorCode |= error_code;
 
-    /* Disable the DelayBlock */
-    LL_DLYB_Disable(DLYB_OCTOSPI2);
-  }
-#endif /* OCTOSPI2 */
-  else
-  {
-    hxspi->ErrorCode |= HAL_XSPI_ERROR_INVALID_PARAM;
+        pDev->aEraseState[index] = XSPI_BLOCKDEV_ERASE_FREE;
+      }
+    }
   }
 
-  /* Abort the current XSPI operation if exist */
-  (void)HAL_XSPI_Abort(hxspi);
-
-  /* Disable Free Running Clock */
-  CLEAR_BIT(hxspi->Instance->DCR1, XSPI_DCR1_FRCK);
-
   return status;
 }
+
 /**
-  * @}
-  */
-/**
-  @cond 0
-  */
-/**
-  * @brief  DMA XSPI process complete callback.
-  * @param  hdma : DMA handle
-  * @retval None
+  * @brief  Cancel the background erase reservation of a sector of a block device.
+  * @param  hxspi   : XSPI handle
+  * @param  pDev    : Pointer to the block device
+  * @param  Address : Address of the sector
+  * @param  pErased : Set to 1 when the sector has been erased in the background, else to 0
+  * @retval HAL status
   */
-static void XSPI_DMACplt(DMA_HandleTypeDef *hdma)
+static HAL_StatusTypeDef XSPI_BlockDev_Release(XSPI_HandleTypeDef *hxspi, XSPI_BlockDevTypeDef *pDev,
+                                               uint32_t Address, uint32_t *pErased)
 {
-  XSPI_HandleTypeDef *hxspi = (XSPI_HandleTypeDef *)(hdma->Parent);
-  hxspi->XferCount = 0;
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t index;
 
-  /* Disable the DMA transfer on the XSPI side */
-  CLEAR_BIT(hxspi->Instance->CR, XSPI_CR_DMAEN);
+  *pErased = 0U;
 
-  /* Enable the XSPI transfer complete Interrupt */
-  HAL_XSPI_ENABLE_IT(hxspi, HAL_XSPI_IT_TC);
+  for (index = 0U; index < XSPI_BLOCKDEV_ERASE_NBR_MAX; index++)
+  {
+    if ((pDev->aEraseState[index] != XSPI_BLOCKDEV_ERASE_FREE) && (pDev->aEraseAddress[index] == Address))
+    {
+      if (pDev->aEraseState[index] == XSPI_BLOCKDEV_ERASE_ONGOING)
+      {
+        status = XSPI_BlockDev_WaitErase(hxspi, pDev);
+      }
+
+      *pErased = (pDev->aEraseState[index] == XSPI_BLOCKDEV_ERASE_DONE) ? 1U : 0U;
+      pDev->aEraseState[index] = XSPI_BLOCKDEV_ERASE_FREE;
+    }
+  }
+
+  return status;
 }
 
 /**
-  * @brief  DMA XSPI process half complete callback.
-  * @param  hdma : DMA handle
+  * @brief  Drop the coalesced page and the cached copy of a sector of a block device being erased.
+  * @param  pDev    : Pointer to the block device
+  * @param  Address : Address of the sector
   * @retval None
   */
-static void XSPI_DMAHalfCplt(DMA_HandleTypeDef *hdma)
+static void XSPI_BlockDev_Discard(XSPI_BlockDevTypeDef *pDev, uint32_t Address)
 {
-  XSPI_HandleTypeDef *hxspi = (XSPI_HandleTypeDef *)(hdma->Parent);
-  hxspi->XferCount = (hxspi->XferCount >> 1);
+  uint32_t slot;
 
-  if (hxspi->State == HAL_XSPI_STATE_BUSY_RX)
+  if ((pDev->PageAddress != XSPI_BLOCKDEV_NO_ADDRESS) &&
+      ((pDev->PageAddress - (pDev->PageAddress % pDev->SectorSize)) == Address))
   {
-#if defined (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U)
-    hxspi->RxHalfCpltCallback(hxspi);
-#else
-    HAL_XSPI_RxHalfCpltCallback(hxspi);
-#endif /* (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U) */
+    pDev->PageAddress = XSPI_BLOCKDEV_NO_ADDRESS;
   }
-  else
+
+  slot = XSPI_BlockDev_CacheFind(pDev, Address);
+  if (slot < pDev->CacheNbr)
   {
-#if defined (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U)
-    hxspi->TxHalfCpltCallback(hxspi);
-#else
-    HAL_XSPI_TxHalfCpltCallback(hxspi);
-#endif /* (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U) */
+    pDev->aCacheAddress[slot] = XSPI_BLOCKDEV_NO_ADDRESS;
   }
 }
 
 /**
-  * @brief  DMA XSPI communication error callback.
-  * @param  hdma : DMA handle
-  * @retval None
+  * @brief  Write the coalesced page of a block device to the memory.
+  * @param  hxspi : XSPI handle
+  * @param  pDev  : Pointer to the block device
+  * @retval HAL status
   */
-static void XSPI_DMAError(DMA_HandleTypeDef *hdma)
+static HAL_StatusTypeDef XSPI_BlockDev_Flush(XSPI_HandleTypeDef *hxspi, XSPI_BlockDevTypeDef *pDev)
 {
-  XSPI_HandleTypeDef *hxspi = (XSPI_HandleTypeDef *)(hdma->Parent);
-  hxspi->XferCount = 0;
-  hxspi->ErrorCode = HAL_XSPI_ERROR_DMA;
-
-  /* Disable the DMA transfer on the XSPI side */
-  CLEAR_BIT(hxspi->Instance->CR, XSPI_CR_DMAEN);
+  HAL_StatusTypeDef status = HAL_OK;
+  XSPI_RegularCmdTypeDef cmd;
 
-  /* Abort the XSPI */
-  if (HAL_XSPI_Abort_IT(hxspi) != HAL_OK)
+  if (pDev->PageAddress != XSPI_BLOCKDEV_NO_ADDRESS)
   {
-    /* Disable the interrupts */
-    HAL_XSPI_DISABLE_IT(hxspi, HAL_XSPI_IT_TC | HAL_XSPI_IT_FT | HAL_XSPI_IT_TE);
+    /* The bytes not programmed are left to 0xFF and do not modify the memory */
+    cmd = pDev->ProgramCmd;
+    cmd.Address    = pDev->PageAddress;
+    cmd.DataLength = pDev->PageSize;
 
-    hxspi->State = HAL_XSPI_STATE_READY;
+    status = XSPI_BlockDev_Operation(hxspi, pDev, &cmd, pDev->pPageBuffer, 1U);
 
-    /* Error callback */
-#if defined (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U)
-    hxspi->ErrorCallback(hxspi);
-#else
-    HAL_XSPI_ErrorCallback(hxspi);
-#endif /* (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U) */
+    pDev->PageAddress = XSPI_BLOCKDEV_NO_ADDRESS;
   }
+
+  return status;
 }
 
 /**
-  * @brief  DMA XSPI abort complete callback.
-  * @param  hdma : DMA handle
-  * @retval None
+  * @brief  Read data from the memory of a block device, including the coalesced page.
+  * @param  hxspi   : XSPI handle
+  * @param  pDev    : Pointer to the block device
+  * @param  Address : Address of the data in the memory
+  * @param  pData   : Pointer to the data buffer
+  * @param  Size    : Number of bytes to read
+  * @retval HAL status
   */
-static void XSPI_DMAAbortCplt(DMA_HandleTypeDef *hdma)
+static HAL_StatusTypeDef XSPI_BlockDev_ReadMemory(XSPI_HandleTypeDef *hxspi, XSPI_BlockDevTypeDef *pDev,
+                                                  uint32_t Address, uint8_t *pData, uint32_t Size)
 {
-  XSPI_HandleTypeDef *hxspi = (XSPI_HandleTypeDef *)(hdma->Parent);
-  hxspi->XferCount = 0;
+  HAL_StatusTypeDef status = HAL_OK;
+  XSPI_RegularCmdTypeDef cmd;
+  const __IO uint8_t *p_mapped;
+  uint32_t error_code;
+  uint32_t start;
+  uint32_t end;
+  uint32_t index;
+
+  if (pDev->pXIPContext != NULL)
+  {
+    p_mapped = (const __IO uint8_t *)(pDev->MappedBase + Address);
 
-  /* Check the state */
-  if (hxspi->State == HAL_XSPI_STATE_ABORT)
+    for (index = 0U; index < Size; index++)
+    {
+      pData[index] = p_mapped[index];
+    }
+  }
+  else
   {
-    /* DMA abort called by XSPI abort */
-    if (HAL_XSPI_GET_FLAG(hxspi, HAL_XSPI_FLAG_BUSY) != RESET)
+    /* The memory is busy until the end of a background erase */
+    status = XSPI_BlockDev_WaitErase(hxspi, pDev);
+
+    if (status == HAL_OK)
     {
-      /* Clear transfer complete flag */
-      HAL_XSPI_CLEAR_FLAG(hxspi, HAL_XSPI_FLAG_TC);
+      cmd = pDev->ReadCmd;
+      cmd.Address    = Address;
+      cmd.DataLength = Size;
 
-      /* Enable the transfer complete interrupts */
-      HAL_XSPI_ENABLE_IT(hxspi, HAL_XSPI_IT_TC);
+      status = HAL_XSPI_Command(hxspi, &cmd, hxspi->Timeout);
 
-      /* Perform an abort of the XSPI */
-      SET_BIT(hxspi->Instance->CR, XSPI_CR_ABORT);
+      if (status == HAL_OK)
+      {
+        status = HAL_XSPI_Receive(hxspi, pData, hxspi->Timeout);
+      }
+
+      if (status != HAL_OK)
+      {
+        error_code = hxspi->ErrorCode;
+        (void)HAL_XSPI_Abort(hxspi);
+        hxspi->ErrorCode |= error_code;
+      }
     }
-    else
-    {
-      hxspi->State = HAL_XSPI_STATE_READY;
+  }
 
-      /* Abort callback */
-#if defined (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U)
-      hxspi->AbortCpltCallback(hxspi);
-#else
-      HAL_XSPI_AbortCpltCallback(hxspi);
-#endif /* (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U) */
+  /* Apply the data programmed in the coalesced page */
+  if ((status == HAL_OK) && (pDev->PageAddress != XSPI_BLOCKDEV_NO_ADDRESS))
+  {
+    start = (Address > pDev->PageAddress) ? Address : pDev->PageAddress;
+    end   = ((Address + Size) < (pDev->PageAddress + pDev->PageSize)) ? (Address + Size) :
+            (pDev->PageAddress + pDev->PageSize);
+
+    for (index = start; index < end; index++)
+    {
+      pData[index - Address] &= pDev->pPageBuffer[index - pDev->PageAddress];
     }
   }
-  else
+
+  return status;
+}
+
+/**
+  * @brief  Find a sector in the cache of a block device.
+  * @param  pDev    : Pointer to the block device
+  * @param  Address : Address of the sector
+  * @retval Cache slot of the sector, pDev->CacheNbr if the sector is not cached
+  */
+static uint32_t XSPI_BlockDev_CacheFind(const XSPI_BlockDevTypeDef *pDev, uint32_t Address)
+{
+  uint32_t slot = 0U;
+
+  while ((slot < pDev->CacheNbr) && (pDev->aCacheAddress[slot] != Address))
   {
-    /* DMA abort called due to a transfer error interrupt */
-    hxspi->State = HAL_XSPI_STATE_READY;
+    slot++;
+  }
 
-    /* Error callback */
-#if defined (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U)
-    hxspi->ErrorCallback(hxspi);
-#else
-    HAL_XSPI_ErrorCallback(hxspi);
-#endif /* defined (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U) */
+  return slot;
+}
+
+/**
+  * @brief  Get a sector from the cache of a block device, loading it in place of the least recently used one.
+  * @param  hxspi    : XSPI handle
+  * @param  pDev     : Pointer to the block device
+  * @param  Address  : Address of the sector
+  * @param  ppSector : Set to the cached copy of the sector
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef XSPI_BlockDev_CacheLoad(XSPI_HandleTypeDef *hxspi, XSPI_BlockDevTypeDef *pDev,
+                                                 uint32_t Address, const uint8_t **ppSector)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t slot;
+  uint32_t index;
+
+  slot = XSPI_BlockDev_CacheFind(pDev, Address);
+
+  if (slot == pDev->CacheNbr)
+  {
+    slot = 0U;
+    for (index = 1U; index < pDev->CacheNbr; index++)
+    {
+      if ((pDev->CacheStamp - pDev->aCacheStamp[index]) > (pDev->CacheStamp - pDev->aCacheStamp[slot]))
+      {
+        slot = index;
+      }
+    }
+
+    pDev->aCacheAddress[slot] = XSPI_BLOCKDEV_NO_ADDRESS;
+
+    status = XSPI_BlockDev_ReadMemory(hxspi, pDev, Address, &pDev->pCacheBuffer[slot * pDev->SectorSize],
+                                      pDev->SectorSize);
+
+    if (status == HAL_OK)
+    {
+      pDev->aCacheAddress[slot] = Address;
+    }
   }
+
+  pDev->CacheStamp++;
+  pDev->aCacheStamp[slot] = pDev->CacheStamp;
+  *ppSector = &pDev->pCacheBuffer[slot * pDev->SectorSize];
+
+  return status;
 }
 
 /**
@@ -1227,6 +1227,201 @@ void LL_DMA_DisconnectNextLinkNode(LL_DMA_LinkNodeTypeDef *pLinkNode, uint32_t L
   pLinkNode->LinkRegisters[LinkNodeCLLRIdx] = 0;
 }
 
+/**
+  * @brief  Initialize a linked list queue on a user array of nodes.
+  * @note   The queue is a lightweight alternative to the HAL DMA linked list queues: the nodes are
+  *         created in place in the pNodes array and linked while they are appended, no handle is used.
+  * @param  pQueue Pointer to a LL_DMA_LinkQueueTypeDef structure.
+  * @param  pNodes Pointer to the user array of linked list nodes.
+  * @param  MaxNodes Number of nodes of the pNodes array.
+  * @retval None
+  */
+void LL_DMA_Queue_Init(LL_DMA_LinkQueueTypeDef *pQueue, LL_DMA_LinkNodeTypeDef *pNodes, uint32_t MaxNodes)
+{
+  /* Check the parameters */
+  assert_param(pNodes != NULL);
+  assert_param(MaxNodes != 0U);
+
+  pQueue->pNodes            = pNodes;
+  pQueue->MaxNodes          = MaxNodes;
+  pQueue->NodeNb            = 0U;
+  pQueue->NodeType          = LL_DMA_GPDMA_LINEAR_NODE;
+  pQueue->UpdateRegisters   = 0U;
+  pQueue->CLLRIdx           = 0U;
+  pQueue->FirstCircularNode = LL_DMA_QUEUE_NOT_CIRCULAR;
+}
+
+/**
+  * @brief  Create a linked list node at the end of the queue and link it to the previous node.
+  * @note   The first appended node sets the layout of the queue: the next nodes must have the same
+  *         node type and updated registers, and the CLLR register update must be enabled.
+  * @note   When the queue is circular, the appended node is linked to the first circular node.
+  * @param  pQueue Pointer to a LL_DMA_LinkQueueTypeDef structure.
+  * @param  DMA_InitNodeStruct Pointer to a LL_DMA_InitNodeTypeDef structure that contains the
+  *         node registers configuration.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: The node is appended to the queue.
+  *          - ERROR: The queue is full or the node layout does not match the queue one.
+  */
+uint32_t LL_DMA_Queue_AppendNode(LL_DMA_LinkQueueTypeDef *pQueue, const LL_DMA_InitNodeTypeDef *DMA_InitNodeStruct)
+{
+  LL_DMA_LinkNodeTypeDef *pnode;
+  uint32_t update_registers = DMA_InitNodeStruct->UpdateRegisters;
+  uint32_t cllr_idx = 0U;
+
+  if (pQueue->NodeNb >= pQueue->MaxNodes)
+  {
+    return (uint32_t)ERROR;
+  }
+
+  /* The CLLR update bits of the previous node select the registers loaded from this node */
+  if ((update_registers & LL_DMA_UPDATE_CLLR) != LL_DMA_UPDATE_CLLR)
+  {
+    return (uint32_t)ERROR;
+  }
+
+  /* CTR3 and CBR2 are discarded for linear addressing nodes */
+  if (DMA_InitNodeStruct->NodeType != LL_DMA_GPDMA_2D_NODE)
+  {
+    update_registers &= ~(LL_DMA_UPDATE_CTR3 | LL_DMA_UPDATE_CBR2);
+  }
+
+  pnode = &pQueue->pNodes[pQueue->NodeNb];
+
+  if (pQueue->NodeNb == 0U)
+  {
+    /* The CLLR register follows the updated registers in the node */
+    cllr_idx += ((update_registers & LL_DMA_UPDATE_CTR1) != 0U) ? 1U : 0U;
+    cllr_idx += ((update_registers & LL_DMA_UPDATE_CTR2) != 0U) ? 1U : 0U;
+    cllr_idx += ((update_registers & LL_DMA_UPDATE_CBR1) != 0U) ? 1U : 0U;
+    cllr_idx += ((update_registers & LL_DMA_UPDATE_CSAR) != 0U) ? 1U : 0U;
+    cllr_idx += ((update_registers & LL_DMA_UPDATE_CDAR) != 0U) ? 1U : 0U;
+    cllr_idx += ((update_registers & LL_DMA_UPDATE_CTR3) != 0U) ? 1U : 0U;
+    cllr_idx += ((update_registers & LL_DMA_UPDATE_CBR2) != 0U) ? 1U : 0U;
+
+    pQueue->NodeType        = DMA_InitNodeStruct->NodeType;
+    pQueue->UpdateRegisters = update_registers;
+    pQueue->CLLRIdx         = cllr_idx;
+  }
+  else
+  {
+    /* All the nodes share the queue layout and linked list base address */
+    if ((DMA_InitNodeStruct->NodeType != pQueue->NodeType) || (update_registers != pQueue->UpdateRegisters))
+    {
+      return (uint32_t)ERROR;
+    }
+
+    if (((uint32_t)pnode & DMA_CLBAR_LBA) != ((uint32_t)pQueue->pNodes & DMA_CLBAR_LBA))
+    {
+      return (uint32_t)ERROR;
+    }
+  }
+
+  (void)LL_DMA_CreateLinkNode(DMA_InitNodeStruct, pnode);
+
+  /* The queue layout is used for the links as the CLLR of the last node may be cleared */
+  if (pQueue->FirstCircularNode != LL_DMA_QUEUE_NOT_CIRCULAR)
+  {
+    pnode->LinkRegisters[pQueue->CLLRIdx] = (((uint32_t)&pQueue->pNodes[pQueue->FirstCircularNode] & DMA_CLLR_LA) | \
+                                             pQueue->UpdateRegisters);
+  }
+  else
+  {
+    LL_DMA_DisconnectNextLinkNode(pnode, pQueue->CLLRIdx);
+  }
+
+  if (pQueue->NodeNb != 0U)
+  {
+    pQueue->pNodes[pQueue->NodeNb - 1U].LinkRegisters[pQueue->CLLRIdx] = (((uint32_t)pnode & DMA_CLLR_LA) | \
+                                                                          pQueue->UpdateRegisters);
+  }
+
+  pQueue->NodeNb++;
+
+  return (uint32_t)SUCCESS;
+}
+
+/**
+  * @brief  Link the last node of the queue to one of its nodes.
+  * @param  pQueue Pointer to a LL_DMA_LinkQueueTypeDef structure.
+  * @param  FirstCircularNodeIdx Index of the node executed after the last node of the queue.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: The queue is circular.
+  *          - ERROR: The node index is out of the queue.
+  */
+uint32_t LL_DMA_Queue_SetCircular(LL_DMA_LinkQueueTypeDef *pQueue, uint32_t FirstCircularNodeIdx)
+{
+  if (FirstCircularNodeIdx >= pQueue->NodeNb)
+  {
+    return (uint32_t)ERROR;
+  }
+
+  pQueue->FirstCircularNode = FirstCircularNodeIdx;
+  pQueue->pNodes[pQueue->NodeNb - 1U].LinkRegisters[pQueue->CLLRIdx] =
+    (((uint32_t)&pQueue->pNodes[FirstCircularNodeIdx] & DMA_CLLR_LA) | pQueue->UpdateRegisters);
+
+  return (uint32_t)SUCCESS;
+}
+
+/**
+  * @brief  Unlink the last node of the queue so that the channel stops after its execution.
+  * @param  pQueue Pointer to a LL_DMA_LinkQueueTypeDef structure.
+  * @retval None
+  */
+void LL_DMA_Queue_ClearCircular(LL_DMA_LinkQueueTypeDef *pQueue)
+{
+  pQueue->FirstCircularNode = LL_DMA_QUEUE_NOT_CIRCULAR;
+
+  if (pQueue->NodeNb != 0U)
+  {
+    LL_DMA_DisconnectNextLinkNode(&pQueue->pNodes[pQueue->NodeNb - 1U], pQueue->CLLRIdx);
+  }
+}
+
+/**
+  * @brief  Start the execution of a linked list queue on a DMA channel.
+  * @note   The channel must be disabled and initialized with LL_DMA_List_Init(). The channel
+  *         registers are loaded from the first node of the queue before the first transfer.
+  * @param  DMAx DMAx Instance
+  * @param  Channel This parameter can be one of the following values:
+  *         @arg @ref LL_DMA_CHANNEL_0
+  *         @arg @ref LL_DMA_CHANNEL_1
+  *         @arg @ref LL_DMA_CHANNEL_2
+  *         @arg @ref LL_DMA_CHANNEL_3
+  *         @arg @ref LL_DMA_CHANNEL_4
+  *         @arg @ref LL_DMA_CHANNEL_5
+  *         @arg @ref LL_DMA_CHANNEL_6
+  *         @arg @ref LL_DMA_CHANNEL_7
+  *         @arg @ref LL_DMA_CHANNEL_8 (*)
+  *         @arg @ref LL_DMA_CHANNEL_9 (*)
+  *         @arg @ref LL_DMA_CHANNEL_10 (*)
+  *         @arg @ref LL_DMA_CHANNEL_11 (*)
+  * @note   (*) Availability depends on devices.
+  * @param  pQueue Pointer to a LL_DMA_LinkQueueTypeDef structure.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: The channel is enabled.
+  *          - ERROR: The queue is empty.
+  */
+uint32_t LL_DMA_Queue_Start(DMA_TypeDef *DMAx, uint32_t Channel, const LL_DMA_LinkQueueTypeDef *pQueue)
+{
+  /* Check the DMA Instance DMAx and Channel parameters */
+  assert_param(IS_LL_DMA_ALL_CHANNEL_INSTANCE(DMAx, Channel));
+
+  if (pQueue->NodeNb == 0U)
+  {
+    return (uint32_t)ERROR;
+  }
+
+  /* Load all the queue registers from the first node */
+  LL_DMA_SetBlkDataLength(DMAx, Channel, 0U);
+  LL_DMA_SetLinkedListBaseAddr(DMAx, Channel, (uint32_t)pQueue->pNodes);
+  LL_DMA_ConfigLinkUpdate(DMAx, Channel, pQueue->UpdateRegisters, (uint32_t)pQueue->pNodes);
+
+  LL_DMA_EnableChannel(DMAx, Channel);
+
+  return (uint32_t)SUCCESS;
+}
+
 /**
   * @}
   */
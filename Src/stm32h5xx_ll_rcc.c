@@ -36,6 +36,16 @@
 
 /* Private types -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
+/** @defgroup RCC_LL_Private_Variables RCC Private variables
+  * @{
+  */
+/* Clock tree frequencies used by the frequency queries while RCC_ClockSnapshotValid is set */
+static LL_RCC_ClockSnapshotTypeDef RCC_ClockSnapshot;
+static uint32_t RCC_ClockSnapshotValid = 0U;
+/**
+  * @}
+  */
+
 /* Private constants ---------------------------------------------------------*/
 /* Private macros ------------------------------------------------------------*/
 /** @addtogroup RCC_LL_Private_Macros
@@ -358,6 +368,9 @@ ErrorStatus LL_RCC_DeInit(void)
   /* Update the SystemCoreClock global variable */
   SystemCoreClock = HSI_VALUE;
 
+  /* The clock tree snapshot is outdated */
+  RCC_ClockSnapshotValid = 0U;
+
   return SUCCESS;
 }
 
@@ -400,6 +413,12 @@ ErrorStatus LL_RCC_DeInit(void)
   */
 void LL_RCC_GetSystemClocksFreq(LL_RCC_ClocksTypeDef *pRCC_Clocks)
 {
+  if (RCC_ClockSnapshotValid != 0U)
+  {
+    *pRCC_Clocks = RCC_ClockSnapshot.Clocks;
+    return;
+  }
+
   /* Get SYSCLK frequency */
   pRCC_Clocks->SYSCLK_Frequency = RCC_GetSystemClockFreq();
 
@@ -416,6 +435,59 @@ void LL_RCC_GetSystemClocksFreq(LL_RCC_ClocksTypeDef *pRCC_Clocks)
   pRCC_Clocks->PCLK3_Frequency  = RCC_GetPCLK3ClockFreq(pRCC_Clocks->HCLK_Frequency);
 }
 
+/**
+  * @brief  Take a snapshot of the clock tree frequencies
+  * @note   Once the snapshot is taken, the system, buses and PLL outputs frequencies are returned
+  *         from it by the frequency functions, peripheral frequency queries (e.g. in LL_USART_Init()
+  *         or LL_SPI_Init()) then only decode the kernel clock selection and no longer recompute
+  *         the PLL outputs.
+  * @note   This function must be called again each time SYSCLK, a bus prescaler or a PLL
+  *         configuration changes, or the snapshot must be invalidated with
+  *         LL_RCC_InvalidateClockSnapshot(). LL_RCC_DeInit() invalidates it.
+  * @retval None
+  */
+void LL_RCC_UpdateClockSnapshot(void)
+{
+  /* Compute the frequencies from the RCC registers */
+  RCC_ClockSnapshotValid = 0U;
+
+  LL_RCC_GetSystemClocksFreq(&RCC_ClockSnapshot.Clocks);
+  LL_RCC_GetPLL1ClockFreq(&RCC_ClockSnapshot.PLL1_Clocks);
+  LL_RCC_GetPLL2ClockFreq(&RCC_ClockSnapshot.PLL2_Clocks);
+#if defined(RCC_CR_PLL3ON)
+  LL_RCC_GetPLL3ClockFreq(&RCC_ClockSnapshot.PLL3_Clocks);
+#endif /* PLL3 */
+
+  RCC_ClockSnapshotValid = 1U;
+}
+
+/**
+  * @brief  Invalidate the clock tree snapshot
+  * @note   The frequency functions compute again the frequencies from the RCC registers.
+  * @retval None
+  */
+void LL_RCC_InvalidateClockSnapshot(void)
+{
+  RCC_ClockSnapshotValid = 0U;
+}
+
+/**
+  * @brief  Return the clock tree frequencies
+  * @note   The frequencies are read from the snapshot when it is valid, computed from the RCC
+  *         registers otherwise.
+  * @param  pSnapshot pointer to a @ref LL_RCC_ClockSnapshotTypeDef structure which will hold the clocks frequencies
+  * @retval None
+  */
+void LL_RCC_GetClockSnapshot(LL_RCC_ClockSnapshotTypeDef *pSnapshot)
+{
+  LL_RCC_GetSystemClocksFreq(&pSnapshot->Clocks);
+  LL_RCC_GetPLL1ClockFreq(&pSnapshot->PLL1_Clocks);
+  LL_RCC_GetPLL2ClockFreq(&pSnapshot->PLL2_Clocks);
+#if defined(RCC_CR_PLL3ON)
+  LL_RCC_GetPLL3ClockFreq(&pSnapshot->PLL3_Clocks);
+#endif /* PLL3 */
+}
+
 /**
   * @brief  Return PLL1 clocks frequencies
   * @note   LL_RCC_PERIPH_FREQUENCY_NO returned for non activated output or oscillator not ready
@@ -429,6 +501,12 @@ void LL_RCC_GetPLL1ClockFreq(LL_PLL_ClocksTypeDef *pPLL_Clocks)
   uint32_t plln;
   uint32_t fracn = 0U;
 
+  if (RCC_ClockSnapshotValid != 0U)
+  {
+    *pPLL_Clocks = RCC_ClockSnapshot.PLL1_Clocks;
+    return;
+  }
+
   /* PLL_VCO = (HSE_VALUE, CSI_VALUE or HSI_VALUE/HSIDIV) / PLLM * (PLLN + FRACN)
      SYSCLK = PLL_VCO / PLLP
   */
@@ -512,6 +590,12 @@ void LL_RCC_GetPLL2ClockFreq(LL_PLL_ClocksTypeDef *pPLL_Clocks)
   uint32_t plln;
   uint32_t fracn = 0U;
 
+  if (RCC_ClockSnapshotValid != 0U)
+  {
+    *pPLL_Clocks = RCC_ClockSnapshot.PLL2_Clocks;
+    return;
+  }
+
   /* PLL_VCO = (HSE_VALUE, CSI_VALUE or HSI_VALUE/HSIDIV) / PLLM * (PLLN + FRACN)
      SYSCLK = PLL_VCO / PLLP
   */
@@ -596,6 +680,12 @@ void LL_RCC_GetPLL3ClockFreq(LL_PLL_ClocksTypeDef *pPLL_Clocks)
   uint32_t plln;
   uint32_t fracn = 0U;
 
+  if (RCC_ClockSnapshotValid != 0U)
+  {
+    *pPLL_Clocks = RCC_ClockSnapshot.PLL3_Clocks;
+    return;
+  }
+
   /* PLL_VCO = (HSE_VALUE, CSI_VALUE or HSI_VALUE/HSIDIV) / PLLM * (PLLN + FRACN)
      SYSCLK = PLL_VCO / PLLP
   */
@@ -3855,6 +3945,11 @@ uint32_t RCC_GetSystemClockFreq(void)
 {
   uint32_t frequency;
 
+  if (RCC_ClockSnapshotValid != 0U)
+  {
+    return RCC_ClockSnapshot.Clocks.SYSCLK_Frequency;
+  }
+
   /* Get SYSCLK source -------------------------------------------------------*/
   switch (LL_RCC_GetSysClkSource())
   {
@@ -554,6 +554,55 @@ uint32_t SDMMC_CmdBlockCount(SDMMC_TypeDef *SDMMCx, uint32_t BlockCount)
   return errorstate;
 }
 
+/**
+  * @brief  Send the number of write blocks to be pre-erased command and check the response.
+  *         Send ACMD23, to be preceded by an application command (CMD55).
+  * @param  SDMMCx: Pointer to SDMMC register base
+  * @param  BlockCount: Number of blocks to be pre-erased
+  * @retval HAL status
+  */
+uint32_t SDMMC_CmdSetWrBlkEraseCount(SDMMC_TypeDef *SDMMCx, uint32_t BlockCount)
+{
+  SDMMC_CmdInitTypeDef  sdmmc_cmdinit;
+  uint32_t errorstate;
+
+  sdmmc_cmdinit.Argument         = (uint32_t)BlockCount;
+  sdmmc_cmdinit.CmdIndex         = SDMMC_CMD_SD_APP_SET_WR_BLK_ERASE_COUNT;
+  sdmmc_cmdinit.Response         = SDMMC_RESPONSE_SHORT;
+  sdmmc_cmdinit.WaitForInterrupt = SDMMC_WAIT_NO;
+  sdmmc_cmdinit.CPSM             = SDMMC_CPSM_ENABLE;
+  (void)SDMMC_SendCommand(SDMMCx, &sdmmc_cmdinit);
+
+  /* Check for error conditions */
+  errorstate = SDMMC_GetCmdResp1(SDMMCx, SDMMC_CMD_SD_APP_SET_WR_BLK_ERASE_COUNT, SDMMC_CMDTIMEOUT);
+
+  return errorstate;
+}
+
+/**
+  * @brief  Send the Send Tuning Block command and check the response.
+  *         Send CMD19, the card answers with the 64 bytes tuning pattern (SDR50 and SDR104).
+  * @param  SDMMCx: Pointer to SDMMC register base
+  * @retval HAL status
+  */
+uint32_t SDMMC_CmdSendTuningBlock(SDMMC_TypeDef *SDMMCx)
+{
+  SDMMC_CmdInitTypeDef  sdmmc_cmdinit;
+  uint32_t errorstate;
+
+  sdmmc_cmdinit.Argument         = 0U;
+  sdmmc_cmdinit.CmdIndex         = SDMMC_CMD_HS_BUSTEST_WRITE;
+  sdmmc_cmdinit.Response         = SDMMC_RESPONSE_SHORT;
+  sdmmc_cmdinit.WaitForInterrupt = SDMMC_WAIT_NO;
+  sdmmc_cmdinit.CPSM             = SDMMC_CPSM_ENABLE;
+  (void)SDMMC_SendCommand(SDMMCx, &sdmmc_cmdinit);
+
+  /* Check for error conditions */
+  errorstate = SDMMC_GetCmdResp1(SDMMCx, SDMMC_CMD_HS_BUSTEST_WRITE, SDMMC_CMDTIMEOUT);
+
+  return errorstate;
+}
+
 /**
   * @brief  Send the Read Single Block command and check the response
   * @param  SDMMCx: Pointer to SDMMC register base
@@ -2060,6 +2109,61 @@ uint32_t SDMMC_DMALinkedList_DisableCircularMode(SDMMC_DMALinkedListTypeDef *pLi
   return SDMMC_ERROR_NONE;
 }
 
+/**
+  * @brief  Build a Linked List over a scatter-gather buffer vector.
+  * @note   One node is built per vector entry, the nodes are taken in order from the
+  *         pNodes array which must hold at least IOVecCount consecutive nodes.
+  * @note   Each buffer address must be word aligned and each buffer size must be a
+  *         non null multiple of 32 bytes fitting in the IDMABNDT field.
+  * @param  pLinkedList: Pointer to the linkedlist to build
+  * @param  pNodes: Pointer to the array of nodes used to build the linkedlist
+  * @param  pIOVec: Pointer to the buffer vector
+  * @param  IOVecCount: Number of entries of the buffer vector
+  * @param  pDataLength: Pointer to the total size in bytes of the vector buffers
+  * @retval Error status
+  */
+uint32_t SDMMC_DMALinkedList_BuildIOVec(SDMMC_DMALinkedListTypeDef *pLinkedList, SDMMC_DMALinkNodeTypeDef *pNodes,
+                                        const SDMMC_DMAIOVecTypeDef *pIOVec, uint32_t IOVecCount,
+                                        uint32_t *pDataLength)
+{
+  SDMMC_DMALinkNodeConfTypeDef node_conf;
+  uint32_t length = 0U;
+  uint32_t count;
+
+  if ((pLinkedList == NULL) || (pNodes == NULL) || (pIOVec == NULL) || (IOVecCount == 0U) || (pDataLength == NULL))
+  {
+    return SDMMC_ERROR_INVALID_PARAMETER;
+  }
+
+  pLinkedList->pHeadNode    = NULL;
+  pLinkedList->pTailNode    = NULL;
+  pLinkedList->NodesCounter = 0U;
+
+  for (count = 0U; count < IOVecCount; count++)
+  {
+    if ((pIOVec[count].BufferSize == 0U) || ((pIOVec[count].BufferSize & ~SDMMC_IDMABSIZE_IDMABNDT) != 0U) ||
+        ((pIOVec[count].BufferAddress & 0x3U) != 0U))
+    {
+      return SDMMC_ERROR_ADDR_MISALIGNED;
+    }
+
+    node_conf.BufferAddress = pIOVec[count].BufferAddress;
+    node_conf.BufferSize    = pIOVec[count].BufferSize;
+    (void)SDMMC_DMALinkedList_BuildNode(&pNodes[count], &node_conf);
+
+    if (SDMMC_DMALinkedList_InsertNode(pLinkedList, pLinkedList->pTailNode, &pNodes[count]) != SDMMC_ERROR_NONE)
+    {
+      return SDMMC_ERROR_INVALID_PARAMETER;
+    }
+
+    length += pIOVec[count].BufferSize;
+  }
+
+  *pDataLength = length;
+
+  return SDMMC_ERROR_NONE;
+}
+
 /**
   * @}
   */
@@ -1114,6 +1114,8 @@ HAL_StatusTypeDef USB_EPClearStall(const USB_OTG_GlobalTypeDef *USBx, const USB_
   *          This parameter can be one of these values:
   *           0 : DMA feature not used
   *           1 : DMA feature used
+  * @note   Source buffers aligned on USB_BUFFER_ALIGNMENT are copied by bursts of
+  *         four words, others word by word with unaligned accesses.
   * @retval HAL status
   */
 HAL_StatusTypeDef USB_WritePacket(const USB_OTG_GlobalTypeDef *USBx, uint8_t *src,
@@ -1121,12 +1123,39 @@ HAL_StatusTypeDef USB_WritePacket(const USB_OTG_GlobalTypeDef *USBx, uint8_t *sr
 {
   uint32_t USBx_BASE = (uint32_t)USBx;
   uint8_t *pSrc = src;
+  const uint32_t *pSrc32;
+  __IO uint32_t *pFifo;
   uint32_t count32b;
   uint32_t i;
 
   if (dma == 0U)
   {
     count32b = ((uint32_t)len + 3U) / 4U;
+
+    if (((uint32_t)pSrc & (USB_BUFFER_ALIGNMENT - 1U)) == 0U)
+    {
+      /* Aligned source: burst the words into the FIFO */
+      pSrc32 = (const uint32_t *)pSrc;
+      pFifo = &USBx_DFIFO((uint32_t)ch_ep_num);
+
+      for (i = count32b >> 2U; i != 0U; i--)
+      {
+        *pFifo = pSrc32[0];
+        *pFifo = pSrc32[1];
+        *pFifo = pSrc32[2];
+        *pFifo = pSrc32[3];
+        pSrc32 = &pSrc32[4];
+      }
+
+      for (i = count32b & 0x3U; i != 0U; i--)
+      {
+        *pFifo = *pSrc32;
+        pSrc32++;
+      }
+
+      return HAL_OK;
+    }
+
     for (i = 0U; i < count32b; i++)
     {
       USBx_DFIFO((uint32_t)ch_ep_num) = __UNALIGNED_UINT32_READ(pSrc);
@@ -1145,24 +1174,54 @@ HAL_StatusTypeDef USB_WritePacket(const USB_OTG_GlobalTypeDef *USBx, uint8_t *sr
   * @param  USBx  Selected device
   * @param  dest  source pointer
   * @param  len  Number of bytes to read
+  * @note   Destination buffers aligned on USB_BUFFER_ALIGNMENT are filled by bursts
+  *         of four words, others word by word with unaligned accesses.
   * @retval pointer to destination buffer
   */
 void *USB_ReadPacket(const USB_OTG_GlobalTypeDef *USBx, uint8_t *dest, uint16_t len)
 {
   uint32_t USBx_BASE = (uint32_t)USBx;
   uint8_t *pDest = dest;
+  uint32_t *pDest32;
+  __IO uint32_t *pFifo;
   uint32_t pData;
   uint32_t i;
   uint32_t count32b = (uint32_t)len >> 2U;
   uint16_t remaining_bytes = len % 4U;
 
-  for (i = 0U; i < count32b; i++)
+  if (((uint32_t)pDest & (USB_BUFFER_ALIGNMENT - 1U)) == 0U)
   {
-    __UNALIGNED_UINT32_WRITE(pDest, USBx_DFIFO(0U));
-    pDest++;
-    pDest++;
-    pDest++;
-    pDest++;
+    /* Aligned destination: burst the words out of the FIFO */
+    pDest32 = (uint32_t *)pDest;
+    pFifo = &USBx_DFIFO(0U);
+
+    for (i = count32b >> 2U; i != 0U; i--)
+    {
+      pDest32[0] = *pFifo;
+      pDest32[1] = *pFifo;
+      pDest32[2] = *pFifo;
+      pDest32[3] = *pFifo;
+      pDest32 = &pDest32[4];
+    }
+
+    for (i = count32b & 0x3U; i != 0U; i--)
+    {
+      *pDest32 = *pFifo;
+      pDest32++;
+    }
+
+    pDest = (uint8_t *)pDest32;
+  }
+  else
+  {
+    for (i = 0U; i < count32b; i++)
+    {
+      __UNALIGNED_UINT32_WRITE(pDest, USBx_DFIFO(0U));
+      pDest++;
+      pDest++;
+      pDest++;
+      pDest++;
+    }
   }
 
   /* When Number of data is not word aligned, read the remaining byte */
@@ -3218,6 +3277,8 @@ HAL_StatusTypeDef USB_DeActivateRemoteWakeup(USB_DRD_TypeDef *USBx)
   * @param   pbUsrBuf pointer to user memory area.
   * @param   wPMABufAddr address into PMA.
   * @param   wNBytes no. of bytes to be copied.
+  * @note    User buffers aligned on USB_BUFFER_ALIGNMENT are copied by bursts of
+  *          four words, others word by word with unaligned accesses.
   * @retval None
   */
 void USB_WritePMA(USB_DRD_TypeDef const *USBx, uint8_t *pbUsrBuf, uint16_t wPMABufAddr, uint16_t wNBytes)
@@ -3225,6 +3286,7 @@ void USB_WritePMA(USB_DRD_TypeDef const *USBx, uint8_t *pbUsrBuf, uint16_t wPMAB
   UNUSED(USBx);
   uint32_t WrVal;
   uint32_t count;
+  const uint32_t *pSrc32;
   __IO uint32_t *pdwVal;
   uint32_t NbWords = ((uint32_t)wNBytes + 3U) >> 2U;
   /* Due to the PMA access 32bit only so the last non word data should be processed alone */
@@ -3240,16 +3302,43 @@ void USB_WritePMA(USB_DRD_TypeDef const *USBx, uint8_t *pbUsrBuf, uint16_t wPMAB
   /* Get the PMA Buffer pointer */
   pdwVal = (__IO uint32_t *)(USB_DRD_PMAADDR + (uint32_t)wPMABufAddr);
 
-  /* Write the Calculated Word into the PMA related Buffer */
-  for (count = NbWords; count != 0U; count--)
+  if (((uint32_t)pBuf & (USB_BUFFER_ALIGNMENT - 1U)) == 0U)
   {
-    *pdwVal = __UNALIGNED_UINT32_READ(pBuf);
-    pdwVal++;
-    /* Increment pBuf 4 Time as Word Increment */
-    pBuf++;
-    pBuf++;
-    pBuf++;
-    pBuf++;
+    /* Aligned user buffer: copy by bursts of four words */
+    pSrc32 = (const uint32_t *)pBuf;
+
+    for (count = NbWords >> 2U; count != 0U; count--)
+    {
+      pdwVal[0] = pSrc32[0];
+      pdwVal[1] = pSrc32[1];
+      pdwVal[2] = pSrc32[2];
+      pdwVal[3] = pSrc32[3];
+      pdwVal = &pdwVal[4];
+      pSrc32 = &pSrc32[4];
+    }
+
+    for (count = NbWords & 0x3U; count != 0U; count--)
+    {
+      *pdwVal = *pSrc32;
+      pdwVal++;
+      pSrc32++;
+    }
+
+    pBuf = (uint8_t *)pSrc32;
+  }
+  else
+  {
+    /* Write the Calculated Word into the PMA related Buffer */
+    for (count = NbWords; count != 0U; count--)
+    {
+      *pdwVal = __UNALIGNED_UINT32_READ(pBuf);
+      pdwVal++;
+      /* Increment pBuf 4 Time as Word Increment */
+      pBuf++;
+      pBuf++;
+      pBuf++;
+      pBuf++;
+    }
   }
 
   /* When Number of data is not word aligned, write the remaining Byte */
@@ -3275,6 +3364,8 @@ void USB_WritePMA(USB_DRD_TypeDef const *USBx, uint8_t *pbUsrBuf, uint16_t wPMAB
   * @param   pbUsrBuf pointer to user memory area.
   * @param   wPMABufAddr address into PMA.
   * @param   wNBytes no. of bytes to be copied.
+  * @note    User buffers aligned on USB_BUFFER_ALIGNMENT are filled by bursts of
+  *          four words, others word by word with unaligned accesses.
   * @retval None
   */
 void USB_ReadPMA(USB_DRD_TypeDef const *USBx, uint8_t *pbUsrBuf, uint16_t wPMABufAddr, uint16_t wNBytes)
@@ -3282,6 +3373,7 @@ void USB_ReadPMA(USB_DRD_TypeDef const *USBx, uint8_t *pbUsrBuf, uint16_t wPMABu
   UNUSED(USBx);
   uint32_t count;
   uint32_t RdVal;
+  uint32_t *pDest32;
   __IO uint32_t *pdwVal;
   uint32_t NbWords = ((uint32_t)wNBytes + 3U) >> 2U;
   /*Due to the PMA access 32bit only so the last non word data should be processed alone */
@@ -3297,16 +3389,43 @@ void USB_ReadPMA(USB_DRD_TypeDef const *USBx, uint8_t *pbUsrBuf, uint16_t wPMABu
     NbWords--;
   }
 
-  /*Read the Calculated Word From the PMA related Buffer*/
-  for (count = NbWords; count != 0U; count--)
+  if (((uint32_t)pBuf & (USB_BUFFER_ALIGNMENT - 1U)) == 0U)
+  {
+    /* Aligned user buffer: copy by bursts of four words */
+    pDest32 = (uint32_t *)pBuf;
+
+    for (count = NbWords >> 2U; count != 0U; count--)
+    {
+      pDest32[0] = pdwVal[0];
+      pDest32[1] = pdwVal[1];
+      pDest32[2] = pdwVal[2];
+      pDest32[3] = pdwVal[3];
+      pdwVal = &pdwVal[4];
+      pDest32 = &pDest32[4];
+    }
+
+    for (count = NbWords & 0x3U; count != 0U; count--)
+    {
+      *pDest32 = *pdwVal;
+      pdwVal++;
+      pDest32++;
+    }
+
+    pBuf = (uint8_t *)pDest32;
+  }
+  else
   {
-    __UNALIGNED_UINT32_WRITE(pBuf, *pdwVal);
+    /*Read the Calculated Word From the PMA related Buffer*/
+    for (count = NbWords; count != 0U; count--)
+    {
+      __UNALIGNED_UINT32_WRITE(pBuf, *pdwVal);
 
-    pdwVal++;
-    pBuf++;
-    pBuf++;
-    pBuf++;
-    pBuf++;
+      pdwVal++;
+      pBuf++;
+      pBuf++;
+      pBuf++;
+      pBuf++;
+    }
   }
 
   /*When Number of data is not word aligned, read the remaining byte*/